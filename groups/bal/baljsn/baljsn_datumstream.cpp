@@ -0,0 +1,1061 @@
+// baljsn_datumstream.cpp                                             -*-C++-*-
+#include <baljsn_datumstream.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baljsn_datumstream_cpp,"$Id$ $CSID$")
+
+#include <baljsn_datumutil.h>                 // for testing
+#include <baljsn_encoderoptions.h>
+#include <baljsn_parserutil.h>
+#include <baljsn_tokenizer.h>
+
+#include <bdlb_numericparseutil.h>
+#include <bdld_datumarraybuilder.h>
+#include <bdld_datummapowningkeysbuilder.h>
+#include <bdlma_bufferedsequentialallocator.h>
+
+#include <bslma_default.h>
+
+#include <bsls_alignedbuffer.h>
+
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+namespace {
+
+typedef bsl::vector<bslstl::StringRef> Path;
+typedef bsl::vector<bsl::size_t>       Indices;
+
+enum {
+    k_ALL_PATHS_RESOLVED = 1  // status indicating that projection is complete
+};
+
+struct ProjectionContext {
+    // This 'struct' holds the state shared by the functions that implement
+    // 'DatumStreamUtil::decodePaths'.
+
+    // CREATORS
+    ProjectionContext(Tokenizer          *tokenizer,
+                      bsl::ostream       *errorStream,
+                      bdld::ManagedDatum *results,
+                      bsl::size_t         numPaths,
+                      bslma::Allocator   *allocator)
+        // Create a context for resolving the specified 'numPaths' paths into
+        // the specified 'results' from the document read by the specified
+        // 'tokenizer', reporting errors to the specified 'errorStream', and
+        // using the specified 'allocator' to supply scratch memory.  The
+        // paths are initially empty and unresolved.
+    : d_tokenizer_p(tokenizer)
+    , d_errorStream_p(errorStream)
+    , d_results_p(results)
+    , d_paths(numPaths, Path(allocator), allocator)
+    , d_isResolved(numPaths, 0, allocator)
+    , d_numUnresolved(numPaths)
+    , d_buffer(allocator)
+    , d_allocator_p(allocator)
+    {
+    }
+
+    // DATA
+
+    Tokenizer           *d_tokenizer_p;    // tokenizer (held, not owned)
+
+    bsl::ostream        *d_errorStream_p;  // error stream (held, not owned)
+
+    bdld::ManagedDatum  *d_results_p;      // results (held, not owned)
+
+    bsl::vector<Path>    d_paths;          // segments of each path
+
+    bsl::vector<char>    d_isResolved;     // whether each path has selected
+                                           // a value
+
+    bsl::size_t          d_numUnresolved;  // number of paths that have not
+                                           // selected a value
+
+    bsl::string          d_buffer;         // scratch buffer for strings
+
+    bslma::Allocator    *d_allocator_p;    // scratch allocator (held, not
+                                           // owned)
+};
+
+EncoderOptions makeEncoderOptions(const DatumEncoderOptions& options)
+    // Return the 'EncoderOptions' that format JSON text as specified by the
+    // specified 'options'.
+{
+    EncoderOptions encoderOptions;
+
+    encoderOptions.setEncodingStyle(options.encodingStyle());
+    encoderOptions.setInitialIndentLevel(options.initialIndentLevel());
+    encoderOptions.setSpacesPerLevel(options.spacesPerLevel());
+
+    return encoderOptions;
+}
+
+int advance(Tokenizer *tokenizer, bsl::ostream *errorStream)
+    // Advance the specified 'tokenizer' to the next token, reporting any
+    // error to the specified 'errorStream' if it is non-null.  Return 0 on
+    // success, and a non-zero value otherwise.
+{
+    if (0 != tokenizer->advanceToNextToken()
+     || Tokenizer::e_ERROR == tokenizer->tokenType()) {
+        if (errorStream) {
+            *errorStream << "Unexpected token or end of input\n";
+        }
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+int extractScalar(bdld::Datum       *result,
+                  bsl::string       *buffer,
+                  Tokenizer         *tokenizer,
+                  bslma::Allocator  *allocator)
+    // Load into the specified 'result' the value of the current
+    // 'e_ELEMENT_VALUE' token of the specified 'tokenizer'.  A string value
+    // refers to the specified 'buffer', and any memory needed to refer to it
+    // is supplied by the specified 'allocator' and need not be released.
+    // Return 0 on success, and a non-zero value if the token is not a valid
+    // JSON scalar.
+{
+    bslstl::StringRef value;
+    if (0 != tokenizer->value(&value) || value.isEmpty()) {
+        return -1;                                                    // RETURN
+    }
+
+    if ('"' == value[0]) {
+        if (0 != ParserUtil::getValue(buffer, value)) {
+            return -1;                                                // RETURN
+        }
+        *result = bdld::Datum::createStringRef(buffer->data(),
+                                               buffer->length(),
+                                               allocator);
+        return 0;                                                     // RETURN
+    }
+
+    if ("true" == value || "false" == value) {
+        *result = bdld::Datum::createBoolean("true" == value);
+        return 0;                                                     // RETURN
+    }
+
+    if ("null" == value) {
+        *result = bdld::Datum::createNull();
+        return 0;                                                     // RETURN
+    }
+
+    double            d;
+    bslstl::StringRef remainder;
+    if (0 == bdlb::NumericParseUtil::parseDouble(&d, &remainder, value) &&
+        0 == remainder.length()) {
+        *result = bdld::Datum::createDouble(d);
+        return 0;                                                     // RETURN
+    }
+
+    return -1;
+}
+
+int parseValue(DatumStreamHandler *handler,
+               bsl::ostream       *errorStream,
+               Tokenizer          *tokenizer,
+               bsl::string        *buffer,
+               bslma::Allocator   *allocator)
+    // Deliver to the specified 'handler' the events describing the value
+    // whose first token is the current token of the specified 'tokenizer',
+    // leaving 'tokenizer' at the last token of that value.  Use the specified
+    // 'buffer' to hold string values, and the specified 'allocator' to supply
+    // any other scratch memory.  Report errors to the specified
+    // 'errorStream' if it is non-null.  Return 0 on success, the non-zero
+    // value returned by 'handler' if it stops parsing, and a negative value if
+    // the value is ill-formed.
+{
+    int rc;
+
+    switch (tokenizer->tokenType()) {
+      case Tokenizer::e_START_OBJECT: {
+        if (0 != (rc = handler->startObject())) {
+            return rc;                                                // RETURN
+        }
+        if (0 != advance(tokenizer, errorStream)) {
+            return -1;                                                // RETURN
+        }
+        while (Tokenizer::e_END_OBJECT != tokenizer->tokenType()) {
+            if (Tokenizer::e_ELEMENT_NAME != tokenizer->tokenType()) {
+                if (errorStream) {
+                    *errorStream << "Expected a member name\n";
+                }
+                return -2;                                            // RETURN
+            }
+
+            bslstl::StringRef name;
+            tokenizer->value(&name);
+            if (0 != (rc = handler->memberName(name))) {
+                return rc;                                            // RETURN
+            }
+
+            if (0 != advance(tokenizer, errorStream)) {
+                return -1;                                            // RETURN
+            }
+            if (0 != (rc = parseValue(handler,
+                                      errorStream,
+                                      tokenizer,
+                                      buffer,
+                                      allocator))) {
+                return rc;                                            // RETURN
+            }
+            if (0 != advance(tokenizer, errorStream)) {
+                return -1;                                            // RETURN
+            }
+        }
+        return handler->endObject();                                  // RETURN
+      }
+      case Tokenizer::e_START_ARRAY: {
+        if (0 != (rc = handler->startArray())) {
+            return rc;                                                // RETURN
+        }
+        if (0 != advance(tokenizer, errorStream)) {
+            return -1;                                                // RETURN
+        }
+        while (Tokenizer::e_END_ARRAY != tokenizer->tokenType()) {
+            if (0 != (rc = parseValue(handler,
+                                      errorStream,
+                                      tokenizer,
+                                      buffer,
+                                      allocator))) {
+                return rc;                                            // RETURN
+            }
+            if (0 != advance(tokenizer, errorStream)) {
+                return -1;                                            // RETURN
+            }
+        }
+        return handler->endArray();                                   // RETURN
+      }
+      case Tokenizer::e_ELEMENT_VALUE: {
+        bdld::Datum value;
+        if (0 != extractScalar(&value, buffer, tokenizer, allocator)) {
+            if (errorStream) {
+                *errorStream << "Invalid value\n";
+            }
+            return -3;                                                // RETURN
+        }
+        return handler->value(value);                                 // RETURN
+      }
+      default: {
+        if (errorStream) {
+            *errorStream << "Unexpected token: "
+                         << tokenizer->tokenType() << '\n';
+        }
+      } break;
+    }
+    return -4;
+}
+
+int skipValue(Tokenizer *tokenizer, bsl::ostream *errorStream)
+    // Advance the specified 'tokenizer' from the first token of the current
+    // value to the last token of that value without interpreting it.  Report
+    // errors to the specified 'errorStream' if it is non-null.  Return 0 on
+    // success, and a negative value otherwise.
+{
+    int depth = 0;
+    do {
+        switch (tokenizer->tokenType()) {
+          case Tokenizer::e_START_OBJECT:
+          case Tokenizer::e_START_ARRAY: {
+            ++depth;
+          } break;
+          case Tokenizer::e_END_OBJECT:
+          case Tokenizer::e_END_ARRAY: {
+            --depth;
+          } break;
+          case Tokenizer::e_ELEMENT_NAME:
+          case Tokenizer::e_ELEMENT_VALUE: {
+          } break;
+          default: {
+            if (errorStream) {
+                *errorStream << "Unexpected token: "
+                             << tokenizer->tokenType() << '\n';
+            }
+            return -1;                                                // RETURN
+          }
+        }
+        if (0 < depth && 0 != advance(tokenizer, errorStream)) {
+            return -1;                                                // RETURN
+        }
+    } while (0 < depth);
+
+    return 0 == depth ? 0 : -1;
+}
+
+int parseIndex(bsl::size_t *result, const bslstl::StringRef& segment)
+    // Load into the specified 'result' the array index represented by the
+    // specified 'segment'.  Return 0 on success, and a non-zero value if
+    // 'segment' is not a non-empty sequence of decimal digits.
+{
+    if (segment.isEmpty()) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::size_t index = 0;
+    for (bsl::size_t i = 0; i < segment.length(); ++i) {
+        const char ch = segment[i];
+        if (ch < '0' || '9' < ch) {
+            return -1;                                                // RETURN
+        }
+        index = index * 10 + (ch - '0');
+    }
+    *result = index;
+    return 0;
+}
+
+const bdld::Datum *findPath(const bdld::Datum& datum,
+                            const Path&        path,
+                            bsl::size_t        depth)
+    // Return the address of the value within the specified 'datum' that is
+    // selected by the segments of the specified 'path' following the first
+    // specified 'depth' segments, or 0 if there is no such value.
+{
+    const bdld::Datum *current = &datum;
+    for (bsl::size_t i = depth; current && i < path.size(); ++i) {
+        if (current->isMap()) {
+            current = current->theMap().find(path[i]);
+        }
+        else if (current->isArray()) {
+            bsl::size_t index;
+            if (0 == parseIndex(&index, path[i])
+             && index < current->theArray().length()) {
+                current = &current->theArray()[index];
+            }
+            else {
+                current = 0;
+            }
+        }
+        else {
+            current = 0;
+        }
+    }
+    return current;
+}
+
+void resolve(ProjectionContext *context, bsl::size_t index)
+    // Mark the path at the specified 'index' in the specified 'context' as
+    // having selected a value.
+{
+    context->d_isResolved[index] = true;
+    --context->d_numUnresolved;
+}
+
+int projectValue(ProjectionContext *context,
+                 const Indices&     candidates,
+                 bsl::size_t        depth)
+    // Decode into the results of the specified 'context' the values selected
+    // by the paths having the specified 'candidates' indices within the value
+    // whose first token is the current token of the tokenizer of 'context',
+    // leaving the tokenizer at the last token of that value.  The first
+    // specified 'depth' segments of each candidate path select the current
+    // value.  Return 0 on success, 'k_ALL_PATHS_RESOLVED' if every path of
+    // 'context' has selected a value (in which case the tokenizer is left at
+    // an unspecified token), and a negative value if the document is
+    // ill-formed.
+{
+    Tokenizer *tokenizer = context->d_tokenizer_p;
+
+    // Partition the unresolved candidates into those that select this value,
+    // and those that select a value nested within it.
+
+    bsl::size_t first = context->d_paths.size();
+    Indices     deeper(context->d_allocator_p);
+
+    for (bsl::size_t i = 0; i < candidates.size(); ++i) {
+        const bsl::size_t index = candidates[i];
+        if (context->d_isResolved[index]) {
+            continue;                                               // CONTINUE
+        }
+        if (depth == context->d_paths[index].size()) {
+            if (first == context->d_paths.size()) {
+                first = index;
+            }
+        }
+        else {
+            deeper.push_back(index);
+        }
+    }
+
+    if (first != context->d_paths.size()) {
+        // Decode this value, then resolve every candidate from it.
+
+        bdld::ManagedDatum& result = context->d_results_p[first];
+
+        DatumStreamBuilder builder(result.allocator());
+        const int          rc = parseValue(&builder,
+                                           context->d_errorStream_p,
+                                           tokenizer,
+                                           &context->d_buffer,
+                                           context->d_allocator_p);
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+        result.adopt(builder.release());
+        resolve(context, first);
+
+        for (bsl::size_t i = 0; i < candidates.size(); ++i) {
+            const bsl::size_t index = candidates[i];
+            if (context->d_isResolved[index]) {
+                continue;                                           // CONTINUE
+            }
+            const bdld::Datum *value = findPath(result.datum(),
+                                                context->d_paths[index],
+                                                depth);
+            if (value) {
+                context->d_results_p[index].clone(*value);
+                resolve(context, index);
+            }
+        }
+        return 0 == context->d_numUnresolved ? k_ALL_PATHS_RESOLVED : 0;
+                                                                      // RETURN
+    }
+
+    if (deeper.empty()
+     || (Tokenizer::e_START_OBJECT != tokenizer->tokenType()
+      && Tokenizer::e_START_ARRAY  != tokenizer->tokenType())) {
+        return skipValue(tokenizer, context->d_errorStream_p);        // RETURN
+    }
+
+    const bool isObject = Tokenizer::e_START_OBJECT == tokenizer->tokenType();
+    const Tokenizer::TokenType endToken = isObject
+                                          ? Tokenizer::e_END_OBJECT
+                                          : Tokenizer::e_END_ARRAY;
+
+    Indices                  selected(context->d_allocator_p);
+    bsl::vector<bsl::string> seenNames(context->d_allocator_p);
+    bsl::size_t              elementIndex = 0;
+
+    if (0 != advance(tokenizer, context->d_errorStream_p)) {
+        return -1;                                                    // RETURN
+    }
+
+    while (endToken != tokenizer->tokenType()) {
+        selected.clear();
+
+        if (isObject) {
+            if (Tokenizer::e_ELEMENT_NAME != tokenizer->tokenType()) {
+                if (context->d_errorStream_p) {
+                    *context->d_errorStream_p << "Expected a member name\n";
+                }
+                return -2;                                            // RETURN
+            }
+
+            bslstl::StringRef name;
+            tokenizer->value(&name);
+
+            // Only the first member having a given name is considered.
+
+            bool isDuplicate = false;
+            for (bsl::size_t i = 0; !isDuplicate && i < seenNames.size();
+                                                                         ++i) {
+                isDuplicate = name == seenNames[i];
+            }
+
+            if (!isDuplicate) {
+                for (bsl::size_t i = 0; i < deeper.size(); ++i) {
+                    if (name == context->d_paths[deeper[i]][depth]) {
+                        selected.push_back(deeper[i]);
+                    }
+                }
+                if (!selected.empty()) {
+                    seenNames.resize(seenNames.size() + 1);
+                    seenNames.back().assign(name.data(), name.length());
+                }
+            }
+
+            if (0 != advance(tokenizer, context->d_errorStream_p)) {
+                return -1;                                            // RETURN
+            }
+        }
+        else {
+            for (bsl::size_t i = 0; i < deeper.size(); ++i) {
+                bsl::size_t index;
+                if (0 == parseIndex(&index, context->d_paths[deeper[i]][depth])
+                 && index == elementIndex) {
+                    selected.push_back(deeper[i]);
+                }
+            }
+            ++elementIndex;
+        }
+
+        const int rc = selected.empty()
+                       ? skipValue(tokenizer, context->d_errorStream_p)
+                       : projectValue(context, selected, depth + 1);
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+
+        if (0 != advance(tokenizer, context->d_errorStream_p)) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    return 0;
+}
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // class DatumStreamHandler
+                          // ------------------------
+
+// CREATORS
+DatumStreamHandler::~DatumStreamHandler()
+{
+}
+
+                          // ------------------------
+                          // class DatumStreamEncoder
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+void DatumStreamEncoder::openPendingArray()
+{
+    if (d_arrayPending) {
+        d_arrayPending = false;
+        d_formatter.openArray();
+    }
+}
+
+// CREATORS
+DatumStreamEncoder::DatumStreamEncoder(bsl::ostream&     stream,
+                                       bslma::Allocator *basicAllocator)
+: d_formatter(stream, basicAllocator)
+, d_strictTypes(false)
+, d_foundCheckFailures(false)
+, d_arrayPending(false)
+{
+}
+
+DatumStreamEncoder::DatumStreamEncoder(
+                                   bsl::ostream&               stream,
+                                   const DatumEncoderOptions&  options,
+                                   bslma::Allocator           *basicAllocator)
+: d_formatter(stream, makeEncoderOptions(options), basicAllocator)
+, d_strictTypes(options.strictTypes())
+, d_foundCheckFailures(false)
+, d_arrayPending(false)
+{
+}
+
+DatumStreamEncoder::~DatumStreamEncoder()
+{
+}
+
+// MANIPULATORS
+int DatumStreamEncoder::startObject()
+{
+    openPendingArray();
+    d_formatter.openObject();
+    return 0;
+}
+
+int DatumStreamEncoder::memberName(const bslstl::StringRef& name)
+{
+    d_formatter.addMemberName(name);
+    return 0;
+}
+
+int DatumStreamEncoder::endObject()
+{
+    d_formatter.closeObject();
+    return 0;
+}
+
+int DatumStreamEncoder::startArray()
+{
+    // Opening the array is deferred until its first element, or its end, is
+    // received, so that an empty array is formatted as such.
+
+    openPendingArray();
+    d_arrayPending = true;
+    return 0;
+}
+
+int DatumStreamEncoder::endArray()
+{
+    if (d_arrayPending) {
+        d_arrayPending = false;
+        d_formatter.openArray(SimpleFormatter::e_EMPTY_ARRAY_FORMAT);
+        d_formatter.closeArray(SimpleFormatter::e_EMPTY_ARRAY_FORMAT);
+    }
+    else {
+        d_formatter.closeArray();
+    }
+    return 0;
+}
+
+int DatumStreamEncoder::value(const bdld::Datum& value)
+{
+    switch (value.type()) {
+      case bdld::Datum::e_MAP:
+      case bdld::Datum::e_ARRAY: {
+        return DatumStreamUtil::generate(this, value);                // RETURN
+      }
+      case bdld::Datum::e_NIL: {
+        openPendingArray();
+        d_formatter.addNullValue();
+      } break;
+      case bdld::Datum::e_BOOLEAN: {
+        openPendingArray();
+        d_formatter.addValue(value.theBoolean());
+      } break;
+      case bdld::Datum::e_REAL: {
+        openPendingArray();
+        d_formatter.addValue(value.theDouble());
+      } break;
+      case bdld::Datum::e_STRING: {
+        openPendingArray();
+        d_formatter.addValue(value.theString());
+      } break;
+      case bdld::Datum::e_INTEGER: {
+        openPendingArray();
+        d_formatter.addValue(value.theInteger());
+        d_foundCheckFailures = true;
+      } break;
+      case bdld::Datum::e_INTEGER64: {
+        openPendingArray();
+        d_formatter.addValue(static_cast<double>(value.theInteger64()));
+        d_foundCheckFailures = true;
+      } break;
+      case bdld::Datum::e_DECIMAL64: {
+        openPendingArray();
+        d_formatter.addValue(value.theDecimal64());
+        d_foundCheckFailures = true;
+      } break;
+      case bdld::Datum::e_DATE: {
+        openPendingArray();
+        d_formatter.addValue(value.theDate());
+        d_foundCheckFailures = true;
+      } break;
+      case bdld::Datum::e_TIME: {
+        openPendingArray();
+        d_formatter.addValue(value.theTime());
+        d_foundCheckFailures = true;
+      } break;
+      case bdld::Datum::e_DATETIME: {
+        openPendingArray();
+        d_formatter.addValue(value.theDatetime());
+        d_foundCheckFailures = true;
+      } break;
+      case bdld::Datum::e_DATETIME_INTERVAL: {
+        openPendingArray();
+        d_formatter.addValue(value.theDatetimeInterval());
+        d_foundCheckFailures = true;
+      } break;
+      default: {
+        d_foundCheckFailures = true;
+        return -1;                                                    // RETURN
+      }
+    }
+    return 0;
+}
+
+                          // ------------------------
+                          // class DatumStreamBuilder
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+int DatumStreamBuilder::endContainer(bool isObject)
+{
+    if (d_frames.empty() || isObject != d_frames.back().d_isObject) {
+        return -1;                                                    // RETURN
+    }
+
+    const Frame       frame     = d_frames.back();
+    const bsl::size_t numValues = d_values.size() - frame.d_firstValue;
+
+    if (isObject && d_keyOffsets.size() - frame.d_firstKey != numValues) {
+        return -2;                                                    // RETURN
+    }
+
+    // Ensure that the built container can be added to 'd_values' without
+    // allocating, once its elements have been removed.
+
+    d_values.reserve(frame.d_firstValue + 1);
+
+    bdld::Datum        *values = d_values.data() + frame.d_firstValue;
+    const bdld::Datum::SizeType size =
+                                 static_cast<bdld::Datum::SizeType>(numValues);
+    bdld::Datum         container;
+
+    if (isObject) {
+        // Keep the *first* instance of any duplicate keys, consistent with
+        // 'DatumUtil::decode'.
+
+        bsl::vector<bdld::DatumMapEntry> entries(d_allocator_p);
+        bsl::vector<bdld::Datum>         duplicates(d_allocator_p);
+
+        entries.reserve(numValues);
+        duplicates.reserve(numValues);
+        d_seenKeys.clear();
+
+        bsl::size_t keysLength = 0;
+        for (bsl::size_t i = 0; i < numValues; ++i) {
+            const bsl::size_t keyIndex = frame.d_firstKey + i;
+            const bsl::size_t begin    = d_keyOffsets[keyIndex];
+            const bsl::size_t end      = keyIndex + 1 < d_keyOffsets.size()
+                                         ? d_keyOffsets[keyIndex + 1]
+                                         : d_keys.length();
+            const bslstl::StringRef key(d_keys.data() + begin, end - begin);
+
+            if (d_seenKeys.insert(key).second) {
+                entries.push_back(bdld::DatumMapEntry(key, values[i]));
+                keysLength += key.length();
+            }
+            else {
+                duplicates.push_back(values[i]);
+            }
+        }
+
+        bdld::DatumMapOwningKeysBuilder builder(
+                           static_cast<bdld::Datum::SizeType>(entries.size()),
+                           static_cast<bdld::Datum::SizeType>(keysLength),
+                           d_allocator_p);
+        if (!entries.empty()) {
+            builder.append(entries.data(),
+                           static_cast<bdld::Datum::SizeType>(entries.size()));
+        }
+
+        // The builder now owns the retained values; no further operation can
+        // throw.
+
+        for (bsl::size_t i = 0; i < duplicates.size(); ++i) {
+            bdld::Datum::destroy(duplicates[i], d_allocator_p);
+        }
+        container = builder.commit();
+
+        if (frame.d_firstKey < d_keyOffsets.size()) {
+            d_keys.resize(d_keyOffsets[frame.d_firstKey]);
+            d_keyOffsets.resize(frame.d_firstKey);
+        }
+    }
+    else {
+        bdld::DatumArrayBuilder builder(size, d_allocator_p);
+        if (0 != size) {
+            builder.append(values, size);
+        }
+        container = builder.commit();
+    }
+
+    d_values.resize(frame.d_firstValue);
+    d_frames.pop_back();
+
+    addValue(container);
+    return 0;
+}
+
+int DatumStreamBuilder::prepareToAddValue()
+{
+    if (d_frames.empty()) {
+        return d_isComplete ? -1 : 0;                                 // RETURN
+    }
+
+    const Frame&      frame     = d_frames.back();
+    const bsl::size_t numKeys   = d_keyOffsets.size() - frame.d_firstKey;
+    const bsl::size_t numValues = d_values.size() - frame.d_firstValue;
+
+    if (frame.d_isObject && numKeys != numValues + 1) {
+        return -2;                                                    // RETURN
+    }
+
+    d_values.reserve(d_values.size() + 1);
+    return 0;
+}
+
+void DatumStreamBuilder::addValue(const bdld::Datum& value)
+{
+    if (d_frames.empty()) {
+        d_result     = value;
+        d_isComplete = true;
+    }
+    else {
+        BSLS_ASSERT(d_values.size() < d_values.capacity());
+
+        d_values.push_back(value);
+    }
+}
+
+// CREATORS
+DatumStreamBuilder::DatumStreamBuilder(bslma::Allocator *basicAllocator)
+: d_values(basicAllocator)
+, d_keys(basicAllocator)
+, d_keyOffsets(basicAllocator)
+, d_frames(basicAllocator)
+, d_seenKeys(basicAllocator)
+, d_result(bdld::Datum::createNull())
+, d_isComplete(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+DatumStreamBuilder::~DatumStreamBuilder()
+{
+    reset();
+}
+
+// MANIPULATORS
+int DatumStreamBuilder::startObject()
+{
+    if (0 != prepareToAddValue()) {
+        return -1;                                                    // RETURN
+    }
+
+    Frame frame;
+    frame.d_firstValue = d_values.size();
+    frame.d_firstKey   = d_keyOffsets.size();
+    frame.d_isObject   = true;
+    d_frames.push_back(frame);
+    return 0;
+}
+
+int DatumStreamBuilder::memberName(const bslstl::StringRef& name)
+{
+    if (d_frames.empty()
+     || !d_frames.back().d_isObject
+     || d_keyOffsets.size() - d_frames.back().d_firstKey
+                           != d_values.size() - d_frames.back().d_firstValue) {
+        return -1;                                                    // RETURN
+    }
+
+    d_keyOffsets.push_back(d_keys.length());
+    d_keys.append(name.data(), name.length());
+    return 0;
+}
+
+int DatumStreamBuilder::endObject()
+{
+    return endContainer(true);
+}
+
+int DatumStreamBuilder::startArray()
+{
+    if (0 != prepareToAddValue()) {
+        return -1;                                                    // RETURN
+    }
+
+    Frame frame;
+    frame.d_firstValue = d_values.size();
+    frame.d_firstKey   = d_keyOffsets.size();
+    frame.d_isObject   = false;
+    d_frames.push_back(frame);
+    return 0;
+}
+
+int DatumStreamBuilder::endArray()
+{
+    return endContainer(false);
+}
+
+int DatumStreamBuilder::value(const bdld::Datum& value)
+{
+    if (0 != prepareToAddValue()) {
+        return -1;                                                    // RETURN
+    }
+
+    addValue(value.clone(d_allocator_p));
+    return 0;
+}
+
+bdld::Datum DatumStreamBuilder::release()
+{
+    BSLS_ASSERT(d_isComplete);
+
+    bdld::Datum result = d_result;
+    d_result     = bdld::Datum::createNull();
+    d_isComplete = false;
+    return result;
+}
+
+void DatumStreamBuilder::reset()
+{
+    for (bsl::size_t i = 0; i < d_values.size(); ++i) {
+        bdld::Datum::destroy(d_values[i], d_allocator_p);
+    }
+    d_values.clear();
+    d_keys.clear();
+    d_keyOffsets.clear();
+    d_frames.clear();
+
+    bdld::Datum::destroy(d_result, d_allocator_p);
+    d_result     = bdld::Datum::createNull();
+    d_isComplete = false;
+}
+
+                           // ----------------------
+                           // struct DatumStreamUtil
+                           // ----------------------
+
+// CLASS METHODS
+int DatumStreamUtil::decodePaths(bdld::ManagedDatum       *results,
+                                 bsl::ostream             *errorStream,
+                                 bsl::streambuf           *jsonBuffer,
+                                 const bslstl::StringRef  *paths,
+                                 bsl::size_t               numPaths)
+{
+    BSLS_ASSERT(results || 0 == numPaths);
+    BSLS_ASSERT(paths   || 0 == numPaths);
+    BSLS_ASSERT(jsonBuffer);
+
+    for (bsl::size_t i = 0; i < numPaths; ++i) {
+        results[i].makeNull();
+    }
+
+    if (0 == numPaths) {
+        return 0;                                                     // RETURN
+    }
+
+    bsls::AlignedBuffer<8 * 1024>      buffer;
+    bdlma::BufferedSequentialAllocator bsa(buffer.buffer(), sizeof(buffer));
+
+    Tokenizer tokenizer(&bsa);
+    tokenizer.reset(jsonBuffer);
+
+    ProjectionContext context(&tokenizer,
+                              errorStream,
+                              results,
+                              numPaths,
+                              &bsa);
+
+    Indices candidates(numPaths, 0, &bsa);
+
+    for (bsl::size_t i = 0; i < numPaths; ++i) {
+        candidates[i] = i;
+
+        const bslstl::StringRef& path = paths[i];
+        if (path.isEmpty()) {
+            continue;                                               // CONTINUE
+        }
+
+        bsl::size_t begin = 0;
+        for (bsl::size_t end = 0; end <= path.length(); ++end) {
+            if (end == path.length() || '.' == path[end]) {
+                context.d_paths[i].push_back(
+                                  bslstl::StringRef(path.data() + begin,
+                                                    end - begin));
+                begin = end + 1;
+            }
+        }
+    }
+
+    int rc = advance(&tokenizer, errorStream);
+    if (0 == rc) {
+        rc = projectValue(&context, candidates, 0);
+    }
+
+    if (0 == rc && 0 == tokenizer.advanceToNextToken()) {
+        if (errorStream) {
+            *errorStream << "Extra token detected after value\n";
+        }
+        rc = -5;
+    }
+
+    if (0 > rc) {
+        for (bsl::size_t i = 0; i < numPaths; ++i) {
+            results[i].makeNull();
+        }
+        return rc;                                                    // RETURN
+    }
+
+    return 0;
+}
+
+int DatumStreamUtil::generate(DatumStreamHandler *handler,
+                              const bdld::Datum&  datum)
+{
+    BSLS_ASSERT(handler);
+
+    int rc;
+
+    switch (datum.type()) {
+      case bdld::Datum::e_MAP: {
+        const bdld::DatumMapRef map = datum.theMap();
+
+        if (0 != (rc = handler->startObject())) {
+            return rc;                                                // RETURN
+        }
+        for (bdld::Datum::SizeType i = 0; i < map.size(); ++i) {
+            if (0 != (rc = handler->memberName(map[i].key()))
+             || 0 != (rc = generate(handler, map[i].value()))) {
+                return rc;                                            // RETURN
+            }
+        }
+        return handler->endObject();                                  // RETURN
+      }
+      case bdld::Datum::e_ARRAY: {
+        const bdld::DatumArrayRef array = datum.theArray();
+
+        if (0 != (rc = handler->startArray())) {
+            return rc;                                                // RETURN
+        }
+        for (bdld::Datum::SizeType i = 0; i < array.length(); ++i) {
+            if (0 != (rc = generate(handler, array[i]))) {
+                return rc;                                            // RETURN
+            }
+        }
+        return handler->endArray();                                   // RETURN
+      }
+      default: {
+      } break;
+    }
+    return handler->value(datum);
+}
+
+int DatumStreamUtil::parse(DatumStreamHandler *handler,
+                           bsl::ostream       *errorStream,
+                           bsl::streambuf     *jsonBuffer)
+{
+    BSLS_ASSERT(handler);
+    BSLS_ASSERT(jsonBuffer);
+
+    bsls::AlignedBuffer<8 * 1024>      buffer;
+    bdlma::BufferedSequentialAllocator bsa(buffer.buffer(), sizeof(buffer));
+
+    Tokenizer tokenizer(&bsa);
+    tokenizer.reset(jsonBuffer);
+
+    // Advance from e_BEGIN
+
+    if (0 != advance(&tokenizer, errorStream)) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::string stringBuffer(&bsa);
+
+    int rc = parseValue(handler, errorStream, &tokenizer, &stringBuffer, &bsa);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    if (0 == tokenizer.advanceToNextToken()) {
+        if (errorStream) {
+            *errorStream << "Extra token detected after value\n";
+        }
+        return -5;                                                    // RETURN
+    }
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,730 @@
+// baljsn_datumstream.h                                               -*-C++-*-
+#ifndef INCLUDED_BALJSN_DATUMSTREAM
+#define INCLUDED_BALJSN_DATUMSTREAM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide event-driven conversion between 'bdld::Datum' and JSON.
+//
+//@CLASSES:
+//  baljsn::DatumStreamHandler: protocol for receiving JSON/'Datum' events
+//  baljsn::DatumStreamEncoder: handler writing events as JSON text
+//  baljsn::DatumStreamBuilder: handler building a 'bdld::Datum' from events
+//  baljsn::DatumStreamUtil: event sources and path-based JSON projection
+//
+//@SEE_ALSO: baljsn_datumutil, baljsn_tokenizer, baljsn_simpleformatter
+//
+//@DESCRIPTION: This component provides a protocol,
+// 'baljsn::DatumStreamHandler', through which a JSON document (or a
+// 'bdld::Datum' having the same shape) is described as a sequence of events
+// -- 'startObject', 'memberName', 'endObject', 'startArray', 'endArray', and
+// 'value' -- in the style of a SAX parser.  Two concrete handlers are
+// provided: 'baljsn::DatumStreamEncoder', which writes the events it receives
+// as JSON text using a 'baljsn::SimpleFormatter', and
+// 'baljsn::DatumStreamBuilder', which builds a 'bdld::Datum' from the events
+// it receives.  The 'struct' 'baljsn::DatumStreamUtil' provides the two event
+// sources: 'parse', which tokenizes JSON text using a 'baljsn::Tokenizer', and
+// 'generate', which walks an existing 'bdld::Datum'.
+//
+// Any source may be connected to any handler, and a client-defined handler
+// may be interposed between them to filter or transform the document as it
+// streams by.  In particular, a document may be re-encoded, or decoded into a
+// 'Datum', without first building the intermediate 'Datum' tree that
+// 'baljsn::DatumUtil' would create.
+//
+// 'DatumStreamUtil' also provides 'decodePaths', which extracts a handful of
+// values from a (possibly very large) JSON document.  Only the values
+// addressed by the supplied paths are decoded into 'Datum' objects; all other
+// values are skipped at the token level, without interpreting their contents
+// or allocating memory for them, and reading stops as soon as every path has
+// been resolved.
+//
+///Events
+///------
+// A well-formed sequence of events describes exactly one JSON value.  An
+// object is described by 'startObject', followed by a 'memberName' and a
+// value for each member, followed by 'endObject'.  An array is described by
+// 'startArray', followed by a value for each element, followed by 'endArray'.
+// A scalar value is described by a single call to 'value'.
+//
+// Each manipulator of 'DatumStreamHandler' returns an 'int': a handler
+// returns 0 to continue, and a non-zero value to stop the source, which then
+// returns that value to its caller.  Handlers that wish to distinguish their
+// own status from the negative status reported by 'parse' for ill-formed
+// input should return positive values.
+//
+// The 'Datum' passed to 'value' by 'parse' is always one of the types produced
+// by 'baljsn::DatumUtil::decode' -- null, boolean, double, or string -- and a
+// string value refers to storage that is valid only for the duration of the
+// call.  Similarly, the name passed to 'memberName' is valid only for the
+// duration of the call.  The 'Datum' passed to 'value' by 'generate' is any
+// 'Datum' that is neither an array nor a map.  Both concrete handlers also
+// accept arrays and maps in 'value', treating them as though the
+// corresponding sequence of events had been received.
+//
+///Paths
+///-----
+// A path supplied to 'decodePaths' is a sequence of segments separated by
+// '.'.  Within an object, a segment selects the member having that name;
+// within an array, a segment consisting only of decimal digits selects the
+// element having that index.  The empty path selects the entire document.
+// For example, given the document:
+//..
+//  { "order": { "id": "A7", "fills": [ { "qty": 100 }, { "qty": 25 } ] } }
+//..
+// the path "order.id" selects '"A7"', the path "order.fills.1.qty" selects
+// '25', and the path "order.fills.2.qty" selects nothing.  Note that a member
+// whose name contains a '.' cannot be selected.
+//
+// Consistent with 'baljsn::DatumUtil::decode', if an object contains several
+// members having the same name, only the *first* such member is considered.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Extracting a Few Fields From a Large Document
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a gateway receives large JSON documents, of which it needs
+// only a couple of fields.  Decoding each document into a 'bdld::Datum' would
+// allocate memory for every value, when only two are required.
+//
+// First, we define the document (which, in practice, would be far larger):
+//..
+//  const char *const JSON = "{"
+//                           "  \"header\": { \"id\": \"T-1\", \"v\": 2 },"
+//                           "  \"rows\": [ [1, 2, 3], [4, 5, 6] ],"
+//                           "  \"owner\": { \"name\": \"Jo\" }"
+//                           "}";
+//..
+// Then, we describe the values we need:
+//..
+//  const bslstl::StringRef PATHS[] = { "header.id", "owner.name" };
+//  const bsl::size_t       NUM_PATHS = sizeof PATHS / sizeof *PATHS;
+//..
+// Next, we extract them, using a 'bdlsb::FixedMemInStreamBuf' to present the
+// document as a 'bsl::streambuf':
+//..
+//  bdld::ManagedDatum results[NUM_PATHS];
+//
+//  bdlsb::FixedMemInStreamBuf input(JSON, bsl::strlen(JSON));
+//
+//  int rc = baljsn::DatumStreamUtil::decodePaths(results,
+//                                                0,
+//                                                &input,
+//                                                PATHS,
+//                                                NUM_PATHS);
+//  assert(0 == rc);
+//..
+// Finally, we observe that the values have been decoded.  Note that only the
+// two strings were decoded into 'Datum' objects; the "rows" array was
+// skipped without being interpreted:
+//..
+//  assert(results[0]->isString());
+//  assert("T-1" == results[0]->theString());
+//  assert(results[1]->isString());
+//  assert("Jo"  == results[1]->theString());
+//..
+//
+///Example 2: Filtering a Document While Re-Encoding It
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we must forward JSON documents after removing every member
+// named "password", at any depth.
+//
+// First, we define a handler that forwards events to another handler, except
+// those describing a member named "password" and its value:
+//..
+//  class PasswordFilter : public baljsn::DatumStreamHandler {
+//      // This class forwards the events it receives to another handler,
+//      // omitting every member named "password".
+//
+//      // DATA
+//      baljsn::DatumStreamHandler *d_next_p;    // handler (held, not owned)
+//      int                         d_skipDepth; // nesting level within an
+//                                               // omitted value, or 0
+//      bool                        d_skipNext;  // omit the next value
+//
+//      // PRIVATE MANIPULATORS
+//      bool skip(int change)
+//          // Update the state of this filter for an event that changes the
+//          // nesting level by the specified 'change', and return 'true' if
+//          // that event should be omitted.
+//      {
+//          if (d_skipNext) {
+//              d_skipNext  = false;
+//              d_skipDepth = change;
+//              return true;                                          // RETURN
+//          }
+//          if (d_skipDepth) {
+//              d_skipDepth += change;
+//              return true;                                          // RETURN
+//          }
+//          return false;
+//      }
+//
+//    public:
+//      // CREATORS
+//      explicit PasswordFilter(baljsn::DatumStreamHandler *next)
+//      : d_next_p(next)
+//      , d_skipDepth(0)
+//      , d_skipNext(false)
+//      {
+//      }
+//
+//      // MANIPULATORS
+//      int startObject()
+//      {
+//          return skip(1) ? 0 : d_next_p->startObject();
+//      }
+//
+//      int memberName(const bslstl::StringRef& name)
+//      {
+//          if (d_skipDepth) {
+//              return 0;                                             // RETURN
+//          }
+//          if ("password" == name) {
+//              d_skipNext = true;
+//              return 0;                                             // RETURN
+//          }
+//          return d_next_p->memberName(name);
+//      }
+//
+//      int endObject()
+//      {
+//          return skip(-1) ? 0 : d_next_p->endObject();
+//      }
+//
+//      int startArray()
+//      {
+//          return skip(1) ? 0 : d_next_p->startArray();
+//      }
+//
+//      int endArray()
+//      {
+//          return skip(-1) ? 0 : d_next_p->endArray();
+//      }
+//
+//      int value(const bdld::Datum& value)
+//      {
+//          return skip(0) ? 0 : d_next_p->value(value);
+//      }
+//  };
+//..
+// Then, we connect a 'baljsn::DatumStreamEncoder' to the filter, and parse a
+// document through it:
+//..
+//  const char *const INPUT = "{\"user\":\"jo\",\"password\":\"secret\","
+//                            "\"next\":{\"password\":[1,{}],"
+//                                      "\"ok\":true}}";
+//
+//  bsl::ostringstream         output;
+//  baljsn::DatumStreamEncoder encoder(output);
+//  PasswordFilter             filter(&encoder);
+//
+//  bdlsb::FixedMemInStreamBuf input(INPUT, bsl::strlen(INPUT));
+//
+//  int rc = baljsn::DatumStreamUtil::parse(&filter, 0, &input);
+//  assert(0 == rc);
+//..
+// Finally, we observe that the passwords are gone.  Note that no 'Datum' tree
+// was built for the document at any point:
+//..
+//  assert("{\"user\":\"jo\",\"next\":{\"ok\":true}}" == output.str());
+//..
+
+#include <balscm_version.h>
+
+#include <baljsn_datumencoderoptions.h>
+#include <baljsn_simpleformatter.h>
+
+#include <bdld_datum.h>
+#include <bdld_manageddatum.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_iosfwd.h>
+#include <bsl_string.h>
+#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+                          // ========================
+                          // class DatumStreamHandler
+                          // ========================
+
+class DatumStreamHandler {
+    // This protocol class defines the events through which a JSON document,
+    // or a 'bdld::Datum' having the same shape, is delivered to a consumer.
+    // See {Events} in the component-level documentation.
+
+  public:
+    // CREATORS
+    virtual ~DatumStreamHandler();
+        // Destroy this object.
+
+    // MANIPULATORS
+    virtual int startObject() = 0;
+        // Process the start of an object.  Return 0 to continue, and a
+        // non-zero value to stop the source of events.
+
+    virtual int memberName(const bslstl::StringRef& name) = 0;
+        // Process the specified 'name' of the next member of the current
+        // object.  Return 0 to continue, and a non-zero value to stop the
+        // source of events.  Note that 'name' may refer to storage that is
+        // valid only for the duration of this call.
+
+    virtual int endObject() = 0;
+        // Process the end of the current object.  Return 0 to continue, and a
+        // non-zero value to stop the source of events.
+
+    virtual int startArray() = 0;
+        // Process the start of an array.  Return 0 to continue, and a
+        // non-zero value to stop the source of events.
+
+    virtual int endArray() = 0;
+        // Process the end of the current array.  Return 0 to continue, and a
+        // non-zero value to stop the source of events.
+
+    virtual int value(const bdld::Datum& value) = 0;
+        // Process the specified scalar 'value'.  Return 0 to continue, and a
+        // non-zero value to stop the source of events.  Note that 'value' may
+        // refer to storage that is valid only for the duration of this call.
+};
+
+                          // ========================
+                          // class DatumStreamEncoder
+                          // ========================
+
+class DatumStreamEncoder : public DatumStreamHandler {
+    // This mechanism class writes the events it receives to a 'bsl::ostream'
+    // as JSON text.  Values are encoded as by 'baljsn::DatumUtil::encode' (see
+    // {'baljsn_datumutil'|Supported Types}).  The behavior is undefined unless
+    // the sequence of events received is well-formed (see {Events}).
+
+    // DATA
+    SimpleFormatter d_formatter;           // JSON formatter
+
+    bool            d_strictTypes;         // 'strictTypes' option
+
+    bool            d_foundCheckFailures;  // whether a value not natively
+                                           // supported by JSON was encoded
+
+    bool            d_arrayPending;        // whether an array has been
+                                           // started but not yet opened
+
+    // PRIVATE MANIPULATORS
+    void openPendingArray();
+        // If an array has been started but not yet opened, open it.
+
+    // NOT IMPLEMENTED
+    DatumStreamEncoder(const DatumStreamEncoder&);
+    DatumStreamEncoder& operator=(const DatumStreamEncoder&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DatumStreamEncoder,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    DatumStreamEncoder(bsl::ostream&               stream,
+                       bslma::Allocator           *basicAllocator = 0);
+    DatumStreamEncoder(bsl::ostream&               stream,
+                       const DatumEncoderOptions&  options,
+                       bslma::Allocator           *basicAllocator = 0);
+        // Create an encoder that writes the events it receives to the
+        // specified 'stream' as JSON text.  Optionally specify 'options'
+        // controlling the format of the output.  If 'options' is not
+        // specified, a default-constructed 'DatumEncoderOptions' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~DatumStreamEncoder();
+        // Destroy this object.
+
+    // MANIPULATORS
+    int startObject();
+        // Write the start of an object.  Return 0.
+
+    int memberName(const bslstl::StringRef& name);
+        // Write the specified member 'name'.  Return 0.
+
+    int endObject();
+        // Write the end of the current object.  Return 0.
+
+    int startArray();
+        // Write the start of an array.  Return 0.
+
+    int endArray();
+        // Write the end of the current array.  Return 0.
+
+    int value(const bdld::Datum& value);
+        // Write the specified 'value'.  Return 0 on success, and a negative
+        // value if 'value' (or, if it is an array or a map, one of its
+        // elements) has a type that cannot be encoded as JSON.
+
+    // ACCESSORS
+    bool isCompleteJSON() const;
+        // Return 'true' if the events received by this encoder describe a
+        // complete JSON value, and 'false' otherwise.
+
+    int status() const;
+        // Return 0 if the 'strictTypes' option supplied at construction is
+        // 'false', or if every value encoded so far has a type natively
+        // supported by JSON, and a positive value otherwise (see
+        // {'baljsn_datumutil'|Supported Types}).
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+                          // ========================
+                          // class DatumStreamBuilder
+                          // ========================
+
+class DatumStreamBuilder : public DatumStreamHandler {
+    // This mechanism class builds a 'bdld::Datum' from the events it
+    // receives.  Objects are built as maps owning their keys, in which only
+    // the first of several members having the same name is retained, and
+    // arrays are built as arrays.  Scalar values are copied.  A manipulator
+    // that receives an event that would make the sequence of events received
+    // ill-formed (see {Events}) returns a non-zero value, and has no effect.
+
+    // PRIVATE TYPES
+    struct Frame {
+        // This 'struct' describes an object or an array that has been started
+        // but not yet ended.
+
+        bsl::size_t d_firstValue;  // index of the first element in
+                                   // 'd_values'
+
+        bsl::size_t d_firstKey;    // index of the first member name in
+                                   // 'd_keyOffsets'
+
+        bool        d_isObject;    // 'true' for an object, 'false' for an
+                                   // array
+    };
+
+    // DATA
+    bsl::vector<bdld::Datum>              d_values;      // elements of the
+                                                         // open containers
+                                                         // (owned)
+
+    bsl::string                           d_keys;        // member names of
+                                                         // the open objects
+
+    bsl::vector<bsl::size_t>              d_keyOffsets;  // offset of each
+                                                         // name in 'd_keys'
+
+    bsl::vector<Frame>                    d_frames;      // open containers,
+                                                         // innermost last
+
+    bsl::unordered_set<bslstl::StringRef> d_seenKeys;    // scratch set used
+                                                         // to drop duplicate
+                                                         // member names
+
+    bdld::Datum                           d_result;      // completed value
+                                                         // (owned)
+
+    bool                                  d_isComplete;  // whether
+                                                         // 'd_result' is set
+
+    bslma::Allocator                     *d_allocator_p; // allocator (held,
+                                                         // not owned)
+
+    // PRIVATE MANIPULATORS
+    int endContainer(bool isObject);
+        // Build the innermost open container, which must be an object if the
+        // specified 'isObject' is 'true' and an array otherwise, and add it to
+        // the value being built.  Return 0 on success, and a non-zero value
+        // if there is no such container, or if a member name is awaiting its
+        // value.
+
+    int prepareToAddValue();
+        // Return 0 if a value may be added to the value being built, and a
+        // non-zero value otherwise.  On success, the capacity of 'd_values'
+        // is sufficient to add a value without allocating.
+
+    void addValue(const bdld::Datum& value);
+        // Add the specified 'value', which must be allocated from the
+        // allocator of this object, to the value being built, taking
+        // ownership of it.  The behavior is undefined unless the preceding
+        // call to 'prepareToAddValue' returned 0.
+
+    // NOT IMPLEMENTED
+    DatumStreamBuilder(const DatumStreamBuilder&);
+    DatumStreamBuilder& operator=(const DatumStreamBuilder&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DatumStreamBuilder,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit DatumStreamBuilder(bslma::Allocator *basicAllocator = 0);
+        // Create a builder that has not received any events.  Optionally
+        // specify a 'basicAllocator' used to supply memory, including the
+        // memory of the values that are built.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.
+
+    ~DatumStreamBuilder();
+        // Destroy this object, and any value it holds.
+
+    // MANIPULATORS
+    int startObject();
+        // Start building an object.  Return 0 on success, and a non-zero
+        // value if a value cannot be added at this point.
+
+    int memberName(const bslstl::StringRef& name);
+        // Record the specified 'name' of the next member of the innermost
+        // open object.  Return 0 on success, and a non-zero value if the
+        // innermost open container is not an object, or if the previous
+        // member name is awaiting its value.
+
+    int endObject();
+        // Finish building the innermost open object.  Return 0 on success, and
+        // a non-zero value if the innermost open container is not an object,
+        // or if a member name is awaiting its value.
+
+    int startArray();
+        // Start building an array.  Return 0 on success, and a non-zero value
+        // if a value cannot be added at this point.
+
+    int endArray();
+        // Finish building the innermost open array.  Return 0 on success, and
+        // a non-zero value if the innermost open container is not an array.
+
+    int value(const bdld::Datum& value);
+        // Add a copy of the specified 'value' to the value being built.
+        // Return 0 on success, and a non-zero value if a value cannot be added
+        // at this point.
+
+    bdld::Datum release();
+        // Return the value that has been built, and reset this builder to its
+        // initial state.  The caller is responsible for releasing the
+        // resources of the returned 'Datum' using the allocator of this
+        // object.  The behavior is undefined unless 'isComplete()'.
+
+    void reset();
+        // Discard any value that has been built, or partially built, and
+        // reset this builder to its initial state.
+
+    // ACCESSORS
+    const bdld::Datum& datum() const;
+        // Return a reference providing non-modifiable access to the value
+        // that has been built.  The behavior is undefined unless
+        // 'isComplete()'.
+
+    bool isComplete() const;
+        // Return 'true' if the events received by this builder describe a
+        // complete value, and 'false' otherwise.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+                          // ======================
+                          // struct DatumStreamUtil
+                          // ======================
+
+struct DatumStreamUtil {
+    // This 'struct' provides a namespace for functions that produce
+    // 'DatumStreamHandler' events from JSON text or from a 'bdld::Datum', and
+    // that extract selected values from JSON text.
+
+    // CLASS METHODS
+    static int decodePaths(bdld::ManagedDatum       *results,
+                           const bslstl::StringRef&  json,
+                           const bslstl::StringRef  *paths,
+                           bsl::size_t               numPaths);
+    static int decodePaths(bdld::ManagedDatum       *results,
+                           bsl::ostream             *errorStream,
+                           const bslstl::StringRef&  json,
+                           const bslstl::StringRef  *paths,
+                           bsl::size_t               numPaths);
+    static int decodePaths(bdld::ManagedDatum       *results,
+                           bsl::ostream             *errorStream,
+                           bsl::streambuf           *jsonBuffer,
+                           const bslstl::StringRef  *paths,
+                           bsl::size_t               numPaths);
+        // Load into each of the specified 'numPaths' elements of the
+        // specified 'results' array the value, in the JSON document provided
+        // by the specified 'json' string or 'jsonBuffer', that is selected by
+        // the corresponding element of the specified 'paths' array (see
+        // {Paths}), or null if that path selects no value.  If the optionally
+        // specified 'errorStream' is non-null, a description of any errors
+        // that occur during parsing will be output to this stream.  Return 0
+        // on success, and a negative value, with each element of 'results'
+        // null, if the document is ill-formed.  Each value is decoded as by
+        // 'baljsn::DatumUtil::decode', and is allocated from the allocator of
+        // the corresponding element of 'results'.  Values that are not
+        // selected are skipped without being decoded (so an ill-formed scalar
+        // among them is not detected), and reading stops as soon as every
+        // path has selected a value; the part of the document that is not
+        // read is not checked for errors.  The behavior is
+        // undefined unless 'results' and 'paths' each refer to at least
+        // 'numPaths' elements.
+
+    static int generate(DatumStreamHandler *handler,
+                        const bdld::Datum&  datum);
+        // Deliver to the specified 'handler' the sequence of events describing
+        // the specified 'datum'.  Each array and map in 'datum' is described
+        // by the events for its elements, and every other value is delivered
+        // to 'handler->value'.  Return 0 on success, and the non-zero value
+        // returned by 'handler', without delivering further events, otherwise.
+
+    static int parse(DatumStreamHandler       *handler,
+                     const bslstl::StringRef&  json);
+    static int parse(DatumStreamHandler       *handler,
+                     bsl::ostream             *errorStream,
+                     const bslstl::StringRef&  json);
+    static int parse(DatumStreamHandler       *handler,
+                     bsl::ostream             *errorStream,
+                     bsl::streambuf           *jsonBuffer);
+        // Deliver to the specified 'handler' the sequence of events describing
+        // the JSON document provided by the specified 'json' string or
+        // 'jsonBuffer'.  If the optionally specified 'errorStream' is
+        // non-null, a description of any errors that occur during parsing will
+        // be output to this stream.  Return 0 on success, the non-zero value
+        // returned by 'handler', without delivering further events, if
+        // 'handler' stops parsing, and a negative value if the document is
+        // ill-formed.  Note that, as events are delivered while the document
+        // is being read, 'handler' may receive events before an error is
+        // detected.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class DatumStreamEncoder
+                          // ------------------------
+
+// ACCESSORS
+inline
+bool DatumStreamEncoder::isCompleteJSON() const
+{
+    return !d_arrayPending && d_formatter.isCompleteJSON();
+}
+
+inline
+int DatumStreamEncoder::status() const
+{
+    return d_strictTypes && d_foundCheckFailures ? 1 : 0;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *DatumStreamEncoder::allocator() const
+{
+    return d_formatter.allocator();
+}
+
+                          // ------------------------
+                          // class DatumStreamBuilder
+                          // ------------------------
+
+// ACCESSORS
+inline
+const bdld::Datum& DatumStreamBuilder::datum() const
+{
+    BSLS_ASSERT(d_isComplete);
+
+    return d_result;
+}
+
+inline
+bool DatumStreamBuilder::isComplete() const
+{
+    return d_isComplete;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *DatumStreamBuilder::allocator() const
+{
+    return d_allocator_p;
+}
+
+                           // ----------------------
+                           // struct DatumStreamUtil
+                           // ----------------------
+
+// CLASS METHODS
+inline
+int DatumStreamUtil::decodePaths(bdld::ManagedDatum       *results,
+                                 const bslstl::StringRef&  json,
+                                 const bslstl::StringRef  *paths,
+                                 bsl::size_t               numPaths)
+{
+    bdlsb::FixedMemInStreamBuf buffer(json.data(), json.length());
+    return decodePaths(results, 0, &buffer, paths, numPaths);
+}
+
+inline
+int DatumStreamUtil::decodePaths(bdld::ManagedDatum       *results,
+                                 bsl::ostream             *errorStream,
+                                 const bslstl::StringRef&  json,
+                                 const bslstl::StringRef  *paths,
+                                 bsl::size_t               numPaths)
+{
+    bdlsb::FixedMemInStreamBuf buffer(json.data(), json.length());
+    return decodePaths(results, errorStream, &buffer, paths, numPaths);
+}
+
+inline
+int DatumStreamUtil::parse(DatumStreamHandler       *handler,
+                           const bslstl::StringRef&  json)
+{
+    bdlsb::FixedMemInStreamBuf buffer(json.data(), json.length());
+    return parse(handler, 0, &buffer);
+}
+
+inline
+int DatumStreamUtil::parse(DatumStreamHandler       *handler,
+                           bsl::ostream             *errorStream,
+                           const bslstl::StringRef&  json)
+{
+    bdlsb::FixedMemInStreamBuf buffer(json.data(), json.length());
+    return parse(handler, errorStream, &buffer);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1651 @@
+// baljsn_datumstream.t.cpp                                           -*-C++-*-
+#include <baljsn_datumstream.h>
+
+#include <baljsn_datumencoderoptions.h>
+#include <baljsn_datumutil.h>
+#include <baljsn_encodingstyle.h>
+
+#include <bdld_datum.h>
+#include <bdld_datumarraybuilder.h>
+#include <bdld_datumudt.h>
+#include <bdld_manageddatum.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bdlt_date.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides a protocol, two concrete handlers, and a
+// utility producing events from JSON text or from a 'bdld::Datum'.  The
+// reference against which the handlers and sources are checked is
+// 'baljsn::DatumUtil': building a 'Datum' from the events produced by 'parse'
+// must yield the same value as 'DatumUtil::decode', and encoding the events
+// produced by 'generate' must yield the same text as 'DatumUtil::encode'.
+// 'decodePaths' is checked against the values found by navigating the 'Datum'
+// produced by 'DatumUtil::decode'.  We use a recording handler to observe the
+// exact sequence of events, and to stop a source part way through.
+// ----------------------------------------------------------------------------
+// DatumStreamEncoder
+// [ 3] DatumStreamEncoder(ostream&, Allocator *);
+// [ 3] DatumStreamEncoder(ostream&, const DatumEncoderOptions&, Alloc *);
+// [ 3] int startObject();
+// [ 3] int memberName(const StringRef& name);
+// [ 3] int endObject();
+// [ 3] int startArray();
+// [ 3] int endArray();
+// [ 3] int value(const Datum& value);
+// [ 3] bool isCompleteJSON() const;
+// [ 3] int status() const;
+// [ 3] Allocator *allocator() const;
+//
+// DatumStreamBuilder
+// [ 2] DatumStreamBuilder(Allocator *);
+// [ 2] ~DatumStreamBuilder();
+// [ 2] int startObject();
+// [ 2] int memberName(const StringRef& name);
+// [ 2] int endObject();
+// [ 2] int startArray();
+// [ 2] int endArray();
+// [ 2] int value(const Datum& value);
+// [ 2] Datum release();
+// [ 2] void reset();
+// [ 2] const Datum& datum() const;
+// [ 2] bool isComplete() const;
+// [ 2] Allocator *allocator() const;
+//
+// DatumStreamUtil
+// [ 4] int generate(DatumStreamHandler *, const Datum&);
+// [ 5] int parse(DatumStreamHandler *, const StringRef&);
+// [ 5] int parse(DatumStreamHandler *, ostream *, const StringRef&);
+// [ 5] int parse(DatumStreamHandler *, ostream *, streambuf *);
+// [ 6] int decodePaths(MD *, const StringRef&, const SR *, size_t);
+// [ 6] int decodePaths(MD *, ostream *, const SR&, const SR *, size_t);
+// [ 6] int decodePaths(MD *, ostream *, streambuf *, const SR *, size_t);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baljsn::DatumStreamHandler Handler;
+typedef baljsn::DatumStreamEncoder Encoder;
+typedef baljsn::DatumStreamBuilder Builder;
+typedef baljsn::DatumStreamUtil    Util;
+typedef bdld::ManagedDatum         MD;
+
+// ============================================================================
+//                       HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class EventRecorder : public baljsn::DatumStreamHandler {
+    // This class records the events it receives as text, and stops the source
+    // of events, returning 'k_STOPPED', once a specified number of events has
+    // been received.
+
+    // DATA
+    bsl::string d_events;     // recorded events
+    int         d_numEvents;  // number of events received
+    int         d_limit;      // number of events accepted, or -1
+
+    // PRIVATE MANIPULATORS
+    int record(const bsl::string& event)
+        // Append the specified 'event' to the recorded events, and return 0
+        // if the limit has not been reached and 'k_STOPPED' otherwise.
+    {
+        if (d_limit == d_numEvents) {
+            return k_STOPPED;                                         // RETURN
+        }
+        ++d_numEvents;
+        d_events += event;
+        return 0;
+    }
+
+  public:
+    // PUBLIC CONSTANTS
+    enum { k_STOPPED = 42 };
+
+    // CREATORS
+    explicit EventRecorder(int limit = -1)
+        // Create a recorder that accepts the optionally specified 'limit'
+        // events, or every event if 'limit' is negative.
+    : d_events(bslma::Default::globalAllocator())
+    , d_numEvents(0)
+    , d_limit(limit)
+    {
+    }
+
+    // MANIPULATORS
+    int startObject()
+    {
+        return record("{");
+    }
+
+    int memberName(const bslstl::StringRef& name)
+    {
+        return record(bsl::string(name, bslma::Default::globalAllocator())
+                                                                       + ":");
+    }
+
+    int endObject()
+    {
+        return record("}");
+    }
+
+    int startArray()
+    {
+        return record("[");
+    }
+
+    int endArray()
+    {
+        return record("]");
+    }
+
+    int value(const bdld::Datum& value)
+    {
+        bsl::ostringstream oss(bslma::Default::globalAllocator());
+        switch (value.type()) {
+          case bdld::Datum::e_NIL: {
+            oss << "N";
+          } break;
+          case bdld::Datum::e_BOOLEAN: {
+            oss << (value.theBoolean() ? "T" : "F");
+          } break;
+          case bdld::Datum::e_REAL: {
+            oss << value.theDouble();
+          } break;
+          case bdld::Datum::e_STRING: {
+            oss << '\'' << value.theString() << '\'';
+          } break;
+          default: {
+            oss << '<' << value.type() << '>';
+          }
+        }
+        oss << ',';
+        return record(oss.str());
+    }
+
+    // ACCESSORS
+    const bsl::string& events() const
+        // Return the recorded events.
+    {
+        return d_events;
+    }
+};
+
+int decodeReference(MD *result, const char *json)
+    // Load into the specified 'result' the value decoded from the specified
+    // 'json' by 'baljsn::DatumUtil', and return the status of 'decode'.
+{
+    return baljsn::DatumUtil::decode(result, json);
+}
+
+bsl::string encodeReference(const bdld::Datum&                 datum,
+                            const baljsn::DatumEncoderOptions& options)
+    // Return the JSON text to which 'baljsn::DatumUtil' encodes the specified
+    // 'datum' using the specified 'options'.
+{
+    bsl::string result(bslma::Default::globalAllocator());
+    baljsn::DatumUtil::encode(&result, datum, options);
+    return result;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Example 2: Filtering a Document While Re-Encoding It
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we must forward JSON documents after removing every member
+// named "password", at any depth.
+//
+// First, we define a handler that forwards events to another handler, except
+// those describing a member named "password" and its value:
+//..
+    class PasswordFilter : public baljsn::DatumStreamHandler {
+        // This class forwards the events it receives to another handler,
+        // omitting every member named "password".
+
+        // DATA
+        baljsn::DatumStreamHandler *d_next_p;    // handler (held, not owned)
+        int                         d_skipDepth; // nesting level within an
+                                                 // omitted value, or 0
+        bool                        d_skipNext;  // omit the next value
+
+        // PRIVATE MANIPULATORS
+        bool skip(int change)
+            // Update the state of this filter for an event that changes the
+            // nesting level by the specified 'change', and return 'true' if
+            // that event should be omitted.
+        {
+            if (d_skipNext) {
+                d_skipNext  = false;
+                d_skipDepth = change;
+                return true;                                          // RETURN
+            }
+            if (d_skipDepth) {
+                d_skipDepth += change;
+                return true;                                          // RETURN
+            }
+            return false;
+        }
+
+      public:
+        // CREATORS
+        explicit PasswordFilter(baljsn::DatumStreamHandler *next)
+        : d_next_p(next)
+        , d_skipDepth(0)
+        , d_skipNext(false)
+        {
+        }
+
+        // MANIPULATORS
+        int startObject()
+        {
+            return skip(1) ? 0 : d_next_p->startObject();
+        }
+
+        int memberName(const bslstl::StringRef& name)
+        {
+            if (d_skipDepth) {
+                return 0;                                             // RETURN
+            }
+            if ("password" == name) {
+                d_skipNext = true;
+                return 0;                                             // RETURN
+            }
+            return d_next_p->memberName(name);
+        }
+
+        int endObject()
+        {
+            return skip(-1) ? 0 : d_next_p->endObject();
+        }
+
+        int startArray()
+        {
+            return skip(1) ? 0 : d_next_p->startArray();
+        }
+
+        int endArray()
+        {
+            return skip(-1) ? 0 : d_next_p->endArray();
+        }
+
+        int value(const bdld::Datum& value)
+        {
+            return skip(0) ? 0 : d_next_p->value(value);
+        }
+    };
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: DOES NOT ALLOCATE MEMORY FROM GLOBAL ALLOCATOR
+    //
+    // Note that the helper classes of this test driver allocate from the
+    // global allocator; its use is therefore checked only for balance.
+
+    bslma::TestAllocator ga("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&ga);
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocator(&da);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Example 1: Extracting a Few Fields From a Large Document
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a gateway receives large JSON documents, of which it needs
+// only a couple of fields.  Decoding each document into a 'bdld::Datum' would
+// allocate memory for every value, when only two are required.
+//
+// First, we define the document (which, in practice, would be far larger):
+//..
+    const char *const JSON = "{"
+                             "  \"header\": { \"id\": \"T-1\", \"v\": 2 },"
+                             "  \"rows\": [ [1, 2, 3], [4, 5, 6] ],"
+                             "  \"owner\": { \"name\": \"Jo\" }"
+                             "}";
+//..
+// Then, we describe the values we need:
+//..
+    const bslstl::StringRef PATHS[] = { "header.id", "owner.name" };
+    const bsl::size_t       NUM_PATHS = sizeof PATHS / sizeof *PATHS;
+//..
+// Next, we extract them, using a 'bdlsb::FixedMemInStreamBuf' to present the
+// document as a 'bsl::streambuf':
+//..
+    bdld::ManagedDatum results[NUM_PATHS];
+
+    bdlsb::FixedMemInStreamBuf input(JSON, bsl::strlen(JSON));
+
+    int rc = baljsn::DatumStreamUtil::decodePaths(results,
+                                                  0,
+                                                  &input,
+                                                  PATHS,
+                                                  NUM_PATHS);
+    ASSERT(0 == rc);
+//..
+// Finally, we observe that the values have been decoded.  Note that only the
+// two strings were decoded into 'Datum' objects; the "rows" array was
+// skipped without being interpreted:
+//..
+    ASSERT(results[0]->isString());
+    ASSERT("T-1" == results[0]->theString());
+    ASSERT(results[1]->isString());
+    ASSERT("Jo"  == results[1]->theString());
+//..
+//
+// Then, we connect a 'baljsn::DatumStreamEncoder' to the filter, and parse a
+// document through it:
+//..
+    {
+        const char *const INPUT = "{\"user\":\"jo\",\"password\":\"secret\","
+                                  "\"next\":{\"password\":[1,{}],"
+                                            "\"ok\":true}}";
+
+        bsl::ostringstream         output;
+        baljsn::DatumStreamEncoder encoder(output);
+        PasswordFilter             filter(&encoder);
+
+        bdlsb::FixedMemInStreamBuf input(INPUT, bsl::strlen(INPUT));
+
+        int rc = baljsn::DatumStreamUtil::parse(&filter, 0, &input);
+        ASSERT(0 == rc);
+//..
+// Finally, we observe that the passwords are gone.  Note that no 'Datum' tree
+// was built for the document at any point:
+//..
+        ASSERT("{\"user\":\"jo\",\"next\":{\"ok\":true}}" == output.str());
+    }
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'decodePaths'
+        //
+        // Concerns:
+        //: 1 Each result is the value selected by the corresponding path,
+        //:   decoded exactly as 'DatumUtil::decode' would decode it, or null
+        //:   if the path selects no value.
+        //:
+        //: 2 Member names and array indices may be mixed in a path, and the
+        //:   empty path selects the whole document.
+        //:
+        //: 3 Only the first of several members having the same name is
+        //:   considered, even if a later one would satisfy a deeper path.
+        //:
+        //: 4 Paths that are prefixes of one another, and duplicate paths, are
+        //:   all resolved.
+        //:
+        //: 5 Reading stops once every path is resolved, so that errors after
+        //:   that point are not reported, but an error before that point is
+        //:   reported, and leaves every result null.
+        //:
+        //: 6 Each result is allocated from its own allocator, and values that
+        //:   are not selected are not allocated at all.
+        //:
+        //: 7 All three overloads are equivalent, and an error is described on
+        //:   the error stream, if one is supplied.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, for a set of documents and
+        //:   paths, compare each result with the value found by navigating
+        //:   the 'Datum' decoded by 'DatumUtil::decode' (or with null), and
+        //:   verify the expected status.  (C-1..5)
+        //:
+        //: 2 Supply results using a test allocator, verify that the default
+        //:   allocator is not used, and that the memory in use is that of the
+        //:   selected values.  (C-6)
+        //:
+        //: 3 Invoke every overload with and without an error stream.  (C-7)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null pointers.  (C-8)
+        //
+        // Testing:
+        //   int decodePaths(MD *, const StringRef&, const SR *, size_t);
+        //   int decodePaths(MD *, ostream *, const SR&, const SR *, size_t);
+        //   int decodePaths(MD *, ostream *, streambuf *, const SR *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'decodePaths'" << endl
+                                  << "=============" << endl;
+
+        const char *const DOC =
+                 "{\"a\":{\"b\":[10,{\"c\":\"x\\ty\"},[true,null]],\"d\":-2},"
+                 " \"e\":\"s\", \"f\":[], \"a\":{\"b\":99,\"z\":1},"
+                 " \"g\":{\"h\":{\"i\":{\"j\":\"deep\"}}}}";
+
+        // Documents that are ill-formed after some values can be resolved,
+        // and well-formed documents holding those values.
+
+        const char *const BAD_TAIL      = "{\"a\":1, \"b\":[2,3], \"c\": ]}";
+        const char *const BAD_TAIL_REF  = "{\"a\":1, \"b\":[2,3]}";
+        const char *const BAD_VALUE     = "{\"a\":1,\"b\":x}";
+        const char *const BAD_VALUE_REF = "{\"a\":1}";
+
+        static const struct {
+            int         d_line;       // source line number
+            const char *d_json;       // document
+            const char *d_paths;      // paths, separated by '|'
+            const char *d_expected;   // reference path for each result,
+                                      // separated by '|', with '-' for null
+            int         d_status;     // 0, or -1 for a negative status
+        } DATA[] = {
+            //LINE  JSON      PATHS           EXPECTED        STATUS
+            //----  ----      -----           --------        ------
+            { L_,   DOC,      "a",            "a",                 0 },
+            { L_,   DOC,      "a.d",          "a.d",               0 },
+            { L_,   DOC,      "a.b.0",        "a.b.0",             0 },
+            { L_,   DOC,      "a.b.1.c",      "a.b.1.c",           0 },
+            { L_,   DOC,      "a.b.2.1",      "a.b.2.1",           0 },
+            { L_,   DOC,      "a.b.3",        "-",                 0 },
+            { L_,   DOC,      "a.b.x",        "-",                 0 },
+            { L_,   DOC,      "a.z",          "-",                 0 },
+            { L_,   DOC,      "e",            "e",                 0 },
+            { L_,   DOC,      "e.x",          "-",                 0 },
+            { L_,   DOC,      "f",            "f",                 0 },
+            { L_,   DOC,      "f.0",          "-",                 0 },
+            { L_,   DOC,      "g.h.i.j",      "g.h.i.j",           0 },
+            { L_,   DOC,      "",             "",                  0 },
+            { L_,   DOC,      "zz",           "-",                 0 },
+            { L_,   DOC,      "e|a.d|g.h",    "e|a.d|g.h",         0 },
+            { L_,   DOC,      "a|a.b.1.c",    "a|a.b.1.c",         0 },
+            { L_,   DOC,      "a.b.1.c|a",    "a.b.1.c|a",         0 },
+            { L_,   DOC,      "a.d|a.d",      "a.d|a.d",           0 },
+            { L_,   DOC,      "|e",           "|e",                0 },
+            { L_,   "[1,[2,3]]",
+                              "1.0|0|2",      "1.0|0|-",           0 },
+            { L_,   "7",      "|x",           "|-",                0 },
+            { L_,   "7",      "0",            "-",                 0 },
+            { L_,   BAD_TAIL, "a",            "a",                 0 },
+            { L_,   BAD_TAIL, "a|b.1",        "a|b.1",             0 },
+            { L_,   BAD_TAIL, "c",            "-",                -1 },
+            { L_,   BAD_TAIL, "a|zz",         "-|-",              -1 },
+            { L_,   "{\"a\":[1,}", "a",         "-",                -1 },
+            { L_,   BAD_VALUE,"a",            "a",                 0 },
+            { L_,   BAD_VALUE,"b",            "-",                -1 },
+            { L_,   "{\"a\":\"\\q\"}",
+                              "a",            "-",                -1 },
+            { L_,   "",       "a",            "-",                -1 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const JSON     = DATA[ti].d_json;
+            const char *const PATHS    = DATA[ti].d_paths;
+            const char *const EXPECTED = DATA[ti].d_expected;
+            const int         STATUS   = DATA[ti].d_status;
+
+            if (veryVerbose) { T_ P_(LINE) P_(JSON) P(PATHS) }
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            // Split 'PATHS' and 'EXPECTED'.
+
+            bsl::vector<bsl::string>       pathStrings(&sa);
+            bsl::vector<bsl::string>       expectedStrings(&sa);
+            bsl::vector<bslstl::StringRef> paths(&sa);
+
+            for (const char *begin = PATHS; ; ) {
+                const char *end = bsl::strchr(begin, '|');
+                pathStrings.push_back(end ? bsl::string(begin, end, &sa)
+                                          : bsl::string(begin, &sa));
+                if (!end) {
+                    break;
+                }
+                begin = end + 1;
+            }
+            for (const char *begin = EXPECTED; ; ) {
+                const char *end = bsl::strchr(begin, '|');
+                expectedStrings.push_back(end ? bsl::string(begin, end, &sa)
+                                              : bsl::string(begin, &sa));
+                if (!end) {
+                    break;
+                }
+                begin = end + 1;
+            }
+            ASSERTV(LINE, pathStrings.size() == expectedStrings.size());
+
+            for (bsl::size_t i = 0; i < pathStrings.size(); ++i) {
+                paths.push_back(pathStrings[i]);
+            }
+            const bsl::size_t NUM_PATHS = paths.size();
+
+            // The expected value of each result is found by navigating the
+            // value decoded by 'DatumUtil::decode'.
+
+            MD        reference(&sa);
+            const int referenceRc = decodeReference(
+                                          &reference,
+                                          BAD_TAIL  == JSON ? BAD_TAIL_REF
+                                        : BAD_VALUE == JSON ? BAD_VALUE_REF
+                                        : JSON);
+
+            for (int overload = 0; overload < 3; ++overload) {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                bsl::vector<MD>    results(&oa);
+                bsl::ostringstream errors(&sa);
+
+                results.resize(NUM_PATHS);
+                for (bsl::size_t i = 0; i < NUM_PATHS; ++i) {
+                    results[i].adopt(bdld::Datum::createInteger(-1));
+                }
+
+                const bsls::Types::Int64 numBytes   = oa.numBytesInUse();
+                const bsls::Types::Int64 numDefault = da.numAllocations();
+
+                int rc;
+                switch (overload) {
+                  case 0: {
+                    rc = Util::decodePaths(results.data(),
+                                           JSON,
+                                           paths.data(),
+                                           NUM_PATHS);
+                  } break;
+                  case 1: {
+                    rc = Util::decodePaths(results.data(),
+                                           &errors,
+                                           JSON,
+                                           paths.data(),
+                                           NUM_PATHS);
+                  } break;
+                  default: {
+                    bdlsb::FixedMemInStreamBuf input(JSON,
+                                                     bsl::strlen(JSON));
+                    rc = Util::decodePaths(results.data(),
+                                           &errors,
+                                           &input,
+                                           paths.data(),
+                                           NUM_PATHS);
+                  } break;
+                }
+
+                ASSERTV(LINE, overload, da.numAllocations(),
+                        numDefault == da.numAllocations());
+                ASSERTV(LINE, overload, rc, STATUS,
+                        (0 == rc) == (0 == STATUS));
+                ASSERTV(LINE, overload, rc, 0 >= rc);
+                ASSERTV(LINE, overload, errors.str(),
+                        (1 == overload || 2 == overload)
+                        == (0 != rc && !errors.str().empty())
+                        || 0 == rc);
+
+                for (bsl::size_t i = 0; i < NUM_PATHS; ++i) {
+                    const bsl::string& EXP = expectedStrings[i];
+
+                    if (0 != rc || "-" == EXP) {
+                        ASSERTV(LINE, overload, i, *results[i],
+                                results[i]->isNull());
+                        continue;
+                    }
+
+                    ASSERTV(LINE, 0 == referenceRc);
+
+                    // Navigate the reference value along 'EXP'.
+
+                    const bdld::Datum *expected = &reference.datum();
+                    bsl::size_t        begin    = 0;
+                    while (expected && !EXP.empty()
+                                    && begin <= EXP.length()) {
+                        bsl::size_t end = EXP.find('.', begin);
+                        if (bsl::string::npos == end) {
+                            end = EXP.length();
+                        }
+                        const bsl::string segment(EXP, begin, end - begin);
+                        if (expected->isMap()) {
+                            expected = expected->theMap().find(segment);
+                        }
+                        else {
+                            const bsl::size_t index =
+                                       bsl::strtoul(segment.c_str(), 0, 10);
+                            expected = index < expected->theArray().length()
+                                       ? &expected->theArray()[index]
+                                       : 0;
+                        }
+                        begin = end + 1;
+                    }
+
+                    ASSERTV(LINE, overload, i, expected);
+                    if (expected) {
+                        ASSERTV(LINE, overload, i, *expected, *results[i],
+                                *expected == *results[i]);
+                    }
+                    ASSERTV(LINE, overload, i,
+                            &oa == results[i].allocator());
+                }
+
+                if (0 != rc) {
+                    ASSERTV(LINE, overload, oa.numBytesInUse(),
+                            numBytes == oa.numBytesInUse());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nUnselected values are not allocated." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            const char *const JSON = "{\"big\":[\"aaaaaaaaaaaaaaaaaaaaaaaa\","
+                                     "{\"k\":\"bbbbbbbbbbbbbbbbbbbbbbbbb\"}],"
+                                     "\"n\":1.5}";
+            const bslstl::StringRef PATH = "n";
+
+            const bsls::Types::Int64 numDefault = da.numAllocations();
+
+            MD  result(&oa);
+            int rc = Util::decodePaths(&result, JSON, &PATH, 1);
+            ASSERTV(rc, 0 == rc);
+            ASSERTV(*result, bdld::Datum::createDouble(1.5) == *result);
+            ASSERTV(oa.numAllocations(), 0 == oa.numAllocations());
+            ASSERTV(da.numAllocations(), numDefault == da.numAllocations());
+        }
+
+        if (verbose) cout << "\nNo paths." << endl;
+        {
+            MD  result;
+            int rc = Util::decodePaths(&result, "not json", 0, 0);
+            ASSERTV(rc, 0 == rc);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bslstl::StringRef PATH = "a";
+            MD                      result;
+
+            MD                *const NULL_RESULTS = 0;
+            const bslstl::StringRef *const NULL_PATHS = 0;
+
+            ASSERT_PASS(Util::decodePaths(&result, "{}", &PATH, 1));
+            ASSERT_FAIL(Util::decodePaths(NULL_RESULTS, "{}", &PATH, 1));
+            ASSERT_FAIL(Util::decodePaths(&result, "{}", NULL_PATHS, 1));
+            ASSERT_PASS(Util::decodePaths(NULL_RESULTS, "{}", NULL_PATHS, 0));
+            ASSERT_FAIL(Util::decodePaths(&result, 0, 0, &PATH, 1));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'parse'
+        //
+        // Concerns:
+        //: 1 The events delivered describe the document, and a
+        //:   'DatumStreamBuilder' receiving them builds the same value that
+        //:   'DatumUtil::decode' produces.
+        //:
+        //: 2 An ill-formed document results in a negative status, and in a
+        //:   description on the error stream if one is supplied; exactly the
+        //:   documents rejected by 'DatumUtil::decode' are rejected.
+        //:
+        //: 3 A non-zero status returned by the handler stops parsing and is
+        //:   returned.
+        //:
+        //: 4 String values are unescaped, and are valid for the duration of
+        //:   the call to 'value'.
+        //:
+        //: 5 All three overloads are equivalent.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a set of documents with
+        //:   an 'EventRecorder', and compare the recorded events with the
+        //:   expected events.  Parse each document with a builder, and
+        //:   compare the result with that of 'DatumUtil::decode'.  (C-1..2, 4)
+        //:
+        //: 2 For each well-formed document, and each possible limit, parse
+        //:   with an 'EventRecorder' that stops after that many events, and
+        //:   verify the status and the events recorded.  (C-3)
+        //:
+        //: 3 Invoke every overload.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null pointers.  (C-6)
+        //
+        // Testing:
+        //   int parse(DatumStreamHandler *, const StringRef&);
+        //   int parse(DatumStreamHandler *, ostream *, const StringRef&);
+        //   int parse(DatumStreamHandler *, ostream *, streambuf *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'parse'" << endl
+                                  << "=======" << endl;
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_json;      // document
+            const char *d_events;    // expected events, or 0 if ill-formed
+        } DATA[] = {
+            //LINE  JSON                           EVENTS
+            //----  ----                           ------
+            { L_,   "null",                        "N,"                    },
+            { L_,   "true",                        "T,"                    },
+            { L_,   "false",                       "F,"                    },
+            { L_,   "-1.5e2",                      "-150,"                 },
+            { L_,   "\"a\\\"b\\u0041\"",           "'a\"bA',"              },
+            { L_,   "[]",                          "[]"                    },
+            { L_,   "{}",                          "{}"                    },
+            { L_,   " [ 1 , [ ] , { } ] ",         "[1,[]{}]"              },
+            { L_,   "{\"a\":1,\"b\":[true,\"x\"]}","{a:1,b:[T,'x',]}"      },
+            { L_,   "{\"a\":1,\"a\":2}",           "{a:1,a:2,}"            },
+            { L_,   "[[[[\"deep\"]]]]",            "[[[['deep',]]]]"       },
+            { L_,   "",                            0                       },
+            { L_,   "[",                           0                       },
+            { L_,   "[1,",                         0                       },
+            { L_,   "{\"a\"",                      0                       },
+            { L_,   "{\"a\":}",                    0                       },
+            { L_,   "{\"a\":1,}",                  0                       },
+            { L_,   "[1]]",                        0                       },
+            { L_,   "tru",                         0                       },
+            { L_,   "\"\\q\"",                     0                       },
+            { L_,   "[1 2]",                       0                       },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const JSON   = DATA[ti].d_json;
+            const char *const EVENTS = DATA[ti].d_events;
+
+            if (veryVerbose) { T_ P_(LINE) P(JSON) }
+
+            bslma::TestAllocator         sa("scratch", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&sa);
+
+            for (int overload = 0; overload < 3; ++overload) {
+                EventRecorder      recorder;
+                bsl::ostringstream errors(&sa);
+
+                int rc;
+                switch (overload) {
+                  case 0: {
+                    rc = Util::parse(&recorder, JSON);
+                  } break;
+                  case 1: {
+                    rc = Util::parse(&recorder, &errors, JSON);
+                  } break;
+                  default: {
+                    bdlsb::FixedMemInStreamBuf input(JSON,
+                                                     bsl::strlen(JSON));
+                    rc = Util::parse(&recorder, &errors, &input);
+                  } break;
+                }
+
+                if (EVENTS) {
+                    ASSERTV(LINE, overload, rc, 0 == rc);
+                    ASSERTV(LINE, overload, recorder.events(), EVENTS,
+                            EVENTS == recorder.events());
+                }
+                else {
+                    ASSERTV(LINE, overload, rc, 0 > rc);
+                    ASSERTV(LINE, overload,
+                            0 == overload || !errors.str().empty());
+                }
+            }
+
+            // Compare with 'DatumUtil::decode'.
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            MD        reference(&sa);
+            const int referenceRc = decodeReference(&reference, JSON);
+
+            {
+                Builder builder(&oa);
+                int     rc = Util::parse(&builder, JSON);
+
+                // Note that 'DatumUtil::decode' accepts a string having an
+                // invalid escape sequence, decoding it as null; 'parse'
+                // rejects it.
+
+                ASSERTV(LINE, rc, referenceRc, 0 != rc || 0 == referenceRc);
+                ASSERTV(LINE, rc, 0 != rc || builder.isComplete());
+                if (0 == rc) {
+                    ASSERTV(LINE, reference, builder.datum(),
+                            *reference == builder.datum());
+                }
+            }
+            ASSERTV(LINE, oa.numBytesInUse(), 0 == oa.numBytesInUse());
+
+            if (!EVENTS) {
+                continue;
+            }
+
+            // Stop after each possible number of events.
+
+            EventRecorder all;
+            Util::parse(&all, JSON);
+
+            for (int limit = 0; ; ++limit) {
+                EventRecorder recorder(limit);
+
+                int rc = Util::parse(&recorder, JSON);
+                ASSERTV(LINE, limit, all.events(), recorder.events(),
+                        0 == all.events().compare(0,
+                                                  recorder.events().length(),
+                                                  recorder.events()));
+                if (0 == rc) {
+                    ASSERTV(LINE, limit, all.events() == recorder.events());
+                    break;
+                }
+                ASSERTV(LINE, limit, rc, EventRecorder::k_STOPPED == rc);
+            }
+        }
+
+        if (verbose) cout << "\nLong strings." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            const bsl::string LONG(20000, 'q', &oa);
+            bsl::string       json("[\"", &oa);
+            json += LONG;
+            json += "\",\"";
+            json += LONG;
+            json += "z\"]";
+
+            Builder builder(&oa);
+            ASSERT(0 == Util::parse(&builder, json));
+            ASSERT(builder.datum().isArray());
+            ASSERT(2 == builder.datum().theArray().length());
+            ASSERT(LONG == builder.datum().theArray()[0].theString());
+            ASSERT(LONG + "z" == builder.datum().theArray()[1].theString());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            EventRecorder              recorder;
+            bdlsb::FixedMemInStreamBuf input("1", 1);
+            Handler *const             NULL_HANDLER = 0;
+
+            ASSERT_PASS(Util::parse(&recorder, 0, &input));
+            ASSERT_FAIL(Util::parse(NULL_HANDLER, 0, &input));
+            ASSERT_FAIL(Util::parse(&recorder, 0, 0));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'generate'
+        //
+        // Concerns:
+        //: 1 The events delivered describe the 'Datum', in order, with every
+        //:   value that is neither an array nor a map delivered to 'value'.
+        //:
+        //: 2 A non-zero status returned by the handler stops generation and
+        //:   is returned.
+        //:
+        //: 3 'generate' followed by a 'DatumStreamBuilder' copies the 'Datum'.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of values decoded from JSON, and a value containing a
+        //:   non-JSON type, generate events into an 'EventRecorder' and
+        //:   compare them with the expected events.  (C-1)
+        //:
+        //: 2 Repeat with every possible event limit.  (C-2)
+        //:
+        //: 3 Generate events into a builder and compare the result with the
+        //:   original.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null handler.  (C-4)
+        //
+        // Testing:
+        //   int generate(DatumStreamHandler *, const Datum&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'generate'" << endl
+                                  << "==========" << endl;
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_json;      // value
+            const char *d_events;    // expected events
+        } DATA[] = {
+            //LINE  JSON                              EVENTS
+            //----  ----                              ------
+            { L_,   "null",                           "N,"                },
+            { L_,   "2",                              "2,"                },
+            { L_,   "\"s\"",                          "'s',"              },
+            { L_,   "[]",                             "[]"                },
+            { L_,   "{}",                             "{}"                },
+            { L_,   "[false,[],{\"k\":[null]}]",      "[F,[]{k:[N,]}]"    },
+            { L_,   "{\"x\":{\"y\":\"z\"},\"w\":3}",  "{x:{y:'z',}w:3,}"  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const JSON   = DATA[ti].d_json;
+            const char *const EVENTS = DATA[ti].d_events;
+
+            if (veryVerbose) { T_ P_(LINE) P(JSON) }
+
+            MD value(&oa);
+            ASSERTV(LINE, 0 == decodeReference(&value, JSON));
+
+            for (int limit = -1; ; ++limit) {
+                EventRecorder recorder(limit);
+
+                int rc = Util::generate(&recorder, *value);
+                if (-1 == limit) {
+                    ASSERTV(LINE, rc, 0 == rc);
+                    ASSERTV(LINE, recorder.events(), EVENTS,
+                            EVENTS == recorder.events());
+                    continue;
+                }
+                ASSERTV(LINE, limit, 0 == bsl::string(EVENTS).compare(
+                                                  0,
+                                                  recorder.events().length(),
+                                                  recorder.events()));
+                if (0 == rc) {
+                    ASSERTV(LINE, limit, EVENTS == recorder.events());
+                    break;
+                }
+                ASSERTV(LINE, limit, rc, EventRecorder::k_STOPPED == rc);
+            }
+
+            Builder builder(&oa);
+            ASSERTV(LINE, 0 == Util::generate(&builder, *value));
+            ASSERTV(LINE, builder.isComplete());
+            ASSERTV(LINE, *value, builder.datum(), *value == builder.datum());
+        }
+
+        if (verbose) cout << "\nNon-JSON types." << endl;
+        {
+            bdld::DatumArrayBuilder arrayBuilder(&oa);
+            arrayBuilder.pushBack(bdld::Datum::createInteger(5));
+            arrayBuilder.pushBack(bdld::Datum::createDate(
+                                                    bdlt::Date(2018, 1, 2)));
+            MD value(arrayBuilder.commit(), &oa);
+
+            EventRecorder recorder;
+            ASSERT(0 == Util::generate(&recorder, *value));
+
+            bsl::ostringstream expected;
+            expected << "[<" << bdld::Datum::e_INTEGER << ">,<"
+                     << bdld::Datum::e_DATE << ">,]";
+            ASSERTV(recorder.events(), expected.str(),
+                    expected.str() == recorder.events());
+        }
+        ASSERTV(oa.numBytesInUse(), 0 == oa.numBytesInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            EventRecorder  recorder;
+            Handler *const NULL_HANDLER = 0;
+
+            ASSERT_PASS(Util::generate(&recorder,
+                                       bdld::Datum::createNull()));
+            ASSERT_FAIL(Util::generate(NULL_HANDLER,
+                                       bdld::Datum::createNull()));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'DatumStreamEncoder'
+        //
+        // Concerns:
+        //: 1 The text written for the events describing a 'Datum' is the text
+        //:   written by 'DatumUtil::encode' for that 'Datum', for every
+        //:   formatting option, including for empty arrays.
+        //:
+        //: 2 'value' accepts arrays and maps, and writes them as though the
+        //:   events describing them had been received.
+        //:
+        //: 3 'status' is positive if and only if the 'strictTypes' option is
+        //:   'true' and a non-JSON type has been written.
+        //:
+        //: 4 'value' returns a negative status for a type that cannot be
+        //:   written.
+        //:
+        //: 5 'isCompleteJSON' is 'true' exactly when a complete value has
+        //:   been written.
+        //:
+        //: 6 Memory is supplied by the allocator supplied at construction.
+        //
+        // Plan:
+        //: 1 For a set of values decoded from JSON, and several options,
+        //:   write the events produced by 'generate' and compare with the
+        //:   output of 'DatumUtil::encode'.  Also pass each value directly to
+        //:   'value'.  (C-1..2)
+        //:
+        //: 2 Write values of non-JSON types with and without 'strictTypes',
+        //:   and check 'status'.  Write a user-defined value.  (C-3..4)
+        //:
+        //: 3 Check 'isCompleteJSON' after each event of a small document.
+        //:   (C-5)
+        //:
+        //: 4 Use a test allocator and verify that the default allocator is
+        //:   not used.  (C-6)
+        //
+        // Testing:
+        //   DatumStreamEncoder(ostream&, Allocator *);
+        //   DatumStreamEncoder(ostream&, const DatumEncoderOptions&, Alloc *);
+        //   int startObject();
+        //   int memberName(const StringRef& name);
+        //   int endObject();
+        //   int startArray();
+        //   int endArray();
+        //   int value(const Datum& value);
+        //   bool isCompleteJSON() const;
+        //   int status() const;
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'DatumStreamEncoder'" << endl
+                                  << "====================" << endl;
+
+        static const char *const DATA[] = {
+            "null",
+            "1.25",
+            "\"a\\nb\"",
+            "[]",
+            "{}",
+            "[[],[[]],{},[{}]]",
+            "{\"a\":[],\"b\":{\"c\":[1,[],\"x\"]},\"d\":true}",
+            "[{\"k\":[]},[null,false]]",
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        baljsn::DatumEncoderOptions pretty;
+        pretty.setEncodingStyle(baljsn::EncodingStyle::e_PRETTY);
+        pretty.setInitialIndentLevel(1);
+        pretty.setSpacesPerLevel(3);
+
+        const baljsn::DatumEncoderOptions OPTIONS[] = {
+            baljsn::DatumEncoderOptions(),
+            pretty,
+        };
+        const int NUM_OPTIONS = sizeof OPTIONS / sizeof *OPTIONS;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const char *const JSON = DATA[ti];
+
+            if (veryVerbose) { T_ P(JSON) }
+
+            MD value(&sa);
+            ASSERTV(JSON, 0 == decodeReference(&value, JSON));
+
+            for (int oi = 0; oi < NUM_OPTIONS; ++oi) {
+                const bsl::string EXPECTED =
+                                         encodeReference(*value, OPTIONS[oi]);
+
+                for (int direct = 0; direct < 2; ++direct) {
+                    bslma::DefaultAllocatorGuard dag(&da);
+                    bsls::Types::Int64 numDefault = da.numAllocations();
+
+                    bsl::ostringstream output(&sa);
+                    {
+                        Encoder encoder(output, OPTIONS[oi], &oa);
+                        ASSERTV(JSON, &oa == encoder.allocator());
+                        ASSERTV(JSON, !encoder.isCompleteJSON());
+
+                        int rc = direct
+                               ? encoder.value(*value)
+                               : Util::generate(&encoder, *value);
+                        ASSERTV(JSON, oi, direct, rc, 0 == rc);
+                        ASSERTV(JSON, oi, direct, encoder.isCompleteJSON());
+                        ASSERTV(JSON, oi, direct, 0 == encoder.status());
+                    }
+                    ASSERTV(JSON, numDefault == da.numAllocations());
+                    ASSERTV(JSON, oi, direct, EXPECTED, output.str(),
+                            EXPECTED == output.str());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nDefault options." << endl;
+        {
+            bsl::ostringstream output(&sa);
+            Encoder            encoder(output);
+
+            ASSERT(&da == encoder.allocator());
+            ASSERT(0 == encoder.startArray());
+            ASSERT(0 == encoder.endArray());
+            ASSERT("[]" == output.str());
+        }
+
+        if (verbose) cout << "\n'isCompleteJSON'." << endl;
+        {
+            bsl::ostringstream output(&sa);
+            Encoder            encoder(output, &oa);
+
+            ASSERT(!encoder.isCompleteJSON());
+            encoder.startObject();
+            ASSERT(!encoder.isCompleteJSON());
+            encoder.memberName("a");
+            ASSERT(!encoder.isCompleteJSON());
+            encoder.startArray();
+            ASSERT(!encoder.isCompleteJSON());
+            encoder.endArray();
+            ASSERT(!encoder.isCompleteJSON());
+            encoder.endObject();
+            ASSERT( encoder.isCompleteJSON());
+            ASSERTV(output.str(), "{\"a\":[]}" == output.str());
+        }
+
+        if (verbose) cout << "\nNon-JSON types and 'status'." << endl;
+        {
+            baljsn::DatumEncoderOptions strict;
+            strict.setStrictTypes(true);
+
+            const bdld::Datum INTEGER = bdld::Datum::createInteger(3);
+            const bdld::Datum DATE    = bdld::Datum::createDate(
+                                                      bdlt::Date(2018, 3, 4));
+
+            for (int si = 0; si < 2; ++si) {
+                const baljsn::DatumEncoderOptions DEFAULT;
+                const baljsn::DatumEncoderOptions& OPT = si ? strict : DEFAULT;
+
+                bsl::ostringstream output(&sa);
+                Encoder            encoder(output, OPT, &oa);
+
+                ASSERT(0 == encoder.startArray());
+                ASSERT(0 == encoder.value(bdld::Datum::createDouble(1)));
+                ASSERT(0 == encoder.status());
+                ASSERT(0 == encoder.value(INTEGER));
+                ASSERTV(si, encoder.status(),
+                        si ? 0 < encoder.status() : 0 == encoder.status());
+                ASSERT(0 == encoder.value(DATE));
+                ASSERT(0 == encoder.endArray());
+                ASSERTV(si, encoder.status(),
+                        si ? 0 < encoder.status() : 0 == encoder.status());
+
+                bdld::DatumArrayBuilder arrayBuilder(&sa);
+                arrayBuilder.pushBack(bdld::Datum::createDouble(1));
+                arrayBuilder.pushBack(INTEGER);
+                arrayBuilder.pushBack(DATE);
+                MD array(arrayBuilder.commit(), &sa);
+
+                ASSERTV(output.str(), encodeReference(*array, OPT),
+                        encodeReference(*array, OPT) == output.str());
+            }
+
+            bsl::ostringstream output(&sa);
+            Encoder            encoder(output, &oa);
+
+            bdld::DatumUdt udt(0, 1);
+            ASSERT(0 >  encoder.value(bdld::Datum::createUdt(udt.data(),
+                                                             udt.type())));
+        }
+        ASSERTV(oa.numBytesInUse(), 0 == oa.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'DatumStreamBuilder'
+        //
+        // Concerns:
+        //: 1 A well-formed sequence of events builds the value it describes,
+        //:   with the first of several members having the same name retained.
+        //:
+        //: 2 An event that would make the sequence ill-formed returns a
+        //:   non-zero status and has no effect.
+        //:
+        //: 3 Scalar values are copied, so that they need not outlive the
+        //:   call to 'value', and arrays and maps passed to 'value' are
+        //:   copied in their entirety.
+        //:
+        //: 4 'release' transfers ownership of the value and resets the
+        //:   builder, which can then build another value; 'reset' discards
+        //:   a partially built value.
+        //:
+        //: 5 All memory, including that of the value built, is supplied by
+        //:   the allocator supplied at construction (or the default
+        //:   allocator), and the builder is exception-neutral and does not
+        //:   leak memory.
+        //
+        // Plan:
+        //: 1 Deliver events by hand for a nested document, and compare the
+        //:   result with that of 'DatumUtil::decode'.  (C-1, 3)
+        //:
+        //: 2 At several points in a sequence, deliver each event that would
+        //:   be ill-formed, verify its status, and verify that completing the
+        //:   sequence yields the expected value.  (C-2)
+        //:
+        //: 3 Release values and verify the builder's state; reset a
+        //:   partially built value.  (C-4)
+        //:
+        //: 4 Build values within the exception test macros using a test
+        //:   allocator, and verify that no memory is leaked.  (C-5)
+        //
+        // Testing:
+        //   DatumStreamBuilder(Allocator *);
+        //   ~DatumStreamBuilder();
+        //   int startObject();
+        //   int memberName(const StringRef& name);
+        //   int endObject();
+        //   int startArray();
+        //   int endArray();
+        //   int value(const Datum& value);
+        //   Datum release();
+        //   void reset();
+        //   const Datum& datum() const;
+        //   bool isComplete() const;
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'DatumStreamBuilder'" << endl
+                                  << "====================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nBuilding by hand." << endl;
+        {
+            MD expected(&sa);
+            ASSERT(0 == decodeReference(
+                                 &expected,
+                                 "{\"name\":\"a long string value!!!\","
+                                 "\"list\":[1,[],{},[true,null]],"
+                                 "\"empty\":\"\",\"name\":\"dup\","
+                                 "\"map\":{\"x\":{\"y\":[\"z\"]}}}"));
+
+            MD nested(&sa);
+            ASSERT(0 == decodeReference(&nested, "[true,null]"));
+
+            bslma::DefaultAllocatorGuard dag(&da);
+            bsls::Types::Int64           numDefault = da.numAllocations();
+
+            Builder builder(&oa);
+            ASSERT(&oa == builder.allocator());
+            ASSERT(!builder.isComplete());
+
+            bsl::string transient("a long string value!!!", &sa);
+
+            ASSERT(0 == builder.startObject());
+            ASSERT(0 == builder.memberName("name"));
+            ASSERT(0 == builder.value(bdld::Datum::createStringRef(
+                                                                transient,
+                                                                &sa)));
+            transient.assign(transient.length(), '#');
+            ASSERT(0 == builder.memberName("list"));
+            ASSERT(0 == builder.startArray());
+            ASSERT(0 == builder.value(bdld::Datum::createDouble(1)));
+            ASSERT(0 == builder.startArray());
+            ASSERT(0 == builder.endArray());
+            ASSERT(0 == builder.startObject());
+            ASSERT(0 == builder.endObject());
+            ASSERT(0 == builder.value(*nested));
+            ASSERT(0 == builder.endArray());
+            ASSERT(0 == builder.memberName("empty"));
+            ASSERT(0 == builder.value(bdld::Datum::createStringRef("", &sa)));
+            ASSERT(0 == builder.memberName("name"));
+            ASSERT(0 == builder.value(bdld::Datum::createStringRef("dup",
+                                                                   &sa)));
+            ASSERT(0 == builder.memberName("map"));
+            ASSERT(0 == builder.startObject());
+            ASSERT(0 == builder.memberName("x"));
+            ASSERT(0 == builder.startObject());
+            ASSERT(0 == builder.memberName("y"));
+            ASSERT(0 == builder.startArray());
+            ASSERT(0 == builder.value(bdld::Datum::createStringRef("z",
+                                                                   &sa)));
+            ASSERT(0 == builder.endArray());
+            ASSERT(0 == builder.endObject());
+            ASSERT(!builder.isComplete());
+            ASSERT(0 == builder.endObject());
+            ASSERT(!builder.isComplete());
+            ASSERT(0 == builder.endObject());
+            ASSERT( builder.isComplete());
+
+            ASSERTV(*expected, builder.datum(),
+                    *expected == builder.datum());
+            ASSERTV(da.numAllocations(), numDefault == da.numAllocations());
+
+            MD released(builder.release(), &oa);
+            ASSERT(!builder.isComplete());
+            ASSERTV(*expected, *released, *expected == *released);
+
+            ASSERT(0 == builder.value(bdld::Datum::createDouble(2)));
+            ASSERT(builder.isComplete());
+            ASSERT(bdld::Datum::createDouble(2) == builder.datum());
+        }
+        ASSERTV(oa.numBytesInUse(), 0 == oa.numBytesInUse());
+
+        if (verbose) cout << "\nIll-formed events." << endl;
+        {
+            // Each row is a prefix of events, followed by the events that are
+            // ill-formed after it, and by events completing the value.
+
+            static const struct {
+                int         d_line;      // source line number
+                const char *d_prefix;    // events delivered first
+                const char *d_invalid;   // ill-formed events
+                const char *d_rest;      // events completing the value
+                const char *d_expected;  // JSON of the completed value
+            } DATA[] = {
+                //LINE PREFIX   INVALID     REST     EXPECTED
+                //---- ------   -------     ----     --------
+                { L_,  "",      "n}]",      "v",     "1"                    },
+                { L_,  "v",     "{n}[]v",   "",      "1"                    },
+                { L_,  "{",     "]v[{",     "nv}",   "{\"k\":1}"            },
+                { L_,  "{n",    "n}]",      "v}",    "{\"k\":1}"            },
+                { L_,  "{nv",   "v[{]",     "}",     "{\"k\":1}"            },
+                { L_,  "[",     "n}",       "v]",    "[1]"                  },
+                { L_,  "[{",    "]v",       "}]",    "[{}]"                 },
+                { L_,  "{n[",   "}n",       "]}",    "{\"k\":[]}"           },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const char *const PREFIX   = DATA[ti].d_prefix;
+                const char *const INVALID  = DATA[ti].d_invalid;
+                const char *const REST     = DATA[ti].d_rest;
+                const char *const EXPECTED = DATA[ti].d_expected;
+
+                if (veryVerbose) { T_ P_(LINE) P_(PREFIX) P(INVALID) }
+
+                Builder builder(&oa);
+
+                struct Deliver {
+                    static int event(Builder *builder, char code)
+                        // Deliver to the specified 'builder' the event
+                        // identified by the specified 'code', and return
+                        // its status.
+                    {
+                        switch (code) {
+                          case '{': return builder->startObject();
+                          case 'n': return builder->memberName("k");
+                          case '}': return builder->endObject();
+                          case '[': return builder->startArray();
+                          case ']': return builder->endArray();
+                          default:  return builder->value(
+                                                bdld::Datum::createDouble(1));
+                        }
+                    }
+                };
+
+                for (const char *p = PREFIX; *p; ++p) {
+                    ASSERTV(LINE, *p, 0 == Deliver::event(&builder, *p));
+                }
+                for (const char *p = INVALID; *p; ++p) {
+                    ASSERTV(LINE, *p, 0 != Deliver::event(&builder, *p));
+                }
+                for (const char *p = REST; *p; ++p) {
+                    ASSERTV(LINE, *p, 0 == Deliver::event(&builder, *p));
+                }
+
+                MD expected(&sa);
+                ASSERTV(LINE, 0 == decodeReference(&expected, EXPECTED));
+                ASSERTV(LINE, builder.isComplete());
+                if (builder.isComplete()) {
+                    ASSERTV(LINE, *expected, builder.datum(),
+                            *expected == builder.datum());
+                }
+            }
+        }
+        ASSERTV(oa.numBytesInUse(), 0 == oa.numBytesInUse());
+
+        if (verbose) cout << "\n'reset'." << endl;
+        {
+            Builder builder(&oa);
+
+            ASSERT(0 == builder.startObject());
+            ASSERT(0 == builder.memberName("a long member name indeed"));
+            ASSERT(0 == builder.startArray());
+            ASSERT(0 == builder.value(bdld::Datum::createStringRef(
+                                               "a long string value indeed",
+                                               &sa)));
+            ASSERT(0 < oa.numBytesInUse());
+
+            builder.reset();
+            ASSERT(!builder.isComplete());
+
+            ASSERT(0 == builder.startArray());
+            ASSERT(0 == builder.endArray());
+            ASSERT(builder.isComplete());
+
+            builder.reset();
+            ASSERT(!builder.isComplete());
+            ASSERT(0 == builder.value(bdld::Datum::createNull()));
+            ASSERT(builder.isComplete());
+
+            // The destructor releases a partially built value.
+
+            builder.reset();
+            ASSERT(0 == builder.startArray());
+            ASSERT(0 == builder.value(bdld::Datum::createStringRef(
+                                               "a long string value indeed",
+                                               &sa)));
+        }
+        ASSERTV(oa.numBytesInUse(), 0 == oa.numBytesInUse());
+
+        if (verbose) cout << "\nDefault allocator." << endl;
+        {
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Builder builder;
+            ASSERT(&da == builder.allocator());
+        }
+
+        if (verbose) cout << "\nException neutrality." << endl;
+        {
+            const char *const JSON =
+                      "{\"aaaaaaaaaaaaaaaaaaaa\":[\"bbbbbbbbbbbbbbbbbbbbbbb\","
+                      "{\"c\":[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17]}],"
+                      "\"aaaaaaaaaaaaaaaaaaaa\":\"dddddddddddddddddddddddd\","
+                      "\"e\":{\"f\":\"gggggggggggggggggggggggggggggggg\"}}";
+
+            MD expected(&sa);
+            ASSERT(0 == decodeReference(&expected, JSON));
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Builder builder(&oa);
+
+                ASSERT(0 == Util::generate(&builder, *expected));
+                ASSERT(builder.isComplete());
+                ASSERT(*expected == builder.datum());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERTV(oa.numBytesInUse(), 0 == oa.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Parse a document into a builder, generate events from the result
+        //:   into an encoder, and decode a path from the encoded text.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const char *const JSON = "{\"a\":[1,\"two\",{\"b\":true}],\"c\":null}";
+
+        Builder builder(&oa);
+        ASSERT(0 == Util::parse(&builder, JSON));
+        ASSERT(builder.isComplete());
+
+        MD reference(&oa);
+        ASSERT(0 == baljsn::DatumUtil::decode(&reference, JSON));
+        ASSERT(*reference == builder.datum());
+
+        bsl::ostringstream output(&oa);
+        {
+            Encoder encoder(output, &oa);
+            ASSERT(0 == Util::generate(&encoder, builder.datum()));
+            ASSERT(encoder.isCompleteJSON());
+        }
+        ASSERTV(output.str(), JSON == output.str());
+
+        const bslstl::StringRef PATH = "a.2.b";
+        MD                      result(&oa);
+        ASSERT(0 == Util::decodePaths(&result, output.str(), &PATH, 1));
+        ASSERT(bdld::Datum::createBoolean(true) == *result);
+      } break;
+      default: {
+        cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    ASSERTV(ga.numBlocksInUse(), 0 == ga.numBlocksInUse());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -433,6 +433,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_review.h>
 #include <bsls_timeinterval.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_iosfwd.h>
 
 namespace BloombergLP {
@@ -490,6 +491,29 @@ struct TimeZoneUtil {
         // operation would have been outside the range of values representable
         // by the 'result' type.
 
+    static int convertUtcToLocalTime(bdlt::DatetimeTz     *results,
+                                     const char           *targetTimeZoneId,
+                                     const bdlt::Datetime *utcTimes,
+                                     bsl::size_t           numTimes);
+        // Load, into each of the specified 'numTimes' elements of the
+        // specified 'results' array, the local date-time value (in the time
+        // zone indicated by the specified 'targetTimeZoneId') corresponding to
+        // the UTC time at the same index of the specified 'utcTimes' array.
+        // The offset from UTC of the time zone is rounded down to minute
+        // precision.  Return 0 on success, and a non-zero value otherwise.  A
+        // return value of 'ErrorCode::k_UNSUPPORTED_ID' indicates that
+        // 'targetTimeZoneId' was not recognized (and 'results' is
+        // unmodified), and a return value of 'ErrorCode::k_OUT_OF_RANGE'
+        // indicates that the result of the operation would have been outside
+        // the range of values representable by 'bdlt::DatetimeTz' for at least
+        // one element of 'utcTimes' (the corresponding elements of 'results'
+        // are unmodified, and the remaining elements are loaded).  The
+        // behavior is undefined unless 'results' and 'utcTimes' each refer to
+        // an array of at least 'numTimes' elements.  Note that
+        // 'targetTimeZoneId' is looked up once for the entire array; see
+        // 'baltzo_utcoffsettable' for constant-time conversions to a time zone
+        // that is used repeatedly.
+
     static int convertLocalToLocalTime(LocalDatetime         *result,
                                        const char            *targetTimeZoneId,
                                        const LocalDatetime&   srcTime);
@@ -702,6 +726,25 @@ int TimeZoneUtil::convertUtcToLocalTime(
                                          DefaultZoneinfoCache::defaultCache());
 }
 
+inline
+int TimeZoneUtil::convertUtcToLocalTime(
+                                        bdlt::DatetimeTz     *results,
+                                        const char           *targetTimeZoneId,
+                                        const bdlt::Datetime *utcTimes,
+                                        bsl::size_t           numTimes)
+{
+    BSLS_ASSERT(results  || 0 == numTimes);
+    BSLS_ASSERT(targetTimeZoneId);
+    BSLS_ASSERT(utcTimes || 0 == numTimes);
+
+    return TimeZoneUtilImp::convertUtcToLocalTime(
+                                         results,
+                                         targetTimeZoneId,
+                                         utcTimes,
+                                         numTimes,
+                                         DefaultZoneinfoCache::defaultCache());
+}
+
 inline
 int TimeZoneUtil::convertLocalToLocalTime(
                                         LocalDatetime        *result,
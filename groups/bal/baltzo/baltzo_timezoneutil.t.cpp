@@ -27,6 +27,7 @@
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 #include <bsls_asserttest.h>
 #include <bsls_types.h>
@@ -46,6 +47,7 @@ using namespace bsl;
 // CLASS METHODS
 // [ 6] convertUtcToLocalTime(LclDatetm *, const char *, const Datetm&);
 // [ 6] convertUtcToLocalTime(DatetmTz *, const char *, const Datetm&);
+// [ 6] convertUtcToLocalTime(DatetmTz *, const ch *, const Datetm *, size_t);
 // [ 8] convertLocalToLocalTime(LclDatetm *, const ch *, const LclDatetm&)
 // [ 8] convertLocalToLocalTime(LclDatetm *, const ch *, const DatetmTz&);
 // [ 8] convertLocalToLocalTime(DatetmTz *, const ch *, const LclDatetm&);
@@ -2008,6 +2010,7 @@ int main(int argc, char *argv[])
         // Testing:
         //   convertUtcToLocalTime(LclDatetm *, const char *, const Datetm&);
         //   convertUtcToLocalTime(DatetmTz *, const char *, const Datetm&);
+        //   convertUtcToLocalTime(DatetmTz *, const ch *, const Datetm *, ...
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -2097,6 +2100,47 @@ int main(int argc, char *argv[])
 
                 LOOP2_ASSERT(LINE, resultLcl.timeZoneId(),
                              TZID == resultLcl.timeZoneId());
+
+                bdlt::DatetimeTz resultArray;
+                LOOP_ASSERT(LINE,
+                            0 == Obj::convertUtcToLocalTime(&resultArray,
+                                                            TZID,
+                                                            &TIME,
+                                                            1));
+
+                LOOP2_ASSERT(LINE, resultArray, resultArray == EXP_TIME_TZ);
+            }
+
+            if (veryVerbose) cout << "\tTest array convertUtcToLocalTime."
+                                  << endl;
+            {
+                // Convert all of the New York times in a single array.
+
+                bsl::vector<bdlt::Datetime>   times;
+                bsl::vector<bdlt::DatetimeTz> expected;
+
+                for (int i = 0; i < NUM_DATA; ++i) {
+                    if (0 == bsl::strcmp(NY, DATA[i].d_timeZoneId)) {
+                        times.push_back(toDatetime(DATA[i].d_input));
+                        expected.push_back(
+                                       toDatetimeTz(DATA[i].d_expectedResult));
+                    }
+                }
+
+                bsl::vector<bdlt::DatetimeTz> results(times.size());
+
+                ASSERT(0 == Obj::convertUtcToLocalTime(results.data(),
+                                                       NY,
+                                                       times.data(),
+                                                       times.size()));
+                ASSERT(expected == results);
+
+                LogVerbosityGuard guard;
+
+                ASSERT(EUID == Obj::convertUtcToLocalTime(results.data(),
+                                                          "bogusId",
+                                                          times.data(),
+                                                          times.size()));
             }
         }
 
@@ -2137,6 +2181,31 @@ int main(int argc, char *argv[])
                                                                  0,
                                                                  TIME));
 
+                // ------------------------------------------------------------
+
+                bdlt::DatetimeTz     *const NULL_RESULTS = 0;
+                const bdlt::Datetime *const NULL_TIMES   = 0;
+
+                ASSERT_PASS(Obj::convertUtcToLocalTime(&resultTz,
+                                                       "America/New_York",
+                                                       &TIME,
+                                                       1));
+                ASSERT_PASS(Obj::convertUtcToLocalTime(NULL_RESULTS,
+                                                       "America/New_York",
+                                                       NULL_TIMES,
+                                                       0));
+                ASSERT_FAIL(Obj::convertUtcToLocalTime(NULL_RESULTS,
+                                                       "America/New_York",
+                                                       &TIME,
+                                                       1));
+                ASSERT_FAIL(Obj::convertUtcToLocalTime(&resultTz,
+                                                       0,
+                                                       &TIME,
+                                                       1));
+                ASSERT_FAIL(Obj::convertUtcToLocalTime(&resultTz,
+                                                       "America/New_York",
+                                                       NULL_TIMES,
+                                                       1));
             }
         }
       } break;
@@ -24,6 +24,7 @@ BSLS_IDENT_RCSID(baltzo_timezoneutilimp_cpp,"$Id$ $CSID$")
 #include <bsls_log.h>
 #include <bsls_types.h>
 
+#include <bsl_limits.h>
 #include <bsl_ostream.h>
 
 namespace BloombergLP {
@@ -231,6 +232,62 @@ int TimeZoneUtilImp::convertUtcToLocalTime(
     return 0;
 }
 
+int TimeZoneUtilImp::convertUtcToLocalTime(
+                                        bdlt::DatetimeTz     *results,
+                                        const char           *resultTimeZoneId,
+                                        const bdlt::Datetime *utcTimes,
+                                        bsl::size_t           numTimes,
+                                        ZoneinfoCache        *cache)
+{
+    BSLS_ASSERT(results  || 0 == numTimes);
+    BSLS_ASSERT(resultTimeZoneId);
+    BSLS_ASSERT(utcTimes || 0 == numTimes);
+    BSLS_ASSERT(cache);
+
+    const Zoneinfo *timeZone;
+    int rc = lookupTimeZone(&timeZone, resultTimeZoneId, cache);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    // Timestamps are frequently ordered, so retain the period of validity of
+    // the most recently found transition, '[periodStart, periodEnd)', and
+    // search the transitions of 'timeZone' only for UTC times outside of it.
+    // The period is initially empty.
+
+    bdlt::EpochUtil::TimeT64 periodStart     = 1;
+    bdlt::EpochUtil::TimeT64 periodEnd       = 0;
+    int                      offsetInMinutes = 0;
+
+    for (bsl::size_t i = 0; i < numTimes; ++i) {
+        const bdlt::EpochUtil::TimeT64 utcTime =
+                               bdlt::EpochUtil::convertToTimeT64(utcTimes[i]);
+
+        if (utcTime < periodStart || periodEnd <= utcTime) {
+            Zoneinfo::TransitionConstIterator it =
+                              timeZone->findTransitionForUtcTime(utcTimes[i]);
+            Zoneinfo::TransitionConstIterator next = it;
+            ++next;
+
+            periodStart     = it->utcTime();
+            periodEnd       = timeZone->endTransitions() == next
+                            ? bsl::numeric_limits<
+                                            bdlt::EpochUtil::TimeT64>::max()
+                            : next->utcTime();
+            offsetInMinutes = it->descriptor().utcOffsetInSeconds() / 60;
+        }
+
+        bdlt::Datetime localTime(utcTimes[i]);
+        if (0 != localTime.addMinutesIfValid(offsetInMinutes)) {
+            rc = ErrorCode::k_OUT_OF_RANGE;
+            continue;
+        }
+        results[i].setDatetimeTz(localTime, offsetInMinutes);
+    }
+
+    return rc;
+}
+
 int TimeZoneUtilImp::initLocalTime(bdlt::DatetimeTz        *result,
                                    LocalTimeValidity::Enum *resultValidity,
                                    const bdlt::Datetime&    localTime,
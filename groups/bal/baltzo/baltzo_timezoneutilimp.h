@@ -142,6 +142,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_datetime.h>
 #include <bdlt_datetimetz.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_iosfwd.h>
 
 namespace BloombergLP {
@@ -173,6 +174,29 @@ struct TimeZoneUtilImp {
         // indicates that an out of range value of 'result' would have
         // occurred.
 
+    static int convertUtcToLocalTime(bdlt::DatetimeTz     *results,
+                                     const char           *resultTimeZoneId,
+                                     const bdlt::Datetime *utcTimes,
+                                     bsl::size_t           numTimes,
+                                     ZoneinfoCache        *cache);
+        // Load, into each of the specified 'numTimes' elements of the
+        // specified 'results' array, the local date-time value, in the time
+        // zone indicated by the specified 'resultTimeZoneId', corresponding
+        // to the UTC time at the same index of the specified 'utcTimes' array,
+        // using time zone information supplied by the specified 'cache'.
+        // Return 0 on success, and a non-zero value otherwise.  A return
+        // status of 'ErrorCode::k_UNSUPPORTED_ID' indicates that
+        // 'resultTimeZoneId' is not recognized (and 'results' is unmodified),
+        // and a return status of 'ErrorCode::k_OUT_OF_RANGE' indicates that an
+        // out of range value would have occurred for at least one element of
+        // 'results' (each such element is unmodified, and the remaining
+        // elements are loaded).  The behavior is undefined unless 'results'
+        // and 'utcTimes' each refer to an array of at least 'numTimes'
+        // elements.  Note that 'resultTimeZoneId' is looked up in 'cache' once
+        // for the entire array, and that the transitions of the time zone are
+        // searched only for those elements of 'utcTimes' that are not
+        // described by the same transition as the preceding element.
+
     static void createLocalTimePeriod(
                           LocalTimePeriod                          *result,
                           const Zoneinfo::TransitionConstIterator&  transition,
@@ -13,6 +13,7 @@
 
 
 #include <bsl_memory.h>
+#include <bsl_vector.h>
 
 #include <bdlt_iso8601util.h>
 #include <bdlt_epochutil.h>
@@ -54,13 +55,14 @@ using namespace bsl;
 //=============================================================================
 // CLASS METHODS
 // [ 2] convertUtcToLocalTime(Datetime *, char *, Datetime&, Cache *)
+// [ 7] convertUtcToLocalTime(DatetimeTz *, char *, Datetime *, size_t,...
 // [ 3] resolveLocalTime(...)
 // [ 4] 'initLocalTime(DatetimeTz *, Datetime& , char *, Dst, Cache *)
 // [ 5] 'createLocalTimePeriod(Period *, TransitionConstIter, Zoneinfo)'
 // [ 6] 'loadLocalTimePeriodForUtc(DatetimeTz *, Datetime& , char *, Cache *)
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 //=============================================================================
 //                    STANDARD BDE ASSERT TEST MACRO
 //-----------------------------------------------------------------------------
@@ -998,7 +1000,7 @@ int main(int argc, char *argv[])
     baltzo::DefaultZoneinfoCache::setDefaultCache(&badCache);
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -1127,6 +1129,181 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'convertUtcToLocalTime' (ARRAY)
+        //
+        // Concerns:
+        //: 1 Each element of the results array is the value loaded by the
+        //:   single-value 'convertUtcToLocalTime' for the corresponding UTC
+        //:   time, whether or not the UTC times are ordered.
+        //:
+        //: 2 Return 'Err::k_UNSUPPORTED_ID', with no effect on the results,
+        //:   if an invalid time zone id is passed.
+        //:
+        //: 3 An element whose result would be out of range is unmodified and
+        //:   causes 'Err::k_OUT_OF_RANGE' to be returned, while the remaining
+        //:   elements are loaded.
+        //:
+        //: 4 An empty array is supported, and null addresses are accepted for
+        //:   empty arrays.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each of several time zones, convert an ordered array of UTC
+        //:   times spanning several centuries, and the same array in reverse
+        //:   order, and compare each element with the result of the
+        //:   single-value 'convertUtcToLocalTime'.  (C-1)
+        //:
+        //: 2 Invoke 'convertUtcToLocalTime' passing an invalid time zone id
+        //:   and check the result.  (C-2)
+        //:
+        //: 3 Convert an array containing a UTC time whose local time is out of
+        //:   range.  (C-3)
+        //:
+        //: 4 Convert arrays of length 0.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   convertUtcToLocalTime(DatetimeTz *, char *, Datetime *, size_t,...
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl
+                          << "'convertUtcToLocalTime' (ARRAY)" << endl
+                          << "===============================" << endl;
+
+        const bdlt::DatetimeTz SENTINEL(bdlt::Datetime(2000, 1, 1), 1);
+
+        bsl::vector<bdlt::Datetime> times(Z);
+        for (bdlt::Datetime time(1883, 1, 1, 0, 0, 0, 123);
+             time < bdlt::Datetime(2040, 1, 1);
+             time.addSeconds(3 * 86400 + 3617)) {
+            times.push_back(time);
+        }
+        times.push_back(bdlt::Datetime(1, 1, 1, 12));
+        times.push_back(bdlt::Datetime(9999, 12, 31, 11));
+
+        bsl::vector<bdlt::Datetime> reversed(times.rbegin(),
+                                             times.rend(),
+                                             Z);
+
+        if (veryVerbose) cout << "\tTesting ordered and unordered times."
+                              << endl;
+        {
+            const char *IDS[] = { NY, RM, SA, RY, GMT, GP1, GM1, ALLDST,
+                                  OLDDST };
+            const int NUM_IDS = static_cast<int>(sizeof IDS / sizeof *IDS);
+
+            for (int ti = 0; ti < NUM_IDS; ++ti) {
+                const char *ID = IDS[ti];
+
+                const bsl::vector<bdlt::Datetime> *INPUTS[] = { &times,
+                                                                &reversed };
+
+                for (int oi = 0; oi < 2; ++oi) {
+                    const bsl::vector<bdlt::Datetime>& INPUT = *INPUTS[oi];
+
+                    bsl::vector<bdlt::DatetimeTz> results(INPUT.size(),
+                                                          SENTINEL,
+                                                          Z);
+
+                    const int RC = Obj::convertUtcToLocalTime(results.data(),
+                                                              ID,
+                                                              INPUT.data(),
+                                                              INPUT.size(),
+                                                              &testCache);
+                    LOOP2_ASSERT(ID, RC, 0 == RC);
+
+                    for (bsl::size_t i = 0; i < INPUT.size(); ++i) {
+                        bdlt::DatetimeTz expected;
+                        const int EXP_RC = Obj::convertUtcToLocalTime(
+                                                                   &expected,
+                                                                   ID,
+                                                                   INPUT[i],
+                                                                   &testCache);
+                        LOOP2_ASSERT(ID, i, 0 == EXP_RC);
+                        LOOP3_ASSERT(ID, INPUT[i], results[i],
+                                     expected == results[i]);
+                    }
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting an invalid time zone id." << endl;
+        {
+            bdlt::DatetimeTz results[2] = { SENTINEL, SENTINEL };
+
+            ASSERT(EUID == Obj::convertUtcToLocalTime(results,
+                                                      "bogusId",
+                                                      times.data(),
+                                                      2,
+                                                      &testCache));
+            ASSERT(SENTINEL == results[0]);
+            ASSERT(SENTINEL == results[1]);
+        }
+
+        if (veryVerbose) cout << "\tTesting results that are out of range."
+                              << endl;
+        {
+            // "Etc/GMT+1" is one hour behind UTC.
+
+            const bdlt::Datetime INPUT[] = {
+                bdlt::Datetime(   1, 1, 1,  0, 30),
+                bdlt::Datetime(   1, 1, 1,  1, 30),
+                bdlt::Datetime(2000, 1, 1, 12)
+            };
+
+            bdlt::DatetimeTz results[3] = { SENTINEL, SENTINEL, SENTINEL };
+
+            const int RC = Obj::convertUtcToLocalTime(results,
+                                                      GP1,
+                                                      INPUT,
+                                                      3,
+                                                      &testCache);
+            ASSERT(Err::k_OUT_OF_RANGE == RC);
+            ASSERT(SENTINEL == results[0]);
+            ASSERT(bdlt::DatetimeTz(bdlt::Datetime(1, 1, 1, 0, 30), -60)
+                                                                == results[1]);
+            ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2000, 1, 1, 11), -60)
+                                                                == results[2]);
+        }
+
+        if (veryVerbose) cout << "\tTesting empty arrays." << endl;
+        {
+            bdlt::DatetimeTz     *const NULL_RESULTS = 0;
+            const bdlt::Datetime *const NULL_TIMES   = 0;
+
+            ASSERT(0 == Obj::convertUtcToLocalTime(NULL_RESULTS,
+                                                   NY,
+                                                   NULL_TIMES,
+                                                   0,
+                                                   &testCache));
+        }
+
+        if (veryVerbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlt::DatetimeTz     result;
+            const bdlt::Datetime time;
+
+            bdlt::DatetimeTz     *const NULL_RESULTS = 0;
+            const bdlt::Datetime *const NULL_TIMES   = 0;
+
+            ASSERT_PASS(Obj::convertUtcToLocalTime(&result,      NY, &time,
+                                                   1, &testCache));
+            ASSERT_FAIL(Obj::convertUtcToLocalTime(NULL_RESULTS, NY, &time,
+                                                   1, &testCache));
+            ASSERT_FAIL(Obj::convertUtcToLocalTime(&result,      0,  &time,
+                                                   1, &testCache));
+            ASSERT_FAIL(Obj::convertUtcToLocalTime(&result, NY, NULL_TIMES,
+                                                   1, &testCache));
+            ASSERT_FAIL(Obj::convertUtcToLocalTime(&result,      NY, &time,
+                                                   1, 0));
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // CLASS METHOD 'loadLocalTimePeriodForUtc':
@@ -0,0 +1,148 @@
+// baltzo_utcoffsettable.cpp                                          -*-C++-*-
+#include <baltzo_utcoffsettable.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baltzo_utcoffsettable_cpp,"$Id$ $CSID$")
+
+#include <baltzo_errorcode.h>
+#include <baltzo_testloader.h>                // for testing
+#include <baltzo_zoneinfocache.h>             // for testing
+#include <baltzo_zoneinfoutil.h>
+
+namespace BloombergLP {
+namespace baltzo {
+
+namespace {
+
+const int k_SECONDS_PER_DAY = 24 * 60 * 60;
+
+}  // close unnamed namespace
+
+                            // --------------------
+                            // class UtcOffsetTable
+                            // --------------------
+
+// PRIVATE ACCESSORS
+int UtcOffsetTable::searchUtcOffsetInSeconds(
+                                          const bdlt::Datetime& utcTime) const
+{
+    return d_timeZone_p->findTransitionForUtcTime(utcTime)->descriptor()
+                                                        .utcOffsetInSeconds();
+}
+
+// CREATORS
+UtcOffsetTable::UtcOffsetTable(const Zoneinfo   *timeZone,
+                               int               firstYear,
+                               int               lastYear,
+                               bslma::Allocator *basicAllocator)
+: d_days(basicAllocator)
+, d_firstTime(0)
+, d_firstYear(firstYear)
+, d_lastYear(lastYear)
+, d_timeZone_p(timeZone)
+{
+    BSLS_ASSERT(timeZone);
+    BSLS_ASSERT(1         <= firstYear);
+    BSLS_ASSERT(firstYear <= lastYear);
+    BSLS_ASSERT(lastYear  <= 9999);
+    BSLS_ASSERT_SAFE(ZoneinfoUtil::isWellFormed(*timeZone));
+
+    const bdlt::Date firstDate(firstYear, 1, 1);
+    const int        numDays = bdlt::Date(lastYear, 12, 31) - firstDate + 1;
+
+    d_firstTime = bdlt::EpochUtil::convertToTimeT64(bdlt::Datetime(firstDate));
+    d_days.resize(numDays);
+
+    // 'current' refers to the transition in effect at the start of each day;
+    // 'next' refers to the transition following 'current'.
+
+    Zoneinfo::TransitionConstIterator current =
+                timeZone->findTransitionForUtcTime(bdlt::Datetime(firstDate));
+    Zoneinfo::TransitionConstIterator next = current;
+    ++next;
+
+    const Zoneinfo::TransitionConstIterator end = timeZone->endTransitions();
+
+    bdlt::EpochUtil::TimeT64 dayStart = d_firstTime;
+
+    for (int i = 0; i < numDays; ++i, dayStart += k_SECONDS_PER_DAY) {
+        while (end != next && next->utcTime() <= dayStart) {
+            current = next;
+            ++next;
+        }
+
+        Day& day = d_days[i];
+
+        day.d_initialOffset = current->descriptor().utcOffsetInSeconds();
+        day.d_finalOffset   = day.d_initialOffset;
+        day.d_split         = k_SECONDS_PER_DAY;
+
+        const bdlt::EpochUtil::TimeT64 dayEnd = dayStart + k_SECONDS_PER_DAY;
+
+        if (end != next && next->utcTime() < dayEnd) {
+            Zoneinfo::TransitionConstIterator afterNext = next;
+            ++afterNext;
+
+            if (end != afterNext && afterNext->utcTime() < dayEnd) {
+                day.d_split = -1;
+            }
+            else {
+                day.d_finalOffset = next->descriptor().utcOffsetInSeconds();
+                day.d_split       = static_cast<int>(next->utcTime()
+                                                                  - dayStart);
+            }
+        }
+    }
+}
+
+// ACCESSORS
+int UtcOffsetTable::convertUtcToLocalTime(bdlt::DatetimeTz      *result,
+                                          const bdlt::Datetime&  utcTime) const
+{
+    BSLS_ASSERT(result);
+
+    const int offsetInMinutes = utcOffsetInSeconds(utcTime) / 60;
+
+    bdlt::Datetime localTime(utcTime);
+    if (0 != localTime.addMinutesIfValid(offsetInMinutes)) {
+        return ErrorCode::k_OUT_OF_RANGE;                             // RETURN
+    }
+
+    result->setDatetimeTz(localTime, offsetInMinutes);
+    return 0;
+}
+
+int UtcOffsetTable::convertUtcToLocalTime(bdlt::DatetimeTz     *results,
+                                          const bdlt::Datetime *utcTimes,
+                                          bsl::size_t           numTimes) const
+{
+    BSLS_ASSERT(results  || 0 == numTimes);
+    BSLS_ASSERT(utcTimes || 0 == numTimes);
+
+    int rc = 0;
+    for (bsl::size_t i = 0; i < numTimes; ++i) {
+        if (0 != convertUtcToLocalTime(results + i, utcTimes[i])) {
+            rc = ErrorCode::k_OUT_OF_RANGE;
+        }
+    }
+    return rc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
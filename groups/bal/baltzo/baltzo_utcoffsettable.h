@@ -0,0 +1,353 @@
+// baltzo_utcoffsettable.h                                            -*-C++-*-
+#ifndef INCLUDED_BALTZO_UTCOFFSETTABLE
+#define INCLUDED_BALTZO_UTCOFFSETTABLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a precomputed table of UTC offsets for a time zone.
+//
+//@CLASSES:
+//  baltzo::UtcOffsetTable: constant-time UTC-to-local conversion for a zone
+//
+//@SEE_ALSO: baltzo_zoneinfo, baltzo_zoneinfocache, baltzo_timezoneutil
+//
+//@DESCRIPTION: This component provides a mechanism, 'baltzo::UtcOffsetTable',
+// that converts UTC times to the local time of a single time zone in constant
+// time.  A 'UtcOffsetTable' is constructed from the address of a well-formed
+// 'baltzo::Zoneinfo' object and a range of years, '[firstYear, lastYear]'.
+// On construction, the sequence of transitions of the time zone is flattened
+// into one entry per UTC day of the year range, each entry holding the offset
+// from UTC in effect at the start of the day, and, if the time zone has a
+// transition during that day, the time of the transition and the offset from
+// UTC in effect after it.  The offset for any UTC time in the year range is
+// then found by indexing the entry for its day, rather than by searching the
+// sequence of transitions (see 'baltzo::Zoneinfo::findTransitionForUtcTime').
+// UTC times outside of the year range, and the (rare) days on which the time
+// zone has more than one transition, are resolved by searching the
+// transitions of the 'Zoneinfo' object, so a 'UtcOffsetTable' provides the
+// same results as 'baltzo::ZoneinfoUtil::convertUtcToLocalTime' for all UTC
+// times.  A table occupies approximately 4.4 kilobytes per year of its range.
+//
+///Time Zone Handles
+///-----------------
+// The 'baltzo::Zoneinfo' object supplied to a 'UtcOffsetTable' is held, not
+// owned, and is never modified.  The addresses returned by
+// 'baltzo::ZoneinfoCache::getZoneinfo' are valid, and the objects they refer
+// to are immutable, for the lifetime of the cache, so a 'UtcOffsetTable'
+// constructed from such an address is a handle to an already-loaded time zone:
+// conversions through the table do not look up the time-zone identifier in
+// the cache, and do not acquire the lock that synchronizes access to it.
+//
+///Thread Safety
+///-------------
+// 'baltzo::UtcOffsetTable' is *const* *thread-safe*, meaning that accessors
+// may be invoked concurrently from different threads.  Since all
+// non-creator methods of 'UtcOffsetTable' are accessors, a single table may
+// be shared by any number of threads without synchronization.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Converting a Batch of UTC Times to Local Time
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to convert a large number of UTC timestamps to local
+// time in New York.  First, we create a (simplified) description of the New
+// York time zone for the years 2010 and 2011, and make it available through a
+// 'baltzo::ZoneinfoCache':
+//..
+//  baltzo::LocalTimeDescriptor est(-5 * 60 * 60, false, "EST");
+//  baltzo::LocalTimeDescriptor edt(-4 * 60 * 60, true,  "EDT");
+//
+//  baltzo::Zoneinfo newYork;
+//  newYork.setIdentifier("America/New_York");
+//  newYork.addTransition(bdlt::EpochUtil::convertToTimeT64(
+//                                                    bdlt::Datetime(1, 1, 1)),
+//                        est);
+//  newYork.addTransition(bdlt::EpochUtil::convertToTimeT64(
+//                                         bdlt::Datetime(2010,  3, 14, 7)),
+//                        edt);
+//  newYork.addTransition(bdlt::EpochUtil::convertToTimeT64(
+//                                         bdlt::Datetime(2010, 11,  7, 6)),
+//                        est);
+//  newYork.addTransition(bdlt::EpochUtil::convertToTimeT64(
+//                                         bdlt::Datetime(2011,  3, 13, 7)),
+//                        edt);
+//  newYork.addTransition(bdlt::EpochUtil::convertToTimeT64(
+//                                         bdlt::Datetime(2011, 11,  6, 6)),
+//                        est);
+//
+//  baltzo::TestLoader loader;
+//  loader.setTimeZone(newYork);
+//
+//  baltzo::ZoneinfoCache cache(&loader);
+//..
+// Then, we obtain the address of the cached time-zone information for New
+// York, once, and use it to create an offset table covering the years 2010 to
+// 2012:
+//..
+//  const baltzo::Zoneinfo *zoneinfo = cache.getZoneinfo("America/New_York");
+//  assert(0 != zoneinfo);
+//
+//  baltzo::UtcOffsetTable table(zoneinfo, 2010, 2012);
+//..
+// Next, we convert an array of UTC times to local time:
+//..
+//  const bdlt::Datetime utcTimes[] = {
+//      bdlt::Datetime(2010,  3, 14,  6, 59, 59),
+//      bdlt::Datetime(2010,  3, 14,  7),
+//      bdlt::Datetime(2011, 12, 25, 12)
+//  };
+//
+//  bdlt::DatetimeTz localTimes[3];
+//
+//  int rc = table.convertUtcToLocalTime(localTimes, utcTimes, 3);
+//  assert(0 == rc);
+//..
+// Now, we verify that the first time was converted to Eastern Standard Time,
+// and the second, the moment of the transition, to Eastern Daylight Time:
+//..
+//  assert(bdlt::DatetimeTz(bdlt::Datetime(2010,  3, 14,  1, 59, 59), -300)
+//                                                           == localTimes[0]);
+//  assert(bdlt::DatetimeTz(bdlt::Datetime(2010,  3, 14,  3), -240)
+//                                                           == localTimes[1]);
+//  assert(bdlt::DatetimeTz(bdlt::Datetime(2011, 12, 25,  7), -300)
+//                                                           == localTimes[2]);
+//..
+// Finally, we observe that a UTC time outside of the year range of the table
+// is still converted correctly:
+//..
+//  bdlt::DatetimeTz localTime;
+//  rc = table.convertUtcToLocalTime(&localTime,
+//                                   bdlt::Datetime(2009, 7, 1, 12));
+//  assert(0 == rc);
+//  assert(bdlt::DatetimeTz(bdlt::Datetime(2009, 7, 1, 7), -300)
+//                                                               == localTime);
+//..
+
+#include <balscm_version.h>
+
+#include <baltzo_zoneinfo.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_epochutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace baltzo {
+
+                            // ====================
+                            // class UtcOffsetTable
+                            // ====================
+
+class UtcOffsetTable {
+    // This class provides a mechanism that holds the address of a time zone
+    // description, and a table of the offsets from UTC in that time zone for
+    // each UTC day of a range of years, and converts UTC times to the local
+    // time of the time zone in constant time.
+    //
+    // This class:
+    //: o is *exception-neutral*
+    //: o is *const* *thread-safe*
+    // For terminology see 'bsldoc_glossary'.
+
+    // PRIVATE TYPES
+    struct Day {
+        // This 'struct' describes the offsets from UTC in effect during a UTC
+        // day.
+
+        int d_initialOffset;  // offset (in seconds) at the start of the day
+
+        int d_finalOffset;    // offset (in seconds) after 'd_split'
+
+        int d_split;          // seconds from the start of the day at which
+                              // 'd_finalOffset' takes effect, or negative if
+                              // the day has more than one transition
+    };
+
+    // DATA
+    bsl::vector<Day>          d_days;        // one entry per UTC day
+
+    bdlt::EpochUtil::TimeT64  d_firstTime;   // start of the first UTC day
+
+    int                       d_firstYear;   // first year of the table
+
+    int                       d_lastYear;    // last year of the table
+
+    const Zoneinfo           *d_timeZone_p;  // time zone (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    UtcOffsetTable(const UtcOffsetTable&);
+    UtcOffsetTable& operator=(const UtcOffsetTable&);
+
+    // PRIVATE ACCESSORS
+    int searchUtcOffsetInSeconds(const bdlt::Datetime& utcTime) const;
+        // Return the offset from UTC, in seconds, in effect at the specified
+        // 'utcTime' in the time zone described by this table, found by
+        // searching the transitions of the time zone.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(UtcOffsetTable, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    UtcOffsetTable(const Zoneinfo   *timeZone,
+                   int               firstYear,
+                   int               lastYear,
+                   bslma::Allocator *basicAllocator = 0);
+        // Create a table of the offsets from UTC in the time zone described by
+        // the specified 'timeZone' for each UTC day of the years in the range
+        // '[firstYear .. lastYear]'.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless 'timeZone' is well-formed (see 'ZoneinfoUtil::isWellFormed'),
+        // 'timeZone' remains valid and unmodified for the lifetime of this
+        // object, and '1 <= firstYear <= lastYear <= 9999'.
+
+    //! ~UtcOffsetTable() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    int convertUtcToLocalTime(bdlt::DatetimeTz      *result,
+                              const bdlt::Datetime&  utcTime) const;
+        // Load, into the specified 'result', the local date-time value, in the
+        // time zone described by this table, corresponding to the specified
+        // 'utcTime'.  The offset from UTC of the time zone is rounded down to
+        // minute precision.  Return 0 on success, and
+        // 'ErrorCode::k_OUT_OF_RANGE', with no effect on 'result', if the
+        // local date-time value would be outside the range of values
+        // representable by 'bdlt::Datetime'.  Note that the result is the same
+        // as that of 'ZoneinfoUtil::convertUtcToLocalTime' for the time zone
+        // of this table.
+
+    int convertUtcToLocalTime(bdlt::DatetimeTz     *results,
+                              const bdlt::Datetime *utcTimes,
+                              bsl::size_t           numTimes) const;
+        // Load, into each of the specified 'numTimes' elements of the
+        // specified 'results' array, the local date-time value, in the time
+        // zone described by this table, corresponding to the UTC time at the
+        // same index of the specified 'utcTimes' array.  The offset from UTC
+        // of the time zone is rounded down to minute precision.  Return 0 on
+        // success, and 'ErrorCode::k_OUT_OF_RANGE' if the local date-time
+        // value corresponding to any element of 'utcTimes' would be outside
+        // the range of values representable by 'bdlt::Datetime', in which
+        // case the corresponding elements of 'results' are unmodified (and
+        // the remaining elements are loaded).  The behavior is undefined
+        // unless 'results' and 'utcTimes' each refer to an array of at least
+        // 'numTimes' elements.
+
+    int firstYear() const;
+        // Return the first year of the range of years covered by this table.
+
+    int lastYear() const;
+        // Return the last year of the range of years covered by this table.
+
+    const Zoneinfo& timeZone() const;
+        // Return a reference providing non-modifiable access to the time zone
+        // described by this table.
+
+    int utcOffsetInSeconds(const bdlt::Datetime& utcTime) const;
+        // Return the offset from UTC, in seconds, in effect at the specified
+        // 'utcTime' in the time zone described by this table.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // class UtcOffsetTable
+                            // --------------------
+
+// ACCESSORS
+inline
+int UtcOffsetTable::firstYear() const
+{
+    return d_firstYear;
+}
+
+inline
+int UtcOffsetTable::lastYear() const
+{
+    return d_lastYear;
+}
+
+inline
+const Zoneinfo& UtcOffsetTable::timeZone() const
+{
+    return *d_timeZone_p;
+}
+
+inline
+int UtcOffsetTable::utcOffsetInSeconds(const bdlt::Datetime& utcTime) const
+{
+    const bdlt::EpochUtil::TimeT64 time =
+                                    bdlt::EpochUtil::convertToTimeT64(utcTime);
+
+    // Times before 'd_firstTime' wrap to large unsigned values, and so fail
+    // the range check below.
+
+    const bsls::Types::Uint64 elapsed =
+                        static_cast<bsls::Types::Uint64>(time - d_firstTime);
+    const bsls::Types::Uint64 day     = elapsed / 86400;
+
+    if (day < d_days.size()) {
+        const Day& entry  = d_days[static_cast<bsl::size_t>(day)];
+        const int  second = static_cast<int>(elapsed - day * 86400);
+
+        if (0 <= entry.d_split) {
+            return second < entry.d_split ? entry.d_initialOffset
+                                          : entry.d_finalOffset;      // RETURN
+        }
+    }
+
+    return searchUtcOffsetInSeconds(utcTime);
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *UtcOffsetTable::allocator() const
+{
+    return d_days.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
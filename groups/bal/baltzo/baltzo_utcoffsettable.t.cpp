@@ -0,0 +1,965 @@
+// baltzo_utcoffsettable.t.cpp                                        -*-C++-*-
+#include <baltzo_utcoffsettable.h>
+
+#include <baltzo_errorcode.h>
+#include <baltzo_localtimedescriptor.h>
+#include <baltzo_testloader.h>
+#include <baltzo_zoneinfo.h>
+#include <baltzo_zoneinfocache.h>
+#include <baltzo_zoneinfoutil.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_epochutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism that flattens the transitions of a
+// time zone into a table having one entry per UTC day of a range of years.
+// The table is an implementation detail that is not directly observable, so
+// we test it by comparing the offsets and local times it produces with those
+// obtained by searching the transitions of the time zone (i.e., by
+// 'baltzo::Zoneinfo::findTransitionForUtcTime' and
+// 'baltzo::ZoneinfoUtil::convertUtcToLocalTime') over synthetic time zones
+// having transitions at day boundaries, several transitions in a single day,
+// offsets that are not a whole number of minutes, and transitions outside of
+// the range of years of the table.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] UtcOffsetTable(const Zoneinfo *, int, int, Allocator *);
+// [ 2] ~UtcOffsetTable();
+//
+// ACCESSORS
+// [ 4] int convertUtcToLocalTime(DatetimeTz *, const Datetime&) const;
+// [ 5] int convertUtcToLocalTime(DatetimeTz *, const Datetime *, size_t);
+// [ 2] int firstYear() const;
+// [ 2] int lastYear() const;
+// [ 2] const Zoneinfo& timeZone() const;
+// [ 3] int utcOffsetInSeconds(const bdlt::Datetime& utcTime) const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// ============================================================================
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baltzo::UtcOffsetTable      Obj;
+typedef baltzo::LocalTimeDescriptor Descriptor;
+typedef baltzo::Zoneinfo            Zoneinfo;
+typedef baltzo::ErrorCode           Err;
+typedef bsls::Types::Int64          Int64;
+
+// ============================================================================
+//                            TEST HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void addTransition(Zoneinfo              *timeZone,
+                   const bdlt::Datetime&  utcTime,
+                   const Descriptor&      descriptor)
+    // Add to the specified 'timeZone' a transition at the specified 'utcTime'
+    // to the specified 'descriptor'.
+{
+    timeZone->addTransition(bdlt::EpochUtil::convertToTimeT64(utcTime),
+                            descriptor);
+}
+
+void makeSimpleZone(Zoneinfo *timeZone)
+    // Load into the specified 'timeZone' a (simplified) description of the
+    // New York time zone, having an initial offset that is not a whole number
+    // of minutes, and transitions to and from daylight-saving time in the
+    // years 2009 through 2012.
+{
+    const Descriptor LMT(-17762, false, "LMT");
+    const Descriptor EST(-18000, false, "EST");
+    const Descriptor EDT(-14400, true,  "EDT");
+
+    timeZone->setIdentifier("SIMPLE");
+    addTransition(timeZone, bdlt::Datetime(   1,  1,  1),    LMT);
+    addTransition(timeZone, bdlt::Datetime(1883, 11, 18, 17), EST);
+
+    static const bdlt::Datetime TIMES[] = {
+        bdlt::Datetime(2009,  3,  8, 7), bdlt::Datetime(2009, 11,  1, 6),
+        bdlt::Datetime(2010,  3, 14, 7), bdlt::Datetime(2010, 11,  7, 6),
+        bdlt::Datetime(2011,  3, 13, 7), bdlt::Datetime(2011, 11,  6, 6),
+        bdlt::Datetime(2012,  3, 11, 7), bdlt::Datetime(2012, 11,  4, 6)
+    };
+    const int NUM_TIMES = static_cast<int>(sizeof TIMES / sizeof *TIMES);
+
+    for (int i = 0; i < NUM_TIMES; ++i) {
+        addTransition(timeZone, TIMES[i], 0 == i % 2 ? EDT : EST);
+    }
+}
+
+void makeIrregularZone(Zoneinfo *timeZone)
+    // Load into the specified 'timeZone' a synthetic time zone having
+    // transitions at the start and the end of UTC days, several transitions
+    // in a single UTC day, consecutive transitions to the same offset, and
+    // transitions outside of the years 2010 and 2011.
+{
+    const Descriptor A(  3600, false, "A");
+    const Descriptor B(  5400, true,  "B");
+    const Descriptor C(-43200, false, "C");
+    const Descriptor D( 50400, true,  "D");
+    const Descriptor E(    37, false, "E");
+
+    timeZone->setIdentifier("IRREGULAR");
+    addTransition(timeZone, bdlt::Datetime(   1,  1,  1),                A);
+    addTransition(timeZone, bdlt::Datetime(2005,  6, 15, 12),            B);
+    addTransition(timeZone, bdlt::Datetime(2009, 12, 31, 23, 59, 59),    C);
+    addTransition(timeZone, bdlt::Datetime(2010,  1,  1),                D);
+    addTransition(timeZone, bdlt::Datetime(2010,  1,  1,  0,  0,  1),    A);
+    addTransition(timeZone, bdlt::Datetime(2010,  6,  1),                B);
+    addTransition(timeZone, bdlt::Datetime(2010,  6,  2,  3),            C);
+    addTransition(timeZone, bdlt::Datetime(2010,  6,  2,  5, 30, 15),    D);
+    addTransition(timeZone, bdlt::Datetime(2010,  6,  2, 23, 59, 59),    E);
+    addTransition(timeZone, bdlt::Datetime(2010,  9,  9,  9),            E);
+    addTransition(timeZone, bdlt::Datetime(2011,  2, 28, 23, 59, 59),    A);
+    addTransition(timeZone, bdlt::Datetime(2011,  3,  1),                B);
+    addTransition(timeZone, bdlt::Datetime(2011, 12, 31, 23, 59, 59),    C);
+    addTransition(timeZone, bdlt::Datetime(2012,  1,  1, 12),            D);
+    addTransition(timeZone, bdlt::Datetime(2020,  1,  1),                E);
+}
+
+void makeConstantZone(Zoneinfo *timeZone, int utcOffsetInSeconds)
+    // Load into the specified 'timeZone' a time zone having the specified
+    // 'utcOffsetInSeconds' at all times.
+{
+    timeZone->setIdentifier("CONSTANT");
+    addTransition(timeZone,
+                  bdlt::Datetime(1, 1, 1),
+                  Descriptor(utcOffsetInSeconds, false, "K"));
+}
+
+void loadSampleTimes(bsl::vector<bdlt::Datetime> *result,
+                     const Zoneinfo&              timeZone,
+                     int                          firstYear,
+                     int                          lastYear)
+    // Load into the specified 'result' a sequence of UTC times for which to
+    // compare the results of a table for the specified 'timeZone' and the
+    // specified range of years '[firstYear, lastYear]' with the results of
+    // searching the transitions of 'timeZone': several times in each day of
+    // the range (and of the days adjacent to the range), and the times
+    // adjacent to each transition of 'timeZone'.
+{
+    static const int SECONDS[] = { 0, 1, 7 * 3600 - 1, 43200, 86399 };
+    const int NUM_SECONDS = static_cast<int>(sizeof SECONDS / sizeof *SECONDS);
+
+    bdlt::Datetime start(firstYear, 1, 1);
+    if (1 < firstYear) {
+        start.addDays(-2);
+    }
+    bdlt::Datetime end(lastYear, 12, 31);
+    if (9999 > lastYear) {
+        end.addDays(2);
+    }
+
+    for (bdlt::Datetime day = start; day <= end; day.addDays(1)) {
+        for (int i = 0; i < NUM_SECONDS; ++i) {
+            bdlt::Datetime time(day);
+            time.addSeconds(SECONDS[i]);
+            result->push_back(time);
+        }
+        if (day == end) {
+            break;
+        }
+    }
+
+    for (Zoneinfo::TransitionConstIterator it = timeZone.beginTransitions();
+         it != timeZone.endTransitions();
+         ++it) {
+        for (int delta = -1; delta <= 1; ++delta) {
+            const Int64 time = it->utcTime() + delta;
+            bdlt::Datetime datetime;
+            if (0 == bdlt::EpochUtil::convertFromTimeT64(&datetime, time)) {
+                result->push_back(datetime);
+            }
+        }
+    }
+
+    // Add a time having a fractional second.
+
+    result->push_back(bdlt::Datetime(firstYear, 1, 1, 0, 0, 0, 999, 999));
+}
+
+int expectedOffset(const Zoneinfo& timeZone, const bdlt::Datetime& utcTime)
+    // Return the offset from UTC, in seconds, in effect at the specified
+    // 'utcTime' in the specified 'timeZone', obtained by searching the
+    // transitions of 'timeZone'.
+{
+    return timeZone.findTransitionForUtcTime(utcTime)->descriptor()
+                                                        .utcOffsetInSeconds();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator testAllocator("test", veryVeryVeryVerbose);
+    bslma::TestAllocator *Z = &testAllocator;
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        // The example uses the default allocator.
+
+        bslma::DefaultAllocatorGuard usageGuard(Z);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Converting a Batch of UTC Times to Local Time
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to convert a large number of UTC timestamps to local
+// time in New York.  First, we create a (simplified) description of the New
+// York time zone for the years 2010 and 2011, and make it available through a
+// 'baltzo::ZoneinfoCache':
+//..
+    baltzo::LocalTimeDescriptor est(-5 * 60 * 60, false, "EST");
+    baltzo::LocalTimeDescriptor edt(-4 * 60 * 60, true,  "EDT");
+
+    baltzo::Zoneinfo newYork;
+    newYork.setIdentifier("America/New_York");
+    newYork.addTransition(bdlt::EpochUtil::convertToTimeT64(
+                                                      bdlt::Datetime(1, 1, 1)),
+                          est);
+    newYork.addTransition(bdlt::EpochUtil::convertToTimeT64(
+                                           bdlt::Datetime(2010,  3, 14, 7)),
+                          edt);
+    newYork.addTransition(bdlt::EpochUtil::convertToTimeT64(
+                                           bdlt::Datetime(2010, 11,  7, 6)),
+                          est);
+    newYork.addTransition(bdlt::EpochUtil::convertToTimeT64(
+                                           bdlt::Datetime(2011,  3, 13, 7)),
+                          edt);
+    newYork.addTransition(bdlt::EpochUtil::convertToTimeT64(
+                                           bdlt::Datetime(2011, 11,  6, 6)),
+                          est);
+
+    baltzo::TestLoader loader;
+    loader.setTimeZone(newYork);
+
+    baltzo::ZoneinfoCache cache(&loader);
+//..
+// Then, we obtain the address of the cached time-zone information for New
+// York, once, and use it to create an offset table covering the years 2010 to
+// 2012:
+//..
+    const baltzo::Zoneinfo *zoneinfo = cache.getZoneinfo("America/New_York");
+    ASSERT(0 != zoneinfo);
+
+    baltzo::UtcOffsetTable table(zoneinfo, 2010, 2012);
+//..
+// Next, we convert an array of UTC times to local time:
+//..
+    const bdlt::Datetime utcTimes[] = {
+        bdlt::Datetime(2010,  3, 14,  6, 59, 59),
+        bdlt::Datetime(2010,  3, 14,  7),
+        bdlt::Datetime(2011, 12, 25, 12)
+    };
+
+    bdlt::DatetimeTz localTimes[3];
+
+    int rc = table.convertUtcToLocalTime(localTimes, utcTimes, 3);
+    ASSERT(0 == rc);
+//..
+// Now, we verify that the first time was converted to Eastern Standard Time,
+// and the second, the moment of the transition, to Eastern Daylight Time:
+//..
+    ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2010,  3, 14,  1, 59, 59), -300)
+                                                             == localTimes[0]);
+    ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2010,  3, 14,  3), -240)
+                                                             == localTimes[1]);
+    ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2011, 12, 25,  7), -300)
+                                                             == localTimes[2]);
+//..
+// Finally, we observe that a UTC time outside of the year range of the table
+// is still converted correctly:
+//..
+    bdlt::DatetimeTz localTime;
+    rc = table.convertUtcToLocalTime(&localTime,
+                                     bdlt::Datetime(2009, 7, 1, 12));
+    ASSERT(0 == rc);
+    ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2009, 7, 1, 7), -300)
+                                                                 == localTime);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ARRAY 'convertUtcToLocalTime'
+        //
+        // Concerns:
+        //: 1 Each element of the results array is the value loaded by the
+        //:   single-value 'convertUtcToLocalTime' for the corresponding UTC
+        //:   time.
+        //:
+        //: 2 An element whose result would be out of range is unmodified and
+        //:   causes 'k_OUT_OF_RANGE' to be returned, while the remaining
+        //:   elements are loaded.
+        //:
+        //: 3 An empty array is supported, and null addresses are accepted for
+        //:   empty arrays.
+        //:
+        //: 4 No memory is allocated.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For tables of several synthetic time zones, convert an array of
+        //:   sample UTC times, and compare each element with the result of the
+        //:   single-value overload.  (C-1, 4)
+        //:
+        //: 2 Convert arrays containing times at the limits of 'bdlt::Datetime'
+        //:   for time zones having positive and negative offsets.  (C-2)
+        //:
+        //: 3 Convert arrays of length 0.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   int convertUtcToLocalTime(DatetimeTz *, const Datetime *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ARRAY 'convertUtcToLocalTime'" << endl
+                          << "=============================" << endl;
+
+        Zoneinfo simple(Z), irregular(Z);
+        makeSimpleZone(&simple);
+        makeIrregularZone(&irregular);
+
+        const Zoneinfo *ZONES[]   = { &simple, &irregular };
+        const int       NUM_ZONES = 2;
+
+        for (int ti = 0; ti < NUM_ZONES; ++ti) {
+            const Zoneinfo& ZONE = *ZONES[ti];
+
+            if (veryVerbose) { T_ P(ZONE.identifier()) }
+
+            const Obj X(&ZONE, 2010, 2011, Z);
+
+            bsl::vector<bdlt::Datetime> times(Z);
+            loadSampleTimes(&times, ZONE, 2008, 2013);
+
+            // Note that the sample times include the first transition, at
+            // 'bdlt::Datetime(1, 1, 1)', whose local time is out of range in
+            // time zones having a negative initial offset.
+
+            const bdlt::DatetimeTz SENTINEL(bdlt::Datetime(2000, 1, 1), 1);
+
+            bsl::vector<bdlt::DatetimeTz> results(times.size(), SENTINEL, Z);
+
+            bslma::TestAllocatorMonitor tam(Z);
+
+            const int RC = X.convertUtcToLocalTime(results.data(),
+                                                   times.data(),
+                                                   times.size());
+            ASSERTV(ti, tam.isTotalSame());
+
+            int expectedRc = 0;
+            for (bsl::size_t i = 0; i < times.size(); ++i) {
+                bdlt::DatetimeTz expected = SENTINEL;
+                if (0 != X.convertUtcToLocalTime(&expected, times[i])) {
+                    expectedRc = Err::k_OUT_OF_RANGE;
+                }
+                ASSERTV(ti, i, times[i], expected, results[i],
+                        expected == results[i]);
+            }
+            ASSERTV(ti, RC, expectedRc == RC);
+        }
+
+        if (verbose) cout << "\nTesting results that are out of range."
+                          << endl;
+        {
+            Zoneinfo east(Z), west(Z);
+            makeConstantZone(&east,  14 * 3600);
+            makeConstantZone(&west, -12 * 3600);
+
+            const bdlt::Datetime TIMES[] = {
+                bdlt::Datetime(   1,  1,  1,  1),
+                bdlt::Datetime(5000,  6, 15, 12),
+                bdlt::Datetime(9999, 12, 31, 23)
+            };
+
+            const bdlt::DatetimeTz SENTINEL(bdlt::Datetime(2000, 1, 1), 1);
+
+            {
+                const Obj X(&east, 9999, 9999, Z);
+
+                bdlt::DatetimeTz results[3] = { SENTINEL, SENTINEL, SENTINEL };
+                ASSERT(Err::k_OUT_OF_RANGE ==
+                                  X.convertUtcToLocalTime(results, TIMES, 3));
+
+                ASSERT(bdlt::DatetimeTz(bdlt::Datetime(1, 1, 1, 15), 840)
+                                                               == results[0]);
+                ASSERT(bdlt::DatetimeTz(bdlt::Datetime(5000, 6, 16, 2), 840)
+                                                               == results[1]);
+                ASSERT(SENTINEL == results[2]);
+            }
+            {
+                const Obj X(&west, 1, 1, Z);
+
+                bdlt::DatetimeTz results[3] = { SENTINEL, SENTINEL, SENTINEL };
+                ASSERT(Err::k_OUT_OF_RANGE ==
+                                  X.convertUtcToLocalTime(results, TIMES, 3));
+
+                ASSERT(SENTINEL == results[0]);
+                ASSERT(bdlt::DatetimeTz(bdlt::Datetime(5000, 6, 15, 0), -720)
+                                                               == results[1]);
+                ASSERT(bdlt::DatetimeTz(bdlt::Datetime(9999, 12, 31, 11),
+                                        -720)                  == results[2]);
+            }
+        }
+
+        if (verbose) cout << "\nTesting empty arrays." << endl;
+        {
+            const Obj X(&simple, 2010, 2010, Z);
+
+            bdlt::DatetimeTz     result;
+            const bdlt::Datetime time;
+
+            ASSERT(0 == X.convertUtcToLocalTime(&result, &time, 0));
+            ASSERT(bdlt::DatetimeTz() == result);
+
+            bdlt::DatetimeTz     *const NULL_RESULTS = 0;
+            const bdlt::Datetime *const NULL_TIMES   = 0;
+
+            ASSERT(0 == X.convertUtcToLocalTime(NULL_RESULTS, NULL_TIMES, 0));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Obj X(&simple, 2010, 2010, Z);
+
+            bdlt::DatetimeTz     result;
+            const bdlt::Datetime time;
+
+            bdlt::DatetimeTz     *const NULL_RESULTS = 0;
+            const bdlt::Datetime *const NULL_TIMES   = 0;
+
+            ASSERT_PASS(X.convertUtcToLocalTime(&result,      &time,      1));
+            ASSERT_FAIL(X.convertUtcToLocalTime(NULL_RESULTS, &time,      1));
+            ASSERT_FAIL(X.convertUtcToLocalTime(&result,      NULL_TIMES, 1));
+            ASSERT_PASS(X.convertUtcToLocalTime(NULL_RESULTS, NULL_TIMES, 0));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'convertUtcToLocalTime'
+        //
+        // Concerns:
+        //: 1 The result and status are those of
+        //:   'ZoneinfoUtil::convertUtcToLocalTime' for the time zone of the
+        //:   table, for UTC times inside and outside of the range of years of
+        //:   the table.
+        //:
+        //: 2 If the result would be out of range, 'result' is unmodified.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For tables of several synthetic time zones and ranges of years,
+        //:   convert a set of sample UTC times and compare the results with
+        //:   those of 'ZoneinfoUtil::convertUtcToLocalTime'.  (C-1)
+        //:
+        //: 2 Convert UTC times near the limits of 'bdlt::Datetime' for time
+        //:   zones having positive and negative offsets, and verify that
+        //:   'k_OUT_OF_RANGE' is returned and 'result' is unmodified.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   int convertUtcToLocalTime(DatetimeTz *, const Datetime&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'convertUtcToLocalTime'" << endl
+                          << "=======================" << endl;
+
+        Zoneinfo simple(Z), irregular(Z);
+        makeSimpleZone(&simple);
+        makeIrregularZone(&irregular);
+
+        const struct {
+            int             d_line;
+            const Zoneinfo *d_zone_p;
+            int             d_firstYear;
+            int             d_lastYear;
+        } DATA[] = {
+            //LINE  ZONE        FIRST  LAST
+            //----  ----------  -----  ----
+            { L_,   &simple,    2010,  2010 },
+            { L_,   &simple,    2008,  2013 },
+            { L_,   &simple,    1883,  1884 },
+            { L_,   &irregular, 2010,  2011 },
+            { L_,   &irregular, 2005,  2005 },
+            { L_,   &irregular, 2011,  2012 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int       LINE  = DATA[ti].d_line;
+            const Zoneinfo& ZONE  = *DATA[ti].d_zone_p;
+            const int       FIRST = DATA[ti].d_firstYear;
+            const int       LAST  = DATA[ti].d_lastYear;
+
+            if (veryVerbose) { T_ P_(LINE) P_(FIRST) P(LAST) }
+
+            const Obj X(&ZONE, FIRST, LAST, Z);
+
+            bsl::vector<bdlt::Datetime> times(Z);
+            loadSampleTimes(&times, ZONE, FIRST, LAST);
+
+            for (bsl::size_t i = 0; i < times.size(); ++i) {
+                bdlt::DatetimeTz                  expected;
+                Zoneinfo::TransitionConstIterator it;
+
+                const int EXP_RC = baltzo::ZoneinfoUtil::convertUtcToLocalTime(
+                                                                     &expected,
+                                                                     &it,
+                                                                     times[i],
+                                                                     ZONE);
+
+                bdlt::DatetimeTz result;
+                const int        RC = X.convertUtcToLocalTime(&result,
+                                                              times[i]);
+
+                ASSERTV(LINE, times[i], EXP_RC, RC, EXP_RC == RC);
+                ASSERTV(LINE, times[i], expected, result, expected == result);
+            }
+        }
+
+        if (verbose) cout << "\nTesting results that are out of range."
+                          << endl;
+        {
+            Zoneinfo east(Z), west(Z);
+            makeConstantZone(&east,  14 * 3600);
+            makeConstantZone(&west, -12 * 3600);
+
+            const bdlt::DatetimeTz SENTINEL(bdlt::Datetime(2000, 1, 1), 1);
+
+            const Obj E(&east, 9999, 9999, Z);
+            const Obj W(&west,    1,    1, Z);
+
+            bdlt::DatetimeTz result = SENTINEL;
+
+            ASSERT(Err::k_OUT_OF_RANGE == E.convertUtcToLocalTime(
+                                          &result,
+                                          bdlt::Datetime(9999, 12, 31, 10)));
+            ASSERT(SENTINEL == result);
+
+            ASSERT(0 == E.convertUtcToLocalTime(
+                                         &result,
+                                         bdlt::Datetime(9999, 12, 31,  9,
+                                                        59, 59, 999, 999)));
+            ASSERT(bdlt::DatetimeTz(bdlt::Datetime(9999, 12, 31, 23,
+                                                   59, 59, 999, 999),
+                                    840) == result);
+
+            result = SENTINEL;
+
+            ASSERT(Err::k_OUT_OF_RANGE == W.convertUtcToLocalTime(
+                                        &result,
+                                        bdlt::Datetime(1, 1, 1, 11, 59, 59)));
+            ASSERT(SENTINEL == result);
+
+            ASSERT(0 == W.convertUtcToLocalTime(&result,
+                                                bdlt::Datetime(1, 1, 1, 12)));
+            ASSERT(bdlt::DatetimeTz(bdlt::Datetime(1, 1, 1), -720) == result);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Obj X(&simple, 2010, 2010, Z);
+
+            bdlt::DatetimeTz result;
+
+            ASSERT_PASS(X.convertUtcToLocalTime(&result, bdlt::Datetime()));
+            ASSERT_FAIL(X.convertUtcToLocalTime(0,       bdlt::Datetime()));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'utcOffsetInSeconds'
+        //
+        // Concerns:
+        //: 1 The offset is that of the transition in effect at the supplied
+        //:   UTC time, for times inside and outside of the range of years of
+        //:   the table.
+        //:
+        //: 2 Transitions at the start or the end of a UTC day, several
+        //:   transitions in a single UTC day, and offsets that are not a whole
+        //:   number of minutes are handled correctly.
+        //:
+        //: 3 Tables covering the first and the last representable years are
+        //:   handled correctly.
+        //:
+        //: 4 No memory is allocated.
+        //
+        // Plan:
+        //: 1 For tables of several synthetic time zones and ranges of years,
+        //:   compare the offset returned for each of a set of sample UTC times
+        //:   with that found by 'Zoneinfo::findTransitionForUtcTime'.
+        //:   (C-1..2, 4)
+        //:
+        //: 2 Repeat P-1 for tables covering the years 1 and 9999.  (C-3)
+        //
+        // Testing:
+        //   int utcOffsetInSeconds(const bdlt::Datetime& utcTime) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'utcOffsetInSeconds'" << endl
+                          << "====================" << endl;
+
+        Zoneinfo simple(Z), irregular(Z), constant(Z);
+        makeSimpleZone(&simple);
+        makeIrregularZone(&irregular);
+        makeConstantZone(&constant, -3 * 3600 - 30 * 60);
+
+        const struct {
+            int             d_line;
+            const Zoneinfo *d_zone_p;
+            int             d_firstYear;
+            int             d_lastYear;
+        } DATA[] = {
+            //LINE  ZONE        FIRST  LAST
+            //----  ----------  -----  ----
+            { L_,   &simple,    2010,  2010 },
+            { L_,   &simple,    2009,  2012 },
+            { L_,   &simple,    2011,  2020 },
+            { L_,   &simple,    1883,  1883 },
+            { L_,   &simple,       1,     2 },
+            { L_,   &simple,    9998,  9999 },
+            { L_,   &irregular, 2010,  2010 },
+            { L_,   &irregular, 2010,  2011 },
+            { L_,   &irregular, 2004,  2012 },
+            { L_,   &irregular, 2019,  2021 },
+            { L_,   &constant,     1,     1 },
+            { L_,   &constant,  2000,  2000 },
+            { L_,   &constant,  9999,  9999 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int       LINE  = DATA[ti].d_line;
+            const Zoneinfo& ZONE  = *DATA[ti].d_zone_p;
+            const int       FIRST = DATA[ti].d_firstYear;
+            const int       LAST  = DATA[ti].d_lastYear;
+
+            if (veryVerbose) { T_ P_(LINE) P_(FIRST) P(LAST) }
+
+            const Obj X(&ZONE, FIRST, LAST, Z);
+
+            bsl::vector<bdlt::Datetime> times(Z);
+            loadSampleTimes(&times, ZONE, FIRST, LAST);
+
+            bslma::TestAllocatorMonitor tam(Z);
+
+            for (bsl::size_t i = 0; i < times.size(); ++i) {
+                const int EXP = expectedOffset(ZONE, times[i]);
+
+                ASSERTV(LINE, times[i], EXP, X.utcOffsetInSeconds(times[i]),
+                        EXP == X.utcOffsetInSeconds(times[i]));
+            }
+
+            ASSERTV(LINE, tam.isTotalSame());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructor stores the supplied time zone and range of
+        //:   years, which are reported by the corresponding accessors.
+        //:
+        //: 2 Memory is allocated from the allocator supplied at construction,
+        //:   or the default allocator if none is supplied, and all memory is
+        //:   released on destruction.
+        //:
+        //: 3 The memory used is proportional to the number of days in the
+        //:   range of years, not to the number of transitions.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create tables for several ranges of years, with and without an
+        //:   allocator, and verify the values of the accessors and the use of
+        //:   the allocators.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   UtcOffsetTable(const Zoneinfo *, int, int, Allocator *);
+        //   ~UtcOffsetTable();
+        //   int firstYear() const;
+        //   int lastYear() const;
+        //   const Zoneinfo& timeZone() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        Zoneinfo simple(Z);
+        makeSimpleZone(&simple);
+
+        const int RANGES[][2] = {
+            { 1, 1 }, { 1, 2 }, { 2010, 2010 }, { 2000, 2039 }, { 9999, 9999 }
+        };
+        const int NUM_RANGES = static_cast<int>(sizeof RANGES
+                                                / sizeof *RANGES);
+
+        for (int ti = 0; ti < NUM_RANGES; ++ti) {
+            const int FIRST = RANGES[ti][0];
+            const int LAST  = RANGES[ti][1];
+
+            if (veryVerbose) { T_ P_(FIRST) P(LAST) }
+
+            {
+                bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+                {
+                    const Obj X(&simple, FIRST, LAST, &sa);
+
+                    ASSERTV(ti, FIRST   == X.firstYear());
+                    ASSERTV(ti, LAST    == X.lastYear());
+                    ASSERTV(ti, &simple == &X.timeZone());
+                    ASSERTV(ti, &sa     == X.allocator());
+
+                    const Int64 NUM_DAYS = bdlt::Date(LAST, 12, 31)
+                                         - bdlt::Date(FIRST, 1, 1) + 1;
+
+                    ASSERTV(ti, 1 == sa.numBlocksInUse());
+                    ASSERTV(ti, NUM_DAYS * 12 <= sa.numBytesInUse());
+                    ASSERTV(ti, NUM_DAYS * 16 >= sa.numBytesInUse());
+                    ASSERTV(ti, 0 == defaultAllocator.numBlocksInUse());
+                }
+
+                ASSERTV(ti, 0 == sa.numBlocksInUse());
+            }
+            {
+                const Obj X(&simple, FIRST, LAST);
+
+                ASSERTV(ti, &defaultAllocator == X.allocator());
+                ASSERTV(ti, 1 == defaultAllocator.numBlocksInUse());
+            }
+            ASSERTV(ti, 0 == defaultAllocator.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Zoneinfo empty(Z);
+
+            const Zoneinfo *const NULL_ZONE = 0;
+
+            ASSERT_PASS(Obj(&simple,     1,    1, Z));
+            ASSERT_PASS(Obj(&simple,  9999, 9999, Z));
+            ASSERT_FAIL(Obj(NULL_ZONE,2010, 2010, Z));
+            ASSERT_FAIL(Obj(&simple,     0,    1, Z));
+            ASSERT_FAIL(Obj(&simple,  2011, 2010, Z));
+            ASSERT_FAIL(Obj(&simple,  9999, 10000, Z));
+            ASSERT_SAFE_FAIL(Obj(&empty, 2010, 2010, Z));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a table for a simple time zone, and convert a few UTC
+        //:   times inside and outside of its range of years.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Zoneinfo simple(Z);
+        makeSimpleZone(&simple);
+
+        const Obj X(&simple, 2010, 2011, Z);
+
+        ASSERT(-18000 == X.utcOffsetInSeconds(bdlt::Datetime(2010,  1,  1)));
+        ASSERT(-14400 == X.utcOffsetInSeconds(bdlt::Datetime(2010,  7,  1)));
+        ASSERT(-14400 == X.utcOffsetInSeconds(bdlt::Datetime(2009,  7,  1)));
+        ASSERT(-17762 == X.utcOffsetInSeconds(bdlt::Datetime(1800,  1,  1)));
+
+        bdlt::DatetimeTz result;
+        ASSERT(0 == X.convertUtcToLocalTime(&result,
+                                            bdlt::Datetime(2010, 7, 1, 12)));
+        ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2010, 7, 1, 8), -240)
+                                                                    == result);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
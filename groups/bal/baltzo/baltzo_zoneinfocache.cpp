@@ -61,7 +61,7 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
         return result;                                                // RETURN
     }
 
-    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_lock);
+    bslmt::WriteLockGuard<bslmt::DistributedReaderWriterMutex> guard(&d_lock);
 
     // We use 'lower_bound' to return the position where the 'timeZoneId'
     // should be (even if it is not in the map), so that it can be used as an
@@ -129,7 +129,7 @@ const Zoneinfo *ZoneinfoCache::lookupZoneinfo(const char *timeZoneId) const
 {
     BSLS_ASSERT(0 != timeZoneId);
 
-    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_lock);
+    bslmt::ReadLockGuard<bslmt::DistributedReaderWriterMutex> guard(&d_lock);
 
     ZoneinfoMap::const_iterator it = d_cache.find(timeZoneId);
     if (d_cache.end() != it) {
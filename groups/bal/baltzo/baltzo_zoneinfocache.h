@@ -157,7 +157,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
-#include <bslmt_rwmutex.h>
+#include <bslmt_distributedreaderwritermutex.h>
 
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
@@ -199,7 +199,10 @@ class ZoneinfoCache {
     Loader                  *d_loader_p;     // loader used to obtain time-zone
                                              // information (held, not owned)
 
-    mutable bslmt::RWMutex  d_lock;         // cache access synchronization
+    mutable bslmt::DistributedReaderWriterMutex
+                             d_lock;         // cache access synchronization;
+                                             // lookups, which dominate, do not
+                                             // contend with each other
 
     bslma::Allocator        *d_allocator_p;  // allocator (held, not owned)
 
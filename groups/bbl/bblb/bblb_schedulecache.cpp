@@ -0,0 +1,291 @@
+// bblb_schedulecache.cpp                                             -*-C++-*-
+#include <bblb_schedulecache.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bblb_schedulecache_cpp,"$Id$ $CSID$")
+
+#include <bblb_schedulegenerationutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_latch.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bblb {
+
+namespace {
+
+typedef bsl::shared_ptr<bsl::vector<bdlt::Date> > MutableSchedulePtr;
+
+void generateSchedules(MutableSchedulePtr     *schedules,
+                       const ScheduleRequest **requests,
+                       bsl::size_t             numSchedules,
+                       bslma::Allocator       *allocator)
+    // Load, into each of the specified 'numSchedules' elements of the
+    // specified 'schedules' array, a newly created schedule, allocated from
+    // the specified 'allocator', that is described by the request addressed
+    // by the corresponding element of the specified 'requests' array.
+{
+    for (bsl::size_t i = 0; i < numSchedules; ++i) {
+        schedules[i] =
+                  bsl::allocate_shared<bsl::vector<bdlt::Date> >(allocator);
+        ScheduleGenerationUtil::generate(schedules[i].get(), *requests[i]);
+    }
+}
+
+void generateSchedulesJob(MutableSchedulePtr     *schedules,
+                          const ScheduleRequest **requests,
+                          bsl::size_t             numSchedules,
+                          bslma::Allocator       *allocator,
+                          char                   *failed,
+                          bslmt::Latch           *latch)
+    // Invoke 'generateSchedules' with the specified 'schedules', 'requests',
+    // 'numSchedules', and 'allocator', then arrive at the specified 'latch'.
+    // If 'generateSchedules' throws, set the specified 'failed' flag instead
+    // of propagating the exception (to the thread pool).
+{
+    try {
+        generateSchedules(schedules, requests, numSchedules, allocator);
+    }
+    catch (...) {
+        *failed = 1;
+    }
+    latch->arrive();
+}
+
+bsl::size_t validLowWatermark(bsl::size_t lowWatermark,
+                              bsl::size_t highWatermark)
+    // Return the specified 'lowWatermark'.  The behavior is undefined unless
+    // '1 <= lowWatermark <= highWatermark', where 'highWatermark' is the
+    // specified high watermark.  Note that this function allows the
+    // preconditions of the constructor to be checked before the underlying
+    // cache is constructed.
+{
+    BSLS_ASSERT(1 <= lowWatermark);
+    BSLS_ASSERT(lowWatermark <= highWatermark);
+
+    return lowWatermark;
+}
+
+}  // close unnamed namespace
+
+                            // -------------------
+                            // class ScheduleCache
+                            // -------------------
+
+// PUBLIC CLASS DATA
+const bsl::size_t ScheduleCache::k_MIN_SCHEDULES_PER_JOB;
+
+// CREATORS
+ScheduleCache::ScheduleCache(bslma::Allocator *basicAllocator)
+: d_cache(basicAllocator)
+, d_numHits(0)
+, d_numMisses(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+ScheduleCache::ScheduleCache(bsl::size_t       lowWatermark,
+                             bsl::size_t       highWatermark,
+                             bslma::Allocator *basicAllocator)
+: d_cache(bdlcc::CacheEvictionPolicy::e_LRU,
+          validLowWatermark(lowWatermark, highWatermark),
+          highWatermark,
+          basicAllocator)
+, d_numHits(0)
+, d_numMisses(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+// MANIPULATORS
+void ScheduleCache::clear()
+{
+    d_cache.clear();
+    d_numHits   = 0;
+    d_numMisses = 0;
+}
+
+ScheduleCache::SchedulePtr ScheduleCache::getSchedule(
+                                                const ScheduleRequest& request)
+{
+    MutableSchedulePtr schedule;
+
+    if (0 == d_cache.tryGetValue(&schedule, request)) {
+        ++d_numHits;
+        return schedule;                                              // RETURN
+    }
+
+    const ScheduleRequest *requestPtr = &request;
+    generateSchedules(&schedule, &requestPtr, 1, d_allocator_p);
+    d_cache.insert(request, schedule);
+    ++d_numMisses;
+
+    return schedule;
+}
+
+void ScheduleCache::getSchedules(SchedulePtr            *results,
+                                 const ScheduleRequest  *requests,
+                                 bsl::size_t             numRequests,
+                                 bdlmt::FixedThreadPool *threadPool)
+{
+    BSLS_ASSERT(results  || 0 == numRequests);
+    BSLS_ASSERT(requests || 0 == numRequests);
+
+    if (0 == numRequests) {
+        return;                                                       // RETURN
+    }
+
+    bdlma::SequentialAllocator scratch(d_allocator_p);
+
+    // Map each request to the index of the first request having its value.
+
+    typedef bsl::unordered_map<ScheduleRequest,
+                               bsl::size_t,
+                               bslh::Hash<> > IndexMap;
+
+    IndexMap                          firstIndex(&scratch);
+    bsl::vector<bsl::size_t>          distinctIndex(numRequests, &scratch);
+    bsl::vector<const ScheduleRequest *>
+                                      missRequests(&scratch);
+    bsl::vector<bsl::size_t>          missIndices(&scratch);
+    bsl::vector<MutableSchedulePtr>   distinctSchedules(&scratch);
+
+    firstIndex.reserve(bsl::min<bsl::size_t>(numRequests, 1 << 16));
+
+    for (bsl::size_t i = 0; i < numRequests; ++i) {
+        bsl::pair<IndexMap::iterator, bool> rc =
+                 firstIndex.insert(bsl::make_pair(requests[i],
+                                                  distinctSchedules.size()));
+        distinctIndex[i] = rc.first->second;
+
+        if (rc.second) {
+            distinctSchedules.resize(distinctSchedules.size() + 1);
+            if (0 != d_cache.tryGetValue(&distinctSchedules.back(),
+                                         requests[i])) {
+                missRequests.push_back(requests + i);
+                missIndices.push_back(distinctSchedules.size() - 1);
+            }
+        }
+    }
+
+    // Generate the schedules that are not cached, fanning out across
+    // 'threadPool' if there are enough of them.
+
+    const bsl::size_t numMisses = missRequests.size();
+
+    bsl::vector<MutableSchedulePtr> generated(numMisses, &scratch);
+
+    bsl::size_t numJobs = 0;
+    if (threadPool && numMisses >= 2 * k_MIN_SCHEDULES_PER_JOB) {
+        numJobs = bsl::min<bsl::size_t>(
+                                      threadPool->numThreads(),
+                                      numMisses / k_MIN_SCHEDULES_PER_JOB - 1);
+    }
+
+    // The calling thread generates the first chunk; each job generates one of
+    // the remaining 'numJobs' chunks.  The jobs write into 'generated' and
+    // 'failed', so this function must not return, even by throwing, before
+    // every job has arrived at 'latch'.
+
+    const bsl::size_t chunkSize  = numMisses / (numJobs + 1);
+    const bsl::size_t firstChunk = numMisses - numJobs * chunkSize;
+
+    bsl::vector<char> failed(numJobs, 0, &scratch);
+    bslmt::Latch      latch(static_cast<int>(numJobs));
+    bsl::size_t       numStarted = 0;
+
+    try {
+        for (bsl::size_t begin = firstChunk;
+             numStarted < numJobs;
+             ++numStarted, begin += chunkSize) {
+            if (0 != threadPool->enqueueJob(
+                              bdlf::BindUtil::bind(&generateSchedulesJob,
+                                                   generated.data() + begin,
+                                                   missRequests.data() + begin,
+                                                   chunkSize,
+                                                   d_allocator_p,
+                                                   failed.data() + numStarted,
+                                                   &latch))) {
+                generateSchedulesJob(generated.data() + begin,
+                                     missRequests.data() + begin,
+                                     chunkSize,
+                                     d_allocator_p,
+                                     failed.data() + numStarted,
+                                     &latch);
+            }
+        }
+
+        generateSchedules(generated.data(),
+                          missRequests.data(),
+                          firstChunk,
+                          d_allocator_p);
+    }
+    catch (...) {
+        if (numStarted < numJobs) {
+            latch.countDown(static_cast<int>(numJobs - numStarted));
+        }
+        latch.wait();
+        throw;
+    }
+
+    latch.wait();
+
+    // Regenerate, on the calling thread, each chunk whose job failed, so that
+    // the exception (which cannot portably be transferred between threads in
+    // C++03) is thrown again to the caller.
+
+    for (bsl::size_t job = 0; job < numJobs; ++job) {
+        if (failed[job]) {
+            const bsl::size_t begin = firstChunk + job * chunkSize;
+
+            generateSchedules(generated.data() + begin,
+                              missRequests.data() + begin,
+                              chunkSize,
+                              d_allocator_p);
+        }
+    }
+
+    for (bsl::size_t i = 0; i < numMisses; ++i) {
+        d_cache.insert(*missRequests[i], generated[i]);
+        distinctSchedules[missIndices[i]] = generated[i];
+    }
+
+    for (bsl::size_t i = 0; i < numRequests; ++i) {
+        results[i] = distinctSchedules[distinctIndex[i]];
+    }
+
+    d_numMisses += numMisses;
+    d_numHits   += numRequests - numMisses;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
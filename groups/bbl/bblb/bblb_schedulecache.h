@@ -0,0 +1,329 @@
+// bblb_schedulecache.h                                               -*-C++-*-
+#ifndef INCLUDED_BBLB_SCHEDULECACHE
+#define INCLUDED_BBLB_SCHEDULECACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe, bounded cache of generated schedules.
+//
+//@CLASSES:
+//  bblb::ScheduleCache: bounded memo of schedules keyed by request
+//
+//@SEE_ALSO: bblb_schedulegenerationutil, bblb_schedulerequest, bdlcc_cache
+//
+//@DESCRIPTION: This component defines a mechanism, 'bblb::ScheduleCache',
+// that memoizes the schedules generated by 'bblb::ScheduleGenerationUtil',
+// keyed by the 'bblb::ScheduleRequest' describing each schedule.  Schedules
+// are returned as shared pointers to immutable 'bsl::vector<bdlt::Date>'
+// objects, so any number of instruments having identical schedule terms can
+// share a single schedule object.
+//
+// The number of schedules held by a 'ScheduleCache' can be bounded by
+// specifying a *low* *watermark* and a *high* *watermark* at construction:
+// when the number of cached schedules exceeds the high watermark, the least
+// recently used schedules are evicted until the number of cached schedules
+// equals the low watermark (see 'bdlcc_cache').  Evicting a schedule does not
+// invalidate shared pointers to it that were previously returned.
+//
+///Batch Requests
+///--------------
+// The 'getSchedules' method obtains the schedules for an array of requests.
+// Identical requests within the batch are identified (by hashing) and each
+// distinct schedule is generated at most once, whether or not it remains in
+// the cache for subsequent batches.  The distinct schedules that are not found
+// in the cache are generated by the calling thread or, when a
+// 'bdlmt::FixedThreadPool' is supplied and there are enough schedules to make
+// it worthwhile, by the threads of the pool and the calling thread together.
+//
+///Memory Allocation
+///-----------------
+// The generated schedules, and the nodes of the cache itself, are allocated
+// from the allocator supplied at construction; the memory used to deduplicate
+// a batch is drawn from a sequential arena (see 'bdlma_sequentialallocator')
+// on top of that allocator and released when the batch is complete.  Note
+// that the allocator supplied at construction must outlive every schedule
+// obtained from the cache (not just the cache itself), and must be thread-safe
+// if the cache is shared among threads or a thread pool is supplied to
+// 'getSchedules'.  A 'bdlma::ConcurrentMultipoolAllocator' is a natural
+// choice for large batches.
+//
+///Thread Safety
+///-------------
+// 'bblb::ScheduleCache' is fully thread-safe, meaning that all non-creator
+// operations on an object can be safely invoked simultaneously from multiple
+// threads.  Note that, if two threads request the same uncached schedule
+// simultaneously, the schedule may be generated twice; both threads obtain
+// schedules having the same value.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing Schedules Among Instruments
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need the quarterly payment schedules of a large set of
+// instruments, many of which have identical terms.
+//
+// First, we create a cache that holds at most 1000 schedules, evicting the
+// least recently used schedules down to 800 when that limit is exceeded:
+//..
+//  bblb::ScheduleCache cache(800, 1000);
+//..
+// Then, we describe the schedules of our instruments; here, 100 instruments
+// cycle through just three distinct sets of terms:
+//..
+//  bsl::vector<bblb::ScheduleRequest> requests(100);
+//  for (int i = 0; i < 100; ++i) {
+//      requests[i].setDayOfMonth(bdlt::Date(2020, 1, 1),  // earliest
+//                                bdlt::Date(2025, 1, 1),  // latest
+//                                2019,                    // example year
+//                                1 + i % 3,               // example month
+//                                3,                       // months apart
+//                                15);                     // day of month
+//  }
+//..
+// Next, we obtain all of the schedules in a single batch:
+//..
+//  bsl::vector<bblb::ScheduleCache::SchedulePtr> schedules(100);
+//  cache.getSchedules(schedules.data(), requests.data(), requests.size());
+//..
+// Now, we observe that only three schedules were generated, and that
+// instruments having the same terms share the same schedule object:
+//..
+//  assert(  3 == cache.numMisses());
+//  assert( 97 == cache.numHits());
+//  assert(  3 == cache.size());
+//  assert(schedules[0] == schedules[3]);
+//  assert(schedules[0] != schedules[1]);
+//
+//  assert(20                      == schedules[0]->size());
+//  assert(bdlt::Date(2020, 1, 15) == schedules[0]->front());
+//..
+// Finally, we obtain the schedule of another instrument individually, which is
+// served from the cache:
+//..
+//  bblb::ScheduleCache::SchedulePtr schedule = cache.getSchedule(requests[4]);
+//  assert(schedule == schedules[1]);
+//  assert(98       == cache.numHits());
+//..
+
+#include <bblscm_version.h>
+
+#include <bblb_schedulerequest.h>
+
+#include <bdlcc_cache.h>
+
+#include <bdlt_date.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+
+namespace bdlmt { class FixedThreadPool; }
+
+namespace bblb {
+
+                            // ===================
+                            // class ScheduleCache
+                            // ===================
+
+class ScheduleCache {
+    // This class implements a thread-safe, optionally bounded, least recently
+    // used cache of the schedules generated by 'ScheduleGenerationUtil',
+    // keyed by 'ScheduleRequest'.
+
+  public:
+    // TYPES
+    typedef bsl::shared_ptr<const bsl::vector<bdlt::Date> > SchedulePtr;
+        // 'SchedulePtr' is an alias for a shared pointer to an immutable
+        // schedule.
+
+  private:
+    // PRIVATE TYPES
+    typedef bdlcc::Cache<ScheduleRequest,
+                         bsl::vector<bdlt::Date>,
+                         bslh::Hash<> >         CacheType;
+
+    // DATA
+    CacheType           d_cache;        // underlying cache
+    bsls::AtomicInt64   d_numHits;      // requests served without generating
+    bsls::AtomicInt64   d_numMisses;    // schedules generated
+    bslma::Allocator   *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ScheduleCache(const ScheduleCache&);
+    ScheduleCache& operator=(const ScheduleCache&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ScheduleCache, bslma::UsesBslmaAllocator);
+
+    // PUBLIC CLASS DATA
+    static const bsl::size_t k_MIN_SCHEDULES_PER_JOB = 64;
+        // The minimum number of schedules generated by a single thread-pool
+        // job in 'getSchedules'.
+
+    // CREATORS
+    explicit ScheduleCache(bslma::Allocator *basicAllocator = 0);
+        // Create an empty schedule cache having no size limit.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ScheduleCache(bsl::size_t       lowWatermark,
+                  bsl::size_t       highWatermark,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty schedule cache that, when it holds more than the
+        // specified 'highWatermark' schedules, evicts the least recently used
+        // schedules until it holds the specified 'lowWatermark' schedules.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // '1 <= lowWatermark <= highWatermark'.
+
+    //! ~ScheduleCache() = default;
+        // Destroy this object.  Note that schedules obtained from this object
+        // remain valid.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all schedules from this cache, and reset the 'numHits' and
+        // 'numMisses' statistics to 0.  Note that schedules previously
+        // obtained from this object remain valid.
+
+    SchedulePtr getSchedule(const ScheduleRequest& request);
+        // Return a shared pointer to the schedule described by the specified
+        // 'request', generating the schedule (and adding it to this cache) if
+        // it is not found in this cache.
+
+    void getSchedules(SchedulePtr            *results,
+                      const ScheduleRequest  *requests,
+                      bsl::size_t             numRequests,
+                      bdlmt::FixedThreadPool *threadPool = 0);
+        // Load, into each of the specified 'numRequests' elements of the
+        // specified 'results' array, a shared pointer to the schedule
+        // described by the corresponding element of the specified 'requests'
+        // array, generating each distinct schedule that is not found in this
+        // cache exactly once (and adding it to this cache).  Elements of
+        // 'requests' having the same value obtain the same schedule object.
+        // Optionally specify a 'threadPool' that is used to generate the
+        // schedules not found in this cache, in jobs of at least
+        // 'k_MIN_SCHEDULES_PER_JOB' schedules each, while the calling thread
+        // also generates schedules; if a job cannot be enqueued, the calling
+        // thread generates its schedules.  If an exception is thrown while
+        // generating a schedule, on any thread, it is propagated to the
+        // caller once every job has completed.  The behavior is undefined
+        // unless 'results' and 'requests' each refer to an array of at least
+        // 'numRequests' elements, and, if 'threadPool' is supplied, the
+        // allocator of this object is thread-safe and this method is not
+        // invoked by a thread of 'threadPool'.
+
+    // ACCESSORS
+    bsl::size_t highWatermark() const;
+        // Return the high watermark of this cache, the number of schedules
+        // above which eviction begins.
+
+    bsl::size_t lowWatermark() const;
+        // Return the low watermark of this cache, the number of schedules at
+        // which eviction ends.
+
+    bsls::Types::Int64 numHits() const;
+        // Return the number of requests that this cache has served (since
+        // construction or the most recent call to 'clear') without generating
+        // a schedule, including requests served by a schedule generated for an
+        // identical request in the same batch.
+
+    bsls::Types::Int64 numMisses() const;
+        // Return the number of schedules that this cache has generated (since
+        // construction or the most recent call to 'clear').
+
+    bsl::size_t size() const;
+        // Return the number of schedules currently held by this cache.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class ScheduleCache
+                            // -------------------
+
+// ACCESSORS
+inline
+bsl::size_t ScheduleCache::highWatermark() const
+{
+    return d_cache.highWatermark();
+}
+
+inline
+bsl::size_t ScheduleCache::lowWatermark() const
+{
+    return d_cache.lowWatermark();
+}
+
+inline
+bsls::Types::Int64 ScheduleCache::numHits() const
+{
+    return d_numHits;
+}
+
+inline
+bsls::Types::Int64 ScheduleCache::numMisses() const
+{
+    return d_numMisses;
+}
+
+inline
+bsl::size_t ScheduleCache::size() const
+{
+    return d_cache.size();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *ScheduleCache::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,920 @@
+// bblb_schedulecache.t.cpp                                           -*-C++-*-
+#include <bblb_schedulecache.h>
+
+#include <bblb_schedulegenerationutil.h>
+#include <bblb_schedulerequest.h>
+
+#include <bdlma_concurrentpoolallocator.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bdlt_date.h>
+#include <bdlt_dayofweek.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadgroup.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a thread-safe mechanism that memoizes schedules
+// in a bounded cache.  The values of the schedules it returns are verified
+// against 'ScheduleGenerationUtil::generate', their sharing is verified by
+// comparing the returned pointers, and the 'numHits' and 'numMisses'
+// statistics are used to observe which schedules were generated.  The batch
+// method is tested without, and then with, a thread pool, and a final test
+// exercises the cache from several threads at once.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ScheduleCache(bslma::Allocator *basicAllocator = 0);
+// [ 2] ScheduleCache(lowWatermark, highWatermark, basicAllocator = 0);
+//
+// MANIPULATORS
+// [ 3] void clear();
+// [ 3] SchedulePtr getSchedule(const ScheduleRequest& request);
+// [ 4] void getSchedules(results, requests, numRequests, threadPool);
+//
+// ACCESSORS
+// [ 2] bsl::size_t highWatermark() const;
+// [ 2] bsl::size_t lowWatermark() const;
+// [ 2] bsls::Types::Int64 numHits() const;
+// [ 2] bsls::Types::Int64 numMisses() const;
+// [ 2] bsl::size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] TESTING 'getSchedules' WITH A THREAD POOL
+// [ 6] CONCURRENCY TEST
+// [ 7] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bblb::ScheduleCache          Obj;
+typedef bblb::ScheduleRequest        Request;
+typedef bblb::ScheduleGenerationUtil Util;
+typedef Obj::SchedulePtr             SchedulePtr;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static Request makeRequest(int index)
+    // Return a request describing a schedule that is distinct for each
+    // distinct value of the specified 'index' in the range '[0, 11 * 10000)'
+    // and that uses each of the methods of 'ScheduleRequest'.
+{
+    const bdlt::Date E(2000, 1, 1);
+    const bdlt::Date L(2010 + index % 11, 12, 31);
+
+    const int key = index / 11;
+
+    Request request;
+    switch (key % 4) {
+      case 0: {
+        request.setDayInterval(E, L, E, 1 + key / 4 % 2500);
+      } break;
+      case 1: {
+        request.setDayOfMonth(E, L, 1999, 1, 1 + key / 4 % 2500, 28);
+      } break;
+      case 2: {
+        request.setDayOfWeekAfterDayOfMonth(E,
+                                            L,
+                                            1999,
+                                            1,
+                                            1 + key / 4 % 2500,
+                                            bdlt::DayOfWeek::e_WED,
+                                            20);
+      } break;
+      default: {
+        request.setDayOfWeekInMonth(E,
+                                    L,
+                                    1999,
+                                    1,
+                                    1 + key / 4 % 2500,
+                                    bdlt::DayOfWeek::e_FRI,
+                                    2);
+      } break;
+    }
+    return request;
+}
+
+static bool isExpected(const SchedulePtr& schedule, const Request& request)
+    // Return 'true' if the specified 'schedule' is not null and has the value
+    // that 'ScheduleGenerationUtil::generate' produces for the specified
+    // 'request', and 'false' otherwise.
+{
+    if (!schedule) {
+        return false;                                                 // RETURN
+    }
+
+    bslma::TestAllocator    scratch("scratch");
+    bsl::vector<bdlt::Date> expected(&scratch);
+    Util::generate(&expected, request);
+
+    return expected == *schedule;
+}
+
+namespace {
+
+struct ConcurrentGetter {
+    // This 'struct' provides a functor that, when invoked, obtains schedules
+    // from a shared cache, using both 'getSchedule' and 'getSchedules', and
+    // verifies them.
+
+    Obj *d_cache_p;      // cache under test (held, not owned)
+    int  d_numRequests;  // number of distinct requests
+
+    void operator()() const
+        // Obtain each of 'd_numRequests' schedules from '*d_cache_p' twice,
+        // individually and in a batch, and verify the results.
+    {
+        bsl::vector<Request>     requests;
+        bsl::vector<SchedulePtr> results(d_numRequests);
+
+        for (int i = 0; i < d_numRequests; ++i) {
+            requests.push_back(makeRequest(i));
+        }
+
+        for (int i = 0; i < d_numRequests; ++i) {
+            const SchedulePtr schedule = d_cache_p->getSchedule(requests[i]);
+            ASSERTV(i, isExpected(schedule, requests[i]));
+        }
+
+        d_cache_p->getSchedules(results.data(),
+                                requests.data(),
+                                requests.size());
+
+        for (int i = 0; i < d_numRequests; ++i) {
+            ASSERTV(i, isExpected(results[i], requests[i]));
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, and replace 'assert' with
+        //:   'ASSERT'.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing Schedules Among Instruments
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need the quarterly payment schedules of a large set of
+// instruments, many of which have identical terms.
+//
+// First, we create a cache that holds at most 1000 schedules, evicting the
+// least recently used schedules down to 800 when that limit is exceeded:
+//..
+    bblb::ScheduleCache cache(800, 1000);
+//..
+// Then, we describe the schedules of our instruments; here, 100 instruments
+// cycle through just three distinct sets of terms:
+//..
+    bsl::vector<bblb::ScheduleRequest> requests(100);
+    for (int i = 0; i < 100; ++i) {
+        requests[i].setDayOfMonth(bdlt::Date(2020, 1, 1),  // earliest
+                                  bdlt::Date(2025, 1, 1),  // latest
+                                  2019,                    // example year
+                                  1 + i % 3,               // example month
+                                  3,                       // months apart
+                                  15);                     // day of month
+    }
+//..
+// Next, we obtain all of the schedules in a single batch:
+//..
+    bsl::vector<bblb::ScheduleCache::SchedulePtr> schedules(100);
+    cache.getSchedules(schedules.data(), requests.data(), requests.size());
+//..
+// Now, we observe that only three schedules were generated, and that
+// instruments having the same terms share the same schedule object:
+//..
+    ASSERT(  3 == cache.numMisses());
+    ASSERT( 97 == cache.numHits());
+    ASSERT(  3 == cache.size());
+    ASSERT(schedules[0] == schedules[3]);
+    ASSERT(schedules[0] != schedules[1]);
+
+    ASSERT(20                      == schedules[0]->size());
+    ASSERT(bdlt::Date(2020, 1, 15) == schedules[0]->front());
+//..
+// Finally, we obtain the schedule of another instrument individually, which is
+// served from the cache:
+//..
+    bblb::ScheduleCache::SchedulePtr schedule = cache.getSchedule(requests[4]);
+    ASSERT(schedule == schedules[1]);
+    ASSERT(98       == cache.numHits());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Multiple threads can obtain schedules from the same cache
+        //:   simultaneously, with both 'getSchedule' and 'getSchedules', while
+        //:   the cache evicts schedules.
+        //
+        // Plan:
+        //: 1 Using a bounded cache that is smaller than the number of distinct
+        //:   requests, start several threads that each obtain and verify the
+        //:   schedules individually and in batches.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator         oa("object", veryVerbose);
+        bdlma::ConcurrentPoolAllocator
+                                     poolAllocator(&oa);
+
+        {
+            Obj mX(50, 100, &poolAllocator);  const Obj& X = mX;
+
+            const ConcurrentGetter getter = { &mX, 300 };
+
+            bslmt::ThreadGroup threads;
+            ASSERT(6 == threads.addThreads(getter, 6));
+            threads.joinAll();
+
+            ASSERTV(X.size(), X.size() <= X.highWatermark());
+            ASSERTV(X.numHits(),
+                    X.numMisses(),
+                    6 * 2 * 300 == X.numHits() + X.numMisses());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'getSchedules' WITH A THREAD POOL
+        //
+        // Concerns:
+        //: 1 When a thread pool is supplied, every result has the expected
+        //:   value, identical requests share one schedule, and each distinct
+        //:   uncached schedule is generated once.
+        //:
+        //: 2 Batches too small to be divided among jobs are correct.
+        //:
+        //: 3 If jobs cannot be enqueued (e.g., the pool is disabled), the
+        //:   calling thread generates all of the schedules.
+        //:
+        //: 4 The generated schedules are allocated from the allocator of the
+        //:   cache.
+        //:
+        //: 5 An exception thrown while generating schedules, whether on the
+        //:   calling thread or in a job, is propagated to the caller after
+        //:   every job has completed, and leaks no memory.
+        //
+        // Plan:
+        //: 1 For a set of batch sizes, including sizes just below and above
+        //:   the threshold for using the pool, obtain the schedules of a batch
+        //:   in which each request appears three times, using a started pool
+        //:   having 4 threads; verify the values, the sharing, and the
+        //:   statistics.  (C-1..2)
+        //:
+        //: 2 Repeat with a disabled pool.  (C-3)
+        //:
+        //: 3 Verify the object allocator is used.  (C-4)
+        //:
+        //: 4 Using a started pool, obtain the schedules of a batch large
+        //:   enough to be divided among all jobs, from a cache whose test
+        //:   allocator has an allocation limit, for a sequence of increasing
+        //:   limits.  Verify that, if the call throws, the statistics are
+        //:   unchanged, and that, otherwise, the results are correct.  The
+        //:   test allocator verifies that no memory is leaked, and the
+        //:   sanitizers, where enabled, that no job outlives the call.  (C-5)
+        //
+        // Testing:
+        //   void getSchedules(results, requests, numRequests, threadPool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "TESTING 'getSchedules' WITH A THREAD POOL" << endl
+                      << "=========================================" << endl;
+
+        const int k_MIN = static_cast<int>(Obj::k_MIN_SCHEDULES_PER_JOB);
+
+        static const int SIZES[] = {
+            1, k_MIN, 2 * k_MIN - 1, 2 * k_MIN, 2 * k_MIN + 1, 5 * k_MIN + 3,
+            10000
+        };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        bdlma::ConcurrentPoolAllocator pa;
+        bdlmt::FixedThreadPool         pool(4, 1000, &pa);
+        ASSERT(0 == pool.start());
+
+        for (int pi = 0; pi < 2; ++pi) {
+            if (1 == pi) {
+                pool.disable();
+            }
+
+            for (int si = 0; si < NUM_SIZES; ++si) {
+                const int SIZE = SIZES[si];
+
+                if (veryVerbose) { T_ P_(pi) P(SIZE); }
+
+                bslma::TestAllocator           oa("object", veryVerbose);
+                bdlma::ConcurrentPoolAllocator poolAllocator(&oa);
+
+                {
+                    Obj mX(&poolAllocator);  const Obj& X = mX;
+
+                    bsl::vector<Request> requests;
+                    for (int r = 0; r < 3; ++r) {
+                        for (int i = 0; i < SIZE; ++i) {
+                            requests.push_back(makeRequest(i));
+                        }
+                    }
+
+                    bsl::vector<SchedulePtr> results(requests.size());
+
+                    mX.getSchedules(results.data(),
+                                    requests.data(),
+                                    requests.size(),
+                                    &pool);
+
+                    ASSERTV(pi, SIZE, X.numMisses(), SIZE == X.numMisses());
+                    ASSERTV(pi, SIZE, X.numHits(), 2 * SIZE == X.numHits());
+                    ASSERTV(pi, SIZE, X.size(), SIZE == (int)X.size());
+
+                    for (int i = 0; i < SIZE; ++i) {
+                        ASSERTV(pi, SIZE, i,
+                                isExpected(results[i], requests[i]));
+                        ASSERTV(pi, SIZE, i, results[i] == results[i + SIZE]);
+                        ASSERTV(pi, SIZE, i,
+                                results[i] == results[i + 2 * SIZE]);
+                    }
+
+                    ASSERTV(pi, SIZE, 0 < oa.numBlocksInUse());
+                }
+            }
+        }
+
+        pool.enable();
+
+        if (verbose) cout << "\nTesting exception propagation." << endl;
+#ifdef BDE_BUILD_TARGET_EXC
+        {
+            const int SIZE = 8 * k_MIN;
+
+            bsl::vector<Request> requests;
+            for (int i = 0; i < SIZE; ++i) {
+                requests.push_back(makeRequest(i));
+            }
+
+            // A test allocator throws once its allocation limit is reached,
+            // and not thereafter, so the exception may be thrown on the
+            // calling thread or in a job, and is not always propagated: a job
+            // whose chunk fails is regenerated by the calling thread.  The
+            // loop ends once the limit is not reached.
+
+            bool reached = true;
+            for (int limit = 0; reached; limit += 1 + limit / 8) {
+                if (veryVerbose) { T_ P(limit); }
+
+                bslma::TestAllocator oa("object", veryVerbose);
+                {
+                    Obj mX(&oa);  const Obj& X = mX;
+
+                    bsl::vector<SchedulePtr> results(requests.size());
+
+                    bool threw = false;
+
+                    oa.setAllocationLimit(limit);
+                    try {
+                        mX.getSchedules(results.data(),
+                                        requests.data(),
+                                        requests.size(),
+                                        &pool);
+                    }
+                    catch (const bslma::TestAllocatorException&) {
+                        threw = true;
+                    }
+                    reached = 0 > oa.allocationLimit();
+                    oa.setAllocationLimit(-1);
+
+                    if (threw) {
+                        ASSERTV(limit, SIZE >= static_cast<int>(X.size()));
+                        ASSERTV(limit, 0    == X.numMisses());
+                    }
+                    else {
+                        ASSERTV(limit, SIZE == X.numMisses());
+                        for (int i = 0; i < SIZE; ++i) {
+                            ASSERTV(limit, i,
+                                    isExpected(results[i], requests[i]));
+                        }
+                    }
+                }
+                ASSERTV(limit, 0 == oa.numBlocksInUse());
+            }
+        }
+#endif
+
+        pool.stop();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'getSchedules'
+        //
+        // Concerns:
+        //: 1 Each result has the value of the schedule described by the
+        //:   corresponding request.
+        //:
+        //: 2 Requests having the same value obtain the same schedule object,
+        //:   and each distinct uncached schedule is generated once, even if
+        //:   the number of distinct schedules exceeds the high watermark.
+        //:
+        //: 3 Schedules already in the cache are not generated again.
+        //:
+        //: 4 A batch of zero requests may be supplied null arrays and has no
+        //:   effect.
+        //:
+        //: 5 Memory is allocated only from the allocator of the cache.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Obtain a batch of schedules in which the requests repeat
+        //:   cyclically, with a bounded cache smaller than the number of
+        //:   distinct requests; verify the values, the sharing, and the
+        //:   statistics.  (C-1..2)
+        //:
+        //: 2 Obtain a second batch overlapping the schedules left in the
+        //:   cache, and verify the statistics.  (C-3)
+        //:
+        //: 3 Invoke the method with zero requests and null arrays.  (C-4)
+        //:
+        //: 4 Verify the default allocator is not used.  (C-5)
+        //:
+        //: 5 Verify defensive checks are triggered for invalid values.  (C-6)
+        //
+        // Testing:
+        //   void getSchedules(results, requests, numRequests, threadPool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'getSchedules'" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        {
+            Obj mX(20, 30, &oa);  const Obj& X = mX;
+
+            const int NUM_DISTINCT = 100;
+            const int NUM_REQUESTS = 1000;
+
+            bsl::vector<Request> requests;
+            for (int i = 0; i < NUM_REQUESTS; ++i) {
+                requests.push_back(makeRequest(i % NUM_DISTINCT));
+            }
+
+            bsl::vector<SchedulePtr> results(NUM_REQUESTS);
+
+            const bsls::Types::Int64 NUM_DEFAULT =
+                                          defaultAllocator.numAllocations();
+
+            mX.getSchedules(results.data(), requests.data(), NUM_REQUESTS);
+
+            ASSERTV(NUM_DEFAULT == defaultAllocator.numAllocations());
+
+            ASSERTV(X.numMisses(), NUM_DISTINCT == X.numMisses());
+            ASSERTV(X.numHits(),
+                    NUM_REQUESTS - NUM_DISTINCT == X.numHits());
+            ASSERTV(X.size(), X.size() <= X.highWatermark());
+
+            for (int i = 0; i < NUM_REQUESTS; ++i) {
+                ASSERTV(i, isExpected(results[i], requests[i]));
+                ASSERTV(i, results[i] == results[i % NUM_DISTINCT]);
+            }
+            for (int i = 1; i < NUM_DISTINCT; ++i) {
+                ASSERTV(i, results[i] != results[i - 1]);
+            }
+
+            // The most recently inserted schedules remain in the cache.
+
+            const bsls::Types::Int64 NUM_MISSES = X.numMisses();
+            const bsl::size_t        NUM_CACHED = X.size();
+
+            bsl::vector<SchedulePtr> recent(NUM_CACHED);
+
+            mX.getSchedules(recent.data(),
+                            requests.data() + NUM_DISTINCT - NUM_CACHED,
+                            NUM_CACHED);
+
+            ASSERTV(NUM_MISSES == X.numMisses());
+            for (bsl::size_t i = 0; i < NUM_CACHED; ++i) {
+                ASSERTV(i, recent[i] == results[NUM_DISTINCT - NUM_CACHED
+                                                                       + i]);
+            }
+
+            // Zero requests.
+
+            const bsls::Types::Int64 NUM_HITS = X.numHits();
+
+            mX.getSchedules(0, 0, 0);
+
+            ASSERTV(NUM_HITS   == X.numHits());
+            ASSERTV(NUM_MISSES == X.numMisses());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);
+
+            const Request R;
+            SchedulePtr   result;
+
+            ASSERT_PASS(mX.getSchedules(&result, &R, 1));
+            ASSERT_PASS(mX.getSchedules(0,       0,  0));
+            ASSERT_FAIL(mX.getSchedules(0,       &R, 1));
+            ASSERT_FAIL(mX.getSchedules(&result, 0,  1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'getSchedule' AND 'clear'
+        //
+        // Concerns:
+        //: 1 'getSchedule' returns a schedule having the value described by
+        //:   the request.
+        //:
+        //: 2 A cached schedule is returned (the same object) without being
+        //:   generated again, and the statistics are maintained.
+        //:
+        //: 3 The number of cached schedules does not exceed the high
+        //:   watermark, and the least recently used schedules are evicted.
+        //:
+        //: 4 Schedules remain valid after they are evicted, after 'clear', and
+        //:   after the cache is destroyed.
+        //:
+        //: 5 'clear' empties the cache and resets the statistics.
+        //:
+        //: 6 Memory is allocated from the allocator of the cache.
+        //
+        // Plan:
+        //: 1 Using a cache with watermarks 3 and 5, obtain a sequence of
+        //:   schedules, verifying the values, the object identity of repeated
+        //:   requests, 'size', 'numHits', and 'numMisses' at each step.
+        //:   (C-1..3)
+        //:
+        //: 2 Hold schedules across eviction, 'clear', and destruction of the
+        //:   cache and verify their values.  (C-4..5)
+        //:
+        //: 3 Verify the default allocator is not used, and the object
+        //:   allocator is.  (C-6)
+        //
+        // Testing:
+        //   void clear();
+        //   SchedulePtr getSchedule(const ScheduleRequest& request);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'getSchedule' AND 'clear'" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        SchedulePtr held;
+        {
+            Obj mX(3, 5, &oa);  const Obj& X = mX;
+
+            const Request R0 = makeRequest(0);
+
+            held = mX.getSchedule(R0);
+
+            ASSERT(isExpected(held, R0));
+            ASSERT(1 == X.size());
+            ASSERT(0 == X.numHits());
+            ASSERT(1 == X.numMisses());
+            ASSERT(0 <  oa.numBlocksInUse());
+
+            ASSERT(held == mX.getSchedule(R0));
+            ASSERT(1 == X.size());
+            ASSERT(1 == X.numHits());
+            ASSERT(1 == X.numMisses());
+
+            for (int i = 1; i <= 5; ++i) {
+                const Request     R = makeRequest(i);
+                const SchedulePtr S = mX.getSchedule(R);
+
+                ASSERTV(i, isExpected(S, R));
+                ASSERTV(i, X.size(), X.size() <= 5);
+            }
+
+            // Six distinct schedules have been requested; on inserting the
+            // sixth, the cache was reduced to the 3 most recently used.
+
+            ASSERTV(X.size(),      3 == X.size());
+            ASSERTV(X.numMisses(), 6 == X.numMisses());
+
+            const bsls::Types::Int64 NUM_MISSES = X.numMisses();
+
+            mX.getSchedule(makeRequest(5));
+            mX.getSchedule(makeRequest(4));
+            ASSERTV(NUM_MISSES == X.numMisses());
+
+            SchedulePtr evicted = mX.getSchedule(R0);
+            ASSERTV(NUM_MISSES + 1 == X.numMisses());
+            ASSERT(evicted != held);
+            ASSERT(*evicted == *held);
+
+            mX.clear();
+
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.numHits());
+            ASSERT(0 == X.numMisses());
+            ASSERT(isExpected(evicted, R0));
+            ASSERT(isExpected(held,    R0));
+        }
+        ASSERT(isExpected(held, makeRequest(0)));
+        ASSERT(0 < oa.numBlocksInUse());
+
+        held.reset();
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor creates an empty cache having no size
+        //:   limit.
+        //:
+        //: 2 The watermark constructor creates an empty cache having the
+        //:   specified watermarks.
+        //:
+        //: 3 The allocator is the one supplied, or the default allocator.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Construct objects with each constructor, with and without an
+        //:   allocator, and verify the accessors.  (C-1..3)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   ScheduleCache(bslma::Allocator *basicAllocator = 0);
+        //   ScheduleCache(lowWatermark, highWatermark, basicAllocator = 0);
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bsls::Types::Int64 numHits() const;
+        //   bsls::Types::Int64 numMisses() const;
+        //   bsl::size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS AND ACCESSORS" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        const bsl::size_t MAX = bsl::numeric_limits<bsl::size_t>::max();
+
+        {
+            const Obj X;
+
+            ASSERT(0                 == X.size());
+            ASSERT(0                 == X.numHits());
+            ASSERT(0                 == X.numMisses());
+            ASSERT(MAX               == X.highWatermark());
+            ASSERT(MAX               == X.lowWatermark());
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+        {
+            const Obj X(&oa);
+
+            ASSERT(0   == X.size());
+            ASSERT(MAX == X.highWatermark());
+            ASSERT(&oa == X.allocator());
+        }
+        {
+            const Obj X(7, 9);
+
+            ASSERT(0                 == X.size());
+            ASSERT(9                 == X.highWatermark());
+            ASSERT(7                 == X.lowWatermark());
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+        {
+            const Obj X(1, 1, &oa);
+
+            ASSERT(1   == X.highWatermark());
+            ASSERT(1   == X.lowWatermark());
+            ASSERT(&oa == X.allocator());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(1, 1, &oa));
+            ASSERT_PASS(Obj(1, 2, &oa));
+            ASSERT_FAIL(Obj(0, 2, &oa));
+            ASSERT_FAIL(Obj(2, 1, &oa));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Obtain a schedule twice, and a batch of schedules, and verify the
+        //:   results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        Request request;
+        request.setDayOfMonth(bdlt::Date(2012, 2,  1),
+                              bdlt::Date(2015, 2, 28),
+                              2007,
+                              7,
+                              9,
+                              23);
+
+        const SchedulePtr S1 = mX.getSchedule(request);
+        const SchedulePtr S2 = mX.getSchedule(request);
+
+        ASSERT(S1 == S2);
+        ASSERT(4 == S1->size());
+        ASSERT(bdlt::Date(2012, 10, 23) == (*S1)[0]);
+        ASSERT(1 == X.numHits());
+        ASSERT(1 == X.numMisses());
+
+        Request     requests[3] = { request, makeRequest(1), request };
+        SchedulePtr results[3];
+
+        mX.getSchedules(results, requests, 3);
+
+        ASSERT(S1 == results[0]);
+        ASSERT(S1 == results[2]);
+        ASSERT(isExpected(results[1], requests[1]));
+        ASSERT(3 == X.numHits());
+        ASSERT(2 == X.numMisses());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
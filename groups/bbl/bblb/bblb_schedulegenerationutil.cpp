@@ -234,6 +234,55 @@ int adjustMonthRange(int *startSerialMonth,
                       // struct ScheduleGenerationUtil
                       // -----------------------------
 
+void ScheduleGenerationUtil::generate(bsl::vector<bdlt::Date> *schedule,
+                                      const ScheduleRequest&   request)
+{
+    BSLS_ASSERT(schedule);
+
+    switch (request.method()) {
+      case ScheduleRequest::e_DAY_INTERVAL: {
+        generateFromDayInterval(schedule,
+                                request.earliest(),
+                                request.latest(),
+                                request.example(),
+                                request.interval());
+      } break;
+      case ScheduleRequest::e_DAY_OF_MONTH: {
+        generateFromDayOfMonth(schedule,
+                               request.earliest(),
+                               request.latest(),
+                               request.example().year(),
+                               request.example().month(),
+                               request.interval(),
+                               request.dayOfMonth(),
+                               request.dayOfFeb());
+      } break;
+      case ScheduleRequest::e_DAY_OF_WEEK_AFTER_DAY_OF_MONTH: {
+        generateFromDayOfWeekAfterDayOfMonth(schedule,
+                                             request.earliest(),
+                                             request.latest(),
+                                             request.example().year(),
+                                             request.example().month(),
+                                             request.interval(),
+                                             request.dayOfWeek(),
+                                             request.dayOfMonth());
+      } break;
+      case ScheduleRequest::e_DAY_OF_WEEK_IN_MONTH: {
+        generateFromDayOfWeekInMonth(schedule,
+                                     request.earliest(),
+                                     request.latest(),
+                                     request.example().year(),
+                                     request.example().month(),
+                                     request.interval(),
+                                     request.dayOfWeek(),
+                                     request.occurrenceWeek());
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized method");
+      } break;
+    }
+}
+
 void ScheduleGenerationUtil::generateFromDayInterval(
                                        bsl::vector<bdlt::Date> *schedule,
                                        const bdlt::Date&        earliest,
@@ -10,7 +10,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bblb::ScheduleGenerationUtil: namespace for schedule generation functions
 //
-//@SEE_ALSO:
+//@SEE_ALSO: bblb_schedulerequest, bblb_schedulecache
 //
 //@DESCRIPTION: This component provides a 'struct',
 // 'bblb::ScheduleGenerationUtil', that serves as a namespace for functions
@@ -71,6 +71,9 @@ BSLS_IDENT("$Id: $")
 //                                          schedule occuring on a specific day
 //                                          of the week in a specific week of
 //                                          the month.
+//
+//  'generate'                              Generate the schedule described by
+//                                          a 'bblb::ScheduleRequest'.
 //..
 //
 ///Usage
@@ -115,6 +118,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bblscm_version.h>
 
+#include <bblb_schedulerequest.h>
+
 #include <bdlt_calendar.h>
 #include <bdlt_date.h>
 #include <bdlt_dayofweek.h>
@@ -133,6 +138,13 @@ struct ScheduleGenerationUtil {
     // schedules.
 
     // CLASS METHODS
+    static void generate(bsl::vector<bdlt::Date> *schedule,
+                         const ScheduleRequest&   request);
+        // Load, into the specified 'schedule', the chronologically increasing
+        // sequence of unique dates described by the specified 'request', as
+        // computed by the generation function indicated by 'request.method()'
+        // invoked with the corresponding attributes of 'request'.
+
     static void generateFromDayInterval(
                                       bsl::vector<bdlt::Date> *schedule,
                                       const bdlt::Date&        earliest,
@@ -1,6 +1,8 @@
 // bblb_schedulegenerationutil.t.cpp                                  -*-C++-*-
 #include <bblb_schedulegenerationutil.h>
 
+#include <bblb_schedulerequest.h>
+
 #include <bdlt_calendar.h>
 #include <bdlt_calendarloader.h>
 #include <bdlt_date.h>
@@ -46,8 +48,9 @@ using namespace bsl;
 // [ 4] generateFromBusinessDayOfMonth(s, e, l, c, eY, eM, i, tBDOM);
 // [ 5] generateFromDayOfWeekAfterDayOfMonth(s, e, l, d, eY, eM, i, DOM);
 // [ 6] generateFromDayOfWeekInMonth(s, e, l, d, eY, eM, i, oW);
+// [ 7] generate(schedule, request);
 // ----------------------------------------------------------------------------
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 // [ 1] toString(output, date)
 // ----------------------------------------------------------------------------
 
@@ -215,7 +218,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -276,6 +279,160 @@ int main(int argc, char *argv[])
     ASSERT(bdlt::Date(2015,  1, 23) == schedule[3]);
 //..
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'generate'
+        //
+        // Concerns:
+        //: 1 The method generates the same schedule as the generation function
+        //:   indicated by the 'method' attribute of the request, invoked with
+        //:   the corresponding attributes, for each method.
+        //:
+        //: 2 Any previous contents of 'schedule' are discarded.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of intervals and parameters, set a 'ScheduleRequest'
+        //:   with each of its 'set*' manipulators, invoke 'generate' on a
+        //:   non-empty 'schedule', and compare the result with that of the
+        //:   corresponding generation function.  (C-1..2)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-3)
+        //
+        // Testing:
+        //   generate(schedule, request);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'generate'" << endl
+                          << "==================" << endl;
+
+        static const struct {
+            int d_line;      // source line number
+            int d_eYear;     // earliest year
+            int d_eMonth;    // earliest month
+            int d_eDay;      // earliest day
+            int d_lYear;     // latest year
+            int d_lMonth;    // latest month
+            int d_lDay;      // latest day
+            int d_xYear;     // example year
+            int d_xMonth;    // example month
+            int d_xDay;      // example day
+            int d_interval;  // interval in days or months
+            int d_param;     // day of month (1..28), used also for week
+        } DATA[] = {
+            //LN  eY  eM  eD    lY  lM  lD    xY  xM  xD  int  par
+            //--  --  --  --  ----  --  --  ----  --  --  ---  ---
+            { L_, 2012, 2,  1, 2015, 2, 28, 2007, 7, 23,   9,  23 },
+            { L_, 2012, 2,  1, 2012, 2,  1, 2012, 2,  1,   1,   1 },
+            { L_, 2000, 1, 31, 2010,12, 31, 2020, 5, 31,   3,  28 },
+            { L_, 1999,12, 31, 2001, 3,  1, 1999, 2, 28,   1,  15 },
+            { L_, 2016, 2, 29, 2024, 2, 29, 2016, 2, 29,  12,  27 },
+            { L_, 2016, 3,  1, 2016, 3, 31, 2017, 1,  1,  24,   4 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        static const bdlt::DayOfWeek::Enum DOW[] = {
+            DAY(SUN), DAY(WED), DAY(SAT)
+        };
+        const int NUM_DOW = sizeof DOW / sizeof *DOW;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int        LINE = DATA[ti].d_line;
+            const bdlt::Date E(DATA[ti].d_eYear,
+                               DATA[ti].d_eMonth,
+                               DATA[ti].d_eDay);
+            const bdlt::Date L(DATA[ti].d_lYear,
+                               DATA[ti].d_lMonth,
+                               DATA[ti].d_lDay);
+            const bdlt::Date X(DATA[ti].d_xYear,
+                               DATA[ti].d_xMonth,
+                               DATA[ti].d_xDay);
+            const int        I    = DATA[ti].d_interval;
+            const int        PAR  = DATA[ti].d_param;
+            const int        WEEK = 1 + PAR % 4;
+
+            if (veryVerbose) { T_ P_(LINE) P_(E) P_(L) P_(X) P_(I) P(PAR); }
+
+            bblb::ScheduleRequest   request;
+            bsl::vector<bdlt::Date> exp;
+            bsl::vector<bdlt::Date> schedule;
+
+            request.setDayInterval(E, L, X, I);
+            schedule.assign(3, X);
+            Obj::generateFromDayInterval(&exp, E, L, X, I);
+            Obj::generate(&schedule, request);
+            ASSERTV(LINE, exp == schedule);
+
+            request.setDayOfMonth(E, L, X.year(), X.month(), I, PAR);
+            schedule.assign(3, X);
+            Obj::generateFromDayOfMonth(&exp, E, L, X.year(), X.month(), I,
+                                        PAR);
+            Obj::generate(&schedule, request);
+            ASSERTV(LINE, exp == schedule);
+
+            request.setDayOfMonth(E, L, X.year(), X.month(), I, 31, PAR);
+            schedule.assign(3, X);
+            Obj::generateFromDayOfMonth(&exp, E, L, X.year(), X.month(), I,
+                                        31, PAR);
+            Obj::generate(&schedule, request);
+            ASSERTV(LINE, exp == schedule);
+
+            for (int di = 0; di < NUM_DOW; ++di) {
+                const bdlt::DayOfWeek::Enum D = DOW[di];
+
+                request.setDayOfWeekAfterDayOfMonth(E,
+                                                    L,
+                                                    X.year(),
+                                                    X.month(),
+                                                    I,
+                                                    D,
+                                                    PAR);
+                schedule.assign(3, X);
+                Obj::generateFromDayOfWeekAfterDayOfMonth(&exp,
+                                                          E,
+                                                          L,
+                                                          X.year(),
+                                                          X.month(),
+                                                          I,
+                                                          D,
+                                                          PAR);
+                Obj::generate(&schedule, request);
+                ASSERTV(LINE, D, exp == schedule);
+
+                request.setDayOfWeekInMonth(E,
+                                            L,
+                                            X.year(),
+                                            X.month(),
+                                            I,
+                                            D,
+                                            WEEK);
+                schedule.assign(3, X);
+                Obj::generateFromDayOfWeekInMonth(&exp,
+                                                  E,
+                                                  L,
+                                                  X.year(),
+                                                  X.month(),
+                                                  I,
+                                                  D,
+                                                  WEEK);
+                Obj::generate(&schedule, request);
+                ASSERTV(LINE, D, exp == schedule);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bblb::ScheduleRequest   request;
+            bsl::vector<bdlt::Date> schedule;
+
+            ASSERT_PASS(Obj::generate(&schedule, request));
+            ASSERT_FAIL(Obj::generate(0,         request));
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING 'generateFromDayOfWeekInMonth'
@@ -0,0 +1,165 @@
+// bblb_schedulerequest.cpp                                           -*-C++-*-
+#include <bblb_schedulerequest.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bblb_schedulerequest_cpp,"$Id$ $CSID$")
+
+#include <bslim_printer.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace bblb {
+
+                           // ---------------------
+                           // class ScheduleRequest
+                           // ---------------------
+
+// MANIPULATORS
+void ScheduleRequest::setDayInterval(const bdlt::Date& earliest,
+                                     const bdlt::Date& latest,
+                                     const bdlt::Date& example,
+                                     int               intervalInDays)
+{
+    BSLS_ASSERT(earliest <= latest);
+    BSLS_ASSERT(1 <= intervalInDays);
+
+    *this = ScheduleRequest();
+
+    d_method   = e_DAY_INTERVAL;
+    d_earliest = earliest;
+    d_latest   = latest;
+    d_example  = example;
+    d_interval = intervalInDays;
+}
+
+void ScheduleRequest::setDayOfMonth(const bdlt::Date& earliest,
+                                    const bdlt::Date& latest,
+                                    int               exampleYear,
+                                    int               exampleMonth,
+                                    int               intervalInMonths,
+                                    int               targetDayOfMonth,
+                                    int               targetDayOfFeb)
+{
+    BSLS_ASSERT(earliest <= latest);
+    BSLS_ASSERT(1 <= exampleYear      && 9999 >= exampleYear);
+    BSLS_ASSERT(1 <= exampleMonth     &&   12 >= exampleMonth);
+    BSLS_ASSERT(1 <= intervalInMonths);
+    BSLS_ASSERT(1 <= targetDayOfMonth &&   31 >= targetDayOfMonth);
+    BSLS_ASSERT(0 <= targetDayOfFeb   &&   29 >= targetDayOfFeb);
+
+    *this = ScheduleRequest();
+
+    d_method     = e_DAY_OF_MONTH;
+    d_earliest   = earliest;
+    d_latest     = latest;
+    d_example    = bdlt::Date(exampleYear, exampleMonth, 1);
+    d_interval   = intervalInMonths;
+    d_dayOfMonth = targetDayOfMonth;
+    d_dayOfFeb   = targetDayOfFeb;
+}
+
+void ScheduleRequest::setDayOfWeekAfterDayOfMonth(
+                                       const bdlt::Date&     earliest,
+                                       const bdlt::Date&     latest,
+                                       int                   exampleYear,
+                                       int                   exampleMonth,
+                                       int                   intervalInMonths,
+                                       bdlt::DayOfWeek::Enum dayOfWeek,
+                                       int                   dayOfMonth)
+{
+    BSLS_ASSERT(earliest <= latest);
+    BSLS_ASSERT(1 <= exampleYear  && 9999 >= exampleYear);
+    BSLS_ASSERT(1 <= exampleMonth &&   12 >= exampleMonth);
+    BSLS_ASSERT(1 <= intervalInMonths);
+    BSLS_ASSERT(1 <= dayOfMonth   &&   31 >= dayOfMonth);
+
+    *this = ScheduleRequest();
+
+    d_method     = e_DAY_OF_WEEK_AFTER_DAY_OF_MONTH;
+    d_earliest   = earliest;
+    d_latest     = latest;
+    d_example    = bdlt::Date(exampleYear, exampleMonth, 1);
+    d_interval   = intervalInMonths;
+    d_dayOfWeek  = dayOfWeek;
+    d_dayOfMonth = dayOfMonth;
+}
+
+void ScheduleRequest::setDayOfWeekInMonth(
+                                       const bdlt::Date&     earliest,
+                                       const bdlt::Date&     latest,
+                                       int                   exampleYear,
+                                       int                   exampleMonth,
+                                       int                   intervalInMonths,
+                                       bdlt::DayOfWeek::Enum dayOfWeek,
+                                       int                   occurrenceWeek)
+{
+    BSLS_ASSERT(earliest <= latest);
+    BSLS_ASSERT(1 <= exampleYear    && 9999 >= exampleYear);
+    BSLS_ASSERT(1 <= exampleMonth   &&   12 >= exampleMonth);
+    BSLS_ASSERT(1 <= intervalInMonths);
+    BSLS_ASSERT(1 <= occurrenceWeek &&    4 >= occurrenceWeek);
+
+    *this = ScheduleRequest();
+
+    d_method         = e_DAY_OF_WEEK_IN_MONTH;
+    d_earliest       = earliest;
+    d_latest         = latest;
+    d_example        = bdlt::Date(exampleYear, exampleMonth, 1);
+    d_interval       = intervalInMonths;
+    d_dayOfWeek      = dayOfWeek;
+    d_occurrenceWeek = occurrenceWeek;
+}
+
+// ACCESSORS
+
+                                  // Aspects
+
+bsl::ostream& ScheduleRequest::print(bsl::ostream& stream,
+                                     int           level,
+                                     int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("method",         static_cast<int>(d_method));
+    printer.printAttribute("earliest",       d_earliest);
+    printer.printAttribute("latest",         d_latest);
+    printer.printAttribute("example",        d_example);
+    printer.printAttribute("interval",       d_interval);
+    printer.printAttribute("dayOfMonth",     d_dayOfMonth);
+    printer.printAttribute("dayOfFeb",       d_dayOfFeb);
+    printer.printAttribute("dayOfWeek",      d_dayOfWeek);
+    printer.printAttribute("occurrenceWeek", d_occurrenceWeek);
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bsl::ostream& bblb::operator<<(bsl::ostream&          stream,
+                               const ScheduleRequest& object)
+{
+    return object.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,481 @@
+// bblb_schedulerequest.h                                             -*-C++-*-
+#ifndef INCLUDED_BBLB_SCHEDULEREQUEST
+#define INCLUDED_BBLB_SCHEDULEREQUEST
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a value-semantic description of a schedule to generate.
+//
+//@CLASSES:
+//  bblb::ScheduleRequest: parameters of one schedule-generation invocation
+//
+//@SEE_ALSO: bblb_schedulegenerationutil, bblb_schedulecache
+//
+//@DESCRIPTION: This component provides a value-semantic attribute class,
+// 'bblb::ScheduleRequest', that captures the method and the arguments of one
+// invocation of a 'bblb::ScheduleGenerationUtil' schedule generation function.
+// Two 'ScheduleRequest' objects have the same value if and only if they
+// describe the same schedule, so 'ScheduleRequest' objects can be compared,
+// hashed (via the 'bslh' modular hashing system), and used as keys to share or
+// memoize generated schedules (see 'bblb_schedulecache').
+//
+// A 'ScheduleRequest' is given its value by one of the 'set*' manipulators,
+// each of which corresponds to a 'bblb::ScheduleGenerationUtil' function and
+// takes the same arguments (without the output 'schedule'):
+//..
+//  Method                              Manipulator
+//  ----------------------------------  ---------------------------------
+//  e_DAY_INTERVAL                      setDayInterval
+//  e_DAY_OF_MONTH                      setDayOfMonth
+//  e_DAY_OF_WEEK_AFTER_DAY_OF_MONTH    setDayOfWeekAfterDayOfMonth
+//  e_DAY_OF_WEEK_IN_MONTH              setDayOfWeekInMonth
+//..
+// The attributes that are not used by the selected method have their default
+// values.  Note that 'generateFromBusinessDayOfMonth' is not represented, as
+// its result depends on a calendar that has no cheaply comparable value.
+//
+///Attributes
+///----------
+//..
+//  Name            Type                   Default
+//  --------------  ---------------------  ----------------
+//  method          Method                 e_DAY_INTERVAL
+//  earliest        bdlt::Date             0001/01/01
+//  latest          bdlt::Date             0001/01/01
+//  example         bdlt::Date             0001/01/01
+//  interval        int                    1
+//  dayOfMonth      int                    0
+//  dayOfFeb        int                    0
+//  dayOfWeek       bdlt::DayOfWeek::Enum  bdlt::DayOfWeek::e_SUN
+//  occurrenceWeek  int                    0
+//..
+//: o 'method': the schedule generation function described.
+//:
+//: o 'earliest', 'latest': the closed interval of the schedule.
+//:
+//: o 'example': the example date for 'e_DAY_INTERVAL', and the first day of
+//:   the example month for the other methods.
+//:
+//: o 'interval': the number of days ('e_DAY_INTERVAL') or months (the other
+//:   methods) between successive dates of the schedule.
+//:
+//: o 'dayOfMonth': the target day of the month ('e_DAY_OF_MONTH'), or the day
+//:   of the month on or after which 'dayOfWeek' is found
+//:   ('e_DAY_OF_WEEK_AFTER_DAY_OF_MONTH').
+//:
+//: o 'dayOfFeb': the target day of February ('e_DAY_OF_MONTH').
+//:
+//: o 'dayOfWeek': the target day of the week
+//:   ('e_DAY_OF_WEEK_AFTER_DAY_OF_MONTH' and 'e_DAY_OF_WEEK_IN_MONTH').
+//:
+//: o 'occurrenceWeek': the week of the month ('e_DAY_OF_WEEK_IN_MONTH').
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recognizing Identical Schedules
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a portfolio holds many instruments paying quarterly on the 15th
+// of the month, and we want to recognize the instruments whose payment
+// schedules are identical.
+//
+// First, we describe the schedules of two of the instruments:
+//..
+//  bblb::ScheduleRequest a;
+//  a.setDayOfMonth(bdlt::Date(2020, 1, 1),   // 'earliest'
+//                  bdlt::Date(2030, 1, 1),   // 'latest'
+//                  2019,                     // 'exampleYear'
+//                  3,                        // 'exampleMonth'
+//                  3,                        // 'intervalInMonths'
+//                  15);                      // 'targetDayOfMonth'
+//
+//  bblb::ScheduleRequest b;
+//  b.setDayOfMonth(bdlt::Date(2020, 1, 1),
+//                  bdlt::Date(2030, 1, 1),
+//                  2024,
+//                  12,
+//                  3,
+//                  15);
+//..
+// Then, we observe that the requests are not equal, even though the schedules
+// they describe will turn out to be the same (December 2024 is an integral
+// number of quarters after March 2019):
+//..
+//  assert(a != b);
+//..
+// Finally, we describe the schedule of a third instrument having exactly the
+// same terms as the first, and observe that the two requests are equal and
+// hash to the same value:
+//..
+//  bblb::ScheduleRequest c(a);
+//  assert(a == c);
+//
+//  bslh::Hash<> hasher;
+//  assert(hasher(a) == hasher(c));
+//..
+
+#include <bblscm_version.h>
+
+#include <bdlt_date.h>
+#include <bdlt_dayofweek.h>
+
+#include <bslh_hash.h>
+
+#include <bslmf_istriviallycopyable.h>
+
+#include <bsl_iosfwd.h>
+
+namespace BloombergLP {
+namespace bblb {
+
+                           // =====================
+                           // class ScheduleRequest
+                           // =====================
+
+class ScheduleRequest {
+    // This unconstrained (value-semantic) attribute class describes one
+    // invocation of a 'ScheduleGenerationUtil' schedule generation function.
+    // See the Attributes section under @DESCRIPTION in the component-level
+    // documentation for information on the class attributes.
+
+  public:
+    // TYPES
+    enum Method {
+        // Enumeration of the schedule generation functions that can be
+        // described by a 'ScheduleRequest'.
+
+        e_DAY_INTERVAL,                    // 'generateFromDayInterval'
+        e_DAY_OF_MONTH,                    // 'generateFromDayOfMonth'
+        e_DAY_OF_WEEK_AFTER_DAY_OF_MONTH,  // 'generateFromDayOfWeekAfter...'
+        e_DAY_OF_WEEK_IN_MONTH             // 'generateFromDayOfWeekInMonth'
+    };
+
+  private:
+    // DATA
+    Method                d_method;          // generation function
+    bdlt::Date            d_earliest;        // first date of the interval
+    bdlt::Date            d_latest;          // last date of the interval
+    bdlt::Date            d_example;         // example date (or month)
+    int                   d_interval;        // days or months between dates
+    int                   d_dayOfMonth;      // target (or minimum) day
+    int                   d_dayOfFeb;        // target day of February
+    bdlt::DayOfWeek::Enum d_dayOfWeek;       // target day of the week
+    int                   d_occurrenceWeek;  // target week of the month
+
+  public:
+    // CREATORS
+    ScheduleRequest();
+        // Create a 'ScheduleRequest' object having the (default) attribute
+        // values:
+        //..
+        //  method()         == e_DAY_INTERVAL
+        //  earliest()       == bdlt::Date()
+        //  latest()         == bdlt::Date()
+        //  example()        == bdlt::Date()
+        //  interval()       == 1
+        //  dayOfMonth()     == 0
+        //  dayOfFeb()       == 0
+        //  dayOfWeek()      == bdlt::DayOfWeek::e_SUN
+        //  occurrenceWeek() == 0
+        //..
+
+    //! ScheduleRequest(const ScheduleRequest& original) = default;
+        // Create a 'ScheduleRequest' object having the value of the specified
+        // 'original' object.
+
+    //! ~ScheduleRequest() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! ScheduleRequest& operator=(const ScheduleRequest& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    void setDayInterval(const bdlt::Date& earliest,
+                        const bdlt::Date& latest,
+                        const bdlt::Date& example,
+                        int               intervalInDays);
+        // Set this object to describe the schedule generated by
+        // 'ScheduleGenerationUtil::generateFromDayInterval' for the specified
+        // 'earliest', 'latest', 'example', and 'intervalInDays'.  The behavior
+        // is undefined unless 'earliest <= latest' and '1 <= intervalInDays'.
+
+    void setDayOfMonth(const bdlt::Date& earliest,
+                       const bdlt::Date& latest,
+                       int               exampleYear,
+                       int               exampleMonth,
+                       int               intervalInMonths,
+                       int               targetDayOfMonth,
+                       int               targetDayOfFeb = 0);
+        // Set this object to describe the schedule generated by
+        // 'ScheduleGenerationUtil::generateFromDayOfMonth' for the specified
+        // 'earliest', 'latest', 'exampleYear', 'exampleMonth',
+        // 'intervalInMonths', and 'targetDayOfMonth', and the optionally
+        // specified 'targetDayOfFeb'.  The behavior is undefined unless
+        // 'earliest <= latest', '1 <= exampleYear <= 9999',
+        // '1 <= exampleMonth <= 12', '1 <= intervalInMonths',
+        // '1 <= targetDayOfMonth <= 31', and '0 <= targetDayOfFeb <= 29'.
+
+    void setDayOfWeekAfterDayOfMonth(const bdlt::Date&     earliest,
+                                     const bdlt::Date&     latest,
+                                     int                   exampleYear,
+                                     int                   exampleMonth,
+                                     int                   intervalInMonths,
+                                     bdlt::DayOfWeek::Enum dayOfWeek,
+                                     int                   dayOfMonth);
+        // Set this object to describe the schedule generated by
+        // 'ScheduleGenerationUtil::generateFromDayOfWeekAfterDayOfMonth' for
+        // the specified 'earliest', 'latest', 'exampleYear', 'exampleMonth',
+        // 'intervalInMonths', 'dayOfWeek', and 'dayOfMonth'.  The behavior is
+        // undefined unless 'earliest <= latest', '1 <= exampleYear <= 9999',
+        // '1 <= exampleMonth <= 12', '1 <= intervalInMonths', and
+        // '1 <= dayOfMonth <= 31'.
+
+    void setDayOfWeekInMonth(const bdlt::Date&     earliest,
+                             const bdlt::Date&     latest,
+                             int                   exampleYear,
+                             int                   exampleMonth,
+                             int                   intervalInMonths,
+                             bdlt::DayOfWeek::Enum dayOfWeek,
+                             int                   occurrenceWeek);
+        // Set this object to describe the schedule generated by
+        // 'ScheduleGenerationUtil::generateFromDayOfWeekInMonth' for the
+        // specified 'earliest', 'latest', 'exampleYear', 'exampleMonth',
+        // 'intervalInMonths', 'dayOfWeek', and 'occurrenceWeek'.  The behavior
+        // is undefined unless 'earliest <= latest',
+        // '1 <= exampleYear <= 9999', '1 <= exampleMonth <= 12',
+        // '1 <= intervalInMonths', and '1 <= occurrenceWeek <= 4'.
+
+    // ACCESSORS
+    int dayOfFeb() const;
+        // Return the value of the 'dayOfFeb' attribute of this object.
+
+    int dayOfMonth() const;
+        // Return the value of the 'dayOfMonth' attribute of this object.
+
+    bdlt::DayOfWeek::Enum dayOfWeek() const;
+        // Return the value of the 'dayOfWeek' attribute of this object.
+
+    const bdlt::Date& earliest() const;
+        // Return a reference providing non-modifiable access to the
+        // 'earliest' attribute of this object.
+
+    const bdlt::Date& example() const;
+        // Return a reference providing non-modifiable access to the 'example'
+        // attribute of this object.  Note that, unless
+        // 'e_DAY_INTERVAL == method()', the day of 'example()' is 1.
+
+    int interval() const;
+        // Return the value of the 'interval' attribute of this object.
+
+    const bdlt::Date& latest() const;
+        // Return a reference providing non-modifiable access to the 'latest'
+        // attribute of this object.
+
+    Method method() const;
+        // Return the value of the 'method' attribute of this object.
+
+    int occurrenceWeek() const;
+        // Return the value of the 'occurrenceWeek' attribute of this object.
+
+                                  // Aspects
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Write the value of this object to the specified output 'stream' in a
+        // human-readable format, and return a reference to 'stream'.
+        // Optionally specify an initial indentation 'level', whose absolute
+        // value is incremented recursively for nested objects.  If 'level' is
+        // specified, optionally specify 'spacesPerLevel', whose absolute value
+        // indicates the number of spaces per indentation level for this and
+        // all of its nested objects.  If 'level' is negative, suppress
+        // indentation of the first line.  If 'spacesPerLevel' is negative,
+        // format the entire output on one line, suppressing all but the
+        // initial indentation (as governed by 'level').  If 'stream' is not
+        // valid on entry, this operation has no effect.  Note that this
+        // human-readable format is not fully specified, and can change without
+        // notice.
+};
+
+// FREE OPERATORS
+bool operator==(const ScheduleRequest& lhs, const ScheduleRequest& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'ScheduleRequest' objects have the
+    // same value if each of their corresponding attributes have the same
+    // value.
+
+bool operator!=(const ScheduleRequest& lhs, const ScheduleRequest& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'ScheduleRequest' objects do not
+    // have the same value if any of their corresponding attributes do not
+    // have the same value.
+
+bsl::ostream& operator<<(bsl::ostream& stream, const ScheduleRequest& object);
+    // Write the value of the specified 'object' to the specified output
+    // 'stream' in a single-line format, and return a reference to 'stream'.
+    // If 'stream' is not valid on entry, this operation has no effect.  Note
+    // that this human-readable format is not fully specified and can change
+    // without notice.  Also note that this method has the same behavior as
+    // 'object.print(stream, 0, -1)'.
+
+// FREE FUNCTIONS
+template <class HASHALG>
+void hashAppend(HASHALG& hashAlg, const ScheduleRequest& object);
+    // Pass the specified 'object' to the specified 'hashAlg'.  This function
+    // integrates with the 'bslh' modular hashing system and effectively
+    // provides a 'bsl::hash' specialization for 'ScheduleRequest'.
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class ScheduleRequest
+                           // ---------------------
+
+// CREATORS
+inline
+ScheduleRequest::ScheduleRequest()
+: d_method(e_DAY_INTERVAL)
+, d_earliest()
+, d_latest()
+, d_example()
+, d_interval(1)
+, d_dayOfMonth(0)
+, d_dayOfFeb(0)
+, d_dayOfWeek(bdlt::DayOfWeek::e_SUN)
+, d_occurrenceWeek(0)
+{
+}
+
+// ACCESSORS
+inline
+int ScheduleRequest::dayOfFeb() const
+{
+    return d_dayOfFeb;
+}
+
+inline
+int ScheduleRequest::dayOfMonth() const
+{
+    return d_dayOfMonth;
+}
+
+inline
+bdlt::DayOfWeek::Enum ScheduleRequest::dayOfWeek() const
+{
+    return d_dayOfWeek;
+}
+
+inline
+const bdlt::Date& ScheduleRequest::earliest() const
+{
+    return d_earliest;
+}
+
+inline
+const bdlt::Date& ScheduleRequest::example() const
+{
+    return d_example;
+}
+
+inline
+int ScheduleRequest::interval() const
+{
+    return d_interval;
+}
+
+inline
+const bdlt::Date& ScheduleRequest::latest() const
+{
+    return d_latest;
+}
+
+inline
+ScheduleRequest::Method ScheduleRequest::method() const
+{
+    return d_method;
+}
+
+inline
+int ScheduleRequest::occurrenceWeek() const
+{
+    return d_occurrenceWeek;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bblb::operator==(const ScheduleRequest& lhs, const ScheduleRequest& rhs)
+{
+    return lhs.method()         == rhs.method()
+        && lhs.earliest()       == rhs.earliest()
+        && lhs.latest()         == rhs.latest()
+        && lhs.example()        == rhs.example()
+        && lhs.interval()       == rhs.interval()
+        && lhs.dayOfMonth()     == rhs.dayOfMonth()
+        && lhs.dayOfFeb()       == rhs.dayOfFeb()
+        && lhs.dayOfWeek()      == rhs.dayOfWeek()
+        && lhs.occurrenceWeek() == rhs.occurrenceWeek();
+}
+
+inline
+bool bblb::operator!=(const ScheduleRequest& lhs, const ScheduleRequest& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class HASHALG>
+inline
+void bblb::hashAppend(HASHALG& hashAlg, const ScheduleRequest& object)
+{
+    using ::BloombergLP::bslh::hashAppend;
+
+    hashAppend(hashAlg, static_cast<int>(object.method()));
+    hashAppend(hashAlg, object.earliest());
+    hashAppend(hashAlg, object.latest());
+    hashAppend(hashAlg, object.example());
+    hashAppend(hashAlg, object.interval());
+    hashAppend(hashAlg, object.dayOfMonth());
+    hashAppend(hashAlg, object.dayOfFeb());
+    hashAppend(hashAlg, static_cast<int>(object.dayOfWeek()));
+    hashAppend(hashAlg, object.occurrenceWeek());
+}
+
+}  // close enterprise namespace
+
+// TRAITS
+
+namespace bsl {
+
+template <>
+struct is_trivially_copyable<BloombergLP::bblb::ScheduleRequest>
+                                                           : bsl::true_type {
+    // This template specialization for 'is_trivially_copyable' indicates that
+    // 'ScheduleRequest' is a trivially copyable type.
+};
+
+}  // close namespace bsl
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,661 @@
+// bblb_schedulerequest.t.cpp                                         -*-C++-*-
+#include <bblb_schedulerequest.h>
+
+#include <bdlt_date.h>
+#include <bdlt_dayofweek.h>
+
+#include <bslh_hash.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is an unconstrained value-semantic attribute class
+// whose value is set through one manipulator per schedule generation method.
+// The manipulators and accessors are tested first, then the value-semantic
+// operations ('print', equality, copy, and 'hashAppend') are verified on a set
+// of distinct values that each differ from one another in a single attribute.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ScheduleRequest();
+// [ 4] ScheduleRequest(const ScheduleRequest& original);
+//
+// MANIPULATORS
+// [ 4] ScheduleRequest& operator=(const ScheduleRequest& rhs);
+// [ 2] void setDayInterval(earliest, latest, example, interval);
+// [ 2] void setDayOfMonth(e, l, eY, eM, interval, tDOM, tDOF = 0);
+// [ 2] void setDayOfWeekAfterDayOfMonth(e, l, eY, eM, i, dOW, dOM);
+// [ 2] void setDayOfWeekInMonth(e, l, eY, eM, i, dOW, oW);
+//
+// ACCESSORS
+// [ 2] int dayOfFeb() const;
+// [ 2] int dayOfMonth() const;
+// [ 2] bdlt::DayOfWeek::Enum dayOfWeek() const;
+// [ 2] const bdlt::Date& earliest() const;
+// [ 2] const bdlt::Date& example() const;
+// [ 2] int interval() const;
+// [ 2] const bdlt::Date& latest() const;
+// [ 2] Method method() const;
+// [ 2] int occurrenceWeek() const;
+// [ 3] ostream& print(ostream& stream, int level, int sPL) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const ScheduleRequest&, const ScheduleRequest&);
+// [ 4] bool operator!=(const ScheduleRequest&, const ScheduleRequest&);
+// [ 3] ostream& operator<<(ostream& stream, const ScheduleRequest& obj);
+//
+// FREE FUNCTIONS
+// [ 5] void hashAppend(HASHALG& hashAlg, const ScheduleRequest& object);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bblb::ScheduleRequest Obj;
+
+#define DAY(X) bdlt::DayOfWeek::e_##X       // Shorten qualified name
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, and replace 'assert' with
+        //:   'ASSERT'.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recognizing Identical Schedules
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a portfolio holds many instruments paying quarterly on the 15th
+// of the month, and we want to recognize the instruments whose payment
+// schedules are identical.
+//
+// First, we describe the schedules of two of the instruments:
+//..
+    bblb::ScheduleRequest a;
+    a.setDayOfMonth(bdlt::Date(2020, 1, 1),   // 'earliest'
+                    bdlt::Date(2030, 1, 1),   // 'latest'
+                    2019,                     // 'exampleYear'
+                    3,                        // 'exampleMonth'
+                    3,                        // 'intervalInMonths'
+                    15);                      // 'targetDayOfMonth'
+
+    bblb::ScheduleRequest b;
+    b.setDayOfMonth(bdlt::Date(2020, 1, 1),
+                    bdlt::Date(2030, 1, 1),
+                    2024,
+                    12,
+                    3,
+                    15);
+//..
+// Then, we observe that the requests are not equal, even though the schedules
+// they describe will turn out to be the same (December 2024 is an integral
+// number of quarters after March 2019):
+//..
+    ASSERT(a != b);
+//..
+// Finally, we describe the schedule of a third instrument having exactly the
+// same terms as the first, and observe that the two requests are equal and
+// hash to the same value:
+//..
+    bblb::ScheduleRequest c(a);
+    ASSERT(a == c);
+
+    bslh::Hash<> hasher;
+    ASSERT(hasher(a) == hasher(c));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'hashAppend'
+        //
+        // Concerns:
+        //: 1 Objects having the same value produce the same hash value.
+        //:
+        //: 2 Objects differing in a single attribute produce different hash
+        //:   values (for the values tested).
+        //
+        // Plan:
+        //: 1 Create a set of objects having distinct values, each differing
+        //:   from a base value in a single attribute; verify that the hash of
+        //:   a copy of each object equals the hash of the original, and that
+        //:   no two objects in the set have the same hash.  (C-1..2)
+        //
+        // Testing:
+        //   void hashAppend(HASHALG& hashAlg, const ScheduleRequest& object);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'hashAppend'" << endl
+                          << "====================" << endl;
+
+        const bdlt::Date E(2020, 1, 1);
+        const bdlt::Date L(2030, 1, 1);
+
+        bsl::vector<Obj> objects(9);
+        objects[1].setDayInterval(E, L, E, 1);
+        objects[2].setDayInterval(E, L, E, 2);
+        objects[3].setDayInterval(E, E, E, 1);
+        objects[4].setDayOfMonth(E, L, 2020, 1, 1, 1);
+        objects[5].setDayOfMonth(E, L, 2020, 1, 1, 1, 1);
+        objects[6].setDayOfWeekAfterDayOfMonth(E, L, 2020, 1, 1, DAY(SUN), 1);
+        objects[7].setDayOfWeekAfterDayOfMonth(E, L, 2020, 1, 1, DAY(MON), 1);
+        objects[8].setDayOfWeekInMonth(E, L, 2020, 1, 1, DAY(SUN), 1);
+
+        bslh::Hash<> hasher;
+
+        for (bsl::size_t i = 0; i < objects.size(); ++i) {
+            const Obj X(objects[i]);
+
+            ASSERTV(i, hasher(X) == hasher(objects[i]));
+
+            for (bsl::size_t j = 0; j < i; ++j) {
+                ASSERTV(i, j, hasher(objects[j]) != hasher(objects[i]));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING EQUALITY OPERATORS AND COPY
+        //
+        // Concerns:
+        //: 1 Two objects compare equal if and only if each of their
+        //:   corresponding attributes are equal.
+        //:
+        //: 2 'operator!=' is the negation of 'operator=='.
+        //:
+        //: 3 A copy-constructed or assigned object has the value of the
+        //:   original.
+        //:
+        //: 4 Setting an object to describe a different method resets the
+        //:   attributes not used by that method to their default values.
+        //
+        // Plan:
+        //: 1 Create a set of objects having distinct values, and verify the
+        //:   equality operators for every pair (including self-pairs).
+        //:   (C-1..2)
+        //:
+        //: 2 Copy-construct and assign from each object and verify the
+        //:   result.  (C-3)
+        //:
+        //: 3 Set an object through each 'set*' manipulator in turn and verify
+        //:   that it equals an object set directly.  (C-4)
+        //
+        // Testing:
+        //   bool operator==(const ScheduleRequest&, const ScheduleRequest&);
+        //   bool operator!=(const ScheduleRequest&, const ScheduleRequest&);
+        //   ScheduleRequest(const ScheduleRequest& original);
+        //   ScheduleRequest& operator=(const ScheduleRequest& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING EQUALITY OPERATORS AND COPY" << endl
+                          << "===================================" << endl;
+
+        const bdlt::Date E(2020, 1, 1);
+        const bdlt::Date L(2030, 1, 1);
+
+        bsl::vector<Obj> objects(10);
+        objects[1].setDayInterval(E, L, E, 1);
+        objects[2].setDayInterval(E, L, L, 1);
+        objects[3].setDayInterval(L, L, E, 1);
+        objects[4].setDayOfMonth(E, L, 2020, 1, 1, 1);
+        objects[5].setDayOfMonth(E, L, 2020, 2, 1, 1);
+        objects[6].setDayOfMonth(E, L, 2020, 1, 1, 1, 28);
+        objects[7].setDayOfWeekAfterDayOfMonth(E, L, 2020, 1, 1, DAY(SUN), 1);
+        objects[8].setDayOfWeekAfterDayOfMonth(E, L, 2020, 1, 2, DAY(SUN), 1);
+        objects[9].setDayOfWeekInMonth(E, L, 2020, 1, 1, DAY(SUN), 1);
+
+        for (bsl::size_t i = 0; i < objects.size(); ++i) {
+            const Obj& X = objects[i];
+
+            for (bsl::size_t j = 0; j < objects.size(); ++j) {
+                const Obj& Y = objects[j];
+
+                if (veryVerbose) { T_ P_(i) P_(j) P_(X) P(Y); }
+
+                ASSERTV(i, j, (i == j) == (X == Y));
+                ASSERTV(i, j, (i != j) == (X != Y));
+            }
+
+            const Obj C(X);
+            ASSERTV(i, X == C);
+
+            Obj mA;  const Obj& A = mA;
+            Obj *mR = &(mA = X);
+            ASSERTV(i, X == A);
+            ASSERTV(i, mR == &mA);
+        }
+
+        // Setting a different method resets the unused attributes.
+
+        Obj mX;  const Obj& X = mX;
+
+        mX.setDayOfWeekInMonth(E, L, 2020, 1, 1, DAY(SAT), 3);
+        mX.setDayOfMonth(E, L, 2020, 1, 1, 1, 28);
+        ASSERTV(X, objects[6] == X);
+
+        mX.setDayInterval(E, L, E, 1);
+        ASSERTV(X, objects[1] == X);
+
+        mX.setDayOfWeekAfterDayOfMonth(E, L, 2020, 1, 1, DAY(SUN), 1);
+        ASSERTV(X, objects[7] == X);
+
+        mX.setDayOfWeekInMonth(E, L, 2020, 1, 1, DAY(SUN), 1);
+        ASSERTV(X, objects[9] == X);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'print' AND 'operator<<'
+        //
+        // Concerns:
+        //: 1 The 'print' method writes every attribute, honoring 'level' and
+        //:   'spacesPerLevel', and returns the stream.
+        //:
+        //: 2 'operator<<' produces the single-line format of 'print'.
+        //
+        // Plan:
+        //: 1 Print an object in multi-line and single-line formats and compare
+        //:   with the expected output.  (C-1..2)
+        //
+        // Testing:
+        //   ostream& print(ostream& stream, int level, int sPL) const;
+        //   ostream& operator<<(ostream& stream, const ScheduleRequest& obj);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'print' AND 'operator<<'" << endl
+                          << "================================" << endl;
+
+        Obj mX;  const Obj& X = mX;
+        mX.setDayOfWeekInMonth(bdlt::Date(2020, 1,  1),
+                               bdlt::Date(2030, 6, 30),
+                               2019,
+                               3,
+                               6,
+                               DAY(TUE),
+                               2);
+
+        const char *EXP_ML = "[\n"
+                             "  method = 3\n"
+                             "  earliest = 01JAN2020\n"
+                             "  latest = 30JUN2030\n"
+                             "  example = 01MAR2019\n"
+                             "  interval = 6\n"
+                             "  dayOfMonth = 0\n"
+                             "  dayOfFeb = 0\n"
+                             "  dayOfWeek = TUE\n"
+                             "  occurrenceWeek = 2\n"
+                             "]\n";
+
+        const char *EXP_SL = "[ method = 3 earliest = 01JAN2020"
+                             " latest = 30JUN2030 example = 01MAR2019"
+                             " interval = 6 dayOfMonth = 0 dayOfFeb = 0"
+                             " dayOfWeek = TUE occurrenceWeek = 2 ]";
+
+        {
+            bsl::ostringstream os;
+            ASSERT(&os == &X.print(os, 0, 2));
+            ASSERTV(os.str(), EXP_ML == os.str());
+        }
+        {
+            bsl::ostringstream os;
+            ASSERT(&os == &X.print(os, 0, -1));
+            ASSERTV(os.str(), EXP_SL == os.str());
+        }
+        {
+            bsl::ostringstream os;
+            ASSERT(&os == &(os << X));
+            ASSERTV(os.str(), EXP_SL == os.str());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor creates an object having the documented
+        //:   default attribute values.
+        //:
+        //: 2 Each 'set*' manipulator sets the 'method' attribute and the
+        //:   attributes corresponding to its arguments, leaving the others at
+        //:   their default values.
+        //:
+        //: 3 For the month-based methods, 'example' is the first day of the
+        //:   example month.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Default construct an object and verify each attribute.  (C-1)
+        //:
+        //: 2 Invoke each 'set*' manipulator and verify each attribute.
+        //:   (C-2..3)
+        //:
+        //: 3 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   ScheduleRequest();
+        //   void setDayInterval(earliest, latest, example, interval);
+        //   void setDayOfMonth(e, l, eY, eM, interval, tDOM, tDOF = 0);
+        //   void setDayOfWeekAfterDayOfMonth(e, l, eY, eM, i, dOW, dOM);
+        //   void setDayOfWeekInMonth(e, l, eY, eM, i, dOW, oW);
+        //   int dayOfFeb() const;
+        //   int dayOfMonth() const;
+        //   bdlt::DayOfWeek::Enum dayOfWeek() const;
+        //   const bdlt::Date& earliest() const;
+        //   const bdlt::Date& example() const;
+        //   int interval() const;
+        //   const bdlt::Date& latest() const;
+        //   Method method() const;
+        //   int occurrenceWeek() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING MANIPULATORS AND ACCESSORS" << endl
+                          << "==================================" << endl;
+
+        const bdlt::Date E(2012, 2,  1);
+        const bdlt::Date L(2015, 2, 28);
+        const bdlt::Date X(2007, 7, 23);
+
+        {
+            const Obj D;
+
+            ASSERT(Obj::e_DAY_INTERVAL == D.method());
+            ASSERT(bdlt::Date()        == D.earliest());
+            ASSERT(bdlt::Date()        == D.latest());
+            ASSERT(bdlt::Date()        == D.example());
+            ASSERT(1                   == D.interval());
+            ASSERT(0                   == D.dayOfMonth());
+            ASSERT(0                   == D.dayOfFeb());
+            ASSERT(DAY(SUN)            == D.dayOfWeek());
+            ASSERT(0                   == D.occurrenceWeek());
+        }
+        {
+            Obj mR;  const Obj& R = mR;
+
+            mR.setDayInterval(E, L, X, 7);
+
+            ASSERT(Obj::e_DAY_INTERVAL == R.method());
+            ASSERT(E                   == R.earliest());
+            ASSERT(L                   == R.latest());
+            ASSERT(X                   == R.example());
+            ASSERT(7                   == R.interval());
+            ASSERT(0                   == R.dayOfMonth());
+            ASSERT(0                   == R.dayOfFeb());
+            ASSERT(DAY(SUN)            == R.dayOfWeek());
+            ASSERT(0                   == R.occurrenceWeek());
+
+            mR.setDayOfMonth(E, L, 2007, 7, 9, 31, 28);
+
+            ASSERT(Obj::e_DAY_OF_MONTH == R.method());
+            ASSERT(E                   == R.earliest());
+            ASSERT(L                   == R.latest());
+            ASSERT(bdlt::Date(2007, 7, 1)
+                                       == R.example());
+            ASSERT(9                   == R.interval());
+            ASSERT(31                  == R.dayOfMonth());
+            ASSERT(28                  == R.dayOfFeb());
+            ASSERT(DAY(SUN)            == R.dayOfWeek());
+            ASSERT(0                   == R.occurrenceWeek());
+
+            mR.setDayOfMonth(E, L, 2007, 8, 3, 30);
+
+            ASSERT(bdlt::Date(2007, 8, 1)
+                                       == R.example());
+            ASSERT(3                   == R.interval());
+            ASSERT(30                  == R.dayOfMonth());
+            ASSERT(0                   == R.dayOfFeb());
+
+            mR.setDayOfWeekAfterDayOfMonth(E, L, 2007, 12, 2, DAY(FRI), 10);
+
+            ASSERT(Obj::e_DAY_OF_WEEK_AFTER_DAY_OF_MONTH
+                                       == R.method());
+            ASSERT(E                   == R.earliest());
+            ASSERT(L                   == R.latest());
+            ASSERT(bdlt::Date(2007, 12, 1)
+                                       == R.example());
+            ASSERT(2                   == R.interval());
+            ASSERT(10                  == R.dayOfMonth());
+            ASSERT(0                   == R.dayOfFeb());
+            ASSERT(DAY(FRI)            == R.dayOfWeek());
+            ASSERT(0                   == R.occurrenceWeek());
+
+            mR.setDayOfWeekInMonth(E, L, 2008, 1, 4, DAY(MON), 3);
+
+            ASSERT(Obj::e_DAY_OF_WEEK_IN_MONTH
+                                       == R.method());
+            ASSERT(E                   == R.earliest());
+            ASSERT(L                   == R.latest());
+            ASSERT(bdlt::Date(2008, 1, 1)
+                                       == R.example());
+            ASSERT(4                   == R.interval());
+            ASSERT(0                   == R.dayOfMonth());
+            ASSERT(0                   == R.dayOfFeb());
+            ASSERT(DAY(MON)            == R.dayOfWeek());
+            ASSERT(3                   == R.occurrenceWeek());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mR;
+
+            ASSERT_PASS(mR.setDayInterval(E, L, X, 1));
+            ASSERT_PASS(mR.setDayInterval(E, E, X, 1));
+            ASSERT_FAIL(mR.setDayInterval(L, E, X, 1));
+            ASSERT_FAIL(mR.setDayInterval(E, L, X, 0));
+
+            ASSERT_PASS(mR.setDayOfMonth(E, L, 1, 1, 1, 1));
+            ASSERT_PASS(mR.setDayOfMonth(E, L, 9999, 12, 1, 31, 29));
+            ASSERT_FAIL(mR.setDayOfMonth(L, E, 2000, 1, 1, 1));
+            ASSERT_FAIL(mR.setDayOfMonth(E, L, 0, 1, 1, 1));
+            ASSERT_FAIL(mR.setDayOfMonth(E, L, 10000, 1, 1, 1));
+            ASSERT_FAIL(mR.setDayOfMonth(E, L, 2000, 0, 1, 1));
+            ASSERT_FAIL(mR.setDayOfMonth(E, L, 2000, 13, 1, 1));
+            ASSERT_FAIL(mR.setDayOfMonth(E, L, 2000, 1, 0, 1));
+            ASSERT_FAIL(mR.setDayOfMonth(E, L, 2000, 1, 1, 0));
+            ASSERT_FAIL(mR.setDayOfMonth(E, L, 2000, 1, 1, 32));
+            ASSERT_FAIL(mR.setDayOfMonth(E, L, 2000, 1, 1, 1, -1));
+            ASSERT_FAIL(mR.setDayOfMonth(E, L, 2000, 1, 1, 1, 30));
+
+            ASSERT_PASS(mR.setDayOfWeekAfterDayOfMonth(E, L, 2000, 1, 1,
+                                                       DAY(SUN), 1));
+            ASSERT_PASS(mR.setDayOfWeekAfterDayOfMonth(E, L, 2000, 1, 1,
+                                                       DAY(SUN), 31));
+            ASSERT_FAIL(mR.setDayOfWeekAfterDayOfMonth(L, E, 2000, 1, 1,
+                                                       DAY(SUN), 1));
+            ASSERT_FAIL(mR.setDayOfWeekAfterDayOfMonth(E, L, 0, 1, 1,
+                                                       DAY(SUN), 1));
+            ASSERT_FAIL(mR.setDayOfWeekAfterDayOfMonth(E, L, 2000, 13, 1,
+                                                       DAY(SUN), 1));
+            ASSERT_FAIL(mR.setDayOfWeekAfterDayOfMonth(E, L, 2000, 1, 0,
+                                                       DAY(SUN), 1));
+            ASSERT_FAIL(mR.setDayOfWeekAfterDayOfMonth(E, L, 2000, 1, 1,
+                                                       DAY(SUN), 0));
+            ASSERT_FAIL(mR.setDayOfWeekAfterDayOfMonth(E, L, 2000, 1, 1,
+                                                       DAY(SUN), 32));
+
+            ASSERT_PASS(mR.setDayOfWeekInMonth(E, L, 2000, 1, 1, DAY(SUN), 1));
+            ASSERT_PASS(mR.setDayOfWeekInMonth(E, L, 2000, 1, 1, DAY(SUN), 4));
+            ASSERT_FAIL(mR.setDayOfWeekInMonth(L, E, 2000, 1, 1, DAY(SUN), 1));
+            ASSERT_FAIL(mR.setDayOfWeekInMonth(E, L, 0, 1, 1, DAY(SUN), 1));
+            ASSERT_FAIL(mR.setDayOfWeekInMonth(E, L, 2000, 0, 1, DAY(SUN), 1));
+            ASSERT_FAIL(mR.setDayOfWeekInMonth(E, L, 2000, 1, 0, DAY(SUN), 1));
+            ASSERT_FAIL(mR.setDayOfWeekInMonth(E, L, 2000, 1, 1, DAY(SUN), 0));
+            ASSERT_FAIL(mR.setDayOfWeekInMonth(E, L, 2000, 1, 1, DAY(SUN), 5));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create objects, set their values, and compare them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+        Obj mY;  const Obj& Y = mY;
+
+        ASSERT(X == Y);
+
+        mX.setDayOfMonth(bdlt::Date(2012, 2, 1),
+                         bdlt::Date(2015, 2, 28),
+                         2007,
+                         7,
+                         9,
+                         23);
+
+        ASSERT(X != Y);
+        ASSERT(Obj::e_DAY_OF_MONTH == X.method());
+
+        mY = X;
+
+        ASSERT(X == Y);
+
+        if (veryVerbose) { P(X); }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -4,6 +4,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bbldc_basicactual365fixed_cpp,"$Id$ $CSID$")
 
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 
 namespace BloombergLP {
@@ -30,6 +31,23 @@ double BasicActual365Fixed::yearsDiff(const bdlt::Date& beginDate,
     return rv;
 }
 
+void BasicActual365Fixed::yearsDiff(double           *results,
+                                    const bdlt::Date *beginDates,
+                                    const bdlt::Date *endDates,
+                                    bsl::size_t       numDates)
+{
+    BSLS_ASSERT(results    || 0 == numDates);
+    BSLS_ASSERT(beginDates || 0 == numDates);
+    BSLS_ASSERT(endDates   || 0 == numDates);
+
+    // The day count is a difference of serial dates, so this loop has no
+    // calls or branches and is a candidate for auto-vectorization.
+
+    for (bsl::size_t i = 0; i < numDates; ++i) {
+        results[i] = (endDates[i] - beginDates[i]) / 365.0;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
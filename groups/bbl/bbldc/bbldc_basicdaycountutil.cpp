@@ -21,6 +21,26 @@ BSLS_IDENT_RCSID(bbldc_basicdaycountutil_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace bbldc {
 
+namespace {
+
+template <class CONVENTION>
+void yearsDiffLoop(double           *results,
+                   const bdlt::Date *beginDates,
+                   const bdlt::Date *endDates,
+                   bsl::size_t       numDates)
+    // Load, into each of the specified 'numDates' elements of the specified
+    // 'results' array, the year fraction between the corresponding elements of
+    // the specified 'beginDates' and 'endDates' arrays as computed by
+    // 'CONVENTION::yearsDiff'.  Note that this function is used for
+    // conventions that do not provide a batch 'yearsDiff' of their own.
+{
+    for (bsl::size_t i = 0; i < numDates; ++i) {
+        results[i] = CONVENTION::yearsDiff(beginDates[i], endDates[i]);
+    }
+}
+
+}  // close unnamed namespace
+
                          // ------------------------
                          // struct BasicDayCountUtil
                          // ------------------------
@@ -136,6 +156,77 @@ double BasicDayCountUtil::yearsDiff(const bdlt::Date&        beginDate,
     return numYears;
 }
 
+void BasicDayCountUtil::yearsDiff(double                   *results,
+                                  const bdlt::Date         *beginDates,
+                                  const bdlt::Date         *endDates,
+                                  bsl::size_t               numDates,
+                                  DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(results    || 0 == numDates);
+    BSLS_ASSERT(beginDates || 0 == numDates);
+    BSLS_ASSERT(endDates   || 0 == numDates);
+
+    switch (convention) {
+      case DayCountConvention::e_ACTUAL_360: {
+        yearsDiffLoop<bbldc::BasicActual360>(results,
+                                             beginDates,
+                                             endDates,
+                                             numDates);
+      } break;
+      case DayCountConvention::e_ACTUAL_365_FIXED: {
+        bbldc::BasicActual365Fixed::yearsDiff(results,
+                                              beginDates,
+                                              endDates,
+                                              numDates);
+      } break;
+      case DayCountConvention::e_ISDA_30_360_EOM: {
+        yearsDiffLoop<bbldc::TerminatedIsda30360Eom>(results,
+                                                     beginDates,
+                                                     endDates,
+                                                     numDates);
+      } break;
+      case DayCountConvention::e_ISDA_ACTUAL_ACTUAL: {
+        bbldc::BasicIsdaActualActual::yearsDiff(results,
+                                                beginDates,
+                                                endDates,
+                                                numDates);
+      } break;
+      case DayCountConvention::e_ISMA_30_360: {
+        bbldc::BasicIsma30360::yearsDiff(results,
+                                         beginDates,
+                                         endDates,
+                                         numDates);
+      } break;
+      case DayCountConvention::e_NL_365: {
+        yearsDiffLoop<bbldc::BasicNl365>(results,
+                                         beginDates,
+                                         endDates,
+                                         numDates);
+      } break;
+      case DayCountConvention::e_PSA_30_360_EOM: {
+        yearsDiffLoop<bbldc::BasicPsa30360Eom>(results,
+                                               beginDates,
+                                               endDates,
+                                               numDates);
+      } break;
+      case DayCountConvention::e_SIA_30_360_EOM: {
+        yearsDiffLoop<bbldc::BasicSia30360Eom>(results,
+                                               beginDates,
+                                               endDates,
+                                               numDates);
+      } break;
+      case DayCountConvention::e_SIA_30_360_NEOM: {
+        yearsDiffLoop<bbldc::BasicSia30360Neom>(results,
+                                                beginDates,
+                                                endDates,
+                                                numDates);
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
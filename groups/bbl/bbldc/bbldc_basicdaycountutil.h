@@ -20,6 +20,11 @@ BSLS_IDENT("$Id: $")
 // 'DayCountConvention::Enum' argument indicating which particular day-count
 // convention to apply.
 //
+// An overload of 'yearsDiff' computes the year fractions for arrays of date
+// pairs.  The convention is selected once per call, and the pairs are then
+// processed by a loop specific to that convention (with no per-pair dispatch),
+// which is preferable when a large number of cashflows share a convention.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -57,6 +62,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bbldc_daycountconvention.h>
 
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 namespace bdlt { class Date; }
 namespace bbldc {
@@ -95,6 +102,25 @@ struct BasicDayCountUtil {
         // 'beginDate' and 'endDate' negates the result; specifically,
         // '|yearsDiff(b, e, c) + yearsDiff(e, b, c)| <= 1.0e-15' for all dates
         // 'b' and 'e', and day-count conventions 'c'.
+
+    static void yearsDiff(double                   *results,
+                          const bdlt::Date         *beginDates,
+                          const bdlt::Date         *endDates,
+                          bsl::size_t               numDates,
+                          DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numDates' elements of the
+        // specified 'results' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates'
+        // and 'endDates' arrays according to the specified day-count
+        // 'convention'.  Each element 'results[i]' has the value that
+        // 'yearsDiff(beginDates[i], endDates[i], convention)' would return.
+        // The behavior is undefined unless 'isSupported(convention)', and
+        // 'results', 'beginDates', and 'endDates' each refer to an array of at
+        // least 'numDates' elements.  Note that, on platforms that compute
+        // with extra floating-point precision, storing each result to the
+        // 'results' array rounds it to 'double', so that it is identical to
+        // the single-pair result, which is rounded by being stored to a
+        // 'volatile double'.
 };
 
 }  // close package namespace
@@ -11,6 +11,7 @@
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -28,8 +29,9 @@ using namespace bsl;
 // [ 2] int daysDiff(beginDate, endDate, convention);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(beginDate, endDate, convention);
+// [ 4] void yearsDiff(results, begin, end, numDates, convention);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -119,7 +121,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -174,6 +176,156 @@ int main(int argc, char *argv[])
     ASSERT(0.1999 < yearsDiff && 0.2001 > yearsDiff);
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'yearsDiff'
+        //   Verify the batch method computes the same values as the
+        //   single-pair method.
+        //
+        // Concerns:
+        //: 1 Each element loaded by the batch 'yearsDiff' is identical (not
+        //:   merely close) to the value returned by the single-pair
+        //:   'yearsDiff' for the corresponding pair of dates and
+        //:   convention.
+        //:
+        //: 2 The method supports pairs in either order, equal dates, and
+        //:   dates spanning leap years and distant years.
+        //:
+        //: 3 No element beyond the first 'numDates' elements of 'results' is
+        //:   modified.
+        //:
+        //: 4 A batch of zero pairs may be supplied null array addresses.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Form a set of date pairs from a table of begin dates and a table
+        //:   of day offsets, apply the batch method for
+        //:   each supported convention, and compare each
+        //:   element to the single-pair result using '=='.  (C-1..2)
+        //:
+        //: 2 Place a sentinel value after the last element of 'results' and
+        //:   verify it is unchanged.  (C-3)
+        //:
+        //: 3 Invoke the method with 'numDates == 0' and null arrays.  (C-4)
+        //:
+        //: 4 Verify defensive checks are triggered for null arrays having a
+        //:   non-zero 'numDates', and for an
+        //:   unsupported convention.  (C-5)
+        //
+        // Testing:
+        //   void yearsDiff(results, begin, end, numDates, convention);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH 'yearsDiff'" << endl
+                          << "=========================" << endl;
+
+        static const struct {
+            int d_year;   // beginDate year
+            int d_month;  // beginDate month
+            int d_day;    // beginDate day
+        } BEGIN[] = {
+            {    1,  1,  1 }, { 1899, 12, 31 }, { 1900,  2, 28 },
+            { 1900,  3,  1 }, { 1992,  2, 29 }, { 1993,  1, 31 },
+            { 1999, 12, 31 }, { 2000,  1,  1 }, { 2000,  2, 28 },
+            { 2000,  2, 29 }, { 2003,  3, 31 }, { 2004,  2, 29 },
+            { 2015,  8, 30 }, { 2015,  8, 31 }, { 2100,  2, 28 },
+            { 9998, 12, 31 },
+        };
+        const int NUM_BEGIN = sizeof BEGIN / sizeof *BEGIN;
+
+        static const int OFFSET[] = {
+                0,     1,    -1,    28,   -29,    30,    31,   -59,    60,
+             -181,   365,   366,  -366,   730, -1461,  1461,  3652, -36525,
+            36524, 73000
+        };
+        const int NUM_OFFSET = sizeof OFFSET / sizeof *OFFSET;
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+
+        for (int bi = 0; bi < NUM_BEGIN; ++bi) {
+            const bdlt::Date BEGIN_DATE(BEGIN[bi].d_year,
+                                        BEGIN[bi].d_month,
+                                        BEGIN[bi].d_day);
+
+            for (int oi = 0; oi < NUM_OFFSET; ++oi) {
+                bdlt::Date endDate(BEGIN_DATE);
+                if (0 == endDate.addDaysIfValid(OFFSET[oi])) {
+                    beginDates.push_back(BEGIN_DATE);
+                    endDates.push_back(endDate);
+                }
+            }
+        }
+
+        const bsl::size_t NUM_DATES = beginDates.size();
+        const double      SENTINEL  = -12345.0;
+
+        if (veryVerbose) { T_ P(NUM_DATES); }
+
+        static const Enum CONVENTIONS[] = {
+            ACTUAL_360,
+            ACTUAL_365_FIXED,
+            ISDA_30_360_EOM,
+            ISDA_ACTUAL_ACTUAL,
+            ISMA_30_360,
+            NL_365,
+            PSA_30_360_EOM,
+            SIA_30_360_EOM,
+            SIA_30_360_NEOM,
+        };
+        const int NUM_CONVENTIONS = sizeof CONVENTIONS / sizeof *CONVENTIONS;
+
+        for (int ci = 0; ci < NUM_CONVENTIONS; ++ci) {
+            const Enum CONV = CONVENTIONS[ci];
+
+            if (veryVerbose) { T_ P(CONV); }
+
+            bsl::vector<double> results(NUM_DATES + 1, SENTINEL);
+
+            Util::yearsDiff(results.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            NUM_DATES,
+                            CONV);
+
+            for (bsl::size_t i = 0; i < NUM_DATES; ++i) {
+                const bdlt::Date& X = beginDates[i];
+                const bdlt::Date& Y = endDates[i];
+
+                const double EXP = Util::yearsDiff(X, Y, CONV);
+
+                ASSERTV(CONV, X, Y, EXP, results[i], EXP == results[i]);
+            }
+            ASSERTV(CONV,
+                    results[NUM_DATES],
+                    SENTINEL == results[NUM_DATES]);
+
+            Util::yearsDiff(0, 0, 0, 0, CONV);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Date X(2015, 1, 5);
+            double           result;
+
+            ASSERT_PASS(Util::yearsDiff(&result, &X, &X, 1, ACTUAL_360));
+            ASSERT_PASS(Util::yearsDiff(0,       0,  0,  0, ACTUAL_360));
+
+            ASSERT_FAIL(Util::yearsDiff(0,       &X, &X, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::yearsDiff(&result, 0,  &X, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::yearsDiff(&result, &X, 0,  1, ACTUAL_360));
+
+            ASSERT_OPT_FAIL(Util::yearsDiff(&result,
+                                            &X,
+                                            &X,
+                                            1,
+                                            INVALID_CONVENTION));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
@@ -12,6 +12,36 @@ BSLS_IDENT_RCSID(bbldc_basicisdaactualactual_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace bbldc {
 
+// STATIC HELPER FUNCTIONS
+static inline
+double computeYearsDiff(const bdlt::Date& beginDate, const bdlt::Date& endDate)
+    // Return the (signed fractional) number of years between the specified
+    // 'beginDate' and 'endDate' according to the ISDA Actual/Actual day-count
+    // convention.  Note that this function computes the same numerator and
+    // denominator as 'BasicIsdaActualActual::yearsDiff', but using a single
+    // serial-date conversion per date.
+{
+    int beginYear, beginDayOfYear, endYear, endDayOfYear;
+
+    beginDate.getYearDay(&beginYear, &beginDayOfYear);
+    endDate.getYearDay(&endYear, &endDayOfYear);
+
+    const int daysInBeginYear =
+                          365 + bdlt::SerialDateImpUtil::isLeapYear(beginYear);
+    const int daysInEndYear =
+                            365 + bdlt::SerialDateImpUtil::isLeapYear(endYear);
+
+    const int yDiff            = endYear - beginYear - 1;
+    const int beginYearDayDiff = daysInBeginYear - beginDayOfYear + 1;
+    const int endYearDayDiff   = endDayOfYear - 1;
+    const int numerator        = yDiff * daysInBeginYear * daysInEndYear
+                               + beginYearDayDiff * daysInEndYear
+                               + endYearDayDiff * daysInBeginYear;
+    const int denominator      = daysInBeginYear * daysInEndYear;
+
+    return numerator / static_cast<double>(denominator);
+}
+
                        // ----------------------------
                        // struct BasicIsdaActualActual
                        // ----------------------------
@@ -49,6 +79,20 @@ double BasicIsdaActualActual::yearsDiff(const bdlt::Date& beginDate,
     return rv;
 }
 
+void BasicIsdaActualActual::yearsDiff(double           *results,
+                                      const bdlt::Date *beginDates,
+                                      const bdlt::Date *endDates,
+                                      bsl::size_t       numDates)
+{
+    BSLS_ASSERT(results    || 0 == numDates);
+    BSLS_ASSERT(beginDates || 0 == numDates);
+    BSLS_ASSERT(endDates   || 0 == numDates);
+
+    for (bsl::size_t i = 0; i < numDates; ++i) {
+        results[i] = computeYearsDiff(beginDates[i], endDates[i]);
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -48,6 +48,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlt_date.h>
 
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 namespace bbldc {
 
@@ -78,6 +80,19 @@ struct BasicIsdaActualActual {
         // 'endDate' negates the result; specifically,
         // '|yearsDiff(b, e) + yearsDiff(e, b)| <= 1.0e-15' for all dates 'b'
         // and 'e'.
+
+    static void yearsDiff(double           *results,
+                          const bdlt::Date *beginDates,
+                          const bdlt::Date *endDates,
+                          bsl::size_t       numDates);
+        // Load, into each of the specified 'numDates' elements of the
+        // specified 'results' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates'
+        // and 'endDates' arrays according to the ISDA Actual/Actual day-count
+        // convention.  Each element 'results[i]' has the value that
+        // 'yearsDiff(beginDates[i], endDates[i])' would return.  The behavior
+        // is undefined unless 'results', 'beginDates', and 'endDates' each
+        // refer to an array of at least 'numDates' elements.
 };
 
 // ============================================================================
@@ -6,6 +6,7 @@ BSLS_IDENT_RCSID(bbldc_basicisma30360_cpp,"$Id$ $CSID$")
 
 #include <bdlt_date.h>
 
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 
 namespace BloombergLP {
@@ -62,6 +63,22 @@ double BasicIsma30360::yearsDiff(const bdlt::Date& beginDate,
     return rv;
 }
 
+void BasicIsma30360::yearsDiff(double           *results,
+                               const bdlt::Date *beginDates,
+                               const bdlt::Date *endDates,
+                               bsl::size_t       numDates)
+{
+    BSLS_ASSERT(results    || 0 == numDates);
+    BSLS_ASSERT(beginDates || 0 == numDates);
+    BSLS_ASSERT(endDates   || 0 == numDates);
+
+    for (bsl::size_t i = 0; i < numDates; ++i) {
+        results[i] =
+            static_cast<double>(computeDaysDiff(beginDates[i], endDates[i]))
+                                                                       / 360.0;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -5,8 +5,11 @@
 
 #include <bslim_testutil.h>
 
+#include <bsls_asserttest.h>
+
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -23,8 +26,9 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] int daysDiff(const bdlt::Date& bD, const bdlt::Date& eD);
 // [ 2] double yearsDiff(const bdlt::Date& bD, const bdlt::Date& eD);
+// [ 3] void yearsDiff(double *r, const Date *bD, const Date *eD, n);
 // ----------------------------------------------------------------------------
-// [ 3] USAGE EXAMPLE
+// [ 4] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -71,6 +75,17 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
 // ============================================================================
 //                     GLOBAL TYPEDEFS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -90,7 +105,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -135,6 +150,127 @@ int main(int argc, char *argv[])
     ASSERT(0.25 == yearsDiff);
 //..
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'yearsDiff'
+        //   Verify the batch method computes the same values as the
+        //   single-pair method.
+        //
+        // Concerns:
+        //: 1 Each element loaded by the batch 'yearsDiff' is identical (not
+        //:   merely close) to the value returned by the single-pair
+        //:   'yearsDiff' for the corresponding pair of dates.
+        //:
+        //: 2 The method supports pairs in either order, equal dates, and
+        //:   dates spanning leap years and distant years.
+        //:
+        //: 3 No element beyond the first 'numDates' elements of 'results' is
+        //:   modified.
+        //:
+        //: 4 A batch of zero pairs may be supplied null array addresses.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Form a set of date pairs from a table of begin dates and a table
+        //:   of day offsets, apply the batch method, and compare each
+        //:   element to the single-pair result using '=='.  (C-1..2)
+        //:
+        //: 2 Place a sentinel value after the last element of 'results' and
+        //:   verify it is unchanged.  (C-3)
+        //:
+        //: 3 Invoke the method with 'numDates == 0' and null arrays.  (C-4)
+        //:
+        //: 4 Verify defensive checks are triggered for null arrays having a
+        //:   non-zero 'numDates'.  (C-5)
+        //
+        // Testing:
+        //   void yearsDiff(double *r, const Date *bD, const Date *eD, n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH 'yearsDiff'" << endl
+                          << "=========================" << endl;
+
+        static const struct {
+            int d_year;   // beginDate year
+            int d_month;  // beginDate month
+            int d_day;    // beginDate day
+        } BEGIN[] = {
+            {    1,  1,  1 }, { 1899, 12, 31 }, { 1900,  2, 28 },
+            { 1900,  3,  1 }, { 1992,  2, 29 }, { 1993,  1, 31 },
+            { 1999, 12, 31 }, { 2000,  1,  1 }, { 2000,  2, 28 },
+            { 2000,  2, 29 }, { 2003,  3, 31 }, { 2004,  2, 29 },
+            { 2015,  8, 30 }, { 2015,  8, 31 }, { 2100,  2, 28 },
+            { 9998, 12, 31 },
+        };
+        const int NUM_BEGIN = sizeof BEGIN / sizeof *BEGIN;
+
+        static const int OFFSET[] = {
+                0,     1,    -1,    28,   -29,    30,    31,   -59,    60,
+             -181,   365,   366,  -366,   730, -1461,  1461,  3652, -36525,
+            36524, 73000
+        };
+        const int NUM_OFFSET = sizeof OFFSET / sizeof *OFFSET;
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+
+        for (int bi = 0; bi < NUM_BEGIN; ++bi) {
+            const bdlt::Date BEGIN_DATE(BEGIN[bi].d_year,
+                                        BEGIN[bi].d_month,
+                                        BEGIN[bi].d_day);
+
+            for (int oi = 0; oi < NUM_OFFSET; ++oi) {
+                bdlt::Date endDate(BEGIN_DATE);
+                if (0 == endDate.addDaysIfValid(OFFSET[oi])) {
+                    beginDates.push_back(BEGIN_DATE);
+                    endDates.push_back(endDate);
+                }
+            }
+        }
+
+        const bsl::size_t NUM_DATES = beginDates.size();
+        const double      SENTINEL  = -12345.0;
+
+        if (veryVerbose) { T_ P(NUM_DATES); }
+
+        {
+            bsl::vector<double> results(NUM_DATES + 1, SENTINEL);
+
+            Util::yearsDiff(results.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            NUM_DATES);
+
+            for (bsl::size_t i = 0; i < NUM_DATES; ++i) {
+                const bdlt::Date& X = beginDates[i];
+                const bdlt::Date& Y = endDates[i];
+
+                const double EXP = Util::yearsDiff(X, Y);
+
+                ASSERTV(X, Y, EXP, results[i], EXP == results[i]);
+            }
+            ASSERTV(results[NUM_DATES], SENTINEL == results[NUM_DATES]);
+
+            Util::yearsDiff(0, 0, 0, 0);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Date X(2015, 1, 5);
+            double           result;
+
+            ASSERT_PASS(Util::yearsDiff(&result, &X, &X, 1));
+            ASSERT_PASS(Util::yearsDiff(0,       0,  0,  0));
+
+            ASSERT_FAIL(Util::yearsDiff(0,       &X, &X, 1));
+            ASSERT_FAIL(Util::yearsDiff(&result, 0,  &X, 1));
+            ASSERT_FAIL(Util::yearsDiff(&result, &X, 0,  1));
+        }
+      } break;
       case 2: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
@@ -110,6 +110,46 @@ double PeriodDayCountUtil::yearsDiff(
     return numYears;
 }
 
+void PeriodDayCountUtil::yearsDiff(
+                                double                         *results,
+                                const bdlt::Date               *beginDates,
+                                const bdlt::Date               *endDates,
+                                bsl::size_t                     numDates,
+                                const bsl::vector<bdlt::Date>&  periodDate,
+                                double                          periodYearDiff,
+                                DayCountConvention::Enum        convention)
+{
+    BSLS_ASSERT(results    || 0 == numDates);
+    BSLS_ASSERT(beginDates || 0 == numDates);
+    BSLS_ASSERT(endDates   || 0 == numDates);
+    BSLS_ASSERT(periodDate.size() >= 2);
+
+    BSLS_ASSERT_SAFE(isSortedAndUnique(periodDate.begin(), periodDate.end()));
+
+#if defined(BSLS_ASSERT_IS_ACTIVE)
+    for (bsl::size_t i = 0; i < numDates; ++i) {
+        BSLS_ASSERT(periodDate.front() <= beginDates[i]);
+        BSLS_ASSERT(                      beginDates[i] <= periodDate.back());
+        BSLS_ASSERT(periodDate.front() <= endDates[i]);
+        BSLS_ASSERT(                      endDates[i]   <= periodDate.back());
+    }
+#endif
+
+    switch (convention) {
+      case DayCountConvention::e_PERIOD_ICMA_ACTUAL_ACTUAL: {
+        bbldc::PeriodIcmaActualActual::yearsDiff(results,
+                                                 beginDates,
+                                                 endDates,
+                                                 numDates,
+                                                 periodDate,
+                                                 periodYearDiff);
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
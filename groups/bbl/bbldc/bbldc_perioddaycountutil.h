@@ -66,6 +66,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bbldc_daycountconvention.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -115,6 +116,27 @@ struct PeriodDayCountUtil {
         // '|yearsDiff(b,e,pd,pyd,c) + yearsDiff(e,b,pd,pyd,c)| <= 1.0e-15' for
         // all dates 'b' and 'e', periods 'pd', and year fraction per period
         // 'pyd'.
+
+    static void yearsDiff(double                         *results,
+                          const bdlt::Date               *beginDates,
+                          const bdlt::Date               *endDates,
+                          bsl::size_t                     numDates,
+                          const bsl::vector<bdlt::Date>&  periodDate,
+                          double                          periodYearDiff,
+                          DayCountConvention::Enum        convention);
+        // Load, into each of the specified 'numDates' elements of the
+        // specified 'results' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates'
+        // and 'endDates' arrays according to the specified day-count
+        // 'convention' with periods starting on the specified 'periodDate'
+        // values and each period having a duration of the specified
+        // 'periodYearDiff' years.  Each element 'results[i]' has the value
+        // that 'yearsDiff(beginDates[i], endDates[i], periodDate,
+        // periodYearDiff, convention)' would return.  The behavior is
+        // undefined unless 'results', 'beginDates', and 'endDates' each refer
+        // to an array of at least 'numDates' elements, each pair of dates
+        // satisfies the preconditions of the single-pair 'yearsDiff', and
+        // 'isSupported(convention)'.
 };
 
 }  // close package namespace
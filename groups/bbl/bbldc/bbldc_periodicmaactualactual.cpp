@@ -37,6 +37,89 @@ static bool isSortedAndUnique(const ITER& begin, const ITER& end)
     return true;
 }
 
+typedef bsl::vector<bdlt::Date>::const_iterator PeriodIter;
+
+static inline
+double computeYearsDiff(const bdlt::Date&              beginDate,
+                        const bdlt::Date&              endDate,
+                        const bsl::vector<bdlt::Date>& periodDate,
+                        double                         periodYearDiff,
+                        PeriodIter                    *minHint,
+                        PeriodIter                    *maxHint)
+    // Return the (signed fractional) number of years between the specified
+    // 'beginDate' and 'endDate' according to the ICMA Actual/Actual day-count
+    // convention with periods starting on the specified 'periodDate' values
+    // and each period having a duration of the specified 'periodYearDiff'
+    // years.  The specified '*minHint' and '*maxHint' are either
+    // 'periodDate.end()' or the (second) period-date iterators bracketing the
+    // earlier and later dates of a previous computation; they are used to
+    // avoid a binary search when a date falls in the same period, and are
+    // updated.  The behavior is undefined unless the preconditions of
+    // 'PeriodIcmaActualActual::yearsDiff' are satisfied.
+{
+    if (beginDate == endDate) {
+        return 0.0;                                                   // RETURN
+    }
+
+    // Compute the negation flag and produce sorted dates.
+
+    bool negationFlag = beginDate > endDate;
+
+    bdlt::Date minDate;
+    bdlt::Date maxDate;
+    if (false == negationFlag) {
+        minDate = beginDate;
+        maxDate = endDate;
+    }
+    else {
+        minDate = endDate;
+        maxDate = beginDate;
+    }
+
+    // Find the period dates bracketing 'minDate', i.e., the first period date
+    // greater than 'minDate' ('upper_bound').
+
+    PeriodIter beginIter2 = *minHint;
+    if (beginIter2 == periodDate.end()
+     || !(*(beginIter2 - 1) <= minDate && minDate < *beginIter2)) {
+        beginIter2 = bsl::upper_bound(periodDate.begin(),
+                                      periodDate.end(),
+                                      minDate);
+        *minHint   = beginIter2;
+    }
+    PeriodIter beginIter1 = beginIter2 - 1;
+
+    // Find the period dates bracketing 'maxDate', i.e., the first period date
+    // not less than 'maxDate' ('lower_bound').
+
+    PeriodIter endIter2 = *maxHint;
+    if (endIter2 == periodDate.end()
+     || !(*(endIter2 - 1) < maxDate && maxDate <= *endIter2)) {
+        endIter2 = bsl::lower_bound(periodDate.begin(),
+                                    periodDate.end(),
+                                    maxDate);
+        *maxHint = endIter2;
+    }
+    PeriodIter endIter1 = endIter2 - 1;
+
+    // Compute the fractional number of periods * 'periodYearDiff'.
+
+    double result = (  static_cast<double>(*beginIter2 - minDate) /
+                                 static_cast<double>(*beginIter2 - *beginIter1)
+                     + static_cast<double>(endIter1 - beginIter2)
+                     + static_cast<double>(maxDate - *endIter1) /
+                                    static_cast<double>(*endIter2 - *endIter1))
+                    * periodYearDiff;
+
+    // Negate the value if necessary.
+
+    if (negationFlag) {
+        result = -result;
+    }
+
+    return result;
+}
+
                       // -----------------------------
                       // struct PeriodIcmaActualActual
                       // -----------------------------
@@ -56,62 +139,64 @@ double PeriodIcmaActualActual::yearsDiff(
 
     BSLS_ASSERT_SAFE(isSortedAndUnique(periodDate.begin(), periodDate.end()));
 
-    if (beginDate == endDate) {
-        return 0.0;                                                   // RETURN
-    }
+    PeriodIter minHint = periodDate.end();
+    PeriodIter maxHint = periodDate.end();
 
 #if defined(BSLS_PLATFORM_CMP_GNU) && (BSLS_PLATFORM_CMP_VERSION >= 50301)
     // Storing the result value in a 'volatile double' removes extra-precision
     // available in floating-point registers.
 
-    volatile double result;
+    const volatile double result =
 #else
-    double result;
+    const double result =
 #endif
+                                   computeYearsDiff(beginDate,
+                                                    endDate,
+                                                    periodDate,
+                                                    periodYearDiff,
+                                                    &minHint,
+                                                    &maxHint);
 
-    // Compute the negation flag and produce sorted dates.
-
-    bool negationFlag = beginDate > endDate;
-
-    bdlt::Date minDate;
-    bdlt::Date maxDate;
-    if (false == negationFlag) {
-        minDate = beginDate;
-        maxDate = endDate;
-    }
-    else {
-        minDate = endDate;
-        maxDate = beginDate;
-    }
-
-    // Find the period dates bracketing 'minDate'.
+    return result;
+}
 
-    bsl::vector<bdlt::Date>::const_iterator beginIter2 =
-               bsl::upper_bound(periodDate.begin(), periodDate.end(), minDate);
-    bsl::vector<bdlt::Date>::const_iterator beginIter1 = beginIter2 - 1;
+void PeriodIcmaActualActual::yearsDiff(
+                                double                         *results,
+                                const bdlt::Date               *beginDates,
+                                const bdlt::Date               *endDates,
+                                bsl::size_t                     numDates,
+                                const bsl::vector<bdlt::Date>&  periodDate,
+                                double                          periodYearDiff)
+{
+    BSLS_ASSERT(results    || 0 == numDates);
+    BSLS_ASSERT(beginDates || 0 == numDates);
+    BSLS_ASSERT(endDates   || 0 == numDates);
+    BSLS_ASSERT(periodDate.size() >= 2);
 
-    // Find the period dates bracketing 'maxDate'.
+    // The period dates are validated once per batch rather than once per
+    // pair.
 
-    bsl::vector<bdlt::Date>::const_iterator endIter2 =
-               bsl::lower_bound(periodDate.begin(), periodDate.end(), maxDate);
-    bsl::vector<bdlt::Date>::const_iterator endIter1 = endIter2 - 1;
+    BSLS_ASSERT_SAFE(isSortedAndUnique(periodDate.begin(), periodDate.end()));
 
-    // Compute the fractional number of periods * 'periodYearDiff'.
+    PeriodIter minHint = periodDate.end();
+    PeriodIter maxHint = periodDate.end();
 
-    result = (  static_cast<double>(*beginIter2 - minDate) /
-                                 static_cast<double>(*beginIter2 - *beginIter1)
-              + static_cast<double>(endIter1 - beginIter2)
-              + static_cast<double>(maxDate - *endIter1) /
-                                    static_cast<double>(*endIter2 - *endIter1))
-             * periodYearDiff;
+    for (bsl::size_t i = 0; i < numDates; ++i) {
+        BSLS_ASSERT(periodDate.front() <= beginDates[i]);
+        BSLS_ASSERT(                      beginDates[i] <= periodDate.back());
+        BSLS_ASSERT(periodDate.front() <= endDates[i]);
+        BSLS_ASSERT(                      endDates[i]   <= periodDate.back());
 
-    // Negate the value if necessary.
+        // Note that storing each result to memory removes any extra
+        // precision, as the 'volatile' does for the single-pair 'yearsDiff'.
 
-    if (negationFlag) {
-        result = -result;
+        results[i] = computeYearsDiff(beginDates[i],
+                                      endDates[i],
+                                      periodDate,
+                                      periodYearDiff,
+                                      &minHint,
+                                      &maxHint);
     }
-
-    return result;
 }
 
 }  // close package namespace
@@ -63,6 +63,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlt_date.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -105,6 +106,28 @@ struct PeriodIcmaActualActual {
         // '|yearsDiff(b, e, pd, pyd) + yearsDiff(e, b, pd, pyd)| <= 1.0e-15'
         // for all dates 'b' and 'e', periods 'pd', and year fraction per
         // period 'pyd'.
+
+    static void yearsDiff(double                         *results,
+                          const bdlt::Date               *beginDates,
+                          const bdlt::Date               *endDates,
+                          bsl::size_t                     numDates,
+                          const bsl::vector<bdlt::Date>&  periodDate,
+                          double                          periodYearDiff);
+        // Load, into each of the specified 'numDates' elements of the
+        // specified 'results' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates'
+        // and 'endDates' arrays according to the ICMA Actual/Actual day-count
+        // convention with periods starting on the specified 'periodDate'
+        // values and each period having a duration of the specified
+        // 'periodYearDiff' years.  Each element 'results[i]' has the value
+        // that 'yearsDiff(beginDates[i], endDates[i], periodDate,
+        // periodYearDiff)' would return.  The behavior is undefined unless
+        // 'results', 'beginDates', and 'endDates' each refer to an array of at
+        // least 'numDates' elements, and each pair of dates satisfies the
+        // preconditions of the single-pair 'yearsDiff'.  Note that the period
+        // bracketing a date is found by binary search only when it differs
+        // from the one bracketing the corresponding date of the previous
+        // pair, so batches ordered by date are processed most efficiently.
 };
 
 // ============================================================================
@@ -10,6 +10,7 @@
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_algorithm.h>
 #include <bsl_vector.h>
 
 using namespace BloombergLP;
@@ -27,8 +28,9 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] int daysDiff(const bdlt::Date& bD, const bdlt::Date& eD);
 // [ 2] double yearsDiff(bD, eD, pD, pYD);
+// [ 3] void yearsDiff(double *r, const Date *bD, *eD, n, pD, pYD);
 // ----------------------------------------------------------------------------
-// [ 3] USAGE EXAMPLE
+// [ 4] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -105,7 +107,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -161,6 +163,176 @@ int main(int argc, char *argv[])
     ASSERT(yearsDiff > 0.1983 && yearsDiff < 0.1985);
 //..
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'yearsDiff'
+        //   Verify the batch method computes the same values as the
+        //   single-pair method.
+        //
+        // Concerns:
+        //: 1 Each element loaded by the batch 'yearsDiff' is identical (not
+        //:   merely close) to the value returned by the single-pair
+        //:   'yearsDiff' for the corresponding pair of dates.
+        //:
+        //: 2 The method supports pairs in either order, equal dates, and
+        //:   dates spanning leap years and distant years.
+        //:
+        //: 3 No element beyond the first 'numDates' elements of 'results' is
+        //:   modified.
+        //:
+        //: 4 A batch of zero pairs may be supplied null array addresses.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Form a set of date pairs from a table of begin dates and a table
+        //:   of day offsets, apply the batch method, and compare each
+        //:   element to the single-pair result using '=='.  (C-1..2)
+        //:
+        //: 2 Place a sentinel value after the last element of 'results' and
+        //:   verify it is unchanged.  (C-3)
+        //:
+        //: 3 Invoke the method with 'numDates == 0' and null arrays.  (C-4)
+        //:
+        //: 4 Verify defensive checks are triggered for null arrays having a
+        //:   non-zero 'numDates'.  (C-5)
+        //
+        // Testing:
+        //   void yearsDiff(double *r, const Date *bD, *eD, n, pD, pYD);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH 'yearsDiff'" << endl
+                          << "=========================" << endl;
+
+        // Quarterly periods from 1999-11-15 through 2010-11-15.
+
+        bsl::vector<bdlt::Date>        mP;
+        const bsl::vector<bdlt::Date>& P = mP;
+        for (int year = 1999; year <= 2010; ++year) {
+            for (int month = 2; month <= 11; month += 3) {
+                if (1999 == year && 11 != month) {
+                    continue;
+                }
+                mP.push_back(bdlt::Date(year, month, 15));
+            }
+        }
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+
+        // Pairs are formed so that consecutive pairs often (but not always)
+        // fall in the same periods.
+
+        static const int OFFSET[] = {
+            0, 1, -1, 17, -45, 89, 92, -92, 365, -366, 1000, -3000
+        };
+        const int NUM_OFFSET = sizeof OFFSET / sizeof *OFFSET;
+
+        for (bdlt::Date d = P.front(); d <= P.back(); d += 13) {
+            for (int oi = 0; oi < NUM_OFFSET; ++oi) {
+                const bdlt::Date E = d + OFFSET[oi];
+                if (P.front() <= E && E <= P.back()) {
+                    beginDates.push_back(d);
+                    endDates.push_back(E);
+                }
+            }
+        }
+        for (bsl::size_t i = 0; i < P.size(); ++i) {
+            beginDates.push_back(P[i]);
+            endDates.push_back(P[P.size() - 1 - i]);
+        }
+
+        const bsl::size_t NUM_DATES = beginDates.size();
+        const double      SENTINEL  = -12345.0;
+
+        if (veryVerbose) { T_ P_(P.size()) P(NUM_DATES); }
+
+        for (int ri = 0; ri < 2; ++ri) {
+            // Apply the batch in the generated order and in reverse order.
+
+            if (1 == ri) {
+                bsl::reverse(beginDates.begin(), beginDates.end());
+                bsl::reverse(endDates.begin(), endDates.end());
+            }
+
+            bsl::vector<double> results(NUM_DATES + 1, SENTINEL);
+
+            Util::yearsDiff(results.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            NUM_DATES,
+                            P,
+                            0.25);
+
+            for (bsl::size_t i = 0; i < NUM_DATES; ++i) {
+                const bdlt::Date& X = beginDates[i];
+                const bdlt::Date& Y = endDates[i];
+
+                const double EXP = Util::yearsDiff(X, Y, P, 0.25);
+
+                ASSERTV(ri, X, Y, EXP, results[i], EXP == results[i]);
+            }
+            ASSERTV(results[NUM_DATES], SENTINEL == results[NUM_DATES]);
+
+            Util::yearsDiff(0, 0, 0, 0, P, 0.25);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<bdlt::Date>        mA;
+            const bsl::vector<bdlt::Date>& A = mA;
+            {
+                mA.push_back(bdlt::Date(2015, 1, 5));
+                mA.push_back(bdlt::Date(2015, 2, 5));
+                mA.push_back(bdlt::Date(2015, 3, 5));
+            }
+
+            // 'periodDate' not sorted
+
+            bsl::vector<bdlt::Date>        mE1;
+            const bsl::vector<bdlt::Date>& E1 = mE1;
+            {
+                mE1.push_back(bdlt::Date(2015, 1, 5));
+                mE1.push_back(bdlt::Date(2015, 3, 5));
+                mE1.push_back(bdlt::Date(2015, 2, 5));
+            }
+
+            // 'periodDate' with one value
+
+            bsl::vector<bdlt::Date>        mE2;
+            const bsl::vector<bdlt::Date>& E2 = mE2;
+            {
+                mE2.push_back(bdlt::Date(2015, 1, 5));
+            }
+
+            const bdlt::Date X(2015, 1, 5);
+            const bdlt::Date Y(2015, 3, 5);
+            const bdlt::Date LO(2015, 1, 4);
+            const bdlt::Date HI(2015, 3, 6);
+            double           result;
+
+            ASSERT_PASS(Util::yearsDiff(&result, &X, &Y, 1, A, 1.0));
+            ASSERT_PASS(Util::yearsDiff(0,       0,  0,  0, A, 1.0));
+
+            ASSERT_FAIL(Util::yearsDiff(0,       &X, &Y, 1, A, 1.0));
+            ASSERT_FAIL(Util::yearsDiff(&result, 0,  &Y, 1, A, 1.0));
+            ASSERT_FAIL(Util::yearsDiff(&result, &X, 0,  1, A, 1.0));
+
+            ASSERT_FAIL(Util::yearsDiff(&result, &X, &Y, 1, E2, 1.0));
+            ASSERT_FAIL(Util::yearsDiff(0,       0,  0,  0, E2, 1.0));
+
+            ASSERT_FAIL(Util::yearsDiff(&result, &LO, &Y,  1, A, 1.0));
+            ASSERT_FAIL(Util::yearsDiff(&result, &X, &HI,  1, A, 1.0));
+            ASSERT_FAIL(Util::yearsDiff(&result, &HI, &X,  1, A, 1.0));
+            ASSERT_FAIL(Util::yearsDiff(&result, &Y, &LO,  1, A, 1.0));
+
+            ASSERT_SAFE_FAIL(Util::yearsDiff(&result, &X, &Y, 1, E1, 1.0));
+            ASSERT_SAFE_FAIL(Util::yearsDiff(0,       0,  0,  0, E1, 1.0));
+        }
+      } break;
       case 2: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
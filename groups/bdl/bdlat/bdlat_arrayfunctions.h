@@ -41,7 +41,10 @@ BSLS_IDENT("$Id: $")
 // The 'ElementType' meta-function contains a typedef 'Type' that specifies the
 // type of element stored in the parameterized "array" type.
 //
-// This component specializes all of these functions for 'bsl::vector<TYPE>'.
+// This component specializes all of these functions for 'bsl::vector<TYPE>'
+// and for 'bsl::small_vector<TYPE, N>', so that a generated type may hold
+// a short sequence in a 'small_vector' (avoiding an allocation per object
+// for the typical length) without further adaptation.
 //
 // Custom types can be plugged into the 'bdlat' framework.  This is done by
 // overloading the 'bdlat_array*' functions inside the namespace of the plugged
@@ -283,6 +286,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
+#include <bsl_small_vector.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -293,7 +297,8 @@ namespace BloombergLP {
 
 namespace bdlat_ArrayFunctions {
     // This 'namespace' provides functions that expose "array" behavior for
-    // "array" types.  Specializations are provided for 'bsl::vector<TYPE>'.
+    // "array" types.  Specializations are provided for 'bsl::vector<TYPE>'
+    // and 'bsl::small_vector<TYPE, N>'.
     // See the component-level documentation for more information.
 
     // META-FUNCTIONS
@@ -435,6 +440,54 @@ namespace bdlat_ArrayFunctions {
     template <class TYPE, class ALLOC>
     bsl::size_t bdlat_arraySize(const bsl::vector<TYPE, ALLOC>& array);
 
+}  // close namespace bdlat_ArrayFunctions
+
+                     // =================================
+                     // bsl::small_vector specializations
+                     // =================================
+
+namespace bdlat_ArrayFunctions {
+
+    // META-FUNCTIONS
+    template <class TYPE, bsl::size_t INLINE_CAPACITY, class ALLOC>
+    struct IsArray<bsl::small_vector<TYPE, INLINE_CAPACITY, ALLOC> >
+    : bslmf::MetaInt<1> {
+    };
+
+    template <class TYPE, bsl::size_t INLINE_CAPACITY, class ALLOC>
+    struct ElementType<bsl::small_vector<TYPE, INLINE_CAPACITY, ALLOC> > {
+        typedef TYPE Type;
+    };
+
+    // MANIPULATORS
+    template <class TYPE,
+              bsl::size_t INLINE_CAPACITY,
+              class ALLOC,
+              class MANIPULATOR>
+    int bdlat_arrayManipulateElement(
+                  bsl::small_vector<TYPE, INLINE_CAPACITY, ALLOC> *array,
+                  MANIPULATOR&                                     manipulator,
+                  int                                              index);
+
+    template <class TYPE, bsl::size_t INLINE_CAPACITY, class ALLOC>
+    void bdlat_arrayResize(
+                     bsl::small_vector<TYPE, INLINE_CAPACITY, ALLOC> *array,
+                     int                                              newSize);
+
+    // ACCESSORS
+    template <class TYPE,
+              bsl::size_t INLINE_CAPACITY,
+              class ALLOC,
+              class ACCESSOR>
+    int bdlat_arrayAccessElement(
+               const bsl::small_vector<TYPE, INLINE_CAPACITY, ALLOC>& array,
+               ACCESSOR&                                              accessor,
+               int                                                    index);
+
+    template <class TYPE, bsl::size_t INLINE_CAPACITY, class ALLOC>
+    bsl::size_t bdlat_arraySize(
+                 const bsl::small_vector<TYPE, INLINE_CAPACITY, ALLOC>& array);
+
 }  // close namespace bdlat_ArrayFunctions
 
 // ============================================================================
@@ -527,6 +580,58 @@ bsl::size_t bdlat_ArrayFunctions::bdlat_arraySize(
     return array.size();
 }
 
+                     // ---------------------------------
+                     // bsl::small_vector specializations
+                     // ---------------------------------
+
+// MANIPULATORS
+
+template <class TYPE,
+          bsl::size_t INLINE_CAPACITY,
+          class ALLOC,
+          class MANIPULATOR>
+inline
+int bdlat_ArrayFunctions::bdlat_arrayManipulateElement(
+                  bsl::small_vector<TYPE, INLINE_CAPACITY, ALLOC> *array,
+                  MANIPULATOR&                                     manipulator,
+                  int                                              index)
+{
+    TYPE& element = (*array)[index];
+    return manipulator(&element);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY, class ALLOC>
+inline
+void bdlat_ArrayFunctions::bdlat_arrayResize(
+                     bsl::small_vector<TYPE, INLINE_CAPACITY, ALLOC> *array,
+                     int                                              newSize)
+{
+    array->resize(newSize);
+}
+
+// ACCESSORS
+
+template <class TYPE,
+          bsl::size_t INLINE_CAPACITY,
+          class ALLOC,
+          class ACCESSOR>
+inline
+int bdlat_ArrayFunctions::bdlat_arrayAccessElement(
+               const bsl::small_vector<TYPE, INLINE_CAPACITY, ALLOC>& array,
+               ACCESSOR&                                              accessor,
+               int                                                    index)
+{
+    return accessor(array[index]);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY, class ALLOC>
+inline
+bsl::size_t bdlat_ArrayFunctions::bdlat_arraySize(
+                  const bsl::small_vector<TYPE, INLINE_CAPACITY, ALLOC>& array)
+{
+    return array.size();
+}
+
 }  // close enterprise namespace
 
 #endif
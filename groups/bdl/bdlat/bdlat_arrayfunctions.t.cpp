@@ -22,6 +22,7 @@
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
+#include <bsl_small_vector.h>
 #include <bsl_vector.h>
 
 using namespace BloombergLP;
@@ -516,6 +517,11 @@ int main(int argc, char *argv[])
         ASSERT(1 == bdlat_ArrayFunctions::IsArray<bsl::vector<int> >::VALUE);
         ASSERT(1 == (bslmf::IsSame<VecElementType, int>::VALUE));
 
+        typedef bsl::small_vector<int, 4>                SmallVec;
+        typedef Obj::ElementType<SmallVec>::Type         SmallVecElementType;
+        ASSERT(1 == bdlat_ArrayFunctions::IsArray<SmallVec>::VALUE);
+        ASSERT(1 == (bslmf::IsSame<SmallVecElementType, int>::VALUE));
+
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -613,6 +619,41 @@ int main(int argc, char *argv[])
             ASSERT(0 == Obj::size(V));
         }
 
+        {
+            if (verbose) cout << "Testing small_vector specialization"
+                              << endl;
+            typedef bsl::small_vector<int, 4> SmallVec;
+
+            SmallVec mV;  const SmallVec& V = mV;
+            mV.push_back(66);
+            mV.push_back(77);
+
+            ASSERT(2 == Obj::size(V));
+
+            int              value;
+            GetValue<int>    getter(&value);
+            AssignValue<int> setter1(33);
+            AssignValue<int> setter2(44);
+
+            Obj::accessElement(V, getter, 0); ASSERT(66 == value);
+            Obj::accessElement(V, getter, 1); ASSERT(77 == value);
+
+            Obj::manipulateElement(&mV, setter1, 0);
+            Obj::manipulateElement(&mV, setter2, 1);
+
+            Obj::accessElement(V, getter, 0); ASSERT(33 == value);
+            Obj::accessElement(V, getter, 1); ASSERT(44 == value);
+
+            Obj::resize(&mV, 6);  // beyond the inline capacity
+            ASSERT(6 == Obj::size(V));
+            Obj::accessElement(V, getter, 0); ASSERT(33 == value);
+            Obj::accessElement(V, getter, 1); ASSERT(44 == value);
+            Obj::accessElement(V, getter, 5); ASSERT( 0 == value);
+
+            Obj::resize(&mV, 0);
+            ASSERT(0 == Obj::size(V));
+        }
+
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -38,6 +38,7 @@ BSLS_IDENT("$Id: $")
 //      o any type with the 'bdlat_TypeTraitBasicCustomizedType' trait
 //      o types instantiated from the 'bdlb::NullableValue' template
 //      o types instantiated from the 'bsl::vector' template
+//      o types instantiated from the 'bsl::small_vector' template
 //      o types instantiated from the 'bsl::basic_string' template
 //..
 // Third-party types may overload the 'bdlat_valueTypeReset' function to
@@ -102,6 +103,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_platform.h>
 
+#include <bsl_small_vector.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
 
@@ -253,6 +255,10 @@ struct bdlat_ValueTypeFunctions_Imp {
     template <class TYPE, class ALLOC>
     static void reset(bsl::vector<TYPE, ALLOC> *object);
 
+    template <class TYPE, bsl::size_t INLINE_CAPACITY, class ALLOC>
+    static void reset(
+                   bsl::small_vector<TYPE, INLINE_CAPACITY, ALLOC> *object);
+
     template <class CHAR_T, class CHAR_TRAITS, class ALLOC>
     static void reset(bsl::basic_string<CHAR_T, CHAR_TRAITS, ALLOC> *object);
 
@@ -529,6 +535,14 @@ void bdlat_ValueTypeFunctions_Imp::reset(bsl::vector<TYPE, ALLOC> *object)
     object->clear();
 }
 
+template <class TYPE, bsl::size_t INLINE_CAPACITY, class ALLOC>
+inline
+void bdlat_ValueTypeFunctions_Imp::reset(
+                      bsl::small_vector<TYPE, INLINE_CAPACITY, ALLOC> *object)
+{
+    object->clear();
+}
+
 template <class CHAR_T, class CHAR_TRAITS, class ALLOC>
 inline
 void bdlat_ValueTypeFunctions_Imp::reset(
@@ -0,0 +1,251 @@
+// bdlb_bitstringrankindex.cpp                                        -*-C++-*-
+#include <bdlb_bitstringrankindex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlb_bitstringrankindex_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitmaskutil.h>
+
+#include <bsl_algorithm.h>
+
+namespace BloombergLP {
+namespace bdlb {
+
+namespace {
+
+enum {
+    k_BITS_PER_WORD   = BitStringUtil::k_BITS_PER_UINT64,
+    k_WORDS_PER_BLOCK = 8
+};
+
+}  // close unnamed namespace
+
+                         // ------------------------
+                         // class BitStringRankIndex
+                         // ------------------------
+
+// PUBLIC CLASS DATA
+const bsl::size_t BitStringRankIndex::k_INVALID_INDEX;
+const bsl::size_t BitStringRankIndex::k_BITS_PER_BLOCK;
+const bsl::size_t BitStringRankIndex::k_SAMPLE_INTERVAL;
+
+// CREATORS
+BitStringRankIndex::BitStringRankIndex(bslma::Allocator *basicAllocator)
+: d_bitString_p(0)
+, d_length(0)
+, d_num1(0)
+, d_counts(2, 0, basicAllocator)
+, d_selectSamples0(basicAllocator)
+, d_selectSamples1(basicAllocator)
+{
+}
+
+BitStringRankIndex::BitStringRankIndex(const bsl::uint64_t *bitString,
+                                       bsl::size_t          length,
+                                       bslma::Allocator    *basicAllocator)
+: d_bitString_p(0)
+, d_length(0)
+, d_num1(0)
+, d_counts(2, 0, basicAllocator)
+, d_selectSamples0(basicAllocator)
+, d_selectSamples1(basicAllocator)
+{
+    reset(bitString, length);
+}
+
+// MANIPULATORS
+void BitStringRankIndex::reset(const bsl::uint64_t *bitString,
+                               bsl::size_t          length)
+{
+    BSLS_ASSERT(bitString || 0 == length);
+
+    // Build the new index in temporaries so that this object is unchanged if
+    // an allocation fails.
+
+    const bsl::size_t numWords  = (length + k_BITS_PER_WORD - 1) /
+                                                               k_BITS_PER_WORD;
+    const bsl::size_t numBlocks = numWords / k_WORDS_PER_BLOCK + 1;
+
+    bsl::vector<bsl::uint64_t> counts(2 * numBlocks, 0, allocator());
+    bsl::vector<bsl::size_t>   samples0(allocator());
+    bsl::vector<bsl::size_t>   samples1(allocator());
+
+    samples0.reserve(length / k_SAMPLE_INTERVAL + 1);
+    samples1.reserve(length / k_SAMPLE_INTERVAL + 1);
+
+    const int lastBits = static_cast<int>((length + k_BITS_PER_WORD - 1) %
+                                                         k_BITS_PER_WORD) + 1;
+
+    bsl::size_t ones        = 0;
+    bsl::size_t nextSample0 = 1;
+    bsl::size_t nextSample1 = 1;
+
+    for (bsl::size_t block = 0; block < numBlocks; ++block) {
+        const bsl::size_t firstWord = block * k_WORDS_PER_BLOCK;
+
+        bsl::uint64_t packed  = 0;
+        bsl::uint64_t inBlock = 0;
+
+        for (int jj = 0; jj < k_WORDS_PER_BLOCK; ++jj) {
+            const bsl::size_t wordIndex = firstWord + jj;
+
+            if (jj) {
+                packed |= inBlock << (9 * (jj - 1));
+            }
+            if (wordIndex < numWords) {
+                bsl::uint64_t word = bitString[wordIndex];
+                if (wordIndex + 1 == numWords) {
+                    word &= BitMaskUtil::lt64(lastBits);
+                }
+                inBlock += BitUtil::numBitsSet(word);
+            }
+        }
+
+        counts[2 * block]     = ones;
+        counts[2 * block + 1] = packed;
+
+        ones += static_cast<bsl::size_t>(inBlock);
+
+        const bsl::size_t end   = bsl::min((block + 1) * k_BITS_PER_BLOCK,
+                                           length);
+        const bsl::size_t zeros = end - ones;
+
+        for (; nextSample1 <= ones; nextSample1 += k_SAMPLE_INTERVAL) {
+            samples1.push_back(block);
+        }
+        for (; nextSample0 <= zeros; nextSample0 += k_SAMPLE_INTERVAL) {
+            samples0.push_back(block);
+        }
+    }
+
+    d_counts.swap(counts);
+    d_selectSamples0.swap(samples0);
+    d_selectSamples1.swap(samples1);
+
+    d_bitString_p = bitString;
+    d_length      = length;
+    d_num1        = ones;
+}
+
+// ACCESSORS
+bsl::size_t BitStringRankIndex::select0(bsl::size_t n) const
+{
+    BSLS_ASSERT(0 < n);
+
+    if (n > num0()) {
+        return k_INVALID_INDEX;                                       // RETURN
+    }
+
+    // Find the last block having fewer than 'n' 0 bits before it, among the
+    // blocks between the samples bracketing the 'n'th 0 bit.
+
+    const bsl::size_t sample = (n - 1) / k_SAMPLE_INTERVAL;
+
+    bsl::size_t lo = d_selectSamples0[sample];
+    bsl::size_t hi = sample + 1 < d_selectSamples0.size()
+                   ? d_selectSamples0[sample + 1]
+                   : d_counts.size() / 2 - 1;
+
+    while (lo < hi) {
+        const bsl::size_t mid = lo + (hi - lo + 1) / 2;
+
+        if (mid * k_BITS_PER_BLOCK - d_counts[2 * mid] < n) {
+            lo = mid;
+        }
+        else {
+            hi = mid - 1;
+        }
+    }
+
+    // Find the last word of that block having fewer than 'n' 0 bits before
+    // it.
+
+    bsl::size_t wordIndex = lo * k_WORDS_PER_BLOCK;
+    for (int jj = 1; jj < k_WORDS_PER_BLOCK; ++jj) {
+        const bsl::size_t next = wordIndex + 1;
+
+        if (next * k_BITS_PER_WORD - num1BeforeWord(next) >= n) {
+            break;
+        }
+        wordIndex = next;
+    }
+
+    const bsl::size_t begin = wordIndex * k_BITS_PER_WORD;
+
+    return BitStringUtil::find0AtNthMinIndex(
+                          d_bitString_p,
+                          begin,
+                          bsl::min(begin + k_BITS_PER_WORD, d_length),
+                          n - (begin - num1BeforeWord(wordIndex)));
+}
+
+bsl::size_t BitStringRankIndex::select1(bsl::size_t n) const
+{
+    BSLS_ASSERT(0 < n);
+
+    if (n > d_num1) {
+        return k_INVALID_INDEX;                                       // RETURN
+    }
+
+    // Find the last block having fewer than 'n' 1 bits before it, among the
+    // blocks between the samples bracketing the 'n'th 1 bit.
+
+    const bsl::size_t sample = (n - 1) / k_SAMPLE_INTERVAL;
+
+    bsl::size_t lo = d_selectSamples1[sample];
+    bsl::size_t hi = sample + 1 < d_selectSamples1.size()
+                   ? d_selectSamples1[sample + 1]
+                   : d_counts.size() / 2 - 1;
+
+    while (lo < hi) {
+        const bsl::size_t mid = lo + (hi - lo + 1) / 2;
+
+        if (d_counts[2 * mid] < n) {
+            lo = mid;
+        }
+        else {
+            hi = mid - 1;
+        }
+    }
+
+    // Find the last word of that block having fewer than 'n' 1 bits before
+    // it.
+
+    bsl::size_t wordIndex = lo * k_WORDS_PER_BLOCK;
+    for (int jj = 1; jj < k_WORDS_PER_BLOCK; ++jj) {
+        const bsl::size_t next = wordIndex + 1;
+
+        if (num1BeforeWord(next) >= n) {
+            break;
+        }
+        wordIndex = next;
+    }
+
+    const bsl::size_t begin = wordIndex * k_BITS_PER_WORD;
+
+    return BitStringUtil::find1AtNthMinIndex(
+                                  d_bitString_p,
+                                  begin,
+                                  bsl::min(begin + k_BITS_PER_WORD, d_length),
+                                  n - num1BeforeWord(wordIndex));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
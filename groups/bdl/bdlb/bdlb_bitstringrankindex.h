@@ -0,0 +1,343 @@
+// bdlb_bitstringrankindex.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLB_BITSTRINGRANKINDEX
+#define INCLUDED_BDLB_BITSTRINGRANKINDEX
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an index for fast rank and select queries on a bit string.
+//
+//@CLASSES:
+//  bdlb::BitStringRankIndex: rank/select index over a read-only bit string
+//
+//@SEE_ALSO: bdlb_bitstringutil, bdlc_bitarray
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdlb::BitStringRankIndex', that augments a bit string (see
+// 'bdlb_bitstringutil') with a small auxiliary index supporting two queries
+// that are otherwise linear in the length of the bit string:
+//..
+//  rank1(index) - the number of 1 bits in positions '[0 .. index)'
+//  select1(n)   - the position of the 'n'th 1 bit (counting from 1)
+//..
+// and the corresponding 'rank0' and 'select0' queries for 0 bits.  'rank0'
+// and 'rank1' take constant time; 'select0' and 'select1' take time
+// logarithmic in the distance between sampled positions (see below), which is
+// bounded by a constant.
+//
+// The index refers to, but does not own, the bit string: the bit string must
+// outlive the index, and must not be modified while the index is in use.  If
+// the bit string is modified, 'reset' must be called to rebuild the index.
+//
+///Index Layout
+///------------
+// The bit string is divided into blocks of 512 bits (eight 64-bit words).  For
+// each block, the index stores two words: the number of 1 bits preceding the
+// block, and seven 9-bit counts of the 1 bits preceding each of words 1
+// through 7 of the block relative to the start of the block.  This layout,
+// sometimes called "rank9", costs 25% of the size of the bit string, and
+// answers 'rank1' with two index reads and one population count.  In
+// addition, the position of every 4096th 0 and 1 bit is sampled, so that
+// 'select0' and 'select1' need binary search only among the blocks between
+// adjacent samples, followed by a scan of the in-block counts and a search
+// within a single word.  The sample arrays take at most 1/32 of the size of
+// the bit string each.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Mapping Between a Sparse and a Dense Index
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain data for a small subset of a large range of identifiers,
+// and record which identifiers are present in a bit string.  The data for the
+// present identifiers is stored contiguously, in increasing order of
+// identifier.  A rank index lets us map an identifier to the position of its
+// data, and a position back to the identifier.
+//
+// First, we create a bit string with room for 2000 identifiers, and mark the
+// identifiers that are multiples of 7 as being present:
+//..
+//  enum { k_NUM_IDS = 2000 };
+//
+//  bsl::uint64_t present[(k_NUM_IDS + 63) / 64] = { 0 };
+//
+//  for (bsl::size_t id = 0; id < k_NUM_IDS; id += 7) {
+//      bdlb::BitStringUtil::assign1(present, id);
+//  }
+//..
+// Then, we build an index over the bit string:
+//..
+//  bdlb::BitStringRankIndex index(present, k_NUM_IDS);
+//
+//  assert(286 == index.num1());
+//..
+// Now, we find the position of the data for identifier 700, which is the
+// number of present identifiers less than 700:
+//..
+//  assert(bdlb::BitStringUtil::bit(present, 700));
+//  assert(100 == index.rank1(700));
+//..
+// Finally, we find the identifier whose data is at position 100, which is that
+// of the 101st present identifier:
+//..
+//  assert(700 == index.select1(101));
+//  assert(bdlb::BitStringRankIndex::k_INVALID_INDEX == index.select1(287));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitstringutil.h>
+#include <bdlb_bitutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlb {
+
+                         // ========================
+                         // class BitStringRankIndex
+                         // ========================
+
+class BitStringRankIndex {
+    // This mechanism class provides constant-time rank and fast select
+    // queries on a bit string that it refers to but does not own.  See
+    // {Index Layout} for details of the representation.
+
+  public:
+    // PUBLIC CLASS DATA
+    static const bsl::size_t k_INVALID_INDEX = BitStringUtil::k_INVALID_INDEX;
+                                              // returned by 'select0' and
+                                              // 'select1' if there is no such
+                                              // bit
+
+    static const bsl::size_t k_BITS_PER_BLOCK = 512;
+                                              // number of bits covered by
+                                              // each pair of index words
+
+    static const bsl::size_t k_SAMPLE_INTERVAL = 4096;
+                                              // number of 0 or 1 bits between
+                                              // sampled positions
+
+  private:
+    // DATA
+    const bsl::uint64_t        *d_bitString_p;     // indexed bit string (held,
+                                                   // not owned)
+
+    bsl::size_t                 d_length;          // number of bits indexed
+
+    bsl::size_t                 d_num1;            // number of 1 bits in
+                                                   // '[0 .. d_length)'
+
+    bsl::vector<bsl::uint64_t>  d_counts;          // two words per block: the
+                                                   // 1 bits before the block,
+                                                   // then seven packed 9-bit
+                                                   // in-block counts
+
+    bsl::vector<bsl::size_t>    d_selectSamples0;  // block holding each
+                                                   // 'k_SAMPLE_INTERVAL'th 0
+
+    bsl::vector<bsl::size_t>    d_selectSamples1;  // block holding each
+                                                   // 'k_SAMPLE_INTERVAL'th 1
+
+  private:
+    // NOT IMPLEMENTED
+    BitStringRankIndex(const BitStringRankIndex&);
+    BitStringRankIndex& operator=(const BitStringRankIndex&);
+
+    // PRIVATE ACCESSORS
+    bsl::size_t num1BeforeWord(bsl::size_t wordIndex) const;
+        // Return the number of 1 bits in the words of the indexed bit string
+        // preceding the word at the specified 'wordIndex'.  The behavior is
+        // undefined unless 'wordIndex' is less than the number of blocks
+        // times 8.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BitStringRankIndex,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit BitStringRankIndex(bslma::Allocator *basicAllocator = 0);
+        // Create an index over an empty bit string.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    BitStringRankIndex(const bsl::uint64_t *bitString,
+                       bsl::size_t          length,
+                       bslma::Allocator    *basicAllocator = 0);
+        // Create an index over the first specified 'length' bits of the
+        // specified 'bitString'.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'bitString' has a length of at least 'length', and 'bitString' is
+        // not modified, and outlives this object, while this object indexes
+        // it.
+
+    //! ~BitStringRankIndex() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void reset(const bsl::uint64_t *bitString, bsl::size_t length);
+        // Rebuild this index over the first specified 'length' bits of the
+        // specified 'bitString'.  The behavior is undefined unless 'bitString'
+        // has a length of at least 'length', and 'bitString' is not modified,
+        // and outlives this object, while this object indexes it.  Note that
+        // 'reset' must be called after modifying the indexed bit string.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+
+    const bsl::uint64_t *bitString() const;
+        // Return the address of the indexed bit string, or 0 if this object
+        // was created without one.
+
+    bsl::size_t length() const;
+        // Return the number of bits indexed.
+
+    bsl::size_t num0() const;
+        // Return the number of 0 bits in the indexed bit string.
+
+    bsl::size_t num1() const;
+        // Return the number of 1 bits in the indexed bit string.
+
+    bsl::size_t rank0(bsl::size_t index) const;
+        // Return the number of 0 bits in the indexed bit string at positions
+        // less than the specified 'index'.  The behavior is undefined unless
+        // 'index <= length()'.
+
+    bsl::size_t rank1(bsl::size_t index) const;
+        // Return the number of 1 bits in the indexed bit string at positions
+        // less than the specified 'index'.  The behavior is undefined unless
+        // 'index <= length()'.
+
+    bsl::size_t select0(bsl::size_t n) const;
+        // Return the position of the specified 'n'th 0 bit, counting from 1,
+        // in the indexed bit string if there are at least 'n' 0 bits, and
+        // 'k_INVALID_INDEX' otherwise.  The behavior is undefined unless
+        // '0 < n'.  Note that 'rank0(select0(n)) == n - 1' for every valid
+        // result.
+
+    bsl::size_t select1(bsl::size_t n) const;
+        // Return the position of the specified 'n'th 1 bit, counting from 1,
+        // in the indexed bit string if there are at least 'n' 1 bits, and
+        // 'k_INVALID_INDEX' otherwise.  The behavior is undefined unless
+        // '0 < n'.  Note that 'rank1(select1(n)) == n - 1' for every valid
+        // result.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class BitStringRankIndex
+                         // ------------------------
+
+// PRIVATE ACCESSORS
+inline
+bsl::size_t BitStringRankIndex::num1BeforeWord(bsl::size_t wordIndex) const
+{
+    const bsl::size_t block = wordIndex / 8;
+    const unsigned    word  = static_cast<unsigned>(wordIndex % 8);
+
+    BSLS_ASSERT(2 * block + 1 < d_counts.size());
+
+    // The count for word 'j' of the block, for 'j' in '[1 .. 7]', is stored at
+    // bit '9 * (j - 1)'; the count for word 0 is implicitly 0.
+
+    const bsl::uint64_t inBlock = word
+                                ? d_counts[2 * block + 1] >> (9 * (word - 1))
+                                : 0;
+
+    return static_cast<bsl::size_t>(d_counts[2 * block] + (inBlock & 0x1ff));
+}
+
+// ACCESSORS
+inline
+bslma::Allocator *BitStringRankIndex::allocator() const
+{
+    return d_counts.get_allocator().mechanism();
+}
+
+inline
+const bsl::uint64_t *BitStringRankIndex::bitString() const
+{
+    return d_bitString_p;
+}
+
+inline
+bsl::size_t BitStringRankIndex::length() const
+{
+    return d_length;
+}
+
+inline
+bsl::size_t BitStringRankIndex::num0() const
+{
+    return d_length - d_num1;
+}
+
+inline
+bsl::size_t BitStringRankIndex::num1() const
+{
+    return d_num1;
+}
+
+inline
+bsl::size_t BitStringRankIndex::rank0(bsl::size_t index) const
+{
+    BSLS_ASSERT(index <= d_length);
+
+    return index - rank1(index);
+}
+
+inline
+bsl::size_t BitStringRankIndex::rank1(bsl::size_t index) const
+{
+    BSLS_ASSERT(index <= d_length);
+
+    if (index == d_length) {
+        return d_num1;                                                // RETURN
+    }
+
+    const bsl::size_t wordIndex = index / BitStringUtil::k_BITS_PER_UINT64;
+    const unsigned    pos       = static_cast<unsigned>(index) %
+                                             BitStringUtil::k_BITS_PER_UINT64;
+    const bsl::uint64_t mask    = (static_cast<bsl::uint64_t>(1) << pos) - 1;
+
+    return num1BeforeWord(wordIndex) +
+                   BitUtil::numBitsSet(d_bitString_p[wordIndex] & mask);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
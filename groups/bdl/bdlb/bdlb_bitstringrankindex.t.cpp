@@ -0,0 +1,616 @@
+// bdlb_bitstringrankindex.t.cpp                                      -*-C++-*-
+#include <bdlb_bitstringrankindex.h>
+
+#include <bdlb_bitstringutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism answering rank and select queries
+// on a bit string it does not own.  Every query is verified against the
+// answers computed directly from a 'bsl::vector' of the positions of the 0
+// and 1 bits, for bit strings whose lengths fall on both sides of word,
+// block, and sample boundaries, and whose densities range from all 0 bits to
+// all 1 bits.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BitStringRankIndex(bslma::Allocator *basicAllocator = 0);
+// [ 2] BitStringRankIndex(const uint64_t *bs, size_t len, *ba = 0);
+//
+// MANIPULATORS
+// [ 2] void reset(const uint64_t *bitString, size_t length);
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] const uint64_t *bitString() const;
+// [ 2] size_t length() const;
+// [ 2] size_t num0() const;
+// [ 2] size_t num1() const;
+// [ 3] size_t rank0(size_t index) const;
+// [ 3] size_t rank1(size_t index) const;
+// [ 4] size_t select0(size_t n) const;
+// [ 4] size_t select1(size_t n) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlb::BitStringRankIndex Obj;
+typedef bdlb::BitStringUtil      Util;
+
+enum { k_BITS_PER_WORD = Util::k_BITS_PER_UINT64 };
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void fillBitString(bsl::vector<bsl::uint64_t> *result,
+                   bsl::size_t                 length,
+                   int                         density,
+                   bsl::uint64_t               seed)
+    // Load into the specified 'result' a bit string of the specified 'length'
+    // in which each bit is set with a probability of approximately the
+    // specified 'density' in 1/16ths, using a pseudo-random sequence
+    // determined by the specified 'seed'.  Bits of the last word beyond
+    // 'length' are set to 1 so that they would be noticed if counted.
+{
+    result->assign((length + k_BITS_PER_WORD - 1) / k_BITS_PER_WORD, 0);
+
+    for (bsl::size_t ii = 0; ii < length; ++ii) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        if (static_cast<int>(seed >> 60) < density) {
+            Util::assign1(result->data(), ii);
+        }
+    }
+    if (length % k_BITS_PER_WORD) {
+        Util::assign1(result->data(),
+                      length,
+                      k_BITS_PER_WORD - length % k_BITS_PER_WORD);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    // Lengths around word, block, and sample boundaries.
+
+    static const bsl::size_t LENGTHS[] = {
+        0, 1, 2, 63, 64, 65, 127, 128, 129, 448, 511, 512, 513, 1000, 1023,
+        1024, 1025, 4095, 4096, 4097, 8191, 8192, 8193, 20000, 65536, 100003
+    };
+    enum { NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+    static const int DENSITIES[] = { 0, 1, 8, 15, 16 };
+    enum { NUM_DENSITIES = sizeof DENSITIES / sizeof *DENSITIES };
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::DefaultAllocatorGuard usageGuard(&ta);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Mapping Between a Sparse and a Dense Index
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain data for a small subset of a large range of identifiers,
+// and record which identifiers are present in a bit string.  The data for the
+// present identifiers is stored contiguously, in increasing order of
+// identifier.  A rank index lets us map an identifier to the position of its
+// data, and a position back to the identifier.
+//
+// First, we create a bit string with room for 2000 identifiers, and mark the
+// identifiers that are multiples of 7 as being present:
+//..
+    enum { k_NUM_IDS = 2000 };
+
+    bsl::uint64_t present[(k_NUM_IDS + 63) / 64] = { 0 };
+
+    for (bsl::size_t id = 0; id < k_NUM_IDS; id += 7) {
+        bdlb::BitStringUtil::assign1(present, id);
+    }
+//..
+// Then, we build an index over the bit string:
+//..
+    bdlb::BitStringRankIndex index(present, k_NUM_IDS);
+
+    ASSERT(286 == index.num1());
+//..
+// Now, we find the position of the data for identifier 700, which is the
+// number of present identifiers less than 700:
+//..
+    ASSERT(bdlb::BitStringUtil::bit(present, 700));
+    ASSERT(100 == index.rank1(700));
+//..
+// Finally, we find the identifier whose data is at position 100, which is that
+// of the 101st present identifier:
+//..
+    ASSERT(700 == index.select1(101));
+    ASSERT(bdlb::BitStringRankIndex::k_INVALID_INDEX == index.select1(287));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'select0' AND 'select1'
+        //
+        // Concerns:
+        //: 1 'select1(n)' returns the position of the 'n'th 1 bit, and
+        //:   'select0(n)' that of the 'n'th 0 bit, for every 'n' from 1 to
+        //:   the number of such bits, including across block and sample
+        //:   boundaries.
+        //:
+        //: 2 Both return 'k_INVALID_INDEX' if there are fewer than 'n' such
+        //:   bits, and never report bits beyond 'length()'.
+        //:
+        //: 3 'rank1(select1(n)) == n - 1' and 'rank0(select0(n)) == n - 1'.
+        //:
+        //: 4 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each length in a table and each density in a table, build a
+        //:   bit string (with set bits beyond its length) and its index, and
+        //:   compare 'select0' and 'select1' for every valid 'n' to vectors
+        //:   of the positions of the 0 and 1 bits.  (C-1, 3)
+        //:
+        //: 2 Verify that 'n' one greater than the number of bits, and
+        //:   'k_INVALID_INDEX', give 'k_INVALID_INDEX'.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for 'n == 0' (using the 'BSLS_ASSERTTEST_*' macros).
+        //:   (C-4)
+        //
+        // Testing:
+        //   size_t select0(size_t n) const;
+        //   size_t select1(size_t n) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'select0' AND 'select1'" << endl
+                          << "===============================" << endl;
+
+        bsl::vector<bsl::uint64_t> bits(&ta);
+        bsl::vector<bsl::size_t>   zeros(&ta);
+        bsl::vector<bsl::size_t>   ones(&ta);
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const bsl::size_t LENGTH = LENGTHS[li];
+
+            for (int di = 0; di < NUM_DENSITIES; ++di) {
+                const int DENSITY = DENSITIES[di];
+
+                if (veryVerbose) { T_ P_(LENGTH) P(DENSITY) }
+
+                fillBitString(&bits, LENGTH, DENSITY, LENGTH * 31 + DENSITY);
+
+                zeros.clear();
+                ones.clear();
+                for (bsl::size_t ii = 0; ii < LENGTH; ++ii) {
+                    (Util::bit(bits.data(), ii) ? ones : zeros).push_back(ii);
+                }
+
+                const Obj X(bits.data(), LENGTH, &ta);
+
+                for (bsl::size_t n = 1; n <= ones.size(); ++n) {
+                    const bsl::size_t POS = X.select1(n);
+
+                    ASSERTV(LENGTH, DENSITY, n, ones[n - 1] == POS);
+                    if (POS < LENGTH) {
+                        ASSERTV(LENGTH, DENSITY, n, n - 1 == X.rank1(POS));
+                    }
+                }
+                for (bsl::size_t n = 1; n <= zeros.size(); ++n) {
+                    const bsl::size_t POS = X.select0(n);
+
+                    ASSERTV(LENGTH, DENSITY, n, zeros[n - 1] == POS);
+                    if (POS < LENGTH) {
+                        ASSERTV(LENGTH, DENSITY, n, n - 1 == X.rank0(POS));
+                    }
+                }
+
+                ASSERTV(LENGTH, DENSITY,
+                        Obj::k_INVALID_INDEX == X.select1(ones.size() + 1));
+                ASSERTV(LENGTH, DENSITY,
+                        Obj::k_INVALID_INDEX == X.select0(zeros.size() + 1));
+                ASSERTV(LENGTH, DENSITY,
+                        Obj::k_INVALID_INDEX ==
+                                           X.select1(Obj::k_INVALID_INDEX));
+                ASSERTV(LENGTH, DENSITY,
+                        Obj::k_INVALID_INDEX ==
+                                           X.select0(Obj::k_INVALID_INDEX));
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bsl::uint64_t WORD = 5;
+            const Obj           X(&WORD, 3, &ta);
+
+            ASSERT_PASS(X.select0(1));
+            ASSERT_FAIL(X.select0(0));
+            ASSERT_PASS(X.select1(1));
+            ASSERT_FAIL(X.select1(0));
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'rank0' AND 'rank1'
+        //
+        // Concerns:
+        //: 1 'rank1(index)' returns the number of 1 bits, and 'rank0(index)'
+        //:   the number of 0 bits, at positions less than 'index', for every
+        //:   'index' in '[0 .. length()]'.
+        //:
+        //: 2 Bits beyond 'length()' in the last word are not counted.
+        //:
+        //: 3 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each length in a table and each density in a table, build a
+        //:   bit string (with set bits beyond its length) and its index, and
+        //:   compare 'rank0' and 'rank1' for every index to running counts.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for 'index > length()' (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-3)
+        //
+        // Testing:
+        //   size_t rank0(size_t index) const;
+        //   size_t rank1(size_t index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'rank0' AND 'rank1'" << endl
+                          << "===========================" << endl;
+
+        bsl::vector<bsl::uint64_t> bits(&ta);
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const bsl::size_t LENGTH = LENGTHS[li];
+
+            for (int di = 0; di < NUM_DENSITIES; ++di) {
+                const int DENSITY = DENSITIES[di];
+
+                if (veryVerbose) { T_ P_(LENGTH) P(DENSITY) }
+
+                fillBitString(&bits, LENGTH, DENSITY, LENGTH * 17 + DENSITY);
+
+                const Obj X(bits.data(), LENGTH, &ta);
+
+                bsl::size_t count = 0;
+                for (bsl::size_t ii = 0; ii <= LENGTH; ++ii) {
+                    ASSERTV(LENGTH, DENSITY, ii, count == X.rank1(ii));
+                    ASSERTV(LENGTH, DENSITY, ii, ii - count == X.rank0(ii));
+
+                    if (ii < LENGTH && Util::bit(bits.data(), ii)) {
+                        ++count;
+                    }
+                }
+                ASSERTV(LENGTH, DENSITY, count == X.num1());
+                ASSERTV(LENGTH, DENSITY, LENGTH - count == X.num0());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bsl::uint64_t WORD = 5;
+            const Obj           X(&WORD, 3, &ta);
+
+            ASSERT_SAFE_PASS(X.rank0(3));
+            ASSERT_SAFE_FAIL(X.rank0(4));
+            ASSERT_SAFE_PASS(X.rank1(3));
+            ASSERT_SAFE_FAIL(X.rank1(4));
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'reset', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed index refers to an empty bit string.
+        //:
+        //: 2 The value constructor and 'reset' record the bit string and its
+        //:   length, and count its 0 and 1 bits.
+        //:
+        //: 3 'reset' replaces the indexed bit string, and may be used to
+        //:   rebuild the index after the bit string is modified.
+        //:
+        //: 4 Memory is obtained from the object allocator only, and the
+        //:   object allocator is returned by 'allocator'.
+        //:
+        //: 5 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Default-construct an index with and without an allocator and
+        //:   verify its accessors.  (C-1, 4)
+        //:
+        //: 2 Construct an index over a bit string, verify its accessors, then
+        //:   modify the bit string, 'reset' the index, and verify the new
+        //:   counts.  (C-2..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null bit string with a positive length (using
+        //:   the 'BSLS_ASSERTTEST_*' macros).  (C-5)
+        //
+        // Testing:
+        //   BitStringRankIndex(bslma::Allocator *basicAllocator = 0);
+        //   BitStringRankIndex(const uint64_t *bs, size_t len, *ba = 0);
+        //   void reset(const uint64_t *bitString, size_t length);
+        //   bslma::Allocator *allocator() const;
+        //   const uint64_t *bitString() const;
+        //   size_t length() const;
+        //   size_t num0() const;
+        //   size_t num1() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, 'reset', AND BASIC ACCESSORS" << endl
+                          << "======================================" << endl;
+
+        {
+            bslma::TestAllocator         da("local", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            const Obj X;
+
+            ASSERT(&da == X.allocator());
+            ASSERT(0 == X.bitString());
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.num0());
+            ASSERT(0 == X.num1());
+            ASSERT(0 == X.rank1(0));
+            ASSERT(Obj::k_INVALID_INDEX == X.select0(1));
+            ASSERT(Obj::k_INVALID_INDEX == X.select1(1));
+        }
+        {
+            const Obj X(&ta);
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.length());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        bsl::uint64_t bits[20] = { 0 };
+        for (bsl::size_t ii = 0; ii < 1280; ii += 3) {
+            Util::assign1(bits, ii);
+        }
+
+        {
+            Obj mX(bits, 1000, &ta);  const Obj& X = mX;
+
+            ASSERT(&ta  == X.allocator());
+            ASSERT(bits == X.bitString());
+            ASSERT(1000 == X.length());
+            ASSERT( 334 == X.num1());
+            ASSERT( 666 == X.num0());
+            ASSERT(0 < ta.numBlocksInUse());
+
+            Util::assign0(bits, 0, 300);
+            mX.reset(bits, 1280);
+
+            ASSERT(bits == X.bitString());
+            ASSERT(1280 == X.length());
+            ASSERT( 327 == X.num1());
+            ASSERT( 953 == X.num0());
+            ASSERT(  0 == X.rank1(300));
+            ASSERT(300 == X.select1(1));
+
+            mX.reset(bits + 5, 0);
+
+            ASSERT(bits + 5 == X.bitString());
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.num1());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+
+            ASSERT_PASS(mX.reset(0, 0));
+            ASSERT_FAIL(mX.reset(0, 1));
+            ASSERT_PASS(mX.reset(bits, 1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Index a short bit string and query it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bsl::uint64_t BITS[2] = { 0x00000000000000F0ULL,
+                                        0x8000000000000001ULL };
+
+        const Obj X(BITS, 128, &ta);
+
+        ASSERT(6   == X.num1());
+        ASSERT(122 == X.num0());
+        ASSERT(0   == X.rank1(4));
+        ASSERT(4   == X.rank1(64));
+        ASSERT(5   == X.rank1(65));
+        ASSERT(5   == X.rank1(127));
+        ASSERT(6   == X.rank1(128));
+        ASSERT(4   == X.select1(1));
+        ASSERT(64  == X.select1(5));
+        ASSERT(127 == X.select1(6));
+        ASSERT(Obj::k_INVALID_INDEX == X.select1(7));
+        ASSERT(0   == X.select0(1));
+        ASSERT(8   == X.select0(5));
+        ASSERT(126 == X.select0(122));
+        ASSERT(Obj::k_INVALID_INDEX == X.select0(123));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -13,7 +13,7 @@ BSLS_IDENT_RCSID(bdlb_bitstringutil_cpp,"$Id$ $CSID$")
 #include <bsla_unused.h>
 
 #include <bsls_alignmentfromtype.h>
-#include <bsls_annotation.h>
+#include <bsls_atomicoperations.h>
 #include <bsls_assert.h>
 #include <bsls_keyword.h>
 #include <bsls_platform.h>
@@ -26,6 +26,21 @@ BSLS_IDENT_RCSID(bdlb_bitstringutil_cpp,"$Id$ $CSID$")
 
 #include <bsl_c_limits.h>    // 'CHAR_BIT'
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+    // On x86-64 with GCC or Clang, whole-word operations are dispatched at
+    // run time to kernels using 'POPCNT', AVX2, or AVX-512, as supported by
+    // the executing processor.
+
+#define BDLB_BITSTRINGUTIL_X86_DISPATCH 1
+#include <immintrin.h>
+
+#if (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 80000)    \
+ || (defined(BSLS_PLATFORM_CMP_CLANG) && BSLS_PLATFORM_CMP_VERSION >= 60000)
+#define BDLB_BITSTRINGUTIL_AVX512 1
+#endif
+#endif
+
 using namespace BloombergLP;
 using bsl::size_t;
 using bsl::uint64_t;
@@ -52,8 +67,6 @@ enum { k_ALIGNMENT       = 4 };
 enum { k_ALIGNMENT       = bsls::AlignmentFromType<uint64_t>::VALUE };
 #endif
 
-#define FALLTHROUGH BSLS_ANNOTATION_FALLTHROUGH
-
 BSLMF_ASSERT(sizeof(uint64_t) * CHAR_BIT == k_BITS_PER_UINT64);
 BSLMF_ASSERT(0 == (k_BITS_PER_UINT64 & (k_BITS_PER_UINT64 - 1))); // power of 2
 
@@ -862,6 +875,491 @@ void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::move(
     }
 }
 
+}  // close unnamed namespace
+
+                            // word-wise kernels
+
+namespace {
+
+enum Operation {
+    // This enumeration lists the bitwise-logical operations applied to whole
+    // words by the 'combine' kernels.
+
+    e_AND,
+    e_MINUS,
+    e_OR,
+    e_XOR,
+
+    k_NUM_OPERATIONS
+};
+
+template <int OPERATION>
+inline
+uint64_t combineWord(uint64_t dst, uint64_t src)
+    // Return the result of applying the bitwise-logical operation identified
+    // by the (template parameter) 'OPERATION' to the specified 'dst' and
+    // 'src'.
+{
+    return e_AND   == OPERATION ? dst &  src
+         : e_MINUS == OPERATION ? dst & ~src
+         : e_OR    == OPERATION ? dst |  src
+         :                        dst ^  src;
+}
+
+struct Kernels {
+    // This 'struct' holds the word-wise kernels used by 'BitStringUtil' on
+    // whole words, as selected for the instruction set available at run
+    // time.
+
+    size_t (*d_num1)(const uint64_t *words, size_t numWords);
+        // Return the number of set bits in the specified 'numWords' words
+        // starting at the specified 'words'.
+
+    size_t (*d_findFirst)(const uint64_t *words,
+                          size_t          numWords,
+                          uint64_t        flip);
+        // Return the index of the first of the specified 'numWords' words
+        // starting at the specified 'words' that differs from the specified
+        // 'flip', or 'numWords' if there is no such word.
+
+    void (*d_combine[k_NUM_OPERATIONS])(uint64_t       *dst,
+                                        const uint64_t *src,
+                                        size_t          numWords);
+        // Apply, for each operation, that operation to each of the specified
+        // 'numWords' words starting at the specified 'dst' and the
+        // corresponding word starting at the specified 'src', writing the
+        // result over 'dst'.  The ranges must be identical or disjoint.
+};
+
+size_t num1Generic(const uint64_t *words, size_t numWords)
+    // Return the number of set bits in the specified 'numWords' words starting
+    // at the specified 'words'.
+{
+    size_t count0 = 0;
+    size_t count1 = 0;
+    size_t ii     = 0;
+
+    for (; ii + 2 <= numWords; ii += 2) {
+        count0 += BitUtil::numBitsSet(words[ii]);
+        count1 += BitUtil::numBitsSet(words[ii + 1]);
+    }
+    if (ii < numWords) {
+        count0 += BitUtil::numBitsSet(words[ii]);
+    }
+    return count0 + count1;
+}
+
+size_t findFirstGeneric(const uint64_t *words, size_t numWords, uint64_t flip)
+    // Return the index of the first of the specified 'numWords' words starting
+    // at the specified 'words' that differs from the specified 'flip', or
+    // 'numWords' if there is no such word.
+{
+    for (size_t ii = 0; ii < numWords; ++ii) {
+        if (words[ii] != flip) {
+            return ii;                                                // RETURN
+        }
+    }
+    return numWords;
+}
+
+template <int OPERATION>
+void combineGeneric(uint64_t *dst, const uint64_t *src, size_t numWords)
+    // Apply the operation identified by the (template parameter) 'OPERATION'
+    // to each of the specified 'numWords' words starting at the specified
+    // 'dst' and the corresponding word starting at the specified 'src',
+    // writing the result over 'dst'.
+{
+    for (size_t ii = 0; ii < numWords; ++ii) {
+        dst[ii] = combineWord<OPERATION>(dst[ii], src[ii]);
+    }
+}
+
+const Kernels s_genericKernels = {
+    &num1Generic,
+    &findFirstGeneric,
+    { &combineGeneric<e_AND>,
+      &combineGeneric<e_MINUS>,
+      &combineGeneric<e_OR>,
+      &combineGeneric<e_XOR> }
+};
+
+#if defined(BDLB_BITSTRINGUTIL_X86_DISPATCH)
+
+// The following kernels are compiled for instruction-set extensions that the
+// rest of the component may not assume, and are called only after 'kernels'
+// has verified that the executing processor supports those extensions.
+
+__attribute__((target("popcnt")))
+size_t num1Popcnt(const uint64_t *words, size_t numWords)
+    // Return the number of set bits in the specified 'numWords' words starting
+    // at the specified 'words', using the 'POPCNT' instruction.
+{
+    size_t count0 = 0;
+    size_t count1 = 0;
+    size_t count2 = 0;
+    size_t count3 = 0;
+    size_t ii     = 0;
+
+    for (; ii + 4 <= numWords; ii += 4) {
+        count0 += __builtin_popcountll(words[ii]);
+        count1 += __builtin_popcountll(words[ii + 1]);
+        count2 += __builtin_popcountll(words[ii + 2]);
+        count3 += __builtin_popcountll(words[ii + 3]);
+    }
+    for (; ii < numWords; ++ii) {
+        count0 += __builtin_popcountll(words[ii]);
+    }
+    return count0 + count1 + count2 + count3;
+}
+
+const Kernels s_popcntKernels = {
+    &num1Popcnt,
+    &findFirstGeneric,
+    { &combineGeneric<e_AND>,
+      &combineGeneric<e_MINUS>,
+      &combineGeneric<e_OR>,
+      &combineGeneric<e_XOR> }
+};
+
+__attribute__((target("avx2,popcnt")))
+size_t num1Avx2(const uint64_t *words, size_t numWords)
+    // Return the number of set bits in the specified 'numWords' words starting
+    // at the specified 'words', counting the bits of each nibble of four words
+    // at a time with a table lookup ('VPSHUFB'), and summing the byte counts
+    // with 'VPSADBW'.
+{
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+                                           1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3,
+                                           1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low   = _mm256_set1_epi8(0x0f);
+    const __m256i zero  = _mm256_setzero_si256();
+
+    __m256i total = zero;
+    size_t  ii    = 0;
+
+    for (; ii + 4 <= numWords; ii += 4) {
+        const __m256i value = _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(words + ii));
+        const __m256i lo    = _mm256_and_si256(value, low);
+        const __m256i hi    = _mm256_and_si256(_mm256_srli_epi16(value, 4),
+                                               low);
+        const __m256i bytes = _mm256_add_epi8(
+                                           _mm256_shuffle_epi8(table, lo),
+                                           _mm256_shuffle_epi8(table, hi));
+
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(bytes, zero));
+    }
+
+    size_t count = static_cast<size_t>(_mm256_extract_epi64(total, 0))
+                 + static_cast<size_t>(_mm256_extract_epi64(total, 1))
+                 + static_cast<size_t>(_mm256_extract_epi64(total, 2))
+                 + static_cast<size_t>(_mm256_extract_epi64(total, 3));
+
+    for (; ii < numWords; ++ii) {
+        count += __builtin_popcountll(words[ii]);
+    }
+    return count;
+}
+
+__attribute__((target("avx2")))
+size_t findFirstAvx2(const uint64_t *words, size_t numWords, uint64_t flip)
+    // Return the index of the first of the specified 'numWords' words starting
+    // at the specified 'words' that differs from the specified 'flip', or
+    // 'numWords' if there is no such word, testing four words at a time.
+{
+    const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(flip));
+
+    size_t ii = 0;
+    for (; ii + 4 <= numWords; ii += 4) {
+        const __m256i value = _mm256_xor_si256(
+                                _mm256_loadu_si256(
+                                    reinterpret_cast<const __m256i *>(words
+                                                                      + ii)),
+                                mask);
+        if (!_mm256_testz_si256(value, value)) {
+            break;
+        }
+    }
+    for (; ii < numWords; ++ii) {
+        if (words[ii] != flip) {
+            return ii;                                                // RETURN
+        }
+    }
+    return numWords;
+}
+
+template <int OPERATION>
+__attribute__((target("avx2")))
+void combineAvx2(uint64_t *dst, const uint64_t *src, size_t numWords)
+    // Apply the operation identified by the (template parameter) 'OPERATION'
+    // to each of the specified 'numWords' words starting at the specified
+    // 'dst' and the corresponding word starting at the specified 'src', four
+    // words at a time, writing the result over 'dst'.
+{
+    size_t ii = 0;
+    for (; ii + 4 <= numWords; ii += 4) {
+        __m256i *const d = reinterpret_cast<__m256i *>(dst + ii);
+        const __m256i  a = _mm256_loadu_si256(d);
+        const __m256i  b = _mm256_loadu_si256(
+                                  reinterpret_cast<const __m256i *>(src + ii));
+
+        _mm256_storeu_si256(d, e_AND   == OPERATION ? _mm256_and_si256(a, b)
+                             : e_MINUS == OPERATION ? _mm256_andnot_si256(b, a)
+                             : e_OR    == OPERATION ? _mm256_or_si256(a, b)
+                             :                        _mm256_xor_si256(a, b));
+    }
+    for (; ii < numWords; ++ii) {
+        dst[ii] = combineWord<OPERATION>(dst[ii], src[ii]);
+    }
+}
+
+const Kernels s_avx2Kernels = {
+    &num1Avx2,
+    &findFirstAvx2,
+    { &combineAvx2<e_AND>,
+      &combineAvx2<e_MINUS>,
+      &combineAvx2<e_OR>,
+      &combineAvx2<e_XOR> }
+};
+
+#if defined(BDLB_BITSTRINGUTIL_AVX512)
+
+__attribute__((target("avx512f,avx512vpopcntdq,popcnt")))
+size_t num1Avx512(const uint64_t *words, size_t numWords)
+    // Return the number of set bits in the specified 'numWords' words starting
+    // at the specified 'words', eight words at a time with 'VPOPCNTQ'.
+{
+    __m512i total = _mm512_setzero_si512();
+    size_t  ii    = 0;
+
+    for (; ii + 8 <= numWords; ii += 8) {
+        total = _mm512_add_epi64(total,
+                                 _mm512_popcnt_epi64(
+                                           _mm512_loadu_si512(words + ii)));
+    }
+
+    // Sum the lanes through memory: '_mm512_reduce_add_epi64' expands, with
+    // some versions of GCC, to code that draws '-Wuninitialized' warnings.
+
+    uint64_t lanes[8];
+    _mm512_storeu_si512(lanes, total);
+
+    size_t count = 0;
+    for (int jj = 0; jj < 8; ++jj) {
+        count += static_cast<size_t>(lanes[jj]);
+    }
+
+    for (; ii < numWords; ++ii) {
+        count += __builtin_popcountll(words[ii]);
+    }
+    return count;
+}
+
+__attribute__((target("avx512f")))
+size_t findFirstAvx512(const uint64_t *words, size_t numWords, uint64_t flip)
+    // Return the index of the first of the specified 'numWords' words starting
+    // at the specified 'words' that differs from the specified 'flip', or
+    // 'numWords' if there is no such word, testing eight words at a time.
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<long long>(flip));
+
+    size_t ii = 0;
+    for (; ii + 8 <= numWords; ii += 8) {
+        const __mmask8 differ = _mm512_cmpneq_epu64_mask(
+                                              _mm512_loadu_si512(words + ii),
+                                              mask);
+        if (differ) {
+            return ii + __builtin_ctz(differ);                        // RETURN
+        }
+    }
+    for (; ii < numWords; ++ii) {
+        if (words[ii] != flip) {
+            return ii;                                                // RETURN
+        }
+    }
+    return numWords;
+}
+
+__attribute__((target("avx512f")))
+inline
+__m512i andNot512(__m512i lhs, __m512i rhs)
+    // Return the bitwise AND of the complement of the specified 'lhs' with
+    // the specified 'rhs'.  Note that the zero-masked form is used because
+    // the unmasked '_mm512_andnot_*' intrinsics draw '-Wuninitialized'
+    // warnings from some versions of GCC.
+{
+    return _mm512_maskz_andnot_epi64(static_cast<__mmask8>(0xFF), lhs, rhs);
+}
+
+template <int OPERATION>
+__attribute__((target("avx512f")))
+void combineAvx512(uint64_t *dst, const uint64_t *src, size_t numWords)
+    // Apply the operation identified by the (template parameter) 'OPERATION'
+    // to each of the specified 'numWords' words starting at the specified
+    // 'dst' and the corresponding word starting at the specified 'src', eight
+    // words at a time, writing the result over 'dst'.
+{
+    size_t ii = 0;
+    for (; ii + 8 <= numWords; ii += 8) {
+        const __m512i a = _mm512_loadu_si512(dst + ii);
+        const __m512i b = _mm512_loadu_si512(src + ii);
+
+        _mm512_storeu_si512(dst + ii,
+                            e_AND   == OPERATION ? _mm512_and_si512(a, b)
+                          : e_MINUS == OPERATION ? andNot512(b, a)
+                          : e_OR    == OPERATION ? _mm512_or_si512(a, b)
+                          :                        _mm512_xor_si512(a, b));
+    }
+    for (; ii < numWords; ++ii) {
+        dst[ii] = combineWord<OPERATION>(dst[ii], src[ii]);
+    }
+}
+
+const Kernels s_avx512Kernels = {
+    &num1Avx512,
+    &findFirstAvx512,
+    { &combineAvx512<e_AND>,
+      &combineAvx512<e_MINUS>,
+      &combineAvx512<e_OR>,
+      &combineAvx512<e_XOR> }
+};
+
+#endif  // BDLB_BITSTRINGUTIL_AVX512
+#endif  // BDLB_BITSTRINGUTIL_X86_DISPATCH
+
+const Kernels *const s_kernelsByTier[] = {
+    &s_genericKernels,
+#if defined(BDLB_BITSTRINGUTIL_X86_DISPATCH)
+    &s_popcntKernels,
+    &s_avx2Kernels,
+#else
+    0,
+    0,
+#endif
+#if defined(BDLB_BITSTRINGUTIL_AVX512)
+    &s_avx512Kernels
+#else
+    0
+#endif
+};
+    // address of the kernels of each 'bdlb::BitStringUtil_Kernels::Tier', or
+    // 0 for tiers not compiled into this build
+
+BSLMF_ASSERT(sizeof s_kernelsByTier / sizeof *s_kernelsByTier
+                                  == bdlb::BitStringUtil_Kernels::k_NUM_TIERS);
+
+bool isTierSupported(int tier)
+    // Return 'true' if the specified 'tier' identifies kernels that are
+    // compiled into this build and supported by the executing processor, and
+    // 'false' otherwise.
+{
+    typedef bdlb::BitStringUtil_Kernels Tiers;
+
+    if (0 > tier || Tiers::k_NUM_TIERS <= tier || !s_kernelsByTier[tier]) {
+        return false;                                                 // RETURN
+    }
+
+#if defined(BDLB_BITSTRINGUTIL_X86_DISPATCH)
+    __builtin_cpu_init();
+
+    switch (tier) {
+      case Tiers::e_AVX512: {
+        return __builtin_cpu_supports("avx512f")
+            && __builtin_cpu_supports("avx512vpopcntdq");             // RETURN
+      }
+      case Tiers::e_AVX2: {
+        return __builtin_cpu_supports("avx2")
+            && __builtin_cpu_supports("popcnt");                      // RETURN
+      }
+      case Tiers::e_POPCNT: {
+        return __builtin_cpu_supports("popcnt");                      // RETURN
+      }
+    }
+#endif
+
+    return Tiers::e_GENERIC == tier;
+}
+
+const Kernels *selectKernels()
+    // Return the address of the most efficient set of kernels supported by
+    // the executing processor.
+{
+    int tier = bdlb::BitStringUtil_Kernels::k_NUM_TIERS - 1;
+    while (!isTierSupported(tier)) {
+        --tier;
+    }
+    return s_kernelsByTier[tier];
+}
+
+bsls::AtomicOperations::AtomicTypes::Pointer s_kernels_p = { 0 };
+    // address of the kernels selected for the executing processor, or 0 if
+    // not yet selected
+
+inline
+const Kernels& kernels()
+    // Return a reference to the most efficient set of kernels supported by
+    // the executing processor, selecting it on first use.  Note that
+    // concurrent first uses select the same kernels, so the race is benign.
+{
+    const Kernels *result = static_cast<const Kernels *>(
+                       bsls::AtomicOperations::getPtrAcquire(&s_kernels_p));
+
+    if (!result) {
+        result = selectKernels();
+        bsls::AtomicOperations::setPtrRelease(
+                                         &s_kernels_p,
+                                         const_cast<Kernels *>(result));
+    }
+    return *result;
+}
+
+template <int OPERATION,
+          void OPER_DO_BITS(        uint64_t *, int, uint64_t, int),
+          void OPER_DO_ALIGNED_WORD(uint64_t *,      uint64_t)>
+void combine(uint64_t       *dstBitString,
+             size_t          dstIndex,
+             const uint64_t *srcBitString,
+             size_t          srcIndex,
+             size_t          numBits)
+    // Apply the bitwise-logical operation identified by the (template
+    // parameter) 'OPERATION', and implemented bit-wise by the (template
+    // parameter) 'OPER_DO_BITS' and word-wise by 'OPER_DO_ALIGNED_WORD', to
+    // the specified 'numBits' of the specified 'dstBitString' starting at the
+    // specified 'dstIndex' and those of the specified 'srcBitString' starting
+    // at the specified 'srcIndex', writing the result over the bits of
+    // 'dstBitString'.  Word-aligned ranges that are identical or disjoint are
+    // processed by the selected kernel; other ranges by 'Mover'.
+{
+    if (0 == dstIndex % k_BITS_PER_UINT64
+     && 0 == srcIndex % k_BITS_PER_UINT64) {
+        uint64_t       *dst      = dstBitString + dstIndex / k_BITS_PER_UINT64;
+        const uint64_t *src      = srcBitString + srcIndex / k_BITS_PER_UINT64;
+        const size_t    numWords = numBits / k_BITS_PER_UINT64;
+        const int       numRem   = u32(numBits) % k_BITS_PER_UINT64;
+        const UintPtr   dstBegin = reinterpret_cast<UintPtr>(dst);
+        const UintPtr   srcBegin = reinterpret_cast<UintPtr>(src);
+        const UintPtr   span     = (numWords + (numRem ? 1 : 0))
+                                 * sizeof(uint64_t);
+
+        if (dstBegin == srcBegin
+         || dstBegin + span <= srcBegin
+         || srcBegin + span <= dstBegin) {
+            kernels().d_combine[OPERATION](dst, src, numWords);
+            if (numRem) {
+                OPER_DO_BITS(dst + numWords, 0, src[numWords], numRem);
+            }
+            return;                                                   // RETURN
+        }
+    }
+
+    Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::move(dstBitString,
+                                                    dstIndex,
+                                                    srcBitString,
+                                                    srcIndex,
+                                                    numBits);
+}
+
 }  // close unnamed namespace
 
 
@@ -1038,6 +1536,155 @@ bsl::ostream& newlineAndIndent(bsl::ostream& stream,
     return stream;
 }
 
+                    // for 'find[01]AtNth{Max,Min}Index'
+
+static inline
+int findNth1AtMaxIndexRaw(uint64_t value, size_t n)
+    // Return the index of the specified 'n'th set bit of the specified
+    // 'value', counting down from the most-significant bit.  The behavior is
+    // undefined unless '0 < n' and 'n <= BitUtil::numBitsSet(value)'.
+{
+    BSLS_ASSERT(0 < n);
+    BSLS_ASSERT(n <= static_cast<size_t>(BitUtil::numBitsSet(value)));
+
+    // Skip whole bytes, from the top, until the byte containing the 'n'th set
+    // bit is found, then clear the 'n - 1' highest set bits of that byte.
+
+    int      pos = k_BITS_PER_UINT64 - CHAR_BIT;
+    uint64_t byte;
+    size_t   count;
+    while (n > (count = BitUtil::numBitsSet(
+                                         byte = (value >> pos) & 0xff))) {
+        n   -= count;
+        pos -= CHAR_BIT;
+    }
+
+    int index = Imp::find1AtMaxIndexRaw(byte);
+    while (--n) {
+        byte  ^= 1ULL << index;
+        index  = Imp::find1AtMaxIndexRaw(byte);
+    }
+    return pos + index;
+}
+
+static inline
+int findNth1AtMinIndexRaw(uint64_t value, size_t n)
+    // Return the index of the specified 'n'th set bit of the specified
+    // 'value', counting up from the least-significant bit.  The behavior is
+    // undefined unless '0 < n' and 'n <= BitUtil::numBitsSet(value)'.
+{
+    BSLS_ASSERT(0 < n);
+    BSLS_ASSERT(n <= static_cast<size_t>(BitUtil::numBitsSet(value)));
+
+    // Skip whole bytes, from the bottom, until the byte containing the 'n'th
+    // set bit is found, then clear the 'n - 1' lowest set bits of that byte.
+
+    int    pos = 0;
+    size_t count;
+    while (n > (count = BitUtil::numBitsSet(value & 0xff))) {
+        n     -= count;
+        value >>= CHAR_BIT;
+        pos   += CHAR_BIT;
+    }
+
+    while (--n) {
+        value &= value - 1;
+    }
+    return pos + Imp::find1AtMinIndexRaw(value);
+}
+
+static
+size_t findNthAtMaxIndexImp(const uint64_t *bitString,
+                            size_t          begin,
+                            size_t          end,
+                            size_t          n,
+                            uint64_t        flip)
+    // Return the index of the specified 'n'th 1 bit in the range
+    // '[begin .. end)' of the bit string formed by XOR-ing each word of the
+    // specified 'bitString' with the specified 'flip', counting down from the
+    // bit at the specified 'end - 1', if at least 'n' such bits exist in the
+    // range, and 'k_INVALID_INDEX' otherwise.  The behavior is undefined
+    // unless '0 < n', 'begin <= end', and 'end' is less than or equal to the
+    // length of 'bitString'.  Note that passing '~0ULL' as 'flip' locates 0
+    // bits rather than 1 bits.
+{
+    if (begin == end) {
+        return bdlb::BitStringUtil::k_INVALID_INDEX;                  // RETURN
+    }
+
+    const size_t beginWord =        begin / k_BITS_PER_UINT64;
+    const int    beginIdx  =   u32(begin) % k_BITS_PER_UINT64;
+    const size_t lastWord  =    (end - 1) / k_BITS_PER_UINT64;
+    const int    endPos    = u32(end - 1) % k_BITS_PER_UINT64 + 1;
+
+    // Whole words are skipped using a population count, so only the word
+    // containing the 'n'th bit is searched bit-wise.
+
+    uint64_t value = (bitString[lastWord] ^ flip) & BitMaskUtil::lt64(endPos);
+
+    for (size_t ii = lastWord; true; value = bitString[--ii] ^ flip) {
+        if (ii == beginWord) {
+            value &= ge64Raw(beginIdx);
+        }
+
+        const size_t count = BitUtil::numBitsSet(value);
+        if (n <= count) {
+            return ii * k_BITS_PER_UINT64 + findNth1AtMaxIndexRaw(value, n);
+                                                                      // RETURN
+        }
+        if (ii == beginWord) {
+            return bdlb::BitStringUtil::k_INVALID_INDEX;              // RETURN
+        }
+        n -= count;
+    }
+}
+
+static
+size_t findNthAtMinIndexImp(const uint64_t *bitString,
+                            size_t          begin,
+                            size_t          end,
+                            size_t          n,
+                            uint64_t        flip)
+    // Return the index of the specified 'n'th 1 bit in the range
+    // '[begin .. end)' of the bit string formed by XOR-ing each word of the
+    // specified 'bitString' with the specified 'flip', counting up from the
+    // bit at the specified 'begin', if at least 'n' such bits exist in the
+    // range, and 'k_INVALID_INDEX' otherwise.  The behavior is undefined
+    // unless '0 < n', 'begin <= end', and 'end' is less than or equal to the
+    // length of 'bitString'.  Note that passing '~0ULL' as 'flip' locates 0
+    // bits rather than 1 bits.
+{
+    if (begin == end) {
+        return bdlb::BitStringUtil::k_INVALID_INDEX;                  // RETURN
+    }
+
+    const size_t beginWord =        begin / k_BITS_PER_UINT64;
+    const int    beginIdx  =   u32(begin) % k_BITS_PER_UINT64;
+    const size_t lastWord  =    (end - 1) / k_BITS_PER_UINT64;
+    const int    endPos    = u32(end - 1) % k_BITS_PER_UINT64 + 1;
+
+    // Whole words are skipped using a population count, so only the word
+    // containing the 'n'th bit is searched bit-wise.
+
+    uint64_t value = (bitString[beginWord] ^ flip) & ge64Raw(beginIdx);
+
+    for (size_t ii = beginWord; true; value = bitString[++ii] ^ flip) {
+        if (ii == lastWord) {
+            value &= BitMaskUtil::lt64(endPos);
+        }
+
+        const size_t count = BitUtil::numBitsSet(value);
+        if (n <= count) {
+            return ii * k_BITS_PER_UINT64 + findNth1AtMinIndexRaw(value, n);
+                                                                      // RETURN
+        }
+        if (ii == lastWord) {
+            return bdlb::BitStringUtil::k_INVALID_INDEX;              // RETURN
+        }
+        n -= count;
+    }
+}
+
 namespace BloombergLP {
 namespace bdlb {
 
@@ -1231,11 +1878,11 @@ void BitStringUtil::andEqual(uint64_t       *dstBitString,
     BSLS_ASSERT(dstBitString);
     BSLS_ASSERT(srcBitString);
 
-    Mover<Imp::andEqBits, Imp::andEqWord>::move(dstBitString,
-                                                dstIndex,
-                                                srcBitString,
-                                                srcIndex,
-                                                numBits);
+    combine<e_AND, Imp::andEqBits, Imp::andEqWord>(dstBitString,
+                                                   dstIndex,
+                                                   srcBitString,
+                                                   srcIndex,
+                                                   numBits);
 }
 
 void BitStringUtil::minusEqual(uint64_t       *dstBitString,
@@ -1247,11 +1894,11 @@ void BitStringUtil::minusEqual(uint64_t       *dstBitString,
     BSLS_ASSERT(dstBitString);
     BSLS_ASSERT(srcBitString);
 
-    Mover<Imp::minusEqBits, Imp::minusEqWord>::move(dstBitString,
-                                                    dstIndex,
-                                                    srcBitString,
-                                                    srcIndex,
-                                                    numBits);
+    combine<e_MINUS, Imp::minusEqBits, Imp::minusEqWord>(dstBitString,
+                                                         dstIndex,
+                                                         srcBitString,
+                                                         srcIndex,
+                                                         numBits);
 }
 
 void BitStringUtil::orEqual(uint64_t       *dstBitString,
@@ -1263,11 +1910,11 @@ void BitStringUtil::orEqual(uint64_t       *dstBitString,
     BSLS_ASSERT(dstBitString);
     BSLS_ASSERT(srcBitString);
 
-    Mover<Imp::orEqBits, Imp::orEqWord>::move(dstBitString,
-                                              dstIndex,
-                                              srcBitString,
-                                              srcIndex,
-                                              numBits);
+    combine<e_OR, Imp::orEqBits, Imp::orEqWord>(dstBitString,
+                                                dstIndex,
+                                                srcBitString,
+                                                srcIndex,
+                                                numBits);
 }
 
 void BitStringUtil::xorEqual(uint64_t       *dstBitString,
@@ -1279,11 +1926,11 @@ void BitStringUtil::xorEqual(uint64_t       *dstBitString,
     BSLS_ASSERT(dstBitString);
     BSLS_ASSERT(srcBitString);
 
-    Mover<Imp::xorEqBits, Imp::xorEqWord>::move(dstBitString,
-                                                dstIndex,
-                                                srcBitString,
-                                                srcIndex,
-                                                numBits);
+    combine<e_XOR, Imp::xorEqBits, Imp::xorEqWord>(dstBitString,
+                                                   dstIndex,
+                                                   srcBitString,
+                                                   srcIndex,
+                                                   numBits);
 }
 
                             // Copy
@@ -1834,14 +2481,13 @@ size_t BitStringUtil::find0AtMinIndex(const uint64_t *bitString, size_t length)
     }
 
     const size_t lastWord = (length - 1) / k_BITS_PER_UINT64;
+    const size_t ii       = kernels().d_findFirst(bitString, lastWord, ~0ULL);
     uint64_t     value;
 
-    for (size_t ii = 0; ii < lastWord; ++ii) {
+    if (ii < lastWord) {
         value = ~bitString[ii];
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+        return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
-        }
     }
 
     const int endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
@@ -1870,8 +2516,19 @@ size_t BitStringUtil::find0AtMinIndex(const uint64_t *bitString,
 
     uint64_t     value     = ~bitString[beginWord] & ge64Raw(beginIdx);
 
-    for (size_t ii = beginWord; ii < lastWord; value = ~bitString[++ii]) {
+    if (beginWord < lastWord) {
         if (value) {
+            return beginWord * k_BITS_PER_UINT64 +
+                                      Imp::find1AtMinIndexRaw(value); // RETURN
+        }
+
+        const size_t ii = beginWord + 1 +
+                          kernels().d_findFirst(bitString + beginWord + 1,
+                                                lastWord - beginWord - 1,
+                                                ~0ULL);
+
+        value = ~bitString[ii];
+        if (ii < lastWord) {
             return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
         }
@@ -1883,6 +2540,30 @@ size_t BitStringUtil::find0AtMinIndex(const uint64_t *bitString,
            : k_INVALID_INDEX;
 }
 
+size_t BitStringUtil::find0AtNthMaxIndex(const uint64_t *bitString,
+                                         size_t          begin,
+                                         size_t          end,
+                                         size_t          n)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < n);
+
+    return findNthAtMaxIndexImp(bitString, begin, end, n, ~0ULL);
+}
+
+size_t BitStringUtil::find0AtNthMinIndex(const uint64_t *bitString,
+                                         size_t          begin,
+                                         size_t          end,
+                                         size_t          n)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < n);
+
+    return findNthAtMinIndexImp(bitString, begin, end, n, ~0ULL);
+}
+
 size_t BitStringUtil::find1AtMaxIndex(const uint64_t *bitString, size_t length)
 {
     BSLS_ASSERT(bitString);
@@ -1948,14 +2629,13 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString, size_t length)
     }
 
     const size_t lastWord = (length - 1) / k_BITS_PER_UINT64;
+    const size_t ii       = kernels().d_findFirst(bitString, lastWord, 0);
     uint64_t     value;
 
-    for (size_t ii = 0; ii < lastWord; ++ii) {
+    if (ii < lastWord) {
         value = bitString[ii];
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+        return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
-        }
     }
 
     const int endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
@@ -1984,8 +2664,19 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString,
 
     uint64_t     value     = bitString[beginWord] & ge64Raw(beginIdx);
 
-    for (size_t ii = beginWord; ii < lastWord; value = bitString[++ii]) {
+    if (beginWord < lastWord) {
         if (value) {
+            return beginWord * k_BITS_PER_UINT64 +
+                                      Imp::find1AtMinIndexRaw(value); // RETURN
+        }
+
+        const size_t ii = beginWord + 1 +
+                          kernels().d_findFirst(bitString + beginWord + 1,
+                                                lastWord - beginWord - 1,
+                                                0);
+
+        value = bitString[ii];
+        if (ii < lastWord) {
             return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
         }
@@ -1997,6 +2688,30 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString,
            : k_INVALID_INDEX;
 }
 
+size_t BitStringUtil::find1AtNthMaxIndex(const uint64_t *bitString,
+                                         size_t          begin,
+                                         size_t          end,
+                                         size_t          n)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < n);
+
+    return findNthAtMaxIndexImp(bitString, begin, end, n, 0);
+}
+
+size_t BitStringUtil::find1AtNthMinIndex(const uint64_t *bitString,
+                                         size_t          begin,
+                                         size_t          end,
+                                         size_t          n)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < n);
+
+    return findNthAtMinIndexImp(bitString, begin, end, n, 0);
+}
+
 bool BitStringUtil::isAny0(const uint64_t *bitString,
                            size_t          index,
                            size_t          numBits)
@@ -2017,11 +2732,14 @@ bool BitStringUtil::isAny0(const uint64_t *bitString,
     }
     numBits -= numOfBits;
 
-    for (; numBits >= k_BITS_PER_UINT64; numBits -= k_BITS_PER_UINT64) {
-        if (~bitString[++idx]) {
-            return true;                                              // RETURN
-        }
+    const size_t numWords = numBits / k_BITS_PER_UINT64;
+
+    if (kernels().d_findFirst(bitString + idx + 1, numWords, ~0ULL) <
+                                                                   numWords) {
+        return true;                                                  // RETURN
     }
+    idx     += numWords;
+    numBits -= numWords * k_BITS_PER_UINT64;
     BSLS_ASSERT(numBits < k_BITS_PER_UINT64);
 
     if (0 == numBits) {
@@ -2051,12 +2769,13 @@ bool BitStringUtil::isAny1(const uint64_t *bitString,
     }
     numBits -= numOfBits;
 
-    while (numBits >= k_BITS_PER_UINT64) {
-        if (bitString[++idx]) {
-            return true;                                              // RETURN
-        }
-        numBits -= k_BITS_PER_UINT64;
+    const size_t numWords = numBits / k_BITS_PER_UINT64;
+
+    if (kernels().d_findFirst(bitString + idx + 1, numWords, 0) < numWords) {
+        return true;                                                  // RETURN
     }
+    idx     += numWords;
+    numBits -= numWords * k_BITS_PER_UINT64;
     BSLS_ASSERT(numBits < k_BITS_PER_UINT64);
 
     if (0 == numBits) {
@@ -2100,50 +2819,13 @@ size_t BitStringUtil::num1(const uint64_t *bitString,
     size_t ret = BitUtil::numBitsSet(bitString[lastWord] &
                                                     BitMaskUtil::lt64(endPos));
 
-    // We now want to visit all the words not including the highest-order and
-    // lowest-order words in 'bitString'.  We set 'array' such that
-    // '&array[0] == &bitString[1]'.  The first word we will visit in this
-    // array (as we predecrement 'ii') will be
-    // 'array[lastWord - 2] == bitString[lastWord - 1]'.  The last element we
-    // will visit will be 'array[0] == bitString[1]'.  The initial value of
-    // 'ii' below will be the number of words between the first and last words
-    // that must be traversed, not including the first word or the last word.
-
-    BSLS_ASSERT(lastWord >= 1);    // therefore 'ii' below is >= 0 and can
-                                        // be represented as a 'size_t'
+    // The words strictly between the lowest-order and highest-order words
+    // are all full words, and are counted by the kernel selected for the
+    // executing processor.
 
-    const uint64_t *array = bitString + 1;
-    size_t          ii    = lastWord
-                                     - 1  // word before last word
-                                     - 1  // adjust from 'bitString' to 'array'
-                                     + 1; // preparation for pre-decrement
+    BSLS_ASSERT(lastWord >= 1);
 
-    while (ii >= 8) {
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-    }
-
-    BSLS_ASSERT(ii < 8);
-
-    switch (ii) {
-      case 7: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 6: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 5: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 4: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 3: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 2: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 1: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      default:                                                     break;
-    }
-
-    BSLS_ASSERT(0 == ii);
+    ret += kernels().d_num1(bitString + 1, lastWord - 1);
 
     // And we are now ready to look at the lowest-order word.
 
@@ -2248,6 +2930,41 @@ bsl::ostream& BitStringUtil::print(bsl::ostream&   stream,
     return stream;
 }
 
+                        // ----------------------------
+                        // struct BitStringUtil_Kernels
+                        // ----------------------------
+
+// CLASS METHODS
+bool BitStringUtil_Kernels::isSupported(int tier)
+{
+    BSLS_ASSERT(0 <= tier);
+    BSLS_ASSERT(tier < k_NUM_TIERS);
+
+    return isTierSupported(tier);
+}
+
+int BitStringUtil_Kernels::selectedTier()
+{
+    const Kernels *selected = &kernels();
+
+    int tier = k_NUM_TIERS - 1;
+    while (0 < tier && s_kernelsByTier[tier] != selected) {
+        --tier;
+    }
+    return tier;
+}
+
+void BitStringUtil_Kernels::setTier(int tier)
+{
+    BSLS_ASSERT(0 <= tier);
+    BSLS_ASSERT(tier < k_NUM_TIERS);
+    BSLS_ASSERT(isTierSupported(tier));
+
+    bsls::AtomicOperations::setPtrRelease(
+                              &s_kernels_p,
+                              const_cast<Kernels *>(s_kernelsByTier[tier]));
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -11,7 +11,7 @@ BSLS_IDENT("$Id: $")
 // bdlb::BitStringUtil: namespace for common bit-manipulation procedures
 //
 //@SEE_ALSO: bdlb_bitutil, bdlb_bitmaskutil, bdlb_bitstringimputil,
-//           bdlc_bitarray
+//           bdlb_bitstringrankindex, bdlc_bitarray
 //
 //@DESCRIPTION: This component provides a utility 'struct',
 // 'bdlb::BitStringUtil', that serves as a namespace for a collection of
@@ -191,10 +191,22 @@ BSLS_IDENT("$Id: $")
 // +--------------------------------------------------------------------------+
 // | find0AtMinIndex | Locate the lowest-order 0 bit in a range.              |
 // +--------------------------------------------------------------------------+
+// | find0AtNthMaxIndex | Locate the 'n'th 0 bit in a range, counting down    |
+// |                    | from the highest-order bit.                         |
+// +--------------------------------------------------------------------------+
+// | find0AtNthMinIndex | Locate the 'n'th 0 bit in a range, counting up from |
+// |                    | the lowest-order bit.                               |
+// +--------------------------------------------------------------------------+
 // | find1AtMaxIndex | Locate the highest-order 1 bit in a range.             |
 // +--------------------------------------------------------------------------+
 // | find1AtMinIndex | Locate the lowest-order 1 bit in a range.              |
 // +--------------------------------------------------------------------------+
+// | find1AtNthMaxIndex | Locate the 'n'th 1 bit in a range, counting down    |
+// |                    | from the highest-order bit.                         |
+// +--------------------------------------------------------------------------+
+// | find1AtNthMinIndex | Locate the 'n'th 1 bit in a range, counting up from |
+// |                    | the lowest-order bit.                               |
+// +--------------------------------------------------------------------------+
 //
 //
 //                                     Count
@@ -218,6 +230,20 @@ BSLS_IDENT("$Id: $")
 //
 //..
 //
+///Performance
+///-----------
+// The operations that traverse many whole words -- 'num0', 'num1',
+// 'find0AtMinIndex', 'find1AtMinIndex', 'isAny0', 'isAny1', and, when both
+// ranges start on a word boundary and are either identical or disjoint,
+// 'andEqual', 'minusEqual', 'orEqual', and 'xorEqual' -- process those words
+// with kernels chosen, on first use, for the executing processor.  On x86-64
+// platforms built with GCC or Clang, kernels using the 'POPCNT', AVX2, and
+// AVX-512 ('VPOPCNTDQ') instructions are selected when the processor supports
+// them, and portable kernels are used otherwise.  The results do not depend
+// on which kernels are selected.  See 'bdlb_bitstringrankindex' for an
+// auxiliary index supporting constant-time 'rank' and fast 'select' queries
+// on a bit string.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -691,6 +717,32 @@ struct BitStringUtil {
         // unless 'begin <= end' and 'end' is less than or equal to the length
         // of 'bitString'.
 
+    static bsl::size_t find0AtNthMaxIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end,
+                                          bsl::size_t          n);
+        // Return the index of the specified 'n'th 0 bit in the specified
+        // 'bitString' in the specified range '[begin .. end)', counting down
+        // from (and including) the bit at 'end - 1', if at least 'n' such bits
+        // exist in the range, and 'k_INVALID_INDEX' otherwise.  Note that
+        // 'find0AtNthMaxIndex(bitString, begin, end, 1)' is equivalent to
+        // 'find0AtMaxIndex(bitString, begin, end)'.  The behavior is undefined
+        // unless '0 < n', 'begin <= end', and 'end' is less than or equal to
+        // the length of 'bitString'.
+
+    static bsl::size_t find0AtNthMinIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end,
+                                          bsl::size_t          n);
+        // Return the index of the specified 'n'th 0 bit in the specified
+        // 'bitString' in the specified range '[begin .. end)', counting up
+        // from (and including) the bit at 'begin', if at least 'n' such bits
+        // exist in the range, and 'k_INVALID_INDEX' otherwise.  Note that
+        // 'find0AtNthMinIndex(bitString, begin, end, 1)' is equivalent to
+        // 'find0AtMinIndex(bitString, begin, end)'.  The behavior is undefined
+        // unless '0 < n', 'begin <= end', and 'end' is less than or equal to
+        // the length of 'bitString'.
+
     static bsl::size_t find1AtMaxIndex(const bsl::uint64_t *bitString,
                                        bsl::size_t          length);
         // Return the index of the most-significant 1 bit in the specified
@@ -721,6 +773,32 @@ struct BitStringUtil {
         // unless 'begin <= end' and 'end' is less than or equal to the length
         // of 'bitString'.
 
+    static bsl::size_t find1AtNthMaxIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end,
+                                          bsl::size_t          n);
+        // Return the index of the specified 'n'th 1 bit in the specified
+        // 'bitString' in the specified range '[begin .. end)', counting down
+        // from (and including) the bit at 'end - 1', if at least 'n' such bits
+        // exist in the range, and 'k_INVALID_INDEX' otherwise.  Note that
+        // 'find1AtNthMaxIndex(bitString, begin, end, 1)' is equivalent to
+        // 'find1AtMaxIndex(bitString, begin, end)'.  The behavior is undefined
+        // unless '0 < n', 'begin <= end', and 'end' is less than or equal to
+        // the length of 'bitString'.
+
+    static bsl::size_t find1AtNthMinIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end,
+                                          bsl::size_t          n);
+        // Return the index of the specified 'n'th 1 bit in the specified
+        // 'bitString' in the specified range '[begin .. end)', counting up
+        // from (and including) the bit at 'begin', if at least 'n' such bits
+        // exist in the range, and 'k_INVALID_INDEX' otherwise.  Note that
+        // 'find1AtNthMinIndex(bitString, begin, end, 1)' is equivalent to
+        // 'find1AtMinIndex(bitString, begin, end)'.  The behavior is undefined
+        // unless '0 < n', 'begin <= end', and 'end' is less than or equal to
+        // the length of 'bitString'.
+
                                 // Count
 
     static bool isAny0(const bsl::uint64_t *bitString,
@@ -775,6 +853,44 @@ struct BitStringUtil {
         // that a trailing newline is provided in multiline mode only.
 };
 
+                        // ============================
+                        // struct BitStringUtil_Kernels
+                        // ============================
+
+struct BitStringUtil_Kernels {
+    // This component-private 'struct' provides a namespace for functions that
+    // identify, and (for testing) select, the tier of word-wise kernels used
+    // by 'BitStringUtil'.  It is not intended for use outside this component
+    // and its test driver.
+
+    // TYPES
+    enum Tier {
+        e_GENERIC = 0,  // portable kernels
+        e_POPCNT  = 1,  // kernels using 'POPCNT'
+        e_AVX2    = 2,  // kernels using AVX2 and 'POPCNT'
+        e_AVX512  = 3   // kernels using AVX-512F and AVX-512 'VPOPCNTDQ'
+    };
+
+    enum { k_NUM_TIERS = 4 };
+
+    // CLASS METHODS
+    static bool isSupported(int tier);
+        // Return 'true' if the kernels of the specified 'tier' are compiled
+        // into this build and supported by the executing processor, and
+        // 'false' otherwise.  The behavior is undefined unless
+        // '0 <= tier < k_NUM_TIERS'.
+
+    static int selectedTier();
+        // Return the tier of the kernels used by 'BitStringUtil', selecting
+        // the highest supported tier if none has been selected yet.
+
+    static void setTier(int tier);
+        // Use the kernels of the specified 'tier' in all subsequent operations
+        // of 'BitStringUtil'.  The behavior is undefined unless
+        // 'isSupported(tier)'.  Note that this function is intended for
+        // testing the kernels of each tier, which give identical results.
+};
+
 // ============================================================================
 //                              INLINE DEFINITIONS
 // ============================================================================
@@ -47,9 +47,13 @@ using bsl::flush;
 // [ 4] void assign1(uint64_t *bitString, St index, St numBits);
 // [ 5] void assignBits(U64 *bitString, St index, U64 srcBits, St nb);
 // [15] void andEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
+// [24] void andEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
 // [16] void minusEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
+// [24] void minusEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
 // [17] void orEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
+// [24] void orEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
 // [18] void xorEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
+// [24] void xorEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
 // [ 8] void copyRaw(U64 *dstBS, St dIdx, U64 *srcBS St sIdx, St nb);
 // [ 8] void copy(U64 *dstBS, St dIdx, U64 *srcBS St sIdx, St nb);
 // [ 7] void copyRaw(U64 *dstBS, St dIdx, U64 *srcBS, St sIdx, St nb);
@@ -70,18 +74,30 @@ using bsl::flush;
 // [19] St find0AtMaxIndex(const uint64_t *bitString, St length);
 // [19] St find0AtMaxIndex(U64 *bitString, St begin, St end);
 // [21] St find0AtMinIndex(const uint64_t *bitString, St length);
+// [24] St find0AtMinIndex(const uint64_t *bitString, St length);
 // [21] St find0AtMinIndex(U64 *bitString, St begin, St end);
+// [24] St find0AtMinIndex(U64 *bitString, St begin, St end);
 // [20] St find1AtMaxIndex(const uint64_t *bitString, St length);
 // [20] St find1AtMaxIndex(U64 *bitString, St begin, St end);
 // [22] St find1AtMinIndex(const uint64_t *bitString, St length);
+// [24] St find1AtMinIndex(const uint64_t *bitString, St length);
 // [22] St find1AtMinIndex(U64 *bitString, St begin, St end);
+// [24] St find1AtMinIndex(U64 *bitString, St begin, St end);
+// [23] St find0AtNthMaxIndex(U64 *bitString, St begin, St end, St n);
+// [23] St find0AtNthMinIndex(U64 *bitString, St begin, St end, St n);
+// [23] St find1AtNthMaxIndex(U64 *bitString, St begin, St end, St n);
+// [23] St find1AtNthMinIndex(U64 *bitString, St begin, St end, St n);
 // [ 6] bool isAny0(const uint64_t *bitString, St index, St numBits);
+// [24] bool isAny0(const uint64_t *bitString, St index, St numBits);
 // [ 6] bool isAny1(const uint64_t *bitString, St index, St numBits);
+// [24] bool isAny1(const uint64_t *bitString, St index, St numBits);
 // [13] St num0(const uint64_t *bitString, St index, St numBits);
+// [24] St num0(const uint64_t *bitString, St index, St numBits);
 // [13] St num1(const uint64_t *bitString, St index, St numBits);
+// [24] St num1(const uint64_t *bitString, St index, St numBits);
 // [12] OS& print(OS& stream, U64 *bs, St nb, int lvl, int spl);
 // ----------------------------------------------------------------------------
-// [23] USAGE EXAMPLE
+// [25] USAGE EXAMPLE
 // [ 1] void populateBitString(U64 *bitString, St idx, char *ascii);
 // [ 1] void populateBitStringHex(U64 *bitString, St idx, char *ascii);
 // ----------------------------------------------------------------------------
@@ -944,6 +960,56 @@ size_t findAtMinOracle(uint64_t *bitString,
     return k_INVALID_INDEX;
 }
 
+size_t findNthAtMaxOracle(uint64_t *bitString,
+                          size_t    begin,
+                          size_t    end,
+                          size_t    n,
+                          bool      value)
+    // Return the index of the specified 'n'th bit that matches the specified
+    // 'value', counting down from the highest-order bit, in the bit string
+    // starting at the specified 'begin' index and ending before the specified
+    // 'end' index in the specified 'bitString'.  The behavior is undefined
+    // unless '0 < n' and 'begin <= end'.  Note that this function provides an
+    // inefficient but reliable way of implementing the 'find*AtNthMaxIndex'
+    // functions for testing.
+{
+    ASSERT(0 < n);
+    ASSERT(begin <= end);
+
+    for (size_t ii = end; begin < ii; --ii) {
+        if (Util::bit(bitString, ii - 1) == value && 0 == --n) {
+            return ii - 1;                                            // RETURN
+        }
+    }
+
+    return k_INVALID_INDEX;
+}
+
+size_t findNthAtMinOracle(uint64_t *bitString,
+                          size_t    begin,
+                          size_t    end,
+                          size_t    n,
+                          bool      value)
+    // Return the index of the specified 'n'th bit that matches the specified
+    // 'value', counting up from the lowest-order bit, in the bit string
+    // starting at the specified 'begin' index and ending before the specified
+    // 'end' index in the specified 'bitString'.  The behavior is undefined
+    // unless '0 < n' and 'begin <= end'.  Note that this function provides an
+    // inefficient but reliable way of implementing the 'find*AtNthMinIndex'
+    // functions for testing.
+{
+    ASSERT(0 < n);
+    ASSERT(begin <= end);
+
+    for (size_t ii = begin; ii < end; ++ii) {
+        if (Util::bit(bitString, ii) == value && 0 == --n) {
+            return ii;                                                // RETURN
+        }
+    }
+
+    return k_INVALID_INDEX;
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -961,7 +1027,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 23: {
+      case 25: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1111,6 +1177,417 @@ int main(int argc, char *argv[])
     ASSERT(false == isOffMay28);
 //..
       } break;
+      case 24: {
+        // --------------------------------------------------------------------
+        // TESTING BULK WORD-WISE OPERATIONS
+        //   Operations spanning many whole words are dispatched to kernels
+        //   selected for the executing processor, that process several words
+        //   at a time.  Ensure that those kernels agree with bit-by-bit
+        //   evaluation, including on the partial blocks at either end.
+        //
+        // Concerns:
+        //: 1 That 'num1' and 'num0' count correctly over ranges whose whole
+        //:   words are not a multiple of the kernel block size.
+        //:
+        //: 2 That 'find[01]AtMinIndex' and 'isAny[01]' find the first
+        //:   qualifying bit wherever it lies within a long run of words.
+        //:
+        //: 3 That 'andEqual', 'minusEqual', 'orEqual', and 'xorEqual' give
+        //:   the correct result for word-aligned ranges, including when the
+        //:   destination and source are the same range, and when they
+        //:   partially overlap.
+        //:
+        //: 4 That the kernels of every tier supported by the executing
+        //:   processor, not only the tier selected by default, satisfy
+        //:   concerns 1..3.
+        //
+        // Plan:
+        //: 1 For a variety of lengths up to 40 words, fill arrays with
+        //:   pseudo-random words, and compare the results of the counting and
+        //:   searching functions, for a variety of word-aligned and unaligned
+        //:   ranges, against bit-by-bit loops using 'bit'.  Plant single
+        //:   bits in otherwise uniform arrays to exercise the searches.
+        //:   (C-1..2)
+        //:
+        //: 2 For the same lengths, apply each of the four bitwise-logical
+        //:   operations to word-aligned ranges of disjoint arrays, of a single
+        //:   array with itself, and of a single array with an overlapping
+        //:   range of itself, and compare the result to one computed bit by
+        //:   bit from copies of the original arrays.  (C-3)
+        //:
+        //: 3 Perform P-1..2 once for each tier for which
+        //:   'bdlb::BitStringUtil_Kernels::isSupported' returns 'true', after
+        //:   selecting it with 'setTier', and restore the original tier
+        //:   afterwards.  (C-4)
+        //
+        // Testing:
+        //   St num0(const uint64_t *bitString, St index, St numBits);
+        //   St num1(const uint64_t *bitString, St index, St numBits);
+        //   St find0AtMinIndex(const uint64_t *bitString, St length);
+        //   St find0AtMinIndex(U64 *bitString, St begin, St end);
+        //   St find1AtMinIndex(const uint64_t *bitString, St length);
+        //   St find1AtMinIndex(U64 *bitString, St begin, St end);
+        //   bool isAny0(const uint64_t *bitString, St index, St numBits);
+        //   bool isAny1(const uint64_t *bitString, St index, St numBits);
+        //   void andEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
+        //   void minusEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
+        //   void orEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
+        //   void xorEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING BULK WORD-WISE OPERATIONS\n"
+                             "=================================\n";
+
+        typedef bdlb::BitStringUtil_Kernels Kernels;
+
+        const int ORIGINAL_TIER = Kernels::selectedTier();
+
+        for (int tier = 0; tier < Kernels::k_NUM_TIERS; ++tier) {
+            if (!Kernels::isSupported(tier)) {
+                if (verbose) cout << "Tier " << tier << " not supported\n";
+                continue;
+            }
+            if (verbose) cout << "Tier " << tier << endl;
+
+            Kernels::setTier(tier);
+            ASSERTV(tier, tier == Kernels::selectedTier());
+
+            enum { k_MAX_WORDS = 40,
+                   k_MAX_BITS  = k_MAX_WORDS * k_BITS_PER_UINT64 };
+
+            // 'seed' is advanced by a linear congruential generator, so that
+            // the arrays are the same on every platform, and for every tier.
+
+            const uint64_t MUL  = 6364136223846793005ULL;
+            const uint64_t INC  = 1442695040888963407ULL;
+            uint64_t       seed = 0x9e3779b97f4a7c15ULL;
+
+            uint64_t array[k_MAX_WORDS];
+            uint64_t other[k_MAX_WORDS];
+            uint64_t result[k_MAX_WORDS];
+            uint64_t expected[k_MAX_WORDS];
+
+            static const size_t OFFSETS[] = { 0, 1, 63, 64, 65, 128, 200 };
+            enum { NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS };
+
+            if (verbose) cout << "Counting and searching\n";
+
+            for (int numWords = 1; numWords <= k_MAX_WORDS; ++numWords) {
+                const size_t numBits = numWords * k_BITS_PER_UINT64;
+
+                for (int fill = 0; fill < 3; ++fill) {
+                    for (int ii = 0; ii < numWords; ++ii) {
+                        seed = seed * MUL + INC;
+                        const uint64_t s7  = seed << 7;
+                        const uint64_t s13 = seed << 13;
+                        array[ii] = 0 == fill ? seed
+                                  : 1 == fill ? seed & s7 & s13
+                                  :             seed | s7 | s13;
+                    }
+
+                    for (int oi = 0; oi < NUM_OFFSETS; ++oi) {
+                        const size_t begin = OFFSETS[oi];
+                        if (begin > numBits) {
+                            continue;
+                        }
+                        for (size_t end = begin;
+                             end <= numBits;
+                             end += end < begin + 130 ? 1 : 37) {
+                            size_t count = 0;
+                            size_t min0  = Util::k_INVALID_INDEX;
+                            size_t min1  = Util::k_INVALID_INDEX;
+                            for (size_t kk = end; begin < kk--; ) {
+                                if (Util::bit(array, kk)) {
+                                    ++count;
+                                    min1 = kk;
+                                }
+                                else {
+                                    min0 = kk;
+                                }
+                            }
+
+                            const size_t num = end - begin;
+
+                            ASSERTV(tier, numWords, begin, end,
+                                    count == Util::num1(array, begin, num));
+                            ASSERTV(tier, numWords, begin, end,
+                                    num - count ==
+                                             Util::num0(array, begin, num));
+                            ASSERTV(tier, numWords, begin, end,
+                                    min0 == Util::find0AtMinIndex(array,
+                                                                  begin,
+                                                                  end));
+                            ASSERTV(tier, numWords, begin, end,
+                                    min1 == Util::find1AtMinIndex(array,
+                                                                  begin,
+                                                                  end));
+                            ASSERTV(tier, numWords, begin, end,
+                                    (min0 != Util::k_INVALID_INDEX) ==
+                                             Util::isAny0(array, begin, num));
+                            ASSERTV(tier, numWords, begin, end,
+                                    (min1 != Util::k_INVALID_INDEX) ==
+                                             Util::isAny1(array, begin, num));
+                            if (0 == begin) {
+                                ASSERTV(tier, numWords, end,
+                                        min0 == Util::find0AtMinIndex(array,
+                                                                      end));
+                                ASSERTV(tier, numWords, end,
+                                        min1 == Util::find1AtMinIndex(array,
+                                                                      end));
+                            }
+                        }
+                    }
+                }
+
+                // Plant a single distinguished bit in otherwise uniform words.
+
+                for (size_t planted = 0; planted < numBits; planted += 13) {
+                    bsl::fill(array, array + numWords, 0ULL);
+                    Util::assign1(array, planted);
+                    ASSERTV(tier, numWords, planted,
+                            planted == Util::find1AtMinIndex(array, numBits));
+                    ASSERTV(tier, numWords, planted,
+                            planted == Util::find1AtMinIndex(array,
+                                                             0,
+                                                             numBits));
+                    ASSERTV(tier, numWords, planted,
+                            Util::isAny1(array, 0, numBits));
+                    ASSERTV(tier, numWords, planted,
+                            !Util::isAny1(array, planted + 1,
+                                          numBits - planted - 1));
+                    ASSERTV(tier, numWords, planted,
+                            1 == Util::num1(array, 0, numBits));
+
+                    bsl::fill(array, array + numWords, ~0ULL);
+                    Util::assign0(array, planted);
+                    ASSERTV(tier, numWords, planted,
+                            planted == Util::find0AtMinIndex(array, numBits));
+                    ASSERTV(tier, numWords, planted,
+                            planted == Util::find0AtMinIndex(array,
+                                                             0,
+                                                             numBits));
+                    ASSERTV(tier, numWords, planted,
+                            Util::isAny0(array, 0, numBits));
+                    ASSERTV(tier, numWords, planted,
+                            !Util::isAny0(array, planted + 1,
+                                          numBits - planted - 1));
+                    ASSERTV(tier, numWords, planted,
+                            numBits - 1 == Util::num1(array, 0, numBits));
+                }
+            }
+
+            if (verbose) cout << "Bitwise-logical operations\n";
+
+            typedef void (*Operation)(uint64_t *, size_t, const uint64_t *,
+                                      size_t, size_t);
+
+            static const Operation OPERATIONS[] = { &Util::andEqual,
+                                                    &Util::minusEqual,
+                                                    &Util::orEqual,
+                                                    &Util::xorEqual };
+
+            for (int oper = 0; oper < 4; ++oper) {
+                const Operation OPER = OPERATIONS[oper];
+
+                for (int numWords = 1; numWords <= k_MAX_WORDS; ++numWords) {
+                    for (int ii = 0; ii < k_MAX_WORDS; ++ii) {
+                        seed = seed * MUL + INC;
+                        array[ii] = seed;
+                        seed = seed * MUL + INC;
+                        other[ii] = seed;
+                    }
+
+                    const size_t maxBits = k_MAX_BITS;
+
+                    for (int mode = 0; mode < 3; ++mode) {
+                        // 'mode' 0: 'other' into 'result'; 1: 'result' into
+                        // itself; 2: overlapping ranges of 'result'.
+
+                        const size_t dstIndex = 2 == mode
+                                              ? k_BITS_PER_UINT64
+                                              : 0;
+                        const size_t srcIndex = 0;
+
+                        for (size_t numBits = 0;
+                             dstIndex + numBits <= maxBits
+                          && numBits <= static_cast<size_t>(numWords)
+                                                        * k_BITS_PER_UINT64;
+                             numBits += numBits < 140 ? 1 : 61) {
+                            bsl::copy(array, array + k_MAX_WORDS, result);
+                            bsl::copy(array, array + k_MAX_WORDS, expected);
+
+                            const uint64_t *src = 0 == mode ? other : array;
+
+                            for (size_t kk = 0; kk < numBits; ++kk) {
+                                const bool d = Util::bit(array, dstIndex + kk);
+                                const bool s = Util::bit(src,   srcIndex + kk);
+                                const bool r = 0 == oper ? d && s
+                                             : 1 == oper ? d && !s
+                                             : 2 == oper ? d || s
+                                             :             d != s;
+                                Util::assign(expected, dstIndex + kk, r);
+                            }
+
+                            OPER(result,
+                                 dstIndex,
+                                 0 == mode ? other : result,
+                                 srcIndex,
+                                 numBits);
+
+                            ASSERTV(tier, oper, numWords, mode, numBits,
+                                    bsl::equal(result,
+                                               result + k_MAX_WORDS,
+                                               expected));
+                        }
+                    }
+                }
+            }
+        }
+
+        Kernels::setTier(ORIGINAL_TIER);
+      } break;
+      case 23: {
+        // --------------------------------------------------------------------
+        // TESTING 'find[01]AtNth{Max,Min}Index' METHODS
+        //   Ensure the methods return the expected value.
+        //
+        // Concerns:
+        //: 1 That the 'find[01]AtNthMinIndex' functions return the index of
+        //:   the 'n'th 0 or 1 bit in a range counting up from 'begin', or
+        //:   'k_INVALID_INDEX' if the range has fewer than 'n' such bits.
+        //:
+        //: 2 That the 'find[01]AtNthMaxIndex' functions return the index of
+        //:   the 'n'th 0 or 1 bit in a range counting down from 'end - 1', or
+        //:   'k_INVALID_INDEX' if the range has fewer than 'n' such bits.
+        //:
+        //: 3 That 'n == 1' is equivalent to the corresponding 'find*Index'
+        //:   function.
+        //:
+        //: 4 That the bit string is not modified.
+        //:
+        //: 5 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Iterate over different test arrays with 'setUpArray'.
+        //:   o Iterate over a variety of '[begin .. end)' ranges.
+        //:     1 For a variety of 'n' from 1 to one more than the number of
+        //:       bits in the range, compare the results of the four functions
+        //:       under test to those of 'findNthAtMinOracle' and
+        //:       'findNthAtMaxOracle'.  (C-1..2)
+        //:
+        //:     2 For 'n == 1', also compare against the 'find*Index'
+        //:       functions.  (C-3)
+        //:
+        //:   o Verify the array is unchanged.  (C-4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values.  (C-5)
+        //
+        // Testing:
+        //   St find0AtNthMaxIndex(U64 *bitString, St begin, St end, St n);
+        //   St find0AtNthMinIndex(U64 *bitString, St begin, St end, St n);
+        //   St find1AtNthMaxIndex(U64 *bitString, St begin, St end, St n);
+        //   St find1AtNthMinIndex(U64 *bitString, St begin, St end, St n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "TESTING 'find[01]AtNth{Max,Min}Index' METHODS\n"
+                      << "=============================================\n";
+
+        const size_t NUM_BITS = SET_UP_ARRAY_DIM * k_BITS_PER_UINT64;
+
+        uint64_t bits[SET_UP_ARRAY_DIM], control[SET_UP_ARRAY_DIM];
+
+        for (int ii = 0; ii < 150;) {
+            setUpArray(control, &ii, true);
+            wordCpy(bits, control, sizeof(bits));
+
+            if (veryVerbose) {
+                P_(ii);    P(pHex(bits, NUM_BITS));
+            }
+
+            for (size_t begin = 0; begin <= NUM_BITS; incSizeT(&begin,
+                                                               NUM_BITS)) {
+                for (size_t end = begin; end <= NUM_BITS; incSizeT(&end,
+                                                                 NUM_BITS)) {
+                    const size_t MAX_N = end - begin + 1;
+                    for (size_t n = 1; n <= MAX_N; incSizeT(&n, MAX_N)) {
+                        if (veryVeryVerbose) {
+                            P_(begin);    P_(end);    P(n);
+                        }
+
+                        const size_t EXP_MIN0 =
+                                 findNthAtMinOracle(bits, begin, end, n, 0);
+                        const size_t EXP_MIN1 =
+                                 findNthAtMinOracle(bits, begin, end, n, 1);
+                        const size_t EXP_MAX0 =
+                                 findNthAtMaxOracle(bits, begin, end, n, 0);
+                        const size_t EXP_MAX1 =
+                                 findNthAtMaxOracle(bits, begin, end, n, 1);
+
+                        const size_t MIN0 =
+                                 Util::find0AtNthMinIndex(bits, begin, end, n);
+                        const size_t MIN1 =
+                                 Util::find1AtNthMinIndex(bits, begin, end, n);
+                        const size_t MAX0 =
+                                 Util::find0AtNthMaxIndex(bits, begin, end, n);
+                        const size_t MAX1 =
+                                 Util::find1AtNthMaxIndex(bits, begin, end, n);
+
+                        ASSERTV(ii, begin, end, n, EXP_MIN0, MIN0,
+                                EXP_MIN0 == MIN0);
+                        ASSERTV(ii, begin, end, n, EXP_MIN1, MIN1,
+                                EXP_MIN1 == MIN1);
+                        ASSERTV(ii, begin, end, n, EXP_MAX0, MAX0,
+                                EXP_MAX0 == MAX0);
+                        ASSERTV(ii, begin, end, n, EXP_MAX1, MAX1,
+                                EXP_MAX1 == MAX1);
+
+                        if (1 == n) {
+                            ASSERT(MIN0 ==
+                                      Util::find0AtMinIndex(bits, begin, end));
+                            ASSERT(MIN1 ==
+                                      Util::find1AtMinIndex(bits, begin, end));
+                            ASSERT(MAX0 ==
+                                      Util::find0AtMaxIndex(bits, begin, end));
+                            ASSERT(MAX1 ==
+                                      Util::find1AtMaxIndex(bits, begin, end));
+                        }
+                    }
+                }
+            }
+
+            ASSERT(0 == wordCmp(bits, control, sizeof(bits)));
+        }
+
+        {
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_PASS(Util::find0AtNthMinIndex(bits, 0,   0, 1));
+            ASSERT_PASS(Util::find0AtNthMinIndex(bits, 0, 100, 1));
+            ASSERT_FAIL(Util::find0AtNthMinIndex(bits, 0, 100, 0));
+            ASSERT_FAIL(Util::find0AtNthMinIndex(bits, 1,   0, 1));
+            ASSERT_FAIL(Util::find0AtNthMinIndex(   0, 0,   0, 1));
+
+            ASSERT_PASS(Util::find1AtNthMinIndex(bits, 0,   0, 1));
+            ASSERT_PASS(Util::find1AtNthMinIndex(bits, 0, 100, 1));
+            ASSERT_FAIL(Util::find1AtNthMinIndex(bits, 0, 100, 0));
+            ASSERT_FAIL(Util::find1AtNthMinIndex(bits, 1,   0, 1));
+            ASSERT_FAIL(Util::find1AtNthMinIndex(   0, 0,   0, 1));
+
+            ASSERT_PASS(Util::find0AtNthMaxIndex(bits, 0,   0, 1));
+            ASSERT_PASS(Util::find0AtNthMaxIndex(bits, 0, 100, 1));
+            ASSERT_FAIL(Util::find0AtNthMaxIndex(bits, 0, 100, 0));
+            ASSERT_FAIL(Util::find0AtNthMaxIndex(bits, 1,   0, 1));
+            ASSERT_FAIL(Util::find0AtNthMaxIndex(   0, 0,   0, 1));
+
+            ASSERT_PASS(Util::find1AtNthMaxIndex(bits, 0,   0, 1));
+            ASSERT_PASS(Util::find1AtNthMaxIndex(bits, 0, 100, 1));
+            ASSERT_FAIL(Util::find1AtNthMaxIndex(bits, 0, 100, 0));
+            ASSERT_FAIL(Util::find1AtNthMaxIndex(bits, 1,   0, 1));
+            ASSERT_FAIL(Util::find1AtNthMaxIndex(   0, 0,   0, 1));
+        }
+      } break;
       case 22: {
         // --------------------------------------------------------------------
         // TESTING 'find1AtMinIndex' METHODS
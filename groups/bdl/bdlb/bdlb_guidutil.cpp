@@ -7,13 +7,23 @@ BSLS_IDENT_RCSID(RCSid_bdlb_guidutil_cpp,"$Id$ $CSID$")
 #include <bdlb_guid.h>
 #include <bdlb_randomdevice.h>
 
+#include <bslma_newdeleteallocator.h>
 #include <bslmf_assert.h>
+#include <bslmt_once.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
 #include <bsls_byteorder.h>
+#include <bsls_log.h>
 #include <bsls_platform.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
-#include <bsl_sstream.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <pthread.h>
+#endif
 
 namespace BloombergLP {
 namespace bdlb {
@@ -109,8 +119,317 @@ int vaildateGuidString(bslstl::StringRef guidString)
     return 0;
 }
 
+const unsigned char k_NOT_HEX = 0xFF;
+
+const unsigned char k_HEX_VALUE[256] = {
+    // The value of each hexadecimal digit character, indexed by character,
+    // and 'k_NOT_HEX' for every other character.
+
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x00
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x08
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x10
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x18
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x20
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x28
+       0,    1,    2,    3,    4,    5,    6,    7,  // 0x30
+       8,    9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x38
+    0xFF,   10,   11,   12,   13,   14,   15, 0xFF,  // 0x40
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x48
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x50
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x58
+    0xFF,   10,   11,   12,   13,   14,   15, 0xFF,  // 0x60
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x68
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x70
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x78
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x80
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x88
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x90
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0x98
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0xA0
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0xA8
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0xB0
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0xB8
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0xC0
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0xC8
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0xD0
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0xD8
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0xE0
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0xE8
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0xF0
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // 0xF8
+};
+
+const char k_HEX_DIGITS[] = "0123456789abcdef";
+
+const int k_CANONICAL_OFFSETS[Guid::k_GUID_NUM_BYTES] = {
+    // The offset of the two hexadecimal digits of each byte of a GUID in its
+    // canonical, 36-character, string form.
+
+    0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34
+};
+
+bool isCanonicalGuidString(bslstl::StringRef guidString)
+    // Return 'true' if the specified 'guidString' has the length and hyphen
+    // positions of the canonical string form of a GUID (e.g.,
+    // "00010203-0405-0607-0809-0a0b0c0d0e0f"), and 'false' otherwise.  Note
+    // that the remaining characters are not inspected.
+{
+    return GuidUtil::k_GUID_NUM_CHARS == guidString.length()
+        && '-' == guidString[8]
+        && '-' == guidString[13]
+        && '-' == guidString[18]
+        && '-' == guidString[23];
+}
+
+int parseCanonicalGuidString(Guid *result, const char *guidString)
+    // Load, into the specified 'result', the value of the GUID in the
+    // canonical string form addressed by the specified 'guidString'.  Return
+    // 0 on success, and a non-zero value (with no effect on 'result') if any
+    // of the 32 hexadecimal digit positions of 'guidString' holds a character
+    // that is not a hexadecimal digit.  The behavior is undefined unless
+    // 'guidString' satisfies 'isCanonicalGuidString'.
+{
+    unsigned char bytes[Guid::k_GUID_NUM_BYTES];
+    unsigned char invalid = 0;
+
+    for (int i = 0; i < Guid::k_GUID_NUM_BYTES; ++i) {
+        const unsigned char *digits =
+                            reinterpret_cast<const unsigned char *>(guidString)
+                                                      + k_CANONICAL_OFFSETS[i];
+        const unsigned char  upper  = k_HEX_VALUE[digits[0]];
+        const unsigned char  lower  = k_HEX_VALUE[digits[1]];
+
+        invalid  = static_cast<unsigned char>(invalid | upper | lower);
+        bytes[i] = static_cast<unsigned char>((upper << 4) | (lower & 0x0F));
+    }
+
+    // Every valid digit value is less than 16, and 'k_NOT_HEX' is not.
+
+    if (invalid & 0xF0) {
+        return -1;                                                    // RETURN
+    }
+
+    *result = Guid(bytes);
+    return 0;
+}
+
+void formatGuid(char *result, const Guid& guid)
+    // Write the canonical string form of the specified 'guid' into the
+    // 'GuidUtil::k_GUID_NUM_CHARS' characters of the array referred to by the
+    // specified 'result'.
+{
+    for (int i = 0; i < Guid::k_GUID_NUM_BYTES; ++i) {
+        char *digits = result + k_CANONICAL_OFFSETS[i];
+        digits[0] = k_HEX_DIGITS[guid[i] >> 4];
+        digits[1] = k_HEX_DIGITS[guid[i] & 0x0F];
+    }
+    result[8] = result[13] = result[18] = result[23] = '-';
+}
+
+void setVersionAndVariant(unsigned char *bytes)
+    // Set the 'version' bits of the GUID having the 16 specified 'bytes' to
+    // '0100' and its 'variant' bits to '10'.
+{
+    typedef unsigned char uc;
+    bytes[6] = uc(0x40 | (bytes[6] & 0x0F));
+    bytes[8] = uc(0x80 | (bytes[8] & 0x3F));
+}
+
+inline
+unsigned int nextPcg32(bsls::Types::Uint64 *state,
+                       bsls::Types::Uint64  increment)
+    // Advance the PCG stream having the specified 'state' and 'increment',
+    // and return the next 32 random bits of the stream (PCG-XSH-RR).
+{
+    const bsls::Types::Uint64 old = *state;
+    *state = old * 6364136223846793005ULL + increment;
+
+    const unsigned int xorShifted =
+                          static_cast<unsigned int>(((old >> 18) ^ old) >> 27);
+    const unsigned int rotation   = static_cast<unsigned int>(old >> 59);
+
+    return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+}
+
+                        // ----------------------
+                        // struct ThreadGuidState
+                        // ----------------------
+
+struct ThreadGuidState {
+    // This 'struct' holds the 'GuidState' used by 'generateNonSecure' on one
+    // thread, together with the information needed to decide when to reseed
+    // it.
+
+    // DATA
+    GuidState   d_state;           // generator state
+
+    bsl::size_t d_numUntilReseed;  // GUIDs remaining before reseeding
+
+    int         d_forkGeneration;  // value of 'g_forkGeneration' when
+                                   // 'd_state' was seeded
+};
+
+bsls::AtomicInt g_forkGeneration(0);
+    // The number of times the current process is known to have been created
+    // by 'fork' (from its original ancestor), used to reseed the inherited
+    // thread states in the child, which would otherwise generate the same
+    // GUIDs as the parent.
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(ThreadGuidState *, g_threadGuidState, 0);
+#endif
+
+extern "C" void incrementForkGeneration()
+    // Increment 'g_forkGeneration'.  Note that this function is registered
+    // to be invoked in the child process after a 'fork'.
+{
+    ++g_forkGeneration;
+}
+
+extern "C" void removeThreadGuidState(void *threadState)
+    // Destroy the specified 'threadState' and release its memory.  Note that
+    // this function is invoked when a thread having a 'ThreadGuidState'
+    // exits.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_threadGuidState = 0;
+#endif
+
+    bslma::NewDeleteAllocator::singleton().deleteObject(
+                              static_cast<ThreadGuidState *>(threadState));
+}
+
+const bslmt::ThreadUtil::Key& threadGuidStateKey()
+    // Return the key of the thread-specific storage holding the
+    // 'ThreadGuidState' of each thread, creating the key (and registering
+    // 'incrementForkGeneration') on the first invocation.
+{
+    static bslmt::ThreadUtil::Key s_key;
+    BSLMT_ONCE_DO {
+        bslmt::ThreadUtil::createKey(&s_key, &removeThreadGuidState);
+#ifdef BSLS_PLATFORM_OS_UNIX
+        pthread_atfork(0, 0, &incrementForkGeneration);
+#endif
+    }
+    return s_key;
+}
+
+ThreadGuidState *getThreadGuidState()
+    // Return the 'ThreadGuidState' of the calling thread, creating it if
+    // necessary.  Note that the memory of the object is supplied by the
+    // 'bslma::NewDeleteAllocator' singleton, since the object must outlive
+    // any allocator installed by the application.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    if (g_threadGuidState) {
+        return g_threadGuidState;                                     // RETURN
+    }
+#endif
+
+    const bslmt::ThreadUtil::Key& key = threadGuidStateKey();
+
+    ThreadGuidState *threadState =
+                 static_cast<ThreadGuidState *>(bslmt::ThreadUtil::getSpecific(
+                                                                        key));
+    if (!threadState) {
+        threadState = new (bslma::NewDeleteAllocator::singleton())
+                                                             ThreadGuidState();
+        threadState->d_numUntilReseed =
+                                       GuidUtil::k_NON_SECURE_RESEED_INTERVAL;
+        threadState->d_forkGeneration = g_forkGeneration.loadRelaxed();
+
+        if (0 != bslmt::ThreadUtil::setSpecific(key, threadState)) {
+            bsls::Log::platformDefaultMessageHandler(
+                  bsls::LogSeverity::e_ERROR,
+                  __FILE__,
+                  __LINE__,
+                  "Failed to add GUID state to thread specific storage.");
+            BSLS_ASSERT(false);
+        }
+    }
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_threadGuidState = threadState;
+#endif
+
+    return threadState;
+}
+
 }  // close unnamed namespace
 
+                              // ---------------
+                              // class GuidState
+                              // ---------------
+
+// CREATORS
+GuidState::GuidState()
+{
+    reseed();
+}
+
+GuidState::GuidState(const bsls::Types::Uint64 *seed)
+{
+    this->seed(seed);
+}
+
+// MANIPULATORS
+void GuidState::generate(Guid *result, bsl::size_t numGuids)
+{
+    generate(reinterpret_cast<unsigned char *>(result), numGuids);
+}
+
+void GuidState::generate(unsigned char *result, bsl::size_t numGuids)
+{
+    BSLS_ASSERT(result || 0 == numGuids);
+
+    unsigned char *bytes = result;
+    unsigned char *end   = bytes + numGuids * Guid::k_GUID_NUM_BYTES;
+
+    while (bytes != end) {
+        for (int g = 0; g < k_GENERATOR_COUNT; ++g, bytes += 4) {
+            const unsigned int bits = nextPcg32(d_state + g, d_increment[g]);
+
+            bytes[0] = static_cast<unsigned char>(bits);
+            bytes[1] = static_cast<unsigned char>(bits >>  8);
+            bytes[2] = static_cast<unsigned char>(bits >> 16);
+            bytes[3] = static_cast<unsigned char>(bits >> 24);
+        }
+        setVersionAndVariant(bytes - Guid::k_GUID_NUM_BYTES);
+    }
+}
+
+void GuidState::reseed()
+{
+    bsls::Types::Uint64 words[k_SEED_LENGTH] = { 0 };
+    RandomDevice::getRandomBytesNonBlocking(
+                                      reinterpret_cast<unsigned char *>(words),
+                                      sizeof words);
+    seed(words);
+}
+
+void GuidState::seed(const bsls::Types::Uint64 *seed)
+{
+    BSLS_ASSERT(seed);
+
+    // This is the seeding procedure of the reference PCG implementation; the
+    // increment of each stream must be odd.
+
+    for (int g = 0; g < k_GENERATOR_COUNT; ++g) {
+        d_increment[g] = (seed[2 * g + 1] << 1) | 1;
+        d_state[g]     = 0;
+        nextPcg32(d_state + g, d_increment[g]);
+        d_state[g]    += seed[2 * g];
+        nextPcg32(d_state + g, d_increment[g]);
+    }
+}
+
+                              // ---------------
+                              // struct GuidUtil
+                              // ---------------
+
+// PUBLIC CLASS DATA
+const bsl::size_t GuidUtil::k_NON_SECURE_RESEED_INTERVAL;
+
 // CLASS METHODS
 Guid GuidUtil::generate()
 {
@@ -125,9 +444,7 @@ void GuidUtil::generate(unsigned char *result, bsl::size_t numGuids)
     unsigned char *end = bytes + numGuids * Guid::k_GUID_NUM_BYTES;
     RandomDevice::getRandomBytesNonBlocking(bytes, end - bytes);
     while (bytes != end) {
-        typedef unsigned char uc;
-        bytes[6] = uc(0x40 | (bytes[6] & 0x0F));
-        bytes[8] = uc(0x80 | (bytes[8] & 0x3F));
+        setVersionAndVariant(bytes);
         bytes += Guid::k_GUID_NUM_BYTES;
     }
 }
@@ -137,6 +454,48 @@ void GuidUtil::generate(Guid *result, bsl::size_t numGuids)
     generate(reinterpret_cast<unsigned char *>(result), numGuids);
 }
 
+Guid GuidUtil::generateNonSecure()
+{
+    Guid result;
+    generateNonSecure(&result);
+    return result;
+}
+
+void GuidUtil::generateNonSecure(unsigned char *result, bsl::size_t numGuids)
+{
+    BSLS_ASSERT(result || 0 == numGuids);
+
+    ThreadGuidState *threadState = getThreadGuidState();
+
+    const int forkGeneration = g_forkGeneration.loadRelaxed();
+    if (threadState->d_forkGeneration != forkGeneration) {
+        threadState->d_state.reseed();
+        threadState->d_numUntilReseed = k_NON_SECURE_RESEED_INTERVAL;
+        threadState->d_forkGeneration = forkGeneration;
+    }
+
+    while (numGuids) {
+        if (0 == threadState->d_numUntilReseed) {
+            threadState->d_state.reseed();
+            threadState->d_numUntilReseed = k_NON_SECURE_RESEED_INTERVAL;
+        }
+
+        const bsl::size_t count = bsl::min(numGuids,
+                                           threadState->d_numUntilReseed);
+
+        threadState->d_state.generate(result, count);
+        threadState->d_numUntilReseed -= count;
+
+        result   += count * Guid::k_GUID_NUM_BYTES;
+        numGuids -= count;
+    }
+}
+
+void GuidUtil::generateNonSecure(Guid *result, bsl::size_t numGuids)
+{
+    generateNonSecure(reinterpret_cast<unsigned char *>(result), numGuids);
+}
+
 bsls::Types::Uint64 GuidUtil::getLeastSignificantBits(const Guid& guid)
 {
     bsls::Types::Uint64 result = 0;
@@ -153,6 +512,12 @@ bsls::Types::Uint64 GuidUtil::getMostSignificantBits(const Guid& guid)
 
 int GuidUtil::guidFromString(Guid *result, bslstl::StringRef guidString)
 {
+    BSLS_ASSERT(result);
+
+    if (isCanonicalGuidString(guidString)) {
+        return parseCanonicalGuidString(result, guidString.data());   // RETURN
+    }
+
     int valid = vaildateGuidString(guidString);
     if (0 != valid) {
         return -1;                                                    // RETURN
@@ -191,11 +556,28 @@ Guid GuidUtil::guidFromString(bslstl::StringRef guidString)
     return result;
 }
 
+bsl::size_t GuidUtil::guidFromString(Guid                    *results,
+                                     const bslstl::StringRef *guidStrings,
+                                     bsl::size_t              numGuids)
+{
+    BSLS_ASSERT(results     || 0 == numGuids);
+    BSLS_ASSERT(guidStrings || 0 == numGuids);
+
+    for (bsl::size_t i = 0; i < numGuids; ++i) {
+        if (0 != guidFromString(results + i, guidStrings[i])) {
+            return i;                                                 // RETURN
+        }
+    }
+    return numGuids;
+}
+
 void GuidUtil::guidToString(bsl::string *result, const Guid& guid)
 {
-    bsl::ostringstream oss;
-    guid.print(oss, 0, -1);
-    *result = oss.str();
+    BSLS_ASSERT(result);
+
+    char buffer[k_GUID_NUM_CHARS];
+    formatGuid(buffer, guid);
+    result->assign(buffer, k_GUID_NUM_CHARS);
 }
 
 bsl::string GuidUtil::guidToString(const Guid& guid)
@@ -205,6 +587,18 @@ bsl::string GuidUtil::guidToString(const Guid& guid)
     return result;
 }
 
+void GuidUtil::guidToString(char        *result,
+                            const Guid  *guids,
+                            bsl::size_t  numGuids)
+{
+    BSLS_ASSERT(result || 0 == numGuids);
+    BSLS_ASSERT(guids  || 0 == numGuids);
+
+    for (bsl::size_t i = 0; i < numGuids; ++i, result += k_GUID_NUM_CHARS) {
+        formatGuid(result, guids[i]);
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -9,12 +9,44 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlb::GuidUtil: namespace for methods for creating UUIDs.
+//  bdlb::GuidState: state of a fast, non-secure, pseudo-random GUID generator
 //
 //@SEE_ALSO: bdlb::Guid
 //
 //@DESCRIPTION: This component provides a struct, 'bdlb::GuidUtil', that
 // serves as a namespace for utility functions that create and work with
-// Globally Unique Identifiers (GUIDs).
+// Globally Unique Identifiers (GUIDs).  This component also provides a
+// mechanism, 'bdlb::GuidState', holding the state of a fast pseudo-random
+// generator of GUIDs.
+//
+///Secure and Non-Secure Generation
+///--------------------------------
+// The 'GuidUtil::generate' methods obtain every bit of every GUID from
+// 'bdlb::RandomDevice::getRandomBytesNonBlocking', which (on UNIX-like
+// platforms) opens and reads '/dev/urandom' on each call.  These GUIDs are
+// suitable where an adversary must not be able to predict them, but are
+// comparatively expensive to produce.
+//
+// The 'GuidUtil::generateNonSecure' methods instead obtain the random bits of
+// each GUID from a per-thread 'bdlb::GuidState', a set of
+// 'GuidState::k_GENERATOR_COUNT' independent 32-bit PCG (permuted congruential
+// generator) streams that is seeded from 'RandomDevice' when a thread first
+// generates a GUID, and reseeded after every
+// 'GuidUtil::k_NON_SECURE_RESEED_INTERVAL' GUIDs, and in the child process of
+// a 'fork'.  These GUIDs are version 4 GUIDs that are unique with
+// overwhelming probability, and are orders of magnitude cheaper to produce,
+// but should *not* be used where unpredictability is a security requirement.
+// A 'GuidState' object can also be used directly (e.g., with an explicit seed
+// to obtain a reproducible sequence of GUIDs in a test).
+//
+///Bulk Conversion
+///---------------
+// In addition to the single-GUID conversions, 'GuidUtil' provides overloads
+// of 'guidToString' and 'guidFromString' that convert arrays of GUIDs.  The
+// array 'guidToString' writes 'GuidUtil::k_GUID_NUM_CHARS' characters per
+// GUID, with no separators and no null terminators, into a caller-supplied
+// buffer.  Both 'guidToString' and the canonical 36-character form of
+// 'guidFromString' are implemented with table lookups rather than streams.
 //
 ///Grammar for GUIDs Used in 'GuidFromString'
 ///------------------------------------------
@@ -149,6 +181,42 @@ BSLS_IDENT("$Id: $")
 //      assert(e2 < e3 || e3 < e2);
 //      assert(e1 < e3 || e3 < e1);
 //..
+//
+///Example 2: Minting Request Identifiers
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that a server assigns a GUID to each incoming request, for tracing
+// purposes only, at a rate of millions of requests per second.  The request
+// identifiers need to be unique, but not unpredictable, so we use the
+// non-secure generator, generating the identifiers in batches:
+//..
+//  bdlb::Guid requestIds[64];
+//  bdlb::GuidUtil::generateNonSecure(requestIds, 64);
+//
+//  assert(4 == bdlb::GuidUtil::getVersion(requestIds[0]));
+//  assert(requestIds[0] != requestIds[63]);
+//..
+// Then, we format all of the identifiers for a log record in a single call:
+//..
+//  char text[64 * bdlb::GuidUtil::k_GUID_NUM_CHARS];
+//  bdlb::GuidUtil::guidToString(text, requestIds, 64);
+//
+//  assert(bdlb::GuidUtil::guidToString(requestIds[1]) ==
+//         bsl::string(text + bdlb::GuidUtil::k_GUID_NUM_CHARS,
+//                     bdlb::GuidUtil::k_GUID_NUM_CHARS));
+//..
+// Finally, we parse the identifiers back into GUIDs in a single call, which
+// returns the number of leading strings that were successfully parsed:
+//..
+//  bslstl::StringRef strings[64];
+//  for (int i = 0; i < 64; ++i) {
+//      strings[i].assign(text + i * bdlb::GuidUtil::k_GUID_NUM_CHARS,
+//                        bdlb::GuidUtil::k_GUID_NUM_CHARS);
+//  }
+//
+//  bdlb::Guid parsed[64];
+//  assert(64 == bdlb::GuidUtil::guidFromString(parsed, strings, 64));
+//  assert(bsl::equal(parsed, parsed + 64, requestIds));
+//..
 
 #include <bdlscm_version.h>
 
@@ -163,6 +231,86 @@ BSLS_IDENT("$Id: $")
 namespace BloombergLP {
 namespace bdlb {
 
+                              // ===============
+                              // class GuidState
+                              // ===============
+
+class GuidState {
+    // This class holds the state of a fast, *non*-*cryptographic*,
+    // pseudo-random generator of RFC 4122 version 4 GUIDs, consisting of
+    // 'k_GENERATOR_COUNT' independent 32-bit PCG streams, each of which
+    // supplies 32 of the 128 bits of every GUID.  Note that a 'GuidState'
+    // cannot be copied, since two objects having the same state would generate
+    // the same GUIDs.
+
+  public:
+    // TYPES
+    enum {
+        k_GENERATOR_COUNT = 4,                      // number of PCG streams
+
+        k_SEED_LENGTH     = 2 * k_GENERATOR_COUNT   // number of 'Uint64' seed
+                                                    // words
+    };
+
+  private:
+    // DATA
+    bsls::Types::Uint64 d_state[k_GENERATOR_COUNT];      // stream states
+    bsls::Types::Uint64 d_increment[k_GENERATOR_COUNT];  // stream increments
+                                                         // (odd)
+
+  private:
+    // NOT IMPLEMENTED
+    GuidState(const GuidState&);
+    GuidState& operator=(const GuidState&);
+
+  public:
+    // CREATORS
+    GuidState();
+        // Create a generator state seeded from
+        // 'RandomDevice::getRandomBytesNonBlocking'.
+
+    explicit GuidState(const bsls::Types::Uint64 *seed);
+        // Create a generator state seeded from the 'k_SEED_LENGTH' words of
+        // the array referred to by the specified 'seed'.  Two objects created
+        // from the same seed generate the same sequence of GUIDs.  The
+        // behavior is undefined unless 'seed' refers to an array of at least
+        // 'k_SEED_LENGTH' words.
+
+    //! ~GuidState() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void generate(Guid *result, bsl::size_t numGuids = 1);
+        // Generate a sequence of GUIDs meeting the RFC 4122 version 4
+        // specification from this generator state, and load the resulting
+        // GUIDs into the array referred to by the specified 'result'.
+        // Optionally specify 'numGuids', indicating the number of GUIDs to
+        // load into the 'result' array.  If 'numGuids' is not supplied, a
+        // default of 1 is used.  The behavior is undefined unless 'result'
+        // refers to a contiguous sequence of at least 'numGuids' Guid
+        // objects.
+
+    void generate(unsigned char *result, bsl::size_t numGuids = 1);
+        // Generate a sequence of GUIDs meeting the RFC 4122 version 4
+        // specification from this generator state, and load the bytes of the
+        // resulting GUIDs into the array referred to by the specified
+        // 'result'.  Optionally specify 'numGuids', indicating the number of
+        // GUIDs to load into the 'result' array.  If 'numGuids' is not
+        // supplied, a default of 1 is used.  The behavior is undefined unless
+        // 'result' refers to a contiguous sequence of at least
+        // '16 * numGuids' bytes.
+
+    void reseed();
+        // Reseed this generator state from
+        // 'RandomDevice::getRandomBytesNonBlocking'.
+
+    void seed(const bsls::Types::Uint64 *seed);
+        // Reseed this generator state from the 'k_SEED_LENGTH' words of the
+        // array referred to by the specified 'seed'.  The behavior is
+        // undefined unless 'seed' refers to an array of at least
+        // 'k_SEED_LENGTH' words.
+};
+
                               // ===============
                               // struct GuidUtil
                               // ===============
@@ -171,6 +319,16 @@ struct GuidUtil {
     // This 'struct' provides a namespace for functions that create Universally
     // Unique Identifiers per RFC 4122 (http://www.ietf.org/rfc/rfc4122.txt).
 
+    // TYPES
+    enum {
+        k_GUID_NUM_CHARS = 36  // number of characters in the string form of a
+                               // GUID produced by 'guidToString'
+    };
+
+    static const bsl::size_t k_NON_SECURE_RESEED_INTERVAL = 1 << 20;
+        // The number of GUIDs generated by 'generateNonSecure' on a thread
+        // between successive reseedings of that thread's generator state.
+
     // CLASS METHODS
     static void generate(Guid *result, bsl::size_t numGuids = 1);
         // Generate a sequence of GUIDs meeting the RFC 4122 version 4
@@ -199,6 +357,37 @@ struct GuidUtil {
         // specification, consisting of 122 randomly generated bits, two
         // 'variant' bits set to '10' and four 'version' bits set to '0100'.
 
+    static void generateNonSecure(Guid *result, bsl::size_t numGuids = 1);
+        // Generate a sequence of GUIDs meeting the RFC 4122 version 4
+        // specification from the generator state of the calling thread (see
+        // {Secure and Non-Secure Generation}), and load the resulting GUIDs
+        // into the array referred to by the specified 'result'.  Optionally
+        // specify 'numGuids', indicating the number of GUIDs to load into the
+        // 'result' array.  If 'numGuids' is not supplied, a default of 1 is
+        // used.  The behavior is undefined unless 'result' refers to a
+        // contiguous sequence of at least 'numGuids' Guid objects.  Note that
+        // the generated GUIDs are not suitable where unpredictability is a
+        // security requirement.
+
+    static void generateNonSecure(unsigned char *result,
+                                  bsl::size_t    numGuids = 1);
+        // Generate a sequence of GUIDs meeting the RFC 4122 version 4
+        // specification from the generator state of the calling thread (see
+        // {Secure and Non-Secure Generation}), and load the bytes of the
+        // resulting GUIDs into the array referred to by the specified
+        // 'result'.  Optionally specify 'numGuids', indicating the number of
+        // GUIDs to load into the 'result' array.  If 'numGuids' is not
+        // supplied, a default of 1 is used.  The behavior is undefined unless
+        // 'result' refers to a contiguous sequence of at least
+        // '16 * numGuids' bytes.  Note that the generated GUIDs are not
+        // suitable where unpredictability is a security requirement.
+
+    static Guid generateNonSecure();
+        // Generate and return a single GUID meeting the RFC 4122 version 4
+        // specification from the generator state of the calling thread (see
+        // {Secure and Non-Secure Generation}).  Note that the generated GUID
+        // is not suitable where unpredictability is a security requirement.
+
     static int guidFromString(Guid *result, bslstl::StringRef guidString);
         // Parse the specified 'guidString' (in {GUID String Format}) and load
         // its value into the specified 'result'.  Return 0 if 'result'
@@ -209,6 +398,19 @@ struct GuidUtil {
         // return the converted GUID, or a default-constructed Guid if the
         // string is improperly formatted.
 
+    static bsl::size_t guidFromString(Guid                    *results,
+                                      const bslstl::StringRef *guidStrings,
+                                      bsl::size_t              numGuids);
+        // Parse each of the specified 'numGuids' elements of the specified
+        // 'guidStrings' array (in {GUID String Format}), in order, and load
+        // its value into the corresponding element of the specified 'results'
+        // array, stopping at the first string that is improperly formatted.
+        // Return the number of strings that were successfully parsed.  The
+        // element of 'results' corresponding to the first improperly formatted
+        // string, and all subsequent elements, are unchanged.  The behavior is
+        // undefined unless 'results' and 'guidStrings' each refer to an array
+        // of at least 'numGuids' elements.
+
     static void guidToString(bsl::string *result, const Guid& guid);
         // Serialize the specified 'guid' into the specified 'result'.  The
         // 'result' string will be in a format suitable for 'guidFromString'.
@@ -217,6 +419,18 @@ struct GuidUtil {
         // Convert the specified 'guid' into a string suitable for
         // 'guidFromString', and return the string.
 
+    static void guidToString(char        *result,
+                             const Guid  *guids,
+                             bsl::size_t  numGuids);
+        // Serialize each of the specified 'numGuids' elements of the specified
+        // 'guids' array into 'k_GUID_NUM_CHARS' consecutive characters of the
+        // array referred to by the specified 'result', in the format produced
+        // by the single-GUID 'guidToString'.  No separators or null
+        // terminators are written.  The behavior is undefined unless 'result'
+        // refers to an array of at least 'k_GUID_NUM_CHARS * numGuids'
+        // characters and 'guids' refers to an array of at least 'numGuids'
+        // elements.
+
     static int getVersion(const bdlb::Guid& guid);
         // Return the version of the specified 'guid' object.  The behavior is
         // undefined unless the contents of the 'guid' object are compliant
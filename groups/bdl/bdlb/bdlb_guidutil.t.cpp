@@ -11,15 +11,24 @@
 
 #include <bslmf_assert.h>
 
+#include <bslmt_threadutil.h>
+
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_byteorder.h>
 #include <bsls_review.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -45,8 +54,21 @@ using namespace bsl;
 // [4] bsl::string guidToString(const Guid& guid)
 // [5] Uint64 getMostSignificantBits(const Guid& guid)
 // [6] Uint64 getLeastSignificantBits(const Guid& guid)
+// [8] void generateNonSecure(Guid *out, size_t cnt)
+// [8] void generateNonSecure(unsigned char *out, size_t cnt)
+// [8] Guid generateNonSecure()
+// [9] size_t guidFromString(Guid *, const StrRef *, size_t)
+// [9] void guidToString(char *result, const Guid *guids, size_t num)
+//
+// GuidState
+// [7] GuidState()
+// [7] explicit GuidState(const Uint64 *seed)
+// [7] void generate(Guid *result, size_t numGuids)
+// [7] void generate(unsigned char *result, size_t numGuids)
+// [7] void reseed()
+// [7] void seed(const Uint64 *seed)
 // ----------------------------------------------------------------------------
-// [7] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -178,6 +200,50 @@ const Element &V0 = VALUES[0],            // V0, V1, ... are used in
               &V7 = VALUES[7],
               &V8 = VALUES[8];
 
+//=============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+enum { k_NUM_GUIDS_PER_THREAD = 10000 };
+
+extern "C" void *generateNonSecureThread(void *guids)
+    // Load, into 'k_NUM_GUIDS_PER_THREAD' elements of the array of 'Guid'
+    // objects addressed by the specified 'guids', GUIDs obtained by calls to
+    // 'GuidUtil::generateNonSecure' of various sizes, and return 0.
+{
+    Obj *result = static_cast<Obj *>(guids);
+    Obj *end    = result + k_NUM_GUIDS_PER_THREAD;
+
+    for (bsl::size_t count = 1; result != end; ++count) {
+        count   = bsl::min<bsl::size_t>(count, end - result);
+        Util::generateNonSecure(result, count);
+        result += count;
+    }
+    return 0;
+}
+
+bool areVersion4(const Obj *guids, bsl::size_t numGuids)
+    // Return 'true' if each of the specified 'numGuids' elements of the
+    // specified 'guids' array has the RFC 4122 version 4 'version' and
+    // 'variant' bits, and 'false' otherwise.
+{
+    for (bsl::size_t i = 0; i < numGuids; ++i) {
+        if (4 != Util::getVersion(guids[i]) || 0x80 != (guids[i][8] & 0xC0)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bool areUnique(const Obj *guids, bsl::size_t numGuids)
+    // Return 'true' if no two of the specified 'numGuids' elements of the
+    // specified 'guids' array have the same value, and 'false' otherwise.
+{
+    bsl::vector<Obj> sorted(guids, guids + numGuids);
+    bsl::sort(sorted.begin(), sorted.end());
+    return sorted.end() == bsl::adjacent_find(sorted.begin(), sorted.end());
+}
+
 //=============================================================================
 //                              USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -295,7 +361,7 @@ int main(int argc, char *argv[])
 
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
     switch (test)  { case 0:
-      case 7: {
+      case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -328,6 +394,567 @@ int main(int argc, char *argv[])
         ASSERT(e1 < e2 || e2 < e1);
         ASSERT(e2 < e3 || e3 < e2);
         ASSERT(e1 < e3 || e3 < e1);
+
+///Example 2: Minting Request Identifiers
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that a server assigns a GUID to each incoming request, for tracing
+// purposes only, at a rate of millions of requests per second.  The request
+// identifiers need to be unique, but not unpredictable, so we use the
+// non-secure generator, generating the identifiers in batches:
+//..
+        bdlb::Guid requestIds[64];
+        bdlb::GuidUtil::generateNonSecure(requestIds, 64);
+
+        ASSERT(4 == bdlb::GuidUtil::getVersion(requestIds[0]));
+        ASSERT(requestIds[0] != requestIds[63]);
+//..
+// Then, we format all of the identifiers for a log record in a single call:
+//..
+        char text[64 * bdlb::GuidUtil::k_GUID_NUM_CHARS];
+        bdlb::GuidUtil::guidToString(text, requestIds, 64);
+
+        ASSERT(bdlb::GuidUtil::guidToString(requestIds[1]) ==
+               bsl::string(text + bdlb::GuidUtil::k_GUID_NUM_CHARS,
+                           bdlb::GuidUtil::k_GUID_NUM_CHARS));
+//..
+// Finally, we parse the identifiers back into GUIDs in a single call, which
+// returns the number of leading strings that were successfully parsed:
+//..
+        bslstl::StringRef strings[64];
+        for (int i = 0; i < 64; ++i) {
+            strings[i].assign(text + i * bdlb::GuidUtil::k_GUID_NUM_CHARS,
+                              bdlb::GuidUtil::k_GUID_NUM_CHARS);
+        }
+
+        bdlb::Guid parsed[64];
+        ASSERT(64 == bdlb::GuidUtil::guidFromString(parsed, strings, 64));
+        ASSERT(bsl::equal(parsed, parsed + 64, requestIds));
+//..
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING BULK 'guidToString' AND 'guidFromString'
+        //
+        // Concerns:
+        //: 1 The array 'guidToString' writes, for each GUID, the same
+        //:   'k_GUID_NUM_CHARS' characters as the single-GUID 'guidToString',
+        //:   and writes nothing beyond the end of the last GUID.
+        //:
+        //: 2 The array 'guidFromString' loads the same value as the
+        //:   single-GUID 'guidFromString' for each string, in each of the
+        //:   accepted formats, and returns the number of strings.
+        //:
+        //: 3 The array 'guidFromString' stops at the first improperly
+        //:   formatted string, returns its index, and leaves the
+        //:   corresponding and subsequent results unchanged.
+        //:
+        //: 4 Strings having the length and hyphens of the canonical form, but
+        //:   containing a non-hexadecimal character, are rejected; upper and
+        //:   lower case digits are both accepted.
+        //:
+        //: 5 An empty array is accepted.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Format an array of the 'VALUES' GUIDs, and compare each
+        //:   'k_GUID_NUM_CHARS' characters with 'guidToString'.  (C-1)
+        //:
+        //: 2 Parse arrays of strings in various formats, and compare with the
+        //:   single-GUID 'guidFromString'.  (C-2)
+        //:
+        //: 3 Parse arrays having an invalid string at each position.  (C-3)
+        //:
+        //: 4 Replace each hexadecimal digit of a canonical string in turn with
+        //:   each of the 234 characters that are not hexadecimal digits.
+        //:   (C-4)
+        //:
+        //: 5 Invoke both methods with zero-length arrays.  (C-5)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null arrays of non-zero length.  (C-6)
+        //
+        // Testing:
+        //   size_t guidFromString(Guid *, const StrRef *, size_t)
+        //   void guidToString(char *result, const Guid *guids, size_t num)
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl
+                          << "TESTING BULK 'guidToString' AND 'guidFromString'"
+                          << endl
+                          << "================================================"
+                          << endl;
+
+        enum { NUM_VALUES = sizeof VALUES / sizeof *VALUES,
+               NUM_CHARS  = Util::k_GUID_NUM_CHARS };
+
+        if (veryVerbose) cout << "\tTesting 'guidToString'." << endl;
+        {
+            Obj guids[NUM_VALUES];
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                guids[i] = Obj(VALUES[i]);
+            }
+
+            for (int n = 0; n <= NUM_VALUES; ++n) {
+                char text[NUM_VALUES * NUM_CHARS + 1];
+                bsl::memset(text, '#', sizeof text);
+
+                Util::guidToString(text, guids, n);
+
+                for (int i = 0; i < n; ++i) {
+                    const bsl::string EXP = Util::guidToString(guids[i]);
+                    const bsl::string result(text + i * NUM_CHARS, NUM_CHARS);
+                    ASSERTV(n, i, EXP, result, EXP == result);
+                }
+                for (int i = n * NUM_CHARS; i < int(sizeof text); ++i) {
+                    ASSERTV(n, i, '#' == text[i]);
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting 'guidFromString'." << endl;
+        {
+            const char *const STRINGS[] = {
+                "00010203-0405-0607-0809-0a0b0c0d0e0f",
+                "00010203-0405-0607-0809-0A0B0C0D0E0F",
+                "{ 87654321-AAAA-BBBB-CCCC-012345654321 }",
+                "[00112233445566778899aAbBcCdDeEfF]",
+                "00102030-4050-6070-8090-a0b0c0d0e0f0",
+                "ffffffff-ffff-ffff-ffff-ffffffffffff",
+            };
+            enum { NUM_STRINGS = sizeof STRINGS / sizeof *STRINGS };
+
+            bslstl::StringRef strings[NUM_STRINGS];
+            Obj               EXP[NUM_STRINGS];
+            for (int i = 0; i < NUM_STRINGS; ++i) {
+                strings[i] = STRINGS[i];
+                ASSERTV(i, 0 == Util::guidFromString(&EXP[i], strings[i]));
+            }
+
+            Obj results[NUM_STRINGS];
+            ASSERT(NUM_STRINGS == Util::guidFromString(results,
+                                                       strings,
+                                                       NUM_STRINGS));
+            ASSERT(bsl::equal(results, results + NUM_STRINGS, EXP));
+
+            ASSERT(0 == Util::guidFromString(results, strings, 0));
+
+            // An invalid string at each position.
+
+            const Obj SENTINEL(V1);
+
+            for (int bad = 0; bad < NUM_STRINGS; ++bad) {
+                bslstl::StringRef mixed[NUM_STRINGS];
+                bsl::copy(strings, strings + NUM_STRINGS, mixed);
+                mixed[bad] = "00010203-0405-0607-0809-0a0b0c0d0e0g";
+
+                bsl::fill(results, results + NUM_STRINGS, SENTINEL);
+
+                const bsl::size_t RC = Util::guidFromString(results,
+                                                            mixed,
+                                                            NUM_STRINGS);
+                ASSERTV(bad, RC, bsl::size_t(bad) == RC);
+
+                for (int i = 0; i < NUM_STRINGS; ++i) {
+                    ASSERTV(bad, i,
+                            (i < bad ? EXP[i] : SENTINEL) == results[i]);
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting non-hexadecimal digits." << endl;
+        {
+            const char  CANONICAL[] = "5c9d4e50-0df1-11e4-9191-0800200c9a66";
+            const char  HEX[]       = "0123456789abcdefABCDEF";
+            const Obj   SENTINEL(V8);
+
+            // Every character that is not a hexadecimal digit, including
+            // those (e.g., '\xb2', '\xb3', and '\xb9') whose low bits match
+            // a digit's.
+
+            for (int pos = 0; pos < NUM_CHARS; ++pos) {
+                if (8 == pos || 13 == pos || 18 == pos || 23 == pos) {
+                    continue;
+                }
+                for (int b = 0; b < 256; ++b) {
+                    if (b && bsl::strchr(HEX, b)) {
+                        continue;
+                    }
+
+                    char string[NUM_CHARS];
+                    bsl::memcpy(string, CANONICAL, NUM_CHARS);
+                    string[pos] = static_cast<char>(b);
+
+                    Obj result(SENTINEL);
+                    ASSERTV(pos, b, 0 != Util::guidFromString(
+                                       &result,
+                                       bslstl::StringRef(string, NUM_CHARS)));
+                    ASSERTV(pos, b, SENTINEL == result);
+                }
+            }
+
+            Obj result;
+            ASSERT(0 == Util::guidFromString(&result, CANONICAL));
+            ASSERT(Obj(V2) == result);
+        }
+
+        if (veryVerbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj                      guid;
+            char                     text[NUM_CHARS];
+            const bslstl::StringRef  string("00010203-0405-0607-0809-"
+                                            "0a0b0c0d0e0f");
+
+            Obj               *const NULL_GUIDS   = 0;
+            char              *const NULL_TEXT    = 0;
+            bslstl::StringRef *const NULL_STRINGS = 0;
+
+            ASSERT_PASS(Util::guidToString(text,      &guid,      1));
+            ASSERT_PASS(Util::guidToString(NULL_TEXT, NULL_GUIDS, 0));
+            ASSERT_FAIL(Util::guidToString(NULL_TEXT, &guid,      1));
+            ASSERT_FAIL(Util::guidToString(text,      NULL_GUIDS, 1));
+
+            ASSERT_PASS(Util::guidFromString(&guid,      &string,      1));
+            ASSERT_PASS(Util::guidFromString(NULL_GUIDS, NULL_STRINGS, 0));
+            ASSERT_FAIL(Util::guidFromString(NULL_GUIDS, &string,      1));
+            ASSERT_FAIL(Util::guidFromString(&guid,      NULL_STRINGS, 1));
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING 'generateNonSecure'
+        //
+        // Concerns:
+        //: 1 Each overload loads the requested number of GUIDs, and leaves
+        //:   memory outside the designated range unchanged.
+        //:
+        //: 2 The generated GUIDs are version 4 GUIDs.
+        //:
+        //: 3 The generated GUIDs are unique, including across the reseeding
+        //:   of the generator state after 'k_NON_SECURE_RESEED_INTERVAL'
+        //:   GUIDs, and across threads.
+        //:
+        //: 4 On UNIX-like platforms, a child process created by 'fork' does
+        //:   not generate the same GUIDs as its parent.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Generate GUIDs with each overload into a zeroed array one larger
+        //:   than required, and check the array.  (C-1..2)
+        //:
+        //: 2 Generate more than 'k_NON_SECURE_RESEED_INTERVAL' GUIDs, in
+        //:   batches straddling the reseeding, and verify that they are
+        //:   version 4 and unique.  (C-2..3)
+        //:
+        //: 3 Generate GUIDs concurrently on several threads, and verify that
+        //:   all of them are unique.  (C-3)
+        //:
+        //: 4 Generate a GUID (initializing the thread state), 'fork', and have
+        //:   the child send its next GUID to the parent through a pipe; verify
+        //:   that it differs from the next GUID of the parent.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null array of non-zero length.  (C-5)
+        //
+        // Testing:
+        //   void generateNonSecure(Guid *out, size_t cnt)
+        //   void generateNonSecure(unsigned char *out, size_t cnt)
+        //   Guid generateNonSecure()
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl
+                          << "TESTING 'generateNonSecure'" << endl
+                          << "===========================" << endl;
+
+        if (veryVerbose) cout << "\tTesting each overload." << endl;
+        {
+            enum { MAX_NUM = 20 };
+
+            for (int n = 0; n <= MAX_NUM; ++n) {
+                for (int overload = 0; overload < 3; ++overload) {
+                    if (2 == overload && 1 != n) {
+                        continue;
+                    }
+
+                    Obj guids[MAX_NUM + 1];
+
+                    switch (overload) {
+                      case 0: {
+                        Util::generateNonSecure(guids, n);
+                      } break;
+                      case 1: {
+                        Util::generateNonSecure(
+                                     reinterpret_cast<unsigned char *>(guids),
+                                     n);
+                      } break;
+                      default: {
+                        guids[0] = Util::generateNonSecure();
+                      } break;
+                    }
+
+                    ASSERTV(n, overload, areVersion4(guids, n));
+                    ASSERTV(n, overload, areUnique(guids, n));
+                    for (int i = n; i <= MAX_NUM; ++i) {
+                        ASSERTV(n, overload, i, Obj() == guids[i]);
+                    }
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting reseeding." << endl;
+        {
+            const bsl::size_t NUM = Util::k_NON_SECURE_RESEED_INTERVAL + 1000;
+
+            bsl::vector<Obj> guids(NUM);
+            for (bsl::size_t i = 0; i < NUM; i += 999) {
+                Util::generateNonSecure(guids.data() + i,
+                                        bsl::min<bsl::size_t>(999, NUM - i));
+            }
+
+            ASSERT(areVersion4(guids.data(), NUM));
+            ASSERT(areUnique(guids.data(), NUM));
+
+            // A single batch straddling the next reseeding.
+
+            Util::generateNonSecure(guids.data(), NUM);
+            ASSERT(areVersion4(guids.data(), NUM));
+            ASSERT(areUnique(guids.data(), NUM));
+        }
+
+        if (veryVerbose) cout << "\tTesting multiple threads." << endl;
+        {
+            enum { NUM_THREADS = 4 };
+
+            bsl::vector<Obj> guids(NUM_THREADS * k_NUM_GUIDS_PER_THREAD);
+
+            bslmt::ThreadUtil::Handle handles[NUM_THREADS];
+            for (int t = 0; t < NUM_THREADS; ++t) {
+                ASSERTV(t, 0 == bslmt::ThreadUtil::create(
+                                 &handles[t],
+                                 &generateNonSecureThread,
+                                 guids.data() + t * k_NUM_GUIDS_PER_THREAD));
+            }
+            for (int t = 0; t < NUM_THREADS; ++t) {
+                ASSERTV(t, 0 == bslmt::ThreadUtil::join(handles[t]));
+            }
+
+            ASSERT(areVersion4(guids.data(), guids.size()));
+            ASSERT(areUnique(guids.data(), guids.size()));
+        }
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        if (veryVerbose) cout << "\tTesting 'fork'." << endl;
+        {
+            Util::generateNonSecure();
+
+            int fds[2];
+            ASSERT(0 == pipe(fds));
+
+            const pid_t pid = fork();
+            ASSERT(-1 != pid);
+
+            if (0 == pid) {
+                const Obj child = Util::generateNonSecure();
+                const int rc    = int(write(fds[1], &child, sizeof child));
+                _exit(int(sizeof child) == rc ? 0 : 1);
+            }
+
+            const Obj parent = Util::generateNonSecure();
+
+            Obj child;
+            ASSERT(int(sizeof child) == int(read(fds[0],
+                                                 &child,
+                                                 sizeof child)));
+            int status = -1;
+            ASSERT(pid == waitpid(pid, &status, 0));
+            ASSERT(0   == status);
+
+            close(fds[0]);
+            close(fds[1]);
+
+            if (veryVeryVerbose) { P_(parent) P(child) }
+            ASSERT(parent != child);
+            ASSERT(areVersion4(&child, 1));
+        }
+#endif
+
+        if (veryVerbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj                  guid;
+            Obj           *const NULL_GUIDS = 0;
+            unsigned char *const NULL_BYTES = 0;
+
+            ASSERT_PASS(Util::generateNonSecure(&guid,      1));
+            ASSERT_PASS(Util::generateNonSecure(NULL_GUIDS, 0));
+            ASSERT_FAIL(Util::generateNonSecure(NULL_GUIDS, 1));
+            ASSERT_PASS(Util::generateNonSecure(NULL_BYTES, 0));
+            ASSERT_FAIL(Util::generateNonSecure(NULL_BYTES, 1));
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'GuidState'
+        //
+        // Concerns:
+        //: 1 A seeded state generates the sequence of the reference PCG-XSH-RR
+        //:   implementation, with the version and variant bits of each GUID
+        //:   overwritten.
+        //:
+        //: 2 Two states created from the same seed generate the same GUIDs,
+        //:   and 'seed' restarts the sequence.
+        //:
+        //: 3 Generating 'n' GUIDs in one call is equivalent to generating
+        //:   them in several calls, with either overload.
+        //:
+        //: 4 Default-constructed and reseeded states generate distinct,
+        //:   version 4 GUIDs.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Seed the first stream with the 'pcg32-demo' seed (42, 54), and
+        //:   compare the first bytes of the first three GUIDs with the
+        //:   published output of that program.  Also compare two GUIDs
+        //:   generated from the seed { 1, 2, ..., 8 } with values computed
+        //:   independently.  (C-1)
+        //:
+        //: 2 Generate GUIDs from two states having the same seed, and again
+        //:   after calling 'seed'.  (C-2)
+        //:
+        //: 3 Generate 32 GUIDs from a state in one call, and from an equally
+        //:   seeded state in calls of varying size and overload.  (C-3)
+        //:
+        //: 4 Generate GUIDs from default-constructed and reseeded states and
+        //:   check that they are version 4 and unique.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null arguments.  (C-5)
+        //
+        // Testing:
+        //   GuidState()
+        //   explicit GuidState(const Uint64 *seed)
+        //   void generate(Guid *result, size_t numGuids)
+        //   void generate(unsigned char *result, size_t numGuids)
+        //   void reseed()
+        //   void seed(const Uint64 *seed)
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl
+                          << "TESTING 'GuidState'" << endl
+                          << "===================" << endl;
+
+        typedef bdlb::GuidState    State;
+        typedef bsls::Types::Uint64 Uint64;
+
+        if (veryVerbose) cout << "\tTesting known answers." << endl;
+        {
+            const Uint64 SEED[State::k_SEED_LENGTH] = { 42, 54 };
+
+            // The first three outputs of 'pcg32-demo', which seeds with
+            // (42, 54), are 0xa15c02b7, 0x7b47f409, and 0xba1d3330.
+
+            const unsigned char EXP[3][4] = { { 0xb7, 0x02, 0x5c, 0xa1 },
+                                              { 0x09, 0xf4, 0x47, 0x7b },
+                                              { 0x30, 0x33, 0x1d, 0xba } };
+
+            State mX(SEED);
+            for (int i = 0; i < 3; ++i) {
+                Obj guid;
+                mX.generate(&guid);
+                ASSERTV(i, 0 == bsl::memcmp(&guid[0], EXP[i], 4));
+            }
+
+            const Uint64  SEED2[State::k_SEED_LENGTH] = { 1, 2, 3, 4,
+                                                          5, 6, 7, 8 };
+            const Element EXP2[] = {
+                { 0xa9, 0xeb, 0x5d, 0x0f, 0xd4, 0xf5, 0x4e, 0x97,
+                  0xaf, 0x93, 0xe1, 0xd6, 0xba, 0xde, 0xf5, 0x92 },
+                { 0x5b, 0x52, 0xd7, 0x5b, 0x3b, 0xbe, 0x40, 0xd7,
+                  0x97, 0x43, 0xa8, 0x10, 0xcf, 0xbc, 0x57, 0x5f },
+            };
+
+            Obj guids[2];
+            mX.seed(SEED2);
+            mX.generate(guids, 2);
+            ASSERT(Obj(EXP2[0]) == guids[0]);
+            ASSERT(Obj(EXP2[1]) == guids[1]);
+        }
+
+        if (veryVerbose) cout << "\tTesting seeding." << endl;
+        {
+            const Uint64 SEED[State::k_SEED_LENGTH] = { 9, 8, 7, 6,
+                                                        5, 4, 3, 2 };
+            enum { NUM = 32 };
+
+            State mX(SEED);
+            State mY(SEED);
+
+            Obj x[NUM], y[NUM];
+            mX.generate(x, NUM);
+
+            for (int i = 0, n = 1; i < NUM; i += n, ++n) {
+                n = bsl::min(n, NUM - i);
+                if (n & 1) {
+                    mY.generate(y + i, n);
+                }
+                else {
+                    mY.generate(reinterpret_cast<unsigned char *>(y + i), n);
+                }
+            }
+            ASSERT(bsl::equal(x, x + NUM, y));
+            ASSERT(areVersion4(x, NUM));
+            ASSERT(areUnique(x, NUM));
+
+            mY.seed(SEED);
+            mY.generate(y, NUM);
+            ASSERT(bsl::equal(x, x + NUM, y));
+
+            Obj z[NUM + 1];
+            mY.generate(z, 0);
+            ASSERT(Obj() == z[0]);
+        }
+
+        if (veryVerbose) cout << "\tTesting random seeding." << endl;
+        {
+            enum { NUM = 16 };
+
+            State mX;
+            State mY;
+
+            Obj guids[3 * NUM];
+            mX.generate(guids, NUM);
+            mY.generate(guids + NUM, NUM);
+            mX.reseed();
+            mX.generate(guids + 2 * NUM, NUM);
+
+            ASSERT(areVersion4(guids, 3 * NUM));
+            ASSERT(areUnique(guids, 3 * NUM));
+        }
+
+        if (veryVerbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Uint64 SEED[State::k_SEED_LENGTH] = { 0 };
+
+            State mX(SEED);
+
+            Obj                  guid;
+            Obj           *const NULL_GUIDS = 0;
+            unsigned char *const NULL_BYTES = 0;
+            const Uint64  *const NULL_SEED  = 0;
+
+            ASSERT_PASS(mX.generate(&guid,      1));
+            ASSERT_PASS(mX.generate(NULL_GUIDS, 0));
+            ASSERT_FAIL(mX.generate(NULL_GUIDS, 1));
+            ASSERT_PASS(mX.generate(NULL_BYTES, 0));
+            ASSERT_FAIL(mX.generate(NULL_BYTES, 1));
+
+            ASSERT_PASS(mX.seed(SEED));
+            ASSERT_FAIL(mX.seed(NULL_SEED));
+        }
       } break;
       case 6: {
         // --------------------------------------------------------------------
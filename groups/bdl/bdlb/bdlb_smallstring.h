@@ -0,0 +1,866 @@
+// bdlb_smallstring.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLB_SMALLSTRING
+#define INCLUDED_BDLB_SMALLSTRING
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a string holding a configurable number of chars in place.
+//
+//@CLASSES:
+//  bdlb::SmallString: string with a compile-time inline capacity
+//
+//@SEE_ALSO: bslstl_smallvector, bdlcc_stringinterner
+//
+//@DESCRIPTION: This component provides a value-semantic class template,
+// 'bdlb::SmallString<INLINE_CAPACITY>', representing a string of 'char' that
+// holds up to 'INLINE_CAPACITY' characters within the object itself, and
+// obtains memory from its allocator only for longer strings.
+//
+// 'bsl::string' holds only 19 characters (on 64-bit platforms) without
+// allocating, and that limit cannot be changed without changing the layout of
+// every 'bsl::string'.  Identifiers slightly longer than that (e.g., ISIN
+// codes with an exchange suffix, or symbols qualified by a venue) therefore
+// always allocate.  A 'SmallString' instantiated with an 'INLINE_CAPACITY'
+// that accommodates most such identifiers avoids those allocations, at the
+// cost of an object whose size grows with 'INLINE_CAPACITY'; it is intended
+// for members of message types and for local variables, rather than as a
+// general replacement for 'bsl::string'.
+//
+// 'SmallString' is implemented in terms of 'bsl::small_vector', whose inline
+// buffer holds 'INLINE_CAPACITY' characters and the null terminator, so that
+// 'c_str' can always be called without modifying the string.  The interface
+// of 'SmallString' is a small subset of that of 'bsl::string'; a
+// 'SmallString' converts implicitly to 'bslstl::StringRef', through which
+// the algorithms of 'bdlb::StringRefUtil' (and most interfaces taking string
+// arguments) can be applied to it.
+//
+///Thread Safety
+///-------------
+// 'bdlb::SmallString' is *const* *thread-safe*: distinct threads may call
+// 'const' methods on the same object concurrently, but no thread may modify
+// an object while another thread accesses it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Holding Instrument Identifiers
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose an order message identifies an instrument by an ISIN code (12
+// characters) qualified by the code of a trading venue, which together rarely
+// exceed 32 characters.  We hold the identifier in a 'SmallString' having an
+// inline capacity of 32.
+//
+// First, we define the message type:
+//..
+//  struct Order {
+//      // This 'struct' represents an order for an instrument.
+//
+//      bdlb::SmallString<32> d_instrument;  // venue-qualified identifier
+//      int                   d_quantity;    // number of units
+//
+//      explicit Order(bslma::Allocator *basicAllocator = 0)
+//      : d_instrument(basicAllocator)
+//      , d_quantity(0)
+//      {
+//      }
+//  };
+//..
+// Then, we create an order, using a test allocator to observe the memory it
+// uses, and build its identifier a part at a time:
+//..
+//  bslma::TestAllocator ta;
+//
+//  Order order(&ta);
+//  order.d_instrument = "US0378331005";
+//  order.d_instrument.push_back('.');
+//  order.d_instrument.append("XNAS");
+//  order.d_quantity   = 100;
+//
+//  assert("US0378331005.XNAS" == order.d_instrument);
+//  assert(17                  == order.d_instrument.length());
+//..
+// Next, we observe that the identifier is held without allocating memory:
+//..
+//  assert(order.d_instrument.isInline());
+//  assert(0 == ta.numBlocksTotal());
+//..
+// Then, we pass the identifier to a function taking a 'bslstl::StringRef',
+// to which a 'SmallString' converts implicitly:
+//..
+//  bslstl::StringRef venue = bdlb::StringRefUtil::substr(
+//                                                      order.d_instrument,
+//                                                      13);
+//  assert("XNAS" == venue);
+//..
+// Finally, we observe that an unusually long identifier is still held
+// correctly, in memory supplied by the allocator of the order:
+//..
+//  order.d_instrument.append(".WITH-A-LONG-SUFFIX");
+//
+//  assert(!order.d_instrument.isInline());
+//  assert(1 == ta.numBlocksInUse());
+//  assert(0 == bsl::strcmp(order.d_instrument.c_str(),
+//                          "US0378331005.XNAS.WITH-A-LONG-SUFFIX"));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+#include <bsl_small_vector.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace bdlb {
+
+                            // =================
+                            // class SmallString
+                            // =================
+
+template <bsl::size_t INLINE_CAPACITY>
+class SmallString {
+    // This value-semantic class template represents a string of 'char' that
+    // holds up to 'INLINE_CAPACITY' characters without allocating memory.
+    // The characters of a string are followed by a null terminator.
+
+    // PRIVATE TYPES
+    typedef bsl::small_vector<char, INLINE_CAPACITY + 1> Chars;
+    typedef bslmf::MovableRefUtil                        MoveUtil;
+
+    // DATA
+    Chars d_chars;  // characters of this string, followed by a null
+                    // terminator
+
+    // PRIVATE MANIPULATORS
+    void privateAssign(const char *characters, bsl::size_t numCharacters);
+        // Set the value of this string to the specified 'numCharacters'
+        // characters starting at the specified 'characters'.  Note that
+        // 'characters' may refer to the value of this string.
+
+    void privateRestoreTerminator();
+        // Append a null terminator to 'd_chars' if it is empty (i.e., if it
+        // was the source of a move).
+
+  public:
+    // TYPES
+    typedef char            value_type;
+    typedef bsl::size_t     size_type;
+    typedef char           *iterator;
+    typedef const char     *const_iterator;
+
+    // CONSTANTS
+    static const size_type k_INLINE_CAPACITY = INLINE_CAPACITY;
+                                      // number of characters held without
+                                      // allocating memory
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SmallString, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit SmallString(bslma::Allocator *basicAllocator = 0);
+        // Create an empty string.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    explicit SmallString(const bslstl::StringRef&  value,
+                         bslma::Allocator         *basicAllocator = 0);
+        // Create a string having the specified 'value'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    SmallString(const SmallString&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a string having the value of the specified 'original'
+        // string.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    SmallString(bslmf::MovableRef<SmallString> original);           // IMPLICIT
+        // Create a string having the value of the specified 'original'
+        // string, and using the allocator of 'original'.  If 'original' holds
+        // its characters in allocated memory, that memory is adopted by the
+        // new string, and 'original' is left empty; otherwise 'original' is
+        // left unchanged.
+
+    SmallString(bslmf::MovableRef<SmallString>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a string having the value of the specified 'original' string
+        // that uses the specified 'basicAllocator' to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  If 'basicAllocator' is the allocator of 'original', the
+        // effect is that of the move constructor above; otherwise 'original'
+        // is left unchanged.
+
+    //! ~SmallString() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    SmallString& operator=(const SmallString& rhs);
+        // Assign to this string the value of the specified 'rhs' string, and
+        // return a reference providing modifiable access to this string.
+
+    SmallString& operator=(bslmf::MovableRef<SmallString> rhs);
+        // Assign to this string the value of the specified 'rhs' string, and
+        // return a reference providing modifiable access to this string.  If
+        // this string and 'rhs' use the same allocator and 'rhs' holds its
+        // characters in allocated memory, that memory is adopted by this
+        // string and 'rhs' is left empty; otherwise 'rhs' is left unchanged.
+
+    SmallString& operator=(const bslstl::StringRef& rhs);
+        // Assign to this string the value of the specified 'rhs' string, and
+        // return a reference providing modifiable access to this string.
+        // Note that 'rhs' may refer to the value of this string.
+
+    SmallString& operator+=(const bslstl::StringRef& value);
+        // Append the specified 'value' to this string, and return a reference
+        // providing modifiable access to this string.  Note that 'value' may
+        // refer to the value of this string.
+
+    SmallString& append(const bslstl::StringRef& value);
+        // Append the specified 'value' to this string, and return a reference
+        // providing modifiable access to this string.  Note that 'value' may
+        // refer to the value of this string.
+
+    iterator begin();
+        // Return an iterator referring to the first character of this
+        // string, or 'end()' if this string is empty.
+
+    void clear();
+        // Remove all characters from this string.  Note that the capacity of
+        // this string is not changed.
+
+    char *data();
+        // Return the address of the first character of this string, which is
+        // followed by 'length()' additional characters and a null
+        // terminator.  The behavior is undefined if the null terminator is
+        // modified.
+
+    iterator end();
+        // Return an iterator referring one past the last character of this
+        // string.
+
+    char& operator[](size_type position);
+        // Return a reference providing modifiable access to the character at
+        // the specified 'position' in this string.  The behavior is undefined
+        // unless 'position < length()'.
+
+    void push_back(char character);
+        // Append the specified 'character' to this string.
+
+    void reserve(size_type newCapacity);
+        // Ensure that this string can hold at least the specified
+        // 'newCapacity' characters without allocating memory.  The behavior
+        // is undefined unless 'newCapacity' is less than the largest value
+        // of 'size_type'.
+
+    void resize(size_type newLength, char character = '\0');
+        // Change the length of this string to the specified 'newLength',
+        // removing characters from the end if 'newLength < length()', and
+        // appending copies of the optionally specified 'character' (or
+        // '\0') otherwise.
+
+    void swap(SmallString& other);
+        // Efficiently exchange the value of this string with that of the
+        // specified 'other' string.  The behavior is undefined unless this
+        // string was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    operator bslstl::StringRef() const;
+        // Return a reference to the characters of this string.  Note that the
+        // reference is invalidated by any modification of this string.
+
+    const char& operator[](size_type position) const;
+        // Return a reference providing non-modifiable access to the character
+        // at the specified 'position' in this string.  The behavior is
+        // undefined unless 'position < length()'.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this string to supply memory.
+
+    const_iterator begin() const;
+        // Return an iterator referring to the first character of this
+        // string, or 'end()' if this string is empty.
+
+    const char *c_str() const;
+        // Return the address of the null-terminated characters of this
+        // string.
+
+    size_type capacity() const;
+        // Return the number of characters this string can hold without
+        // allocating memory.
+
+    const char *data() const;
+        // Return the address of the first character of this string, which is
+        // followed by 'length()' additional characters and a null terminator.
+
+    bool empty() const;
+        // Return 'true' if this string has no characters, and 'false'
+        // otherwise.
+
+    const_iterator end() const;
+        // Return an iterator referring one past the last character of this
+        // string.
+
+    bool isInline() const;
+        // Return 'true' if the characters of this string are held within
+        // this object, and 'false' if they are held in memory obtained from
+        // the allocator of this string.
+
+    size_type length() const;
+        // Return the number of characters in this string.
+
+    size_type size() const;
+        // Return the number of characters in this string.
+};
+
+// FREE OPERATORS
+template <bsl::size_t LHS_CAPACITY, bsl::size_t RHS_CAPACITY>
+bool operator==(const SmallString<LHS_CAPACITY>& lhs,
+                const SmallString<RHS_CAPACITY>& rhs);
+template <bsl::size_t INLINE_CAPACITY>
+bool operator==(const SmallString<INLINE_CAPACITY>& lhs,
+                const bslstl::StringRef&            rhs);
+template <bsl::size_t INLINE_CAPACITY>
+bool operator==(const bslstl::StringRef&            lhs,
+                const SmallString<INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' strings have the same
+    // value, and 'false' otherwise.  Two strings have the same value if they
+    // have the same length and the same character at each position.
+
+template <bsl::size_t LHS_CAPACITY, bsl::size_t RHS_CAPACITY>
+bool operator!=(const SmallString<LHS_CAPACITY>& lhs,
+                const SmallString<RHS_CAPACITY>& rhs);
+template <bsl::size_t INLINE_CAPACITY>
+bool operator!=(const SmallString<INLINE_CAPACITY>& lhs,
+                const bslstl::StringRef&            rhs);
+template <bsl::size_t INLINE_CAPACITY>
+bool operator!=(const bslstl::StringRef&            lhs,
+                const SmallString<INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' strings do not have the
+    // same value, and 'false' otherwise.  Two strings do not have the same
+    // value if they differ in length or in the character at any position.
+
+template <bsl::size_t LHS_CAPACITY, bsl::size_t RHS_CAPACITY>
+bool operator<(const SmallString<LHS_CAPACITY>& lhs,
+               const SmallString<RHS_CAPACITY>& rhs);
+template <bsl::size_t LHS_CAPACITY, bsl::size_t RHS_CAPACITY>
+bool operator>(const SmallString<LHS_CAPACITY>& lhs,
+               const SmallString<RHS_CAPACITY>& rhs);
+template <bsl::size_t LHS_CAPACITY, bsl::size_t RHS_CAPACITY>
+bool operator<=(const SmallString<LHS_CAPACITY>& lhs,
+                const SmallString<RHS_CAPACITY>& rhs);
+template <bsl::size_t LHS_CAPACITY, bsl::size_t RHS_CAPACITY>
+bool operator>=(const SmallString<LHS_CAPACITY>& lhs,
+                const SmallString<RHS_CAPACITY>& rhs);
+    // Return 'true' if the value of the specified 'lhs' string is
+    // respectively less than, greater than, less than or equal to, or greater
+    // than or equal to the value of the specified 'rhs' string, and 'false'
+    // otherwise.  Strings are ordered lexicographically by the 'unsigned'
+    // values of their characters, as for 'bslstl::StringRef'.
+
+template <bsl::size_t INLINE_CAPACITY>
+bsl::ostream& operator<<(bsl::ostream&                       stream,
+                         const SmallString<INLINE_CAPACITY>& string);
+    // Write the characters of the specified 'string' to the specified output
+    // 'stream', and return a reference to 'stream'.
+
+// FREE FUNCTIONS
+template <class HASHALG, bsl::size_t INLINE_CAPACITY>
+void hashAppend(HASHALG& hashAlg, const SmallString<INLINE_CAPACITY>& string);
+    // Pass the specified 'string' to the specified 'hashAlg'.  Note that a
+    // 'SmallString' contributes to a hash exactly as a 'bslstl::StringRef'
+    // (and a 'bsl::string') having the same value, so that the three may be
+    // used interchangeably as keys of a hashed container.
+
+template <bsl::size_t INLINE_CAPACITY>
+void swap(SmallString<INLINE_CAPACITY>& a, SmallString<INLINE_CAPACITY>& b);
+    // Exchange the values of the specified 'a' and 'b' strings.  The
+    // behavior is undefined unless 'a' and 'b' were created with the same
+    // allocator.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // -----------------
+                            // class SmallString
+                            // -----------------
+
+// CONSTANTS
+template <bsl::size_t INLINE_CAPACITY>
+const bsl::size_t SmallString<INLINE_CAPACITY>::k_INLINE_CAPACITY;
+
+// PRIVATE MANIPULATORS
+template <bsl::size_t INLINE_CAPACITY>
+void SmallString<INLINE_CAPACITY>::privateAssign(
+                                              const char  *characters,
+                                              bsl::size_t  numCharacters)
+{
+    if (numCharacters >= d_chars.capacity()) {
+        // 'characters' may be in the buffer being replaced, so the new value
+        // is built in separate storage.
+
+        Chars temp(d_chars.get_allocator());
+        temp.reserve(numCharacters + 1);
+        temp.insert(temp.end(), characters, characters + numCharacters);
+        temp.push_back('\0');
+        d_chars.swap(temp);
+    }
+    else {
+        // Growing within the capacity neither moves the characters nor
+        // writes to those of the current value, but shrinking may overwrite
+        // the removed characters (e.g., in safe builds), so the string is
+        // shrunk only after 'characters' are copied.
+
+        const bsl::size_t newSize = numCharacters + 1;
+
+        if (newSize > d_chars.size()) {
+            d_chars.resize(newSize);
+        }
+        bsl::memmove(d_chars.data(), characters, numCharacters);
+        d_chars.resize(newSize);
+        d_chars[numCharacters] = '\0';
+    }
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+void SmallString<INLINE_CAPACITY>::privateRestoreTerminator()
+{
+    if (d_chars.empty()) {
+        d_chars.push_back('\0');  // within the inline capacity; cannot throw
+    }
+}
+
+// CREATORS
+template <bsl::size_t INLINE_CAPACITY>
+inline
+SmallString<INLINE_CAPACITY>::SmallString(bslma::Allocator *basicAllocator)
+: d_chars(basicAllocator)
+{
+    d_chars.push_back('\0');
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+SmallString<INLINE_CAPACITY>::SmallString(
+                                     const bslstl::StringRef&  value,
+                                     bslma::Allocator         *basicAllocator)
+: d_chars(basicAllocator)
+{
+    privateAssign(value.data(), value.length());
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+SmallString<INLINE_CAPACITY>::SmallString(
+                                          const SmallString&  original,
+                                          bslma::Allocator   *basicAllocator)
+: d_chars(original.d_chars, basicAllocator)
+{
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+SmallString<INLINE_CAPACITY>::SmallString(
+                                       bslmf::MovableRef<SmallString> original)
+: d_chars(MoveUtil::move(MoveUtil::access(original).d_chars))
+{
+    MoveUtil::access(original).privateRestoreTerminator();
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+SmallString<INLINE_CAPACITY>::SmallString(
+                               bslmf::MovableRef<SmallString>  original,
+                               bslma::Allocator               *basicAllocator)
+: d_chars(MoveUtil::move(MoveUtil::access(original).d_chars),
+          typename Chars::allocator_type(basicAllocator))
+{
+    MoveUtil::access(original).privateRestoreTerminator();
+}
+
+// MANIPULATORS
+template <bsl::size_t INLINE_CAPACITY>
+inline
+SmallString<INLINE_CAPACITY>&
+SmallString<INLINE_CAPACITY>::operator=(const SmallString& rhs)
+{
+    privateAssign(rhs.data(), rhs.length());
+    return *this;
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+SmallString<INLINE_CAPACITY>&
+SmallString<INLINE_CAPACITY>::operator=(bslmf::MovableRef<SmallString> rhs)
+{
+    SmallString& lvalue = rhs;
+
+    d_chars = MoveUtil::move(lvalue.d_chars);
+    lvalue.privateRestoreTerminator();
+    return *this;
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+SmallString<INLINE_CAPACITY>&
+SmallString<INLINE_CAPACITY>::operator=(const bslstl::StringRef& rhs)
+{
+    privateAssign(rhs.data(), rhs.length());
+    return *this;
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+SmallString<INLINE_CAPACITY>&
+SmallString<INLINE_CAPACITY>::operator+=(const bslstl::StringRef& value)
+{
+    return append(value);
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+SmallString<INLINE_CAPACITY>&
+SmallString<INLINE_CAPACITY>::append(const bslstl::StringRef& value)
+{
+    const size_type oldLength = length();
+    const size_type numChars  = value.length();
+
+    const size_type newSize = d_chars.size() + numChars;
+
+    if (newSize > d_chars.capacity()) {
+        // 'value' may be in the buffer being replaced, so the new value is
+        // built in separate storage, with room to grow geometrically.
+
+        Chars temp(d_chars.get_allocator());
+        temp.reserve(bsl::max(newSize, 2 * d_chars.capacity()));
+        temp.insert(temp.end(), d_chars.begin(), d_chars.end() - 1);
+        temp.insert(temp.end(), value.begin(), value.end());
+        temp.push_back('\0');
+        d_chars.swap(temp);
+    }
+    else {
+        // 'value' can be in this string only before the position of the
+        // terminator, which is where the appended characters are written.
+
+        d_chars.resize(newSize);
+        bsl::memmove(d_chars.data() + oldLength, value.data(), numChars);
+        d_chars[newSize - 1] = '\0';
+    }
+    return *this;
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallString<INLINE_CAPACITY>::iterator
+SmallString<INLINE_CAPACITY>::begin()
+{
+    return d_chars.data();
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+void SmallString<INLINE_CAPACITY>::clear()
+{
+    d_chars.resize(1);
+    d_chars[0] = '\0';
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+char *SmallString<INLINE_CAPACITY>::data()
+{
+    return d_chars.data();
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallString<INLINE_CAPACITY>::iterator
+SmallString<INLINE_CAPACITY>::end()
+{
+    return d_chars.data() + length();
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+char& SmallString<INLINE_CAPACITY>::operator[](size_type position)
+{
+    BSLS_ASSERT_SAFE(position < length());
+
+    return d_chars[position];
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+void SmallString<INLINE_CAPACITY>::push_back(char character)
+{
+    d_chars.push_back('\0');
+    d_chars[d_chars.size() - 2] = character;
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+void SmallString<INLINE_CAPACITY>::reserve(size_type newCapacity)
+{
+    BSLS_ASSERT(newCapacity < d_chars.max_size());
+
+    d_chars.reserve(newCapacity + 1);
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+void SmallString<INLINE_CAPACITY>::resize(size_type newLength,
+                                          char      character)
+{
+    const size_type oldLength = length();
+
+    reserve(newLength);
+
+    // The remaining operations cannot allocate, and so cannot throw.
+
+    d_chars.resize(newLength + 1, character);
+    if (newLength > oldLength) {
+        d_chars[oldLength] = character;
+    }
+    d_chars[newLength] = '\0';
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+void SmallString<INLINE_CAPACITY>::swap(SmallString& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_chars.swap(other.d_chars);
+}
+
+// ACCESSORS
+template <bsl::size_t INLINE_CAPACITY>
+inline
+SmallString<INLINE_CAPACITY>::operator bslstl::StringRef() const
+{
+    return bslstl::StringRef(d_chars.data(), length());
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+const char& SmallString<INLINE_CAPACITY>::operator[](size_type position) const
+{
+    BSLS_ASSERT_SAFE(position < length());
+
+    return d_chars[position];
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+bslma::Allocator *SmallString<INLINE_CAPACITY>::allocator() const
+{
+    return d_chars.get_allocator().mechanism();
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallString<INLINE_CAPACITY>::const_iterator
+SmallString<INLINE_CAPACITY>::begin() const
+{
+    return d_chars.data();
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+const char *SmallString<INLINE_CAPACITY>::c_str() const
+{
+    return d_chars.data();
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallString<INLINE_CAPACITY>::size_type
+SmallString<INLINE_CAPACITY>::capacity() const
+{
+    return d_chars.capacity() - 1;
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+const char *SmallString<INLINE_CAPACITY>::data() const
+{
+    return d_chars.data();
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallString<INLINE_CAPACITY>::empty() const
+{
+    return 1 == d_chars.size();
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallString<INLINE_CAPACITY>::const_iterator
+SmallString<INLINE_CAPACITY>::end() const
+{
+    return d_chars.data() + length();
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallString<INLINE_CAPACITY>::isInline() const
+{
+    return d_chars.isInline();
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallString<INLINE_CAPACITY>::size_type
+SmallString<INLINE_CAPACITY>::length() const
+{
+    return d_chars.size() - 1;
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallString<INLINE_CAPACITY>::size_type
+SmallString<INLINE_CAPACITY>::size() const
+{
+    return d_chars.size() - 1;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <bsl::size_t LHS_CAPACITY, bsl::size_t RHS_CAPACITY>
+inline
+bool bdlb::operator==(const SmallString<LHS_CAPACITY>& lhs,
+                      const SmallString<RHS_CAPACITY>& rhs)
+{
+    return bslstl::StringRef(lhs) == bslstl::StringRef(rhs);
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlb::operator==(const SmallString<INLINE_CAPACITY>& lhs,
+                      const bslstl::StringRef&            rhs)
+{
+    return bslstl::StringRef(lhs) == rhs;
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlb::operator==(const bslstl::StringRef&            lhs,
+                      const SmallString<INLINE_CAPACITY>& rhs)
+{
+    return lhs == bslstl::StringRef(rhs);
+}
+
+template <bsl::size_t LHS_CAPACITY, bsl::size_t RHS_CAPACITY>
+inline
+bool bdlb::operator!=(const SmallString<LHS_CAPACITY>& lhs,
+                      const SmallString<RHS_CAPACITY>& rhs)
+{
+    return bslstl::StringRef(lhs) != bslstl::StringRef(rhs);
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlb::operator!=(const SmallString<INLINE_CAPACITY>& lhs,
+                      const bslstl::StringRef&            rhs)
+{
+    return bslstl::StringRef(lhs) != rhs;
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlb::operator!=(const bslstl::StringRef&            lhs,
+                      const SmallString<INLINE_CAPACITY>& rhs)
+{
+    return lhs != bslstl::StringRef(rhs);
+}
+
+template <bsl::size_t LHS_CAPACITY, bsl::size_t RHS_CAPACITY>
+inline
+bool bdlb::operator<(const SmallString<LHS_CAPACITY>& lhs,
+                     const SmallString<RHS_CAPACITY>& rhs)
+{
+    return bslstl::StringRef(lhs) < bslstl::StringRef(rhs);
+}
+
+template <bsl::size_t LHS_CAPACITY, bsl::size_t RHS_CAPACITY>
+inline
+bool bdlb::operator>(const SmallString<LHS_CAPACITY>& lhs,
+                     const SmallString<RHS_CAPACITY>& rhs)
+{
+    return bslstl::StringRef(lhs) > bslstl::StringRef(rhs);
+}
+
+template <bsl::size_t LHS_CAPACITY, bsl::size_t RHS_CAPACITY>
+inline
+bool bdlb::operator<=(const SmallString<LHS_CAPACITY>& lhs,
+                      const SmallString<RHS_CAPACITY>& rhs)
+{
+    return bslstl::StringRef(lhs) <= bslstl::StringRef(rhs);
+}
+
+template <bsl::size_t LHS_CAPACITY, bsl::size_t RHS_CAPACITY>
+inline
+bool bdlb::operator>=(const SmallString<LHS_CAPACITY>& lhs,
+                      const SmallString<RHS_CAPACITY>& rhs)
+{
+    return bslstl::StringRef(lhs) >= bslstl::StringRef(rhs);
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+bsl::ostream& bdlb::operator<<(bsl::ostream&                       stream,
+                               const SmallString<INLINE_CAPACITY>& string)
+{
+    return stream << bslstl::StringRef(string);
+}
+
+// FREE FUNCTIONS
+template <class HASHALG, bsl::size_t INLINE_CAPACITY>
+inline
+void bdlb::hashAppend(HASHALG&                            hashAlg,
+                      const SmallString<INLINE_CAPACITY>& string)
+{
+    hashAppend(hashAlg, bslstl::StringRef(string));
+}
+
+template <bsl::size_t INLINE_CAPACITY>
+inline
+void bdlb::swap(SmallString<INLINE_CAPACITY>& a,
+                SmallString<INLINE_CAPACITY>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,933 @@
+// bdlb_smallstring.t.cpp                                             -*-C++-*-
+#include <bdlb_smallstring.h>
+
+#include <bdlb_stringrefutil.h>
+
+#include <bslh_hash.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic string holding a configurable
+// number of characters in place, implemented in terms of 'bsl::small_vector',
+// which is tested in its own component.  This test driver therefore
+// concentrates on the invariant 'SmallString' adds, that the characters are
+// always followed by a null terminator, across the transitions between the
+// inline and allocated representations, including for arguments referring to
+// the value of the string being modified.  Manipulators are verified against
+// 'bsl::string' as an oracle, and allocations are verified with test
+// allocators.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit SmallString(bslma::Allocator *basicAllocator = 0);
+// [ 2] explicit SmallString(const StringRef& value, *basicAllocator = 0);
+// [ 2] SmallString(const SmallString& original, *basicAllocator = 0);
+// [ 2] SmallString(MovableRef<SmallString> original);
+// [ 2] SmallString(MovableRef<SmallString> original, *basicAllocator);
+//
+// MANIPULATORS
+// [ 2] SmallString& operator=(const SmallString& rhs);
+// [ 2] SmallString& operator=(MovableRef<SmallString> rhs);
+// [ 3] SmallString& operator=(const bslstl::StringRef& rhs);
+// [ 3] SmallString& operator+=(const bslstl::StringRef& value);
+// [ 3] SmallString& append(const bslstl::StringRef& value);
+// [ 3] iterator begin();
+// [ 3] void clear();
+// [ 3] char *data();
+// [ 3] iterator end();
+// [ 3] char& operator[](size_type position);
+// [ 3] void push_back(char character);
+// [ 3] void reserve(size_type newCapacity);
+// [ 3] void resize(size_type newLength, char character = '\0');
+// [ 2] void swap(SmallString& other);
+//
+// ACCESSORS
+// [ 3] operator bslstl::StringRef() const;
+// [ 3] const char& operator[](size_type position) const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const char *c_str() const;
+// [ 3] size_type capacity() const;
+// [ 3] const char *data() const;
+// [ 3] bool empty() const;
+// [ 3] const_iterator end() const;
+// [ 2] bool isInline() const;
+// [ 3] size_type length() const;
+// [ 3] size_type size() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const SmallString<L>&, const SmallString<R>&);
+// [ 4] bool operator==(const SmallString<N>&, const bslstl::StringRef&);
+// [ 4] bool operator==(const bslstl::StringRef&, const SmallString<N>&);
+// [ 4] bool operator!=(const SmallString<L>&, const SmallString<R>&);
+// [ 4] bool operator!=(const SmallString<N>&, const bslstl::StringRef&);
+// [ 4] bool operator!=(const bslstl::StringRef&, const SmallString<N>&);
+// [ 4] bool operator< (const SmallString<L>&, const SmallString<R>&);
+// [ 4] bool operator> (const SmallString<L>&, const SmallString<R>&);
+// [ 4] bool operator<=(const SmallString<L>&, const SmallString<R>&);
+// [ 4] bool operator>=(const SmallString<L>&, const SmallString<R>&);
+// [ 4] ostream& operator<<(ostream& stream, const SmallString<N>& string);
+//
+// FREE FUNCTIONS
+// [ 4] void hashAppend(HASHALG& hashAlg, const SmallString<N>& string);
+// [ 2] void swap(SmallString<N>& a, SmallString<N>& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlb::SmallString<8> Obj;
+
+typedef bslmf::MovableRefUtil MoveUtil;
+
+static const char *const VALUES[] = {
+    "",
+    "a",
+    "abcdefg",                     // one less than the inline capacity
+    "abcdefgh",                    // exactly the inline capacity
+    "abcdefghi",                   // one more than the inline capacity
+    "0123456789abcdefghijklmnopqrstuvwxyz"
+};
+enum { NUM_VALUES = sizeof VALUES / sizeof *VALUES };
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+template <bsl::size_t INLINE_CAPACITY>
+bool isValid(const bdlb::SmallString<INLINE_CAPACITY>& string)
+    // Return 'true' if the specified 'string' satisfies the invariants of
+    // 'SmallString', and 'false' otherwise.
+{
+    return '\0'                        == string.c_str()[string.length()]
+        && string.data()               == string.c_str()
+        && string.begin() + string.length() == string.end()
+        && string.length()             == string.size()
+        && (0 == string.length())      == string.empty()
+        && string.length()             <= string.capacity()
+        && INLINE_CAPACITY             <= string.capacity()
+        && (INLINE_CAPACITY == string.capacity()) == string.isInline();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Holding Instrument Identifiers
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose an order message identifies an instrument by an ISIN code (12
+// characters) qualified by the code of a trading venue, which together rarely
+// exceed 32 characters.  We hold the identifier in a 'SmallString' having an
+// inline capacity of 32.
+//
+// First, we define the message type:
+//..
+struct Order {
+    // This 'struct' represents an order for an instrument.
+
+    bdlb::SmallString<32> d_instrument;  // venue-qualified identifier
+    int                   d_quantity;    // number of units
+
+    explicit Order(bslma::Allocator *basicAllocator = 0)
+    : d_instrument(basicAllocator)
+    , d_quantity(0)
+    {
+    }
+};
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create an order, using a test allocator to observe the memory it
+// uses, and build its identifier a part at a time:
+//..
+        bslma::TestAllocator ta;
+
+        Order order(&ta);
+        order.d_instrument = "US0378331005";
+        order.d_instrument.push_back('.');
+        order.d_instrument.append("XNAS");
+        order.d_quantity   = 100;
+
+        ASSERT("US0378331005.XNAS" == order.d_instrument);
+        ASSERT(17                  == order.d_instrument.length());
+//..
+// Next, we observe that the identifier is held without allocating memory:
+//..
+        ASSERT(order.d_instrument.isInline());
+        ASSERT(0 == ta.numBlocksTotal());
+//..
+// Then, we pass the identifier to a function taking a 'bslstl::StringRef',
+// to which a 'SmallString' converts implicitly:
+//..
+        bslstl::StringRef venue = bdlb::StringRefUtil::substr(
+                                                            order.d_instrument,
+                                                            13);
+        ASSERT("XNAS" == venue);
+//..
+// Finally, we observe that an unusually long identifier is still held
+// correctly, in memory supplied by the allocator of the order:
+//..
+        order.d_instrument.append(".WITH-A-LONG-SUFFIX");
+
+        ASSERT(!order.d_instrument.isInline());
+        ASSERT(1 == ta.numBlocksInUse());
+        ASSERT(0 == bsl::strcmp(order.d_instrument.c_str(),
+                                "US0378331005.XNAS.WITH-A-LONG-SUFFIX"));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COMPARISON, PRINTING, AND HASHING
+        //
+        // Concerns:
+        //: 1 Strings compare as the 'bslstl::StringRef's having their values,
+        //:   regardless of their inline capacities and representations.
+        //:
+        //: 2 A 'SmallString' may be compared with a 'bslstl::StringRef' (and
+        //:   hence a string literal) on either side.
+        //:
+        //: 3 'operator<<' writes exactly the characters of the string.
+        //:
+        //: 4 A 'SmallString' hashes as a 'bsl::string' having its value.
+        //
+        // Plan:
+        //: 1 For every pair of values in a table, compare strings of two
+        //:   different inline capacities holding those values with each
+        //:   other and with 'bslstl::StringRef's, and verify the results
+        //:   against those of 'bsl::string'.  (C-1..2)
+        //:
+        //: 2 Print each value to a 'bsl::ostringstream'.  (C-3)
+        //:
+        //: 3 Compare the hash of each value with 'bslh::Hash<>' to that of a
+        //:   'bsl::string'.  (C-4)
+        //
+        // Testing:
+        //   bool operator==(const SmallString<L>&, const SmallString<R>&);
+        //   bool operator==(const SmallString<N>&, const bslstl::StringRef&);
+        //   bool operator==(const bslstl::StringRef&, const SmallString<N>&);
+        //   bool operator!=(const SmallString<L>&, const SmallString<R>&);
+        //   bool operator!=(const SmallString<N>&, const bslstl::StringRef&);
+        //   bool operator!=(const bslstl::StringRef&, const SmallString<N>&);
+        //   bool operator< (const SmallString<L>&, const SmallString<R>&);
+        //   bool operator> (const SmallString<L>&, const SmallString<R>&);
+        //   bool operator<=(const SmallString<L>&, const SmallString<R>&);
+        //   bool operator>=(const SmallString<L>&, const SmallString<R>&);
+        //   ostream& operator<<(ostream& stream, const SmallString<N>& s);
+        //   void hashAppend(HASHALG& hashAlg, const SmallString<N>& string);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COMPARISON, PRINTING, AND HASHING" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_VALUES; ++ti) {
+            const Obj                     X(VALUES[ti], &ta);
+            const bsl::string             S(VALUES[ti], &ta);
+            const bslstl::StringRef       R(VALUES[ti]);
+
+            for (int tj = 0; tj < NUM_VALUES; ++tj) {
+                const bdlb::SmallString<2> Y(VALUES[tj], &ta);
+                const bsl::string          T(VALUES[tj], &ta);
+                const bslstl::StringRef    U(VALUES[tj]);
+
+                if (veryVerbose) { T_ P_(ti) P(tj) }
+
+                ASSERTV(ti, tj, (S == T) == (X == Y));
+                ASSERTV(ti, tj, (S != T) == (X != Y));
+                ASSERTV(ti, tj, (S <  T) == (X <  Y));
+                ASSERTV(ti, tj, (S >  T) == (X >  Y));
+                ASSERTV(ti, tj, (S <= T) == (X <= Y));
+                ASSERTV(ti, tj, (S >= T) == (X >= Y));
+
+                ASSERTV(ti, tj, (S == T) == (X == U));
+                ASSERTV(ti, tj, (S == T) == (R == Y));
+                ASSERTV(ti, tj, (S != T) == (X != U));
+                ASSERTV(ti, tj, (S != T) == (R != Y));
+            }
+
+            ASSERTV(ti, X == VALUES[ti]);
+            ASSERTV(ti, VALUES[ti] == X);
+            ASSERTV(ti, !(X != VALUES[ti]));
+
+            bsl::ostringstream stream(&ta);
+            stream << X;
+            ASSERTV(ti, S == stream.str());
+
+            bslh::Hash<> hasher;
+            ASSERTV(ti, hasher(S) == hasher(X));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // STRING MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each manipulator produces the value that the corresponding
+        //:   operation of 'bsl::string' produces.
+        //:
+        //: 2 After each manipulator, the characters are followed by a null
+        //:   terminator, and the capacity reflects the representation.
+        //:
+        //: 3 Memory is allocated only when the length exceeds the capacity,
+        //:   and the capacity grows geometrically on repeated appends.
+        //:
+        //: 4 Assigning or appending a 'bslstl::StringRef' referring to the
+        //:   value of the string itself, including when the string must
+        //:   allocate, produces the intended value.
+        //:
+        //: 5 'clear' keeps the capacity, and 'reserve' does not change the
+        //:   value.
+        //
+        // Plan:
+        //: 1 For every pair of values in a table, and every combination of
+        //:   'operator=', 'append', 'operator+=', 'push_back', and 'resize',
+        //:   apply the operation to a 'SmallString' and to a 'bsl::string',
+        //:   and compare the results, checking the invariants with 'isValid'.
+        //:   (C-1..2)
+        //:
+        //: 2 Append characters one at a time to an empty string, and verify
+        //:   the number of allocations.  (C-3)
+        //:
+        //: 3 Assign to and append to strings substrings of their own value,
+        //:   starting from both representations.  (C-4)
+        //:
+        //: 4 Call 'clear' and 'reserve' on strings of each value.  (C-5)
+        //
+        // Testing:
+        //   SmallString& operator=(const bslstl::StringRef& rhs);
+        //   SmallString& operator+=(const bslstl::StringRef& value);
+        //   SmallString& append(const bslstl::StringRef& value);
+        //   iterator begin();
+        //   void clear();
+        //   char *data();
+        //   iterator end();
+        //   char& operator[](size_type position);
+        //   void push_back(char character);
+        //   void reserve(size_type newCapacity);
+        //   void resize(size_type newLength, char character = '\0');
+        //   operator bslstl::StringRef() const;
+        //   const char& operator[](size_type position) const;
+        //   const_iterator begin() const;
+        //   const char *c_str() const;
+        //   size_type capacity() const;
+        //   const char *data() const;
+        //   bool empty() const;
+        //   const_iterator end() const;
+        //   size_type length() const;
+        //   size_type size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STRING MANIPULATORS AND ACCESSORS" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nCompare with 'bsl::string'." << endl;
+
+        for (int ti = 0; ti < NUM_VALUES; ++ti) {
+            for (int tj = 0; tj < NUM_VALUES; ++tj) {
+                const bslstl::StringRef U(VALUES[tj]);
+
+                if (veryVerbose) { T_ P_(ti) P(tj) }
+
+                {
+                    Obj         mX(VALUES[ti], &ta);  const Obj& X = mX;
+                    bsl::string mS(VALUES[ti], &ta);
+
+                    mX = U;
+                    mS.assign(U.data(), U.length());
+                    ASSERTV(ti, tj, isValid(X));
+                    ASSERTV(ti, tj, mS == bsl::string(X.c_str(), &ta));
+                }
+                {
+                    Obj         mX(VALUES[ti], &ta);  const Obj& X = mX;
+                    bsl::string mS(VALUES[ti], &ta);
+
+                    mX.append(U);
+                    mS.append(U.data(), U.length());
+                    ASSERTV(ti, tj, isValid(X));
+                    ASSERTV(ti, tj, mS == bsl::string(X.c_str(), &ta));
+
+                    mX += U;
+                    mS.append(U.data(), U.length());
+                    ASSERTV(ti, tj, isValid(X));
+                    ASSERTV(ti, tj, mS == bsl::string(X.c_str(), &ta));
+                }
+                {
+                    Obj         mX(VALUES[ti], &ta);  const Obj& X = mX;
+                    bsl::string mS(VALUES[ti], &ta);
+
+                    for (bsl::size_t k = 0; k < U.length(); ++k) {
+                        mX.push_back(U[k]);
+                        mS.push_back(U[k]);
+                        ASSERTV(ti, tj, k, isValid(X));
+                    }
+                    ASSERTV(ti, tj, mS == bsl::string(X.c_str(), &ta));
+                }
+                {
+                    Obj         mX(VALUES[ti], &ta);  const Obj& X = mX;
+                    bsl::string mS(VALUES[ti], &ta);
+
+                    mX.resize(U.length(), 'x');
+                    mS.resize(U.length(), 'x');
+                    ASSERTV(ti, tj, isValid(X));
+                    ASSERTV(ti, tj, mS == bsl::string(X.data(), X.length(),
+                                                      &ta));
+
+                    mX.resize(U.length() + 3);
+                    mS.resize(U.length() + 3);
+                    ASSERTV(ti, tj, isValid(X));
+                    ASSERTV(ti, tj, mS == bsl::string(X.data(), X.length(),
+                                                      &ta));
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nVerify element access." << endl;
+        {
+            Obj mX("abc", &ta);  const Obj& X = mX;
+
+            mX[1] = 'B';
+            *mX.begin()     = 'A';
+            *(mX.end() - 1) = 'C';
+            mX.data()[0]    = 'a';
+
+            ASSERT('a' == X[0]);
+            ASSERT('B' == X[1]);
+            ASSERT('C' == X[2]);
+            ASSERT(X.begin() + 3 == X.end());
+            ASSERT("aBC" == bslstl::StringRef(X));
+            ASSERT(isValid(X));
+        }
+
+        if (verbose) cout << "\nVerify geometric growth." << endl;
+        {
+            bslma::TestAllocator sa("string", veryVeryVerbose);
+
+            Obj mX(&sa);  const Obj& X = mX;
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.push_back(static_cast<char>('a' + i % 26));
+                ASSERTV(i, isValid(X));
+            }
+            ASSERTV(sa.numBlocksTotal(), sa.numBlocksTotal() <= 10);
+            ASSERT(1 == sa.numBlocksInUse());
+
+            Obj mY(&sa);  const Obj& Y = mY;
+
+            for (int i = 0; i < 1000; ++i) {
+                mY.append("xyz");
+                ASSERTV(i, isValid(Y));
+            }
+            ASSERTV(sa.numBlocksTotal(), sa.numBlocksTotal() <= 20);
+            ASSERT(3000 == Y.length());
+        }
+
+        if (verbose) cout << "\nVerify aliasing arguments." << endl;
+        {
+            for (int ti = 0; ti < NUM_VALUES; ++ti) {
+                const bsl::string S(VALUES[ti], &ta);
+
+                for (bsl::size_t pos = 0; pos <= S.length(); ++pos) {
+                    if (veryVerbose) { T_ P_(ti) P(pos) }
+
+                    {
+                        Obj mX(VALUES[ti], &ta);  const Obj& X = mX;
+
+                        mX = bdlb::StringRefUtil::substr(X, pos);
+                        ASSERTV(ti, pos, isValid(X));
+                        ASSERTV(ti, pos, S.substr(pos) == X.c_str());
+                    }
+                    {
+                        Obj mX(VALUES[ti], &ta);  const Obj& X = mX;
+
+                        mX.append(bdlb::StringRefUtil::substr(X, pos));
+                        ASSERTV(ti, pos, isValid(X));
+                        ASSERTV(ti, pos, S + S.substr(pos) == X.c_str());
+                    }
+                    {
+                        Obj mX(VALUES[ti], &ta);  const Obj& X = mX;
+
+                        mX += X;
+                        mX += bdlb::StringRefUtil::substr(X, 0, pos);
+                        ASSERTV(ti, pos, isValid(X));
+                        ASSERTV(ti, pos, S + S + S.substr(0, pos) ==
+                                                                   X.c_str());
+                    }
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nVerify 'clear' and 'reserve'." << endl;
+        {
+            for (int ti = 0; ti < NUM_VALUES; ++ti) {
+                Obj mX(VALUES[ti], &ta);  const Obj& X = mX;
+
+                const bsl::size_t CAPACITY = X.capacity();
+
+                mX.reserve(0);
+                ASSERTV(ti, CAPACITY == X.capacity());
+                ASSERTV(ti, VALUES[ti] == X);
+
+                mX.reserve(100);
+                ASSERTV(ti, 100 <= X.capacity());
+                ASSERTV(ti, !X.isInline());
+                ASSERTV(ti, VALUES[ti] == X);
+                ASSERTV(ti, isValid(X));
+
+                const bsl::size_t RESERVED = X.capacity();
+
+                mX.clear();
+                ASSERTV(ti, RESERVED == X.capacity());
+                ASSERTV(ti, X.empty());
+                ASSERTV(ti, isValid(X));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        //: 1 Each constructor creates a string having the intended value and
+        //:   using the intended allocator, which is the default allocator if
+        //:   none (or 0) is supplied.
+        //:
+        //: 2 A string of at most 'INLINE_CAPACITY' characters is held inline
+        //:   and allocates no memory.
+        //:
+        //: 3 Moving a string holding allocated memory, with the same
+        //:   allocator, transfers the memory and leaves the source empty and
+        //:   valid; moving with a different allocator, or moving an inline
+        //:   string, leaves the source valid.
+        //:
+        //: 4 Copy and move assignment (including of a string to itself)
+        //:   produce the value of the source.
+        //:
+        //: 5 'swap' exchanges values across all combinations of
+        //:   representations, without allocating.
+        //
+        // Plan:
+        //: 1 For each value in a table, create strings with each constructor,
+        //:   with and without an allocator, and verify their values,
+        //:   representations, allocators, and the memory they use.  (C-1..3)
+        //:
+        //: 2 For every pair of values in the table, copy-assign, move-assign,
+        //:   and swap strings, verifying values and allocations.  (C-4..5)
+        //
+        // Testing:
+        //   explicit SmallString(bslma::Allocator *basicAllocator = 0);
+        //   explicit SmallString(const StringRef& value, *basicAllocator = 0);
+        //   SmallString(const SmallString& original, *basicAllocator = 0);
+        //   SmallString(MovableRef<SmallString> original);
+        //   SmallString(MovableRef<SmallString> original, *basicAllocator);
+        //   SmallString& operator=(const SmallString& rhs);
+        //   SmallString& operator=(MovableRef<SmallString> rhs);
+        //   void swap(SmallString& other);
+        //   bslma::Allocator *allocator() const;
+        //   bool isInline() const;
+        //   void swap(SmallString<N>& a, SmallString<N>& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, ASSIGNMENT, AND SWAP" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator ta("test",  veryVeryVerbose);
+        bslma::TestAllocator oa("other", veryVeryVerbose);
+
+        if (verbose) cout << "\nDefault and value constructors." << endl;
+        {
+            {
+                const Obj X;
+                ASSERT(&defaultAllocator == X.allocator());
+                ASSERT(X.empty());
+                ASSERT(X.isInline());
+                ASSERT(isValid(X));
+            }
+            {
+                const Obj X(&ta);
+                ASSERT(&ta == X.allocator());
+                ASSERT(isValid(X));
+            }
+            {
+                const Obj X(static_cast<bslma::Allocator *>(0));
+                ASSERT(&defaultAllocator == X.allocator());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+            for (int ti = 0; ti < NUM_VALUES; ++ti) {
+                const bslstl::StringRef V(VALUES[ti]);
+                const bool              INLINE = V.length() <= 8;
+
+                const Obj X(V, &ta);
+                ASSERTV(ti, V == X);
+                ASSERTV(ti, INLINE == X.isInline());
+                ASSERTV(ti, (INLINE ? 0 : 1) == ta.numBlocksInUse());
+                ASSERTV(ti, isValid(X));
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nCopy and move constructors." << endl;
+        {
+            for (int ti = 0; ti < NUM_VALUES; ++ti) {
+                const bslstl::StringRef V(VALUES[ti]);
+                const bool              INLINE = V.length() <= 8;
+
+                if (veryVerbose) { T_ P(ti) }
+
+                Obj mZ(V, &ta);  const Obj& Z = mZ;
+
+                {
+                    const Obj X(Z);
+                    ASSERTV(ti, &defaultAllocator == X.allocator());
+                    ASSERTV(ti, V == X);
+                    ASSERTV(ti, isValid(X));
+                }
+                {
+                    const Obj X(Z, &oa);
+                    ASSERTV(ti, &oa == X.allocator());
+                    ASSERTV(ti, V == X);
+                    ASSERTV(ti, (INLINE ? 0 : 1) == oa.numBlocksInUse());
+                }
+                {
+                    Obj mY(Z, &ta);  const Obj& Y = mY;
+
+                    bslma::TestAllocatorMonitor tam(&ta);
+
+                    const Obj X(MoveUtil::move(mY));
+                    ASSERTV(ti, &ta == X.allocator());
+                    ASSERTV(ti, V == X);
+                    ASSERTV(ti, tam.isTotalSame());
+                    ASSERTV(ti, isValid(Y));
+                    ASSERTV(ti, INLINE || Y.empty());
+                    ASSERTV(ti, Y.isInline());
+                }
+                {
+                    Obj mY(Z, &ta);  const Obj& Y = mY;
+
+                    bslma::TestAllocatorMonitor tam(&ta);
+
+                    const Obj X(MoveUtil::move(mY), &ta);
+                    ASSERTV(ti, &ta == X.allocator());
+                    ASSERTV(ti, V == X);
+                    ASSERTV(ti, tam.isTotalSame());
+                    ASSERTV(ti, isValid(Y));
+                }
+                {
+                    Obj mY(Z, &ta);  const Obj& Y = mY;
+
+                    const Obj X(MoveUtil::move(mY), &oa);
+                    ASSERTV(ti, &oa == X.allocator());
+                    ASSERTV(ti, V == X);
+                    ASSERTV(ti, V == Y);
+                    ASSERTV(ti, isValid(Y));
+                }
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nAssignment and swap." << endl;
+        {
+            for (int ti = 0; ti < NUM_VALUES; ++ti) {
+                const bslstl::StringRef V(VALUES[ti]);
+
+                for (int tj = 0; tj < NUM_VALUES; ++tj) {
+                    const bslstl::StringRef W(VALUES[tj]);
+
+                    if (veryVerbose) { T_ P_(ti) P(tj) }
+
+                    {
+                        Obj mX(V, &ta);  const Obj& X = mX;
+                        Obj mY(W, &oa);  const Obj& Y = mY;
+
+                        Obj *mR = &(mX = Y);
+                        ASSERTV(ti, tj, mR == &mX);
+                        ASSERTV(ti, tj, W == X);
+                        ASSERTV(ti, tj, &ta == X.allocator());
+                        ASSERTV(ti, tj, isValid(X));
+
+                        mX = X;
+                        ASSERTV(ti, tj, W == X);
+                    }
+                    {
+                        Obj mX(V, &ta);  const Obj& X = mX;
+                        Obj mY(W, &ta);  const Obj& Y = mY;
+
+                        Obj *mR = &(mX = MoveUtil::move(mY));
+                        ASSERTV(ti, tj, mR == &mX);
+                        ASSERTV(ti, tj, W == X);
+                        ASSERTV(ti, tj, isValid(X));
+                        ASSERTV(ti, tj, isValid(Y));
+
+                        mX = MoveUtil::move(mX);
+                        ASSERTV(ti, tj, W == X);
+                    }
+                    {
+                        Obj mX(V, &ta);  const Obj& X = mX;
+                        Obj mY(W, &oa);  const Obj& Y = mY;
+
+                        mX = MoveUtil::move(mY);
+                        ASSERTV(ti, tj, W == X);
+                        ASSERTV(ti, tj, &ta == X.allocator());
+                        ASSERTV(ti, tj, isValid(Y));
+                    }
+                    {
+                        Obj mX(V, &ta);  const Obj& X = mX;
+                        Obj mY(W, &ta);  const Obj& Y = mY;
+
+                        bslma::TestAllocatorMonitor tam(&ta);
+
+                        mX.swap(mY);
+                        ASSERTV(ti, tj, W == X);
+                        ASSERTV(ti, tj, V == Y);
+                        ASSERTV(ti, tj, isValid(X));
+                        ASSERTV(ti, tj, isValid(Y));
+
+                        swap(mX, mY);
+                        ASSERTV(ti, tj, V == X);
+                        ASSERTV(ti, tj, W == Y);
+                        ASSERTV(ti, tj, tam.isTotalSame());
+                    }
+                }
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);  const Obj& X = mX;
+            Obj mY(&ta);
+            Obj mZ(&oa);
+
+            ASSERT_SAFE_FAIL(X[0]);
+            mX.push_back('a');
+            ASSERT_SAFE_PASS(X[0]);
+
+            ASSERT_SAFE_PASS(mX.swap(mY));
+            ASSERT_SAFE_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Build a string across its inline capacity, and verify its value
+        //:   and representation.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+        ASSERT(X.empty());
+        ASSERT(8 == X.capacity());
+        ASSERT(0 == bsl::strcmp("", X.c_str()));
+
+        mX = "abcd";
+        mX.append("efgh");
+        ASSERT("abcdefgh" == X);
+        ASSERT(X.isInline());
+        ASSERT(0 == ta.numBlocksTotal());
+
+        mX.push_back('i');
+        ASSERT("abcdefghi" == X);
+        ASSERT(!X.isInline());
+        ASSERT(1 == ta.numBlocksInUse());
+        ASSERT(0 == bsl::strcmp("abcdefghi", X.c_str()));
+
+        Obj mY(X, &ta);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.resize(3);
+        ASSERT("abc" == Y);
+        ASSERT(Y < X);
+
+        mX.clear();
+        ASSERT(X.empty());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
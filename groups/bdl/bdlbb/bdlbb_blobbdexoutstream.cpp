@@ -0,0 +1,124 @@
+// bdlbb_blobbdexoutstream.cpp                                        -*-C++-*-
+#include <bdlbb_blobbdexoutstream.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_blobbdexoutstream_cpp,"$Id$ $CSID$")
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                         // -----------------------
+                         // class BlobBdexOutStream
+                         // -----------------------
+
+// PRIVATE MANIPULATORS
+void BlobBdexOutStream::advanceBuffer()
+{
+    BSLS_ASSERT(d_cursor_p == d_end_p);
+
+    const int position  = length();
+    const int nextIndex = d_bufferIndex + 1;
+
+    if (nextIndex >= d_blob_p->numBuffers()) {
+        // All buffers are full; have the blob obtain another one from its
+        // factory.
+
+        BSLS_ASSERT(position == d_blob_p->totalSize());
+
+        d_blob_p->setLength(position + 1);
+    }
+    d_blob_p->setLength(position);
+
+    const BlobBuffer& buffer = d_blob_p->buffer(nextIndex);
+
+    d_bufferIndex  = nextIndex;
+    d_bufferOffset = position;
+    d_begin_p      = buffer.data();
+    d_cursor_p     = d_begin_p;
+    d_end_p        = d_begin_p + buffer.size();
+}
+
+void BlobBdexOutStream::writeBytes(const char *bytes, int numBytes)
+{
+    BSLS_ASSERT(0 <= numBytes);
+
+    while (true) {
+        const int available = static_cast<int>(d_end_p - d_cursor_p);
+
+        if (numBytes <= available) {
+            if (numBytes) {
+                bsl::memcpy(d_cursor_p, bytes, numBytes);
+                d_cursor_p += numBytes;
+            }
+            return;                                                   // RETURN
+        }
+
+        if (available) {
+            bsl::memcpy(d_cursor_p, bytes, available);
+            d_cursor_p += available;
+            bytes      += available;
+            numBytes   -= available;
+        }
+        advanceBuffer();
+    }
+}
+
+// CREATORS
+BlobBdexOutStream::BlobBdexOutStream(Blob *blob, int versionSelector)
+: d_blob_p(blob)
+, d_begin_p(0)
+, d_cursor_p(0)
+, d_end_p(0)
+, d_bufferIndex(-1)
+, d_bufferOffset(0)
+, d_versionSelector(versionSelector)
+, d_validFlag(true)
+{
+    BSLS_ASSERT(blob);
+
+    // Locate the buffer holding the first unused byte of the blob.  If every
+    // buffer is full, the stream starts without a current buffer, positioned
+    // after the last buffer.
+
+    const int position   = blob->length();
+    const int numBuffers = blob->numBuffers();
+
+    int offset = 0;
+    for (int i = 0; i < numBuffers; ++i) {
+        const BlobBuffer& buffer = blob->buffer(i);
+
+        if (position < offset + buffer.size()) {
+            d_bufferIndex  = i;
+            d_bufferOffset = offset;
+            d_begin_p      = buffer.data();
+            d_cursor_p     = d_begin_p + (position - offset);
+            d_end_p        = d_begin_p + buffer.size();
+            return;                                                   // RETURN
+        }
+        offset += buffer.size();
+    }
+
+    d_bufferIndex  = numBuffers - 1;
+    d_bufferOffset = position;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
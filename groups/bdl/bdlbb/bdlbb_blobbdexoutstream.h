@@ -0,0 +1,1012 @@
+// bdlbb_blobbdexoutstream.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLBB_BLOBBDEXOUTSTREAM
+#define INCLUDED_BDLBB_BLOBBDEXOUTSTREAM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a BDEX output stream that writes directly into a blob.
+//
+//@CLASSES:
+//  bdlbb::BlobBdexOutStream: BDEX 'OutStream' appending to a 'bdlbb::Blob'
+//
+//@SEE_ALSO: bslx_byteoutstream, bslx_genericoutstream, bdlbb_blobstreambuf
+//
+//@DESCRIPTION: This component provides a BDEX output stream class,
+// 'bdlbb::BlobBdexOutStream', that externalizes values, and arrays of values,
+// of fundamental types, and 'bsl::string' values, directly into the buffers of
+// a held 'bdlbb::Blob'.  The stream satisfies the BDEX 'OutStream' protocol
+// (see the 'bslx' package-level documentation) and writes exactly the same
+// bytes as 'bslx::ByteOutStream', so its output can be read with
+// 'bslx::ByteInStream' (or any other BDEX 'InStream') once the bytes have
+// been gathered.
+//
+// Unlike 'bslx::ByteOutStream', which grows a single contiguous buffer (and
+// therefore copies everything written so far each time it grows), a
+// 'bdlbb::BlobBdexOutStream' never moves data that has already been written:
+// when the current blob buffer is exhausted the stream continues in the next
+// buffer, obtaining new buffers from the blob's buffer factory as needed.
+// Values that straddle a buffer boundary are split across the two buffers.
+// Arrays are externalized in runs of whole elements directly into each
+// buffer, using the bulk conversion functions of 'bslx::MarshallingUtil', so
+// a large payload is converted and written in a single pass.  Compared with
+// 'bslx::GenericOutStream<bdlbb::OutBlobStreamBuf>', no virtual function is
+// called per value and no intermediate staging buffer is used.
+//
+// A 'bdlbb::BlobBdexOutStream' appends to the data already in the blob,
+// starting at the blob's length at the time the stream is created.  The
+// length of the blob is brought up to date each time the stream moves to a
+// new buffer, by 'flush', and by the destructor; between those points the
+// blob's length may be less than the number of bytes written.  The blob must
+// not be modified other than through the stream while the stream is in use.
+// Note that, as the length of a 'bdlbb::Blob' is an 'int', a single blob can
+// hold at most 'INT_MAX' bytes.
+//
+// Note that output streams can be *invalidated* explicitly and queried for
+// *validity*.  Writing to an invalid stream has no effect.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Externalizing Into a Blob
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we want to externalize a large array of 'double' values, together
+// with a header, into a blob that will later be written to a socket.
+//
+// First, we create a blob whose buffers come from a buffer factory that
+// supplies 64-byte buffers:
+//..
+//  bdlbb::SimpleBlobBufferFactory factory(64);
+//  bdlbb::Blob                    blob(&factory);
+//..
+// Then, we create a stream on the blob and externalize the header and the
+// values.  Note that the 800 bytes of the array are spread over several
+// buffers:
+//..
+//  double values[100];
+//  for (int i = 0; i < 100; ++i) {
+//      values[i] = i * 0.5;
+//  }
+//
+//  {
+//      bdlbb::BlobBdexOutStream stream(&blob, 20180101);
+//      stream.putString(bsl::string("prices"));
+//      stream.putLength(100);
+//      stream.putArrayFloat64(values, 100);
+//      assert(stream.isValid());
+//      assert(7 + 1 + 800 == stream.length());
+//  }
+//..
+// Next, note that the blob's length is up to date once the stream has been
+// destroyed:
+//..
+//  assert(808 == blob.length());
+//  assert(13  == blob.numDataBuffers());
+//..
+// Finally, we gather the blob's data and read it back with a
+// 'bslx::ByteInStream':
+//..
+//  bsl::vector<char> data(blob.length());
+//  int               offset = 0;
+//  for (int i = 0; i < blob.numDataBuffers(); ++i) {
+//      const int size = i + 1 == blob.numDataBuffers()
+//                       ? blob.lastDataBufferLength()
+//                       : blob.buffer(i).size();
+//      bsl::memcpy(data.data() + offset, blob.buffer(i).data(), size);
+//      offset += size;
+//  }
+//
+//  bslx::ByteInStream in(data.data(), data.size());
+//  bsl::string        name;
+//  int                length;
+//  double             result[100];
+//  in.getString(name);
+//  in.getLength(length);
+//  in.getArrayFloat64(result, length);
+//  assert(in);
+//  assert("prices" == name);
+//  assert(100      == length);
+//  assert(49.5     == result[99]);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlbb_blob.h>
+
+#include <bslx_marshallingutil.h>
+#include <bslx_outstreamfunctions.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                         // =======================
+                         // class BlobBdexOutStream
+                         // =======================
+
+class BlobBdexOutStream {
+    // This class provides output methods to externalize values, and C-style
+    // arrays of values, of the fundamental integral and floating-point types,
+    // as well as 'bsl::string' values, directly into the buffers of a held
+    // 'Blob'.  Each 'put' method writes the same bytes as the corresponding
+    // method of 'bslx::ByteOutStream'.  See the 'bslx' package-level
+    // documentation for the definition of the BDEX 'OutStream' protocol.
+
+    // DATA
+    Blob *d_blob_p;           // blob to write to (held, not owned)
+
+    char *d_begin_p;          // start of the current buffer, or 0 if the
+                              // stream has no current buffer
+
+    char *d_cursor_p;         // position of the next byte to write in the
+                              // current buffer
+
+    char *d_end_p;            // end of the current buffer
+
+    int   d_bufferIndex;      // index of the current buffer in the blob
+
+    int   d_bufferOffset;     // offset within the blob of the first byte of
+                              // the current buffer
+
+    int   d_versionSelector;  // 'versionSelector' to use with 'operator<<' as
+                              // per the 'bslx' package-level documentation
+
+    int   d_validFlag;        // stream validity flag; 'true' if stream is in
+                              // valid state, 'false' otherwise
+
+    // NOT IMPLEMENTED
+    BlobBdexOutStream(const BlobBdexOutStream&);
+    BlobBdexOutStream& operator=(const BlobBdexOutStream&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    void advanceBuffer();
+        // Make the buffer following the current buffer of the held blob the
+        // current buffer, obtaining a new buffer from the blob's factory if
+        // the current buffer is the last buffer of the blob, and set the
+        // length of the blob to the offset of the new current buffer.  The
+        // behavior is undefined unless the current buffer is full.
+
+    template <class TYPE>
+    BlobBdexOutStream& putArrayElements(
+                               const TYPE  *values,
+                               int          numValues,
+                               int          elementSize,
+                               void       (*putArray)(char *,
+                                                      const TYPE *,
+                                                      int));
+        // Externalize the specified 'numValues' elements of the specified
+        // 'values' array, each occupying the specified 'elementSize' bytes in
+        // the stream, by applying the specified 'putArray' to each run of
+        // elements that fits in the current buffer.  Return a reference to
+        // this stream.  If this stream is initially invalid, this operation
+        // has no effect.
+
+    void writeBytes(const char *bytes, int numBytes);
+        // Write the specified 'numBytes' bytes from the specified 'bytes' at
+        // the current position of this stream, continuing in subsequent
+        // buffers of the held blob as needed.  The behavior is undefined
+        // unless '0 <= numBytes'.
+
+  public:
+    // CREATORS
+    BlobBdexOutStream(Blob *blob, int versionSelector);
+        // Create an output stream that appends to the data in the specified
+        // 'blob', starting at 'blob->length()', and that will use the
+        // specified (*compile*-time-defined) 'versionSelector' as needed (see
+        // the 'bslx' package-level documentation).  The behavior is undefined
+        // unless 'blob' outlives this stream, and unless 'blob' has a buffer
+        // factory if the stream needs more capacity than 'blob' already has.
+
+    ~BlobBdexOutStream();
+        // Set the length of the held blob to include all bytes written by this
+        // stream (see 'flush'), and destroy this object.
+
+    // MANIPULATORS
+    void flush();
+        // Set the length of the held blob to include all bytes written by this
+        // stream.
+
+    void invalidate();
+        // Put this output stream into an invalid state.  This function has no
+        // effect if this stream is already invalid.  Note that this function
+        // should be called whenever a value extracted from this stream is
+        // determined to be invalid, inconsistent, or otherwise incorrect.
+
+    BlobBdexOutStream& putLength(int length);
+        // If the specified 'length' is less than 128, write to this stream the
+        // one-byte integer comprised of the least-significant one byte of the
+        // 'length'; otherwise, write to this stream the four-byte, two's
+        // complement integer (in network byte order) comprised of the
+        // least-significant four bytes of the 'length' (in host byte order)
+        // with the most-significant bit set.  Return a reference to this
+        // stream.  If this stream is initially invalid, this operation has no
+        // effect.  The behavior is undefined unless '0 <= length'.
+
+    BlobBdexOutStream& putVersion(int version);
+        // Write to this stream the one-byte, two's complement unsigned integer
+        // comprised of the least-significant one byte of the specified
+        // 'version', and return a reference to this stream.  If this stream
+        // is initially invalid, this operation has no effect.
+
+                      // *** scalar integer values ***
+
+    BlobBdexOutStream& putInt64(bsls::Types::Int64 value);
+    BlobBdexOutStream& putUint64(bsls::Types::Uint64 value);
+    BlobBdexOutStream& putInt56(bsls::Types::Int64 value);
+    BlobBdexOutStream& putUint56(bsls::Types::Uint64 value);
+    BlobBdexOutStream& putInt48(bsls::Types::Int64 value);
+    BlobBdexOutStream& putUint48(bsls::Types::Uint64 value);
+    BlobBdexOutStream& putInt40(bsls::Types::Int64 value);
+    BlobBdexOutStream& putUint40(bsls::Types::Uint64 value);
+    BlobBdexOutStream& putInt32(int value);
+    BlobBdexOutStream& putUint32(unsigned int value);
+    BlobBdexOutStream& putInt24(int value);
+    BlobBdexOutStream& putUint24(unsigned int value);
+    BlobBdexOutStream& putInt16(int value);
+    BlobBdexOutStream& putUint16(unsigned int value);
+    BlobBdexOutStream& putInt8(int value);
+    BlobBdexOutStream& putUint8(unsigned int value);
+        // Write to this stream the N-byte, two's complement integer (in
+        // network byte order) comprised of the least-significant N bytes of
+        // the specified 'value' (in host byte order), where N is the number of
+        // bits in the method name divided by 8, and return a reference to
+        // this stream.  If this stream is initially invalid, this operation
+        // has no effect.
+
+                      // *** scalar floating-point values ***
+
+    BlobBdexOutStream& putFloat64(double value);
+    BlobBdexOutStream& putFloat32(float value);
+        // Write to this stream the N-byte IEEE floating-point value (in
+        // network byte order) comprised of the specified 'value', where N is
+        // the number of bits in the method name divided by 8 (see
+        // 'bslx_marshallingutil'), and return a reference to this stream.  If
+        // this stream is initially invalid, this operation has no effect.
+
+                      // *** string values ***
+
+    BlobBdexOutStream& putString(const bsl::string& value);
+        // Write to this stream the length of the specified 'value' (see
+        // 'putLength') and an array of one-byte, two's complement unsigned
+        // integers comprised of the characters of 'value', and return a
+        // reference to this stream.  If this stream is initially invalid,
+        // this operation has no effect.
+
+                      // *** arrays of integer values ***
+
+    BlobBdexOutStream& putArrayInt64(const bsls::Types::Int64 *values,
+                                     int                       numValues);
+    BlobBdexOutStream& putArrayUint64(const bsls::Types::Uint64 *values,
+                                      int                        numValues);
+    BlobBdexOutStream& putArrayInt56(const bsls::Types::Int64 *values,
+                                     int                       numValues);
+    BlobBdexOutStream& putArrayUint56(const bsls::Types::Uint64 *values,
+                                      int                        numValues);
+    BlobBdexOutStream& putArrayInt48(const bsls::Types::Int64 *values,
+                                     int                       numValues);
+    BlobBdexOutStream& putArrayUint48(const bsls::Types::Uint64 *values,
+                                      int                        numValues);
+    BlobBdexOutStream& putArrayInt40(const bsls::Types::Int64 *values,
+                                     int                       numValues);
+    BlobBdexOutStream& putArrayUint40(const bsls::Types::Uint64 *values,
+                                      int                        numValues);
+    BlobBdexOutStream& putArrayInt32(const int *values, int numValues);
+    BlobBdexOutStream& putArrayUint32(const unsigned int *values,
+                                      int                 numValues);
+    BlobBdexOutStream& putArrayInt24(const int *values, int numValues);
+    BlobBdexOutStream& putArrayUint24(const unsigned int *values,
+                                      int                 numValues);
+    BlobBdexOutStream& putArrayInt16(const short *values, int numValues);
+    BlobBdexOutStream& putArrayUint16(const unsigned short *values,
+                                      int                   numValues);
+    BlobBdexOutStream& putArrayInt8(const char *values, int numValues);
+    BlobBdexOutStream& putArrayInt8(const signed char *values, int numValues);
+    BlobBdexOutStream& putArrayUint8(const char *values, int numValues);
+    BlobBdexOutStream& putArrayUint8(const unsigned char *values,
+                                     int                  numValues);
+        // Write to this stream the consecutive N-byte, two's complement
+        // integers (in network byte order) comprised of the least-significant
+        // N bytes of each of the specified 'numValues' leading entries in the
+        // specified 'values' (in host byte order), where N is the number of
+        // bits in the method name divided by 8, and return a reference to
+        // this stream.  If this stream is initially invalid, this operation
+        // has no effect.  The behavior is undefined unless '0 <= numValues'
+        // and 'values' has sufficient contents.
+
+                      // *** arrays of floating-point values ***
+
+    BlobBdexOutStream& putArrayFloat64(const double *values, int numValues);
+    BlobBdexOutStream& putArrayFloat32(const float *values, int numValues);
+        // Write to this stream the consecutive N-byte IEEE floating-point
+        // values (in network byte order) comprised of each of the specified
+        // 'numValues' leading entries in the specified 'values', where N is
+        // the number of bits in the method name divided by 8, and return a
+        // reference to this stream.  If this stream is initially invalid,
+        // this operation has no effect.  The behavior is undefined unless
+        // '0 <= numValues' and 'values' has sufficient contents.
+
+    // ACCESSORS
+    operator const void *() const;
+        // Return a non-zero value if this stream is valid, and 0 otherwise.
+        // An invalid stream is a stream for which an output operation was
+        // detected to have failed or 'invalidate' was called.
+
+    int bdexVersionSelector() const;
+        // Return the 'versionSelector' to be used with 'operator<<' for BDEX
+        // streaming as per the 'bslx' package-level documentation.
+
+    Blob *blob() const;
+        // Return the address of the blob held by this stream.
+
+    bool isValid() const;
+        // Return 'true' if this stream is valid, and 'false' otherwise.  An
+        // invalid stream is a stream for which an output operation was
+        // detected to have failed or 'invalidate' was called.
+
+    int length() const;
+        // Return the length the held blob has once all bytes written by this
+        // stream are included (i.e., the length of the blob after 'flush').
+};
+
+// FREE OPERATORS
+template <class TYPE>
+BlobBdexOutStream& operator<<(BlobBdexOutStream& stream, const TYPE& value);
+    // Write the specified 'value' to the specified output 'stream' following
+    // the requirements of the BDEX protocol (see the 'bslx' package-level
+    // documentation), and return a reference to 'stream'.  The behavior is
+    // undefined unless 'TYPE' is BDEX-compliant.
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                         // -----------------------
+                         // class BlobBdexOutStream
+                         // -----------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+BlobBdexOutStream& BlobBdexOutStream::putArrayElements(
+                               const TYPE  *values,
+                               int          numValues,
+                               int          elementSize,
+                               void       (*putArray)(char *,
+                                                      const TYPE *,
+                                                      int))
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    while (0 < numValues) {
+        int numFit = static_cast<int>(d_end_p - d_cursor_p) / elementSize;
+
+        if (numFit) {
+            if (numFit > numValues) {
+                numFit = numValues;
+            }
+            putArray(d_cursor_p, values, numFit);
+            d_cursor_p += numFit * elementSize;
+            values     += numFit;
+            numValues  -= numFit;
+        }
+        else {
+            // The next element straddles a buffer boundary.
+
+            char bytes[8];
+            putArray(bytes, values, 1);
+            writeBytes(bytes, elementSize);
+            ++values;
+            --numValues;
+        }
+    }
+    return *this;
+}
+
+// CREATORS
+inline
+BlobBdexOutStream::~BlobBdexOutStream()
+{
+    flush();
+}
+
+// MANIPULATORS
+inline
+void BlobBdexOutStream::flush()
+{
+    const int position = length();
+    if (position > d_blob_p->length()) {
+        d_blob_p->setLength(position);
+    }
+}
+
+inline
+void BlobBdexOutStream::invalidate()
+{
+    d_validFlag = false;
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putLength(int length)
+{
+    BSLS_ASSERT_SAFE(0 <= length);
+
+    if (length > 127) {
+        putInt32(length | (1 << 31));
+    }
+    else {
+        putInt8(length);
+    }
+    return *this;
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putVersion(int version)
+{
+    return putUint8(version);
+}
+
+                      // *** scalar integer values ***
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putInt64(bsls::Types::Int64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    enum { k_SIZE = bslx::MarshallingUtil::k_SIZEOF_INT64 };
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= k_SIZE)) {
+        bslx::MarshallingUtil::putInt64(d_cursor_p, value);
+        d_cursor_p += k_SIZE;
+    }
+    else {
+        char bytes[k_SIZE];
+        bslx::MarshallingUtil::putInt64(bytes, value);
+        writeBytes(bytes, k_SIZE);
+    }
+    return *this;
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putUint64(bsls::Types::Uint64 value)
+{
+    return putInt64(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putInt56(bsls::Types::Int64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    enum { k_SIZE = bslx::MarshallingUtil::k_SIZEOF_INT56 };
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= k_SIZE)) {
+        bslx::MarshallingUtil::putInt56(d_cursor_p, value);
+        d_cursor_p += k_SIZE;
+    }
+    else {
+        char bytes[k_SIZE];
+        bslx::MarshallingUtil::putInt56(bytes, value);
+        writeBytes(bytes, k_SIZE);
+    }
+    return *this;
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putUint56(bsls::Types::Uint64 value)
+{
+    return putInt56(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putInt48(bsls::Types::Int64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    enum { k_SIZE = bslx::MarshallingUtil::k_SIZEOF_INT48 };
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= k_SIZE)) {
+        bslx::MarshallingUtil::putInt48(d_cursor_p, value);
+        d_cursor_p += k_SIZE;
+    }
+    else {
+        char bytes[k_SIZE];
+        bslx::MarshallingUtil::putInt48(bytes, value);
+        writeBytes(bytes, k_SIZE);
+    }
+    return *this;
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putUint48(bsls::Types::Uint64 value)
+{
+    return putInt48(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putInt40(bsls::Types::Int64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    enum { k_SIZE = bslx::MarshallingUtil::k_SIZEOF_INT40 };
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= k_SIZE)) {
+        bslx::MarshallingUtil::putInt40(d_cursor_p, value);
+        d_cursor_p += k_SIZE;
+    }
+    else {
+        char bytes[k_SIZE];
+        bslx::MarshallingUtil::putInt40(bytes, value);
+        writeBytes(bytes, k_SIZE);
+    }
+    return *this;
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putUint40(bsls::Types::Uint64 value)
+{
+    return putInt40(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putInt32(int value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    enum { k_SIZE = bslx::MarshallingUtil::k_SIZEOF_INT32 };
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= k_SIZE)) {
+        bslx::MarshallingUtil::putInt32(d_cursor_p, value);
+        d_cursor_p += k_SIZE;
+    }
+    else {
+        char bytes[k_SIZE];
+        bslx::MarshallingUtil::putInt32(bytes, value);
+        writeBytes(bytes, k_SIZE);
+    }
+    return *this;
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putUint32(unsigned int value)
+{
+    return putInt32(static_cast<int>(value));
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putInt24(int value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    enum { k_SIZE = bslx::MarshallingUtil::k_SIZEOF_INT24 };
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= k_SIZE)) {
+        bslx::MarshallingUtil::putInt24(d_cursor_p, value);
+        d_cursor_p += k_SIZE;
+    }
+    else {
+        char bytes[k_SIZE];
+        bslx::MarshallingUtil::putInt24(bytes, value);
+        writeBytes(bytes, k_SIZE);
+    }
+    return *this;
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putUint24(unsigned int value)
+{
+    return putInt24(static_cast<int>(value));
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putInt16(int value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    enum { k_SIZE = bslx::MarshallingUtil::k_SIZEOF_INT16 };
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= k_SIZE)) {
+        bslx::MarshallingUtil::putInt16(d_cursor_p, value);
+        d_cursor_p += k_SIZE;
+    }
+    else {
+        char bytes[k_SIZE];
+        bslx::MarshallingUtil::putInt16(bytes, value);
+        writeBytes(bytes, k_SIZE);
+    }
+    return *this;
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putUint16(unsigned int value)
+{
+    return putInt16(static_cast<int>(value));
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putInt8(int value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_cursor_p != d_end_p)) {
+        bslx::MarshallingUtil::putInt8(d_cursor_p, value);
+        ++d_cursor_p;
+    }
+    else {
+        char byte;
+        bslx::MarshallingUtil::putInt8(&byte, value);
+        writeBytes(&byte, 1);
+    }
+    return *this;
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putUint8(unsigned int value)
+{
+    return putInt8(static_cast<int>(value));
+}
+
+                      // *** scalar floating-point values ***
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putFloat64(double value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    enum { k_SIZE = bslx::MarshallingUtil::k_SIZEOF_FLOAT64 };
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= k_SIZE)) {
+        bslx::MarshallingUtil::putFloat64(d_cursor_p, value);
+        d_cursor_p += k_SIZE;
+    }
+    else {
+        char bytes[k_SIZE];
+        bslx::MarshallingUtil::putFloat64(bytes, value);
+        writeBytes(bytes, k_SIZE);
+    }
+    return *this;
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putFloat32(float value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    enum { k_SIZE = bslx::MarshallingUtil::k_SIZEOF_FLOAT32 };
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p - d_cursor_p >= k_SIZE)) {
+        bslx::MarshallingUtil::putFloat32(d_cursor_p, value);
+        d_cursor_p += k_SIZE;
+    }
+    else {
+        char bytes[k_SIZE];
+        bslx::MarshallingUtil::putFloat32(bytes, value);
+        writeBytes(bytes, k_SIZE);
+    }
+    return *this;
+}
+
+                      // *** string values ***
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putString(const bsl::string& value)
+{
+    const int length = static_cast<int>(value.length());
+    putLength(length);
+    return putArrayUint8(value.data(), length);
+}
+
+                      // *** arrays of integer values ***
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayInt64(
+                                          const bsls::Types::Int64 *values,
+                                          int                       numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT64,
+                            &bslx::MarshallingUtil::putArrayInt64);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayUint64(
+                                         const bsls::Types::Uint64 *values,
+                                         int                        numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT64,
+                            &bslx::MarshallingUtil::putArrayInt64);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayInt56(
+                                          const bsls::Types::Int64 *values,
+                                          int                       numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT56,
+                            &bslx::MarshallingUtil::putArrayInt56);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayUint56(
+                                         const bsls::Types::Uint64 *values,
+                                         int                        numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT56,
+                            &bslx::MarshallingUtil::putArrayInt56);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayInt48(
+                                          const bsls::Types::Int64 *values,
+                                          int                       numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT48,
+                            &bslx::MarshallingUtil::putArrayInt48);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayUint48(
+                                         const bsls::Types::Uint64 *values,
+                                         int                        numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT48,
+                            &bslx::MarshallingUtil::putArrayInt48);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayInt40(
+                                          const bsls::Types::Int64 *values,
+                                          int                       numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT40,
+                            &bslx::MarshallingUtil::putArrayInt40);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayUint40(
+                                         const bsls::Types::Uint64 *values,
+                                         int                        numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT40,
+                            &bslx::MarshallingUtil::putArrayInt40);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayInt32(const int *values,
+                                                    int        numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT32,
+                            &bslx::MarshallingUtil::putArrayInt32);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayUint32(
+                                                const unsigned int *values,
+                                                int                 numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT32,
+                            &bslx::MarshallingUtil::putArrayInt32);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayInt24(const int *values,
+                                                    int        numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT24,
+                            &bslx::MarshallingUtil::putArrayInt24);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayUint24(
+                                                const unsigned int *values,
+                                                int                 numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT24,
+                            &bslx::MarshallingUtil::putArrayInt24);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayInt16(const short *values,
+                                                    int          numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT16,
+                            &bslx::MarshallingUtil::putArrayInt16);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayUint16(
+                                              const unsigned short *values,
+                                              int                   numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_INT16,
+                            &bslx::MarshallingUtil::putArrayInt16);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayInt8(const char *values,
+                                                   int         numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    writeBytes(values, numValues);
+    return *this;
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayInt8(
+                                                 const signed char *values,
+                                                 int                numValues)
+{
+    return putArrayInt8(reinterpret_cast<const char *>(values), numValues);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayUint8(const char *values,
+                                                    int         numValues)
+{
+    return putArrayInt8(values, numValues);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayUint8(
+                                               const unsigned char *values,
+                                               int                  numValues)
+{
+    return putArrayInt8(reinterpret_cast<const char *>(values), numValues);
+}
+
+                      // *** arrays of floating-point values ***
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayFloat64(const double *values,
+                                                      int           numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_FLOAT64,
+                            &bslx::MarshallingUtil::putArrayFloat64);
+}
+
+inline
+BlobBdexOutStream& BlobBdexOutStream::putArrayFloat32(const float *values,
+                                                      int          numValues)
+{
+    return putArrayElements(values,
+                            numValues,
+                            bslx::MarshallingUtil::k_SIZEOF_FLOAT32,
+                            &bslx::MarshallingUtil::putArrayFloat32);
+}
+
+// ACCESSORS
+inline
+BlobBdexOutStream::operator const void *() const
+{
+    return isValid() ? this : 0;
+}
+
+inline
+int BlobBdexOutStream::bdexVersionSelector() const
+{
+    return d_versionSelector;
+}
+
+inline
+Blob *BlobBdexOutStream::blob() const
+{
+    return d_blob_p;
+}
+
+inline
+bool BlobBdexOutStream::isValid() const
+{
+    return d_validFlag;
+}
+
+inline
+int BlobBdexOutStream::length() const
+{
+    return d_bufferOffset + static_cast<int>(d_cursor_p - d_begin_p);
+}
+
+// FREE OPERATORS
+template <class TYPE>
+inline
+BlobBdexOutStream& operator<<(BlobBdexOutStream& stream, const TYPE& value)
+{
+    return bslx::OutStreamFunctions::bdexStreamOut(stream, value);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
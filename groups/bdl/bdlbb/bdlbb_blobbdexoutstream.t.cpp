@@ -0,0 +1,993 @@
+// bdlbb_blobbdexoutstream.t.cpp                                      -*-C++-*-
+#include <bdlbb_blobbdexoutstream.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslx_byteinstream.h>
+#include <bslx_byteoutstream.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a BDEX output stream that writes into the
+// buffers of a 'bdlbb::Blob'.  Its contract is that every 'put' method writes
+// exactly the bytes written by the corresponding 'bslx::ByteOutStream' method,
+// wherever the buffer boundaries of the blob fall.  We therefore verify each
+// method by comparing the data of the blob with the contents of a
+// 'bslx::ByteOutStream' to which the same operations were applied, for a
+// range of blob buffer sizes and initial blob lengths, so that every value is
+// written both within a buffer and across each possible buffer boundary.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BlobBdexOutStream(Blob *blob, int versionSelector);
+// [ 2] ~BlobBdexOutStream();
+//
+// MANIPULATORS
+// [ 2] void flush();
+// [ 5] void invalidate();
+// [ 5] BlobBdexOutStream& putLength(int length);
+// [ 5] BlobBdexOutStream& putVersion(int version);
+// [ 3] BlobBdexOutStream& putInt64(Int64 value);
+// [ 3] BlobBdexOutStream& putUint64(Uint64 value);
+// [ 3] BlobBdexOutStream& putInt56(Int64 value);
+// [ 3] BlobBdexOutStream& putUint56(Uint64 value);
+// [ 3] BlobBdexOutStream& putInt48(Int64 value);
+// [ 3] BlobBdexOutStream& putUint48(Uint64 value);
+// [ 3] BlobBdexOutStream& putInt40(Int64 value);
+// [ 3] BlobBdexOutStream& putUint40(Uint64 value);
+// [ 3] BlobBdexOutStream& putInt32(int value);
+// [ 3] BlobBdexOutStream& putUint32(unsigned int value);
+// [ 3] BlobBdexOutStream& putInt24(int value);
+// [ 3] BlobBdexOutStream& putUint24(unsigned int value);
+// [ 3] BlobBdexOutStream& putInt16(int value);
+// [ 3] BlobBdexOutStream& putUint16(unsigned int value);
+// [ 3] BlobBdexOutStream& putInt8(int value);
+// [ 3] BlobBdexOutStream& putUint8(unsigned int value);
+// [ 3] BlobBdexOutStream& putFloat64(double value);
+// [ 3] BlobBdexOutStream& putFloat32(float value);
+// [ 4] BlobBdexOutStream& putString(const bsl::string& value);
+// [ 4] BlobBdexOutStream& putArrayInt64(const Int64 *values, int num);
+// [ 4] BlobBdexOutStream& putArrayUint64(const Uint64 *values, int num);
+// [ 4] BlobBdexOutStream& putArrayInt56(const Int64 *values, int num);
+// [ 4] BlobBdexOutStream& putArrayUint56(const Uint64 *values, int num);
+// [ 4] BlobBdexOutStream& putArrayInt48(const Int64 *values, int num);
+// [ 4] BlobBdexOutStream& putArrayUint48(const Uint64 *values, int num);
+// [ 4] BlobBdexOutStream& putArrayInt40(const Int64 *values, int num);
+// [ 4] BlobBdexOutStream& putArrayUint40(const Uint64 *values, int num);
+// [ 4] BlobBdexOutStream& putArrayInt32(const int *values, int num);
+// [ 4] BlobBdexOutStream& putArrayUint32(const unsigned *values, int num);
+// [ 4] BlobBdexOutStream& putArrayInt24(const int *values, int num);
+// [ 4] BlobBdexOutStream& putArrayUint24(const unsigned *values, int num);
+// [ 4] BlobBdexOutStream& putArrayInt16(const short *values, int num);
+// [ 4] BlobBdexOutStream& putArrayUint16(const ushort *values, int num);
+// [ 4] BlobBdexOutStream& putArrayInt8(const char *values, int num);
+// [ 4] BlobBdexOutStream& putArrayInt8(const schar *values, int num);
+// [ 4] BlobBdexOutStream& putArrayUint8(const char *values, int num);
+// [ 4] BlobBdexOutStream& putArrayUint8(const uchar *values, int num);
+// [ 4] BlobBdexOutStream& putArrayFloat64(const double *values, int num);
+// [ 4] BlobBdexOutStream& putArrayFloat32(const float *values, int num);
+//
+// ACCESSORS
+// [ 5] operator const void *() const;
+// [ 2] int bdexVersionSelector() const;
+// [ 2] Blob *blob() const;
+// [ 5] bool isValid() const;
+// [ 2] int length() const;
+//
+// FREE OPERATORS
+// [ 5] BlobBdexOutStream& operator<<(BlobBdexOutStream&, const TYPE&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::BlobBdexOutStream Obj;
+typedef bsls::Types::Int64       Int64;
+typedef bsls::Types::Uint64      Uint64;
+
+const int VERSION_SELECTOR = 20180101;
+
+const int NUM_SCALAR_METHODS = 18;
+const int NUM_ARRAY_METHODS  = 21;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bsl::string blobData(const bdlbb::Blob& blob)
+    // Return the data bytes of the specified 'blob'.
+{
+    bsl::string result;
+    for (int i = 0; i < blob.numDataBuffers(); ++i) {
+        const int size = i + 1 == blob.numDataBuffers()
+                         ? blob.lastDataBufferLength()
+                         : blob.buffer(i).size();
+        result.append(blob.buffer(i).data(), size);
+    }
+    return result;
+}
+
+static void fillBlob(bdlbb::Blob *blob, int length)
+    // Set the length of the specified 'blob' to the specified 'length' and
+    // set its data bytes to a recognizable pattern.
+{
+    blob->setLength(length);
+
+    int index = 0;
+    for (int i = 0; i < blob->numDataBuffers(); ++i) {
+        const int size = i + 1 == blob->numDataBuffers()
+                         ? blob->lastDataBufferLength()
+                         : blob->buffer(i).size();
+        for (int j = 0; j < size; ++j, ++index) {
+            blob->buffer(i).data()[j] = static_cast<char>('a' + index % 26);
+        }
+    }
+}
+
+static bsl::string fillPattern(int length)
+    // Return the data written by 'fillBlob' for the specified 'length'.
+{
+    bsl::string result;
+    for (int i = 0; i < length; ++i) {
+        result.push_back(static_cast<char>('a' + i % 26));
+    }
+    return result;
+}
+
+template <class STREAM>
+void putScalar(STREAM *stream, int method, int seed)
+    // Apply the scalar 'put' method having the specified 'method' index in
+    // '[0 .. NUM_SCALAR_METHODS)' to the specified 'stream' with a value
+    // derived from the specified 'seed'.
+{
+    const Int64 value = (static_cast<Int64>(seed) << 40)
+                      ^ (static_cast<Int64>(seed) * 0x01020304 - 17);
+
+    switch (method) {
+      case  0: stream->putInt64(value);                                break;
+      case  1: stream->putUint64(static_cast<Uint64>(value));          break;
+      case  2: stream->putInt56(value);                                break;
+      case  3: stream->putUint56(static_cast<Uint64>(value));          break;
+      case  4: stream->putInt48(value);                                break;
+      case  5: stream->putUint48(static_cast<Uint64>(value));          break;
+      case  6: stream->putInt40(value);                                break;
+      case  7: stream->putUint40(static_cast<Uint64>(value));          break;
+      case  8: stream->putInt32(static_cast<int>(value));              break;
+      case  9: stream->putUint32(static_cast<unsigned int>(value));    break;
+      case 10: stream->putInt24(static_cast<int>(value));              break;
+      case 11: stream->putUint24(static_cast<unsigned int>(value));    break;
+      case 12: stream->putInt16(static_cast<int>(value));              break;
+      case 13: stream->putUint16(static_cast<unsigned int>(value));    break;
+      case 14: stream->putInt8(static_cast<int>(value));               break;
+      case 15: stream->putUint8(static_cast<unsigned int>(value));     break;
+      case 16: stream->putFloat64(static_cast<double>(value) / 3.0);   break;
+      case 17: stream->putFloat32(static_cast<float>(value) / 3.0f);   break;
+      default: ASSERT(!"unknown scalar method");
+    }
+}
+
+template <class STREAM>
+void putArray(STREAM *stream, int method, int numValues)
+    // Apply the array 'put' method (or 'putString') having the specified
+    // 'method' index in '[0 .. NUM_ARRAY_METHODS)' to the specified 'stream'
+    // with the specified 'numValues' values.  The behavior is undefined
+    // unless '0 <= numValues <= 64'.
+{
+    Int64          i64[64];
+    Uint64         u64[64];
+    int            i32[64];
+    unsigned int   u32[64];
+    short          i16[64];
+    unsigned short u16[64];
+    char           c8[64];
+    signed char    i8[64];
+    unsigned char  u8[64];
+    double         f64[64];
+    float          f32[64];
+
+    for (int i = 0; i < 64; ++i) {
+        const Int64 value = (static_cast<Int64>(i + 1) * 0x0123456789ALL)
+                          ^ (i % 3 ? -1 : 0);
+
+        i64[i] = value;
+        u64[i] = static_cast<Uint64>(value);
+        i32[i] = static_cast<int>(value);
+        u32[i] = static_cast<unsigned int>(value);
+        i16[i] = static_cast<short>(value);
+        u16[i] = static_cast<unsigned short>(value);
+        c8[i]  = static_cast<char>(value);
+        i8[i]  = static_cast<signed char>(value);
+        u8[i]  = static_cast<unsigned char>(value);
+        f64[i] = static_cast<double>(value) / 7.0;
+        f32[i] = static_cast<float>(value) / 7.0f;
+    }
+
+    switch (method) {
+      case  0: stream->putArrayInt64(i64, numValues);                  break;
+      case  1: stream->putArrayUint64(u64, numValues);                 break;
+      case  2: stream->putArrayInt56(i64, numValues);                  break;
+      case  3: stream->putArrayUint56(u64, numValues);                 break;
+      case  4: stream->putArrayInt48(i64, numValues);                  break;
+      case  5: stream->putArrayUint48(u64, numValues);                 break;
+      case  6: stream->putArrayInt40(i64, numValues);                  break;
+      case  7: stream->putArrayUint40(u64, numValues);                 break;
+      case  8: stream->putArrayInt32(i32, numValues);                  break;
+      case  9: stream->putArrayUint32(u32, numValues);                 break;
+      case 10: stream->putArrayInt24(i32, numValues);                  break;
+      case 11: stream->putArrayUint24(u32, numValues);                 break;
+      case 12: stream->putArrayInt16(i16, numValues);                  break;
+      case 13: stream->putArrayUint16(u16, numValues);                 break;
+      case 14: stream->putArrayInt8(c8, numValues);                    break;
+      case 15: stream->putArrayInt8(i8, numValues);                    break;
+      case 16: stream->putArrayUint8(c8, numValues);                   break;
+      case 17: stream->putArrayUint8(u8, numValues);                   break;
+      case 18: stream->putArrayFloat64(f64, numValues);                break;
+      case 19: stream->putArrayFloat32(f32, numValues);                break;
+      case 20: stream->putString(bsl::string(c8, numValues));          break;
+      default: ASSERT(!"unknown array method");
+    }
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Externalizing Into a Blob
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we want to externalize a large array of 'double' values, together
+// with a header, into a blob that will later be written to a socket.
+//
+// First, we create a blob whose buffers come from a buffer factory that
+// supplies 64-byte buffers:
+//..
+    bdlbb::SimpleBlobBufferFactory factory(64);
+    bdlbb::Blob                    blob(&factory);
+//..
+// Then, we create a stream on the blob and externalize the header and the
+// values.  Note that the 800 bytes of the array are spread over several
+// buffers:
+//..
+    double values[100];
+    for (int i = 0; i < 100; ++i) {
+        values[i] = i * 0.5;
+    }
+
+    {
+        bdlbb::BlobBdexOutStream stream(&blob, 20180101);
+        stream.putString(bsl::string("prices"));
+        stream.putLength(100);
+        stream.putArrayFloat64(values, 100);
+        ASSERT(stream.isValid());
+        ASSERT(7 + 1 + 800 == stream.length());
+    }
+//..
+// Next, note that the blob's length is up to date once the stream has been
+// destroyed:
+//..
+    ASSERT(808 == blob.length());
+    ASSERT(13  == blob.numDataBuffers());
+//..
+// Finally, we gather the blob's data and read it back with a
+// 'bslx::ByteInStream':
+//..
+    bsl::vector<char> data(blob.length());
+    int               offset = 0;
+    for (int i = 0; i < blob.numDataBuffers(); ++i) {
+        const int size = i + 1 == blob.numDataBuffers()
+                         ? blob.lastDataBufferLength()
+                         : blob.buffer(i).size();
+        bsl::memcpy(data.data() + offset, blob.buffer(i).data(), size);
+        offset += size;
+    }
+
+    bslx::ByteInStream in(data.data(), data.size());
+    bsl::string        name;
+    int                length;
+    double             result[100];
+    in.getString(name);
+    in.getLength(length);
+    in.getArrayFloat64(result, length);
+    ASSERT(in);
+    ASSERT("prices" == name);
+    ASSERT(100      == length);
+    ASSERT(49.5     == result[99]);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // VALIDITY, LENGTHS, VERSIONS, AND 'operator<<'
+        //
+        // Concerns:
+        //: 1 A stream is initially valid, and 'invalidate' makes it invalid.
+        //:
+        //: 2 'operator const void *' and 'isValid' report the validity.
+        //:
+        //: 3 No 'put' method has any effect on an invalid stream.
+        //:
+        //: 4 'putLength' writes one byte for lengths below 128 and four bytes
+        //:   otherwise, and 'putVersion' writes one byte, as
+        //:   'bslx::ByteOutStream' does.
+        //:
+        //: 5 'operator<<' externalizes BDEX-compliant types, and the result
+        //:   can be read by 'bslx::ByteInStream'.
+        //
+        // Plan:
+        //: 1 Invalidate a stream and apply every 'put' method; verify that
+        //:   neither the length of the stream nor the blob changes.
+        //:   (C-1..3)
+        //:
+        //: 2 Compare the output of 'putLength' and 'putVersion' for boundary
+        //:   values with that of 'bslx::ByteOutStream', using a buffer size
+        //:   that forces the four-byte length to straddle buffers.  (C-4)
+        //:
+        //: 3 Stream a 'bsl::vector<int>' and a 'bsl::string' with
+        //:   'operator<<' and read them back.  (C-5)
+        //
+        // Testing:
+        //   void invalidate();
+        //   BlobBdexOutStream& putLength(int length);
+        //   BlobBdexOutStream& putVersion(int version);
+        //   operator const void *() const;
+        //   bool isValid() const;
+        //   BlobBdexOutStream& operator<<(BlobBdexOutStream&, const TYPE&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALIDITY, LENGTHS, VERSIONS, AND 'operator<<'"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        if (verbose) cout << "\nTesting 'invalidate'." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(3, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            Obj mX(&blob, VERSION_SELECTOR);  const Obj& X = mX;
+            ASSERT(X.isValid());
+            ASSERT(X);
+
+            mX.putInt32(7);
+            ASSERT(4 == X.length());
+
+            mX.invalidate();
+            ASSERT(!X.isValid());
+            ASSERT(!X);
+
+            for (int method = 0; method < NUM_SCALAR_METHODS; ++method) {
+                putScalar(&mX, method, method);
+                LOOP_ASSERT(method, 4 == X.length());
+            }
+            for (int method = 0; method < NUM_ARRAY_METHODS; ++method) {
+                putArray(&mX, method, 9);
+                LOOP_ASSERT(method, 4 == X.length());
+            }
+            mX.putLength(300);
+            mX.putVersion(2);
+            mX << 5;
+            ASSERT(4 == X.length());
+
+            mX.invalidate();
+            ASSERT(!X.isValid());
+
+            mX.flush();
+            ASSERT(4 == blob.length());
+        }
+
+        if (verbose) cout << "\nTesting 'putLength' and 'putVersion'." << endl;
+        {
+            const int LENGTHS[] = { 0, 1, 127, 128, 129, 255, 256,
+                                    0x7FFFFFFF };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int prefix = 0; prefix < 3; ++prefix) {
+                bdlbb::SimpleBlobBufferFactory factory(3, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+                fillBlob(&blob, prefix);
+
+                bslx::ByteOutStream expected(VERSION_SELECTOR, &ta);
+                {
+                    Obj mX(&blob, VERSION_SELECTOR);
+                    for (int i = 0; i < NUM_LENGTHS; ++i) {
+                        mX.putLength(LENGTHS[i]);
+                        expected.putLength(LENGTHS[i]);
+                        mX.putVersion(i + 1);
+                        expected.putVersion(i + 1);
+                    }
+                }
+                LOOP_ASSERT(prefix,
+                            fillPattern(prefix) +
+                            bsl::string(expected.data(), expected.length())
+                                                            == blobData(blob));
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'operator<<'." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(5, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            bsl::vector<int> vector(&ta);
+            for (int i = 0; i < 50; ++i) {
+                vector.push_back(i * 1000 - 7);
+            }
+            const bsl::string string("a string longer than a buffer", &ta);
+
+            {
+                Obj mX(&blob, VERSION_SELECTOR);
+                ASSERT(&mX == &(mX << vector << string));
+                ASSERT(mX.isValid());
+            }
+
+            const bsl::string data = blobData(blob);
+
+            bslx::ByteInStream in(data.data(), data.length());
+            bsl::vector<int>   vectorResult(&ta);
+            bsl::string        stringResult(&ta);
+            in >> vectorResult >> stringResult;
+            ASSERT(in);
+            ASSERT(in.isEmpty());
+            ASSERT(vector == vectorResult);
+            ASSERT(string == stringResult);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ARRAY AND STRING PUT METHODS
+        //
+        // Concerns:
+        //: 1 Each array 'put' method, and 'putString', writes the same bytes
+        //:   as the corresponding 'bslx::ByteOutStream' method.
+        //:
+        //: 2 Arrays are written correctly whatever the position of the buffer
+        //:   boundaries, including elements that straddle a boundary and
+        //:   arrays larger than a buffer.
+        //:
+        //: 3 Arrays of length zero write nothing.
+        //:
+        //: 4 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of buffer sizes, for every initial blob length less
+        //:   than twice the buffer size, for every array method, and for a
+        //:   set of array lengths, write the array into a blob and compare
+        //:   the blob data with the output of a 'bslx::ByteOutStream'.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null array.  (C-4)
+        //
+        // Testing:
+        //   BlobBdexOutStream& putString(const bsl::string& value);
+        //   BlobBdexOutStream& putArrayInt64(const Int64 *values, int num);
+        //   BlobBdexOutStream& putArrayUint64(const Uint64 *values, int num);
+        //   BlobBdexOutStream& putArrayInt56(const Int64 *values, int num);
+        //   BlobBdexOutStream& putArrayUint56(const Uint64 *values, int num);
+        //   BlobBdexOutStream& putArrayInt48(const Int64 *values, int num);
+        //   BlobBdexOutStream& putArrayUint48(const Uint64 *values, int num);
+        //   BlobBdexOutStream& putArrayInt40(const Int64 *values, int num);
+        //   BlobBdexOutStream& putArrayUint40(const Uint64 *values, int num);
+        //   BlobBdexOutStream& putArrayInt32(const int *values, int num);
+        //   BlobBdexOutStream& putArrayUint32(const unsigned *values, int);
+        //   BlobBdexOutStream& putArrayInt24(const int *values, int num);
+        //   BlobBdexOutStream& putArrayUint24(const unsigned *values, int);
+        //   BlobBdexOutStream& putArrayInt16(const short *values, int num);
+        //   BlobBdexOutStream& putArrayUint16(const ushort *values, int num);
+        //   BlobBdexOutStream& putArrayInt8(const char *values, int num);
+        //   BlobBdexOutStream& putArrayInt8(const schar *values, int num);
+        //   BlobBdexOutStream& putArrayUint8(const char *values, int num);
+        //   BlobBdexOutStream& putArrayUint8(const uchar *values, int num);
+        //   BlobBdexOutStream& putArrayFloat64(const double *values, int);
+        //   BlobBdexOutStream& putArrayFloat32(const float *values, int num);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ARRAY AND STRING PUT METHODS" << endl
+                          << "============================" << endl;
+
+        const int BUFFER_SIZES[] = { 1, 2, 3, 5, 8, 13, 64 };
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES
+                                                        / sizeof *BUFFER_SIZES;
+
+        const int ARRAY_LENGTHS[] = { 0, 1, 2, 3, 7, 16, 33, 64 };
+        const int NUM_ARRAY_LENGTHS = sizeof ARRAY_LENGTHS
+                                                       / sizeof *ARRAY_LENGTHS;
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+            if (veryVerbose) { T_ P(BUFFER_SIZE) }
+
+            for (int prefix = 0; prefix < 2 * BUFFER_SIZE; ++prefix) {
+            for (int method = 0; method < NUM_ARRAY_METHODS; ++method) {
+            for (int tj = 0; tj < NUM_ARRAY_LENGTHS; ++tj) {
+                const int LENGTH = ARRAY_LENGTHS[tj];
+
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+                fillBlob(&blob, prefix);
+
+                bslx::ByteOutStream expected(VERSION_SELECTOR, &ta);
+                putArray(&expected, method, LENGTH);
+
+                {
+                    Obj mX(&blob, VERSION_SELECTOR);  const Obj& X = mX;
+                    putArray(&mX, method, LENGTH);
+
+                    LOOP4_ASSERT(BUFFER_SIZE, prefix, method, LENGTH,
+                                 X.isValid());
+                    LOOP4_ASSERT(BUFFER_SIZE, prefix, method, LENGTH,
+                                 prefix + static_cast<int>(expected.length())
+                                                                == X.length());
+                }
+
+                LOOP4_ASSERT(BUFFER_SIZE, prefix, method, LENGTH,
+                             fillPattern(prefix) +
+                             bsl::string(expected.data(), expected.length())
+                                                            == blobData(blob));
+            }
+            }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(4, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+            Obj                            mX(&blob, VERSION_SELECTOR);
+
+            const int    values[] = { 1, 2 };
+            const int   *nullInts = 0;
+            const double nullDouble[] = { 0.0 };
+            const char  *nullChars = 0;
+
+            ASSERT_SAFE_PASS(mX.putArrayInt32(values, 2));
+            ASSERT_SAFE_FAIL(mX.putArrayInt32(nullInts, 2));
+            ASSERT_SAFE_FAIL(mX.putArrayInt32(values, -1));
+            ASSERT_SAFE_PASS(mX.putArrayFloat64(nullDouble, 1));
+            ASSERT_SAFE_FAIL(mX.putArrayInt8(nullChars, 1));
+            ASSERT_SAFE_FAIL(mX.putLength(-1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SCALAR PUT METHODS
+        //
+        // Concerns:
+        //: 1 Each scalar 'put' method writes the same bytes as the
+        //:   corresponding 'bslx::ByteOutStream' method.
+        //:
+        //: 2 A value is written correctly whether it fits in the current
+        //:   buffer or straddles one or more buffer boundaries.
+        //:
+        //: 3 The data present in the blob before the stream was created is
+        //:   not modified.
+        //
+        // Plan:
+        //: 1 For every buffer size in '[1 .. 9]', for every initial blob
+        //:   length less than twice the buffer size, and for every scalar
+        //:   method, write a sequence of values into a blob and compare the
+        //:   blob data with the initial data followed by the output of a
+        //:   'bslx::ByteOutStream'.  (C-1..3)
+        //
+        // Testing:
+        //   BlobBdexOutStream& putInt64(Int64 value);
+        //   BlobBdexOutStream& putUint64(Uint64 value);
+        //   BlobBdexOutStream& putInt56(Int64 value);
+        //   BlobBdexOutStream& putUint56(Uint64 value);
+        //   BlobBdexOutStream& putInt48(Int64 value);
+        //   BlobBdexOutStream& putUint48(Uint64 value);
+        //   BlobBdexOutStream& putInt40(Int64 value);
+        //   BlobBdexOutStream& putUint40(Uint64 value);
+        //   BlobBdexOutStream& putInt32(int value);
+        //   BlobBdexOutStream& putUint32(unsigned int value);
+        //   BlobBdexOutStream& putInt24(int value);
+        //   BlobBdexOutStream& putUint24(unsigned int value);
+        //   BlobBdexOutStream& putInt16(int value);
+        //   BlobBdexOutStream& putUint16(unsigned int value);
+        //   BlobBdexOutStream& putInt8(int value);
+        //   BlobBdexOutStream& putUint8(unsigned int value);
+        //   BlobBdexOutStream& putFloat64(double value);
+        //   BlobBdexOutStream& putFloat32(float value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SCALAR PUT METHODS" << endl
+                          << "==================" << endl;
+
+        for (int bufferSize = 1; bufferSize <= 9; ++bufferSize) {
+            for (int prefix = 0; prefix < 2 * bufferSize; ++prefix) {
+                for (int method = 0; method < NUM_SCALAR_METHODS; ++method) {
+                    bdlbb::SimpleBlobBufferFactory factory(bufferSize, &ta);
+                    bdlbb::Blob                    blob(&factory, &ta);
+                    fillBlob(&blob, prefix);
+
+                    bslx::ByteOutStream expected(VERSION_SELECTOR, &ta);
+                    {
+                        Obj mX(&blob, VERSION_SELECTOR);
+                        const Obj& X = mX;
+
+                        for (int seed = 0; seed < 11; ++seed) {
+                            putScalar(&mX, method, seed);
+                            putScalar(&expected, method, seed);
+
+                            LOOP4_ASSERT(bufferSize, prefix, method, seed,
+                                         prefix +
+                                         static_cast<int>(expected.length())
+                                                                == X.length());
+                        }
+                    }
+
+                    LOOP3_ASSERT(bufferSize, prefix, method,
+                                 fillPattern(prefix) +
+                                 bsl::string(expected.data(),
+                                             expected.length())
+                                                            == blobData(blob));
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTOR, 'flush', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The stream appends at the length of the blob when it is created,
+        //:   whether that position is inside a buffer, at a buffer boundary,
+        //:   or after the last buffer.
+        //:
+        //: 2 Spare capacity already in the blob is used before new buffers
+        //:   are obtained from the factory, so a blob without a factory can
+        //:   be written up to its capacity.
+        //:
+        //: 3 The blob's length is updated when the stream moves to a new
+        //:   buffer, by 'flush', and by the destructor, and never exceeds the
+        //:   number of bytes written.
+        //:
+        //: 4 'length', 'blob', and 'bdexVersionSelector' return the expected
+        //:   values.
+        //:
+        //: 5 No memory is allocated from the default allocator.
+        //:
+        //: 6 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create streams on blobs in each of the states of C-1 and C-2,
+        //:   write bytes one at a time, and verify the lengths of the stream
+        //:   and of the blob, and the number of buffers, after each write.
+        //:   (C-1..4)
+        //:
+        //: 2 Verify that the default allocator was not used.  (C-5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null blob.  (C-6)
+        //
+        // Testing:
+        //   BlobBdexOutStream(Blob *blob, int versionSelector);
+        //   ~BlobBdexOutStream();
+        //   void flush();
+        //   int bdexVersionSelector() const;
+        //   Blob *blob() const;
+        //   int length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTOR, 'flush', AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        if (verbose) cout << "\nEmpty blob." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(4, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            {
+                Obj mX(&blob, VERSION_SELECTOR);  const Obj& X = mX;
+
+                ASSERT(&blob            == X.blob());
+                ASSERT(VERSION_SELECTOR == X.bdexVersionSelector());
+                ASSERT(0                == X.length());
+                ASSERT(0                == blob.numBuffers());
+
+                for (int i = 1; i <= 10; ++i) {
+                    mX.putInt8(i);
+
+                    LOOP_ASSERT(i, i                 == X.length());
+                    LOOP_ASSERT(i, (i + 3) / 4       == blob.numBuffers());
+                    LOOP_ASSERT(i, (i - 1) / 4 * 4   == blob.length());
+                }
+
+                mX.flush();
+                ASSERT(10 == blob.length());
+
+                mX.putInt16(0x0B0C);
+                ASSERT(10 == blob.length());
+            }
+            ASSERT(12 == blob.length());
+            ASSERT(3  == blob.numBuffers());
+            ASSERT(bsl::string("\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0A"
+                               "\x0B\x0C") == blobData(blob));
+        }
+
+        if (verbose) cout << "\nSpare capacity." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(4, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+            blob.setLength(10);
+            fillBlob(&blob, 3);
+            ASSERT(3 == blob.numBuffers());
+
+            {
+                Obj mX(&blob, VERSION_SELECTOR);  const Obj& X = mX;
+                ASSERT(3 == X.length());
+
+                mX.putArrayInt8("XYZWVUTSR", 9);
+                ASSERT(12 == X.length());
+                ASSERT(3  == blob.numBuffers());
+                ASSERT(8  == blob.length());
+
+                mX.putInt8('Q');
+                ASSERT(13 == X.length());
+                ASSERT(4  == blob.numBuffers());
+                ASSERT(12 == blob.length());
+            }
+            ASSERT(13 == blob.length());
+            ASSERT("abcXYZWVUTSRQ" == blobData(blob));
+        }
+
+        if (verbose) cout << "\nBuffer boundary and full blob." << endl;
+        {
+            for (int length = 0; length <= 8; length += 4) {
+                bdlbb::SimpleBlobBufferFactory factory(4, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+                blob.setLength(8);
+                fillBlob(&blob, length);
+
+                {
+                    Obj mX(&blob, VERSION_SELECTOR);  const Obj& X = mX;
+                    LOOP_ASSERT(length, length == X.length());
+
+                    mX.putInt8('!');
+                    LOOP_ASSERT(length, length + 1 == X.length());
+                    LOOP_ASSERT(length, (8 == length ? 3 : 2)
+                                                        == blob.numBuffers());
+                }
+                LOOP_ASSERT(length, length + 1 == blob.length());
+                LOOP_ASSERT(length, fillPattern(length) + "!"
+                                                           == blobData(blob));
+            }
+        }
+
+        if (verbose) cout << "\nBlob without a factory." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(5, &ta);
+            bdlbb::Blob                    blob(&ta);
+
+            bdlbb::BlobBuffer buffer;
+            factory.allocate(&buffer);
+            blob.appendBuffer(buffer);
+            factory.allocate(&buffer);
+            buffer.setSize(3);
+            blob.appendBuffer(buffer);
+            ASSERT(0 == blob.length());
+            ASSERT(8 == blob.totalSize());
+
+            {
+                Obj mX(&blob, VERSION_SELECTOR);  const Obj& X = mX;
+                mX.putInt64(0x0102030405060708LL);
+                ASSERT(8 == X.length());
+            }
+            ASSERT(8 == blob.length());
+            ASSERT(bsl::string("\x01\x02\x03\x04\x05\x06\x07\x08")
+                                                           == blobData(blob));
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(4, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+            bdlbb::Blob                   *nullBlob = 0;
+
+            ASSERT_PASS(Obj(&blob,    VERSION_SELECTOR));
+            ASSERT_FAIL(Obj(nullBlob, VERSION_SELECTOR));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a few values into a blob having small buffers and compare
+        //:   the blob data with the output of a 'bslx::ByteOutStream'.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bdlbb::SimpleBlobBufferFactory factory(3, &ta);
+        bdlbb::Blob                    blob(&factory, &ta);
+
+        bslx::ByteOutStream expected(VERSION_SELECTOR, &ta);
+        expected.putInt32(1).putInt8('c').putString("hello");
+        expected.putFloat64(2.5);
+
+        {
+            Obj mX(&blob, VERSION_SELECTOR);  const Obj& X = mX;
+            mX.putInt32(1).putInt8('c').putString("hello");
+            mX.putFloat64(2.5);
+
+            ASSERT(X.isValid());
+            ASSERT(19 == X.length());
+        }
+
+        ASSERT(19 == blob.length());
+        ASSERT(bsl::string(expected.data(), expected.length())
+                                                           == blobData(blob));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -917,6 +917,28 @@ class BitArray {
         // is not specified and 'effectiveEnd == end' otherwise.  The behavior
         // is undefined unless 'begin <= effectiveEnd <= length()'.
 
+    bsl::size_t find0AtNthMaxIndex(bsl::size_t n,
+                                   bsl::size_t begin = 0,
+                                   bsl::size_t end   = k_INVALID_INDEX) const;
+        // Return the index of the specified 'n'th 0 bit in this array,
+        // counting down from the most-significant bit in the range optionally
+        // specified by 'begin' and 'end', if at least 'n' such bits exist in
+        // the range, and 'k_INVALID_INDEX' otherwise.  The range is
+        // '[begin .. effectiveEnd)', where 'effectiveEnd == length()' if 'end'
+        // is not specified and 'effectiveEnd == end' otherwise.  The behavior
+        // is undefined unless '0 < n' and 'begin <= effectiveEnd <= length()'.
+
+    bsl::size_t find0AtNthMinIndex(bsl::size_t n,
+                                   bsl::size_t begin = 0,
+                                   bsl::size_t end   = k_INVALID_INDEX) const;
+        // Return the index of the specified 'n'th 0 bit in this array,
+        // counting up from the least-significant bit in the range optionally
+        // specified by 'begin' and 'end', if at least 'n' such bits exist in
+        // the range, and 'k_INVALID_INDEX' otherwise.  The range is
+        // '[begin .. effectiveEnd)', where 'effectiveEnd == length()' if 'end'
+        // is not specified and 'effectiveEnd == end' otherwise.  The behavior
+        // is undefined unless '0 < n' and 'begin <= effectiveEnd <= length()'.
+
     bsl::size_t find1AtMaxIndex(bsl::size_t begin = 0,
                                 bsl::size_t end   = k_INVALID_INDEX) const;
         // Return the index of the most-significant 1 bit in this array in the
@@ -935,6 +957,28 @@ class BitArray {
         // is not specified and 'effectiveEnd == end' otherwise.  The behavior
         // is undefined unless 'begin <= effectiveEnd <= length()'.
 
+    bsl::size_t find1AtNthMaxIndex(bsl::size_t n,
+                                   bsl::size_t begin = 0,
+                                   bsl::size_t end   = k_INVALID_INDEX) const;
+        // Return the index of the specified 'n'th 1 bit in this array,
+        // counting down from the most-significant bit in the range optionally
+        // specified by 'begin' and 'end', if at least 'n' such bits exist in
+        // the range, and 'k_INVALID_INDEX' otherwise.  The range is
+        // '[begin .. effectiveEnd)', where 'effectiveEnd == length()' if 'end'
+        // is not specified and 'effectiveEnd == end' otherwise.  The behavior
+        // is undefined unless '0 < n' and 'begin <= effectiveEnd <= length()'.
+
+    bsl::size_t find1AtNthMinIndex(bsl::size_t n,
+                                   bsl::size_t begin = 0,
+                                   bsl::size_t end   = k_INVALID_INDEX) const;
+        // Return the index of the specified 'n'th 1 bit in this array,
+        // counting up from the least-significant bit in the range optionally
+        // specified by 'begin' and 'end', if at least 'n' such bits exist in
+        // the range, and 'k_INVALID_INDEX' otherwise.  The range is
+        // '[begin .. effectiveEnd)', where 'effectiveEnd == length()' if 'end'
+        // is not specified and 'effectiveEnd == end' otherwise.  The behavior
+        // is undefined unless '0 < n' and 'begin <= effectiveEnd <= length()'.
+
     bool isAny0() const;
         // Return 'true' if the value of any bit in this array is 0, and
         // 'false' otherwise.
@@ -1714,6 +1758,36 @@ bsl::size_t BitArray::find0AtMinIndex(bsl::size_t begin, bsl::size_t end) const
     return bdlb::BitStringUtil::find0AtMinIndex(data(), begin, end);
 }
 
+inline
+bsl::size_t BitArray::find0AtNthMaxIndex(bsl::size_t n,
+                                         bsl::size_t begin,
+                                         bsl::size_t end) const
+{
+    if (k_INVALID_INDEX == end) {
+        end = d_length;
+    }
+    BSLS_ASSERT(0 < n);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(         end <= d_length);
+
+    return bdlb::BitStringUtil::find0AtNthMaxIndex(data(), begin, end, n);
+}
+
+inline
+bsl::size_t BitArray::find0AtNthMinIndex(bsl::size_t n,
+                                         bsl::size_t begin,
+                                         bsl::size_t end) const
+{
+    if (k_INVALID_INDEX == end) {
+        end = d_length;
+    }
+    BSLS_ASSERT(0 < n);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(         end <= d_length);
+
+    return bdlb::BitStringUtil::find0AtNthMinIndex(data(), begin, end, n);
+}
+
 inline
 bsl::size_t BitArray::find1AtMaxIndex(bsl::size_t begin, bsl::size_t end) const
 {
@@ -1738,6 +1812,36 @@ bsl::size_t BitArray::find1AtMinIndex(bsl::size_t begin, bsl::size_t end) const
     return bdlb::BitStringUtil::find1AtMinIndex(data(), begin, end);
 }
 
+inline
+bsl::size_t BitArray::find1AtNthMaxIndex(bsl::size_t n,
+                                         bsl::size_t begin,
+                                         bsl::size_t end) const
+{
+    if (k_INVALID_INDEX == end) {
+        end = d_length;
+    }
+    BSLS_ASSERT(0 < n);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(         end <= d_length);
+
+    return bdlb::BitStringUtil::find1AtNthMaxIndex(data(), begin, end, n);
+}
+
+inline
+bsl::size_t BitArray::find1AtNthMinIndex(bsl::size_t n,
+                                         bsl::size_t begin,
+                                         bsl::size_t end) const
+{
+    if (k_INVALID_INDEX == end) {
+        end = d_length;
+    }
+    BSLS_ASSERT(0 < n);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(         end <= d_length);
+
+    return bdlb::BitStringUtil::find1AtNthMinIndex(data(), begin, end, n);
+}
+
 inline
 bool BitArray::isAny0() const
 {
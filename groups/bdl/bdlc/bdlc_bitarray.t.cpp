@@ -33,6 +33,7 @@
 
 #include <bsl_iostream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bsl_sstream.h>
 #include <bsl_new.h>         // placement syntax
 
@@ -133,6 +134,10 @@ using bsl::uint64_t;
 // [28] size_t find0AtMinIndex(size_t begin, size_t end) const;
 // [27] size_t find1AtMaxIndex(size_t begin, size_t end) const;
 // [28] size_t find1AtMinIndex(size_t begin, size_t end) const;
+// [31] size_t find0AtNthMaxIndex(size_t n, size_t b, size_t e) const;
+// [31] size_t find0AtNthMinIndex(size_t n, size_t b, size_t e) const;
+// [31] size_t find1AtNthMaxIndex(size_t n, size_t b, size_t e) const;
+// [31] size_t find1AtNthMinIndex(size_t n, size_t b, size_t e) const;
 // [ 4] bool isAny0() const;
 // [ 4] bool isAny1() const;
 // [ 4] bool isEmpty() const;
@@ -156,7 +161,7 @@ using bsl::uint64_t;
 // [ 5] ostream& operator<<(ostream&, const BitArray&);
 // [ 8] void swap(BitArray& lhs, BitArray& rhs);
 //-----------------------------------------------------------------------------
-// [31] USAGE EXAMPLE
+// [32] USAGE EXAMPLE
 // [ 3] BitArray gDispatch(const char *spec);
 // [ 3] BitArray& gg(BitArray* object, const char *spec);
 // [ 3] BitArray& ggDispatch(BitArray* object, const char *spec);
@@ -1360,6 +1365,157 @@ void testFind1AtMinIndex()
         }
 }
 
+static
+void testFindNth()
+    // Test all overloads of the 'find[01]AtNth{Max,Min}Index' methods.  See
+    // documentation in case 31 of the main 'switch' statement.
+{
+        bslma::TestAllocator testAllocator(veryVeryVerbose);
+
+        const char *SPECS[] = {
+           "0",      "01",     "011",    "0110",   "01100", "111111",
+           "0110001",         "01100011",         "011000110",
+           "011000110001100", "0110001100011000", "01100011000110001",
+           "0000100011100001001100000100110",
+           "00001000111000010011000001001101",
+           "000010001110000100110000010011010000100011100001001100000100110",
+           "0000100011100001001100000100110100001000111000010011000001001100",
+           "00001000111000010011000001001101000010001110000100110000010011001",
+           "xhaq5haq5w3", "xh4w7q9ha", "xqah5yca532wdwb",
+           "xh01wwww0", "xwwww0h01h0", "xww0h01h0ww0",
+           0}; // Null string required as last element.
+
+        {
+            // Verify results for empty array.
+
+            const Obj X;
+            ASSERT(k_INVALID_INDEX == X.find0AtNthMaxIndex(1));
+            ASSERT(k_INVALID_INDEX == X.find0AtNthMinIndex(1));
+            ASSERT(k_INVALID_INDEX == X.find1AtNthMaxIndex(1));
+            ASSERT(k_INVALID_INDEX == X.find1AtNthMinIndex(1));
+        }
+
+        for (int ti = 0; SPECS[ti]; ++ti) {
+            for (int flip = 0; flip < 2; ++flip) {
+                const char *const DST = SPECS[ti];
+
+                Obj          mX;
+                const Obj&   X      = ggDispatch(&mX, DST);
+                const size_t curLen = X.length();
+
+                if (flip) {
+                    mX.toggleAll();
+                }
+
+                const Obj XX(X, &testAllocator);
+                ASSERT(XX.length() == curLen);
+
+                const Int64 BB = testAllocator.numBlocksTotal();
+
+                for (size_t begin = 0; begin <= curLen; begin += 3) {
+                    for (size_t end = begin; end <= curLen; end += 5) {
+                        // Collect the indices of clear and set bits in
+                        // ascending order.
+
+                        bsl::vector<size_t> zeros, ones;
+                        for (size_t ii = begin; ii < end; ++ii) {
+                            (X[ii] ? ones : zeros).push_back(ii);
+                        }
+
+                        for (size_t n = 1; n <= end - begin + 1; ++n) {
+                            const size_t NZ = zeros.size();
+                            const size_t NO = ones.size();
+
+                            const size_t EXP_MIN0 = n <= NZ
+                                                  ? zeros[n - 1]
+                                                  : k_INVALID_INDEX;
+                            const size_t EXP_MAX0 = n <= NZ
+                                                  ? zeros[NZ - n]
+                                                  : k_INVALID_INDEX;
+                            const size_t EXP_MIN1 = n <= NO
+                                                  ? ones[n - 1]
+                                                  : k_INVALID_INDEX;
+                            const size_t EXP_MAX1 = n <= NO
+                                                  ? ones[NO - n]
+                                                  : k_INVALID_INDEX;
+
+                            ASSERTV(ti, begin, end, n,
+                                  EXP_MIN0 == X.find0AtNthMinIndex(n,
+                                                                   begin,
+                                                                   end));
+                            ASSERTV(ti, begin, end, n,
+                                  EXP_MAX0 == X.find0AtNthMaxIndex(n,
+                                                                   begin,
+                                                                   end));
+                            ASSERTV(ti, begin, end, n,
+                                  EXP_MIN1 == X.find1AtNthMinIndex(n,
+                                                                   begin,
+                                                                   end));
+                            ASSERTV(ti, begin, end, n,
+                                  EXP_MAX1 == X.find1AtNthMaxIndex(n,
+                                                                   begin,
+                                                                   end));
+
+                            if (curLen == end) {
+                                ASSERT(X.find0AtNthMinIndex(n, begin) ==
+                                                                    EXP_MIN0);
+                                ASSERT(X.find1AtNthMaxIndex(n, begin) ==
+                                                                    EXP_MAX1);
+
+                                if (0 == begin) {
+                                    ASSERT(X.find0AtNthMaxIndex(n) ==
+                                                                    EXP_MAX0);
+                                    ASSERT(X.find1AtNthMinIndex(n) ==
+                                                                    EXP_MIN1);
+                                }
+                            }
+                        }
+
+                        ASSERT(XX == X);
+                    }
+                }
+
+                ASSERT(BB == testAllocator.numBlocksTotal());
+            }
+        }
+
+        {
+            Obj mX;    const Obj& X = ggDispatch(&mX, "xwa");
+
+            bsls::AssertTestHandlerGuard guard;
+
+            size_t len = X.length();
+
+            ASSERT_SAFE_PASS(X.find0AtNthMaxIndex(1));
+            ASSERT_SAFE_PASS(X.find0AtNthMaxIndex(1,       0,     len));
+            ASSERT_SAFE_PASS(X.find0AtNthMaxIndex(1, len / 2, len / 2));
+            ASSERT_SAFE_FAIL(X.find0AtNthMaxIndex(0));
+            ASSERT_SAFE_FAIL(X.find0AtNthMaxIndex(1, len + 1));
+            ASSERT_SAFE_FAIL(X.find0AtNthMaxIndex(1,     len, len - 1));
+
+            ASSERT_SAFE_PASS(X.find0AtNthMinIndex(1));
+            ASSERT_SAFE_PASS(X.find0AtNthMinIndex(1,       0,     len));
+            ASSERT_SAFE_PASS(X.find0AtNthMinIndex(1, len / 2, len / 2));
+            ASSERT_SAFE_FAIL(X.find0AtNthMinIndex(0));
+            ASSERT_SAFE_FAIL(X.find0AtNthMinIndex(1, len + 1));
+            ASSERT_SAFE_FAIL(X.find0AtNthMinIndex(1,     len, len - 1));
+
+            ASSERT_SAFE_PASS(X.find1AtNthMaxIndex(1));
+            ASSERT_SAFE_PASS(X.find1AtNthMaxIndex(1,       0,     len));
+            ASSERT_SAFE_PASS(X.find1AtNthMaxIndex(1, len / 2, len / 2));
+            ASSERT_SAFE_FAIL(X.find1AtNthMaxIndex(0));
+            ASSERT_SAFE_FAIL(X.find1AtNthMaxIndex(1, len + 1));
+            ASSERT_SAFE_FAIL(X.find1AtNthMaxIndex(1,     len, len - 1));
+
+            ASSERT_SAFE_PASS(X.find1AtNthMinIndex(1));
+            ASSERT_SAFE_PASS(X.find1AtNthMinIndex(1,       0,     len));
+            ASSERT_SAFE_PASS(X.find1AtNthMinIndex(1, len / 2, len / 2));
+            ASSERT_SAFE_FAIL(X.find1AtNthMinIndex(0));
+            ASSERT_SAFE_FAIL(X.find1AtNthMinIndex(1, len + 1));
+            ASSERT_SAFE_FAIL(X.find1AtNthMinIndex(1,     len, len - 1));
+        }
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -1416,7 +1572,7 @@ int main(int argc, char *argv[])
     strcat(LONG_SPEC_9, LONG_SPEC_1);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 31: {
+      case 32: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1437,6 +1593,51 @@ int main(int argc, char *argv[])
 
         testUsage();
       } break;
+      case 31: {
+        // --------------------------------------------------------------------
+        // TESTING FIND[01]ATNTH{MAX,MIN}INDEX METHODS
+        //   Ensure the methods return the expected value.
+        //
+        // Concerns:
+        //: 1 The correct result is obtained, including 'k_INVALID_INDEX' when
+        //:   the range has fewer than 'n' bits of the sought value.
+        //:
+        //: 2 The object is unchanged.
+        //:
+        //: 3 Memory is not allocated.
+        //:
+        //: 4 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each of a sequence of specifications and their complements,
+        //:   create an object X from that specification, and copy construct
+        //:   'XX' from 'X'.
+        //:
+        //: 2 For a variety of ranges '[begin .. end)', collect the indices of
+        //:   the clear and set bits in the range using the '[]' operator, and
+        //:   for each 'n' from 1 to one more than the length of the range,
+        //:   verify that the functions, called with and without the optional
+        //:   arguments, return the expected value.  (C-1)
+        //:
+        //: 3 Verify that 'XX == X'.  (C-2).
+        //:
+        //: 4 After the loops, verify that no memory has been allocated since
+        //:   'XX' was created.  (C-3).
+        //:
+        //: 5 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   size_t find0AtNthMaxIndex(size_t n, size_t b, size_t e) const;
+        //   size_t find0AtNthMinIndex(size_t n, size_t b, size_t e) const;
+        //   size_t find1AtNthMaxIndex(size_t n, size_t b, size_t e) const;
+        //   size_t find1AtNthMinIndex(size_t n, size_t b, size_t e) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING FIND[01]ATNTH{MAX,MIN}INDEX METHODS\n"
+                               "===========================================\n";
+
+        testFindNth();
+      } break;
       case 30: {
         // --------------------------------------------------------------------
         // TESTING RANGE-BASED NUM0, NUM1
@@ -0,0 +1,619 @@
+// bdlc_bitpackedintarray.cpp                                         -*-C++-*-
+#include <bdlc_bitpackedintarray.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlc_bitpackedintarray_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslim_printer.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace {
+
+const int k_BLOCK_LENGTH = bdlc::BitPackedIntArray::k_BLOCK_LENGTH;
+
+typedef void (*UnpackFunction)(bsl::uint64_t       *result,
+                               const bsl::uint64_t *words);
+    // 'UnpackFunction' is an alias for a function that loads into 'result'
+    // the 'k_BLOCK_LENGTH' bit fields packed into 'words'.
+
+                        // ======================
+                        // local block primitives
+                        // ======================
+
+template <int WIDTH>
+void unpackBlock(bsl::uint64_t *result, const bsl::uint64_t *words)
+    // Load into the specified 'result' the 'k_BLOCK_LENGTH' consecutive
+    // 'WIDTH'-bit fields packed, least-significant bit first, into the
+    // specified 'words'.  Note that 'WIDTH' being a compile-time constant
+    // makes the position of every field a compile-time constant once the loop
+    // is unrolled, which allows the compiler to vectorize the loop.
+{
+    const bsl::uint64_t mask = ~static_cast<bsl::uint64_t>(0) >> (64 - WIDTH);
+
+    for (int i = 0; i < k_BLOCK_LENGTH; ++i) {
+        const int bit   = i * WIDTH;
+        const int word  = bit >> 6;
+        const int shift = bit & 63;
+
+        bsl::uint64_t value = words[word] >> shift;
+        if (shift + WIDTH > 64) {
+            value |= words[word + 1] << (64 - shift);
+        }
+        result[i] = value & mask;
+    }
+}
+
+template <>
+void unpackBlock<0>(bsl::uint64_t *result, const bsl::uint64_t *)
+    // Load 0 into the 'k_BLOCK_LENGTH' elements of the specified 'result'.
+{
+    bsl::memset(result, 0, k_BLOCK_LENGTH * sizeof *result);
+}
+
+const UnpackFunction s_unpackFunctions[65] = {
+    // Unpacking functions indexed by bit width.
+
+    &unpackBlock<0>, &unpackBlock<1>, &unpackBlock<2>, &unpackBlock<3>,
+    &unpackBlock<4>, &unpackBlock<5>, &unpackBlock<6>, &unpackBlock<7>,
+    &unpackBlock<8>, &unpackBlock<9>, &unpackBlock<10>, &unpackBlock<11>,
+    &unpackBlock<12>, &unpackBlock<13>, &unpackBlock<14>, &unpackBlock<15>,
+    &unpackBlock<16>, &unpackBlock<17>, &unpackBlock<18>, &unpackBlock<19>,
+    &unpackBlock<20>, &unpackBlock<21>, &unpackBlock<22>, &unpackBlock<23>,
+    &unpackBlock<24>, &unpackBlock<25>, &unpackBlock<26>, &unpackBlock<27>,
+    &unpackBlock<28>, &unpackBlock<29>, &unpackBlock<30>, &unpackBlock<31>,
+    &unpackBlock<32>, &unpackBlock<33>, &unpackBlock<34>, &unpackBlock<35>,
+    &unpackBlock<36>, &unpackBlock<37>, &unpackBlock<38>, &unpackBlock<39>,
+    &unpackBlock<40>, &unpackBlock<41>, &unpackBlock<42>, &unpackBlock<43>,
+    &unpackBlock<44>, &unpackBlock<45>, &unpackBlock<46>, &unpackBlock<47>,
+    &unpackBlock<48>, &unpackBlock<49>, &unpackBlock<50>, &unpackBlock<51>,
+    &unpackBlock<52>, &unpackBlock<53>, &unpackBlock<54>, &unpackBlock<55>,
+    &unpackBlock<56>, &unpackBlock<57>, &unpackBlock<58>, &unpackBlock<59>,
+    &unpackBlock<60>, &unpackBlock<61>, &unpackBlock<62>, &unpackBlock<63>,
+    &unpackBlock<64>
+};
+
+void packBlock(bsl::uint64_t *words, const bsl::uint64_t *values, int width)
+    // Pack the 'k_BLOCK_LENGTH' specified 'values' as consecutive
+    // 'width'-bit fields, least-significant bit first, into the specified
+    // 'words'.  The behavior is undefined unless '1 <= width <= 64', each
+    // value is representable in 'width' bits, and 'words' refers to
+    // '2 * width' words, all initially 0.
+{
+    for (int i = 0; i < k_BLOCK_LENGTH; ++i) {
+        const int bit   = i * width;
+        const int word  = bit >> 6;
+        const int shift = bit & 63;
+
+        words[word] |= values[i] << shift;
+        if (shift + width > 64) {
+            words[word + 1] |= values[i] >> (64 - shift);
+        }
+    }
+}
+
+inline
+bsl::uint64_t extract(const bsl::uint64_t *words, int width, int index)
+    // Return the 'width'-bit field having the specified 'index' in the
+    // specified 'words'.  The behavior is undefined unless
+    // '0 <= width <= 64' and '0 <= index < k_BLOCK_LENGTH'.
+{
+    if (0 == width) {
+        return 0;                                                     // RETURN
+    }
+
+    const int bit   = index * width;
+    const int word  = bit >> 6;
+    const int shift = bit & 63;
+
+    bsl::uint64_t value = words[word] >> shift;
+    if (shift + width > 64) {
+        value |= words[word + 1] << (64 - shift);
+    }
+    return value & (~static_cast<bsl::uint64_t>(0) >> (64 - width));
+}
+
+                        // ==============
+                        // local visitors
+                        // ==============
+
+class SumVisitor {
+    // This class accumulates, modulo 2^64, the sum of the values visited.
+
+    // DATA
+    bsl::uint64_t d_sum;  // running sum
+
+  public:
+    // CREATORS
+    SumVisitor()
+    : d_sum(0)
+    {
+    }
+
+    // MANIPULATORS
+    void visitValues(const bsl::int64_t *values, bsl::size_t numValues)
+        // Add the specified 'numValues' 'values' to the running sum.
+    {
+        bsl::uint64_t sum = 0;
+        for (bsl::size_t i = 0; i < numValues; ++i) {
+            sum += static_cast<bsl::uint64_t>(values[i]);
+        }
+        d_sum += sum;
+    }
+
+    // ACCESSORS
+    bsl::int64_t result() const
+        // Return the sum of the values visited.
+    {
+        return static_cast<bsl::int64_t>(d_sum);
+    }
+};
+
+class MinMaxVisitor {
+    // This class tracks the smallest and the largest of the values visited.
+
+    // DATA
+    bsl::int64_t d_min;  // smallest value visited
+    bsl::int64_t d_max;  // largest value visited
+
+  public:
+    // CREATORS
+    explicit MinMaxVisitor(bsl::int64_t value)
+        // Create a visitor whose minimum and maximum are the specified
+        // 'value'.
+    : d_min(value)
+    , d_max(value)
+    {
+    }
+
+    // MANIPULATORS
+    void visitValue(bsl::int64_t value)
+        // Include the specified 'value' in the minimum and maximum.
+    {
+        d_min = value < d_min ? value : d_min;
+        d_max = value > d_max ? value : d_max;
+    }
+
+    void visitValues(const bsl::int64_t *values, bsl::size_t numValues)
+        // Include the specified 'numValues' 'values' in the minimum and
+        // maximum.
+    {
+        bsl::int64_t low  = d_min;
+        bsl::int64_t high = d_max;
+        for (bsl::size_t i = 0; i < numValues; ++i) {
+            low  = values[i] < low  ? values[i] : low;
+            high = values[i] > high ? values[i] : high;
+        }
+        d_min = low;
+        d_max = high;
+    }
+
+    // ACCESSORS
+    bsl::int64_t max() const
+        // Return the largest value visited.
+    {
+        return d_max;
+    }
+
+    bsl::int64_t min() const
+        // Return the smallest value visited.
+    {
+        return d_min;
+    }
+};
+
+}  // close unnamed namespace
+
+namespace bdlc {
+
+                          // -----------------------
+                          // class BitPackedIntArray
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+void BitPackedIntArray::sealTail()
+{
+    BSLS_ASSERT(k_BLOCK_LENGTH == d_tail.size());
+
+    const bsl::int64_t *values = d_tail.data();
+
+    bsl::uint64_t packed[k_BLOCK_LENGTH];
+    Block         block;
+
+    if (e_FRAME_OF_REFERENCE == d_encoding) {
+        bsl::int64_t minimum = values[0];
+        for (int i = 1; i < k_BLOCK_LENGTH; ++i) {
+            minimum = values[i] < minimum ? values[i] : minimum;
+        }
+
+        block.d_base      = minimum;
+        block.d_reference = 0;
+        for (int i = 0; i < k_BLOCK_LENGTH; ++i) {
+            packed[i] = static_cast<bsl::uint64_t>(values[i])
+                      - static_cast<bsl::uint64_t>(minimum);
+        }
+    }
+    else {
+        // Compute the differences modulo 2^64, and take their minimum as
+        // signed values.
+
+        for (int i = 1; i < k_BLOCK_LENGTH; ++i) {
+            packed[i] = static_cast<bsl::uint64_t>(values[i])
+                      - static_cast<bsl::uint64_t>(values[i - 1]);
+        }
+
+        bsl::int64_t reference = static_cast<bsl::int64_t>(packed[1]);
+        for (int i = 2; i < k_BLOCK_LENGTH; ++i) {
+            const bsl::int64_t delta = static_cast<bsl::int64_t>(packed[i]);
+            reference = delta < reference ? delta : reference;
+        }
+
+        block.d_base      = values[0];
+        block.d_reference = reference;
+        packed[0]         = 0;
+        for (int i = 1; i < k_BLOCK_LENGTH; ++i) {
+            packed[i] -= static_cast<bsl::uint64_t>(reference);
+        }
+    }
+
+    bsl::uint64_t bits = 0;
+    for (int i = 0; i < k_BLOCK_LENGTH; ++i) {
+        bits |= packed[i];
+    }
+    const int width = 0 == bits ? 0 : 64 - bdlb::BitUtil::numLeadingUnsetBits(
+                                                                         bits);
+
+    // Ensure that no allocation can fail once the packed data is in place.
+
+    if (d_blocks.size() == d_blocks.capacity()) {
+        d_blocks.reserve(2 * d_blocks.size() + 1);
+    }
+
+    const bsl::size_t offset = d_words.size();
+    d_words.resize(offset + 2 * width, 0);
+
+    block.d_wordOffset = offset;
+    d_blocks.push_back(block);
+
+    if (width) {
+        packBlock(d_words.data() + offset, packed, width);
+    }
+    d_tail.clear();
+}
+
+// PRIVATE ACCESSORS
+void BitPackedIntArray::decodeBlock(bsl::int64_t *result,
+                                    bsl::size_t   blockIndex) const
+{
+    BSLS_ASSERT(blockIndex < d_blocks.size());
+
+    const Block& block = d_blocks[blockIndex];
+
+    // Unpack into 'result' viewed as unsigned, then undo the encoding modulo
+    // 2^64.
+
+    bsl::uint64_t *values = reinterpret_cast<bsl::uint64_t *>(result);
+    s_unpackFunctions[blockBitWidth(blockIndex)](
+                                          values,
+                                          d_words.data() + block.d_wordOffset);
+
+    const bsl::uint64_t base = static_cast<bsl::uint64_t>(block.d_base);
+
+    if (e_FRAME_OF_REFERENCE == d_encoding) {
+        for (int i = 0; i < k_BLOCK_LENGTH; ++i) {
+            values[i] += base;
+        }
+    }
+    else {
+        const bsl::uint64_t reference =
+                                static_cast<bsl::uint64_t>(block.d_reference);
+
+        bsl::uint64_t value = base;
+        values[0] = value;
+        for (int i = 1; i < k_BLOCK_LENGTH; ++i) {
+            value     += reference + values[i];
+            values[i]  = value;
+        }
+    }
+}
+
+// MANIPULATORS
+BitPackedIntArray& BitPackedIntArray::operator=(const BitPackedIntArray& rhs)
+{
+    if (this != &rhs) {
+        BitPackedIntArray(rhs, allocator()).swap(*this);
+    }
+    return *this;
+}
+
+void BitPackedIntArray::append(const bsl::int64_t *values,
+                               bsl::size_t         numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    while (numValues) {
+        bsl::size_t count = k_BLOCK_LENGTH - d_tail.size();
+        if (count > numValues) {
+            count = numValues;
+        }
+
+        d_tail.insert(d_tail.end(), values, values + count);
+        values    += count;
+        numValues -= count;
+
+        if (k_BLOCK_LENGTH == d_tail.size()) {
+            sealTail();
+        }
+    }
+}
+
+void BitPackedIntArray::reserveCapacity(bsl::size_t numElements,
+                                        int         bitsPerElement)
+{
+    BSLS_ASSERT(0 <= bitsPerElement);
+    BSLS_ASSERT(bitsPerElement <= 64);
+
+    const bsl::size_t numBlocks = numElements / k_BLOCK_LENGTH;
+
+    d_blocks.reserve(numBlocks);
+    d_words.reserve(numBlocks * 2 * bitsPerElement);
+    d_tail.reserve(k_BLOCK_LENGTH);
+}
+
+void BitPackedIntArray::swap(BitPackedIntArray& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    bslalg::SwapUtil::swap(&d_encoding, &other.d_encoding);
+    d_blocks.swap(other.d_blocks);
+    d_words.swap(other.d_words);
+    d_tail.swap(other.d_tail);
+}
+
+// ACCESSORS
+bsl::int64_t BitPackedIntArray::operator[](bsl::size_t index) const
+{
+    BSLS_ASSERT(index < length());
+
+    const bsl::size_t blockIndex = index / k_BLOCK_LENGTH;
+
+    if (blockIndex >= d_blocks.size()) {
+        return d_tail[index - d_blocks.size() * k_BLOCK_LENGTH];      // RETURN
+    }
+
+    const Block&         block  = d_blocks[blockIndex];
+    const int            width  = blockBitWidth(blockIndex);
+    const bsl::uint64_t *words  = d_words.data() + block.d_wordOffset;
+    const int            offset = static_cast<int>(index % k_BLOCK_LENGTH);
+
+    bsl::uint64_t value = static_cast<bsl::uint64_t>(block.d_base);
+
+    if (e_FRAME_OF_REFERENCE == d_encoding) {
+        value += extract(words, width, offset);
+    }
+    else {
+        value += static_cast<bsl::uint64_t>(offset)
+               * static_cast<bsl::uint64_t>(block.d_reference);
+        for (int i = 1; i <= offset; ++i) {
+            value += extract(words, width, i);
+        }
+    }
+    return static_cast<bsl::int64_t>(value);
+}
+
+void BitPackedIntArray::copyTo(bsl::int64_t *result,
+                               bsl::size_t   index,
+                               bsl::size_t   numValues) const
+{
+    BSLS_ASSERT(result || 0 == numValues);
+    BSLS_ASSERT(index + numValues <= length());
+
+    const bsl::size_t numEncoded = d_blocks.size() * k_BLOCK_LENGTH;
+
+    bsl::int64_t block[k_BLOCK_LENGTH];
+
+    while (numValues && index < numEncoded) {
+        const bsl::size_t blockIndex = index / k_BLOCK_LENGTH;
+        const bsl::size_t offset     = index % k_BLOCK_LENGTH;
+
+        bsl::size_t count = k_BLOCK_LENGTH - offset;
+        if (count > numValues) {
+            count = numValues;
+        }
+
+        if (k_BLOCK_LENGTH == count) {
+            decodeBlock(result, blockIndex);
+        }
+        else {
+            decodeBlock(block, blockIndex);
+            bsl::memcpy(result, block + offset, count * sizeof *result);
+        }
+        result    += count;
+        index     += count;
+        numValues -= count;
+    }
+
+    if (numValues) {
+        bsl::memcpy(result,
+                    d_tail.data() + (index - numEncoded),
+                    numValues * sizeof *result);
+    }
+}
+
+bool BitPackedIntArray::isEqual(const BitPackedIntArray& other) const
+{
+    if (length() != other.length()) {
+        return false;                                                 // RETURN
+    }
+
+    if (d_encoding == other.d_encoding) {
+        // Each encoding is a function of the values alone, so the
+        // representations are identical exactly when the values are.
+
+        for (bsl::size_t i = 0; i < d_blocks.size(); ++i) {
+            const Block& lhs = d_blocks[i];
+            const Block& rhs = other.d_blocks[i];
+            if (lhs.d_base        != rhs.d_base
+             || lhs.d_reference   != rhs.d_reference
+             || lhs.d_wordOffset  != rhs.d_wordOffset) {
+                return false;                                         // RETURN
+            }
+        }
+        return d_words == other.d_words && d_tail == other.d_tail;    // RETURN
+    }
+
+    bsl::int64_t lhs[k_BLOCK_LENGTH];
+    bsl::int64_t rhs[k_BLOCK_LENGTH];
+
+    const bsl::size_t numElements = length();
+    for (bsl::size_t i = 0; i < numElements; i += k_BLOCK_LENGTH) {
+        bsl::size_t count = numElements - i;
+        if (count > k_BLOCK_LENGTH) {
+            count = k_BLOCK_LENGTH;
+        }
+        copyTo(lhs, i, count);
+        other.copyTo(rhs, i, count);
+        if (0 != bsl::memcmp(lhs, rhs, count * sizeof *lhs)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bsl::int64_t BitPackedIntArray::max(bsl::size_t index,
+                                    bsl::size_t numValues) const
+{
+    BSLS_ASSERT(0 < numValues);
+    BSLS_ASSERT(index + numValues <= length());
+
+    MinMaxVisitor visitor((*this)[index]);
+    visit(&visitor, index, numValues);
+    return visitor.max();
+}
+
+bsl::int64_t BitPackedIntArray::min(bsl::size_t index,
+                                    bsl::size_t numValues) const
+{
+    BSLS_ASSERT(0 < numValues);
+    BSLS_ASSERT(index + numValues <= length());
+
+    MinMaxVisitor visitor((*this)[index]);
+
+    if (e_FRAME_OF_REFERENCE != d_encoding) {
+        visit(&visitor, index, numValues);
+        return visitor.min();                                         // RETURN
+    }
+
+    // The base of each complete block of a frame-of-reference array is the
+    // minimum of the block, so only partially covered blocks are decoded.
+
+    const bsl::size_t end        = index + numValues;
+    const bsl::size_t firstBlock = (index + k_BLOCK_LENGTH - 1)
+                                                              / k_BLOCK_LENGTH;
+    bsl::size_t       lastBlock  = end / k_BLOCK_LENGTH;
+    if (lastBlock > d_blocks.size()) {
+        lastBlock = d_blocks.size();
+    }
+
+    if (firstBlock >= lastBlock) {
+        visit(&visitor, index, numValues);
+        return visitor.min();                                         // RETURN
+    }
+
+    for (bsl::size_t i = firstBlock; i < lastBlock; ++i) {
+        visitor.visitValue(d_blocks[i].d_base);
+    }
+    visit(&visitor, index, firstBlock * k_BLOCK_LENGTH - index);
+    visit(&visitor,
+          lastBlock * k_BLOCK_LENGTH,
+          end - lastBlock * k_BLOCK_LENGTH);
+    return visitor.min();
+}
+
+bsl::ostream& BitPackedIntArray::print(bsl::ostream& stream,
+                                       int           level,
+                                       int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+
+    bsl::int64_t values[k_BLOCK_LENGTH];
+
+    const bsl::size_t numElements = length();
+    for (bsl::size_t i = 0; i < numElements; i += k_BLOCK_LENGTH) {
+        bsl::size_t count = numElements - i;
+        if (count > k_BLOCK_LENGTH) {
+            count = k_BLOCK_LENGTH;
+        }
+        copyTo(values, i, count);
+        for (bsl::size_t j = 0; j < count; ++j) {
+            printer.printValue(values[j]);
+        }
+    }
+    printer.end();
+
+    return stream;
+}
+
+bsl::int64_t BitPackedIntArray::sum(bsl::size_t index,
+                                    bsl::size_t numValues) const
+{
+    BSLS_ASSERT(index + numValues <= length());
+
+    SumVisitor visitor;
+    visit(&visitor, index, numValues);
+    return visitor.result();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bsl::ostream& bdlc::operator<<(bsl::ostream&            stream,
+                               const BitPackedIntArray& array)
+{
+    return array.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+void bdlc::swap(BitPackedIntArray& a, BitPackedIntArray& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    BitPackedIntArray futureA(b, a.allocator());
+    BitPackedIntArray futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,567 @@
+// bdlc_bitpackedintarray.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLC_BITPACKEDINTARRAY
+#define INCLUDED_BDLC_BITPACKEDINTARRAY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an append-only, block-compressed array of 64-bit integers.
+//
+//@CLASSES:
+//  bdlc::BitPackedIntArray: bit-packed, frame-of-reference or delta array
+//
+//@SEE_ALSO: bdlc_packedintarray
+//
+//@DESCRIPTION: This component provides a value-semantic array class,
+// 'bdlc::BitPackedIntArray', that stores a sequence of 'bsl::int64_t' values
+// using, on average, only as many bits per element as the local spread of the
+// values requires.  Where 'bdlc::PackedIntArray' chooses a single byte width
+// (1, 2, 4, or 8 bytes) for the whole array, a 'bdlc::BitPackedIntArray'
+// divides its elements into blocks of 'k_BLOCK_LENGTH' (128) elements and
+// chooses, independently for each block, a bit width in the range '[0 .. 64]'.
+// The array is append-only: elements are added with 'push_back' or 'append',
+// and cannot be modified or removed individually (see 'removeAll').
+//
+///Encodings
+///---------
+// Each array uses one of two encodings, selected at construction:
+//
+//: 'e_FRAME_OF_REFERENCE':
+//:   Each block records its minimum value, and each element is stored as its
+//:   difference from that minimum using just enough bits to represent the
+//:   largest difference in the block.  Any element can be read in constant
+//:   time.  This encoding suits values that cluster within each block (e.g.,
+//:   prices, sizes, or identifiers drawn from a narrow range).
+//:
+//: 'e_DELTA':
+//:   Each block records its first value and the minimum difference between
+//:   consecutive values, and each element is stored as the difference from
+//:   its predecessor, less that minimum.  Reading an element requires
+//:   summing the differences that precede it within its block, so the cost
+//:   is proportional to the position of the element within its block
+//:   (bounded by 'k_BLOCK_LENGTH').  This encoding suits slowly changing or
+//:   monotonic series (e.g., timestamps or cumulative counts), where the
+//:   consecutive differences are far smaller than the values themselves; a
+//:   block of evenly spaced values needs no bits per element at all.
+//
+// In both encodings all arithmetic is performed modulo 2^64, so every
+// 'bsl::int64_t' value is represented exactly, whatever the spread of the
+// values.
+//
+///Space and Performance
+///---------------------
+// Each complete block occupies '2 * W' 64-bit words of packed data, where 'W'
+// is the bit width of the block, plus a 24-byte header; elements that do not
+// yet fill a block are held unencoded until the block is complete.  The
+// header therefore adds 1.5 bits per element to the 'W' bits of packed data.
+//
+// The bulk accessors 'copyTo', 'sum', 'min', and 'max' decode one block at a
+// time with an unpacking function specialized for the bit width of the block;
+// the resulting loops have no data-dependent branches and a fixed trip count,
+// which allows the compiler to unroll and vectorize them.  In addition, 'min'
+// uses the block headers of a frame-of-reference array directly, without
+// decoding complete blocks.  Prefer these accessors to repeated use of
+// 'operator[]' whenever more than a few elements are needed.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Storing a Time Series of Timestamps
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we record the time, in microseconds since the epoch, at which each
+// of a large number of events occurred.  The events arrive roughly every 100
+// microseconds, so consecutive timestamps differ by far less than the
+// timestamps themselves.
+//
+// First, we create an array using the delta encoding, and append 1000
+// timestamps to it:
+//..
+//  bdlc::BitPackedIntArray timestamps(bdlc::BitPackedIntArray::e_DELTA);
+//
+//  bsl::int64_t time = 1514764800000000LL;  // 2018-01-01T00:00:00Z
+//  for (int i = 0; i < 1000; ++i) {
+//      time += 95 + (i * 7) % 11;           // jitter in '[95 .. 105]'
+//      timestamps.push_back(time);
+//  }
+//  assert(1000 == timestamps.length());
+//..
+// Then, we observe that each complete block uses 4 bits per element, as the
+// consecutive differences, less the smallest difference (95), are in the
+// range '[0 .. 10]':
+//..
+//  assert(4 == timestamps.blockBitWidth(0));
+//..
+// Next, we access an individual timestamp:
+//..
+//  assert(time == timestamps[999]);
+//..
+// Now, we decode a range of timestamps into a contiguous buffer:
+//..
+//  bsl::int64_t window[200];
+//  timestamps.copyTo(window, 500, 200);
+//  assert(timestamps[500] == window[0]);
+//  assert(timestamps[699] == window[199]);
+//..
+// Finally, we compute the mean interval between the events in that window:
+//..
+//  const bsl::int64_t span = window[199] - window[0];
+//  assert(95 <= span / 199 && span / 199 <= 105);
+//  assert(timestamps.min() == timestamps[0]);
+//  assert(timestamps.max() == time);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_iosfwd.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                          // =======================
+                          // class BitPackedIntArray
+                          // =======================
+
+class BitPackedIntArray {
+    // This space-efficient value-semantic array class represents an
+    // append-only sequence of 'bsl::int64_t' values, stored in blocks of
+    // 'k_BLOCK_LENGTH' elements that are each bit-packed relative to a
+    // per-block reference value.  See {Encodings}.
+
+  public:
+    // PUBLIC TYPES
+    enum Encoding {
+        // Enumeration of the supported block encodings.
+
+        e_FRAME_OF_REFERENCE,  // elements relative to the block minimum
+        e_DELTA                // differences between consecutive elements
+    };
+
+    // PUBLIC CONSTANTS
+    enum { k_BLOCK_LENGTH = 128 };  // number of elements per encoded block
+
+  private:
+    // PRIVATE TYPES
+    struct Block {
+        // This 'struct' holds the header of a complete block.  The bit width
+        // of the block is not stored: a block of width 'W' occupies exactly
+        // '2 * W' words, so the width is half the distance to the offset of
+        // the next block (or to the end of the packed data).
+
+        bsl::int64_t  d_base;        // minimum value ('e_FRAME_OF_REFERENCE')
+                                     // or first value ('e_DELTA')
+
+        bsl::int64_t  d_reference;   // minimum difference between
+                                     // consecutive values ('e_DELTA'); 0
+                                     // otherwise
+
+        bsl::uint64_t d_wordOffset;  // index of the first word of packed data
+    };
+
+    // DATA
+    Encoding                   d_encoding;  // block encoding
+
+    bsl::vector<Block>         d_blocks;    // headers of complete blocks
+
+    bsl::vector<bsl::uint64_t> d_words;     // packed data of complete blocks
+
+    bsl::vector<bsl::int64_t>  d_tail;      // unencoded elements following
+                                            // the last complete block
+
+    // PRIVATE MANIPULATORS
+    void sealTail();
+        // Encode the 'k_BLOCK_LENGTH' elements of the tail of this array as a
+        // new complete block, and clear the tail.  The behavior is undefined
+        // unless 'k_BLOCK_LENGTH == d_tail.size()'.
+
+    // PRIVATE ACCESSORS
+    void decodeBlock(bsl::int64_t *result, bsl::size_t blockIndex) const;
+        // Load into the specified 'result' the 'k_BLOCK_LENGTH' elements of
+        // the complete block having the specified 'blockIndex'.  The behavior
+        // is undefined unless 'blockIndex < d_blocks.size()' and 'result'
+        // refers to an array of at least 'k_BLOCK_LENGTH' elements.
+
+    template <class VISITOR>
+    void visit(VISITOR *visitor, bsl::size_t index, bsl::size_t numValues)
+                                                                        const;
+        // Invoke the specified 'visitor' on the elements in the range
+        // '[index .. index + numValues)' of this array, in order, as a
+        // sequence of calls 'visitor->visitValues(values, count)', each
+        // supplying the decoded values of the range that lie in one block.
+        // The behavior is undefined unless 'index + numValues <= length()'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BitPackedIntArray,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit BitPackedIntArray(bslma::Allocator *basicAllocator = 0);
+    explicit BitPackedIntArray(Encoding          encoding,
+                               bslma::Allocator *basicAllocator = 0);
+        // Create an empty array.  Optionally specify the 'encoding' of the
+        // blocks of this array; if 'encoding' is not specified,
+        // 'e_FRAME_OF_REFERENCE' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    BitPackedIntArray(const BitPackedIntArray&  original,
+                      bslma::Allocator         *basicAllocator = 0);
+        // Create an array having the same value and encoding as the specified
+        // 'original' array.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    //! ~BitPackedIntArray() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    BitPackedIntArray& operator=(const BitPackedIntArray& rhs);
+        // Assign to this array the value and encoding of the specified 'rhs'
+        // array, and return a reference providing modifiable access to this
+        // array.
+
+    void append(const bsl::int64_t *values, bsl::size_t numValues);
+        // Append to the end of this array the specified 'numValues' elements
+        // of the specified 'values' array.  The behavior is undefined unless
+        // 'values' refers to an array of at least 'numValues' elements, or
+        // '0 == numValues'.
+
+    void push_back(bsl::int64_t value);
+        // Append to the end of this array an element having the specified
+        // 'value'.
+
+    void removeAll();
+        // Remove all the elements from this array.
+
+    void reserveCapacity(bsl::size_t numElements, int bitsPerElement = 64);
+        // Make the capacity of this array at least the specified
+        // 'numElements', assuming that complete blocks need on average no
+        // more than the optionally specified 'bitsPerElement' bits per
+        // element.  The behavior is undefined unless
+        // '0 <= bitsPerElement <= 64'.
+
+    void swap(BitPackedIntArray& other);
+        // Efficiently exchange the value and encoding of this array with
+        // those of the specified 'other' array.  This method provides the
+        // no-throw exception-safety guarantee.  The behavior is undefined
+        // unless this array was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    bsl::int64_t operator[](bsl::size_t index) const;
+        // Return the value of the element at the specified 'index'.  The
+        // behavior is undefined unless 'index < length()'.  Note that the
+        // complexity is constant for 'e_FRAME_OF_REFERENCE' arrays, and
+        // proportional to 'index % k_BLOCK_LENGTH' for 'e_DELTA' arrays.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this array to supply memory.
+
+    int blockBitWidth(bsl::size_t blockIndex) const;
+        // Return the number of bits used to store each element of the
+        // complete block having the specified 'blockIndex'.  The behavior is
+        // undefined unless 'blockIndex < numBlocks()'.
+
+    void copyTo(bsl::int64_t *result,
+                bsl::size_t   index,
+                bsl::size_t   numValues) const;
+        // Load into the specified 'result' the specified 'numValues' elements
+        // of this array starting at the specified 'index'.  The behavior is
+        // undefined unless 'index + numValues <= length()', and 'result'
+        // refers to an array of at least 'numValues' elements or
+        // '0 == numValues'.
+
+    Encoding encoding() const;
+        // Return the encoding of the blocks of this array.
+
+    bool isEmpty() const;
+        // Return 'true' if there are no elements in this array, and 'false'
+        // otherwise.
+
+    bool isEqual(const BitPackedIntArray& other) const;
+        // Return 'true' if this and the specified 'other' array have the same
+        // value, and 'false' otherwise.  Two 'BitPackedIntArray' arrays have
+        // the same value if they have the same length, and all corresponding
+        // elements (those at the same indices) have the same value.
+
+    bsl::size_t length() const;
+        // Return the number of elements in this array.
+
+    bsl::int64_t max() const;
+    bsl::int64_t max(bsl::size_t index, bsl::size_t numValues) const;
+        // Return the largest value of the elements of this array or, if
+        // specified, of the 'numValues' elements starting at the specified
+        // 'index'.  The behavior is undefined unless the selected range is
+        // not empty and 'index + numValues <= length()'.
+
+    bsl::int64_t min() const;
+    bsl::int64_t min(bsl::size_t index, bsl::size_t numValues) const;
+        // Return the smallest value of the elements of this array or, if
+        // specified, of the 'numValues' elements starting at the specified
+        // 'index'.  The behavior is undefined unless the selected range is
+        // not empty and 'index + numValues <= length()'.
+
+    bsl::size_t numBlocks() const;
+        // Return the number of complete (encoded) blocks in this array.
+
+    bsl::size_t numPackedWords() const;
+        // Return the number of 64-bit words of packed data held by the
+        // complete blocks of this array.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Write the value of this array to the specified output 'stream' in a
+        // human-readable format, and return a reference to 'stream'.
+        // Optionally specify an initial indentation 'level', whose absolute
+        // value is incremented recursively for nested arrays.  If 'level' is
+        // specified, optionally specify 'spacesPerLevel', whose absolute value
+        // indicates the number of spaces per indentation level for this and
+        // all of its nested arrays.  If 'level' is negative, format the entire
+        // output on one line, suppressing all but the initial indentation (as
+        // governed by 'level').  If 'stream' is not valid on entry, this
+        // operation has no effect.  Note that the format is not fully
+        // specified, and can change without notice.
+
+    bsl::int64_t sum() const;
+    bsl::int64_t sum(bsl::size_t index, bsl::size_t numValues) const;
+        // Return the sum, modulo 2^64, of the values of the elements of this
+        // array or, if specified, of the 'numValues' elements starting at the
+        // specified 'index'.  The behavior is undefined unless
+        // 'index + numValues <= length()'.
+};
+
+// FREE OPERATORS
+bsl::ostream& operator<<(bsl::ostream&            stream,
+                         const BitPackedIntArray& array);
+    // Write the value of the specified 'array' to the specified output
+    // 'stream' in a single-line format, and return a reference providing
+    // modifiable access to 'stream'.  If 'stream' is not valid on entry, this
+    // operation has no effect.  Note that this human-readable format is not
+    // fully specified and can change without notice.
+
+bool operator==(const BitPackedIntArray& lhs, const BitPackedIntArray& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' arrays have the same
+    // value, and 'false' otherwise.  Two 'BitPackedIntArray' arrays have the
+    // same value if they have the same length, and all corresponding elements
+    // (those at the same indices) have the same value.  Note that the
+    // encodings of the arrays are not part of their value.
+
+bool operator!=(const BitPackedIntArray& lhs, const BitPackedIntArray& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' arrays do not have the
+    // same value, and 'false' otherwise.  Two 'BitPackedIntArray' arrays do
+    // not have the same value if they do not have the same length, or if any
+    // corresponding elements (those at the same indices) do not have the same
+    // value.
+
+// FREE FUNCTIONS
+void swap(BitPackedIntArray& a, BitPackedIntArray& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  This function
+    // provides the no-throw exception-safety guarantee if the two objects were
+    // created with the same allocator and the basic guarantee otherwise.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class BitPackedIntArray
+                          // -----------------------
+
+// PRIVATE ACCESSORS
+template <class VISITOR>
+void BitPackedIntArray::visit(VISITOR     *visitor,
+                              bsl::size_t  index,
+                              bsl::size_t  numValues) const
+{
+    BSLS_ASSERT_SAFE(index + numValues <= length());
+
+    const bsl::size_t numEncoded = d_blocks.size() * k_BLOCK_LENGTH;
+
+    bsl::int64_t block[k_BLOCK_LENGTH];
+
+    while (numValues && index < numEncoded) {
+        const bsl::size_t blockIndex = index / k_BLOCK_LENGTH;
+        const bsl::size_t offset     = index % k_BLOCK_LENGTH;
+
+        bsl::size_t count = k_BLOCK_LENGTH - offset;
+        if (count > numValues) {
+            count = numValues;
+        }
+
+        decodeBlock(block, blockIndex);
+        visitor->visitValues(block + offset, count);
+
+        index     += count;
+        numValues -= count;
+    }
+
+    if (numValues) {
+        visitor->visitValues(d_tail.data() + (index - numEncoded), numValues);
+    }
+}
+
+// CREATORS
+inline
+BitPackedIntArray::BitPackedIntArray(bslma::Allocator *basicAllocator)
+: d_encoding(e_FRAME_OF_REFERENCE)
+, d_blocks(basicAllocator)
+, d_words(basicAllocator)
+, d_tail(basicAllocator)
+{
+}
+
+inline
+BitPackedIntArray::BitPackedIntArray(Encoding          encoding,
+                                     bslma::Allocator *basicAllocator)
+: d_encoding(encoding)
+, d_blocks(basicAllocator)
+, d_words(basicAllocator)
+, d_tail(basicAllocator)
+{
+}
+
+inline
+BitPackedIntArray::BitPackedIntArray(const BitPackedIntArray&  original,
+                                     bslma::Allocator         *basicAllocator)
+: d_encoding(original.d_encoding)
+, d_blocks(original.d_blocks, basicAllocator)
+, d_words(original.d_words, basicAllocator)
+, d_tail(original.d_tail, basicAllocator)
+{
+}
+
+// MANIPULATORS
+inline
+void BitPackedIntArray::push_back(bsl::int64_t value)
+{
+    d_tail.push_back(value);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                         k_BLOCK_LENGTH == d_tail.size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        sealTail();
+    }
+}
+
+inline
+void BitPackedIntArray::removeAll()
+{
+    d_blocks.clear();
+    d_words.clear();
+    d_tail.clear();
+}
+
+// ACCESSORS
+inline
+bslma::Allocator *BitPackedIntArray::allocator() const
+{
+    return d_tail.get_allocator().mechanism();
+}
+
+inline
+int BitPackedIntArray::blockBitWidth(bsl::size_t blockIndex) const
+{
+    BSLS_ASSERT_SAFE(blockIndex < d_blocks.size());
+
+    const bsl::uint64_t next = blockIndex + 1 < d_blocks.size()
+                               ? d_blocks[blockIndex + 1].d_wordOffset
+                               : d_words.size();
+
+    return static_cast<int>((next - d_blocks[blockIndex].d_wordOffset) / 2);
+}
+
+inline
+BitPackedIntArray::Encoding BitPackedIntArray::encoding() const
+{
+    return d_encoding;
+}
+
+inline
+bool BitPackedIntArray::isEmpty() const
+{
+    return d_blocks.empty() && d_tail.empty();
+}
+
+inline
+bsl::size_t BitPackedIntArray::length() const
+{
+    return d_blocks.size() * k_BLOCK_LENGTH + d_tail.size();
+}
+
+inline
+bsl::int64_t BitPackedIntArray::max() const
+{
+    return max(0, length());
+}
+
+inline
+bsl::int64_t BitPackedIntArray::min() const
+{
+    return min(0, length());
+}
+
+inline
+bsl::size_t BitPackedIntArray::numBlocks() const
+{
+    return d_blocks.size();
+}
+
+inline
+bsl::size_t BitPackedIntArray::numPackedWords() const
+{
+    return d_words.size();
+}
+
+inline
+bsl::int64_t BitPackedIntArray::sum() const
+{
+    return sum(0, length());
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bdlc::operator==(const BitPackedIntArray& lhs,
+                      const BitPackedIntArray& rhs)
+{
+    return lhs.isEqual(rhs);
+}
+
+inline
+bool bdlc::operator!=(const BitPackedIntArray& lhs,
+                      const BitPackedIntArray& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
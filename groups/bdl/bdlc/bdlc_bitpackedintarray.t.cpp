@@ -0,0 +1,1099 @@
+// bdlc_bitpackedintarray.t.cpp                                       -*-C++-*-
+#include <bdlc_bitpackedintarray.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include <bsl_cstdint.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an append-only array whose value is the
+// sequence of its elements.  Every accessor is verified against a
+// 'bsl::vector<int64_t>' oracle holding the same elements, for both
+// encodings, for sequences whose local spread requires each possible number
+// of bits per element, and for array lengths on both sides of the block
+// boundaries.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BitPackedIntArray(bslma::Allocator *basicAllocator = 0);
+// [ 2] BitPackedIntArray(Encoding encoding, bslma::Allocator *ba = 0);
+// [ 7] BitPackedIntArray(const BitPackedIntArray& original, *ba = 0);
+//
+// MANIPULATORS
+// [ 7] BitPackedIntArray& operator=(const BitPackedIntArray& rhs);
+// [ 6] void append(const int64_t *values, size_t numValues);
+// [ 2] void push_back(int64_t value);
+// [ 2] void removeAll();
+// [ 6] void reserveCapacity(size_t numElements, int bitsPerElement);
+// [ 7] void swap(BitPackedIntArray& other);
+//
+// ACCESSORS
+// [ 2] int64_t operator[](size_t index) const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] int blockBitWidth(size_t blockIndex) const;
+// [ 4] void copyTo(int64_t *result, size_t index, size_t num) const;
+// [ 2] Encoding encoding() const;
+// [ 2] bool isEmpty() const;
+// [ 7] bool isEqual(const BitPackedIntArray& other) const;
+// [ 2] size_t length() const;
+// [ 5] int64_t max() const;
+// [ 5] int64_t max(size_t index, size_t numValues) const;
+// [ 5] int64_t min() const;
+// [ 5] int64_t min(size_t index, size_t numValues) const;
+// [ 2] size_t numBlocks() const;
+// [ 2] size_t numPackedWords() const;
+// [ 7] ostream& print(ostream& stream, int level, int spacesPerLevel) const;
+// [ 5] int64_t sum() const;
+// [ 5] int64_t sum(size_t index, size_t numValues) const;
+//
+// FREE OPERATORS
+// [ 7] ostream& operator<<(ostream&, const BitPackedIntArray&);
+// [ 7] bool operator==(const BitPackedIntArray&, const BitPackedIntArray&);
+// [ 7] bool operator!=(const BitPackedIntArray&, const BitPackedIntArray&);
+//
+// FREE FUNCTIONS
+// [ 7] void swap(BitPackedIntArray& a, BitPackedIntArray& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] EXTREME VALUES
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::BitPackedIntArray Obj;
+typedef bsl::vector<int64_t>    Oracle;
+
+const int BLOCK = Obj::k_BLOCK_LENGTH;
+
+const Obj::Encoding ENCODINGS[] = { Obj::e_FRAME_OF_REFERENCE, Obj::e_DELTA };
+const int           NUM_ENCODINGS = sizeof ENCODINGS / sizeof *ENCODINGS;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static uint64_t nextRandom(uint64_t *state)
+    // Advance the specified linear-congruential generator 'state' and return
+    // its new value.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state ^ (*state >> 29);
+}
+
+static void generate(Oracle   *values,
+                     int       length,
+                     int       spreadBits,
+                     bool      isSeries,
+                     uint64_t  seed)
+    // Load into the specified 'values' the specified 'length' pseudo-random
+    // values derived from the specified 'seed'.  If the specified 'isSeries'
+    // is 'false', the values are spread over '2^spreadBits' consecutive
+    // integers around a base; otherwise each value differs from its
+    // predecessor by a step spread over '2^spreadBits' integers, producing a
+    // random walk.
+{
+    values->clear();
+
+    uint64_t state = seed;
+    uint64_t value = nextRandom(&state);
+    const uint64_t mask = 0 == spreadBits
+                          ? 0
+                          : ~static_cast<uint64_t>(0) >> (64 - spreadBits);
+
+    for (int i = 0; i < length; ++i) {
+        const uint64_t r = nextRandom(&state) & mask;
+        if (isSeries) {
+            value += r;
+            values->push_back(static_cast<int64_t>(value));
+        }
+        else {
+            values->push_back(static_cast<int64_t>(value + r));
+        }
+    }
+}
+
+static void verify(int line, const Obj& X, const Oracle& values)
+    // Verify, reporting failures at the specified 'line', that the specified
+    // 'X' holds exactly the specified 'values'.
+{
+    ASSERTV(line, values.size(), X.length(), values.size() == X.length());
+    ASSERTV(line, values.empty() == X.isEmpty());
+    ASSERTV(line, values.size() / BLOCK == X.numBlocks());
+
+    if (values.size() != X.length()) {
+        return;                                                       // RETURN
+    }
+    for (bsl::size_t i = 0; i < values.size(); ++i) {
+        ASSERTV(line, i, values[i], X[i], values[i] == X[i]);
+    }
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Storing a Time Series of Timestamps
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we record the time, in microseconds since the epoch, at which each
+// of a large number of events occurred.  The events arrive roughly every 100
+// microseconds, so consecutive timestamps differ by far less than the
+// timestamps themselves.
+//
+// First, we create an array using the delta encoding, and append 1000
+// timestamps to it:
+//..
+    bdlc::BitPackedIntArray timestamps(bdlc::BitPackedIntArray::e_DELTA);
+
+    bsl::int64_t time = 1514764800000000LL;  // 2018-01-01T00:00:00Z
+    for (int i = 0; i < 1000; ++i) {
+        time += 95 + (i * 7) % 11;           // jitter in '[95 .. 105]'
+        timestamps.push_back(time);
+    }
+    ASSERT(1000 == timestamps.length());
+//..
+// Then, we observe that each complete block uses 4 bits per element, as the
+// consecutive differences, less the smallest difference (95), are in the
+// range '[0 .. 10]':
+//..
+    ASSERT(4 == timestamps.blockBitWidth(0));
+//..
+// Next, we access an individual timestamp:
+//..
+    ASSERT(time == timestamps[999]);
+//..
+// Now, we decode a range of timestamps into a contiguous buffer:
+//..
+    bsl::int64_t window[200];
+    timestamps.copyTo(window, 500, 200);
+    ASSERT(timestamps[500] == window[0]);
+    ASSERT(timestamps[699] == window[199]);
+//..
+// Finally, we compute the mean interval between the events in that window:
+//..
+    const bsl::int64_t span = window[199] - window[0];
+    ASSERT(95 <= span / 199 && span / 199 <= 105);
+    ASSERT(timestamps.min() == timestamps[0]);
+    ASSERT(timestamps.max() == time);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // VALUE-SEMANTIC OPERATIONS
+        //
+        // Concerns:
+        //: 1 The copy constructor and the assignment operator reproduce the
+        //:   value and the encoding, using the intended allocator.
+        //:
+        //: 2 'isEqual', 'operator==', and 'operator!=' compare values
+        //:   independently of the encodings.
+        //:
+        //: 3 The member and free 'swap' functions exchange values and
+        //:   encodings, without allocation when the allocators are the same.
+        //:
+        //: 4 'print' and 'operator<<' format the elements.
+        //
+        // Plan:
+        //: 1 For a set of lengths and both encodings, copy, assign, and swap
+        //:   arrays, and verify the results against the oracle.  (C-1, 3)
+        //:
+        //: 2 Compare arrays of equal and unequal values, of equal and
+        //:   unequal lengths, and with equal and differing encodings.  (C-2)
+        //:
+        //: 3 Print a small array and verify the output.  (C-4)
+        //
+        // Testing:
+        //   BitPackedIntArray(const BitPackedIntArray& original, *ba = 0);
+        //   BitPackedIntArray& operator=(const BitPackedIntArray& rhs);
+        //   void swap(BitPackedIntArray& other);
+        //   bool isEqual(const BitPackedIntArray& other) const;
+        //   ostream& print(ostream& stream, int level, int spl) const;
+        //   ostream& operator<<(ostream&, const BitPackedIntArray&);
+        //   bool operator==(const BitPackedIntArray&, const Obj&);
+        //   bool operator!=(const BitPackedIntArray&, const Obj&);
+        //   void swap(BitPackedIntArray& a, BitPackedIntArray& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE-SEMANTIC OPERATIONS" << endl
+                          << "=========================" << endl;
+
+        const int LENGTHS[] = { 0, 1, BLOCK - 1, BLOCK, BLOCK + 1,
+                                3 * BLOCK + 17 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+        for (int te = 0; te < NUM_ENCODINGS; ++te) {
+            const int           LENGTH   = LENGTHS[ti];
+            const Obj::Encoding ENCODING = ENCODINGS[te];
+            const Obj::Encoding OTHER    = ENCODINGS[1 - te];
+
+            Oracle values(&ta);
+            generate(&values, LENGTH, 9, te, ti + 1);
+
+            Obj mX(ENCODING, &ta);  const Obj& X = mX;
+            mX.append(values.data(), values.size());
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            ASSERTV(LENGTH, &oa     == Y.allocator());
+            ASSERTV(LENGTH, ENCODING == Y.encoding());
+            ASSERTV(LENGTH, X == Y);
+            ASSERTV(LENGTH, !(X != Y));
+            verify(L_, Y, values);
+
+            Obj mZ(OTHER, &oa);  const Obj& Z = mZ;
+            ASSERTV(LENGTH, (0 == LENGTH) == (X == Z));
+            mZ.append(values.data(), values.size());
+            ASSERTV(LENGTH, X == Z);
+            ASSERTV(LENGTH, Z == X);
+            ASSERTV(LENGTH, X.isEqual(Z));
+
+            if (LENGTH) {
+                Obj mW(OTHER, &oa);  const Obj& W = mW;
+                mW.append(values.data(), values.size() - 1);
+                mW.push_back(values.back() + 1);
+                ASSERTV(LENGTH, X != W);
+                ASSERTV(LENGTH, Y != W);
+
+                mW.push_back(0);
+                ASSERTV(LENGTH, X != W);
+
+                // assignment, including from an array of the other
+                // encoding
+
+                mW = X;
+                ASSERTV(LENGTH, &oa      == W.allocator());
+                ASSERTV(LENGTH, ENCODING == W.encoding());
+                verify(L_, W, values);
+
+                mW = W;
+                verify(L_, W, values);
+            }
+
+            // swap with the same allocator: no allocation
+
+            Obj mE(OTHER, &oa);  const Obj& E = mE;
+            const bsls::Types::Int64 numAllocations = oa.numAllocations();
+            mE.swap(mY);
+            ASSERTV(LENGTH, numAllocations == oa.numAllocations());
+            ASSERTV(LENGTH, ENCODING == E.encoding());
+            ASSERTV(LENGTH, OTHER    == Y.encoding());
+            ASSERTV(LENGTH, Y.isEmpty());
+            verify(L_, E, values);
+
+            swap(mE, mY);
+            ASSERTV(LENGTH, numAllocations == oa.numAllocations());
+            verify(L_, Y, values);
+
+            // free swap with different allocators
+
+            Obj mF(OTHER, &ta);  const Obj& F = mF;
+            swap(mF, mY);
+            ASSERTV(LENGTH, &ta == F.allocator());
+            ASSERTV(LENGTH, &oa == Y.allocator());
+            verify(L_, F, values);
+            ASSERTV(LENGTH, Y.isEmpty());
+        }
+        }
+
+        if (verbose) cout << "\nTesting 'print' and 'operator<<'." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.push_back(-1);
+            mX.push_back(2);
+            mX.push_back(30);
+
+            bsl::ostringstream oss1;
+            oss1 << X;
+            ASSERTV(oss1.str(), "[ -1 2 30 ]" == oss1.str());
+
+            bsl::ostringstream oss2;
+            X.print(oss2, 1, 2);
+            ASSERTV(oss2.str(), "  [\n    -1\n    2\n    30\n  ]\n"
+                                                               == oss2.str());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'append' AND 'reserveCapacity'
+        //
+        // Concerns:
+        //: 1 'append' produces the same array as the equivalent sequence of
+        //:   'push_back' calls, whatever the initial length and the number of
+        //:   values appended.
+        //:
+        //: 2 After 'reserveCapacity', appending the reserved number of
+        //:   elements having no more than the reserved number of bits per
+        //:   element does not allocate.
+        //:
+        //: 3 Memory is supplied by the object allocator only.
+        //:
+        //: 4 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of initial lengths and appended lengths, build the
+        //:   same array with 'append' and with 'push_back', and compare them
+        //:   with the oracle.  (C-1, 3)
+        //:
+        //: 2 Reserve capacity, append values of a known spread, and verify
+        //:   that no allocation occurred.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void append(const int64_t *values, size_t numValues);
+        //   void reserveCapacity(size_t numElements, int bitsPerElement);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'append' AND 'reserveCapacity'" << endl
+                          << "==============================" << endl;
+
+        const int LENGTHS[] = { 0, 1, 2, BLOCK - 1, BLOCK, BLOCK + 1,
+                                2 * BLOCK + 5 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int te = 0; te < NUM_ENCODINGS; ++te) {
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+        for (int tj = 0; tj < NUM_LENGTHS; ++tj) {
+            const Obj::Encoding ENCODING = ENCODINGS[te];
+            const int           INITIAL  = LENGTHS[ti];
+            const int           APPENDED = LENGTHS[tj];
+
+            Oracle values(&ta);
+            generate(&values, INITIAL + APPENDED, 20, te, ti * 10 + tj);
+
+            Obj mX(ENCODING, &ta);  const Obj& X = mX;
+            Obj mY(ENCODING, &ta);  const Obj& Y = mY;
+
+            for (int i = 0; i < INITIAL + APPENDED; ++i) {
+                mX.push_back(values[i]);
+            }
+            for (int i = 0; i < INITIAL; ++i) {
+                mY.push_back(values[i]);
+            }
+            mY.append(values.data() + INITIAL, APPENDED);
+
+            ASSERTV(ENCODING, INITIAL, APPENDED, X == Y);
+            ASSERTV(ENCODING, INITIAL, APPENDED,
+                    X.numPackedWords() == Y.numPackedWords());
+            verify(L_, Y, values);
+        }
+        }
+        }
+
+        if (verbose) cout << "\nTesting 'reserveCapacity'." << endl;
+        {
+            for (int te = 0; te < NUM_ENCODINGS; ++te) {
+                const Obj::Encoding ENCODING = ENCODINGS[te];
+
+                Oracle values(&ta);
+                generate(&values, 10 * BLOCK + 3, 12, false, te);
+
+                bslma::TestAllocator oa("object", veryVeryVerbose);
+
+                Obj mX(ENCODING, &oa);  const Obj& X = mX;
+                mX.reserveCapacity(values.size(), 13);
+
+                const bsls::Types::Int64 numAllocations = oa.numAllocations();
+                mX.append(values.data(), values.size());
+                ASSERTV(ENCODING, numAllocations == oa.numAllocations());
+                verify(L_, X, values);
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj            mX(&ta);
+            const int64_t  VALUES[] = { 1, 2 };
+            const int64_t *NULL_VALUES = 0;
+
+            ASSERT_PASS(mX.append(VALUES, 2));
+            ASSERT_PASS(mX.append(NULL_VALUES, 0));
+            ASSERT_FAIL(mX.append(NULL_VALUES, 1));
+
+            ASSERT_PASS(mX.reserveCapacity(10, 0));
+            ASSERT_PASS(mX.reserveCapacity(10, 64));
+            ASSERT_FAIL(mX.reserveCapacity(10, -1));
+            ASSERT_FAIL(mX.reserveCapacity(10, 65));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'sum', 'min', AND 'max'
+        //
+        // Concerns:
+        //: 1 The aggregates of every range match those computed from the
+        //:   oracle, for ranges within a block, spanning blocks, covering
+        //:   complete blocks, and reaching into the unencoded tail.
+        //:
+        //: 2 'min' of a frame-of-reference array is correct when computed
+        //:   from the block headers.
+        //:
+        //: 3 'sum' wraps modulo 2^64.
+        //:
+        //: 4 The whole-array overloads aggregate the whole array.
+        //:
+        //: 5 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For both encodings and a set of arrays, compare every aggregate
+        //:   over a set of ranges, including every range at block boundaries,
+        //:   with the oracle.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid ranges.  (C-5)
+        //
+        // Testing:
+        //   int64_t max() const;
+        //   int64_t max(size_t index, size_t numValues) const;
+        //   int64_t min() const;
+        //   int64_t min(size_t index, size_t numValues) const;
+        //   int64_t sum() const;
+        //   int64_t sum(size_t index, size_t numValues) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'sum', 'min', AND 'max'" << endl
+                          << "=======================" << endl;
+
+        const int SPREADS[] = { 0, 3, 17, 40, 64 };
+        const int NUM_SPREADS = sizeof SPREADS / sizeof *SPREADS;
+
+        const int LENGTH = 4 * BLOCK + 37;
+
+        const int POINTS[] = { 0, 1, 5, BLOCK - 1, BLOCK, BLOCK + 1,
+                               2 * BLOCK, 3 * BLOCK - 2, 4 * BLOCK,
+                               4 * BLOCK + 1, LENGTH - 1, LENGTH };
+        const int NUM_POINTS = sizeof POINTS / sizeof *POINTS;
+
+        for (int te = 0; te < NUM_ENCODINGS; ++te) {
+        for (int ts = 0; ts < NUM_SPREADS; ++ts) {
+        for (int series = 0; series < 2; ++series) {
+            const Obj::Encoding ENCODING = ENCODINGS[te];
+            const int           SPREAD   = SPREADS[ts];
+
+            Oracle values(&ta);
+            generate(&values, LENGTH, SPREAD, series, ts + 7 * series);
+
+            Obj mX(ENCODING, &ta);  const Obj& X = mX;
+            mX.append(values.data(), values.size());
+
+            for (int i = 0; i < NUM_POINTS; ++i) {
+            for (int j = i; j < NUM_POINTS; ++j) {
+                const bsl::size_t INDEX = POINTS[i];
+                const bsl::size_t NUM   = POINTS[j] - POINTS[i];
+
+                uint64_t sum = 0;
+                int64_t  min = NUM ? values[INDEX] : 0;
+                int64_t  max = min;
+                for (bsl::size_t k = INDEX; k < INDEX + NUM; ++k) {
+                    sum += static_cast<uint64_t>(values[k]);
+                    min  = values[k] < min ? values[k] : min;
+                    max  = values[k] > max ? values[k] : max;
+                }
+
+                ASSERTV(ENCODING, SPREAD, INDEX, NUM,
+                        static_cast<int64_t>(sum) == X.sum(INDEX, NUM));
+                if (NUM) {
+                    ASSERTV(ENCODING, SPREAD, INDEX, NUM,
+                            min == X.min(INDEX, NUM));
+                    ASSERTV(ENCODING, SPREAD, INDEX, NUM,
+                            max == X.max(INDEX, NUM));
+                }
+
+                if (0 == INDEX && LENGTH == static_cast<int>(NUM)) {
+                    ASSERTV(ENCODING, SPREAD, X.sum() == X.sum(INDEX, NUM));
+                    ASSERTV(ENCODING, SPREAD, min == X.min());
+                    ASSERTV(ENCODING, SPREAD, max == X.max());
+                }
+            }
+            }
+        }
+        }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT_PASS(X.sum());
+            ASSERT_FAIL(X.min());
+            ASSERT_FAIL(X.max());
+
+            for (int i = 0; i < 3; ++i) {
+                mX.push_back(i);
+            }
+
+            ASSERT_PASS(X.sum(3, 0));
+            ASSERT_FAIL(X.sum(3, 1));
+            ASSERT_PASS(X.min(2, 1));
+            ASSERT_FAIL(X.min(2, 0));
+            ASSERT_FAIL(X.min(2, 2));
+            ASSERT_PASS(X.max(0, 3));
+            ASSERT_FAIL(X.max(1, 3));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'copyTo'
+        //
+        // Concerns:
+        //: 1 'copyTo' loads exactly the elements of the requested range, for
+        //:   every range within a block, spanning blocks, covering complete
+        //:   blocks (decoded in place), and reaching into the tail.
+        //:
+        //: 2 'copyTo' writes no element outside of the requested range.
+        //:
+        //: 3 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For both encodings and every bit width, build an array of three
+        //:   blocks and a partial tail, and copy every range starting and
+        //:   ending at a set of points around the block boundaries into a
+        //:   guarded buffer.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   void copyTo(int64_t *result, size_t index, size_t num) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'copyTo'" << endl
+                          << "========" << endl;
+
+        const int LENGTH = 3 * BLOCK + 50;
+
+        const int POINTS[] = { 0, 1, 63, BLOCK - 1, BLOCK, BLOCK + 1,
+                               2 * BLOCK - 1, 2 * BLOCK, 3 * BLOCK,
+                               3 * BLOCK + 1, LENGTH - 1, LENGTH };
+        const int NUM_POINTS = sizeof POINTS / sizeof *POINTS;
+
+        const int64_t GUARD = 0x5A5A5A5A5A5A5A5ALL;
+
+        for (int te = 0; te < NUM_ENCODINGS; ++te) {
+        for (int spread = 0; spread <= 64; ++spread) {
+            const Obj::Encoding ENCODING = ENCODINGS[te];
+
+            Oracle values(&ta);
+            generate(&values, LENGTH, spread, te, spread);
+
+            Obj mX(ENCODING, &ta);  const Obj& X = mX;
+            mX.append(values.data(), values.size());
+
+            for (int i = 0; i < NUM_POINTS; ++i) {
+            for (int j = i; j < NUM_POINTS; ++j) {
+                const bsl::size_t INDEX = POINTS[i];
+                const bsl::size_t NUM   = POINTS[j] - POINTS[i];
+
+                Oracle result(NUM + 2, GUARD);
+                X.copyTo(result.data() + 1, INDEX, NUM);
+
+                ASSERTV(ENCODING, spread, INDEX, NUM, GUARD == result[0]);
+                ASSERTV(ENCODING, spread, INDEX, NUM,
+                        GUARD == result[NUM + 1]);
+                ASSERTV(ENCODING, spread, INDEX, NUM,
+                        0 == bsl::memcmp(result.data() + 1,
+                                         values.data() + INDEX,
+                                         NUM * sizeof(int64_t)));
+            }
+            }
+        }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);  const Obj& X = mX;
+            for (int i = 0; i < 3; ++i) {
+                mX.push_back(i);
+            }
+
+            int64_t  result[4];
+            int64_t *nullResult = 0;
+
+            ASSERT_PASS(X.copyTo(result, 0, 3));
+            ASSERT_PASS(X.copyTo(result, 3, 0));
+            ASSERT_PASS(X.copyTo(nullResult, 1, 0));
+            ASSERT_FAIL(X.copyTo(nullResult, 1, 1));
+            ASSERT_FAIL(X.copyTo(result, 1, 3));
+            ASSERT_FAIL(X.copyTo(result, 4, 0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // EXTREME VALUES
+        //
+        // Concerns:
+        //: 1 Every 'int64_t' value is represented exactly, including blocks
+        //:   mixing the smallest and the largest values, whose spread and
+        //:   consecutive differences overflow 'int64_t'.
+        //:
+        //: 2 Such blocks use 64 bits per element.
+        //
+        // Plan:
+        //: 1 For both encodings, build arrays alternating between, and
+        //:   mixing, the extreme values and 0, and verify every element, the
+        //:   block widths, and the aggregates.  (C-1..2)
+        //
+        // Testing:
+        //   EXTREME VALUES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXTREME VALUES" << endl
+                          << "==============" << endl;
+
+        const int64_t MIN = bsl::numeric_limits<int64_t>::min();
+        const int64_t MAX = bsl::numeric_limits<int64_t>::max();
+
+        // The differences between consecutive elements of the first pattern
+        // alternate between -1 and 1 (modulo 2^64), and so are encoded in 2
+        // bits by the delta encoding.
+
+        const struct {
+            int     d_line;
+            int64_t d_pattern[4];
+            int     d_forWidth;
+            int     d_deltaWidth;
+        } DATA[] = {
+            //LINE  PATTERN                   FOR  DELTA
+            //----  ------------------------  ---  -----
+            { L_,   { MIN, MAX, MIN, MAX },   64,   2 },
+            { L_,   { MAX, MIN, 0,   -1  },   64,  64 },
+            { L_,   { 0,   MIN, 1,   MAX },   64,  64 },
+            { L_,   { MIN, MIN, MIN, MIN },    0,   0 },
+            { L_,   { MAX, MAX, MAX, MAX },    0,   0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int te = 0; te < NUM_ENCODINGS; ++te) {
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const Obj::Encoding  ENCODING = ENCODINGS[te];
+            const int            LINE     = DATA[ti].d_line;
+            const int64_t *const PATTERN  = DATA[ti].d_pattern;
+            const int            WIDTH    = Obj::e_DELTA == ENCODING
+                                            ? DATA[ti].d_deltaWidth
+                                            : DATA[ti].d_forWidth;
+
+            Oracle values(&ta);
+            for (int i = 0; i < 2 * BLOCK + 3; ++i) {
+                values.push_back(PATTERN[i % 4]);
+            }
+
+            Obj mX(ENCODING, &ta);  const Obj& X = mX;
+            mX.append(values.data(), values.size());
+
+            verify(L_, X, values);
+
+            ASSERTV(LINE, ENCODING, X.blockBitWidth(0),
+                    WIDTH == X.blockBitWidth(0));
+            ASSERTV(LINE, ENCODING, X.blockBitWidth(1),
+                    WIDTH == X.blockBitWidth(1));
+
+            uint64_t sum = 0;
+            int64_t  min = values[0];
+            int64_t  max = values[0];
+            for (bsl::size_t i = 0; i < values.size(); ++i) {
+                sum += static_cast<uint64_t>(values[i]);
+                min  = values[i] < min ? values[i] : min;
+                max  = values[i] > max ? values[i] : max;
+            }
+            ASSERTV(LINE, ENCODING, static_cast<int64_t>(sum) == X.sum());
+            ASSERTV(LINE, ENCODING, min == X.min());
+            ASSERTV(LINE, ENCODING, max == X.max());
+        }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 An array is created empty, with the specified (or default)
+        //:   encoding and allocator.
+        //:
+        //: 2 'push_back' appends exactly the specified value, and every
+        //:   element can be read back with 'operator[]', whether it is in a
+        //:   complete block or in the unencoded tail.
+        //:
+        //: 3 Each complete block uses the smallest bit width able to
+        //:   represent its encoded values, and the packed data of a block
+        //:   occupies '2 * W' words.
+        //:
+        //: 4 'removeAll' empties the array.
+        //:
+        //: 5 Memory is supplied by the object allocator only.
+        //:
+        //: 6 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create arrays with and without an encoding and an allocator,
+        //:   and verify their state.  (C-1)
+        //:
+        //: 2 For both encodings and every spread from 0 to 64 bits, append
+        //:   values of that spread (clustered, or as a random walk), and
+        //:   verify every element, the number of blocks, the block widths,
+        //:   and the number of packed words.  (C-2..3)
+        //:
+        //: 3 Call 'removeAll' and verify that the array is empty and can be
+        //:   reused.  (C-4)
+        //:
+        //: 4 Verify that the default allocator was not used.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid indices.  (C-6)
+        //
+        // Testing:
+        //   BitPackedIntArray(bslma::Allocator *basicAllocator = 0);
+        //   BitPackedIntArray(Encoding encoding, bslma::Allocator *ba = 0);
+        //   void push_back(int64_t value);
+        //   void removeAll();
+        //   int64_t operator[](size_t index) const;
+        //   bslma::Allocator *allocator() const;
+        //   int blockBitWidth(size_t blockIndex) const;
+        //   Encoding encoding() const;
+        //   bool isEmpty() const;
+        //   size_t length() const;
+        //   size_t numBlocks() const;
+        //   size_t numPackedWords() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                        << endl
+                        << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                        << "========================================" << endl;
+
+        if (verbose) cout << "\nTesting constructors." << endl;
+        {
+            Obj mA;  const Obj& A = mA;
+            ASSERT(&defaultAllocator          == A.allocator());
+            ASSERT(Obj::e_FRAME_OF_REFERENCE  == A.encoding());
+            ASSERT(A.isEmpty());
+            ASSERT(0                          == A.length());
+
+            Obj mB(&ta);  const Obj& B = mB;
+            ASSERT(&ta                        == B.allocator());
+            ASSERT(Obj::e_FRAME_OF_REFERENCE  == B.encoding());
+
+            Obj mC(Obj::e_DELTA);  const Obj& C = mC;
+            ASSERT(&defaultAllocator          == C.allocator());
+            ASSERT(Obj::e_DELTA               == C.encoding());
+
+            Obj mD(Obj::e_DELTA, &ta);  const Obj& D = mD;
+            ASSERT(&ta                        == D.allocator());
+            ASSERT(Obj::e_DELTA               == D.encoding());
+            ASSERT(0                          == D.numBlocks());
+            ASSERT(0                          == D.numPackedWords());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\nTesting 'push_back' and widths." << endl;
+
+        for (int te = 0; te < NUM_ENCODINGS; ++te) {
+        for (int spread = 0; spread <= 64; ++spread) {
+        for (int series = 0; series < 2; ++series) {
+            const Obj::Encoding ENCODING = ENCODINGS[te];
+
+            if (veryVerbose) { T_ P_(ENCODING) P_(spread) P(series) }
+
+            const int LENGTH = 3 * BLOCK + 7;
+
+            Oracle values(&ta);
+            generate(&values, LENGTH, spread, series, spread * 2 + series);
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(ENCODING, &oa);  const Obj& X = mX;
+
+            for (int i = 0; i < LENGTH; ++i) {
+                mX.push_back(values[i]);
+
+                ASSERTV(ENCODING, spread, i, i + 1 == (int)X.length());
+                ASSERTV(ENCODING, spread, i, values[i] == X[i]);
+            }
+            verify(L_, X, values);
+
+            // Compute the expected width of each block from its encoded
+            // values.
+
+            bsl::size_t numWords = 0;
+            for (bsl::size_t b = 0; b < X.numBlocks(); ++b) {
+                const int64_t *v = values.data() + b * BLOCK;
+
+                uint64_t bits = 0;
+                if (Obj::e_FRAME_OF_REFERENCE == ENCODING) {
+                    int64_t min = v[0];
+                    for (int i = 1; i < BLOCK; ++i) {
+                        min = v[i] < min ? v[i] : min;
+                    }
+                    for (int i = 0; i < BLOCK; ++i) {
+                        bits |= static_cast<uint64_t>(v[i])
+                              - static_cast<uint64_t>(min);
+                    }
+                }
+                else {
+                    int64_t minDelta = v[1] - v[0];
+                    for (int i = 2; i < BLOCK; ++i) {
+                        const int64_t delta = static_cast<int64_t>(
+                                             static_cast<uint64_t>(v[i])
+                                           - static_cast<uint64_t>(v[i - 1]));
+                        minDelta = delta < minDelta ? delta : minDelta;
+                    }
+                    for (int i = 1; i < BLOCK; ++i) {
+                        bits |= static_cast<uint64_t>(v[i])
+                              - static_cast<uint64_t>(v[i - 1])
+                              - static_cast<uint64_t>(minDelta);
+                    }
+                }
+
+                int width = 0;
+                while (width < 64 && (bits >> width)) {
+                    ++width;
+                }
+
+                ASSERTV(ENCODING, spread, series, b, width,
+                        X.blockBitWidth(b),
+                        width == X.blockBitWidth(b));
+                numWords += 2 * width;
+            }
+            ASSERTV(ENCODING, spread, series,
+                    numWords == X.numPackedWords());
+
+            mX.removeAll();
+            ASSERTV(ENCODING, spread, X.isEmpty());
+            ASSERTV(ENCODING, spread, 0 == X.numBlocks());
+            ASSERTV(ENCODING, spread, 0 == X.numPackedWords());
+
+            mX.append(values.data(), BLOCK + 1);
+            values.resize(BLOCK + 1);
+            verify(L_, X, values);
+        }
+        }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(X.blockBitWidth(0));
+            ASSERT_FAIL(X[0]);
+
+            for (int i = 0; i < BLOCK + 1; ++i) {
+                mX.push_back(i);
+            }
+
+            ASSERT_PASS(X[BLOCK]);
+            ASSERT_FAIL(X[BLOCK + 1]);
+            ASSERT_SAFE_PASS(X.blockBitWidth(0));
+            ASSERT_SAFE_FAIL(X.blockBitWidth(1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Append values to arrays of each encoding and read them back.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        for (int te = 0; te < NUM_ENCODINGS; ++te) {
+            Obj mX(ENCODINGS[te], &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.push_back(1000000 + i * 3 + i % 5);
+            }
+            ASSERT(1000 == X.length());
+            ASSERT(7    == X.numBlocks());
+
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, 1000000 + i * 3 + i % 5 == X[i]);
+            }
+
+            ASSERT(1000000     == X.min());
+            ASSERT(1000000 + 2997 + 4 == X.max()
+                || 1000000 + 2999 == X.max());
+
+            Obj mY(X, &ta);  const Obj& Y = mY;
+            ASSERT(X == Y);
+            mY.push_back(0);
+            ASSERT(X != Y);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
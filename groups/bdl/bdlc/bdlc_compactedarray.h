@@ -24,6 +24,37 @@ BSLS_IDENT("$Id: $")
 // elements is not available.  Users can access the (non-modifiable) value of
 // individual elements by calling the indexing operator or via iterators.
 //
+///Bulk Loading
+///------------
+// Populating a 'CompactedArray' element-by-element (e.g., with 'push_back')
+// keeps the unique values sorted at all times, so each previously unseen value
+// costs a pass over the whole index to renumber the elements that follow it.
+// When the full sequence is available up front, the 'assign' method instead
+// deduplicates the sequence with a hash table, sorts only the unique values,
+// and renumbers the index once, for a cost of 'O(n + u * log(u))', where 'n'
+// is the length of the sequence and 'u' is the number of unique values.
+// 'assign' requires 'TYPE' to be equality-comparable and hashable with
+// 'bslh::Hash<>', in addition to the 'operator<' required by the rest of the
+// class, and requires values that compare equal to be equivalent under
+// 'operator<'.
+//
+///Dictionary Access
+///-----------------
+// The array is a dictionary encoding of its elements: the element at 'index'
+// is the unique value 'uniqueElement(uniqueElementIndex(index))'.  Scans that
+// aggregate or filter the elements can operate on the (small, integral) codes
+// obtained from 'uniqueElementIndex' or, in bulk, from
+// 'loadUniqueElementIndices', and consult each unique value only once.  The
+// number of elements having each unique value is available in constant time
+// from 'uniqueElementCount'.
+//
+///Thread Safety
+///-------------
+// 'CompactedArray' is *const* *thread-safe*: its accessors may be invoked
+// concurrently from any number of threads, provided no thread modifies the
+// array.  See 'bdlc_frozencompactedarray' for an immutable form of the array
+// suitable for sharing among threads.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -147,6 +178,8 @@ BSLS_IDENT("$Id: $")
 #include <bsl_iosfwd.h>
 #include <bsl_iterator.h>
 #include <bsl_limits.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -307,6 +340,22 @@ bool operator<(const TYPE& lhs, const CompactedArray_CountedValue<TYPE>& rhs);
     // underlying object value of the specified 'rhs', and 'false' otherwise.
     // Note that the reference count is intentionally ignored.
 
+                 // ========================================
+                 // struct CompactedArray_DictionaryEntryLess
+                 // ========================================
+
+template <class ENTRY>
+struct CompactedArray_DictionaryEntryLess {
+    // This 'struct' provides a comparator ordering the addresses of the
+    // (key, value) entries of a map by the keys of the addressed entries.
+
+    // ACCESSORS
+    bool operator()(const ENTRY *lhs, const ENTRY *rhs) const;
+        // Return 'true' if the key of the entry addressed by the specified
+        // 'lhs' is less than the key of the entry addressed by the specified
+        // 'rhs', and 'false' otherwise.
+};
+
                     // ==================================
                     // class CompactedArray_ConstIterator
                     // ==================================
@@ -695,6 +744,19 @@ class CompactedArray {
         // Note that if this array and 'srcArray' are the same, the behavior is
         // as if a copy of 'srcArray' were passed.
 
+    template <class INPUT_ITERATOR>
+    void assign(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Assign to this array the sequence of values in the range starting
+        // at the specified 'first' and ending immediately before the specified
+        // 'last' iterator.  'TYPE' must be equality-comparable and hashable
+        // with 'bslh::Hash<>', and values comparing equal must be equivalent
+        // under 'operator<'.  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last', and the sequence does not refer to
+        // elements of this array.  Note that this method deduplicates the
+        // values with a hash table (see {Bulk Loading}), and so is far more
+        // efficient than successive calls to 'push_back' for large sequences.
+
     void insert(bsl::size_t dstIndex, const TYPE& value);
         // Insert into this array, at the specified 'dstIndex', an element
         // having the specified 'value', shifting any elements originally at or
@@ -863,6 +925,16 @@ class CompactedArray {
     bsl::size_t length() const;
         // Return the number of elements in this array.
 
+    void loadUniqueElementIndices(bsl::size_t *result,
+                                  bsl::size_t  srcIndex,
+                                  bsl::size_t  numElements) const;
+        // Load into the specified 'result' the indices, within the sorted
+        // sequence of unique element values in this array, of the specified
+        // 'numElements' elements starting at the specified 'srcIndex'.  The
+        // behavior is undefined unless 'result' refers to an array of at
+        // least 'numElements' elements and
+        // 'srcIndex + numElements <= length()'.
+
     bsl::ostream& print(bsl::ostream& stream,
                         int           level = 0,
                         int           spacesPerLevel = 4) const;
@@ -885,6 +957,19 @@ class CompactedArray {
         // that 'uniqueElement(index)' and 'operator[](index)' can return
         // different objects.
 
+    bsl::size_t uniqueElementCount(bsl::size_t index) const;
+        // Return the number of elements in this array having the value of the
+        // unique element at the specified 'index' within the sorted sequence
+        // of unique element values in this array.  The behavior is undefined
+        // unless 'index < uniqueLength()'.
+
+    bsl::size_t uniqueElementIndex(bsl::size_t index) const;
+        // Return the index, within the sorted sequence of unique element
+        // values in this array, of the element at the specified 'index' in
+        // this array.  The behavior is undefined unless 'index < length()'.
+        // Note that 'uniqueElement(uniqueElementIndex(index))' and
+        // 'operator[](index)' return the same object.
+
     bsl::size_t uniqueLength() const;
         // Return the number of unique elements in this array.
 };
@@ -1053,6 +1138,20 @@ bool bdlc::operator<(const TYPE&                              lhs,
 
 namespace bdlc {
 
+                 // ----------------------------------------
+                 // struct CompactedArray_DictionaryEntryLess
+                 // ----------------------------------------
+
+// ACCESSORS
+template <class ENTRY>
+inline
+bool CompactedArray_DictionaryEntryLess<ENTRY>::operator()(
+                                                   const ENTRY *lhs,
+                                                   const ENTRY *rhs) const
+{
+    return lhs->first < rhs->first;
+}
+
                     // ----------------------------------
                     // class CompactedArray_ConstIterator
                     // ----------------------------------
@@ -1545,6 +1644,62 @@ void CompactedArray<TYPE>::append(const CompactedArray& srcArray,
     }
 }
 
+template <class TYPE>
+template <class INPUT_ITERATOR>
+void CompactedArray<TYPE>::assign(INPUT_ITERATOR first, INPUT_ITERATOR last)
+{
+    typedef bsl::unordered_map<TYPE, bsl::size_t, bslh::Hash<> > Dictionary;
+    typedef typename Dictionary::value_type                       Entry;
+
+    bslma::Allocator *allocator = d_index.allocator();
+
+    // Assign to each distinct value a provisional code, in order of first
+    // appearance, and record the code of each element.
+
+    Dictionary                  dictionary(allocator);
+    bsl::vector<const Entry *>  entries(allocator);
+    bsl::vector<bsl::size_t>    counts(allocator);
+    PackedIntArray<bsl::size_t> codes(allocator);
+
+    for (; first != last; ++first) {
+        typename Dictionary::iterator iter = dictionary.find(*first);
+
+        if (dictionary.end() == iter) {
+            iter = dictionary.emplace(*first, entries.size()).first;
+            entries.push_back(&*iter);
+            counts.push_back(0);
+        }
+        ++counts[iter->second];
+        codes.push_back(iter->second);
+    }
+
+    // Sort the distinct values, and renumber the codes to their positions in
+    // the sorted sequence.
+
+    bsl::sort(entries.begin(),
+              entries.end(),
+              CompactedArray_DictionaryEntryLess<Entry>());
+
+    bsl::vector<bsl::size_t> positions(entries.size(), 0, allocator);
+
+    Data data(allocator);
+    data.reserve(entries.size());
+
+    for (bsl::size_t i = 0; i < entries.size(); ++i) {
+        const bsl::size_t code = entries[i]->second;
+
+        positions[code] = i;
+        data.emplace_back(entries[i]->first, counts[code]);
+    }
+
+    for (bsl::size_t i = 0; i < codes.length(); ++i) {
+        codes.replace(i, positions[codes[i]]);
+    }
+
+    bslalg::SwapUtil::swap(&d_data,  &data);
+    bslalg::SwapUtil::swap(&d_index, &codes);
+}
+
 template <class TYPE>
 void CompactedArray<TYPE>::insert(bsl::size_t dstIndex, const TYPE& value)
 {
@@ -1941,6 +2096,23 @@ bsl::size_t CompactedArray<TYPE>::length() const
     return d_index.length();
 }
 
+template <class TYPE>
+void CompactedArray<TYPE>::loadUniqueElementIndices(
+                                            bsl::size_t *result,
+                                            bsl::size_t  srcIndex,
+                                            bsl::size_t  numElements) const
+{
+    BSLS_ASSERT(result || 0 == numElements);
+
+    // Assert 'srcIndex + numElements <= length()' without risk of overflow.
+    BSLS_ASSERT(numElements <= length());
+    BSLS_ASSERT(srcIndex    <= length() - numElements);
+
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        result[i] = d_index[srcIndex + i];
+    }
+}
+
 template <class TYPE>
 bsl::ostream& CompactedArray<TYPE>::print(bsl::ostream& stream,
                                           int           level,
@@ -1969,6 +2141,24 @@ const TYPE& CompactedArray<TYPE>::uniqueElement(bsl::size_t index) const
     return d_data[index].d_value.object();
 }
 
+template <class TYPE>
+inline
+bsl::size_t CompactedArray<TYPE>::uniqueElementCount(bsl::size_t index) const
+{
+    BSLS_ASSERT(index < uniqueLength());
+
+    return d_data[index].d_count;
+}
+
+template <class TYPE>
+inline
+bsl::size_t CompactedArray<TYPE>::uniqueElementIndex(bsl::size_t index) const
+{
+    BSLS_ASSERT(index < length());
+
+    return d_index[index];
+}
+
 template <class TYPE>
 inline
 bsl::size_t CompactedArray<TYPE>::uniqueLength() const
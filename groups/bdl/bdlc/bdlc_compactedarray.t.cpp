@@ -19,10 +19,12 @@
 #include <bsl_cstring.h>
 #include <bsl_iosfwd.h>
 #include <bsl_iostream.h>
+#include <bsl_iterator.h>
 #include <bsl_set.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -106,6 +108,7 @@ using namespace bsl;
 // [ 2] void append(const TYPE& value);
 // [12] void append(const CompactedArray& srcArray);
 // [12] void append(const CompactedArray& srcArray, si, ne);
+// [27] void assign(INPUT_ITERATOR first, INPUT_ITERATOR last);
 // [13] void insert(di, value);
 // [24] CACI insert(CACI dst, value);
 // [13] void insert(di, const CompactedArray& srcArray);
@@ -132,8 +135,11 @@ using namespace bsl;
 // [ 4] bool isEmpty() const;
 // [ 6] bool isEqual(const CompactedArray& other) const;
 // [ 4] bsl::size_t length() const;
+// [27] void loadUniqueElementIndices(result, si, ne) const;
 // [ 5] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
 // [ 4] const TYPE& uniqueElement(bsl::size_t index) const;
+// [27] bsl::size_t uniqueElementCount(bsl::size_t index) const;
+// [27] bsl::size_t uniqueElementIndex(bsl::size_t index) const;
 // [ 4] bsl::size_t uniqueLength() const;
 // [ 5] ostream& operator<<(ostream& stream, const CompactedArray& array);
 // [ 6] bool operator==(lhs, rhs);
@@ -142,7 +148,7 @@ using namespace bsl;
 // [26] void hashAppend(HASHALG&, const CompactedArray&);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [27] USAGE EXAMPLE
+// [28] USAGE EXAMPLE
 // [10] TESTING BDEX STREAMING
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
@@ -433,7 +439,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 27: {
+      case 28: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -480,6 +486,258 @@ int main(int argc, char *argv[])
     ASSERT(2 == schedule.uniqueLength());
 //..
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING 'assign' AND DICTIONARY ACCESSORS
+        //
+        // Concerns:
+        //: 1 'assign' sets the array to the value of the specified sequence,
+        //:   replacing any previous value.
+        //:
+        //: 2 The unique elements, their reference counts, and the index of
+        //:   each element within the unique elements, are the same as those
+        //:   produced by appending the values one at a time.
+        //:
+        //: 3 'assign' accepts input iterators.
+        //:
+        //: 4 Any memory allocation is from the object allocator.
+        //:
+        //: 5 'assign' is exception-neutral and leaves the array unchanged if
+        //:   an exception is thrown.
+        //:
+        //: 6 'uniqueElementIndex' and 'loadUniqueElementIndices' report, for
+        //:   each element, the index of the unique element having its value,
+        //:   and 'uniqueElementCount' reports the number of such elements.
+        //:
+        //: 7 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, for a set of specifications
+        //:   and a set of initial values, 'assign' the values of the
+        //:   specification to an array, and compare the result with an array
+        //:   populated with 'gg'.  Verify that the dictionary accessors are
+        //:   consistent with the element values.  (C-1..2, 4, 6)
+        //:
+        //: 2 Repeat P-1 within the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*'
+        //:   macros, verifying the value of the array when an exception is
+        //:   thrown.  (C-5)
+        //:
+        //: 3 Assign from an 'istream_iterator' over a large sequence of
+        //:   integers, and compare the result with an array populated with
+        //:   'push_back'.  (C-2..3, 6)
+        //:
+        //: 4 Verify defensive checks are triggered for invalid values.  (C-7)
+        //
+        // Testing:
+        //   void assign(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void loadUniqueElementIndices(result, si, ne) const;
+        //   bsl::size_t uniqueElementCount(bsl::size_t index) const;
+        //   bsl::size_t uniqueElementIndex(bsl::size_t index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'assign' AND DICTIONARY ACCESSORS\n"
+                          << "=========================================\n";
+
+        static const struct {
+            int         d_lineNum;
+            const char *d_spec_p;
+        } INIT[] = {
+            //line  spec
+            //----  ----
+            { L_,   ""          },
+            { L_,   "z"         },
+            { L_,   "abcabc"    },
+            { L_,   "yyyyyyyyy" },
+        };
+        const int NUM_INIT = static_cast<int>(sizeof INIT / sizeof *INIT);
+
+        static const struct {
+            int         d_lineNum;
+            const char *d_spec_p;
+        } DATA[] = {
+            //line  spec
+            //----  ----
+            { L_,   ""                     },
+            { L_,   "a"                    },
+            { L_,   "ba"                   },
+            { L_,   "aaaa"                 },
+            { L_,   "zyxwvutsrqponm"       },
+            { L_,   "abcdefghijklmnopqrst" },
+            { L_,   "dbcadbcadbcadbca"     },
+            { L_,   "qqqqqqqqqqqqqqqqqqqb" },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        if (verbose) cout << "\nTesting 'assign'." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_lineNum;
+            const char *const SPEC = DATA[ti].d_spec_p;
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            bsl::vector<bsl::string> values(&sa);
+            for (const char *p = SPEC; *p; ++p) {
+                values.push_back(bsl::string(1, *p));
+            }
+
+            Obj mE(&sa);  const Obj& EXP = gg(&mE, SPEC);
+
+            for (int tj = 0; tj < NUM_INIT; ++tj) {
+                const char *const INIT_SPEC = INIT[tj].d_spec_p;
+
+                if (veryVerbose) { T_ P_(SPEC) P(INIT_SPEC) }
+
+                bsls::Types::Int64 allocations =
+                                             defaultAllocator.numAllocations();
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                    Obj mX(&sa);  const Obj& X = gg(&mX, INIT_SPEC);
+                    Obj mI(&sa);  const Obj& I = gg(&mI, INIT_SPEC);
+
+                    try {
+                        mX.assign(values.begin(), values.end());
+                    }
+                    catch (...) {
+                        LOOP_ASSERT(LINE, I == X);
+                        throw;
+                    }
+
+                    LOOP_ASSERT(LINE, EXP                 == X);
+                    LOOP_ASSERT(LINE, EXP.uniqueLength()  == X.uniqueLength());
+                    LOOP_ASSERT(LINE, &sa                 == X.allocator());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                LOOP_ASSERT(LINE,
+                            allocations == defaultAllocator.numAllocations());
+            }
+
+            Obj mX(&sa);  const Obj& X = mX;
+            mX.assign(values.begin(), values.end());
+
+            bsl::size_t total = 0;
+            for (bsl::size_t i = 0; i < X.uniqueLength(); ++i) {
+                LOOP2_ASSERT(LINE, i,
+                             EXP.uniqueElement(i) == X.uniqueElement(i));
+                LOOP2_ASSERT(LINE, i,
+                    EXP.uniqueElementCount(i) == X.uniqueElementCount(i));
+
+                if (i) {
+                    LOOP2_ASSERT(LINE, i,
+                                 X.uniqueElement(i - 1) < X.uniqueElement(i));
+                }
+                total += X.uniqueElementCount(i);
+            }
+            LOOP_ASSERT(LINE, X.length() == total);
+
+            for (bsl::size_t i = 0; i < X.length(); ++i) {
+                LOOP2_ASSERT(LINE, i,
+                    EXP.uniqueElementIndex(i) == X.uniqueElementIndex(i));
+                LOOP2_ASSERT(LINE, i,
+                             &X[i] == &X.uniqueElement(
+                                                  X.uniqueElementIndex(i)));
+            }
+
+            for (bsl::size_t si = 0; si <= X.length(); ++si) {
+                for (bsl::size_t ne = 0; si + ne <= X.length(); ++ne) {
+                    bsl::vector<bsl::size_t> indices(ne + 1, 99, &sa);
+
+                    X.loadUniqueElementIndices(indices.data(), si, ne);
+
+                    for (bsl::size_t i = 0; i < ne; ++i) {
+                        LOOP3_ASSERT(LINE, si, i,
+                                 X.uniqueElementIndex(si + i) == indices[i]);
+                    }
+                    LOOP2_ASSERT(LINE, si, 99 == indices[ne]);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'assign' with allocating values."
+                          << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            bsl::vector<bsl::string> values(&sa);
+            values.push_back(LONG_STRING_2);
+            values.push_back(LONG_STRING_1);
+            values.push_back(LONG_STRING_2);
+
+            bsls::Types::Int64 allocations = defaultAllocator.numAllocations();
+
+            Obj mX(&sa);  const Obj& X = mX;
+            mX.assign(values.begin(), values.end());
+
+            ASSERT(allocations == defaultAllocator.numAllocations());
+            ASSERT(3             == X.length());
+            ASSERT(2             == X.uniqueLength());
+            ASSERT(LONG_STRING_1 == X.uniqueElement(0));
+            ASSERT(LONG_STRING_2 == X[0]);
+            ASSERT(2             == X.uniqueElementCount(1));
+        }
+
+        if (verbose) cout << "\nTesting 'assign' with input iterators."
+                          << endl;
+        {
+            const int NUM_VALUES = 5000;
+
+            bsl::ostringstream out;
+            ObjInt             mE;  const ObjInt& EXP = mE;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const int value = (i * 7919) % 613 - 300;
+
+                out << value << ' ';
+                mE.push_back(value);
+            }
+
+            bsl::istringstream             in(out.str());
+            bsl::istream_iterator<int>     first(in);
+            bsl::istream_iterator<int>     last;
+
+            ObjInt mX;  const ObjInt& X = mX;
+            mX.push_back(1000);
+
+            mX.assign(first, last);
+
+            ASSERT(EXP                == X);
+            ASSERT(613                == X.uniqueLength());
+            ASSERT(EXP.uniqueLength() == X.uniqueLength());
+
+            for (bsl::size_t i = 0; i < X.length(); ++i) {
+                LOOP_ASSERT(i,
+                    EXP.uniqueElementIndex(i) == X.uniqueElementIndex(i));
+            }
+            for (bsl::size_t i = 0; i < X.uniqueLength(); ++i) {
+                LOOP_ASSERT(i,
+                    EXP.uniqueElementCount(i) == X.uniqueElementCount(i));
+            }
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;  const Obj& X = gg(&mX, "abca");
+
+            bsl::size_t  indices[4];
+            bsl::size_t *nullIndices = 0;
+
+            ASSERT_SAFE_PASS(X.uniqueElementIndex(3));
+            ASSERT_SAFE_FAIL(X.uniqueElementIndex(4));
+
+            ASSERT_SAFE_PASS(X.uniqueElementCount(2));
+            ASSERT_SAFE_FAIL(X.uniqueElementCount(3));
+
+            ASSERT_SAFE_PASS(X.loadUniqueElementIndices(indices, 0, 4));
+            ASSERT_SAFE_PASS(X.loadUniqueElementIndices(indices, 4, 0));
+            ASSERT_SAFE_PASS(X.loadUniqueElementIndices(nullIndices, 1, 0));
+            ASSERT_SAFE_FAIL(X.loadUniqueElementIndices(nullIndices, 1, 1));
+            ASSERT_SAFE_FAIL(X.loadUniqueElementIndices(indices, 1, 4));
+            ASSERT_SAFE_FAIL(X.loadUniqueElementIndices(indices, 5, 0));
+        }
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // TESTING 'hashAppend'
@@ -0,0 +1,1262 @@
+// bdlc_compressedbitmap.cpp                                          -*-C++-*-
+#include <bdlc_compressedbitmap.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlc_compressedbitmap_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitstringutil.h>
+#include <bdlb_bitutil.h>
+
+#include <bslim_printer.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+namespace {
+
+typedef CompressedBitmap_Container Container;
+typedef bdlb::BitStringUtil        BitStringUtil;
+
+enum {
+    k_CHUNK_BITS      = 65536,
+    k_MAX_ARRAY       = Container::k_MAX_ARRAY_LENGTH,
+    k_NUM_WORDS       = Container::k_NUM_BITMAP_WORDS,
+    k_BITS_PER_WORD   = BitStringUtil::k_BITS_PER_UINT64,
+    k_RUN_BYTES       = 2 * sizeof(bsl::uint16_t),
+    k_ARRAY_BYTES     = sizeof(bsl::uint16_t),
+    k_BITMAP_BYTES    = k_NUM_WORDS * sizeof(bsl::uint64_t)
+};
+
+enum Operation {
+    // This enumeration lists the set operations applied to a pair of
+    // containers having the same key.
+
+    e_AND,
+    e_MINUS,
+    e_OR,
+    e_XOR
+};
+
+class ClearProctor {
+    // This class implements a proctor that, unless released, removes all the
+    // elements of a vector of containers on destruction, leaving the set
+    // being modified valid (and empty) if an exception is thrown part way
+    // through an operation.
+
+    // DATA
+    bsl::vector<Container> *d_containers_p;  // managed vector, or 0
+
+  private:
+    // NOT IMPLEMENTED
+    ClearProctor(const ClearProctor&);
+    ClearProctor& operator=(const ClearProctor&);
+
+  public:
+    // CREATORS
+    explicit ClearProctor(bsl::vector<Container> *containers)
+    : d_containers_p(containers)
+        // Create a proctor managing the specified 'containers'.
+    {
+    }
+
+    ~ClearProctor()
+        // Remove all elements of the managed vector, if any.
+    {
+        if (d_containers_p) {
+            d_containers_p->clear();
+        }
+    }
+
+    // MANIPULATORS
+    void release()
+        // Release the managed vector from management.
+    {
+        d_containers_p = 0;
+    }
+};
+
+void releaseValues(Container *container)
+    // Release the memory held by the array or run payload of the specified
+    // 'container'.
+{
+    bsl::vector<bsl::uint16_t> empty(container->values().get_allocator());
+    container->values().swap(empty);
+}
+
+void releaseWords(Container *container)
+    // Release the memory held by the bitmap payload of the specified
+    // 'container'.
+{
+    bsl::vector<bsl::uint64_t> empty(container->words().get_allocator());
+    container->words().swap(empty);
+}
+
+bsl::uint32_t numRunValues(const bsl::vector<bsl::uint16_t>& runs)
+    // Return the number of values described by the specified 'runs'.
+{
+    bsl::uint32_t result = 0;
+    for (bsl::size_t i = 1; i < runs.size(); i += 2) {
+        result += static_cast<bsl::uint32_t>(runs[i]) + 1;
+    }
+    return result;
+}
+
+void loadWords(bsl::uint64_t *words, const Container& container)
+    // Load into the specified 'words', an array of 'k_NUM_WORDS' words, the
+    // bitmap form of the specified 'container'.
+{
+    if (Container::e_BITMAP == container.type()) {
+        bsl::memcpy(words,
+                    container.words().data(),
+                    k_NUM_WORDS * sizeof *words);
+        return;                                                       // RETURN
+    }
+
+    bsl::memset(words, 0, k_NUM_WORDS * sizeof *words);
+
+    const bsl::vector<bsl::uint16_t>& values = container.values();
+
+    if (Container::e_ARRAY == container.type()) {
+        for (bsl::size_t i = 0; i < values.size(); ++i) {
+            const unsigned value = values[i];
+
+            words[value / k_BITS_PER_WORD] |= static_cast<bsl::uint64_t>(1)
+                                                  << (value % k_BITS_PER_WORD);
+        }
+    }
+    else {
+        for (bsl::size_t i = 0; i < values.size(); i += 2) {
+            const bsl::size_t numValues =
+                                   static_cast<bsl::size_t>(values[i + 1]) + 1;
+
+            BitStringUtil::assign1(words, values[i], numValues);
+        }
+    }
+}
+
+void setFromWords(Container           *container,
+                  const bsl::uint64_t *words,
+                  bsl::uint32_t        cardinality)
+    // Set the specified 'container' to hold the specified 'cardinality'
+    // values of the specified 'words', an array of 'k_NUM_WORDS' words, in
+    // array form if 'cardinality <= k_MAX_ARRAY', and in bitmap form
+    // otherwise.  Note that 'words' may be the bitmap payload of 'container'.
+{
+    container->setCardinality(cardinality);
+
+    if (cardinality > k_MAX_ARRAY) {
+        if (container->words().data() != words) {
+            container->words().assign(words, words + k_NUM_WORDS);
+        }
+        releaseValues(container);
+        container->setType(Container::e_BITMAP);
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<bsl::uint16_t>& values = container->values();
+
+    values.clear();
+    values.reserve(cardinality);
+    for (int i = 0; i < k_NUM_WORDS; ++i) {
+        for (bsl::uint64_t word = words[i]; word; word &= word - 1) {
+            values.push_back(static_cast<bsl::uint16_t>(
+                    i * k_BITS_PER_WORD + bdlb::BitUtil::numTrailingUnsetBits(
+                                                                       word)));
+        }
+    }
+    releaseWords(container);
+    container->setType(Container::e_ARRAY);
+}
+
+void arrayToBitmap(Container *container)
+    // Convert the specified array 'container' to bitmap form.
+{
+    BSLS_ASSERT(Container::e_ARRAY == container->type());
+
+    bsl::vector<bsl::uint64_t>& words = container->words();
+
+    words.assign(k_NUM_WORDS, 0);
+    loadWords(words.data(), *container);
+    releaseValues(container);
+    container->setType(Container::e_BITMAP);
+}
+
+void runToArrayOrBitmap(Container *container)
+    // Convert the specified run 'container' to array or bitmap form,
+    // according to its cardinality.
+{
+    BSLS_ASSERT(Container::e_RUN == container->type());
+
+    bsl::uint64_t words[k_NUM_WORDS];
+
+    loadWords(words, *container);
+    setFromWords(container, words, container->cardinality());
+}
+
+bsl::size_t numRuns(const Container& container)
+    // Return the number of runs of consecutive values in the specified
+    // 'container'.
+{
+    const bsl::vector<bsl::uint16_t>& values = container.values();
+
+    switch (container.type()) {
+      case Container::e_ARRAY: {
+        bsl::size_t result = values.empty() ? 0 : 1;
+        for (bsl::size_t i = 1; i < values.size(); ++i) {
+            if (values[i] != values[i - 1] + 1) {
+                ++result;
+            }
+        }
+        return result;                                                // RETURN
+      }
+      case Container::e_BITMAP: {
+        const bsl::vector<bsl::uint64_t>& words = container.words();
+
+        bsl::size_t   result = 0;
+        bsl::uint64_t carry  = 0;
+        for (int i = 0; i < k_NUM_WORDS; ++i) {
+            const bsl::uint64_t word = words[i];
+
+            result += bdlb::BitUtil::numBitsSet(word & ~((word << 1) | carry));
+            carry   = word >> (k_BITS_PER_WORD - 1);
+        }
+        return result;                                                // RETURN
+      }
+      default: {
+        return values.size() / 2;                                     // RETURN
+      }
+    }
+}
+
+void convertToRuns(Container *container)
+    // Convert the specified array or bitmap 'container' to run form.
+{
+    BSLS_ASSERT(Container::e_RUN != container->type());
+
+    bsl::uint64_t words[k_NUM_WORDS];
+    loadWords(words, *container);
+
+    bsl::vector<bsl::uint16_t> runs(container->values().get_allocator());
+    runs.reserve(2 * numRuns(*container));
+
+    bsl::size_t begin = BitStringUtil::find1AtMinIndex(words, k_CHUNK_BITS);
+    while (BitStringUtil::k_INVALID_INDEX != begin) {
+        bsl::size_t end = BitStringUtil::find0AtMinIndex(words,
+                                                         begin,
+                                                         k_CHUNK_BITS);
+        if (BitStringUtil::k_INVALID_INDEX == end) {
+            end = k_CHUNK_BITS;
+        }
+        runs.push_back(static_cast<bsl::uint16_t>(begin));
+        runs.push_back(static_cast<bsl::uint16_t>(end - begin - 1));
+
+        begin = end < k_CHUNK_BITS
+              ? BitStringUtil::find1AtMinIndex(words, end, k_CHUNK_BITS)
+              : BitStringUtil::k_INVALID_INDEX;
+    }
+
+    container->values().swap(runs);
+    releaseWords(container);
+    container->setType(Container::e_RUN);
+}
+
+void combineWords(bsl::uint64_t       *dst,
+                  const bsl::uint64_t *src,
+                  Operation            operation)
+    // Apply the specified 'operation' to the specified 'dst' and 'src',
+    // arrays of 'k_NUM_WORDS' words, writing the result to 'dst'.
+{
+    switch (operation) {
+      case e_AND: {
+        BitStringUtil::andEqual(dst, 0, src, 0, k_CHUNK_BITS);
+      } break;
+      case e_MINUS: {
+        BitStringUtil::minusEqual(dst, 0, src, 0, k_CHUNK_BITS);
+      } break;
+      case e_OR: {
+        BitStringUtil::orEqual(dst, 0, src, 0, k_CHUNK_BITS);
+      } break;
+      case e_XOR: {
+        BitStringUtil::xorEqual(dst, 0, src, 0, k_CHUNK_BITS);
+      } break;
+    }
+}
+
+void filterArray(Container        *dst,
+                 const Container&  src,
+                 bool              keepIfPresent)
+    // Remove from the specified array 'dst' every value whose presence in the
+    // specified 'src' differs from the specified 'keepIfPresent'.
+{
+    BSLS_ASSERT(Container::e_ARRAY == dst->type());
+
+    bsl::vector<bsl::uint16_t>& values = dst->values();
+
+    bsl::size_t numKept = 0;
+    if (Container::e_ARRAY == src.type()) {
+        const bsl::vector<bsl::uint16_t>& other = src.values();
+
+        bsl::size_t j = 0;
+        for (bsl::size_t i = 0; i < values.size(); ++i) {
+            const bsl::uint16_t value = values[i];
+
+            while (j < other.size() && other[j] < value) {
+                ++j;
+            }
+            if ((j < other.size() && other[j] == value) == keepIfPresent) {
+                values[numKept++] = value;
+            }
+        }
+    }
+    else {
+        for (bsl::size_t i = 0; i < values.size(); ++i) {
+            if (src.contains(values[i]) == keepIfPresent) {
+                values[numKept++] = values[i];
+            }
+        }
+    }
+    values.resize(numKept);
+    dst->setCardinality(static_cast<bsl::uint32_t>(numKept));
+}
+
+void mergeArrays(Container        *dst,
+                 const Container&  src,
+                 Operation         operation)
+    // Replace the specified array 'dst' by the union (if 'operation' is
+    // 'e_OR') or symmetric difference (if 'operation' is 'e_XOR') of 'dst'
+    // and the specified array 'src'.
+{
+    BSLS_ASSERT(Container::e_ARRAY == dst->type());
+    BSLS_ASSERT(Container::e_ARRAY == src.type());
+    BSLS_ASSERT(e_OR == operation || e_XOR == operation);
+
+    const bsl::vector<bsl::uint16_t>& a = dst->values();
+    const bsl::vector<bsl::uint16_t>& b = src.values();
+
+    bsl::vector<bsl::uint16_t> result(a.get_allocator());
+    result.reserve(a.size() + b.size());
+
+    bsl::size_t i = 0;
+    bsl::size_t j = 0;
+    while (i < a.size() && j < b.size()) {
+        if (a[i] < b[j]) {
+            result.push_back(a[i++]);
+        }
+        else if (b[j] < a[i]) {
+            result.push_back(b[j++]);
+        }
+        else {
+            if (e_OR == operation) {
+                result.push_back(a[i]);
+            }
+            ++i;
+            ++j;
+        }
+    }
+    result.insert(result.end(), a.begin() + i, a.end());
+    result.insert(result.end(), b.begin() + j, b.end());
+
+    const bsl::uint32_t cardinality = static_cast<bsl::uint32_t>(
+                                                                result.size());
+
+    dst->values().swap(result);
+    dst->setCardinality(cardinality);
+    if (cardinality > k_MAX_ARRAY) {
+        arrayToBitmap(dst);
+    }
+}
+
+void combine(Container *dst, const Container& src, Operation operation)
+    // Apply the specified 'operation' to the specified 'dst' and 'src'
+    // containers, having the same key, writing the result to 'dst'.  Note
+    // that the result may be empty.
+{
+    BSLS_ASSERT(dst->key() == src.key());
+
+    if (Container::e_ARRAY == dst->type()) {
+        if (e_AND == operation || e_MINUS == operation) {
+            filterArray(dst, src, e_AND == operation);
+            return;                                                   // RETURN
+        }
+        if (Container::e_ARRAY == src.type()) {
+            mergeArrays(dst, src, operation);
+            return;                                                   // RETURN
+        }
+    }
+
+    if (e_AND == operation && Container::e_ARRAY == src.type()) {
+        // The intersection is the values of 'src' present in 'dst'.
+
+        bsl::vector<bsl::uint16_t> result(src.values(),
+                                          dst->values().get_allocator());
+
+        bsl::size_t numKept = 0;
+        for (bsl::size_t i = 0; i < result.size(); ++i) {
+            if (dst->contains(result[i])) {
+                result[numKept++] = result[i];
+            }
+        }
+        result.resize(numKept);
+
+        dst->values().swap(result);
+        releaseWords(dst);
+        dst->setType(Container::e_ARRAY);
+        dst->setCardinality(static_cast<bsl::uint32_t>(numKept));
+        return;                                                       // RETURN
+    }
+
+    // Otherwise, combine the bitmap forms of the two containers, a word (or
+    // more) at a time.
+
+    bsl::uint64_t  dstBuffer[k_NUM_WORDS];
+    bsl::uint64_t  srcBuffer[k_NUM_WORDS];
+    bsl::uint64_t *dstWords = dstBuffer;
+
+    if (Container::e_BITMAP == dst->type()) {
+        dstWords = dst->words().data();
+    }
+    else {
+        loadWords(dstBuffer, *dst);
+    }
+
+    const bsl::uint64_t *srcWords = srcBuffer;
+    if (Container::e_BITMAP == src.type()) {
+        srcWords = src.words().data();
+    }
+    else {
+        loadWords(srcBuffer, src);
+    }
+
+    combineWords(dstWords, srcWords, operation);
+    setFromWords(dst,
+                 dstWords,
+                 static_cast<bsl::uint32_t>(
+                             BitStringUtil::num1(dstWords, 0, k_CHUNK_BITS)));
+}
+
+bool containersIntersect(const Container& lhs, const Container& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' containers, having the
+    // same key, have a value in common, and 'false' otherwise.
+{
+    if (Container::e_ARRAY == rhs.type() && Container::e_ARRAY != lhs.type()) {
+        return containersIntersect(rhs, lhs);                         // RETURN
+    }
+
+    if (Container::e_ARRAY == lhs.type()) {
+        const bsl::vector<bsl::uint16_t>& values = lhs.values();
+
+        if (Container::e_ARRAY == rhs.type()) {
+            const bsl::vector<bsl::uint16_t>& other = rhs.values();
+
+            bsl::size_t i = 0;
+            bsl::size_t j = 0;
+            while (i < values.size() && j < other.size()) {
+                if (values[i] < other[j]) {
+                    ++i;
+                }
+                else if (other[j] < values[i]) {
+                    ++j;
+                }
+                else {
+                    return true;                                      // RETURN
+                }
+            }
+            return false;                                             // RETURN
+        }
+
+        for (bsl::size_t i = 0; i < values.size(); ++i) {
+            if (rhs.contains(values[i])) {
+                return true;                                          // RETURN
+            }
+        }
+        return false;                                                 // RETURN
+    }
+
+    bsl::uint64_t lhsBuffer[k_NUM_WORDS];
+    bsl::uint64_t rhsBuffer[k_NUM_WORDS];
+
+    const bsl::uint64_t *lhsWords = lhsBuffer;
+    if (Container::e_BITMAP == lhs.type()) {
+        lhsWords = lhs.words().data();
+    }
+    else {
+        loadWords(lhsBuffer, lhs);
+    }
+
+    const bsl::uint64_t *rhsWords = rhsBuffer;
+    if (Container::e_BITMAP == rhs.type()) {
+        rhsWords = rhs.words().data();
+    }
+    else {
+        loadWords(rhsBuffer, rhs);
+    }
+
+    for (int i = 0; i < k_NUM_WORDS; ++i) {
+        if (lhsWords[i] & rhsWords[i]) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+}  // close unnamed namespace
+
+                      // --------------------------------
+                      // class CompressedBitmap_Container
+                      // --------------------------------
+
+// CONSTANTS
+const bsl::size_t CompressedBitmap_Container::k_MAX_ARRAY_LENGTH;
+const bsl::size_t CompressedBitmap_Container::k_NUM_BITMAP_WORDS;
+
+// MANIPULATORS
+bool CompressedBitmap_Container::loadCardinality()
+{
+    switch (d_type) {
+      case e_ARRAY: {
+        if (d_values.empty()
+         || d_values.size() > k_MAX_ARRAY_LENGTH
+         || !d_words.empty()) {
+            return false;                                             // RETURN
+        }
+        for (bsl::size_t i = 1; i < d_values.size(); ++i) {
+            if (d_values[i] <= d_values[i - 1]) {
+                return false;                                         // RETURN
+            }
+        }
+        d_cardinality = static_cast<bsl::uint32_t>(d_values.size());
+      } break;
+      case e_BITMAP: {
+        if (k_NUM_BITMAP_WORDS != d_words.size() || !d_values.empty()) {
+            return false;                                             // RETURN
+        }
+        d_cardinality = static_cast<bsl::uint32_t>(
+                        BitStringUtil::num1(d_words.data(), 0, k_CHUNK_BITS));
+        if (d_cardinality <= k_MAX_ARRAY_LENGTH) {
+            return false;                                             // RETURN
+        }
+      } break;
+      case e_RUN: {
+        if (d_values.empty() || d_values.size() % 2 || !d_words.empty()) {
+            return false;                                             // RETURN
+        }
+
+        // Runs must lie within the chunk, in increasing order, separated by
+        // at least one absent value.
+
+        bsl::uint32_t next = 0;
+        for (bsl::size_t i = 0; i < d_values.size(); i += 2) {
+            const bsl::uint32_t start = d_values[i];
+            const bsl::uint32_t last  = start + d_values[i + 1];
+
+            if (start < next || k_CHUNK_BITS <= last) {
+                return false;                                         // RETURN
+            }
+            next = last + 2;
+        }
+        d_cardinality = numRunValues(d_values);
+      } break;
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+    return true;
+}
+
+void CompressedBitmap_Container::swap(CompressedBitmap_Container& other)
+{
+    d_values.swap(other.d_values);
+    d_words.swap(other.d_words);
+    bsl::swap(d_cardinality, other.d_cardinality);
+    bsl::swap(d_key,         other.d_key);
+    bsl::swap(d_type,        other.d_type);
+}
+
+// ACCESSORS
+bool CompressedBitmap_Container::contains(bsl::uint16_t low) const
+{
+    switch (d_type) {
+      case e_ARRAY: {
+        return bsl::binary_search(d_values.begin(), d_values.end(), low);
+                                                                      // RETURN
+      }
+      case e_BITMAP: {
+        return (d_words[low / k_BITS_PER_WORD] >> (low % k_BITS_PER_WORD)) & 1;
+                                                                      // RETURN
+      }
+      default: {
+        // Find the last run starting at or before 'low'.
+
+        bsl::size_t lo = 0;
+        bsl::size_t hi = d_values.size() / 2;
+        while (lo < hi) {
+            const bsl::size_t mid = lo + (hi - lo) / 2;
+            if (d_values[2 * mid] <= low) {
+                lo = mid + 1;
+            }
+            else {
+                hi = mid;
+            }
+        }
+        return 0 < lo
+            && low - d_values[2 * (lo - 1)] <= d_values[2 * (lo - 1) + 1];
+                                                                      // RETURN
+      }
+    }
+}
+
+                    // -----------------------------------
+                    // class CompressedBitmapConstIterator
+                    // -----------------------------------
+
+// PRIVATE MANIPULATORS
+void CompressedBitmapConstIterator::loadFirst()
+{
+    d_index = 0;
+    d_value = 0;
+
+    if (d_container == d_containers_p->size()) {
+        return;                                                       // RETURN
+    }
+
+    const Container& container = (*d_containers_p)[d_container];
+
+    bsl::uint32_t low;
+    if (Container::e_BITMAP == container.type()) {
+        low = static_cast<bsl::uint32_t>(BitStringUtil::find1AtMinIndex(
+                                                     container.words().data(),
+                                                     k_CHUNK_BITS));
+    }
+    else {
+        low = container.values()[0];
+    }
+    d_value = (static_cast<bsl::uint32_t>(container.key()) << 16) | low;
+}
+
+// MANIPULATORS
+CompressedBitmapConstIterator& CompressedBitmapConstIterator::operator++()
+{
+    BSLS_ASSERT(d_containers_p);
+    BSLS_ASSERT(d_container < d_containers_p->size());
+
+    const Container&    container = (*d_containers_p)[d_container];
+    const bsl::uint32_t high      = d_value & 0xffff0000u;
+    const bsl::uint32_t low       = d_value & 0xffffu;
+
+    switch (container.type()) {
+      case Container::e_ARRAY: {
+        if (++d_index < container.values().size()) {
+            d_value = high | container.values()[d_index];
+            return *this;                                             // RETURN
+        }
+      } break;
+      case Container::e_BITMAP: {
+        if (low + 1 < k_CHUNK_BITS) {
+            const bsl::size_t next = BitStringUtil::find1AtMinIndex(
+                                                     container.words().data(),
+                                                     low + 1,
+                                                     k_CHUNK_BITS);
+            if (BitStringUtil::k_INVALID_INDEX != next) {
+                d_value = high | static_cast<bsl::uint32_t>(next);
+                return *this;                                         // RETURN
+            }
+        }
+      } break;
+      case Container::e_RUN: {
+        const bsl::vector<bsl::uint16_t>& runs = container.values();
+
+        if (low < static_cast<bsl::uint32_t>(runs[2 * d_index]) +
+                                                       runs[2 * d_index + 1]) {
+            ++d_value;
+            return *this;                                             // RETURN
+        }
+        if (2 * ++d_index < runs.size()) {
+            d_value = high | runs[2 * d_index];
+            return *this;                                             // RETURN
+        }
+      } break;
+    }
+
+    ++d_container;
+    loadFirst();
+    return *this;
+}
+
+                          // ----------------------
+                          // class CompressedBitmap
+                          // ----------------------
+
+// PRIVATE ACCESSORS
+bsl::size_t CompressedBitmap::lowerBound(bsl::uint16_t key) const
+{
+    bsl::size_t lo = 0;
+    bsl::size_t hi = d_containers.size();
+    while (lo < hi) {
+        const bsl::size_t mid = lo + (hi - lo) / 2;
+        if (d_containers[mid].key() < key) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// MANIPULATORS
+void CompressedBitmap::andEqual(const CompressedBitmap& other)
+{
+    ClearProctor proctor(&d_containers);
+
+    bsl::size_t numKept = 0;
+    bsl::size_t j       = 0;
+    for (bsl::size_t i = 0; i < d_containers.size(); ++i) {
+        Container& container = d_containers[i];
+
+        while (j < other.d_containers.size()
+            && other.d_containers[j].key() < container.key()) {
+            ++j;
+        }
+        if (j == other.d_containers.size()) {
+            break;
+        }
+        if (other.d_containers[j].key() != container.key()) {
+            continue;
+        }
+
+        combine(&container, other.d_containers[j], e_AND);
+        if (container.cardinality()) {
+            if (numKept != i) {
+                d_containers[numKept].swap(container);
+            }
+            ++numKept;
+        }
+    }
+    d_containers.erase(d_containers.begin() + numKept, d_containers.end());
+
+    proctor.release();
+}
+
+void CompressedBitmap::assign(const BitArray& bits)
+{
+    BSLS_ASSERT(bits.length() <=
+                      static_cast<bsl::uint64_t>(k_CHUNK_BITS) * k_CHUNK_BITS);
+
+    const bsl::size_t length    = bits.length();
+    const bsl::size_t numChunks = (length + k_CHUNK_BITS - 1) / k_CHUNK_BITS;
+
+    bsl::vector<Container> containers(allocator());
+
+    for (bsl::size_t chunk = 0; chunk < numChunks; ++chunk) {
+        const bsl::size_t begin = chunk * k_CHUNK_BITS;
+        const bsl::size_t end   = bsl::min(begin + k_CHUNK_BITS, length);
+        const bsl::size_t count = bits.num1(begin, end);
+
+        if (0 == count) {
+            continue;
+        }
+
+        containers.resize(containers.size() + 1);
+
+        Container& container = containers.back();
+
+        container.setKey(static_cast<bsl::uint16_t>(chunk));
+        container.setCardinality(static_cast<bsl::uint32_t>(count));
+
+        if (count > k_MAX_ARRAY) {
+            // Copy the chunk a word at a time.
+
+            container.setType(Container::e_BITMAP);
+            container.words().assign(k_NUM_WORDS, 0);
+
+            bsl::uint64_t *words = container.words().data();
+            for (bsl::size_t index = begin; index < end;
+                                                   index += k_BITS_PER_WORD) {
+                *words++ = bits.bits(index,
+                                     bsl::min<bsl::size_t>(k_BITS_PER_WORD,
+                                                           end - index));
+            }
+        }
+        else {
+            bsl::vector<bsl::uint16_t>& values = container.values();
+
+            values.reserve(count);
+            for (bsl::size_t index = bits.find1AtMinIndex(begin, end);
+                 BitArray::k_INVALID_INDEX != index;
+                 index = index + 1 < end
+                       ? bits.find1AtMinIndex(index + 1, end)
+                       : BitArray::k_INVALID_INDEX) {
+                values.push_back(static_cast<bsl::uint16_t>(index - begin));
+            }
+        }
+    }
+
+    d_containers.swap(containers);
+}
+
+bool CompressedBitmap::insert(bsl::uint32_t value)
+{
+    const bsl::uint16_t key = static_cast<bsl::uint16_t>(value >> 16);
+    const bsl::uint16_t low = static_cast<bsl::uint16_t>(value);
+    const bsl::size_t   idx = lowerBound(key);
+
+    if (idx == d_containers.size() || d_containers[idx].key() != key) {
+        d_containers.emplace(d_containers.begin() + idx);
+
+        Container& container = d_containers[idx];
+
+        container.setKey(key);
+        container.values().push_back(low);
+        container.setCardinality(1);
+        return true;                                                  // RETURN
+    }
+
+    Container& container = d_containers[idx];
+
+    if (Container::e_RUN == container.type()) {
+        if (container.contains(low)) {
+            return false;                                             // RETURN
+        }
+        runToArrayOrBitmap(&container);
+    }
+
+    if (Container::e_ARRAY == container.type()) {
+        bsl::vector<bsl::uint16_t>& values = container.values();
+
+        const bsl::vector<bsl::uint16_t>::iterator it =
+                           bsl::lower_bound(values.begin(), values.end(), low);
+
+        if (it != values.end() && *it == low) {
+            return false;                                             // RETURN
+        }
+        if (values.size() < k_MAX_ARRAY) {
+            values.insert(it, low);
+            container.setCardinality(container.cardinality() + 1);
+            return true;                                              // RETURN
+        }
+        arrayToBitmap(&container);
+    }
+
+    bsl::uint64_t&      word = container.words()[low / k_BITS_PER_WORD];
+    const bsl::uint64_t bit  = static_cast<bsl::uint64_t>(1)
+                                                    << (low % k_BITS_PER_WORD);
+
+    if (word & bit) {
+        return false;                                                 // RETURN
+    }
+    word |= bit;
+    container.setCardinality(container.cardinality() + 1);
+    return true;
+}
+
+void CompressedBitmap::minusEqual(const CompressedBitmap& other)
+{
+    ClearProctor proctor(&d_containers);
+
+    bsl::size_t numKept = 0;
+    bsl::size_t j       = 0;
+    for (bsl::size_t i = 0; i < d_containers.size(); ++i) {
+        Container& container = d_containers[i];
+
+        while (j < other.d_containers.size()
+            && other.d_containers[j].key() < container.key()) {
+            ++j;
+        }
+        if (j < other.d_containers.size()
+         && other.d_containers[j].key() == container.key()) {
+            combine(&container, other.d_containers[j], e_MINUS);
+        }
+        if (container.cardinality()) {
+            if (numKept != i) {
+                d_containers[numKept].swap(container);
+            }
+            ++numKept;
+        }
+    }
+    d_containers.erase(d_containers.begin() + numKept, d_containers.end());
+
+    proctor.release();
+}
+
+void CompressedBitmap::orEqual(const CompressedBitmap& other)
+{
+    if (this == &other) {
+        return;                                                       // RETURN
+    }
+
+    ClearProctor proctor(&d_containers);
+
+    bsl::vector<Container> result(allocator());
+    result.reserve(d_containers.size() + other.d_containers.size());
+
+    bsl::size_t i = 0;
+    bsl::size_t j = 0;
+    while (i < d_containers.size() || j < other.d_containers.size()) {
+        if (j == other.d_containers.size()
+         || (i < d_containers.size()
+          && d_containers[i].key() < other.d_containers[j].key())) {
+            result.resize(result.size() + 1);
+            result.back().swap(d_containers[i++]);
+        }
+        else if (i == d_containers.size()
+              || other.d_containers[j].key() < d_containers[i].key()) {
+            result.push_back(other.d_containers[j++]);
+        }
+        else {
+            result.resize(result.size() + 1);
+            result.back().swap(d_containers[i++]);
+            combine(&result.back(), other.d_containers[j++], e_OR);
+        }
+    }
+    d_containers.swap(result);
+
+    proctor.release();
+}
+
+bool CompressedBitmap::remove(bsl::uint32_t value)
+{
+    const bsl::uint16_t key = static_cast<bsl::uint16_t>(value >> 16);
+    const bsl::uint16_t low = static_cast<bsl::uint16_t>(value);
+    const bsl::size_t   idx = lowerBound(key);
+
+    if (idx == d_containers.size() || d_containers[idx].key() != key) {
+        return false;                                                 // RETURN
+    }
+
+    Container& container = d_containers[idx];
+
+    if (Container::e_RUN == container.type()) {
+        if (!container.contains(low)) {
+            return false;                                             // RETURN
+        }
+        runToArrayOrBitmap(&container);
+    }
+
+    if (Container::e_ARRAY == container.type()) {
+        bsl::vector<bsl::uint16_t>& values = container.values();
+
+        const bsl::vector<bsl::uint16_t>::iterator it =
+                           bsl::lower_bound(values.begin(), values.end(), low);
+
+        if (it == values.end() || *it != low) {
+            return false;                                             // RETURN
+        }
+        values.erase(it);
+    }
+    else {
+        bsl::uint64_t&      word = container.words()[low / k_BITS_PER_WORD];
+        const bsl::uint64_t bit  = static_cast<bsl::uint64_t>(1)
+                                                    << (low % k_BITS_PER_WORD);
+
+        if (!(word & bit)) {
+            return false;                                             // RETURN
+        }
+        word &= ~bit;
+    }
+
+    const bsl::uint32_t cardinality = container.cardinality() - 1;
+
+    if (0 == cardinality) {
+        d_containers.erase(d_containers.begin() + idx);
+    }
+    else if (Container::e_BITMAP == container.type()
+          && cardinality <= k_MAX_ARRAY) {
+        setFromWords(&container, container.words().data(), cardinality);
+    }
+    else {
+        container.setCardinality(cardinality);
+    }
+    return true;
+}
+
+void CompressedBitmap::runOptimize()
+{
+    for (bsl::size_t i = 0; i < d_containers.size(); ++i) {
+        Container& container = d_containers[i];
+
+        const bsl::size_t runBytes = numRuns(container) * k_RUN_BYTES;
+        const bsl::size_t otherBytes =
+                          container.cardinality() > k_MAX_ARRAY
+                          ? static_cast<bsl::size_t>(k_BITMAP_BYTES)
+                          : container.cardinality() * k_ARRAY_BYTES;
+
+        if (runBytes < otherBytes) {
+            if (Container::e_RUN != container.type()) {
+                convertToRuns(&container);
+            }
+        }
+        else if (Container::e_RUN == container.type()) {
+            runToArrayOrBitmap(&container);
+        }
+    }
+}
+
+void CompressedBitmap::shrinkToFit()
+{
+    for (bsl::size_t i = 0; i < d_containers.size(); ++i) {
+        d_containers[i].values().shrink_to_fit();
+        d_containers[i].words().shrink_to_fit();
+    }
+    d_containers.shrink_to_fit();
+}
+
+void CompressedBitmap::xorEqual(const CompressedBitmap& other)
+{
+    if (this == &other) {
+        removeAll();
+        return;                                                       // RETURN
+    }
+
+    ClearProctor proctor(&d_containers);
+
+    bsl::vector<Container> result(allocator());
+    result.reserve(d_containers.size() + other.d_containers.size());
+
+    bsl::size_t i = 0;
+    bsl::size_t j = 0;
+    while (i < d_containers.size() || j < other.d_containers.size()) {
+        if (j == other.d_containers.size()
+         || (i < d_containers.size()
+          && d_containers[i].key() < other.d_containers[j].key())) {
+            result.resize(result.size() + 1);
+            result.back().swap(d_containers[i++]);
+        }
+        else if (i == d_containers.size()
+              || other.d_containers[j].key() < d_containers[i].key()) {
+            result.push_back(other.d_containers[j++]);
+        }
+        else {
+            result.resize(result.size() + 1);
+            result.back().swap(d_containers[i++]);
+            combine(&result.back(), other.d_containers[j++], e_XOR);
+            if (0 == result.back().cardinality()) {
+                result.pop_back();
+            }
+        }
+    }
+    d_containers.swap(result);
+
+    proctor.release();
+}
+
+// ACCESSORS
+bsl::size_t CompressedBitmap::cardinality() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_containers.size(); ++i) {
+        result += d_containers[i].cardinality();
+    }
+    return result;
+}
+
+bool CompressedBitmap::contains(bsl::uint32_t value) const
+{
+    const bsl::uint16_t key = static_cast<bsl::uint16_t>(value >> 16);
+    const bsl::size_t   idx = lowerBound(key);
+
+    return idx < d_containers.size()
+        && d_containers[idx].key() == key
+        && d_containers[idx].contains(static_cast<bsl::uint16_t>(value));
+}
+
+bool CompressedBitmap::intersects(const CompressedBitmap& other) const
+{
+    bsl::size_t i = 0;
+    bsl::size_t j = 0;
+    while (i < d_containers.size() && j < other.d_containers.size()) {
+        const bsl::uint16_t lhsKey = d_containers[i].key();
+        const bsl::uint16_t rhsKey = other.d_containers[j].key();
+
+        if (lhsKey < rhsKey) {
+            ++i;
+        }
+        else if (rhsKey < lhsKey) {
+            ++j;
+        }
+        else {
+            if (containersIntersect(d_containers[i],
+                                    other.d_containers[j])) {
+                return true;                                          // RETURN
+            }
+            ++i;
+            ++j;
+        }
+    }
+    return false;
+}
+
+void CompressedBitmap::loadBitArray(BitArray *result) const
+{
+    BSLS_ASSERT(result);
+
+    result->removeAll();
+    if (isEmpty()) {
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t length = static_cast<bsl::size_t>(max()) + 1;
+
+    result->setLength(length);
+
+    for (bsl::size_t i = 0; i < d_containers.size(); ++i) {
+        const Container&  container = d_containers[i];
+        const bsl::size_t base      = static_cast<bsl::size_t>(
+                                                      container.key()) << 16;
+
+        const bsl::vector<bsl::uint16_t>& values = container.values();
+
+        switch (container.type()) {
+          case Container::e_ARRAY: {
+            for (bsl::size_t j = 0; j < values.size(); ++j) {
+                result->assign1(base + values[j]);
+            }
+          } break;
+          case Container::e_BITMAP: {
+            const bsl::vector<bsl::uint64_t>& words = container.words();
+
+            for (bsl::size_t j = 0; j < words.size(); ++j) {
+                const bsl::size_t index = base + j * k_BITS_PER_WORD;
+
+                if (words[j]) {
+                    result->assignBits(index,
+                                       words[j],
+                                       bsl::min<bsl::size_t>(k_BITS_PER_WORD,
+                                                             length - index));
+                }
+            }
+          } break;
+          case Container::e_RUN: {
+            for (bsl::size_t j = 0; j < values.size(); j += 2) {
+                result->assign1(base + values[j],
+                                static_cast<bsl::size_t>(values[j + 1]) + 1);
+            }
+          } break;
+        }
+    }
+}
+
+bsl::uint32_t CompressedBitmap::max() const
+{
+    BSLS_ASSERT(!isEmpty());
+
+    const Container& container = d_containers.back();
+
+    bsl::uint32_t low;
+    switch (container.type()) {
+      case Container::e_ARRAY: {
+        low = container.values().back();
+      } break;
+      case Container::e_BITMAP: {
+        low = static_cast<bsl::uint32_t>(BitStringUtil::find1AtMaxIndex(
+                                                     container.words().data(),
+                                                     k_CHUNK_BITS));
+      } break;
+      default: {
+        const bsl::vector<bsl::uint16_t>& runs = container.values();
+
+        low = static_cast<bsl::uint32_t>(runs[runs.size() - 2]) +
+                                                                  runs.back();
+      } break;
+    }
+    return (static_cast<bsl::uint32_t>(container.key()) << 16) | low;
+}
+
+bsl::ostream& CompressedBitmap::print(bsl::ostream& stream,
+                                      int           level,
+                                      int           spacesPerLevel) const
+{
+    if (!stream.good()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    for (const_iterator it = begin(); it != end(); ++it) {
+        printer.printValue(*it);
+    }
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bool bdlc::operator==(const CompressedBitmap& lhs, const CompressedBitmap& rhs)
+{
+    typedef CompressedBitmap_Container Container;
+
+    if (lhs.d_containers.size() != rhs.d_containers.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (bsl::size_t i = 0; i < lhs.d_containers.size(); ++i) {
+        const Container& a = lhs.d_containers[i];
+        const Container& b = rhs.d_containers[i];
+
+        if (a.key() != b.key() || a.cardinality() != b.cardinality()) {
+            return false;                                             // RETURN
+        }
+
+        if (a.type() == b.type()) {
+            if (a.values() != b.values() || a.words() != b.words()) {
+                return false;                                         // RETURN
+            }
+            continue;
+        }
+
+        bsl::uint64_t aWords[k_NUM_WORDS];
+        bsl::uint64_t bWords[k_NUM_WORDS];
+
+        loadWords(aWords, a);
+        loadWords(bWords, b);
+        if (0 != bsl::memcmp(aWords, bWords, sizeof aWords)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bsl::ostream& bdlc::operator<<(bsl::ostream&           stream,
+                               const CompressedBitmap& set)
+{
+    return set.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+void bdlc::swap(CompressedBitmap& a, CompressedBitmap& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    CompressedBitmap futureA(b, a.allocator());
+    CompressedBitmap futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1060 @@
+// bdlc_compressedbitmap.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLC_COMPRESSEDBITMAP
+#define INCLUDED_BDLC_COMPRESSEDBITMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a compressed set of 32-bit unsigned integers.
+//
+//@CLASSES:
+//  bdlc::CompressedBitmap: compressed (array, bitmap, or run) integer set
+//  bdlc::CompressedBitmapConstIterator: forward iterator over the values
+//
+//@SEE_ALSO: bdlc_bitarray, bdlb_bitstringutil
+//
+//@DESCRIPTION: This component provides a value-semantic container class,
+// 'bdlc::CompressedBitmap', representing a set of 'bsl::uint32_t' values, and
+// an iterator, 'bdlc::CompressedBitmapConstIterator', that visits the values
+// of a set in increasing order.  Where a 'bdlc::BitArray' uses one bit for
+// every position up to the largest value, so that a sparse set over a large
+// universe is mostly zero words, a 'bdlc::CompressedBitmap' uses space
+// roughly in proportion to the number of values, yet operations on dense
+// regions still proceed a word (or more) at a time.
+//
+///Representation
+///--------------
+// The 32-bit universe is divided into chunks of 65536 values sharing the same
+// high-order 16 bits.  A set stores, in increasing order of those bits, one
+// "container" for each chunk holding at least one value, and each container
+// holds the low-order 16 bits of its values in one of three forms, an
+// approach known as a "Roaring" bitmap:
+//
+//: array:  a sorted array of 16-bit values, used for chunks holding at most
+//:         4096 values (2 bytes per value);
+//:
+//: bitmap: a 65536-bit bitmap, used for chunks holding more than 4096 values
+//:         (8192 bytes, regardless of the number of values); and
+//:
+//: run:    a sorted array of (start, length) pairs describing runs of
+//:         consecutive values (4 bytes per run).
+//
+// 'insert' and 'remove' convert between the array and bitmap forms as the
+// number of values in a chunk crosses 4096.  Run containers are created only
+// by 'runOptimize', which selects, for each container, the smallest of the
+// three forms; a run container that is subsequently modified is converted
+// back to the array or bitmap form.  Sets built from ranges of consecutive
+// values (e.g., blocks of identifiers) should call 'runOptimize' once they are
+// built.
+//
+///Set Operations
+///--------------
+// The manipulators 'andEqual', 'orEqual', 'minusEqual', and 'xorEqual'
+// combine a set with another in place, visiting only the chunks present in
+// either set.  Containers of the same chunk are combined by merging for
+// arrays, and a word at a time (using the processor-specific kernels of
+// 'bdlb::BitStringUtil') for bitmaps.  The accessor 'intersects' determines
+// whether two sets have any value in common without building their
+// intersection.
+//
+///Interoperation with 'bdlc::BitArray'
+///------------------------------------
+// 'assign(const BitArray&)' loads a set with the indices of the set bits of a
+// bit array, and 'loadBitArray' loads a bit array whose set bits are the
+// values of a set.  Chunks of the bit array holding more than 4096 set bits
+// are copied a word at a time.
+//
+///BDEX Externalization
+///--------------------
+// A set is externalized as the number of containers followed by, for each
+// container, its 16-bit key, its form, and its payload.  The form of each
+// container is preserved, so that a set that was 'runOptimize'd need not be
+// optimized again after it is read.  Streaming in validates the data, and
+// invalidates the stream if the data does not represent a set in canonical
+// form.
+//
+///Thread Safety
+///-------------
+// 'bdlc::CompressedBitmap' is *const* *thread-safe*: distinct threads may
+// call 'const' methods on the same object concurrently, but no thread may
+// modify an object while another thread accesses it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Checking Entitlements
+/// - - - - - - - - - - - - - - - -
+// Suppose a service holds, for each user, the set of identifiers of the data
+// feeds the user is entitled to, and, for each request, the set of feeds the
+// request requires.  Identifiers range over 32 bits, but each user is
+// entitled to a small number of feeds, clustered in a few ranges.
+//
+// First, we build the entitlements of a user, who is entitled to every feed
+// with identifiers in '[100000 .. 110000)', and a few others:
+//..
+//  bdlc::CompressedBitmap entitled;
+//
+//  for (bsl::uint32_t id = 100000; id < 110000; ++id) {
+//      entitled.insert(id);
+//  }
+//  entitled.insert(7);
+//  entitled.insert(4000000000u);
+//
+//  assert(10002 == entitled.cardinality());
+//..
+// Then, since the set was built from a range of consecutive identifiers, we
+// reduce its size by converting it to run containers where that is smaller:
+//..
+//  entitled.runOptimize();
+//
+//  assert(10002 == entitled.cardinality());
+//  assert(entitled.contains(105000));
+//..
+// Next, we build the set of feeds needed by a request:
+//..
+//  bdlc::CompressedBitmap needed;
+//
+//  needed.insert(7);
+//  needed.insert(105000);
+//  needed.insert(200000);
+//..
+// Now, we find which needed feeds the user is not entitled to:
+//..
+//  bdlc::CompressedBitmap missing(needed);
+//
+//  missing.minusEqual(entitled);
+//
+//  assert(1 == missing.cardinality());
+//  assert(200000 == *missing.begin());
+//..
+// Finally, we list the needed feeds the user is entitled to:
+//..
+//  bdlc::CompressedBitmap granted(needed);
+//
+//  granted.andEqual(entitled);
+//
+//  bsl::vector<bsl::uint32_t> ids(granted.begin(), granted.end());
+//
+//  assert(2      == ids.size());
+//  assert(7      == ids[0]);
+//  assert(105000 == ids[1]);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_bitarray.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_iosfwd.h>
+#include <bsl_iterator.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+class CompressedBitmap;
+
+                      // ================================
+                      // class CompressedBitmap_Container
+                      // ================================
+
+class CompressedBitmap_Container {
+    // This component-private class holds the values of a
+    // 'CompressedBitmap' sharing the same high-order 16 bits (its "key"),
+    // in one of the forms described in {Representation}.  Only the payload
+    // vector used by the current form is non-empty.
+
+  public:
+    // TYPES
+    enum Type {
+        e_ARRAY  = 0,  // 'values()' holds the sorted low-order bits
+        e_BITMAP = 1,  // 'words()' holds a 65536-bit bitmap
+        e_RUN    = 2   // 'values()' holds (start, length - 1) pairs
+    };
+
+    // CONSTANTS
+    static const bsl::size_t k_MAX_ARRAY_LENGTH = 4096;
+                                     // largest number of values held in an
+                                     // array container
+
+    static const bsl::size_t k_NUM_BITMAP_WORDS = 1024;
+                                     // number of words in a bitmap container
+
+  private:
+    // DATA
+    bsl::vector<bsl::uint16_t> d_values;       // array or run payload
+    bsl::vector<bsl::uint64_t> d_words;        // bitmap payload
+    bsl::uint32_t              d_cardinality;  // number of values held
+    bsl::uint16_t              d_key;          // high-order 16 bits
+    char                       d_type;         // 'Type' of the payload
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CompressedBitmap_Container,
+                                   bslma::UsesBslmaAllocator);
+    BSLMF_NESTED_TRAIT_DECLARATION(CompressedBitmap_Container,
+                                   bslmf::IsBitwiseMoveable);
+
+    // CREATORS
+    explicit CompressedBitmap_Container(bslma::Allocator *basicAllocator = 0);
+        // Create an empty array container having a key of 0.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    CompressedBitmap_Container(
+                       const CompressedBitmap_Container&  original,
+                       bslma::Allocator                  *basicAllocator = 0);
+        // Create a container having the same key, form, and values as the
+        // specified 'original' container.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    //! ~CompressedBitmap_Container() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    CompressedBitmap_Container& operator=(
+                                        const CompressedBitmap_Container& rhs);
+        // Assign to this container the key, form, and values of the specified
+        // 'rhs' container, and return a reference providing modifiable access
+        // to this container.
+
+    bool loadCardinality();
+        // Set the cardinality of this container from its payload, and return
+        // 'true' if the payload is the canonical representation of a
+        // non-empty set in the current form, and 'false' otherwise.  Used to
+        // validate data read from a BDEX stream.
+
+    void setCardinality(bsl::uint32_t value);
+        // Set the cardinality of this container to the specified 'value'.
+
+    void setKey(bsl::uint16_t value);
+        // Set the key of this container to the specified 'value'.
+
+    void setType(Type value);
+        // Set the form of this container to the specified 'value'.  Note that
+        // the payload is not changed.
+
+    void swap(CompressedBitmap_Container& other);
+        // Efficiently exchange the value of this container with that of the
+        // specified 'other' container.  The behavior is undefined unless this
+        // container was created with the same allocator as 'other'.
+
+    bsl::vector<bsl::uint16_t>& values();
+        // Return a reference providing modifiable access to the array or run
+        // payload of this container.
+
+    bsl::vector<bsl::uint64_t>& words();
+        // Return a reference providing modifiable access to the bitmap
+        // payload of this container.
+
+    // ACCESSORS
+    bsl::uint32_t cardinality() const;
+        // Return the number of values held by this container.
+
+    bool contains(bsl::uint16_t low) const;
+        // Return 'true' if this container holds the specified 'low' value, and
+        // 'false' otherwise.
+
+    bsl::uint16_t key() const;
+        // Return the key of this container.
+
+    Type type() const;
+        // Return the form of this container.
+
+    const bsl::vector<bsl::uint16_t>& values() const;
+        // Return a reference providing non-modifiable access to the array or
+        // run payload of this container.
+
+    const bsl::vector<bsl::uint64_t>& words() const;
+        // Return a reference providing non-modifiable access to the bitmap
+        // payload of this container.
+};
+
+                    // ===================================
+                    // class CompressedBitmapConstIterator
+                    // ===================================
+
+class CompressedBitmapConstIterator {
+    // This class provides a forward iterator over the values of a
+    // 'CompressedBitmap' in increasing order.  An iterator is invalidated by
+    // any modification of the set it refers to.
+
+    // DATA
+    const bsl::vector<CompressedBitmap_Container>
+                    *d_containers_p;  // containers of the iterated set
+
+    bsl::size_t      d_container;     // index of the current container
+
+    bsl::size_t      d_index;         // index of the current value (array) or
+                                      // run (run) within the container
+
+    bsl::uint32_t    d_value;         // current value
+
+    // FRIENDS
+    friend class CompressedBitmap;
+    friend bool operator==(const CompressedBitmapConstIterator&,
+                           const CompressedBitmapConstIterator&);
+
+    // PRIVATE CREATORS
+    CompressedBitmapConstIterator(
+                 const bsl::vector<CompressedBitmap_Container> *containers,
+                 bsl::size_t                                    container);
+        // Create an iterator referring to the first value of the specified
+        // 'container' of the specified 'containers', or to the end if
+        // 'container == containers->size()'.
+
+    // PRIVATE MANIPULATORS
+    void loadFirst();
+        // Set this iterator to the first value of the current container, if
+        // any.
+
+  public:
+    // TYPES
+    typedef bsl::forward_iterator_tag iterator_category;
+    typedef bsl::uint32_t             value_type;
+    typedef bsl::ptrdiff_t            difference_type;
+    typedef const bsl::uint32_t      *pointer;
+    typedef const bsl::uint32_t&      reference;
+
+    // CREATORS
+    CompressedBitmapConstIterator();
+        // Create a default iterator.  Note that the behavior of every method
+        // other than assignment and comparison with another default iterator
+        // is undefined for a default iterator.
+
+    //! CompressedBitmapConstIterator(
+    //!              const CompressedBitmapConstIterator& original) = default;
+        // Create an iterator referring to the same value as the specified
+        // 'original' iterator.
+
+    //! ~CompressedBitmapConstIterator() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! CompressedBitmapConstIterator& operator=(
+    //!                   const CompressedBitmapConstIterator& rhs) = default;
+        // Set this iterator to refer to the same value as the specified 'rhs'
+        // iterator, and return a reference providing modifiable access to this
+        // iterator.
+
+    CompressedBitmapConstIterator& operator++();
+        // Advance this iterator to the next value of the set, or to the end,
+        // and return a reference providing modifiable access to this
+        // iterator.  The behavior is undefined unless this iterator refers to
+        // a value.
+
+    // ACCESSORS
+    const bsl::uint32_t& operator*() const;
+        // Return a reference providing non-modifiable access to the value
+        // referred to by this iterator.  The behavior is undefined unless this
+        // iterator refers to a value.  Note that the reference is invalidated
+        // when this iterator is advanced.
+
+    const bsl::uint32_t *operator->() const;
+        // Return the address of the value referred to by this iterator.  The
+        // behavior is undefined unless this iterator refers to a value.
+};
+
+// FREE OPERATORS
+bool operator==(const CompressedBitmapConstIterator& lhs,
+                const CompressedBitmapConstIterator& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators refer to the
+    // same value of the same set, or are both at the end of the same set or
+    // both default, and 'false' otherwise.
+
+bool operator!=(const CompressedBitmapConstIterator& lhs,
+                const CompressedBitmapConstIterator& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators do not refer to
+    // the same value, and 'false' otherwise.
+
+CompressedBitmapConstIterator operator++(CompressedBitmapConstIterator& it,
+                                         int);
+    // Advance the specified iterator 'it' to the next value, and return its
+    // value *before* the advancement.  The behavior is undefined unless 'it'
+    // refers to a value.
+
+                          // ======================
+                          // class CompressedBitmap
+                          // ======================
+
+class CompressedBitmap {
+    // This value-semantic container class represents a set of
+    // 'bsl::uint32_t' values, stored as described in {Representation}.
+
+    // PRIVATE TYPES
+    typedef CompressedBitmap_Container Container;
+
+    // DATA
+    bsl::vector<Container> d_containers;  // non-empty containers, in
+                                          // increasing order of key
+
+    // FRIENDS
+    friend bool operator==(const CompressedBitmap&, const CompressedBitmap&);
+
+    // PRIVATE ACCESSORS
+    bsl::size_t lowerBound(bsl::uint16_t key) const;
+        // Return the index of the first container whose key is not less than
+        // the specified 'key', or the number of containers if there is none.
+
+  public:
+    // TYPES
+    typedef CompressedBitmapConstIterator const_iterator;
+    typedef bsl::uint32_t                 value_type;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CompressedBitmap,
+                                   bslma::UsesBslmaAllocator);
+    BSLMF_NESTED_TRAIT_DECLARATION(CompressedBitmap,
+                                   bslmf::IsBitwiseMoveable);
+
+    // CLASS METHODS
+    static int maxSupportedBdexVersion(int versionSelector);
+        // Return the maximum valid BDEX format version, as indicated by the
+        // specified 'versionSelector', to be passed to the 'bdexStreamOut'
+        // method.  Note that it is highly recommended that 'versionSelector'
+        // be formatted as "YYYYMMDD", a date representation.  Also note that
+        // 'versionSelector' should be a *compile*-time-chosen value that
+        // selects a format version supported by both externalizer and
+        // unexternalizer.  See the 'bslx' package-level documentation for
+        // more information on BDEX streaming of value-semantic types and
+        // containers.
+
+    // CREATORS
+    explicit CompressedBitmap(bslma::Allocator *basicAllocator = 0);
+        // Create an empty set.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    CompressedBitmap(const CompressedBitmap&  original,
+                     bslma::Allocator        *basicAllocator = 0);
+        // Create a set having the same value, and the same representation, as
+        // the specified 'original' set.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    //! ~CompressedBitmap() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    CompressedBitmap& operator=(const CompressedBitmap& rhs);
+        // Assign to this set the value of the specified 'rhs' set, and return
+        // a reference providing modifiable access to this set.
+
+    void andEqual(const CompressedBitmap& other);
+        // Remove from this set every value not in the specified 'other' set.
+
+    void assign(const BitArray& bits);
+        // Assign to this set the indices of the set bits of the specified
+        // 'bits'.  The behavior is undefined unless
+        // 'bits.length() <= 2^32'.
+
+    bool insert(bsl::uint32_t value);
+        // Insert the specified 'value' into this set.  Return 'true' if
+        // 'value' was inserted, and 'false' if it was already present.
+
+    void minusEqual(const CompressedBitmap& other);
+        // Remove from this set every value in the specified 'other' set.
+
+    void orEqual(const CompressedBitmap& other);
+        // Insert into this set every value in the specified 'other' set.
+
+    bool remove(bsl::uint32_t value);
+        // Remove the specified 'value' from this set.  Return 'true' if
+        // 'value' was removed, and 'false' if it was not present.
+
+    void removeAll();
+        // Remove all values from this set.
+
+    void runOptimize();
+        // Convert each container of this set to the smallest of the array,
+        // bitmap, and run forms (see {Representation}).  Note that the value
+        // of this set is not changed.
+
+    void shrinkToFit();
+        // Release any memory held by this set beyond that needed to hold its
+        // current value.
+
+    void swap(CompressedBitmap& other);
+        // Efficiently exchange the value of this set with that of the
+        // specified 'other' set.  This method provides the no-throw
+        // exception-safety guarantee.  The behavior is undefined unless this
+        // set was created with the same allocator as 'other'.
+
+    void xorEqual(const CompressedBitmap& other);
+        // Replace this set by the values present in exactly one of this set
+        // and the specified 'other' set.
+
+                                  // Aspects
+
+    template <class STREAM>
+    STREAM& bdexStreamIn(STREAM& stream, int version);
+        // Assign to this object the value read from the specified input
+        // 'stream' using the specified 'version' format, and return a
+        // reference to 'stream'.  If 'stream' is initially invalid, this
+        // operation has no effect.  If 'version' is not supported, this
+        // object is unaltered and 'stream' is invalidated, but otherwise
+        // unmodified.  If 'version' is supported but 'stream' becomes invalid
+        // during this operation, or the data read does not represent a set in
+        // canonical form, this object is unaltered and 'stream' is
+        // invalidated.  Note that no version is read from 'stream'.  See the
+        // 'bslx' package-level documentation for more information on BDEX
+        // streaming of value-semantic types and containers.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+
+    const_iterator begin() const;
+        // Return an iterator referring to the smallest value of this set, or
+        // 'end()' if this set is empty.
+
+    bsl::size_t cardinality() const;
+        // Return the number of values in this set.
+
+    bool contains(bsl::uint32_t value) const;
+        // Return 'true' if this set contains the specified 'value', and
+        // 'false' otherwise.
+
+    const_iterator end() const;
+        // Return an iterator referring to one past the largest value of this
+        // set.
+
+    bool intersects(const CompressedBitmap& other) const;
+        // Return 'true' if this set and the specified 'other' set have a value
+        // in common, and 'false' otherwise.
+
+    bool isEmpty() const;
+        // Return 'true' if this set has no values, and 'false' otherwise.
+
+    void loadBitArray(BitArray *result) const;
+        // Load into the specified 'result' a bit array of length 'max() + 1'
+        // (or 0 if this set is empty) whose set bits are exactly the values of
+        // this set.
+
+    bsl::uint32_t max() const;
+        // Return the largest value of this set.  The behavior is undefined
+        // unless this set is not empty.
+
+    bsl::uint32_t min() const;
+        // Return the smallest value of this set.  The behavior is undefined
+        // unless this set is not empty.
+
+    bsl::size_t numContainers() const;
+        // Return the number of containers (chunks of 65536 values holding at
+        // least one value) of this set.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+        // Write the values of this set to the specified output 'stream' in a
+        // human-readable format, and return a reference to 'stream'.
+        // Optionally specify an initial indentation 'level', whose absolute
+        // value is incremented recursively for nested objects.  If 'level' is
+        // specified, optionally specify 'spacesPerLevel', whose absolute value
+        // indicates the number of spaces per indentation level for this and
+        // all of its nested objects.  If 'level' is negative, suppress
+        // indentation of the first line.  If 'spacesPerLevel' is negative,
+        // format the entire output on one line, suppressing all but the
+        // initial indentation (as governed by 'level').  If 'stream' is not
+        // valid on entry, this operation has no effect.
+
+                                  // Aspects
+
+    template <class STREAM>
+    STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        // Write the value of this object, using the specified 'version'
+        // format, to the specified output 'stream', and return a reference to
+        // 'stream'.  If 'stream' is initially invalid, this operation has no
+        // effect.  If 'version' is not supported, 'stream' is invalidated, but
+        // otherwise unmodified.  Note that 'version' is not written to
+        // 'stream'.  See the 'bslx' package-level documentation for more
+        // information on BDEX streaming of value-semantic types and
+        // containers.
+};
+
+// FREE OPERATORS
+bool operator==(const CompressedBitmap& lhs, const CompressedBitmap& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets have the same value,
+    // and 'false' otherwise.  Two 'CompressedBitmap' objects have the same
+    // value if they contain the same values, regardless of representation.
+
+bool operator!=(const CompressedBitmap& lhs, const CompressedBitmap& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets do not have the same
+    // value, and 'false' otherwise.  Two 'CompressedBitmap' objects do not
+    // have the same value if either contains a value the other does not.
+
+bsl::ostream& operator<<(bsl::ostream& stream, const CompressedBitmap& set);
+    // Write the value of the specified 'set' to the specified output 'stream'
+    // in a single-line format, and return a reference to 'stream'.  If
+    // 'stream' is not valid on entry, this operation has no effect.  Note that
+    // this human-readable format is not fully specified, can change without
+    // notice, and is logically equivalent to:
+    //..
+    //  print(stream, 0, -1);
+    //..
+
+// FREE FUNCTIONS
+void swap(CompressedBitmap& a, CompressedBitmap& b);
+    // Exchange the values of the specified 'a' and 'b' sets.  This function
+    // provides the no-throw exception-safety guarantee if the two objects
+    // were created with the same allocator and the basic guarantee otherwise.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // class CompressedBitmap_Container
+                      // --------------------------------
+
+// CREATORS
+inline
+CompressedBitmap_Container::CompressedBitmap_Container(
+                                              bslma::Allocator *basicAllocator)
+: d_values(basicAllocator)
+, d_words(basicAllocator)
+, d_cardinality(0)
+, d_key(0)
+, d_type(e_ARRAY)
+{
+}
+
+inline
+CompressedBitmap_Container::CompressedBitmap_Container(
+                             const CompressedBitmap_Container&  original,
+                             bslma::Allocator                  *basicAllocator)
+: d_values(original.d_values, basicAllocator)
+, d_words(original.d_words, basicAllocator)
+, d_cardinality(original.d_cardinality)
+, d_key(original.d_key)
+, d_type(original.d_type)
+{
+}
+
+// MANIPULATORS
+inline
+CompressedBitmap_Container& CompressedBitmap_Container::operator=(
+                                         const CompressedBitmap_Container& rhs)
+{
+    d_values      = rhs.d_values;
+    d_words       = rhs.d_words;
+    d_cardinality = rhs.d_cardinality;
+    d_key         = rhs.d_key;
+    d_type        = rhs.d_type;
+
+    return *this;
+}
+
+inline
+void CompressedBitmap_Container::setCardinality(bsl::uint32_t value)
+{
+    d_cardinality = value;
+}
+
+inline
+void CompressedBitmap_Container::setKey(bsl::uint16_t value)
+{
+    d_key = value;
+}
+
+inline
+void CompressedBitmap_Container::setType(Type value)
+{
+    d_type = static_cast<char>(value);
+}
+
+inline
+bsl::vector<bsl::uint16_t>& CompressedBitmap_Container::values()
+{
+    return d_values;
+}
+
+inline
+bsl::vector<bsl::uint64_t>& CompressedBitmap_Container::words()
+{
+    return d_words;
+}
+
+// ACCESSORS
+inline
+bsl::uint32_t CompressedBitmap_Container::cardinality() const
+{
+    return d_cardinality;
+}
+
+inline
+bsl::uint16_t CompressedBitmap_Container::key() const
+{
+    return d_key;
+}
+
+inline
+CompressedBitmap_Container::Type CompressedBitmap_Container::type() const
+{
+    return static_cast<Type>(d_type);
+}
+
+inline
+const bsl::vector<bsl::uint16_t>& CompressedBitmap_Container::values() const
+{
+    return d_values;
+}
+
+inline
+const bsl::vector<bsl::uint64_t>& CompressedBitmap_Container::words() const
+{
+    return d_words;
+}
+
+                    // -----------------------------------
+                    // class CompressedBitmapConstIterator
+                    // -----------------------------------
+
+// PRIVATE CREATORS
+inline
+CompressedBitmapConstIterator::CompressedBitmapConstIterator(
+                 const bsl::vector<CompressedBitmap_Container> *containers,
+                 bsl::size_t                                    container)
+: d_containers_p(containers)
+, d_container(container)
+, d_index(0)
+, d_value(0)
+{
+    loadFirst();
+}
+
+// CREATORS
+inline
+CompressedBitmapConstIterator::CompressedBitmapConstIterator()
+: d_containers_p(0)
+, d_container(0)
+, d_index(0)
+, d_value(0)
+{
+}
+
+// ACCESSORS
+inline
+const bsl::uint32_t& CompressedBitmapConstIterator::operator*() const
+{
+    BSLS_ASSERT(d_containers_p);
+    BSLS_ASSERT(d_container < d_containers_p->size());
+
+    return d_value;
+}
+
+inline
+const bsl::uint32_t *CompressedBitmapConstIterator::operator->() const
+{
+    BSLS_ASSERT(d_containers_p);
+    BSLS_ASSERT(d_container < d_containers_p->size());
+
+    return &d_value;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bdlc::operator==(const CompressedBitmapConstIterator& lhs,
+                      const CompressedBitmapConstIterator& rhs)
+{
+    return lhs.d_containers_p == rhs.d_containers_p
+        && lhs.d_container    == rhs.d_container
+        && lhs.d_value        == rhs.d_value;
+}
+
+inline
+bool bdlc::operator!=(const CompressedBitmapConstIterator& lhs,
+                      const CompressedBitmapConstIterator& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bdlc::CompressedBitmapConstIterator bdlc::operator++(
+                                         CompressedBitmapConstIterator& it,
+                                         int)
+{
+    CompressedBitmapConstIterator result(it);
+    ++it;
+    return result;
+}
+
+namespace bdlc {
+
+                          // ----------------------
+                          // class CompressedBitmap
+                          // ----------------------
+
+// CLASS METHODS
+inline
+int CompressedBitmap::maxSupportedBdexVersion(int)
+{
+    return 1;
+}
+
+// CREATORS
+inline
+CompressedBitmap::CompressedBitmap(bslma::Allocator *basicAllocator)
+: d_containers(basicAllocator)
+{
+}
+
+inline
+CompressedBitmap::CompressedBitmap(const CompressedBitmap&  original,
+                                   bslma::Allocator        *basicAllocator)
+: d_containers(original.d_containers, basicAllocator)
+{
+}
+
+// MANIPULATORS
+inline
+CompressedBitmap& CompressedBitmap::operator=(const CompressedBitmap& rhs)
+{
+    d_containers = rhs.d_containers;
+
+    return *this;
+}
+
+inline
+void CompressedBitmap::removeAll()
+{
+    d_containers.clear();
+}
+
+inline
+void CompressedBitmap::swap(CompressedBitmap& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_containers.swap(other.d_containers);
+}
+
+                                  // Aspects
+
+template <class STREAM>
+STREAM& CompressedBitmap::bdexStreamIn(STREAM& stream, int version)
+{
+    if (!stream) {
+        return stream;                                                // RETURN
+    }
+
+    switch (version) {  // Switch on the schema version (starting with 1).
+      case 1: {
+        int numContainers;
+        stream.getLength(numContainers);
+        if (!stream) {
+            return stream;                                            // RETURN
+        }
+
+        bsl::vector<Container> containers(allocator());
+
+        for (int i = 0; i < numContainers; ++i) {
+            unsigned short key;
+            char           type;
+            int            length;
+
+            stream.getUint16(key);
+            stream.getInt8(type);
+            stream.getLength(length);
+            if (!stream) {
+                return stream;                                        // RETURN
+            }
+
+            if ((!containers.empty() && key <= containers.back().key())
+             || (Container::e_BITMAP == type
+              && Container::k_NUM_BITMAP_WORDS != static_cast<bsl::size_t>(
+                                                                     length))
+             || (Container::e_BITMAP != type
+              && (0 == length || 65536 < length))) {
+                stream.invalidate();
+                return stream;                                        // RETURN
+            }
+
+            containers.resize(containers.size() + 1);
+
+            Container& container = containers.back();
+
+            container.setKey(key);
+
+            switch (type) {
+              case Container::e_ARRAY: {
+                container.setType(Container::e_ARRAY);
+                container.values().resize(length);
+                stream.getArrayUint16(container.values().data(), length);
+              } break;
+              case Container::e_BITMAP: {
+                container.setType(Container::e_BITMAP);
+                container.words().resize(length);
+                stream.getArrayUint64(
+                    reinterpret_cast<bsls::Types::Uint64 *>(
+                                                    container.words().data()),
+                    length);
+              } break;
+              case Container::e_RUN: {
+                container.setType(Container::e_RUN);
+                container.values().resize(2 * length);
+                stream.getArrayUint16(container.values().data(),
+                                      2 * length);
+              } break;
+              default: {
+                stream.invalidate();
+                return stream;                                        // RETURN
+              }
+            }
+
+            if (!stream) {
+                return stream;                                        // RETURN
+            }
+            if (!container.loadCardinality()) {
+                stream.invalidate();
+                return stream;                                        // RETURN
+            }
+        }
+
+        d_containers.swap(containers);
+      } break;
+      default: {
+        stream.invalidate();
+      }
+    }
+
+    return stream;
+}
+
+// ACCESSORS
+inline
+bslma::Allocator *CompressedBitmap::allocator() const
+{
+    return d_containers.get_allocator().mechanism();
+}
+
+inline
+CompressedBitmap::const_iterator CompressedBitmap::begin() const
+{
+    return const_iterator(&d_containers, 0);
+}
+
+inline
+CompressedBitmap::const_iterator CompressedBitmap::end() const
+{
+    return const_iterator(&d_containers, d_containers.size());
+}
+
+inline
+bool CompressedBitmap::isEmpty() const
+{
+    return d_containers.empty();
+}
+
+inline
+bsl::uint32_t CompressedBitmap::min() const
+{
+    BSLS_ASSERT(!isEmpty());
+
+    return *begin();
+}
+
+inline
+bsl::size_t CompressedBitmap::numContainers() const
+{
+    return d_containers.size();
+}
+
+                                  // Aspects
+
+template <class STREAM>
+STREAM& CompressedBitmap::bdexStreamOut(STREAM& stream, int version) const
+{
+    if (!stream) {
+        return stream;                                                // RETURN
+    }
+
+    switch (version) {
+      case 1: {
+        stream.putLength(static_cast<int>(d_containers.size()));
+
+        for (bsl::size_t i = 0; i < d_containers.size(); ++i) {
+            const Container& container = d_containers[i];
+
+            stream.putUint16(container.key());
+            stream.putInt8(static_cast<char>(container.type()));
+
+            switch (container.type()) {
+              case Container::e_ARRAY: {
+                const int length = static_cast<int>(
+                                                   container.values().size());
+
+                stream.putLength(length);
+                stream.putArrayUint16(container.values().data(), length);
+              } break;
+              case Container::e_BITMAP: {
+                const int length = static_cast<int>(
+                                                    container.words().size());
+
+                stream.putLength(length);
+                stream.putArrayUint64(
+                    reinterpret_cast<const bsls::Types::Uint64 *>(
+                                                    container.words().data()),
+                    length);
+              } break;
+              case Container::e_RUN: {
+                const int length = static_cast<int>(
+                                               container.values().size() / 2);
+
+                stream.putLength(length);
+                stream.putArrayUint16(container.values().data(), 2 * length);
+              } break;
+            }
+        }
+      } break;
+      default: {
+        stream.invalidate();
+      }
+    }
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bdlc::operator!=(const CompressedBitmap& lhs, const CompressedBitmap& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
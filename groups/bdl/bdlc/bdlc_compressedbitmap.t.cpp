@@ -0,0 +1,1509 @@
+// bdlc_compressedbitmap.t.cpp                                        -*-C++-*-
+#include <bdlc_compressedbitmap.h>
+
+#include <bdlc_bitarray.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslx_byteinstream.h>
+#include <bslx_byteoutstream.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic set of 32-bit unsigned
+// integers whose chunks are held in array, bitmap, or run form.  Every
+// manipulator and accessor is verified against a sorted 'bsl::vector' oracle
+// holding the same values, for sets whose chunks are sparse (array form),
+// dense (bitmap form), and made of ranges (run form after 'runOptimize'), and
+// for chunks whose number of values crosses the array/bitmap threshold.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 8] static int maxSupportedBdexVersion(int versionSelector);
+//
+// CREATORS
+// [ 2] CompressedBitmap(bslma::Allocator *basicAllocator = 0);
+// [ 4] CompressedBitmap(const CompressedBitmap& original, *ba = 0);
+//
+// MANIPULATORS
+// [ 4] CompressedBitmap& operator=(const CompressedBitmap& rhs);
+// [ 6] void andEqual(const CompressedBitmap& other);
+// [ 7] void assign(const BitArray& bits);
+// [ 2] bool insert(uint32_t value);
+// [ 6] void minusEqual(const CompressedBitmap& other);
+// [ 6] void orEqual(const CompressedBitmap& other);
+// [ 2] bool remove(uint32_t value);
+// [ 2] void removeAll();
+// [ 5] void runOptimize();
+// [ 5] void shrinkToFit();
+// [ 4] void swap(CompressedBitmap& other);
+// [ 6] void xorEqual(const CompressedBitmap& other);
+// [ 8] STREAM& bdexStreamIn(STREAM& stream, int version);
+//
+// ACCESSORS
+// [ 4] bslma::Allocator *allocator() const;
+// [ 3] const_iterator begin() const;
+// [ 2] size_t cardinality() const;
+// [ 2] bool contains(uint32_t value) const;
+// [ 3] const_iterator end() const;
+// [ 6] bool intersects(const CompressedBitmap& other) const;
+// [ 2] bool isEmpty() const;
+// [ 7] void loadBitArray(BitArray *result) const;
+// [ 3] uint32_t max() const;
+// [ 3] uint32_t min() const;
+// [ 2] size_t numContainers() const;
+// [ 9] ostream& print(ostream& stream, int level, int spacesPerLevel) const;
+// [ 8] STREAM& bdexStreamOut(STREAM& stream, int version) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const CompressedBitmap&, const CompressedBitmap&);
+// [ 4] bool operator!=(const CompressedBitmap&, const CompressedBitmap&);
+// [ 9] ostream& operator<<(ostream&, const CompressedBitmap&);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(CompressedBitmap& a, CompressedBitmap& b);
+//
+// ITERATOR
+// [ 3] CompressedBitmapConstIterator();
+// [ 3] CompressedBitmapConstIterator& operator++();
+// [ 3] CompressedBitmapConstIterator operator++(iterator&, int);
+// [ 3] const uint32_t& operator*() const;
+// [ 3] bool operator==(const iterator&, const iterator&);
+// [ 3] bool operator!=(const iterator&, const iterator&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [10] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::CompressedBitmap         Obj;
+typedef Obj::const_iterator            Iter;
+typedef bsl::vector<bsl::uint32_t>     Oracle;
+
+const bsl::uint32_t CHUNK = 65536;
+const bsl::uint32_t LIMIT = 4096;  // largest array container
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static uint64_t nextRandom(uint64_t *state)
+    // Advance the specified linear-congruential generator 'state' and return
+    // its new value.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state ^ (*state >> 29);
+}
+
+static void normalize(Oracle *values)
+    // Sort the specified 'values' and remove duplicates.
+{
+    bsl::sort(values->begin(), values->end());
+    values->erase(bsl::unique(values->begin(), values->end()), values->end());
+}
+
+enum Shape {
+    e_SPARSE,  // few values per chunk (array containers)
+    e_DENSE,   // many values per chunk (bitmap containers)
+    e_RANGES,  // long runs of consecutive values (run containers)
+    e_MIXED    // a different shape in each chunk
+};
+
+const Shape SHAPES[]   = { e_SPARSE, e_DENSE, e_RANGES, e_MIXED };
+const int   NUM_SHAPES = sizeof SHAPES / sizeof *SHAPES;
+
+static void generate(Oracle *values, Shape shape, uint64_t seed)
+    // Load into the specified 'values' a sorted set of pseudo-random values,
+    // derived from the specified 'seed', spread over a few chunks having the
+    // specified 'shape'.
+{
+    values->clear();
+
+    uint64_t state = seed;
+
+    const int numChunks = 1 + static_cast<int>(nextRandom(&state) % 4);
+
+    for (int c = 0; c < numChunks; ++c) {
+        // Chunks are drawn from a small range of keys, so that two sets
+        // generated from different seeds usually share some chunks.
+
+        const bsl::uint32_t base = CHUNK *
+                           static_cast<bsl::uint32_t>(nextRandom(&state) % 6);
+
+        Shape s = shape;
+        if (e_MIXED == s) {
+            s = static_cast<Shape>(nextRandom(&state) % 3);
+        }
+
+        switch (s) {
+          case e_SPARSE: {
+            const int n = 1 + static_cast<int>(nextRandom(&state) % 3000);
+            for (int i = 0; i < n; ++i) {
+                values->push_back(base + static_cast<bsl::uint32_t>(
+                                             nextRandom(&state) % CHUNK));
+            }
+          } break;
+          case e_DENSE: {
+            for (bsl::uint32_t i = 0; i < CHUNK; ++i) {
+                if (nextRandom(&state) % 4) {
+                    values->push_back(base + i);
+                }
+            }
+          } break;
+          default: {
+            const int n = 1 + static_cast<int>(nextRandom(&state) % 6);
+            for (int r = 0; r < n; ++r) {
+                const bsl::uint32_t start = static_cast<bsl::uint32_t>(
+                                                  nextRandom(&state) % CHUNK);
+                const bsl::uint32_t length = static_cast<bsl::uint32_t>(
+                                                  nextRandom(&state) % 20000);
+                for (bsl::uint32_t i = start;
+                     i < CHUNK && i < start + length;
+                     ++i) {
+                    values->push_back(base + i);
+                }
+            }
+          }
+        }
+    }
+    normalize(values);
+}
+
+static void load(Obj *result, const Oracle& values)
+    // Insert the specified 'values' into the specified 'result'.
+{
+    for (bsl::size_t i = 0; i < values.size(); ++i) {
+        result->insert(values[i]);
+    }
+}
+
+static void verify(int line, const Obj& X, const Oracle& values)
+    // Verify, reporting failures at the specified 'line', that the specified
+    // 'X' holds exactly the specified 'values'.
+{
+    ASSERTV(line, values.size(), X.cardinality(),
+            values.size() == X.cardinality());
+    ASSERTV(line, values.empty() == X.isEmpty());
+
+    bslma::TestAllocator va("verify");
+
+    Oracle actual(X.begin(), X.end(), &va);
+    ASSERTV(line, values == actual);
+
+    if (!values.empty()) {
+        ASSERTV(line, values.front() == X.min());
+        ASSERTV(line, values.back()  == X.max());
+    }
+
+    bsl::size_t numChunks = 0;
+    for (bsl::size_t i = 0; i < values.size(); ++i) {
+        if (0 == i || values[i] / CHUNK != values[i - 1] / CHUNK) {
+            ++numChunks;
+        }
+    }
+    ASSERTV(line, numChunks, X.numContainers(),
+            numChunks == X.numContainers());
+}
+
+static void combine(Oracle        *result,
+                    const Oracle&  lhs,
+                    const Oracle&  rhs,
+                    int            operation)
+    // Load into the specified 'result' the intersection (0), difference (1),
+    // union (2), or symmetric difference (3) of the specified 'lhs' and 'rhs'
+    // according to the specified 'operation'.
+{
+    result->clear();
+    switch (operation) {
+      case 0: {
+        bsl::set_intersection(lhs.begin(), lhs.end(),
+                              rhs.begin(), rhs.end(),
+                              bsl::back_inserter(*result));
+      } break;
+      case 1: {
+        bsl::set_difference(lhs.begin(), lhs.end(),
+                            rhs.begin(), rhs.end(),
+                            bsl::back_inserter(*result));
+      } break;
+      case 2: {
+        bsl::set_union(lhs.begin(), lhs.end(),
+                       rhs.begin(), rhs.end(),
+                       bsl::back_inserter(*result));
+      } break;
+      default: {
+        bsl::set_symmetric_difference(lhs.begin(), lhs.end(),
+                                      rhs.begin(), rhs.end(),
+                                      bsl::back_inserter(*result));
+      }
+    }
+}
+
+static void apply(Obj *result, const Obj& other, int operation)
+    // Combine the specified 'result' with the specified 'other' using the
+    // manipulator identified by the specified 'operation' (see 'combine').
+{
+    switch (operation) {
+      case 0: result->andEqual(other);   break;
+      case 1: result->minusEqual(other); break;
+      case 2: result->orEqual(other);    break;
+      default: result->xorEqual(other);
+    }
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Checking Entitlements
+/// - - - - - - - - - - - - - - - -
+// Suppose a service holds, for each user, the set of identifiers of the data
+// feeds the user is entitled to, and, for each request, the set of feeds the
+// request requires.  Identifiers range over 32 bits, but each user is
+// entitled to a small number of feeds, clustered in a few ranges.
+//
+// First, we build the entitlements of a user, who is entitled to every feed
+// with identifiers in '[100000 .. 110000)', and a few others:
+//..
+    bdlc::CompressedBitmap entitled;
+
+    for (bsl::uint32_t id = 100000; id < 110000; ++id) {
+        entitled.insert(id);
+    }
+    entitled.insert(7);
+    entitled.insert(4000000000u);
+
+    ASSERT(10002 == entitled.cardinality());
+//..
+// Then, since the set was built from a range of consecutive identifiers, we
+// reduce its size by converting it to run containers where that is smaller:
+//..
+    entitled.runOptimize();
+
+    ASSERT(10002 == entitled.cardinality());
+    ASSERT(entitled.contains(105000));
+//..
+// Next, we build the set of feeds needed by a request:
+//..
+    bdlc::CompressedBitmap needed;
+
+    needed.insert(7);
+    needed.insert(105000);
+    needed.insert(200000);
+//..
+// Now, we find which needed feeds the user is not entitled to:
+//..
+    bdlc::CompressedBitmap missing(needed);
+
+    missing.minusEqual(entitled);
+
+    ASSERT(1 == missing.cardinality());
+    ASSERT(200000 == *missing.begin());
+//..
+// Finally, we list the needed feeds the user is entitled to:
+//..
+    bdlc::CompressedBitmap granted(needed);
+
+    granted.andEqual(entitled);
+
+    bsl::vector<bsl::uint32_t> ids(granted.begin(), granted.end());
+
+    ASSERT(2      == ids.size());
+    ASSERT(7      == ids[0]);
+    ASSERT(105000 == ids[1]);
+//..
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // PRINT AND OUTPUT OPERATOR
+        //
+        // Concerns:
+        //: 1 'print' writes the values in increasing order, honoring 'level'
+        //:   and 'spacesPerLevel', and returns the stream.
+        //:
+        //: 2 'operator<<' writes the same as 'print(stream, 0, -1)'.
+        //:
+        //: 3 Nothing is written to a stream in a bad state.
+        //
+        // Plan:
+        //: 1 Print empty and non-empty sets with different formats, and
+        //:   compare to expected output.  (C-1..2)
+        //:
+        //: 2 Print to a stream with 'badbit' set.  (C-3)
+        //
+        // Testing:
+        //   ostream& print(ostream& stream, int level, int spl) const;
+        //   ostream& operator<<(ostream&, const CompressedBitmap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRINT AND OUTPUT OPERATOR" << endl
+                          << "=========================" << endl;
+
+        Obj mX(&ta);  const Obj& X = mX;
+        {
+            bsl::ostringstream os;
+            os << X;
+            ASSERTV(os.str(), "[ ]" == os.str());
+        }
+
+        mX.insert(70000);
+        mX.insert(3);
+        mX.insert(5);
+        {
+            bsl::ostringstream os;
+            ASSERT(&os == &(os << X));
+            ASSERTV(os.str(), "[ 3 5 70000 ]" == os.str());
+        }
+        {
+            bsl::ostringstream os;
+            ASSERT(&os == &X.print(os, 1, 2));
+            ASSERTV(os.str(),
+                    "  [\n    3\n    5\n    70000\n  ]\n" == os.str());
+        }
+        {
+            bsl::ostringstream os;
+            X.print(os, -1, 2);
+            ASSERTV(os.str(), "[\n    3\n    5\n    70000\n  ]\n" == os.str());
+        }
+        {
+            bsl::ostringstream os;
+            os.setstate(bsl::ios::badbit);
+            X.print(os, 0, -1);
+            ASSERT(os.str().empty());
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // BDEX STREAMING
+        //
+        // Concerns:
+        //: 1 A set streamed out and back in has the same value and the same
+        //:   representation, for every form of container.
+        //:
+        //: 2 Streaming into a non-empty set replaces its value.
+        //:
+        //: 3 An unsupported version, a truncated stream, or data that does
+        //:   not represent a set in canonical form invalidates the stream and
+        //:   leaves the object unchanged.
+        //:
+        //: 4 Nothing is read from or written to an invalid stream.
+        //:
+        //: 5 'maxSupportedBdexVersion' returns 1.
+        //
+        // Plan:
+        //: 1 Round-trip sets of every shape, before and after 'runOptimize',
+        //:   and compare values and 'numContainers'.  (C-1..2)
+        //:
+        //: 2 Hand-craft streams with each kind of invalid content, and
+        //:   verify that streaming in fails without modifying the object.
+        //:   Stream in every proper prefix of a valid stream.  (C-3)
+        //:
+        //: 3 Stream using invalid streams.  (C-4)
+        //:
+        //: 4 Call 'maxSupportedBdexVersion'.  (C-5)
+        //
+        // Testing:
+        //   static int maxSupportedBdexVersion(int versionSelector);
+        //   STREAM& bdexStreamIn(STREAM& stream, int version);
+        //   STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BDEX STREAMING" << endl
+                          << "==============" << endl;
+
+        ASSERT(1 == Obj::maxSupportedBdexVersion(0));
+        ASSERT(1 == Obj::maxSupportedBdexVersion(20180101));
+
+        const int VERSION = 1;
+
+        if (verbose) cout << "\tRound trip." << endl;
+
+        for (int si = 0; si < NUM_SHAPES; ++si) {
+            for (uint64_t seed = 1; seed <= 4; ++seed) {
+                for (int opt = 0; opt < 2; ++opt) {
+                    Oracle values(&ta);
+                    generate(&values, SHAPES[si], seed);
+
+                    Obj mX(&ta);  const Obj& X = mX;
+                    load(&mX, values);
+                    if (opt) {
+                        mX.runOptimize();
+                    }
+
+                    bslx::ByteOutStream out(VERSION, &ta);
+                    X.bdexStreamOut(out, VERSION);
+                    ASSERT(out);
+
+                    Obj mY(&ta);  const Obj& Y = mY;
+                    mY.insert(12345678);
+
+                    bslx::ByteInStream in(out.data(), out.length());
+                    mY.bdexStreamIn(in, VERSION);
+                    ASSERTV(si, seed, opt, in);
+                    ASSERTV(si, seed, opt, in.isEmpty());
+                    ASSERTV(si, seed, opt, X == Y);
+                    verify(L_, Y, values);
+
+                    // Every proper prefix is rejected.
+
+                    const int length = static_cast<int>(out.length());
+                    const int step   = length / 37 + 1;
+                    for (int len = 0; len < length; len += step) {
+                        Obj mZ(&ta);  const Obj& Z = mZ;
+                        mZ.insert(42);
+
+                        bslx::ByteInStream in2(out.data(), len);
+                        mZ.bdexStreamIn(in2, VERSION);
+                        ASSERTV(si, seed, len, !in2);
+                        ASSERTV(si, seed, len, 1 == Z.cardinality());
+                        ASSERTV(si, seed, len, Z.contains(42));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tInvalid data." << endl;
+
+        enum { e_ARRAY = 0, e_BITMAP = 1, e_RUN = 2 };
+
+        for (int ti = 0; ti < 11; ++ti) {
+            bslx::ByteOutStream out(VERSION, &ta);
+
+            switch (ti) {
+              case 0: {  // unsorted array
+                const unsigned short V[] = { 5, 3 };
+                out.putLength(1);
+                out.putUint16(0); out.putInt8(e_ARRAY); out.putLength(2);
+                out.putArrayUint16(V, 2);
+              } break;
+              case 1: {  // duplicate array value
+                const unsigned short V[] = { 3, 3 };
+                out.putLength(1);
+                out.putUint16(0); out.putInt8(e_ARRAY); out.putLength(2);
+                out.putArrayUint16(V, 2);
+              } break;
+              case 2: {  // empty container
+                out.putLength(1);
+                out.putUint16(0); out.putInt8(e_ARRAY); out.putLength(0);
+              } break;
+              case 3: {  // array longer than the threshold
+                out.putLength(1);
+                out.putUint16(0); out.putInt8(e_ARRAY);
+                out.putLength(LIMIT + 1);
+                for (unsigned short i = 0; i <= LIMIT; ++i) {
+                    out.putUint16(i);
+                }
+              } break;
+              case 4: {  // unknown type
+                out.putLength(1);
+                out.putUint16(0); out.putInt8(7); out.putLength(1);
+                out.putUint16(1);
+              } break;
+              case 5: {  // bitmap holding too few values
+                out.putLength(1);
+                out.putUint16(0); out.putInt8(e_BITMAP); out.putLength(1024);
+                for (int i = 0; i < 1024; ++i) {
+                    out.putUint64(i < 64 ? ~0ULL : 0);
+                }
+              } break;
+              case 6: {  // bitmap of the wrong length
+                out.putLength(1);
+                out.putUint16(0); out.putInt8(e_BITMAP); out.putLength(1023);
+                for (int i = 0; i < 1023; ++i) {
+                    out.putUint64(~0ULL);
+                }
+              } break;
+              case 7: {  // overlapping runs
+                const unsigned short V[] = { 10, 5, 14, 2 };
+                out.putLength(1);
+                out.putUint16(0); out.putInt8(e_RUN); out.putLength(2);
+                out.putArrayUint16(V, 4);
+              } break;
+              case 8: {  // adjacent runs
+                const unsigned short V[] = { 10, 5, 16, 2 };
+                out.putLength(1);
+                out.putUint16(0); out.putInt8(e_RUN); out.putLength(2);
+                out.putArrayUint16(V, 4);
+              } break;
+              case 9: {  // run past the end of the chunk
+                const unsigned short V[] = { 65530, 10 };
+                out.putLength(1);
+                out.putUint16(0); out.putInt8(e_RUN); out.putLength(1);
+                out.putArrayUint16(V, 2);
+              } break;
+              default: {  // keys not increasing
+                out.putLength(2);
+                out.putUint16(3); out.putInt8(e_ARRAY); out.putLength(1);
+                out.putUint16(1);
+                out.putUint16(3); out.putInt8(e_ARRAY); out.putLength(1);
+                out.putUint16(2);
+              }
+            }
+
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.insert(42);
+
+            bslx::ByteInStream in(out.data(), out.length());
+            mX.bdexStreamIn(in, VERSION);
+            ASSERTV(ti, !in);
+            ASSERTV(ti, 1 == X.cardinality());
+            ASSERTV(ti, X.contains(42));
+        }
+
+        if (verbose) cout << "\tValid hand-crafted data." << endl;
+        {
+            const unsigned short V[] = { 10, 5, 17, 2 };
+
+            bslx::ByteOutStream out(VERSION, &ta);
+            out.putLength(1);
+            out.putUint16(2); out.putInt8(e_RUN); out.putLength(2);
+            out.putArrayUint16(V, 4);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bslx::ByteInStream in(out.data(), out.length());
+            mX.bdexStreamIn(in, VERSION);
+            ASSERT(in);
+
+            Oracle values(&ta);
+            for (bsl::uint32_t i = 10; i <= 15; ++i) {
+                values.push_back(2 * CHUNK + i);
+            }
+            for (bsl::uint32_t i = 17; i <= 19; ++i) {
+                values.push_back(2 * CHUNK + i);
+            }
+            verify(L_, X, values);
+        }
+
+        if (verbose) cout << "\tBad version and invalid streams." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.insert(1);
+            mX.insert(100000);
+
+            bslx::ByteOutStream out(VERSION, &ta);
+            X.bdexStreamOut(out, VERSION);
+
+            Obj mY(&ta);  const Obj& Y = mY;
+            mY.insert(42);
+
+            {
+                bslx::ByteInStream in(out.data(), out.length());
+                mY.bdexStreamIn(in, 2);
+                ASSERT(!in);
+                ASSERT(1 == Y.cardinality());
+            }
+            {
+                bslx::ByteInStream in(out.data(), out.length());
+                mY.bdexStreamIn(in, 0);
+                ASSERT(!in);
+                ASSERT(1 == Y.cardinality());
+            }
+            {
+                bslx::ByteInStream in(out.data(), out.length());
+                in.invalidate();
+                mY.bdexStreamIn(in, VERSION);
+                ASSERT(!in);
+                ASSERT(1 == Y.cardinality());
+            }
+            {
+                bslx::ByteOutStream out2(VERSION, &ta);
+                out2.invalidate();
+                X.bdexStreamOut(out2, VERSION);
+                ASSERT(0 == out2.length());
+            }
+            {
+                bslx::ByteOutStream out2(VERSION, &ta);
+                X.bdexStreamOut(out2, 2);
+                ASSERT(!out2);
+            }
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // INTEROPERATION WITH 'BitArray'
+        //
+        // Concerns:
+        //: 1 'assign' loads exactly the indices of the set bits of a bit
+        //:   array, replacing any previous value, for sparse and dense bit
+        //:   arrays, and for lengths that are not a multiple of the chunk or
+        //:   word size.
+        //:
+        //: 2 'loadBitArray' loads a bit array whose length is one more than
+        //:   the largest value, and whose set bits are the values of the set,
+        //:   for every form of container.
+        //:
+        //: 3 'loadBitArray' of an empty set loads an empty bit array.
+        //
+        // Plan:
+        //: 1 Generate sets of every shape, convert them to bit arrays and
+        //:   back, and compare with the oracle.  (C-1..3)
+        //
+        // Testing:
+        //   void assign(const BitArray& bits);
+        //   void loadBitArray(BitArray *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INTEROPERATION WITH 'BitArray'" << endl
+                          << "==============================" << endl;
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            bdlc::BitArray bits(5, true, &ta);
+
+            X.loadBitArray(&bits);
+            ASSERT(0 == bits.length());
+
+            mX.insert(7);
+            mX.assign(bits);
+            ASSERT(X.isEmpty());
+        }
+
+        for (int si = 0; si < NUM_SHAPES; ++si) {
+            for (uint64_t seed = 1; seed <= 6; ++seed) {
+                for (int opt = 0; opt < 2; ++opt) {
+                    Oracle values(&ta);
+                    generate(&values, SHAPES[si], seed);
+
+                    Obj mX(&ta);  const Obj& X = mX;
+                    load(&mX, values);
+                    if (opt) {
+                        mX.runOptimize();
+                    }
+
+                    bdlc::BitArray bits(&ta);
+                    X.loadBitArray(&bits);
+                    ASSERTV(si, seed,
+                            values.back() + 1 == bits.length());
+                    ASSERTV(si, seed, values.size() == bits.num1());
+                    for (bsl::size_t i = 0; i < values.size(); ++i) {
+                        ASSERTV(si, seed, i, bits[values[i]]);
+                    }
+
+                    // Extend the length so that it is not a multiple of the
+                    // word size.
+
+                    bits.setLength(bits.length() + 13, false);
+
+                    Obj mY(&ta);  const Obj& Y = mY;
+                    mY.insert(values.back() + 1);
+                    mY.assign(bits);
+                    verify(L_, Y, values);
+                    ASSERTV(si, seed, X == Y);
+                }
+            }
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // SET OPERATIONS
+        //
+        // Concerns:
+        //: 1 'andEqual', 'minusEqual', 'orEqual', and 'xorEqual' produce the
+        //:   intersection, difference, union, and symmetric difference of the
+        //:   two sets, for every combination of container forms.
+        //:
+        //: 2 The result is canonical: chunks that become empty are removed,
+        //:   and the result compares equal to the same set built by 'insert'.
+        //:
+        //: 3 Each operation behaves correctly when 'other' is the object
+        //:   itself.
+        //:
+        //: 4 'intersects' returns whether the intersection is non-empty.
+        //:
+        //: 5 'other' is not modified.
+        //
+        // Plan:
+        //: 1 For every pair of shapes and a few seeds, with and without
+        //:   'runOptimize' of either operand, apply each operation and
+        //:   compare with the oracle.  (C-1..2, 4..5)
+        //:
+        //: 2 Apply each operation to an object and itself.  (C-3)
+        //
+        // Testing:
+        //   void andEqual(const CompressedBitmap& other);
+        //   void minusEqual(const CompressedBitmap& other);
+        //   void orEqual(const CompressedBitmap& other);
+        //   void xorEqual(const CompressedBitmap& other);
+        //   bool intersects(const CompressedBitmap& other) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SET OPERATIONS" << endl
+                          << "==============" << endl;
+
+        for (int si = 0; si < NUM_SHAPES; ++si) {
+        for (int sj = 0; sj < NUM_SHAPES; ++sj) {
+        for (uint64_t seed = 1; seed <= 3; ++seed) {
+        for (int opt = 0; opt < 4; ++opt) {
+            Oracle a(&ta), b(&ta);
+            generate(&a, SHAPES[si], seed);
+            generate(&b, SHAPES[sj], seed * 7919 + 1);
+
+            Obj mA(&ta);  const Obj& A = mA;
+            Obj mB(&ta);  const Obj& B = mB;
+            load(&mA, a);
+            load(&mB, b);
+            if (opt & 1) {
+                mA.runOptimize();
+            }
+            if (opt & 2) {
+                mB.runOptimize();
+            }
+
+            const Obj B0(B, &ta);
+
+            Oracle expected(&ta);
+            combine(&expected, a, b, 0);
+            ASSERTV(si, sj, seed, opt,
+                    !expected.empty() == A.intersects(B));
+            ASSERTV(si, sj, seed, opt,
+                    !expected.empty() == B.intersects(A));
+
+            for (int op = 0; op < 4; ++op) {
+                if (veryVerbose) {
+                    T_ P_(si) P_(sj) P_(seed) P_(opt) P(op)
+                }
+
+                combine(&expected, a, b, op);
+
+                Obj mX(A, &ta);  const Obj& X = mX;
+                apply(&mX, B, op);
+                verify(L_, X, expected);
+                ASSERTV(si, sj, seed, opt, op, B == B0);
+
+                Obj mE(&ta);  const Obj& E = mE;
+                load(&mE, expected);
+                ASSERTV(si, sj, seed, opt, op, E == X);
+
+                // Results remain usable for further mutation.
+
+                mX.insert(6 * CHUNK + 1);
+                ASSERTV(si, sj, seed, opt, op,
+                        expected.size() + 1 == X.cardinality());
+            }
+        }
+        }
+        }
+        }
+
+        if (verbose) cout << "\tAliasing." << endl;
+
+        for (int si = 0; si < NUM_SHAPES; ++si) {
+            for (int opt = 0; opt < 2; ++opt) {
+                Oracle a(&ta);
+                generate(&a, SHAPES[si], 11);
+
+                for (int op = 0; op < 4; ++op) {
+                    Obj mX(&ta);  const Obj& X = mX;
+                    load(&mX, a);
+                    if (opt) {
+                        mX.runOptimize();
+                    }
+
+                    ASSERTV(si, X.intersects(X));
+
+                    apply(&mX, X, op);
+
+                    const Oracle empty(&ta);
+                    verify(L_, X, (op % 2) ? empty : a);
+                }
+            }
+        }
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(!X.intersects(X));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'runOptimize' AND 'shrinkToFit'
+        //
+        // Concerns:
+        //: 1 Neither method changes the value of the set.
+        //:
+        //: 2 'runOptimize' reduces the memory used by sets made of long runs,
+        //:   and does not increase the memory used by other sets.
+        //:
+        //: 3 'shrinkToFit' does not increase the memory used.
+        //:
+        //: 4 A run-optimized set remains fully mutable.
+        //
+        // Plan:
+        //: 1 Generate sets of every shape, and compare the value and the
+        //:   memory in use before and after each method.  (C-1..3)
+        //:
+        //: 2 Insert and remove values into run-optimized sets, comparing with
+        //:   the oracle.  (C-4)
+        //
+        // Testing:
+        //   void runOptimize();
+        //   void shrinkToFit();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'runOptimize' AND 'shrinkToFit'" << endl
+                          << "===============================" << endl;
+
+        for (int si = 0; si < NUM_SHAPES; ++si) {
+            for (uint64_t seed = 1; seed <= 6; ++seed) {
+                Oracle values;  // default allocator: does not count
+                generate(&values, SHAPES[si], seed);
+
+                bslma::TestAllocator sa("set", veryVeryVerbose);
+
+                Obj mX(&sa);  const Obj& X = mX;
+                load(&mX, values);
+
+                const bsls::Types::Int64 before = sa.numBytesInUse();
+
+                mX.shrinkToFit();
+                verify(L_, X, values);
+
+                const bsls::Types::Int64 shrunk = sa.numBytesInUse();
+                ASSERTV(si, seed, before, shrunk, shrunk <= before);
+
+                mX.runOptimize();
+                verify(L_, X, values);
+
+                const bsls::Types::Int64 optimized = sa.numBytesInUse();
+                ASSERTV(si, seed, shrunk, optimized, optimized <= shrunk);
+                if (e_RANGES == SHAPES[si]) {
+                    ASSERTV(si, seed, shrunk, optimized,
+                            optimized * 4 < shrunk);
+                }
+
+                // Mutate the optimized set.
+
+                uint64_t state = seed;
+                for (int i = 0; i < 2000; ++i) {
+                    const bsl::uint32_t value = static_cast<bsl::uint32_t>(
+                                           nextRandom(&state) % (6 * CHUNK));
+
+                    Oracle::iterator it = bsl::lower_bound(values.begin(),
+                                                           values.end(),
+                                                           value);
+                    const bool present = it != values.end() && *it == value;
+
+                    if (i % 2) {
+                        ASSERTV(si, seed, i, !present == mX.insert(value));
+                        if (!present) {
+                            values.insert(it, value);
+                        }
+                    }
+                    else {
+                        ASSERTV(si, seed, i, present == mX.remove(value));
+                        if (present) {
+                            values.erase(it);
+                        }
+                    }
+                    if (0 == i % 400) {
+                        mX.runOptimize();
+                    }
+                }
+                verify(L_, X, values);
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 The copy constructor creates an object having the same value,
+        //:   using the supplied (or default) allocator.
+        //:
+        //: 2 Assignment, including self-assignment, gives the target the value
+        //:   of the source and returns a reference to the target.
+        //:
+        //: 3 Member and free 'swap' exchange values and do not allocate.
+        //:
+        //: 4 'operator==' compares values regardless of the form of the
+        //:   containers, and 'operator!=' is its negation.
+        //:
+        //: 5 All memory is allocated from the object's allocator.
+        //
+        // Plan:
+        //: 1 Generate sets, copy, assign, swap, and compare them, checking
+        //:   the allocators in use.  (C-1..3, 5)
+        //:
+        //: 2 Compare sets having the same value in different forms, and sets
+        //:   differing in a single value.  (C-4)
+        //
+        // Testing:
+        //   CompressedBitmap(const CompressedBitmap& original, *ba = 0);
+        //   CompressedBitmap& operator=(const CompressedBitmap& rhs);
+        //   void swap(CompressedBitmap& other);
+        //   bslma::Allocator *allocator() const;
+        //   bool operator==(const CompressedBitmap&, const CompressedBitmap&);
+        //   bool operator!=(const CompressedBitmap&, const CompressedBitmap&);
+        //   void swap(CompressedBitmap& a, CompressedBitmap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                          << "====================================" << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&defaultAllocator == X.allocator());
+
+            Obj mY(&ta);  const Obj& Y = mY;
+            ASSERT(&ta == Y.allocator());
+        }
+
+        for (int si = 0; si < NUM_SHAPES; ++si) {
+            for (uint64_t seed = 1; seed <= 4; ++seed) {
+                Oracle a(&ta), b(&ta);
+                generate(&a, SHAPES[si], seed);
+                generate(&b, SHAPES[(si + 1) % NUM_SHAPES], seed + 100);
+
+                Obj mX(&ta);  const Obj& X = mX;
+                load(&mX, a);
+
+                const bsls::Types::Int64 numDefault =
+                                          defaultAllocator.numAllocations();
+
+                Obj mY(X, &ta);  const Obj& Y = mY;
+                ASSERTV(si, seed, X == Y);
+                ASSERTV(si, seed, !(X != Y));
+                ASSERTV(si, seed, &ta == Y.allocator());
+                verify(L_, Y, a);
+
+                // Same value, different forms.
+
+                mY.runOptimize();
+                ASSERTV(si, seed, X == Y);
+                ASSERTV(si, seed, Y == X);
+
+                // Differing in a single value.
+
+                const bsl::uint32_t v = a[a.size() / 2];
+                mY.remove(v);
+                ASSERTV(si, seed, X != Y);
+                ASSERTV(si, seed, Y != X);
+                mY.insert(v);
+                ASSERTV(si, seed, X == Y);
+
+                mY.insert(9 * CHUNK);
+                ASSERTV(si, seed, X != Y);
+
+                // Assignment.
+
+                Obj mZ(&ta);  const Obj& Z = mZ;
+                load(&mZ, b);
+                ASSERTV(si, seed, &mZ == &(mZ = X));
+                ASSERTV(si, seed, X == Z);
+                ASSERTV(si, seed, &mZ == &(mZ = Z));
+                ASSERTV(si, seed, X == Z);
+                verify(L_, Z, a);
+
+                // Swap.
+
+                Obj mW(&ta);  const Obj& W = mW;
+                load(&mW, b);
+
+                const bsls::Types::Int64 numTest = ta.numAllocations();
+
+                mZ.swap(mW);
+                verify(L_, Z, b);
+                verify(L_, W, a);
+
+                swap(mZ, mW);
+                verify(L_, Z, a);
+                verify(L_, W, b);
+
+                ASSERTV(si, seed, numTest == ta.numAllocations());
+                ASSERTV(si, seed,
+                        numDefault == defaultAllocator.numAllocations());
+            }
+        }
+
+        if (verbose) cout << "\tCopy using the default allocator." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.insert(3);
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERT(&defaultAllocator == Y.allocator());
+            ASSERT(X == Y);
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslma::TestAllocator oa("other", veryVeryVerbose);
+
+            Obj mX(&ta);
+            Obj mY(&ta);
+            Obj mZ(&oa);
+
+            ASSERT_PASS(mX.swap(mY));
+            ASSERT_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ITERATION, 'min', AND 'max'
+        //
+        // Concerns:
+        //: 1 Iteration visits every value once, in increasing order, for every
+        //:   form of container.
+        //:
+        //: 2 Pre- and post-increment advance the iterator; post-increment
+        //:   returns the previous position.
+        //:
+        //: 3 Iterators compare equal if and only if they refer to the same
+        //:   position, and a default-constructed iterator compares equal to
+        //:   another default-constructed iterator.
+        //:
+        //: 4 'begin() == end()' for an empty set.
+        //:
+        //: 5 'min' and 'max' return the smallest and largest values, and
+        //:   assert that the set is non-empty.
+        //
+        // Plan:
+        //: 1 Generate sets of every shape, with and without 'runOptimize',
+        //:   and iterate over them, comparing with the oracle.  (C-1..2, 5)
+        //:
+        //: 2 Compare iterators at different positions.  (C-3..4)
+        //:
+        //: 3 Call 'min' and 'max' on an empty set.  (C-5)
+        //
+        // Testing:
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   uint32_t max() const;
+        //   uint32_t min() const;
+        //   CompressedBitmapConstIterator();
+        //   CompressedBitmapConstIterator& operator++();
+        //   CompressedBitmapConstIterator operator++(iterator&, int);
+        //   const uint32_t& operator*() const;
+        //   bool operator==(const iterator&, const iterator&);
+        //   bool operator!=(const iterator&, const iterator&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ITERATION, 'min', AND 'max'" << endl
+                          << "===========================" << endl;
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(X.begin() == X.end());
+
+            Iter a, b;
+            ASSERT(a == b);
+        }
+
+        for (int si = 0; si < NUM_SHAPES; ++si) {
+            for (uint64_t seed = 1; seed <= 6; ++seed) {
+                for (int opt = 0; opt < 2; ++opt) {
+                    Oracle values(&ta);
+                    generate(&values, SHAPES[si], seed);
+
+                    Obj mX(&ta);  const Obj& X = mX;
+                    load(&mX, values);
+                    if (opt) {
+                        mX.runOptimize();
+                    }
+
+                    ASSERTV(si, seed, values.front() == X.min());
+                    ASSERTV(si, seed, values.back()  == X.max());
+
+                    Iter it = X.begin();
+                    for (bsl::size_t i = 0; i < values.size(); ++i) {
+                        ASSERTV(si, seed, opt, i, it != X.end());
+                        ASSERTV(si, seed, opt, i, values[i] == *it);
+
+                        if (i % 2) {
+                            const Iter prev = it++;
+                            ASSERTV(i, values[i] == *prev);
+                            ASSERTV(i, prev != it);
+                        }
+                        else {
+                            const Iter prev = it;
+                            ASSERTV(i, &++it == &it);
+                            ASSERTV(i, prev != it);
+                        }
+                    }
+                    ASSERTV(si, seed, opt, it == X.end());
+
+                    ASSERTV(si, seed, X.begin() == X.begin());
+                    ASSERTV(si, seed, X.end()   == X.end());
+                }
+            }
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT_FAIL(X.min());
+            ASSERT_FAIL(X.max());
+            ASSERT_FAIL(*X.begin());
+
+            mX.insert(5);
+
+            ASSERT_PASS(X.min());
+            ASSERT_PASS(X.max());
+            ASSERT_PASS(*X.begin());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed set is empty.
+        //:
+        //: 2 'insert' adds a value and returns 'true' if it was absent, and
+        //:   returns 'false' otherwise.
+        //:
+        //: 3 'remove' removes a value and returns 'true' if it was present,
+        //:   and returns 'false' otherwise.
+        //:
+        //: 4 The representation of a chunk changes correctly as its number of
+        //:   values crosses the array/bitmap threshold in either direction.
+        //:
+        //: 5 Chunks that become empty are removed.
+        //:
+        //: 6 'removeAll' empties the set.
+        //:
+        //: 7 Values at the extremes of the 32-bit range are handled.
+        //
+        // Plan:
+        //: 1 Insert and remove pseudo-random values over a few chunks,
+        //:   comparing with the oracle after each step.  (C-1..3, 5..6)
+        //:
+        //: 2 Fill a chunk with values, one at a time, past the threshold, and
+        //:   remove them again.  (C-4..5)
+        //:
+        //: 3 Insert and remove 0 and 0xFFFFFFFF.  (C-7)
+        //
+        // Testing:
+        //   CompressedBitmap(bslma::Allocator *basicAllocator = 0);
+        //   bool insert(uint32_t value);
+        //   bool remove(uint32_t value);
+        //   void removeAll();
+        //   size_t cardinality() const;
+        //   bool contains(uint32_t value) const;
+        //   bool isEmpty() const;
+        //   size_t numContainers() const;
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                 << "========================================" << endl;
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.cardinality());
+            ASSERT(0 == X.numContainers());
+            ASSERT(!X.contains(0));
+            ASSERT(0 == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\tRandom insertions and removals." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            Oracle values(&ta);
+
+            uint64_t state = 17;
+            for (int i = 0; i < 20000; ++i) {
+                const bsl::uint32_t value = static_cast<bsl::uint32_t>(
+                              nextRandom(&state) % (3 * CHUNK)) + CHUNK / 2;
+
+                Oracle::iterator it = bsl::lower_bound(values.begin(),
+                                                       values.end(),
+                                                       value);
+                const bool present = it != values.end() && *it == value;
+
+                ASSERTV(i, present == X.contains(value));
+
+                if (nextRandom(&state) % 3) {
+                    ASSERTV(i, !present == mX.insert(value));
+                    if (!present) {
+                        values.insert(it, value);
+                    }
+                }
+                else {
+                    ASSERTV(i, present == mX.remove(value));
+                    if (present) {
+                        values.erase(it);
+                    }
+                }
+                ASSERTV(i, bsl::binary_search(values.begin(),
+                                              values.end(),
+                                              value) == X.contains(value));
+
+                if (0 == i % 1000) {
+                    verify(L_, X, values);
+                }
+            }
+            verify(L_, X, values);
+
+            mX.removeAll();
+            verify(L_, X, Oracle());
+        }
+
+        if (verbose) cout << "\tCrossing the threshold." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            Oracle values(&ta);
+
+            const bsl::uint32_t base = 5 * CHUNK;
+            for (bsl::uint32_t i = 0; i < 2 * LIMIT; ++i) {
+                const bsl::uint32_t value = base + (i * 7919) % CHUNK;
+                ASSERTV(i, mX.insert(value));
+                ASSERTV(i, !mX.insert(value));
+                values.push_back(value);
+                ASSERTV(i, i + 1 == X.cardinality());
+                if (i >= LIMIT - 2 && i <= LIMIT + 2) {
+                    Oracle sorted(values);
+                    normalize(&sorted);
+                    verify(L_, X, sorted);
+                }
+            }
+            for (bsl::uint32_t i = 0; i < 2 * LIMIT; ++i) {
+                const bsl::uint32_t value = base + (i * 7919) % CHUNK;
+                ASSERTV(i, mX.remove(value));
+                ASSERTV(i, !mX.remove(value));
+                ASSERTV(i, 2 * LIMIT - i - 1 == X.cardinality());
+                ASSERTV(i, !X.contains(value));
+                if (i >= LIMIT - 2 && i <= LIMIT + 2) {
+                    Oracle sorted(values.begin() + i + 1, values.end());
+                    normalize(&sorted);
+                    verify(L_, X, sorted);
+                }
+            }
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.numContainers());
+        }
+
+        if (verbose) cout << "\tExtreme values." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(mX.insert(0xFFFFFFFFu));
+            ASSERT(mX.insert(0));
+            ASSERT(2 == X.numContainers());
+            ASSERT(0           == X.min());
+            ASSERT(0xFFFFFFFFu == X.max());
+            ASSERT(X.contains(0xFFFFFFFFu));
+            ASSERT(!X.contains(0xFFFFFFFEu));
+            ASSERT(mX.remove(0));
+            ASSERT(1 == X.numContainers());
+            ASSERT(0xFFFFFFFFu == X.min());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create sets, insert and remove values, combine them, and verify
+        //:   the results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(&ta);  const Obj& X = mX;
+        ASSERT(X.isEmpty());
+
+        ASSERT(mX.insert(10));
+        ASSERT(mX.insert(70000));
+        ASSERT(!mX.insert(10));
+        ASSERT(2 == X.cardinality());
+        ASSERT(2 == X.numContainers());
+        ASSERT(X.contains(10));
+        ASSERT(!X.contains(11));
+
+        Obj mY(&ta);  const Obj& Y = mY;
+        for (bsl::uint32_t i = 0; i < 10000; ++i) {
+            mY.insert(i);
+        }
+        ASSERT(10000 == Y.cardinality());
+
+        Obj mZ(X, &ta);  const Obj& Z = mZ;
+        mZ.andEqual(Y);
+        ASSERT(1 == Z.cardinality());
+        ASSERT(10 == Z.min());
+
+        mZ = X;
+        mZ.orEqual(Y);
+        ASSERT(10001 == Z.cardinality());
+        ASSERT(70000 == Z.max());
+
+        mY.runOptimize();
+        ASSERT(10000 == Y.cardinality());
+        ASSERT(X.intersects(Y));
+
+        ASSERT(mX.remove(10));
+        ASSERT(!X.intersects(Y));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
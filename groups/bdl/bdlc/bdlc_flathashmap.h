@@ -0,0 +1,923 @@
+// bdlc_flathashmap.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHMAP
+#define INCLUDED_BDLC_FLATHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressing unordered map with contiguous storage.
+//
+//@CLASSES:
+//  bdlc::FlatHashMap: open-addressing unordered map
+//
+//@SEE_ALSO: bdlc_flathashset, bdlc_flathashtable, bslstl_unorderedmap
+//
+//@DESCRIPTION: This component provides a value-semantic class template,
+// 'bdlc::FlatHashMap', implementing an unordered map of unique keys to values,
+// whose interface is a subset of that of 'bsl::unordered_map'.  Where
+// 'bsl::unordered_map' holds each element in a separately allocated node,
+// linked into a list threaded through an array of buckets, a
+// 'bdlc::FlatHashMap' holds its elements in a single array of slots, using
+// open addressing, alongside an array of one-byte control values, each
+// holding 7 bits of the hash value of the key in its slot (see
+// 'bdlc_flathashtable').  Consequently:
+//
+//: o A lookup usually compares the key sought with a single element, having
+//:   first compared its hash value with those of 8 slots at once, and touches
+//:   few cache lines.
+//:
+//: o Inserting an element allocates memory only when the map is rehashed, and
+//:   iterating over or rehashing a map visits memory in address order,
+//:   without following links between nodes.  Rehashing a map whose elements
+//:   are bitwise movable copies them with 'memcpy'.
+//:
+//: o Inserting an element may move the elements of the map, invalidating all
+//:   references, pointers, and iterators to them (not just iterators, as for
+//:   'bsl::unordered_map').  Erasing an element invalidates only references,
+//:   pointers, and iterators to that element.
+//:
+//: o A map does not expose its buckets, and its maximum load factor is fixed
+//:   at 0.875.
+//
+// 'bdlc::FlatHashMap' is therefore best suited to large maps whose elements
+// are looked up and iterated far more often than they are referenced across
+// insertions.
+//
+// The hash functor and equality functor of a map must not throw.  The hash
+// value of each key is mixed before use, so that the identity hash functions
+// provided by 'bsl::hash' for integral types are suitable.
+//
+///Thread Safety
+///-------------
+// 'bdlc::FlatHashMap' is *const* *thread-safe*: distinct threads may call
+// 'const' methods on the same object concurrently, but no thread may modify
+// an object while another thread accesses it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Orders by Account
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we tally the number of orders entered by each of a large number of
+// accounts, each identified by an integer, and then report the accounts that
+// entered the most orders.
+//
+// First, we create a map from account to number of orders, reserving space
+// for the expected number of accounts so that it is not rehashed as it is
+// populated:
+//..
+//  bdlc::FlatHashMap<int, int> orders;
+//  orders.reserve(1000);
+//
+//  const bsl::size_t capacity = orders.capacity();
+//..
+// Then, we tally a sequence of orders, in which account 'i % 1000' enters
+// every order 'i' but also account 7 enters every tenth order:
+//..
+//  for (int i = 0; i < 10000; ++i) {
+//      ++orders[i % 1000];
+//      if (0 == i % 10) {
+//          ++orders[7];
+//      }
+//  }
+//
+//  assert(1000     == orders.size());
+//  assert(capacity == orders.capacity());
+//..
+// Next, we look up the number of orders of some accounts:
+//..
+//  assert(1010 == orders.find(7)->second);
+//  assert(  10 == orders.find(8)->second);
+//  assert(orders.end() == orders.find(1000));
+//..
+// Then, we find the account having entered the most orders, by iterating
+// over the map:
+//..
+//  int account = -1;
+//  int maximum = 0;
+//
+//  for (bdlc::FlatHashMap<int, int>::const_iterator it = orders.begin();
+//       it != orders.end();
+//       ++it) {
+//      if (it->second > maximum) {
+//          account = it->first;
+//          maximum = it->second;
+//      }
+//  }
+//
+//  assert(   7 == account);
+//  assert(1010 == maximum);
+//..
+// Finally, we remove an account that has been closed:
+//..
+//  assert(1 == orders.erase(999));
+//  assert(0 == orders.erase(999));
+//
+//  assert(999 == orders.size());
+//  assert(false == orders.contains(999));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <initializer_list>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                       // ============================
+                       // struct FlatHashMap_EntryUtil
+                       // ============================
+
+template <class KEY, class VALUE>
+struct FlatHashMap_EntryUtil {
+    // This component-private 'struct' provides a namespace for obtaining the
+    // key of an element of a 'FlatHashMap'.
+
+    // CLASS METHODS
+    static const KEY& key(const bsl::pair<const KEY, VALUE>& entry);
+        // Return a reference providing non-modifiable access to the key of
+        // the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashMap
+                            // =================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashMap {
+    // This class template implements a value-semantic unordered map of unique
+    // keys of the (template parameter) type 'KEY' to values of the (template
+    // parameter) type 'VALUE', hashed by the (template parameter) type 'HASH'
+    // and compared by the (template parameter) type 'EQUAL', holding its
+    // elements in a single array of slots.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          bsl::pair<const KEY, VALUE>,
+                          FlatHashMap_EntryUtil<KEY, VALUE>,
+                          HASH,
+                          EQUAL>                             ImplType;
+
+    typedef bslmf::MovableRefUtil                            MoveUtil;
+
+    // DATA
+    ImplType d_impl;  // underlying table
+
+    // FRIENDS
+    template <class K, class V, class H, class E>
+    friend bool operator==(const FlatHashMap<K, V, H, E>&,
+                           const FlatHashMap<K, V, H, E>&);
+
+  public:
+    // TYPES
+    typedef KEY                                              key_type;
+    typedef VALUE                                            mapped_type;
+    typedef bsl::pair<const KEY, VALUE>                      value_type;
+    typedef bsl::size_t                                      size_type;
+    typedef bsl::ptrdiff_t                                   difference_type;
+    typedef HASH                                             hasher;
+    typedef EQUAL                                            key_equal;
+    typedef value_type&                                      reference;
+    typedef const value_type&                                const_reference;
+    typedef value_type                                      *pointer;
+    typedef const value_type                                *const_pointer;
+    typedef FlatHashTable_Iterator<value_type>               iterator;
+    typedef FlatHashTable_Iterator<const value_type>         const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashMap, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashMap();
+    explicit FlatHashMap(bslma::Allocator *basicAllocator);
+    explicit FlatHashMap(bsl::size_t capacity);
+    FlatHashMap(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty map.  Optionally specify a 'capacity', the number
+        // of elements the map can hold without rehashing; if 'capacity' is
+        // not specified, the map initially has no slots and allocates no
+        // memory.  Optionally specify a 'hash' functor used to hash keys; if
+        // 'hash' is not specified, a default-constructed 'HASH' is used.
+        // Optionally specify an 'equal' functor used to compare keys; if
+        // 'equal' is not specified, a default-constructed 'EQUAL' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a map holding the elements in the specified range
+        // '[first, last)', ignoring those whose keys equal the key of an
+        // earlier element in the range.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '[first, last)' is a valid range of objects
+        // convertible to 'value_type'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatHashMap(std::initializer_list<value_type>  values,
+                bslma::Allocator                  *basicAllocator = 0);
+        // Create a map holding the specified 'values', ignoring those whose
+        // keys equal the key of an earlier value.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+#endif
+
+    FlatHashMap(const FlatHashMap&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a map having the same value, hash functor, and equality
+        // functor as the specified 'original' map.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    FlatHashMap(bslmf::MovableRef<FlatHashMap> original);           // IMPLICIT
+        // Create a map having the same value, functors, and allocator as the
+        // specified 'original' map, by taking ownership of its slots.
+        // 'original' is left empty, with no slots.
+
+    FlatHashMap(bslmf::MovableRef<FlatHashMap>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a map having the same value and functors as the specified
+        // 'original' map, using the specified 'basicAllocator' to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  If 'original' uses 'basicAllocator', take
+        // ownership of its slots, leaving it empty with no slots; otherwise,
+        // move its elements, leaving them in a valid but unspecified state.
+
+    //! ~FlatHashMap() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashMap& operator=(const FlatHashMap& rhs);
+        // Assign to this map the value and functors of the specified 'rhs'
+        // map, and return a reference providing modifiable access to this
+        // map.
+
+    FlatHashMap& operator=(bslmf::MovableRef<FlatHashMap> rhs);
+        // Assign to this map the value and functors of the specified 'rhs'
+        // map, and return a reference providing modifiable access to this
+        // map.  If 'rhs' uses the allocator of this map, exchange the slots of
+        // the two maps; otherwise, move the elements of 'rhs', leaving them in
+        // a valid but unspecified state.
+
+    VALUE& operator[](const KEY& key);
+        // Return a reference providing modifiable access to the value mapped
+        // to the specified 'key', first inserting an element having 'key' and
+        // a default-constructed value if this map has no element having 'key'.
+        // Note that inserting an element invalidates all references, pointers,
+        // and iterators to the elements of this map.
+
+    iterator begin();
+        // Return an iterator referring to the first element of this map, or
+        // 'end()' if this map is empty.
+
+    void clear();
+        // Remove all elements from this map, leaving its capacity unchanged.
+
+    iterator end();
+        // Return an iterator referring to the end of this map.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the element having the specified 'key' from this map, if
+        // any.  Return the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove the element referred to by the specified 'position' from this
+        // map, and return an iterator referring to the element following it,
+        // or 'end()' if there is no such element.  The behavior is undefined
+        // unless 'position' refers to an element of this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the elements in the specified range '[first, last)' from
+        // this map, and return an iterator referring to the element 'last'
+        // referred to, or 'end()' if 'last == end()'.  The behavior is
+        // undefined unless '[first, last)' is a valid range of elements of
+        // this map.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the element of this map having the
+        // specified 'key', or 'end()' if there is no such element.
+
+    bsl::pair<iterator, bool> insert(const value_type& value);
+        // Insert a copy of the specified 'value' into this map if it has no
+        // element having the key of 'value'.  Return a pair whose first member
+        // refers to the element of this map having that key, and whose second
+        // member is 'true' if 'value' was inserted, and 'false' otherwise.
+        // Note that inserting an element invalidates all references, pointers,
+        // and iterators to the elements of this map.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the elements in the specified range
+        // '[first, last)' whose keys are not already present in this map or
+        // earlier in the range.  The behavior is undefined unless
+        // '[first, last)' is a valid range of objects convertible to
+        // 'value_type', none of which is an element of this map.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Rehash this map into an array of slots able to hold its elements,
+        // having no fewer than the specified 'minimumCapacity' slots,
+        // reclaiming the slots of erased elements.  If this map is empty and
+        // '0 == minimumCapacity', release its slots instead.
+
+    void reserve(bsl::size_t numElements);
+        // Increase, if necessary, the capacity of this map so that it can hold
+        // the specified 'numElements' without rehashing.
+
+    void swap(FlatHashMap& other);
+        // Exchange the value and functors of this map with those of the
+        // specified 'other' map.  This method provides the no-throw
+        // exception-safety guarantee.  The behavior is undefined unless this
+        // map and 'other' use the same allocator.
+
+    // ACCESSORS
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this map, or
+        // 'end()' if this map is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements this map can hold without rehashing.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator referring to the end of this map.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map has an element having the specified 'key',
+        // and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements of this map having the specified 'key'
+        // (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this map has no elements, and 'false' otherwise.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element of this map having the
+        // specified 'key', or 'end()' if there is no such element.
+
+    HASH hash_function() const;
+        // Return the hash functor of this map.
+
+    EQUAL key_eq() const;
+        // Return the equality functor of this map.
+
+    float load_factor() const;
+        // Return the ratio of the number of elements of this map to the number
+        // of its slots, or 0 if it has no slots.
+
+    float max_load_factor() const;
+        // Return the maximum ratio of the number of elements of this map
+        // (including erased elements whose slots have not been reclaimed) to
+        // the number of its slots.  Note that this value is always 0.875.
+
+    bsl::size_t size() const;
+        // Return the number of elements of this map.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps have the same value,
+    // and 'false' otherwise.  Two maps have the same value if they have the
+    // same number of elements, and for each element of 'lhs' there is an
+    // element of 'rhs' having an equal key and a value that compares equal
+    // using 'operator=='.
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps do not have the same
+    // value, and 'false' otherwise.  Two maps do not have the same value if
+    // they have a different number of elements, or for some element of 'lhs'
+    // there is no element of 'rhs' having an equal key and a value that
+    // compares equal using 'operator=='.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          FlatHashMap<KEY, VALUE, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' maps.  If 'a' and 'b'
+    // use the same allocator, this operation provides the no-throw
+    // exception-safety guarantee; otherwise, it provides the basic guarantee.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // struct FlatHashMap_EntryUtil
+                       // ----------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE>
+inline
+const KEY& FlatHashMap_EntryUtil<KEY, VALUE>::key(
+                                      const bsl::pair<const KEY, VALUE>& entry)
+{
+    return entry.first;
+}
+
+                            // -----------------
+                            // class FlatHashMap
+                            // -----------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap()
+: d_impl(0, HASH(), EQUAL(), 0)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL(), 0)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                            bsl::size_t       capacity,
+                                            bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                            bsl::size_t       capacity,
+                                            const HASH&       hash,
+                                            bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                            bsl::size_t       capacity,
+                                            const HASH&       hash,
+                                            const EQUAL&      equal,
+                                            bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                         std::initializer_list<value_type>  values,
+                         bslma::Allocator                  *basicAllocator)
+: d_impl(values.size(), HASH(), EQUAL(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                          const FlatHashMap&  original,
+                                          bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                       bslmf::MovableRef<FlatHashMap> original)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                              bslmf::MovableRef<FlatHashMap>  original,
+                              bslma::Allocator               *basicAllocator)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl), basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(const FlatHashMap& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(
+                                            bslmf::MovableRef<FlatHashMap> rhs)
+{
+    d_impl = MoveUtil::move(MoveUtil::access(rhs).d_impl);
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator[](const KEY& key)
+{
+    bool              found;
+    bsl::uint64_t     hash;
+    const bsl::size_t index = d_impl.findOrPrepareInsert(&found, &hash, key);
+
+    if (!found) {
+        bslma::Allocator *allocator = d_impl.allocator();
+
+        bsls::ObjectBuffer<VALUE> defaultValue;
+        bslma::ConstructionUtil::construct(defaultValue.address(), allocator);
+        bslma::DestructorGuard<VALUE> guard(defaultValue.address());
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        bslma::ConstructionUtil::construct(
+                                       d_impl.entries() + index,
+                                       allocator,
+                                       key,
+                                       MoveUtil::move(defaultValue.object()));
+#else
+        bslma::ConstructionUtil::construct(d_impl.entries() + index,
+                                           allocator,
+                                           key,
+                                           defaultValue.object());
+#endif
+        d_impl.commitInsert(index, hash);
+    }
+    return d_impl.entries()[index].second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    const bsl::size_t index = d_impl.find(key);
+
+    if (index == d_impl.capacity()) {
+        return 0;                                                     // RETURN
+    }
+    d_impl.erase(index);
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator position)
+{
+    BSLS_ASSERT(position != end());
+
+    const bsl::size_t index = &*position - d_impl.entries();
+
+    d_impl.erase(index);
+    return d_impl.iteratorAt(index);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(iterator position)
+{
+    return erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    while (first != last) {
+        first = erase(first);
+    }
+    if (last == end()) {
+        return end();                                                 // RETURN
+    }
+    return d_impl.iteratorAt(&*last - d_impl.entries());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
+{
+    return d_impl.iteratorAt(d_impl.find(key));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const value_type& value)
+{
+    bool              found;
+    bsl::uint64_t     hash;
+    const bsl::size_t index =
+                        d_impl.findOrPrepareInsert(&found, &hash, value.first);
+
+    if (!found) {
+        bslma::ConstructionUtil::construct(d_impl.entries() + index,
+                                           d_impl.allocator(),
+                                           value);
+        d_impl.commitInsert(index, hash);
+    }
+    return bsl::pair<iterator, bool>(d_impl.iteratorAt(index), !found);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        insert(*first);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::swap(FlatHashMap& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return FlatHashTable_ImpUtil::maxLoad(d_impl.capacity());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.find(key) != d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::count(const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.iteratorAt(d_impl.find(key));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hashFunctor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL FlatHashMap<KEY, VALUE, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.equalityFunctor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.capacity()
+           ? static_cast<float>(d_impl.size())
+                                       / static_cast<float>(d_impl.capacity())
+           : 0.0f;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
+{
+    return 0.875f;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                                  // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl.isEqual(rhs.d_impl);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void bdlc::swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+                FlatHashMap<KEY, VALUE, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureA(b, a.allocator());
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
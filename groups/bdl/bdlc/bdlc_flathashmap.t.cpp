@@ -0,0 +1,1130 @@
+// bdlc_flathashmap.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic unordered map implemented in
+// terms of 'bdlc::FlatHashTable', which is tested thoroughly in its own
+// component.  This test driver therefore concentrates on the forwarding of
+// each method to the table, on the construction of elements (in particular
+// by 'operator[]'), and on the allocator and value semantics of the map.  The
+// manipulators are verified against a 'bsl::map' oracle on pseudo-random
+// sequences of operations.  A negative test case compares the performance of
+// the map with that of 'bsl::unordered_map'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashMap();
+// [ 2] explicit FlatHashMap(bslma::Allocator *basicAllocator);
+// [ 2] explicit FlatHashMap(size_t capacity);
+// [ 2] FlatHashMap(size_t capacity, Allocator *);
+// [ 2] FlatHashMap(size_t capacity, const HASH&, Allocator *);
+// [ 2] FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator *);
+// [ 4] FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, Allocator *);
+// [ 4] FlatHashMap(initializer_list<value_type> values, Allocator *);
+// [ 5] FlatHashMap(const FlatHashMap& original, Allocator *);
+// [ 5] FlatHashMap(MovableRef<FlatHashMap> original);
+// [ 5] FlatHashMap(MovableRef<FlatHashMap> original, Allocator *);
+//
+// MANIPULATORS
+// [ 5] FlatHashMap& operator=(const FlatHashMap& rhs);
+// [ 5] FlatHashMap& operator=(MovableRef<FlatHashMap> rhs);
+// [ 3] VALUE& operator[](const KEY& key);
+// [ 3] iterator begin();
+// [ 3] void clear();
+// [ 3] iterator end();
+// [ 3] size_t erase(const KEY& key);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(iterator position);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 3] iterator find(const KEY& key);
+// [ 3] pair<iterator, bool> insert(const value_type& value);
+// [ 4] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 4] void rehash(size_t minimumCapacity);
+// [ 4] void reserve(size_t numElements);
+// [ 5] void swap(FlatHashMap& other);
+//
+// ACCESSORS
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 2] size_t capacity() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 4] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+// [ 5] bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+//
+// FREE FUNCTIONS
+// [ 5] void swap(FlatHashMap& a, FlatHashMap& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'bsl::unordered_map'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashMap<int, int>                 IntMap;
+typedef bdlc::FlatHashMap<bsl::string, bsl::string> StringMap;
+typedef bslmf::MovableRefUtil                       MoveUtil;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::uint64_t nextRandom(bsl::uint64_t *state)
+    // Advance the specified linear-congruential generator 'state' and return
+    // its new value.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state ^ (*state >> 29);
+}
+
+bsl::string makeString(int value)
+    // Return a string, too long for the short-string buffer, whose value is
+    // determined by the specified 'value'.
+{
+    bsl::string result("a string long enough to allocate memory: ");
+    for (int i = 0; i < 8; ++i) {
+        result.push_back(static_cast<char>('0' + value % 10));
+        value /= 10;
+    }
+    return result;
+}
+
+template <class MAP, class ORACLE>
+bool matchesOracle(const MAP& map, const ORACLE& oracle)
+    // Return 'true' if the specified 'map' holds exactly the elements of the
+    // specified 'oracle', each exactly once, and 'false' otherwise.
+{
+    if (map.size() != oracle.size() || map.empty() != oracle.empty()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::size_t count = 0;
+    for (typename MAP::const_iterator it = map.begin();
+         it != map.end();
+         ++it) {
+        typename ORACLE::const_iterator found = oracle.find(it->first);
+        if (found == oracle.end() || !(found->second == it->second)) {
+            return false;                                             // RETURN
+        }
+        ++count;
+    }
+    if (count != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (typename ORACLE::const_iterator it = oracle.begin();
+         it != oracle.end();
+         ++it) {
+        typename MAP::const_iterator found = map.find(it->first);
+        if (found == map.end()
+         || !(found->second == it->second)
+         || !map.contains(it->first)
+         || 1 != map.count(it->first)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Orders by Account
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we tally the number of orders entered by each of a large number of
+// accounts, each identified by an integer, and then report the accounts that
+// entered the most orders.
+//
+// First, we create a map from account to number of orders, reserving space
+// for the expected number of accounts so that it is not rehashed as it is
+// populated:
+//..
+    bdlc::FlatHashMap<int, int> orders;
+    orders.reserve(1000);
+
+    const bsl::size_t capacity = orders.capacity();
+//..
+// Then, we tally a sequence of orders, in which account 'i % 1000' enters
+// every order 'i' but also account 7 enters every tenth order:
+//..
+    for (int i = 0; i < 10000; ++i) {
+        ++orders[i % 1000];
+        if (0 == i % 10) {
+            ++orders[7];
+        }
+    }
+
+    ASSERT(1000     == orders.size());
+    ASSERT(capacity == orders.capacity());
+//..
+// Next, we look up the number of orders of some accounts:
+//..
+    ASSERT(1010 == orders.find(7)->second);
+    ASSERT(  10 == orders.find(8)->second);
+    ASSERT(orders.end() == orders.find(1000));
+//..
+// Then, we find the account having entered the most orders, by iterating
+// over the map:
+//..
+    int account = -1;
+    int maximum = 0;
+
+    for (bdlc::FlatHashMap<int, int>::const_iterator it = orders.begin();
+         it != orders.end();
+         ++it) {
+        if (it->second > maximum) {
+            account = it->first;
+            maximum = it->second;
+        }
+    }
+
+    ASSERT(   7 == account);
+    ASSERT(1010 == maximum);
+//..
+// Finally, we remove an account that has been closed:
+//..
+    ASSERT(1 == orders.erase(999));
+    ASSERT(0 == orders.erase(999));
+
+    ASSERT(999 == orders.size());
+    ASSERT(false == orders.contains(999));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original and uses the allocator
+        //:   supplied.
+        //:
+        //: 2 Moving with the same allocator does not allocate, and leaves the
+        //:   original empty; moving with a different allocator moves the
+        //:   elements into memory obtained from the allocator supplied.
+        //:
+        //: 3 Assignment and the member and free 'swap' exchange values,
+        //:   including between maps using different allocators for the free
+        //:   'swap'.
+        //:
+        //: 4 Two maps are equal if and only if they have the same keys mapped
+        //:   to equal values, regardless of their capacities and of the order
+        //:   in which the elements were inserted.
+        //
+        // Plan:
+        //: 1 Build a map of strings, copy, move, assign, and swap it using two
+        //:   test allocators, verifying the results against an oracle and the
+        //:   allocators' counters.  (C-1..3)
+        //:
+        //: 2 Compare maps built in different orders, with different
+        //:   capacities, and differing in a single value.  (C-4)
+        //
+        // Testing:
+        //   FlatHashMap(const FlatHashMap& original, Allocator *);
+        //   FlatHashMap(MovableRef<FlatHashMap> original);
+        //   FlatHashMap(MovableRef<FlatHashMap> original, Allocator *);
+        //   FlatHashMap& operator=(const FlatHashMap& rhs);
+        //   FlatHashMap& operator=(MovableRef<FlatHashMap> rhs);
+        //   void swap(FlatHashMap& other);
+        //   bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   void swap(FlatHashMap& a, FlatHashMap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND EQUALITY" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator oa("other", veryVeryVerbose);
+
+        bsl::map<bsl::string, bsl::string> oracle(&ta);
+
+        StringMap mX(&ta);  const StringMap& X = mX;
+
+        for (int i = 0; i < 100; ++i) {
+            mX[makeString(i)] = makeString(i * 3);
+            oracle[makeString(i)] = makeString(i * 3);
+        }
+        ASSERT(matchesOracle(X, oracle));
+
+        if (verbose) cout << "\tCopy construction." << endl;
+        {
+            StringMap mY(X, &oa);  const StringMap& Y = mY;
+
+            ASSERT(&oa == Y.allocator());
+            ASSERT(matchesOracle(Y, oracle));
+            ASSERT(X == Y);
+            ASSERT(!(X != Y));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tMove construction." << endl;
+        {
+            StringMap mY(X, &ta);  const StringMap& Y = mY;
+
+            const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+
+            StringMap mZ(MoveUtil::move(mY));  const StringMap& Z = mZ;
+
+            ASSERT(numBlocks == ta.numBlocksTotal());
+            ASSERT(&ta == Z.allocator());
+            ASSERT(matchesOracle(Z, oracle));
+            ASSERT(Y.empty());
+            ASSERT(0 == Y.capacity());
+
+            StringMap mW(MoveUtil::move(mZ), &oa);  const StringMap& W = mW;
+
+            ASSERT(&oa == W.allocator());
+            ASSERT(matchesOracle(W, oracle));
+            ASSERT(W.size() == Z.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tAssignment." << endl;
+        {
+            StringMap mY(&oa);  const StringMap& Y = mY;
+
+            mY["only"] = "value";
+
+            mY = X;
+            ASSERT(&oa == Y.allocator());
+            ASSERT(matchesOracle(Y, oracle));
+
+            mY = Y;
+            ASSERT(matchesOracle(Y, oracle));
+
+            StringMap mZ(&oa);  const StringMap& Z = mZ;
+
+            const bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+
+            mZ = MoveUtil::move(mY);
+            ASSERT(numBlocks == oa.numBlocksTotal());
+            ASSERT(matchesOracle(Z, oracle));
+
+            StringMap mW(X, &ta);
+
+            mY = MoveUtil::move(mW);                  // different allocator
+            ASSERT(&oa == Y.allocator());
+            ASSERT(matchesOracle(Y, oracle));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tSwap." << endl;
+        {
+            StringMap mY(X, &ta);  const StringMap& Y = mY;
+            StringMap mZ(&ta);     const StringMap& Z = mZ;
+
+            mZ["only"] = "value";
+
+            const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+
+            mY.swap(mZ);
+            ASSERT(numBlocks == ta.numBlocksTotal());
+            ASSERT(matchesOracle(Z, oracle));
+            ASSERT(1 == Y.size());
+            ASSERT("value" == Y.find("only")->second);
+
+            swap(mY, mZ);
+            ASSERT(numBlocks == ta.numBlocksTotal());
+            ASSERT(matchesOracle(Y, oracle));
+            ASSERT(1 == Z.size());
+
+            StringMap mW(&oa);  const StringMap& W = mW;
+
+            swap(mY, mW);                             // different allocator
+            ASSERT(&ta == Y.allocator());
+            ASSERT(&oa == W.allocator());
+            ASSERT(matchesOracle(W, oracle));
+            ASSERT(Y.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tEquality." << endl;
+        {
+            IntMap mY(&ta);      const IntMap& Y = mY;
+            IntMap mZ(500, &ta); const IntMap& Z = mZ;
+
+            ASSERT(Y == Z);
+
+            for (int i = 0; i < 50; ++i) {
+                mY[i]      = i * i;
+                mZ[49 - i] = (49 - i) * (49 - i);
+            }
+            ASSERT(Y.capacity() != Z.capacity());
+            ASSERT(Y == Z);
+            ASSERT(Z == Y);
+
+            mZ[7] = 0;
+            ASSERT(Y != Z);
+            ASSERT(Z != Y);
+
+            mZ.erase(7);
+            ASSERT(Y != Z);
+
+            mZ[7] = 49;
+            ASSERT(Y == Z);
+
+            mZ[50] = 0;
+            ASSERT(Y != Z);
+            ASSERT(Z != Y);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RANGES, REHASH, AND RESERVE
+        //
+        // Concerns:
+        //: 1 Constructing from and inserting a range keeps the first element
+        //:   having each key.
+        //:
+        //: 2 Erasing a range removes exactly its elements and returns an
+        //:   iterator referring to the element following it.
+        //:
+        //: 3 'reserve' ensures that the map can hold the number of elements
+        //:   requested without allocating, and 'rehash' preserves the value of
+        //:   the map, releasing its memory if it is empty and 0 is requested.
+        //:
+        //: 4 'load_factor' is the ratio of the size of the map to the number
+        //:   of its slots, and never exceeds 'max_load_factor'.
+        //
+        // Plan:
+        //: 1 Construct maps from arrays and initializer lists having repeated
+        //:   keys, and insert ranges into them.  (C-1)
+        //:
+        //: 2 Erase ranges of several lengths from a map, verifying the result
+        //:   against an oracle.  (C-2)
+        //:
+        //: 3 Reserve space, then insert up to the capacity reported, checking
+        //:   the allocator's counters, and rehash maps to several capacities.
+        //:   (C-3..4)
+        //
+        // Testing:
+        //   FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, Allocator *);
+        //   FlatHashMap(initializer_list<value_type> values, Allocator *);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numElements);
+        //   float load_factor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RANGES, REHASH, AND RESERVE" << endl
+                          << "===========================" << endl;
+
+        typedef IntMap::value_type Value;
+
+        if (verbose) cout << "\tRange construction and insertion." << endl;
+        {
+            const Value VALUES[] = {
+                Value(1, 10), Value(2, 20), Value(1, 11), Value(3, 30),
+                Value(2, 21), Value(4, 40)
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            IntMap mX(VALUES, VALUES + NUM_VALUES, &ta);
+            const IntMap& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(4  == X.size());
+            ASSERT(10 == X.find(1)->second);
+            ASSERT(20 == X.find(2)->second);
+
+            const Value MORE[] = { Value(4, 41), Value(5, 50), Value(5, 51) };
+
+            mX.insert(MORE, MORE + 3);
+            ASSERT(5  == X.size());
+            ASSERT(40 == X.find(4)->second);
+            ASSERT(50 == X.find(5)->second);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            IntMap mY({ Value(1, 10), Value(1, 11), Value(2, 20) }, &ta);
+            const IntMap& Y = mY;
+
+            ASSERT(2  == Y.size());
+            ASSERT(10 == Y.find(1)->second);
+#endif
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tRange erasure." << endl;
+        {
+            for (int length = 0; length < 20; ++length) {
+                bsl::map<int, int> oracle(&ta);
+                IntMap             mX(&ta);  const IntMap& X = mX;
+
+                for (int i = 0; i < 40; ++i) {
+                    mX[i * 11]     = i;
+                    oracle[i * 11] = i;
+                }
+
+                IntMap::const_iterator first = X.begin();
+                for (int i = 0; i < 5; ++i) {
+                    ++first;
+                }
+                IntMap::const_iterator last = first;
+                for (int i = 0; i < length; ++i) {
+                    oracle.erase(last->first);
+                    ++last;
+                }
+                const int lastKey = last->first;
+
+                IntMap::iterator result = mX.erase(first, last);
+
+                ASSERTV(length, matchesOracle(X, oracle));
+                ASSERTV(length, lastKey == result->first);
+            }
+
+            IntMap mX(&ta);  const IntMap& X = mX;
+
+            for (int i = 0; i < 40; ++i) {
+                mX[i] = i;
+            }
+            ASSERT(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tReserve and rehash." << endl;
+        {
+            for (int n = 0; n < 300; n += 7) {
+                IntMap mX(&ta);  const IntMap& X = mX;
+
+                mX.reserve(n);
+                ASSERTV(n, static_cast<bsl::size_t>(n) <= X.capacity());
+
+                const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+                const bsl::size_t capacity  = X.capacity();
+
+                for (bsl::size_t i = 0; i < capacity; ++i) {
+                    mX[static_cast<int>(i)] = 1;
+                    ASSERTV(n, i, X.load_factor() <= X.max_load_factor());
+                }
+                ASSERTV(n, numBlocks == ta.numBlocksTotal());
+                ASSERTV(n, capacity  == X.capacity());
+
+                mX.rehash(4 * capacity);
+                ASSERTV(n, 3 * capacity <= X.capacity());
+                ASSERTV(n, capacity == X.size());
+                for (bsl::size_t i = 0; i < capacity; ++i) {
+                    ASSERTV(n, i, X.contains(static_cast<int>(i)));
+                }
+                ASSERTV(n, X.load_factor() < 0.25f);
+
+                mX.clear();
+                mX.rehash(0);
+                ASSERTV(n, 0    == X.capacity());
+                ASSERTV(n, 0.0f == X.load_factor());
+                ASSERTV(n, 0    == ta.numBlocksInUse());
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERTION, LOOKUP, AND REMOVAL
+        //
+        // Concerns:
+        //: 1 The map holds exactly the elements inserted and not removed, on
+        //:   any sequence of insertions and removals, and finds each of them.
+        //:
+        //: 2 'operator[]' inserts a default-constructed value, using the
+        //:   allocator of the map, only if the key is not present.
+        //:
+        //: 3 'insert' does not replace the value of an existing key, and
+        //:   returns an iterator referring to the element having the key.
+        //:
+        //: 4 Erasing by position returns an iterator referring to the next
+        //:   element, so that a map can be filtered in one pass.
+        //:
+        //: 5 The elements of the map use the allocator of the map.
+        //
+        // Plan:
+        //: 1 Apply pseudo-random sequences of insertions (by 'insert' and by
+        //:   'operator[]') and removals (by key and by position) to maps of
+        //:   'int' and of 'bsl::string', and to a 'bsl::map' oracle,
+        //:   verifying that they agree.  (C-1..3, 5)
+        //:
+        //: 2 Erase every other element of a map while iterating.  (C-4)
+        //
+        // Testing:
+        //   VALUE& operator[](const KEY& key);
+        //   iterator begin();
+        //   void clear();
+        //   iterator end();
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(iterator position);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   const_iterator find(const KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERTION, LOOKUP, AND REMOVAL" << endl
+                          << "==============================" << endl;
+
+        if (verbose) cout << "\tRandom operations on strings." << endl;
+        {
+            bsl::map<bsl::string, bsl::string> oracle(&ta);
+            StringMap                          mX(&ta);
+            const StringMap&                   X = mX;
+
+            bsl::uint64_t state = 12345;
+
+            for (int i = 0; i < 4000; ++i) {
+                const bsl::uint64_t r   = nextRandom(&state);
+                const int           k   = static_cast<int>(r % 500);
+                const bsl::string   key = makeString(k);
+
+                switch ((r >> 16) % 4) {
+                  case 0: {
+                    const StringMap::value_type value(key, makeString(i));
+
+                    const bool inserted = oracle.insert(value).second;
+
+                    bsl::pair<StringMap::iterator, bool> result =
+                                                             mX.insert(value);
+                    ASSERTV(i, inserted == result.second);
+                    ASSERTV(i, key == result.first->first);
+                    ASSERTV(i, oracle[key] == result.first->second);
+                  } break;
+                  case 1: {
+                    const bool present = X.contains(key);
+
+                    bsl::string& value = mX[key];
+                    ASSERTV(i, present || value.empty());
+                    ASSERTV(i, &ta == value.get_allocator().mechanism());
+
+                    value          = makeString(i);
+                    oracle[key]    = makeString(i);
+                  } break;
+                  case 2: {
+                    ASSERTV(i, oracle.erase(key) == mX.erase(key));
+                  } break;
+                  default: {
+                    StringMap::iterator it = mX.find(key);
+                    if (it != X.end()) {
+                        mX.erase(it);
+                        oracle.erase(key);
+                    }
+                  } break;
+                }
+                ASSERTV(i, oracle.size() == X.size());
+            }
+            ASSERT(matchesOracle(X, oracle));
+            for (StringMap::const_iterator it = X.begin(); it != X.end();
+                                                                        ++it) {
+                ASSERT(&ta == it->first.get_allocator().mechanism());
+                ASSERT(&ta == it->second.get_allocator().mechanism());
+            }
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.cbegin() == X.cend());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tErasure while iterating." << endl;
+        {
+            IntMap mX(&ta);  const IntMap& X = mX;
+
+            for (int i = 0; i < 1000; ++i) {
+                mX[i] = i;
+            }
+
+            for (IntMap::iterator it = mX.begin(); it != mX.end();) {
+                if (it->first % 2) {
+                    it = mX.erase(it);
+                }
+                else {
+                    it->second = -it->first;
+                    ++it;
+                }
+            }
+            ASSERT(500 == X.size());
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, (i % 2 ? 0 : 1) == X.count(i));
+                ASSERTV(i, i % 2 || -i == X.find(i)->second);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an empty map, using the allocator
+        //:   supplied or the default allocator, and the functors supplied or
+        //:   default-constructed functors.
+        //:
+        //: 2 A map created without a capacity allocates no memory, and a map
+        //:   created with a capacity can hold that many elements.
+        //
+        // Plan:
+        //: 1 Create maps with each constructor, and verify the accessors and
+        //:   the allocators' counters.  (C-1..2)
+        //
+        // Testing:
+        //   FlatHashMap();
+        //   explicit FlatHashMap(bslma::Allocator *basicAllocator);
+        //   explicit FlatHashMap(size_t capacity);
+        //   FlatHashMap(size_t capacity, Allocator *);
+        //   FlatHashMap(size_t capacity, const HASH&, Allocator *);
+        //   FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator *);
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        {
+            IntMap mX;  const IntMap& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        {
+            IntMap mX(&ta);  const IntMap& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksTotal());
+        }
+        {
+            IntMap mX(100);  const IntMap& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(100 <= X.capacity());
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+        {
+            IntMap mX(100, &ta);  const IntMap& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(100 <= X.capacity());
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        {
+            typedef bdlc::FlatHashMap<int,
+                                      int,
+                                      bsl::function<bsl::size_t(int)>,
+                                      bsl::function<bool(int, int)> > FMap;
+
+            const bsl::function<bsl::size_t(int)> HASH  = bsl::hash<int>();
+            const bsl::function<bool(int, int)>   EQUAL =
+                                                         bsl::equal_to<int>();
+
+            FMap mX(10, HASH, &ta);  const FMap& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(10 <= X.capacity());
+            ASSERT(X.hash_function());
+            ASSERT(!X.key_eq());
+
+            FMap mY(10, HASH, EQUAL, &ta);  const FMap& Y = mY;
+
+            ASSERT(Y.hash_function());
+            ASSERT(Y.key_eq());
+            ASSERT(Y.key_eq()(3, 3));
+            ASSERT(!Y.key_eq()(3, 4));
+            ASSERT(Y.hash_function()(3) == bsl::hash<int>()(3));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, iterate over, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        IntMap mX(&ta);  const IntMap& X = mX;
+
+        ASSERT(X.empty());
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERTV(i, mX.insert(IntMap::value_type(i, i * i)).second);
+            ASSERTV(i, !mX.insert(IntMap::value_type(i, 0)).second);
+        }
+        ASSERT(100 == X.size());
+
+        int sum = 0;
+        for (IntMap::const_iterator it = X.begin(); it != X.end(); ++it) {
+            ASSERT(it->first * it->first == it->second);
+            sum += it->first;
+        }
+        ASSERT(99 * 100 / 2 == sum);
+
+        mX[1000] = 7;
+        ASSERT(101 == X.size());
+        ASSERT(7   == X.find(1000)->second);
+
+        for (int i = 0; i < 100; i += 2) {
+            ASSERTV(i, 1 == mX.erase(i));
+            ASSERTV(i, 0 == mX.erase(i));
+        }
+        ASSERT(51 == X.size());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'bsl::unordered_map'
+        //
+        // Concerns:
+        //: 1 Insertion, lookup, iteration, and rehashing of a large map are
+        //:   faster than those of a 'bsl::unordered_map' of the same size, and
+        //:   the longest pause caused by a single rehash is shorter.
+        //
+        // Plan:
+        //: 1 Time, using 'bsls::Stopwatch', the insertion of 'N' pseudo-random
+        //:   keys (recording the longest single insertion), successful and
+        //:   unsuccessful lookups, a full iteration, and a rehash doubling the
+        //:   number of buckets, for each container.  'N' is one million, or
+        //:   ten million in very verbose mode.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'bsl::unordered_map'
+        // --------------------------------------------------------------------
+
+        if (verbose) {
+            cout << endl
+                 << "PERFORMANCE: COMPARISON WITH 'bsl::unordered_map'\n"
+                 << "=================================================\n";
+        }
+
+        const int N = veryVerbose ? 10000000 : 1000000;
+
+        bsl::vector<bsl::uint64_t> keys(N);
+        bsl::uint64_t              state = 42;
+        for (int i = 0; i < N; ++i) {
+            keys[i] = nextRandom(&state);
+        }
+
+        typedef bdlc::FlatHashMap<bsl::uint64_t, bsl::uint64_t> FlatMap;
+        typedef bsl::unordered_map<bsl::uint64_t, bsl::uint64_t> NodeMap;
+
+        FlatMap flat;
+        NodeMap node;
+
+        bsls::Stopwatch sw;
+        bsls::Stopwatch pause;
+        double          flatInsert, nodeInsert;
+        double          flatPause = 0.0, nodePause = 0.0;
+
+        sw.start(true);
+        for (int i = 0; i < N; ++i) {
+            pause.start(true);
+            flat[keys[i]] = i;
+            pause.stop();
+            if (pause.accumulatedWallTime() > flatPause) {
+                flatPause = pause.accumulatedWallTime();
+            }
+            pause.reset();
+        }
+        sw.stop();
+        flatInsert = sw.accumulatedWallTime();
+        sw.reset();
+
+        sw.start(true);
+        for (int i = 0; i < N; ++i) {
+            pause.start(true);
+            node[keys[i]] = i;
+            pause.stop();
+            if (pause.accumulatedWallTime() > nodePause) {
+                nodePause = pause.accumulatedWallTime();
+            }
+            pause.reset();
+        }
+        sw.stop();
+        nodeInsert = sw.accumulatedWallTime();
+        sw.reset();
+
+        bsl::uint64_t checksum = 0;
+        double        flatFind, nodeFind, flatMiss, nodeMiss;
+
+        sw.start(true);
+        for (int i = 0; i < N; ++i) {
+            checksum += flat.find(keys[i])->second;
+        }
+        sw.stop();
+        flatFind = sw.accumulatedWallTime();
+        sw.reset();
+
+        sw.start(true);
+        for (int i = 0; i < N; ++i) {
+            checksum -= node.find(keys[i])->second;
+        }
+        sw.stop();
+        nodeFind = sw.accumulatedWallTime();
+        sw.reset();
+
+        sw.start(true);
+        for (int i = 0; i < N; ++i) {
+            checksum += flat.count(keys[i] + 1);
+        }
+        sw.stop();
+        flatMiss = sw.accumulatedWallTime();
+        sw.reset();
+
+        sw.start(true);
+        for (int i = 0; i < N; ++i) {
+            checksum -= node.count(keys[i] + 1);
+        }
+        sw.stop();
+        nodeMiss = sw.accumulatedWallTime();
+        sw.reset();
+
+        double flatIterate, nodeIterate;
+
+        sw.start(true);
+        for (FlatMap::const_iterator it = flat.begin(); it != flat.end();
+                                                                        ++it) {
+            checksum += it->second;
+        }
+        sw.stop();
+        flatIterate = sw.accumulatedWallTime();
+        sw.reset();
+
+        sw.start(true);
+        for (NodeMap::const_iterator it = node.begin(); it != node.end();
+                                                                        ++it) {
+            checksum -= it->second;
+        }
+        sw.stop();
+        nodeIterate = sw.accumulatedWallTime();
+        sw.reset();
+
+        ASSERT(0 == checksum);
+
+        double flatRehash, nodeRehash;
+
+        sw.start(true);
+        flat.rehash(2 * (flat.capacity() + 1));
+        sw.stop();
+        flatRehash = sw.accumulatedWallTime();
+        sw.reset();
+
+        sw.start(true);
+        node.rehash(2 * node.bucket_count());
+        sw.stop();
+        nodeRehash = sw.accumulatedWallTime();
+        sw.reset();
+
+        ASSERT(flat.size() == node.size());
+
+        cout << "N = " << N << " (times in seconds)\n"
+             << "\t\t\tFlatHashMap\tunordered_map\n"
+             << "insert\t\t\t" << flatInsert  << "\t" << nodeInsert  << "\n"
+             << "longest insert\t\t" << flatPause << "\t" << nodePause << "\n"
+             << "find (hit)\t\t" << flatFind  << "\t" << nodeFind    << "\n"
+             << "find (miss)\t\t" << flatMiss << "\t" << nodeMiss    << "\n"
+             << "iterate\t\t\t" << flatIterate << "\t" << nodeIterate << "\n"
+             << "rehash\t\t\t" << flatRehash  << "\t" << nodeRehash  << "\n";
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,786 @@
+// bdlc_flathashset.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHSET
+#define INCLUDED_BDLC_FLATHASHSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressing unordered set with contiguous storage.
+//
+//@CLASSES:
+//  bdlc::FlatHashSet: open-addressing unordered set
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashtable, bslstl_unorderedset
+//
+//@DESCRIPTION: This component provides a value-semantic class template,
+// 'bdlc::FlatHashSet', implementing an unordered set of unique keys, whose
+// interface is a subset of that of 'bsl::unordered_set'.  A 'FlatHashSet'
+// holds its elements in a single array of slots, using open addressing,
+// alongside an array of one-byte control values, each holding 7 bits of the
+// hash value of the element in its slot (see 'bdlc_flathashtable').  The
+// trade-offs with respect to 'bsl::unordered_set' are those described for
+// 'bdlc::FlatHashMap' in 'bdlc_flathashmap': lookups and iteration touch
+// fewer cache lines, and inserting elements allocates memory only when the
+// set is rehashed, but inserting an element may move the elements of the set,
+// invalidating all references, pointers, and iterators to them.
+//
+// The hash functor and equality functor of a set must not throw.  The hash
+// value of each element is mixed before use, so that the identity hash
+// functions provided by 'bsl::hash' for integral types are suitable.
+//
+///Thread Safety
+///-------------
+// 'bdlc::FlatHashSet' is *const* *thread-safe*: distinct threads may call
+// 'const' methods on the same object concurrently, but no thread may modify
+// an object while another thread accesses it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicate Trade Identifiers
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a trade feed may deliver a trade more than once, and we want to
+// process each trade only once, identifying trades by their 64-bit
+// identifiers.
+//
+// First, we create a set of the identifiers of the trades already processed:
+//..
+//  bdlc::FlatHashSet<bsls::Types::Int64> processed;
+//..
+// Then, we process a sequence of trades, some of which are delivered again:
+//..
+//  const bsls::Types::Int64 trades[] = { 1001, 1002, 1001, 1003, 1002, 1004 };
+//  const int                numTrades = sizeof trades / sizeof *trades;
+//
+//  int numProcessed = 0;
+//  for (int i = 0; i < numTrades; ++i) {
+//      if (processed.insert(trades[i]).second) {
+//          ++numProcessed;                       // process the trade here
+//      }
+//  }
+//..
+// Now, we observe that each distinct trade was processed once:
+//..
+//  assert(4 == numProcessed);
+//  assert(4 == processed.size());
+//  assert(processed.contains(1003));
+//  assert(!processed.contains(1005));
+//..
+// Finally, once trades up to 1002 are known to be settled and will not be
+// delivered again, we remove them:
+//..
+//  for (bdlc::FlatHashSet<bsls::Types::Int64>::const_iterator it =
+//                                                          processed.begin();
+//       it != processed.end();) {
+//      if (*it <= 1002) {
+//          it = processed.erase(it);
+//      }
+//      else {
+//          ++it;
+//      }
+//  }
+//
+//  assert(2 == processed.size());
+//  assert(processed.contains(1004));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <initializer_list>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                       // ============================
+                       // struct FlatHashSet_EntryUtil
+                       // ============================
+
+template <class KEY>
+struct FlatHashSet_EntryUtil {
+    // This component-private 'struct' provides a namespace for obtaining the
+    // key of an element of a 'FlatHashSet'.
+
+    // CLASS METHODS
+    static const KEY& key(const KEY& entry);
+        // Return the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashSet
+                            // =================
+
+template <class KEY,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashSet {
+    // This class template implements a value-semantic unordered set of unique
+    // elements of the (template parameter) type 'KEY', hashed by the
+    // (template parameter) type 'HASH' and compared by the (template
+    // parameter) type 'EQUAL', holding its elements in a single array of
+    // slots.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          KEY,
+                          FlatHashSet_EntryUtil<KEY>,
+                          HASH,
+                          EQUAL>                     ImplType;
+
+    typedef bslmf::MovableRefUtil                    MoveUtil;
+
+    // DATA
+    ImplType d_impl;  // underlying table
+
+    // FRIENDS
+    template <class K, class H, class E>
+    friend bool operator==(const FlatHashSet<K, H, E>&,
+                           const FlatHashSet<K, H, E>&);
+
+  public:
+    // TYPES
+    typedef KEY                                      key_type;
+    typedef KEY                                      value_type;
+    typedef bsl::size_t                              size_type;
+    typedef bsl::ptrdiff_t                           difference_type;
+    typedef HASH                                     hasher;
+    typedef EQUAL                                    key_equal;
+    typedef value_type&                              reference;
+    typedef const value_type&                        const_reference;
+    typedef value_type                              *pointer;
+    typedef const value_type                        *const_pointer;
+    typedef FlatHashTable_Iterator<const value_type> iterator;
+    typedef FlatHashTable_Iterator<const value_type> const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashSet, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashSet();
+    explicit FlatHashSet(bslma::Allocator *basicAllocator);
+    explicit FlatHashSet(bsl::size_t capacity);
+    FlatHashSet(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty set.  Optionally specify a 'capacity', the number
+        // of elements the set can hold without rehashing; if 'capacity' is
+        // not specified, the set initially has no slots and allocates no
+        // memory.  Optionally specify a 'hash' functor used to hash elements;
+        // if 'hash' is not specified, a default-constructed 'HASH' is used.
+        // Optionally specify an 'equal' functor used to compare elements; if
+        // 'equal' is not specified, a default-constructed 'EQUAL' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashSet(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a set holding the distinct elements in the specified range
+        // '[first, last)'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '[first, last)' is a valid range of objects convertible to 'KEY'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatHashSet(std::initializer_list<KEY>  values,
+                bslma::Allocator           *basicAllocator = 0);
+        // Create a set holding the distinct elements of the specified
+        // 'values'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+#endif
+
+    FlatHashSet(const FlatHashSet&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a set having the same value, hash functor, and equality
+        // functor as the specified 'original' set.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    FlatHashSet(bslmf::MovableRef<FlatHashSet> original);           // IMPLICIT
+        // Create a set having the same value, functors, and allocator as the
+        // specified 'original' set, by taking ownership of its slots.
+        // 'original' is left empty, with no slots.
+
+    FlatHashSet(bslmf::MovableRef<FlatHashSet>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a set having the same value and functors as the specified
+        // 'original' set, using the specified 'basicAllocator' to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  If 'original' uses 'basicAllocator', take
+        // ownership of its slots, leaving it empty with no slots; otherwise,
+        // move its elements, leaving them in a valid but unspecified state.
+
+    //! ~FlatHashSet() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashSet& operator=(const FlatHashSet& rhs);
+        // Assign to this set the value and functors of the specified 'rhs'
+        // set, and return a reference providing modifiable access to this
+        // set.
+
+    FlatHashSet& operator=(bslmf::MovableRef<FlatHashSet> rhs);
+        // Assign to this set the value and functors of the specified 'rhs'
+        // set, and return a reference providing modifiable access to this
+        // set.  If 'rhs' uses the allocator of this set, exchange the slots of
+        // the two sets; otherwise, move the elements of 'rhs', leaving them in
+        // a valid but unspecified state.
+
+    void clear();
+        // Remove all elements from this set, leaving its capacity unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the element equal to the specified 'key' from this set, if
+        // any.  Return the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove the element referred to by the specified 'position' from this
+        // set, and return an iterator referring to the element following it,
+        // or 'end()' if there is no such element.  The behavior is undefined
+        // unless 'position' refers to an element of this set.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the elements in the specified range '[first, last)' from
+        // this set, and return 'last'.  The behavior is undefined unless
+        // '[first, last)' is a valid range of elements of this set.
+
+    bsl::pair<iterator, bool> insert(const KEY& value);
+        // Insert a copy of the specified 'value' into this set if it has no
+        // element equal to 'value'.  Return a pair whose first member refers
+        // to the element of this set equal to 'value', and whose second member
+        // is 'true' if 'value' was inserted, and 'false' otherwise.  Note that
+        // inserting an element invalidates all references, pointers, and
+        // iterators to the elements of this set.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the elements in the specified range
+        // '[first, last)' not already present in this set or earlier in the
+        // range.  The behavior is undefined unless '[first, last)' is a valid
+        // range of objects convertible to 'KEY', none of which is an element
+        // of this set.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Rehash this set into an array of slots able to hold its elements,
+        // having no fewer than the specified 'minimumCapacity' slots,
+        // reclaiming the slots of erased elements.  If this set is empty and
+        // '0 == minimumCapacity', release its slots instead.
+
+    void reserve(bsl::size_t numElements);
+        // Increase, if necessary, the capacity of this set so that it can hold
+        // the specified 'numElements' without rehashing.
+
+    void swap(FlatHashSet& other);
+        // Exchange the value and functors of this set with those of the
+        // specified 'other' set.  This method provides the no-throw
+        // exception-safety guarantee.  The behavior is undefined unless this
+        // set and 'other' use the same allocator.
+
+    // ACCESSORS
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this set, or
+        // 'end()' if this set is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements this set can hold without rehashing.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator referring to the end of this set.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set has an element equal to the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements of this set equal to the specified
+        // 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this set has no elements, and 'false' otherwise.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element of this set equal to the
+        // specified 'key', or 'end()' if there is no such element.
+
+    HASH hash_function() const;
+        // Return the hash functor of this set.
+
+    EQUAL key_eq() const;
+        // Return the equality functor of this set.
+
+    float load_factor() const;
+        // Return the ratio of the number of elements of this set to the number
+        // of its slots, or 0 if it has no slots.
+
+    float max_load_factor() const;
+        // Return the maximum ratio of the number of elements of this set
+        // (including erased elements whose slots have not been reclaimed) to
+        // the number of its slots.  Note that this value is always 0.875.
+
+    bsl::size_t size() const;
+        // Return the number of elements of this set.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+bool operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets have the same value,
+    // and 'false' otherwise.  Two sets have the same value if they have the
+    // same number of elements, and for each element of 'lhs' there is an
+    // element of 'rhs' that is equal to it using both 'EQUAL' and
+    // 'operator=='.
+
+template <class KEY, class HASH, class EQUAL>
+bool operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets do not have the same
+    // value, and 'false' otherwise.  Two sets do not have the same value if
+    // they have a different number of elements, or for some element of 'lhs'
+    // there is no element of 'rhs' that is equal to it using both 'EQUAL' and
+    // 'operator=='.
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+void swap(FlatHashSet<KEY, HASH, EQUAL>& a, FlatHashSet<KEY, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' sets.  If 'a' and 'b'
+    // use the same allocator, this operation provides the no-throw
+    // exception-safety guarantee; otherwise, it provides the basic guarantee.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // struct FlatHashSet_EntryUtil
+                       // ----------------------------
+
+// CLASS METHODS
+template <class KEY>
+inline
+const KEY& FlatHashSet_EntryUtil<KEY>::key(const KEY& entry)
+{
+    return entry;
+}
+
+                            // -----------------
+                            // class FlatHashSet
+                            // -----------------
+
+// CREATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet()
+: d_impl(0, HASH(), EQUAL(), 0)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL(), 0)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           const EQUAL&      equal,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                std::initializer_list<KEY>  values,
+                                bslma::Allocator           *basicAllocator)
+: d_impl(values.size(), HASH(), EQUAL(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                          const FlatHashSet&  original,
+                                          bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                       bslmf::MovableRef<FlatHashSet> original)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                              bslmf::MovableRef<FlatHashSet>  original,
+                              bslma::Allocator               *basicAllocator)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl), basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>&
+FlatHashSet<KEY, HASH, EQUAL>::operator=(const FlatHashSet& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>&
+FlatHashSet<KEY, HASH, EQUAL>::operator=(bslmf::MovableRef<FlatHashSet> rhs)
+{
+    d_impl = MoveUtil::move(MoveUtil::access(rhs).d_impl);
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::erase(const KEY& key)
+{
+    const bsl::size_t index = d_impl.find(key);
+
+    if (index == d_impl.capacity()) {
+        return 0;                                                     // RETURN
+    }
+    d_impl.erase(index);
+    return 1;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator position)
+{
+    BSLS_ASSERT(position != end());
+
+    const bsl::size_t index = &*position - d_impl.entries();
+
+    d_impl.erase(index);
+    return static_cast<const ImplType&>(d_impl).iteratorAt(index);
+}
+
+template <class KEY, class HASH, class EQUAL>
+typename FlatHashSet<KEY, HASH, EQUAL>::iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator first, const_iterator last)
+{
+    while (first != last) {
+        first = erase(first);
+    }
+    return last;
+}
+
+template <class KEY, class HASH, class EQUAL>
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(const KEY& value)
+{
+    bool              found;
+    bsl::uint64_t     hash;
+    const bsl::size_t index = d_impl.findOrPrepareInsert(&found, &hash, value);
+
+    if (!found) {
+        bslma::ConstructionUtil::construct(d_impl.entries() + index,
+                                           d_impl.allocator(),
+                                           value);
+        d_impl.commitInsert(index, hash);
+    }
+    return bsl::pair<iterator, bool>(
+                        static_cast<const ImplType&>(d_impl).iteratorAt(index),
+                        !found);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+void FlatHashSet<KEY, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                           INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        insert(*first);
+    }
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::reserve(bsl::size_t numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::swap(FlatHashSet& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::capacity() const
+{
+    return FlatHashTable_ImpUtil::maxLoad(d_impl.capacity());
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.find(key) != d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::count(const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.iteratorAt(d_impl.find(key));
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+HASH FlatHashSet<KEY, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hashFunctor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+EQUAL FlatHashSet<KEY, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.equalityFunctor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.capacity()
+           ? static_cast<float>(d_impl.size())
+                                       / static_cast<float>(d_impl.capacity())
+           : 0.0f;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::max_load_factor() const
+{
+    return 0.875f;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                                  // Aspects
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashSet<KEY, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl.isEqual(rhs.d_impl);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+void bdlc::swap(FlatHashSet<KEY, HASH, EQUAL>& a,
+                FlatHashSet<KEY, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashSet<KEY, HASH, EQUAL> futureA(b, a.allocator());
+    FlatHashSet<KEY, HASH, EQUAL> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
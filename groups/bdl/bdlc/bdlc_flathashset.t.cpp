@@ -0,0 +1,831 @@
+// bdlc_flathashset.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashset.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic unordered set implemented in
+// terms of 'bdlc::FlatHashTable', which is tested thoroughly in its own
+// component.  This test driver therefore concentrates on the forwarding of
+// each method to the table, and on the allocator and value semantics of the
+// set.  The manipulators are verified against a 'bsl::set' oracle on
+// pseudo-random sequences of operations.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashSet();
+// [ 2] explicit FlatHashSet(bslma::Allocator *basicAllocator);
+// [ 2] explicit FlatHashSet(size_t capacity);
+// [ 2] FlatHashSet(size_t capacity, Allocator *);
+// [ 2] FlatHashSet(size_t capacity, const HASH&, Allocator *);
+// [ 2] FlatHashSet(size_t, const HASH&, const EQUAL&, Allocator *);
+// [ 4] FlatHashSet(INPUT_ITERATOR, INPUT_ITERATOR, Allocator *);
+// [ 4] FlatHashSet(initializer_list<KEY> values, Allocator *);
+// [ 5] FlatHashSet(const FlatHashSet& original, Allocator *);
+// [ 5] FlatHashSet(MovableRef<FlatHashSet> original);
+// [ 5] FlatHashSet(MovableRef<FlatHashSet> original, Allocator *);
+//
+// MANIPULATORS
+// [ 5] FlatHashSet& operator=(const FlatHashSet& rhs);
+// [ 5] FlatHashSet& operator=(MovableRef<FlatHashSet> rhs);
+// [ 3] void clear();
+// [ 3] size_t erase(const KEY& key);
+// [ 3] iterator erase(const_iterator position);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 3] pair<iterator, bool> insert(const KEY& value);
+// [ 4] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 4] void rehash(size_t minimumCapacity);
+// [ 4] void reserve(size_t numElements);
+// [ 5] void swap(FlatHashSet& other);
+//
+// ACCESSORS
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 2] size_t capacity() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 4] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const FlatHashSet& lhs, const FlatHashSet& rhs);
+// [ 5] bool operator!=(const FlatHashSet& lhs, const FlatHashSet& rhs);
+//
+// FREE FUNCTIONS
+// [ 5] void swap(FlatHashSet& a, FlatHashSet& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashSet<int>         IntSet;
+typedef bdlc::FlatHashSet<bsl::string> StringSet;
+typedef bslmf::MovableRefUtil          MoveUtil;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::uint64_t nextRandom(bsl::uint64_t *state)
+    // Advance the specified linear-congruential generator 'state' and return
+    // its new value.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state ^ (*state >> 29);
+}
+
+bsl::string makeString(int value)
+    // Return a string, too long for the short-string buffer, whose value is
+    // determined by the specified 'value'.
+{
+    bsl::string result("a string long enough to allocate memory: ");
+    for (int i = 0; i < 8; ++i) {
+        result.push_back(static_cast<char>('0' + value % 10));
+        value /= 10;
+    }
+    return result;
+}
+
+template <class SET, class KEY>
+bool matchesOracle(const SET& set, const bsl::set<KEY>& oracle)
+    // Return 'true' if the specified 'set' holds exactly the elements of the
+    // specified 'oracle', each exactly once, and 'false' otherwise.
+{
+    if (set.size() != oracle.size() || set.empty() != oracle.empty()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::size_t count = 0;
+    for (typename SET::const_iterator it = set.begin();
+         it != set.end();
+         ++it) {
+        if (0 == oracle.count(*it)) {
+            return false;                                             // RETURN
+        }
+        ++count;
+    }
+    if (count != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (typename bsl::set<KEY>::const_iterator it = oracle.begin();
+         it != oracle.end();
+         ++it) {
+        typename SET::const_iterator found = set.find(*it);
+        if (found == set.end()
+         || !(*found == *it)
+         || !set.contains(*it)
+         || 1 != set.count(*it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicate Trade Identifiers
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a trade feed may deliver a trade more than once, and we want to
+// process each trade only once, identifying trades by their 64-bit
+// identifiers.
+//
+// First, we create a set of the identifiers of the trades already processed:
+//..
+    bdlc::FlatHashSet<bsls::Types::Int64> processed;
+//..
+// Then, we process a sequence of trades, some of which are delivered again:
+//..
+    const bsls::Types::Int64 trades[] = { 1001, 1002, 1001, 1003, 1002, 1004 };
+    const int                numTrades = sizeof trades / sizeof *trades;
+
+    int numProcessed = 0;
+    for (int i = 0; i < numTrades; ++i) {
+        if (processed.insert(trades[i]).second) {
+            ++numProcessed;                       // process the trade here
+        }
+    }
+//..
+// Now, we observe that each distinct trade was processed once:
+//..
+    ASSERT(4 == numProcessed);
+    ASSERT(4 == processed.size());
+    ASSERT(processed.contains(1003));
+    ASSERT(!processed.contains(1005));
+//..
+// Finally, once trades up to 1002 are known to be settled and will not be
+// delivered again, we remove them:
+//..
+    for (bdlc::FlatHashSet<bsls::Types::Int64>::const_iterator it =
+                                                            processed.begin();
+         it != processed.end();) {
+        if (*it <= 1002) {
+            it = processed.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    ASSERT(2 == processed.size());
+    ASSERT(processed.contains(1004));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original and uses the allocator
+        //:   supplied.
+        //:
+        //: 2 Moving with the same allocator does not allocate, and leaves the
+        //:   original empty; moving with a different allocator moves the
+        //:   elements into memory obtained from the allocator supplied.
+        //:
+        //: 3 Assignment and the member and free 'swap' exchange values,
+        //:   including between sets using different allocators for the free
+        //:   'swap'.
+        //:
+        //: 4 Two sets are equal if and only if they have the same elements,
+        //:   regardless of their capacities and of the order in which the
+        //:   elements were inserted.
+        //
+        // Plan:
+        //: 1 Build a set of strings, copy, move, assign, and swap it using two
+        //:   test allocators, verifying the results against an oracle and the
+        //:   allocators' counters.  (C-1..3)
+        //:
+        //: 2 Compare sets built in different orders and with different
+        //:   capacities.  (C-4)
+        //
+        // Testing:
+        //   FlatHashSet(const FlatHashSet& original, Allocator *);
+        //   FlatHashSet(MovableRef<FlatHashSet> original);
+        //   FlatHashSet(MovableRef<FlatHashSet> original, Allocator *);
+        //   FlatHashSet& operator=(const FlatHashSet& rhs);
+        //   FlatHashSet& operator=(MovableRef<FlatHashSet> rhs);
+        //   void swap(FlatHashSet& other);
+        //   bool operator==(const FlatHashSet& lhs, const FlatHashSet& rhs);
+        //   bool operator!=(const FlatHashSet& lhs, const FlatHashSet& rhs);
+        //   void swap(FlatHashSet& a, FlatHashSet& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND EQUALITY" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator oa("other", veryVeryVerbose);
+
+        bsl::set<bsl::string> oracle(&ta);
+
+        StringSet mX(&ta);  const StringSet& X = mX;
+
+        for (int i = 0; i < 100; ++i) {
+            mX.insert(makeString(i));
+            oracle.insert(makeString(i));
+        }
+        ASSERT(matchesOracle(X, oracle));
+
+        if (verbose) cout << "\tCopy and move construction." << endl;
+        {
+            StringSet mY(X, &oa);  const StringSet& Y = mY;
+
+            ASSERT(&oa == Y.allocator());
+            ASSERT(matchesOracle(Y, oracle));
+            ASSERT(X == Y);
+            ASSERT(!(X != Y));
+
+            const bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+
+            StringSet mZ(MoveUtil::move(mY));  const StringSet& Z = mZ;
+
+            ASSERT(numBlocks == oa.numBlocksTotal());
+            ASSERT(&oa == Z.allocator());
+            ASSERT(matchesOracle(Z, oracle));
+            ASSERT(Y.empty());
+            ASSERT(0 == Y.capacity());
+
+            StringSet mW(MoveUtil::move(mZ), &ta);  const StringSet& W = mW;
+
+            ASSERT(&ta == W.allocator());
+            ASSERT(matchesOracle(W, oracle));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tAssignment." << endl;
+        {
+            StringSet mY(&oa);  const StringSet& Y = mY;
+
+            mY.insert("only");
+
+            mY = X;
+            ASSERT(&oa == Y.allocator());
+            ASSERT(matchesOracle(Y, oracle));
+
+            mY = Y;
+            ASSERT(matchesOracle(Y, oracle));
+
+            StringSet mZ(&oa);  const StringSet& Z = mZ;
+
+            const bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+
+            mZ = MoveUtil::move(mY);
+            ASSERT(numBlocks == oa.numBlocksTotal());
+            ASSERT(matchesOracle(Z, oracle));
+
+            StringSet mW(X, &ta);
+
+            mY = MoveUtil::move(mW);                  // different allocator
+            ASSERT(&oa == Y.allocator());
+            ASSERT(matchesOracle(Y, oracle));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tSwap." << endl;
+        {
+            StringSet mY(X, &ta);  const StringSet& Y = mY;
+            StringSet mZ(&ta);     const StringSet& Z = mZ;
+
+            mZ.insert("only");
+
+            const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+
+            mY.swap(mZ);
+            ASSERT(numBlocks == ta.numBlocksTotal());
+            ASSERT(matchesOracle(Z, oracle));
+            ASSERT(1 == Y.size());
+            ASSERT(Y.contains("only"));
+
+            swap(mY, mZ);
+            ASSERT(numBlocks == ta.numBlocksTotal());
+            ASSERT(matchesOracle(Y, oracle));
+
+            StringSet mW(&oa);  const StringSet& W = mW;
+
+            swap(mY, mW);                             // different allocator
+            ASSERT(&ta == Y.allocator());
+            ASSERT(&oa == W.allocator());
+            ASSERT(matchesOracle(W, oracle));
+            ASSERT(Y.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tEquality." << endl;
+        {
+            IntSet mY(&ta);      const IntSet& Y = mY;
+            IntSet mZ(500, &ta); const IntSet& Z = mZ;
+
+            ASSERT(Y == Z);
+
+            for (int i = 0; i < 50; ++i) {
+                mY.insert(i);
+                mZ.insert(49 - i);
+            }
+            ASSERT(Y.capacity() != Z.capacity());
+            ASSERT(Y == Z);
+
+            mZ.erase(7);
+            ASSERT(Y != Z);
+            ASSERT(Z != Y);
+
+            mZ.insert(50);
+            ASSERT(Y != Z);
+
+            mZ.erase(50);
+            mZ.insert(7);
+            ASSERT(Y == Z);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RANGES, REHASH, AND RESERVE
+        //
+        // Concerns:
+        //: 1 Constructing from and inserting a range keeps one copy of each
+        //:   distinct element.
+        //:
+        //: 2 Erasing a range removes exactly its elements.
+        //:
+        //: 3 'reserve' ensures that the set can hold the number of elements
+        //:   requested without allocating, and 'rehash' preserves the value of
+        //:   the set, releasing its memory if it is empty and 0 is requested.
+        //:
+        //: 4 'load_factor' never exceeds 'max_load_factor'.
+        //
+        // Plan:
+        //: 1 Construct sets from arrays and initializer lists having repeated
+        //:   elements, and insert ranges into them.  (C-1)
+        //:
+        //: 2 Erase ranges of several lengths from a set, verifying the result
+        //:   against an oracle.  (C-2)
+        //:
+        //: 3 Reserve space, then insert up to the capacity reported, checking
+        //:   the allocator's counters, and rehash sets to several capacities.
+        //:   (C-3..4)
+        //
+        // Testing:
+        //   FlatHashSet(INPUT_ITERATOR, INPUT_ITERATOR, Allocator *);
+        //   FlatHashSet(initializer_list<KEY> values, Allocator *);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numElements);
+        //   float load_factor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RANGES, REHASH, AND RESERVE" << endl
+                          << "===========================" << endl;
+
+        if (verbose) cout << "\tRange construction and insertion." << endl;
+        {
+            const int VALUES[]   = { 1, 2, 1, 3, 2, 4 };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            IntSet mX(VALUES, VALUES + NUM_VALUES, &ta);  const IntSet& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(4 == X.size());
+
+            const int MORE[] = { 4, 5, 5 };
+
+            mX.insert(MORE, MORE + 3);
+            ASSERT(5 == X.size());
+            ASSERT(X.contains(5));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            IntSet mY({ 1, 1, 2 }, &ta);  const IntSet& Y = mY;
+
+            ASSERT(2 == Y.size());
+            ASSERT(Y.contains(1));
+            ASSERT(Y.contains(2));
+#endif
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tRange erasure." << endl;
+        {
+            for (int length = 0; length < 20; ++length) {
+                bsl::set<int> oracle(&ta);
+                IntSet        mX(&ta);  const IntSet& X = mX;
+
+                for (int i = 0; i < 40; ++i) {
+                    mX.insert(i * 11);
+                    oracle.insert(i * 11);
+                }
+
+                IntSet::const_iterator first = X.begin();
+                for (int i = 0; i < 5; ++i) {
+                    ++first;
+                }
+                IntSet::const_iterator last = first;
+                for (int i = 0; i < length; ++i) {
+                    oracle.erase(*last);
+                    ++last;
+                }
+                const int lastKey = *last;
+
+                IntSet::const_iterator result = mX.erase(first, last);
+
+                ASSERTV(length, matchesOracle(X, oracle));
+                ASSERTV(length, lastKey == *result);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tReserve and rehash." << endl;
+        {
+            for (int n = 0; n < 300; n += 7) {
+                IntSet mX(&ta);  const IntSet& X = mX;
+
+                mX.reserve(n);
+                ASSERTV(n, static_cast<bsl::size_t>(n) <= X.capacity());
+
+                const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+                const bsl::size_t capacity  = X.capacity();
+
+                for (bsl::size_t i = 0; i < capacity; ++i) {
+                    mX.insert(static_cast<int>(i));
+                    ASSERTV(n, i, X.load_factor() <= X.max_load_factor());
+                }
+                ASSERTV(n, numBlocks == ta.numBlocksTotal());
+                ASSERTV(n, capacity  == X.capacity());
+
+                mX.rehash(4 * capacity);
+                ASSERTV(n, 3 * capacity <= X.capacity());
+                ASSERTV(n, capacity == X.size());
+
+                mX.clear();
+                mX.rehash(0);
+                ASSERTV(n, 0 == X.capacity());
+                ASSERTV(n, 0 == ta.numBlocksInUse());
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERTION, LOOKUP, AND REMOVAL
+        //
+        // Concerns:
+        //: 1 The set holds exactly the elements inserted and not removed, on
+        //:   any sequence of insertions and removals, and finds each of them.
+        //:
+        //: 2 'insert' returns an iterator referring to the element equal to
+        //:   the value inserted, whether or not it was already present.
+        //:
+        //: 3 The elements of the set use the allocator of the set.
+        //
+        // Plan:
+        //: 1 Apply pseudo-random sequences of insertions and removals (by key
+        //:   and by position) to a set of 'bsl::string' and to a 'bsl::set'
+        //:   oracle, verifying that they agree.  (C-1..3)
+        //
+        // Testing:
+        //   void clear();
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   pair<iterator, bool> insert(const KEY& value);
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   const_iterator find(const KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERTION, LOOKUP, AND REMOVAL" << endl
+                          << "==============================" << endl;
+
+        bsl::set<bsl::string> oracle(&ta);
+        StringSet             mX(&ta);  const StringSet& X = mX;
+
+        bsl::uint64_t state = 54321;
+
+        for (int i = 0; i < 4000; ++i) {
+            const bsl::uint64_t r   = nextRandom(&state);
+            const bsl::string   key = makeString(static_cast<int>(r % 500));
+
+            switch ((r >> 16) % 3) {
+              case 0: {
+                const bool inserted = oracle.insert(key).second;
+
+                bsl::pair<StringSet::iterator, bool> result = mX.insert(key);
+                ASSERTV(i, inserted == result.second);
+                ASSERTV(i, key == *result.first);
+              } break;
+              case 1: {
+                ASSERTV(i, oracle.erase(key) == mX.erase(key));
+              } break;
+              default: {
+                StringSet::const_iterator it = X.find(key);
+                if (it != X.end()) {
+                    mX.erase(it);
+                    oracle.erase(key);
+                }
+              } break;
+            }
+            ASSERTV(i, oracle.size() == X.size());
+        }
+        ASSERT(matchesOracle(X, oracle));
+        for (StringSet::const_iterator it = X.begin(); it != X.end(); ++it) {
+            ASSERT(&ta == it->get_allocator().mechanism());
+        }
+
+        mX.clear();
+        ASSERT(X.empty());
+        ASSERT(X.begin() == X.end());
+        ASSERT(X.cbegin() == X.cend());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an empty set, using the allocator
+        //:   supplied or the default allocator.
+        //:
+        //: 2 A set created without a capacity allocates no memory, and a set
+        //:   created with a capacity can hold that many elements.
+        //
+        // Plan:
+        //: 1 Create sets with each constructor, and verify the accessors and
+        //:   the allocators' counters.  (C-1..2)
+        //
+        // Testing:
+        //   FlatHashSet();
+        //   explicit FlatHashSet(bslma::Allocator *basicAllocator);
+        //   explicit FlatHashSet(size_t capacity);
+        //   FlatHashSet(size_t capacity, Allocator *);
+        //   FlatHashSet(size_t capacity, const HASH&, Allocator *);
+        //   FlatHashSet(size_t, const HASH&, const EQUAL&, Allocator *);
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        {
+            IntSet mX;  const IntSet& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        {
+            IntSet mX(&ta);  const IntSet& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == ta.numBlocksTotal());
+        }
+        {
+            IntSet mX(100);  const IntSet& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(100 <= X.capacity());
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+        {
+            IntSet mX(100, &ta);  const IntSet& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(100 <= X.capacity());
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        {
+            IntSet mX(10, bsl::hash<int>(), &ta);  const IntSet& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(X.hash_function()(3) == bsl::hash<int>()(3));
+
+            IntSet mY(10, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const IntSet& Y = mY;
+
+            ASSERT(10 <= Y.capacity());
+            ASSERT(Y.key_eq()(3, 3));
+            ASSERT(!Y.key_eq()(3, 4));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, iterate over, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        IntSet mX(&ta);  const IntSet& X = mX;
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERTV(i, mX.insert(i * 3).second);
+            ASSERTV(i, !mX.insert(i * 3).second);
+        }
+        ASSERT(100 == X.size());
+
+        int sum = 0;
+        for (IntSet::const_iterator it = X.begin(); it != X.end(); ++it) {
+            sum += *it;
+        }
+        ASSERT(3 * 99 * 100 / 2 == sum);
+
+        for (int i = 0; i < 100; i += 2) {
+            ASSERTV(i, 1 == mX.erase(i * 3));
+            ASSERTV(i, 0 == mX.erase(i * 3));
+        }
+        ASSERT(50 == X.size());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,60 @@
+// bdlc_flathashtable.cpp                                             -*-C++-*-
+#include <bdlc_flathashtable.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlc_flathashtable_cpp,"$Id$ $CSID$")
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                      // ---------------------------
+                      // struct FlatHashTable_ImpUtil
+                      // ---------------------------
+
+// CLASS DATA
+const bsl::uint8_t FlatHashTable_ImpUtil::s_sentinel =
+                                        FlatHashTable_GroupControl::k_SENTINEL;
+
+// CLASS METHODS
+bsl::size_t FlatHashTable_ImpUtil::capacityForSize(bsl::size_t size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    bsl::size_t capacity = FlatHashTable_GroupControl::k_SIZE;
+    while (maxLoad(capacity) < size) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+void FlatHashTable_ImpUtil::resetControls(bsl::uint8_t *controls,
+                                          bsl::size_t   capacity)
+{
+    BSLS_ASSERT(controls);
+
+    bsl::memset(controls, FlatHashTable_GroupControl::k_EMPTY, capacity);
+    controls[capacity] = FlatHashTable_GroupControl::k_SENTINEL;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1452 @@
+// bdlc_flathashtable.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#define INCLUDED_BDLC_FLATHASHTABLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressing hash table with contiguous storage.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable: open-addressing table of entries, grouped probing
+//  bdlc::FlatHashTable_GroupControl: match bytes of a group of control bytes
+//  bdlc::FlatHashTable_Iterator: forward iterator over the entries of a table
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashset
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlc::FlatHashTable', implementing the open-addressing hash table
+// underlying 'bdlc::FlatHashMap' and 'bdlc::FlatHashSet', along with its
+// iterator and a utility for matching the control bytes of the table.  These
+// types are *component-private* and should not be used directly; use
+// 'bdlc_flathashmap' or 'bdlc_flathashset' instead.
+//
+///Representation
+///--------------
+// A table of capacity 'N' (zero, or a power of two no less than 8) holds two
+// parallel arrays, obtained in a single allocation: an array of 'N' entries,
+// and an array of 'N + 1' *control* bytes.  The control byte of a slot
+// identifies it as empty, as *erased* (holding no entry, but having once held
+// one), or as full; the control byte of a full slot holds 7 bits of the hash
+// value of the key of its entry.  The final control byte is a sentinel that
+// terminates iteration.
+//
+// The slots are divided into groups of 8 consecutive slots.  A key is looked
+// up by visiting, in a sequence determined by its hash value, the groups of
+// the table until it reaches a group having an empty slot.  The 8 control
+// bytes of each group visited are compared with the 7 bits of the hash value
+// of the key at once, as a single 64-bit word, and only the entries of slots
+// whose control bytes match are compared with the key.  Because the entries
+// are held contiguously, iterating over a table and rehashing it visit memory
+// in address order, without following links between nodes.
+//
+// At most 7/8 of the slots of a table may be full or erased; inserting into a
+// table at this limit rehashes the table, doubling its capacity unless at
+// least half of the limit is made up of erased slots, in which case the
+// capacity is unchanged and the erased slots are reclaimed.  Erasing an entry
+// makes its slot empty if its group has an empty slot, and erased otherwise.
+//
+// Unlike a node-based table, inserting into or rehashing a flat table moves
+// the entries it holds, invalidating all references, pointers, and iterators
+// to those entries.  If the entry type is bitwise movable, rehashing copies
+// the entries with 'memcpy'.
+//
+///Requirements on 'HASH' and 'EQUAL'
+///----------------------------------
+// The hash and equality functors of a table must not throw exceptions.  Note
+// that rehashing a table invokes the hash functor for each of its entries.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bdlc' and is *not* intended
+// for direct client use.  It is subject to change without notice.  As such, a
+// usage example is not provided.
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_removeconst.h>
+
+#include <bsls_assert.h>
+#include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_iterator.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                     // ================================
+                     // class FlatHashTable_GroupControl
+                     // ================================
+
+class FlatHashTable_GroupControl {
+    // This class provides the comparisons of a group of 8 consecutive control
+    // bytes of a flat hash table against a value, performed at once on a
+    // 64-bit word.  Each comparison returns a *bit* *mask* having, for each
+    // control byte in the group satisfying it, the most-significant bit of
+    // the corresponding byte set; the mask can be traversed using 'firstIndex'
+    // and 'removeFirst'.
+
+  public:
+    // TYPES
+    typedef bsl::uint64_t BitMask;
+        // 'BitMask' is an alias for the type of the result of a comparison.
+
+    // CONSTANTS
+    enum {
+        k_SIZE     = 8,     // number of control bytes in a group
+
+        k_EMPTY    = 0x80,  // value of the control byte of an empty slot
+
+        k_ERASED   = 0xFE,  // value of the control byte of an erased slot
+
+        k_SENTINEL = 0xFF   // value of the control byte following the last
+                            // slot
+    };
+
+  private:
+    // DATA
+    bsl::uint64_t d_value;  // the 8 control bytes, lowest address in the
+                            // least-significant byte
+
+  public:
+    // CLASS METHODS
+    static int firstIndex(BitMask mask);
+        // Return the index, within its group, of the first control byte
+        // selected by the specified 'mask'.  The behavior is undefined unless
+        // '0 != mask'.
+
+    static BitMask removeFirst(BitMask mask);
+        // Return the specified 'mask' with the first control byte it selects
+        // removed.  The behavior is undefined unless '0 != mask'.
+
+    // CREATORS
+    explicit FlatHashTable_GroupControl(const bsl::uint8_t *controls);
+        // Create a group holding the 8 control bytes at the specified
+        // 'controls' address, which need not be aligned.
+
+    // ACCESSORS
+    BitMask match(bsl::uint8_t value) const;
+        // Return a mask selecting the control bytes of this group that
+        // (possibly) equal the specified 'value'.  Every control byte equal to
+        // 'value' is selected; a control byte not equal to 'value' is rarely
+        // selected (but only if a byte at a lower address in this group equals
+        // 'value'), so that the entries of the slots selected must still be
+        // compared.  The behavior is undefined unless '0 <= value < 0x80'.
+
+    BitMask matchEmpty() const;
+        // Return a mask selecting exactly the control bytes of this group
+        // indicating an empty slot.
+
+    BitMask matchEmptyOrErased() const;
+        // Return a mask selecting exactly the control bytes of this group
+        // indicating an empty or an erased slot.
+
+    BitMask matchFull() const;
+        // Return a mask selecting exactly the control bytes of this group
+        // indicating a full slot.
+};
+
+                      // ============================
+                      // class FlatHashTable_Iterator
+                      // ============================
+
+template <class ENTRY>
+class FlatHashTable_Iterator {
+    // This class provides a forward iterator over the entries of a flat hash
+    // table, providing access to each entry as an object of the (template
+    // parameter) type 'ENTRY', which may be 'const'-qualified.  An iterator is
+    // invalidated by any operation on its table that inserts an entry.
+
+    // PRIVATE TYPES
+    typedef typename bsl::remove_const<ENTRY>::type NcEntry;
+
+    // DATA
+    ENTRY              *d_entry_p;    // referenced entry
+
+    const bsl::uint8_t *d_control_p;  // control byte of the referenced entry
+
+    // FRIENDS
+    template <class OTHER_ENTRY>
+    friend class FlatHashTable_Iterator;
+
+    template <class LHS_ENTRY, class RHS_ENTRY>
+    friend bool operator==(const FlatHashTable_Iterator<LHS_ENTRY>&,
+                           const FlatHashTable_Iterator<RHS_ENTRY>&);
+
+  public:
+    // TYPES
+    typedef bsl::forward_iterator_tag iterator_category;
+    typedef NcEntry                   value_type;
+    typedef bsl::ptrdiff_t            difference_type;
+    typedef ENTRY                    *pointer;
+    typedef ENTRY&                    reference;
+
+    // CREATORS
+    FlatHashTable_Iterator();
+        // Create an iterator referring to no entry.
+
+    FlatHashTable_Iterator(ENTRY *entry, const bsl::uint8_t *control);
+        // Create an iterator referring to the specified 'entry', whose slot
+        // has the specified 'control' byte.  If 'control' does not indicate
+        // a full slot, advance to the first full slot following it, or to the
+        // sentinel.  The behavior is undefined unless 'control' is the control
+        // byte of the slot of 'entry', or the sentinel of a table.
+
+    //! FlatHashTable_Iterator(const FlatHashTable_Iterator& original) =
+    //                                                                 default;
+        // Create an iterator referring to the same entry as the specified
+        // 'original' iterator.
+
+    template <class OTHER_ENTRY>
+    FlatHashTable_Iterator(
+             const FlatHashTable_Iterator<OTHER_ENTRY>& original,
+             typename bsl::enable_if<bsl::is_same<OTHER_ENTRY, NcEntry>::value,
+                                     int>::type = 0);
+        // Create an iterator referring to the same entry as the specified
+        // 'original' non-'const' iterator.  Note that this constructor allows
+        // a 'const' iterator to be created from a non-'const' one; it is a
+        // template so as not to suppress the implicit copy operations.
+
+    //! ~FlatHashTable_Iterator() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! FlatHashTable_Iterator& operator=(const FlatHashTable_Iterator&) =
+    //                                                                 default;
+        // Assign to this iterator the value of the specified 'rhs' iterator,
+        // and return a reference providing modifiable access to this iterator.
+
+    FlatHashTable_Iterator& operator++();
+        // Advance this iterator to the next entry of its table, or to the end
+        // of the table, and return a reference providing modifiable access to
+        // this iterator.  The behavior is undefined if this iterator refers
+        // to the end of its table.
+
+    FlatHashTable_Iterator operator++(int);
+        // Advance this iterator to the next entry of its table, or to the end
+        // of the table, and return an iterator having the value of this
+        // iterator before the call.  The behavior is undefined if this
+        // iterator refers to the end of its table.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the entry referred to by this iterator.  The
+        // behavior is undefined if this iterator refers to the end of its
+        // table.
+
+    ENTRY *operator->() const;
+        // Return the address of the entry referred to by this iterator.  The
+        // behavior is undefined if this iterator refers to the end of its
+        // table.
+};
+
+// FREE OPERATORS
+template <class LHS_ENTRY, class RHS_ENTRY>
+bool operator==(const FlatHashTable_Iterator<LHS_ENTRY>& lhs,
+                const FlatHashTable_Iterator<RHS_ENTRY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators refer to the
+    // same entry, or to the end of the same table, and 'false' otherwise.
+
+template <class LHS_ENTRY, class RHS_ENTRY>
+bool operator!=(const FlatHashTable_Iterator<LHS_ENTRY>& lhs,
+                const FlatHashTable_Iterator<RHS_ENTRY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators do not refer to
+    // the same entry, or to the end of the same table, and 'false' otherwise.
+
+                      // ===========================
+                      // struct FlatHashTable_ImpUtil
+                      // ===========================
+
+struct FlatHashTable_ImpUtil {
+    // This 'struct' provides a namespace for the operations of a flat hash
+    // table that do not depend on the types of its entries.
+
+    // CLASS DATA
+    static const bsl::uint8_t s_sentinel;
+        // A sentinel control byte referred to by the iterators of a table
+        // having no slots.
+
+    // CLASS METHODS
+    static bsl::size_t capacityForSize(bsl::size_t size);
+        // Return the smallest capacity of a table that can hold the specified
+        // 'size' entries without rehashing: 0 if '0 == size', and otherwise
+        // the smallest power of two, no less than 8, at least 7/8 of which is
+        // no less than 'size'.
+
+    static bsl::size_t firstGroup(bsl::uint64_t mixedHash,
+                                  bsl::size_t   capacity);
+        // Return the index of the first slot of the first group visited by the
+        // probe sequence of a key whose hash has the specified 'mixedHash' in
+        // a table having the specified 'capacity'.  The behavior is undefined
+        // unless 'capacity' is a power of two no less than 8.
+
+    static bsl::uint64_t mix(bsl::size_t hashCode);
+        // Return a value, all of whose bits depend on the specified
+        // 'hashCode', derived from 'hashCode'.  Note that the hash functions
+        // of 'bsl::hash' for integral types return their argument, whose
+        // low-order bits are a poor choice of table position.
+
+    static bsl::size_t maxLoad(bsl::size_t capacity);
+        // Return the maximum number of the slots of a table having the
+        // specified 'capacity' that may be full or erased.
+
+    static void resetControls(bsl::uint8_t *controls, bsl::size_t capacity);
+        // Set the first specified 'capacity' of the specified 'controls' to
+        // indicate an empty slot, and the following one to the sentinel.
+};
+
+                           // ===================
+                           // class FlatHashTable
+                           // ===================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+class FlatHashTable {
+    // This class template provides an open-addressing hash table of unique
+    // entries of the (template parameter) type 'ENTRY', each identified by a
+    // key of the (template parameter) type 'KEY' obtained from the entry by
+    // the (template parameter) 'ENTRY_UTIL::key' class method, and hashed and
+    // compared by the (template parameter) types 'HASH' and 'EQUAL'.  The
+    // table supplies slots for the entries; the entries themselves are
+    // created in those slots by the caller (see 'findOrPrepareInsert').
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl GroupControl;
+    typedef FlatHashTable_ImpUtil      ImpUtil;
+    typedef bslmf::MovableRefUtil      MoveUtil;
+
+    // DATA
+    ENTRY            *d_entries_p;    // array of 'd_capacity' slots, or 0
+
+    bsl::uint8_t     *d_controls_p;   // array of 'd_capacity + 1' control
+                                      // bytes, or 0; in the same allocation as
+                                      // 'd_entries_p'
+
+    bsl::size_t       d_size;         // number of full slots
+
+    bsl::size_t       d_numErased;    // number of erased slots
+
+    bsl::size_t       d_capacity;     // number of slots
+
+    HASH              d_hasher;       // hash functor
+
+    EQUAL             d_equal;        // equality functor
+
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t numBytes(bsl::size_t capacity);
+        // Return the number of bytes of the allocation of a table having the
+        // specified 'capacity'.
+
+    // PRIVATE MANIPULATORS
+    void allocate(bsl::size_t capacity);
+        // Obtain, for this table having no slots, memory for the specified
+        // 'capacity' slots, all of which are empty.  The behavior is undefined
+        // unless '0 == d_capacity', and 'capacity' is a power of two no less
+        // than 8.
+
+    void destroyEntries();
+        // Destroy the entries held by this table, leaving its slots empty.
+
+    bsl::size_t findEmptySlot(bsl::uint64_t mixedHash) const;
+        // Return the index of the first slot, in the probe sequence of the
+        // specified 'mixedHash', that is empty or erased.  The behavior is
+        // undefined unless this table has an empty slot.
+
+    void markFull(bsl::size_t index, bsl::uint64_t mixedHash);
+        // Mark the slot having the specified 'index' as full, holding an
+        // entry whose key has the specified 'mixedHash'.
+
+    void rehashTo(bsl::size_t capacity);
+        // Move the entries of this table into a table having the specified
+        // 'capacity' slots, using the allocator of this table.  The behavior
+        // is undefined unless 'capacity' is a power of two no less than 8 and
+        // no less than 'capacityForSize(size())'.
+
+    void swapState(FlatHashTable& other);
+        // Exchange the slots and entries of this table with those of the
+        // specified 'other' table, but not their functors or allocators.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findIndex(const KEY& key, bsl::uint64_t mixedHash) const;
+        // Return the index of the slot holding the entry having the specified
+        // 'key', whose hash has the specified 'mixedHash', or 'd_capacity' if
+        // this table holds no such entry.
+
+  public:
+    // TYPES
+    typedef FlatHashTable_Iterator<ENTRY>       Iterator;
+    typedef FlatHashTable_Iterator<const ENTRY> ConstIterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashTable, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashTable(bsl::size_t       capacity,
+                  const HASH&       hash,
+                  const EQUAL&      equal,
+                  bslma::Allocator *basicAllocator);
+        // Create an empty table able to hold the specified 'capacity' entries
+        // without rehashing, using the specified 'hash' and 'equal' functors,
+        // and the specified 'basicAllocator' to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    FlatHashTable(const FlatHashTable&  original,
+                  bslma::Allocator     *basicAllocator);
+        // Create a table having the same entries and functors as the specified
+        // 'original' table, using the specified 'basicAllocator' to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    explicit FlatHashTable(bslmf::MovableRef<FlatHashTable> original);
+        // Create a table having the same entries, functors, and allocator as
+        // the specified 'original' table, by taking ownership of its slots.
+        // 'original' is left empty, with no slots.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable>  original,
+                  bslma::Allocator                 *basicAllocator);
+        // Create a table having the same entries and functors as the specified
+        // 'original' table, using the specified 'basicAllocator' to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  If 'original' uses 'basicAllocator', take
+        // ownership of its slots, leaving it empty with no slots; otherwise,
+        // move its entries, leaving it with its entries in a valid but
+        // unspecified state.
+
+    ~FlatHashTable();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this table the entries and functors of the specified 'rhs'
+        // table, and return a reference providing modifiable access to this
+        // table.
+
+    FlatHashTable& operator=(bslmf::MovableRef<FlatHashTable> rhs);
+        // Assign to this table the entries and functors of the specified 'rhs'
+        // table, and return a reference providing modifiable access to this
+        // table.  If 'rhs' uses the allocator of this table, exchange the
+        // slots of the two tables; otherwise, move the entries of 'rhs',
+        // leaving them in a valid but unspecified state.
+
+    Iterator begin();
+        // Return an iterator referring to the first entry of this table, or
+        // 'end()' if this table is empty.
+
+    void clear();
+        // Destroy the entries of this table, leaving it empty, with the same
+        // capacity.
+
+    Iterator end();
+        // Return an iterator referring to the end of this table.
+
+    ENTRY *entries();
+        // Return the address of the array of slots of this table, or 0 if
+        // this table has no slots.
+
+    void erase(bsl::size_t index);
+        // Destroy the entry held in the slot having the specified 'index'.
+        // The behavior is undefined unless the slot having 'index' is full.
+
+    bsl::size_t findOrPrepareInsert(bool          *found,
+                                    bsl::uint64_t *mixedHash,
+                                    const KEY&     key);
+        // Return the index of the slot holding the entry having the specified
+        // 'key', and load 'true' into the specified 'found', if this table
+        // holds such an entry.  Otherwise, load 'false' into 'found',
+        // rehashing this table if necessary, and return the index of a slot in
+        // which an entry having 'key' may be created, after which
+        // 'commitInsert' must be called with that index and the value loaded
+        // into the specified 'mixedHash'.  If no entry is created (e.g., if
+        // its constructor throws), 'commitInsert' must not be called, and the
+        // table is unchanged but for its capacity.
+
+    void commitInsert(bsl::size_t index, bsl::uint64_t mixedHash);
+        // Mark the slot having the specified 'index', in which an entry has
+        // been created, as full.  The behavior is undefined unless 'index'
+        // and 'mixedHash' were returned by the most recent call to
+        // 'findOrPrepareInsert' on this table, that call loaded 'false' into
+        // its 'found' argument, and no other manipulator has been called
+        // since.
+
+    Iterator iteratorAt(bsl::size_t index);
+        // Return an iterator referring to the entry in the first full slot
+        // having an index no less than the specified 'index', or 'end()' if
+        // there is no such slot.  The behavior is undefined unless
+        // 'index <= capacity()'.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Rehash this table into a table having the smallest capacity no less
+        // than 'capacityForSize(size())' and the specified 'minimumCapacity'
+        // (rounded up to a power of two no less than 8), reclaiming its
+        // erased slots.  If this table is empty and '0 == minimumCapacity',
+        // release its slots instead.
+
+    void reserve(bsl::size_t numEntries);
+        // Increase, if necessary, the capacity of this table so that it can
+        // hold the specified 'numEntries' entries without rehashing.
+
+    void swap(FlatHashTable& other);
+        // Exchange the value and functors of this table with those of the
+        // specified 'other' table.  The behavior is undefined unless this
+        // table and 'other' use the same allocator.
+
+    // ACCESSORS
+    ConstIterator begin() const;
+        // Return an iterator referring to the first entry of this table, or
+        // 'end()' if this table is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots of this table.
+
+    ConstIterator end() const;
+        // Return an iterator referring to the end of this table.
+
+    const ENTRY *entries() const;
+        // Return the address of the array of slots of this table, or 0 if
+        // this table has no slots.
+
+    const EQUAL& equalityFunctor() const;
+        // Return a reference providing non-modifiable access to the equality
+        // functor of this table.
+
+    bsl::size_t find(const KEY& key) const;
+        // Return the index of the slot holding the entry having the specified
+        // 'key', or 'capacity()' if this table holds no such entry.
+
+    const HASH& hashFunctor() const;
+        // Return a reference providing non-modifiable access to the hash
+        // functor of this table.
+
+    bool isEqual(const FlatHashTable& other) const;
+        // Return 'true' if this table and the specified 'other' table hold the
+        // same number of entries, and each entry of this table is equal (using
+        // 'operator==' on 'ENTRY') to the entry of 'other' having its key, and
+        // 'false' otherwise.
+
+    ConstIterator iteratorAt(bsl::size_t index) const;
+        // Return an iterator referring to the entry in the first full slot
+        // having an index no less than the specified 'index', or 'end()' if
+        // there is no such slot.  The behavior is undefined unless
+        // 'index <= capacity()'.
+
+    bsl::size_t size() const;
+        // Return the number of entries held by this table.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this table to supply memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                     // --------------------------------
+                     // class FlatHashTable_GroupControl
+                     // --------------------------------
+
+// CLASS METHODS
+inline
+int FlatHashTable_GroupControl::firstIndex(BitMask mask)
+{
+    BSLS_ASSERT_SAFE(0 != mask);
+
+    return bdlb::BitUtil::numTrailingUnsetBits(mask) >> 3;
+}
+
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::removeFirst(BitMask mask)
+{
+    BSLS_ASSERT_SAFE(0 != mask);
+
+    return mask & (mask - 1);
+}
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                  const bsl::uint8_t *controls)
+{
+    BSLS_ASSERT_SAFE(controls);
+
+    bsl::memcpy(&d_value, controls, sizeof d_value);
+#ifdef BSLS_PLATFORM_IS_BIG_ENDIAN
+    d_value = bsls::ByteOrderUtil::swapBytes64(d_value);
+#endif
+}
+
+// ACCESSORS
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::match(bsl::uint8_t value) const
+{
+    BSLS_ASSERT_SAFE(value < 0x80);
+
+    // A byte of 'x' is zero if and only if the corresponding control byte
+    // equals 'value'.  Subtracting 1 from each byte sets the most-significant
+    // bit of each zero byte, but a borrow out of a zero byte may also set that
+    // bit of the next byte if it is 1 (hence the occasional false positive).
+
+    const bsl::uint64_t k_LSBS = 0x0101010101010101ULL;
+    const bsl::uint64_t k_MSBS = 0x8080808080808080ULL;
+
+    const bsl::uint64_t x = d_value ^ (k_LSBS * value);
+
+    return (x - k_LSBS) & ~x & k_MSBS;
+}
+
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::matchEmpty() const
+{
+    // Of the control bytes having the most-significant bit set, only
+    // 'k_EMPTY' has bit 1 unset.
+
+    return d_value & (~d_value << 6) & 0x8080808080808080ULL;
+}
+
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::matchEmptyOrErased() const
+{
+    // The sentinel never occurs within a group.
+
+    return d_value & 0x8080808080808080ULL;
+}
+
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::matchFull() const
+{
+    return ~d_value & 0x8080808080808080ULL;
+}
+
+                      // ----------------------------
+                      // class FlatHashTable_Iterator
+                      // ----------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_Iterator<ENTRY>::FlatHashTable_Iterator()
+: d_entry_p(0)
+, d_control_p(0)
+{
+}
+
+template <class ENTRY>
+inline
+FlatHashTable_Iterator<ENTRY>::FlatHashTable_Iterator(
+                                            ENTRY              *entry,
+                                            const bsl::uint8_t *control)
+: d_entry_p(entry)
+, d_control_p(control)
+{
+    BSLS_ASSERT_SAFE(control);
+
+    while (*d_control_p & 0x80
+        && FlatHashTable_GroupControl::k_SENTINEL != *d_control_p) {
+        ++d_entry_p;
+        ++d_control_p;
+    }
+}
+
+template <class ENTRY>
+template <class OTHER_ENTRY>
+inline
+FlatHashTable_Iterator<ENTRY>::FlatHashTable_Iterator(
+             const FlatHashTable_Iterator<OTHER_ENTRY>& original,
+             typename bsl::enable_if<bsl::is_same<OTHER_ENTRY, NcEntry>::value,
+                                     int>::type)
+: d_entry_p(original.d_entry_p)
+, d_control_p(original.d_control_p)
+{
+}
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+FlatHashTable_Iterator<ENTRY>& FlatHashTable_Iterator<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_control_p);
+    BSLS_ASSERT_SAFE(FlatHashTable_GroupControl::k_SENTINEL != *d_control_p);
+
+    do {
+        ++d_entry_p;
+        ++d_control_p;
+    } while (*d_control_p & 0x80
+          && FlatHashTable_GroupControl::k_SENTINEL != *d_control_p);
+
+    return *this;
+}
+
+template <class ENTRY>
+inline
+FlatHashTable_Iterator<ENTRY> FlatHashTable_Iterator<ENTRY>::operator++(int)
+{
+    FlatHashTable_Iterator result(*this);
+    ++*this;
+    return result;
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& FlatHashTable_Iterator<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_control_p);
+    BSLS_ASSERT_SAFE(0 == (*d_control_p & 0x80));
+
+    return *d_entry_p;
+}
+
+template <class ENTRY>
+inline
+ENTRY *FlatHashTable_Iterator<ENTRY>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_control_p);
+    BSLS_ASSERT_SAFE(0 == (*d_control_p & 0x80));
+
+    return d_entry_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class LHS_ENTRY, class RHS_ENTRY>
+inline
+bool bdlc::operator==(const FlatHashTable_Iterator<LHS_ENTRY>& lhs,
+                      const FlatHashTable_Iterator<RHS_ENTRY>& rhs)
+{
+    return lhs.d_control_p == rhs.d_control_p;
+}
+
+template <class LHS_ENTRY, class RHS_ENTRY>
+inline
+bool bdlc::operator!=(const FlatHashTable_Iterator<LHS_ENTRY>& lhs,
+                      const FlatHashTable_Iterator<RHS_ENTRY>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+namespace bdlc {
+
+                      // ---------------------------
+                      // struct FlatHashTable_ImpUtil
+                      // ---------------------------
+
+// CLASS METHODS
+inline
+bsl::size_t FlatHashTable_ImpUtil::firstGroup(bsl::uint64_t mixedHash,
+                                              bsl::size_t   capacity)
+{
+    // The low-order 7 bits of 'mixedHash' are held in the control byte; use
+    // the remaining bits to select the group.
+
+    return static_cast<bsl::size_t>(mixedHash >> 7)
+         & (capacity - 1)
+         & ~static_cast<bsl::size_t>(FlatHashTable_GroupControl::k_SIZE - 1);
+}
+
+inline
+bsl::uint64_t FlatHashTable_ImpUtil::mix(bsl::size_t hashCode)
+{
+    // Multiply by 2^64 divided by the golden ratio (Fibonacci hashing), then
+    // fold the well-mixed high-order bits into the low-order bits.
+
+    bsl::uint64_t result = static_cast<bsl::uint64_t>(hashCode)
+                                                    * 0x9E3779B97F4A7C15ULL;
+    return result ^ (result >> 32);
+}
+
+inline
+bsl::size_t FlatHashTable_ImpUtil::maxLoad(bsl::size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+                           // -------------------
+                           // class FlatHashTable
+                           // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::numBytes(
+                                                          bsl::size_t capacity)
+{
+    return capacity * sizeof(ENTRY) + capacity + 1;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocate(
+                                                          bsl::size_t capacity)
+{
+    BSLS_ASSERT(0 == d_capacity);
+    BSLS_ASSERT(GroupControl::k_SIZE <= capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    char *memory = static_cast<char *>(
+                                  d_allocator_p->allocate(numBytes(capacity)));
+
+    d_entries_p  = reinterpret_cast<ENTRY *>(memory);
+    d_controls_p = reinterpret_cast<bsl::uint8_t *>(
+                                            memory + capacity * sizeof(ENTRY));
+    d_capacity   = capacity;
+    d_size       = 0;
+    d_numErased  = 0;
+
+    ImpUtil::resetControls(d_controls_p, capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::destroyEntries()
+{
+    if (0 == d_size) {
+        return;                                                       // RETURN
+    }
+
+    for (bsl::size_t i = 0; i < d_capacity; i += GroupControl::k_SIZE) {
+        GroupControl::BitMask full =
+                                  GroupControl(d_controls_p + i).matchFull();
+        while (full) {
+            bslma::DestructionUtil::destroy(
+                        d_entries_p + i + GroupControl::firstIndex(full));
+            full = GroupControl::removeFirst(full);
+        }
+    }
+    ImpUtil::resetControls(d_controls_p, d_capacity);
+    d_size      = 0;
+    d_numErased = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findEmptySlot(
+                                                 bsl::uint64_t mixedHash) const
+{
+    BSLS_ASSERT_SAFE(0 < d_capacity);
+
+    const bsl::size_t mask  = d_capacity - 1;
+    bsl::size_t       group = ImpUtil::firstGroup(mixedHash, d_capacity);
+    bsl::size_t       step  = 0;
+
+    while (true) {
+        const GroupControl          control(d_controls_p + group);
+        const GroupControl::BitMask available = control.matchEmptyOrErased();
+        if (available) {
+            return group + GroupControl::firstIndex(available);       // RETURN
+        }
+        step += GroupControl::k_SIZE;
+        group = (group + step) & mask;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::markFull(
+                                                   bsl::size_t   index,
+                                                   bsl::uint64_t mixedHash)
+{
+    d_controls_p[index] = static_cast<bsl::uint8_t>(mixedHash & 0x7F);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashTo(
+                                                          bsl::size_t capacity)
+{
+    FlatHashTable temp(0, d_hasher, d_equal, d_allocator_p);
+    temp.allocate(capacity);
+
+    if (bslmf::IsBitwiseMoveable<ENTRY>::value) {
+        for (bsl::size_t i = 0; i < d_capacity; i += GroupControl::k_SIZE) {
+            GroupControl::BitMask full =
+                                  GroupControl(d_controls_p + i).matchFull();
+            while (full) {
+                const bsl::size_t   index = i + GroupControl::firstIndex(full);
+                const bsl::uint64_t hash  =
+                          ImpUtil::mix(d_hasher(ENTRY_UTIL::key(
+                                                       d_entries_p[index])));
+                const bsl::size_t   slot  = temp.findEmptySlot(hash);
+
+                bsl::memcpy(static_cast<void *>(temp.d_entries_p + slot),
+                            static_cast<const void *>(d_entries_p + index),
+                            sizeof(ENTRY));
+                temp.markFull(slot, hash);
+                full = GroupControl::removeFirst(full);
+            }
+        }
+        temp.d_size = d_size;
+
+        // The entries now belong to 'temp'; mark the slots of this table as
+        // empty so that they are not destroyed.
+
+        if (0 != d_capacity) {
+            ImpUtil::resetControls(d_controls_p, d_capacity);
+        }
+        d_size      = 0;
+        d_numErased = 0;
+    }
+    else {
+        for (bsl::size_t i = 0; i < d_capacity; i += GroupControl::k_SIZE) {
+            GroupControl::BitMask full =
+                                  GroupControl(d_controls_p + i).matchFull();
+            while (full) {
+                const bsl::size_t   index = i + GroupControl::firstIndex(full);
+                const bsl::uint64_t hash  =
+                          ImpUtil::mix(d_hasher(ENTRY_UTIL::key(
+                                                       d_entries_p[index])));
+                const bsl::size_t   slot  = temp.findEmptySlot(hash);
+
+                bslma::ConstructionUtil::construct(
+                              temp.d_entries_p + slot,
+                              d_allocator_p,
+                              MoveUtil::move_if_noexcept(d_entries_p[index]));
+                temp.markFull(slot, hash);
+                ++temp.d_size;
+                full = GroupControl::removeFirst(full);
+            }
+        }
+    }
+
+    swapState(temp);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swapState(
+                                                          FlatHashTable& other)
+{
+    bslalg::SwapUtil::swap(&d_entries_p,  &other.d_entries_p);
+    bslalg::SwapUtil::swap(&d_controls_p, &other.d_controls_p);
+    bslalg::SwapUtil::swap(&d_size,       &other.d_size);
+    bslalg::SwapUtil::swap(&d_numErased,  &other.d_numErased);
+    bslalg::SwapUtil::swap(&d_capacity,   &other.d_capacity);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findIndex(
+                                                const KEY&    key,
+                                                bsl::uint64_t mixedHash) const
+{
+    if (0 == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::size_t  mask  = d_capacity - 1;
+    const bsl::uint8_t h2    = static_cast<bsl::uint8_t>(mixedHash & 0x7F);
+    bsl::size_t        group = ImpUtil::firstGroup(mixedHash, d_capacity);
+    bsl::size_t        step  = 0;
+
+    while (true) {
+        const GroupControl    control(d_controls_p + group);
+        GroupControl::BitMask candidates = control.match(h2);
+
+        while (candidates) {
+            const bsl::size_t index =
+                                group + GroupControl::firstIndex(candidates);
+            if (d_equal(ENTRY_UTIL::key(d_entries_p[index]), key)) {
+                return index;                                         // RETURN
+            }
+            candidates = GroupControl::removeFirst(candidates);
+        }
+        if (control.matchEmpty()) {
+            return d_capacity;                                        // RETURN
+        }
+        step += GroupControl::k_SIZE;
+        group = (group + step) & mask;
+    }
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                            bsl::size_t       capacity,
+                                            const HASH&       hash,
+                                            const EQUAL&      equal,
+                                            bslma::Allocator *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (capacity) {
+        allocate(ImpUtil::capacityForSize(capacity));
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                        const FlatHashTable&  original,
+                                        bslma::Allocator     *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_hasher(original.d_hasher)
+, d_equal(original.d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (0 == original.d_size) {
+        return;                                                       // RETURN
+    }
+
+    FlatHashTable temp(0, d_hasher, d_equal, d_allocator_p);
+    temp.allocate(ImpUtil::capacityForSize(original.d_size));
+
+    for (ConstIterator it = original.begin(); it != original.end(); ++it) {
+        const bsl::uint64_t hash =
+                                  ImpUtil::mix(d_hasher(ENTRY_UTIL::key(*it)));
+        const bsl::size_t   slot = temp.findEmptySlot(hash);
+
+        bslma::ConstructionUtil::construct(temp.d_entries_p + slot,
+                                           d_allocator_p,
+                                           *it);
+        temp.markFull(slot, hash);
+        ++temp.d_size;
+    }
+
+    swapState(temp);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                     bslmf::MovableRef<FlatHashTable> original)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator_p(MoveUtil::access(original).d_allocator_p)
+{
+    swapState(MoveUtil::access(original));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                            bslmf::MovableRef<FlatHashTable>  original,
+                            bslma::Allocator                 *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    FlatHashTable& lvalue = original;
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        swapState(lvalue);
+        return;                                                       // RETURN
+    }
+
+    if (0 == lvalue.d_size) {
+        return;                                                       // RETURN
+    }
+
+    FlatHashTable temp(0, d_hasher, d_equal, d_allocator_p);
+    temp.allocate(ImpUtil::capacityForSize(lvalue.d_size));
+
+    for (Iterator it = lvalue.begin(); it != lvalue.end(); ++it) {
+        const bsl::uint64_t hash =
+                                  ImpUtil::mix(d_hasher(ENTRY_UTIL::key(*it)));
+        const bsl::size_t   slot = temp.findEmptySlot(hash);
+
+        bslma::ConstructionUtil::construct(temp.d_entries_p + slot,
+                                           d_allocator_p,
+                                           MoveUtil::move(*it));
+        temp.markFull(slot, hash);
+        ++temp.d_size;
+    }
+
+    swapState(temp);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+{
+    if (d_capacity) {
+        destroyEntries();
+        d_allocator_p->deallocate(d_entries_p);
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        FlatHashTable temp(rhs, d_allocator_p);
+        swap(temp);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                          bslmf::MovableRef<FlatHashTable> rhs)
+{
+    FlatHashTable& lvalue = rhs;
+
+    if (this != &lvalue) {
+        FlatHashTable temp(MoveUtil::move(lvalue), d_allocator_p);
+        swap(temp);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::Iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+{
+    if (0 == d_size) {
+        return end();                                                 // RETURN
+    }
+    return Iterator(d_entries_p, d_controls_p);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+{
+    if (d_capacity) {
+        destroyEntries();
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::Iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+{
+    if (0 == d_capacity) {
+        return Iterator(0, &ImpUtil::s_sentinel);                     // RETURN
+    }
+    return Iterator(d_entries_p + d_capacity, d_controls_p + d_capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+ENTRY *FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::entries()
+{
+    return d_entries_p;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                             bsl::size_t index)
+{
+    BSLS_ASSERT(index < d_capacity);
+    BSLS_ASSERT(0 == (d_controls_p[index] & 0x80));
+
+    bslma::DestructionUtil::destroy(d_entries_p + index);
+    --d_size;
+
+    // A probe sequence passes over a group only if, when the key probed for
+    // was inserted, every slot of the group was full.  If the group of 'index'
+    // now has an empty slot, no probe sequence passes over it, and the slot
+    // can be made empty.
+
+    const bsl::size_t group = index & ~(GroupControl::k_SIZE - 1);
+
+    if (GroupControl(d_controls_p + group).matchEmpty()) {
+        d_controls_p[index] = GroupControl::k_EMPTY;
+    }
+    else {
+        d_controls_p[index] = GroupControl::k_ERASED;
+        ++d_numErased;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findOrPrepareInsert(
+                                                    bool          *found,
+                                                    bsl::uint64_t *mixedHash,
+                                                    const KEY&     key)
+{
+    BSLS_ASSERT(found);
+    BSLS_ASSERT(mixedHash);
+
+    const bsl::uint64_t hash  = ImpUtil::mix(d_hasher(key));
+    const bsl::size_t   index = findIndex(key, hash);
+
+    if (index < d_capacity) {
+        *found = true;
+        return index;                                                 // RETURN
+    }
+
+    if (d_size + d_numErased >= ImpUtil::maxLoad(d_capacity)) {
+        // Reclaim the erased slots if they make up at least half of the load;
+        // otherwise, double the capacity.
+
+        if (d_capacity && d_size <= ImpUtil::maxLoad(d_capacity) / 2) {
+            rehashTo(d_capacity);
+        }
+        else {
+            rehashTo(d_capacity ? 2 * d_capacity
+                                : static_cast<bsl::size_t>(
+                                                        GroupControl::k_SIZE));
+        }
+    }
+
+    *found     = false;
+    *mixedHash = hash;
+    return findEmptySlot(hash);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::commitInsert(
+                                                   bsl::size_t   index,
+                                                   bsl::uint64_t mixedHash)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(d_controls_p[index] & 0x80);
+
+    if (GroupControl::k_ERASED == d_controls_p[index]) {
+        --d_numErased;
+    }
+    markFull(index, mixedHash);
+    ++d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::Iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iteratorAt(
+                                                             bsl::size_t index)
+{
+    BSLS_ASSERT_SAFE(index <= d_capacity);
+
+    if (index == d_capacity) {
+        return end();                                                 // RETURN
+    }
+    return Iterator(d_entries_p + index, d_controls_p + index);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+                                                   bsl::size_t minimumCapacity)
+{
+    bsl::size_t capacity = ImpUtil::capacityForSize(d_size);
+
+    if (capacity < minimumCapacity) {
+        capacity = GroupControl::k_SIZE;
+        while (capacity < minimumCapacity) {
+            capacity *= 2;
+        }
+    }
+
+    if (0 == capacity) {
+        if (d_capacity) {
+            d_allocator_p->deallocate(d_entries_p);
+            d_entries_p  = 0;
+            d_controls_p = 0;
+            d_capacity   = 0;
+            d_numErased  = 0;
+        }
+        return;                                                       // RETURN
+    }
+
+    rehashTo(capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+                                                        bsl::size_t numEntries)
+{
+    const bsl::size_t capacity = ImpUtil::capacityForSize(numEntries);
+
+    if (capacity > d_capacity) {
+        rehashTo(capacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+                                                          FlatHashTable& other)
+{
+    BSLS_ASSERT_SAFE(d_allocator_p == other.d_allocator_p);
+
+    swapState(other);
+    bslalg::SwapUtil::swap(&d_hasher, &other.d_hasher);
+    bslalg::SwapUtil::swap(&d_equal,  &other.d_equal);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::ConstIterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+{
+    if (0 == d_size) {
+        return end();                                                 // RETURN
+    }
+    return ConstIterator(d_entries_p, d_controls_p);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacity()
+                                                                          const
+{
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::ConstIterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+{
+    if (0 == d_capacity) {
+        return ConstIterator(0, &ImpUtil::s_sentinel);                // RETURN
+    }
+    return ConstIterator(d_entries_p + d_capacity, d_controls_p + d_capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const ENTRY *FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::entries()
+                                                                          const
+{
+    return d_entries_p;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const EQUAL&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equalityFunctor() const
+{
+    return d_equal;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(
+                                                          const KEY& key) const
+{
+    if (0 == d_size) {
+        return d_capacity;                                            // RETURN
+    }
+    return findIndex(key, ImpUtil::mix(d_hasher(key)));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const HASH&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hashFunctor() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::isEqual(
+                                             const FlatHashTable& other) const
+{
+    if (d_size != other.d_size) {
+        return false;                                                 // RETURN
+    }
+
+    for (ConstIterator it = begin(); it != end(); ++it) {
+        const bsl::size_t index = other.find(ENTRY_UTIL::key(*it));
+
+        if (index == other.d_capacity || !(other.d_entries_p[index] == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::ConstIterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iteratorAt(
+                                                       bsl::size_t index) const
+{
+    BSLS_ASSERT_SAFE(index <= d_capacity);
+
+    if (index == d_capacity) {
+        return end();                                                 // RETURN
+    }
+    return ConstIterator(d_entries_p + index, d_controls_p + index);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+{
+    return d_size;
+}
+
+                                  // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
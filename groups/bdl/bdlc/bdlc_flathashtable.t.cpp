@@ -0,0 +1,1226 @@
+// bdlc_flathashtable.t.cpp                                           -*-C++-*-
+#include <bdlc_flathashtable.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides the open-addressing table underlying
+// 'bdlc::FlatHashMap' and 'bdlc::FlatHashSet', a utility comparing a group of
+// control bytes at once, and the iterator of the table.  The group comparisons
+// are verified exhaustively, byte by byte, against a direct computation.  The
+// table is verified against a 'bsl::set' (or 'bsl::map') oracle on
+// pseudo-random sequences of insertions and removals, for entries that are
+// bitwise movable ('int') and that are not and allocate memory
+// ('bsl::string'), with a well-distributed hash functor and with a degenerate
+// one that sends every key to the same group.
+// ----------------------------------------------------------------------------
+// FlatHashTable_GroupControl
+// [ 2] static int firstIndex(BitMask mask);
+// [ 2] static BitMask removeFirst(BitMask mask);
+// [ 2] FlatHashTable_GroupControl(const bsl::uint8_t *controls);
+// [ 2] BitMask match(bsl::uint8_t value) const;
+// [ 2] BitMask matchEmpty() const;
+// [ 2] BitMask matchEmptyOrErased() const;
+// [ 2] BitMask matchFull() const;
+//
+// FlatHashTable_ImpUtil
+// [ 3] static size_t capacityForSize(size_t size);
+// [ 3] static size_t firstGroup(uint64_t mixedHash, size_t capacity);
+// [ 3] static uint64_t mix(size_t hashCode);
+// [ 3] static size_t maxLoad(size_t capacity);
+// [ 3] static void resetControls(uint8_t *controls, size_t capacity);
+//
+// FlatHashTable_Iterator
+// [ 4] FlatHashTable_Iterator();
+// [ 4] FlatHashTable_Iterator(ENTRY *entry, const uint8_t *control);
+// [ 4] FlatHashTable_Iterator(const FlatHashTable_Iterator<OTHER>&);
+// [ 4] FlatHashTable_Iterator& operator++();
+// [ 4] FlatHashTable_Iterator operator++(int);
+// [ 4] ENTRY& operator*() const;
+// [ 4] ENTRY *operator->() const;
+// [ 4] bool operator==(const Iterator<L>&, const Iterator<R>&);
+// [ 4] bool operator!=(const Iterator<L>&, const Iterator<R>&);
+//
+// FlatHashTable
+// [ 5] FlatHashTable(size_t, const HASH&, const EQUAL&, Allocator *);
+// [ 6] FlatHashTable(const FlatHashTable&, Allocator *);
+// [ 6] FlatHashTable(MovableRef<FlatHashTable>);
+// [ 6] FlatHashTable(MovableRef<FlatHashTable>, Allocator *);
+// [ 5] ~FlatHashTable();
+// [ 6] FlatHashTable& operator=(const FlatHashTable&);
+// [ 6] FlatHashTable& operator=(MovableRef<FlatHashTable>);
+// [ 5] Iterator begin();
+// [ 5] void clear();
+// [ 5] Iterator end();
+// [ 5] ENTRY *entries();
+// [ 5] void erase(size_t index);
+// [ 5] size_t findOrPrepareInsert(bool *, uint64_t *, const KEY&);
+// [ 5] void commitInsert(size_t index, uint64_t mixedHash);
+// [ 5] Iterator iteratorAt(size_t index);
+// [ 5] void rehash(size_t minimumCapacity);
+// [ 5] void reserve(size_t numEntries);
+// [ 6] void swap(FlatHashTable& other);
+// [ 5] ConstIterator begin() const;
+// [ 5] size_t capacity() const;
+// [ 5] ConstIterator end() const;
+// [ 5] const ENTRY *entries() const;
+// [ 6] const EQUAL& equalityFunctor() const;
+// [ 5] size_t find(const KEY& key) const;
+// [ 6] const HASH& hashFunctor() const;
+// [ 6] bool isEqual(const FlatHashTable& other) const;
+// [ 5] ConstIterator iteratorAt(size_t index) const;
+// [ 5] size_t size() const;
+// [ 5] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashTable_GroupControl GroupControl;
+typedef bdlc::FlatHashTable_ImpUtil      ImpUtil;
+typedef GroupControl::BitMask            BitMask;
+
+const bsl::uint8_t EMPTY    = GroupControl::k_EMPTY;
+const bsl::uint8_t ERASED   = GroupControl::k_ERASED;
+const bsl::uint8_t SENTINEL = GroupControl::k_SENTINEL;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::uint64_t nextRandom(bsl::uint64_t *state)
+    // Advance the specified linear-congruential generator 'state' and return
+    // its new value.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state ^ (*state >> 29);
+}
+
+struct IdentityUtil {
+    // This 'struct' provides the key of an entry that is its own key.
+
+    template <class TYPE>
+    static const TYPE& key(const TYPE& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+};
+
+struct PairUtil {
+    // This 'struct' provides the key of an entry that is a pair.
+
+    template <class PAIR>
+    static const typename PAIR::first_type& key(const PAIR& entry)
+        // Return the first member of the specified 'entry'.
+    {
+        return entry.first;
+    }
+};
+
+struct ConstantHash {
+    // This 'struct' provides a degenerate hash functor sending every key to
+    // the same group and control byte.
+
+    template <class TYPE>
+    bsl::size_t operator()(const TYPE&) const
+        // Return 0.
+    {
+        return 0;
+    }
+};
+
+struct StringHash {
+    // This 'struct' provides a hash functor for strings.
+
+    bsl::size_t operator()(const bsl::string& value) const
+        // Return a hash value of the specified 'value'.
+    {
+        bsl::size_t result = 14695981039346656037ULL;
+        for (bsl::size_t i = 0; i < value.size(); ++i) {
+            result ^= static_cast<unsigned char>(value[i]);
+            result *= 1099511628211ULL;
+        }
+        return result;
+    }
+};
+
+bsl::string makeString(int value)
+    // Return a string, too long for the short-string buffer, whose value is
+    // determined by the specified 'value'.
+{
+    bsl::string result("a string long enough to allocate memory: ");
+    for (int i = 0; i < 8; ++i) {
+        result.push_back(static_cast<char>('0' + value % 10));
+        value /= 10;
+    }
+    return result;
+}
+
+template <class TABLE, class KEY>
+bool insertEntry(TABLE *table, const KEY& key)
+    // Insert into the specified 'table' an entry having the specified 'key',
+    // if it has none.  Return 'true' if an entry was inserted, and 'false'
+    // otherwise.
+{
+    bool              found;
+    bsl::uint64_t     hash;
+    const bsl::size_t index = table->findOrPrepareInsert(&found, &hash, key);
+
+    if (!found) {
+        bslma::ConstructionUtil::construct(table->entries() + index,
+                                           table->allocator(),
+                                           key);
+        table->commitInsert(index, hash);
+    }
+    return !found;
+}
+
+template <class TABLE, class KEY, class VALUE>
+bool insertEntry(TABLE *table, const bsl::pair<const KEY, VALUE>& entry)
+    // Insert into the specified 'table' a copy of the specified 'entry', if
+    // it has no entry having the key of 'entry'.  Return 'true' if an entry
+    // was inserted, and 'false' otherwise.
+{
+    bool              found;
+    bsl::uint64_t     hash;
+    const bsl::size_t index =
+                      table->findOrPrepareInsert(&found, &hash, entry.first);
+
+    if (!found) {
+        bslma::ConstructionUtil::construct(table->entries() + index,
+                                           table->allocator(),
+                                           entry);
+        table->commitInsert(index, hash);
+    }
+    return !found;
+}
+
+template <class TABLE, class KEY>
+bool eraseEntry(TABLE *table, const KEY& key)
+    // Erase from the specified 'table' the entry having the specified 'key',
+    // if any.  Return 'true' if an entry was erased, and 'false' otherwise.
+{
+    const bsl::size_t index = table->find(key);
+
+    if (index == table->capacity()) {
+        return false;                                                 // RETURN
+    }
+    table->erase(index);
+    return true;
+}
+
+template <class TABLE, class KEY>
+bool matchesOracle(const TABLE& table, const bsl::set<KEY>& oracle)
+    // Return 'true' if the specified 'table' holds exactly the keys of the
+    // specified 'oracle', each exactly once, and 'false' otherwise.
+{
+    if (table.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::size_t count = 0;
+    for (typename TABLE::ConstIterator it = table.begin();
+         it != table.end();
+         ++it) {
+        if (0 == oracle.count(*it)) {
+            return false;                                             // RETURN
+        }
+        ++count;
+    }
+    if (count != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (typename bsl::set<KEY>::const_iterator it = oracle.begin();
+         it != oracle.end();
+         ++it) {
+        const bsl::size_t index = table.find(*it);
+        if (index == table.capacity() || !(table.entries()[index] == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class TABLE, class KEY>
+void testRandomOperations(TABLE         *table,
+                          const KEY&   (*makeKey)(int, KEY *),
+                          bsl::uint64_t  seed)
+    // Apply a pseudo-random sequence, derived from the specified 'seed', of
+    // insertions and removals of keys created by the specified 'makeKey' to
+    // the specified empty 'table', and to a 'bsl::set' oracle, verifying that
+    // they agree.
+{
+    bsl::set<KEY> oracle(table->allocator());
+    bsl::uint64_t state = seed;
+
+    const TABLE& X = *table;
+
+    for (int round = 0; round < 4; ++round) {
+        const int range = 64 << (2 * round);
+
+        for (int i = 0; i < 4 * range; ++i) {
+            KEY                 buffer;
+            const bsl::uint64_t r   = nextRandom(&state);
+            const KEY&          key = makeKey(static_cast<int>(r % range),
+                                              &buffer);
+
+            if (r & 0x300) {
+                const bool inserted = oracle.insert(key).second;
+                ASSERTV(round, i, inserted == insertEntry(table, key));
+            }
+            else {
+                const bool erased = 0 != oracle.erase(key);
+                ASSERTV(round, i, erased == eraseEntry(table, key));
+            }
+            ASSERTV(round, i, oracle.size() == X.size());
+            ASSERTV(round, i, X.size() <= ImpUtil::maxLoad(X.capacity()));
+        }
+        ASSERTV(round, matchesOracle(X, oracle));
+
+        table->rehash(0);
+        ASSERTV(round, matchesOracle(X, oracle));
+        ASSERTV(round, ImpUtil::capacityForSize(X.size()) == X.capacity());
+    }
+
+    table->clear();
+    ASSERT(0 == X.size());
+    ASSERT(X.begin() == X.end());
+}
+
+const int& makeInt(int value, int *buffer)
+    // Load the specified 'value' into the specified 'buffer', and return a
+    // reference to 'buffer'.
+{
+    *buffer = value;
+    return *buffer;
+}
+
+const bsl::string& makeStringKey(int value, bsl::string *buffer)
+    // Load into the specified 'buffer' the result of 'makeString(value)', and
+    // return a reference to 'buffer'.
+{
+    *buffer = makeString(value);
+    return *buffer;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same entries as the original, uses the allocator
+        //:   supplied, and reclaims the erased slots of the original.
+        //:
+        //: 2 Moving with the same allocator takes ownership of the slots of
+        //:   the original, without allocating, and leaves it with no slots.
+        //:
+        //: 3 Moving with a different allocator moves the entries into slots
+        //:   obtained from the allocator supplied.
+        //:
+        //: 4 Assignment and 'swap' exchange the entries and the functors.
+        //:
+        //: 5 'isEqual' compares entries by key and by value.
+        //
+        // Plan:
+        //: 1 Build a table of strings, erase some of them, and copy, move,
+        //:   assign, and swap it, using two test allocators, verifying the
+        //:   entries against an oracle and the allocators' counters.
+        //:   (C-1..4)
+        //:
+        //: 2 Compare tables of pairs that differ in one value.  (C-5)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable&, Allocator *);
+        //   FlatHashTable(MovableRef<FlatHashTable>);
+        //   FlatHashTable(MovableRef<FlatHashTable>, Allocator *);
+        //   FlatHashTable& operator=(const FlatHashTable&);
+        //   FlatHashTable& operator=(MovableRef<FlatHashTable>);
+        //   void swap(FlatHashTable& other);
+        //   const EQUAL& equalityFunctor() const;
+        //   const HASH& hashFunctor() const;
+        //   bool isEqual(const FlatHashTable& other) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND EQUALITY" << endl
+                          << "==============================" << endl;
+
+        typedef bdlc::FlatHashTable<bsl::string,
+                                    bsl::string,
+                                    IdentityUtil,
+                                    StringHash,
+                                    bsl::equal_to<bsl::string> > Obj;
+        typedef bslmf::MovableRefUtil                            MoveUtil;
+
+        bslma::TestAllocator oa("other", veryVeryVerbose);
+
+        bsl::set<bsl::string> oracle(&ta);
+
+        Obj mX(0, StringHash(), bsl::equal_to<bsl::string>(), &ta);
+        const Obj& X = mX;
+
+        for (int i = 0; i < 200; ++i) {
+            insertEntry(&mX, makeString(i));
+            oracle.insert(makeString(i));
+        }
+        for (int i = 0; i < 200; i += 3) {
+            eraseEntry(&mX, makeString(i));
+            oracle.erase(makeString(i));
+        }
+        ASSERT(matchesOracle(X, oracle));
+
+        if (verbose) cout << "\tCopy construction." << endl;
+        {
+            const bsls::Types::Int64 numBlocks = oa.numBlocksInUse();
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+
+            ASSERT(&oa == Y.allocator());
+            ASSERT(matchesOracle(Y, oracle));
+            ASSERT(ImpUtil::capacityForSize(X.size()) == Y.capacity());
+            ASSERT(oa.numBlocksInUse() ==
+                   numBlocks + 1 + static_cast<bsls::Types::Int64>(Y.size()));
+            ASSERT(X.isEqual(Y));
+            ASSERT(Y.isEqual(X));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tMove construction." << endl;
+        {
+            Obj mY(X, &ta);  const Obj& Y = mY;
+
+            const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+
+            Obj mZ(MoveUtil::move(mY));  const Obj& Z = mZ;
+
+            ASSERT(numBlocks == ta.numBlocksTotal());
+            ASSERT(&ta == Z.allocator());
+            ASSERT(matchesOracle(Z, oracle));
+            ASSERT(0 == Y.size());
+            ASSERT(0 == Y.capacity());
+            ASSERT(Y.begin() == Y.end());
+
+            Obj mW(MoveUtil::move(mZ), &ta);  const Obj& W = mW;
+
+            ASSERT(numBlocks == ta.numBlocksTotal());
+            ASSERT(matchesOracle(W, oracle));
+            ASSERT(0 == Z.capacity());
+
+            Obj mV(MoveUtil::move(mW), &oa);  const Obj& V = mV;
+
+            ASSERT(&oa == V.allocator());
+            ASSERT(matchesOracle(V, oracle));
+            ASSERT(W.size() == V.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tAssignment and swap." << endl;
+        {
+            Obj mY(0, StringHash(), bsl::equal_to<bsl::string>(), &oa);
+            const Obj& Y = mY;
+
+            insertEntry(&mY, bsl::string("only"));
+
+            mY = X;
+            ASSERT(&oa == Y.allocator());
+            ASSERT(matchesOracle(Y, oracle));
+
+            mY = Y;
+            ASSERT(matchesOracle(Y, oracle));
+
+            Obj mZ(0, StringHash(), bsl::equal_to<bsl::string>(), &oa);
+            const Obj& Z = mZ;
+
+            mZ = MoveUtil::move(mY);
+            ASSERT(matchesOracle(Z, oracle));
+            ASSERT(0 == Y.size());
+
+            mY = MoveUtil::move(mX);                  // different allocator
+            ASSERT(&oa == Y.allocator());
+            ASSERT(matchesOracle(Y, oracle));
+
+            Obj mW(0, StringHash(), bsl::equal_to<bsl::string>(), &oa);
+            const Obj& W = mW;
+
+            insertEntry(&mW, bsl::string("only"));
+
+            mW.swap(mY);
+            ASSERT(matchesOracle(W, oracle));
+            ASSERT(1 == Y.size());
+            ASSERT(Y.find("only") < Y.capacity());
+
+            ASSERT(0 == mY.hashFunctor()(bsl::string()) -
+                                           StringHash()(bsl::string()));
+            ASSERT(mY.equalityFunctor()(bsl::string("a"), bsl::string("a")));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tEquality of pairs." << endl;
+        {
+            typedef bsl::pair<const int, int>       Pair;
+            typedef bdlc::FlatHashTable<int,
+                                        Pair,
+                                        PairUtil,
+                                        bsl::hash<int>,
+                                        bsl::equal_to<int> > PairObj;
+
+            PairObj mY(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            PairObj mZ(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+
+            for (int i = 0; i < 50; ++i) {
+                insertEntry(&mY, Pair(i, i * i));
+                insertEntry(&mZ, Pair(49 - i, (49 - i) * (49 - i)));
+            }
+            ASSERT(mY.isEqual(mZ));
+            ASSERT(mZ.isEqual(mY));
+
+            mZ.entries()[mZ.find(7)].second = 0;
+            ASSERT(!mY.isEqual(mZ));
+            ASSERT(!mZ.isEqual(mY));
+
+            mZ.erase(mZ.find(7));
+            ASSERT(!mY.isEqual(mZ));
+
+            insertEntry(&mZ, Pair(7, 49));
+            ASSERT(mY.isEqual(mZ));
+
+            insertEntry(&mZ, Pair(50, 0));
+            ASSERT(!mY.isEqual(mZ));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // INSERTION, LOOKUP, AND REMOVAL
+        //
+        // Concerns:
+        //: 1 The table holds exactly the entries inserted and not removed, and
+        //:   finds each of them, on any sequence of insertions and removals.
+        //:
+        //: 2 The load (full and erased slots) never exceeds 7/8 of the
+        //:   capacity, and erased slots are reclaimed, so that a table whose
+        //:   size is bounded does not grow without bound.
+        //:
+        //: 3 Keys whose hash values collide in the same group are probed
+        //:   across groups, and erasing in a full group does not break the
+        //:   probe sequences that pass over it.
+        //:
+        //: 4 Rehashing moves entries that are not bitwise movable, and
+        //:   destroys the originals, without leaking memory.
+        //:
+        //: 5 'reserve' allocates once, after which inserting up to the number
+        //:   of entries reserved does not allocate.
+        //:
+        //: 6 'iteratorAt' and 'begin' skip empty and erased slots.
+        //:
+        //: 7 No memory is obtained from the default allocator.
+        //
+        // Plan:
+        //: 1 Apply pseudo-random sequences of insertions and removals to
+        //:   tables of 'int' and of 'bsl::string', with a well-distributed
+        //:   hash functor and with a constant one, verifying the table
+        //:   against a 'bsl::set' oracle.  (C-1..4, 7)
+        //:
+        //: 2 Repeatedly insert and erase distinct keys, keeping the size
+        //:   bounded, and verify the capacity stays bounded.  (C-2)
+        //:
+        //: 3 Reserve space and verify the number of allocations.  (C-5)
+        //:
+        //: 4 Erase entries and compare 'iteratorAt' with a direct scan.  (C-6)
+        //
+        // Testing:
+        //   FlatHashTable(size_t, const HASH&, const EQUAL&, Allocator *);
+        //   ~FlatHashTable();
+        //   Iterator begin();
+        //   void clear();
+        //   Iterator end();
+        //   ENTRY *entries();
+        //   void erase(size_t index);
+        //   size_t findOrPrepareInsert(bool *, uint64_t *, const KEY&);
+        //   void commitInsert(size_t index, uint64_t mixedHash);
+        //   Iterator iteratorAt(size_t index);
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numEntries);
+        //   ConstIterator begin() const;
+        //   size_t capacity() const;
+        //   ConstIterator end() const;
+        //   const ENTRY *entries() const;
+        //   size_t find(const KEY& key) const;
+        //   ConstIterator iteratorAt(size_t index) const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERTION, LOOKUP, AND REMOVAL" << endl
+                          << "==============================" << endl;
+
+        typedef bdlc::FlatHashTable<int,
+                                    int,
+                                    IdentityUtil,
+                                    bsl::hash<int>,
+                                    bsl::equal_to<int> >          IntObj;
+        typedef bdlc::FlatHashTable<int,
+                                    int,
+                                    IdentityUtil,
+                                    ConstantHash,
+                                    bsl::equal_to<int> >          CollidingObj;
+        typedef bdlc::FlatHashTable<bsl::string,
+                                    bsl::string,
+                                    IdentityUtil,
+                                    StringHash,
+                                    bsl::equal_to<bsl::string> >  StringObj;
+        typedef bdlc::FlatHashTable<bsl::string,
+                                    bsl::string,
+                                    IdentityUtil,
+                                    ConstantHash,
+                                    bsl::equal_to<bsl::string> >
+                                                            CollidingStringObj;
+
+        if (verbose) cout << "\tPseudo-random operations." << endl;
+
+        for (bsl::uint64_t seed = 1; seed <= 4; ++seed) {
+            {
+                IntObj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+                testRandomOperations(&mX, &makeInt, seed);
+
+                StringObj mY(0,
+                             StringHash(),
+                             bsl::equal_to<bsl::string>(),
+                             &ta);
+                testRandomOperations(&mY, &makeStringKey, seed);
+            }
+            ASSERTV(seed, 0 == ta.numBlocksInUse());
+        }
+        {
+            CollidingObj mX(0, ConstantHash(), bsl::equal_to<int>(), &ta);
+            testRandomOperations(&mX, &makeInt, 5);
+
+            CollidingStringObj mY(0,
+                                  ConstantHash(),
+                                  bsl::equal_to<bsl::string>(),
+                                  &ta);
+            testRandomOperations(&mY, &makeStringKey, 6);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tErased slots are reclaimed." << endl;
+        {
+            IntObj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const IntObj& X = mX;
+
+            for (int i = 0; i < 100000; ++i) {
+                ASSERTV(i, insertEntry(&mX, i));
+                if (i >= 50) {
+                    ASSERTV(i, eraseEntry(&mX, i - 50));
+                }
+                ASSERTV(i, X.size() <= 50);
+            }
+            ASSERTV(X.capacity(), X.capacity() <= 128);
+
+            for (int i = 100000 - 50; i < 100000; ++i) {
+                ASSERTV(i, X.find(i) < X.capacity());
+                ASSERTV(i, X.entries()[X.find(i)] == i);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\t'reserve' and 'rehash'." << endl;
+        {
+            IntObj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const IntObj& X = mX;
+
+            ASSERT(0 == X.capacity());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.find(1) == X.capacity());
+
+            const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+
+            mX.reserve(1000);
+            ASSERT(numBlocks + 1 == ta.numBlocksTotal());
+            ASSERT(1000 <= ImpUtil::maxLoad(X.capacity()));
+
+            for (int i = 0; i < 1000; ++i) {
+                insertEntry(&mX, i);
+            }
+            ASSERT(numBlocks + 1 == ta.numBlocksTotal());
+            ASSERT(1000 == X.size());
+
+            mX.reserve(10);
+            ASSERT(numBlocks + 1 == ta.numBlocksTotal());
+
+            mX.rehash(8192);
+            ASSERT(8192 == X.capacity());
+            ASSERT(1000 == X.size());
+
+            mX.rehash(0);
+            ASSERT(ImpUtil::capacityForSize(1000) == X.capacity());
+
+            mX.clear();
+            ASSERT(0 == X.size());
+            ASSERT(0 < X.capacity());
+
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksInUse());
+
+            IntObj mY(100, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            ASSERT(128 == mY.capacity());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tIteration skips empty slots." << endl;
+        {
+            IntObj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const IntObj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                insertEntry(&mX, i);
+            }
+            for (int i = 0; i < 100; i += 2) {
+                eraseEntry(&mX, i);
+            }
+
+            for (bsl::size_t index = 0; index <= X.capacity(); ++index) {
+                bsl::size_t expected = index;
+                while (expected < X.capacity()
+                    && X.find(X.entries()[expected]) != expected) {
+                    ++expected;
+                }
+
+                IntObj::ConstIterator it = X.iteratorAt(index);
+                IntObj::Iterator      mt = mX.iteratorAt(index);
+                ASSERTV(index, it == mt);
+                if (expected == X.capacity()) {
+                    ASSERTV(index, X.end() == it);
+                }
+                else {
+                    ASSERTV(index, &X.entries()[expected] == &*it);
+                    ASSERTV(index, 1 == *it % 2);
+                }
+            }
+            ASSERT(X.begin() == X.iteratorAt(0));
+            ASSERT(mX.begin() == X.begin());
+            ASSERT(mX.end() == X.end());
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ITERATOR
+        //
+        // Concerns:
+        //: 1 An iterator created at a slot that is not full advances to the
+        //:   next full slot, or to the sentinel.
+        //:
+        //: 2 Incrementing an iterator visits the full slots in order, and
+        //:   stops at the sentinel.
+        //:
+        //: 3 A 'const' iterator can be created from, and compared with, a
+        //:   non-'const' one.
+        //
+        // Plan:
+        //: 1 Iterate over hand-built arrays of control bytes and entries.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   FlatHashTable_Iterator();
+        //   FlatHashTable_Iterator(ENTRY *entry, const uint8_t *control);
+        //   FlatHashTable_Iterator(const FlatHashTable_Iterator<OTHER>&);
+        //   FlatHashTable_Iterator& operator++();
+        //   FlatHashTable_Iterator operator++(int);
+        //   ENTRY& operator*() const;
+        //   ENTRY *operator->() const;
+        //   bool operator==(const Iterator<L>&, const Iterator<R>&);
+        //   bool operator!=(const Iterator<L>&, const Iterator<R>&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ITERATOR" << endl
+                          << "========" << endl;
+
+        typedef bdlc::FlatHashTable_Iterator<bsl::pair<int, int> >   Iter;
+        typedef bdlc::FlatHashTable_Iterator<const bsl::pair<int, int> >
+                                                                     CIter;
+
+        bsl::pair<int, int> entries[8];
+        for (int i = 0; i < 8; ++i) {
+            entries[i].first  = i;
+            entries[i].second = 10 * i;
+        }
+
+        const bsl::uint8_t controls[9] = {
+            EMPTY, 0x11, ERASED, ERASED, 0x00, EMPTY, 0x7F, EMPTY, SENTINEL
+        };
+
+        Iter it(entries, controls);
+        ASSERT(1 == it->first);
+        ASSERT(10 == (*it).second);
+
+        it->second = 11;
+        ASSERT(11 == entries[1].second);
+
+        CIter cit(it);
+        ASSERT(cit == it);
+        ASSERT(it == cit);
+        ASSERT(!(cit != it));
+
+        Iter prev = it++;
+        ASSERT(1 == prev->first);
+        ASSERT(4 == it->first);
+        ASSERT(prev != it);
+
+        ASSERT(6 == (++it)->first);
+        ++it;
+
+        const Iter end(entries + 8, controls + 8);
+        ASSERT(end == it);
+        ASSERT(CIter(end) == it);
+
+        const Iter fromEmpty(entries + 7, controls + 7);
+        ASSERT(end == fromEmpty);
+
+        const Iter fromFull(entries + 4, controls + 4);
+        ASSERT(4 == fromFull->first);
+
+        int count = 0;
+        for (CIter i(entries, controls); i != end; ++i) {
+            ++count;
+        }
+        ASSERT(3 == count);
+
+        const bsl::uint8_t noSlots[1] = { SENTINEL };
+        ASSERT(CIter(0, noSlots) == CIter(0, noSlots));
+
+        Iter dflt;
+        dflt = fromFull;
+        ASSERT(fromFull == dflt);
+
+        cit = end;
+        ASSERT(end == cit);
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Iter mEnd(end);
+            ASSERT_SAFE_FAIL(++mEnd);
+            ASSERT_SAFE_FAIL(*end);
+            ASSERT_SAFE_PASS(*fromFull);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // IMPLEMENTATION UTILITY
+        //
+        // Concerns:
+        //: 1 'capacityForSize' returns the smallest power of two no less than
+        //:   8 whose maximum load is no less than its argument, and 0 for 0.
+        //:
+        //: 2 'maxLoad' is 7/8 of the capacity.
+        //:
+        //: 3 'firstGroup' returns the index of the first slot of a group
+        //:   within the table.
+        //:
+        //: 4 'mix' spreads consecutive integers over the groups and control
+        //:   bytes.
+        //:
+        //: 5 'resetControls' sets each control byte to empty, followed by the
+        //:   sentinel.
+        //
+        // Plan:
+        //: 1 Compare with direct computations over a range of arguments.
+        //:   (C-1..3, 5)
+        //:
+        //: 2 Mix consecutive integers, and verify every control value and
+        //:   every group of a table of 1024 slots is used.  (C-4)
+        //
+        // Testing:
+        //   static size_t capacityForSize(size_t size);
+        //   static size_t firstGroup(uint64_t mixedHash, size_t capacity);
+        //   static uint64_t mix(size_t hashCode);
+        //   static size_t maxLoad(size_t capacity);
+        //   static void resetControls(uint8_t *controls, size_t capacity);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "IMPLEMENTATION UTILITY" << endl
+                          << "======================" << endl;
+
+        ASSERT(0 == ImpUtil::capacityForSize(0));
+        for (bsl::size_t size = 1; size < 5000; ++size) {
+            const bsl::size_t capacity = ImpUtil::capacityForSize(size);
+
+            ASSERTV(size, 8 <= capacity);
+            ASSERTV(size, 0 == (capacity & (capacity - 1)));
+            ASSERTV(size, size <= ImpUtil::maxLoad(capacity));
+            ASSERTV(size, 8 == capacity
+                       || size > ImpUtil::maxLoad(capacity / 2));
+        }
+
+        for (bsl::size_t capacity = 8; capacity <= 1024; capacity *= 2) {
+            ASSERTV(capacity,
+                    capacity * 7 / 8 == ImpUtil::maxLoad(capacity));
+
+            for (bsl::uint64_t h = 0; h < 4096; ++h) {
+                const bsl::uint64_t mixed = ImpUtil::mix(h);
+                const bsl::size_t   group = ImpUtil::firstGroup(mixed,
+                                                                capacity);
+
+                ASSERTV(capacity, h, group < capacity);
+                ASSERTV(capacity, h, 0 == group % 8);
+            }
+        }
+
+        {
+            bool controlUsed[128] = { false };
+            bool groupUsed[128]   = { false };
+
+            for (bsl::size_t h = 0; h < 8192; ++h) {
+                const bsl::uint64_t mixed = ImpUtil::mix(h);
+
+                controlUsed[mixed & 0x7F] = true;
+                groupUsed[ImpUtil::firstGroup(mixed, 1024) / 8] = true;
+            }
+            for (int i = 0; i < 128; ++i) {
+                ASSERTV(i, controlUsed[i]);
+                ASSERTV(i, groupUsed[i]);
+            }
+        }
+
+        {
+            bsl::uint8_t controls[33];
+            bsl::memset(controls, 0x12, sizeof controls);
+
+            ImpUtil::resetControls(controls, 32);
+            for (int i = 0; i < 32; ++i) {
+                ASSERTV(i, EMPTY == controls[i]);
+            }
+            ASSERT(SENTINEL == controls[32]);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // GROUP CONTROL
+        //
+        // Concerns:
+        //: 1 'matchEmpty', 'matchEmptyOrErased', and 'matchFull' select
+        //:   exactly the control bytes of the corresponding kinds.
+        //:
+        //: 2 'match' selects every control byte equal to its argument, and
+        //:   selects a byte not equal to it only if a byte at a lower address
+        //:   equals it.
+        //:
+        //: 3 'firstIndex' and 'removeFirst' traverse the bytes selected in
+        //:   increasing address order.
+        //:
+        //: 4 A group may be loaded from an unaligned address.
+        //
+        // Plan:
+        //: 1 For pseudo-random groups of control bytes (at unaligned
+        //:   addresses), compare the masks with a byte-by-byte computation.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   static int firstIndex(BitMask mask);
+        //   static BitMask removeFirst(BitMask mask);
+        //   FlatHashTable_GroupControl(const bsl::uint8_t *controls);
+        //   BitMask match(bsl::uint8_t value) const;
+        //   BitMask matchEmpty() const;
+        //   BitMask matchEmptyOrErased() const;
+        //   BitMask matchFull() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GROUP CONTROL" << endl
+                          << "=============" << endl;
+
+        bsl::uint64_t state = 12345;
+
+        for (int iteration = 0; iteration < 20000; ++iteration) {
+            bsl::uint8_t buffer[9];
+            bsl::uint8_t *controls = buffer + (iteration & 1);
+
+            // Draw most bytes from a small set of values, so that equal
+            // neighbors are common.
+
+            for (int i = 0; i < 8; ++i) {
+                const bsl::uint64_t r = nextRandom(&state);
+                switch (r % 6) {
+                  case 0:  controls[i] = EMPTY;                          break;
+                  case 1:  controls[i] = ERASED;                         break;
+                  case 2:  controls[i] = 0x00;                           break;
+                  case 3:  controls[i] = 0x01;                           break;
+                  default: controls[i] = static_cast<bsl::uint8_t>(
+                                                           (r >> 8) & 0x7F);
+                }
+            }
+
+            const GroupControl X(controls);
+
+            bool empty[8], emptyOrErased[8], full[8];
+            for (int i = 0; i < 8; ++i) {
+                empty[i]         = EMPTY == controls[i];
+                emptyOrErased[i] = EMPTY == controls[i]
+                                                    || ERASED == controls[i];
+                full[i]          = controls[i] < 0x80;
+            }
+
+            const BitMask MASKS[] = {
+                X.matchEmpty(), X.matchEmptyOrErased(), X.matchFull()
+            };
+            const bool *EXPECTED[] = { empty, emptyOrErased, full };
+
+            for (int m = 0; m < 3; ++m) {
+                BitMask mask = MASKS[m];
+                for (int i = 0; i < 8; ++i) {
+                    const bool selected =
+                                   0 != (mask & (0x80ULL << (8 * i)));
+                    ASSERTV(iteration, m, i, EXPECTED[m][i] == selected);
+                }
+                ASSERTV(iteration, m,
+                        0 == (mask & ~0x8080808080808080ULL));
+
+                int previous = -1;
+                while (mask) {
+                    const int index = GroupControl::firstIndex(mask);
+                    ASSERTV(iteration, m, index, previous < index);
+                    ASSERTV(iteration, m, index, EXPECTED[m][index]);
+                    previous = index;
+                    mask     = GroupControl::removeFirst(mask);
+                }
+            }
+
+            const bsl::uint8_t value = static_cast<bsl::uint8_t>(
+                                                nextRandom(&state) % 3 == 0
+                                                ? nextRandom(&state) & 0x7F
+                                                : controls[0] & 0x7F);
+            const BitMask match = X.match(value);
+
+            bool seen = false;
+            for (int i = 0; i < 8; ++i) {
+                const bool selected = 0 != (match & (0x80ULL << (8 * i)));
+                if (controls[i] == value) {
+                    ASSERTV(iteration, i, selected);
+                }
+                else if (selected) {
+                    ASSERTV(iteration, i, seen);
+                }
+                seen = seen || controls[i] == value;
+            }
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bsl::uint8_t controls[8] = { 0 };
+            const GroupControl X(controls);
+
+            ASSERT_SAFE_FAIL(GroupControl::firstIndex(0));
+            ASSERT_SAFE_PASS(GroupControl::firstIndex(0x80));
+            ASSERT_SAFE_FAIL(GroupControl::removeFirst(0));
+            ASSERT_SAFE_FAIL(X.match(0x80));
+            ASSERT_SAFE_PASS(X.match(0x7F));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, iterate over, and erase a few entries.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        typedef bdlc::FlatHashTable<int,
+                                    int,
+                                    IdentityUtil,
+                                    bsl::hash<int>,
+                                    bsl::equal_to<int> > Obj;
+
+        Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+        const Obj& X = mX;
+
+        ASSERT(0 == X.size());
+        ASSERT(0 == X.capacity());
+        ASSERT(0 == ta.numBlocksTotal());
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERTV(i, insertEntry(&mX, i * 7));
+            ASSERTV(i, !insertEntry(&mX, i * 7));
+        }
+        ASSERT(100 == X.size());
+        ASSERT(128 == X.capacity());
+
+        int sum = 0;
+        for (Obj::ConstIterator it = X.begin(); it != X.end(); ++it) {
+            sum += *it;
+        }
+        ASSERT(7 * 99 * 100 / 2 == sum);
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERTV(i, X.find(i * 7) < X.capacity());
+            ASSERTV(i, X.capacity() == X.find(i * 7 + 1));
+        }
+
+        for (int i = 0; i < 100; i += 2) {
+            ASSERTV(i, eraseEntry(&mX, i * 7));
+            ASSERTV(i, !eraseEntry(&mX, i * 7));
+        }
+        ASSERT(50 == X.size());
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
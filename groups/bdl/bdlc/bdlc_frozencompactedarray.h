@@ -0,0 +1,520 @@
+// bdlc_frozencompactedarray.h                                        -*-C++-*-
+#ifndef INCLUDED_BDLC_FROZENCOMPACTEDARRAY
+#define INCLUDED_BDLC_FROZENCOMPACTEDARRAY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an immutable compacted array for concurrent read access.
+//
+//@CLASSES:
+//  bdlc::FrozenCompactedArray: immutable compacted array of 'TYPE' objects
+//
+//@SEE_ALSO: bdlc_compactedarray
+//
+//@DESCRIPTION: This component provides a value-semantic array,
+// 'bdlc::FrozenCompactedArray', having the space-efficient, deduplicated
+// representation of a 'bdlc::CompactedArray' (see 'bdlc_compactedarray'), but
+// whose value is fixed at construction.  A 'FrozenCompactedArray' provides
+// no manipulators (not even assignment), so that, once constructed, it can be
+// shared among any number of threads (e.g., by means of a
+// 'bsl::shared_ptr<const bdlc::FrozenCompactedArray<TYPE> >') that index it
+// concurrently without synchronization.
+//
+// A 'FrozenCompactedArray' is created by taking over the value of a
+// 'bdlc::CompactedArray' (in constant time, when both use the same
+// allocator), by copying another 'FrozenCompactedArray', or directly from a
+// sequence of values, which is bulk-loaded by 'bdlc::CompactedArray::assign'
+// (see the "Bulk Loading" section of 'bdlc_compactedarray').  The 'array'
+// accessor provides non-modifiable access to the underlying
+// 'bdlc::CompactedArray', and hence to its complete set of accessors.
+//
+// Like 'bdlc::CompactedArray', this class provides dictionary access to its
+// elements: 'uniqueElementIndex' and 'loadUniqueElementIndices' return the
+// index of the unique value of one or more elements within the sorted sequence
+// of unique values, so that scans can operate on small integral codes and
+// consult each unique value only once.
+//
+///Thread Safety
+///-------------
+// 'FrozenCompactedArray' is *fully* *thread-safe*, in that all of its
+// non-creator methods may be invoked concurrently from any number of threads
+// on the same object.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Aggregating a Market-Data Column by Dictionary Code
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we load a day of trades, each having the code of the exchange on
+// which it was executed, and the traded volume.  There are millions of trades
+// but only a handful of exchanges, and the trades are analyzed, once loaded,
+// by several threads.
+//
+// First, we load the exchange column directly into a frozen array (here, from
+// a small sample of trades):
+//..
+//  const char *exchanges[] = { "XNYS", "XNAS", "XNYS", "BATS", "XNAS",
+//                              "XNYS", "XNYS", "BATS", "XNAS", "XNYS" };
+//  const int   volumes[]   = {   100,    200,    300,    400,    500,
+//                                600,    700,    800,    900,   1000 };
+//  const int   numTrades   = 10;
+//
+//  typedef bdlc::FrozenCompactedArray<bsl::string> ExchangeColumn;
+//
+//  const ExchangeColumn column(exchanges, exchanges + numTrades);
+//
+//  assert(10 == column.length());
+//  assert( 3 == column.uniqueLength());
+//..
+// Then, we observe that the unique values are sorted, and that the number of
+// trades on each exchange is available directly:
+//..
+//  assert("BATS" == column.uniqueElement(0));
+//  assert("XNAS" == column.uniqueElement(1));
+//  assert("XNYS" == column.uniqueElement(2));
+//
+//  assert(2 == column.uniqueElementCount(0));
+//  assert(3 == column.uniqueElementCount(1));
+//  assert(5 == column.uniqueElementCount(2));
+//..
+// Next, we compute the volume traded on each exchange, decoding the exchange
+// codes of the trades in bulk and accumulating by code, without comparing any
+// strings:
+//..
+//  bsl::vector<bsl::size_t> codes(numTrades);
+//  column.loadUniqueElementIndices(codes.data(), 0, numTrades);
+//
+//  bsl::vector<int> volumeByExchange(column.uniqueLength(), 0);
+//  for (int i = 0; i < numTrades; ++i) {
+//      volumeByExchange[codes[i]] += volumes[i];
+//  }
+//..
+// Finally, we verify the aggregated volumes:
+//..
+//  assert(1200 == volumeByExchange[0]);  // BATS
+//  assert(1600 == volumeByExchange[1]);  // XNAS
+//  assert(2700 == volumeByExchange[2]);  // XNYS
+//..
+// Note that 'column' could equally have been shared among threads, each
+// aggregating a different range of trades.
+
+#include <bdlscm_version.h>
+
+#include <bdlc_compactedarray.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_iosfwd.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                        // ==========================
+                        // class FrozenCompactedArray
+                        // ==========================
+
+template <class TYPE>
+class FrozenCompactedArray {
+    // This space-efficient, value-semantic array class represents an
+    // immutable sequence of 'TYPE' elements, represented as a
+    // 'CompactedArray<TYPE>'.  The value of an object of this class is fixed
+    // at construction; this class provides no manipulators.
+
+    // DATA
+    CompactedArray<TYPE> d_array;  // the represented array
+
+  private:
+    // NOT IMPLEMENTED
+    FrozenCompactedArray& operator=(const FrozenCompactedArray&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FrozenCompactedArray,
+                                   bslma::UsesBslmaAllocator);
+
+    // PUBLIC TYPES
+    typedef TYPE value_type;  // The type for elements.
+
+    typedef typename CompactedArray<TYPE>::const_iterator const_iterator;
+
+    // CREATORS
+    explicit FrozenCompactedArray(bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'FrozenCompactedArray'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    explicit FrozenCompactedArray(CompactedArray<TYPE> *array,
+                                  bslma::Allocator     *basicAllocator = 0);
+        // Create a 'FrozenCompactedArray' having the value of the specified
+        // 'array', and leave 'array' empty.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  This
+        // constructor takes over the representation of 'array' in constant
+        // time if 'array' uses the same allocator as this object, and copies
+        // it otherwise.  The behavior is undefined unless '0 != array'.
+
+    template <class INPUT_ITERATOR>
+    FrozenCompactedArray(INPUT_ITERATOR    first,
+                         INPUT_ITERATOR    last,
+                         bslma::Allocator *basicAllocator = 0);
+        // Create a 'FrozenCompactedArray' having the sequence of values in
+        // the range starting at the specified 'first' and ending immediately
+        // before the specified 'last' iterator.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  'TYPE' must be
+        // equality-comparable and hashable with 'bslh::Hash<>', and values
+        // comparing equal must be equivalent under 'operator<'.  The behavior
+        // is undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'first' is at a position at or before 'last'.  Note
+        // that the sequence is loaded by 'CompactedArray<TYPE>::assign'.
+
+    FrozenCompactedArray(const FrozenCompactedArray&  original,
+                         bslma::Allocator            *basicAllocator = 0);
+        // Create a 'FrozenCompactedArray' having the same value as the
+        // specified 'original' object.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    //! ~FrozenCompactedArray() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    const TYPE& operator[](bsl::size_t index) const;
+        // Return a 'const' reference to the element at the specified 'index'
+        // in this array.  The behavior is undefined unless 'index < length()'.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this array to supply memory.
+
+    const CompactedArray<TYPE>& array() const;
+        // Return a 'const' reference to the 'CompactedArray' representing the
+        // value of this array.
+
+    const_iterator begin() const;
+        // Return an iterator referring to the first element in this array, or
+        // the past-the-end iterator if this array is empty.  The iterator
+        // remains valid as long as this array exists.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator for this array.  The iterator
+        // remains valid as long as this array exists.
+
+    bool isEmpty() const;
+        // Return 'true' if there are no elements in this array, and 'false'
+        // otherwise.
+
+    bsl::size_t length() const;
+        // Return the number of elements in this array.
+
+    void loadUniqueElementIndices(bsl::size_t *result,
+                                  bsl::size_t  srcIndex,
+                                  bsl::size_t  numElements) const;
+        // Load into the specified 'result' the indices, within the sorted
+        // sequence of unique element values in this array, of the specified
+        // 'numElements' elements starting at the specified 'srcIndex'.  The
+        // behavior is undefined unless 'result' refers to an array of at
+        // least 'numElements' elements and
+        // 'srcIndex + numElements <= length()'.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Write the value of this array to the specified output 'stream' in a
+        // human-readable format, and return a reference to 'stream'.
+        // Optionally specify an initial indentation 'level', whose absolute
+        // value is incremented recursively for nested arrays.  If 'level' is
+        // specified, optionally specify 'spacesPerLevel', whose absolute value
+        // indicates the number of spaces per indentation level for this and
+        // all of its nested arrays.  If 'level' is negative, format the entire
+        // output on one line, suppressing all but the initial indentation (as
+        // governed by 'level').  If 'stream' is not valid on entry, this
+        // operation has no effect.  Note that the format is not fully
+        // specified, and can change without notice.
+
+    const TYPE& uniqueElement(bsl::size_t index) const;
+        // Return a 'const' reference to the element at the specified 'index'
+        // within the sorted sequence of unique element values in this array.
+        // The behavior is undefined unless 'index < uniqueLength()'.
+
+    bsl::size_t uniqueElementCount(bsl::size_t index) const;
+        // Return the number of elements in this array having the value of the
+        // unique element at the specified 'index' within the sorted sequence
+        // of unique element values in this array.  The behavior is undefined
+        // unless 'index < uniqueLength()'.
+
+    bsl::size_t uniqueElementIndex(bsl::size_t index) const;
+        // Return the index, within the sorted sequence of unique element
+        // values in this array, of the element at the specified 'index' in
+        // this array.  The behavior is undefined unless 'index < length()'.
+
+    bsl::size_t uniqueLength() const;
+        // Return the number of unique elements in this array.
+};
+
+// FREE OPERATORS
+template <class TYPE>
+bsl::ostream& operator<<(bsl::ostream&                     stream,
+                         const FrozenCompactedArray<TYPE>& array);
+    // Write the value of the specified 'array' to the specified output
+    // 'stream' in a single-line format, and return a reference providing
+    // modifiable access to 'stream'.  If 'stream' is not valid on entry, this
+    // operation has no effect.  Note that this human-readable format is not
+    // fully specified and can change without notice.
+
+template <class TYPE>
+bool operator==(const FrozenCompactedArray<TYPE>& lhs,
+                const FrozenCompactedArray<TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' arrays have the same
+    // value, and 'false' otherwise.  Two 'FrozenCompactedArray' arrays have
+    // the same value if they have the same length, and all corresponding
+    // elements (those at the same indices) have the same value.
+
+template <class TYPE>
+bool operator!=(const FrozenCompactedArray<TYPE>& lhs,
+                const FrozenCompactedArray<TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' arrays do not have the
+    // same value, and 'false' otherwise.  Two 'FrozenCompactedArray' arrays do
+    // not have the same value if they do not have the same length, or if any
+    // corresponding elements (those at the same indices) do not have the same
+    // value.
+
+// HASH SPECIALIZATIONS
+template <class HASHALG, class TYPE>
+void hashAppend(HASHALG& hashAlg, const FrozenCompactedArray<TYPE>& input);
+    // Pass the specified 'input' to the specified 'hashAlg'.  Note that an
+    // array and the 'CompactedArray' representing it hash identically.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // --------------------------
+                        // class FrozenCompactedArray
+                        // --------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+FrozenCompactedArray<TYPE>::FrozenCompactedArray(
+                                              bslma::Allocator *basicAllocator)
+: d_array(basicAllocator)
+{
+}
+
+template <class TYPE>
+FrozenCompactedArray<TYPE>::FrozenCompactedArray(
+                                          CompactedArray<TYPE> *array,
+                                          bslma::Allocator     *basicAllocator)
+: d_array(basicAllocator)
+{
+    BSLS_ASSERT(array);
+
+    if (array->allocator() != d_array.allocator()) {
+        CompactedArray<TYPE> copy(*array, d_array.allocator());
+        d_array.swap(copy);
+        array->removeAll();
+    }
+    else {
+        d_array.swap(*array);
+    }
+}
+
+template <class TYPE>
+template <class INPUT_ITERATOR>
+FrozenCompactedArray<TYPE>::FrozenCompactedArray(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_array(basicAllocator)
+{
+    d_array.assign(first, last);
+}
+
+template <class TYPE>
+inline
+FrozenCompactedArray<TYPE>::FrozenCompactedArray(
+                                 const FrozenCompactedArray&  original,
+                                 bslma::Allocator            *basicAllocator)
+: d_array(original.d_array, basicAllocator)
+{
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+const TYPE& FrozenCompactedArray<TYPE>::operator[](bsl::size_t index) const
+{
+    BSLS_ASSERT(index < length());
+
+    return d_array[index];
+}
+
+template <class TYPE>
+inline
+bslma::Allocator *FrozenCompactedArray<TYPE>::allocator() const
+{
+    return d_array.allocator();
+}
+
+template <class TYPE>
+inline
+const CompactedArray<TYPE>& FrozenCompactedArray<TYPE>::array() const
+{
+    return d_array;
+}
+
+template <class TYPE>
+inline
+typename FrozenCompactedArray<TYPE>::const_iterator
+                                      FrozenCompactedArray<TYPE>::begin() const
+{
+    return d_array.begin();
+}
+
+template <class TYPE>
+inline
+typename FrozenCompactedArray<TYPE>::const_iterator
+                                        FrozenCompactedArray<TYPE>::end() const
+{
+    return d_array.end();
+}
+
+template <class TYPE>
+inline
+bool FrozenCompactedArray<TYPE>::isEmpty() const
+{
+    return d_array.isEmpty();
+}
+
+template <class TYPE>
+inline
+bsl::size_t FrozenCompactedArray<TYPE>::length() const
+{
+    return d_array.length();
+}
+
+template <class TYPE>
+inline
+void FrozenCompactedArray<TYPE>::loadUniqueElementIndices(
+                                            bsl::size_t *result,
+                                            bsl::size_t  srcIndex,
+                                            bsl::size_t  numElements) const
+{
+    BSLS_ASSERT(result || 0 == numElements);
+    BSLS_ASSERT(numElements <= length());
+    BSLS_ASSERT(srcIndex    <= length() - numElements);
+
+    d_array.loadUniqueElementIndices(result, srcIndex, numElements);
+}
+
+template <class TYPE>
+inline
+bsl::ostream& FrozenCompactedArray<TYPE>::print(
+                                            bsl::ostream& stream,
+                                            int           level,
+                                            int           spacesPerLevel) const
+{
+    return d_array.print(stream, level, spacesPerLevel);
+}
+
+template <class TYPE>
+inline
+const TYPE& FrozenCompactedArray<TYPE>::uniqueElement(bsl::size_t index) const
+{
+    BSLS_ASSERT(index < uniqueLength());
+
+    return d_array.uniqueElement(index);
+}
+
+template <class TYPE>
+inline
+bsl::size_t FrozenCompactedArray<TYPE>::uniqueElementCount(
+                                                       bsl::size_t index) const
+{
+    BSLS_ASSERT(index < uniqueLength());
+
+    return d_array.uniqueElementCount(index);
+}
+
+template <class TYPE>
+inline
+bsl::size_t FrozenCompactedArray<TYPE>::uniqueElementIndex(
+                                                       bsl::size_t index) const
+{
+    BSLS_ASSERT(index < length());
+
+    return d_array.uniqueElementIndex(index);
+}
+
+template <class TYPE>
+inline
+bsl::size_t FrozenCompactedArray<TYPE>::uniqueLength() const
+{
+    return d_array.uniqueLength();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class TYPE>
+inline
+bsl::ostream& bdlc::operator<<(bsl::ostream&                     stream,
+                               const FrozenCompactedArray<TYPE>& array)
+{
+    return array.print(stream, 0, -1);
+}
+
+template <class TYPE>
+inline
+bool bdlc::operator==(const FrozenCompactedArray<TYPE>& lhs,
+                      const FrozenCompactedArray<TYPE>& rhs)
+{
+    return lhs.array() == rhs.array();
+}
+
+template <class TYPE>
+inline
+bool bdlc::operator!=(const FrozenCompactedArray<TYPE>& lhs,
+                      const FrozenCompactedArray<TYPE>& rhs)
+{
+    return lhs.array() != rhs.array();
+}
+
+// HASH SPECIALIZATIONS
+template <class HASHALG, class TYPE>
+inline
+void bdlc::hashAppend(HASHALG&                          hashAlg,
+                      const FrozenCompactedArray<TYPE>& input)
+{
+    hashAppend(hashAlg, input.array());
+}
+
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
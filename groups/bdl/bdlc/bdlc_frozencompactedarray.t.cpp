@@ -0,0 +1,754 @@
+// bdlc_frozencompactedarray.t.cpp                                    -*-C++-*-
+#include <bdlc_frozencompactedarray.h>
+
+#include <bslim_testutil.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an immutable wrapper of a
+// 'bdlc::CompactedArray'.  The concerns are that each constructor produces
+// the intended value (taking over the representation of the source array
+// when possible), that the accessors forward to the represented array, and
+// that the array can be read concurrently by several threads.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FrozenCompactedArray(bslma::Allocator *basicAllocator = 0);
+// [ 2] FrozenCompactedArray(CompactedArray *array, *bA = 0);
+// [ 2] FrozenCompactedArray(INPUT_ITERATOR first, last, *bA = 0);
+// [ 2] FrozenCompactedArray(const FrozenCompactedArray& original, *bA = 0);
+//
+// ACCESSORS
+// [ 3] const TYPE& operator[](bsl::size_t index) const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] const CompactedArray<TYPE>& array() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator end() const;
+// [ 3] bool isEmpty() const;
+// [ 3] bsl::size_t length() const;
+// [ 3] void loadUniqueElementIndices(result, si, ne) const;
+// [ 4] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+// [ 3] const TYPE& uniqueElement(bsl::size_t index) const;
+// [ 3] bsl::size_t uniqueElementCount(bsl::size_t index) const;
+// [ 3] bsl::size_t uniqueElementIndex(bsl::size_t index) const;
+// [ 3] bsl::size_t uniqueLength() const;
+//
+// FREE OPERATORS
+// [ 4] ostream& operator<<(ostream& stream, const FrozenCompactedArray& a);
+// [ 4] bool operator==(lhs, rhs);
+// [ 4] bool operator!=(lhs, rhs);
+// [ 4] void hashAppend(HASHALG&, const FrozenCompactedArray&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENT READ ACCESS
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FrozenCompactedArray<bsl::string> Obj;
+typedef bdlc::CompactedArray<bsl::string>       Array;
+typedef bdlc::FrozenCompactedArray<int>         ObjInt;
+
+// Define 'bsl::string' value long enough to ensure dynamic memory allocation.
+#define SUFFICIENTLY_LONG_STRING "1234567890123456789012345678901234567890" \
+                                 "1234567890123456789012345678901234567890"
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static void loadStrings(bsl::vector<bsl::string> *result, const char *spec)
+    // Load into the specified 'result' a long string for each character of
+    // the specified 'spec', having that character as first character.
+{
+    result->clear();
+    for (const char *p = spec; *p; ++p) {
+        result->push_back(bsl::string(1, *p) + SUFFICIENTLY_LONG_STRING);
+    }
+}
+
+enum { k_NUM_THREADS = 4, k_NUM_THREAD_VALUES = 20000 };
+
+struct ReaderArgs {
+    // This 'struct' provides the arguments of a thread reading a shared
+    // 'ObjInt'.
+
+    const ObjInt *d_array_p;  // array to read
+    const int    *d_expected_p;
+                              // expected values of the elements of the array
+    int           d_offset;   // index of the first element read
+    int           d_errors;   // number of mismatches found
+};
+
+extern "C" void *readerThread(void *arg)
+    // Read repeatedly the elements of the array described by the specified
+    // 'arg', a 'ReaderArgs' object, starting at a thread-specific offset, and
+    // count the elements whose value, or dictionary code, is not as expected.
+{
+    ReaderArgs&   args   = *static_cast<ReaderArgs *>(arg);
+    const ObjInt& X      = *args.d_array_p;
+    const int     length = static_cast<int>(X.length());
+
+    bsl::vector<bsl::size_t> codes(length);
+
+    for (int pass = 0; pass < 5; ++pass) {
+        for (int i = 0; i < length; ++i) {
+            const int index = (i + args.d_offset) % length;
+
+            if (X[index] != args.d_expected_p[index]) {
+                ++args.d_errors;
+            }
+        }
+
+        X.loadUniqueElementIndices(codes.data(), 0, length);
+        for (int i = 0; i < length; ++i) {
+            if (X.uniqueElement(codes[i]) != args.d_expected_p[i]) {
+                ++args.d_errors;
+            }
+        }
+    }
+    return 0;
+}
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Aggregating a Market-Data Column by Dictionary Code
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we load a day of trades, each having the code of the exchange on
+// which it was executed, and the traded volume.  There are millions of trades
+// but only a handful of exchanges, and the trades are analyzed, once loaded,
+// by several threads.
+//
+// First, we load the exchange column directly into a frozen array (here, from
+// a small sample of trades):
+//..
+    const char *exchanges[] = { "XNYS", "XNAS", "XNYS", "BATS", "XNAS",
+                                "XNYS", "XNYS", "BATS", "XNAS", "XNYS" };
+    const int   volumes[]   = {   100,    200,    300,    400,    500,
+                                  600,    700,    800,    900,   1000 };
+    const int   numTrades   = 10;
+
+    typedef bdlc::FrozenCompactedArray<bsl::string> ExchangeColumn;
+
+    const ExchangeColumn column(exchanges, exchanges + numTrades);
+
+    ASSERT(10 == column.length());
+    ASSERT( 3 == column.uniqueLength());
+//..
+// Then, we observe that the unique values are sorted, and that the number of
+// trades on each exchange is available directly:
+//..
+    ASSERT("BATS" == column.uniqueElement(0));
+    ASSERT("XNAS" == column.uniqueElement(1));
+    ASSERT("XNYS" == column.uniqueElement(2));
+
+    ASSERT(2 == column.uniqueElementCount(0));
+    ASSERT(3 == column.uniqueElementCount(1));
+    ASSERT(5 == column.uniqueElementCount(2));
+//..
+// Next, we compute the volume traded on each exchange, decoding the exchange
+// codes of the trades in bulk and accumulating by code, without comparing any
+// strings:
+//..
+    bsl::vector<bsl::size_t> codes(numTrades);
+    column.loadUniqueElementIndices(codes.data(), 0, numTrades);
+
+    bsl::vector<int> volumeByExchange(column.uniqueLength(), 0);
+    for (int i = 0; i < numTrades; ++i) {
+        volumeByExchange[codes[i]] += volumes[i];
+    }
+//..
+// Finally, we verify the aggregated volumes:
+//..
+    ASSERT(1200 == volumeByExchange[0]);  // BATS
+    ASSERT(1600 == volumeByExchange[1]);  // XNAS
+    ASSERT(2700 == volumeByExchange[2]);  // XNYS
+//..
+// Note that 'column' could equally have been shared among threads, each
+// aggregating a different range of trades.
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENT READ ACCESS
+        //
+        // Concerns:
+        //: 1 Several threads can read the same array concurrently, through
+        //:   'operator[]', 'loadUniqueElementIndices', and 'uniqueElement'.
+        //
+        // Plan:
+        //: 1 Create an array, share it through a 'bsl::shared_ptr' to
+        //:   'const', and have several threads read every element repeatedly,
+        //:   each starting at a different offset, and compare them with the
+        //:   expected values.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENT READ ACCESS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT READ ACCESS" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        bsl::vector<int> values(&oa);
+        for (int i = 0; i < k_NUM_THREAD_VALUES; ++i) {
+            values.push_back((i * 7919) % 1009);
+        }
+
+        bsl::shared_ptr<const ObjInt> mX;
+        mX.createInplace(&oa, values.begin(), values.end(), &oa);
+
+        ASSERT(1009 == mX->uniqueLength());
+
+        ReaderArgs                args[k_NUM_THREADS];
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+        for (int t = 0; t < k_NUM_THREADS; ++t) {
+            args[t].d_array_p    = mX.get();
+            args[t].d_expected_p = values.data();
+            args[t].d_offset     = t * (k_NUM_THREAD_VALUES / k_NUM_THREADS);
+            args[t].d_errors     = 0;
+
+            ASSERTV(t, 0 == bslmt::ThreadUtil::create(&handles[t],
+                                                      &readerThread,
+                                                      &args[t]));
+        }
+        for (int t = 0; t < k_NUM_THREADS; ++t) {
+            ASSERTV(t, 0 == bslmt::ThreadUtil::join(handles[t]));
+            ASSERTV(t, args[t].d_errors, 0 == args[t].d_errors);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // EQUALITY, PRINT, AND 'hashAppend'
+        //
+        // Concerns:
+        //: 1 Two arrays compare equal if and only if their represented
+        //:   arrays compare equal.
+        //:
+        //: 2 'print' and 'operator<<' format the elements as the represented
+        //:   array does.
+        //:
+        //: 3 An array hashes as its represented array does.
+        //
+        // Plan:
+        //: 1 For the cross product of a set of values, compare the results of
+        //:   the operators and of hashing with those of the represented
+        //:   arrays.  (C-1, 3)
+        //:
+        //: 2 Print arrays with a set of 'level' and 'spacesPerLevel' values,
+        //:   and compare the output with that of the represented array.  (C-2)
+        //
+        // Testing:
+        //   ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+        //   ostream& operator<<(ostream& stream, const Obj& a);
+        //   bool operator==(lhs, rhs);
+        //   bool operator!=(lhs, rhs);
+        //   void hashAppend(HASHALG&, const FrozenCompactedArray&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EQUALITY, PRINT, AND 'hashAppend'" << endl
+                          << "=================================" << endl;
+
+        const char *SPECS[] = { "", "a", "b", "ab", "ba", "aab", "abcabc" };
+        const int   NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        bslh::Hash<> hasher;
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            bsl::vector<bsl::string> valuesX(&oa);
+            loadStrings(&valuesX, SPECS[ti]);
+
+            const Obj X(valuesX.begin(), valuesX.end(), &oa);
+
+            for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                bsl::vector<bsl::string> valuesY(&oa);
+                loadStrings(&valuesY, SPECS[tj]);
+
+                const Obj Y(valuesY.begin(), valuesY.end(), &oa);
+
+                ASSERTV(ti, tj, (ti == tj) == (X == Y));
+                ASSERTV(ti, tj, (ti != tj) == (X != Y));
+                ASSERTV(ti, tj, (ti == tj) == (hasher(X) == hasher(Y)));
+            }
+
+            ASSERTV(ti, hasher(X.array()) == hasher(X));
+
+            const int LEVELS[] = { 0, 1, -1, 2 };
+            const int SPLS[]   = { 4, 2, -1, 0 };
+
+            for (int l = 0; l < 4; ++l) {
+                for (int s = 0; s < 4; ++s) {
+                    bsl::ostringstream expected(&oa);
+                    bsl::ostringstream actual(&oa);
+
+                    X.array().print(expected, LEVELS[l], SPLS[s]);
+                    ASSERTV(ti, &actual == &X.print(actual,
+                                                    LEVELS[l],
+                                                    SPLS[s]));
+                    ASSERTV(ti, l, s, expected.str() == actual.str());
+                }
+            }
+
+            bsl::ostringstream expected(&oa);
+            bsl::ostringstream actual(&oa);
+
+            expected << X.array();
+            actual   << X;
+            ASSERTV(ti, expected.str() == actual.str());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each accessor returns the corresponding value of the represented
+        //:   array.
+        //:
+        //: 2 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of values, compare the result of each accessor with
+        //:   that of the represented array, and with the expected elements.
+        //:   (C-1)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-2)
+        //
+        // Testing:
+        //   const TYPE& operator[](bsl::size_t index) const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bool isEmpty() const;
+        //   bsl::size_t length() const;
+        //   void loadUniqueElementIndices(result, si, ne) const;
+        //   const TYPE& uniqueElement(bsl::size_t index) const;
+        //   bsl::size_t uniqueElementCount(bsl::size_t index) const;
+        //   bsl::size_t uniqueElementIndex(bsl::size_t index) const;
+        //   bsl::size_t uniqueLength() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ACCESSORS" << endl
+                          << "=========" << endl;
+
+        const char *SPECS[] = { "", "a", "aaa", "ba", "cbacba",
+                                "abcdefghij", "zzzzyzzzzyzzzzx" };
+        const int   NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            const char *const SPEC = SPECS[ti];
+
+            if (veryVerbose) { T_ P(SPEC) }
+
+            bsl::vector<bsl::string> values(&oa);
+            loadStrings(&values, SPEC);
+
+            const Obj    X(values.begin(), values.end(), &oa);
+            const Array& A = X.array();
+
+            ASSERTV(SPEC, values.size()    == X.length());
+            ASSERTV(SPEC, values.empty()   == X.isEmpty());
+            ASSERTV(SPEC, A.uniqueLength() == X.uniqueLength());
+            ASSERTV(SPEC, A.begin()        == X.begin());
+            ASSERTV(SPEC, A.end()          == X.end());
+
+            for (bsl::size_t i = 0; i < X.length(); ++i) {
+                ASSERTV(SPEC, i, values[i] == X[i]);
+                ASSERTV(SPEC, i, &A[i]     == &X[i]);
+                ASSERTV(SPEC, i,
+                        A.uniqueElementIndex(i) == X.uniqueElementIndex(i));
+            }
+
+            for (bsl::size_t i = 0; i < X.uniqueLength(); ++i) {
+                ASSERTV(SPEC, i,
+                        &A.uniqueElement(i) == &X.uniqueElement(i));
+                ASSERTV(SPEC, i,
+                        A.uniqueElementCount(i) == X.uniqueElementCount(i));
+            }
+
+            bsl::vector<bsl::size_t> codes(X.length() + 1, 99, &oa);
+            X.loadUniqueElementIndices(codes.data(), 0, X.length());
+            for (bsl::size_t i = 0; i < X.length(); ++i) {
+                ASSERTV(SPEC, i, X.uniqueElementIndex(i) == codes[i]);
+            }
+            ASSERTV(SPEC, 99 == codes[X.length()]);
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const int    VALUES[] = { 3, 1, 3 };
+            const ObjInt X(VALUES, VALUES + 3, &oa);
+
+            bsl::size_t  codes[3];
+            bsl::size_t *nullCodes = 0;
+
+            ASSERT_SAFE_PASS(X[2]);
+            ASSERT_SAFE_FAIL(X[3]);
+
+            ASSERT_SAFE_PASS(X.uniqueElement(1));
+            ASSERT_SAFE_FAIL(X.uniqueElement(2));
+
+            ASSERT_SAFE_PASS(X.uniqueElementCount(1));
+            ASSERT_SAFE_FAIL(X.uniqueElementCount(2));
+
+            ASSERT_SAFE_PASS(X.uniqueElementIndex(2));
+            ASSERT_SAFE_FAIL(X.uniqueElementIndex(3));
+
+            ASSERT_SAFE_PASS(X.loadUniqueElementIndices(codes, 0, 3));
+            ASSERT_SAFE_PASS(X.loadUniqueElementIndices(nullCodes, 0, 0));
+            ASSERT_SAFE_FAIL(X.loadUniqueElementIndices(nullCodes, 0, 1));
+            ASSERT_SAFE_FAIL(X.loadUniqueElementIndices(codes, 1, 3));
+            ASSERT_SAFE_FAIL(X.loadUniqueElementIndices(codes, 0, 4));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS
+        //
+        // Concerns:
+        //: 1 The default constructor creates an empty array.
+        //:
+        //: 2 The constructor taking a 'CompactedArray' creates an array
+        //:   having the value of that array, and leaves that array empty.
+        //:
+        //: 3 If the source array uses the same allocator as the created
+        //:   array, its representation is taken over without allocation.
+        //:
+        //: 4 The range constructor creates an array having the values of the
+        //:   range.
+        //:
+        //: 5 The copy constructor creates an array having the value of the
+        //:   original.
+        //:
+        //: 6 Each constructor uses the specified allocator, or the default
+        //:   allocator if none is specified, and the default allocator is not
+        //:   otherwise used.
+        //:
+        //: 7 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of values, create arrays using each constructor, with
+        //:   and without an allocator, and verify their values and their
+        //:   allocators, and the use of the allocators.  (C-1..6)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-7)
+        //
+        // Testing:
+        //   FrozenCompactedArray(bslma::Allocator *basicAllocator = 0);
+        //   FrozenCompactedArray(CompactedArray *array, *bA = 0);
+        //   FrozenCompactedArray(INPUT_ITERATOR first, last, *bA = 0);
+        //   FrozenCompactedArray(const FrozenCompactedArray& original, *bA);
+        //   bslma::Allocator *allocator() const;
+        //   const CompactedArray<TYPE>& array() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS" << endl
+                          << "========" << endl;
+
+        if (verbose) cout << "\nTesting default constructor." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            const Obj X;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(X.isEmpty());
+
+            const Obj Y(&oa);
+            ASSERT(&oa == Y.allocator());
+            ASSERT(Y.isEmpty());
+            ASSERT(0   == oa.numBlocksTotal());
+        }
+
+        const char *SPECS[] = { "", "a", "abab", "cbacba", "abcdefghij" };
+        const int   NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            const char *const SPEC = SPECS[ti];
+
+            if (veryVerbose) { T_ P(SPEC) }
+
+            bslma::TestAllocator sa("source", veryVeryVerbose);
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            bsl::vector<bsl::string> values(&sa);
+            loadStrings(&values, SPEC);
+
+            Array mE(&sa);  const Array& EXP = mE;
+            for (bsl::size_t i = 0; i < values.size(); ++i) {
+                mE.push_back(values[i]);
+            }
+
+            if (veryVerbose) cout << "\tFrom an array, same allocator."
+                                  << endl;
+            {
+                Array mA(EXP, &sa);  const Array& A = mA;
+
+                const bsls::Types::Int64 numBlocks = sa.numBlocksTotal();
+
+                const Obj X(&mA, &sa);
+
+                ASSERTV(SPEC, numBlocks == sa.numBlocksTotal());
+                ASSERTV(SPEC, &sa       == X.allocator());
+                ASSERTV(SPEC, EXP       == X.array());
+                ASSERTV(SPEC, A.isEmpty());
+            }
+
+            if (veryVerbose) cout << "\tFrom an array, other allocator."
+                                  << endl;
+            {
+                Array mA(EXP, &sa);  const Array& A = mA;
+
+                const Obj X(&mA, &oa);
+
+                ASSERTV(SPEC, &oa == X.allocator());
+                ASSERTV(SPEC, EXP == X.array());
+                ASSERTV(SPEC, A.isEmpty());
+                ASSERTV(SPEC, values.empty() || 0 < oa.numBlocksInUse());
+            }
+
+            if (veryVerbose) cout << "\tFrom a range." << endl;
+            {
+                const bsls::Types::Int64 numBlocks =
+                                             defaultAllocator.numBlocksTotal();
+
+                const Obj X(values.begin(), values.end(), &oa);
+
+                ASSERTV(SPEC, &oa == X.allocator());
+                ASSERTV(SPEC, EXP == X.array());
+                ASSERTV(SPEC, numBlocks == defaultAllocator.numBlocksTotal());
+
+                const Obj Y(values.begin(), values.end());
+
+                ASSERTV(SPEC, &defaultAllocator == Y.allocator());
+                ASSERTV(SPEC, EXP               == Y.array());
+
+                if (veryVerbose) cout << "\tCopy." << endl;
+
+                bslma::TestAllocator ca("copy", veryVeryVerbose);
+
+                const Obj Z(X, &ca);
+                ASSERTV(SPEC, &ca == Z.allocator());
+                ASSERTV(SPEC, X   == Z);
+                ASSERTV(SPEC, values.empty() || 0 < ca.numBlocksInUse());
+            }
+            ASSERTV(SPEC, 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Array  mA;
+            Array *nullArray = 0;
+
+            ASSERT_SAFE_PASS((void)Obj(&mA));
+            ASSERT_SAFE_FAIL((void)Obj(nullArray));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Freeze a compacted array, copy it, and access the result.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        bdlc::CompactedArray<int> mA(&oa);
+        mA.push_back(5);
+        mA.push_back(3);
+        mA.push_back(5);
+
+        const ObjInt X(&mA, &oa);
+        ASSERT(mA.isEmpty());
+        ASSERT(3 == X.length());
+        ASSERT(2 == X.uniqueLength());
+        ASSERT(5 == X[0]);
+        ASSERT(3 == X[1]);
+        ASSERT(1 == X.uniqueElementIndex(0));
+        ASSERT(0 == X.uniqueElementIndex(1));
+
+        const ObjInt Y(X, &oa);
+        ASSERT(X == Y);
+
+        const int    VALUES[] = { 5, 3, 5 };
+        const ObjInt Z(VALUES, VALUES + 3, &oa);
+        ASSERT(X == Z);
+
+        const ObjInt W(VALUES, VALUES + 2, &oa);
+        ASSERT(X != W);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,237 @@
+// bdlcc_epochdomain.cpp                                              -*-C++-*-
+#include <bdlcc_epochdomain.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_epochdomain_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+
+#include <bsl_new.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// A record's 'd_state' is 0 when no critical section is in progress in it,
+// and '2 * e + 1' when one that began in epoch 'e' is.  A guard publishes its
+// epoch with a sequentially consistent store and then reloads the global
+// epoch, retrying if it has changed; an advancing thread reads every record
+// with sequentially consistent loads before storing the new epoch.  So either
+// the advancing thread sees the guard's epoch, or the guard sees the new
+// epoch and republishes.
+//
+// Objects retired in epoch 'e' are appended to 'd_retired[e % 3]'.  When the
+// epoch advances from 'g' to 'g + 1', every critical section in progress
+// began in 'g', after every object retired in 'g - 1' was unlinked, so those
+// objects (in 'd_retired[(g + 2) % 3]') are freed; that list then receives
+// the objects retired in 'g + 2'.  Retiring and advancing are serialized by
+// 'd_retiredLock', but deleters are called after it is released.
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                             // -----------------
+                             // class EpochDomain
+                             // -----------------
+
+// PRIVATE CLASS METHODS
+void EpochDomain::freeAll(bsl::vector<Retired> *retired)
+{
+    BSLS_ASSERT(retired);
+
+    for (bsl::size_t i = 0; i < retired->size(); ++i) {
+        const Retired& object = (*retired)[i];
+        object.d_deleter(object.d_object_p, object.d_context_p);
+    }
+    retired->clear();
+}
+
+// PRIVATE MANIPULATORS
+EpochDomain::Record *EpochDomain::acquireRecord()
+{
+    Record *record = d_records.loadAcquire();
+    while (record) {
+        if (0 == record->d_inUse.loadRelaxed()
+         && 0 == record->d_inUse.testAndSwapAcqRel(0, 1)) {
+            break;
+        }
+        record = record->d_next_p;
+    }
+
+    if (!record) {
+        record = static_cast<Record *>(
+                                    d_allocator_p->allocate(sizeof(Record)));
+        new (&record->d_state) bsls::AtomicUint64(0);
+        new (&record->d_inUse) bsls::AtomicInt(1);
+
+        Record *head = d_records.loadRelaxed();
+        do {
+            record->d_next_p = head;
+            head = d_records.testAndSwapAcqRel(record->d_next_p, record);
+        } while (head != record->d_next_p);
+
+        d_numRecords.addRelaxed(1);
+    }
+
+    Uint64 epoch = d_epoch.load();
+    for (;;) {
+        record->d_state.store(2 * epoch + 1);
+
+        const Uint64 current = d_epoch.load();
+        if (current == epoch) {
+            break;
+        }
+        epoch = current;
+    }
+
+    return record;
+}
+
+void EpochDomain::releaseRecord(Record *record)
+{
+    BSLS_ASSERT(record);
+    BSLS_ASSERT(1 == record->d_inUse.loadRelaxed());
+
+    record->d_state.storeRelease(0);
+    record->d_inUse.storeRelease(0);
+}
+
+bool EpochDomain::tryAdvanceImp(bsl::vector<Retired> *reclaimable)
+{
+    BSLS_ASSERT(reclaimable);
+
+    const Uint64 epoch = d_epoch.loadRelaxed();
+
+    for (Record *record = d_records.loadAcquire();
+         record;
+         record = record->d_next_p) {
+        const Uint64 state = record->d_state.load();
+        if (0 != state && 2 * epoch + 1 != state) {
+            return false;                                             // RETURN
+        }
+    }
+
+    d_epoch.store(epoch + 1);
+
+    bsl::vector<Retired>& expired = d_retired[(epoch + 2) % k_NUM_LISTS];
+    d_numRetired -= static_cast<int>(expired.size());
+    reclaimable->swap(expired);
+
+    return true;
+}
+
+// CREATORS
+EpochDomain::EpochDomain(bslma::Allocator *basicAllocator)
+: d_epoch(0)
+, d_records(0)
+, d_numRecords(0)
+, d_retired(k_NUM_LISTS, bslma::Default::allocator(basicAllocator))
+, d_numRetired(0)
+, d_numSinceAdvance(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+EpochDomain::~EpochDomain()
+{
+    for (int i = 0; i < k_NUM_LISTS; ++i) {
+        freeAll(&d_retired[i]);
+    }
+
+    Record *record = d_records.loadAcquire();
+    while (record) {
+        BSLS_ASSERT(0 == record->d_inUse.loadRelaxed());
+
+        Record *next = record->d_next_p;
+        d_allocator_p->deallocate(record);
+        record = next;
+    }
+}
+
+// MANIPULATORS
+void EpochDomain::retire(void *object, Deleter deleter, void *context)
+{
+    BSLS_ASSERT(object);
+    BSLS_ASSERT(deleter);
+
+    const Retired retired = { object, deleter, context };
+
+    bsl::vector<Retired> reclaimable(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_retiredLock);
+
+        d_retired[d_epoch.load() % k_NUM_LISTS].push_back(retired);
+        ++d_numRetired;
+
+        if (++d_numSinceAdvance >= k_ADVANCE_THRESHOLD) {
+            d_numSinceAdvance = 0;
+            tryAdvanceImp(&reclaimable);
+        }
+    }
+
+    freeAll(&reclaimable);
+}
+
+void EpochDomain::synchronize()
+{
+    const Uint64 target = d_epoch.load() + 2;
+
+    while (d_epoch.loadAcquire() < target) {
+        if (!tryAdvance()) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+}
+
+void EpochDomain::synchronizeAsync()
+{
+    // Two advances free every object retired before the first; further
+    // advances cannot free more.
+
+    for (int i = 0; i < k_NUM_LISTS - 1; ++i) {
+        if (!tryAdvance()) {
+            break;
+        }
+    }
+}
+
+bool EpochDomain::tryAdvance()
+{
+    bsl::vector<Retired> reclaimable(d_allocator_p);
+    bool                 advanced;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_retiredLock);
+
+        advanced = tryAdvanceImp(&reclaimable);
+    }
+
+    freeAll(&reclaimable);
+    return advanced;
+}
+
+// ACCESSORS
+int EpochDomain::numRetired() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_retiredLock);
+    return d_numRetired;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
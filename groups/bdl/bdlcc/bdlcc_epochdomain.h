@@ -0,0 +1,463 @@
+// bdlcc_epochdomain.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLCC_EPOCHDOMAIN
+#define INCLUDED_BDLCC_EPOCHDOMAIN
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide epoch-based reclamation of shared objects.
+//
+//@CLASSES:
+//  bdlcc::EpochDomain: epochs, participants, and retired objects
+//  bdlcc::EpochGuard: scoped critical section of an 'EpochDomain'
+//
+//@SEE_ALSO: bdlcc_hazardpointerdomain, bdlcc_skiplist
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdlcc::EpochDomain', and
+// a scoped guard, 'bdlcc::EpochGuard', implementing *epoch-based*
+// *reclamation*: a technique for deciding when an object that has been
+// removed from a shared data structure can be freed, even though other
+// threads may still be reading it.
+//
+// A thread reads the structure only within a *critical* *section*, delimited
+// by the lifetime of an 'EpochGuard'.  Within its critical section, a thread
+// may read any object it reaches, and keep pointers to them, without further
+// synchronization: no object reachable when (or after) the critical section
+// began is freed before it ends.  Entering and leaving a critical section
+// each cost one store to a location private to the guard (and entering, a
+// load of the global epoch), independent of the number of objects read.
+//
+// A thread that removes an object from the structure (so that no thread can
+// newly reach it) passes it to 'retire', together with a function to free it.
+// The domain maintains a global *epoch* number; each object is retired into
+// the list for the current epoch, and each critical section records the epoch
+// in which it began.  The epoch can be advanced only when every critical
+// section in progress began in the current epoch, and an object retired in
+// epoch 'e' is freed once the epoch reaches 'e + 2', by which time no
+// critical section that could have reached it is still in progress.
+//
+// 'retire' attempts to advance the epoch after every
+// 'k_ADVANCE_THRESHOLD' objects retired; 'tryAdvance' attempts it explicitly,
+// and 'synchronize' blocks until every object retired before the call has
+// been freed.  'retireObject' is a convenience that frees the object with
+// 'bslma::DeleterHelper::deleteObject' and the allocator from which it was
+// obtained.
+//
+// Epoch-based reclamation makes reading very cheap, but a thread that stays
+// in a critical section (or is suspended in one) prevents every object
+// retired since it entered from being freed.  Critical sections should
+// therefore be short, and must not block.  Where that cannot be guaranteed,
+// 'bdlcc::HazardPointerDomain' bounds the memory held instead.
+//
+///Participant Records
+///-------------------
+// Each guard occupies a *record* of the domain, in which it publishes the
+// epoch of its critical section, for its lifetime.  Records are created on
+// demand, padded to a cache line, and reused by later guards; they are freed
+// only when the domain is destroyed.  Guards may be nested; each occupies its
+// own record.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::EpochDomain' is fully *thread-safe*, meaning that all non-creator
+// operations on an object can be safely invoked simultaneously from multiple
+// threads.  A 'bdlcc::EpochGuard' must be used only by the thread that
+// created it.  The function passed to 'retire' may be called by any thread
+// that calls 'retire', 'tryAdvance', or 'synchronize' on the domain, or by
+// the destructor of the domain, but never while the calling thread holds a
+// lock of the domain.  A thread must not call 'synchronize' while it is in a
+// critical section of the same domain.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Linked List Without Locking
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a singly-linked list of integers that many threads
+// read and a single thread modifies, and that readers must not take a lock.
+//
+// First, we define the node type:
+//..
+//  struct IntNode {
+//      int                          d_value;
+//      bsls::AtomicPointer<IntNode> d_next;
+//  };
+//..
+// Then, we create the domain and a list of three nodes:
+//..
+//  bslma::TestAllocator          ta;
+//  bdlcc::EpochDomain            domain(&ta);
+//  bsls::AtomicPointer<IntNode>  head(0);
+//
+//  for (int i = 3; i > 0; --i) {
+//      IntNode *node = new (ta) IntNode;
+//      node->d_value = i;
+//      node->d_next.storeRelaxed(head.loadRelaxed());
+//      head.storeRelease(node);
+//  }
+//..
+// Next, a reader enters a critical section and sums the list:
+//..
+//  {
+//      bdlcc::EpochGuard guard(&domain);
+//
+//      int sum = 0;
+//      for (const IntNode *node = head.loadAcquire();
+//           node;
+//           node = node->d_next.loadAcquire()) {
+//          sum += node->d_value;
+//..
+// Meanwhile (as illustrated here, while the reader is at the second node),
+// the writer unlinks the second node and retires it.  The node is not freed
+// while the reader's critical section, which still refers to it, is in
+// progress, and the reader continues from it to the third node:
+//..
+//          if (2 == node->d_value) {
+//              IntNode *second = head.loadAcquire()->d_next.loadAcquire();
+//              head.loadAcquire()->d_next.storeRelease(
+//                                              second->d_next.loadAcquire());
+//              domain.retireObject(second, &ta);
+//
+//              domain.synchronizeAsync();
+//              assert(1 == domain.numRetired());
+//          }
+//      }
+//      assert(6 == sum);
+//  }
+//..
+// Finally, once no critical section is in progress, the node can be freed:
+//..
+//  domain.synchronize();
+//  assert(0 == domain.numRetired());
+//
+//  while (IntNode *node = head.loadRelaxed()) {
+//      head.storeRelaxed(node->d_next.loadRelaxed());
+//      ta.deleteObject(node);
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deleterhelper.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                         // =========================
+                         // struct EpochDomain_Record
+                         // =========================
+
+struct EpochDomain_Record {
+    // This component-private 'struct' holds the state of one participant in
+    // an 'EpochDomain', and is occupied by at most one guard at a time.
+
+    // PUBLIC DATA
+    bsls::AtomicUint64  d_state;   // twice the epoch of the critical section
+                                   // in progress, plus one; or 0 if none
+
+    bsls::AtomicInt     d_inUse;   // 1 if occupied by a guard, and 0
+                                   // otherwise
+
+    EpochDomain_Record *d_next_p;  // next record of the domain (immutable
+                                   // once published)
+
+    char                d_pad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                              - sizeof(bsls::AtomicUint64)
+                              - sizeof(bsls::AtomicInt)
+                              - sizeof(void *)];
+                                   // padding to prevent false sharing
+};
+
+                             // =================
+                             // class EpochDomain
+                             // =================
+
+class EpochDomain {
+    // This mechanism maintains a global epoch, the epochs of the critical
+    // sections in progress (each occupying a record of the domain), and lists
+    // of the objects retired in recent epochs, and frees those objects once no
+    // critical section can reach them.
+
+  public:
+    // TYPES
+    typedef void (*Deleter)(void *object, void *context);
+        // 'Deleter' is an alias for a function that frees an object, given
+        // its address and the context with which it was retired.
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_ADVANCE_THRESHOLD = 64  // number of objects retired between
+                                  // attempts by 'retire' to advance the
+                                  // epoch
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef EpochDomain_Record  Record;
+    typedef bsls::Types::Uint64 Uint64;
+
+    struct Retired {
+        // This 'struct' describes a retired object.
+
+        void    *d_object_p;   // retired object
+        Deleter  d_deleter;    // function to free 'd_object_p'
+        void    *d_context_p;  // context passed to 'd_deleter'
+    };
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_NUM_LISTS = 3  // number of epochs whose retired objects may be
+                         // awaiting reclamation
+    };
+
+    // DATA
+    bsls::AtomicUint64           d_epoch;                 // global epoch
+
+    bsls::AtomicPointer<Record>  d_records;               // most recently
+                                                          // created record
+
+    bsls::AtomicInt              d_numRecords;            // number of records
+
+    mutable bslmt::Mutex         d_retiredLock;           // guards the retire
+                                                          // lists, and epoch
+                                                          // advancement
+
+    bsl::vector<bsl::vector<Retired> >
+                                 d_retired;               // objects retired in
+                                                          // each epoch, by
+                                                          // epoch modulo
+                                                          // 'k_NUM_LISTS'
+
+    int                          d_numRetired;            // total size of
+                                                          // 'd_retired'
+
+    int                          d_numSinceAdvance;       // objects retired
+                                                          // since the last
+                                                          // attempt to advance
+
+    bslma::Allocator            *d_allocator_p;           // memory allocator
+                                                          // (held, not owned)
+
+    // FRIENDS
+    friend class EpochGuard;
+
+    // PRIVATE CLASS METHODS
+    template <class TYPE>
+    static void deleteObject(void *object, void *allocator);
+        // Destroy the specified 'object' of the (template parameter) 'TYPE'
+        // and return its memory to the specified 'allocator'.
+
+    static void freeAll(bsl::vector<Retired> *retired);
+        // Free each object in the specified 'retired' list.
+
+    // PRIVATE MANIPULATORS
+    Record *acquireRecord();
+        // Return the address of a record that is not occupied by a guard,
+        // creating it if necessary, mark it occupied, and publish in it the
+        // current epoch.
+
+    void releaseRecord(Record *record);
+        // Mark the specified 'record' as having no critical section in
+        // progress, and as no longer occupied.
+
+    bool tryAdvanceImp(bsl::vector<Retired> *reclaimable);
+        // Advance the epoch if every critical section in progress began in
+        // the current epoch, and, if so, load into the specified
+        // 'reclaimable' the objects that have become safe to free and return
+        // 'true'; otherwise return 'false' with no effect.  This method must
+        // be called holding 'd_retiredLock'.
+
+  private:
+    // NOT IMPLEMENTED
+    EpochDomain(const EpochDomain&);
+    EpochDomain& operator=(const EpochDomain&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(EpochDomain, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit EpochDomain(bslma::Allocator *basicAllocator = 0);
+        // Create an epoch domain having no records and no retired objects.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~EpochDomain();
+        // Free every object retired to this domain, and destroy this object.
+        // The behavior is undefined unless no guard of this domain exists.
+
+    // MANIPULATORS
+    void retire(void *object, Deleter deleter, void *context);
+        // Arrange for the specified 'deleter' to be called with the specified
+        // 'object' and 'context' once no critical section of this domain that
+        // may have reached 'object' is in progress.  The behavior is undefined
+        // unless 'object' has been made unreachable to critical sections that
+        // begin after this call, and has not been retired before.
+
+    template <class TYPE>
+    void retireObject(TYPE *object, bslma::Allocator *allocator);
+        // Arrange for the specified 'object' to be destroyed and its memory
+        // returned to the specified 'allocator' (from which it must have been
+        // obtained) once no critical section of this domain that may have
+        // reached it is in progress.  See 'retire'.
+
+    void synchronize();
+        // Block until every object retired to this domain before this call
+        // has been freed.  The behavior is undefined if the calling thread is
+        // in a critical section of this domain.
+
+    void synchronizeAsync();
+        // Free every object retired to this domain that can be freed without
+        // waiting for a critical section in progress to end, advancing the
+        // epoch as often as possible.
+
+    bool tryAdvance();
+        // Advance the epoch and free the objects that have thereby become safe
+        // to free, if every critical section in progress began in the current
+        // epoch.  Return 'true' if the epoch was advanced, and 'false'
+        // otherwise.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+
+    bsls::Types::Uint64 epoch() const;
+        // Return the current epoch of this domain.
+
+    int numRecords() const;
+        // Return the number of participant records of this domain.
+
+    int numRetired() const;
+        // Return the number of objects retired to this domain that have not
+        // yet been freed.
+};
+
+                              // ================
+                              // class EpochGuard
+                              // ================
+
+class EpochGuard {
+    // This class implements a scoped guard that delimits a critical section
+    // of an 'EpochDomain': objects reachable during its lifetime are not freed
+    // by the domain before it is destroyed.
+
+    // DATA
+    EpochDomain        *d_domain_p;  // domain (held, not owned)
+    EpochDomain_Record *d_record_p;  // occupied record
+
+  private:
+    // NOT IMPLEMENTED
+    EpochGuard(const EpochGuard&);
+    EpochGuard& operator=(const EpochGuard&);
+
+  public:
+    // CREATORS
+    explicit EpochGuard(EpochDomain *domain);
+        // Create a guard, and enter a critical section of the specified
+        // 'domain'.
+
+    ~EpochGuard();
+        // Leave the critical section of this guard, and destroy this object.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                             // -----------------
+                             // class EpochDomain
+                             // -----------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+void EpochDomain::deleteObject(void *object, void *allocator)
+{
+    bslma::DeleterHelper::deleteObject(static_cast<TYPE *>(object),
+                                       static_cast<bslma::Allocator *>(
+                                                                  allocator));
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void EpochDomain::retireObject(TYPE *object, bslma::Allocator *allocator)
+{
+    BSLS_ASSERT(allocator);
+
+    retire(const_cast<void *>(static_cast<const void *>(object)),
+           &deleteObject<TYPE>,
+           allocator);
+}
+
+// ACCESSORS
+inline
+bslma::Allocator *EpochDomain::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+bsls::Types::Uint64 EpochDomain::epoch() const
+{
+    return d_epoch.loadAcquire();
+}
+
+inline
+int EpochDomain::numRecords() const
+{
+    return d_numRecords.loadAcquire();
+}
+
+                              // ----------------
+                              // class EpochGuard
+                              // ----------------
+
+// CREATORS
+inline
+EpochGuard::EpochGuard(EpochDomain *domain)
+: d_domain_p(domain)
+, d_record_p(domain->acquireRecord())
+{
+}
+
+inline
+EpochGuard::~EpochGuard()
+{
+    d_domain_p->releaseRecord(d_record_p);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
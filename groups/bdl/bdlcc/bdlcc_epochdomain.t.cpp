@@ -0,0 +1,910 @@
+// bdlcc_epochdomain.t.cpp                                            -*-C++-*-
+#include <bdlcc_epochdomain.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides epoch-based reclamation: a domain holding
+// the global epoch, the participant records, and the retired objects, and a
+// guard delimiting a critical section.  The single-threaded tests verify that
+// records are created on demand and reused, that the epoch advances exactly
+// when every critical section in progress began in the current epoch, that an
+// object retired in epoch 'e' is freed exactly when the epoch reaches 'e + 2'
+// (whether the advance is explicit, or triggered by 'retire',
+// 'synchronizeAsync', or 'synchronize'), and that the destructor frees every
+// retired object.  The concurrency concerns, that no object is freed while a
+// critical section that may have reached it is in progress, and that
+// 'synchronize' waits for such critical sections, are verified with reader
+// threads that validate the objects they read while a writer replaces and
+// retires them.
+// ----------------------------------------------------------------------------
+// EpochDomain
+// CREATORS
+// [ 2] explicit EpochDomain(bslma::Allocator *basicAllocator = 0);
+// [ 3] ~EpochDomain();
+//
+// MANIPULATORS
+// [ 3] void retire(void *object, Deleter deleter, void *context);
+// [ 3] void retireObject(TYPE *object, bslma::Allocator *allocator);
+// [ 3] void synchronize();
+// [ 3] void synchronizeAsync();
+// [ 3] bool tryAdvance();
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 3] bsls::Types::Uint64 epoch() const;
+// [ 2] int numRecords() const;
+// [ 3] int numRetired() const;
+//
+// EpochGuard
+// CREATORS
+// [ 2] explicit EpochGuard(EpochDomain *domain);
+// [ 2] ~EpochGuard();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: no reachable object is freed under concurrent retirement
+// [ 5] CONCERN: 'synchronize' waits for critical sections in progress
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::EpochDomain Obj;
+typedef bdlcc::EpochGuard  Guard;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct Counted {
+    // This 'struct' holds a value, and a marker that is cleared when it is
+    // destroyed.
+
+    enum { k_ALIVE = 0x5eed };
+
+    int d_value;   // value
+    int d_marker;  // 'k_ALIVE' until destroyed
+
+    explicit Counted(int value)
+    : d_value(value)
+    , d_marker(k_ALIVE)
+    {
+    }
+
+    ~Counted()
+    {
+        d_marker = 0;
+    }
+};
+
+void countingDeleter(void *object, void *counter)
+    // Increment the specified 'counter', an 'int', and ignore the specified
+    // 'object'.
+{
+    (void)object;
+    ++*static_cast<int *>(counter);
+}
+
+void readerWorker(bsls::AtomicPointer<Counted> *source,
+                  Obj                          *domain,
+                  bslmt::Barrier               *barrier,
+                  bsls::AtomicBool             *done,
+                  bsls::AtomicInt              *numErrors)
+    // Wait on the specified 'barrier', and then, until the specified 'done'
+    // is 'true', repeatedly enter a critical section of the specified
+    // 'domain', read several objects held in turn by the specified 'source',
+    // and verify that each remains alive and unchanged for the rest of the
+    // critical section, incrementing the specified 'numErrors' otherwise.
+{
+    enum { k_NUM_READS = 8 };
+
+    barrier->wait();
+
+    while (!done->load()) {
+        Guard guard(domain);
+
+        const Counted *objects[k_NUM_READS];
+        int            values[k_NUM_READS];
+
+        for (int i = 0; i < k_NUM_READS; ++i) {
+            objects[i] = source->loadAcquire();
+            values[i]  = objects[i]->d_value;
+
+            for (int j = 0; j <= i; ++j) {
+                if (Counted::k_ALIVE != objects[j]->d_marker
+                 || values[j] != objects[j]->d_value) {
+                    numErrors->addRelaxed(1);
+                }
+            }
+        }
+    }
+}
+
+void holderWorker(Obj              *domain,
+                  bslmt::Barrier   *entered,
+                  bsls::AtomicBool *release,
+                  bsls::AtomicBool *released)
+    // Enter a critical section of the specified 'domain', wait on the
+    // specified 'entered' barrier, and then remain in the critical section
+    // until the specified 'release' is 'true'; set the specified 'released'
+    // to 'true' immediately before leaving the critical section.
+{
+    Guard guard(domain);
+
+    entered->wait();
+
+    while (!release->load()) {
+        bslmt::ThreadUtil::yield();
+    }
+    released->store(true);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Linked List Without Locking
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a singly-linked list of integers that many threads
+// read and a single thread modifies, and that readers must not take a lock.
+//
+// First, we define the node type:
+//..
+struct IntNode {
+    int                          d_value;
+    bsls::AtomicPointer<IntNode> d_next;
+};
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create the domain and a list of three nodes:
+//..
+        bslma::TestAllocator          ta;
+        bdlcc::EpochDomain            domain(&ta);
+        bsls::AtomicPointer<IntNode>  head(0);
+
+        for (int i = 3; i > 0; --i) {
+            IntNode *node = new (ta) IntNode;
+            node->d_value = i;
+            node->d_next.storeRelaxed(head.loadRelaxed());
+            head.storeRelease(node);
+        }
+//..
+// Next, a reader enters a critical section and sums the list:
+//..
+        {
+            bdlcc::EpochGuard guard(&domain);
+
+            int sum = 0;
+            for (const IntNode *node = head.loadAcquire();
+                 node;
+                 node = node->d_next.loadAcquire()) {
+                sum += node->d_value;
+//..
+// Meanwhile (as illustrated here, while the reader is at the second node),
+// the writer unlinks the second node and retires it.  The node is not freed
+// while the reader's critical section, which still refers to it, is in
+// progress, and the reader continues from it to the third node:
+//..
+                if (2 == node->d_value) {
+                    IntNode *second = head.loadAcquire()->d_next.loadAcquire();
+                    head.loadAcquire()->d_next.storeRelease(
+                                               second->d_next.loadAcquire());
+                    domain.retireObject(second, &ta);
+
+                    domain.synchronizeAsync();
+                    ASSERT(1 == domain.numRetired());
+                }
+            }
+            ASSERT(6 == sum);
+        }
+//..
+// Finally, once no critical section is in progress, the node can be freed:
+//..
+        domain.synchronize();
+        ASSERT(0 == domain.numRetired());
+
+        while (IntNode *node = head.loadRelaxed()) {
+            head.storeRelaxed(node->d_next.loadRelaxed());
+            ta.deleteObject(node);
+        }
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: 'synchronize' WAITS FOR CRITICAL SECTIONS IN PROGRESS
+        //
+        // Concerns:
+        //: 1 'synchronize' does not return while a critical section that
+        //:   began before it was called is in progress.
+        //:
+        //: 2 'synchronize' returns once that critical section ends, having
+        //:   freed every object retired before it was called.
+        //
+        // Plan:
+        //: 1 Start a thread that enters a critical section and remains in it
+        //:   until released.  Retire an object, and call 'synchronize' from
+        //:   the main thread after releasing the other thread, and verify
+        //:   that the other thread had left its critical section when
+        //:   'synchronize' returned, and that the object was freed.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: 'synchronize' waits for critical sections in progress
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: 'synchronize' WAITS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int ti = 0; ti < 20; ++ti) {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bslmt::Barrier   entered(2);
+            bsls::AtomicBool release(false);
+            bsls::AtomicBool released(false);
+
+            bslmt::ThreadUtil::Handle handle;
+            int rc = bslmt::ThreadUtil::create(
+                                         &handle,
+                                         bdlf::BindUtil::bind(&holderWorker,
+                                                              &mX,
+                                                              &entered,
+                                                              &release,
+                                                              &released));
+            ASSERTV(ti, 0 == rc);
+
+            entered.wait();
+
+            int object     = 0;
+            int numDeleted = 0;
+            mX.retire(&object, &countingDeleter, &numDeleted);
+
+            mX.synchronizeAsync();
+            ASSERTV(ti, 0 == numDeleted);
+
+            if (ti % 2) {
+                bslmt::ThreadUtil::microSleep(100 * ti);
+            }
+            release.store(true);
+
+            mX.synchronize();
+            ASSERTV(ti, released.load());
+            ASSERTV(ti, 1 == numDeleted);
+            ASSERTV(ti, 0 == X.numRetired());
+
+            bslmt::ThreadUtil::join(handle);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: NO REACHABLE OBJECT IS FREED UNDER CONCURRENT RETIREMENT
+        //
+        // Concerns:
+        //: 1 An object read within a critical section is not freed, even
+        //:   though it is concurrently replaced and retired, until the
+        //:   critical section ends.
+        //:
+        //: 2 Retired objects are freed as the epoch advances, so that the
+        //:   number awaiting reclamation remains bounded while the readers'
+        //:   critical sections are short.
+        //:
+        //: 3 Every retired object is freed by 'synchronize'.
+        //
+        // Plan:
+        //: 1 Start several reader threads that repeatedly enter a critical
+        //:   section and read several objects held in turn by a shared
+        //:   pointer, verifying that each remains alive, while the main
+        //:   thread repeatedly replaces the object and retires the old one.
+        //:   Verify that no reader observed a destroyed object, that fewer
+        //:   objects than were retired remain, and that, once the readers
+        //:   have finished, 'synchronize' frees them all.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: no reachable object is freed under concurrent retirement
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONCURRENT RETIREMENT" << endl
+                          << "==============================" << endl;
+
+        enum { k_NUM_READERS = 4, k_NUM_UPDATES = 20000 };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsls::AtomicPointer<Counted> source(new (oa) Counted(0));
+            bsls::AtomicBool             done(false);
+            bsls::AtomicInt              numErrors(0);
+            bslmt::Barrier               barrier(k_NUM_READERS + 1);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_READERS];
+
+            for (int t = 0; t < k_NUM_READERS; ++t) {
+                int rc = bslmt::ThreadUtil::create(
+                                        &handles[t],
+                                        bdlf::BindUtil::bind(&readerWorker,
+                                                             &source,
+                                                             &mX,
+                                                             &barrier,
+                                                             &done,
+                                                             &numErrors));
+                ASSERTV(t, 0 == rc);
+            }
+
+            barrier.wait();
+
+            for (int i = 1; i <= k_NUM_UPDATES; ++i) {
+                Counted *old = source.swap(new (oa) Counted(i));
+                mX.retireObject(old, &oa);
+            }
+
+            done.store(true);
+            for (int t = 0; t < k_NUM_READERS; ++t) {
+                bslmt::ThreadUtil::join(handles[t]);
+            }
+
+            ASSERTV(numErrors, 0 == numErrors);
+            ASSERTV(X.numRecords(), k_NUM_READERS >= X.numRecords());
+
+            if (veryVerbose) {
+                P_(X.numRecords()) P_(X.epoch()) P(X.numRetired())
+            }
+
+            ASSERTV(X.epoch(), 0 < X.epoch());
+            ASSERTV(X.numRetired(), k_NUM_UPDATES > X.numRetired());
+
+            mX.synchronize();
+            ASSERTV(X.numRetired(), 0 == X.numRetired());
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+            oa.deleteObject(source.swap(0));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // EPOCHS AND RECLAMATION
+        //
+        // Concerns:
+        //: 1 'tryAdvance' advances the epoch, and returns 'true', exactly when
+        //:   every critical section in progress began in the current epoch.
+        //:
+        //: 2 An object retired in epoch 'e' is freed, by calling its deleter
+        //:   once with the object and context supplied, exactly when the
+        //:   epoch reaches 'e + 2'.
+        //:
+        //: 3 'synchronizeAsync' frees every object that can be freed without
+        //:   waiting, and 'synchronize' frees every object retired before it
+        //:   was called.
+        //:
+        //: 4 'retire' attempts to advance the epoch after every
+        //:   'k_ADVANCE_THRESHOLD' objects retired.
+        //:
+        //: 5 'retireObject' destroys the object and returns its memory to the
+        //:   allocator supplied.
+        //:
+        //: 6 The destructor frees every retired object.
+        //
+        // Plan:
+        //: 1 With and without a critical section in progress, retire objects
+        //:   with a counting deleter, and verify the epoch, the results of
+        //:   'tryAdvance', 'numRetired', and the deleter calls, after each
+        //:   attempt to advance.  (C-1..3)
+        //:
+        //: 2 Retire 'k_ADVANCE_THRESHOLD' objects, and verify that the epoch
+        //:   advanced.  (C-4)
+        //:
+        //: 3 Retire objects with 'retireObject' and a test allocator, and
+        //:   verify that the memory is returned.  (C-5)
+        //:
+        //: 4 Destroy a domain holding retired objects, and verify that the
+        //:   deleters were called.  (C-6)
+        //
+        // Testing:
+        //   ~EpochDomain();
+        //   void retire(void *object, Deleter deleter, void *context);
+        //   void retireObject(TYPE *object, bslma::Allocator *allocator);
+        //   void synchronize();
+        //   void synchronizeAsync();
+        //   bool tryAdvance();
+        //   bsls::Types::Uint64 epoch() const;
+        //   int numRetired() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EPOCHS AND RECLAMATION" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nAdvancing with no critical section." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            int objects[2];
+            int numDeleted = 0;
+
+            ASSERT(0 == X.epoch());
+
+            mX.retire(&objects[0], &countingDeleter, &numDeleted);
+            ASSERT(1 == X.numRetired());
+
+            ASSERT(true == mX.tryAdvance());
+            ASSERT(1 == X.epoch());
+            ASSERT(0 == numDeleted);
+
+            mX.retire(&objects[1], &countingDeleter, &numDeleted);
+            ASSERT(2 == X.numRetired());
+
+            ASSERT(true == mX.tryAdvance());
+            ASSERT(2 == X.epoch());
+            ASSERT(1 == numDeleted);
+            ASSERT(1 == X.numRetired());
+
+            ASSERT(true == mX.tryAdvance());
+            ASSERT(3 == X.epoch());
+            ASSERT(2 == numDeleted);
+            ASSERT(0 == X.numRetired());
+        }
+
+        if (verbose) cout << "\nAdvancing with a critical section." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            int objects[3];
+            int numDeleted = 0;
+
+            mX.retire(&objects[0], &countingDeleter, &numDeleted);
+            {
+                Guard guard(&mX);
+
+                mX.retire(&objects[1], &countingDeleter, &numDeleted);
+
+                // The critical section began in epoch 0: the epoch can advance
+                // once, freeing nothing retired in epoch 0.
+
+                ASSERT(true  == mX.tryAdvance());
+                ASSERT(1     == X.epoch());
+                ASSERT(false == mX.tryAdvance());
+                ASSERT(1     == X.epoch());
+                ASSERT(0     == numDeleted);
+
+                mX.retire(&objects[2], &countingDeleter, &numDeleted);
+
+                mX.synchronizeAsync();
+                ASSERT(1 == X.epoch());
+                ASSERT(0 == numDeleted);
+                ASSERT(3 == X.numRetired());
+
+                // A nested critical section begins in the current epoch.
+
+                {
+                    Guard inner(&mX);
+                    ASSERT(false == mX.tryAdvance());
+                }
+            }
+
+            // Epoch 2 frees the objects retired in epoch 0.
+
+            ASSERT(true == mX.tryAdvance());
+            ASSERT(2 == X.epoch());
+            ASSERT(2 == numDeleted);
+            ASSERT(1 == X.numRetired());
+
+            {
+                Guard guard(&mX);
+                ASSERT(true == mX.tryAdvance());
+                ASSERT(3 == X.epoch());
+                ASSERT(3 == numDeleted);
+                ASSERT(0 == X.numRetired());
+            }
+        }
+
+        if (verbose) cout << "\n'synchronizeAsync' and 'synchronize'."
+                          << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            int objects[2];
+            int numDeleted = 0;
+
+            mX.retire(&objects[0], &countingDeleter, &numDeleted);
+            mX.synchronizeAsync();
+            ASSERT(2 == X.epoch());
+            ASSERT(1 == numDeleted);
+
+            mX.retire(&objects[1], &countingDeleter, &numDeleted);
+            mX.synchronize();
+            ASSERT(4 == X.epoch());
+            ASSERT(2 == numDeleted);
+            ASSERT(0 == X.numRetired());
+
+            mX.synchronize();
+            ASSERT(6 == X.epoch());
+        }
+
+        if (verbose) cout << "\nAdvancing by 'retire'." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            int objects[3 * Obj::k_ADVANCE_THRESHOLD];
+            int numDeleted = 0;
+
+            for (int i = 0; i < Obj::k_ADVANCE_THRESHOLD - 1; ++i) {
+                mX.retire(&objects[i], &countingDeleter, &numDeleted);
+            }
+            ASSERT(0 == X.epoch());
+
+            mX.retire(&objects[Obj::k_ADVANCE_THRESHOLD - 1],
+                      &countingDeleter,
+                      &numDeleted);
+            ASSERT(1 == X.epoch());
+            ASSERT(0 == numDeleted);
+
+            for (int i = Obj::k_ADVANCE_THRESHOLD;
+                 i < 2 * Obj::k_ADVANCE_THRESHOLD;
+                 ++i) {
+                mX.retire(&objects[i], &countingDeleter, &numDeleted);
+            }
+            ASSERT(2 == X.epoch());
+            ASSERTV(numDeleted, Obj::k_ADVANCE_THRESHOLD == numDeleted);
+            ASSERT(Obj::k_ADVANCE_THRESHOLD == X.numRetired());
+
+            {
+                Guard guard(&mX);
+
+                for (int i = 2 * Obj::k_ADVANCE_THRESHOLD;
+                     i < 3 * Obj::k_ADVANCE_THRESHOLD;
+                     ++i) {
+                    mX.retire(&objects[i], &countingDeleter, &numDeleted);
+                }
+                ASSERT(3 == X.epoch());
+                ASSERTV(numDeleted,
+                        2 * Obj::k_ADVANCE_THRESHOLD == numDeleted);
+            }
+        }
+
+        if (verbose) cout << "\nRetiring with 'retireObject'." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsls::AtomicPointer<Counted> source(new (oa) Counted(1));
+
+            {
+                Guard guard(&mX);
+
+                const Counted *object = source.loadAcquire();
+                ASSERT(1 == object->d_value);
+
+                mX.retireObject(source.swap(new (oa) Counted(2)), &oa);
+                mX.synchronizeAsync();
+                ASSERT(2 == oa.numBlocksInUse());
+                ASSERT(Counted::k_ALIVE == object->d_marker);
+            }
+
+            mX.synchronize();
+            ASSERT(1 == oa.numBlocksInUse());
+            ASSERT(0 == X.numRetired());
+
+            oa.deleteObject(source.swap(0));
+        }
+
+        if (verbose) cout << "\nDestruction frees retired objects." << endl;
+        {
+            int objects[2];
+            int numDeleted = 0;
+            {
+                Obj mX(&ta);
+
+                {
+                    Guard guard(&mX);
+
+                    mX.retire(&objects[0], &countingDeleter, &numDeleted);
+                    mX.retire(&objects[1], &countingDeleter, &numDeleted);
+                    mX.synchronizeAsync();
+                }
+                ASSERT(0 == numDeleted);
+            }
+            ASSERT(2 == numDeleted);
+        }
+
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND RECORDS
+        //
+        // Concerns:
+        //: 1 A domain initially is in epoch 0, has no records and no retired
+        //:   objects, and uses the allocator supplied, or the default
+        //:   allocator.
+        //:
+        //: 2 Each guard in existence occupies a distinct record, created on
+        //:   demand from the allocator of the domain.
+        //:
+        //: 3 Records released by destroyed guards are reused, and all records
+        //:   are freed by the destructor of the domain.
+        //
+        // Plan:
+        //: 1 Create domains with and without an allocator, and verify the
+        //:   accessors.  (C-1)
+        //:
+        //: 2 Create nested guards, and verify the number of records and the
+        //:   allocations.  Create guards again, and verify that no record is
+        //:   added.  Destroy the domain, and verify that its memory is
+        //:   returned.  (C-2..3)
+        //
+        // Testing:
+        //   explicit EpochDomain(bslma::Allocator *basicAllocator = 0);
+        //   bslma::Allocator *allocator() const;
+        //   int numRecords() const;
+        //   explicit EpochGuard(EpochDomain *domain);
+        //   ~EpochGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND RECORDS" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(0 == X.epoch());
+            ASSERT(0 == X.numRecords());
+            ASSERT(0 == X.numRetired());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.numRecords());
+
+            const bsls::Types::Int64 BASE = ta.numBlocksInUse();
+
+            {
+                Guard g1(&mX);
+                ASSERT(1 == X.numRecords());
+                ASSERT(BASE + 1 == ta.numBlocksInUse());
+                {
+                    Guard g2(&mX);
+                    ASSERT(2 == X.numRecords());
+                    ASSERT(BASE + 2 == ta.numBlocksInUse());
+                }
+                Guard g3(&mX);
+                ASSERT(2 == X.numRecords());
+            }
+
+            for (int i = 0; i < 10; ++i) {
+                Guard g1(&mX);
+                Guard g2(&mX);
+                ASSERT(2 == X.numRecords());
+            }
+            ASSERT(BASE + 2 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Read an object in a critical section, retire it, and verify that
+        //:   it is freed by 'synchronize' only after the critical section
+        //:   ends.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsls::AtomicPointer<Counted> source(new (ta) Counted(7));
+            {
+                Guard guard(&mX);
+                ASSERT(1 == X.numRecords());
+
+                const Counted *object = source.loadAcquire();
+                ASSERT(7 == object->d_value);
+
+                mX.retireObject(source.swap(0), &ta);
+                ASSERT(1 == X.numRetired());
+
+                mX.synchronizeAsync();
+                ASSERT(1 == X.numRetired());
+                ASSERT(7 == object->d_value);
+            }
+            mX.synchronize();
+            ASSERT(0 == X.numRetired());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
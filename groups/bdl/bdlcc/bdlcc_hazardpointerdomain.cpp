@@ -0,0 +1,205 @@
+// bdlcc_hazardpointerdomain.cpp                                      -*-C++-*-
+#include <bdlcc_hazardpointerdomain.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_hazardpointerdomain_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_new.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Records form a singly-linked list that only grows: a new record is pushed
+// at the head with a compare-and-swap, and its 'd_next_p' is never modified
+// afterwards, so the list can be traversed without synchronization beyond an
+// acquire load of the head.
+//
+// 'reclaim' moves the whole retire list out of the domain under the lock, and
+// then works without it: it gathers the published hazard pointers into a
+// sorted vector, frees each retired object not found in that vector, and
+// returns the remainder to the retire list.  Deleters are therefore never
+// called while the lock is held, and concurrent reclamations work on disjoint
+// sets of objects.  An object retired after a reclamation gathers the hazard
+// pointers is simply left for the next reclamation.
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                         // -------------------------
+                         // class HazardPointerDomain
+                         // -------------------------
+
+// PRIVATE MANIPULATORS
+HazardPointerDomain::Record *HazardPointerDomain::acquireRecord()
+{
+    for (Record *record = d_records.loadAcquire();
+         record;
+         record = record->d_next_p) {
+        if (0 == record->d_inUse.loadRelaxed()
+         && 0 == record->d_inUse.testAndSwapAcqRel(0, 1)) {
+            return record;                                            // RETURN
+        }
+    }
+
+    Record *record = static_cast<Record *>(
+                                    d_allocator_p->allocate(sizeof(Record)));
+    new (&record->d_hazard) bsls::AtomicPointer<const char>(0);
+    new (&record->d_inUse) bsls::AtomicInt(1);
+
+    Record *head = d_records.loadRelaxed();
+    do {
+        record->d_next_p = head;
+        head = d_records.testAndSwapAcqRel(record->d_next_p, record);
+    } while (head != record->d_next_p);
+
+    d_numRecords.addRelaxed(1);
+    return record;
+}
+
+void HazardPointerDomain::releaseRecord(Record *record)
+{
+    BSLS_ASSERT(record);
+    BSLS_ASSERT(1 == record->d_inUse.loadRelaxed());
+
+    record->d_hazard.storeRelease(0);
+    record->d_inUse.storeRelease(0);
+}
+
+// CREATORS
+HazardPointerDomain::HazardPointerDomain(bslma::Allocator *basicAllocator)
+: d_records(0)
+, d_numRecords(0)
+, d_retired(bslma::Default::allocator(basicAllocator))
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+HazardPointerDomain::~HazardPointerDomain()
+{
+    for (bsl::size_t i = 0; i < d_retired.size(); ++i) {
+        const Retired& retired = d_retired[i];
+        retired.d_deleter(retired.d_object_p, retired.d_context_p);
+    }
+
+    Record *record = d_records.loadAcquire();
+    while (record) {
+        BSLS_ASSERT(0 == record->d_inUse.loadRelaxed());
+
+        Record *next = record->d_next_p;
+        d_allocator_p->deallocate(record);
+        record = next;
+    }
+}
+
+// MANIPULATORS
+int HazardPointerDomain::reclaim()
+{
+    bsl::vector<Retired> candidates(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_retiredLock);
+        candidates.swap(d_retired);
+    }
+
+    if (candidates.empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    // The sequentially consistent loads pair with those of
+    // 'HazardPointerGuard::protect': a guard whose hazard pointer is not seen
+    // here reloads its source after the objects were retired, and so cannot
+    // obtain them.
+
+    bsl::vector<const void *> hazards(d_allocator_p);
+    hazards.reserve(d_numRecords.loadAcquire());
+    for (Record *record = d_records.loadAcquire();
+         record;
+         record = record->d_next_p) {
+        const void *hazard = record->d_hazard.load();
+        if (hazard) {
+            hazards.push_back(hazard);
+        }
+    }
+    bsl::sort(hazards.begin(), hazards.end());
+
+    int numFreed = 0;
+
+    bsl::vector<Retired>::iterator kept = candidates.begin();
+    for (bsl::vector<Retired>::iterator it = candidates.begin();
+         it != candidates.end();
+         ++it) {
+        if (bsl::binary_search(hazards.begin(),
+                               hazards.end(),
+                               static_cast<const void *>(it->d_object_p))) {
+            *kept++ = *it;
+        }
+        else {
+            it->d_deleter(it->d_object_p, it->d_context_p);
+            ++numFreed;
+        }
+    }
+    candidates.erase(kept, candidates.end());
+
+    if (!candidates.empty()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_retiredLock);
+        d_retired.insert(d_retired.end(),
+                         candidates.begin(),
+                         candidates.end());
+    }
+
+    return numFreed;
+}
+
+void HazardPointerDomain::retire(void *object, Deleter deleter, void *context)
+{
+    BSLS_ASSERT(object);
+    BSLS_ASSERT(deleter);
+
+    const Retired retired = { object, deleter, context };
+
+    bsl::size_t numRetired;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_retiredLock);
+        d_retired.push_back(retired);
+        numRetired = d_retired.size();
+    }
+
+    // Reclaiming only once the retire list is larger than twice the number
+    // of hazard pointers ensures that each reclamation frees at least half of
+    // the objects it examines.
+
+    const bsl::size_t threshold = k_MIN_RECLAIM_THRESHOLD
+                                + 2 * d_numRecords.loadRelaxed();
+    if (numRetired >= threshold) {
+        reclaim();
+    }
+}
+
+// ACCESSORS
+int HazardPointerDomain::numRetired() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_retiredLock);
+    return static_cast<int>(d_retired.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
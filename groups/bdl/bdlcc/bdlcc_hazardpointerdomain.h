@@ -0,0 +1,436 @@
+// bdlcc_hazardpointerdomain.h                                        -*-C++-*-
+#ifndef INCLUDED_BDLCC_HAZARDPOINTERDOMAIN
+#define INCLUDED_BDLCC_HAZARDPOINTERDOMAIN
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide hazard pointers for safe memory reclamation.
+//
+//@CLASSES:
+//  bdlcc::HazardPointerDomain: hazard pointers and the objects they guard
+//  bdlcc::HazardPointerGuard: scoped protection of one object from reclamation
+//
+//@SEE_ALSO: bdlcc_epochdomain
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdlcc::HazardPointerDomain', and a scoped guard,
+// 'bdlcc::HazardPointerGuard', implementing *hazard* *pointers*: a technique
+// for deciding when an object that has been removed from a lock-free data
+// structure can be freed, even though other threads may still be reading it.
+//
+// A thread that is about to read an object reachable from a shared
+// 'bsls::AtomicPointer' creates a 'HazardPointerGuard' and calls 'protect',
+// which publishes the address of the object in a *hazard* *pointer* that is
+// visible to all threads, and returns the address once it is certain that the
+// object was still reachable after the hazard pointer was published.  Until
+// the guard is destroyed (or 'reset', or used to protect another object), the
+// object is not freed.
+//
+// A thread that removes an object from the structure (so that no thread can
+// newly reach it) passes it to 'retire', together with a function to free it.
+// The domain keeps retired objects on a *retire* *list*; when that list grows
+// beyond a threshold proportional to the number of hazard pointers, the
+// domain *reclaims* it: it collects the hazard pointers currently published,
+// frees every retired object that none of them refers to, and keeps the rest
+// for a later attempt.  Reclamation can also be requested explicitly with
+// 'reclaim'.  'retireObject' is a convenience that frees the object with
+// 'bslma::DeleterHelper::deleteObject' and the allocator from which it was
+// obtained.
+//
+// Hazard pointers bound the amount of unreclaimed memory: an object is kept
+// only while some guard protects it.  Each 'protect', however, costs a
+// sequentially consistent store and a reload of the source pointer.  Where
+// readers hold references to many objects at once, or traverse long chains
+// of them, 'bdlcc::EpochDomain' is usually cheaper.
+//
+///Hazard Pointer Records
+///----------------------
+// Each guard occupies a *record* of the domain, holding one hazard pointer,
+// for its lifetime.  Records are created on demand, padded to a cache line,
+// and reused by later guards; they are freed only when the domain is
+// destroyed.  The number of records is therefore the largest number of
+// guards that have existed at the same time, and acquiring a record examines
+// at most that many records.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::HazardPointerDomain' is fully *thread-safe*, meaning that all
+// non-creator operations on an object can be safely invoked simultaneously
+// from multiple threads.  A 'bdlcc::HazardPointerGuard' must be used only by
+// the thread that created it.  The function passed to 'retire' may be called
+// by any thread that calls 'retire' or 'reclaim' on the domain, or by the
+// destructor of the domain.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Shared Object Without Locking
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads read a value that is occasionally replaced,
+// and that we want the readers to take no lock.  We hold the value by pointer
+// in a 'bsls::AtomicPointer', and use a hazard pointer domain to decide when a
+// replaced value may be freed.
+//
+// First, we define the value type:
+//..
+//  struct Settings {
+//      int d_timeout;
+//      int d_retries;
+//  };
+//..
+// Then, we create the domain and the initial value:
+//..
+//  bslma::TestAllocator             ta;
+//  bdlcc::HazardPointerDomain       domain(&ta);
+//
+//  Settings *initial = new (ta) Settings;
+//  initial->d_timeout = 30;
+//  initial->d_retries = 3;
+//
+//  bsls::AtomicPointer<Settings>    current(initial);
+//..
+// Next, a reader protects the current value, and can read it safely for as
+// long as its guard exists:
+//..
+//  {
+//      bdlcc::HazardPointerGuard guard(&domain);
+//      const Settings *settings = guard.protect(current);
+//      assert(30 == settings->d_timeout);
+//..
+// Now, a writer replaces the value and retires the old one.  Since the
+// reader's guard still protects it, it is not freed, even by an explicit
+// 'reclaim':
+//..
+//      Settings *updated = new (ta) Settings(*settings);
+//      updated->d_timeout = 60;
+//
+//      Settings *old = current.swap(updated);
+//      domain.retireObject(old, &ta);
+//
+//      assert(0 == domain.reclaim());
+//      assert(30 == settings->d_timeout);
+//  }
+//..
+// Finally, once the guard is destroyed, the old value can be reclaimed:
+//..
+//  assert(1 == domain.reclaim());
+//  assert(0 == domain.numRetired());
+//
+//  ta.deleteObject(current.swap(0));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deleterhelper.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                     // =================================
+                     // struct HazardPointerDomain_Record
+                     // =================================
+
+struct HazardPointerDomain_Record {
+    // This component-private 'struct' holds one hazard pointer of a
+    // 'HazardPointerDomain', and is occupied by at most one guard at a time.
+
+    // PUBLIC DATA
+    bsls::AtomicPointer<const char>
+                                d_hazard;   // protected object, or 0
+
+    bsls::AtomicInt             d_inUse;    // 1 if occupied by a guard, and 0
+                                            // otherwise
+
+    HazardPointerDomain_Record *d_next_p;   // next record of the domain
+                                            // (immutable once published)
+
+    char                        d_pad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                      - 2 * sizeof(void *)
+                                      - sizeof(bsls::AtomicInt)];
+                                            // padding to prevent false
+                                            // sharing
+};
+
+                         // =========================
+                         // class HazardPointerDomain
+                         // =========================
+
+class HazardPointerDomain {
+    // This mechanism holds a set of hazard pointers, occupied by
+    // 'HazardPointerGuard' objects, and a list of retired objects, each of
+    // which is freed once no hazard pointer refers to it.
+
+  public:
+    // TYPES
+    typedef void (*Deleter)(void *object, void *context);
+        // 'Deleter' is an alias for a function that frees an object, given
+        // its address and the context with which it was retired.
+
+  private:
+    // PRIVATE TYPES
+    typedef HazardPointerDomain_Record Record;
+
+    struct Retired {
+        // This 'struct' describes a retired object.
+
+        void    *d_object_p;   // retired object
+        Deleter  d_deleter;    // function to free 'd_object_p'
+        void    *d_context_p;  // context passed to 'd_deleter'
+    };
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_MIN_RECLAIM_THRESHOLD = 64  // number of retired objects below which
+                                      // 'retire' does not reclaim
+    };
+
+    // DATA
+    bsls::AtomicPointer<Record>  d_records;      // most recently created
+                                                 // record
+
+    bsls::AtomicInt              d_numRecords;   // number of records
+
+    mutable bslmt::Mutex         d_retiredLock;  // guards 'd_retired'
+
+    bsl::vector<Retired>         d_retired;      // objects awaiting
+                                                 // reclamation
+
+    bslma::Allocator            *d_allocator_p;  // memory allocator (held,
+                                                 // not owned)
+
+    // FRIENDS
+    friend class HazardPointerGuard;
+
+    // PRIVATE CLASS METHODS
+    template <class TYPE>
+    static void deleteObject(void *object, void *allocator);
+        // Destroy the specified 'object' of the (template parameter) 'TYPE'
+        // and return its memory to the specified 'allocator'.
+
+    // PRIVATE MANIPULATORS
+    Record *acquireRecord();
+        // Return the address of a record that is not occupied by a guard,
+        // creating it if necessary, and mark it occupied.
+
+    void releaseRecord(Record *record);
+        // Clear the hazard pointer of the specified 'record' and mark it no
+        // longer occupied.
+
+  private:
+    // NOT IMPLEMENTED
+    HazardPointerDomain(const HazardPointerDomain&);
+    HazardPointerDomain& operator=(const HazardPointerDomain&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(HazardPointerDomain,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit HazardPointerDomain(bslma::Allocator *basicAllocator = 0);
+        // Create a hazard pointer domain having no records and no retired
+        // objects.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    ~HazardPointerDomain();
+        // Free every object retired to this domain, and destroy this object.
+        // The behavior is undefined unless no guard of this domain exists.
+
+    // MANIPULATORS
+    int reclaim();
+        // Free every object retired to this domain to which no hazard pointer
+        // refers, and return the number of objects freed.
+
+    void retire(void *object, Deleter deleter, void *context);
+        // Arrange for the specified 'deleter' to be called with the specified
+        // 'object' and 'context' once no hazard pointer of this domain refers
+        // to 'object'.  The behavior is undefined unless 'object' has been
+        // made unreachable to threads that do not already hold a reference to
+        // it, and has not been retired before.
+
+    template <class TYPE>
+    void retireObject(TYPE *object, bslma::Allocator *allocator);
+        // Arrange for the specified 'object' to be destroyed and its memory
+        // returned to the specified 'allocator' (from which it must have been
+        // obtained) once no hazard pointer of this domain refers to it.  See
+        // 'retire'.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+
+    int numRecords() const;
+        // Return the number of hazard pointer records of this domain.
+
+    int numRetired() const;
+        // Return the number of objects retired to this domain that have not
+        // yet been freed.
+};
+
+                          // ========================
+                          // class HazardPointerGuard
+                          // ========================
+
+class HazardPointerGuard {
+    // This class implements a scoped guard that occupies one hazard pointer
+    // of a 'HazardPointerDomain', with which it protects at most one object
+    // at a time from being freed.
+
+    // DATA
+    HazardPointerDomain        *d_domain_p;  // domain (held, not owned)
+    HazardPointerDomain_Record *d_record_p;  // occupied record
+
+  private:
+    // NOT IMPLEMENTED
+    HazardPointerGuard(const HazardPointerGuard&);
+    HazardPointerGuard& operator=(const HazardPointerGuard&);
+
+  public:
+    // CREATORS
+    explicit HazardPointerGuard(HazardPointerDomain *domain);
+        // Create a guard occupying a hazard pointer of the specified 'domain'
+        // and protecting no object.
+
+    ~HazardPointerGuard();
+        // Stop protecting any object, release the hazard pointer of this
+        // guard, and destroy this object.
+
+    // MANIPULATORS
+    template <class TYPE>
+    TYPE *protect(const bsls::AtomicPointer<TYPE>& source);
+        // Protect the object addressed by the specified 'source', and return
+        // its address.  The object is not freed by the domain of this guard
+        // until this guard protects another object, is 'reset', or is
+        // destroyed.  Any object previously protected by this guard is no
+        // longer protected.  Note that the address returned was held by
+        // 'source' after the object became protected, but may no longer be.
+
+    void reset();
+        // Stop protecting any object.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // class HazardPointerDomain
+                         // -------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+void HazardPointerDomain::deleteObject(void *object, void *allocator)
+{
+    bslma::DeleterHelper::deleteObject(static_cast<TYPE *>(object),
+                                       static_cast<bslma::Allocator *>(
+                                                                  allocator));
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void HazardPointerDomain::retireObject(TYPE             *object,
+                                       bslma::Allocator *allocator)
+{
+    BSLS_ASSERT(allocator);
+
+    retire(const_cast<void *>(static_cast<const void *>(object)),
+           &deleteObject<TYPE>,
+           allocator);
+}
+
+// ACCESSORS
+inline
+bslma::Allocator *HazardPointerDomain::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+int HazardPointerDomain::numRecords() const
+{
+    return d_numRecords.loadAcquire();
+}
+
+                          // ------------------------
+                          // class HazardPointerGuard
+                          // ------------------------
+
+// CREATORS
+inline
+HazardPointerGuard::HazardPointerGuard(HazardPointerDomain *domain)
+: d_domain_p(domain)
+, d_record_p(domain->acquireRecord())
+{
+}
+
+inline
+HazardPointerGuard::~HazardPointerGuard()
+{
+    d_domain_p->releaseRecord(d_record_p);
+}
+
+// MANIPULATORS
+template <class TYPE>
+TYPE *HazardPointerGuard::protect(const bsls::AtomicPointer<TYPE>& source)
+{
+    TYPE *ptr = source.loadAcquire();
+
+    while (true) {
+        // The sequentially consistent store and load ensure that a reclaiming
+        // thread either sees the hazard pointer, or retired the object after
+        // this thread reloads 'source' -- in which case the reload does not
+        // return it.
+
+        d_record_p->d_hazard.store(static_cast<const char *>(
+                                             static_cast<const void *>(ptr)));
+
+        TYPE *current = source.load();
+        if (current == ptr) {
+            return ptr;                                               // RETURN
+        }
+        ptr = current;
+    }
+}
+
+inline
+void HazardPointerGuard::reset()
+{
+    d_record_p->d_hazard.storeRelease(0);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
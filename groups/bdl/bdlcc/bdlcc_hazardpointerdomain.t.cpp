@@ -0,0 +1,723 @@
+// bdlcc_hazardpointerdomain.t.cpp                                    -*-C++-*-
+#include <bdlcc_hazardpointerdomain.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides hazard pointers: a domain holding the
+// published hazard pointers and the retired objects, and a guard occupying
+// one hazard pointer.  The single-threaded tests verify that records are
+// created on demand and reused, that a retired object is freed exactly when
+// no hazard pointer refers to it (whether reclamation is explicit, triggered
+// by 'retire', or done by the destructor), and that 'retireObject' returns
+// the memory to the allocator supplied.  The concurrency concern, that no
+// object is freed while a reader protects it, is verified with reader threads
+// that validate the objects they protect while a writer replaces and retires
+// them.
+// ----------------------------------------------------------------------------
+// HazardPointerDomain
+// CREATORS
+// [ 2] explicit HazardPointerDomain(bslma::Allocator *basicAllocator = 0);
+// [ 3] ~HazardPointerDomain();
+//
+// MANIPULATORS
+// [ 3] int reclaim();
+// [ 3] void retire(void *object, Deleter deleter, void *context);
+// [ 3] void retireObject(TYPE *object, bslma::Allocator *allocator);
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] int numRecords() const;
+// [ 3] int numRetired() const;
+//
+// HazardPointerGuard
+// CREATORS
+// [ 2] explicit HazardPointerGuard(HazardPointerDomain *domain);
+// [ 2] ~HazardPointerGuard();
+//
+// MANIPULATORS
+// [ 3] TYPE *protect(const bsls::AtomicPointer<TYPE>& source);
+// [ 3] void reset();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: no protected object is freed under concurrent retirement
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::HazardPointerDomain Obj;
+typedef bdlcc::HazardPointerGuard  Guard;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct Counted {
+    // This 'struct' holds a value, and a marker that is cleared when it is
+    // destroyed.
+
+    enum { k_ALIVE = 0x5eed };
+
+    int d_value;   // value
+    int d_marker;  // 'k_ALIVE' until destroyed
+
+    explicit Counted(int value)
+    : d_value(value)
+    , d_marker(k_ALIVE)
+    {
+    }
+
+    ~Counted()
+    {
+        d_marker = 0;
+    }
+};
+
+void countingDeleter(void *object, void *counter)
+    // Increment the specified 'counter', an 'int', and ignore the specified
+    // 'object'.
+{
+    (void)object;
+    ++*static_cast<int *>(counter);
+}
+
+void readerWorker(bsls::AtomicPointer<Counted> *source,
+                  Obj                          *domain,
+                  bslmt::Barrier               *barrier,
+                  bsls::AtomicBool             *done,
+                  bsls::AtomicInt              *numErrors)
+    // Wait on the specified 'barrier', and then, until the specified 'done'
+    // is 'true', protect the object held by the specified 'source' with a
+    // guard of the specified 'domain', and verify that it is alive
+    // and that its value does not change, incrementing the specified
+    // 'numErrors' otherwise.
+{
+    barrier->wait();
+
+    while (!done->load()) {
+        Guard guard(domain);
+
+        for (int i = 0; i < 100; ++i) {
+            const Counted *object = guard.protect(*source);
+
+            const int value = object->d_value;
+            for (int j = 0; j < 10; ++j) {
+                if (Counted::k_ALIVE != object->d_marker
+                 || value != object->d_value) {
+                    numErrors->addRelaxed(1);
+                }
+            }
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Shared Object Without Locking
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads read a value that is occasionally replaced,
+// and that we want the readers to take no lock.  We hold the value by pointer
+// in a 'bsls::AtomicPointer', and use a hazard pointer domain to decide when a
+// replaced value may be freed.
+//
+// First, we define the value type:
+//..
+struct Settings {
+    int d_timeout;
+    int d_retries;
+};
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create the domain and the initial value:
+//..
+        bslma::TestAllocator             ta;
+        bdlcc::HazardPointerDomain       domain(&ta);
+
+        Settings *initial = new (ta) Settings;
+        initial->d_timeout = 30;
+        initial->d_retries = 3;
+
+        bsls::AtomicPointer<Settings>    current(initial);
+//..
+// Next, a reader protects the current value, and can read it safely for as
+// long as its guard exists:
+//..
+        {
+            bdlcc::HazardPointerGuard guard(&domain);
+            const Settings *settings = guard.protect(current);
+            ASSERT(30 == settings->d_timeout);
+//..
+// Now, a writer replaces the value and retires the old one.  Since the
+// reader's guard still protects it, it is not freed, even by an explicit
+// 'reclaim':
+//..
+            Settings *updated = new (ta) Settings(*settings);
+            updated->d_timeout = 60;
+
+            Settings *old = current.swap(updated);
+            domain.retireObject(old, &ta);
+
+            ASSERT(0 == domain.reclaim());
+            ASSERT(30 == settings->d_timeout);
+        }
+//..
+// Finally, once the guard is destroyed, the old value can be reclaimed:
+//..
+        ASSERT(1 == domain.reclaim());
+        ASSERT(0 == domain.numRetired());
+
+        ta.deleteObject(current.swap(0));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: NO PROTECTED OBJECT IS FREED UNDER CONCURRENT RETIREMENT
+        //
+        // Concerns:
+        //: 1 An object returned by 'protect' is not freed, even though it is
+        //:   concurrently replaced and retired, until the guard protects
+        //:   another object or is destroyed.
+        //:
+        //: 2 Every retired object is eventually freed.
+        //
+        // Plan:
+        //: 1 Start several reader threads that repeatedly protect the object
+        //:   held by a shared pointer and verify that it is alive, while the
+        //:   main thread repeatedly replaces the object and retires the old
+        //:   one.  Verify that no reader observed a destroyed object, and
+        //:   that, once the readers have finished, every object has been
+        //:   freed by 'reclaim' and the destructor.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: no protected object is freed under concurrent retirement
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONCURRENT RETIREMENT" << endl
+                          << "==============================" << endl;
+
+        enum { k_NUM_READERS = 4, k_NUM_UPDATES = 20000 };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsls::AtomicPointer<Counted> source(new (oa) Counted(0));
+            bsls::AtomicBool             done(false);
+            bsls::AtomicInt              numErrors(0);
+            bslmt::Barrier               barrier(k_NUM_READERS + 1);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_READERS];
+
+            for (int t = 0; t < k_NUM_READERS; ++t) {
+                int rc = bslmt::ThreadUtil::create(
+                                        &handles[t],
+                                        bdlf::BindUtil::bind(&readerWorker,
+                                                             &source,
+                                                             &mX,
+                                                             &barrier,
+                                                             &done,
+                                                             &numErrors));
+                ASSERTV(t, 0 == rc);
+            }
+
+            barrier.wait();
+
+            for (int i = 1; i <= k_NUM_UPDATES; ++i) {
+                Counted *old = source.swap(new (oa) Counted(i));
+                mX.retireObject(old, &oa);
+            }
+
+            done.store(true);
+            for (int t = 0; t < k_NUM_READERS; ++t) {
+                bslmt::ThreadUtil::join(handles[t]);
+            }
+
+            ASSERTV(numErrors, 0 == numErrors);
+            ASSERTV(X.numRecords(), k_NUM_READERS >= X.numRecords());
+
+            if (veryVerbose) { P_(X.numRecords()) P(X.numRetired()) }
+
+            // Fewer objects than the reclamation threshold remain retired.
+
+            ASSERTV(X.numRetired(), 64 + 2 * k_NUM_READERS > X.numRetired());
+
+            mX.reclaim();
+            ASSERTV(X.numRetired(), 0 == X.numRetired());
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+            oa.deleteObject(source.swap(0));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RETIREMENT AND RECLAMATION
+        //
+        // Concerns:
+        //: 1 'reclaim' frees exactly the retired objects to which no hazard
+        //:   pointer refers, calling each deleter once with the object and
+        //:   context supplied, and returns the number freed.
+        //:
+        //: 2 'protect' returns the object held by its source, and protects it
+        //:   until the guard protects another object, is 'reset', or is
+        //:   destroyed.
+        //:
+        //: 3 'retire' reclaims once sufficiently many objects are retired.
+        //:
+        //: 4 'retireObject' destroys the object and returns its memory to the
+        //:   allocator supplied.
+        //:
+        //: 5 The destructor frees every retired object, protected or not.
+        //
+        // Plan:
+        //: 1 Retire objects with a counting deleter while some of them are
+        //:   protected, and verify the counts returned by 'reclaim' and
+        //:   'numRetired', and the deleter calls, after each change of
+        //:   protection.  (C-1..2)
+        //:
+        //: 2 Retire more objects than the reclamation threshold, and verify
+        //:   that 'retire' freed them.  (C-3)
+        //:
+        //: 3 Retire objects with 'retireObject' and a test allocator, and
+        //:   verify that the memory is returned.  (C-4)
+        //:
+        //: 4 Destroy a domain holding retired objects, and verify that the
+        //:   deleters were called.  (C-5)
+        //
+        // Testing:
+        //   ~HazardPointerDomain();
+        //   int reclaim();
+        //   void retire(void *object, Deleter deleter, void *context);
+        //   void retireObject(TYPE *object, bslma::Allocator *allocator);
+        //   int numRetired() const;
+        //   TYPE *protect(const bsls::AtomicPointer<TYPE>& source);
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RETIREMENT AND RECLAMATION" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nExplicit reclamation." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            int objects[3] = { 0, 1, 2 };
+            int numDeleted = 0;
+
+            bsls::AtomicPointer<int> sourceA(&objects[0]);
+            bsls::AtomicPointer<int> sourceB(&objects[1]);
+
+            Guard guardA(&mX);
+            Guard guardB(&mX);
+
+            ASSERT(&objects[0] == guardA.protect(sourceA));
+            ASSERT(&objects[1] == guardB.protect(sourceB));
+
+            mX.retire(&objects[0], &countingDeleter, &numDeleted);
+            mX.retire(&objects[1], &countingDeleter, &numDeleted);
+            mX.retire(&objects[2], &countingDeleter, &numDeleted);
+            ASSERT(3 == X.numRetired());
+            ASSERT(0 == numDeleted);
+
+            ASSERT(1 == mX.reclaim());
+            ASSERT(2 == X.numRetired());
+            ASSERT(1 == numDeleted);
+
+            ASSERT(0 == mX.reclaim());
+            ASSERT(2 == X.numRetired());
+
+            guardA.reset();
+            ASSERT(1 == mX.reclaim());
+            ASSERT(1 == X.numRetired());
+            ASSERT(2 == numDeleted);
+
+            // Protecting another object releases the previous one.
+
+            sourceB.store(&objects[2]);
+            ASSERT(&objects[2] == guardB.protect(sourceB));
+            ASSERT(1 == mX.reclaim());
+            ASSERT(0 == X.numRetired());
+            ASSERT(3 == numDeleted);
+
+            ASSERT(0 == mX.reclaim());
+        }
+
+        if (verbose) cout << "\nReclamation by 'retire'." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            enum { k_NUM_OBJECTS = 100 };
+
+            int objects[k_NUM_OBJECTS];
+            int numDeleted = 0;
+
+            bsls::AtomicPointer<int> source(&objects[0]);
+
+            Guard guard(&mX);
+            ASSERT(&objects[0] == guard.protect(source));
+
+            int i = 0;
+            while (i < k_NUM_OBJECTS && 0 == numDeleted) {
+                mX.retire(&objects[i++], &countingDeleter, &numDeleted);
+            }
+
+            // One record: reclamation once 64 + 2 objects are retired.
+
+            ASSERTV(i, 66 == i);
+            ASSERTV(numDeleted, 65 == numDeleted);
+            ASSERTV(X.numRetired(), 1 == X.numRetired());
+        }
+
+        if (verbose) cout << "\nRetiring with 'retireObject'." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsls::AtomicPointer<Counted> source(new (oa) Counted(1));
+
+            {
+                Guard guard(&mX);
+
+                const Counted *object = guard.protect(source);
+                ASSERT(1 == object->d_value);
+
+                mX.retireObject(source.swap(new (oa) Counted(2)), &oa);
+                ASSERT(0 == mX.reclaim());
+                ASSERT(2 == oa.numBlocksInUse());
+                ASSERT(Counted::k_ALIVE == object->d_marker);
+            }
+
+            ASSERT(1 == mX.reclaim());
+            ASSERT(1 == oa.numBlocksInUse());
+            ASSERT(0 == X.numRetired());
+
+            oa.deleteObject(source.swap(0));
+        }
+
+        if (verbose) cout << "\nDestruction frees retired objects." << endl;
+        {
+            int objects[2];
+            int numDeleted = 0;
+            {
+                Obj mX(&ta);
+
+                bsls::AtomicPointer<int> source(&objects[0]);
+                {
+                    Guard guard(&mX);
+                    guard.protect(source);
+
+                    mX.retire(&objects[0], &countingDeleter, &numDeleted);
+                    mX.retire(&objects[1], &countingDeleter, &numDeleted);
+                    ASSERT(1 == mX.reclaim());
+                }
+                ASSERT(1 == numDeleted);
+            }
+            ASSERT(2 == numDeleted);
+        }
+
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND RECORDS
+        //
+        // Concerns:
+        //: 1 A domain initially has no records and no retired objects, and
+        //:   uses the allocator supplied, or the default allocator.
+        //:
+        //: 2 Each guard in existence occupies a distinct record, created on
+        //:   demand from the allocator of the domain.
+        //:
+        //: 3 Records released by destroyed guards are reused, and all records
+        //:   are freed by the destructor of the domain.
+        //
+        // Plan:
+        //: 1 Create domains with and without an allocator, and verify the
+        //:   accessors.  (C-1)
+        //:
+        //: 2 Create nested guards, and verify the number of records and the
+        //:   allocations, and that independent guards protect independently.
+        //:   Create guards again, and verify that no record is added.  Destroy
+        //:   the domain, and verify that its memory is returned.  (C-2..3)
+        //
+        // Testing:
+        //   explicit HazardPointerDomain(bslma::Allocator *basicAllocator);
+        //   bslma::Allocator *allocator() const;
+        //   int numRecords() const;
+        //   explicit HazardPointerGuard(HazardPointerDomain *domain);
+        //   ~HazardPointerGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND RECORDS" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(0 == X.numRecords());
+            ASSERT(0 == X.numRetired());
+        }
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.numRecords());
+            ASSERT(0 == ta.numBlocksTotal());
+
+            int a = 1;
+            int b = 2;
+
+            bsls::AtomicPointer<int> sourceA(&a);
+            bsls::AtomicPointer<int> sourceB(&b);
+
+            {
+                Guard g1(&mX);
+                ASSERT(1 == X.numRecords());
+                ASSERT(1 == ta.numBlocksInUse());
+                {
+                    Guard g2(&mX);
+                    ASSERT(2 == X.numRecords());
+                    ASSERT(2 == ta.numBlocksInUse());
+
+                    ASSERT(&a == g1.protect(sourceA));
+                    ASSERT(&b == g2.protect(sourceB));
+                    ASSERT(1 == *g1.protect(sourceA));
+                    ASSERT(2 == *g2.protect(sourceB));
+                }
+                Guard g3(&mX);
+                ASSERT(2 == X.numRecords());
+            }
+
+            for (int i = 0; i < 10; ++i) {
+                Guard g1(&mX);
+                Guard g2(&mX);
+                ASSERT(2 == X.numRecords());
+            }
+            ASSERT(2 == ta.numBlocksInUse());
+            ASSERT(2 == ta.numBlocksTotal());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Protect an object, retire it, and reclaim it before and after
+        //:   the guard is destroyed.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsls::AtomicPointer<Counted> source(new (ta) Counted(7));
+            {
+                Guard guard(&mX);
+                ASSERT(1 == X.numRecords());
+
+                const Counted *object = guard.protect(source);
+                ASSERT(7 == object->d_value);
+
+                mX.retireObject(source.swap(0), &ta);
+                ASSERT(1 == X.numRetired());
+                ASSERT(0 == mX.reclaim());
+                ASSERT(7 == object->d_value);
+            }
+            ASSERT(1 == mX.reclaim());
+            ASSERT(0 == X.numRetired());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
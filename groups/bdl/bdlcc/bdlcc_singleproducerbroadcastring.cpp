@@ -0,0 +1,58 @@
+// bdlcc_singleproducerbroadcastring.cpp                              -*-C++-*-
+
+#include <bdlcc_singleproducerbroadcastring.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_singleproducerbroadcastring_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+
+///Implementation Note
+///===================
+// The ring is an array of 'capacity()' slots indexed by sequence number
+// modulo the capacity (a power of 2).  The producer owns 'd_published', the
+// number of values pushed; each consumer owns its cursor, the number of
+// values it has consumed, held in a cache line of its own so that consumers
+// do not contend with one another.  A value is published by storing into
+// 'd_published' after assigning to its slot, and a consumer may read the
+// slots of sequence numbers in '[cursor .. published)'.
+//
+// In 'e_GATING' mode, the producer may overwrite the slot of sequence 's'
+// only once every attached consumer's cursor exceeds 's - capacity()'.  The
+// producer caches the least cursor it observed, as 'd_gateLimit', and reads
+// the cursors again only once the cache no longer permits a push, so that the
+// producer touches the consumers' cache lines about once per 'capacity()'
+// pushes rather than on every push.  A consumer advances its cursor once per
+// batch, after copying (or visiting) the values of the batch.
+//
+// In 'e_OVERWRITE' mode, the producer never reads the cursors.  Instead, each
+// slot holds a sequence word that is odd while the slot is being written, and
+// '2 * (s + 1)' once it holds the value of sequence 's', in the manner of a
+// sequence lock.  A consumer copies a batch, advances its cursor with a full
+// barrier, and then checks the sequence word of each slot it copied; copies
+// of slots that were overwritten in the meantime are discarded and counted as
+// skipped.  Because the producer writes slots in sequence order, the
+// discarded copies always precede the valid ones within a batch.
+//
+// Blocking uses a mutex and condition variable for each side, and a count of
+// blocked threads that the other side reads (with sequential consistency)
+// after publishing or advancing, so that the mutex is taken only when a
+// thread is actually blocked.
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
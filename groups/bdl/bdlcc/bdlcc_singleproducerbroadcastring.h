@@ -0,0 +1,1356 @@
+// bdlcc_singleproducerbroadcastring.h                                -*-C++-*-
+
+#ifndef INCLUDED_BDLCC_SINGLEPRODUCERBROADCASTRING
+#define INCLUDED_BDLCC_SINGLEPRODUCERBROADCASTRING
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a ring buffer broadcasting one producer to many consumers.
+//
+//@CLASSES:
+//  bdlcc::SingleProducerBroadcastRing: SPMC broadcast ring buffer
+//
+//@SEE_ALSO: bdlcc_singleproducersingleconsumerboundedqueue
+//
+//@DESCRIPTION: This component defines a class template,
+// 'bdlcc::SingleProducerBroadcastRing', providing a bounded, thread-aware
+// ring buffer through which a single producer delivers every value to each of
+// a fixed number of consumers.  Unlike a queue, where each value is removed
+// by exactly one consumer, each value pushed into the ring is stored once and
+// is read by *every* consumer, so that fanning a stream out to 'N' threads
+// requires neither 'N' queues nor 'N' copies of each value.
+//
+// Each consumer is identified by an integer in the range
+// '[0 .. numConsumers())', fixed at construction, and has its own sequence
+// cursor: the number of values it has consumed.  The behavior of the methods
+// 'pushBack' and 'tryPushBack' is undefined unless the use is by a single
+// producer, and the behavior of the methods taking a 'consumerId' is
+// undefined unless, for each 'consumerId', the use is by a single consumer.
+// All consumers start at the first value pushed into the ring.
+//
+///Overflow Modes
+///--------------
+// The ring holds 'capacity()' values.  What happens when the producer is
+// 'capacity()' values ahead of a consumer is selected at construction:
+//
+//: 'e_GATING':    The producer is gated on the slowest attached consumer:
+//:                'pushBack' blocks (and 'tryPushBack' fails) until every
+//:                attached consumer has consumed the value about to be
+//:                overwritten.  No value is ever lost.  A consumer that will
+//:                not consume any more values must call 'detachConsumer' so
+//:                that it no longer gates the producer.
+//:
+//: 'e_OVERWRITE': The producer never waits; a consumer that falls more than
+//:                'capacity()' values behind skips the values that were
+//:                overwritten, and the number of values it skipped is reported
+//:                by 'numSkipped'.  This mode suits lossy feeds, where a slow
+//:                consumer is better served by the most recent values than by
+//:                stalling the producer.  Because a consumer may be copying a
+//:                value while the producer overwrites it (the copy is then
+//:                discarded), this mode requires 'TYPE' to be trivially
+//:                copyable (see 'bslmf_istriviallycopyable').
+//
+///Batched and In-Place Reads
+///--------------------------
+// In addition to removing one value at a time, a consumer may copy up to a
+// specified number of available values in one call, paying for the
+// synchronization with the producer once per batch rather than once per
+// value.  In 'e_GATING' mode, a consumer may instead 'visit' available values
+// in place, invoking a functor on a 'const' reference to each value in the
+// ring without copying it; the values cannot be overwritten until the call
+// returns.
+//
+// Batching and in-place reads apply only to consumers: the producer publishes
+// each value as soon as it is pushed.
+//
+///Disabling the Producer
+///----------------------
+// The ring may be placed into an "enqueue disabled" state using the
+// 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
+// immediately and return 'e_DISABLED', including a blocked invocation of
+// 'pushBack'.  A consumer that has consumed every value pushed into a disabled
+// ring fails with 'e_DISABLED' rather than blocking or returning 'e_EMPTY',
+// so that disabling the producer serves to signal the end of the stream.  The
+// ring may be restored to normal operation with 'enablePushBack'.
+//
+///Template Requirements
+///---------------------
+// 'TYPE' must be default constructible and copy assignable; in 'e_OVERWRITE'
+// mode it must also be trivially copyable.  The ring default-constructs
+// 'capacity()' elements at construction and assigns pushed values to them, so
+// a 'TYPE' that retains its storage across assignment (e.g., 'bsl::string')
+// does not allocate once the ring has wrapped around.  If 'TYPE' uses a
+// 'bslma::Allocator', it must declare the 'bslma::UsesBslmaAllocator' trait
+// so that the allocator of the ring is propagated to its elements.
+//
+///Exception Safety
+///----------------
+// If the assignment of a value throws, the ring is unchanged: a value is
+// published only once it has been assigned, and a consumer's cursor advances
+// only over values that have been copied (or visited) successfully.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Fanning Out Market Data
+/// - - - - - - - - - - - - - - - - -
+// Suppose a market-data handler receives quotes on one thread and must make
+// every quote available to several strategy threads.  Rather than copying
+// each quote into one queue per strategy, we push each quote once into a
+// 'bdlcc::SingleProducerBroadcastRing', from which every strategy reads it.
+//
+// First, we define the quote type, and a strategy that consumes quotes in
+// batches until the handler signals the end of the feed, computing the total
+// volume:
+//..
+//  struct Quote {
+//      int    d_instrument;
+//      double d_price;
+//      int    d_volume;
+//  };
+//
+//  typedef bdlcc::SingleProducerBroadcastRing<Quote> QuoteRing;
+//
+//  void strategy(QuoteRing *ring, int consumerId, bsls::Types::Int64 *volume)
+//      // Consume quotes from the specified 'ring' as the consumer having the
+//      // specified 'consumerId', until the end of the feed, and load into the
+//      // specified 'volume' their total volume.
+//  {
+//      enum { k_BATCH_SIZE = 64 };
+//
+//      Quote       batch[k_BATCH_SIZE];
+//      bsl::size_t numQuotes;
+//
+//      *volume = 0;
+//      while (0 == ring->popFront(consumerId,
+//                                 batch,
+//                                 k_BATCH_SIZE,
+//                                 &numQuotes)) {
+//          for (bsl::size_t i = 0; i < numQuotes; ++i) {
+//              *volume += batch[i].d_volume;
+//          }
+//      }
+//  }
+//..
+// Then, we create a ring for three strategies, and start their threads:
+//..
+//  enum { k_NUM_STRATEGIES = 3, k_NUM_QUOTES = 10000 };
+//
+//  QuoteRing ring(1024, k_NUM_STRATEGIES);
+//
+//  bsls::Types::Int64        volumes[k_NUM_STRATEGIES];
+//  bslmt::ThreadUtil::Handle handles[k_NUM_STRATEGIES];
+//
+//  for (int i = 0; i < k_NUM_STRATEGIES; ++i) {
+//      bslmt::ThreadUtil::create(&handles[i],
+//                                bdlf::BindUtil::bind(&strategy,
+//                                                     &ring,
+//                                                     i,
+//                                                     &volumes[i]));
+//  }
+//..
+// Next, the handler pushes the quotes it receives.  The ring was created in
+// 'e_GATING' mode, so the handler waits if it gets 1024 quotes ahead of the
+// slowest strategy:
+//..
+//  for (int i = 0; i < k_NUM_QUOTES; ++i) {
+//      Quote quote = { i % 17, 100.0 + i % 7, 1 + i % 2 };
+//
+//      ring.pushBack(quote);
+//  }
+//..
+// Finally, the handler signals the end of the feed by disabling the ring, and
+// we verify that every strategy saw every quote:
+//..
+//  ring.disablePushBack();
+//
+//  for (int i = 0; i < k_NUM_STRATEGIES; ++i) {
+//      bslmt::ThreadUtil::join(handles[i]);
+//      assert(15000 == volumes[i]);
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_istriviallycopyable.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                // ================================================
+                // class SingleProducerBroadcastRing_AdvanceGuard
+                // ================================================
+
+template <class RING>
+class SingleProducerBroadcastRing_AdvanceGuard {
+    // This component-private class implements a guard that, upon
+    // destruction, advances the cursor of a consumer of a 'RING' to a
+    // sequence number that is maintained by the client of the guard.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    RING         *d_ring_p;      // ring whose consumer is advanced
+    int           d_consumerId;  // consumer whose cursor is advanced
+    const Uint64 *d_sequence_p;  // sequence to which to advance
+
+    // NOT IMPLEMENTED
+    SingleProducerBroadcastRing_AdvanceGuard(
+                             const SingleProducerBroadcastRing_AdvanceGuard&);
+    SingleProducerBroadcastRing_AdvanceGuard& operator=(
+                             const SingleProducerBroadcastRing_AdvanceGuard&);
+
+  public:
+    // CREATORS
+    SingleProducerBroadcastRing_AdvanceGuard(RING         *ring,
+                                             int           consumerId,
+                                             const Uint64 *sequence);
+        // Create a guard that, upon destruction, advances the cursor of the
+        // consumer having the specified 'consumerId' of the specified 'ring'
+        // to the value of the specified 'sequence' at that time.
+
+    ~SingleProducerBroadcastRing_AdvanceGuard();
+        // Advance the managed cursor, and destroy this object.
+};
+
+                    // =================================
+                    // class SingleProducerBroadcastRing
+                    // =================================
+
+template <class TYPE>
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_ALIGNAS)
+class alignas(bslmt::Platform::e_CACHE_LINE_SIZE) SingleProducerBroadcastRing {
+#else
+class SingleProducerBroadcastRing {
+#endif
+    // This class provides a bounded ring buffer through which a single
+    // producer delivers every value to each of a fixed number of consumers.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64                         Uint64;
+    typedef bsls::AtomicOperations                      AtomicOp;
+    typedef bsls::AtomicOperations::AtomicTypes::Int    AtomicInt;
+    typedef bsls::AtomicOperations::AtomicTypes::Uint64 AtomicUint64;
+
+    struct Cursor {
+        // This 'struct' holds the state of one consumer, padded to occupy a
+        // cache line of its own.
+
+        // PUBLIC DATA
+        AtomicUint64 d_sequence;    // number of values consumed, or
+                                    // 'k_DETACHED'
+
+        AtomicUint64 d_numSkipped;  // number of values overwritten before
+                                    // being consumed
+
+        char         d_pad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                           - 2 * sizeof(AtomicUint64)];
+                                    // padding to prevent false sharing
+    };
+
+    typedef SingleProducerBroadcastRing_AdvanceGuard<
+                                     SingleProducerBroadcastRing<TYPE> > Guard;
+
+    // PRIVATE CONSTANTS
+    static const Uint64 k_DETACHED = ~static_cast<Uint64>(0);
+                                    // cursor of a detached consumer
+
+  public:
+    // PUBLIC TYPES
+    typedef TYPE value_type;  // The type for elements.
+
+    enum OverflowMode {
+        e_GATING,     // the producer waits for the slowest consumer
+        e_OVERWRITE   // the producer overwrites values not yet consumed
+    };
+
+    // PUBLIC CONSTANTS
+    enum {
+        e_SUCCESS  =  0,
+        e_EMPTY    = -1,
+        e_FULL     = -2,
+        e_DISABLED = -3,
+        e_FAILED   = -4
+    };
+
+  private:
+    // DATA
+    AtomicUint64              d_published;      // number of values pushed;
+                                                // written by the producer
+
+    Uint64                    d_gateLimit;      // producer-private: pushes
+                                                // of lesser sequence numbers
+                                                // need not consult the
+                                                // consumer cursors
+
+    AtomicInt                 d_pushDisabled;   // 1 if enqueue disabled, and
+                                                // 0 otherwise
+
+    AtomicInt                 d_producerWaiting;
+                                                // 1 if the producer is
+                                                // blocked, and 0 otherwise
+
+    AtomicInt                 d_numWaitingConsumers;
+                                                // number of blocked consumers
+
+    const char                d_producerPad[
+                                         bslmt::Platform::e_CACHE_LINE_SIZE
+                                       - sizeof(AtomicUint64)
+                                       - sizeof(Uint64)
+                                       - 3 * sizeof(AtomicInt)];
+                                                // padding to keep the data
+                                                // written by the producer
+                                                // in its own cache line
+
+    const bsl::size_t         d_capacity;       // number of slots; a power of
+                                                // 2
+
+    const Uint64              d_mask;           // 'd_capacity - 1'
+
+    const OverflowMode        d_mode;           // overflow mode
+
+    const int                 d_numConsumers;   // number of consumers
+
+    bsl::vector<TYPE>         d_values;         // the slots
+
+    AtomicUint64             *d_slotSequences_p;
+                                                // 'e_OVERWRITE' only: for
+                                                // each slot, '2 * (s + 1)'
+                                                // once the value of sequence
+                                                // 's' is written, and
+                                                // '2 * s + 1' while it is
+                                                // being written
+
+    void                     *d_cursorBuffer_p; // memory holding 'd_cursors_p'
+
+    Cursor                   *d_cursors_p;      // cache-line-aligned consumer
+                                                // cursors
+
+    bslmt::Mutex              d_producerMutex;  // used with
+                                                // 'd_producerCondition'
+
+    bslmt::Condition          d_producerCondition;
+                                                // condition for blocking the
+                                                // producer when the ring is
+                                                // full
+
+    bslmt::Mutex              d_consumerMutex;  // used with
+                                                // 'd_consumerCondition'
+
+    bslmt::Condition          d_consumerCondition;
+                                                // condition for blocking
+                                                // consumers when no value is
+                                                // available
+
+    bslma::Allocator         *d_allocator_p;    // allocator, held not owned
+
+    // FRIENDS
+    friend class SingleProducerBroadcastRing_AdvanceGuard<
+                                           SingleProducerBroadcastRing<TYPE> >;
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t roundUpCapacity(bsl::size_t capacity);
+        // Return the smallest power of 2 that is not less than the specified
+        // 'capacity', or 1 if 'capacity' is 0.
+
+    // PRIVATE MANIPULATORS
+    void advance(int consumerId, Uint64 sequence);
+        // Set the cursor of the consumer having the specified 'consumerId' to
+        // the specified 'sequence', and unblock the producer if it is blocked.
+
+    void initialize();
+        // Initialize the atomic state of this object, and allocate the
+        // consumer cursors and, in 'e_OVERWRITE' mode, the slot sequences.
+        // Note that this method is invoked only by the constructors.
+
+    void publish(Uint64 sequence);
+        // Publish the value of the specified 'sequence', which has been
+        // assigned to its slot, and unblock any blocked consumers.
+
+    int popFrontImp(int          consumerId,
+                    TYPE        *values,
+                    bsl::size_t  maxNumValues,
+                    bsl::size_t *numValues,
+                    bool         isTry);
+        // Load into the specified 'values' up to the specified 'maxNumValues'
+        // values available to the consumer having the specified
+        // 'consumerId', remove them for that consumer, and load their number
+        // into the specified 'numValues'.  If the specified 'isTry' is
+        // 'false', block until at least one value is available.  Return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if no value is available and
+        // 'isPushBackDisabled()', 'e_EMPTY' if no value is available and
+        // 'isTry', and 'e_FAILED' if an underlying mechanism returns an error.
+
+    int reserve(Uint64 *sequence, bool isTry);
+        // Load into the specified 'sequence' the sequence number of the next
+        // value to push, and make its slot writable.  If the specified 'isTry'
+        // is 'false', block (in 'e_GATING' mode) until the slot is no longer
+        // needed by any attached consumer.  Return 'e_SUCCESS' on success,
+        // 'e_DISABLED' if 'isPushBackDisabled()', 'e_FULL' if the slot is
+        // needed and 'isTry', and 'e_FAILED' if an underlying mechanism
+        // returns an error.
+
+    int waitForValues(Uint64 *published,
+                      Uint64  cursor,
+                      bool    isTry);
+        // Load into the specified 'published' the number of values pushed,
+        // once it exceeds the specified 'cursor'.  If the specified 'isTry' is
+        // 'false', block until a value beyond 'cursor' is pushed.  Return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if no value beyond 'cursor' is
+        // available and 'isPushBackDisabled()', 'e_EMPTY' if no such value is
+        // available and 'isTry', and 'e_FAILED' if an underlying mechanism
+        // returns an error.
+
+    // PRIVATE ACCESSORS
+    Uint64 minimumCursor(Uint64 sequence) const;
+        // Return the least cursor of the attached consumers, or the specified
+        // 'sequence' if no consumer is attached.
+
+    // NOT IMPLEMENTED
+    SingleProducerBroadcastRing(const SingleProducerBroadcastRing&);
+    SingleProducerBroadcastRing& operator=(const SingleProducerBroadcastRing&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SingleProducerBroadcastRing,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    SingleProducerBroadcastRing(bsl::size_t       capacity,
+                                int               numConsumers,
+                                bslma::Allocator *basicAllocator = 0);
+    SingleProducerBroadcastRing(bsl::size_t       capacity,
+                                int               numConsumers,
+                                OverflowMode      mode,
+                                bslma::Allocator *basicAllocator = 0);
+        // Create a ring holding at least the specified 'capacity' values
+        // (rounded up to a power of 2), delivering each value to the
+        // specified 'numConsumers' consumers, all of them attached.
+        // Optionally specify the overflow 'mode'; if 'mode' is not specified,
+        // 'e_GATING' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '0 < numConsumers', and unless 'e_GATING == mode' or 'TYPE' is
+        // trivially copyable.
+
+    ~SingleProducerBroadcastRing();
+        // Destroy this object.
+
+    // MANIPULATORS
+    int pushBack(const TYPE& value);
+        // Append the specified 'value' to this ring, making it available to
+        // every consumer.  In 'e_GATING' mode, block until the slot to hold
+        // 'value' is no longer needed by any attached consumer.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPushBackDisabled()', and
+        // 'e_FAILED' if an underlying mechanism returns an error.  A blocked
+        // invocation returns 'e_DISABLED' if 'disablePushBack' is invoked.
+        // The behavior is undefined unless the invoker of this method is the
+        // single producer.
+
+    int pushBack(bslmf::MovableRef<TYPE> value);
+        // Append the specified move-insertable 'value' to this ring, making it
+        // available to every consumer.  'value' is left in a valid but
+        // unspecified state.  In 'e_GATING' mode, block until the slot to hold
+        // 'value' is no longer needed by any attached consumer.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPushBackDisabled()', and
+        // 'e_FAILED' if an underlying mechanism returns an error.  On
+        // failure, 'value' is not changed.  The behavior is undefined unless
+        // the invoker of this method is the single producer.
+
+    int tryPushBack(const TYPE& value);
+        // Append the specified 'value' to this ring without blocking.  Return
+        // 0 on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPushBackDisabled()', and
+        // 'e_FULL' if, in 'e_GATING' mode, the slot to hold 'value' is still
+        // needed by an attached consumer.  The behavior is undefined unless
+        // the invoker of this method is the single producer.
+
+    int tryPushBack(bslmf::MovableRef<TYPE> value);
+        // Append the specified move-insertable 'value' to this ring without
+        // blocking.  'value' is left in a valid but unspecified state.  Return
+        // 0 on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPushBackDisabled()', and
+        // 'e_FULL' if, in 'e_GATING' mode, the slot to hold 'value' is still
+        // needed by an attached consumer.  On failure, 'value' is not
+        // changed.  The behavior is undefined unless the invoker of this
+        // method is the single producer.
+
+    int popFront(int consumerId, TYPE *value);
+        // Load into the specified 'value' the next value available to the
+        // consumer having the specified 'consumerId', and remove it for that
+        // consumer.  If no value is available, block until one is.  Return 0
+        // on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if no value is available and
+        // 'isPushBackDisabled()', and 'e_FAILED' if an underlying mechanism
+        // returns an error.  On failure, 'value' is not changed.  A blocked
+        // invocation returns 'e_DISABLED' if 'disablePushBack' is invoked.
+        // The behavior is undefined unless
+        // '0 <= consumerId < numConsumers()', the consumer is attached, and
+        // the invoker is the single consumer having 'consumerId'.
+
+    int popFront(int          consumerId,
+                 TYPE        *values,
+                 bsl::size_t  maxNumValues,
+                 bsl::size_t *numValues);
+        // Load into the specified 'values' array up to the specified
+        // 'maxNumValues' of the next values available to the consumer having
+        // the specified 'consumerId', remove them for that consumer, and load
+        // their number into the specified 'numValues'.  If no value is
+        // available, block until one is.  Return 0 on success, and a non-zero
+        // value otherwise, with the same error codes as
+        // 'popFront(consumerId, value)'.  The behavior is undefined unless
+        // '0 < maxNumValues', 'values' refers to an array of at least
+        // 'maxNumValues' elements, '0 <= consumerId < numConsumers()', the
+        // consumer is attached, and the invoker is the single consumer having
+        // 'consumerId'.
+
+    int tryPopFront(int consumerId, TYPE *value);
+        // Load into the specified 'value' the next value available to the
+        // consumer having the specified 'consumerId', if any, and remove it
+        // for that consumer, without blocking.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_SUCCESS' on
+        // success, 'e_DISABLED' if no value is available and
+        // 'isPushBackDisabled()', and 'e_EMPTY' if no value is available and
+        // '!isPushBackDisabled()'.  On failure, 'value' is not changed.  The
+        // behavior is undefined unless '0 <= consumerId < numConsumers()', the
+        // consumer is attached, and the invoker is the single consumer having
+        // 'consumerId'.
+
+    int tryPopFront(int          consumerId,
+                    TYPE        *values,
+                    bsl::size_t  maxNumValues,
+                    bsl::size_t *numValues);
+        // Load into the specified 'values' array up to the specified
+        // 'maxNumValues' of the next values available to the consumer having
+        // the specified 'consumerId', remove them for that consumer, and load
+        // their number into the specified 'numValues', without blocking.
+        // Return 0 on success, and a non-zero value otherwise, with the same
+        // error codes as 'tryPopFront(consumerId, value)'.  The behavior is
+        // undefined unless '0 < maxNumValues', 'values' refers to an array of
+        // at least 'maxNumValues' elements,
+        // '0 <= consumerId < numConsumers()', the consumer is attached, and
+        // the invoker is the single consumer having 'consumerId'.
+
+    template <class VISITOR>
+    int visit(int consumerId, VISITOR& visitor, bsl::size_t maxNumValues);
+        // Invoke the specified 'visitor' on a 'const' reference to each of up
+        // to the specified 'maxNumValues' next values available to the
+        // consumer having the specified 'consumerId', in order and without
+        // copying them, and remove those values for that consumer.  If no
+        // value is available, block until one is.  'visitor' must be
+        // invocable as 'visitor(const TYPE&)'.  If 'visitor' throws, the
+        // value on which it threw is not removed.  Return 0 on success, and a
+        // non-zero value otherwise, with the same error codes as
+        // 'popFront(consumerId, value)'.  The behavior is undefined unless
+        // this ring is in 'e_GATING' mode, '0 < maxNumValues',
+        // '0 <= consumerId < numConsumers()', the consumer is attached, and
+        // the invoker is the single consumer having 'consumerId'.
+
+    template <class VISITOR>
+    int tryVisit(int consumerId, VISITOR& visitor, bsl::size_t maxNumValues);
+        // Invoke the specified 'visitor' on a 'const' reference to each of up
+        // to the specified 'maxNumValues' next values available to the
+        // consumer having the specified 'consumerId', in order and without
+        // copying them, and remove those values for that consumer, without
+        // blocking.  'visitor' must be invocable as 'visitor(const TYPE&)'.
+        // If 'visitor' throws, the value on which it threw is not removed.
+        // Return 0 on success, and a non-zero value otherwise, with the same
+        // error codes as 'tryPopFront(consumerId, value)'.  The behavior is
+        // undefined unless this ring is in 'e_GATING' mode,
+        // '0 < maxNumValues', '0 <= consumerId < numConsumers()', the consumer
+        // is attached, and the invoker is the single consumer having
+        // 'consumerId'.
+
+    void detachConsumer(int consumerId);
+        // Detach the consumer having the specified 'consumerId', so that it
+        // no longer gates the producer.  A detached consumer cannot be
+        // re-attached.  The behavior is undefined unless
+        // '0 <= consumerId < numConsumers()', and the invoker is the single
+        // consumer having 'consumerId' or no thread is using that consumer.
+
+                       // Enqueue State
+
+    void disablePushBack();
+        // Disable enqueueing into this ring.  All subsequent invocations of
+        // 'pushBack' or 'tryPushBack' fail immediately, as does a blocked
+        // invocation of 'pushBack'.  Consumers that have consumed every
+        // value fail with 'e_DISABLED', including blocked consumers.  If the
+        // ring is already enqueue disabled, this method has no effect.
+
+    void enablePushBack();
+        // Enable enqueueing.  If the ring is not enqueue disabled, this call
+        // has no effect.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the number of values this ring holds.
+
+    bool isConsumerAttached(int consumerId) const;
+        // Return 'true' if the consumer having the specified 'consumerId' is
+        // attached, and 'false' otherwise.  The behavior is undefined unless
+        // '0 <= consumerId < numConsumers()'.
+
+    bool isPushBackDisabled() const;
+        // Return 'true' if this ring is enqueue disabled, and 'false'
+        // otherwise.  Note that the ring is created in the "enqueue enabled"
+        // state.
+
+    OverflowMode mode() const;
+        // Return the overflow mode of this ring.
+
+    int numConsumers() const;
+        // Return the number of consumers of this ring.
+
+    bsl::size_t numElements(int consumerId) const;
+        // Return the number of values available to the consumer having the
+        // specified 'consumerId', or 0 if the consumer is detached.  The
+        // behavior is undefined unless '0 <= consumerId < numConsumers()'.
+
+    bsls::Types::Uint64 numPushed() const;
+        // Return the number of values pushed into this ring.
+
+    bsls::Types::Uint64 numSkipped(int consumerId) const;
+        // Return the number of values that were overwritten before the
+        // consumer having the specified 'consumerId' consumed them.  Note
+        // that this number is always 0 in 'e_GATING' mode.  The behavior is
+        // undefined unless '0 <= consumerId < numConsumers()'.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                // ------------------------------------------------
+                // class SingleProducerBroadcastRing_AdvanceGuard
+                // ------------------------------------------------
+
+// CREATORS
+template <class RING>
+inline
+SingleProducerBroadcastRing_AdvanceGuard<RING>::
+             SingleProducerBroadcastRing_AdvanceGuard(RING         *ring,
+                                                      int           consumerId,
+                                                      const Uint64 *sequence)
+: d_ring_p(ring)
+, d_consumerId(consumerId)
+, d_sequence_p(sequence)
+{
+}
+
+template <class RING>
+inline
+SingleProducerBroadcastRing_AdvanceGuard<RING>::
+                                    ~SingleProducerBroadcastRing_AdvanceGuard()
+{
+    d_ring_p->advance(d_consumerId, *d_sequence_p);
+}
+
+                    // ---------------------------------
+                    // class SingleProducerBroadcastRing
+                    // ---------------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+bsl::size_t
+SingleProducerBroadcastRing<TYPE>::roundUpCapacity(bsl::size_t capacity)
+{
+    bsl::size_t result = 1;
+    while (result < capacity) {
+        result <<= 1;
+    }
+    return result;
+}
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+void SingleProducerBroadcastRing<TYPE>::advance(int    consumerId,
+                                                Uint64 sequence)
+{
+    // The swap is a full barrier: in 'e_GATING' mode, it orders the preceding
+    // reads of the slots before the producer may overwrite them and, with
+    // 'd_producerWaiting', the wake-up of the producer; in 'e_OVERWRITE' mode,
+    // it orders those reads before the validation of the slot sequences.
+
+    AtomicOp::swapUint64(&d_cursors_p[consumerId].d_sequence, sequence);
+
+    if (AtomicOp::getInt(&d_producerWaiting)) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_producerMutex);
+        }
+        d_producerCondition.signal();
+    }
+}
+
+template <class TYPE>
+void SingleProducerBroadcastRing<TYPE>::initialize()
+{
+    AtomicOp::initUint64(&d_published, 0);
+    AtomicOp::initInt(&d_pushDisabled, 0);
+    AtomicOp::initInt(&d_producerWaiting, 0);
+    AtomicOp::initInt(&d_numWaitingConsumers, 0);
+
+    // Allocate an extra cache line, so that the cursors can start on a cache
+    // line boundary.
+
+    d_cursorBuffer_p = d_allocator_p->allocate(
+                   (d_numConsumers + 1) * bslmt::Platform::e_CACHE_LINE_SIZE);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_cursorBuffer_p,
+                                                        d_allocator_p);
+
+    const bsl::size_t address = reinterpret_cast<bsl::size_t>(
+                                                             d_cursorBuffer_p);
+    d_cursors_p = reinterpret_cast<Cursor *>(
+                      (address + bslmt::Platform::e_CACHE_LINE_SIZE - 1)
+                    & ~static_cast<bsl::size_t>(
+                                     bslmt::Platform::e_CACHE_LINE_SIZE - 1));
+
+    for (int i = 0; i < d_numConsumers; ++i) {
+        AtomicOp::initUint64(&d_cursors_p[i].d_sequence,   0);
+        AtomicOp::initUint64(&d_cursors_p[i].d_numSkipped, 0);
+    }
+
+    if (e_OVERWRITE == d_mode) {
+        d_slotSequences_p = static_cast<AtomicUint64 *>(
+                   d_allocator_p->allocate(d_capacity * sizeof(AtomicUint64)));
+
+        for (bsl::size_t i = 0; i < d_capacity; ++i) {
+            AtomicOp::initUint64(&d_slotSequences_p[i], 0);
+        }
+    }
+
+    proctor.release();
+}
+
+template <class TYPE>
+inline
+void SingleProducerBroadcastRing<TYPE>::publish(Uint64 sequence)
+{
+    if (e_OVERWRITE == d_mode) {
+        AtomicOp::setUint64Release(&d_slotSequences_p[sequence & d_mask],
+                                   2 * sequence + 2);
+    }
+
+    AtomicOp::setUint64(&d_published, sequence + 1);
+
+    if (AtomicOp::getInt(&d_numWaitingConsumers)) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_consumerMutex);
+        }
+        d_consumerCondition.broadcast();
+    }
+}
+
+template <class TYPE>
+int SingleProducerBroadcastRing<TYPE>::popFrontImp(
+                                                  int          consumerId,
+                                                  TYPE        *values,
+                                                  bsl::size_t  maxNumValues,
+                                                  bsl::size_t *numValues,
+                                                  bool         isTry)
+{
+    BSLS_ASSERT(0 <= consumerId);
+    BSLS_ASSERT(consumerId < d_numConsumers);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numValues);
+
+    Cursor& state  = d_cursors_p[consumerId];
+    Uint64  cursor = AtomicOp::getUint64Relaxed(&state.d_sequence);
+
+    BSLS_ASSERT(k_DETACHED != cursor);
+
+    while (true) {
+        Uint64 published;
+
+        const int rc = waitForValues(&published, cursor, isTry);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+
+        if (e_GATING == d_mode) {
+            const bsl::size_t num = static_cast<bsl::size_t>(
+                              published - cursor < maxNumValues
+                              ? published - cursor
+                              : maxNumValues);
+
+            for (bsl::size_t i = 0; i < num; ++i) {
+                values[i] = d_values[(cursor + i) & d_mask];
+            }
+            advance(consumerId, cursor + num);
+            *numValues = num;
+            return e_SUCCESS;                                         // RETURN
+        }
+
+        // 'e_OVERWRITE' mode: skip the values already overwritten, copy the
+        // rest, then discard the copies of values overwritten while they were
+        // being copied.  The producer overwrites slots in sequence order, so
+        // the valid copies are those following the last invalid one.
+
+        Uint64 skipped = 0;
+        if (published - cursor > d_capacity) {
+            skipped = published - cursor - d_capacity;
+            cursor  = published - d_capacity;
+        }
+
+        const bsl::size_t num = static_cast<bsl::size_t>(
+                              published - cursor < maxNumValues
+                              ? published - cursor
+                              : maxNumValues);
+
+        for (bsl::size_t i = 0; i < num; ++i) {
+            values[i] = d_values[(cursor + i) & d_mask];
+        }
+        advance(consumerId, cursor + num);
+
+        bsl::size_t numValid = 0;
+        while (numValid < num) {
+            const Uint64 sequence = cursor + num - numValid - 1;
+            if (2 * sequence + 2 != AtomicOp::getUint64Acquire(
+                                   &d_slotSequences_p[sequence & d_mask])) {
+                break;
+            }
+            ++numValid;
+        }
+
+        skipped += num - numValid;
+        if (skipped) {
+            AtomicOp::addUint64Relaxed(&state.d_numSkipped, skipped);
+        }
+
+        cursor += num;
+
+        if (numValid) {
+            if (numValid < num) {
+                for (bsl::size_t i = 0; i < numValid; ++i) {
+                    values[i] = values[num - numValid + i];
+                }
+            }
+            *numValues = numValid;
+            return e_SUCCESS;                                         // RETURN
+        }
+    }
+}
+
+template <class TYPE>
+int SingleProducerBroadcastRing<TYPE>::reserve(Uint64 *sequence, bool isTry)
+{
+    if (AtomicOp::getIntAcquire(&d_pushDisabled)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    const Uint64 next = AtomicOp::getUint64Relaxed(&d_published);
+
+    *sequence = next;
+
+    if (e_OVERWRITE == d_mode) {
+        // Mark the slot as being written before modifying it, so that a
+        // consumer copying its previous value discards the copy.
+
+        AtomicOp::swapUint64AcqRel(&d_slotSequences_p[next & d_mask],
+                                   2 * next + 1);
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    if (next < d_gateLimit) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    Uint64 minimum = minimumCursor(next);
+    if (next - minimum >= d_capacity && !isTry) {
+        bslmt::ThreadUtil::yield();
+        minimum = minimumCursor(next);
+    }
+
+    if (next - minimum < d_capacity) {
+        d_gateLimit = minimum + d_capacity;
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    if (isTry) {
+        return e_FULL;                                                // RETURN
+    }
+
+    int rc = e_SUCCESS;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_producerMutex);
+
+        AtomicOp::setInt(&d_producerWaiting, 1);
+
+        while (true) {
+            if (AtomicOp::getInt(&d_pushDisabled)) {
+                rc = e_DISABLED;
+                break;
+            }
+            minimum = minimumCursor(next);
+            if (next - minimum < d_capacity) {
+                d_gateLimit = minimum + d_capacity;
+                break;
+            }
+            if (d_producerCondition.wait(&d_producerMutex)) {
+                rc = e_FAILED;
+                break;
+            }
+        }
+
+        AtomicOp::setInt(&d_producerWaiting, 0);
+    }
+    return rc;
+}
+
+template <class TYPE>
+int SingleProducerBroadcastRing<TYPE>::waitForValues(Uint64 *published,
+                                                     Uint64  cursor,
+                                                     bool    isTry)
+{
+    *published = AtomicOp::getUint64Acquire(&d_published);
+    if (*published != cursor) {
+        return e_SUCCESS;                                             // RETURN
+    }
+    if (AtomicOp::getIntAcquire(&d_pushDisabled)) {
+        return e_DISABLED;                                            // RETURN
+    }
+    if (isTry) {
+        return e_EMPTY;                                               // RETURN
+    }
+
+    bslmt::ThreadUtil::yield();
+    *published = AtomicOp::getUint64Acquire(&d_published);
+    if (*published != cursor) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    int rc = e_SUCCESS;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_consumerMutex);
+
+        AtomicOp::addInt(&d_numWaitingConsumers, 1);
+
+        while (cursor == (*published = AtomicOp::getUint64(&d_published))) {
+            if (AtomicOp::getInt(&d_pushDisabled)) {
+                rc = e_DISABLED;
+                break;
+            }
+            if (d_consumerCondition.wait(&d_consumerMutex)) {
+                rc = e_FAILED;
+                break;
+            }
+        }
+
+        AtomicOp::addInt(&d_numWaitingConsumers, -1);
+    }
+    return rc;
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+typename SingleProducerBroadcastRing<TYPE>::Uint64
+SingleProducerBroadcastRing<TYPE>::minimumCursor(Uint64 sequence) const
+{
+    Uint64 result = sequence;
+    for (int i = 0; i < d_numConsumers; ++i) {
+        const Uint64 cursor = AtomicOp::getUint64(&d_cursors_p[i].d_sequence);
+        if (cursor < result) {
+            result = cursor;
+        }
+    }
+    return result;
+}
+
+// CREATORS
+template <class TYPE>
+SingleProducerBroadcastRing<TYPE>::SingleProducerBroadcastRing(
+                                              bsl::size_t       capacity,
+                                              int               numConsumers,
+                                              bslma::Allocator *basicAllocator)
+: d_gateLimit(0)
+, d_producerPad()
+, d_capacity(roundUpCapacity(capacity))
+, d_mask(d_capacity - 1)
+, d_mode(e_GATING)
+, d_numConsumers(numConsumers)
+, d_values(d_capacity, basicAllocator)
+, d_slotSequences_p(0)
+, d_cursorBuffer_p(0)
+, d_cursors_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < numConsumers);
+
+    initialize();
+}
+
+template <class TYPE>
+SingleProducerBroadcastRing<TYPE>::SingleProducerBroadcastRing(
+                                              bsl::size_t       capacity,
+                                              int               numConsumers,
+                                              OverflowMode      mode,
+                                              bslma::Allocator *basicAllocator)
+: d_gateLimit(0)
+, d_producerPad()
+, d_capacity(roundUpCapacity(capacity))
+, d_mask(d_capacity - 1)
+, d_mode(mode)
+, d_numConsumers(numConsumers)
+, d_values(d_capacity, basicAllocator)
+, d_slotSequences_p(0)
+, d_cursorBuffer_p(0)
+, d_cursors_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < numConsumers);
+    BSLS_ASSERT(e_GATING == mode || bsl::is_trivially_copyable<TYPE>::value);
+
+    initialize();
+}
+
+template <class TYPE>
+SingleProducerBroadcastRing<TYPE>::~SingleProducerBroadcastRing()
+{
+    d_allocator_p->deallocate(d_cursorBuffer_p);
+    if (d_slotSequences_p) {
+        d_allocator_p->deallocate(d_slotSequences_p);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+int SingleProducerBroadcastRing<TYPE>::pushBack(const TYPE& value)
+{
+    Uint64    sequence;
+    const int rc = reserve(&sequence, false);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    d_values[sequence & d_mask] = value;
+    publish(sequence);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int SingleProducerBroadcastRing<TYPE>::pushBack(
+                                                 bslmf::MovableRef<TYPE> value)
+{
+    Uint64    sequence;
+    const int rc = reserve(&sequence, false);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    d_values[sequence & d_mask] = bslmf::MovableRefUtil::move(value);
+    publish(sequence);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int SingleProducerBroadcastRing<TYPE>::tryPushBack(const TYPE& value)
+{
+    Uint64    sequence;
+    const int rc = reserve(&sequence, true);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    d_values[sequence & d_mask] = value;
+    publish(sequence);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int SingleProducerBroadcastRing<TYPE>::tryPushBack(
+                                                 bslmf::MovableRef<TYPE> value)
+{
+    Uint64    sequence;
+    const int rc = reserve(&sequence, true);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    d_values[sequence & d_mask] = bslmf::MovableRefUtil::move(value);
+    publish(sequence);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+inline
+int SingleProducerBroadcastRing<TYPE>::popFront(int consumerId, TYPE *value)
+{
+    bsl::size_t numValues;
+    return popFrontImp(consumerId, value, 1, &numValues, false);
+}
+
+template <class TYPE>
+inline
+int SingleProducerBroadcastRing<TYPE>::popFront(int          consumerId,
+                                                TYPE        *values,
+                                                bsl::size_t  maxNumValues,
+                                                bsl::size_t *numValues)
+{
+    return popFrontImp(consumerId, values, maxNumValues, numValues, false);
+}
+
+template <class TYPE>
+inline
+int SingleProducerBroadcastRing<TYPE>::tryPopFront(int consumerId, TYPE *value)
+{
+    bsl::size_t numValues;
+    return popFrontImp(consumerId, value, 1, &numValues, true);
+}
+
+template <class TYPE>
+inline
+int SingleProducerBroadcastRing<TYPE>::tryPopFront(int          consumerId,
+                                                   TYPE        *values,
+                                                   bsl::size_t  maxNumValues,
+                                                   bsl::size_t *numValues)
+{
+    return popFrontImp(consumerId, values, maxNumValues, numValues, true);
+}
+
+template <class TYPE>
+template <class VISITOR>
+int SingleProducerBroadcastRing<TYPE>::visit(int          consumerId,
+                                             VISITOR&     visitor,
+                                             bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT(e_GATING == d_mode);
+    BSLS_ASSERT(0 <= consumerId);
+    BSLS_ASSERT(consumerId < d_numConsumers);
+    BSLS_ASSERT(0 < maxNumValues);
+
+    Uint64 cursor = AtomicOp::getUint64Relaxed(
+                                        &d_cursors_p[consumerId].d_sequence);
+
+    BSLS_ASSERT(k_DETACHED != cursor);
+
+    Uint64    published;
+    const int rc = waitForValues(&published, cursor, false);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    const Uint64 end = published - cursor < maxNumValues
+                       ? published
+                       : cursor + maxNumValues;
+
+    Guard guard(this, consumerId, &cursor);
+    for (; cursor < end; ++cursor) {
+        visitor(static_cast<const TYPE&>(d_values[cursor & d_mask]));
+    }
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+template <class VISITOR>
+int SingleProducerBroadcastRing<TYPE>::tryVisit(int          consumerId,
+                                                VISITOR&     visitor,
+                                                bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT(e_GATING == d_mode);
+    BSLS_ASSERT(0 <= consumerId);
+    BSLS_ASSERT(consumerId < d_numConsumers);
+    BSLS_ASSERT(0 < maxNumValues);
+
+    Uint64 cursor = AtomicOp::getUint64Relaxed(
+                                        &d_cursors_p[consumerId].d_sequence);
+
+    BSLS_ASSERT(k_DETACHED != cursor);
+
+    Uint64    published;
+    const int rc = waitForValues(&published, cursor, true);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    const Uint64 end = published - cursor < maxNumValues
+                       ? published
+                       : cursor + maxNumValues;
+
+    Guard guard(this, consumerId, &cursor);
+    for (; cursor < end; ++cursor) {
+        visitor(static_cast<const TYPE&>(d_values[cursor & d_mask]));
+    }
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+inline
+void SingleProducerBroadcastRing<TYPE>::detachConsumer(int consumerId)
+{
+    BSLS_ASSERT(0 <= consumerId);
+    BSLS_ASSERT(consumerId < d_numConsumers);
+
+    advance(consumerId, k_DETACHED);
+}
+
+template <class TYPE>
+void SingleProducerBroadcastRing<TYPE>::disablePushBack()
+{
+    AtomicOp::setInt(&d_pushDisabled, 1);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_producerMutex);
+    }
+    d_producerCondition.broadcast();
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_consumerMutex);
+    }
+    d_consumerCondition.broadcast();
+}
+
+template <class TYPE>
+inline
+void SingleProducerBroadcastRing<TYPE>::enablePushBack()
+{
+    AtomicOp::setInt(&d_pushDisabled, 0);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bsl::size_t SingleProducerBroadcastRing<TYPE>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class TYPE>
+inline
+bool SingleProducerBroadcastRing<TYPE>::isConsumerAttached(
+                                                          int consumerId) const
+{
+    BSLS_ASSERT(0 <= consumerId);
+    BSLS_ASSERT(consumerId < d_numConsumers);
+
+    return k_DETACHED != AtomicOp::getUint64Acquire(
+                                         &d_cursors_p[consumerId].d_sequence);
+}
+
+template <class TYPE>
+inline
+bool SingleProducerBroadcastRing<TYPE>::isPushBackDisabled() const
+{
+    return 0 != AtomicOp::getIntAcquire(&d_pushDisabled);
+}
+
+template <class TYPE>
+inline
+typename SingleProducerBroadcastRing<TYPE>::OverflowMode
+SingleProducerBroadcastRing<TYPE>::mode() const
+{
+    return d_mode;
+}
+
+template <class TYPE>
+inline
+int SingleProducerBroadcastRing<TYPE>::numConsumers() const
+{
+    return d_numConsumers;
+}
+
+template <class TYPE>
+bsl::size_t SingleProducerBroadcastRing<TYPE>::numElements(
+                                                          int consumerId) const
+{
+    BSLS_ASSERT(0 <= consumerId);
+    BSLS_ASSERT(consumerId < d_numConsumers);
+
+    const Uint64 cursor = AtomicOp::getUint64Acquire(
+                                         &d_cursors_p[consumerId].d_sequence);
+    if (k_DETACHED == cursor) {
+        return 0;                                                     // RETURN
+    }
+
+    const Uint64 published = AtomicOp::getUint64Acquire(&d_published);
+    const Uint64 available = published > cursor ? published - cursor : 0;
+
+    return static_cast<bsl::size_t>(available < d_capacity ? available
+                                                           : d_capacity);
+}
+
+template <class TYPE>
+inline
+bsls::Types::Uint64 SingleProducerBroadcastRing<TYPE>::numPushed() const
+{
+    return AtomicOp::getUint64Acquire(&d_published);
+}
+
+template <class TYPE>
+inline
+bsls::Types::Uint64
+SingleProducerBroadcastRing<TYPE>::numSkipped(int consumerId) const
+{
+    BSLS_ASSERT(0 <= consumerId);
+    BSLS_ASSERT(consumerId < d_numConsumers);
+
+    return AtomicOp::getUint64Relaxed(&d_cursors_p[consumerId].d_numSkipped);
+}
+
+                                  // Aspects
+
+template <class TYPE>
+inline
+bslma::Allocator *SingleProducerBroadcastRing<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
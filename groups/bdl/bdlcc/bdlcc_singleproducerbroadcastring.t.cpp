@@ -0,0 +1,1498 @@
+// bdlcc_singleproducerbroadcastring.t.cpp                            -*-C++-*-
+
+#include <bdlcc_singleproducerbroadcastring.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a bounded ring buffer through which a single
+// producer delivers every value to each of a fixed number of consumers.  The
+// basic behavior of each method is verified with a single thread, which can
+// act as the producer and every consumer in turn.  Blocking behavior is
+// verified with a second thread, and the concurrency concerns (every consumer
+// receives every value, in order, in 'e_GATING' mode; no consumer receives a
+// torn or out-of-order value in 'e_OVERWRITE' mode) are verified with one
+// producer thread and several consumer threads using every way of reading.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SingleProducerBroadcastRing(capacity, numConsumers, *bA = 0);
+// [ 2] SingleProducerBroadcastRing(capacity, numConsumers, mode, *bA = 0);
+// [ 2] ~SingleProducerBroadcastRing();
+//
+// MANIPULATORS
+// [ 2] int pushBack(const TYPE& value);
+// [ 2] int pushBack(bslmf::MovableRef<TYPE> value);
+// [ 3] int tryPushBack(const TYPE& value);
+// [ 3] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [ 2] int popFront(int consumerId, TYPE *value);
+// [ 4] int popFront(int id, TYPE *values, size_t max, size_t *num);
+// [ 2] int tryPopFront(int consumerId, TYPE *value);
+// [ 4] int tryPopFront(int id, TYPE *values, size_t max, size_t *num);
+// [ 5] int visit(int consumerId, VISITOR& visitor, size_t maxNumValues);
+// [ 5] int tryVisit(int consumerId, VISITOR& visitor, size_t maxNumValues);
+// [ 3] void detachConsumer(int consumerId);
+// [ 6] void disablePushBack();
+// [ 6] void enablePushBack();
+//
+// ACCESSORS
+// [ 2] size_t capacity() const;
+// [ 3] bool isConsumerAttached(int consumerId) const;
+// [ 6] bool isPushBackDisabled() const;
+// [ 2] OverflowMode mode() const;
+// [ 2] int numConsumers() const;
+// [ 2] size_t numElements(int consumerId) const;
+// [ 2] Uint64 numPushed() const;
+// [ 7] Uint64 numSkipped(int consumerId) const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] CONCERN: 'e_OVERWRITE' mode skips overwritten values
+// [ 8] CONCERN: blocked producer and consumers are released
+// [ 9] CONCERN: concurrent delivery in 'e_GATING' mode
+// [10] CONCERN: concurrent delivery in 'e_OVERWRITE' mode
+// [11] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::SingleProducerBroadcastRing<int>         Obj;
+typedef bdlcc::SingleProducerBroadcastRing<bsl::string> StringObj;
+typedef bsls::Types::Uint64                             Uint64;
+
+// ============================================================================
+//                   GLOBAL STRUCTS/FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct Summer {
+    // This functor accumulates the values it visits, and optionally throws
+    // when visiting a specified value.
+
+    // DATA
+    int d_sum;
+    int d_count;
+    int d_throwOn;  // value on which to throw, or -1
+
+    // CREATORS
+    explicit Summer(int throwOn = -1)
+    : d_sum(0)
+    , d_count(0)
+    , d_throwOn(throwOn)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()(const int& value)
+    {
+#ifdef BDE_BUILD_TARGET_EXC
+        if (value == d_throwOn) {
+            throw d_throwOn;
+        }
+#endif
+        d_sum += value;
+        ++d_count;
+    }
+};
+
+struct Checked {
+    // This trivially copyable 'struct' holds a sequence number and its
+    // complement, so that a torn copy can be detected.
+
+    // DATA
+    Uint64 d_sequence;
+    Uint64 d_padding[6];
+    Uint64 d_complement;
+};
+
+                        // ==========================
+                        // concurrent test machinery
+                        // ==========================
+
+enum ReadMethod {
+    e_POP_ONE,
+    e_POP_BATCH,
+    e_TRY_POP_BATCH,
+    e_VISIT
+};
+
+struct SequenceChecker {
+    // This functor verifies that the values it visits are consecutive
+    // integers starting from 0.
+
+    // DATA
+    int d_next;
+    int d_numErrors;
+
+    // CREATORS
+    SequenceChecker()
+    : d_next(0)
+    , d_numErrors(0)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()(const int& value)
+    {
+        if (value != d_next) {
+            ++d_numErrors;
+        }
+        d_next = value + 1;
+    }
+};
+
+void gatingConsumer(Obj             *ring,
+                    int              consumerId,
+                    ReadMethod       method,
+                    SequenceChecker *checker)
+    // Read from the specified 'ring', as the consumer having the specified
+    // 'consumerId', using the specified 'method', until 'ring' is disabled,
+    // passing every value read to the specified 'checker'.
+{
+    int         buffer[37];
+    bsl::size_t numValues;
+
+    while (true) {
+        int rc;
+        switch (method) {
+          case e_POP_ONE: {
+            rc = ring->popFront(consumerId, buffer);
+            numValues = 1;
+          } break;
+          case e_POP_BATCH: {
+            rc = ring->popFront(consumerId, buffer, 37, &numValues);
+          } break;
+          case e_TRY_POP_BATCH: {
+            rc = ring->tryPopFront(consumerId, buffer, 37, &numValues);
+            if (Obj::e_EMPTY == rc) {
+                bslmt::ThreadUtil::yield();
+                continue;
+            }
+          } break;
+          default: {
+            rc = ring->visit(consumerId, *checker, 37);
+            numValues = 0;
+          }
+        }
+        if (rc) {
+            ASSERTV(consumerId, rc, Obj::e_DISABLED == rc);
+            return;                                                   // RETURN
+        }
+        for (bsl::size_t i = 0; i < numValues; ++i) {
+            (*checker)(buffer[i]);
+        }
+    }
+}
+
+typedef bdlcc::SingleProducerBroadcastRing<Checked> CheckedObj;
+
+struct OverwriteResult {
+    // This 'struct' holds what a consumer in 'e_OVERWRITE' mode observed.
+
+    Uint64 d_numReceived;
+    Uint64 d_last;        // last sequence received, plus 1
+    int    d_numErrors;
+};
+
+void overwriteConsumer(CheckedObj      *ring,
+                       int              consumerId,
+                       bool             isSlow,
+                       OverwriteResult *result)
+    // Read from the specified 'ring', as the consumer having the specified
+    // 'consumerId', in batches, until 'ring' is disabled, verifying that
+    // every value is consistent and that sequence numbers increase, and load
+    // the outcome into the specified 'result'.  If the specified 'isSlow' is
+    // 'true', yield between batches so as to fall behind the producer.
+{
+    Checked     buffer[16];
+    bsl::size_t numValues;
+
+    result->d_numReceived = 0;
+    result->d_last        = 0;
+    result->d_numErrors   = 0;
+
+    while (0 == ring->popFront(consumerId, buffer, 16, &numValues)) {
+        for (bsl::size_t i = 0; i < numValues; ++i) {
+            const Checked& value = buffer[i];
+            if (value.d_sequence != ~value.d_complement
+             || value.d_sequence < result->d_last) {
+                ++result->d_numErrors;
+            }
+            result->d_last = value.d_sequence + 1;
+            ++result->d_numReceived;
+        }
+        if (isSlow) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+}
+
+void blockedPop(Obj *ring, int consumerId, int *rc, int *value)
+    // Invoke 'popFront' on the specified 'ring' as the consumer having the
+    // specified 'consumerId', and load the result into the specified 'rc' and
+    // the value into the specified 'value'.
+{
+    *rc = ring->popFront(consumerId, value);
+}
+
+void blockedPush(Obj *ring, int value, int *rc)
+    // Invoke 'pushBack' on the specified 'ring' with the specified 'value',
+    // and load the result into the specified 'rc'.
+{
+    *rc = ring->pushBack(value);
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Fanning Out Market Data
+/// - - - - - - - - - - - - - - - - -
+// Suppose a market-data handler receives quotes on one thread and must make
+// every quote available to several strategy threads.  Rather than copying
+// each quote into one queue per strategy, we push each quote once into a
+// 'bdlcc::SingleProducerBroadcastRing', from which every strategy reads it.
+//
+// First, we define the quote type, and a strategy that consumes quotes in
+// batches until the handler signals the end of the feed, computing the total
+// volume:
+//..
+    struct Quote {
+        int    d_instrument;
+        double d_price;
+        int    d_volume;
+    };
+
+    typedef bdlcc::SingleProducerBroadcastRing<Quote> QuoteRing;
+
+    void strategy(QuoteRing *ring, int consumerId, bsls::Types::Int64 *volume)
+        // Consume quotes from the specified 'ring' as the consumer having the
+        // specified 'consumerId', until the end of the feed, and load into the
+        // specified 'volume' their total volume.
+    {
+        enum { k_BATCH_SIZE = 64 };
+
+        Quote       batch[k_BATCH_SIZE];
+        bsl::size_t numQuotes;
+
+        *volume = 0;
+        while (0 == ring->popFront(consumerId,
+                                   batch,
+                                   k_BATCH_SIZE,
+                                   &numQuotes)) {
+            for (bsl::size_t i = 0; i < numQuotes; ++i) {
+                *volume += batch[i].d_volume;
+            }
+        }
+    }
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 11: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Then, we create a ring for three strategies, and start their threads:
+//..
+    enum { k_NUM_STRATEGIES = 3, k_NUM_QUOTES = 10000 };
+
+    QuoteRing ring(1024, k_NUM_STRATEGIES);
+
+    bsls::Types::Int64        volumes[k_NUM_STRATEGIES];
+    bslmt::ThreadUtil::Handle handles[k_NUM_STRATEGIES];
+
+    for (int i = 0; i < k_NUM_STRATEGIES; ++i) {
+        bslmt::ThreadUtil::create(&handles[i],
+                                  bdlf::BindUtil::bind(&strategy,
+                                                       &ring,
+                                                       i,
+                                                       &volumes[i]));
+    }
+//..
+// Next, the handler pushes the quotes it receives.  The ring was created in
+// 'e_GATING' mode, so the handler waits if it gets 1024 quotes ahead of the
+// slowest strategy:
+//..
+    for (int i = 0; i < k_NUM_QUOTES; ++i) {
+        Quote quote = { i % 17, 100.0 + i % 7, 1 + i % 2 };
+
+        ring.pushBack(quote);
+    }
+//..
+// Finally, the handler signals the end of the feed by disabling the ring, and
+// we verify that every strategy saw every quote:
+//..
+    ring.disablePushBack();
+
+    for (int i = 0; i < k_NUM_STRATEGIES; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+        ASSERT(15000 == volumes[i]);
+    }
+//..
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // CONCURRENT DELIVERY IN 'e_OVERWRITE' MODE
+        //
+        // Concerns:
+        //: 1 No consumer receives a torn value, even when the producer
+        //:   overwrites a slot while the consumer copies it.
+        //:
+        //: 2 Each consumer receives values in increasing sequence order.
+        //:
+        //: 3 Every value is either received or counted by 'numSkipped'.
+        //:
+        //: 4 The producer never blocks.
+        //
+        // Plan:
+        //: 1 Push a large number of values holding a sequence number and its
+        //:   complement into a small ring read by fast and slow consumers,
+        //:   and verify each value received and the total counts.  (C-1..4)
+        //
+        // Testing:
+        //   CONCERN: concurrent delivery in 'e_OVERWRITE' mode
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT DELIVERY IN 'e_OVERWRITE' MODE"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        enum { k_NUM_CONSUMERS = 4, k_NUM_VALUES = 400000 };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        CheckedObj mX(32, k_NUM_CONSUMERS, CheckedObj::e_OVERWRITE, &ta);
+
+        OverwriteResult           results[k_NUM_CONSUMERS];
+        bslmt::ThreadUtil::Handle handles[k_NUM_CONSUMERS];
+
+        for (int i = 0; i < k_NUM_CONSUMERS; ++i) {
+            bslmt::ThreadUtil::create(&handles[i],
+                                      bdlf::BindUtil::bind(&overwriteConsumer,
+                                                           &mX,
+                                                           i,
+                                                           i % 2 == 1,
+                                                           &results[i]));
+        }
+
+        for (Uint64 i = 0; i < k_NUM_VALUES; ++i) {
+            Checked value;
+            value.d_sequence   = i;
+            value.d_complement = ~i;
+            for (int j = 0; j < 6; ++j) {
+                value.d_padding[j] = i;
+            }
+            ASSERT(0 == mX.tryPushBack(value));
+
+            if (0 == i % 64) {
+                // Let the consumers catch up, so that they read while the
+                // producer writes.
+
+                bslmt::ThreadUtil::yield();
+            }
+        }
+        mX.disablePushBack();
+
+        for (int i = 0; i < k_NUM_CONSUMERS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+
+            const OverwriteResult& R = results[i];
+
+            if (verbose) {
+                P_(i) P_(R.d_numReceived) P(mX.numSkipped(i))
+            }
+
+            ASSERTV(i, R.d_numErrors, 0 == R.d_numErrors);
+            ASSERTV(i, R.d_numReceived + mX.numSkipped(i),
+                    k_NUM_VALUES == R.d_numReceived + mX.numSkipped(i));
+            ASSERTV(i, R.d_last, k_NUM_VALUES == R.d_last);
+        }
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // CONCURRENT DELIVERY IN 'e_GATING' MODE
+        //
+        // Concerns:
+        //: 1 Every consumer receives every value, once and in order, whichever
+        //:   way it reads, while the producer is gated on the slowest
+        //:   consumer.
+        //:
+        //: 2 A consumer detached while the producer is running stops gating
+        //:   the producer.
+        //
+        // Plan:
+        //: 1 Push consecutive integers into a small ring read by consumers
+        //:   using each way of reading, and verify the sequence each consumer
+        //:   received.  (C-1)
+        //:
+        //: 2 Create one additional consumer that never reads, and detach it
+        //:   after a delay.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: concurrent delivery in 'e_GATING' mode
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT DELIVERY IN 'e_GATING' MODE" << endl
+                          << "======================================" << endl;
+
+        enum { k_NUM_READERS = 4, k_NUM_VALUES = 200000 };
+
+        const ReadMethod METHODS[k_NUM_READERS] = {
+            e_POP_ONE, e_POP_BATCH, e_TRY_POP_BATCH, e_VISIT
+        };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int capacity = 1; capacity <= 64; capacity *= 8) {
+            if (verbose) { T_ P(capacity) }
+
+            Obj mX(capacity, k_NUM_READERS + 1, &ta);  const Obj& X = mX;
+
+            SequenceChecker           checkers[k_NUM_READERS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_READERS];
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                bslmt::ThreadUtil::create(&handles[i],
+                                          bdlf::BindUtil::bind(&gatingConsumer,
+                                                               &mX,
+                                                               i,
+                                                               METHODS[i],
+                                                               &checkers[i]));
+            }
+
+            // The last consumer never reads; the producer fills the ring and
+            // is detected as blocked before the consumer is detached.
+
+            int rc = 0;
+            for (int i = 0; i < capacity; ++i) {
+                rc |= mX.pushBack(i);
+            }
+            ASSERT(0 == rc);
+            ASSERT(Obj::e_FULL == mX.tryPushBack(capacity));
+
+            mX.detachConsumer(k_NUM_READERS);
+
+            for (int i = capacity; i < k_NUM_VALUES; ++i) {
+                rc |= mX.pushBack(i);
+            }
+            ASSERT(0 == rc);
+            mX.disablePushBack();
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+                ASSERTV(capacity, i, checkers[i].d_numErrors,
+                        0 == checkers[i].d_numErrors);
+                ASSERTV(capacity, i, checkers[i].d_next,
+                        k_NUM_VALUES == checkers[i].d_next);
+                ASSERTV(capacity, i, 0 == X.numElements(i));
+            }
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // BLOCKED PRODUCER AND CONSUMERS ARE RELEASED
+        //
+        // Concerns:
+        //: 1 A consumer blocked in 'popFront' returns the value once it is
+        //:   pushed.
+        //:
+        //: 2 A consumer blocked in 'popFront' returns 'e_DISABLED' when the
+        //:   ring is disabled.
+        //:
+        //: 3 A producer blocked in 'pushBack' completes once the slowest
+        //:   consumer reads, or once the slowest consumer is detached.
+        //:
+        //: 4 A producer blocked in 'pushBack' returns 'e_DISABLED' when the
+        //:   ring is disabled.
+        //
+        // Plan:
+        //: 1 Block a thread in each situation, wait until it is blocked, and
+        //:   release it using the method under test.  (C-1..4)
+        //
+        // Testing:
+        //   CONCERN: blocked producer and consumers are released
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BLOCKED PRODUCER AND CONSUMERS ARE RELEASED"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        const bsls::TimeInterval DELAY(0.05);
+
+        if (verbose) cout << "\tConsumer released by a push." << endl;
+        {
+            Obj mX(4, 1, &ta);
+
+            int                       rc    = 1;
+            int                       value = -1;
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle,
+                                      bdlf::BindUtil::bind(&blockedPop,
+                                                           &mX,
+                                                           0,
+                                                           &rc,
+                                                           &value));
+            bslmt::ThreadUtil::sleep(DELAY);
+            ASSERT(1 == rc);
+
+            ASSERT(0 == mX.pushBack(42));
+            bslmt::ThreadUtil::join(handle);
+            ASSERT(0  == rc);
+            ASSERT(42 == value);
+        }
+
+        if (verbose) cout << "\tConsumer released by disabling." << endl;
+        {
+            Obj mX(4, 1, &ta);
+
+            int                       rc    = 1;
+            int                       value = -1;
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle,
+                                      bdlf::BindUtil::bind(&blockedPop,
+                                                           &mX,
+                                                           0,
+                                                           &rc,
+                                                           &value));
+            bslmt::ThreadUtil::sleep(DELAY);
+            ASSERT(1 == rc);
+
+            mX.disablePushBack();
+            bslmt::ThreadUtil::join(handle);
+            ASSERT(Obj::e_DISABLED == rc);
+            ASSERT(-1 == value);
+        }
+
+        if (verbose) cout << "\tProducer released by a read." << endl;
+        for (int detach = 0; detach < 2; ++detach) {
+            Obj mX(2, 2, &ta);
+
+            ASSERT(0 == mX.pushBack(1));
+            ASSERT(0 == mX.pushBack(2));
+
+            int                       rc = 1;
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle,
+                                      bdlf::BindUtil::bind(&blockedPush,
+                                                           &mX,
+                                                           3,
+                                                           &rc));
+            bslmt::ThreadUtil::sleep(DELAY);
+            ASSERT(1 == rc);
+
+            int value;
+            ASSERT(0 == mX.popFront(0, &value));
+            ASSERT(1 == value);
+            bslmt::ThreadUtil::sleep(DELAY);
+            ASSERT(1 == rc);  // consumer 1 still gates the producer
+
+            if (detach) {
+                mX.detachConsumer(1);
+            }
+            else {
+                ASSERT(0 == mX.popFront(1, &value));
+                ASSERT(1 == value);
+            }
+            bslmt::ThreadUtil::join(handle);
+            ASSERT(0 == rc);
+            ASSERT(3 == mX.numPushed());
+        }
+
+        if (verbose) cout << "\tProducer released by disabling." << endl;
+        {
+            Obj mX(1, 1, &ta);
+
+            ASSERT(0 == mX.pushBack(1));
+
+            int                       rc = 1;
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle,
+                                      bdlf::BindUtil::bind(&blockedPush,
+                                                           &mX,
+                                                           2,
+                                                           &rc));
+            bslmt::ThreadUtil::sleep(DELAY);
+            ASSERT(1 == rc);
+
+            mX.disablePushBack();
+            bslmt::ThreadUtil::join(handle);
+            ASSERT(Obj::e_DISABLED == rc);
+            ASSERT(1 == mX.numPushed());
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'e_OVERWRITE' MODE
+        //
+        // Concerns:
+        //: 1 In 'e_OVERWRITE' mode, 'pushBack' and 'tryPushBack' never fail
+        //:   for lack of space.
+        //:
+        //: 2 A consumer more than 'capacity()' values behind receives the
+        //:   most recent 'capacity()' values, and 'numSkipped' reports the
+        //:   number of values it missed.
+        //:
+        //: 3 'numElements' does not exceed 'capacity()'.
+        //:
+        //: 4 Consumers are independent: a consumer that keeps up skips
+        //:   nothing.
+        //:
+        //: 5 Constructing a ring in 'e_OVERWRITE' mode for a type that is not
+        //:   trivially copyable, and visiting in 'e_OVERWRITE' mode, are
+        //:   detected in appropriate build modes.
+        //
+        // Plan:
+        //: 1 Push more than 'capacity()' values, with one consumer reading
+        //:   as they are pushed and another reading only at the end.
+        //:   (C-1..4)
+        //:
+        //: 2 Verify defensive checks using 'AssertTestHandlerGuard'.  (C-5)
+        //
+        // Testing:
+        //   Uint64 numSkipped(int consumerId) const;
+        //   CONCERN: 'e_OVERWRITE' mode skips overwritten values
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'e_OVERWRITE' MODE" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int ti = 0; ti < 3; ++ti) {
+            const int CAPACITY = 8;
+            const int NUM      = 5 + 11 * ti;
+
+            Obj mX(CAPACITY, 2, Obj::e_OVERWRITE, &ta);  const Obj& X = mX;
+            ASSERT(Obj::e_OVERWRITE == X.mode());
+
+            for (int i = 0; i < NUM; ++i) {
+                ASSERTV(ti, i, 0 == (i % 2 ? mX.pushBack(i)
+                                           : mX.tryPushBack(i)));
+
+                int value;
+                ASSERTV(ti, i, 0 == mX.tryPopFront(0, &value));
+                ASSERTV(ti, i, i == value);
+            }
+
+            const int EXP_SKIPPED = NUM > CAPACITY ? NUM - CAPACITY : 0;
+
+            ASSERTV(ti, 0 == X.numElements(0));
+            ASSERTV(ti, NUM - EXP_SKIPPED ==
+                                          static_cast<int>(X.numElements(1)));
+
+            int         values[64];
+            bsl::size_t numValues = 0;
+            ASSERTV(ti, 0 == mX.tryPopFront(1, values, 64, &numValues));
+            ASSERTV(ti, numValues,
+                    NUM - EXP_SKIPPED == static_cast<int>(numValues));
+            for (bsl::size_t i = 0; i < numValues; ++i) {
+                ASSERTV(ti, i, EXP_SKIPPED + static_cast<int>(i) == values[i]);
+            }
+            ASSERTV(ti, EXP_SKIPPED == static_cast<int>(X.numSkipped(1)));
+            ASSERTV(ti, 0 == X.numSkipped(0));
+
+            ASSERTV(ti, Obj::e_EMPTY == mX.tryPopFront(1, values, 64,
+                                                       &numValues));
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(StringObj(4, 1, StringObj::e_GATING, &ta));
+            ASSERT_FAIL(StringObj(4, 1, StringObj::e_OVERWRITE, &ta));
+            ASSERT_PASS(Obj(4, 1, Obj::e_OVERWRITE, &ta));
+
+            Obj    mX(4, 1, Obj::e_OVERWRITE, &ta);
+            Summer summer;
+
+            ASSERT_FAIL(mX.tryVisit(0, summer, 1));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'disablePushBack' AND 'enablePushBack'
+        //
+        // Concerns:
+        //: 1 Pushing into a disabled ring fails with 'e_DISABLED', and does
+        //:   not change the ring.
+        //:
+        //: 2 Consumers of a disabled ring receive the remaining values, and
+        //:   then fail with 'e_DISABLED' (rather than 'e_EMPTY').
+        //:
+        //: 3 'enablePushBack' restores normal operation, and both methods are
+        //:   idempotent.
+        //
+        // Plan:
+        //: 1 Disable and enable a ring with values pending, exercising every
+        //:   push and pop method.  (C-1..3)
+        //
+        // Testing:
+        //   void disablePushBack();
+        //   void enablePushBack();
+        //   bool isPushBackDisabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'disablePushBack' AND 'enablePushBack'" << endl
+                          << "======================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        Obj mX(4, 2, &ta);  const Obj& X = mX;
+        ASSERT(!X.isPushBackDisabled());
+
+        ASSERT(0 == mX.pushBack(1));
+        ASSERT(0 == mX.pushBack(2));
+
+        mX.disablePushBack();
+        ASSERT(X.isPushBackDisabled());
+        mX.disablePushBack();
+        ASSERT(X.isPushBackDisabled());
+
+        ASSERT(Obj::e_DISABLED == mX.pushBack(3));
+        ASSERT(Obj::e_DISABLED == mX.tryPushBack(3));
+        ASSERT(2 == X.numPushed());
+
+        int         value;
+        int         values[4];
+        bsl::size_t numValues;
+        Summer      summer;
+
+        ASSERT(0 == mX.popFront(0, &value));
+        ASSERT(1 == value);
+        ASSERT(0 == mX.tryPopFront(0, &value));
+        ASSERT(2 == value);
+        ASSERT(Obj::e_DISABLED == mX.popFront(0, &value));
+        ASSERT(Obj::e_DISABLED == mX.tryPopFront(0, &value));
+        ASSERT(Obj::e_DISABLED == mX.popFront(0, values, 4, &numValues));
+        ASSERT(Obj::e_DISABLED == mX.tryPopFront(0, values, 4, &numValues));
+        ASSERT(Obj::e_DISABLED == mX.visit(0, summer, 4));
+        ASSERT(Obj::e_DISABLED == mX.tryVisit(0, summer, 4));
+        ASSERT(2 == value);
+
+        ASSERT(0 == mX.visit(1, summer, 4));
+        ASSERT(3 == summer.d_sum);
+
+        mX.enablePushBack();
+        ASSERT(!X.isPushBackDisabled());
+        mX.enablePushBack();
+        ASSERT(!X.isPushBackDisabled());
+
+        ASSERT(Obj::e_EMPTY == mX.tryPopFront(0, &value));
+        ASSERT(0 == mX.pushBack(3));
+        ASSERT(0 == mX.tryPopFront(0, &value));
+        ASSERT(3 == value);
+        ASSERT(0 == mX.tryPopFront(1, &value));
+        ASSERT(3 == value);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'visit' AND 'tryVisit'
+        //
+        // Concerns:
+        //: 1 The visitor is invoked on up to 'maxNumValues' available values,
+        //:   in order, and those values are removed for the consumer only.
+        //:
+        //: 2 'tryVisit' returns 'e_EMPTY' without invoking the visitor if no
+        //:   value is available.
+        //:
+        //: 3 If the visitor throws, the values visited before are removed and
+        //:   the value on which it threw is not.
+        //:
+        //: 4 Visited values are not copied.
+        //
+        // Plan:
+        //: 1 Visit values with various limits, and compare the sums.
+        //:   (C-1..2)
+        //:
+        //: 2 Visit with a visitor throwing on a given value.  (C-3)
+        //:
+        //: 3 Visit a ring of strings, and verify that no memory is
+        //:   allocated.  (C-4)
+        //
+        // Testing:
+        //   int visit(int consumerId, VISITOR& visitor, size_t maxNumValues);
+        //   int tryVisit(int consumerId, VISITOR& visitor, size_t max);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'visit' AND 'tryVisit'" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            Obj mX(8, 2, &ta);  const Obj& X = mX;
+
+            Summer summer;
+            ASSERT(Obj::e_EMPTY == mX.tryVisit(0, summer, 5));
+            ASSERT(0 == summer.d_count);
+
+            for (int i = 1; i <= 6; ++i) {
+                ASSERT(0 == mX.pushBack(i));
+            }
+
+            ASSERT(0 == mX.tryVisit(0, summer, 4));
+            ASSERT(4 == summer.d_count);
+            ASSERT(10 == summer.d_sum);
+            ASSERT(2 == X.numElements(0));
+            ASSERT(6 == X.numElements(1));
+
+            ASSERT(0 == mX.visit(0, summer, 100));
+            ASSERT(6 == summer.d_count);
+            ASSERT(21 == summer.d_sum);
+            ASSERT(0 == X.numElements(0));
+
+#ifdef BDE_BUILD_TARGET_EXC
+            Summer thrower(3);
+            try {
+                mX.visit(1, thrower, 100);
+                ASSERT(0);
+            }
+            catch (int value) {
+                ASSERT(3 == value);
+            }
+            ASSERT(2 == thrower.d_count);
+            ASSERT(4 == X.numElements(1));
+
+            int value;
+            ASSERT(0 == mX.tryPopFront(1, &value));
+            ASSERT(3 == value);
+#endif
+        }
+        {
+            StringObj mX(4, 1, &ta);
+
+            const bsl::string LONG("a string too long for the short buffer",
+                                   &ta);
+            ASSERT(0 == mX.pushBack(LONG));
+
+            struct LengthVisitor {
+                bsl::size_t d_length;
+
+                void operator()(const bsl::string& value)
+                {
+                    d_length += value.length();
+                }
+            } visitor = { 0 };
+
+            const bsls::Types::Int64 NUM_ALLOCS = ta.numAllocations();
+            ASSERT(0 == mX.visit(0, visitor, 1));
+            ASSERT(LONG.length() == visitor.d_length);
+            ASSERT(NUM_ALLOCS == ta.numAllocations());
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj    mX(4, 1, &ta);
+            Summer summer;
+
+            ASSERT(0 == mX.pushBack(1));
+            ASSERT(0 == mX.pushBack(2));
+
+            ASSERT_FAIL(mX.tryVisit(-1, summer, 1));
+            ASSERT_FAIL(mX.tryVisit( 1, summer, 1));
+            ASSERT_FAIL(mX.tryVisit( 0, summer, 0));
+            ASSERT_PASS(mX.tryVisit( 0, summer, 1));
+            ASSERT_FAIL(mX.visit(   -1, summer, 1));
+            ASSERT_FAIL(mX.visit(    0, summer, 0));
+            ASSERT_PASS(mX.visit(    0, summer, 1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BATCHED 'popFront' AND 'tryPopFront'
+        //
+        // Concerns:
+        //: 1 Up to 'maxNumValues' available values are loaded, in order, and
+        //:   their number is returned.
+        //:
+        //: 2 Batches wrap around the end of the ring.
+        //:
+        //: 3 'tryPopFront' returns 'e_EMPTY', and does not modify its
+        //:   arguments, if no value is available.
+        //
+        // Plan:
+        //: 1 Push values in various numbers, and pop them in batches of
+        //:   various sizes, comparing with the expected sequence.  (C-1..3)
+        //
+        // Testing:
+        //   int popFront(int id, TYPE *values, size_t max, size_t *num);
+        //   int tryPopFront(int id, TYPE *values, size_t max, size_t *num);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCHED 'popFront' AND 'tryPopFront'" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (bsl::size_t batch = 1; batch <= 9; ++batch) {
+            Obj mX(8, 1, &ta);  const Obj& X = mX;
+
+            int next     = 0;
+            int expected = 0;
+            for (int round = 0; round < 20; ++round) {
+                const int numPush = 1 + (round * 5) % 8;
+                for (int i = 0; i < numPush; ++i) {
+                    ASSERTV(batch, round, 0 == mX.tryPushBack(next++));
+                }
+
+                while (X.numElements(0)) {
+                    const bsl::size_t available = X.numElements(0);
+
+                    int         values[16];
+                    bsl::size_t numValues = 99;
+                    const int   rc = round % 2
+                                   ? mX.popFront(0, values, batch, &numValues)
+                                   : mX.tryPopFront(0,
+                                                    values,
+                                                    batch,
+                                                    &numValues);
+                    ASSERTV(batch, round, 0 == rc);
+                    const bsl::size_t EXP_NUM = batch < available
+                                              ? batch
+                                              : available;
+                    ASSERTV(batch, round, numValues, EXP_NUM == numValues);
+                    for (bsl::size_t i = 0; i < numValues; ++i) {
+                        ASSERTV(batch, round, i, expected++ == values[i]);
+                    }
+                }
+
+                int         values[16];
+                bsl::size_t numValues = 99;
+                ASSERTV(batch, round, Obj::e_EMPTY ==
+                              mX.tryPopFront(0, values, batch, &numValues));
+                ASSERTV(batch, round, 99 == numValues);
+            }
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj         mX(4, 1, &ta);
+            int         values[4];
+            bsl::size_t numValues;
+
+            ASSERT(0 == mX.pushBack(1));
+            ASSERT(0 == mX.pushBack(2));
+
+            ASSERT_FAIL(mX.tryPopFront(0, values, 0, &numValues));
+            ASSERT_FAIL(mX.tryPopFront(0, 0,      1, &numValues));
+            ASSERT_FAIL(mX.tryPopFront(0, values, 1, 0));
+            ASSERT_FAIL(mX.tryPopFront(1, values, 1, &numValues));
+            ASSERT_PASS(mX.tryPopFront(0, values, 1, &numValues));
+            ASSERT_FAIL(mX.popFront(0, values, 0, &numValues));
+            ASSERT_PASS(mX.popFront(0, values, 1, &numValues));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // GATING, 'tryPushBack', AND 'detachConsumer'
+        //
+        // Concerns:
+        //: 1 In 'e_GATING' mode, 'tryPushBack' fails with 'e_FULL' exactly
+        //:   when the slowest attached consumer is 'capacity()' values
+        //:   behind, and does not modify the ring or the value.
+        //:
+        //: 2 A detached consumer no longer gates the producer, has no
+        //:   elements, and is reported as detached; other consumers are
+        //:   unaffected.
+        //:
+        //: 3 If every consumer is detached, pushes always succeed.
+        //:
+        //: 4 Using a detached consumer is detected in appropriate build
+        //:   modes.
+        //
+        // Plan:
+        //: 1 Fill the ring, and verify that 'tryPushBack' fails until each
+        //:   consumer reads or is detached.  (C-1..3)
+        //:
+        //: 2 Verify defensive checks using 'AssertTestHandlerGuard'.  (C-4)
+        //
+        // Testing:
+        //   int tryPushBack(const TYPE& value);
+        //   int tryPushBack(bslmf::MovableRef<TYPE> value);
+        //   void detachConsumer(int consumerId);
+        //   bool isConsumerAttached(int consumerId) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GATING, 'tryPushBack', AND 'detachConsumer'"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            Obj mX(4, 3, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, 0 == mX.tryPushBack(i));
+            }
+            ASSERT(Obj::e_FULL == mX.tryPushBack(4));
+            ASSERT(4 == X.numPushed());
+
+            int value;
+            ASSERT(0 == mX.popFront(0, &value));
+            ASSERT(0 == mX.popFront(1, &value));
+            ASSERT(Obj::e_FULL == mX.tryPushBack(4));  // consumer 2 gates
+
+            ASSERT(X.isConsumerAttached(2));
+            mX.detachConsumer(2);
+            ASSERT(!X.isConsumerAttached(2));
+            ASSERT(0 == X.numElements(2));
+            ASSERT(X.isConsumerAttached(0));
+
+            ASSERT(0 == mX.tryPushBack(4));
+            ASSERT(Obj::e_FULL == mX.tryPushBack(5));  // consumer 1 gates
+
+            ASSERT(0 == mX.popFront(1, &value));
+            ASSERT(1 == value);
+            ASSERT(Obj::e_FULL == mX.tryPushBack(5));  // consumer 0 gates
+            ASSERT(0 == mX.popFront(0, &value));
+            ASSERT(1 == value);
+            ASSERT(0 == mX.tryPushBack(5));
+
+            mX.detachConsumer(0);
+            mX.detachConsumer(1);
+            for (int i = 6; i < 100; ++i) {
+                ASSERTV(i, 0 == mX.tryPushBack(i));
+            }
+            ASSERT(100 == X.numPushed());
+        }
+
+        if (verbose) cout << "\t'tryPushBack' of a movable value." << endl;
+        {
+            StringObj mX(1, 1, &ta);
+
+            bsl::string value("a string too long for the short buffer", &ta);
+            ASSERT(0 == mX.tryPushBack(bslmf::MovableRefUtil::move(value)));
+
+            bsl::string other("another string too long for the buffer", &ta);
+            ASSERT(StringObj::e_FULL ==
+                          mX.tryPushBack(bslmf::MovableRefUtil::move(other)));
+            ASSERT("another string too long for the buffer" == other);
+
+            bsl::string result(&ta);
+            ASSERT(0 == mX.popFront(0, &result));
+            ASSERT("a string too long for the short buffer" == result);
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(4, 2, &ta);  const Obj& X = mX;
+            int value;
+
+            ASSERT(0 == mX.pushBack(1));
+            mX.detachConsumer(1);
+
+            ASSERT_PASS(mX.tryPopFront(0, &value));
+            ASSERT_FAIL(mX.tryPopFront(1, &value));
+            ASSERT_FAIL(mX.detachConsumer(2));
+            ASSERT_FAIL(X.isConsumerAttached(-1));
+            ASSERT_FAIL(X.isConsumerAttached(2));
+            ASSERT_FAIL(X.numElements(2));
+            ASSERT_FAIL(X.numSkipped(2));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'pushBack', 'popFront', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The capacity is rounded up to a power of 2 (and 0 to 1), and the
+        //:   number of consumers and the mode are as specified.
+        //:
+        //: 2 Every consumer receives every value pushed, in order,
+        //:   independently of the other consumers.
+        //:
+        //: 3 'numElements' and 'numPushed' reflect the values pushed and
+        //:   consumed.
+        //:
+        //: 4 'pushBack' of a movable value moves it.
+        //:
+        //: 5 All memory comes from the object allocator (or the default
+        //:   allocator if none is specified), is propagated to the elements,
+        //:   and is released on destruction.
+        //:
+        //: 6 Precondition violations are detected in appropriate build modes.
+        //
+        // Plan:
+        //: 1 Create rings of various capacities and numbers of consumers,
+        //:   push values, and pop them as each consumer in turn, verifying
+        //:   the accessors throughout.  (C-1..3)
+        //:
+        //: 2 Push a movable string.  (C-4)
+        //:
+        //: 3 Use test allocators to monitor memory.  (C-5)
+        //:
+        //: 4 Verify defensive checks using 'AssertTestHandlerGuard'.  (C-6)
+        //
+        // Testing:
+        //   SingleProducerBroadcastRing(capacity, numConsumers, *bA = 0);
+        //   SingleProducerBroadcastRing(capacity, numC, mode, *bA = 0);
+        //   ~SingleProducerBroadcastRing();
+        //   int pushBack(const TYPE& value);
+        //   int pushBack(bslmf::MovableRef<TYPE> value);
+        //   int popFront(int consumerId, TYPE *value);
+        //   int tryPopFront(int consumerId, TYPE *value);
+        //   size_t capacity() const;
+        //   OverflowMode mode() const;
+        //   int numConsumers() const;
+        //   size_t numElements(int consumerId) const;
+        //   Uint64 numPushed() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, 'pushBack', 'popFront', AND BASIC "
+                          << "ACCESSORS" << endl
+                          << "============================================"
+                          << "=========" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        const struct {
+            bsl::size_t d_capacity;
+            bsl::size_t d_expCapacity;
+        } DATA[] = {
+            { 0, 1 }, { 1, 1 }, { 2, 2 }, { 3, 4 }, { 5, 8 }, { 64, 64 },
+            { 65, 128 }
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const bsl::size_t CAPACITY = DATA[ti].d_capacity;
+            const bsl::size_t EXPECTED = DATA[ti].d_expCapacity;
+
+            for (int numConsumers = 1; numConsumers <= 3; ++numConsumers) {
+            for (int mi = 0; mi < 3; ++mi) {
+                Obj *p = 0 == mi
+                       ? new (ta) Obj(CAPACITY, numConsumers, &ta)
+                       : new (ta) Obj(CAPACITY,
+                                      numConsumers,
+                                      1 == mi ? Obj::e_GATING
+                                              : Obj::e_OVERWRITE,
+                                      &ta);
+                Obj& mX = *p;  const Obj& X = mX;
+
+                ASSERTV(ti, EXPECTED == X.capacity());
+                ASSERTV(ti, numConsumers == X.numConsumers());
+                ASSERTV(ti, (2 == mi ? Obj::e_OVERWRITE : Obj::e_GATING)
+                                                                == X.mode());
+                ASSERTV(ti, &ta == X.allocator());
+                ASSERTV(ti, 0 == X.numPushed());
+                ASSERTV(ti, !X.isPushBackDisabled());
+
+                for (int c = 0; c < numConsumers; ++c) {
+                    ASSERTV(ti, c, 0 == X.numElements(c));
+                    ASSERTV(ti, c, X.isConsumerAttached(c));
+                    ASSERTV(ti, c, 0 == X.numSkipped(c));
+                }
+
+                // Push up to the capacity, then pop as each consumer in turn.
+
+                int next = 0;
+                for (int round = 0; round < 3; ++round) {
+                    for (bsl::size_t i = 0; i < EXPECTED; ++i) {
+                        ASSERTV(ti, i, 0 == mX.pushBack(next + i));
+                    }
+                    ASSERTV(ti, next + EXPECTED == X.numPushed());
+
+                    for (int c = 0; c < numConsumers; ++c) {
+                        ASSERTV(ti, c, EXPECTED == X.numElements(c));
+                        for (bsl::size_t i = 0; i < EXPECTED; ++i) {
+                            int value = -1;
+                            ASSERTV(ti, c, i, 0 == (i % 2
+                                                   ? mX.popFront(c, &value)
+                                                   : mX.tryPopFront(c,
+                                                                    &value)));
+                            ASSERTV(ti, c, i,
+                                    next + static_cast<int>(i) == value);
+                            ASSERTV(ti, c, EXPECTED - i - 1 ==
+                                                         X.numElements(c));
+                        }
+                        int value = -1;
+                        ASSERTV(ti, c, Obj::e_EMPTY ==
+                                                  mX.tryPopFront(c, &value));
+                        ASSERTV(ti, c, -1 == value);
+                    }
+                    next += static_cast<int>(EXPECTED);
+                }
+
+                ta.deleteObject(p);
+            }
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tDefault allocator and element allocator."
+                          << endl;
+        {
+            StringObj mX(2, 1);  const StringObj& X = mX;
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+        {
+            bslma::TestAllocator da("default", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            StringObj mX(2, 2, &ta);
+
+            bsl::string value("a string too long for the short buffer", &ta);
+            ASSERT(0 == mX.pushBack(value));
+            ASSERT(0 == mX.pushBack(bslmf::MovableRefUtil::move(value)));
+
+            bsl::string result(&ta);
+            ASSERT(0 == mX.popFront(1, &result));
+            ASSERT("a string too long for the short buffer" == result);
+            ASSERT(0 == mX.popFront(1, &result));
+            ASSERT("a string too long for the short buffer" == result);
+
+            ASSERT(0 == da.numAllocations());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(4, 0, &ta));
+            ASSERT_PASS(Obj(4, 1, &ta));
+            ASSERT_FAIL(Obj(4, 0, Obj::e_GATING, &ta));
+
+            Obj mX(4, 2, &ta);
+            int value;
+
+            ASSERT(0 == mX.pushBack(1));
+
+            ASSERT_FAIL(mX.tryPopFront(-1, &value));
+            ASSERT_FAIL(mX.tryPopFront( 2, &value));
+            ASSERT_FAIL(mX.tryPopFront( 0, 0));
+            ASSERT_PASS(mX.tryPopFront( 0, &value));
+            ASSERT_FAIL(mX.popFront(    2, &value));
+            ASSERT_PASS(mX.popFront(    1, &value));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a ring with two consumers, push values, and read them as
+        //:   each consumer.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        Obj mX(4, 2, &ta);  const Obj& X = mX;
+        ASSERT(4 == X.capacity());
+        ASSERT(2 == X.numConsumers());
+
+        ASSERT(0 == mX.pushBack(10));
+        ASSERT(0 == mX.pushBack(20));
+        ASSERT(2 == X.numElements(0));
+        ASSERT(2 == X.numElements(1));
+
+        int value;
+        ASSERT(0 == mX.popFront(0, &value));
+        ASSERT(10 == value);
+        ASSERT(1 == X.numElements(0));
+        ASSERT(2 == X.numElements(1));
+
+        int         values[4];
+        bsl::size_t numValues;
+        ASSERT(0 == mX.popFront(1, values, 4, &numValues));
+        ASSERT(2 == numValues);
+        ASSERT(10 == values[0]);
+        ASSERT(20 == values[1]);
+
+        ASSERT(0 == mX.tryPopFront(0, &value));
+        ASSERT(20 == value);
+        ASSERT(Obj::e_EMPTY == mX.tryPopFront(0, &value));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
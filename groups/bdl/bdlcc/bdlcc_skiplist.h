@@ -20,7 +20,7 @@ BSLS_IDENT("$Id: $")
 //  bdlcc::SkipListPair:       type for opaque pointers
 //  bdlcc::SkipListPairHandle: scope mechanism for safe item references
 //
-//@SEE_ALSO:
+//@SEE_ALSO: bdlcc_epochdomain
 //
 //@DESCRIPTION: This component provides a thread-safe value-semantic
 // associative Skip List container.  A Skip List stores objects of a
@@ -116,6 +116,26 @@ BSLS_IDENT("$Id: $")
 // 'releaseReferenceRaw' must be called for *each* such pair reference when it
 // is no longer needed.
 //
+///Epoch-Guarded Lookup
+///--------------------
+// A Skip List may be created with a 'bdlcc::EpochDomain', in which case nodes
+// whose last reference is released are retired to the domain rather than
+// freed immediately.  The methods 'findGuarded', 'frontGuarded', and
+// 'backGuarded' then look up a pair without adding a reference to it: the
+// 'bdlcc::SkipListPair' pointer they load remains valid, even if the pair is
+// concurrently removed from the list, until the calling thread leaves the
+// critical section (delimited by a 'bdlcc::EpochGuard' of the same domain) in
+// which it was obtained.  Such a pointer is not a reference in the sense of
+// the usage rules above: it must not be released, and must not be passed to
+// 'addPairReferenceRaw' or to any method that modifies the list.  Lookups
+// still acquire the lock of the list; only the atomic updates of the
+// reference count, on lookup and on release, are avoided.
+//
+// The domain must outlive the list, and the destructor of the list waits (by
+// calling 'synchronize' on the domain) until every node it retired has been
+// freed, so a list must not be destroyed by a thread that is in a critical
+// section of its domain.
+//
 ///Thread Safety
 ///-------------
 // 'bdlcc::SkipList' is thread-safe and thread-aware; that is, multiple threads
@@ -332,6 +352,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlcc_epochdomain.h>
+
 #include <bslmt_lockguard.h>
 #include <bslmt_condition.h>
 #include <bslmt_mutex.h>
@@ -770,6 +792,8 @@ class SkipList {
 
     PoolManager                               *d_poolManager_p; // owned
 
+    EpochDomain                               *d_epochDomain_p; // held
+
     bslma::Allocator                          *d_allocator_p; // held
 
     // FRIENDS
@@ -881,10 +905,16 @@ class SkipList {
         // lock.  Return the node that was at the front of the list, or 0 if
         // the list was empty.
 
+    static void deleteRetiredNode(void *node, void *list);
+        // Destroy the specified 'node' and return it to the pool of the
+        // specified 'list'.  This function is the deleter with which nodes are
+        // retired to the epoch domain of a list.
+
     void releaseNode(Node *node);
         // Decrement the reference count of the specified 'node', and if it
-        // reaches 0, destroy 'node' and return it to the pool.  Note that this
-        // method neither acquires nor requires the lock.
+        // reaches 0, destroy 'node' and return it to the pool, or, if this
+        // list has an epoch domain, retire it to the domain to be so freed.
+        // Note that this method neither acquires nor requires the lock.
 
     int removeAllImp(bsl::vector<Pair *> *removed, bool unlock);
         // Remove all items from this list, and then unlock the mutex if the
@@ -1048,6 +1078,15 @@ class SkipList {
         // to supply memory.  If 'basicAllocator' is 0, the currently installed
         // default allocator is used.
 
+    explicit SkipList(EpochDomain      *epochDomain,
+                      bslma::Allocator *basicAllocator = 0);
+        // Create a new Skip List that retires released nodes to the specified
+        // 'epochDomain', enabling the 'Guarded' lookup methods.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'epochDomain' outlives this
+        // list.  See "Epoch-Guarded Lookup" in the component documentation.
+
     SkipList(const SkipList& original, bslma::Allocator *basicAllocator = 0);
         // Create a new Skip List initialized to the value of the specified
         // 'original' list.  Optionally specify a 'basicAllocator' used to
@@ -1055,8 +1094,11 @@ class SkipList {
         // default allocator is used.
 
     ~SkipList();
-        // Destroy this Skip List.  The behavior is undefined if references are
-        // outstanding to any pairs in the list.
+        // Destroy this Skip List.  If this list has an epoch domain, first
+        // wait until every node it retired to the domain has been freed.  The
+        // behavior is undefined if references are outstanding to any pairs in
+        // the list, or if this list has an epoch domain and the calling thread
+        // is in a critical section of it.
 
     // MANIPULATORS
     SkipList& operator=(const SkipList& rhs);
@@ -1344,6 +1386,15 @@ class SkipList {
         // success, and a non-zero value if the list is empty.  Note that if
         // the list is empty, the value of '*back' is undefined.
 
+    int backGuarded(Pair **back) const;
+        // Load into the specified 'back' an unreferenced pointer to the last
+        // item in the list, valid until the calling thread leaves its current
+        // critical section of the epoch domain of this list.  Return 0 on
+        // success, and a non-zero value (with no effect on 'back') if the list
+        // is empty.  The behavior is undefined unless this list has an epoch
+        // domain and the calling thread holds a 'bdlcc::EpochGuard' of it.
+        // See "Epoch-Guarded Lookup" in the component documentation.
+
     bool exists(const KEY& key) const;
         // Return 'true' if there is a pair in the list with the specified
         // 'key', and 'false' otherwise.
@@ -1359,6 +1410,15 @@ class SkipList {
         // 'releaseReferenceRaw') when it is no longer needed.  Return 0 on
         // success, and a non-zero value if the list is empty.
 
+    int frontGuarded(Pair **front) const;
+        // Load into the specified 'front' an unreferenced pointer to the first
+        // item in the list, valid until the calling thread leaves its current
+        // critical section of the epoch domain of this list.  Return 0 on
+        // success, and a non-zero value (with no effect on 'front') if the
+        // list is empty.  The behavior is undefined unless this list has an
+        // epoch domain and the calling thread holds a 'bdlcc::EpochGuard' of
+        // it.  See "Epoch-Guarded Lookup" in the component documentation.
+
     bool isEmpty() const;
         // Return 'true' if this list is empty, and 'false' otherwise.
 
@@ -1397,6 +1457,18 @@ class SkipList {
         // undefined which one is returned.  The 'item' reference must be
         // released (using 'releaseReferenceRaw') when it is no longer needed.
 
+    int findGuarded(Pair **item, const KEY& key) const;
+        // Load into the specified 'item' an unreferenced pointer to the
+        // element in this list with the specified 'key' found by searching
+        // the list from the front, valid until the calling thread leaves its
+        // current critical section of the epoch domain of this list.  Return
+        // 0 on success, and a non-zero value (with no effect on 'item') if no
+        // such element exists.  If there are multiple elements in the list
+        // with the 'key', it is undefined which one is returned.  The behavior
+        // is undefined unless this list has an epoch domain and the calling
+        // thread holds a 'bdlcc::EpochGuard' of it.  See "Epoch-Guarded
+        // Lookup" in the component documentation.
+
                             // simple reverse finds
 
     int findR(PairHandle *item, const KEY& key) const;
@@ -1533,6 +1605,10 @@ class SkipList {
 
     bslma::Allocator *allocator() const;
         // Return the allocator used by this object to supply memory.
+
+    EpochDomain *epochDomain() const;
+        // Return the epoch domain to which this list retires released nodes,
+        // or 0 if it has none.
 };
 
 // FREE OPERATORS
@@ -2097,6 +2173,19 @@ SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::popFrontImp()
     return node;
 }
 
+template<class KEY, class DATA>
+void SkipList<KEY, DATA>::deleteRetiredNode(void *node, void *list)
+{
+    BSLS_ASSERT(node);
+    BSLS_ASSERT(list);
+
+    Node *p = static_cast<Node *>(node);
+
+    p->d_key.~KEY();
+    p->d_data.~DATA();
+    PoolUtil::deallocate(static_cast<SkipList *>(list)->d_poolManager_p, p);
+}
+
 template<class KEY, class DATA>
 inline
 void SkipList<KEY, DATA>::releaseNode(Node *node)
@@ -2106,6 +2195,11 @@ void SkipList<KEY, DATA>::releaseNode(Node *node)
     int refCnt = node->decrementRefCount();
 
     if (!refCnt) {
+        if (d_epochDomain_p) {
+            d_epochDomain_p->retire(node, &deleteRetiredNode, this);
+            return;                                                   // RETURN
+        }
+
         node->d_key.~KEY();
         node->d_data.~DATA();
         PoolUtil::deallocate(d_poolManager_p, node);
@@ -2569,17 +2663,33 @@ SkipList<KEY, DATA>::SkipList(bslma::Allocator *basicAllocator)
 : d_listLevel(0)
 , d_length(0)
 , d_poolManager_p(0)
+, d_epochDomain_p(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     initialize();
 }
 
+template<class KEY, class DATA>
+SkipList<KEY, DATA>::SkipList(EpochDomain      *epochDomain,
+                              bslma::Allocator *basicAllocator)
+: d_listLevel(0)
+, d_length(0)
+, d_poolManager_p(0)
+, d_epochDomain_p(epochDomain)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(epochDomain);
+
+    initialize();
+}
+
 template<class KEY, class DATA>
 SkipList<KEY, DATA>::SkipList(const SkipList&   original,
                               bslma::Allocator *basicAllocator)
 : d_listLevel(0)
 , d_length(0)
 , d_poolManager_p(0)
+, d_epochDomain_p(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     initialize();
@@ -2600,6 +2710,13 @@ SkipList<KEY, DATA>::~SkipList()
         p = p->d_ptrs[0].d_next_p;
     }
 
+    if (d_epochDomain_p) {
+        // Nodes retired to the domain are returned to the pool by their
+        // deleter, so must be freed before the pool is.
+
+        d_epochDomain_p->synchronize();
+    }
+
     PoolUtil::deletePoolManager(d_allocator_p, d_poolManager_p);
 }
 
@@ -3040,6 +3157,23 @@ int SkipList<KEY, DATA>::backRaw(Pair **back) const
     return *back ? 0 : -1;
 }
 
+template<class KEY, class DATA>
+int SkipList<KEY, DATA>::backGuarded(Pair **back) const
+{
+    BSLS_ASSERT(back);
+    BSLS_ASSERT(d_epochDomain_p);
+
+    LockGuard guard(&d_lock);
+
+    Node *node = d_tail_p->d_ptrs[0].d_prev_p;
+    if (node == d_head_p) {
+        return -1;                                                    // RETURN
+    }
+
+    *back = reinterpret_cast<Pair *>(node);
+    return 0;
+}
+
 template<class KEY, class DATA>
 bool SkipList<KEY, DATA>::exists(const KEY& key) const
 {
@@ -3080,6 +3214,23 @@ int SkipList<KEY, DATA>::frontRaw(Pair **front) const
     return *front ? 0 : -1;
 }
 
+template<class KEY, class DATA>
+int SkipList<KEY, DATA>::frontGuarded(Pair **front) const
+{
+    BSLS_ASSERT(front);
+    BSLS_ASSERT(d_epochDomain_p);
+
+    LockGuard guard(&d_lock);
+
+    Node *node = d_head_p->d_ptrs[0].d_next_p;
+    if (node == d_tail_p) {
+        return -1;                                                    // RETURN
+    }
+
+    *front = reinterpret_cast<Pair *>(node);
+    return 0;
+}
+
 template<class KEY, class DATA>
 inline
 bool SkipList<KEY, DATA>::isEmpty() const
@@ -3205,6 +3356,26 @@ int SkipList<KEY, DATA>::findRaw(Pair **item, const KEY& key) const
     return *item ? 0 : -1;
 }
 
+template<class KEY, class DATA>
+int SkipList<KEY, DATA>::findGuarded(Pair **item, const KEY& key) const
+{
+    BSLS_ASSERT(item);
+    BSLS_ASSERT(d_epochDomain_p);
+
+    Node *locator[k_MAX_NUM_LEVELS];
+
+    LockGuard guard(&d_lock);
+    lookupImpLowerBound(locator, key);
+
+    Node *q = locator[0];
+    if (q != d_tail_p && q->d_key == key) {
+        *item = reinterpret_cast<Pair *>(q);
+        return 0;                                                     // RETURN
+    }
+
+    return -1;
+}
+
                             // simple reverse finds
 
 template<class KEY, class DATA>
@@ -3449,6 +3620,13 @@ bslma::Allocator *SkipList<KEY, DATA>::allocator() const
     return d_allocator_p;
 }
 
+template<class KEY, class DATA>
+inline
+EpochDomain *SkipList<KEY, DATA>::epochDomain() const
+{
+    return d_epochDomain_p;
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
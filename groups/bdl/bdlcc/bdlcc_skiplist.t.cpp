@@ -32,6 +32,7 @@
 #include <bdlt_datetime.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_review.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -469,6 +470,69 @@ class KeyValue {
 
 }  // close namespace SKIPLIST_TEST_CASE_NO_DEFAULT_CTOR_KEY_VALUE
 
+// ============================================================================
+//                         CASE 30 EPOCH-GUARDED LOOKUP
+// ----------------------------------------------------------------------------
+
+namespace SKIPLIST_TEST_CASE_EPOCH_GUARDED {
+
+typedef bdlcc::SkipList<int, bsl::string> SkipList;
+
+enum { k_NUM_KEYS = 64 };
+
+bsl::string valueForKey(int key)
+    // Return the value stored under the specified 'key', long enough not to
+    // be held in the short-string buffer.
+{
+    bsl::ostringstream oss;
+    oss << "value of key " << key << " -- padded beyond the short buffer";
+    return oss.str();
+}
+
+void guardedReader(SkipList           *list,
+                   bdlcc::EpochDomain *domain,
+                   bsls::AtomicBool   *done,
+                   bsls::AtomicInt    *numErrors,
+                   int                 seed)
+    // Until the specified 'done' is 'true', repeatedly enter a critical
+    // section of the specified 'domain', look up keys pseudo-randomly chosen
+    // from the specified 'seed' in the specified 'list' with 'findGuarded'
+    // and 'frontGuarded', and verify that the pairs found hold the expected
+    // values until the end of the critical section, incrementing the
+    // specified 'numErrors' otherwise.
+{
+    unsigned int state = static_cast<unsigned int>(seed);
+
+    while (!done->load()) {
+        bdlcc::EpochGuard guard(domain);
+
+        SkipList::Pair *pairs[4];
+        int             numPairs = 0;
+
+        for (int i = 0; i < 3; ++i) {
+            state = state * 1103515245 + 12345;
+            const int key = static_cast<int>((state >> 16) % k_NUM_KEYS);
+
+            if (0 == list->findGuarded(&pairs[numPairs], key)) {
+                ++numPairs;
+            }
+        }
+        if (0 == list->frontGuarded(&pairs[numPairs])) {
+            ++numPairs;
+        }
+
+        bslmt::ThreadUtil::yield();
+
+        for (int i = 0; i < numPairs; ++i) {
+            if (valueForKey(pairs[i]->key()) != pairs[i]->data()) {
+                numErrors->addRelaxed(1);
+            }
+        }
+    }
+}
+
+}  // close namespace SKIPLIST_TEST_CASE_EPOCH_GUARDED
+
 // ============================================================================
 //                         CASE 28 DRQS 144652915
 // ----------------------------------------------------------------------------
@@ -907,6 +971,192 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 30: {
+        // --------------------------------------------------------------------
+        // TESTING EPOCH-GUARDED LOOKUP
+        //
+        // Concerns:
+        //: 1 A list created with an epoch domain reports it, and a list
+        //:   created without one reports 0.
+        //:
+        //: 2 'findGuarded', 'frontGuarded', and 'backGuarded' find the same
+        //:   pairs as the corresponding 'Raw' methods, without adding a
+        //:   reference.
+        //:
+        //: 3 A pair found by a guarded lookup remains valid, after it is
+        //:   removed and its last reference released, until the critical
+        //:   section in which it was found ends; the node is retired to the
+        //:   domain rather than freed.
+        //:
+        //: 4 The destructor of the list frees every node it retired.
+        //:
+        //: 5 Guarded lookups in several threads, concurrent with insertion and
+        //:   removal, find only valid pairs.
+        //
+        // Plan:
+        //: 1 Create lists with and without a domain, and verify
+        //:   'epochDomain'.  (C-1)
+        //:
+        //: 2 Populate a list, and look up pairs by key and position with the
+        //:   guarded methods, verifying the pairs found, and that the pair
+        //:   found by 'findGuarded' is the one found by 'findRaw'.  (C-2)
+        //:
+        //: 3 Within a critical section, find a pair with 'findGuarded', remove
+        //:   it, and verify that its key and data remain accessible and that
+        //:   the domain holds one retired node; after the critical section,
+        //:   'synchronize' the domain and verify that the node was freed.
+        //:   (C-3)
+        //:
+        //: 4 Destroy a list having retired nodes, and verify that all memory
+        //:   is returned to the allocator.  (C-4)
+        //:
+        //: 5 Run several threads performing guarded lookups while the main
+        //:   thread repeatedly removes and re-adds keys, and verify that every
+        //:   pair found held the value expected for its key.  (C-5)
+        //
+        // Testing:
+        //   SkipList(EpochDomain *epochDomain, bslma::Allocator *alloc = 0);
+        //   int backGuarded(Pair **back) const;
+        //   int findGuarded(Pair **item, const KEY& key) const;
+        //   int frontGuarded(Pair **front) const;
+        //   EpochDomain *epochDomain() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING EPOCH-GUARDED LOOKUP\n"
+                             "============================\n";
+
+        using namespace SKIPLIST_TEST_CASE_EPOCH_GUARDED;
+
+        bslma::TestAllocator da(veryVeryVeryVerbose);
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard defaultGuard(&da);
+
+        {
+            bdlcc::EpochDomain domain(&ta);
+
+            SkipList plain(&ta);
+            ASSERT(0 == plain.epochDomain());
+
+            SkipList list(&domain, &ta);
+            ASSERT(&domain == list.epochDomain());
+            ASSERT(&ta     == list.allocator());
+
+            SkipList::Pair *pair;
+            {
+                bdlcc::EpochGuard guard(&domain);
+
+                ASSERT(0 != list.findGuarded(&pair, 1));
+                ASSERT(0 != list.frontGuarded(&pair));
+                ASSERT(0 != list.backGuarded(&pair));
+            }
+
+            for (int i = 0; i < 10; ++i) {
+                list.add(i, valueForKey(i));
+            }
+
+            {
+                bdlcc::EpochGuard guard(&domain);
+
+                ASSERT(0 == list.frontGuarded(&pair));
+                ASSERT(0 == pair->key());
+                ASSERT(0 == list.backGuarded(&pair));
+                ASSERT(9 == pair->key());
+                ASSERT(0 == list.findGuarded(&pair, 5));
+                ASSERT(5 == pair->key());
+                ASSERT(valueForKey(5) == pair->data());
+                ASSERT(0 != list.findGuarded(&pair, 10));
+
+                // Remove the pair while it is in use by this critical
+                // section.
+
+                SkipList::Pair *found = 0;
+                ASSERT(0 == list.findGuarded(&found, 3));
+
+                SkipList::Pair *reference;
+                ASSERT(0 == list.findRaw(&reference, 3));
+                ASSERT(found == reference);
+                ASSERT(0 == list.remove(reference));
+                list.releaseReferenceRaw(reference);
+
+                ASSERT(9 == list.length());
+                ASSERT(1 == domain.numRetired());
+
+                ASSERT(3 == found->key());
+                ASSERT(valueForKey(3) == found->data());
+
+                domain.synchronizeAsync();
+                ASSERT(1 == domain.numRetired());
+                ASSERT(valueForKey(3) == found->data());
+            }
+
+            domain.synchronize();
+            ASSERT(0 == domain.numRetired());
+
+            // Nodes released by 'removeAll' are retired, and freed before
+            // the pool by the destructor.
+
+            {
+                SkipList other(&domain, &ta);
+                for (int i = 0; i < 10; ++i) {
+                    other.add(i, valueForKey(i));
+                }
+                other.removeAll();
+                ASSERT(10 == domain.numRetired());
+            }
+            ASSERT(0 == domain.numRetired());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tConcurrent guarded lookups.\n";
+        {
+            enum { k_NUM_READERS = 4, k_NUM_ROUNDS = 200 };
+
+            bdlcc::EpochDomain domain(&ta);
+            SkipList           list(&domain, &ta);
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                list.add(i, valueForKey(i));
+            }
+
+            bsls::AtomicBool done(false);
+            bsls::AtomicInt  numErrors(0);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_READERS];
+            for (int t = 0; t < k_NUM_READERS; ++t) {
+                int rc = bslmt::ThreadUtil::create(
+                                        &handles[t],
+                                        bdlf::BindUtil::bind(&guardedReader,
+                                                             &list,
+                                                             &domain,
+                                                             &done,
+                                                             &numErrors,
+                                                             t + 1));
+                ASSERT(0 == rc);
+            }
+
+            for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+                for (int i = round % 2; i < k_NUM_KEYS; i += 2) {
+                    SkipList::Pair *reference;
+                    if (0 == list.findRaw(&reference, i)) {
+                        list.remove(reference);
+                        list.releaseReferenceRaw(reference);
+                    }
+                    list.add(i, valueForKey(i));
+                }
+                list.popFront();
+                list.add(0, valueForKey(0));
+            }
+
+            done.store(true);
+            for (int t = 0; t < k_NUM_READERS; ++t) {
+                bslmt::ThreadUtil::join(handles[t]);
+            }
+
+            ASSERTV(numErrors, 0 == numErrors);
+            ASSERTV(list.length(), k_NUM_KEYS == list.length());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
       case 29: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG / VERIFY FIX OF DRQS 145745492
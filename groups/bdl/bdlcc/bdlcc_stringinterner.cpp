@@ -0,0 +1,342 @@
+// bdlcc_stringinterner.cpp                                           -*-C++-*-
+#include <bdlcc_stringinterner.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_stringinterner_cpp,"$Id$ $CSID$")
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bslalg_autoarraydestructor.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstring.h>
+#include <bsl_unordered_set.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Each stripe holds the interned strings as keys of a hash table, each key
+// recording the hash of its string, which is computed once by 'intern' (or
+// 'find') and used both to select the stripe and, through
+// 'StringInterner_KeyHash', as the hash of the key within the hash table of
+// the stripe.  Since the hash tables of 'bsl' select buckets by the remainder
+// modulo a prime number of buckets, selecting the stripe by the low-order
+// bits of the same hash does not make some buckets unusable.
+//
+// 'intern' first looks up the string holding the read lock of the stripe and,
+// only if that fails, looks it up again holding the write lock, so that the
+// string is added only once even if several threads intern it concurrently.
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                        // =========================
+                        // struct StringInterner_Key
+                        // =========================
+
+struct StringInterner_Key {
+    // This 'struct' represents a string and its hash, as held in (or looked
+    // up in) the hash table of a stripe.
+
+    // DATA
+    const char  *d_data_p;  // characters of the string
+    bsl::size_t  d_length;  // number of characters
+    bsl::size_t  d_hash;    // hash of the string
+};
+
+                      // =============================
+                      // struct StringInterner_KeyHash
+                      // =============================
+
+struct StringInterner_KeyHash {
+    // This 'struct' provides a hash functor returning the hash recorded in a
+    // key.
+
+    // ACCESSORS
+    bsl::size_t operator()(const StringInterner_Key& key) const
+        // Return the hash recorded in the specified 'key'.
+    {
+        return key.d_hash;
+    }
+};
+
+                      // ==============================
+                      // struct StringInterner_KeyEqual
+                      // ==============================
+
+struct StringInterner_KeyEqual {
+    // This 'struct' provides an equality functor comparing the strings of two
+    // keys.
+
+    // ACCESSORS
+    bool operator()(const StringInterner_Key& lhs,
+                    const StringInterner_Key& rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' keys refer to strings
+        // having the same value, and 'false' otherwise.
+    {
+        return lhs.d_hash   == rhs.d_hash
+            && lhs.d_length == rhs.d_length
+            && (0 == lhs.d_length
+             || 0 == bsl::memcmp(lhs.d_data_p, rhs.d_data_p, lhs.d_length));
+    }
+};
+
+namespace {
+
+StringInterner_Key makeKey(const bslstl::StringRef& string)
+    // Return a key referring to the specified 'string' and recording its
+    // hash.
+{
+    StringInterner_Key key;
+    key.d_data_p = string.data();
+    key.d_length = string.length();
+    key.d_hash   = bslh::Hash<>()(string);
+    return key;
+}
+
+}  // close unnamed namespace
+
+                        // ===========================
+                        // class StringInterner_Stripe
+                        // ===========================
+
+class StringInterner_Stripe {
+    // This component-private class holds the strings of a 'StringInterner'
+    // assigned to one stripe, and the lock serializing access to them.
+
+    // PRIVATE TYPES
+    typedef bsl::unordered_set<StringInterner_Key,
+                               StringInterner_KeyHash,
+                               StringInterner_KeyEqual> KeySet;
+
+    // DATA
+    mutable bslmt::ReaderWriterMutex d_lock;     // guards the other members
+
+    KeySet                           d_keys;     // interned strings
+
+    bdlma::SequentialAllocator       d_storage;  // holds the characters of
+                                                 // the interned strings
+
+    // NOT IMPLEMENTED
+    StringInterner_Stripe(const StringInterner_Stripe&);
+    StringInterner_Stripe& operator=(const StringInterner_Stripe&);
+
+  public:
+    // CREATORS
+    explicit StringInterner_Stripe(bslma::Allocator *basicAllocator);
+        // Create an empty stripe that uses the specified 'basicAllocator' to
+        // supply memory.
+
+    //! ~StringInterner_Stripe() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    bslstl::StringRef intern(const StringInterner_Key& key);
+        // Return a reference to the string held by this stripe having the
+        // value of the string of the specified 'key', first adding a copy of
+        // that string if this stripe holds no such string.
+
+    // ACCESSORS
+    int find(bslstl::StringRef *result, const StringInterner_Key& key) const;
+        // Load into the specified 'result' a reference to the string held by
+        // this stripe having the value of the string of the specified 'key'.
+        // Return 0 on success, and a non-zero value (with no effect on
+        // 'result') if this stripe holds no such string.
+
+    bsl::size_t numStrings() const;
+        // Return the number of strings held by this stripe.
+};
+
+                        // ---------------------------
+                        // class StringInterner_Stripe
+                        // ---------------------------
+
+// CREATORS
+StringInterner_Stripe::StringInterner_Stripe(bslma::Allocator *basicAllocator)
+: d_lock()
+, d_keys(basicAllocator)
+, d_storage(basicAllocator)
+{
+}
+
+// MANIPULATORS
+bslstl::StringRef StringInterner_Stripe::intern(const StringInterner_Key& key)
+{
+    {
+        bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+        KeySet::const_iterator it = d_keys.find(key);
+        if (d_keys.end() != it) {
+            return bslstl::StringRef(it->d_data_p, it->d_length);     // RETURN
+        }
+    }
+
+    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    KeySet::const_iterator it = d_keys.find(key);
+    if (d_keys.end() != it) {
+        // Another thread added the string since the read lock was released.
+
+        return bslstl::StringRef(it->d_data_p, it->d_length);         // RETURN
+    }
+
+    char *data = static_cast<char *>(d_storage.allocate(key.d_length + 1));
+    if (key.d_length) {
+        bsl::memcpy(data, key.d_data_p, key.d_length);
+    }
+    data[key.d_length] = '\0';
+
+    StringInterner_Key copy = key;
+    copy.d_data_p = data;
+
+    // If the insertion throws, the characters are released with the
+    // stripe.
+
+    d_keys.insert(copy);
+
+    return bslstl::StringRef(data, key.d_length);
+}
+
+// ACCESSORS
+int StringInterner_Stripe::find(bslstl::StringRef         *result,
+                                const StringInterner_Key&  key) const
+{
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    KeySet::const_iterator it = d_keys.find(key);
+    if (d_keys.end() == it) {
+        return 1;                                                     // RETURN
+    }
+
+    result->assign(it->d_data_p, it->d_length);
+    return 0;
+}
+
+bsl::size_t StringInterner_Stripe::numStrings() const
+{
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    return d_keys.size();
+}
+
+                           // --------------------
+                           // class StringInterner
+                           // --------------------
+
+// PRIVATE MANIPULATORS
+void StringInterner::init(int numStripes)
+{
+    BSLS_ASSERT(0 < numStripes);
+    BSLS_ASSERT(numStripes <= 65536);
+
+    d_numStripes = 1;
+    while (d_numStripes < static_cast<bsl::size_t>(numStripes)) {
+        d_numStripes <<= 1;
+    }
+
+    d_stripes_p = static_cast<StringInterner_Stripe *>(
+               d_allocator_p->allocate(d_numStripes *
+                                       sizeof(StringInterner_Stripe)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> deallocator(d_stripes_p,
+                                                            d_allocator_p);
+    bslalg::AutoArrayDestructor<StringInterner_Stripe> destructor(
+                                                                  d_stripes_p,
+                                                                  d_stripes_p);
+
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        new (d_stripes_p + i) StringInterner_Stripe(d_allocator_p);
+        destructor.moveEnd(1);
+    }
+
+    destructor.release();
+    deallocator.release();
+}
+
+// PRIVATE ACCESSORS
+StringInterner_Stripe& StringInterner::stripe(bsl::size_t hash) const
+{
+    return d_stripes_p[hash & (d_numStripes - 1)];
+}
+
+// CREATORS
+StringInterner::StringInterner(bslma::Allocator *basicAllocator)
+: d_stripes_p(0)
+, d_numStripes(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init(k_DEFAULT_NUM_STRIPES);
+}
+
+StringInterner::StringInterner(int               numStripes,
+                               bslma::Allocator *basicAllocator)
+: d_stripes_p(0)
+, d_numStripes(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init(numStripes);
+}
+
+StringInterner::~StringInterner()
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_stripes_p[i].~StringInterner_Stripe();
+    }
+    d_allocator_p->deallocate(d_stripes_p);
+}
+
+// MANIPULATORS
+bslstl::StringRef StringInterner::intern(const bslstl::StringRef& string)
+{
+    const StringInterner_Key key = makeKey(string);
+
+    return stripe(key.d_hash).intern(key);
+}
+
+// ACCESSORS
+int StringInterner::find(bslstl::StringRef        *result,
+                         const bslstl::StringRef&  string) const
+{
+    BSLS_ASSERT(result);
+
+    const StringInterner_Key key = makeKey(string);
+
+    return stripe(key.d_hash).find(result, key);
+}
+
+bsl::size_t StringInterner::numStrings() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        result += d_stripes_p[i].numStrings();
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
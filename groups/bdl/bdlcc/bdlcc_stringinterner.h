@@ -0,0 +1,277 @@
+// bdlcc_stringinterner.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLCC_STRINGINTERNER
+#define INCLUDED_BDLCC_STRINGINTERNER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe pool of unique, immutable strings.
+//
+//@CLASSES:
+//  bdlcc::StringInterner: thread-safe string interning table
+//
+//@SEE_ALSO: bdlb_smallstring, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component provides a thread-safe mechanism,
+// 'bdlcc::StringInterner', that maintains a set of unique strings and maps
+// any string to the single copy in the set having its value (a technique
+// known as "interning").  'intern' returns a 'bslstl::StringRef' to that copy,
+// adding it to the set if it is not already present, and 'find' returns it
+// only if it is present.
+//
+// The copies held by an interner are never modified, moved, or removed, so a
+// reference returned by 'intern' (or 'find') remains valid, and refers to the
+// same characters, until the interner is destroyed.  Each copy is followed by
+// a null terminator, so that 'data()' of a returned reference may be used as a
+// C-style string.  Two references returned by the same interner have the same
+// value if and only if they have the same address, so interned strings can be
+// compared (and hashed) by address.
+//
+// Interning suits a program that holds many copies of a comparatively small
+// number of distinct values, such as the symbols of instruments in the
+// messages of a market data feed: each distinct symbol is held once, by the
+// interner, and each message holds only a 'bslstl::StringRef' to it.
+//
+///Concurrency
+///-----------
+// The set of strings is divided into a number of *stripes*, specified at
+// construction, and each string is assigned to a stripe by its hash value.
+// Each stripe has its own reader-writer lock, hash table, and storage for the
+// characters of its strings.  'intern' and 'find' lock only the stripe of the
+// string requested, and only for reading if the string is already present, so
+// that threads interning strings already present do not contend, and threads
+// adding strings contend only if those strings are in the same stripe.  The
+// hash of a string is computed once per call, outside of any lock.
+//
+///Memory Usage
+///------------
+// The characters of the strings in each stripe are held by a
+// 'bdlma::SequentialAllocator', in blocks obtained from the allocator supplied
+// at construction, so that interning a string usually requires no allocation
+// beyond a node of the hash table of the stripe.  Memory is released only
+// when the interner is destroyed.  An interner should therefore not be used
+// for an unbounded set of values (e.g., values read from an untrusted source).
+//
+///Thread Safety
+///-------------
+// 'bdlcc::StringInterner' is fully *thread-safe*, meaning that all
+// non-creator operations on an object can be safely invoked simultaneously
+// from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing the Symbols of Quotes
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose a market data handler receives quotes, each identifying its
+// instrument by a symbol, and keeps the most recent quotes for later
+// processing.  Most quotes are for a small number of instruments, so rather
+// than copy the symbol into each quote, the handler interns it.
+//
+// First, we define the quote type, which refers to its symbol:
+//..
+//  struct Quote {
+//      // This 'struct' represents a quote for an instrument.
+//
+//      bslstl::StringRef d_symbol;  // interned symbol of the instrument
+//      double            d_price;   // quoted price
+//  };
+//..
+// Then, we define a function that builds a quote from the fields of a
+// message, interning the symbol:
+//..
+//  Quote makeQuote(bdlcc::StringInterner    *interner,
+//                  const bslstl::StringRef&  symbol,
+//                  double                    price)
+//      // Return a quote of the specified 'price' for the instrument having
+//      // the specified 'symbol', interned by the specified 'interner'.
+//  {
+//      Quote quote;
+//      quote.d_symbol = interner->intern(symbol);
+//      quote.d_price  = price;
+//      return quote;
+//  }
+//..
+// Next, we create an interner, and build quotes from symbols held in a buffer
+// that is reused, as is the case for symbols parsed from incoming messages:
+//..
+//  bdlcc::StringInterner interner;
+//
+//  char buffer[32];
+//
+//  bsl::strcpy(buffer, "IBM US Equity");
+//  Quote q1 = makeQuote(&interner, buffer, 101.5);
+//
+//  bsl::strcpy(buffer, "VOD LN Equity");
+//  Quote q2 = makeQuote(&interner, buffer, 2.25);
+//
+//  bsl::strcpy(buffer, "IBM US Equity");
+//  Quote q3 = makeQuote(&interner, buffer, 101.75);
+//..
+// Now, we observe that the quotes refer to copies of the symbols owned by the
+// interner, and that quotes for the same instrument share the same copy:
+//..
+//  assert("IBM US Equity" == q1.d_symbol);
+//  assert("VOD LN Equity" == q2.d_symbol);
+//
+//  assert(q1.d_symbol.data() != buffer);
+//  assert(q1.d_symbol.data() == q3.d_symbol.data());
+//  assert(q1.d_symbol.data() != q2.d_symbol.data());
+//
+//  assert(2 == interner.numStrings());
+//..
+// Finally, we look up a symbol without interning it:
+//..
+//  bslstl::StringRef symbol;
+//
+//  assert(0 == interner.find(&symbol, "VOD LN Equity"));
+//  assert(q2.d_symbol.data() == symbol.data());
+//
+//  assert(0 != interner.find(&symbol, "MSFT US Equity"));
+//  assert(2 == interner.numStrings());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+class StringInterner_Stripe;
+
+                           // ====================
+                           // class StringInterner
+                           // ====================
+
+class StringInterner {
+    // This class provides a thread-safe set of unique strings, each of which
+    // is held at a fixed address until the set is destroyed.
+
+    // DATA
+    StringInterner_Stripe *d_stripes_p;    // array of 'd_numStripes' stripes
+
+    bsl::size_t            d_numStripes;   // number of stripes; a power of 2
+
+    bslma::Allocator      *d_allocator_p;  // memory allocator (held, not
+                                           // owned)
+
+    // NOT IMPLEMENTED
+    StringInterner(const StringInterner&);
+    StringInterner& operator=(const StringInterner&);
+
+    // PRIVATE MANIPULATORS
+    void init(int numStripes);
+        // Create the stripes of this object, the number of which is the
+        // specified 'numStripes' rounded up to a power of 2.  The behavior is
+        // undefined unless '0 < numStripes'.
+
+    // PRIVATE ACCESSORS
+    StringInterner_Stripe& stripe(bsl::size_t hash) const;
+        // Return a reference providing modifiable access to the stripe
+        // holding strings having the specified 'hash'.
+
+  public:
+    // CONSTANTS
+    enum { k_DEFAULT_NUM_STRIPES = 16 };
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StringInterner, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit StringInterner(bslma::Allocator *basicAllocator = 0);
+    explicit StringInterner(int               numStripes,
+                            bslma::Allocator *basicAllocator = 0);
+        // Create an empty interner.  Optionally specify 'numStripes', the
+        // number of independently locked parts of this interner, rounded up
+        // to a power of 2; if 'numStripes' is not specified,
+        // 'k_DEFAULT_NUM_STRIPES' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < numStripes <= 65536'.
+
+    ~StringInterner();
+        // Destroy this object, releasing the strings it holds.  The behavior
+        // is undefined if any reference returned by 'intern' or 'find' is
+        // subsequently used.
+
+    // MANIPULATORS
+    bslstl::StringRef intern(const bslstl::StringRef& string);
+        // Return a reference to the string held by this interner having the
+        // value of the specified 'string', first adding a copy of 'string' to
+        // this interner if it holds no such string.  The characters referred
+        // to by the returned reference are followed by a null terminator, and
+        // remain valid until this interner is destroyed.
+
+    // ACCESSORS
+    int find(bslstl::StringRef        *result,
+             const bslstl::StringRef&  string) const;
+        // Load into the specified 'result' a reference to the string held by
+        // this interner having the value of the specified 'string'.  Return 0
+        // on success, and a non-zero value (with no effect on 'result') if
+        // this interner holds no such string.
+
+    bsl::size_t numStrings() const;
+        // Return the number of strings held by this interner.  Note that, in
+        // the presence of concurrent calls to 'intern', the value returned
+        // may be out of date by the time it is returned.
+
+    bsl::size_t numStripes() const;
+        // Return the number of stripes of this interner.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this interner to supply memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                           // --------------------
+                           // class StringInterner
+                           // --------------------
+
+// ACCESSORS
+inline
+bsl::size_t StringInterner::numStripes() const
+{
+    return d_numStripes;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *StringInterner::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,688 @@
+// bdlcc_stringinterner.t.cpp                                         -*-C++-*-
+#include <bdlcc_stringinterner.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread-safe set of unique strings.  The
+// mapping from values to interned strings is verified with a single thread
+// against a 'bsl::map' holding the address returned when each value was first
+// interned, for several numbers of stripes and for values that differ only in
+// length or in embedded null characters.  The concurrency concern, that
+// threads interning the same values concurrently obtain the same string for
+// each value, is verified with several threads released together by a
+// barrier.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit StringInterner(bslma::Allocator *basicAllocator = 0);
+// [ 2] explicit StringInterner(int numStripes, *basicAllocator = 0);
+// [ 2] ~StringInterner();
+//
+// MANIPULATORS
+// [ 3] bslstl::StringRef intern(const bslstl::StringRef& string);
+//
+// ACCESSORS
+// [ 3] int find(bslstl::StringRef *result, const StringRef& string) const;
+// [ 3] bsl::size_t numStrings() const;
+// [ 2] bsl::size_t numStripes() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: concurrent interning yields a single copy of each value
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::StringInterner Obj;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::string makeValue(int index, bslma::Allocator *basicAllocator)
+    // Return a distinct value for the specified 'index', using the specified
+    // 'basicAllocator' to supply memory.  Values have lengths from 0 to 39,
+    // and some hold embedded null characters.
+{
+    bsl::ostringstream stream(basicAllocator);
+    stream << index;
+
+    bsl::string value(stream.str(), basicAllocator);
+    if (index % 3 == 0) {
+        value.push_back('\0');
+    }
+    value.append(static_cast<bsl::size_t>(index % 37), 'x');
+    return value;
+}
+
+void internWorker(Obj                             *interner,
+                  bslmt::Barrier                  *barrier,
+                  const bsl::vector<bsl::string>  *values,
+                  bsl::vector<bslstl::StringRef>  *results,
+                  int                              threadIndex)
+    // Wait on the specified 'barrier', and then intern each of the specified
+    // 'values' with the specified 'interner', starting from a position
+    // determined by the specified 'threadIndex', and load the result for each
+    // value into the corresponding element of the specified 'results'.
+{
+    const bsl::size_t numValues = values->size();
+    const bsl::size_t start     = (threadIndex * 7919) % numValues;
+
+    barrier->wait();
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        const bsl::size_t index = (start + i) % numValues;
+
+        (*results)[index] = interner->intern((*values)[index]);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing the Symbols of Quotes
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose a market data handler receives quotes, each identifying its
+// instrument by a symbol, and keeps the most recent quotes for later
+// processing.  Most quotes are for a small number of instruments, so rather
+// than copy the symbol into each quote, the handler interns it.
+//
+// First, we define the quote type, which refers to its symbol:
+//..
+struct Quote {
+    // This 'struct' represents a quote for an instrument.
+
+    bslstl::StringRef d_symbol;  // interned symbol of the instrument
+    double            d_price;   // quoted price
+};
+//..
+// Then, we define a function that builds a quote from the fields of a
+// message, interning the symbol:
+//..
+Quote makeQuote(bdlcc::StringInterner    *interner,
+                const bslstl::StringRef&  symbol,
+                double                    price)
+    // Return a quote of the specified 'price' for the instrument having
+    // the specified 'symbol', interned by the specified 'interner'.
+{
+    Quote quote;
+    quote.d_symbol = interner->intern(symbol);
+    quote.d_price  = price;
+    return quote;
+}
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Next, we create an interner, and build quotes from symbols held in a buffer
+// that is reused, as is the case for symbols parsed from incoming messages:
+//..
+        bdlcc::StringInterner interner;
+
+        char buffer[32];
+
+        bsl::strcpy(buffer, "IBM US Equity");
+        Quote q1 = makeQuote(&interner, buffer, 101.5);
+
+        bsl::strcpy(buffer, "VOD LN Equity");
+        Quote q2 = makeQuote(&interner, buffer, 2.25);
+
+        bsl::strcpy(buffer, "IBM US Equity");
+        Quote q3 = makeQuote(&interner, buffer, 101.75);
+//..
+// Now, we observe that the quotes refer to copies of the symbols owned by the
+// interner, and that quotes for the same instrument share the same copy:
+//..
+        ASSERT("IBM US Equity" == q1.d_symbol);
+        ASSERT("VOD LN Equity" == q2.d_symbol);
+
+        ASSERT(q1.d_symbol.data() != buffer);
+        ASSERT(q1.d_symbol.data() == q3.d_symbol.data());
+        ASSERT(q1.d_symbol.data() != q2.d_symbol.data());
+
+        ASSERT(2 == interner.numStrings());
+//..
+// Finally, we look up a symbol without interning it:
+//..
+        bslstl::StringRef symbol;
+
+        ASSERT(0 == interner.find(&symbol, "VOD LN Equity"));
+        ASSERT(q2.d_symbol.data() == symbol.data());
+
+        ASSERT(0 != interner.find(&symbol, "MSFT US Equity"));
+        ASSERT(2 == interner.numStrings());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT INTERNING YIELDS A SINGLE COPY OF EACH VALUE
+        //
+        // Concerns:
+        //: 1 Threads interning the same values concurrently, in different
+        //:   orders, obtain the same string for each value.
+        //:
+        //: 2 Each value is added to the interner exactly once.
+        //
+        // Plan:
+        //: 1 For several numbers of stripes, start several threads that wait
+        //:   on a barrier and then intern the same values, each starting from
+        //:   a different position.  Verify that the threads obtained the same
+        //:   address, and the intended value, for each value, and that the
+        //:   interner holds the number of distinct values.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: concurrent interning yields a single copy of each value
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONCURRENT INTERNING" << endl
+                          << "=============================" << endl;
+
+        enum { k_NUM_THREADS = 8, k_NUM_VALUES = 5000 };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        bsl::vector<bsl::string> values(&ta);
+        for (int i = 0; i < k_NUM_VALUES; ++i) {
+            values.push_back(makeValue(i, &ta));
+        }
+
+        static const int STRIPES[] = { 1, 4, 16 };
+        enum { NUM_STRIPES = sizeof STRIPES / sizeof *STRIPES };
+
+        for (int ti = 0; ti < NUM_STRIPES; ++ti) {
+            if (veryVerbose) { T_ P(STRIPES[ti]) }
+
+            Obj mX(STRIPES[ti], &ta);  const Obj& X = mX;
+
+            bslmt::Barrier barrier(k_NUM_THREADS);
+
+            bsl::vector<bsl::vector<bslstl::StringRef> > results(&ta);
+            results.resize(k_NUM_THREADS);
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                results[t].resize(k_NUM_VALUES);
+            }
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                int rc = bslmt::ThreadUtil::create(
+                                        &handles[t],
+                                        bdlf::BindUtil::bind(&internWorker,
+                                                             &mX,
+                                                             &barrier,
+                                                             &values,
+                                                             &results[t],
+                                                             t));
+                ASSERTV(t, 0 == rc);
+            }
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                bslmt::ThreadUtil::join(handles[t]);
+            }
+
+            ASSERTV(ti, X.numStrings(), k_NUM_VALUES == X.numStrings());
+
+            for (int i = 0; i < k_NUM_VALUES; ++i) {
+                const bslstl::StringRef& R = results[0][i];
+
+                ASSERTV(ti, i, values[i] == R);
+                ASSERTV(ti, i, '\0' == R.data()[R.length()]);
+
+                for (int t = 1; t < k_NUM_THREADS; ++t) {
+                    ASSERTV(ti, i, t, R.data() == results[t][i].data());
+                }
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INTERN AND FIND
+        //
+        // Concerns:
+        //: 1 'intern' returns a reference having the value of its argument,
+        //:   followed by a null terminator, and not referring to the argument.
+        //:
+        //: 2 'intern' returns the same address for all strings having the same
+        //:   value, and different addresses for different values, including
+        //:   values differing only in length or in embedded null characters,
+        //:   and the empty string.
+        //:
+        //: 3 'find' loads the interned string for a value that was interned,
+        //:   and otherwise returns non-zero without modifying its result or
+        //:   the interner.
+        //:
+        //: 4 'numStrings' returns the number of distinct values interned.
+        //:
+        //: 5 The behavior is independent of the number of stripes.
+        //:
+        //: 6 All memory is supplied by the allocator of the interner, and is
+        //:   released when the interner is destroyed.
+        //
+        // Plan:
+        //: 1 For several numbers of stripes, intern a sequence of values, each
+        //:   value several times, from freshly built strings, and verify the
+        //:   results against a 'bsl::map' holding the address returned when
+        //:   each value was first interned.  (C-1..2, 4..5)
+        //:
+        //: 2 Call 'find' for values interned and not interned.  (C-3)
+        //:
+        //: 3 Verify the allocators used.  (C-6)
+        //
+        // Testing:
+        //   bslstl::StringRef intern(const bslstl::StringRef& string);
+        //   int find(bslstl::StringRef *result, const StringRef& s) const;
+        //   bsl::size_t numStrings() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INTERN AND FIND" << endl
+                          << "===============" << endl;
+
+        enum { k_NUM_VALUES = 1000 };
+
+        bslma::TestAllocator ta("test",    veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        static const int STRIPES[] = { 1, 2, 3, 16, 100 };
+        enum { NUM_STRIPES = sizeof STRIPES / sizeof *STRIPES };
+
+        for (int ti = 0; ti < NUM_STRIPES; ++ti) {
+            if (veryVerbose) { T_ P(STRIPES[ti]) }
+
+            {
+                Obj mX(STRIPES[ti], &ta);  const Obj& X = mX;
+
+                typedef bsl::map<bsl::string, const char *> Oracle;
+
+                Oracle oracle(&sa);
+
+                for (int round = 0; round < 3; ++round) {
+                    for (int i = 0; i < k_NUM_VALUES; ++i) {
+                        const bsl::string VALUE = makeValue(i, &sa);
+
+                        bslstl::StringRef result;
+                        const int         rc = X.find(&result, VALUE);
+
+                        const bslstl::StringRef R = mX.intern(VALUE);
+
+                        ASSERTV(ti, i, VALUE == R);
+                        ASSERTV(ti, i, R.data() != VALUE.data());
+                        ASSERTV(ti, i, '\0' == R.data()[R.length()]);
+
+                        Oracle::iterator it = oracle.find(VALUE);
+                        if (oracle.end() == it) {
+                            ASSERTV(ti, i, 0 != rc);
+                            ASSERTV(ti, i, 0 == round);
+                            ASSERTV(ti, i, 0 == result.data());
+                            oracle[VALUE] = R.data();
+                        }
+                        else {
+                            ASSERTV(ti, i, 0 == rc);
+                            ASSERTV(ti, i, it->second == R.data());
+                            ASSERTV(ti, i, R.data() == result.data());
+                            ASSERTV(ti, i, R.length() == result.length());
+                        }
+                        ASSERTV(ti, i, oracle.size() == X.numStrings());
+                    }
+                }
+
+                // Distinct values have distinct addresses.
+
+                bsl::map<const char *, int> addresses(&sa);
+                for (Oracle::iterator it = oracle.begin();
+                     it != oracle.end();
+                     ++it) {
+                    ++addresses[it->second];
+                }
+                ASSERTV(ti, oracle.size() == addresses.size());
+
+                // The empty string, and values differing only in embedded
+                // null characters, are distinct.
+
+                const bslstl::StringRef EMPTY = mX.intern("");
+                ASSERTV(ti, 0 == EMPTY.length());
+                ASSERTV(ti, 0 != EMPTY.data());
+                ASSERTV(ti, '\0' == *EMPTY.data());
+                const bslstl::StringRef NULL_REF;
+                ASSERTV(ti, EMPTY.data() == mX.intern(NULL_REF).data());
+
+                const bslstl::StringRef A1 =
+                                         mX.intern(bslstl::StringRef("a", 1));
+                const bslstl::StringRef A2 =
+                                       mX.intern(bslstl::StringRef("a\0", 2));
+                const bslstl::StringRef A3 =
+                                     mX.intern(bslstl::StringRef("a\0\0", 3));
+                ASSERTV(ti, A1.data() != A2.data());
+                ASSERTV(ti, A2.data() != A3.data());
+                ASSERTV(ti, 2 == A2.length());
+                ASSERTV(ti, oracle.size() + 4 == X.numStrings());
+
+                bslstl::StringRef result("unchanged");
+                ASSERTV(ti, 0 != X.find(&result,
+                                        bslstl::StringRef("a\0\0\0", 4)));
+                ASSERTV(ti, "unchanged" == result);
+                ASSERTV(ti, oracle.size() + 4 == X.numStrings());
+
+                ASSERTV(ti, 0 < ta.numBlocksInUse());
+            }
+            ASSERTV(ti, 0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructors use the intended allocator, which is the
+        //:   default allocator if none (or 0) is supplied.
+        //:
+        //: 2 The number of stripes is the requested number rounded up to a
+        //:   power of 2, or 'k_DEFAULT_NUM_STRIPES' if none is requested.
+        //:
+        //: 3 An empty interner holds no strings, and the destructor releases
+        //:   all memory.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create interners with each constructor, with and without
+        //:   allocators, and verify the allocator, the number of stripes, and
+        //:   the memory in use after destruction.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid numbers of stripes.  (C-4)
+        //
+        // Testing:
+        //   explicit StringInterner(bslma::Allocator *basicAllocator = 0);
+        //   explicit StringInterner(int numStripes, *basicAllocator = 0);
+        //   ~StringInterner();
+        //   bsl::size_t numStripes() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            const Obj X;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+            ASSERT(0 == X.numStrings());
+        }
+        ASSERT(0 <  defaultAllocator.numBlocksTotal());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+        {
+            const Obj X(&ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+            ASSERT(0 <  ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        static const struct {
+            int         d_line;
+            int         d_numStripes;
+            bsl::size_t d_expected;
+        } DATA[] = {
+            { L_,     1,     1 },
+            { L_,     2,     2 },
+            { L_,     3,     4 },
+            { L_,     4,     4 },
+            { L_,     5,     8 },
+            { L_,    16,    16 },
+            { L_,    17,    32 },
+            { L_,  1000,  1024 },
+            { L_, 65536, 65536 }
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const int         STRIPES  = DATA[ti].d_numStripes;
+            const bsl::size_t EXPECTED = DATA[ti].d_expected;
+
+            {
+                const Obj X(STRIPES, &ta);
+                ASSERTV(LINE, &ta     == X.allocator());
+                ASSERTV(LINE, EXPECTED == X.numStripes());
+                ASSERTV(LINE, 0        == X.numStrings());
+            }
+            {
+                const Obj X(STRIPES, static_cast<bslma::Allocator *>(0));
+                ASSERTV(LINE, &defaultAllocator == X.allocator());
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+            ASSERTV(LINE, 0 == defaultAllocator.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(    0, &ta));
+            ASSERT_FAIL(Obj(   -1, &ta));
+            ASSERT_PASS(Obj(    1, &ta));
+            ASSERT_PASS(Obj(65536, &ta));
+            ASSERT_FAIL(Obj(65537, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Intern a few values, and look them up.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        ASSERT(0 == X.numStrings());
+
+        bsl::string value("hello", &ta);
+
+        const bslstl::StringRef R1 = mX.intern(value);
+        ASSERT("hello" == R1);
+        ASSERT(value.data() != R1.data());
+        ASSERT(1 == X.numStrings());
+
+        value = "world";
+        const bslstl::StringRef R2 = mX.intern(value);
+        ASSERT("world" == R2);
+        ASSERT("hello" == R1);
+        ASSERT(2 == X.numStrings());
+
+        value = "hello";
+        ASSERT(R1.data() == mX.intern(value).data());
+        ASSERT(2 == X.numStrings());
+
+        bslstl::StringRef result;
+        ASSERT(0 == X.find(&result, "world"));
+        ASSERT(R2.data() == result.data());
+        ASSERT(0 != X.find(&result, "other"));
+        ASSERT(2 == X.numStrings());
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
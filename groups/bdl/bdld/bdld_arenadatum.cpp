@@ -0,0 +1,151 @@
+// bdld_arenadatum.cpp                                                -*-C++-*-
+#include <bdld_arenadatum.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdld_arenadatum_cpp,"$Id$ $CSID$")
+
+#include <bdld_datummaker.h>                  // for testing
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdld {
+
+namespace {
+
+const bsl::size_t k_NODE_OVERHEAD =
+                             32 + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT * 2;
+    // upper bound on the memory, other than that proportional to the length
+    // of a string, binary, array, or map, that a 'Datum' allocates for a
+    // single node (including the padding added by the arena to align it)
+
+bsl::size_t requiredCapacity(const FlatDatumRef& flatDatum)
+    // Return an upper bound on the memory required to decode the node
+    // referred to by the specified 'flatDatum' (including its descendants).
+{
+    bsl::size_t result = k_NODE_OVERHEAD;
+
+    switch (flatDatum.type()) {
+      case Datum::e_STRING: {
+        result += flatDatum.theString().length();
+      } break;
+      case Datum::e_BINARY: {
+        result += flatDatum.theBinary().size();
+      } break;
+      case Datum::e_ERROR: {
+        result += flatDatum.theError().message().length();
+      } break;
+      case Datum::e_ARRAY: {
+        const FlatDatumRef::SizeType length = flatDatum.arrayLength();
+
+        result += sizeof(Datum) * (length + 1);
+        for (FlatDatumRef::SizeType i = 0; i < length; ++i) {
+            result += requiredCapacity(flatDatum.arrayElement(i));
+        }
+      } break;
+      case Datum::e_MAP: {
+        const FlatDatumRef::SizeType size = flatDatum.mapSize();
+
+        result += sizeof(DatumMapEntry) * (size + 1);
+        for (FlatDatumRef::SizeType i = 0; i < size; ++i) {
+            result += flatDatum.mapKey(i).length();
+            result += requiredCapacity(flatDatum.mapValue(i));
+        }
+      } break;
+      default: {
+      } break;
+    }
+
+    return result;
+}
+
+bsl::size_t requiredCapacity(const Datum& datum)
+    // Return an upper bound on the memory required to clone the specified
+    // 'datum' (including its descendants).
+{
+    bsl::size_t result = k_NODE_OVERHEAD;
+
+    switch (datum.type()) {
+      case Datum::e_STRING: {
+        result += datum.theString().length();
+      } break;
+      case Datum::e_BINARY: {
+        result += datum.theBinary().size();
+      } break;
+      case Datum::e_ERROR: {
+        result += datum.theError().message().length();
+      } break;
+      case Datum::e_ARRAY: {
+        const DatumArrayRef array = datum.theArray();
+
+        result += sizeof(Datum) * (array.length() + 1);
+        for (DatumArrayRef::SizeType i = 0; i < array.length(); ++i) {
+            result += requiredCapacity(array[i]);
+        }
+      } break;
+      case Datum::e_MAP: {
+        const DatumMapRef map = datum.theMap();
+
+        result += sizeof(DatumMapEntry) * (map.size() + 1);
+        for (DatumMapRef::SizeType i = 0; i < map.size(); ++i) {
+            result += map[i].key().length();
+            result += requiredCapacity(map[i].value());
+        }
+      } break;
+      case Datum::e_INT_MAP: {
+        const DatumIntMapRef map = datum.theIntMap();
+
+        result += sizeof(DatumIntMapEntry) * (map.size() + 1);
+        for (DatumIntMapRef::SizeType i = 0; i < map.size(); ++i) {
+            result += requiredCapacity(map[i].value());
+        }
+      } break;
+      default: {
+      } break;
+    }
+
+    return result;
+}
+
+}  // close unnamed namespace
+
+                              // ----------------
+                              // class ArenaDatum
+                              // ----------------
+
+// CREATORS
+ArenaDatum::ArenaDatum(const FlatDatumRef&  flatDatum,
+                       bslma::Allocator    *basicAllocator)
+: d_arena(requiredCapacity(flatDatum), basicAllocator)
+{
+    FlatDatumUtil::decode(&d_datum, flatDatum, &d_arena);
+}
+
+ArenaDatum::ArenaDatum(const Datum& datum, bslma::Allocator *basicAllocator)
+: d_arena(requiredCapacity(datum), basicAllocator)
+, d_datum(datum.clone(&d_arena))
+{
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
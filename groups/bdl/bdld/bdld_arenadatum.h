@@ -0,0 +1,216 @@
+// bdld_arenadatum.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLD_ARENADATUM
+#define INCLUDED_BDLD_ARENADATUM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide a 'Datum' tree allocated from a single block of memory.
+//
+//@CLASSES:
+//  bdld::ArenaDatum: owner of a 'Datum' tree laid out in a single arena
+//
+//@SEE_ALSO: bdld_flatdatum, bdld_manageddatum
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdld::ArenaDatum', that
+// owns a 'Datum' (and every array, map, string, and other value that it
+// refers to) allocated from a private arena.  The arena is sized, before the
+// tree is built, from an upper bound on the memory that the tree requires, so
+// building a tree of any size and shape typically requires a single
+// allocation from the allocator supplied at construction, and destroying it
+// requires a single deallocation, without visiting the nodes of the tree.
+// Contrast this with a 'Datum' built with 'DatumArrayBuilder' or
+// 'DatumMapBuilder' (or cloned with 'Datum::clone'), for which each array,
+// map, and allocated scalar is a separate allocation that must be released by
+// 'Datum::destroy' walking the tree.
+//
+// An 'ArenaDatum' can be created either by decoding a flat datum (see
+// {'bdld_flatdatum'}), or by copying a 'Datum'.  The 'Datum' that it holds is
+// not modifiable.  Should the bound prove insufficient (which indicates a
+// change in the memory layout of 'Datum'), further memory is obtained from
+// the allocator supplied at construction, and is also released by the
+// destructor.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Holding a Received Configuration
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service receives its configuration, a 'Datum' map, from
+// another process as a flat datum, and holds the configuration until it is
+// replaced.
+//
+// First, we create the flat datum as the sending process would:
+//..
+//  bslma::TestAllocator sa("sender");
+//  bdld::DatumMaker     m(&sa);
+//
+//  bdld::Datum config = m.m("name",    "pricing",
+//                           "threads", 8,
+//                           "markets", m.a("NYSE", "LSE", "TSE"));
+//
+//  bsl::vector<char> buffer(&sa);
+//  int rc = bdld::FlatDatumUtil::encode(&buffer, config);
+//  assert(0 == rc);
+//
+//  bdld::Datum::destroy(config, &sa);
+//..
+// Then, having received and validated the buffer, the service decodes it into
+// an 'ArenaDatum':
+//..
+//  rc = bdld::FlatDatumUtil::validate(buffer.data(), buffer.size());
+//  assert(0 == rc);
+//
+//  bslma::TestAllocator oa("object");
+//
+//  bdld::ArenaDatum *received = new (oa) bdld::ArenaDatum(
+//                                        bdld::FlatDatumRef(buffer.data()),
+//                                        &oa);
+//..
+// Next, we observe that the whole tree, including the nested array and the
+// strings, occupies a single block (besides the 'ArenaDatum' object itself):
+//..
+//  assert(2 == oa.numBlocksInUse());
+//
+//  const bdld::Datum& copy = received->datum();
+//  assert("pricing" == copy.theMap().find("name")->theString());
+//  assert(3         == copy.theMap().find("markets")->theArray().length());
+//..
+// Finally, when the configuration is replaced, we destroy the 'ArenaDatum',
+// which releases the tree with a single deallocation:
+//..
+//  oa.deleteObject(received);
+//  assert(0 == oa.numBlocksInUse());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdld_datum.h>
+#include <bdld_flatdatum.h>
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+namespace BloombergLP {
+namespace bdld {
+
+                              // ================
+                              // class ArenaDatum
+                              // ================
+
+class ArenaDatum {
+    // This mechanism class owns a non-modifiable 'Datum' tree, all of whose
+    // memory is supplied by a private arena that is sized, on construction,
+    // to hold the entire tree.
+
+    // DATA
+    bdlma::SequentialAllocator d_arena;  // supplies memory for 'd_datum'
+    Datum                      d_datum;  // owned tree
+
+  private:
+    // NOT IMPLEMENTED
+    ArenaDatum(const ArenaDatum&);
+    ArenaDatum& operator=(const ArenaDatum&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ArenaDatum, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit ArenaDatum(const FlatDatumRef&  flatDatum,
+                        bslma::Allocator    *basicAllocator = 0);
+        // Create an object holding a 'Datum' having the value of the node
+        // referred to by the specified 'flatDatum', as loaded by
+        // 'FlatDatumUtil::decode'.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The held 'Datum' does not
+        // refer to the flat datum.  The behavior is undefined unless
+        // 'flatDatum' refers to a node of a valid flat datum.
+
+    explicit ArenaDatum(const Datum&      datum,
+                        bslma::Allocator *basicAllocator = 0);
+        // Create an object holding a deep copy of the specified 'datum', as
+        // made by 'Datum::clone'.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  Note that, as with 'Datum::clone', the
+        // maps of the held 'Datum' are not flagged as sorted.
+
+    ~ArenaDatum();
+        // Destroy this object, releasing all memory used by the held 'Datum'
+        // at once.
+
+    // ACCESSORS
+    const Datum *operator->() const;
+        // Return a pointer providing non-modifiable access to the 'Datum' held
+        // by this object.
+
+    const Datum& operator*() const;
+        // Return a reference providing non-modifiable access to the 'Datum'
+        // held by this object.
+
+    const Datum& datum() const;
+        // Return a reference providing non-modifiable access to the 'Datum'
+        // held by this object.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                              // ----------------
+                              // class ArenaDatum
+                              // ----------------
+
+// CREATORS
+inline
+ArenaDatum::~ArenaDatum()
+{
+    // 'd_arena' releases the memory of 'd_datum' without 'Datum::destroy'
+    // visiting its nodes.
+}
+
+// ACCESSORS
+inline
+const Datum *ArenaDatum::operator->() const
+{
+    return &d_datum;
+}
+
+inline
+const Datum& ArenaDatum::operator*() const
+{
+    return d_datum;
+}
+
+inline
+const Datum& ArenaDatum::datum() const
+{
+    return d_datum;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,620 @@
+// bdld_arenadatum.t.cpp                                              -*-C++-*-
+#include <bdld_arenadatum.h>
+
+#include <bdld_datummaker.h>
+#include <bdld_flatdatum.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_time.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test is a mechanism that owns a 'Datum' tree allocated
+// from a private arena.  Our concerns are that the held 'Datum' has the value
+// of its source, that building it obtains a single block from the supplied
+// allocator regardless of the shape of the tree, and that all of that memory
+// is released by the destructor, including when an exception is thrown
+// during construction.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit ArenaDatum(const FlatDatumRef&, bslma::Allocator * = 0);
+// [ 3] explicit ArenaDatum(const Datum&, bslma::Allocator * = 0);
+// [ 2] ~ArenaDatum();
+//
+// ACCESSORS
+// [ 4] const Datum *operator->() const;
+// [ 4] const Datum& operator*() const;
+// [ 4] const Datum& datum() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [ 4] CONCERN: The object uses 'bslma::Allocator'.
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdld::ArenaDatum   Obj;
+typedef bdld::Datum        Datum;
+typedef bsls::Types::Int64 Int64;
+
+// ============================================================================
+//                              TEST APPARATUS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bool isEqualSorted(const Datum& lhs, const Datum& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same value and
+    // every pair of corresponding maps has the same sorted flag, and 'false'
+    // otherwise.
+{
+    if (lhs != rhs) {
+        return false;                                                 // RETURN
+    }
+    if (lhs.isArray()) {
+        for (bdld::DatumArrayRef::SizeType i = 0;
+                                          i < lhs.theArray().length(); ++i) {
+            if (!isEqualSorted(lhs.theArray()[i], rhs.theArray()[i])) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+    if (lhs.isMap()) {
+        if (lhs.theMap().isSorted() != rhs.theMap().isSorted()) {
+            return false;                                             // RETURN
+        }
+        for (bdld::DatumMapRef::SizeType i = 0; i < lhs.theMap().size(); ++i) {
+            if (!isEqualSorted(lhs.theMap()[i].value(),
+                               rhs.theMap()[i].value())) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+    return true;
+}
+
+void makeValues(bsl::vector<Datum> *result, bslma::Allocator *allocator)
+    // Append, to the specified 'result', a set of 'Datum' values of every
+    // supported type, including large and nested aggregates, using the
+    // specified 'allocator'.
+{
+    bdld::DatumMaker m(allocator);
+
+    const char BINARY[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    const bsl::string LONG(1000, 'x', allocator);
+
+    result->push_back(m());
+    result->push_back(m(true));
+    result->push_back(m(-7));
+    result->push_back(m(Int64(1) << 60));
+    result->push_back(m(2.5));
+    result->push_back(m(bdlt::Date(2018, 3, 4)));
+    result->push_back(m(bdlt::Time(12, 34, 56, 789, 12)));
+    result->push_back(m(bdlt::Datetime(2018, 3, 4, 5, 6, 7, 8, 9)));
+    result->push_back(m(bdlt::DatetimeInterval(-3, 4, 5, 6, 7, 8)));
+    result->push_back(m(bdldfp::Decimal64(12345)));
+    result->push_back(m("short"));
+    result->push_back(m(bslstl::StringRef(LONG)));
+    result->push_back(Datum::copyBinary(BINARY, sizeof BINARY, allocator));
+    result->push_back(m(bdld::DatumError(3, "an error message")));
+    result->push_back(m.a());
+    result->push_back(m.m());
+    result->push_back(m.a(1, "two", 3.0, m.a(m.a(m.a(LONG)))));
+    result->push_back(m.m("first",  m.a(Int64(1) << 40, bdlt::Date()),
+                          "second", m.m("nested", LONG, "empty", m.a()),
+                          "third",  bdld::DatumError(1)));
+
+    // A wide array of allocated values.
+
+    bdld::DatumMutableArrayRef array;
+    Datum::createUninitializedArray(&array, 500, allocator);
+    for (int i = 0; i < 500; ++i) {
+        array.data()[i] = m.a(bdlt::DatetimeInterval(i),
+                              bslstl::StringRef(LONG.data() + i,
+                                                LONG.length() - i));
+    }
+    *array.length() = 500;
+    result->push_back(Datum::adoptArray(array));
+
+    // A sorted map.
+
+    bdld::DatumMutableMapRef map;
+    Datum::createUninitializedMap(&map, 2, allocator);
+    map.data()[0] = bdld::DatumMapEntry("a", m.a(1, 2));
+    map.data()[1] = bdld::DatumMapEntry("b", m("a longer string"));
+    *map.size()   = 2;
+    *map.sorted() = true;
+    result->push_back(Datum::adoptMap(map));
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Holding a Received Configuration
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service receives its configuration, a 'Datum' map, from
+// another process as a flat datum, and holds the configuration until it is
+// replaced.
+//
+// First, we create the flat datum as the sending process would:
+//..
+    bslma::TestAllocator sa("sender");
+    bdld::DatumMaker     m(&sa);
+
+    bdld::Datum config = m.m("name",    "pricing",
+                             "threads", 8,
+                             "markets", m.a("NYSE", "LSE", "TSE"));
+
+    bsl::vector<char> buffer(&sa);
+    int rc = bdld::FlatDatumUtil::encode(&buffer, config);
+    ASSERT(0 == rc);
+
+    bdld::Datum::destroy(config, &sa);
+//..
+// Then, having received and validated the buffer, the service decodes it into
+// an 'ArenaDatum':
+//..
+    rc = bdld::FlatDatumUtil::validate(buffer.data(), buffer.size());
+    ASSERT(0 == rc);
+
+    bslma::TestAllocator oa("object");
+
+    bdld::ArenaDatum *received = new (oa) bdld::ArenaDatum(
+                                          bdld::FlatDatumRef(buffer.data()),
+                                          &oa);
+//..
+// Next, we observe that the whole tree, including the nested array and the
+// strings, occupies a single block (besides the 'ArenaDatum' object itself):
+//..
+    ASSERT(2 == oa.numBlocksInUse());
+
+    const bdld::Datum& copy = received->datum();
+    ASSERT("pricing" == copy.theMap().find("name")->theString());
+    ASSERT(3         == copy.theMap().find("markets")->theArray().length());
+//..
+// Finally, when the configuration is replaced, we destroy the 'ArenaDatum',
+// which releases the tree with a single deallocation:
+//..
+    oa.deleteObject(received);
+    ASSERT(0 == oa.numBlocksInUse());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ACCESSORS AND TRAITS
+        //
+        // Concerns:
+        //: 1 'datum', 'operator*', and 'operator->' all provide access to the
+        //:   same held 'Datum'.
+        //:
+        //: 2 The accessors are 'const' and do not allocate memory.
+        //:
+        //: 3 'ArenaDatum' has the 'bslma::UsesBslmaAllocator' trait.
+        //
+        // Plan:
+        //: 1 Create an object, and compare the addresses returned by each
+        //:   accessor through a 'const' reference, monitoring the allocators.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify the trait.  (C-3)
+        //
+        // Testing:
+        //   const Datum *operator->() const;
+        //   const Datum& operator*() const;
+        //   const Datum& datum() const;
+        //   CONCERN: The object uses 'bslma::Allocator'.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ACCESSORS AND TRAITS" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator ma("model",   veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bdld::DatumMaker m(&ma);
+
+        const Datum VALUE = m.a("abcdefghijklmnop", 2);
+
+        const Obj X(VALUE, &oa);
+
+        const Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+        ASSERT(&X.datum() == &*X);
+        ASSERT(&X.datum() == X.operator->());
+        ASSERT(2          == X->theArray().length());
+        ASSERT(VALUE      == *X);
+
+        ASSERT(NUM_BLOCKS == oa.numBlocksTotal());
+        ASSERT(0          == da.numBlocksTotal());
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+
+        Datum::destroy(VALUE, &ma);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONSTRUCT FROM 'Datum'
+        //
+        // Concerns:
+        //: 1 The held 'Datum' has the value of the specified 'Datum', and does
+        //:   not refer to its memory.
+        //:
+        //: 2 Constructing the object obtains at most one block from the
+        //:   specified allocator, whatever the size and shape of the tree,
+        //:   and the destructor releases it.
+        //:
+        //: 3 If an allocator is not specified, the default allocator is used.
+        //:
+        //: 4 Construction is exception neutral.
+        //
+        // Plan:
+        //: 1 For each of a set of 'Datum' values of every supported type,
+        //:   including wide and deep aggregates, create an object under the
+        //:   exception-test loop, and compare its value with the original.
+        //:   Then destroy the original, and verify the value of the object
+        //:   again.  Monitor the allocators throughout.  (C-1..2, 4)
+        //:
+        //: 2 Repeat P-1 without supplying an allocator.  (C-3)
+        //
+        // Testing:
+        //   explicit ArenaDatum(const Datum&, bslma::Allocator * = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCT FROM 'Datum'" << endl
+                          << "======================" << endl;
+
+        for (char cfg = 'a'; cfg <= 'b'; ++cfg) {
+            const char CONFIG = cfg;
+
+            bslma::TestAllocator ma("model",    veryVeryVeryVerbose);
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+            bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            bslma::TestAllocator& oa  = 'a' == CONFIG ? sa : da;
+            bslma::TestAllocator& noa = 'a' == CONFIG ? da : sa;
+
+            bsl::vector<Datum> values(&ma);
+            makeValues(&values, &ma);
+
+            for (bsl::size_t ti = 0; ti < values.size(); ++ti) {
+                if (veryVerbose) { T_ P_(CONFIG) P(ti) }
+
+                bsl::vector<Datum> copies(&ma);
+                makeValues(&copies, &ma);
+
+                Datum mVALUE = copies[ti];  const Datum& VALUE = mVALUE;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    Obj *objPtr = 'a' == CONFIG
+                                ? new (ma) Obj(VALUE, &sa)
+                                : new (ma) Obj(VALUE);
+
+                    ASSERTV(CONFIG, ti, VALUE == objPtr->datum());
+
+                    ma.deleteObject(objPtr);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(CONFIG, ti, 0 == oa.numBlocksInUse());
+
+                const Int64 NUM_BLOCKS = oa.numBlocksTotal();
+                {
+                    const Obj X(VALUE, 'a' == CONFIG ? &sa : 0);
+
+                    ASSERTV(CONFIG, ti, oa.numBlocksTotal() - NUM_BLOCKS,
+                            1 >= oa.numBlocksTotal() - NUM_BLOCKS);
+
+                    for (bsl::size_t i = 0; i < copies.size(); ++i) {
+                        Datum::destroy(copies[i], &ma);
+                    }
+
+                    ASSERTV(CONFIG, ti, values[ti] == X.datum());
+                }
+                ASSERTV(CONFIG, ti, 0 == oa.numBlocksInUse());
+                ASSERTV(CONFIG, ti, 0 == noa.numBlocksTotal());
+            }
+
+            for (bsl::size_t ti = 0; ti < values.size(); ++ti) {
+                Datum::destroy(values[ti], &ma);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCT FROM 'FlatDatumRef'
+        //
+        // Concerns:
+        //: 1 The held 'Datum' has the value of the encoded 'Datum', including
+        //:   the sorted flags of its maps, and does not refer to the flat
+        //:   datum.
+        //:
+        //: 2 Constructing the object obtains at most one block from the
+        //:   specified allocator, whatever the size and shape of the tree,
+        //:   and the destructor releases it.
+        //:
+        //: 3 If an allocator is not specified, the default allocator is used.
+        //:
+        //: 4 Construction is exception neutral.
+        //
+        // Plan:
+        //: 1 For each of a set of 'Datum' values of every supported type,
+        //:   including wide and deep aggregates, encode the value, and create
+        //:   an object from the root of the encoding under the exception-test
+        //:   loop.  Compare the value of the object with the original.  Then
+        //:   overwrite the flat datum, and verify the value of the object
+        //:   again.  Monitor the allocators throughout.  (C-1..2, 4)
+        //:
+        //: 2 Repeat P-1 without supplying an allocator.  (C-3)
+        //
+        // Testing:
+        //   explicit ArenaDatum(const FlatDatumRef&, bslma::Allocator * = 0);
+        //   ~ArenaDatum();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCT FROM 'FlatDatumRef'" << endl
+                          << "=============================" << endl;
+
+        for (char cfg = 'a'; cfg <= 'b'; ++cfg) {
+            const char CONFIG = cfg;
+
+            bslma::TestAllocator ma("model",    veryVeryVeryVerbose);
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+            bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            bslma::TestAllocator& oa  = 'a' == CONFIG ? sa : da;
+            bslma::TestAllocator& noa = 'a' == CONFIG ? da : sa;
+
+            bsl::vector<Datum> values(&ma);
+            makeValues(&values, &ma);
+
+            for (bsl::size_t ti = 0; ti < values.size(); ++ti) {
+                const Datum& VALUE = values[ti];
+
+                if (veryVerbose) { T_ P_(CONFIG) P(ti) }
+
+                bsl::vector<char> buffer(&ma);
+                ASSERTV(ti, 0 == bdld::FlatDatumUtil::encode(&buffer, VALUE));
+
+                const bdld::FlatDatumRef ROOT(buffer.data());
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    Obj *objPtr = 'a' == CONFIG
+                                ? new (ma) Obj(ROOT, &sa)
+                                : new (ma) Obj(ROOT);
+
+                    ASSERTV(CONFIG, ti, isEqualSorted(objPtr->datum(), VALUE));
+
+                    ma.deleteObject(objPtr);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(CONFIG, ti, 0 == oa.numBlocksInUse());
+
+                const Int64 NUM_BLOCKS = oa.numBlocksTotal();
+                {
+                    const Obj X(ROOT, 'a' == CONFIG ? &sa : 0);
+
+                    ASSERTV(CONFIG, ti, oa.numBlocksTotal() - NUM_BLOCKS,
+                            1 >= oa.numBlocksTotal() - NUM_BLOCKS);
+
+                    bsl::fill(buffer.begin(), buffer.end(), '\xFF');
+
+                    ASSERTV(CONFIG, ti, isEqualSorted(X.datum(), VALUE));
+                }
+                ASSERTV(CONFIG, ti, 0 == oa.numBlocksInUse());
+                ASSERTV(CONFIG, ti, 0 == noa.numBlocksTotal());
+            }
+
+            for (bsl::size_t ti = 0; ti < values.size(); ++ti) {
+                Datum::destroy(values[ti], &ma);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create objects from a 'Datum' and from its flat encoding, and
+        //:   verify their values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ma("model",  veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bdld::DatumMaker m(&ma);
+
+        const Datum VALUE = m.a(42, "a string of some length", m.m("k", 1.5));
+
+        bsl::vector<char> buffer(&ma);
+        ASSERT(0 == bdld::FlatDatumUtil::encode(&buffer, VALUE));
+
+        {
+            const Obj X(VALUE, &oa);
+            const Obj Y(bdld::FlatDatumRef(buffer.data()), &oa);
+
+            ASSERT(VALUE == X.datum());
+            ASSERT(VALUE == Y.datum());
+            ASSERT(2     == oa.numBlocksInUse());
+        }
+
+        ASSERT(0 == oa.numBlocksInUse());
+
+        Datum::destroy(VALUE, &ma);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
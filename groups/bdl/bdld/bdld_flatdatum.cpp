@@ -0,0 +1,886 @@
+// bdld_flatdatum.cpp                                                 -*-C++-*-
+#include <bdld_flatdatum.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdld_flatdatum_cpp,"$Id$ $CSID$")
+
+#include <bdld_datummaker.h>                  // for testing
+#include <bdld_datumudt.h>                    // for testing
+#include <bdld_manageddatum.h>
+
+#include <bdldfp_decimalconvertutil.h>
+
+#include <bdlt_timeunitratio.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace bdld {
+
+namespace {
+
+const char k_MAGIC[4] = { 'B', 'D', 'F', 'D' };
+
+const bsl::size_t k_MAX_LENGTH = bsl::numeric_limits<unsigned int>::max();
+    // maximum length of a flat datum
+
+// Sizes of the fixed parts of the payloads of each node type (excluding the
+// one-byte tag).
+
+const bsl::size_t k_DATE_SIZE     = 4;
+const bsl::size_t k_TIME_SIZE     = 8;
+const bsl::size_t k_INTERVAL_SIZE = 12;
+const bsl::size_t k_ARRAY_SIZE    = 4;   // plus 4 bytes per element
+const bsl::size_t k_MAP_SIZE      = 5;   // plus 12 bytes per entry
+
+                              // ---------------
+                              // Encoding Helpers
+                              // ---------------
+
+void appendUint64(bsl::vector<char> *buffer, bsls::Types::Uint64 value)
+    // Append the specified 'value' to the specified 'buffer' in little-endian
+    // byte order.
+{
+    for (int i = 0; i < 8; ++i, value >>= 8) {
+        buffer->push_back(static_cast<char>(value & 0xFF));
+    }
+}
+
+void appendUint32(bsl::vector<char> *buffer, unsigned int value)
+    // Append the specified 'value' to the specified 'buffer' in little-endian
+    // byte order.
+{
+    for (int i = 0; i < 4; ++i, value >>= 8) {
+        buffer->push_back(static_cast<char>(value & 0xFF));
+    }
+}
+
+void storeUint32(char *address, unsigned int value)
+    // Store the specified 'value' at the specified 'address' in little-endian
+    // byte order.
+{
+    for (int i = 0; i < 4; ++i, value >>= 8) {
+        address[i] = static_cast<char>(value & 0xFF);
+    }
+}
+
+void appendBytes(bsl::vector<char> *buffer,
+                 const void        *bytes,
+                 bsl::size_t        numBytes)
+    // Append the specified 'numBytes' at the specified 'bytes' to the
+    // specified 'buffer'.
+{
+    const char *begin = static_cast<const char *>(bytes);
+    buffer->insert(buffer->end(), begin, begin + numBytes);
+}
+
+void appendDate(bsl::vector<char> *buffer, const bdlt::Date& date)
+    // Append the payload encoding the specified 'date' to the specified
+    // 'buffer'.
+{
+    const int year = date.year();
+    buffer->push_back(static_cast<char>(year & 0xFF));
+    buffer->push_back(static_cast<char>(year >> 8));
+    buffer->push_back(static_cast<char>(date.month()));
+    buffer->push_back(static_cast<char>(date.day()));
+}
+
+void appendTime(bsl::vector<char> *buffer, const bdlt::Time& time)
+    // Append the payload encoding the specified 'time' to the specified
+    // 'buffer'.
+{
+    const bsls::Types::Int64 microseconds =
+              ((time.hour() * 60LL + time.minute()) * 60 + time.second())
+                                         * bdlt::TimeUnitRatio::k_US_PER_S
+            + time.millisecond() * bdlt::TimeUnitRatio::k_US_PER_MS
+            + time.microsecond();
+
+    appendUint64(buffer, static_cast<bsls::Types::Uint64>(microseconds));
+}
+
+int computeLength(bsl::size_t *length, const Datum& datum, int depth)
+    // Add, to the specified '*length', the length of the encoding of the node
+    // for the specified 'datum' (including its descendants), which is nested
+    // at the specified 'depth'.  Return 0 on success, and a non-zero value if
+    // 'datum' holds or contains a value of an unsupported type or is nested
+    // too deeply.
+{
+    *length += 1;
+
+    switch (datum.type()) {
+      case Datum::e_NIL: {
+      } break;
+      case Datum::e_BOOLEAN: {
+        *length += 1;
+      } break;
+      case Datum::e_INTEGER: {
+        *length += 4;
+      } break;
+      case Datum::e_INTEGER64:
+      case Datum::e_DOUBLE:
+      case Datum::e_DECIMAL64: {
+        *length += 8;
+      } break;
+      case Datum::e_DATE: {
+        *length += k_DATE_SIZE;
+      } break;
+      case Datum::e_TIME: {
+        *length += k_TIME_SIZE;
+      } break;
+      case Datum::e_DATETIME: {
+        *length += k_DATE_SIZE + k_TIME_SIZE;
+      } break;
+      case Datum::e_DATETIME_INTERVAL: {
+        *length += k_INTERVAL_SIZE;
+      } break;
+      case Datum::e_STRING: {
+        *length += 4 + datum.theString().length();
+      } break;
+      case Datum::e_BINARY: {
+        *length += 4 + datum.theBinary().size();
+      } break;
+      case Datum::e_ERROR: {
+        *length += 8 + datum.theError().message().length();
+      } break;
+      case Datum::e_ARRAY: {
+        if (depth >= FlatDatumUtil::k_MAX_DEPTH) {
+            return -1;                                                // RETURN
+        }
+
+        const DatumArrayRef array = datum.theArray();
+
+        *length += k_ARRAY_SIZE
+                         + array.length() * FlatDatum_Imp::k_ARRAY_SLOT_SIZE;
+
+        for (DatumArrayRef::SizeType i = 0; i < array.length(); ++i) {
+            if (0 != computeLength(length, array[i], depth + 1)) {
+                return -1;                                            // RETURN
+            }
+        }
+      } break;
+      case Datum::e_MAP: {
+        if (depth >= FlatDatumUtil::k_MAX_DEPTH) {
+            return -1;                                                // RETURN
+        }
+
+        const DatumMapRef map = datum.theMap();
+
+        *length += k_MAP_SIZE + map.size() * FlatDatum_Imp::k_MAP_ENTRY_SIZE;
+
+        for (DatumMapRef::SizeType i = 0; i < map.size(); ++i) {
+            *length += map[i].key().length();
+            if (0 != computeLength(length, map[i].value(), depth + 1)) {
+                return -1;                                            // RETURN
+            }
+        }
+      } break;
+      default: {
+        return -1;                                                    // RETURN
+      }
+    }
+
+    return 0;
+}
+
+void encodeNode(bsl::vector<char> *buffer, const Datum& datum)
+    // Append the encoding of the node for the specified 'datum' (including
+    // its descendants) to the specified 'buffer'.  The behavior is undefined
+    // unless 'computeLength' succeeds for 'datum' and the length of 'buffer'
+    // will not exceed 'k_MAX_LENGTH'.
+{
+    const Datum::DataType type = datum.type();
+
+    buffer->push_back(static_cast<char>(type));
+
+    switch (type) {
+      case Datum::e_NIL: {
+      } break;
+      case Datum::e_BOOLEAN: {
+        buffer->push_back(datum.theBoolean() ? 1 : 0);
+      } break;
+      case Datum::e_INTEGER: {
+        appendUint32(buffer, static_cast<unsigned int>(datum.theInteger()));
+      } break;
+      case Datum::e_INTEGER64: {
+        appendUint64(buffer,
+                     static_cast<bsls::Types::Uint64>(datum.theInteger64()));
+      } break;
+      case Datum::e_DOUBLE: {
+        const double        value = datum.theDouble();
+        bsls::Types::Uint64 bits;
+        bsl::memcpy(&bits, &value, sizeof bits);
+        appendUint64(buffer, bits);
+      } break;
+      case Datum::e_DECIMAL64: {
+        unsigned char bytes[8];
+        bdldfp::DecimalConvertUtil::decimal64ToNetwork(bytes,
+                                                       datum.theDecimal64());
+        appendBytes(buffer, bytes, sizeof bytes);
+      } break;
+      case Datum::e_DATE: {
+        appendDate(buffer, datum.theDate());
+      } break;
+      case Datum::e_TIME: {
+        appendTime(buffer, datum.theTime());
+      } break;
+      case Datum::e_DATETIME: {
+        const bdlt::Datetime value = datum.theDatetime();
+        appendDate(buffer, value.date());
+        appendTime(buffer, value.time());
+      } break;
+      case Datum::e_DATETIME_INTERVAL: {
+        const bdlt::DatetimeInterval value = datum.theDatetimeInterval();
+        appendUint32(buffer, static_cast<unsigned int>(value.days()));
+        appendUint64(buffer,
+                     static_cast<bsls::Types::Uint64>(
+                                        value.fractionalDayInMicroseconds()));
+      } break;
+      case Datum::e_STRING: {
+        const bslstl::StringRef value = datum.theString();
+        appendUint32(buffer, static_cast<unsigned int>(value.length()));
+        appendBytes(buffer, value.data(), value.length());
+      } break;
+      case Datum::e_BINARY: {
+        const DatumBinaryRef value = datum.theBinary();
+        appendUint32(buffer, static_cast<unsigned int>(value.size()));
+        appendBytes(buffer, value.data(), value.size());
+      } break;
+      case Datum::e_ERROR: {
+        const DatumError value = datum.theError();
+        appendUint32(buffer, static_cast<unsigned int>(value.code()));
+        appendUint32(buffer,
+                     static_cast<unsigned int>(value.message().length()));
+        appendBytes(buffer, value.message().data(), value.message().length());
+      } break;
+      case Datum::e_ARRAY: {
+        const DatumArrayRef array = datum.theArray();
+
+        appendUint32(buffer, static_cast<unsigned int>(array.length()));
+
+        const bsl::size_t slots = buffer->size();
+        buffer->resize(slots
+                          + array.length() * FlatDatum_Imp::k_ARRAY_SLOT_SIZE);
+
+        for (DatumArrayRef::SizeType i = 0; i < array.length(); ++i) {
+            storeUint32(buffer->data() + slots
+                                       + i * FlatDatum_Imp::k_ARRAY_SLOT_SIZE,
+                        static_cast<unsigned int>(buffer->size()));
+            encodeNode(buffer, array[i]);
+        }
+      } break;
+      case Datum::e_MAP: {
+        const DatumMapRef map = datum.theMap();
+
+        buffer->push_back(map.isSorted() ? 1 : 0);
+        appendUint32(buffer, static_cast<unsigned int>(map.size()));
+
+        const bsl::size_t entries = buffer->size();
+        buffer->resize(entries + map.size() * FlatDatum_Imp::k_MAP_ENTRY_SIZE);
+
+        for (DatumMapRef::SizeType i = 0; i < map.size(); ++i) {
+            const bslstl::StringRef key = map[i].key();
+
+            char *entry = buffer->data() + entries
+                                         + i * FlatDatum_Imp::k_MAP_ENTRY_SIZE;
+
+            storeUint32(entry,     static_cast<unsigned int>(buffer->size()));
+            storeUint32(entry + 4, static_cast<unsigned int>(key.length()));
+            appendBytes(buffer, key.data(), key.length());
+
+            storeUint32(buffer->data() + entries
+                                      + i * FlatDatum_Imp::k_MAP_ENTRY_SIZE
+                                      + 8,
+                        static_cast<unsigned int>(buffer->size()));
+            encodeNode(buffer, map[i].value());
+        }
+      } break;
+      default: {
+        BSLS_ASSERT(!"Unsupported type");
+      }
+    }
+}
+
+                             // -----------------
+                             // Decoding Helpers
+                             // -----------------
+
+bdlt::Date loadDate(const char *payload)
+    // Return the date encoded at the specified 'payload'.
+{
+    const unsigned char *bytes =
+                             reinterpret_cast<const unsigned char *>(payload);
+
+    return bdlt::Date(bytes[0] | (bytes[1] << 8), bytes[2], bytes[3]);
+}
+
+bdlt::Time loadTime(const char *payload)
+    // Return the time encoded at the specified 'payload'.
+{
+    bsls::Types::Int64 microseconds =
+           static_cast<bsls::Types::Int64>(FlatDatum_Imp::loadUint64(payload));
+
+    if (bdlt::TimeUnitRatio::k_US_PER_D == microseconds) {
+        return bdlt::Time();                                          // RETURN
+    }
+
+    const int microsecond = static_cast<int>(microseconds % 1000);
+    microseconds /= 1000;
+    const int millisecond = static_cast<int>(microseconds % 1000);
+    microseconds /= 1000;
+    const int second      = static_cast<int>(microseconds % 60);
+    microseconds /= 60;
+    const int minute      = static_cast<int>(microseconds % 60);
+    const int hour        = static_cast<int>(microseconds / 60);
+
+    return bdlt::Time(hour, minute, second, millisecond, microsecond);
+}
+
+                            // ------------------
+                            // Validation Helpers
+                            // ------------------
+
+bool fits(bsl::size_t position, bsl::size_t size, bsl::size_t length)
+    // Return 'true' if the specified 'size' bytes starting at the specified
+    // 'position' lie within a buffer of the specified 'length', and 'false'
+    // otherwise.
+{
+    return position <= length && size <= length - position;
+}
+
+bool consume(bsl::size_t *remaining, bsl::size_t size)
+    // Subtract the specified 'size' from the specified '*remaining' and return
+    // 'true' if 'size <= *remaining', and return 'false' with no effect
+    // otherwise.
+{
+    if (size > *remaining) {
+        return false;                                                 // RETURN
+    }
+    *remaining -= size;
+    return true;
+}
+
+int validateNode(const char  *buffer,
+                 bsl::size_t  length,
+                 bsl::size_t  offset,
+                 int          depth,
+                 bsl::size_t *remaining)
+    // Return 0 if the node at the specified 'offset' in the specified 'buffer'
+    // of the specified 'length', nested at the specified 'depth', is valid
+    // (including its descendants), and a non-zero value otherwise.  Subtract
+    // the size of each node (and key) visited from the specified
+    // '*remaining', and fail if it would become negative.  Note that, as each
+    // node has a size of at least one byte, '*remaining' bounds the work done
+    // for a malicious buffer whose offsets refer to a node more than once.
+{
+    if (!fits(offset, 1, length) || !consume(remaining, 1)) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t  position = offset + 1;
+    const char        *payload  = buffer + position;
+
+    bsl::size_t size = 0;  // size of the fixed part of the payload
+
+    switch (static_cast<unsigned char>(buffer[offset])) {
+      case Datum::e_NIL: {
+        return 0;                                                     // RETURN
+      }
+      case Datum::e_BOOLEAN: {
+        size = 1;
+      } break;
+      case Datum::e_INTEGER: {
+        size = 4;
+      } break;
+      case Datum::e_INTEGER64:
+      case Datum::e_DOUBLE:
+      case Datum::e_DECIMAL64: {
+        size = 8;
+      } break;
+      case Datum::e_DATE: {
+        size = k_DATE_SIZE;
+      } break;
+      case Datum::e_TIME: {
+        size = k_TIME_SIZE;
+      } break;
+      case Datum::e_DATETIME: {
+        size = k_DATE_SIZE + k_TIME_SIZE;
+      } break;
+      case Datum::e_DATETIME_INTERVAL: {
+        size = k_INTERVAL_SIZE;
+      } break;
+      case Datum::e_STRING:
+      case Datum::e_BINARY: {
+        size = 4;
+      } break;
+      case Datum::e_ERROR: {
+        size = 8;
+      } break;
+      case Datum::e_ARRAY: {
+        size = k_ARRAY_SIZE;
+      } break;
+      case Datum::e_MAP: {
+        size = k_MAP_SIZE;
+      } break;
+      default: {
+        return -1;                                                    // RETURN
+      }
+    }
+
+    if (!fits(position, size, length) || !consume(remaining, size)) {
+        return -1;                                                    // RETURN
+    }
+
+    switch (buffer[offset]) {
+      case Datum::e_BOOLEAN: {
+        return 0 == payload[0] || 1 == payload[0] ? 0 : -1;           // RETURN
+      }
+      case Datum::e_DATE:
+      case Datum::e_TIME:
+      case Datum::e_DATETIME: {
+        const bool hasDate = Datum::e_TIME != buffer[offset];
+        const bool hasTime = Datum::e_DATE != buffer[offset];
+
+        bool isDefaultDate = false;
+        if (hasDate) {
+            const unsigned char *bytes =
+                             reinterpret_cast<const unsigned char *>(payload);
+            const int year = bytes[0] | (bytes[1] << 8);
+            if (!bdlt::Date::isValidYearMonthDay(year, bytes[2], bytes[3])) {
+                return -1;                                            // RETURN
+            }
+            isDefaultDate = 1 == year && 1 == bytes[2] && 1 == bytes[3];
+        }
+
+        if (hasTime) {
+            const bsls::Types::Uint64 microseconds =
+                                    FlatDatum_Imp::loadUint64(
+                                       payload + (hasDate ? k_DATE_SIZE : 0));
+            const bsls::Types::Uint64 perDay =
+                                           bdlt::TimeUnitRatio::k_US_PER_D;
+
+            if (microseconds > perDay
+             || (perDay == microseconds && hasDate && !isDefaultDate)) {
+                return -1;                                            // RETURN
+            }
+        }
+        return 0;                                                     // RETURN
+      }
+      case Datum::e_DATETIME_INTERVAL: {
+        const int                days = static_cast<int>(
+                                          FlatDatum_Imp::loadUint32(payload));
+        const bsls::Types::Int64 microseconds =
+                                     static_cast<bsls::Types::Int64>(
+                                      FlatDatum_Imp::loadUint64(payload + 4));
+
+        // The fields must already be normalized, as they are in a
+        // 'bdlt::DatetimeInterval'.
+
+        if (microseconds <= -bdlt::TimeUnitRatio::k_US_PER_D
+         || microseconds >=  bdlt::TimeUnitRatio::k_US_PER_D
+         || (days > 0 && microseconds < 0)
+         || (days < 0 && microseconds > 0)) {
+            return -1;                                                // RETURN
+        }
+        return 0;                                                     // RETURN
+      }
+      case Datum::e_STRING:
+      case Datum::e_BINARY:
+      case Datum::e_ERROR: {
+        const bsl::size_t dataLength =
+                             FlatDatum_Imp::loadUint32(payload + size - 4);
+
+        return fits(position + size, dataLength, length)
+            && consume(remaining, dataLength) ? 0 : -1;               // RETURN
+      }
+      case Datum::e_ARRAY: {
+        const bsl::size_t numElements = FlatDatum_Imp::loadUint32(payload);
+
+        if (depth >= FlatDatumUtil::k_MAX_DEPTH
+         || numElements > length / FlatDatum_Imp::k_ARRAY_SLOT_SIZE
+         || !fits(position + size,
+                  numElements * FlatDatum_Imp::k_ARRAY_SLOT_SIZE,
+                  length)
+         || !consume(remaining,
+                     numElements * FlatDatum_Imp::k_ARRAY_SLOT_SIZE)) {
+            return -1;                                                // RETURN
+        }
+
+        for (bsl::size_t i = 0; i < numElements; ++i) {
+            const bsl::size_t child = FlatDatum_Imp::loadUint32(
+                                     payload + k_ARRAY_SIZE
+                                     + i * FlatDatum_Imp::k_ARRAY_SLOT_SIZE);
+            if (child <= offset
+             || 0 != validateNode(buffer,
+                                  length,
+                                  child,
+                                  depth + 1,
+                                  remaining)) {
+                return -1;                                            // RETURN
+            }
+        }
+        return 0;                                                     // RETURN
+      }
+      case Datum::e_MAP: {
+        const bool        sorted     = 1 == payload[0];
+        const bsl::size_t numEntries = FlatDatum_Imp::loadUint32(payload + 1);
+
+        if (depth >= FlatDatumUtil::k_MAX_DEPTH
+         || (0 != payload[0] && 1 != payload[0])
+         || numEntries > length / FlatDatum_Imp::k_MAP_ENTRY_SIZE
+         || !fits(position + size,
+                  numEntries * FlatDatum_Imp::k_MAP_ENTRY_SIZE,
+                  length)
+         || !consume(remaining,
+                     numEntries * FlatDatum_Imp::k_MAP_ENTRY_SIZE)) {
+            return -1;                                                // RETURN
+        }
+
+        bslstl::StringRef previousKey;
+        for (bsl::size_t i = 0; i < numEntries; ++i) {
+            const char *entry = payload + k_MAP_SIZE
+                                        + i * FlatDatum_Imp::k_MAP_ENTRY_SIZE;
+
+            const bsl::size_t keyOffset = FlatDatum_Imp::loadUint32(entry);
+            const bsl::size_t keyLength = FlatDatum_Imp::loadUint32(entry + 4);
+            const bsl::size_t child     = FlatDatum_Imp::loadUint32(entry + 8);
+
+            if (keyOffset <= offset
+             || !fits(keyOffset, keyLength, length)
+             || !consume(remaining, keyLength)) {
+                return -1;                                            // RETURN
+            }
+
+            const bslstl::StringRef key(buffer + keyOffset, keyLength);
+            if (sorted && 0 < i && key < previousKey) {
+                return -1;                                            // RETURN
+            }
+            previousKey = key;
+
+            if (child <= offset
+             || 0 != validateNode(buffer,
+                                  length,
+                                  child,
+                                  depth + 1,
+                                  remaining)) {
+                return -1;                                            // RETURN
+            }
+        }
+        return 0;                                                     // RETURN
+      }
+      default: {
+        return 0;                                                     // RETURN
+      }
+    }
+}
+
+}  // close unnamed namespace
+
+                             // ------------------
+                             // class FlatDatumRef
+                             // ------------------
+
+// ACCESSORS
+
+                               // Scalar Values
+
+bdlt::Date FlatDatumRef::theDate() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_DATE == type());
+
+    return loadDate(payload());
+}
+
+bdlt::Time FlatDatumRef::theTime() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_TIME == type());
+
+    return loadTime(payload());
+}
+
+bdlt::Datetime FlatDatumRef::theDatetime() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_DATETIME == type());
+
+    return bdlt::Datetime(loadDate(payload()),
+                          loadTime(payload() + k_DATE_SIZE));
+}
+
+bdlt::DatetimeInterval FlatDatumRef::theDatetimeInterval() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_DATETIME_INTERVAL == type());
+
+    bdlt::DatetimeInterval result;
+    result.setInterval(static_cast<int>(FlatDatum_Imp::loadUint32(payload())),
+                       0,
+                       0,
+                       0,
+                       0,
+                       static_cast<bsls::Types::Int64>(
+                                FlatDatum_Imp::loadUint64(payload() + 4)));
+    return result;
+}
+
+bdldfp::Decimal64 FlatDatumRef::theDecimal64() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_DECIMAL64 == type());
+
+    bdldfp::Decimal64 result;
+    bdldfp::DecimalConvertUtil::decimal64FromNetwork(
+                           &result,
+                           reinterpret_cast<const unsigned char *>(payload()));
+    return result;
+}
+
+                                // Map Values
+
+int FlatDatumRef::findMapValue(FlatDatumRef             *result,
+                               const bslstl::StringRef&  key) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT_SAFE(Datum::e_MAP == type());
+
+    const SizeType size = mapSize();
+
+    if (isMapSorted()) {
+        // Find the first entry whose key is not less than 'key'.
+
+        SizeType low  = 0;
+        SizeType high = size;
+        while (low < high) {
+            const SizeType middle = low + (high - low) / 2;
+            if (mapKey(middle) < key) {
+                low = middle + 1;
+            }
+            else {
+                high = middle;
+            }
+        }
+
+        if (low < size && mapKey(low) == key) {
+            *result = mapValue(low);
+            return 0;                                                 // RETURN
+        }
+        return -1;                                                    // RETURN
+    }
+
+    for (SizeType i = 0; i < size; ++i) {
+        if (mapKey(i) == key) {
+            *result = mapValue(i);
+            return 0;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+                            // --------------------
+                            // struct FlatDatumUtil
+                            // --------------------
+
+// CLASS METHODS
+void FlatDatumUtil::decode(Datum               *result,
+                           const FlatDatumRef&  flatDatum,
+                           bslma::Allocator    *basicAllocator)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(basicAllocator);
+
+    switch (flatDatum.type()) {
+      case Datum::e_NIL: {
+        *result = Datum::createNull();
+      } break;
+      case Datum::e_BOOLEAN: {
+        *result = Datum::createBoolean(flatDatum.theBoolean());
+      } break;
+      case Datum::e_INTEGER: {
+        *result = Datum::createInteger(flatDatum.theInteger());
+      } break;
+      case Datum::e_INTEGER64: {
+        *result = Datum::createInteger64(flatDatum.theInteger64(),
+                                         basicAllocator);
+      } break;
+      case Datum::e_DOUBLE: {
+        *result = Datum::createDouble(flatDatum.theDouble());
+      } break;
+      case Datum::e_DECIMAL64: {
+        *result = Datum::createDecimal64(flatDatum.theDecimal64(),
+                                         basicAllocator);
+      } break;
+      case Datum::e_DATE: {
+        *result = Datum::createDate(flatDatum.theDate());
+      } break;
+      case Datum::e_TIME: {
+        *result = Datum::createTime(flatDatum.theTime());
+      } break;
+      case Datum::e_DATETIME: {
+        *result = Datum::createDatetime(flatDatum.theDatetime(),
+                                        basicAllocator);
+      } break;
+      case Datum::e_DATETIME_INTERVAL: {
+        *result = Datum::createDatetimeInterval(
+                                             flatDatum.theDatetimeInterval(),
+                                             basicAllocator);
+      } break;
+      case Datum::e_STRING: {
+        *result = Datum::copyString(flatDatum.theString(), basicAllocator);
+      } break;
+      case Datum::e_BINARY: {
+        const DatumBinaryRef value = flatDatum.theBinary();
+        *result = Datum::copyBinary(value.data(),
+                                    value.size(),
+                                    basicAllocator);
+      } break;
+      case Datum::e_ERROR: {
+        const DatumError value = flatDatum.theError();
+        *result = Datum::createError(value.code(),
+                                     value.message(),
+                                     basicAllocator);
+      } break;
+      case Datum::e_ARRAY: {
+        const FlatDatumRef::SizeType length = flatDatum.arrayLength();
+
+        DatumMutableArrayRef array;
+        Datum::createUninitializedArray(&array, length, basicAllocator);
+
+        // The partially decoded array is owned by 'guard', and so is released
+        // if decoding an element throws.
+
+        ManagedDatum guard(Datum::adoptArray(array), basicAllocator);
+
+        for (FlatDatumRef::SizeType i = 0; i < length; ++i) {
+            decode(array.data() + i,
+                   flatDatum.arrayElement(i),
+                   basicAllocator);
+            ++*array.length();
+        }
+
+        *result = guard.release();
+      } break;
+      case Datum::e_MAP: {
+        const FlatDatumRef::SizeType size = flatDatum.mapSize();
+
+        Datum::SizeType keysCapacity = 0;
+        for (FlatDatumRef::SizeType i = 0; i < size; ++i) {
+            keysCapacity += flatDatum.mapKey(i).length();
+        }
+
+        DatumMutableMapOwningKeysRef map;
+        Datum::createUninitializedMap(&map,
+                                      size,
+                                      keysCapacity,
+                                      basicAllocator);
+        *map.sorted() = flatDatum.isMapSorted();
+
+        // The partially decoded map is owned by 'guard', and so is released if
+        // decoding a value throws.
+
+        ManagedDatum guard(Datum::adoptMap(map), basicAllocator);
+
+        char *nextKey = map.keys();
+        for (FlatDatumRef::SizeType i = 0; i < size; ++i) {
+            const bslstl::StringRef key = flatDatum.mapKey(i);
+            bsl::memcpy(nextKey, key.data(), key.length());
+
+            Datum value;
+            decode(&value, flatDatum.mapValue(i), basicAllocator);
+
+            map.data()[i] = DatumMapEntry(
+                                    bslstl::StringRef(nextKey, key.length()),
+                                    value);
+            ++*map.size();
+            nextKey += key.length();
+        }
+
+        *result = guard.release();
+      } break;
+      default: {
+        BSLS_ASSERT(!"Invalid flat datum");
+      }
+    }
+}
+
+int FlatDatumUtil::encode(bsl::vector<char> *result, const Datum& datum)
+{
+    BSLS_ASSERT(result);
+
+    bsl::size_t length = FlatDatum_Imp::k_HEADER_SIZE;
+    if (0 != computeLength(&length, datum, 0) || length > k_MAX_LENGTH) {
+        return -1;                                                    // RETURN
+    }
+
+    result->clear();
+    result->reserve(length);
+
+    appendBytes(result, k_MAGIC, sizeof k_MAGIC);
+    result->push_back(static_cast<char>(FlatDatum_Imp::k_VERSION));
+    result->resize(8);
+    appendUint32(result, static_cast<unsigned int>(length));
+    result->resize(FlatDatum_Imp::k_HEADER_SIZE);
+
+    encodeNode(result, datum);
+
+    BSLS_ASSERT(result->size() == length);
+
+    return 0;
+}
+
+bsl::size_t FlatDatumUtil::encodedLength(const Datum& datum)
+{
+    bsl::size_t length = FlatDatum_Imp::k_HEADER_SIZE;
+
+    const int rc = computeLength(&length, datum, 0);
+    BSLS_ASSERT(0 == rc);  (void)rc;
+
+    return length;
+}
+
+int FlatDatumUtil::validate(const char *buffer, bsl::size_t length)
+{
+    BSLS_ASSERT(buffer || 0 == length);
+
+    if (length <= FlatDatum_Imp::k_HEADER_SIZE
+     || length > k_MAX_LENGTH
+     || 0 != bsl::memcmp(buffer, k_MAGIC, sizeof k_MAGIC)
+     || FlatDatum_Imp::k_VERSION != buffer[4]
+     || 0 != buffer[5] || 0 != buffer[6] || 0 != buffer[7]
+     || length != FlatDatum_Imp::loadUint32(buffer + 8)
+     || 0 != FlatDatum_Imp::loadUint32(buffer + 12)) {
+        return -1;                                                    // RETURN
+    }
+
+    // The nodes (and keys) of a valid flat datum occupy every byte following
+    // the header exactly once.
+
+    bsl::size_t remaining = length - FlatDatum_Imp::k_HEADER_SIZE;
+
+    if (0 != validateNode(buffer,
+                          length,
+                          FlatDatum_Imp::k_HEADER_SIZE,
+                          0,
+                          &remaining)) {
+        return -1;                                                    // RETURN
+    }
+    return 0 == remaining ? 0 : -1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,669 @@
+// bdld_flatdatum.h                                                   -*-C++-*-
+#ifndef INCLUDED_BDLD_FLATDATUM
+#define INCLUDED_BDLD_FLATDATUM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide a contiguous, position-independent encoding of 'Datum's.
+//
+//@CLASSES:
+//  bdld::FlatDatumRef: in-place, read-only view of an encoded 'Datum'
+//  bdld::FlatDatumUtil: namespace for encoding and decoding flat 'Datum's
+//
+//@SEE_ALSO: bdld_datum, bdld_arenadatum
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bdld::FlatDatumUtil', that encodes a 'Datum' tree into a single contiguous
+// buffer (a *flat* *datum*) in which every reference from an array or map to
+// its elements is a byte offset from the start of the buffer, rather than a
+// pointer.  A flat datum can therefore be written to a file or a socket,
+// 'mmap'ed or received into any address, and read in place.  This component
+// also provides a value-semantic reference type, 'bdld::FlatDatumRef', that
+// provides read-only access to a (sub-)tree of a flat datum in place, without
+// decoding it and without allocating memory.
+//
+// A buffer obtained from an untrusted source must be verified with
+// 'FlatDatumUtil::validate' before it is read; the accessors of
+// 'FlatDatumRef' do not check bounds.  A valid flat datum can be converted
+// back into a 'Datum' (having no references into the buffer) with
+// 'FlatDatumUtil::decode'.  See {'bdld_arenadatum'} to decode a flat datum
+// into a single block of memory.
+//
+///Supported Types
+///---------------
+// All of the types that a 'Datum' can hold are supported, except for
+// user-defined types ('e_USERDEFINED'), whose values are pointers, and
+// int-maps ('e_INT_MAP').  'FlatDatumUtil::encode' fails if the 'Datum' to be
+// encoded holds, or contains, a value of either of these types.
+//
+///Encoding Format
+///---------------
+// A flat datum consists of a 16-byte header followed by the encoding of the
+// root node.  All multi-byte integers are stored in little-endian byte order
+// with no alignment requirement, so a flat datum can be read on any platform
+// regardless of the platform that wrote it.
+//..
+//  offset  size  content
+//  ------  ----  -----------------------------------------------------------
+//       0     4  the magic bytes "BDFD"
+//       4     1  the format version (1)
+//       5     3  zero
+//       8     4  the total length of the flat datum, in bytes
+//      12     4  zero
+//      16        the root node
+//..
+// Each node consists of a one-byte 'Datum::DataType' tag followed by a payload
+// that depends on the type:
+//..
+//  type                 payload
+//  -------------------  ----------------------------------------------------
+//  e_NIL                (none)
+//  e_BOOLEAN            1 byte (0 or 1)
+//  e_INTEGER            4-byte signed integer
+//  e_INTEGER64          8-byte signed integer
+//  e_DOUBLE             8-byte IEEE-754 bit pattern
+//  e_DATE               2-byte year, 1-byte month, 1-byte day
+//  e_TIME               8-byte microseconds since midnight (24:00 is encoded
+//                       as 86,400,000,000)
+//  e_DATETIME           'e_DATE' payload, then 'e_TIME' payload
+//  e_DATETIME_INTERVAL  4-byte days, 8-byte microseconds of fractional day
+//  e_DECIMAL64          8-byte BID encoding in network byte order (see
+//                       'bdldfp_decimalconvertutil')
+//  e_STRING             4-byte length, then the characters
+//  e_BINARY             4-byte size, then the bytes
+//  e_ERROR              4-byte code, 4-byte message length, then the message
+//  e_ARRAY              4-byte length 'n', then 'n' 4-byte element offsets
+//  e_MAP                1-byte sorted flag, 4-byte size 'n', then 'n'
+//                       entries of 4-byte key offset, 4-byte key length, and
+//                       4-byte value offset
+//..
+// Every offset is measured from the start of the flat datum, and the offset of
+// each element (and key) of an array (or map) is greater than the offset of
+// the array (or map) node itself, so a valid flat datum is a tree and cannot
+// contain cycles.  The keys of a map are stored as raw characters (with no
+// tag), and every byte following the header belongs to exactly one node or
+// key.  The sorted flag of a map is set if the encoded 'Datum' map was sorted,
+// in which case 'FlatDatumRef::findMapValue' uses a binary search.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sending a Configuration Between Processes
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we represent the configuration of a service as a 'Datum' map,
+// and we want to send it to another process, which reads only a few of its
+// values.
+//
+// First, we build the configuration:
+//..
+//  bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+//
+//  bdld::DatumMutableMapRef map;
+//  bdld::Datum::createUninitializedMap(&map, 2, allocator);
+//  map.data()[0] = bdld::DatumMapEntry("name",
+//                                      bdld::Datum::createStringRef(
+//                                                          "pricing",
+//                                                          allocator));
+//  map.data()[1] = bdld::DatumMapEntry("threads",
+//                                      bdld::Datum::createInteger(8));
+//  *map.size() = 2;
+//
+//  bdld::Datum config = bdld::Datum::adoptMap(map);
+//..
+// Then, we encode it into a flat buffer, which we could now write to a socket:
+//..
+//  bsl::vector<char> buffer;
+//  int rc = bdld::FlatDatumUtil::encode(&buffer, config);
+//  assert(0 == rc);
+//
+//  bdld::Datum::destroy(config, allocator);
+//..
+// Next, the receiving process, having read the buffer into memory, verifies
+// that it is a valid flat datum:
+//..
+//  rc = bdld::FlatDatumUtil::validate(buffer.data(), buffer.size());
+//  assert(0 == rc);
+//..
+// Now, the receiver reads the values it needs in place, without decoding the
+// buffer or allocating memory:
+//..
+//  bdld::FlatDatumRef root(buffer.data());
+//  assert(bdld::Datum::e_MAP == root.type());
+//
+//  bdld::FlatDatumRef threads;
+//  rc = root.findMapValue(&threads, "threads");
+//  assert(0 == rc);
+//  assert(8 == threads.theInteger());
+//..
+// Finally, the receiver decodes the whole configuration into a 'Datum', which
+// does not refer to the buffer:
+//..
+//  bdld::Datum copy;
+//  bdld::FlatDatumUtil::decode(&copy, root, allocator);
+//
+//  assert(bdld::Datum::e_MAP == copy.type());
+//  assert("pricing" == copy.theMap().find("name")->theString());
+//
+//  bdld::Datum::destroy(copy, allocator);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdld_datum.h>
+#include <bdld_datumbinaryref.h>
+#include <bdld_datumerror.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_time.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmf_istriviallycopyable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_byteorder.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdld {
+
+                           // ====================
+                           // struct FlatDatum_Imp
+                           // ====================
+
+struct FlatDatum_Imp {
+    // [!PRIVATE!] This 'struct' provides a namespace for the constants and
+    // primitive operations that define the layout of a flat datum.
+
+    // TYPES
+    enum {
+        k_HEADER_SIZE     = 16,   // size of the header
+        k_VERSION         = 1,    // current format version
+        k_ARRAY_SLOT_SIZE = 4,    // size of an array element offset
+        k_MAP_ENTRY_SIZE  = 12    // size of a map entry
+    };
+
+    // CLASS METHODS
+    static bsls::Types::Uint64 loadUint64(const char *address);
+        // Return the 8-byte little-endian unsigned integer at the specified
+        // 'address'.
+
+    static unsigned int loadUint32(const char *address);
+        // Return the 4-byte little-endian unsigned integer at the specified
+        // 'address'.
+};
+
+                             // ==================
+                             // class FlatDatumRef
+                             // ==================
+
+class FlatDatumRef {
+    // This value-semantic reference type provides read-only access, in place,
+    // to a node of a flat datum.  The behavior of every accessor is undefined
+    // unless this object refers to a node of a valid flat datum (see
+    // 'FlatDatumUtil::validate') that remains in memory and unmodified, and,
+    // for the accessors of a particular type, unless 'type()' is that type.
+
+  public:
+    // TYPES
+    typedef Datum::SizeType SizeType;
+        // 'SizeType' is an alias for an unsigned integral value, representing
+        // the length of an array or the size of a map.
+
+  private:
+    // DATA
+    const char  *d_encoding_p;  // start of the flat datum (held, not owned)
+    unsigned int d_offset;      // offset of the node from 'd_encoding_p'
+
+    // FRIENDS
+    friend bool operator==(const FlatDatumRef&, const FlatDatumRef&);
+
+    // PRIVATE ACCESSORS
+    const char *payload() const;
+        // Return the address of the payload of the node referred to by this
+        // object.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatDatumRef, bsl::is_trivially_copyable);
+
+    // CREATORS
+    FlatDatumRef();
+        // Create a reference to no node.  The behavior of every accessor other
+        // than 'encoding' and 'offset' is undefined for the created object
+        // until it is assigned a reference to a node.
+
+    explicit FlatDatumRef(const char *encoding);
+        // Create a reference to the root node of the flat datum at the
+        // specified 'encoding'.  The behavior is undefined unless 'encoding'
+        // refers to a valid flat datum.
+
+    FlatDatumRef(const char *encoding, unsigned int offset);
+        // Create a reference to the node at the specified 'offset' in the flat
+        // datum at the specified 'encoding'.  The behavior is undefined unless
+        // 'encoding' refers to a valid flat datum having a node at 'offset'.
+
+    //! FlatDatumRef(const FlatDatumRef& original) = default;
+    //! ~FlatDatumRef() = default;
+
+    // MANIPULATORS
+    //! FlatDatumRef& operator=(const FlatDatumRef& rhs) = default;
+
+    // ACCESSORS
+    Datum::DataType type() const;
+        // Return the type of the value of the node referred to by this object.
+
+    const char *encoding() const;
+        // Return the address of the flat datum containing the node referred to
+        // by this object.
+
+    unsigned int offset() const;
+        // Return the offset of the node referred to by this object from the
+        // start of its flat datum.
+
+                               // Scalar Values
+
+    bool theBoolean() const;
+        // Return the boolean value of the referenced node.
+
+    int theInteger() const;
+        // Return the integer value of the referenced node.
+
+    bsls::Types::Int64 theInteger64() const;
+        // Return the 64-bit integer value of the referenced node.
+
+    double theDouble() const;
+        // Return the double value of the referenced node.
+
+    bdlt::Date theDate() const;
+        // Return the date value of the referenced node.
+
+    bdlt::Time theTime() const;
+        // Return the time value of the referenced node.
+
+    bdlt::Datetime theDatetime() const;
+        // Return the datetime value of the referenced node.
+
+    bdlt::DatetimeInterval theDatetimeInterval() const;
+        // Return the datetime interval value of the referenced node.
+
+    bdldfp::Decimal64 theDecimal64() const;
+        // Return the 'Decimal64' value of the referenced node.
+
+    bslstl::StringRef theString() const;
+        // Return a reference to the characters, in the flat datum, of the
+        // string value of the referenced node.
+
+    DatumBinaryRef theBinary() const;
+        // Return a reference to the bytes, in the flat datum, of the binary
+        // value of the referenced node.
+
+    DatumError theError() const;
+        // Return the error value of the referenced node, whose message refers
+        // to characters in the flat datum.
+
+                               // Array Values
+
+    SizeType arrayLength() const;
+        // Return the number of elements of the array value of the referenced
+        // node.
+
+    FlatDatumRef arrayElement(SizeType index) const;
+        // Return a reference to the element at the specified 'index' of the
+        // array value of the referenced node.  The behavior is undefined
+        // unless 'index < arrayLength()'.
+
+                                // Map Values
+
+    SizeType mapSize() const;
+        // Return the number of entries of the map value of the referenced
+        // node.
+
+    bool isMapSorted() const;
+        // Return 'true' if the entries of the map value of the referenced node
+        // are sorted by key, and 'false' otherwise.
+
+    bslstl::StringRef mapKey(SizeType index) const;
+        // Return a reference to the characters, in the flat datum, of the key
+        // of the entry at the specified 'index' of the map value of the
+        // referenced node.  The behavior is undefined unless
+        // 'index < mapSize()'.
+
+    FlatDatumRef mapValue(SizeType index) const;
+        // Return a reference to the value of the entry at the specified
+        // 'index' of the map value of the referenced node.  The behavior is
+        // undefined unless 'index < mapSize()'.
+
+    int findMapValue(FlatDatumRef             *result,
+                     const bslstl::StringRef&  key) const;
+        // Load, into the specified 'result', a reference to the value of the
+        // first entry of the map value of the referenced node having the
+        // specified 'key'.  Return 0 on success, and a non-zero value (with no
+        // effect on 'result') if no entry has 'key'.  The search is binary if
+        // 'isMapSorted()', and linear otherwise.
+};
+
+// FREE OPERATORS
+bool operator==(const FlatDatumRef& lhs, const FlatDatumRef& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' refer to the same node of
+    // the same flat datum, and 'false' otherwise.  Note that two references to
+    // distinct nodes having the same value do not compare equal.
+
+bool operator!=(const FlatDatumRef& lhs, const FlatDatumRef& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' do not refer to the same
+    // node of the same flat datum, and 'false' otherwise.
+
+                            // ====================
+                            // struct FlatDatumUtil
+                            // ====================
+
+struct FlatDatumUtil {
+    // This 'struct' provides a namespace for functions that encode 'Datum'
+    // objects into flat datums, and that validate and decode flat datums.
+
+    // TYPES
+    enum {
+        k_MAX_DEPTH = 1024  // maximum nesting depth of arrays and maps that
+                            // is encoded or accepted by 'validate'
+    };
+
+    // CLASS METHODS
+    static void decode(Datum               *result,
+                       const FlatDatumRef&  flatDatum,
+                       bslma::Allocator    *basicAllocator);
+        // Load, into the specified 'result', a 'Datum' having the value of the
+        // node referred to by the specified 'flatDatum', using the specified
+        // 'basicAllocator' to supply memory.  The loaded 'Datum' (including
+        // the keys of its maps) does not refer to the flat datum, and must be
+        // released with 'Datum::destroy' using 'basicAllocator'.  If an
+        // exception is thrown, 'result' is unchanged and no memory is leaked.
+        // The behavior is undefined unless 'flatDatum' refers to a node of a
+        // valid flat datum.
+
+    static int encode(bsl::vector<char> *result, const Datum& datum);
+        // Load, into the specified 'result', the flat datum encoding of the
+        // specified 'datum', replacing the contents of 'result'.  Return 0 on
+        // success, and a non-zero value (with the contents of 'result'
+        // unspecified) if 'datum' holds or contains a user-defined value or an
+        // int-map, if arrays and maps are nested more than 'k_MAX_DEPTH'
+        // deep, or if the encoding would exceed 4 GB.
+
+    static bsl::size_t encodedLength(const Datum& datum);
+        // Return the length, in bytes, of the flat datum encoding of the
+        // specified 'datum'.  The behavior is undefined unless 'datum' can be
+        // encoded (see 'encode').
+
+    static int validate(const char *buffer, bsl::size_t length);
+        // Return 0 if the specified 'buffer' of the specified 'length' holds a
+        // valid flat datum of exactly 'length' bytes, and a non-zero value
+        // otherwise.  A valid flat datum has a well-formed header, every node
+        // has a supported type tag and a payload encoding a value of that
+        // type, every offset refers forward to a node (or key) in the
+        // buffer, nesting does not exceed 'k_MAX_DEPTH', the keys of every
+        // map flagged as sorted are in non-decreasing order, and the nodes
+        // and keys reachable from the root account for every byte following
+        // the header exactly once (counting a node once for each reference to
+        // it).  Note that the last condition bounds the work done by this
+        // function, and by 'decode', to be linear in 'length'.  The behavior
+        // is undefined unless '0 != buffer || 0 == length'.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                           // --------------------
+                           // struct FlatDatum_Imp
+                           // --------------------
+
+// CLASS METHODS
+inline
+bsls::Types::Uint64 FlatDatum_Imp::loadUint64(const char *address)
+{
+    bsls::Types::Uint64 value;
+    bsl::memcpy(&value, address, sizeof value);
+    return BSLS_BYTEORDER_LE_U64_TO_HOST(value);
+}
+
+inline
+unsigned int FlatDatum_Imp::loadUint32(const char *address)
+{
+    unsigned int value;
+    bsl::memcpy(&value, address, sizeof value);
+    return BSLS_BYTEORDER_LE_U32_TO_HOST(value);
+}
+
+                             // ------------------
+                             // class FlatDatumRef
+                             // ------------------
+
+// PRIVATE ACCESSORS
+inline
+const char *FlatDatumRef::payload() const
+{
+    return d_encoding_p + d_offset + 1;
+}
+
+// CREATORS
+inline
+FlatDatumRef::FlatDatumRef()
+: d_encoding_p(0)
+, d_offset(0)
+{
+}
+
+inline
+FlatDatumRef::FlatDatumRef(const char *encoding)
+: d_encoding_p(encoding)
+, d_offset(FlatDatum_Imp::k_HEADER_SIZE)
+{
+    BSLS_ASSERT_SAFE(encoding);
+}
+
+inline
+FlatDatumRef::FlatDatumRef(const char *encoding, unsigned int offset)
+: d_encoding_p(encoding)
+, d_offset(offset)
+{
+    BSLS_ASSERT_SAFE(encoding);
+}
+
+// ACCESSORS
+inline
+Datum::DataType FlatDatumRef::type() const
+{
+    return static_cast<Datum::DataType>(
+                       static_cast<unsigned char>(d_encoding_p[d_offset]));
+}
+
+inline
+const char *FlatDatumRef::encoding() const
+{
+    return d_encoding_p;
+}
+
+inline
+unsigned int FlatDatumRef::offset() const
+{
+    return d_offset;
+}
+
+                               // Scalar Values
+
+inline
+bool FlatDatumRef::theBoolean() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_BOOLEAN == type());
+
+    return 0 != *payload();
+}
+
+inline
+int FlatDatumRef::theInteger() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_INTEGER == type());
+
+    return static_cast<int>(FlatDatum_Imp::loadUint32(payload()));
+}
+
+inline
+bsls::Types::Int64 FlatDatumRef::theInteger64() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_INTEGER64 == type());
+
+    return static_cast<bsls::Types::Int64>(
+                                       FlatDatum_Imp::loadUint64(payload()));
+}
+
+inline
+double FlatDatumRef::theDouble() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_DOUBLE == type());
+
+    const bsls::Types::Uint64 bits = FlatDatum_Imp::loadUint64(payload());
+
+    double value;
+    bsl::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+inline
+bslstl::StringRef FlatDatumRef::theString() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_STRING == type());
+
+    const char *data = payload();
+    return bslstl::StringRef(data + 4, FlatDatum_Imp::loadUint32(data));
+}
+
+inline
+DatumBinaryRef FlatDatumRef::theBinary() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_BINARY == type());
+
+    const char *data = payload();
+    return DatumBinaryRef(data + 4, FlatDatum_Imp::loadUint32(data));
+}
+
+inline
+DatumError FlatDatumRef::theError() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_ERROR == type());
+
+    const char *data = payload();
+    return DatumError(static_cast<int>(FlatDatum_Imp::loadUint32(data)),
+                      bslstl::StringRef(data + 8,
+                                        FlatDatum_Imp::loadUint32(data + 4)));
+}
+
+                               // Array Values
+
+inline
+FlatDatumRef::SizeType FlatDatumRef::arrayLength() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_ARRAY == type());
+
+    return FlatDatum_Imp::loadUint32(payload());
+}
+
+inline
+FlatDatumRef FlatDatumRef::arrayElement(SizeType index) const
+{
+    BSLS_ASSERT_SAFE(Datum::e_ARRAY == type());
+    BSLS_ASSERT_SAFE(index < arrayLength());
+
+    return FlatDatumRef(d_encoding_p,
+                        FlatDatum_Imp::loadUint32(
+                                payload() + 4
+                                + index * FlatDatum_Imp::k_ARRAY_SLOT_SIZE));
+}
+
+                                // Map Values
+
+inline
+FlatDatumRef::SizeType FlatDatumRef::mapSize() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_MAP == type());
+
+    return FlatDatum_Imp::loadUint32(payload() + 1);
+}
+
+inline
+bool FlatDatumRef::isMapSorted() const
+{
+    BSLS_ASSERT_SAFE(Datum::e_MAP == type());
+
+    return 0 != *payload();
+}
+
+inline
+bslstl::StringRef FlatDatumRef::mapKey(SizeType index) const
+{
+    BSLS_ASSERT_SAFE(Datum::e_MAP == type());
+    BSLS_ASSERT_SAFE(index < mapSize());
+
+    const char *entry = payload() + 5
+                                   + index * FlatDatum_Imp::k_MAP_ENTRY_SIZE;
+
+    return bslstl::StringRef(d_encoding_p + FlatDatum_Imp::loadUint32(entry),
+                             FlatDatum_Imp::loadUint32(entry + 4));
+}
+
+inline
+FlatDatumRef FlatDatumRef::mapValue(SizeType index) const
+{
+    BSLS_ASSERT_SAFE(Datum::e_MAP == type());
+    BSLS_ASSERT_SAFE(index < mapSize());
+
+    const char *entry = payload() + 5
+                                   + index * FlatDatum_Imp::k_MAP_ENTRY_SIZE;
+
+    return FlatDatumRef(d_encoding_p, FlatDatum_Imp::loadUint32(entry + 8));
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bdld::operator==(const FlatDatumRef& lhs, const FlatDatumRef& rhs)
+{
+    return lhs.d_encoding_p == rhs.d_encoding_p
+        && lhs.d_offset     == rhs.d_offset;
+}
+
+inline
+bool bdld::operator!=(const FlatDatumRef& lhs, const FlatDatumRef& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
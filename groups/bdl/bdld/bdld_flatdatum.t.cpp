@@ -0,0 +1,1618 @@
+// bdld_flatdatum.t.cpp                                               -*-C++-*-
+#include <bdld_flatdatum.h>
+
+#include <bdld_datummaker.h>
+#include <bdld_datumudt.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_time.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test provides a utility that encodes 'Datum' objects
+// into a contiguous buffer, validates and decodes such buffers, and a
+// reference type that reads an encoded buffer in place.  We test the layout
+// of the encoding directly for a few values, and otherwise verify that every
+// supported value survives a round trip through 'encode' and either the
+// in-place accessors or 'decode'.  'validate' is tested by accepting every
+// encoding produced by 'encode' and rejecting truncated, corrupted, and
+// maliciously structured buffers.
+// ----------------------------------------------------------------------------
+// CLASS METHODS (FlatDatum_Imp)
+// [ 2] Uint64 loadUint64(const char *address);
+// [ 2] unsigned int loadUint32(const char *address);
+//
+// CREATORS (FlatDatumRef)
+// [ 4] FlatDatumRef();
+// [ 4] explicit FlatDatumRef(const char *encoding);
+// [ 4] FlatDatumRef(const char *encoding, unsigned int offset);
+//
+// ACCESSORS (FlatDatumRef)
+// [ 4] Datum::DataType type() const;
+// [ 4] const char *encoding() const;
+// [ 4] unsigned int offset() const;
+// [ 4] bool theBoolean() const;
+// [ 4] int theInteger() const;
+// [ 4] Int64 theInteger64() const;
+// [ 4] double theDouble() const;
+// [ 4] bdlt::Date theDate() const;
+// [ 4] bdlt::Time theTime() const;
+// [ 4] bdlt::Datetime theDatetime() const;
+// [ 4] bdlt::DatetimeInterval theDatetimeInterval() const;
+// [ 4] bdldfp::Decimal64 theDecimal64() const;
+// [ 4] bslstl::StringRef theString() const;
+// [ 4] DatumBinaryRef theBinary() const;
+// [ 4] DatumError theError() const;
+// [ 5] SizeType arrayLength() const;
+// [ 5] FlatDatumRef arrayElement(SizeType index) const;
+// [ 5] SizeType mapSize() const;
+// [ 5] bool isMapSorted() const;
+// [ 5] bslstl::StringRef mapKey(SizeType index) const;
+// [ 5] FlatDatumRef mapValue(SizeType index) const;
+// [ 5] int findMapValue(FlatDatumRef *, const StringRef&) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const FlatDatumRef&, const FlatDatumRef&);
+// [ 4] bool operator!=(const FlatDatumRef&, const FlatDatumRef&);
+//
+// CLASS METHODS (FlatDatumUtil)
+// [ 7] void decode(Datum *, const FlatDatumRef&, bslma::Allocator *);
+// [ 3] int encode(bsl::vector<char> *result, const Datum& datum);
+// [ 3] bsl::size_t encodedLength(const Datum& datum);
+// [ 6] int validate(const char *buffer, bsl::size_t length);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdld::FlatDatumUtil Util;
+typedef bdld::FlatDatumRef  Obj;
+typedef bdld::FlatDatum_Imp Imp;
+typedef bdld::Datum         Datum;
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+// ============================================================================
+//                              TEST APPARATUS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void storeUint32(bsl::vector<char> *buffer,
+                 bsl::size_t        position,
+                 unsigned int       value)
+    // Store the specified 'value' at the specified 'position' of the specified
+    // 'buffer' in little-endian byte order.
+{
+    for (int i = 0; i < 4; ++i, value >>= 8) {
+        (*buffer)[position + i] = static_cast<char>(value & 0xFF);
+    }
+}
+
+void truncate(bsl::vector<char> *buffer, bsl::size_t length)
+    // Truncate the specified 'buffer' to the specified 'length' and update
+    // the length recorded in its header accordingly.
+{
+    buffer->resize(length);
+    storeUint32(buffer, 8, static_cast<unsigned int>(length));
+}
+
+int validate(const bsl::vector<char>& buffer)
+    // Return the result of validating the specified 'buffer'.
+{
+    return Util::validate(buffer.data(), buffer.size());
+}
+
+Datum makeSortedMap(const Datum& unsortedMap, bslma::Allocator *allocator)
+    // Return a sorted map, allocated from the specified 'allocator', having
+    // copies of the entries of the specified 'unsortedMap' in ascending order
+    // of their keys.  The keys of the result refer to those of 'unsortedMap'.
+{
+    const bdld::DatumMapRef map = unsortedMap.theMap();
+
+    bdld::DatumMutableMapRef result;
+    Datum::createUninitializedMap(&result, map.size(), allocator);
+    for (bdld::DatumMapRef::SizeType i = 0; i < map.size(); ++i) {
+        bdld::DatumMapEntry *entry = result.data() + i;
+        while (entry != result.data() && map[i].key() < entry[-1].key()) {
+            *entry = entry[-1];
+            --entry;
+        }
+        *entry = bdld::DatumMapEntry(map[i].key(),
+                                     map[i].value().clone(allocator));
+    }
+    *result.size()   = map.size();
+    *result.sorted() = true;
+    return Datum::adoptMap(result);
+}
+
+bool isEqual(const Obj& flat, const Datum& datum)
+    // Return 'true' if the specified 'flat' node has the value of the
+    // specified 'datum' (including the sorted flags of maps), and 'false'
+    // otherwise.
+{
+    if (flat.type() != datum.type()) {
+        return false;                                                 // RETURN
+    }
+
+    switch (datum.type()) {
+      case Datum::e_NIL:       return true;                           // RETURN
+      case Datum::e_BOOLEAN:   return flat.theBoolean() == datum.theBoolean();
+                                                                      // RETURN
+      case Datum::e_INTEGER:   return flat.theInteger() == datum.theInteger();
+                                                                      // RETURN
+      case Datum::e_INTEGER64: {
+        return flat.theInteger64() == datum.theInteger64();           // RETURN
+      }
+      case Datum::e_DOUBLE: {
+        const double lhs = flat.theDouble();
+        const double rhs = datum.theDouble();
+        return 0 == bsl::memcmp(&lhs, &rhs, sizeof lhs);              // RETURN
+      }
+      case Datum::e_DATE:      return flat.theDate() == datum.theDate();
+                                                                      // RETURN
+      case Datum::e_TIME:      return flat.theTime() == datum.theTime();
+                                                                      // RETURN
+      case Datum::e_DATETIME: {
+        return flat.theDatetime() == datum.theDatetime();             // RETURN
+      }
+      case Datum::e_DATETIME_INTERVAL: {
+        return flat.theDatetimeInterval()
+                                        == datum.theDatetimeInterval();
+                                                                      // RETURN
+      }
+      case Datum::e_DECIMAL64: {
+        return flat.theDecimal64() == datum.theDecimal64();           // RETURN
+      }
+      case Datum::e_STRING:    return flat.theString() == datum.theString();
+                                                                      // RETURN
+      case Datum::e_BINARY:    return flat.theBinary() == datum.theBinary();
+                                                                      // RETURN
+      case Datum::e_ERROR:     return flat.theError() == datum.theError();
+                                                                      // RETURN
+      case Datum::e_ARRAY: {
+        const bdld::DatumArrayRef array = datum.theArray();
+        if (flat.arrayLength() != array.length()) {
+            return false;                                             // RETURN
+        }
+        for (bdld::DatumArrayRef::SizeType i = 0; i < array.length(); ++i) {
+            if (!isEqual(flat.arrayElement(i), array[i])) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;                                                  // RETURN
+      }
+      case Datum::e_MAP: {
+        const bdld::DatumMapRef map = datum.theMap();
+        if (flat.mapSize() != map.size()
+         || flat.isMapSorted() != map.isSorted()) {
+            return false;                                             // RETURN
+        }
+        for (bdld::DatumMapRef::SizeType i = 0; i < map.size(); ++i) {
+            if (flat.mapKey(i) != map[i].key()
+             || !isEqual(flat.mapValue(i), map[i].value())) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;                                                  // RETURN
+      }
+      default: return false;                                          // RETURN
+    }
+}
+
+bool isEqualSorted(const Datum& lhs, const Datum& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same value and
+    // every pair of corresponding maps has the same sorted flag, and 'false'
+    // otherwise.
+{
+    if (lhs != rhs) {
+        return false;                                                 // RETURN
+    }
+    if (lhs.isArray()) {
+        for (bdld::DatumArrayRef::SizeType i = 0;
+                                          i < lhs.theArray().length(); ++i) {
+            if (!isEqualSorted(lhs.theArray()[i], rhs.theArray()[i])) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+    if (lhs.isMap()) {
+        if (lhs.theMap().isSorted() != rhs.theMap().isSorted()) {
+            return false;                                             // RETURN
+        }
+        for (bdld::DatumMapRef::SizeType i = 0; i < lhs.theMap().size(); ++i) {
+            if (!isEqualSorted(lhs.theMap()[i].value(),
+                               rhs.theMap()[i].value())) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+    return true;
+}
+
+Datum makeNested(int depth, bslma::Allocator *allocator)
+    // Return an array nested in arrays to the specified 'depth' (an array
+    // having no arrays is at depth 1), using the specified 'allocator'.
+{
+    bdld::DatumMaker m(allocator);
+
+    Datum result = m.a();
+    for (int i = 1; i < depth; ++i) {
+        result = m.a(result);
+    }
+    return result;
+}
+
+void makeScalars(bsl::vector<Datum> *result, bslma::Allocator *allocator)
+    // Append, to the specified 'result', a set of scalar 'Datum' values,
+    // including boundary values of each supported type, using the specified
+    // 'allocator'.
+{
+    bdld::DatumMaker m(allocator);
+
+    const char   BINARY[] = { 0, 1, 2, 3, 127, -128, -1 };
+    const double DBL_MAX_ = bsl::numeric_limits<double>::max();
+
+    result->push_back(m());
+    result->push_back(m(true));
+    result->push_back(m(false));
+    result->push_back(m(0));
+    result->push_back(m(-1));
+    result->push_back(m(bsl::numeric_limits<int>::min()));
+    result->push_back(m(bsl::numeric_limits<int>::max()));
+    result->push_back(m(Int64(0)));
+    result->push_back(m(bsl::numeric_limits<Int64>::min()));
+    result->push_back(m(bsl::numeric_limits<Int64>::max()));
+    result->push_back(m(0.0));
+    result->push_back(m(-0.0));
+    result->push_back(m(1.5));
+    result->push_back(m(-DBL_MAX_));
+    result->push_back(m(bsl::numeric_limits<double>::infinity()));
+    result->push_back(m(bsl::numeric_limits<double>::denorm_min()));
+    result->push_back(m(bdlt::Date()));
+    result->push_back(m(bdlt::Date(2018, 2, 28)));
+    result->push_back(m(bdlt::Date(9999, 12, 31)));
+    result->push_back(m(bdlt::Time()));
+    result->push_back(m(bdlt::Time(0, 0, 0, 0, 0)));
+    result->push_back(m(bdlt::Time(23, 59, 59, 999, 999)));
+    result->push_back(m(bdlt::Datetime()));
+    result->push_back(m(bdlt::Datetime(2018, 6, 30, 12, 34, 56, 789, 12)));
+    result->push_back(m(bdlt::Datetime(9999, 12, 31, 23, 59, 59, 999, 999)));
+    result->push_back(m(bdlt::DatetimeInterval()));
+    result->push_back(m(bdlt::DatetimeInterval(1, 2, 3, 4, 5, 6)));
+    result->push_back(m(bdlt::DatetimeInterval(-1, -2, -3, -4, -5, -6)));
+    result->push_back(m(bdlt::DatetimeInterval(0, 0, 0, 0, 0, -1)));
+    result->push_back(m(bdlt::DatetimeInterval(-999999999, -23)));
+    result->push_back(m(bdldfp::Decimal64(0)));
+    result->push_back(m(bdldfp::Decimal64(-42)));
+    result->push_back(m(BDLDFP_DECIMAL_DD(1234567.890123456)));
+    result->push_back(m(""));
+    result->push_back(m("a"));
+    result->push_back(m(bslstl::StringRef(
+                          "a somewhat longer string, with embedded \0 null",
+                          46)));
+    result->push_back(Datum::copyBinary(BINARY, 0, allocator));
+    result->push_back(Datum::copyBinary(BINARY, sizeof BINARY, allocator));
+    result->push_back(m(bdld::DatumError()));
+    result->push_back(m(bdld::DatumError(-7)));
+    result->push_back(m(bdld::DatumError(42, "out of range")));
+}
+
+void makeAggregates(bsl::vector<Datum> *result, bslma::Allocator *allocator)
+    // Append, to the specified 'result', a set of array and map 'Datum'
+    // values, including empty, nested, and sorted aggregates, using the
+    // specified 'allocator'.
+{
+    bdld::DatumMaker m(allocator);
+
+    const Datum unsortedMap = m.m("zeta",  1,
+                                  "alpha", m.a(true, "two", 3.0),
+                                  "",      m(),
+                                  "mu",    m.m("x", bdlt::Date(2018, 1, 2)),
+                                  "alpha", "duplicate");
+
+    result->push_back(m.a());
+    result->push_back(m.m());
+    result->push_back(m.a(1, 2, 3));
+    result->push_back(m.a(m.a(), m.m(), m.a(m.a(m.a("deep")))));
+    result->push_back(unsortedMap);
+    result->push_back(makeSortedMap(unsortedMap, allocator));
+    result->push_back(m.a(makeSortedMap(unsortedMap, allocator),
+                          m.m("k", m.a(bdldfp::Decimal64(5),
+                                       bdld::DatumError(1, "e"),
+                                       Int64(-5))),
+                          bdlt::DatetimeInterval(3, 4)));
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sending a Configuration Between Processes
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we represent the configuration of a service as a 'Datum' map,
+// and we want to send it to another process, which reads only a few of its
+// values.
+//
+// First, we build the configuration:
+//..
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    bdld::DatumMutableMapRef map;
+    bdld::Datum::createUninitializedMap(&map, 2, allocator);
+    map.data()[0] = bdld::DatumMapEntry("name",
+                                        bdld::Datum::createStringRef(
+                                                            "pricing",
+                                                            allocator));
+    map.data()[1] = bdld::DatumMapEntry("threads",
+                                        bdld::Datum::createInteger(8));
+    *map.size() = 2;
+
+    bdld::Datum config = bdld::Datum::adoptMap(map);
+//..
+// Then, we encode it into a flat buffer, which we could now write to a socket:
+//..
+    bsl::vector<char> buffer;
+    int rc = bdld::FlatDatumUtil::encode(&buffer, config);
+    ASSERT(0 == rc);
+
+    bdld::Datum::destroy(config, allocator);
+//..
+// Next, the receiving process, having read the buffer into memory, verifies
+// that it is a valid flat datum:
+//..
+    rc = bdld::FlatDatumUtil::validate(buffer.data(), buffer.size());
+    ASSERT(0 == rc);
+//..
+// Now, the receiver reads the values it needs in place, without decoding the
+// buffer or allocating memory:
+//..
+    bdld::FlatDatumRef root(buffer.data());
+    ASSERT(bdld::Datum::e_MAP == root.type());
+
+    bdld::FlatDatumRef threads;
+    rc = root.findMapValue(&threads, "threads");
+    ASSERT(0 == rc);
+    ASSERT(8 == threads.theInteger());
+//..
+// Finally, the receiver decodes the whole configuration into a 'Datum', which
+// does not refer to the buffer:
+//..
+    bdld::Datum copy;
+    bdld::FlatDatumUtil::decode(&copy, root, allocator);
+
+    ASSERT(bdld::Datum::e_MAP == copy.type());
+    ASSERT("pricing" == copy.theMap().find("name")->theString());
+
+    bdld::Datum::destroy(copy, allocator);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // DECODE
+        //
+        // Concerns:
+        //: 1 'decode' loads a 'Datum' having the value of the encoded 'Datum',
+        //:   including the sorted flag of every map.
+        //:
+        //: 2 'decode' can start at any node, not only the root.
+        //:
+        //: 3 The decoded 'Datum' does not refer to the flat datum.
+        //:
+        //: 4 All memory is supplied by the specified allocator, and 'decode'
+        //:   is exception neutral: if an allocation fails, 'result' is
+        //:   unchanged and no memory is leaked.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each of a set of scalar and aggregate 'Datum' values, encode
+        //:   the value, decode the root under the exception-test loop with a
+        //:   test allocator, and compare the result with the original value.
+        //:   Then overwrite the buffer, and verify that the decoded value is
+        //:   unchanged.  (C-1, 3..4)
+        //:
+        //: 2 Decode the elements of an encoded array individually.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null arguments.  (C-5)
+        //
+        // Testing:
+        //   void decode(Datum *, const FlatDatumRef&, bslma::Allocator *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECODE" << endl
+                          << "======" << endl;
+
+        bslma::TestAllocator ma("model",   veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bsl::vector<Datum> values(&ma);
+        makeScalars(&values, &ma);
+        makeAggregates(&values, &ma);
+
+        if (verbose) cout << "\nDecode the root of each value." << endl;
+
+        for (bsl::size_t ti = 0; ti < values.size(); ++ti) {
+            const Datum& VALUE = values[ti];
+
+            if (veryVerbose) { T_ P_(ti) P(VALUE) }
+
+            bsl::vector<char> buffer(&ma);
+            ASSERTV(ti, 0 == Util::encode(&buffer, VALUE));
+
+            Datum mX = Datum::createInteger(-1);  const Datum& X = mX;
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERTV(ti, Datum::createInteger(-1) == X);
+
+                Util::decode(&mX, Obj(buffer.data()), &oa);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(ti, X, VALUE, isEqualSorted(X, VALUE));
+
+            bsl::fill(buffer.begin(), buffer.end(), '\xFF');
+
+            ASSERTV(ti, X, VALUE, isEqualSorted(X, VALUE));
+
+            Datum::destroy(mX, &oa);
+
+            ASSERTV(ti, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nDecode nodes other than the root." << endl;
+        {
+            bdld::DatumMaker m(&ma);
+
+            const Datum VALUE = m.a(m.a(1, "two"), "three", m.m("k", 4.0));
+
+            bsl::vector<char> buffer(&ma);
+            ASSERT(0 == Util::encode(&buffer, VALUE));
+
+            const Obj ROOT(buffer.data());
+            for (int i = 0; i < 3; ++i) {
+                Datum mX;  const Datum& X = mX;
+                Util::decode(&mX, ROOT.arrayElement(i), &oa);
+
+                ASSERTV(i, VALUE.theArray()[i] == X);
+
+                Datum::destroy(mX, &oa);
+            }
+
+            Datum::destroy(VALUE, &ma);
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        for (bsl::size_t ti = 0; ti < values.size(); ++ti) {
+            Datum::destroy(values[ti], &ma);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<char> buffer(&ma);
+            ASSERT(0 == Util::encode(&buffer, Datum::createInteger(1)));
+
+            const Obj ROOT(buffer.data());
+            Datum     mX;
+
+            Datum *const NULL_RESULT = 0;
+
+            ASSERT_PASS(Util::decode(&mX, ROOT, &oa));
+            ASSERT_FAIL(Util::decode(NULL_RESULT, ROOT, &oa));
+            ASSERT_FAIL(Util::decode(&mX, ROOT, 0));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // VALIDATE
+        //
+        // Concerns:
+        //: 1 Every flat datum produced by 'encode' is valid.
+        //:
+        //: 2 A buffer that is shorter or longer than the length recorded in
+        //:   its header, or whose header is otherwise malformed, is invalid.
+        //:
+        //: 3 A buffer whose nodes or keys do not lie entirely within the
+        //:   buffer is invalid.
+        //:
+        //: 4 A node having an unsupported type tag, or a payload that is not
+        //:   the encoding of a value of its type, is invalid.
+        //:
+        //: 5 A buffer having an offset that does not refer forward (and so
+        //:   could form a cycle), nesting deeper than 'k_MAX_DEPTH', or
+        //:   sharing nodes so as to require excessive work, is invalid.
+        //:
+        //: 6 A map flagged as sorted whose keys are out of order is invalid.
+        //:
+        //: 7 Arbitrary corruption of a flat datum never results in undefined
+        //:   behavior, and any corrupted buffer accepted by 'validate' can be
+        //:   read in full.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Encode a set of values, and verify that each is valid.  (C-1)
+        //:
+        //: 2 For each encoding, truncate it to every shorter length (updating
+        //:   the length in the header), and verify that it is invalid.  Note
+        //:   that every byte of an encoding is referred to by some node, so
+        //:   every truncation is invalid.  (C-2..3)
+        //:
+        //: 3 Corrupt each byte of the header, and verify that the buffer is
+        //:   invalid.  (C-2)
+        //:
+        //: 4 Using the table-driven technique, corrupt single fields of the
+        //:   encodings of specific values, and verify the result of
+        //:   'validate'.  (C-3..6)
+        //:
+        //: 5 Hand-craft a buffer whose array elements all refer to the same
+        //:   nested array, and verify that it is invalid.  Verify that a
+        //:   'Datum' nested 'k_MAX_DEPTH' deep is valid.  (C-5)
+        //:
+        //: 6 Flip each bit of the body of the encoding of a nested value, and
+        //:   verify that any buffer accepted by 'validate' can be decoded.
+        //:   (C-7)
+        //:
+        //: 7 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   int validate(const char *buffer, bsl::size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALIDATE" << endl
+                          << "========" << endl;
+
+        bslma::TestAllocator ma("model",  veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::vector<Datum> values(&ma);
+        makeScalars(&values, &ma);
+        makeAggregates(&values, &ma);
+
+        if (verbose) cout << "\nEncodings and their truncations." << endl;
+
+        for (bsl::size_t ti = 0; ti < values.size(); ++ti) {
+            bsl::vector<char> buffer(&ma);
+            ASSERTV(ti, 0 == Util::encode(&buffer, values[ti]));
+            ASSERTV(ti, 0 == validate(buffer));
+
+            for (bsl::size_t length = Imp::k_HEADER_SIZE;
+                                      length < buffer.size(); ++length) {
+                bsl::vector<char> truncated(buffer, &ma);
+                truncate(&truncated, length);
+                ASSERTV(ti, length, 0 != validate(truncated));
+            }
+
+            bsl::vector<char> extended(buffer, &ma);
+            extended.push_back(0);
+            ASSERTV(ti, 0 != validate(extended));
+            truncate(&extended, extended.size());
+            ASSERTV(ti, 0 != validate(extended));
+
+            for (bsl::size_t i = 0; i < Imp::k_HEADER_SIZE; ++i) {
+                bsl::vector<char> corrupted(buffer, &ma);
+                corrupted[i] = static_cast<char>(corrupted[i] ^ 0x10);
+                ASSERTV(ti, i, 0 != validate(corrupted));
+            }
+        }
+
+        if (verbose) cout << "\nCorrupted fields." << endl;
+        {
+            bdld::DatumMaker m(&ma);
+
+            // Positions below are relative to the root node at offset 16.
+
+            static const struct {
+                int         d_line;       // source line number
+                int         d_value;      // index into 'VALUES'
+                int         d_position;   // position of the corrupted byte
+                int         d_byte;       // replacement byte value
+                bool        d_isValid;    // expected result
+            } DATA[] = {
+                //LINE  VAL  POS   BYTE  VALID
+                //----  ---  ---  -----  -----
+                { L_,    0,   0,   0x00, true  },  // nil
+                { L_,    0,   0,   0x0B, false },  // user-defined
+                { L_,    0,   0,   0x10, false },  // int-map
+                { L_,    0,   0,   0x11, false },  // beyond last type
+                { L_,    0,   0,   0xFF, false },
+                { L_,    1,   1,   0x00, true  },  // boolean
+                { L_,    1,   1,   0x02, false },
+                { L_,    2,   3,   0x0C, true  },  // date month 12
+                { L_,    2,   3,   0x0D, false },  // date month 13
+                { L_,    2,   4,   0x00, false },  // date day 0
+                { L_,    2,   2,   0x28, false },  // date year 10240
+                { L_,    3,   1,   0x00, true  },  // time 24:00
+                { L_,    3,   1,   0x01, false },  // time > 24:00
+                { L_,    4,   5,   0x00, true  },  // datetime 24:00
+                { L_,    4,   1,   0x02, false },  // datetime 24:00, not 1/1/1
+                { L_,    5,   1,   0x00, true  },  // interval days -256
+                { L_,    5,   4,   0x00, false },  // interval sign mismatch
+                { L_,    5,  12,   0x00, false },  // interval micros >= 1 day
+                { L_,    6,   1,   0x05, true  },  // string length 5
+                { L_,    6,   1,   0x06, false },  // string past end
+                { L_,    6,   4,   0x01, false },  // string length huge
+                { L_,    7,   5,   0x00, true  },  // error message length 0
+                { L_,    7,   8,   0x01, false },  // message length huge
+                { L_,    8,   1,   0x01, false },  // array slot unreferenced
+                { L_,    8,   1,   0x03, false },  // array length too large
+                { L_,    8,   5,   0x10, false },  // element refers to array
+                { L_,    8,   5,   0x0F, false },  // element refers backward
+                { L_,    8,   5,   0x00, false },  // element refers to header
+                { L_,    8,   5,   0xFF, false },  // element past end
+                { L_,    9,   1,   0x00, true  },  // map unsorted
+                { L_,    9,   1,   0x02, false },  // map sorted flag 2
+                { L_,    9,   2,   0x03, false },  // map size too large
+                { L_,    9,   6,   0x10, false },  // key refers to map
+                { L_,    9,  10,   0x7F, false },  // key past end
+                { L_,    9,  14,   0x10, false },  // value refers to map
+                { L_,   10,   1,   0x01, false },  // sorted, keys out of order
+                { L_,    9,  36,   0x61, true  },  // sorted, keys "a", "a"
+                { L_,    9,  30,   0x63, false },  // sorted, keys "c", "b"
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            const Datum AB = m.m("a", 1, "b", 2);
+
+            const Datum VALUES[] = {
+                m(),                                                 //  0
+                m(true),                                             //  1
+                m(bdlt::Date(2018, 1, 31)),                          //  2
+                m(bdlt::Time()),                                     //  3
+                m(bdlt::Datetime(bdlt::Date(), bdlt::Time())),       //  4
+                m(bdlt::DatetimeInterval(-1, 0, 0, 0, 0, -1)),       //  5
+                m("abcde"),                                          //  6
+                m(bdld::DatumError(1, "")),                          //  7
+                m.a(1, 2),                                           //  8
+                makeSortedMap(AB, &ma),                              //  9
+                m.m("b", 1, "a", 2),                                 // 10
+            };
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int  LINE     = DATA[ti].d_line;
+                const int  VALUE    = DATA[ti].d_value;
+                const int  POSITION = DATA[ti].d_position;
+                const char BYTE     = static_cast<char>(DATA[ti].d_byte);
+                const bool IS_VALID = DATA[ti].d_isValid;
+
+                bsl::vector<char> buffer(&ma);
+                ASSERTV(LINE, 0 == Util::encode(&buffer, VALUES[VALUE]));
+                ASSERTV(LINE, 0 == validate(buffer));
+
+                buffer[Imp::k_HEADER_SIZE + POSITION] = BYTE;
+
+                ASSERTV(LINE, IS_VALID, IS_VALID == (0 == validate(buffer)));
+            }
+
+            for (bsl::size_t i = 0; i < sizeof VALUES / sizeof *VALUES; ++i) {
+                Datum::destroy(VALUES[i], &ma);
+            }
+            Datum::destroy(AB, &ma);
+        }
+
+        if (verbose) cout << "\nShared nodes and depth." << endl;
+        {
+            // Build, by hand, a buffer of 20 arrays in which each array has
+            // two elements, both referring to the next array.  The tree
+            // described by the buffer has more than a million nodes.
+
+            const int NUM_ARRAYS = 20;
+            const int ARRAY_SIZE = 1 + 4 + 2 * 4;
+
+            bsl::vector<char> buffer(Imp::k_HEADER_SIZE, '\0', &ma);
+            buffer[0] = 'B'; buffer[1] = 'D'; buffer[2] = 'F'; buffer[3] = 'D';
+            buffer[4] = 1;
+
+            for (int i = 0; i < NUM_ARRAYS; ++i) {
+                const bsl::size_t position = buffer.size();
+                const unsigned int next = static_cast<unsigned int>(
+                                                       position + ARRAY_SIZE);
+
+                buffer.resize(position + ARRAY_SIZE);
+                buffer[position] = static_cast<char>(Datum::e_ARRAY);
+                if (i + 1 < NUM_ARRAYS) {
+                    storeUint32(&buffer, position + 1, 2);
+                    storeUint32(&buffer, position + 5, next);
+                    storeUint32(&buffer, position + 9, next);
+                }
+                else {
+                    buffer.resize(position + 5);
+                    storeUint32(&buffer, position + 1, 0);
+                }
+            }
+            truncate(&buffer, buffer.size());
+
+            ASSERT(0 != validate(buffer));
+
+            // Make each array refer to the next array with only one element,
+            // leaving the second offset of each array unreferenced.
+
+            for (int i = 0; i + 1 < NUM_ARRAYS; ++i) {
+                storeUint32(&buffer, Imp::k_HEADER_SIZE + i * ARRAY_SIZE + 1,
+                            1);
+            }
+
+            ASSERT(0 != validate(buffer));
+
+            bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+            const Datum DEEPEST = makeNested(Util::k_MAX_DEPTH, &da);
+            ASSERT(0 == Util::encode(&buffer, DEEPEST));
+            ASSERT(0 == validate(buffer));
+
+            // Make the innermost array hold a single element referring to a
+            // further (empty) array.
+
+            const bsl::size_t position = buffer.size() - 5;
+            ASSERT(Datum::e_ARRAY == buffer[position]);
+            storeUint32(&buffer, position + 1, 1);
+            buffer.resize(buffer.size() + 4);
+            storeUint32(&buffer,
+                        position + 5,
+                        static_cast<unsigned int>(buffer.size()));
+            buffer.push_back(static_cast<char>(Datum::e_ARRAY));
+            buffer.resize(buffer.size() + 4);
+            truncate(&buffer, buffer.size());
+
+            ASSERT(0 != validate(buffer));
+
+            Datum::destroy(DEEPEST, &da);
+        }
+
+        if (verbose) cout << "\nBit flips." << endl;
+        {
+            bdld::DatumMaker m(&ma);
+
+            const Datum VALUE = m.a(m.m("key", "value", "k2", m.a(1, 2.5)),
+                                    bdlt::Datetime(2018, 1, 2, 3, 4, 5),
+                                    bdld::DatumError(3, "msg"));
+
+            bsl::vector<char> buffer(&ma);
+            ASSERT(0 == Util::encode(&buffer, VALUE));
+
+            int numValid = 0;
+            for (bsl::size_t i = Imp::k_HEADER_SIZE; i < buffer.size(); ++i) {
+                for (int bit = 0; bit < 8; ++bit) {
+                    bsl::vector<char> corrupted(buffer, &ma);
+                    corrupted[i] = static_cast<char>(corrupted[i]
+                                                               ^ (1 << bit));
+
+                    if (0 == validate(corrupted)) {
+                        ++numValid;
+
+                        Datum mX;
+                        Util::decode(&mX, Obj(corrupted.data()), &oa);
+                        Datum::destroy(mX, &oa);
+                    }
+                }
+            }
+
+            if (veryVerbose) { T_ P(numValid) }
+
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+            Datum::destroy(VALUE, &ma);
+        }
+
+        for (bsl::size_t ti = 0; ti < values.size(); ++ti) {
+            Datum::destroy(values[ti], &ma);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const char *const NULL_BUFFER = 0;
+
+            ASSERT_PASS(Util::validate(NULL_BUFFER, 0));
+            ASSERT_FAIL(Util::validate(NULL_BUFFER, 1));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // AGGREGATE ACCESSORS
+        //
+        // Concerns:
+        //: 1 'arrayLength' and 'arrayElement' provide access to the elements
+        //:   of an encoded array, in order.
+        //:
+        //: 2 'mapSize', 'isMapSorted', 'mapKey', and 'mapValue' provide access
+        //:   to the entries of an encoded map, in order.
+        //:
+        //: 3 'findMapValue' finds the first entry having a key, in both sorted
+        //:   and unsorted maps, including the empty key, and fails (with no
+        //:   effect on 'result') for a key that is absent.
+        //:
+        //: 4 The accessors do not allocate memory.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Encode each of a set of aggregate values, and verify (using the
+        //:   recursive 'isEqual' helper) that the encoded tree read through
+        //:   the accessors has the value of the original.  (C-1..2, 4)
+        //:
+        //: 2 For sorted and unsorted maps of various sizes, search for every
+        //:   key, and for keys that are absent (less than, between, and
+        //:   greater than the keys present).  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   SizeType arrayLength() const;
+        //   FlatDatumRef arrayElement(SizeType index) const;
+        //   SizeType mapSize() const;
+        //   bool isMapSorted() const;
+        //   bslstl::StringRef mapKey(SizeType index) const;
+        //   FlatDatumRef mapValue(SizeType index) const;
+        //   int findMapValue(FlatDatumRef *, const StringRef&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "AGGREGATE ACCESSORS" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator ma("model",   veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bsl::vector<Datum> values(&ma);
+        makeAggregates(&values, &ma);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nRead arrays and maps in place." << endl;
+
+        for (bsl::size_t ti = 0; ti < values.size(); ++ti) {
+            const Datum& VALUE = values[ti];
+
+            bsl::vector<char> buffer(&ma);
+            ASSERTV(ti, 0 == Util::encode(&buffer, VALUE));
+
+            const Obj X(buffer.data());
+            ASSERTV(ti, VALUE, isEqual(X, VALUE));
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\nFind map values." << endl;
+        {
+            static const char *const KEYS[] = {
+                "", "b", "d", "dd", "f", "h", "j", "l", "n", "p"
+            };
+            const int NUM_KEYS = static_cast<int>(sizeof KEYS / sizeof *KEYS);
+
+            static const char *const ABSENT[] = {
+                "a", "c", "d\0", "e", "o", "q", "zzz"
+            };
+            const int NUM_ABSENT =
+                             static_cast<int>(sizeof ABSENT / sizeof *ABSENT);
+
+            for (int size = 0; size <= NUM_KEYS; ++size) {
+                for (int sorted = 0; sorted < 2; ++sorted) {
+                    bdld::DatumMutableMapRef map;
+                    Datum::createUninitializedMap(&map, size, &ma);
+                    for (int i = 0; i < size; ++i) {
+                        // Store the keys in reverse order if unsorted.
+
+                        const int j = sorted ? i : size - 1 - i;
+                        map.data()[i] = bdld::DatumMapEntry(
+                                                    KEYS[j],
+                                                    Datum::createInteger(j));
+                    }
+                    *map.size()   = size;
+                    *map.sorted() = sorted;
+
+                    const Datum VALUE = Datum::adoptMap(map);
+
+                    bsl::vector<char> buffer(&ma);
+                    ASSERTV(size, 0 == Util::encode(&buffer, VALUE));
+
+                    const Obj X(buffer.data());
+                    ASSERTV(size, sorted, sorted == X.isMapSorted());
+
+                    for (int i = 0; i < size; ++i) {
+                        Obj result;
+                        ASSERTV(size, sorted, i,
+                                0 == X.findMapValue(&result, KEYS[i]));
+                        ASSERTV(size, sorted, i, i == result.theInteger());
+                    }
+
+                    for (int i = size; i < NUM_KEYS; ++i) {
+                        Obj result;
+                        ASSERTV(size, sorted, i,
+                                0 != X.findMapValue(&result, KEYS[i]));
+                        ASSERTV(size, sorted, i, Obj() == result);
+                    }
+
+                    for (int i = 0; i < NUM_ABSENT; ++i) {
+                        const bslstl::StringRef KEY(
+                                              ABSENT[i],
+                                              2 == i ? 2 : strlen(ABSENT[i]));
+                        Obj result;
+                        ASSERTV(size, sorted, i,
+                                0 != X.findMapValue(&result, KEY));
+                        ASSERTV(size, sorted, i, Obj() == result);
+                    }
+
+                    Datum::destroy(VALUE, &ma);
+                }
+            }
+
+            // 'findMapValue' finds the first of several entries having the
+            // same key.
+
+            bdld::DatumMaker m(&ma);
+
+            const Datum VALUE = m.m("k", 1, "k", 2, "j", 3);
+
+            bsl::vector<char> buffer(&ma);
+            ASSERT(0 == Util::encode(&buffer, VALUE));
+
+            const Obj X(buffer.data());
+            Obj       result;
+            ASSERT(0 == X.findMapValue(&result, "k"));
+            ASSERT(1 == result.theInteger());
+
+            Datum::destroy(VALUE, &ma);
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        for (bsl::size_t ti = 0; ti < values.size(); ++ti) {
+            Datum::destroy(values[ti], &ma);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdld::DatumMaker m(&ma);
+
+            const Datum VALUE = m.a(m.m("k", 1));
+
+            bsl::vector<char> buffer(&ma);
+            ASSERT(0 == Util::encode(&buffer, VALUE));
+
+            const Obj ARRAY(buffer.data());
+            const Obj MAP = ARRAY.arrayElement(0);
+
+            ASSERT_SAFE_PASS(ARRAY.arrayElement(0));
+            ASSERT_SAFE_FAIL(ARRAY.arrayElement(1));
+            ASSERT_SAFE_FAIL(MAP.arrayLength());
+
+            ASSERT_SAFE_PASS(MAP.mapKey(0));
+            ASSERT_SAFE_FAIL(MAP.mapKey(1));
+            ASSERT_SAFE_PASS(MAP.mapValue(0));
+            ASSERT_SAFE_FAIL(MAP.mapValue(1));
+            ASSERT_SAFE_FAIL(ARRAY.mapSize());
+
+            Obj        result;
+            Obj *const NULL_RESULT = 0;
+
+            ASSERT_PASS(MAP.findMapValue(&result, "k"));
+            ASSERT_FAIL(MAP.findMapValue(NULL_RESULT, "k"));
+
+            Datum::destroy(VALUE, &ma);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CREATORS AND SCALAR ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor creates a reference to no node, having a
+        //:   null 'encoding' and a zero 'offset'.
+        //:
+        //: 2 The single-argument constructor refers to the root node of the
+        //:   flat datum, and the two-argument constructor refers to the node
+        //:   at the specified offset.
+        //:
+        //: 3 Each scalar accessor returns the value of the encoded 'Datum',
+        //:   including boundary values, without allocating memory.
+        //:
+        //: 4 'operator==' and 'operator!=' compare the referenced nodes by
+        //:   address, not by value.
+        //:
+        //: 5 'FlatDatumRef' is trivially copyable.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Default construct an object and verify its attributes.  (C-1)
+        //:
+        //: 2 Encode each of a set of scalar values, and verify that the root
+        //:   node read through the accessors has the value of the original.
+        //:   (C-2..3)
+        //:
+        //: 3 Compare references to nodes of distinct buffers holding the same
+        //:   value, and to distinct nodes of the same buffer.  (C-4)
+        //:
+        //: 4 Verify the trait.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered when an accessor for the wrong type is called.  (C-6)
+        //
+        // Testing:
+        //   FlatDatumRef();
+        //   explicit FlatDatumRef(const char *encoding);
+        //   FlatDatumRef(const char *encoding, unsigned int offset);
+        //   Datum::DataType type() const;
+        //   const char *encoding() const;
+        //   unsigned int offset() const;
+        //   bool theBoolean() const;
+        //   int theInteger() const;
+        //   Int64 theInteger64() const;
+        //   double theDouble() const;
+        //   bdlt::Date theDate() const;
+        //   bdlt::Time theTime() const;
+        //   bdlt::Datetime theDatetime() const;
+        //   bdlt::DatetimeInterval theDatetimeInterval() const;
+        //   bdldfp::Decimal64 theDecimal64() const;
+        //   bslstl::StringRef theString() const;
+        //   DatumBinaryRef theBinary() const;
+        //   DatumError theError() const;
+        //   bool operator==(const FlatDatumRef&, const FlatDatumRef&);
+        //   bool operator!=(const FlatDatumRef&, const FlatDatumRef&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND SCALAR ACCESSORS" << endl
+                          << "=============================" << endl;
+
+        bslma::TestAllocator ma("model",   veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nDefault constructor." << endl;
+        {
+            const Obj X;
+            ASSERT(0 == X.encoding());
+            ASSERT(0 == X.offset());
+        }
+
+        bsl::vector<Datum> values(&ma);
+        makeScalars(&values, &ma);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nRead scalars in place." << endl;
+
+        for (bsl::size_t ti = 0; ti < values.size(); ++ti) {
+            const Datum& VALUE = values[ti];
+
+            if (veryVerbose) { T_ P_(ti) P(VALUE) }
+
+            bsl::vector<char> buffer(&ma);
+            ASSERTV(ti, 0 == Util::encode(&buffer, VALUE));
+
+            const Obj X(buffer.data());
+            ASSERTV(ti, buffer.data() == X.encoding());
+            ASSERTV(ti, Imp::k_HEADER_SIZE == X.offset());
+            ASSERTV(ti, VALUE, isEqual(X, VALUE));
+
+            const Obj Y(buffer.data(), Imp::k_HEADER_SIZE);
+            ASSERTV(ti, X == Y);
+            ASSERTV(ti, !(X != Y));
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\nEquality compares identity." << endl;
+        {
+            bdld::DatumMaker m(&ma);
+
+            const Datum VALUE = m.a(5, 5);
+
+            bsl::vector<char> buffer1(&ma);
+            bsl::vector<char> buffer2(&ma);
+            ASSERT(0 == Util::encode(&buffer1, VALUE));
+            ASSERT(0 == Util::encode(&buffer2, VALUE));
+
+            const Obj X(buffer1.data());
+            const Obj Y(buffer2.data());
+
+            ASSERT(X != Y);
+            ASSERT(!(X == Y));
+
+            ASSERT(X.arrayElement(0) != X.arrayElement(1));
+            ASSERT(X.arrayElement(0).theInteger()
+                                          == X.arrayElement(1).theInteger());
+            ASSERT(X.arrayElement(0) == Obj(buffer1.data(),
+                                            X.arrayElement(0).offset()));
+
+            Obj mZ;  const Obj& Z = mZ;
+            mZ = X;
+            ASSERT(X == Z);
+
+            Datum::destroy(VALUE, &ma);
+        }
+
+        if (verbose) cout << "\nTraits." << endl;
+
+        ASSERT(bsl::is_trivially_copyable<Obj>::value);
+
+        for (bsl::size_t ti = 0; ti < values.size(); ++ti) {
+            Datum::destroy(values[ti], &ma);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<char> buffer(&ma);
+            ASSERT(0 == Util::encode(&buffer, Datum::createInteger(5)));
+
+            const Obj X(buffer.data());
+
+            ASSERT_SAFE_PASS(X.theInteger());
+            ASSERT_SAFE_FAIL(X.theBoolean());
+            ASSERT_SAFE_FAIL(X.theInteger64());
+            ASSERT_SAFE_FAIL(X.theDouble());
+            ASSERT_SAFE_FAIL(X.theDate());
+            ASSERT_SAFE_FAIL(X.theTime());
+            ASSERT_SAFE_FAIL(X.theDatetime());
+            ASSERT_SAFE_FAIL(X.theDatetimeInterval());
+            ASSERT_SAFE_FAIL(X.theDecimal64());
+            ASSERT_SAFE_FAIL(X.theString());
+            ASSERT_SAFE_FAIL(X.theBinary());
+            ASSERT_SAFE_FAIL(X.theError());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ENCODE
+        //
+        // Concerns:
+        //: 1 'encode' writes the documented header, followed by the documented
+        //:   encoding of the root node.
+        //:
+        //: 2 'encode' replaces any previous contents of 'result'.
+        //:
+        //: 3 'encodedLength' returns the length of the encoding produced by
+        //:   'encode'.
+        //:
+        //: 4 'encode' fails for a 'Datum' holding or containing a user-defined
+        //:   value or an int-map, and for arrays and maps nested more than
+        //:   'k_MAX_DEPTH' deep.
+        //:
+        //: 5 The offsets of the elements of arrays and the keys and values of
+        //:   maps refer forward to their nodes.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Encode specific values, and compare the result with the expected
+        //:   bytes.  (C-1..2, 5)
+        //:
+        //: 2 For each of a set of scalar and aggregate values, verify that
+        //:   'encodedLength' returns the length of the encoding.  (C-3)
+        //:
+        //: 3 Attempt to encode unsupported values, and values nested to
+        //:   'k_MAX_DEPTH' and one more.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null arguments.  (C-6)
+        //
+        // Testing:
+        //   int encode(bsl::vector<char> *result, const Datum& datum);
+        //   bsl::size_t encodedLength(const Datum& datum);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ENCODE" << endl
+                          << "======" << endl;
+
+        bslma::TestAllocator ma("model", veryVeryVeryVerbose);
+
+        bdld::DatumMaker m(&ma);
+
+        if (verbose) cout << "\nExpected bytes." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                int         d_value;     // index into 'VALUES'
+                const char *d_bytes;     // expected encoding of the root node
+                int         d_length;    // length of 'd_bytes'
+            } DATA[] = {
+#define E(BYTES) BYTES, sizeof BYTES - 1
+                { L_, 0, E("\x00")                                          },
+                { L_, 1, E("\x04\x01")                                      },
+                { L_, 2, E("\x01\x04\x03\x02\x01")                          },
+                { L_, 3, E("\x0A\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF")          },
+                { L_, 4, E("\x02\x00\x00\x00\x00\x00\x00\xF0\x3F")          },
+                { L_, 5, E("\x06\xE2\x07\x02\x1C")                          },
+                { L_, 6, E("\x07\x01\x00\x00\x00\x00\x00\x00\x00")          },
+                { L_, 7, E("\x09\x00\x00\x00\x00"
+                           "\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF")              },
+                { L_, 8, E("\x03\x02\x00\x00\x00" "ab")                     },
+                { L_, 9, E("\x05\x07\x00\x00\x00\x01\x00\x00\x00" "e")      },
+                { L_,10, E("\x0C\x02\x00\x00\x00"
+                           "\x1D\x00\x00\x00\x1E\x00\x00\x00"
+                           "\x00" "\x04\x00")                               },
+                { L_,11, E("\x0D\x00\x01\x00\x00\x00"
+                           "\x22\x00\x00\x00\x01\x00\x00\x00"
+                           "\x23\x00\x00\x00" "k" "\x04\x00")               },
+#undef E
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            const Datum VALUES[] = {
+                m(),                                                 //  0
+                m(true),                                             //  1
+                m(0x01020304),                                       //  2
+                m(Int64(-1)),                                        //  3
+                m(1.0),                                              //  4
+                m(bdlt::Date(2018, 2, 28)),                          //  5
+                m(bdlt::Time(0, 0, 0, 0, 1)),                        //  6
+                m(bdlt::DatetimeInterval(0, 0, 0, 0, 0, -1)),        //  7
+                m("ab"),                                             //  8
+                m(bdld::DatumError(7, "e")),                         //  9
+                m.a(m(), false),                                     // 10
+                m.m("k", false),                                     // 11
+            };
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const Datum&      VALUE  = VALUES[DATA[ti].d_value];
+                const char *const BYTES  = DATA[ti].d_bytes;
+                const bsl::size_t LENGTH = DATA[ti].d_length;
+
+                if (veryVerbose) { T_ P_(LINE) P(VALUE) }
+
+                bsl::vector<char> buffer(100, 'x', &ma);
+                ASSERTV(LINE, 0 == Util::encode(&buffer, VALUE));
+
+                const bsl::size_t EXP_LENGTH = Imp::k_HEADER_SIZE + LENGTH;
+
+                ASSERTV(LINE, buffer.size(), EXP_LENGTH == buffer.size());
+                ASSERTV(LINE, EXP_LENGTH == Util::encodedLength(VALUE));
+
+                ASSERTV(LINE, 0 == bsl::memcmp(buffer.data(), "BDFD\1\0\0\0",
+                                               8));
+                ASSERTV(LINE,
+                        EXP_LENGTH == Imp::loadUint32(buffer.data() + 8));
+                ASSERTV(LINE, 0 == Imp::loadUint32(buffer.data() + 12));
+                ASSERTV(LINE, 0 == bsl::memcmp(buffer.data()
+                                                         + Imp::k_HEADER_SIZE,
+                                               BYTES,
+                                               LENGTH));
+            }
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                Datum::destroy(VALUES[i], &ma);
+            }
+        }
+
+        if (verbose) cout << "\n'encodedLength'." << endl;
+        {
+            bsl::vector<Datum> values(&ma);
+            makeScalars(&values, &ma);
+            makeAggregates(&values, &ma);
+
+            for (bsl::size_t ti = 0; ti < values.size(); ++ti) {
+                bsl::vector<char> buffer(&ma);
+                ASSERTV(ti, 0 == Util::encode(&buffer, values[ti]));
+                ASSERTV(ti, buffer.size() == Util::encodedLength(values[ti]));
+
+                Datum::destroy(values[ti], &ma);
+            }
+        }
+
+        if (verbose) cout << "\nUnsupported values." << endl;
+        {
+            int udt = 0;
+
+            bdld::DatumMutableIntMapRef intMap;
+            Datum::createUninitializedIntMap(&intMap, 0, &ma);
+
+            const Datum UDT     = Datum::createUdt(&udt, 1);
+            const Datum INT_MAP = Datum::adoptIntMap(intMap);
+            const Datum VALUES[] = {
+                UDT,
+                INT_MAP,
+                m.a(1, UDT),
+                m.m("k", m.a(INT_MAP)),
+            };
+
+            for (bsl::size_t ti = 0; ti < sizeof VALUES / sizeof *VALUES;
+                                                                        ++ti) {
+                bsl::vector<char> buffer(&ma);
+                ASSERTV(ti, 0 != Util::encode(&buffer, VALUES[ti]));
+            }
+
+            const Datum DEEPEST = makeNested(Util::k_MAX_DEPTH, &ma);
+            const Datum TOO_DEEP = m.a(DEEPEST);
+
+            bsl::vector<char> buffer(&ma);
+            ASSERT(0 == Util::encode(&buffer, DEEPEST));
+            ASSERT(0 != Util::encode(&buffer, TOO_DEEP));
+
+            const Datum TOO_DEEP_MAP = m.m("k", DEEPEST.clone(&ma));
+            ASSERT(0 != Util::encode(&buffer, TOO_DEEP_MAP));
+
+            for (bsl::size_t i = 2; i < sizeof VALUES / sizeof *VALUES; ++i) {
+                Datum::destroy(VALUES[i], &ma);
+            }
+            Datum::destroy(TOO_DEEP,     &ma);
+            Datum::destroy(TOO_DEEP_MAP, &ma);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<char> *const NULL_RESULT = 0;
+
+            bsl::vector<char> buffer(&ma);
+
+            ASSERT_PASS(Util::encode(&buffer, Datum::createNull()));
+            ASSERT_FAIL(Util::encode(NULL_RESULT, Datum::createNull()));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // LOAD PRIMITIVES
+        //
+        // Concerns:
+        //: 1 'loadUint32' and 'loadUint64' read little-endian integers at any
+        //:   alignment.
+        //
+        // Plan:
+        //: 1 Store byte patterns at every offset of an over-sized buffer, and
+        //:   verify the loaded values.  (C-1)
+        //
+        // Testing:
+        //   Uint64 loadUint64(const char *address);
+        //   unsigned int loadUint32(const char *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOAD PRIMITIVES" << endl
+                          << "===============" << endl;
+
+        const char BYTES[] = "\x01\x23\x45\x67\x89\xAB\xCD\xEF";
+
+        for (int offset = 0; offset < 8; ++offset) {
+            char buffer[16] = { 0 };
+            bsl::memcpy(buffer + offset, BYTES, 8);
+
+            ASSERTV(offset, 0x67452301u == Imp::loadUint32(buffer + offset));
+            ASSERTV(offset, 0xEFCDAB8967452301ull
+                                          == Imp::loadUint64(buffer + offset));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode a nested value, validate it, read it in place, and decode
+        //:   it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ma("model",  veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bdld::DatumMaker m(&ma);
+
+        const Datum VALUE = m.a(42,
+                                "hello",
+                                m.m("pi",   3.14,
+                                    "date", bdlt::Date(2018, 3, 4)));
+
+        bsl::vector<char> buffer(&ma);
+        ASSERT(0 == Util::encode(&buffer, VALUE));
+        ASSERT(0 == Util::validate(buffer.data(), buffer.size()));
+
+        const Obj X(buffer.data());
+        ASSERT(Datum::e_ARRAY == X.type());
+        ASSERT(3              == X.arrayLength());
+        ASSERT(42             == X.arrayElement(0).theInteger());
+        ASSERT("hello"        == X.arrayElement(1).theString());
+        ASSERT("date"         == X.arrayElement(2).mapKey(1));
+
+        Obj date;
+        ASSERT(0 == X.arrayElement(2).findMapValue(&date, "date"));
+        ASSERT(bdlt::Date(2018, 3, 4) == date.theDate());
+
+        Datum mY;  const Datum& Y = mY;
+        Util::decode(&mY, X, &oa);
+        ASSERT(VALUE == Y);
+
+        Datum::destroy(mY,    &oa);
+        Datum::destroy(VALUE, &ma);
+
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -92,6 +92,34 @@ ThreadPoolWaitNode::ThreadPoolWaitNode()
 }
 
 // PRIVATE MANIPULATORS
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+void ThreadPool::doEnqueueJob(const Job& job)
+{
+    // The queued 'Job' is created with the allocator of this pool (as it
+    // would be were 'd_queue' a queue of 'Job' objects), and then moved into
+    // an 'InplaceJob' without allocating.
+
+    d_queue.emplace_back(Job(bsl::allocator_arg,
+                             d_queue.get_allocator().mechanism(),
+                             job));
+    wakeThreadIfNeeded();
+}
+
+void ThreadPool::doEnqueueJob(bslmf::MovableRef<Job> job)
+{
+    d_queue.emplace_back(Job(bsl::allocator_arg,
+                             d_queue.get_allocator().mechanism(),
+                             bslmf::MovableRefUtil::move(job)));
+    wakeThreadIfNeeded();
+}
+
+void ThreadPool::doEnqueueJob(InplaceJob&& job)
+{
+    d_queue.push_back(bslmf::MovableRefUtil::move(job));
+    wakeThreadIfNeeded();
+}
+#else
 void ThreadPool::doEnqueueJob(const Job& job)
 {
     d_queue.push_back(job);
@@ -103,6 +131,31 @@ void ThreadPool::doEnqueueJob(bslmf::MovableRef<Job> job)
     d_queue.push_back(bslmf::MovableRefUtil::move(job));
     wakeThreadIfNeeded();
 }
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+int ThreadPool::enqueueInplaceJob(InplaceJob&& functor)
+{
+    if (!functor) {
+        // Abort here if the 'functor' is "unset".  This prevents a crash
+        // inside 'workerThread' (where the context of 'functor' would be
+        // lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    if (!d_enabled) {
+        return -1;                                                    // RETURN
+    }
+
+    doEnqueueJob(bslmf::MovableRefUtil::move(functor));
+
+    return startThreadIfNeeded();
+}
+#endif
 
 void ThreadPool::wakeThreadIfNeeded()
 {
@@ -217,7 +270,17 @@ int ThreadPool::startNewThread()
 void ThreadPool::workerThread()
 {
     ThreadPoolWaitNode waitNode;
-    Job functor;
+
+    // 'functor' uses the allocator of 'd_queue' so that jobs can be moved
+    // (rather than copied) out of the queue without allocating.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+    QueuedJob functor;
+#else
+    QueuedJob functor(bsl::allocator_arg,
+                      d_queue.get_allocator().mechanism());
+#endif
     while (1) {
         // The functor has to be cleared when we are *not* holding the lock
         // because it might have some objects bound with non-trivial
@@ -225,7 +288,7 @@ void ThreadPool::workerThread()
 
         bool functorWasSetFlag = false;
         if (functor) {
-            functor = Job();
+            functor = QueuedJob();
             functorWasSetFlag = true;
         }
 
@@ -310,7 +373,7 @@ void ThreadPool::workerThread()
                 }
             }
 
-            functor = d_queue.front();
+            functor = bslmf::MovableRefUtil::move(d_queue.front());
             d_queue.pop_front();
 
             // Although user-enqueued functors cannot be null, 'stop()' and
@@ -47,6 +47,13 @@ BSLS_IDENT("$Id: $")
 // or the passing of multiple user-defined arguments.  See the 'bdef' package
 // documentation for more on functors and their usage.
 //
+// When compiled with C++11 support, the pool queues jobs as
+// 'bsl::unique_function' objects (see 'bslstl_inplacefunction') large enough
+// to hold a 'bsl::function', and moves each job from the queue to the thread
+// that runs it.  A 'bsl::unique_function<void(), N>' (with 'N' no larger than
+// 'sizeof(Job)') may also be enqueued directly; its target, which need not be
+// copyable, is then moved into the queue without allocating memory.
+//
 // An application can tune the thread pool by adjusting the minimum and maximum
 // number of threads in the pool, and the maximum amount of time that
 // dynamically created threads can idle before being destroyed.  To avoid
@@ -354,6 +361,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_threadutil.h>
 
 #include <bsls_atomic.h>
+#include <bsls_compilerfeatures.h>
 
 #include <bslmf_functionpointertraits.h>
 #include <bslmf_movableref.h>
@@ -362,6 +370,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslma_allocator.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_deque.h>
 
 #if defined(BSLS_PLATFORM_OS_UNIX)
@@ -406,9 +415,26 @@ class ThreadPool {
     // TYPES
     typedef bsl::function<void()> Job;
 
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+    typedef bsl::unique_function<void(), sizeof(Job)> InplaceJob;
+        // 'InplaceJob' is the type in which pending jobs are queued.  It can
+        // hold a 'Job', or any other invocable object no larger than a 'Job',
+        // without allocating memory.
+#endif
+
   private:
+    // PRIVATE TYPES
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+    typedef InplaceJob QueuedJob;
+#else
+    typedef Job        QueuedJob;
+#endif
+
     // PRIVATE DATA
-    bsl::deque<Job>      d_queue;          // queue of pending jobs
+    bsl::deque<QueuedJob>
+                         d_queue;          // queue of pending jobs
 
     mutable bslmt::Mutex d_mutex;          // mutex used to control access to
                                            // this thread pool
@@ -479,10 +505,23 @@ class ThreadPool {
     // PRIVATE MANIPULATORS
     void doEnqueueJob(const Job& job);
     void doEnqueueJob(bslmf::MovableRef<Job> job);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+    void doEnqueueJob(InplaceJob&& job);
+#endif
         // Internal method used to push the specified 'job' onto 'd_queue' and
         // signal the next waiting thread if any.  Note that this method must
         // be called with 'd_mutex' locked.
 
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+    int enqueueInplaceJob(InplaceJob&& functor);
+        // Enqueue the specified 'functor' to be executed by the next
+        // available thread.  Return 0 if enqueued successfully, and a non-zero
+        // value if queuing is currently disabled.  The behavior is undefined
+        // unless 'functor' is not empty.
+#endif
+
     void wakeThreadIfNeeded();
         // Signal this thread and pop the current thread from the wait list.
 
@@ -550,6 +589,20 @@ class ThreadPool {
         // to the function by the processing thread.  Return 0 if enqueued
         // successfully, and a non-zero value if queuing is currently disabled.
 
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+    template <bsl::size_t CAPACITY>
+    int enqueueJob(bsl::unique_function<void(), CAPACITY>&& functor);
+        // Enqueue the specified 'functor' to be executed by the next
+        // available thread.  Return 0 if enqueued successfully, and a non-zero
+        // value if queuing is currently disabled.  The target of 'functor' is
+        // moved into the queue, and no memory is allocated to hold it.  The
+        // behavior is undefined unless 'functor' is not empty.  Note that
+        // compilation fails unless 'CAPACITY <= sizeof(Job)'; an
+        // 'inplace_function' can be passed after conversion to a
+        // 'unique_function'.
+#endif
+
     double resetPercentBusy();
         // Atomically report the percentage of wall time spent by each thread
         // of this thread pool executing jobs since the last reset time, and
@@ -639,6 +692,17 @@ int ThreadPool::enqueueJob(ThreadPoolJobFunc function, void *userData)
     return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
 }
 
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+template <bsl::size_t CAPACITY>
+inline
+int ThreadPool::enqueueJob(bsl::unique_function<void(), CAPACITY>&& functor)
+{
+    return enqueueInplaceJob(
+                           InplaceJob(bslmf::MovableRefUtil::move(functor)));
+}
+#endif
+
 // ACCESSORS
 
 inline
@@ -13,12 +13,15 @@
 
 #include <bslmt_configuration.h>
 
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_managedptr.h>
 #include <bslma_testallocator.h>
 
 #include <bdlf_bind.h>
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
 #include <bsls_timeinterval.h>
@@ -85,6 +88,7 @@ using namespace bsl;  // automatically added by script
 // [10] USAGE EXAMPLE
 // [11] USAGE EXAMPLE (Functor Interface)
 // [12] TESTING CPU consumption of an idle pool.
+// [15] int enqueueJob(bsl::unique_function<void(), CAPACITY>&&);
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -681,6 +685,52 @@ void CopyCountingFunctor::operator()()
 
 }  // close namespace case14
 
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+namespace case15 {
+                              // ===============
+                              // MoveOnlyCounter
+                              // ===============
+
+class MoveOnlyCounter {
+    // A move-only functor that increments a counter it does not own, and
+    // owns an integer allocated from a supplied allocator.
+
+  private:
+    // DATA
+    bsls::AtomicInt        *d_counter_p;  // counter to increment
+    bslma::ManagedPtr<int>  d_owned;      // owned resource
+
+  public:
+    // CREATORS
+    MoveOnlyCounter(bsls::AtomicInt *counter, bslma::Allocator *allocator)
+        // Create a 'MoveOnlyCounter' object that increments the specified
+        // 'counter', and owns an integer allocated from the specified
+        // 'allocator'.
+    : d_counter_p(counter)
+    , d_owned(new (*allocator) int(1), allocator)
+    {
+    }
+
+    MoveOnlyCounter(MoveOnlyCounter&& original)
+        // Create a 'MoveOnlyCounter' object having the counter and the owned
+        // integer of the specified 'original'.
+    : d_counter_p(original.d_counter_p)
+    , d_owned(bslmf::MovableRefUtil::move(original.d_owned))
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Increment the counter by the value of the owned integer.
+    {
+        d_counter_p->add(*d_owned);
+    }
+};
+
+}  // close namespace case15
+#endif
+
 // ============================================================================
 //                          CASE 8 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -817,6 +867,92 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0: // 0 is always the first test case
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING ENQUEUEING 'unique_function' JOBS
+        //
+        // Concerns:
+        //: 1 A 'bsl::unique_function' holding a move-only target, and a
+        //:   'bsl::inplace_function' converted to a 'unique_function', can be
+        //:   enqueued, and are run and then destroyed.
+        //:
+        //: 2 Neither those jobs nor a 'Job' is copied by the pool, and so no
+        //:   memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Block the single thread of a pool, enqueue jobs of each kind
+        //:   with a test allocator installed as the default, and verify,
+        //:   after draining the pool, the number of jobs run and that the
+        //:   default allocator was not used.  (C-1..2)
+        //
+        // Testing:
+        //   int enqueueJob(bsl::unique_function<void(), CAPACITY>&&);
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "TESTING ENQUEUEING 'unique_function' JOBS" << endl
+                 << "=========================================" << endl;
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+        enum {
+            MIN_THREADS    = 1,
+            MAX_THREADS    = 1,
+            IDLE_TIME      = 0
+        };
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        bsls::AtomicInt counter(0);
+        {
+            bslmt::Latch            latch(1);
+            bslmt::ThreadAttributes attributes;
+            Obj                     mX(attributes,
+                                       MIN_THREADS,
+                                       MAX_THREADS,
+                                       IDLE_TIME,
+                                       &testAllocator);
+            mX.start();
+
+            case14::OnceBlockingFunctor blocker(&latch);
+            ASSERT(0 == mX.enqueueJob(bsl::unique_function<void()>(blocker)));
+
+            ASSERT(0 == mX.enqueueJob(bsl::unique_function<void()>(
+                            case15::MoveOnlyCounter(&counter,
+                                                    &testAllocator))));
+
+            ASSERT(0 == mX.enqueueJob(Obj::InplaceJob(
+                            case15::MoveOnlyCounter(&counter,
+                                                    &testAllocator))));
+
+            bsl::inplace_function<void(), 32> inplace =
+                                                  [&counter]() { ++counter; };
+            ASSERT(0 == mX.enqueueJob(
+                    bsl::unique_function<void(), 32>(
+                                   bslmf::MovableRefUtil::move(inplace))));
+
+            int                         copies = 0;
+            case14::CopyCountingFunctor f(&copies);
+            const Obj::Job              job(bsl::allocator_arg_t(),
+                                            &testAllocator,
+                                            f);
+            copies = 0;
+            ASSERT(0 == mX.enqueueJob(job));
+
+            ASSERTV(mX.numPendingJobs(), 4 <= mX.numPendingJobs());
+
+            latch.arrive();
+            mX.drain();
+
+            ASSERTV(counter, 3 == counter);
+            ASSERTV(copies,  1 == copies);
+            ASSERTV(da.numAllocations(), 0 == da.numAllocations());
+        }
+        ASSERTV(testAllocator.numBlocksInUse(),
+                0 == testAllocator.numBlocksInUse());
+#endif
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING MOVING ENQUEUEJOB METHOD
@@ -315,20 +315,43 @@ int Calendar::getNextBusinessDay(Date        *nextBusinessDay,
 
     enum { e_SUCCESS = 0, e_FAILURE = 1 };
 
-    int offset = date - firstDate();
-    while (nth) {
-        offset = static_cast<int>(
-                                d_nonBusinessDays.find0AtMinIndex(offset + 1));
-        if (0 > offset) {
-            return e_FAILURE;                                         // RETURN
-        }
-        --nth;
+    // Business days are the clear bits of 'd_nonBusinessDays', so the 'nth'
+    // one is located directly by skipping whole words of the bit array.
+
+    const int offset = static_cast<int>(d_nonBusinessDays.find0AtNthMinIndex(
+                                                      nth,
+                                                      date + 1 - firstDate()));
+    if (0 > offset) {
+        return e_FAILURE;                                             // RETURN
     }
     *nextBusinessDay = firstDate() + offset;
 
     return e_SUCCESS;
 }
 
+int Calendar::getPreviousBusinessDay(Date        *previousBusinessDay,
+                                     const Date&  date,
+                                     int          nth) const
+{
+    BSLS_ASSERT(previousBusinessDay);
+    BSLS_ASSERT(Date(1, 1, 1) < date);
+    BSLS_ASSERT(isInRange(date - 1));
+    BSLS_ASSERT(0 < nth);
+
+    enum { e_SUCCESS = 0, e_FAILURE = 1 };
+
+    const int offset = static_cast<int>(d_nonBusinessDays.find0AtNthMaxIndex(
+                                                          nth,
+                                                          0,
+                                                          date - firstDate()));
+    if (0 > offset) {
+        return e_FAILURE;                                             // RETURN
+    }
+    *previousBusinessDay = firstDate() + offset;
+
+    return e_SUCCESS;
+}
+
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED  // BDE3.0
 
 // DEPRECATED METHODS
@@ -124,6 +124,8 @@ using namespace bsl;
 // [ 4] const Date& firstDate() const;
 // [28] int getNextBusinessDay(Date *nextBusinessDay, const Date& date);
 // [28] int getNextBusinessDay(Date *nBD, const Date& date, int nth);
+// [31] int getPreviousBusinessDay(Date *pBD, const Date& date);
+// [31] int getPreviousBusinessDay(Date *pBD, const Date& date, int nth);
 // [ 4] bdlt::Date holiday(int index) const;
 // [ 4] int holidayCode(const Date& date, int index) const;
 // [11] bool isBusinessDay(const Date& date) const;
@@ -181,7 +183,7 @@ using namespace bsl;
 // [ 8] void swap(Calendar& a, Calendar& b);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [31] USAGE EXAMPLE
+// [32] USAGE EXAMPLE
 // [ 3] CALENDAR& gg(CALENDAR *o, const char *s);
 // [ 3] int ggg(CALENDAR *obj, const char *spec, bool vF);
 // ============================================================================
@@ -1167,7 +1169,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 31: {
+      case 32: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1236,6 +1238,156 @@ int main(int argc, char *argv[])
                          MyCalendarUtil::modifiedFollowing(31, 7, 2015, cal2));
 //..
       } break;
+      case 31: {
+        // -------------------------------------------------------------------
+        // 'previousBusinessDay' ACCESSORS
+        //   Ensure both of these non-basic accessors properly interpret
+        //   object state.
+        //
+        // Concerns:
+        //: 1 Both of these non-basic accessors returns the expected value and
+        //:   correctly loads the supplied 'previousBusinessDay'.
+        //:
+        //: 2 Each non-basic accessor method is declared 'const'.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of 'const' objects created with the generator function,
+        //:   compute and store all business days for the calendar.
+        //:   Exhaustively verify the return value and loaded
+        //:   'previousBusinessDay' using the stored business days.  (C-1..2)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-3)
+        //
+        // Testing:
+        //   int getPreviousBusinessDay(Date *pBD, const Date& date);
+        //   int getPreviousBusinessDay(Date *pBD, const Date& date, int nth);
+        // -------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'previousBusinessDay' ACCESSORS" << endl
+                          << "===============================" << endl;
+
+        const char **SPECS = DEFAULT_SPECS;
+
+        for (int ti = 0; SPECS[ti]; ++ti) {
+            const char *const SPEC = SPECS[ti];
+
+            Obj mX;  const Obj& X = gg(&mX, SPEC);
+
+            if (0 < X.length()) {
+                bsl::vector<bdlt::Date> businessDay;
+
+                // Note that the below avoids incrementing
+                // 'bdlt::Date(9999, 12, 31)'.
+
+                for (bdlt::Date date = X.firstDate();
+                     date < X.lastDate();
+                     ++date) {
+                    if (X.isBusinessDay(date)) {
+                        businessDay.push_back(date);
+                    }
+                }
+                if (X.isBusinessDay(X.lastDate())) {
+                    businessDay.push_back(X.lastDate());
+                }
+
+                // 'numPrecedingBusinessDays' is the number of business days
+                // strictly before 'date'.  Note that the below avoids
+                // incrementing 'bdlt::Date(9999, 12, 31)'.
+
+                int numPrecedingBusinessDays = 0;
+
+                for (int offset = 0; offset < X.length(); ++offset) {
+                    const bdlt::Date prev = X.firstDate() + offset;
+
+                    if (bdlt::Date(9999, 12, 31) == prev) {
+                        break;
+                    }
+
+                    const bdlt::Date date = prev + 1;
+
+                    if (X.isBusinessDay(prev)) {
+                        ++numPrecedingBusinessDays;
+                    }
+
+                    bdlt::Date rv;
+
+                    if (0 < numPrecedingBusinessDays) {
+                        const bdlt::Date EXP =
+                                     businessDay[numPrecedingBusinessDays - 1];
+
+                        ASSERTV(ti,
+                                X,
+                                date,
+                                0 == X.getPreviousBusinessDay(&rv, date));
+                        ASSERTV(ti, date, EXP == rv);
+                    }
+                    else {
+                        ASSERTV(ti,
+                                X,
+                                date,
+                                0 != X.getPreviousBusinessDay(&rv, date));
+                    }
+
+                    for (int tj = 1; tj <= numPrecedingBusinessDays; ++tj) {
+                        const bdlt::Date EXP =
+                                    businessDay[numPrecedingBusinessDays - tj];
+
+                        ASSERTV(ti,
+                                X,
+                                date,
+                                tj,
+                                0 == X.getPreviousBusinessDay(&rv, date, tj));
+                        ASSERTV(ti, date, EXP == rv);
+                    }
+
+                    const bdlt::Date UNCHANGED = rv;
+
+                    ASSERTV(ti,
+                            X,
+                            date,
+                            0 != X.getPreviousBusinessDay(
+                                               &rv,
+                                               date,
+                                               numPrecedingBusinessDays + 1));
+                    ASSERTV(ti, date, UNCHANGED == rv);
+                }
+            }
+        }
+
+        // Negative testing.
+
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;  const Obj& X = gg(&mX, "@2014/1/1 30 14");
+
+            bdlt::Date date;
+
+            ASSERT_SAFE_FAIL(X.getPreviousBusinessDay(&date, X.firstDate()));
+            ASSERT_SAFE_PASS(X.getPreviousBusinessDay(&date,
+                                                      X.firstDate() + 1));
+            ASSERT_SAFE_PASS(X.getPreviousBusinessDay(&date,
+                                                      X.lastDate() + 1));
+            ASSERT_SAFE_FAIL(X.getPreviousBusinessDay(&date,
+                                                      X.lastDate() + 2));
+            ASSERT_SAFE_FAIL(X.getPreviousBusinessDay(&date,
+                                                      bdlt::Date(1, 1, 1)));
+            ASSERT_SAFE_FAIL(X.getPreviousBusinessDay(0, X.lastDate() + 1));
+
+            ASSERT_FAIL(X.getPreviousBusinessDay(&date, X.firstDate(), 1));
+            ASSERT_PASS(X.getPreviousBusinessDay(&date, X.firstDate() + 1, 1));
+            ASSERT_PASS(X.getPreviousBusinessDay(&date, X.lastDate() + 1, 1));
+            ASSERT_FAIL(X.getPreviousBusinessDay(&date, X.lastDate() + 2, 1));
+            ASSERT_FAIL(X.getPreviousBusinessDay(&date,
+                                                 bdlt::Date(1, 1, 1),
+                                                 1));
+            ASSERT_FAIL(X.getPreviousBusinessDay(&date, X.lastDate() + 1, 0));
+            ASSERT_FAIL(X.getPreviousBusinessDay(0, X.lastDate() + 1, 1));
+        }
+      } break;
       case 30: {
         // --------------------------------------------------------------------
         // TESTING: hashAppend
@@ -10,68 +10,125 @@ BSLS_IDENT_RCSID(bdlt_calendarutil_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace bdlt {
 
-                           // ===================
-                           // struct CalendarUtil
-                           // ===================
-
-int CalendarUtil::addBusinessDaysIfValid(
-                                        bdlt::Date            *result,
-                                        const bdlt::Date&      original,
-                                        const bdlt::Calendar&  calendar,
-                                        int                    numBusinessDays)
+namespace {
+
+int shiftBusinessDays(bdlt::Date            *result,
+                      const bdlt::Date&      original,
+                      const bdlt::Calendar&  calendar,
+                      bool                   isForward,
+                      unsigned int           numBusinessDays)
+    // Load, into the specified 'result', the date that is the specified
+    // 'numBusinessDays' business days after (if the specified 'isForward' is
+    // 'true') or before (otherwise) the specified 'original' date according to
+    // the specified 'calendar'.  If '0 == numBusinessDays', load 'original' if
+    // it is a business day, and the nearest business day after (if
+    // 'isForward') or before (otherwise) 'original' if it is not.  Return 0 on
+    // success, and a non-zero value, without modifying '*result', if either
+    // 'original' or the resulting date is not within the valid range of
+    // 'calendar'.
 {
-    BSLS_ASSERT(result);
-
     enum { e_SUCCESS = 0, e_OUT_OF_RANGE = 1 };
 
     if (!calendar.isInRange(original)) {
         return e_OUT_OF_RANGE;                                        // RETURN
     }
 
-    unsigned int absNumBusDays = numBusinessDays >= 0
-                               ? numBusinessDays
-                               : -numBusinessDays;
-
-    // declare forward and reverse iterators
+    if (0 == numBusinessDays) {
+        if (calendar.isBusinessDay(original)) {
+            *result = original;
+            return e_SUCCESS;                                         // RETURN
+        }
+        numBusinessDays = 1;
+    }
 
-    unsigned int count = calendar.isBusinessDay(original) ? 0 : 1;
+    // There cannot be more business days in the valid range than there are
+    // days, which also keeps the 'nth' argument below representable as 'int'.
 
-    if (numBusinessDays < 0) {
-        // an iterator to the business day on or before original
+    if (numBusinessDays > static_cast<unsigned int>(calendar.length())) {
+        return e_OUT_OF_RANGE;                                        // RETURN
+    }
 
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                         calendar.rbeginBusinessDays(original);
+    // The 'nth' business day is located by the calendar with a population
+    // count over whole words of its non-business day bit array, rather than
+    // by stepping a business day iterator one day at a time.
 
-        while (rit != calendar.rendBusinessDays() && count < absNumBusDays) {
-            ++rit;
-            ++count;
-        }
+    const int nth = static_cast<int>(numBusinessDays);
 
-        if (rit == calendar.rendBusinessDays()) {
+    if (isForward) {
+        if (calendar.lastDate() == original) {
             return e_OUT_OF_RANGE;                                    // RETURN
         }
+        return calendar.getNextBusinessDay(result, original, nth)
+               ? e_OUT_OF_RANGE
+               : e_SUCCESS;                                           // RETURN
+    }
 
-        *result = *rit;
+    if (calendar.firstDate() == original) {
+        return e_OUT_OF_RANGE;                                        // RETURN
     }
-    else {
-        // an iterator to the business day on or after 'original'
+    return calendar.getPreviousBusinessDay(result, original, nth)
+           ? e_OUT_OF_RANGE
+           : e_SUCCESS;
+}
 
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                          calendar.beginBusinessDays(original);
+}  // close unnamed namespace
 
-        while (fit != calendar.endBusinessDays() && count < absNumBusDays) {
-            ++fit;
-            ++count;
-        }
+                           // ===================
+                           // struct CalendarUtil
+                           // ===================
 
-        if (fit == calendar.endBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
+int CalendarUtil::addBusinessDaysIfValid(
+                                        bdlt::Date            *result,
+                                        const bdlt::Date&      original,
+                                        const bdlt::Calendar&  calendar,
+                                        int                    numBusinessDays)
+{
+    BSLS_ASSERT(result);
 
-        *result = *fit;
+    // Note that the negation is performed on an 'unsigned int' so that
+    // 'INT_MIN' is handled.
+
+    const unsigned int absNumBusDays =
+                                   numBusinessDays >= 0
+                                   ? static_cast<unsigned int>(numBusinessDays)
+                                   : 0u - numBusinessDays;
+
+    return shiftBusinessDays(result,
+                             original,
+                             calendar,
+                             numBusinessDays >= 0,
+                             absNumBusDays);
+}
+
+int CalendarUtil::addBusinessDaysIfValid(
+                                        bdlt::Date            *results,
+                                        const bdlt::Date      *originals,
+                                        bsl::size_t            numDates,
+                                        const bdlt::Calendar&  calendar,
+                                        int                    numBusinessDays)
+{
+    BSLS_ASSERT(results   || 0 == numDates);
+    BSLS_ASSERT(originals || 0 == numDates);
+
+    const unsigned int absNumBusDays =
+                                   numBusinessDays >= 0
+                                   ? static_cast<unsigned int>(numBusinessDays)
+                                   : 0u - numBusinessDays;
+    const bool         isForward     = numBusinessDays >= 0;
+
+    int numFailures = 0;
+
+    for (bsl::size_t i = 0; i < numDates; ++i) {
+        if (shiftBusinessDays(results + i,
+                              originals[i],
+                              calendar,
+                              isForward,
+                              absNumBusDays)) {
+            ++numFailures;
+        }
     }
 
-    return e_SUCCESS;
+    return numFailures;
 }
 
 int CalendarUtil::nthBusinessDayOfMonthOrMaxIfValid(
@@ -350,56 +407,16 @@ int CalendarUtil::subtractBusinessDaysIfValid(
 {
     BSLS_ASSERT(result);
 
-    enum { e_SUCCESS = 0, e_OUT_OF_RANGE = 1 };
-
-    if (!calendar.isInRange(original)) {
-        return e_OUT_OF_RANGE;                                        // RETURN
-    }
-
-    unsigned int absNumBusDays = numBusinessDays >= 0
-                               ? numBusinessDays
-                               : -numBusinessDays;
-
-    // declare forward and reverse iterators
-
-    unsigned int count = calendar.isBusinessDay(original) ? 0 : 1;
-
-    if (numBusinessDays >= 0) {
-        // an iterator to the business day on or before original
-
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                         calendar.rbeginBusinessDays(original);
-
-        while (rit != calendar.rendBusinessDays() && count < absNumBusDays) {
-            ++rit;
-            ++count;
-        }
-
-        if (rit == calendar.rendBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
-
-        *result = *rit;
-    }
-    else {
-        // an iterator to the business day on or after 'original'
-
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                          calendar.beginBusinessDays(original);
+    const unsigned int absNumBusDays =
+                                   numBusinessDays >= 0
+                                   ? static_cast<unsigned int>(numBusinessDays)
+                                   : 0u - numBusinessDays;
 
-        while (fit != calendar.endBusinessDays() && count < absNumBusDays) {
-            ++fit;
-            ++count;
-        }
-
-        if (fit == calendar.endBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
-
-        *result = *fit;
-    }
-
-    return e_SUCCESS;
+    return shiftBusinessDays(result,
+                             original,
+                             calendar,
+                             numBusinessDays < 0,
+                             absNumBusDays);
 }
 
 }  // close package namespace
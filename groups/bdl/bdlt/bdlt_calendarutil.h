@@ -19,7 +19,8 @@ BSLS_IDENT("$Id: $")
 // This utility component provides the following (static) methods:
 //..
 //  'addBusinessDaysIfValid'   Add an integral number of business days to the
-//                             specified original date within the valid range
+//                             specified original date (or to each of an
+//                             array of original dates) within the valid range
 //                             of the specified calendar.
 //
 //  'nthBusinessDayOfMonthOrMaxIfValid'
@@ -121,6 +122,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #include <bsls_review.h>
 
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 namespace bdlt {
 
@@ -171,6 +174,26 @@ struct CalendarUtil {
         // identical to the result of
         // 'subtractBusinessDaysIfValid(res, orig, cal, -numBusinessDays)'.
 
+    static int addBusinessDaysIfValid(bdlt::Date            *results,
+                                      const bdlt::Date      *originals,
+                                      bsl::size_t            numDates,
+                                      const bdlt::Calendar&  calendar,
+                                      int                    numBusinessDays);
+        // Load, into each element of the specified 'results' array, the date
+        // that is the specified 'numBusinessDays' chronologically after the
+        // corresponding element of the specified 'originals' array, having
+        // the specified 'numDates' elements, according to the specified
+        // 'calendar', as if by calling
+        // 'addBusinessDaysIfValid(&results[i], originals[i], calendar,
+        // numBusinessDays)' for each 'i' in '[0 .. numDates)'.  Return the
+        // number of elements for which either the original date or the
+        // resulting date is not within the valid range of 'calendar' (the
+        // corresponding element of 'results' is left unmodified), so that 0 is
+        // returned if every date was successfully computed.  The behavior is
+        // undefined unless 'results' and 'originals' each refer to an array
+        // of at least 'numDates' elements.  Note that 'results' and
+        // 'originals' may refer to the same array.
+
     static int nthBusinessDayOfMonthOrMaxIfValid(
                                                bdlt::Date            *result,
                                                const bdlt::Calendar&  calendar,
@@ -14,11 +14,15 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_types.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_set.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace BloombergLP::bdlt;
@@ -35,6 +39,7 @@ using namespace bsl;
 // 'CalendarUtil' may be used.
 //-----------------------------------------------------------------------------
 // [ 9] int addBusinessDaysIfValid(bdlt::Date *result, orig, cdr, num);
+// [10] int addBusinessDaysIfValid(Date *res, orig, numDates, cdr, num);
 // [ 8] int nthBusinessDayOfMonthOrMaxIfValid(res, cal, year, month, n);
 // [ 7] shiftIfValid(bdlt::Date *result, orig, calendar, convention)
 // [ 7] shiftIfValid(res, orig, cdr, conv, specDay, extSpecDay, specConv)
@@ -44,7 +49,7 @@ using namespace bsl;
 // [ 6] shiftPrecedingIfValid(bdlt::Date *result, orig, calendar)
 // [ 9] int subtractBusinessDaysIfValid(bdlt::Date *result, orig, cdr, num);
 //-----------------------------------------------------------------------------
-// [10] USAGE EXAMPLE
+// [11] USAGE EXAMPLE
 // [ 1] parseCalendar(const char *, const bdlt::Date&)
 // [ 2] getStartDate(const char *)
 //-----------------------------------------------------------------------------
@@ -231,6 +236,50 @@ int getStartDate(const char *input)
     return 999;
 }
 
+int addBusinessDaysOracle(bdlt::Date            *result,
+                          const bdlt::Date&      original,
+                          const bdlt::Calendar&  calendar,
+                          int                    numBusinessDays)
+    // Load, into the specified 'result', the date that is the specified
+    // 'numBusinessDays' chronologically after the specified 'original' date
+    // according to the specified 'calendar', as documented for
+    // 'CalendarUtil::addBusinessDaysIfValid'.  Return 0 on success, and a
+    // non-zero value, without modifying '*result', otherwise.  Note that this
+    // function provides an inefficient but reliable implementation, stepping
+    // through the calendar one day at a time, for testing.
+{
+    if (!calendar.isInRange(original)) {
+        return 1;                                                     // RETURN
+    }
+
+    if (0 == numBusinessDays && calendar.isBusinessDay(original)) {
+        *result = original;
+        return 0;                                                     // RETURN
+    }
+
+    const int step = numBusinessDays >= 0 ? 1 : -1;
+    typedef bsls::Types::Int64 Int64;
+
+    Int64 remaining = numBusinessDays >= 0
+                      ? bsl::max(numBusinessDays, 1)
+                      : -static_cast<Int64>(numBusinessDays);
+
+    bdlt::Date date = original;
+    while (0 < remaining) {
+        if ((1 == step && calendar.lastDate() == date)
+         || (-1 == step && calendar.firstDate() == date)) {
+            return 1;                                                 // RETURN
+        }
+        date += step;
+        if (calendar.isBusinessDay(date)) {
+            --remaining;
+        }
+    }
+
+    *result = date;
+    return 0;
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -248,7 +297,7 @@ int main(int argc, char *argv[])
 
     switch (test) {
       case 0:
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -315,6 +364,140 @@ int main(int argc, char *argv[])
     ASSERT(expected == result);
 //..
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'addBusinessDaysIfValid'
+        //   Ensure that the batch function loads the same results as the
+        //   single-date function and returns the number of failures.
+        //
+        // Concerns:
+        //: 1 Each element of 'results' is loaded with the value the
+        //:   single-date 'addBusinessDaysIfValid' would load, and elements for
+        //:   which that function fails are left unmodified.
+        //:
+        //: 2 The return value is the number of failed elements.
+        //:
+        //: 3 'results' and 'originals' may refer to the same array.
+        //:
+        //: 4 'numDates == 0' is supported with null arrays.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Populate an array with every date in, and one date either side
+        //:   of, the valid range of a calendar, and for a set of
+        //:   'numBusinessDays' values compare the batch results to the
+        //:   single-date results.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 with the input array used as the output.  (C-3)
+        //:
+        //: 3 Call the function with 'numDates == 0' and null arrays.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-5)
+        //
+        // Testing:
+        //   int addBusinessDaysIfValid(Date *res, orig, numDates, cdr, num);
+        // --------------------------------------------------------------------
+
+        if (verbose) {
+            cout << endl
+                 << "TESTING BATCH 'addBusinessDaysIfValid'" << endl
+                 << "======================================" << endl;
+        }
+
+        bdlt::Calendar calendar(bdlt::Date(2018, 1, 1),
+                                bdlt::Date(2018, 12, 31));
+        calendar.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+        calendar.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+        calendar.addHoliday(bdlt::Date(2018,  1,  1));
+        calendar.addHoliday(bdlt::Date(2018,  7,  4));
+        calendar.addHoliday(bdlt::Date(2018, 12, 25));
+
+        bsl::vector<bdlt::Date> originals;
+        for (bdlt::Date date = calendar.firstDate() - 1;
+             date <= calendar.lastDate() + 1;
+             ++date) {
+            originals.push_back(date);
+        }
+        const bsl::size_t NUM_DATES = originals.size();
+
+        const int NUM_DAYS[] = { -300, -22, -1, 0, 1, 5, 22, 300 };
+        const int NUM_NUM_DAYS = sizeof NUM_DAYS / sizeof *NUM_DAYS;
+
+        for (int ti = 0; ti < NUM_NUM_DAYS; ++ti) {
+            const int NUM = NUM_DAYS[ti];
+
+            if (veryVerbose) { T_ P(NUM) }
+
+            const bdlt::Date        INITIAL(1, 1, 1);
+            bsl::vector<bdlt::Date> exp(NUM_DATES, INITIAL);
+            int                     expFailures = 0;
+
+            for (bsl::size_t i = 0; i < NUM_DATES; ++i) {
+                if (Util::addBusinessDaysIfValid(&exp[i],
+                                                 originals[i],
+                                                 calendar,
+                                                 NUM)) {
+                    ++expFailures;
+                }
+            }
+            ASSERTV(NUM, expFailures, 0 < expFailures);
+
+            bsl::vector<bdlt::Date> results(NUM_DATES, INITIAL);
+
+            const int rc = Util::addBusinessDaysIfValid(results.data(),
+                                                        originals.data(),
+                                                        NUM_DATES,
+                                                        calendar,
+                                                        NUM);
+            ASSERTV(NUM, expFailures, rc, expFailures == rc);
+            ASSERTV(NUM, exp == results);
+
+            // In place.  Failed elements retain the original date.
+
+            bsl::vector<bdlt::Date> inPlace(originals);
+
+            const int rc2 = Util::addBusinessDaysIfValid(inPlace.data(),
+                                                         inPlace.data(),
+                                                         NUM_DATES,
+                                                         calendar,
+                                                         NUM);
+            ASSERTV(NUM, expFailures, rc2, expFailures == rc2);
+
+            for (bsl::size_t i = 0; i < NUM_DATES; ++i) {
+                const bdlt::Date EXP = INITIAL == exp[i] ? originals[i]
+                                                         : exp[i];
+                ASSERTV(NUM, i, EXP, inPlace[i], EXP == inPlace[i]);
+            }
+        }
+
+        ASSERT(0 == Util::addBusinessDaysIfValid(0, 0, 0, calendar, 5));
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlt::Date date;
+            bdlt::Date result;
+
+            ASSERT_PASS(Util::addBusinessDaysIfValid(&result,
+                                                     &date,
+                                                     1,
+                                                     calendar,
+                                                     0));
+            ASSERT_FAIL(Util::addBusinessDaysIfValid(0,
+                                                     &date,
+                                                     1,
+                                                     calendar,
+                                                     0));
+            ASSERT_FAIL(Util::addBusinessDaysIfValid(&result,
+                                                     0,
+                                                     1,
+                                                     calendar,
+                                                     0));
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING '(add|subtract)BusinessDaysIfValid'
@@ -510,6 +693,74 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (verbose) cout << "\nExhaustive comparison to oracle." << endl;
+        {
+            // Calendars spanning several 64-bit words of the underlying bit
+            // array, with runs of non-business days of varying length.
+
+            const int NUM_DAYS[] = { -300, -70, -64, -63, -5, -2, -1, 0,
+                                     1, 2, 5, 63, 64, 65, 130, 300,
+                                     INT_MAX, INT_MIN };
+            const int NUM_NUM_DAYS = sizeof NUM_DAYS / sizeof *NUM_DAYS;
+
+            for (int ti = 0; ti < 4; ++ti) {
+                bdlt::Calendar calendar(bdlt::Date(2000, 1, 1),
+                                        bdlt::Date(2000, 9, 30));
+                if (1 <= ti) {
+                    calendar.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+                    calendar.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+                }
+                if (2 <= ti) {
+                    for (bdlt::Date d(2000, 3, 1);
+                         d < bdlt::Date(2000, 5, 15);
+                         ++d) {
+                        calendar.addHoliday(d);
+                    }
+                }
+                if (3 <= ti) {
+                    calendar.addHoliday(calendar.firstDate());
+                    calendar.addHoliday(calendar.lastDate());
+                }
+
+                for (bdlt::Date date = calendar.firstDate() - 1;
+                     date <= calendar.lastDate() + 1;
+                     ++date) {
+                    for (int tj = 0; tj < NUM_NUM_DAYS; ++tj) {
+                        const int NUM = NUM_DAYS[tj];
+
+                        bdlt::Date exp(1, 1, 1);
+                        const int  EXP_RC = addBusinessDaysOracle(&exp,
+                                                                  date,
+                                                                  calendar,
+                                                                  NUM);
+
+                        bdlt::Date result(1, 1, 1);
+                        const int  rc = Util::addBusinessDaysIfValid(&result,
+                                                                     date,
+                                                                     calendar,
+                                                                     NUM);
+
+                        ASSERTV(ti, date, NUM, EXP_RC, rc,
+                                (0 == EXP_RC) == (0 == rc));
+                        ASSERTV(ti, date, NUM, exp, result, exp == result);
+
+                        if (0 != NUM && INT_MIN != NUM) {
+                            bdlt::Date result2(1, 1, 1);
+                            const int  rc2 = Util::subtractBusinessDaysIfValid(
+                                                                      &result2,
+                                                                      date,
+                                                                      calendar,
+                                                                      -NUM);
+
+                            ASSERTV(ti, date, NUM, rc, rc2, rc == rc2);
+                            ASSERTV(ti, date, NUM, result, result2,
+                                    result == result2);
+                        }
+                    }
+                }
+            }
+        }
+
         // negative tests
         if (verbose) cout << "\nNegative Testing." << endl;
         {
@@ -0,0 +1,398 @@
+// bdlt_calendarview.cpp                                              -*-C++-*-
+#include <bdlt_calendarview.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlt_calendarview_cpp,"$Id$ $CSID$")
+
+#include <bdlt_dayofweekset.h>
+#include <bdlt_packedcalendar.h>
+
+#include <bsls_alignmentutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_ios.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlt {
+namespace {
+
+// The layout of the 32-byte header of a calendar image.  All multi-byte
+// fields are stored in native byte order.
+
+const char          k_MAGIC[4]            = { 'B', 'D', 'C', 'V' };
+const bsl::uint16_t k_BYTE_ORDER_MARK     = 0xFEFF;
+const unsigned char k_VERSION             = 1;
+
+const bsl::size_t   k_MAGIC_OFFSET        =  0;
+const bsl::size_t   k_BOM_OFFSET          =  4;
+const bsl::size_t   k_VERSION_OFFSET      =  6;
+const bsl::size_t   k_FIRST_DATE_OFFSET   =  8;
+const bsl::size_t   k_LENGTH_OFFSET       = 12;
+const bsl::size_t   k_NUM_HOLIDAYS_OFFSET = 16;
+const bsl::size_t   k_NUM_NON_BUS_OFFSET  = 20;
+const bsl::size_t   k_NUM_TRANS_OFFSET    = 24;
+const bsl::size_t   k_HEADER_SIZE         = 32;
+
+const bsl::size_t   k_TRANSITION_SIZE     =  8;  // 'int32' offset and mask
+const bsl::size_t   k_BITS_PER_WORD       = 64;
+
+const int           k_VALID_MASK_BITS     = 0xFE;  // bits '1 .. 7'
+
+int maxDateOffset()
+    // Return the offset of the maximum valid 'Date' from the minimum valid
+    // 'Date'.
+{
+    return Date(9999, 12, 31) - Date(1, 1, 1);
+}
+
+bsl::size_t numWords(int length)
+    // Return the number of 64-bit words required to hold a bit string having
+    // the specified 'length'.
+{
+    return (static_cast<bsl::size_t>(length) + k_BITS_PER_WORD - 1)
+                                                             / k_BITS_PER_WORD;
+}
+
+bsl::size_t computeImageSize(int length, int numTransitions)
+    // Return the size of a calendar image having the specified 'length' and
+    // the specified 'numTransitions' weekend-days transitions.
+{
+    return k_HEADER_SIZE
+         + k_TRANSITION_SIZE * static_cast<bsl::size_t>(numTransitions)
+         + 2 * sizeof(bsl::uint64_t) * numWords(length);
+}
+
+int readInt32(const char *image, bsl::size_t offset)
+    // Return the 32-bit integer stored at the specified 'offset' in the
+    // specified 'image'.
+{
+    bsl::int32_t value;
+    bsl::memcpy(&value, image + offset, sizeof value);
+    return value;
+}
+
+void writeInt32(char *image, bsl::size_t offset, int value)
+    // Store the specified 'value' as a 32-bit integer at the specified
+    // 'offset' in the specified 'image'.
+{
+    const bsl::int32_t v = value;
+    bsl::memcpy(image + offset, &v, sizeof v);
+}
+
+int weekendDaysMask(const DayOfWeekSet& weekendDays)
+    // Return the bit mask corresponding to the specified 'weekendDays', in
+    // which bit 'd' is set if the day of the week having the enumerated value
+    // 'd' is a member of 'weekendDays'.
+{
+    int mask = 0;
+    for (int d = DayOfWeek::e_SUN; d <= DayOfWeek::e_SAT; ++d) {
+        if (weekendDays.isMember(static_cast<DayOfWeek::Enum>(d))) {
+            mask |= 1 << d;
+        }
+    }
+    return mask;
+}
+
+}  // close unnamed namespace
+
+                            // ------------------
+                            // class CalendarView
+                            // ------------------
+
+// MANIPULATORS
+int CalendarView::load(const void *image, bsl::size_t numBytes)
+{
+    enum { e_SUCCESS = 0, e_FAILURE = 1 };
+
+    BSLS_ASSERT(image || 0 == numBytes);
+
+    if (numBytes < k_HEADER_SIZE
+     || !bsls::AlignmentUtil::is8ByteAligned(image)) {
+        return e_FAILURE;                                             // RETURN
+    }
+
+    const char *data = static_cast<const char *>(image);
+
+    bsl::uint16_t bom;
+    bsl::memcpy(&bom, data + k_BOM_OFFSET, sizeof bom);
+
+    if (0 != bsl::memcmp(data + k_MAGIC_OFFSET, k_MAGIC, sizeof k_MAGIC)
+     || k_BYTE_ORDER_MARK != bom
+     || k_VERSION != static_cast<unsigned char>(data[k_VERSION_OFFSET])) {
+        return e_FAILURE;                                             // RETURN
+    }
+
+    const int firstOffset        = readInt32(data, k_FIRST_DATE_OFFSET);
+    const int length             = readInt32(data, k_LENGTH_OFFSET);
+    const int numHolidays        = readInt32(data, k_NUM_HOLIDAYS_OFFSET);
+    const int numNonBusinessDays = readInt32(data, k_NUM_NON_BUS_OFFSET);
+    const int numTransitions     = readInt32(data, k_NUM_TRANS_OFFSET);
+
+    if (firstOffset < 0
+     || length      < 0
+     || length      > maxDateOffset() + 1
+     || firstOffset > maxDateOffset() + 1 - length
+     || numHolidays < 0
+     || numHolidays > length
+     || numNonBusinessDays < numHolidays
+     || numNonBusinessDays > length
+     || numTransitions < 0
+     || numTransitions > maxDateOffset() + 1
+     || numBytes != computeImageSize(length, numTransitions)) {
+        return e_FAILURE;                                             // RETURN
+    }
+
+    const bsl::int32_t *transitions =
+                  reinterpret_cast<const bsl::int32_t *>(data + k_HEADER_SIZE);
+
+    for (int i = 0; i < numTransitions; ++i) {
+        const int offset = transitions[2 * i];
+        const int mask   = transitions[2 * i + 1];
+
+        if (offset < 0
+         || offset > maxDateOffset()
+         || (i > 0 && offset <= transitions[2 * (i - 1)])
+         || (mask & ~k_VALID_MASK_BITS)) {
+            return e_FAILURE;                                         // RETURN
+        }
+    }
+
+    const bsl::size_t    bitsOffset = k_HEADER_SIZE
+                                    + k_TRANSITION_SIZE * numTransitions;
+    const bsl::uint64_t *nonBusinessDays =
+                    reinterpret_cast<const bsl::uint64_t *>(data + bitsOffset);
+
+    d_nonBusinessDays_p  = nonBusinessDays;
+    d_holidays_p         = nonBusinessDays + numWords(length);
+    d_transitions_p      = transitions;
+    d_length             = length;
+    d_numHolidays        = numHolidays;
+    d_numNonBusinessDays = numNonBusinessDays;
+    d_numTransitions     = numTransitions;
+
+    if (length) {
+        d_firstDate = Date(1, 1, 1) + firstOffset;
+        d_lastDate  = d_firstDate + (length - 1);
+    }
+    else {
+        d_firstDate = Date(9999, 12, 31);
+        d_lastDate  = Date(1, 1, 1);
+    }
+
+    return e_SUCCESS;
+}
+
+// ACCESSORS
+int CalendarView::getNextBusinessDay(Date        *nextBusinessDay,
+                                     const Date&  date) const
+{
+    BSLS_ASSERT(nextBusinessDay);
+    BSLS_ASSERT(Date(9999, 12, 31) > date);
+    BSLS_ASSERT(isInRange(date + 1));
+
+    enum { e_SUCCESS = 0, e_FAILURE = 1 };
+
+    const bsl::size_t index = bdlb::BitStringUtil::find0AtMinIndex(
+                                                      d_nonBusinessDays_p,
+                                                      (date + 1) - d_firstDate,
+                                                      d_length);
+
+    if (bdlb::BitStringUtil::k_INVALID_INDEX == index) {
+        return e_FAILURE;                                             // RETURN
+    }
+
+    *nextBusinessDay = d_firstDate + static_cast<int>(index);
+
+    return e_SUCCESS;
+}
+
+bool CalendarView::isWeekendDay(const Date& date) const
+{
+    const int offset = date - Date(1, 1, 1);
+
+    // Find the last transition at or before 'date'.
+
+    int lo = 0;
+    int hi = d_numTransitions;
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        if (d_transitions_p[2 * mid] <= offset) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+
+    if (0 == lo) {
+        return false;                                                 // RETURN
+    }
+
+    return 0 != (d_transitions_p[2 * (lo - 1) + 1] & (1 << date.dayOfWeek()));
+}
+
+int CalendarView::numBusinessDays(const Date& beginDate,
+                                  const Date& endDate) const
+{
+    BSLS_ASSERT(isInRange(beginDate));
+    BSLS_ASSERT(isInRange(endDate));
+    BSLS_ASSERT(beginDate <= endDate);
+
+    const int numDays = endDate - beginDate + 1;
+
+    return numDays - static_cast<int>(bdlb::BitStringUtil::num1(
+                                                      d_nonBusinessDays_p,
+                                                      beginDate - d_firstDate,
+                                                      numDays));
+}
+
+                          // -----------------------
+                          // struct CalendarViewUtil
+                          // -----------------------
+
+// CLASS METHODS
+bsl::size_t CalendarViewUtil::imageSize(const PackedCalendar& calendar)
+{
+    return computeImageSize(calendar.length(),
+                            calendar.numWeekendDaysTransitions());
+}
+
+void CalendarViewUtil::writeImage(void                  *buffer,
+                                  const PackedCalendar&  calendar)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(bsls::AlignmentUtil::is8ByteAligned(buffer));
+
+    char *data = static_cast<char *>(buffer);
+
+    const int length         = calendar.length();
+    const int numTransitions = calendar.numWeekendDaysTransitions();
+    const int firstOffset    = length ? calendar.firstDate() - Date(1, 1, 1)
+                                      : 0;
+
+    // header
+
+    bsl::memset(data, 0, k_HEADER_SIZE);
+    bsl::memcpy(data + k_MAGIC_OFFSET, k_MAGIC, sizeof k_MAGIC);
+    bsl::memcpy(data + k_BOM_OFFSET,
+                &k_BYTE_ORDER_MARK,
+                sizeof k_BYTE_ORDER_MARK);
+    data[k_VERSION_OFFSET] = static_cast<char>(k_VERSION);
+
+    writeInt32(data, k_FIRST_DATE_OFFSET,   firstOffset);
+    writeInt32(data, k_LENGTH_OFFSET,       length);
+    writeInt32(data, k_NUM_HOLIDAYS_OFFSET, calendar.numHolidays());
+    writeInt32(data, k_NUM_TRANS_OFFSET,    numTransitions);
+
+    // weekend-days transitions
+
+    bsl::int32_t *transitions =
+                        reinterpret_cast<bsl::int32_t *>(data + k_HEADER_SIZE);
+
+    int i = 0;
+    for (PackedCalendar::WeekendDaysTransitionConstIterator it =
+                                        calendar.beginWeekendDaysTransitions();
+         it != calendar.endWeekendDaysTransitions();
+         ++it, ++i) {
+        transitions[2 * i]     = it->first - Date(1, 1, 1);
+        transitions[2 * i + 1] = weekendDaysMask(it->second);
+    }
+
+    // non-business days and holidays
+
+    const bsl::size_t words = numWords(length);
+
+    bsl::uint64_t *nonBusinessDays = reinterpret_cast<bsl::uint64_t *>(
+                          data + k_HEADER_SIZE + k_TRANSITION_SIZE * i);
+    bsl::uint64_t *holidays        = nonBusinessDays + words;
+
+    bsl::memset(nonBusinessDays, 0, 2 * sizeof(bsl::uint64_t) * words);
+
+    if (0 == length) {
+        writeInt32(data, k_NUM_NON_BUS_OFFSET, 0);
+        return;                                                       // RETURN
+    }
+
+    const Date& firstDate = calendar.firstDate();
+
+    for (PackedCalendar::HolidayConstIterator it = calendar.beginHolidays();
+         it != calendar.endHolidays();
+         ++it) {
+        bdlb::BitStringUtil::assign1(holidays, *it - firstDate);
+    }
+
+    // Weekend days are set transition by transition, so that each date is
+    // visited once, independent of the number of transitions.
+
+    for (int t = 0; t < numTransitions; ++t) {
+        const int mask  = transitions[2 * t + 1];
+        const int begin = bsl::max(transitions[2 * t] - firstOffset, 0);
+        const int end   = t + 1 < numTransitions
+                        ? bsl::min(transitions[2 * (t + 1)] - firstOffset,
+                                   length)
+                        : length;
+
+        if (0 == mask || begin >= end) {
+            continue;                                               // CONTINUE
+        }
+
+        int dayOfWeek = (firstDate + begin).dayOfWeek();
+        for (int d = begin; d < end; ++d) {
+            if (mask & (1 << dayOfWeek)) {
+                bdlb::BitStringUtil::assign1(nonBusinessDays, d);
+            }
+            dayOfWeek = DayOfWeek::e_SAT == dayOfWeek ? DayOfWeek::e_SUN
+                                                      : dayOfWeek + 1;
+        }
+    }
+
+    bdlb::BitStringUtil::orEqual(nonBusinessDays, 0, holidays, 0, length);
+
+    writeInt32(data,
+               k_NUM_NON_BUS_OFFSET,
+               static_cast<int>(bdlb::BitStringUtil::num1(nonBusinessDays,
+                                                          0,
+                                                          length)));
+}
+
+int CalendarViewUtil::writeImage(bsl::streambuf        *streamBuf,
+                                 const PackedCalendar&  calendar)
+{
+    BSLS_ASSERT(streamBuf);
+
+    enum { e_SUCCESS = 0, e_FAILURE = 1 };
+
+    const bsl::size_t size = imageSize(calendar);
+
+    bsl::vector<bsl::uint64_t> buffer(size / sizeof(bsl::uint64_t));
+
+    writeImage(buffer.data(), calendar);
+
+    const bsl::streamsize numWritten = streamBuf->sputn(
+                                reinterpret_cast<const char *>(buffer.data()),
+                                static_cast<bsl::streamsize>(size));
+
+    return static_cast<bsl::streamsize>(size) == numWritten ? e_SUCCESS
+                                                            : e_FAILURE;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,454 @@
+// bdlt_calendarview.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLT_CALENDARVIEW
+#define INCLUDED_BDLT_CALENDARVIEW
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a read-only calendar over a relocatable binary image.
+//
+//@CLASSES:
+//  bdlt::CalendarView: read-only calendar referring to an external image
+//  bdlt::CalendarViewUtil: namespace for creating calendar images
+//
+//@SEE_ALSO: bdlt_calendar, bdlt_packedcalendar, bdlt_calendarcache
+//
+//@DESCRIPTION: This component provides an in-core, non-value-semantic
+// mechanism, 'bdlt::CalendarView', that answers the common business-day
+// queries supported by 'bdlt::Calendar' directly from a contiguous,
+// pointer-free block of memory (a *calendar* *image*), and a utility
+// 'struct', 'bdlt::CalendarViewUtil', that produces such images from a
+// 'bdlt::PackedCalendar'.
+//
+// A calendar image contains the valid range, the weekend-days transitions,
+// and two bit strings -- the non-business days and the holidays -- indexed by
+// the offset of a date from the first date of the valid range.  Because an
+// image contains no pointers, it may be written to a file once and
+// subsequently be mapped (e.g., using 'bdls::FilesystemUtil::map') into the
+// address space of any number of processes.  Loading a view over a mapped
+// image is an 'O[1]' operation that neither allocates memory nor copies the
+// image, and the physical pages backing the image are shared by all processes
+// that map the same file.  The cost of determining whether a date is a
+// business day using a 'bdlt::CalendarView' is the same as that of a
+// 'bdlt::Calendar'.
+//
+// Note that holiday codes are *not* represented in a calendar image.  Clients
+// that require holiday codes should use a 'bdlt::PackedCalendar' or
+// 'bdlt::Calendar' instead.
+//
+///Image Format
+///------------
+// A calendar image is a sequence of 64-bit aligned sections, each of which is
+// stored in the *native* byte order of the platform that produced it:
+//..
+//  +---------------------------+  offset 0
+//  | header (32 bytes)         |  magic, byte-order mark, format version,
+//  |                           |  valid range, and element counts
+//  +---------------------------+  offset 32
+//  | weekend-days transitions  |  one 8-byte record per transition
+//  +---------------------------+
+//  | non-business days         |  '(length + 63) / 64' 64-bit words
+//  +---------------------------+
+//  | holidays                  |  '(length + 63) / 64' 64-bit words
+//  +---------------------------+
+//..
+// 'bdlt::CalendarView::load' validates the header, the section sizes, and the
+// ordering of the weekend-days transitions of a supplied image, and rejects
+// images produced on a platform having a different byte order.  The bit
+// strings themselves are not inspected, and so loading a view is independent
+// of the length of the calendar.  The address of an image supplied to 'load'
+// must be 8-byte aligned, which is always the case for memory returned by
+// 'mmap' or by a 'bslma::Allocator'.
+//
+// The lifetime of the image referred to by a 'bdlt::CalendarView' must exceed
+// that of the view (or, more precisely, the last use of the view that
+// accesses calendar data).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing a Calendar Image Between Processes
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a publishing process periodically writes the calendars used by
+// a large number of pricing processes to files, and that the pricing
+// processes should be able to access those calendars without having to parse
+// and rebuild them.
+//
+// First, the publishing process creates a packed calendar for the year 2018
+// having the usual weekend days and two holidays:
+//..
+//  bdlt::PackedCalendar packed(bdlt::Date(2018, 1, 1),
+//                              bdlt::Date(2018, 12, 31));
+//  packed.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+//  packed.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+//  packed.addHoliday(bdlt::Date(2018,  1,  1));
+//  packed.addHoliday(bdlt::Date(2018, 12, 25));
+//..
+// Then, the publishing process writes an image of the calendar to a stream
+// buffer.  In practice this would be a 'bsl::filebuf' that refers to the file
+// to be published, but for the purposes of this example we use a
+// 'bdlsb::MemOutStreamBuf':
+//..
+//  bdlsb::MemOutStreamBuf streamBuf;
+//
+//  int rc = bdlt::CalendarViewUtil::writeImage(&streamBuf, packed);
+//  assert(0 == rc);
+//  assert(bdlt::CalendarViewUtil::imageSize(packed) == streamBuf.length());
+//..
+// Next, a pricing process obtains the address of the image.  In practice the
+// address would be obtained by mapping the published file with
+// 'bdls::FilesystemUtil::map'; here we simply use the address of the
+// (suitably aligned) memory held by the stream buffer:
+//..
+//  const void *image = streamBuf.data();
+//..
+// Now, the pricing process loads a calendar view over the image:
+//..
+//  bdlt::CalendarView view;
+//
+//  rc = view.load(image, streamBuf.length());
+//  assert(0 == rc);
+//..
+// Finally, the pricing process uses the view as it would use a
+// 'bdlt::Calendar':
+//..
+//  assert(bdlt::Date(2018,  1,  1) == view.firstDate());
+//  assert(bdlt::Date(2018, 12, 31) == view.lastDate());
+//
+//  assert( view.isHoliday(bdlt::Date(2018, 12, 25)));
+//  assert( view.isWeekendDay(bdlt::Date(2018, 12, 29)));
+//  assert( view.isBusinessDay(bdlt::Date(2018, 12, 27)));
+//  assert(!view.isBusinessDay(bdlt::Date(2018, 12, 30)));
+//
+//  assert(259 == view.numBusinessDays());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlt_date.h>
+#include <bdlt_dayofweek.h>
+
+#include <bdlb_bitstringutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_streambuf.h>
+
+namespace BloombergLP {
+namespace bdlt {
+
+class PackedCalendar;
+
+                            // ==================
+                            // class CalendarView
+                            // ==================
+
+class CalendarView {
+    // This class provides read-only access to the weekend and holiday
+    // information held in a calendar image created by 'CalendarViewUtil'.  A
+    // default-constructed view (or a view that has been 'reset') refers to no
+    // image and represents an empty calendar.  Note that the behavior of
+    // requesting *any* calendar information for a supplied date whose value is
+    // outside the current *valid* *range* of the view (unless otherwise noted,
+    // e.g., 'isWeekendDay') is undefined.
+
+    // DATA
+    const bsl::uint64_t *d_nonBusinessDays_p;  // non-business days bit string
+                                               // (held, not owned)
+
+    const bsl::uint64_t *d_holidays_p;         // holidays bit string (held,
+                                               // not owned)
+
+    const bsl::int32_t  *d_transitions_p;      // '(offset, weekend-days mask)'
+                                               // pairs (held, not owned)
+
+    Date                 d_firstDate;          // first date of valid range
+
+    Date                 d_lastDate;           // last date of valid range
+
+    int                  d_length;             // number of days in valid range
+
+    int                  d_numHolidays;        // number of holidays
+
+    int                  d_numNonBusinessDays; // number of non-business days
+
+    int                  d_numTransitions;     // number of weekend-days
+                                               // transitions
+
+  private:
+    // NOT IMPLEMENTED
+    bool operator==(const CalendarView&) const;
+    bool operator!=(const CalendarView&) const;
+
+  public:
+    // CREATORS
+    CalendarView();
+        // Create a calendar view that refers to no image, and so has an empty
+        // valid range.
+
+    //! CalendarView(const CalendarView& original) = default;
+        // Create a calendar view that refers to the same image as the
+        // specified 'original' view.
+
+    //! ~CalendarView() = default;
+        // Destroy this object.  Note that the referenced image, if any, is
+        // not affected.
+
+    // MANIPULATORS
+    //! CalendarView& operator=(const CalendarView& rhs) = default;
+        // Make this view refer to the same image as the specified 'rhs' view,
+        // and return a reference providing modifiable access to this view.
+
+    int load(const void *image, bsl::size_t numBytes);
+        // Make this view refer to the calendar image at the specified 'image'
+        // address having the specified 'numBytes' size.  Return 0 on success,
+        // and a non-zero value (with no effect on this view) if 'image' is not
+        // 8-byte aligned, or if the 'numBytes' bytes at 'image' do not
+        // constitute a well-formed calendar image created on a platform having
+        // the same byte order as this one.  The behavior is undefined unless
+        // '[image .. image + numBytes)' is a valid range of readable memory
+        // that remains unmodified for as long as this view refers to it.
+
+    void reset();
+        // Reset this view to its default-constructed state, referring to no
+        // image.
+
+    // ACCESSORS
+    const Date& firstDate() const;
+        // Return a reference providing non-modifiable access to the earliest
+        // date in the valid range of this view.  The behavior is undefined
+        // unless the view is non-empty -- i.e., unless '1 <= length()'.
+
+    int getNextBusinessDay(Date *nextBusinessDay, const Date& date) const;
+        // Load, into the specified 'nextBusinessDay', the date of the first
+        // business day in this view following the specified 'date'.  Return
+        // 0 on success -- i.e., if such a business day exists, and a non-zero
+        // value (with no effect on 'nextBusinessDay') otherwise.  The behavior
+        // is undefined unless 'date + 1' is both a valid 'bdlt::Date' and in
+        // the valid range of this view.
+
+    bool isBusinessDay(const Date& date) const;
+        // Return 'true' if the specified 'date' is a business day (i.e., not a
+        // holiday or weekend day) in this view, and 'false' otherwise.  The
+        // behavior is undefined unless 'date' is within the valid range of
+        // this view.
+
+    bool isHoliday(const Date& date) const;
+        // Return 'true' if the specified 'date' is a holiday in this view, and
+        // 'false' otherwise.  The behavior is undefined unless 'date' is
+        // within the valid range of this view.
+
+    bool isInRange(const Date& date) const;
+        // Return 'true' if the specified 'date' is within the valid range of
+        // this view (i.e., 'firstDate() <= date <= lastDate()'), and 'false'
+        // otherwise.  Note that the valid range for a view is empty if its
+        // length is 0.
+
+    bool isNonBusinessDay(const Date& date) const;
+        // Return 'true' if the specified 'date' is not a business day (i.e.,
+        // is either a holiday or weekend day) in this view, and 'false'
+        // otherwise.  The behavior is undefined unless 'date' is within the
+        // valid range of this view.  Note that:
+        //..
+        //  !isBusinessDay(date)
+        //..
+        // returns the same result.
+
+    bool isWeekendDay(const Date& date) const;
+        // Return 'true' if the specified 'date' falls on a day of the week
+        // that is considered a weekend day in this view, and 'false'
+        // otherwise.  Note that this method is defined for all 'bdlt::Date'
+        // values, not just those that fall within the valid range, and may be
+        // invoked on even an empty view (i.e., having '0 == length()').
+
+    const Date& lastDate() const;
+        // Return a reference providing non-modifiable access to the latest
+        // date in the valid range of this view.  The behavior is undefined
+        // unless the view is non-empty -- i.e., unless '1 <= length()'.
+
+    int length() const;
+        // Return the number of days in the valid range of this view, which is
+        // defined to be 0 if this view is empty, and
+        // 'lastDate() - firstDate() + 1' otherwise.
+
+    int numBusinessDays() const;
+        // Return the number of days in the valid range of this view that are
+        // considered business days -- i.e., are neither holidays nor weekend
+        // days.  Note that
+        // 'numBusinessDays() == length() - numNonBusinessDays()'.
+
+    int numBusinessDays(const Date& beginDate, const Date& endDate) const;
+        // Return the number of days in the specified range
+        // '[beginDate .. endDate]' of this view that are considered business
+        // days -- i.e., are neither holidays nor weekend days.  The behavior
+        // is undefined unless both 'beginDate' and 'endDate' are within the
+        // valid range of this view, and 'beginDate <= endDate'.
+
+    int numHolidays() const;
+        // Return the number of days in the valid range of this view that are
+        // individually designated as holidays.
+
+    int numNonBusinessDays() const;
+        // Return the number of days in the valid range of this view that are
+        // *not* considered business days -- i.e., are either holidays, weekend
+        // days, or both.  Note that
+        // 'numNonBusinessDays() == length() - numBusinessDays()'.
+
+    int numWeekendDaysTransitions() const;
+        // Return the number of weekend-days transitions in this view.
+};
+
+                          // =======================
+                          // struct CalendarViewUtil
+                          // =======================
+
+struct CalendarViewUtil {
+    // This 'struct' provides a namespace for functions that create calendar
+    // images suitable for use with 'CalendarView'.
+
+    // CLASS METHODS
+    static bsl::size_t imageSize(const PackedCalendar& calendar);
+        // Return the number of bytes in the calendar image of the specified
+        // 'calendar'.
+
+    static void writeImage(void *buffer, const PackedCalendar& calendar);
+        // Write the calendar image of the specified 'calendar' to the
+        // specified 'buffer'.  The behavior is undefined unless 'buffer' is
+        // 8-byte aligned and refers to at least 'imageSize(calendar)' bytes of
+        // writable memory.
+
+    static int writeImage(bsl::streambuf        *streamBuf,
+                          const PackedCalendar&  calendar);
+        // Write the calendar image of the specified 'calendar' to the
+        // specified 'streamBuf'.  Return 0 on success, and a non-zero value
+        // if 'imageSize(calendar)' bytes could not be written to 'streamBuf'.
+        // Note that if the resulting bytes are subsequently loaded into
+        // memory, the address of the first byte must be 8-byte aligned to be
+        // used with 'CalendarView::load'.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class CalendarView
+                            // ------------------
+
+// CREATORS
+inline
+CalendarView::CalendarView()
+: d_nonBusinessDays_p(0)
+, d_holidays_p(0)
+, d_transitions_p(0)
+, d_firstDate(9999, 12, 31)
+, d_lastDate(1, 1, 1)
+, d_length(0)
+, d_numHolidays(0)
+, d_numNonBusinessDays(0)
+, d_numTransitions(0)
+{
+}
+
+// MANIPULATORS
+inline
+void CalendarView::reset()
+{
+    *this = CalendarView();
+}
+
+// ACCESSORS
+inline
+const Date& CalendarView::firstDate() const
+{
+    return d_firstDate;
+}
+
+inline
+bool CalendarView::isBusinessDay(const Date& date) const
+{
+    return !isNonBusinessDay(date);
+}
+
+inline
+bool CalendarView::isHoliday(const Date& date) const
+{
+    BSLS_ASSERT_SAFE(isInRange(date));
+
+    return bdlb::BitStringUtil::bit(d_holidays_p, date - d_firstDate);
+}
+
+inline
+bool CalendarView::isInRange(const Date& date) const
+{
+    return d_firstDate <= date && date <= d_lastDate;
+}
+
+inline
+bool CalendarView::isNonBusinessDay(const Date& date) const
+{
+    BSLS_ASSERT_SAFE(isInRange(date));
+
+    return bdlb::BitStringUtil::bit(d_nonBusinessDays_p, date - d_firstDate);
+}
+
+inline
+const Date& CalendarView::lastDate() const
+{
+    return d_lastDate;
+}
+
+inline
+int CalendarView::length() const
+{
+    return d_length;
+}
+
+inline
+int CalendarView::numBusinessDays() const
+{
+    return d_length - d_numNonBusinessDays;
+}
+
+inline
+int CalendarView::numHolidays() const
+{
+    return d_numHolidays;
+}
+
+inline
+int CalendarView::numNonBusinessDays() const
+{
+    return d_numNonBusinessDays;
+}
+
+inline
+int CalendarView::numWeekendDaysTransitions() const
+{
+    return d_numTransitions;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,798 @@
+// bdlt_calendarview.t.cpp                                            -*-C++-*-
+#include <bdlt_calendarview.h>
+
+#include <bdlt_calendar.h>
+#include <bdlt_date.h>
+#include <bdlt_dayofweek.h>
+#include <bdlt_dayofweekset.h>
+#include <bdlt_packedcalendar.h>
+
+#include <bdlsb_fixedmemoutstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlt::CalendarView' is an in-core mechanism that refers to a calendar image
+// produced by 'bdlt::CalendarViewUtil'.  The primary concern is that a view
+// loaded from the image of a calendar answers every supported query exactly as
+// a 'bdlt::Calendar' having the same value would.  We also need to verify
+// that malformed images are rejected by 'load' without affecting the view, and
+// that the two 'writeImage' overloads produce identical images.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bsl::size_t CalendarViewUtil::imageSize(const PackedCalendar&);
+// [ 2] void CalendarViewUtil::writeImage(void *, const PackedCalendar&);
+// [ 2] int CalendarViewUtil::writeImage(bsl::streambuf *, const PC&);
+//
+// CREATORS
+// [ 3] CalendarView();
+//
+// MANIPULATORS
+// [ 3] int load(const void *image, bsl::size_t numBytes);
+// [ 3] void reset();
+//
+// ACCESSORS
+// [ 4] const Date& firstDate() const;
+// [ 4] int getNextBusinessDay(Date *nextBusinessDay, const Date& date) const;
+// [ 4] bool isBusinessDay(const Date& date) const;
+// [ 4] bool isHoliday(const Date& date) const;
+// [ 4] bool isInRange(const Date& date) const;
+// [ 4] bool isNonBusinessDay(const Date& date) const;
+// [ 4] bool isWeekendDay(const Date& date) const;
+// [ 4] const Date& lastDate() const;
+// [ 4] int length() const;
+// [ 4] int numBusinessDays() const;
+// [ 4] int numBusinessDays(const Date& beginDate, const Date& endDate) const;
+// [ 4] int numHolidays() const;
+// [ 4] int numNonBusinessDays() const;
+// [ 4] int numWeekendDaysTransitions() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlt::CalendarView     Obj;
+typedef bdlt::CalendarViewUtil Util;
+
+// ============================================================================
+//                                TEST FUNCTIONS
+// ----------------------------------------------------------------------------
+
+bdlt::PackedCalendar makeCalendar(const bdlt::Date&  firstDate,
+                                  int                length,
+                                  const char        *weekendSpec,
+                                  int                holidayStride)
+    // Return a packed calendar having the specified 'length' days starting at
+    // the specified 'firstDate', having weekend-days transitions described by
+    // the specified 'weekendSpec', and having a holiday on every date whose
+    // offset from 'firstDate' is a multiple of the specified 'holidayStride'
+    // (no holidays if '0 == holidayStride').  'weekendSpec' is a sequence of
+    // groups of the form "<offset>:<days>;", where '<offset>' is the offset
+    // (possibly negative) of the transition date from 'firstDate' and
+    // '<days>' is a (possibly empty) sequence of digits '1' (Sunday) through
+    // '7' (Saturday).
+{
+    bdlt::PackedCalendar result;
+
+    if (length > 0) {
+        result.setValidRange(firstDate, firstDate + (length - 1));
+    }
+
+    const char *p = weekendSpec;
+    while (*p) {
+        char *end;
+        int   offset = static_cast<int>(strtol(p, &end, 10));
+        p = end + 1;  // skip ':'
+
+        bdlt::DayOfWeekSet days;
+        while (';' != *p) {
+            days.add(static_cast<bdlt::DayOfWeek::Enum>(*p - '0'));
+            ++p;
+        }
+        ++p;  // skip ';'
+
+        result.addWeekendDaysTransition(firstDate + offset, days);
+    }
+
+    if (holidayStride > 0) {
+        for (int i = 0; i < length; i += holidayStride) {
+            result.addHoliday(firstDate + i);
+        }
+    }
+
+    return result;
+}
+
+struct ImageBuffer {
+    // This 'struct' holds a suitably aligned copy of the image of a calendar.
+
+    bsl::vector<bsl::uint64_t> d_words;
+    bsl::size_t                d_size;
+
+    explicit ImageBuffer(const bdlt::PackedCalendar& calendar)
+    : d_words((Util::imageSize(calendar) + 7) / 8 + 1)
+    , d_size(Util::imageSize(calendar))
+        // Create an image buffer holding the image of the specified
+        // 'calendar'.  Note that one extra word is allocated so that
+        // misaligned copies of the image can be made.
+    {
+        Util::writeImage(d_words.data(), calendar);
+    }
+
+    char *data()
+        // Return the address of the image.
+    {
+        return reinterpret_cast<char *>(d_words.data());
+    }
+};
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing a Calendar Image Between Processes
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a publishing process periodically writes the calendars used by
+// a large number of pricing processes to files, and that the pricing
+// processes should be able to access those calendars without having to parse
+// and rebuild them.
+//
+// First, the publishing process creates a packed calendar for the year 2018
+// having the usual weekend days and two holidays:
+//..
+    bdlt::PackedCalendar packed(bdlt::Date(2018, 1, 1),
+                                bdlt::Date(2018, 12, 31));
+    packed.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+    packed.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+    packed.addHoliday(bdlt::Date(2018,  1,  1));
+    packed.addHoliday(bdlt::Date(2018, 12, 25));
+//..
+// Then, the publishing process writes an image of the calendar to a stream
+// buffer.  In practice this would be a 'bsl::filebuf' that refers to the file
+// to be published, but for the purposes of this example we use a
+// 'bdlsb::MemOutStreamBuf':
+//..
+    bdlsb::MemOutStreamBuf streamBuf;
+
+    int rc = bdlt::CalendarViewUtil::writeImage(&streamBuf, packed);
+    ASSERT(0 == rc);
+    ASSERT(bdlt::CalendarViewUtil::imageSize(packed) == streamBuf.length());
+//..
+// Next, a pricing process obtains the address of the image.  In practice the
+// address would be obtained by mapping the published file with
+// 'bdls::FilesystemUtil::map'; here we simply use the address of the
+// (suitably aligned) memory held by the stream buffer:
+//..
+    const void *image = streamBuf.data();
+//..
+// Now, the pricing process loads a calendar view over the image:
+//..
+    bdlt::CalendarView view;
+
+    rc = view.load(image, streamBuf.length());
+    ASSERT(0 == rc);
+//..
+// Finally, the pricing process uses the view as it would use a
+// 'bdlt::Calendar':
+//..
+    ASSERT(bdlt::Date(2018,  1,  1) == view.firstDate());
+    ASSERT(bdlt::Date(2018, 12, 31) == view.lastDate());
+
+    ASSERT( view.isHoliday(bdlt::Date(2018, 12, 25)));
+    ASSERT( view.isWeekendDay(bdlt::Date(2018, 12, 29)));
+    ASSERT( view.isBusinessDay(bdlt::Date(2018, 12, 27)));
+    ASSERT(!view.isBusinessDay(bdlt::Date(2018, 12, 30)));
+
+    ASSERT(259 == view.numBusinessDays());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each accessor of a view loaded from the image of a calendar
+        //:   returns the same value as the corresponding accessor of a
+        //:   'bdlt::Calendar' having the value of that calendar.
+        //:
+        //: 2 Calendars having no weekend-days transitions, transitions before,
+        //:   within, and after the valid range, and empty weekend-day sets are
+        //:   represented correctly.
+        //:
+        //: 3 Calendars whose lengths are, and are not, multiples of 64 are
+        //:   represented correctly.
+        //:
+        //: 4 'isWeekendDay' is correct for dates outside of the valid range.
+        //:
+        //: 5 The accessors do not allocate memory.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, create a set of calendars and,
+        //:   for each, load a view from its image and compare every accessor
+        //:   against a 'bdlt::Calendar' for every date (or pair of dates) in
+        //:   the valid range.  (C-1..4)
+        //:
+        //: 2 Verify that the default allocator is not used by the accessors.
+        //:   (C-5)
+        //
+        // Testing:
+        //   const Date& firstDate() const;
+        //   int getNextBusinessDay(Date *nextBusinessDay, const Date& date);
+        //   bool isBusinessDay(const Date& date) const;
+        //   bool isHoliday(const Date& date) const;
+        //   bool isInRange(const Date& date) const;
+        //   bool isNonBusinessDay(const Date& date) const;
+        //   bool isWeekendDay(const Date& date) const;
+        //   const Date& lastDate() const;
+        //   int length() const;
+        //   int numBusinessDays() const;
+        //   int numBusinessDays(const Date& beginDate, const Date& endDate);
+        //   int numHolidays() const;
+        //   int numNonBusinessDays() const;
+        //   int numWeekendDaysTransitions() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ACCESSORS" << endl
+                                  << "=========" << endl;
+
+        static const struct {
+            int         d_line;        // source line number
+            int         d_year;        // year of first date
+            int         d_month;       // month of first date
+            int         d_day;         // day of first date
+            int         d_length;      // length of valid range
+            const char *d_weekend_p;   // weekend-days transitions spec
+            int         d_stride;      // holiday stride
+        } DATA[] = {
+            //LN  YEAR  MO  DY  LEN  WEEKEND                    STRIDE
+            //--  ----  --  --  ---  -------------------------  ------
+            { L_, 2018,  1,  1,   0, "",                             0 },
+            { L_, 2018,  1,  1,   1, "",                             0 },
+            { L_, 2018,  1,  1,   1, "0:1;",                         1 },
+            { L_, 2018,  1,  1,  63, "-1000:17;",                    5 },
+            { L_, 2018,  1,  1,  64, "-1000:17;",                    7 },
+            { L_, 2018,  1,  1,  65, "-1000:17;",                    0 },
+            { L_, 2017, 12, 30, 128, "-9:1;10:;40:67;300:2;",        3 },
+            { L_, 2000,  2, 28, 500, "0:17;100:6;200:67;250:17;",   11 },
+            { L_,    1,  1,  1, 400, "0:17;",                       13 },
+            { L_, 9998, 12,  1, 396, "-5000:1;200:7;",              17 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const bdlt::Date  FIRST(DATA[ti].d_year,
+                                    DATA[ti].d_month,
+                                    DATA[ti].d_day);
+            const int         LENGTH = DATA[ti].d_length;
+            const char *const SPEC   = DATA[ti].d_weekend_p;
+            const int         STRIDE = DATA[ti].d_stride;
+
+            if (veryVerbose) { T_ P_(LINE) P_(FIRST) P_(LENGTH) P(SPEC) }
+
+            const bdlt::PackedCalendar PC = makeCalendar(FIRST,
+                                                         LENGTH,
+                                                         SPEC,
+                                                         STRIDE);
+            const bdlt::Calendar       C(PC);
+
+            ImageBuffer buffer(PC);
+
+            Obj mX;  const Obj& X = mX;
+            ASSERTV(LINE, 0 == mX.load(buffer.data(), buffer.d_size));
+
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            ASSERTV(LINE, C.length() == X.length());
+            ASSERTV(LINE, C.numHolidays() == X.numHolidays());
+            ASSERTV(LINE, C.numBusinessDays() == X.numBusinessDays());
+            ASSERTV(LINE, C.numNonBusinessDays() == X.numNonBusinessDays());
+            ASSERTV(LINE, C.numWeekendDaysTransitions() ==
+                                               X.numWeekendDaysTransitions());
+
+            if (0 == LENGTH) {
+                ASSERTV(LINE, !X.isInRange(FIRST));
+                ASSERTV(LINE, dam.isTotalSame());
+                continue;
+            }
+
+            ASSERTV(LINE, C.firstDate() == X.firstDate());
+            ASSERTV(LINE, C.lastDate()  == X.lastDate());
+
+            if (bdlt::Date(1, 1, 1) < FIRST) {
+                ASSERTV(LINE, !X.isInRange(FIRST - 1));
+            }
+            if (bdlt::Date(9999, 12, 31) > X.lastDate()) {
+                ASSERTV(LINE, !X.isInRange(X.lastDate() + 1));
+            }
+
+            for (int i = -10; i < LENGTH + 10; ++i) {
+                bdlt::Date date;
+                if (0 != date.addDaysIfValid(FIRST - bdlt::Date(1, 1, 1)
+                                                                      + i)) {
+                    continue;
+                }
+                ASSERTV(LINE, i, C.isWeekendDay(date) ==
+                                                       X.isWeekendDay(date));
+            }
+
+            for (int i = 0; i < LENGTH; ++i) {
+                const bdlt::Date DATE = FIRST + i;
+
+                ASSERTV(LINE, i, X.isInRange(DATE));
+                ASSERTV(LINE, i, C.isBusinessDay(DATE) ==
+                                                      X.isBusinessDay(DATE));
+                ASSERTV(LINE, i, C.isNonBusinessDay(DATE) ==
+                                                   X.isNonBusinessDay(DATE));
+                ASSERTV(LINE, i, C.isHoliday(DATE) == X.isHoliday(DATE));
+
+                if (i + 1 < LENGTH) {
+                    bdlt::Date expected(1, 1, 1), actual(1, 1, 1);
+                    const int  expRc = C.getNextBusinessDay(&expected, DATE);
+                    const int  actRc = X.getNextBusinessDay(&actual,   DATE);
+
+                    ASSERTV(LINE, i, (0 == expRc) == (0 == actRc));
+                    ASSERTV(LINE, i, expected == actual);
+                }
+
+                for (int j = i; j < LENGTH; j += 1 + j / 8) {
+                    const bdlt::Date END = FIRST + j;
+
+                    ASSERTV(LINE, i, j, C.numBusinessDays(DATE, END) ==
+                                              X.numBusinessDays(DATE, END));
+                }
+            }
+
+            ASSERTV(LINE, dam.isTotalSame());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS AND MANIPULATORS
+        //
+        // Concerns:
+        //: 1 A default-constructed view is empty.
+        //:
+        //: 2 'load' succeeds for a well-formed image and fails, with no effect
+        //:   on the view, for an image that is truncated, extended,
+        //:   misaligned, has a corrupted header, or has weekend-days
+        //:   transitions that are out of order or have invalid day masks.
+        //:
+        //: 3 'reset' returns the view to its default-constructed state.
+        //:
+        //: 4 'load' does not allocate memory.
+        //
+        // Plan:
+        //: 1 Create a default-constructed view and verify its state.  (C-1)
+        //:
+        //: 2 Create an image of a calendar, and verify that 'load' succeeds.
+        //:   Then apply a series of corruptions to copies of the image and
+        //:   verify that 'load' fails and that the view retains its previous
+        //:   state.  (C-2, 4)
+        //:
+        //: 3 Call 'reset' and verify that the view is empty.  (C-3)
+        //
+        // Testing:
+        //   CalendarView();
+        //   int load(const void *image, bsl::size_t numBytes);
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CREATORS AND MANIPULATORS" << endl
+                                  << "=========================" << endl;
+
+        if (verbose) cout << "\tDefault construction." << endl;
+        {
+            const Obj X;
+
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.numBusinessDays());
+            ASSERT(0 == X.numHolidays());
+            ASSERT(0 == X.numNonBusinessDays());
+            ASSERT(0 == X.numWeekendDaysTransitions());
+            ASSERT(!X.isInRange(bdlt::Date(1, 1, 1)));
+            ASSERT(!X.isInRange(bdlt::Date(9999, 12, 31)));
+            ASSERT(!X.isWeekendDay(bdlt::Date(2018, 1, 6)));
+        }
+
+        if (verbose) cout << "\tValid and invalid images." << endl;
+        {
+            const bdlt::PackedCalendar PC = makeCalendar(
+                                                     bdlt::Date(2018, 1, 1),
+                                                     100,
+                                                     "-5:17;30:6;60:67;",
+                                                     9);
+
+            ImageBuffer       buffer(PC);
+            const bsl::size_t SIZE = buffer.d_size;
+
+            Obj mX;  const Obj& X = mX;
+
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            ASSERT(0 == mX.load(buffer.data(), SIZE));
+            ASSERT(100 == X.length());
+            ASSERT(3 == X.numWeekendDaysTransitions());
+
+            const int NUM_NON_BUSINESS_DAYS = X.numNonBusinessDays();
+
+            // size errors
+
+            ASSERT(0 != mX.load(buffer.data(), SIZE - 1));
+            ASSERT(0 != mX.load(buffer.data(), SIZE + 1));
+            ASSERT(0 != mX.load(buffer.data(), 0));
+            ASSERT(0 != mX.load(buffer.data(), 31));
+
+            ASSERT(100 == X.length());
+
+            // misaligned
+
+            bsl::memmove(buffer.data() + 4, buffer.data(), SIZE);
+            ASSERT(0 != mX.load(buffer.data() + 4, SIZE));
+            bsl::memmove(buffer.data(), buffer.data() + 4, SIZE);
+            ASSERT(0 == mX.load(buffer.data(), SIZE));
+
+            // corrupted header and transitions
+
+            static const struct {
+                int d_line;     // source line number
+                int d_offset;   // offset of byte to corrupt
+                int d_value;    // value to store
+            } DATA[] = {
+                //LN  OFF  VALUE
+                //--  ---  -----
+                { L_,   0,  'X' },    // magic
+                { L_,   3,  'X' },    // magic
+                { L_,   4, 0x00 },    // byte-order mark
+                { L_,   5, 0x00 },    // byte-order mark
+                { L_,   6, 0x02 },    // version
+                { L_,  11, 0x7f },    // first date out of range
+                { L_,  15, 0x80 },    // negative length
+                { L_,  12, 0xc8 },    // length does not match size
+                { L_,  19, 0x80 },    // negative number of holidays
+                { L_,  16, 0x7f },    // too many holidays
+                { L_,  20, 0x00 },    // too few non-business days
+                { L_,  27, 0x80 },    // negative number of transitions
+                { L_,  24, 0x02 },    // size mismatch
+                { L_,  35, 0x7f },    // transition date out of range
+                { L_,  42, 0x00 },    // second transition precedes first
+                { L_,  36, 0x01 },    // invalid day-of-week mask bit
+                { L_,  37, 0x01 },    // invalid day-of-week mask bit
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE   = DATA[ti].d_line;
+                const int OFFSET = DATA[ti].d_offset;
+                const int VALUE  = DATA[ti].d_value;
+
+                if (veryVerbose) { T_ P_(LINE) P_(OFFSET) P(VALUE) }
+
+                const char saved = buffer.data()[OFFSET];
+                buffer.data()[OFFSET] = static_cast<char>(VALUE);
+
+                ASSERTV(LINE, 0 != mX.load(buffer.data(), SIZE));
+
+                ASSERTV(LINE, 100 == X.length());
+                ASSERTV(LINE, bdlt::Date(2018, 1, 1) == X.firstDate());
+                ASSERTV(LINE, NUM_NON_BUSINESS_DAYS ==
+                                                      X.numNonBusinessDays());
+
+                buffer.data()[OFFSET] = saved;
+
+                ASSERTV(LINE, 0 == mX.load(buffer.data(), SIZE));
+            }
+
+            ASSERT(dam.isTotalSame());
+
+            mX.reset();
+
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.numNonBusinessDays());
+            ASSERT(0 == X.numWeekendDaysTransitions());
+            ASSERT(!X.isInRange(bdlt::Date(2018, 1, 1)));
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            ASSERT_PASS(mX.load(0, 0));
+            ASSERT_FAIL(mX.load(0, 32));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'CalendarViewUtil'
+        //
+        // Concerns:
+        //: 1 'imageSize' returns the size of the header, plus 8 bytes per
+        //:   weekend-days transition, plus two bit strings of
+        //:   '(length + 63) / 64' 64-bit words.
+        //:
+        //: 2 Both 'writeImage' overloads produce identical images.
+        //:
+        //: 3 The 'bsl::streambuf' overload returns a non-zero value if the
+        //:   image cannot be written in its entirety.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of calendars, compare 'imageSize' against the expected
+        //:   value.  (C-1)
+        //:
+        //: 2 Write the image to a buffer and to a 'bdlsb::MemOutStreamBuf',
+        //:   and compare the bytes.  (C-2)
+        //:
+        //: 3 Write the image to a 'bdlsb::FixedMemOutStreamBuf' that is one
+        //:   byte too small and verify the result.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   bsl::size_t CalendarViewUtil::imageSize(const PackedCalendar&);
+        //   void CalendarViewUtil::writeImage(void *, const PackedCalendar&);
+        //   int CalendarViewUtil::writeImage(bsl::streambuf *, const PC&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'CalendarViewUtil'" << endl
+                                  << "==================" << endl;
+
+        static const struct {
+            int         d_line;      // source line number
+            int         d_length;    // length of valid range
+            const char *d_weekend_p; // weekend-days transitions spec
+            bsl::size_t d_size;      // expected image size
+        } DATA[] = {
+            //LN  LEN  WEEKEND                 SIZE
+            //--  ---  ---------------------   ----
+            { L_,   0, "",                       32 },
+            { L_,   1, "",                       48 },
+            { L_,  64, "0:17;",                  56 },
+            { L_,  65, "0:17;",                  72 },
+            { L_, 200, "0:17;50:1;100:;",       120 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const int         LENGTH = DATA[ti].d_length;
+            const char *const SPEC   = DATA[ti].d_weekend_p;
+            const bsl::size_t SIZE   = DATA[ti].d_size;
+
+            if (veryVerbose) { T_ P_(LINE) P_(LENGTH) P(SPEC) }
+
+            const bdlt::PackedCalendar PC = makeCalendar(
+                                                     bdlt::Date(2018, 3, 1),
+                                                     LENGTH,
+                                                     SPEC,
+                                                     4);
+
+            ASSERTV(LINE, SIZE == Util::imageSize(PC));
+
+            ImageBuffer buffer(PC);
+
+            bdlsb::MemOutStreamBuf streamBuf;
+            ASSERTV(LINE, 0 == Util::writeImage(&streamBuf, PC));
+            ASSERTV(LINE, SIZE == streamBuf.length());
+            ASSERTV(LINE, 0 == bsl::memcmp(buffer.data(),
+                                           streamBuf.data(),
+                                           SIZE));
+
+            bsl::vector<char> small(SIZE - 1);
+            bdlsb::FixedMemOutStreamBuf fixedBuf(small.data(), small.size());
+            ASSERTV(LINE, 0 != Util::writeImage(&fixedBuf, PC));
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::PackedCalendar PC;
+
+            bsl::uint64_t buffer[5];
+
+            ASSERT_PASS(Util::writeImage(static_cast<void *>(buffer), PC));
+            ASSERT_FAIL(Util::writeImage(static_cast<void *>(0), PC));
+            ASSERT_FAIL(Util::writeImage(
+                            static_cast<void *>(
+                                reinterpret_cast<char *>(buffer) + 1), PC));
+            ASSERT_FAIL(Util::writeImage(static_cast<bsl::streambuf *>(0),
+                                         PC));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an image of a simple calendar, load a view over it, and
+        //:   exercise the primary accessors.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bdlt::PackedCalendar pc(bdlt::Date(2018, 1, 1),
+                                bdlt::Date(2018, 1, 31));
+        pc.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+        pc.addHoliday(bdlt::Date(2018, 1, 15));
+
+        ImageBuffer buffer(pc);
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == mX.load(buffer.data(), buffer.d_size));
+
+        ASSERT(31 == X.length());
+        ASSERT( 1 == X.numHolidays());
+        ASSERT( 5 == X.numNonBusinessDays());
+        ASSERT(26 == X.numBusinessDays());
+
+        ASSERT( X.isBusinessDay(bdlt::Date(2018, 1,  2)));
+        ASSERT( X.isHoliday(bdlt::Date(2018, 1, 15)));
+        ASSERT( X.isNonBusinessDay(bdlt::Date(2018, 1, 7)));
+        ASSERT(!X.isHoliday(bdlt::Date(2018, 1, 7)));
+        ASSERT( X.isWeekendDay(bdlt::Date(2018, 1, 7)));
+
+        ASSERT(25 == X.numBusinessDays(bdlt::Date(2018, 1,  2),
+                                       bdlt::Date(2018, 1, 31)));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
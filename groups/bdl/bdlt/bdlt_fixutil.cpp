@@ -12,6 +12,9 @@ BSLS_IDENT_RCSID(bdlt_fixutil_cpp,"$Id$ $CSID$")
 #include <bdlt_time.h>
 #include <bdlt_timetz.h>
 
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cstring.h>
@@ -373,6 +376,20 @@ int parseTime(const char **nextPos,
     return 0;
 }
 
+static const char k_DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+    // The decimal representations of the integers in the range '[0 .. 99]',
+    // each padded to two digits, concatenated in increasing order.
+
 static
 int generateInt(char *buffer, int value, int paddedLen)
     // Write, to the specified 'buffer', the decimal string representation of
@@ -390,9 +407,18 @@ int generateInt(char *buffer, int value, int paddedLen)
 
     char *p = buffer + paddedLen;
 
-    while (p > buffer) {
+    // Emit two digits at a time from a table of the 100 two-digit strings.
+
+    while (p - buffer >= 2) {
+        const char *pair = k_DIGIT_PAIRS + 2 * (value % 100);
+
+        *--p   = pair[1];
+        *--p   = pair[0];
+        value /= 100;
+    }
+
+    if (p > buffer) {
         *--p = static_cast<char>('0' + value % 10);
-        value /= 10;
     }
 
     return paddedLen;
@@ -566,6 +592,196 @@ int generatedLengthForTimeTzObject(int                         defaultLength,
 }
 #endif
 
+static inline
+bsls::Types::Uint64 loadEightBytes(const char *string)
+    // Return the 8 characters starting at the specified 'string' as an
+    // unsigned 64-bit integer whose least-significant byte is 'string[0]' and
+    // whose most-significant byte is 'string[7]'.
+{
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+    bsls::Types::Uint64 result;
+    bsl::memcpy(&result, string, sizeof result);
+    return result;
+#else
+    bsls::Types::Uint64 result = 0;
+    for (int i = 7; i >= 0; --i) {
+        result = (result << 8) | static_cast<unsigned char>(string[i]);
+    }
+    return result;
+#endif
+}
+
+static inline
+int decodeEightBytes(bsls::Types::Uint64 *pairs,
+                     const char          *string,
+                     bsls::Types::Uint64  pattern,
+                     bsls::Types::Uint64  limits)
+    // Match the 8 characters starting at the specified 'string' against the
+    // specified 'pattern' and, on success, load into the specified 'pairs' a
+    // value whose byte 'i' (counting from the least-significant byte) is
+    // '10 * d[i] + d[i + 1]', where 'd[i]' is the digit value of 'string[i]'
+    // (and 0 for a separator).  Return 0 on success, and a non-zero value
+    // (with no effect) otherwise.  Byte 'i' of 'pattern' is '0' if
+    // 'string[i]' must be a decimal digit, and is otherwise the separator
+    // that 'string[i]' must equal; byte 'i' of the specified 'limits' must be
+    // 0x76 in the former case and 0x7F in the latter.
+{
+    // After the exclusive-or, a digit position holds a value in '[0 .. 9]',
+    // and a separator position holds 0, if and only if the character
+    // matches.  Adding the limit sets the high bit of any byte that exceeds
+    // its bound, and no carry can cross a byte unless that byte already has
+    // its high bit set.
+
+    const bsls::Types::Uint64 k_HIGH_BITS = 0x8080808080808080ULL;
+
+    const bsls::Types::Uint64 values = loadEightBytes(string) ^ pattern;
+
+    if ((values | (values + limits)) & k_HIGH_BITS) {
+        return -1;                                                    // RETURN
+    }
+
+    *pairs = values * 10 + (values >> 8);
+
+    return 0;
+}
+
+static inline
+int pairAt(bsls::Types::Uint64 pairs, int index)
+    // Return byte 'index' (counting from the least-significant byte) of the
+    // specified 'pairs'.
+{
+    return static_cast<int>((pairs >> (8 * index)) & 0xFF);
+}
+
+static
+int parseDatetimeFast(Datetime   *localDatetime,
+                      int        *tzOffset,
+                      const char *string,
+                      int         length)
+    // Parse the specified initial 'length' characters of the specified
+    // 'string' if they have the common layout
+    // "YYYYMMDD-hh:mm:ss{.s{s{s{s{s{s}}}}}}{Z|(+|-)hh:mm}" and denote a valid
+    // 'Datetime' that does not require the special handling of a leap second,
+    // load the value into the specified 'localDatetime' and the timezone
+    // offset, in minutes, into the specified 'tzOffset', and return 0.
+    // Otherwise, return a non-zero value with no effect.  Note that a non-zero
+    // result does not indicate that 'string' is invalid, only that it must be
+    // parsed by the general parser.
+{
+    enum { k_BASE_LENGTH = sizeof "YYYYMMDD-hh:mm:ss" - 1 };
+
+    if (length < k_BASE_LENGTH || '-' != string[8]) {
+        return -1;                                                    // RETURN
+    }
+
+    // Patterns and limits, least-significant byte first, for "YYYYMMDD" and
+    // "hh:mm:ss".
+
+    bsls::Types::Uint64 date, time;
+
+    if (0 != decodeEightBytes(&date,
+                              string,
+                              0x3030303030303030ULL,
+                              0x7676767676767676ULL)
+     || 0 != decodeEightBytes(&time,
+                              string + 9,
+                              0x30303A30303A3030ULL,
+                              0x76767F76767F7676ULL)) {
+        return -1;                                                    // RETURN
+    }
+
+    const int year   = pairAt(date, 0) * 100 + pairAt(date, 2);
+    const int month  = pairAt(date, 4);
+    const int day    = pairAt(date, 6);
+    const int hour   = pairAt(time, 0);
+    const int minute = pairAt(time, 3);
+    const int second = pairAt(time, 6);
+
+    if (hour > 23 || second > 59) {
+        return -1;                                                    // RETURN
+    }
+
+    const char *p   = string + k_BASE_LENGTH;
+    const char *end = string + length;
+
+    // Fractional second of at most 6 digits, which needs no rounding.
+
+    int microsecond = 0;
+
+    if (p < end && '.' == *p) {
+        ++p;
+
+        const char *digits    = p;
+        const char *digitsEnd = bsl::min(end, p + 7);
+
+        while (p < digitsEnd && '0' <= *p && *p <= '9') {
+            microsecond = microsecond * 10 + (*p - '0');
+            ++p;
+        }
+
+        const int numDigits = static_cast<int>(p - digits);
+
+        if (0 == numDigits || 6 < numDigits) {
+            return -1;                                                // RETURN
+        }
+
+        static const int k_SCALE[] = { 0, 100000, 10000, 1000, 100, 10, 1 };
+
+        microsecond *= k_SCALE[numDigits];
+    }
+
+    // Timezone offset, if any, in its generated form.
+
+    int offset = 0;
+
+    if (p < end) {
+        if ('Z' == *p && end - p == 1) {
+            ++p;
+        }
+        else if (('+' == *p || '-' == *p)
+              && end - p == static_cast<int>(sizeof "+hh:mm") - 1
+              && ':' == p[3]) {
+            const char *z = p + 1;
+
+            if (z[0] < '0' || z[0] > '9' || z[1] < '0' || z[1] > '9'
+             || z[3] < '0' || z[3] > '9' || z[4] < '0' || z[4] > '9') {
+                return -1;                                            // RETURN
+            }
+
+            const int zoneHour   = (z[0] - '0') * 10 + (z[1] - '0');
+            const int zoneMinute = (z[3] - '0') * 10 + (z[4] - '0');
+
+            if (zoneHour > 23 || zoneMinute > 59) {
+                return -1;                                            // RETURN
+            }
+
+            offset = zoneHour * 60 + zoneMinute;
+            if ('-' == *p) {
+                offset = -offset;
+            }
+            p = end;
+        }
+        else {
+            return -1;                                                // RETURN
+        }
+    }
+
+    if (0 != localDatetime->setDatetimeIfValid(year,
+                                               month,
+                                               day,
+                                               hour,
+                                               minute,
+                                               second,
+                                               microsecond / 1000,
+                                               microsecond % 1000)) {
+        return -1;                                                    // RETURN
+    }
+
+    *tzOffset = offset;
+
+    return 0;
+}
+
 static
 void copyBuf(char *dst, int dstLen, const char *src, int srcLen)
     // Copy, to the specified 'dst' buffer having the specified 'dstLen', the
@@ -1029,6 +1245,44 @@ int FixUtil::generateRaw(char                        *buffer,
     return datetimeLen + zoneLen;
 }
 
+bsl::size_t FixUtil::generateRaw(char                        *buffer,
+                                 const Datetime              *objects,
+                                 bsl::size_t                  numObjects,
+                                 char                         separator,
+                                 const FixUtilConfiguration&  configuration)
+{
+    BSLS_ASSERT(buffer  || 0 == numObjects);
+    BSLS_ASSERT(objects || 0 == numObjects);
+
+    char *p = buffer;
+
+    for (bsl::size_t i = 0; i < numObjects; ++i) {
+        p += generateRaw(p, objects[i], configuration);
+        *p++ = separator;
+    }
+
+    return p - buffer;
+}
+
+bsl::size_t FixUtil::generateRaw(char                        *buffer,
+                                 const DatetimeTz            *objects,
+                                 bsl::size_t                  numObjects,
+                                 char                         separator,
+                                 const FixUtilConfiguration&  configuration)
+{
+    BSLS_ASSERT(buffer  || 0 == numObjects);
+    BSLS_ASSERT(objects || 0 == numObjects);
+
+    char *p = buffer;
+
+    for (bsl::size_t i = 0; i < numObjects; ++i) {
+        p += generateRaw(p, objects[i], configuration);
+        *p++ = separator;
+    }
+
+    return p - buffer;
+}
+
 int FixUtil::parse(Date *result, const char *string, int length)
 {
     BSLS_ASSERT(result);
@@ -1224,6 +1478,21 @@ int FixUtil::parse(DatetimeTz *result, const char *string, int length)
     //
     // The fractional second and timezone offset are independently optional.
 
+    // 0. Try the fast path for the layout produced by 'generate'.
+
+    {
+        Datetime localDatetime;
+        int      tzOffset;
+
+        if (0 == parseDatetimeFast(&localDatetime,
+                                   &tzOffset,
+                                   string,
+                                   length)) {
+            result->setDatetimeTz(localDatetime, tzOffset);
+            return 0;                                                 // RETURN
+        }
+    }
+
     enum { k_MINIMUM_LENGTH = sizeof "YYYYMMDD-hh:mm" - 1 };
 
     if (length < k_MINIMUM_LENGTH) {
@@ -1257,6 +1526,46 @@ int FixUtil::parse(DatetimeTz *result, const char *string, int length)
     return 0;
 }
 
+bsl::size_t FixUtil::parse(Datetime                *results,
+                           const bslstl::StringRef *strings,
+                           bsl::size_t              numStrings)
+{
+    BSLS_ASSERT(results || 0 == numStrings);
+    BSLS_ASSERT(strings || 0 == numStrings);
+
+    for (bsl::size_t i = 0; i < numStrings; ++i) {
+        BSLS_ASSERT(strings[i].data());
+
+        if (0 != parse(results + i,
+                       strings[i].data(),
+                       static_cast<int>(strings[i].length()))) {
+            return i;                                                 // RETURN
+        }
+    }
+
+    return numStrings;
+}
+
+bsl::size_t FixUtil::parse(DatetimeTz              *results,
+                           const bslstl::StringRef *strings,
+                           bsl::size_t              numStrings)
+{
+    BSLS_ASSERT(results || 0 == numStrings);
+    BSLS_ASSERT(strings || 0 == numStrings);
+
+    for (bsl::size_t i = 0; i < numStrings; ++i) {
+        BSLS_ASSERT(strings[i].data());
+
+        if (0 != parse(results + i,
+                       strings[i].data(),
+                       static_cast<int>(strings[i].length()))) {
+            return i;                                                 // RETURN
+        }
+    }
+
+    return numStrings;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
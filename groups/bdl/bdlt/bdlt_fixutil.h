@@ -294,6 +294,24 @@ BSLS_IDENT("$Id: $")
 //                                                # optional during parsing
 //..
 //
+///Arrays of Datetime Values
+///-------------------------
+// 'FixUtil' also provides 'generateRaw' and 'parse' overloads that convert
+// arrays of 'Datetime' and 'DatetimeTz' values (e.g., the timestamps of a
+// batch of FIX messages).  The array 'generateRaw' functions write each
+// representation followed by a caller-supplied separator character, reading
+// the process-wide default configuration once for the entire array when no
+// configuration is supplied.  The array 'parse' functions stop at the first
+// string that cannot be parsed and return its index.
+//
+// Note that parsing a 'Datetime' or 'DatetimeTz' first tries a fast path for
+// strings in the layout produced by the 'generate' functions (i.e.,
+// "YYYYMMDD-hh:mm:ss", optionally followed by a '.' and one to six digits,
+// optionally followed by 'Z' or "(+|-)hh:mm"), which validates and converts
+// several fields at a time.  Any other string (e.g., one omitting the
+// seconds, or having a leap second or more than six fractional digits) is
+// handled by the general parser; the results are the same in either case.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -453,6 +471,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #include <bsls_review.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 
@@ -673,6 +692,40 @@ struct FixUtil {
         // is large enough to hold any string generated by this component
         // (counting a null terminator, if any).
 
+    static bsl::size_t generateRaw(char                        *buffer,
+                                   const Datetime              *objects,
+                                   bsl::size_t                  numObjects,
+                                   char                         separator);
+    static bsl::size_t generateRaw(
+                                 char                        *buffer,
+                                 const Datetime              *objects,
+                                 bsl::size_t                  numObjects,
+                                 char                         separator,
+                                 const FixUtilConfiguration&  configuration);
+    static bsl::size_t generateRaw(char                        *buffer,
+                                   const DatetimeTz            *objects,
+                                   bsl::size_t                  numObjects,
+                                   char                         separator);
+    static bsl::size_t generateRaw(
+                                 char                        *buffer,
+                                 const DatetimeTz            *objects,
+                                 bsl::size_t                  numObjects,
+                                 char                         separator,
+                                 const FixUtilConfiguration&  configuration);
+        // Write, to the specified 'buffer', the FIX representation of each of
+        // the specified 'numObjects' elements of the specified 'objects'
+        // array, in order, each followed by the specified 'separator'
+        // character.  Optionally specify a 'configuration' to affect the
+        // format of the generated strings.  If 'configuration' is not
+        // supplied, the process-wide default value
+        // 'FixUtilConfiguration::defaultConfiguration()' is used (and is read
+        // once for the entire array).  Return the total number of characters
+        // written.  'buffer' is not null terminated.  The behavior is
+        // undefined unless 'objects' refers to an array of at least
+        // 'numObjects' elements, and 'buffer' has sufficient capacity.  Note
+        // that a buffer of size 'numObjects * (k_MAX_STRLEN + 1)' is large
+        // enough to hold the generated strings.
+
     static int parse(Date *result, const char *string, int length);
         // Parse the specified initial 'length' characters of the specified FIX
         // 'string' as a 'Date' value, and load the value into the specified
@@ -890,6 +943,25 @@ struct FixUtil {
         // attribute is taken to be 59, then an additional second is added to
         // 'result' at the end.  The behavior is undefined unless
         // 'string.data()' is non-null.
+
+    static bsl::size_t parse(Datetime                *results,
+                             const bslstl::StringRef *strings,
+                             bsl::size_t              numStrings);
+    static bsl::size_t parse(DatetimeTz              *results,
+                             const bslstl::StringRef *strings,
+                             bsl::size_t              numStrings);
+        // Parse each of the specified 'numStrings' elements of the specified
+        // 'strings' array, in order, as described for the single-value 'parse'
+        // function of the same result type, and load the value into the
+        // corresponding element of the specified 'results' array.  Stop at the
+        // first element of 'strings' that cannot be parsed.  Return the number
+        // of elements that were successfully parsed; i.e., return 'numStrings'
+        // on success, and the index of the first element of 'strings' that
+        // could not be parsed otherwise (leaving the element of 'results' at
+        // that index, and all subsequent elements, unmodified).  The behavior
+        // is undefined unless 'results' and 'strings' each refer to an array
+        // of at least 'numStrings' elements, and 'strings[i].data()' is
+        // non-null for each such element.
 };
 
 // ============================================================================
@@ -1226,6 +1298,38 @@ int FixUtil::generateRaw(char *buffer, const DatetimeTz& object)
                        FixUtilConfiguration::defaultConfiguration());
 }
 
+inline
+bsl::size_t FixUtil::generateRaw(char           *buffer,
+                                 const Datetime *objects,
+                                 bsl::size_t     numObjects,
+                                 char            separator)
+{
+    BSLS_ASSERT(buffer  || 0 == numObjects);
+    BSLS_ASSERT(objects || 0 == numObjects);
+
+    return generateRaw(buffer,
+                       objects,
+                       numObjects,
+                       separator,
+                       FixUtilConfiguration::defaultConfiguration());
+}
+
+inline
+bsl::size_t FixUtil::generateRaw(char             *buffer,
+                                 const DatetimeTz *objects,
+                                 bsl::size_t       numObjects,
+                                 char              separator)
+{
+    BSLS_ASSERT(buffer  || 0 == numObjects);
+    BSLS_ASSERT(objects || 0 == numObjects);
+
+    return generateRaw(buffer,
+                       objects,
+                       numObjects,
+                       separator,
+                       FixUtilConfiguration::defaultConfiguration());
+}
+
 inline
 int FixUtil::parse(Date *result, const bslstl::StringRef& string)
 {
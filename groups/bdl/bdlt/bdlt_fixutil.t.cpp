@@ -19,6 +19,7 @@
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #undef SEC
 
@@ -106,8 +107,14 @@ using namespace bsl;
 // [ 7] int parse(DateTz *result, const StringRef& string);
 // [ 8] int parse(TimeTz *result, const StringRef& string);
 // [ 9] int parse(DatetimeTz *result, const StringRef& string);
+// [10] generateRaw(char *, const Datetime *, size_t, char);
+// [10] generateRaw(char *, const Datetime *, size_t, char, Config);
+// [10] generateRaw(char *, const DatetimeTz *, size_t, char);
+// [10] generateRaw(char *, const DatetimeTz *, size_t, char, Config);
+// [10] parse(Datetime *, const StringRef *, size_t);
+// [10] parse(DatetimeTz *, const StringRef *, size_t);
 //-----------------------------------------------------------------------------
-// [10] USAGE EXAMPLE
+// [11] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -661,7 +668,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -836,6 +843,441 @@ if (veryVerbose)
     ASSERT(         0 == bsl::strcmp(buffer, "20050131-08:59:59+04:00"));
 //..
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // ARRAY CONVERSIONS AND THE PARSING FAST PATH
+        //
+        // Concerns:
+        //: 1 The array 'generateRaw' functions write, for each object, the
+        //:   string written by the corresponding single-object function
+        //:   followed by the separator, and return the total number of
+        //:   characters written.
+        //:
+        //: 2 The array 'generateRaw' functions that do not take a
+        //:   configuration use the process-wide default configuration.
+        //:
+        //: 3 The array 'parse' functions load the values loaded by the
+        //:   corresponding single-value functions, and return the number of
+        //:   strings.
+        //:
+        //: 4 The array 'parse' functions stop at the first string that cannot
+        //:   be parsed, return its index, and leave the result at that index,
+        //:   and all subsequent results, unmodified.
+        //:
+        //: 5 Strings on either side of the boundary of the layout handled by
+        //:   the parsing fast path (e.g., strings having a leap second, seven
+        //:   fractional digits, an abbreviated timezone offset, or no seconds)
+        //:   are parsed correctly.
+        //:
+        //: 6 Null arrays may be supplied when the number of elements is 0.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, specify a set of strings, on
+        //:   either side of the boundary of the fast-path layout, and their
+        //:   expected 'DatetimeTz' values (or that they are invalid).  Parse
+        //:   each string into a 'DatetimeTz', and verify the result.  (C-5)
+        //:
+        //: 2 Form arrays of 'Datetime' and 'DatetimeTz' objects from the cross
+        //:   product of the default date, time, and zone data.  For each
+        //:   configuration, generate each array with the array functions and
+        //:   compare the result with the output of the single-object
+        //:   functions.  (C-1..2)
+        //:
+        //: 3 Parse the strings generated in P-2 with the array functions, and
+        //:   compare the results with those of the single-value functions.
+        //:   Then, replace one string by an invalid string, and verify the
+        //:   return value and that the subsequent results are unmodified.
+        //:   Also invoke the array functions with 0 elements and null arrays.
+        //:   (C-3..4, 6)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments, but not triggered for adjacent
+        //:   valid ones (using the 'BSLS_ASSERTTEST_*' macros).  (C-7)
+        //
+        // Testing:
+        //   generateRaw(char *, const Datetime *, size_t, char);
+        //   generateRaw(char *, const Datetime *, size_t, char, Config);
+        //   generateRaw(char *, const DatetimeTz *, size_t, char);
+        //   generateRaw(char *, const DatetimeTz *, size_t, char, Config);
+        //   parse(Datetime *, const StringRef *, size_t);
+        //   parse(DatetimeTz *, const StringRef *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                    << "ARRAY CONVERSIONS AND THE PARSING FAST PATH" << endl
+                    << "===========================================" << endl;
+
+        if (verbose) cout << "\nStrings at the fast-path boundary." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                const char *d_input;     // input string
+                bool        d_isValid;   // is input valid
+                int         d_year;      // expected year
+                int         d_month;     // expected month
+                int         d_day;       // expected day
+                int         d_hour;      // expected hour
+                int         d_min;       // expected minute
+                int         d_sec;       // expected second
+                int         d_msec;      // expected millisecond
+                int         d_usec;      // expected microsecond
+                int         d_offset;    // expected offset
+            } DATA[] = {
+    //LINE  INPUT                          VALID  YEAR MO DA HR MI SE MSE USE
+    //----  -----------------------------  -----  ---- -- -- -- -- -- --- ---
+    //                                                                   OFF
+    //                                                                   ---
+    { L_,   "20010203-04:05:06",            true, 2001, 2, 3, 4, 5, 6,  0,  0,
+                                                                        0 },
+    { L_,   "20010203-04:05:06.7",          true, 2001, 2, 3, 4, 5, 6,700,  0,
+                                                                        0 },
+    { L_,   "20010203-04:05:06.123456",     true, 2001, 2, 3, 4, 5, 6,123,456,
+                                                                        0 },
+    { L_,   "20010203-04:05:06.1234564",    true, 2001, 2, 3, 4, 5, 6,123,456,
+                                                                        0 },
+    { L_,   "20010203-04:05:06.1234565",    true, 2001, 2, 3, 4, 5, 6,123,457,
+                                                                        0 },
+    { L_,   "20010203-04:05:06.9999995",    true, 2001, 2, 3, 4, 5, 7,  0,  0,
+                                                                        0 },
+    { L_,   "20010203-04:05:06Z",           true, 2001, 2, 3, 4, 5, 6,  0,  0,
+                                                                        0 },
+    { L_,   "20010203-04:05:06+01:30",      true, 2001, 2, 3, 4, 5, 6,  0,  0,
+                                                                       90 },
+    { L_,   "20010203-04:05:06.5-01:30",    true, 2001, 2, 3, 4, 5, 6,500,  0,
+                                                                      -90 },
+    { L_,   "20010203-04:05:06+01",         true, 2001, 2, 3, 4, 5, 6,  0,  0,
+                                                                       60 },
+    { L_,   "20010203-04:05",               true, 2001, 2, 3, 4, 5, 0,  0,  0,
+                                                                        0 },
+    { L_,   "20010203-04:05+01:00",         true, 2001, 2, 3, 4, 5, 0,  0,  0,
+                                                                       60 },
+    { L_,   "20010203-23:59:60",            true, 2001, 2, 4, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "99991231-23:59:59.999999",     true, 9999,12,31,23,59,59,999,999,
+                                                                        0 },
+    { L_,   "00010101-00:00:00.000001",     true,    1, 1, 1, 0, 0, 0,  0,  1,
+                                                                        0 },
+
+    { L_,   "20010203-04:05:06.",          false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "20010230-04:05:06",           false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "00000203-04:05:06",           false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "20010203-24:00:00",           false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "20010203-04:60:06",           false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "20010203-04:05:61",           false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "20010203T04:05:06",           false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "2001/203-04:05:06",           false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "20010203-04:05:0:",           false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "20010203-04:05:06z",          false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "20010203-04:05:06+24:00",     false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "20010203-04:05:06+01:60",     false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "20010203-04:05:06+01:3x",     false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+    { L_,   "20010203-04:05:06Z ",         false,    0, 0, 0, 0, 0, 0,  0,  0,
+                                                                        0 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            const bdlt::DatetimeTz XX(bdlt::Datetime(246, 8, 10), -7);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE   = DATA[ti].d_line;
+                const char *INPUT  = DATA[ti].d_input;
+                const bool  VALID  = DATA[ti].d_isValid;
+
+                if (veryVerbose) { T_ P_(LINE) P_(INPUT) P(VALID) }
+
+                const bdlt::DatetimeTz EXPECTED =
+                    VALID
+                    ? bdlt::DatetimeTz(bdlt::Datetime(DATA[ti].d_year,
+                                                      DATA[ti].d_month,
+                                                      DATA[ti].d_day,
+                                                      DATA[ti].d_hour,
+                                                      DATA[ti].d_min,
+                                                      DATA[ti].d_sec,
+                                                      DATA[ti].d_msec,
+                                                      DATA[ti].d_usec),
+                                       DATA[ti].d_offset)
+                    : XX;
+
+                bdlt::DatetimeTz mX(XX);  const bdlt::DatetimeTz& X = mX;
+
+                const int rc = Util::parse(
+                                         &mX,
+                                         INPUT,
+                                         static_cast<int>(bsl::strlen(INPUT)));
+
+                ASSERTV(LINE, rc, VALID == (0 == rc));
+                ASSERTV(LINE, X, EXPECTED, EXPECTED == X);
+            }
+        }
+
+        if (verbose) cout << "\nArrays of objects." << endl;
+
+        bsl::vector<bdlt::Datetime>   datetimes;
+        bsl::vector<bdlt::DatetimeTz> datetimeTzs;
+
+        for (int ti = 0; ti < NUM_DEFAULT_DATE_DATA; ++ti) {
+            const int YEAR  = DEFAULT_DATE_DATA[ti].d_year;
+            const int MONTH = DEFAULT_DATE_DATA[ti].d_month;
+            const int DAY   = DEFAULT_DATE_DATA[ti].d_day;
+
+            for (int tj = 0; tj < NUM_DEFAULT_TIME_DATA; ++tj) {
+                const int HOUR = DEFAULT_TIME_DATA[tj].d_hour;
+                const int MIN  = DEFAULT_TIME_DATA[tj].d_min;
+                const int SEC  = DEFAULT_TIME_DATA[tj].d_sec;
+                const int MSEC = DEFAULT_TIME_DATA[tj].d_msec;
+                const int USEC = DEFAULT_TIME_DATA[tj].d_usec;
+
+                if (24 == HOUR) {
+                    continue;
+                }
+
+                const bdlt::Datetime DT(YEAR,
+                                        MONTH,
+                                        DAY,
+                                        HOUR,
+                                        MIN,
+                                        SEC,
+                                        MSEC,
+                                        USEC);
+
+                datetimes.push_back(DT);
+
+                for (int tk = 0; tk < NUM_DEFAULT_ZONE_DATA; ++tk) {
+                    const int OFFSET = DEFAULT_ZONE_DATA[tk].d_offset;
+
+                    datetimeTzs.push_back(bdlt::DatetimeTz(DT, OFFSET));
+                }
+            }
+        }
+
+        const bsl::size_t NUM_DT   = datetimes.size();
+        const bsl::size_t NUM_DTTZ = datetimeTzs.size();
+
+        bsl::vector<char> buffer(NUM_DTTZ * (Util::k_MAX_STRLEN + 1));
+
+        for (int tc = 0; tc < NUM_DEFAULT_CNFG_DATA; ++tc) {
+            const int  CLINE     = DEFAULT_CNFG_DATA[tc].d_line;
+            const int  PRECISION = DEFAULT_CNFG_DATA[tc].d_precision;
+            const bool USEZ      = DEFAULT_CNFG_DATA[tc].d_useZ;
+
+            if (veryVerbose) { T_ P_(CLINE) P_(PRECISION) P(USEZ) }
+
+            Config mC;  const Config& C = mC;
+            gg(&mC, PRECISION, USEZ);
+
+            // Set the default configuration to the complement of 'C'.
+
+            Config mDFLT;  const Config& DFLT = mDFLT;
+            gg(&mDFLT, 9 - PRECISION, !USEZ);
+            Config::setDefaultConfiguration(DFLT);
+
+            bsl::string expectedDt;
+            bsl::string expectedDtTz;
+
+            for (bsl::size_t i = 0; i < NUM_DT; ++i) {
+                char      single[Util::k_MAX_STRLEN];
+                const int len = Util::generateRaw(single, datetimes[i], C);
+
+                expectedDt.append(single, len);
+                expectedDt.push_back('\n');
+            }
+            for (bsl::size_t i = 0; i < NUM_DTTZ; ++i) {
+                char      single[Util::k_MAX_STRLEN];
+                const int len = Util::generateRaw(single, datetimeTzs[i], C);
+
+                expectedDtTz.append(single, len);
+                expectedDtTz.push_back('\n');
+            }
+
+            bsl::size_t len = Util::generateRaw(buffer.data(),
+                                                datetimes.data(),
+                                                NUM_DT,
+                                                '\n',
+                                                C);
+            ASSERTV(CLINE, expectedDt.length() == len);
+            ASSERTV(CLINE, expectedDt == bsl::string(buffer.data(), len));
+
+            len = Util::generateRaw(buffer.data(),
+                                    datetimeTzs.data(),
+                                    NUM_DTTZ,
+                                    '\n',
+                                    C);
+            ASSERTV(CLINE, expectedDtTz.length() == len);
+            ASSERTV(CLINE, expectedDtTz == bsl::string(buffer.data(), len));
+
+            // Now use 'C' as the default configuration.
+
+            Config::setDefaultConfiguration(C);
+
+            len = Util::generateRaw(buffer.data(),
+                                    datetimes.data(),
+                                    NUM_DT,
+                                    '\n');
+            ASSERTV(CLINE, expectedDt.length() == len);
+            ASSERTV(CLINE, expectedDt == bsl::string(buffer.data(), len));
+
+            len = Util::generateRaw(buffer.data(),
+                                    datetimeTzs.data(),
+                                    NUM_DTTZ,
+                                    '\n');
+            ASSERTV(CLINE, expectedDtTz.length() == len);
+            ASSERTV(CLINE, expectedDtTz == bsl::string(buffer.data(), len));
+
+            // Parse the strings generated for 'DatetimeTz' objects.
+
+            bsl::vector<StrRef> strings;
+            for (bsl::size_t begin = 0; begin < expectedDtTz.length(); ) {
+                const bsl::size_t end = expectedDtTz.find('\n', begin);
+
+                strings.push_back(StrRef(expectedDtTz.data() + begin,
+                                         end - begin));
+                begin = end + 1;
+            }
+            ASSERTV(CLINE, NUM_DTTZ == strings.size());
+
+            const bdlt::Datetime   XX(246, 8, 10);
+            const bdlt::DatetimeTz ZZ(XX, -7);
+
+            bsl::vector<bdlt::Datetime>   resultsDt(NUM_DTTZ, XX);
+            bsl::vector<bdlt::DatetimeTz> resultsDtTz(NUM_DTTZ, ZZ);
+
+            bsl::size_t numParsedDt = NUM_DTTZ;
+            for (bsl::size_t i = 0; i < NUM_DTTZ; ++i) {
+                bdlt::Datetime   mX(XX);
+                bdlt::DatetimeTz mZ(ZZ);
+
+                if (NUM_DTTZ == numParsedDt
+                 && 0 != Util::parse(&mX, strings[i])) {
+                    numParsedDt = i;
+                }
+                ASSERTV(CLINE, i, 0 == Util::parse(&mZ, strings[i]));
+            }
+
+            ASSERTV(CLINE, numParsedDt == Util::parse(resultsDt.data(),
+                                                      strings.data(),
+                                                      NUM_DTTZ));
+            ASSERTV(CLINE, NUM_DTTZ == Util::parse(resultsDtTz.data(),
+                                                   strings.data(),
+                                                   NUM_DTTZ));
+
+            for (bsl::size_t i = 0; i < NUM_DTTZ; ++i) {
+                bdlt::Datetime   mX(XX);
+                bdlt::DatetimeTz mZ(ZZ);
+
+                if (i < numParsedDt) {
+                    Util::parse(&mX, strings[i]);
+                }
+                Util::parse(&mZ, strings[i]);
+
+                ASSERTV(CLINE, i, mX == resultsDt[i]);
+                ASSERTV(CLINE, i, mZ == resultsDtTz[i]);
+            }
+
+            // Stop at the first string that cannot be parsed.
+
+            const bsl::size_t BAD = NUM_DTTZ / 3;
+
+            strings[BAD] = StrRef("20010230-04:05:06");
+            resultsDtTz.assign(NUM_DTTZ, ZZ);
+
+            ASSERTV(CLINE, BAD == Util::parse(resultsDtTz.data(),
+                                              strings.data(),
+                                              NUM_DTTZ));
+            for (bsl::size_t i = 0; i < NUM_DTTZ; ++i) {
+                bdlt::DatetimeTz mZ(ZZ);
+
+                if (i < BAD) {
+                    Util::parse(&mZ, strings[i]);
+                }
+                ASSERTV(CLINE, i, mZ == resultsDtTz[i]);
+            }
+        }
+
+        Config::setDefaultConfiguration(Config());
+
+        if (verbose) cout << "\nEmpty arrays." << endl;
+        {
+            ASSERT(0 == Util::generateRaw(0,
+                                          static_cast<bdlt::Datetime *>(0),
+                                          0,
+                                          '\n'));
+            ASSERT(0 == Util::generateRaw(0,
+                                          static_cast<bdlt::DatetimeTz *>(0),
+                                          0,
+                                          '\n',
+                                          Config()));
+            const StrRef *const NSTR = 0;
+
+            ASSERT(0 == Util::parse(static_cast<bdlt::Datetime *>(0),
+                                    NSTR,
+                                    0));
+            ASSERT(0 == Util::parse(static_cast<bdlt::DatetimeTz *>(0),
+                                    NSTR,
+                                    0));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Config C;
+
+            char                   buf[Util::k_MAX_STRLEN + 1];
+            const bdlt::Datetime   DT;
+            const bdlt::DatetimeTz DTTZ;
+            const bdlt::Datetime  *NDT   = 0;
+            const bdlt::DatetimeTz *NDTTZ = 0;
+
+            ASSERT_PASS(Util::generateRaw(buf, &DT,   1, ','));
+            ASSERT_FAIL(Util::generateRaw(  0, &DT,   1, ','));
+            ASSERT_FAIL(Util::generateRaw(buf, NDT,   1, ','));
+            ASSERT_PASS(Util::generateRaw(buf, &DT,   1, ',', C));
+            ASSERT_FAIL(Util::generateRaw(  0, &DT,   1, ',', C));
+            ASSERT_FAIL(Util::generateRaw(buf, NDT,   1, ',', C));
+
+            ASSERT_PASS(Util::generateRaw(buf, &DTTZ, 1, ','));
+            ASSERT_FAIL(Util::generateRaw(  0, &DTTZ, 1, ','));
+            ASSERT_FAIL(Util::generateRaw(buf, NDTTZ, 1, ','));
+            ASSERT_PASS(Util::generateRaw(buf, &DTTZ, 1, ',', C));
+            ASSERT_FAIL(Util::generateRaw(  0, &DTTZ, 1, ',', C));
+            ASSERT_FAIL(Util::generateRaw(buf, NDTTZ, 1, ',', C));
+
+            const StrRef GOOD("20010203-04:05:06");
+            const StrRef NULLREF;
+            const StrRef *const NSTR = 0;
+
+            bdlt::Datetime   mX;
+            bdlt::DatetimeTz mZ;
+
+            bdlt::Datetime   *const NX = 0;
+            bdlt::DatetimeTz *const NZ = 0;
+
+            ASSERT_PASS(Util::parse(&mX, &GOOD,    1));
+            ASSERT_FAIL(Util::parse( NX, &GOOD,    1));
+            ASSERT_FAIL(Util::parse(&mX,  NSTR,    1));
+            ASSERT_FAIL(Util::parse(&mX, &NULLREF, 1));
+
+            ASSERT_PASS(Util::parse(&mZ, &GOOD,    1));
+            ASSERT_FAIL(Util::parse( NZ, &GOOD,    1));
+            ASSERT_FAIL(Util::parse(&mZ,  NSTR,    1));
+            ASSERT_FAIL(Util::parse(&mZ, &NULLREF, 1));
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // PARSE: DATETIME & DATETIMETZ
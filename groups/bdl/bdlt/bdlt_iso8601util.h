@@ -379,6 +379,25 @@ BSLS_IDENT("$Id: $")
 //                                                             # not valid)
 //..
 //
+///Arrays of Datetime Values
+///-------------------------
+// 'Iso8601Util' also provides 'generateRaw' and 'parse' overloads that convert
+// arrays of 'Datetime' and 'DatetimeTz' values (e.g., a column of timestamps
+// in a log or a message batch).  The array 'generateRaw' functions write each
+// representation followed by a caller-supplied separator character (e.g.,
+// '\n'), reading the process-wide default configuration once for the entire
+// array when no configuration is supplied.  The array 'parse' functions stop
+// at the first string that cannot be parsed and return its index.
+//
+// Note that parsing a 'Datetime' or 'DatetimeTz' first tries a fast path for
+// strings in the layout produced by the 'generate' functions (i.e.,
+// "YYYY-MM-DDThh:mm:ss", optionally followed by a '.' or ',' and one to six
+// digits, optionally followed by 'Z' or "(+|-)hh:mm"), which validates and
+// converts several fields at a time.  Any string not matching that layout
+// (e.g., one having a leap second, more than six fractional digits, or a
+// lowercase 't') is handled by the general parser; the results are the same
+// in either case.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -557,6 +576,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 
@@ -839,6 +859,42 @@ struct Iso8601Util {
         // is large enough to hold any string generated by this component
         // (counting a null terminator, if any).
 
+    static bsl::size_t generateRaw(
+                             char                            *buffer,
+                             const Datetime                  *objects,
+                             bsl::size_t                      numObjects,
+                             char                             separator);
+    static bsl::size_t generateRaw(
+                             char                            *buffer,
+                             const Datetime                  *objects,
+                             bsl::size_t                      numObjects,
+                             char                             separator,
+                             const Iso8601UtilConfiguration&  configuration);
+    static bsl::size_t generateRaw(
+                             char                            *buffer,
+                             const DatetimeTz                *objects,
+                             bsl::size_t                      numObjects,
+                             char                             separator);
+    static bsl::size_t generateRaw(
+                             char                            *buffer,
+                             const DatetimeTz                *objects,
+                             bsl::size_t                      numObjects,
+                             char                             separator,
+                             const Iso8601UtilConfiguration&  configuration);
+        // Write, to the specified 'buffer', the ISO 8601 representation of
+        // each of the specified 'numObjects' elements of the specified
+        // 'objects' array, in order, each followed by the specified
+        // 'separator' character.  Optionally specify a 'configuration' to
+        // affect the format of the generated strings.  If 'configuration' is
+        // not supplied, the process-wide default value
+        // 'Iso8601UtilConfiguration::defaultConfiguration()' is used (and is
+        // read once for the entire array).  Return the total number of
+        // characters written.  'buffer' is not null terminated.  The behavior
+        // is undefined unless 'objects' refers to an array of at least
+        // 'numObjects' elements, and 'buffer' has sufficient capacity.  Note
+        // that a buffer of size 'numObjects * (k_MAX_STRLEN + 1)' is large
+        // enough to hold the generated strings.
+
     static int parse(bsls::TimeInterval *result,
                      const char         *string,
                      int                 length);
@@ -1115,6 +1171,25 @@ struct Iso8601Util {
         // zone designator must be absent or indicate UTC.  The behavior is
         // undefined unless 'string.data()' is non-null.
 
+    static bsl::size_t parse(Datetime                *results,
+                             const bslstl::StringRef *strings,
+                             bsl::size_t              numStrings);
+    static bsl::size_t parse(DatetimeTz              *results,
+                             const bslstl::StringRef *strings,
+                             bsl::size_t              numStrings);
+        // Parse each of the specified 'numStrings' elements of the specified
+        // 'strings' array, in order, as described for the single-value 'parse'
+        // function of the same result type, and load the value into the
+        // corresponding element of the specified 'results' array.  Stop at the
+        // first element of 'strings' that cannot be parsed.  Return the number
+        // of elements that were successfully parsed; i.e., return 'numStrings'
+        // on success, and the index of the first element of 'strings' that
+        // could not be parsed otherwise (leaving the element of 'results' at
+        // that index, and all subsequent elements, unmodified).  The behavior
+        // is undefined unless 'results' and 'strings' each refer to an array
+        // of at least 'numStrings' elements, and 'strings[i].data()' is
+        // non-null for each such element.
+
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
     static int generate(char              *buffer,
                         const Date&        object,
@@ -1580,6 +1655,38 @@ int Iso8601Util::generateRaw(char *buffer, const DatetimeTz& object)
                        Iso8601UtilConfiguration::defaultConfiguration());
 }
 
+inline
+bsl::size_t Iso8601Util::generateRaw(char           *buffer,
+                                     const Datetime *objects,
+                                     bsl::size_t     numObjects,
+                                     char            separator)
+{
+    BSLS_ASSERT_SAFE(buffer  || 0 == numObjects);
+    BSLS_ASSERT_SAFE(objects || 0 == numObjects);
+
+    return generateRaw(buffer,
+                       objects,
+                       numObjects,
+                       separator,
+                       Iso8601UtilConfiguration::defaultConfiguration());
+}
+
+inline
+bsl::size_t Iso8601Util::generateRaw(char             *buffer,
+                                     const DatetimeTz *objects,
+                                     bsl::size_t       numObjects,
+                                     char              separator)
+{
+    BSLS_ASSERT_SAFE(buffer  || 0 == numObjects);
+    BSLS_ASSERT_SAFE(objects || 0 == numObjects);
+
+    return generateRaw(buffer,
+                       objects,
+                       numObjects,
+                       separator,
+                       Iso8601UtilConfiguration::defaultConfiguration());
+}
+
 inline
 int Iso8601Util::parse(bsls::TimeInterval *result,
                        const bslstl::StringRef& string)
@@ -124,6 +124,7 @@ namespace bsl {
 #include <bslstl_equalto.h>
 #include <bslstl_function.h>
 #include <bslstl_hash.h>
+#include <bslstl_inplacefunction.h>
 #include <bslstl_referencewrapper.h>
 
 #endif
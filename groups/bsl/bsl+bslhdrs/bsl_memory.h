@@ -101,7 +101,9 @@ namespace bsl {
 
 #include <bslmf_allocatorargt.h>
 
+#include <bslstl_atomicsharedptr.h>
 #include <bslstl_badweakptr.h>
+#include <bslstl_localsharedptr.h>
 #include <bslstl_ownerless.h>
 #include <bslstl_sharedptr.h>
 #endif
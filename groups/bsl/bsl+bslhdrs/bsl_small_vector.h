@@ -0,0 +1,38 @@
+// bsl_small_vector.h                                                 -*-C++-*-
+#ifndef INCLUDED_BSL_SMALL_VECTOR
+#define INCLUDED_BSL_SMALL_VECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector having inline storage for a few elements.
+//
+//@SEE_ALSO: package bos+stdhdrs in the bos package group
+//
+//@DESCRIPTION: Provide, in the 'bsl' namespace, the 'small_vector' container,
+// which has no counterpart in the C++ Standard Library, in the manner of the
+// headers providing the standard containers.  This header includes
+// Bloomberg's implementation of 'small_vector'.
+
+#include <bsls_nativestd.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_smallvector.h>
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
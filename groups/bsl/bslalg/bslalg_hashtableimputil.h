@@ -509,6 +509,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 #include <bsls_nativestd.h>
+#include <bsls_performancehint.h>
 #include <bsls_platform.h>
 
 #include <cstddef>
@@ -719,6 +720,28 @@ struct HashTableImpUtil {
         //                  const KEY_CONFIG::KeyType& key2)
         //..
 
+    static void prefetchBucket(const HashTableAnchor& anchor,
+                               native_std::size_t     hashCode);
+        // Hint to the processor to begin loading into the cache the bucket, in
+        // the array of buckets of the specified 'anchor', that holds elements
+        // having the specified 'hashCode'.  This function does not read the
+        // bucket, and has no effect on the observable state of the program.
+        // The behavior is undefined if 'anchor' has 0 buckets.  Note that a
+        // subsequent 'find' for 'hashCode' avoids a cache miss on the bucket
+        // array only if enough time has elapsed for the load to complete;
+        // typically a group of buckets is prefetched before any is probed.
+
+    static void prefetchBucketElements(const HashTableAnchor& anchor,
+                                       native_std::size_t     hashCode);
+        // Hint to the processor to begin loading into the cache the first
+        // element of the bucket, in the array of buckets of the specified
+        // 'anchor', that holds elements having the specified 'hashCode', if
+        // that bucket is not empty.  This function has no effect on the
+        // observable state of the program.  The behavior is undefined if
+        // 'anchor' has 0 buckets.  Note that this function reads the bucket
+        // itself, so it should be called some time after 'prefetchBucket' for
+        // the same 'hashCode'.
+
     template <class KEY_CONFIG, class HASHER>
     static void rehash(HashTableAnchor   *newAnchor,
                        BidirectionalLink *elementList,
@@ -842,6 +865,30 @@ BidirectionalLink *HashTableImpUtil::find(
     return 0;
 }
 
+inline
+void HashTableImpUtil::prefetchBucket(const HashTableAnchor& anchor,
+                                      native_std::size_t     hashCode)
+{
+    BSLS_ASSERT_SAFE(anchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(anchor.bucketArraySize());
+
+    bsls::PerformanceHint::prefetchForReading(
+                                      findBucketForHashCode(anchor, hashCode));
+}
+
+inline
+void HashTableImpUtil::prefetchBucketElements(const HashTableAnchor& anchor,
+                                              native_std::size_t     hashCode)
+{
+    BSLS_ASSERT_SAFE(anchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(anchor.bucketArraySize());
+
+    const HashTableBucket *bucket = findBucketForHashCode(anchor, hashCode);
+    if (bucket->first()) {
+        bsls::PerformanceHint::prefetchForReading(bucket->first());
+    }
+}
+
 template <class KEY_CONFIG, class HASHER>
 void HashTableImpUtil::rehash(HashTableAnchor   *newAnchor,
                               BidirectionalLink *elementList,
@@ -49,6 +49,8 @@ using namespace BloombergLP::bslalg;
 // ----------------------------------------------------------------------------
 // [  ] ...
 // ----------------------------------------------------------------------------
+// [12] prefetchBucket(const HashTableAnchor& a, size_t h);
+// [12] prefetchBucketElements(const HashTableAnchor& a, size_t h);
 // [10] remove(HashTableAnchor *a, BidirectionalLink *l, size_t  h);
 // [10] bucketContainsLink(const Bucket& b, BidirectionalLink *l);
 // [ 9] find(const HashTableAnchor& a, KeyType& key, comparator, size_t h);
@@ -676,7 +678,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -757,6 +759,91 @@ int main(int argc, char *argv[])
         ASSERT(0 == hs.count("chomp"));
 //..
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING 'prefetchBucket' and 'prefetchBucketElements'
+        //
+        // Concerns:
+        //: 1 Both functions may be called for any hash code, whether the
+        //:   corresponding bucket is empty or not.
+        //:
+        //: 2 Neither function modifies the anchor, its buckets, or its list.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Populate an anchor having some empty and some non-empty buckets,
+        //:   and call both functions for a range of hash codes larger than
+        //:   the number of buckets.  (C-1)
+        //:
+        //: 2 Verify that the bucket array compares equal to a copy taken
+        //:   beforehand, and that the anchor remains well-formed.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an anchor with no buckets.  (C-3)
+        //
+        // Testing:
+        //   prefetchBucket(const HashTableAnchor& a, size_t h);
+        //   prefetchBucketElements(const HashTableAnchor& a, size_t h);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("TESTING 'prefetchBucket' and"
+                            " 'prefetchBucketElements'\n"
+                            "============================"
+                            "=========================\n");
+
+        bslma::TestAllocator oa("objectAllocator", veryVeryVeryVerbose);
+
+        typedef BidirectionalNode<int> IntNode;
+        typedef TestSetKeyPolicy<int>  TestPolicy;
+        typedef NodeUtil<int>          IntNodeUtil;
+
+        enum { k_NUM_NODES = 6 };
+        const int VALUES[k_NUM_NODES] = { 0, 8, 1, 9, 17, 3 };
+
+        Bucket buckets[8];
+        memset(buckets, 0, sizeof(buckets));
+
+        Anchor     anchor(buckets, 8, 0);
+        Mod8Hasher hasher;
+
+        IntNode *nodes[k_NUM_NODES];
+        for (int i = 0; i < k_NUM_NODES; ++i) {
+            nodes[i] = IntNodeUtil::create(VALUES[i], &oa);
+            Obj::insertAtBackOfBucket(&anchor, nodes[i], VALUES[i]);
+        }
+        ASSERT((Obj::isWellFormed<TestPolicy>(anchor, hasher)));
+
+        Bucket expected[8];
+        memcpy(expected, buckets, sizeof(buckets));
+        Link *const ROOT = anchor.listRootAddress();
+
+        for (size_t hashCode = 0; hashCode < 32; ++hashCode) {
+            Obj::prefetchBucket(anchor, hashCode);
+            Obj::prefetchBucketElements(anchor, hashCode);
+
+            ASSERTV(hashCode, 0 == memcmp(expected, buckets, sizeof(buckets)));
+            ASSERTV(hashCode, ROOT == anchor.listRootAddress());
+        }
+        ASSERT((Obj::isWellFormed<TestPolicy>(anchor, hasher)));
+        ASSERT(k_NUM_NODES == countElements(anchor.listRootAddress()));
+
+        if (verbose) printf("Negative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Anchor empty(0, 0, 0);
+
+            ASSERT_SAFE_PASS(Obj::prefetchBucket(anchor, 3));
+            ASSERT_SAFE_FAIL(Obj::prefetchBucket(empty, 3));
+            ASSERT_SAFE_PASS(Obj::prefetchBucketElements(anchor, 3));
+            ASSERT_SAFE_FAIL(Obj::prefetchBucketElements(empty, 3));
+        }
+
+        for (int i = 0; i < k_NUM_NODES; ++i) {
+            IntNodeUtil::destroy(nodes[i], &oa);
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING ATTEMPTED USAGE EXAMPLE
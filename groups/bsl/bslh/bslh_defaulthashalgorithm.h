@@ -60,6 +60,18 @@ BSLS_IDENT("$Id: $")
 // write hashes from 'bslh::DefaultHashAlgorithm' to any memory accessible by
 // multiple machines.
 //
+///Selecting the Underlying Algorithm
+///----------------------------------
+// By default, 'bslh::DefaultHashAlgorithm' wraps 'bslh::SpookyHashAlgorithm'.
+// If the macro 'BSLH_DEFAULTHASHALGORITHM_USE_WYHASH' is defined when building
+// (consistently, for every translation unit of the program), it instead wraps
+// 'bslh::WyHashAlgorithm', which is substantially faster for the short keys
+// typical of hash tables.  In that configuration 'bslh::Hash<>', and hence
+// 'bsl::hash' and the 'bsl' unordered containers, hash integral and pointer
+// keys with the one-shot 'bslh::WyHashAlgorithm::hashBytes' (see
+// 'bslh_hash').  Note that the hash values produced differ between the two
+// configurations, which is permitted by the consistency guarantee above.
+//
 ///Usage
 ///-----
 // This section illustrates intended usage of this component.
@@ -280,6 +292,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 
 #include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashalgorithm.h>
 
 namespace BloombergLP {
 
@@ -292,7 +305,11 @@ class DefaultHashAlgorithm {
 
   private:
     // PRIVATE TYPES
+#if defined(BSLH_DEFAULTHASHALGORITHM_USE_WYHASH)
+    typedef bslh::WyHashAlgorithm InternalHashAlgorithm;
+#else
     typedef bslh::SpookyHashAlgorithm InternalHashAlgorithm;
+#endif
         // Typedef indicating the algorithm currently being used by
         // 'bslh::DefualtHashAlgorithm' to compute hashes.  This algorithm is
         // subject to change.
@@ -358,6 +358,13 @@ bool HashTable<TYPE, HASHER>::contains(const TYPE& value) const
 
 typedef DefaultHashAlgorithm Obj;
 
+#if defined(BSLH_DEFAULTHASHALGORITHM_USE_WYHASH)
+typedef WyHashAlgorithm     CanonicalAlgorithm;
+#else
+typedef SpookyHashAlgorithm CanonicalAlgorithm;
+#endif
+    // The algorithm that 'DefaultHashAlgorithm' is configured to wrap.
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -455,7 +462,7 @@ int main(int argc, char *argv[])
                             " correct type using 'bslmf::IsSame'. (C-1)\n");
         {
             ASSERT((bslmf::IsSame<Obj::result_type,
-                                  SpookyHashAlgorithm::result_type>::VALUE));
+                                  CanonicalAlgorithm::result_type>::VALUE));
         }
 
         if (verbose) printf("Declare the expected signature of 'computeHash()'"
@@ -550,7 +557,7 @@ int main(int argc, char *argv[])
 
                 Obj                 contiguousHash;
                 Obj                 dispirateHash;
-                SpookyHashAlgorithm cannonicalHashAlgorithm;
+                CanonicalAlgorithm  cannonicalHashAlgorithm;
 
                 cannonicalHashAlgorithm(VALUE, strlen(VALUE));
                 contiguousHash(VALUE, strlen(VALUE));
@@ -561,7 +568,7 @@ int main(int argc, char *argv[])
                     dispirateHash(&VALUE[j], sizeof(char));
                 }
 
-                SpookyHashAlgorithm::result_type hash =
+                CanonicalAlgorithm::result_type hash =
                                          cannonicalHashAlgorithm.computeHash();
 
                 LOOP_ASSERT(LINE, hash == contiguousHash.computeHash());
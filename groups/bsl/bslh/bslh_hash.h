@@ -125,6 +125,20 @@ BSLS_IDENT("$Id: $")
 // allowed to modify the internal state of the algorithm, meaning calling
 // 'computeHash()' more than once may not return the correct value.
 //
+///Fixed-Size Key Fast Path
+///------------------------
+// Integral (other than 'bool') and pointer keys are always passed to the
+// algorithm in a single call to 'operator()' (see {'hashAppend'}).  Where an
+// algorithm provides a class method that hashes one contiguous sequence of
+// bytes directly, 'bslh::Hash::operator()' calls that method for such keys,
+// bypassing the incremental (buffering) interface.  This is the case for
+// 'bslh::WyHashAlgorithm' (via 'bslh::WyHashAlgorithm::hashBytes'), and for
+// 'bslh::DefaultHashAlgorithm' when it is configured to use
+// 'bslh::WyHashAlgorithm' (see 'bslh_defaulthashalgorithm').  The value
+// returned is identical to that produced through 'hashAppend'.  Note that
+// enumerated keys always go through 'hashAppend', so that an overload
+// provided for an enumeration is honored.
+//
 ///Usage
 ///-----
 // This section illustrates intended usage of this component.
@@ -408,8 +422,10 @@ BSLS_IDENT("$Id: $")
 #include <bslscm_version.h>
 
 #include <bslh_defaulthashalgorithm.h>
+#include <bslh_wyhashalgorithm.h>
 
 #include <bslmf_enableif.h>
+#include <bslmf_integralconstant.h>
 #include <bslmf_isbitwisemoveable.h>
 #include <bslmf_isenum.h>
 #include <bslmf_isfloatingpoint.h>
@@ -428,6 +444,38 @@ namespace BloombergLP {
 
 namespace bslh {
 
+                      // ===============================
+                      // struct bslh::Hash_OneShotTraits
+                      // ===============================
+
+template <class HASH_ALGORITHM>
+struct Hash_OneShotTraits {
+    // This component-private 'struct' identifies, as 'Algorithm', a class
+    // providing a 'hashBytes(const void *, size_t)' class method that returns
+    // the value the (template parameter) 'HASH_ALGORITHM' would compute for a
+    // single contiguous sequence of bytes, or 'void' if there is no such
+    // class.  This primary template identifies no such class.
+
+    typedef void Algorithm;
+};
+
+template <>
+struct Hash_OneShotTraits<WyHashAlgorithm> {
+    // This specialization identifies 'WyHashAlgorithm' itself.
+
+    typedef WyHashAlgorithm Algorithm;
+};
+
+#if defined(BSLH_DEFAULTHASHALGORITHM_USE_WYHASH)
+template <>
+struct Hash_OneShotTraits<DefaultHashAlgorithm> {
+    // This specialization identifies 'WyHashAlgorithm', which
+    // 'DefaultHashAlgorithm' wraps in this configuration.
+
+    typedef WyHashAlgorithm Algorithm;
+};
+#endif
+
                           // ================
                           // class bslh::Hash
                           // ================
@@ -445,6 +493,37 @@ struct Hash {
     typedef HASH_ALGORITHM HashAlgorithm;
         // Make the 'HASH_ALGORITHM' template parameter available to clients.
 
+  private:
+    // PRIVATE TYPES
+    typedef typename Hash_OneShotTraits<HASH_ALGORITHM>::Algorithm
+                                                              OneShotAlgorithm;
+        // Class providing a one-shot 'hashBytes' equivalent to
+        // 'HASH_ALGORITHM', or 'void' if there is none.
+
+    template <class TYPE>
+    struct UseOneShot : bsl::integral_constant<bool,
+                        !bsl::is_same<OneShotAlgorithm, void>::value
+                     && (bsl::is_integral<TYPE>::value ||
+                         bsl::is_pointer<TYPE>::value)
+                     && !bsl::is_same<TYPE, bool>::value> {
+        // This 'struct' is 'true_type' if keys of the (template parameter)
+        // 'TYPE' are to be hashed with 'OneShotAlgorithm::hashBytes', and
+        // 'false_type' otherwise.  Note that enumerated types are excluded, as
+        // they may have a 'hashAppend' overload found by ADL.
+    };
+
+    // PRIVATE CLASS METHODS
+    template <class TYPE>
+    static result_type hashImp(const TYPE& key, bsl::false_type);
+    template <class TYPE>
+    static result_type hashImp(const TYPE& key, bsl::true_type);
+        // Return the hash of the specified 'key', computed by passing 'key'
+        // to 'hashAppend' with a default-constructed 'HASH_ALGORITHM' if the
+        // second argument is of type 'false_type', and with
+        // 'OneShotAlgorithm::hashBytes' otherwise.
+
+  public:
+
     // CREATORS
     //! Hash() = default;
         // Create a 'bslh::Hash' object.
@@ -585,12 +664,32 @@ template <class TYPE>
 inline
 typename bslh::Hash<HASH_ALGORITHM>::result_type
 bslh::Hash<HASH_ALGORITHM>::operator()(TYPE const& key) const
+{
+    return hashImp(key, UseOneShot<TYPE>());
+}
+
+// PRIVATE CLASS METHODS
+template <class HASH_ALGORITHM>
+template <class TYPE>
+inline
+typename bslh::Hash<HASH_ALGORITHM>::result_type
+bslh::Hash<HASH_ALGORITHM>::hashImp(const TYPE& key, bsl::false_type)
 {
     HASH_ALGORITHM hashAlg;
     hashAppend(hashAlg, key);
     return static_cast<result_type>(hashAlg.computeHash());
 }
 
+template <class HASH_ALGORITHM>
+template <class TYPE>
+inline
+typename bslh::Hash<HASH_ALGORITHM>::result_type
+bslh::Hash<HASH_ALGORITHM>::hashImp(const TYPE& key, bsl::true_type)
+{
+    return static_cast<result_type>(
+                               OneShotAlgorithm::hashBytes(&key, sizeof key));
+}
+
 // FREE FUNCTIONS
 template <class HASH_ALGORITHM, class TYPE>
 inline
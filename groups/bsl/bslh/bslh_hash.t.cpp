@@ -3,11 +3,13 @@
 #include <bslh_defaultseededhashalgorithm.h>
 #include <bslh_siphashalgorithm.h>
 #include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashalgorithm.h>
 
 #include <bsls_alignmentfromtype.h>
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <limits>
@@ -48,6 +50,7 @@ using namespace bslh;
 //
 // ACCESSORS
 // [ 4] operator()(const T&) const
+// [ 8] operator()(const T&) const: fixed-size key fast path
 //
 // FREE FUNCTIONS
 // [ 3] void hashAppend(HASHALG& hashAlg, bool input);
@@ -74,11 +77,12 @@ using namespace bslh;
 // [ 3] void hashAppend(HASHALG& hashAlg, RT (*input)(ARGS...));
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [ 6] IsBitwiseMovable trait
 // [ 6] is_trivially_copyable trait
 // [ 6] is_trivially_default_constructible trait
 // [ 7] QoI: Support for empty base optimization
+// [-1] PERFORMANCE: HASHING SHORT KEYS WITH EACH ALGORITHM
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -829,6 +833,57 @@ namespace Z {
 }  // close namespace Z
 
 
+enum FastPathEnum { e_FAST_PATH_A = 1, e_FAST_PATH_B = 0x7fffffff };
+
+namespace W {
+
+enum CustomEnum { e_CUSTOM_A = 1, e_CUSTOM_B = 0x7fffffff };
+
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& hashAlg, CustomEnum value)
+    // Pass the specified 'value', as a 'long long', and a trailing tag to the
+    // specified 'hashAlg'.  This 'hashAppend', found by ADL, produces a value
+    // different from hashing the bytes of 'value', so 'bslh::Hash' must not
+    // bypass it.
+{
+    using bslh::hashAppend;
+    hashAppend(hashAlg, static_cast<long long>(value));
+    hashAppend(hashAlg, 'W');
+}
+
+}  // close namespace W
+
+template <class HASH_ALGORITHM, class TYPE>
+bool matchesHashAppend(const TYPE& key)
+    // Return 'true' if 'bslh::Hash<HASH_ALGORITHM>' produces, for the
+    // specified 'key', the value computed by passing 'key' to 'hashAppend'
+    // with a default-constructed (template parameter) 'HASH_ALGORITHM', and
+    // 'false' otherwise.
+{
+    HASH_ALGORITHM hashAlg;
+    hashAppend(hashAlg, key);
+    return static_cast<size_t>(hashAlg.computeHash())
+                                                == Hash<HASH_ALGORITHM>()(key);
+}
+
+template <class HASH_ALGORITHM, class TYPE>
+double timeHash(const TYPE *keys, int numKeys, int iterations, size_t *sum)
+    // Return the time, in seconds, to hash the specified 'numKeys' elements
+    // of the specified 'keys' array the specified 'iterations' times with
+    // 'bslh::Hash<HASH_ALGORITHM>', and add the hashes to the specified 'sum'.
+{
+    Hash<HASH_ALGORITHM> hasher;
+    bsls::Stopwatch      timer;
+    timer.start();
+    for (int i = 0; i < iterations; ++i) {
+        for (int j = 0; j < numKeys; ++j) {
+            *sum += hasher(keys[j]);
+        }
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -846,7 +901,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   The hashing algorithm can be applied to user defined types which
@@ -901,6 +956,102 @@ int main(int argc, char *argv[])
         ASSERT(!hashTable.contains(Box(Point(3, 3), 3, 3)));
 
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING FIXED-SIZE KEY FAST PATH
+        //   'operator()' hashes integral and pointer keys with the one-shot
+        //   'hashBytes' of algorithms that provide one, and must produce the
+        //   same value as the 'hashAppend' path.
+        //
+        // Concerns:
+        //: 1 For 'WyHashAlgorithm', the hash of each integral, pointer, and
+        //:   enumerated key equals the value obtained by passing the key to
+        //:   'hashAppend' with a default-constructed algorithm.
+        //:
+        //: 2 Keys of types that do not take the fast path ('bool' and
+        //:   floating-point types) are unaffected.
+        //:
+        //: 3 The same holds for 'DefaultHashAlgorithm', whichever algorithm it
+        //:   is configured to wrap, and for algorithms without a one-shot
+        //:   method.
+        //:
+        //: 4 An enumeration having its own 'hashAppend', found by ADL, is
+        //:   hashed with that 'hashAppend', not with 'hashBytes'.
+        //
+        // Plan:
+        //: 1 For a set of keys of each fundamental type, compare the result of
+        //:   'Hash<ALG>::operator()' with that of 'hashAppend' for
+        //:   'WyHashAlgorithm', 'DefaultHashAlgorithm', and
+        //:   'SpookyHashAlgorithm'.  (C-1..3)
+        //:
+        //: 2 Do the same for keys of an enumeration whose 'hashAppend' hashes
+        //:   extra data, and verify that the result differs from the one-shot
+        //:   hash of the key's bytes.  (C-4)
+        //
+        // Testing:
+        //   operator()(const T&) const: fixed-size key fast path
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING FIXED-SIZE KEY FAST PATH"
+                            "\n================================\n");
+
+        const long long VALUES[] = { 0, 1, -1, 42, 0x7f, 0x80, 0xffff,
+                                     0x12345678, -0x12345678,
+                                     0x0123456789abcdefLL };
+        const int       NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        for (int ti = 0; ti < NUM_VALUES; ++ti) {
+            const long long VALUE = VALUES[ti];
+
+            const char           C   = static_cast<char>(VALUE);
+            const unsigned char  UC  = static_cast<unsigned char>(VALUE);
+            const short          S   = static_cast<short>(VALUE);
+            const int            I   = static_cast<int>(VALUE);
+            const unsigned       U   = static_cast<unsigned>(VALUE);
+            const long           L   = static_cast<long>(VALUE);
+            const long long      LL  = VALUE;
+            const wchar_t        W   = static_cast<wchar_t>(VALUE);
+            const FastPathEnum   E   = static_cast<FastPathEnum>(
+                                                       VALUE & 0x7fffffff);
+            const W::CustomEnum  CE  = static_cast<W::CustomEnum>(
+                                                       VALUE & 0x7fffffff);
+            const void          *PTR = reinterpret_cast<const void *>(
+                                             static_cast<size_t>(VALUE));
+            const bool           B   = 0 != VALUE;
+            const double         D   = static_cast<double>(VALUE);
+
+            ASSERTV(ti, matchesHashAppend<WyHashAlgorithm>(C));
+            ASSERTV(ti, matchesHashAppend<WyHashAlgorithm>(UC));
+            ASSERTV(ti, matchesHashAppend<WyHashAlgorithm>(S));
+            ASSERTV(ti, matchesHashAppend<WyHashAlgorithm>(I));
+            ASSERTV(ti, matchesHashAppend<WyHashAlgorithm>(U));
+            ASSERTV(ti, matchesHashAppend<WyHashAlgorithm>(L));
+            ASSERTV(ti, matchesHashAppend<WyHashAlgorithm>(LL));
+            ASSERTV(ti, matchesHashAppend<WyHashAlgorithm>(W));
+            ASSERTV(ti, matchesHashAppend<WyHashAlgorithm>(E));
+            ASSERTV(ti, matchesHashAppend<WyHashAlgorithm>(PTR));
+            ASSERTV(ti, matchesHashAppend<WyHashAlgorithm>(B));
+            ASSERTV(ti, matchesHashAppend<WyHashAlgorithm>(D));
+
+            ASSERTV(ti, matchesHashAppend<DefaultHashAlgorithm>(I));
+            ASSERTV(ti, matchesHashAppend<DefaultHashAlgorithm>(LL));
+            ASSERTV(ti, matchesHashAppend<DefaultHashAlgorithm>(E));
+            ASSERTV(ti, matchesHashAppend<DefaultHashAlgorithm>(PTR));
+            ASSERTV(ti, matchesHashAppend<DefaultHashAlgorithm>(B));
+
+            ASSERTV(ti, matchesHashAppend<SpookyHashAlgorithm>(I));
+            ASSERTV(ti, matchesHashAppend<SpookyHashAlgorithm>(PTR));
+
+            ASSERTV(ti, Hash<WyHashAlgorithm>()(LL) ==
+                           WyHashAlgorithm::hashBytes(&LL, sizeof LL));
+
+            ASSERTV(ti, matchesHashAppend<WyHashAlgorithm>(CE));
+            ASSERTV(ti, matchesHashAppend<DefaultHashAlgorithm>(CE));
+            ASSERTV(ti, matchesHashAppend<SpookyHashAlgorithm>(CE));
+            ASSERTV(ti, Hash<WyHashAlgorithm>()(CE) !=
+                           WyHashAlgorithm::hashBytes(&CE, sizeof CE));
+        }
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // TESTING QOI: IS AN EMPTY TYPE
@@ -1123,8 +1274,16 @@ int main(int argc, char *argv[])
             for (int i = 0; i != NUM_DATA; ++i) {
                 const int    LINE  = DATA[i].d_line;
                 const int    VALUE = DATA[i].d_value;
+#if defined(BSLH_DEFAULTHASHALGORITHM_USE_WYHASH)
+                // The table holds SpookyHash values, but the default algorithm
+                // is configured to be wyhash.
+
+                const size_t HASH  = static_cast<size_t>(
+                             WyHashAlgorithm::hashBytes(&VALUE, sizeof VALUE));
+#else
                 const size_t HASH  =
                                    static_cast<size_t>(DATA[i].d_expectedHash);
+#endif
 
                 if (veryVerbose) printf("Hashing: %i, Expecting: " ZU "\n",
                                         VALUE,
@@ -1811,6 +1970,77 @@ int main(int argc, char *argv[])
             ASSERT(hashAlg(int1) == hashAlg(int2));
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: HASHING SHORT KEYS WITH EACH ALGORITHM
+        //
+        // Concerns:
+        //: 1 Report the cost of hashing 8- to 32-byte keys through
+        //:   'bslh::Hash' with each regular algorithm, so that the choice of
+        //:   default algorithm can be evaluated.
+        //
+        // Plan:
+        //: 1 Time hashing arrays of 64-bit integers and of 16- and 32-byte
+        //:   character arrays with 'Hash<SpookyHashAlgorithm>',
+        //:   'Hash<WyHashAlgorithm>', and 'Hash<>'.  Optionally, the number of
+        //:   iterations may be given as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: HASHING SHORT KEYS WITH EACH ALGORITHM
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: HASHING SHORT KEYS WITH EACH"
+                            " ALGORITHM"
+                            "\n========================================="
+                            "==========\n");
+
+        const int ITERATIONS = argc > 2 && atoi(argv[2]) > 0
+                             ? atoi(argv[2])
+                             : 10 * 1000;
+        enum { k_NUM_KEYS = 1024 };
+
+        typedef bsls::Types::Uint64 Uint64;
+
+        static Uint64 ints[k_NUM_KEYS];
+        static char   chars16[k_NUM_KEYS][16];
+        static char   chars32[k_NUM_KEYS][32];
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            ints[i] = static_cast<Uint64>(i) * 0x9e3779b97f4a7c15ULL;
+            for (int j = 0; j < 32; ++j) {
+                const char c = static_cast<char>('a' + (i + j * 7) % 26);
+                if (j < 16) {
+                    chars16[i][j] = c;
+                }
+                chars32[i][j] = c;
+            }
+        }
+
+        size_t sum = 0;
+
+        printf("%-10s %12s %12s %12s\n",
+               "key", "spooky", "wyhash", "default");
+        printf("%-10s %12.4f %12.4f %12.4f\n", "Uint64",
+               timeHash<SpookyHashAlgorithm>(ints, k_NUM_KEYS, ITERATIONS,
+                                             &sum),
+               timeHash<WyHashAlgorithm>(ints, k_NUM_KEYS, ITERATIONS, &sum),
+               timeHash<DefaultHashAlgorithm>(ints, k_NUM_KEYS, ITERATIONS,
+                                              &sum));
+        printf("%-10s %12.4f %12.4f %12.4f\n", "char[16]",
+               timeHash<SpookyHashAlgorithm>(chars16, k_NUM_KEYS, ITERATIONS,
+                                             &sum),
+               timeHash<WyHashAlgorithm>(chars16, k_NUM_KEYS, ITERATIONS,
+                                         &sum),
+               timeHash<DefaultHashAlgorithm>(chars16, k_NUM_KEYS, ITERATIONS,
+                                              &sum));
+        printf("%-10s %12.4f %12.4f %12.4f\n", "char[32]",
+               timeHash<SpookyHashAlgorithm>(chars32, k_NUM_KEYS, ITERATIONS,
+                                             &sum),
+               timeHash<WyHashAlgorithm>(chars32, k_NUM_KEYS, ITERATIONS,
+                                         &sum),
+               timeHash<DefaultHashAlgorithm>(chars32, k_NUM_KEYS, ITERATIONS,
+                                              &sum));
+        if (veryVerbose) { P(sum) }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
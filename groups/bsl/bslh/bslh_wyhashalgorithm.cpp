@@ -0,0 +1,111 @@
+// bslh_wyhashalgorithm.cpp                                           -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace bslh {
+
+                          // ---------------------------
+                          // class bslh::WyHashAlgorithm
+                          // ---------------------------
+
+// PRIVATE CLASS DATA
+const WyHashAlgorithm::Uint64 WyHashAlgorithm::k_SECRET0;
+const WyHashAlgorithm::Uint64 WyHashAlgorithm::k_SECRET1;
+const WyHashAlgorithm::Uint64 WyHashAlgorithm::k_SECRET2;
+const WyHashAlgorithm::Uint64 WyHashAlgorithm::k_SECRET3;
+
+// PRIVATE CLASS METHODS
+WyHashAlgorithm::Uint64 WyHashAlgorithm::hashLong(const unsigned char *data,
+                                                  size_t numBytes)
+{
+    BSLS_ASSERT_SAFE(16 < numBytes);
+
+    const unsigned char *p    = data;
+    size_t               i    = numBytes;
+    Uint64               seed = initialSeed(0);
+
+    if (i > k_BLOCK_SIZE) {
+        Uint64 see1 = seed;
+        Uint64 see2 = seed;
+        do {
+            seed = mix(read8(p)      ^ k_SECRET1, read8(p + 8)  ^ seed);
+            see1 = mix(read8(p + 16) ^ k_SECRET2, read8(p + 24) ^ see1);
+            see2 = mix(read8(p + 32) ^ k_SECRET3, read8(p + 40) ^ see2);
+            p += k_BLOCK_SIZE;
+            i -= k_BLOCK_SIZE;
+        } while (i > k_BLOCK_SIZE);
+        seed ^= see1 ^ see2;
+    }
+    while (i > 16) {
+        seed = mix(read8(p) ^ k_SECRET1, read8(p + 8) ^ seed);
+        p += 16;
+        i -= 16;
+    }
+    return finalize(read8(p + i - 16), read8(p + i - 8), seed, numBytes);
+}
+
+// PRIVATE MANIPULATORS
+void WyHashAlgorithm::processBlock(const unsigned char *block)
+{
+    d_seed = mix(read8(block)      ^ k_SECRET1, read8(block + 8)  ^ d_seed);
+    d_see1 = mix(read8(block + 16) ^ k_SECRET2, read8(block + 24) ^ d_see1);
+    d_see2 = mix(read8(block + 32) ^ k_SECRET3, read8(block + 40) ^ d_see2);
+}
+
+void WyHashAlgorithm::processInput(const unsigned char *data,
+                                   size_t               numBytes)
+{
+    BSLS_ASSERT_SAFE(k_BLOCK_SIZE < d_bufferLength + numBytes);
+
+    unsigned char *const pending = d_buffer + k_HISTORY_SIZE;
+
+    // A block is processed only once at least one byte is known to follow
+    // it, because the final (possibly full) block of the input is consumed by
+    // 'computeHash' instead.
+
+    if (d_bufferLength) {
+        const size_t fill = k_BLOCK_SIZE - d_bufferLength;
+        memcpy(pending + d_bufferLength, data, fill);
+        data     += fill;
+        numBytes -= fill;
+
+        processBlock(pending);
+        memcpy(d_buffer, pending + k_BLOCK_SIZE - k_HISTORY_SIZE,
+               k_HISTORY_SIZE);
+        d_bufferLength = 0;
+    }
+
+    if (numBytes > k_BLOCK_SIZE) {
+        do {
+            processBlock(data);
+            data     += k_BLOCK_SIZE;
+            numBytes -= k_BLOCK_SIZE;
+        } while (numBytes > k_BLOCK_SIZE);
+        memcpy(d_buffer, data - k_HISTORY_SIZE, k_HISTORY_SIZE);
+    }
+
+    memcpy(pending, data, numBytes);
+    d_bufferLength = numBytes;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
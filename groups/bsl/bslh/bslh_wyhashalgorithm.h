@@ -0,0 +1,538 @@
+// bslh_wyhashalgorithm.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLH_WYHASHALGORITHM
+#define INCLUDED_BSLH_WYHASHALGORITHM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an implementation of the wyhash multiply-mix algorithm.
+//
+//@CLASSES:
+//  bslh::WyHashAlgorithm: functor implementing the wyhash algorithm
+//
+//@SEE_ALSO: bslh_hash, bslh_defaulthashalgorithm, bslh_spookyhashalgorithm
+//
+//@DESCRIPTION: 'bslh::WyHashAlgorithm' implements the "wyhash" algorithm by
+// Wang Yi (final version 4).  The algorithm consumes its input 16 bytes (or,
+// for long input, 48 bytes) at a time, combining each group of words with a
+// 64x64->128 bit multiplication whose high and low halves are folded together
+// ("multiply-mix").  A single such multiplication achieves full avalanche, so
+// very few instructions are needed per byte, and keys of 16 bytes or fewer are
+// hashed with just two multiplications and no loop at all.  This makes the
+// algorithm considerably faster than 'bslh::SpookyHashAlgorithm' for the short
+// keys (integers, pointers, and short strings) that dominate hash table use.
+// For more information, see: https://github.com/wangyi-fudan/wyhash
+//
+// This class satisfies the requirements for regular 'bslh' hashing algorithms
+// and seeded 'bslh' hashing algorithms, defined in 'bslh_hash.h' and
+// 'bslh_seededhash.h' respectively.  More information can be found in the
+// package level documentation for 'bslh'.
+//
+///One-Shot Hashing
+///----------------
+// In addition to the incremental interface required of 'bslh' algorithms,
+// 'bslh::WyHashAlgorithm' provides a class method, 'hashBytes', that hashes a
+// single contiguous sequence of bytes without maintaining any incremental
+// state.  'hashBytes' returns the same value that 'computeHash' would return
+// for a default-constructed object that had been passed the same sequence of
+// bytes (in any number of calls).  'bslh::Hash<bslh::WyHashAlgorithm>' uses
+// 'hashBytes' directly for integral and pointer keys, which are always
+// supplied to the algorithm as a single fixed-size sequence of bytes (see
+// 'bslh_hash').
+//
+///Security
+///--------
+// In this context "security" refers to the ability of the algorithm to produce
+// hashes that are not predictable by an attacker.  Security is a concern when
+// an attacker may be able to provide malicious input into a hash table,
+// thereby causing hashes to collide to buckets, which degrades performance.
+// There are *no* security guarantees made by 'bslh::WyHashAlgorithm', meaning
+// attackers may be able to engineer keys that will cause a Denial of Service
+// (DoS) attack in hash tables using this algorithm, even if they do not know
+// the seed.  If security is required, an algorithm that documents better
+// secure properties should be used, such as 'bslh::SipHashAlgorithm'.
+//
+///Speed
+///-----
+// This algorithm will compute a hash on the order of O(n) where 'n' is the
+// length of the input data.  On platforms providing a 128-bit integer type
+// (such as 64-bit GCC and Clang) the 64x64->128 bit multiplication compiles to
+// a single instruction; on other platforms it is emulated with four 32-bit
+// multiplications, which is slower but produces identical hashes.
+//
+///Hash Distribution
+///-----------------
+// Output hashes will be well distributed and will avalanche, which means
+// changing one bit of the input will change approximately 50% of the output
+// bits.  This will prevent similar values from funneling to the same hash or
+// bucket.
+//
+///Hash Consistency
+///----------------
+// This hash algorithm is endian-specific.  On little-endian machines the
+// hashes produced match those of the canonical implementation using the
+// default secret.  On big-endian machines the Performance and Security
+// Guarantees still apply, however the hashes produced will be different from
+// those produced by the canonical implementation.  It is not recommended to
+// send hashes from 'bslh::WyHashAlgorithm' over a network, or to write them to
+// any memory accessible by multiple machines.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing Short Keys
+///- - - - - - - - - - - - - -
+// Suppose we maintain an index of ticker symbols, which are short strings, and
+// profiling shows that computing the hash of the symbol is a significant
+// fraction of the cost of each lookup.  'bslh::WyHashAlgorithm' hashes such
+// short keys with very few instructions.
+//
+// First, we define the index, using a simple fixed-size array of buckets to
+// keep the example self-contained:
+//..
+//  const char *tickers[] = { "IBM", "MSFT", "AAPL", "GOOG", "BLK" };
+//  const size_t NUM_TICKERS = sizeof tickers / sizeof *tickers;
+//  const size_t NUM_BUCKETS = 64;
+//
+//  const char *buckets[NUM_BUCKETS] = { 0 };
+//..
+// Then, we insert each ticker into the bucket selected by its hash, using
+// linear probing to resolve collisions.  We hash the characters of each ticker
+// by passing them to a 'bslh::WyHashAlgorithm' object:
+//..
+//  for (size_t i = 0; i < NUM_TICKERS; ++i) {
+//      bslh::WyHashAlgorithm hashAlg;
+//      hashAlg(tickers[i], strlen(tickers[i]));
+//      size_t bucket = static_cast<size_t>(hashAlg.computeHash())
+//                                                            % NUM_BUCKETS;
+//      while (buckets[bucket]) {
+//          bucket = (bucket + 1) % NUM_BUCKETS;
+//      }
+//      buckets[bucket] = tickers[i];
+//  }
+//..
+// Next, we look up each ticker, this time computing its hash with the one-shot
+// 'hashBytes' class method, which yields the same value as the incremental
+// interface whenever a key is available as a single contiguous sequence of
+// bytes:
+//..
+//  for (size_t i = 0; i < NUM_TICKERS; ++i) {
+//      size_t bucket = static_cast<size_t>(
+//                        bslh::WyHashAlgorithm::hashBytes(tickers[i],
+//                                                         strlen(tickers[i])))
+//                                                            % NUM_BUCKETS;
+//      while (buckets[bucket] != tickers[i]) {
+//          ASSERT(buckets[bucket]);
+//          bucket = (bucket + 1) % NUM_BUCKETS;
+//      }
+//  }
+//..
+// Finally, we observe that the hash does not depend on how the input is
+// divided between calls to the function-call operator:
+//..
+//  bslh::WyHashAlgorithm whole;
+//  whole("MSFT", 4);
+//
+//  bslh::WyHashAlgorithm pieces;
+//  pieces("MS", 2);
+//  pieces("FT", 2);
+//
+//  ASSERT(whole.computeHash() == pieces.computeHash());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+#include <string.h>  // for 'memcpy'
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                          // ===========================
+                          // class bslh::WyHashAlgorithm
+                          // ===========================
+
+class WyHashAlgorithm {
+    // This class implements the "wyhash" hash algorithm in an interface that
+    // is usable in the modular hashing system in 'bslh'.  Input is buffered
+    // until a full 48-byte block *and* at least one further byte are
+    // available, so that the value returned by 'computeHash' is independent of
+    // how the input is divided between calls to 'operator()'.
+
+  public:
+    // TYPES
+    typedef bsls::Types::Uint64 result_type;
+        // Typedef indicating the value type returned by this algorithm.
+
+    // CONSTANTS
+    enum { k_SEED_LENGTH = 8 }; // Seed length in bytes.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+        // Typedef for a 64-bit integer type used in the hashing algorithm.
+
+    enum {
+        k_HISTORY_SIZE = 16,  // number of already-processed bytes retained
+                              // ahead of the pending input
+
+        k_BLOCK_SIZE   = 48   // number of bytes consumed by each iteration
+                              // of the long-input loop
+    };
+
+    // PRIVATE CLASS DATA
+    static const Uint64 k_SECRET0 = 0x2d358dccaa6c78a5ULL;
+    static const Uint64 k_SECRET1 = 0x8bb84b93962eacc9ULL;
+    static const Uint64 k_SECRET2 = 0x4b33a62ed433d4a3ULL;
+    static const Uint64 k_SECRET3 = 0x4d5a2da51de1aa47ULL;
+        // Default secret of the canonical implementation.
+
+    // DATA
+    Uint64        d_seed;         // running state of the first lane (and the
+                                  // only lane for input of 48 bytes or less)
+
+    Uint64        d_see1;         // running state of the second lane
+
+    Uint64        d_see2;         // running state of the third lane
+
+    size_t        d_totalLength;  // number of bytes passed to 'operator()'
+
+    size_t        d_bufferLength; // number of pending bytes in 'd_buffer'
+                                  // following the history
+
+    unsigned char d_buffer[k_HISTORY_SIZE + k_BLOCK_SIZE];
+                                  // last 'k_HISTORY_SIZE' processed bytes,
+                                  // followed by up to 'k_BLOCK_SIZE' pending
+                                  // bytes
+
+    // NOT IMPLEMENTED
+    WyHashAlgorithm(const WyHashAlgorithm& original); // = delete;
+        // Do not allow copy construction.
+
+    WyHashAlgorithm& operator=(const WyHashAlgorithm& rhs); // = delete;
+        // Do not allow assignment.
+
+    // PRIVATE CLASS METHODS
+    static Uint64 finalize(Uint64 a, Uint64 b, Uint64 seed, size_t length);
+        // Return the hash of an input of the specified 'length' bytes whose
+        // final two words are the specified 'a' and 'b', and whose preceding
+        // words have been accumulated into the specified 'seed'.
+
+    static Uint64 hashLong(const unsigned char *data, size_t numBytes);
+        // Return the hash of the specified 'data' having the specified
+        // 'numBytes'.  The behavior is undefined unless '16 < numBytes'.
+
+    static Uint64 initialSeed(Uint64 seed);
+        // Return the initial state of each lane for the specified 'seed'.
+
+    static Uint64 mix(Uint64 lhs, Uint64 rhs);
+        // Return the exclusive-or of the high and low halves of the 128-bit
+        // product of the specified 'lhs' and 'rhs'.
+
+    static void multiply(Uint64 *lhs, Uint64 *rhs);
+        // Load the low and high halves of the 128-bit product of the values
+        // of the specified 'lhs' and 'rhs' into 'lhs' and 'rhs' respectively.
+
+    static Uint64 read3(const unsigned char *data, size_t numBytes);
+        // Return a word combining the first, middle, and last bytes of the
+        // specified 'data' having the specified 'numBytes'.  The behavior is
+        // undefined unless '1 <= numBytes <= 3'.
+
+    static Uint64 read4(const unsigned char *data);
+        // Return the 32-bit word, in native byte order, at the specified
+        // 'data'.
+
+    static Uint64 read8(const unsigned char *data);
+        // Return the 64-bit word, in native byte order, at the specified
+        // 'data'.
+
+    static Uint64 shortHash(const unsigned char *data,
+                            size_t               numBytes,
+                            Uint64               seed);
+        // Return the hash of the specified 'data' having the specified
+        // 'numBytes' using the specified initial 'seed'.  The behavior is
+        // undefined unless 'numBytes <= 16'.
+
+    // PRIVATE MANIPULATORS
+    void processBlock(const unsigned char *block);
+        // Incorporate the 'k_BLOCK_SIZE' bytes at the specified 'block' into
+        // the three lanes of the running state.
+
+    void processInput(const unsigned char *data, size_t numBytes);
+        // Incorporate the specified 'data' having the specified 'numBytes'
+        // into the running state.  The behavior is undefined unless
+        // 'k_BLOCK_SIZE < d_bufferLength + numBytes'.
+
+  public:
+    // CLASS METHODS
+    static result_type hashBytes(const void *data, size_t numBytes);
+        // Return the hash of the specified 'data' having the specified
+        // 'numBytes', as would be returned by 'computeHash' on a
+        // default-constructed 'WyHashAlgorithm' object after the same bytes
+        // had been passed to 'operator()'.  The behavior is undefined unless
+        // 'data' points to a valid memory location with at least 'numBytes'
+        // bytes of initialized memory or 'numBytes' is zero.
+
+    // CREATORS
+    WyHashAlgorithm();
+        // Create a 'bslh::WyHashAlgorithm' using a default initial seed.
+
+    explicit WyHashAlgorithm(const char *seed);
+        // Create a 'bslh::WyHashAlgorithm', seeded with a 64-bit
+        // ('k_SEED_LENGTH' bytes) seed pointed to by the specified 'seed'.
+        // Each bit of the supplied seed will contribute to the final hash
+        // produced by 'computeHash()'.  The behavior is undefined unless
+        // 'seed' points to at least 8 bytes of initialized memory.
+
+    //! ~WyHashAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Incorporate the specified 'data', of at least the specified
+        // 'numBytes', into the internal state of the hashing algorithm.  Every
+        // bit of data incorporated into the internal state of the algorithm
+        // will contribute to the final hash produced by 'computeHash()'.  The
+        // same hash value will be produced regardless of whether a sequence of
+        // bytes is passed in all at once or through multiple calls to this
+        // member function.  Input where 'numBytes' is 0 will have no effect on
+        // the internal state of the algorithm.  The behaviour is undefined
+        // unless 'data' points to a valid memory location with at least
+        // 'numBytes' bytes of initialized memory or 'numBytes' is zero.
+
+    result_type computeHash();
+        // Return the finalized version of the hash that has been accumulated.
+        // Note that, unlike some other 'bslh' algorithms, calling this method
+        // does not change the internal state of this object, so more data may
+        // be passed to 'operator()' afterwards, and calling 'computeHash()'
+        // again yields the hash of all of the data passed so far.  Also note
+        // that a value will be returned, even if data has not been passed into
+        // 'operator()'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+// PRIVATE CLASS METHODS
+inline
+void WyHashAlgorithm::multiply(Uint64 *lhs, Uint64 *rhs)
+{
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = *lhs;
+    product *= *rhs;
+    *lhs = static_cast<Uint64>(product);
+    *rhs = static_cast<Uint64>(product >> 64);
+#else
+    const Uint64 ha  = *lhs >> 32;
+    const Uint64 hb  = *rhs >> 32;
+    const Uint64 la  = static_cast<unsigned int>(*lhs);
+    const Uint64 lb  = static_cast<unsigned int>(*rhs);
+    const Uint64 rh  = ha * hb;
+    const Uint64 rm0 = ha * lb;
+    const Uint64 rm1 = hb * la;
+    const Uint64 rl  = la * lb;
+    const Uint64 t   = rl + (rm0 << 32);
+    Uint64       c   = t < rl;
+    const Uint64 lo  = t + (rm1 << 32);
+    c += lo < t;
+    *lhs = lo;
+    *rhs = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::mix(Uint64 lhs, Uint64 rhs)
+{
+    multiply(&lhs, &rhs);
+    return lhs ^ rhs;
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::read8(const unsigned char *data)
+{
+    Uint64 result;
+    memcpy(&result, data, sizeof result);
+    return result;
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::read4(const unsigned char *data)
+{
+    unsigned int result;
+    memcpy(&result, data, sizeof result);
+    return result;
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::read3(const unsigned char *data,
+                                               size_t               numBytes)
+{
+    return static_cast<Uint64>(data[0]) << 16
+         | static_cast<Uint64>(data[numBytes >> 1]) << 8
+         | data[numBytes - 1];
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::initialSeed(Uint64 seed)
+{
+    return seed ^ mix(seed ^ k_SECRET0, k_SECRET1);
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::finalize(Uint64 a,
+                                                  Uint64 b,
+                                                  Uint64 seed,
+                                                  size_t length)
+{
+    a ^= k_SECRET1;
+    b ^= seed;
+    multiply(&a, &b);
+    return mix(a ^ k_SECRET0 ^ length, b ^ k_SECRET1);
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::shortHash(
+                                                const unsigned char *data,
+                                                size_t               numBytes,
+                                                Uint64               seed)
+{
+    BSLS_ASSERT_SAFE(numBytes <= 16);
+
+    Uint64 a, b;
+    if (numBytes >= 4) {
+        const size_t offset = (numBytes >> 3) << 2;
+        a = read4(data) << 32 | read4(data + offset);
+        b = read4(data + numBytes - 4) << 32
+          | read4(data + numBytes - 4 - offset);
+    }
+    else if (numBytes > 0) {
+        a = read3(data, numBytes);
+        b = 0;
+    }
+    else {
+        a = b = 0;
+    }
+    return finalize(a, b, seed, numBytes);
+}
+
+// CLASS METHODS
+inline
+WyHashAlgorithm::result_type WyHashAlgorithm::hashBytes(const void *data,
+                                                        size_t      numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    return numBytes <= 16 ? shortHash(bytes, numBytes, initialSeed(0))
+                          : hashLong(bytes, numBytes);
+}
+
+// CREATORS
+inline
+WyHashAlgorithm::WyHashAlgorithm()
+: d_seed(initialSeed(0))
+, d_see1(d_seed)
+, d_see2(d_seed)
+, d_totalLength(0)
+, d_bufferLength(0)
+{
+}
+
+inline
+WyHashAlgorithm::WyHashAlgorithm(const char *seed)
+: d_totalLength(0)
+, d_bufferLength(0)
+{
+    BSLS_ASSERT(seed);
+
+    Uint64 value;
+    memcpy(&value, seed, sizeof value);
+
+    d_seed = initialSeed(value);
+    d_see1 = d_seed;
+    d_see2 = d_seed;
+}
+
+// MANIPULATORS
+inline
+void WyHashAlgorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    d_totalLength += numBytes;
+    if (d_bufferLength + numBytes <= k_BLOCK_SIZE) {
+        if (numBytes) {
+            memcpy(d_buffer + k_HISTORY_SIZE + d_bufferLength, data, numBytes);
+            d_bufferLength += numBytes;
+        }
+    }
+    else {
+        processInput(static_cast<const unsigned char *>(data), numBytes);
+    }
+}
+
+inline
+WyHashAlgorithm::result_type WyHashAlgorithm::computeHash()
+{
+    const unsigned char *p = d_buffer + k_HISTORY_SIZE;
+
+    if (d_totalLength <= 16) {
+        return shortHash(p, d_totalLength, d_seed);                   // RETURN
+    }
+
+    Uint64 seed = d_seed;
+    if (d_totalLength > k_BLOCK_SIZE) {
+        seed ^= d_see1 ^ d_see2;
+    }
+
+    // If a block has been processed, fewer than 16 bytes may be pending, in
+    // which case the final two words overlap the retained history.
+
+    size_t i = d_bufferLength;
+    while (i > 16) {
+        seed = mix(read8(p) ^ k_SECRET1, read8(p + 8) ^ seed);
+        p += 16;
+        i -= 16;
+    }
+    return finalize(read8(p + i - 16), read8(p + i - 8), seed, d_totalLength);
+}
+
+}  // close package namespace
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::WyHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,827 @@
+// bslh_wyhashalgorithm.t.cpp                                         -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace bslh;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a 'bslh' hashing algorithm.  The basic test plan
+// is to compare the output of the function call operator with the expected
+// output generated by an independent, straightforward transcription of the
+// canonical one-shot wyhash function (using the portable 32-bit
+// multiplication, so that the 128-bit code path of the component is checked
+// against it).  Since the component buffers its input, we additionally verify
+// that the result does not depend on how the input is split between calls, and
+// that the one-shot 'hashBytes' class method agrees with the incremental
+// interface.
+//-----------------------------------------------------------------------------
+// TYPEDEF
+// [ 6] typedef bsls::Types::Uint64 result_type;
+//
+// CONSTANTS
+// [ 6] enum { k_SEED_LENGTH = 8 };
+//
+// CLASS METHODS
+// [ 5] static result_type hashBytes(const void *data, size_t numBytes);
+//
+// CREATORS
+// [ 2] WyHashAlgorithm();
+// [ 2] WyHashAlgorithm(const char *seed);
+// [ 2] ~WyHashAlgorithm();
+//
+// MANIPULATORS
+// [ 3] void operator()(void const* key, size_t len);
+// [ 3] result_type computeHash();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: HASH IS INDEPENDENT OF HOW INPUT IS SPLIT
+// [ 6] Trait IsBitwiseMoveable
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: SHORT KEYS
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  PRINTF FORMAT MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ZU BSLS_BSLTESTUTIL_FORMAT_ZU
+
+//=============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef WyHashAlgorithm                  Obj;
+typedef BloombergLP::bsls::Types::Uint64 Uint64;
+
+//=============================================================================
+//                       REFERENCE IMPLEMENTATION
+//-----------------------------------------------------------------------------
+
+namespace {
+
+const Uint64 SECRET[4] = { 0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL,
+                           0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL };
+
+void refMum(Uint64 *A, Uint64 *B)
+    // Portable 64x64->128 bit multiplication from the canonical source.
+{
+    Uint64 ha = *A >> 32, hb = *B >> 32;
+    Uint64 la = static_cast<unsigned int>(*A);
+    Uint64 lb = static_cast<unsigned int>(*B);
+    Uint64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    Uint64 t = rl + (rm0 << 32), c = t < rl;
+    Uint64 lo = t + (rm1 << 32);
+    c += lo < t;
+    Uint64 hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    *A = lo;
+    *B = hi;
+}
+
+Uint64 refMix(Uint64 A, Uint64 B)
+{
+    refMum(&A, &B);
+    return A ^ B;
+}
+
+Uint64 refR8(const unsigned char *p)
+{
+    Uint64 v;
+    memcpy(&v, p, 8);
+    return v;
+}
+
+Uint64 refR4(const unsigned char *p)
+{
+    unsigned int v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+Uint64 refR3(const unsigned char *p, size_t k)
+{
+    return (static_cast<Uint64>(p[0]) << 16)
+         | (static_cast<Uint64>(p[k >> 1]) << 8)
+         | p[k - 1];
+}
+
+Uint64 refWyhash(const void *key, size_t len, Uint64 seed)
+    // Return the canonical wyhash (final version 4) of the specified 'key'
+    // having the specified 'len' bytes, using the specified 'seed' and the
+    // default secret.
+{
+    const unsigned char *p = static_cast<const unsigned char *>(key);
+    seed ^= refMix(seed ^ SECRET[0], SECRET[1]);
+    Uint64 a, b;
+    if (len <= 16) {
+        if (len >= 4) {
+            a = (refR4(p) << 32) | refR4(p + ((len >> 3) << 2));
+            b = (refR4(p + len - 4) << 32)
+              | refR4(p + len - 4 - ((len >> 3) << 2));
+        }
+        else if (len > 0) {
+            a = refR3(p, len);
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        size_t i = len;
+        if (i > 48) {
+            Uint64 see1 = seed, see2 = seed;
+            do {
+                seed = refMix(refR8(p) ^ SECRET[1], refR8(p + 8) ^ seed);
+                see1 = refMix(refR8(p + 16) ^ SECRET[2],
+                              refR8(p + 24) ^ see1);
+                see2 = refMix(refR8(p + 32) ^ SECRET[3],
+                              refR8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = refMix(refR8(p) ^ SECRET[1], refR8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = refR8(p + i - 16);
+        b = refR8(p + i - 8);
+    }
+    a ^= SECRET[1];
+    b ^= seed;
+    refMum(&a, &b);
+    return refMix(a ^ SECRET[0] ^ len, b ^ SECRET[1]);
+}
+
+void fillBuffer(unsigned char *buffer, size_t length, unsigned int seed)
+    // Load pseudo-random bytes derived from the specified 'seed' into the
+    // specified 'buffer' having the specified 'length'.
+{
+    for (size_t i = 0; i < length; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        buffer[i] = static_cast<unsigned char>(seed >> 16);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;      // suppress warning
+    (void)veryVeryVeryVerbose;  // suppress warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The usage example provided in the component header file compiles,
+        //   links, and runs as shown.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing Short Keys
+///- - - - - - - - - - - - - -
+// Suppose we maintain an index of ticker symbols, which are short strings, and
+// profiling shows that computing the hash of the symbol is a significant
+// fraction of the cost of each lookup.  'bslh::WyHashAlgorithm' hashes such
+// short keys with very few instructions.
+//
+// First, we define the index, using a simple fixed-size array of buckets to
+// keep the example self-contained:
+//..
+    const char *tickers[] = { "IBM", "MSFT", "AAPL", "GOOG", "BLK" };
+    const size_t NUM_TICKERS = sizeof tickers / sizeof *tickers;
+    const size_t NUM_BUCKETS = 64;
+
+    const char *buckets[NUM_BUCKETS] = { 0 };
+//..
+// Then, we insert each ticker into the bucket selected by its hash, using
+// linear probing to resolve collisions.  We hash the characters of each ticker
+// by passing them to a 'bslh::WyHashAlgorithm' object:
+//..
+    for (size_t i = 0; i < NUM_TICKERS; ++i) {
+        bslh::WyHashAlgorithm hashAlg;
+        hashAlg(tickers[i], strlen(tickers[i]));
+        size_t bucket = static_cast<size_t>(hashAlg.computeHash())
+                                                              % NUM_BUCKETS;
+        while (buckets[bucket]) {
+            bucket = (bucket + 1) % NUM_BUCKETS;
+        }
+        buckets[bucket] = tickers[i];
+    }
+//..
+// Next, we look up each ticker, this time computing its hash with the one-shot
+// 'hashBytes' class method, which yields the same value as the incremental
+// interface whenever a key is available as a single contiguous sequence of
+// bytes:
+//..
+    for (size_t i = 0; i < NUM_TICKERS; ++i) {
+        size_t bucket = static_cast<size_t>(
+                          bslh::WyHashAlgorithm::hashBytes(tickers[i],
+                                                           strlen(tickers[i])))
+                                                              % NUM_BUCKETS;
+        while (buckets[bucket] != tickers[i]) {
+            ASSERT(buckets[bucket]);
+            bucket = (bucket + 1) % NUM_BUCKETS;
+        }
+    }
+//..
+// Finally, we observe that the hash does not depend on how the input is
+// divided between calls to the function-call operator:
+//..
+    bslh::WyHashAlgorithm whole;
+    whole("MSFT", 4);
+
+    bslh::WyHashAlgorithm pieces;
+    pieces("MS", 2);
+    pieces("FT", 2);
+
+    ASSERT(whole.computeHash() == pieces.computeHash());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'result_type', 'k_SEED_LENGTH', AND TRAITS
+        //
+        // Concerns:
+        //: 1 The typedef 'result_type' is publicly accessible and an alias for
+        //:   'bsls::Types::Uint64'.
+        //:
+        //: 2 'k_SEED_LENGTH' is publicly accessible and equal to 8.
+        //:
+        //: 3 'WyHashAlgorithm' is marked as bitwise moveable.
+        //
+        // Plan:
+        //: 1 ASSERT the typedef is accessible and is the correct type using
+        //:   'bslmf::IsSame'.  (C-1)
+        //:
+        //: 2 Access 'k_SEED_LENGTH' and ASSERT it is equal to the expected
+        //:   value.  (C-2)
+        //:
+        //: 3 ASSERT 'bslmf::IsBitwiseMoveable' is true for the class.  (C-3)
+        //
+        // Testing:
+        //   typedef bsls::Types::Uint64 result_type;
+        //   enum { k_SEED_LENGTH = 8 };
+        //   Trait IsBitwiseMoveable
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'result_type', 'k_SEED_LENGTH', AND"
+                            " TRAITS"
+                            "\n==========================================="
+                            "=======\n");
+
+        ASSERT((bslmf::IsSame<Uint64, Obj::result_type>::VALUE));
+        ASSERT(8 == Obj::k_SEED_LENGTH);
+        ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'hashBytes'
+        //
+        // Concerns:
+        //: 1 'hashBytes' returns the same value as 'computeHash' on a
+        //:   default-constructed object supplied with the same bytes, for
+        //:   lengths on both sides of the 16- and 48-byte boundaries.
+        //:
+        //: 2 'hashBytes' matches the reference implementation.
+        //:
+        //: 3 'hashBytes' accepts unaligned input.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each length in '[0 .. 200]', and each of several offsets
+        //:   into an aligned buffer, compare 'hashBytes' with the incremental
+        //:   interface and with the reference implementation.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null 'data' with a non-zero 'numBytes'.  (C-4)
+        //
+        // Testing:
+        //   static result_type hashBytes(const void *data, size_t numBytes);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'hashBytes'"
+                            "\n===================\n");
+
+        union {
+            Uint64        d_align;
+            unsigned char d_bytes[256];
+        } buffer;
+        fillBuffer(buffer.d_bytes, sizeof buffer.d_bytes, 5);
+
+        for (size_t offset = 0; offset < 8; offset += 3) {
+            for (size_t len = 0; len <= 200; ++len) {
+                const unsigned char *DATA = buffer.d_bytes + offset;
+
+                Obj mX;
+                mX(DATA, len);
+
+                const Uint64 EXP = refWyhash(DATA, len, 0);
+
+                ASSERTV(offset, len, EXP == Obj::hashBytes(DATA, len));
+                ASSERTV(offset, len, EXP == mX.computeHash());
+            }
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj::hashBytes(0, 0));
+            ASSERT_FAIL(Obj::hashBytes(0, 1));
+            ASSERT_PASS(Obj::hashBytes(buffer.d_bytes, 1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: HASH IS INDEPENDENT OF HOW INPUT IS SPLIT
+        //   The algorithm buffers input in 48-byte blocks and keeps a 16-byte
+        //   history of processed input, so every way of dividing the input
+        //   between calls must exercise the same final state.
+        //
+        // Concerns:
+        //: 1 Splitting the input into two pieces at any point yields the same
+        //:   hash as passing the input in one call.
+        //:
+        //: 2 Passing the input one byte at a time, or in chunks of assorted
+        //:   sizes (including chunks that exactly fill, and chunks that
+        //:   span, the internal block), yields the same hash.
+        //:
+        //: 3 Zero-length calls have no effect.
+        //:
+        //: 4 'computeHash' does not disturb the state: more data may be
+        //:   supplied afterwards, and the result again matches.
+        //
+        // Plan:
+        //: 1 For each length in '[0 .. 160]' and each split point, compare the
+        //:   hash of the two-piece input to the reference.  (C-1)
+        //:
+        //: 2 For each length in '[0 .. 300]' and each chunk size in
+        //:   '{1, 3, 16, 47, 48, 49, 100}', supply the input in chunks,
+        //:   interleaving zero-length calls, and compare to the reference.
+        //:   (C-2,3)
+        //:
+        //: 3 While supplying the input one byte at a time, call 'computeHash'
+        //:   after each byte and compare to the reference for the prefix.
+        //:   (C-4)
+        //
+        // Testing:
+        //   CONCERN: HASH IS INDEPENDENT OF HOW INPUT IS SPLIT
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: HASH IS INDEPENDENT OF HOW INPUT IS"
+                            " SPLIT"
+                            "\n============================================"
+                            "======\n");
+
+        unsigned char buffer[300];
+        fillBuffer(buffer, sizeof buffer, 17);
+
+        if (verbose) printf("Two pieces.\n");
+        for (size_t len = 0; len <= 160; ++len) {
+            const Uint64 EXP = refWyhash(buffer, len, 0);
+            for (size_t split = 0; split <= len; ++split) {
+                Obj mX;
+                mX(buffer, split);
+                mX(buffer + split, len - split);
+                ASSERTV(len, split, EXP == mX.computeHash());
+            }
+        }
+
+        if (verbose) printf("Assorted chunk sizes.\n");
+        {
+            const size_t CHUNKS[] = { 1, 3, 16, 47, 48, 49, 100 };
+            const int    NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+
+            for (size_t len = 0; len <= sizeof buffer; ++len) {
+                const Uint64 EXP = refWyhash(buffer, len, 0);
+                for (int ti = 0; ti < NUM_CHUNKS; ++ti) {
+                    const size_t CHUNK = CHUNKS[ti];
+
+                    Obj mX;
+                    for (size_t i = 0; i < len; i += CHUNK) {
+                        mX(buffer + i, len - i < CHUNK ? len - i : CHUNK);
+                        mX(buffer, 0);
+                    }
+                    ASSERTV(len, CHUNK, EXP == mX.computeHash());
+                }
+            }
+        }
+
+        if (verbose) printf("'computeHash' after each byte.\n");
+        {
+            Obj mX;
+            ASSERT(refWyhash(buffer, 0, 0) == mX.computeHash());
+            for (size_t len = 1; len <= sizeof buffer; ++len) {
+                mX(buffer + len - 1, 1);
+                ASSERTV(len, refWyhash(buffer, len, 0) == mX.computeHash());
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator()' AND 'computeHash()'
+        //   Verify that the class offers the ability to invoke it with some
+        //   bytes and a length, and that it returns a hash.
+        //
+        // Concerns:
+        //: 1 The function call operator is callable.
+        //:
+        //: 2 The output of the algorithm matches the reference implementation
+        //:   for the default seed and for supplied seeds.
+        //:
+        //: 3 'computeHash()' returns a value even if no data was supplied.
+        //:
+        //: 4 Distinct inputs, including inputs differing only in length,
+        //:   produce distinct hashes.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Hash a table of strings, of lengths spanning the short, medium,
+        //:   and long code paths, with the default seed and several supplied
+        //:   seeds, and compare with the reference implementation.  (C-1..3)
+        //:
+        //: 2 Hash runs of zero bytes of every length in '[0 .. 100]' and
+        //:   verify that the hashes are distinct.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null 'data' with a non-zero 'numBytes'.  (C-5)
+        //
+        // Testing:
+        //   void operator()(void const* key, size_t len);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'operator()' AND 'computeHash()'"
+                            "\n========================================\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_value;
+        } DATA[] = {
+            // LINE   VALUE
+            // ----   -----
+            {  L_,    ""                                                     },
+            {  L_,    "a"                                                    },
+            {  L_,    "ab"                                                   },
+            {  L_,    "abc"                                                  },
+            {  L_,    "abcd"                                                 },
+            {  L_,    "message"                                              },
+            {  L_,    "abcdefgh"                                             },
+            {  L_,    "0123456789abcdef"                                     },
+            {  L_,    "0123456789abcdefg"                                    },
+            {  L_,    "The quick brown fox jumps over the lazy dog"          },
+            {  L_,    "0123456789abcdef0123456789abcdef0123456789abcdef"     },
+            {  L_,    "0123456789abcdef0123456789abcdef0123456789abcdefX"    },
+            {  L_,    "12345678901234567890123456789012345678901234567890"
+                      "123456789012345678901234567890"                       },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const Uint64 SEEDS[] = { 0, 1, 0xdeadbeefULL, 0x0123456789abcdefULL };
+        const int    NUM_SEEDS = sizeof SEEDS / sizeof *SEEDS;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE  = DATA[ti].d_line;
+            const char *const VALUE = DATA[ti].d_value;
+            const size_t      LEN   = strlen(VALUE);
+
+            Obj mX;
+            mX(VALUE, LEN);
+            const Uint64 HASH = mX.computeHash();
+
+            if (veryVerbose) { P_(LINE) P(HASH) }
+
+            ASSERTV(LINE, refWyhash(VALUE, LEN, 0) == HASH);
+
+            for (int si = 0; si < NUM_SEEDS; ++si) {
+                const Uint64 SEED = SEEDS[si];
+
+                char seed[Obj::k_SEED_LENGTH];
+                memcpy(seed, &SEED, sizeof seed);
+
+                Obj mY(seed);
+                mY(VALUE, LEN);
+                ASSERTV(LINE, si, refWyhash(VALUE, LEN, SEED)
+                                                          == mY.computeHash());
+            }
+        }
+
+        if (verbose) printf("Distinct lengths yield distinct hashes.\n");
+        {
+            unsigned char zeros[100] = { 0 };
+            Uint64        hashes[101];
+            for (size_t len = 0; len <= sizeof zeros; ++len) {
+                Obj mX;
+                mX(zeros, len);
+                hashes[len] = mX.computeHash();
+                for (size_t j = 0; j < len; ++j) {
+                    ASSERTV(len, j, hashes[j] != hashes[len]);
+                }
+            }
+        }
+
+        if (verbose) printf("Negative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+            ASSERT_PASS(mX(0, 0));
+            ASSERT_FAIL(mX(0, 5));
+            ASSERT_PASS(mX("abcde", 5));
+            ASSERT_FAIL(Obj(0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS
+        //   Ensure that the implicit destructor as well as the explicit
+        //   default and seeded constructors are publicly callable.
+        //
+        // Concerns:
+        //: 1 Objects can be created using the default constructor.
+        //:
+        //: 2 Objects can be created using the seeded constructor, and each
+        //:   bit of the seed affects the hash.
+        //:
+        //: 3 The default constructor is equivalent to a zero seed.
+        //:
+        //: 4 Objects can be destroyed.
+        //
+        // Plan:
+        //: 1 Create objects with the default and seeded constructors, and
+        //:   let them go out of scope.  (C-1,4)
+        //:
+        //: 2 Flip each bit of a seed in turn and verify the hash of a fixed
+        //:   input changes.  (C-2)
+        //:
+        //: 3 Compare the hash produced with a zero seed to that produced by
+        //:   a default-constructed object.  (C-3)
+        //
+        // Testing:
+        //   WyHashAlgorithm();
+        //   WyHashAlgorithm(const char *seed);
+        //   ~WyHashAlgorithm();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CREATORS"
+                            "\n================\n");
+
+        const char INPUT[] = "seeded input";
+
+        Obj mD;
+        mD(INPUT, sizeof INPUT);
+        const Uint64 DEFAULT_HASH = mD.computeHash();
+
+        char seed[Obj::k_SEED_LENGTH] = { 0 };
+        {
+            Obj mX(seed);
+            mX(INPUT, sizeof INPUT);
+            ASSERT(DEFAULT_HASH == mX.computeHash());
+        }
+
+        for (int bit = 0; bit < Obj::k_SEED_LENGTH * 8; ++bit) {
+            seed[bit / 8] = static_cast<char>(1 << (bit % 8));
+
+            Obj mX(seed);
+            mX(INPUT, sizeof INPUT);
+            ASSERTV(bit, DEFAULT_HASH != mX.computeHash());
+
+            seed[bit / 8] = 0;
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an instance of 'bslh::WyHashAlgorithm'.  (C-1)
+        //:
+        //: 2 Verify different hashes are produced for different 'int's and
+        //:   the same hash for the same 'int's.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        int int1 = 123456;
+        int int2 = 654321;
+        int int3 = 123456;
+
+        Obj hashAlg1;
+        Obj hashAlg2;
+        Obj hashAlg3;
+        hashAlg1(&int1, sizeof(int));
+        hashAlg2(&int2, sizeof(int));
+        hashAlg3(&int3, sizeof(int));
+
+        const Uint64 H1 = hashAlg1.computeHash();
+        ASSERT(H1 != hashAlg2.computeHash());
+        ASSERT(H1 == hashAlg3.computeHash());
+        ASSERT(H1 == Obj::hashBytes(&int1, sizeof(int)));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SHORT KEYS
+        //
+        // Concerns:
+        //: 1 Hashing keys of 4 to 32 bytes takes only a few nanoseconds, and
+        //:   'hashBytes' is no slower than the incremental interface.
+        //
+        // Plan:
+        //: 1 For key sizes 4, 8, 16, 24, and 32 bytes, time hashing a large
+        //:   number of keys with the incremental interface and with
+        //:   'hashBytes', and report the results.  Optionally, the number of
+        //:   iterations may be given as the second argument.  Note that a
+        //:   comparison with the other 'bslh' algorithms, through
+        //:   'bslh::Hash', is provided by the 'bslh_hash' test driver.
+        //
+        // Testing:
+        //   PERFORMANCE: SHORT KEYS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: SHORT KEYS"
+                            "\n=======================\n");
+
+        const int ITERATIONS = argc > 2 && atoi(argv[2]) > 0
+                             ? atoi(argv[2])
+                             : 10 * 1000 * 1000;
+
+        unsigned char buffer[64 + 32];
+        fillBuffer(buffer, sizeof buffer, 3);
+
+        const size_t SIZES[] = { 4, 8, 16, 24, 32 };
+        const int    NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        printf("%6s %12s %12s\n", "bytes", "incremental", "hashBytes");
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const size_t SIZE = SIZES[ti];
+
+            Uint64          sum = 0;
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                Obj hashAlg;
+                hashAlg(buffer + (i & 63), SIZE);
+                sum += hashAlg.computeHash();
+            }
+            timer.stop();
+            const double INCREMENTAL = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                sum += Obj::hashBytes(buffer + (i & 63), SIZE);
+            }
+            timer.stop();
+            const double ONE_SHOT = timer.elapsedTime();
+
+            printf("%6d %12.4f %12.4f\n",
+                   static_cast<int>(SIZE), INCREMENTAL, ONE_SHOT);
+            if (veryVerbose) { P(sum) }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
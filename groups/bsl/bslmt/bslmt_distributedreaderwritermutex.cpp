@@ -0,0 +1,114 @@
+// bslmt_distributedreaderwritermutex.cpp                             -*-C++-*-
+#include <bslmt_distributedreaderwritermutex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslmt_distributedreaderwritermutex_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// A reader increments its slot and then reads 'd_writerState'; a writer sets
+// 'd_writerState' and then reads every slot.  All four operations are
+// sequentially consistent, so at least one side sees the other: either the
+// writer sees the reader's increment and waits for it, or the reader sees the
+// writer and backs out.  A reader that backs out waits for the writer by
+// locking (and immediately unlocking) 'd_writeMutex', which the writer holds
+// from the start of 'lockWrite' to the end of 'unlockWrite'.
+
+namespace BloombergLP {
+namespace bslmt {
+
+                    // ----------------------------------
+                    // class DistributedReaderWriterMutex
+                    // ----------------------------------
+
+// PRIVATE MANIPULATORS
+void DistributedReaderWriterMutex::lockReadSlow(Slot *slot)
+{
+    do {
+        slot->d_count.addAcqRel(-1);
+        {
+            LockGuard<Mutex> guard(&d_writeMutex);
+        }
+        slot->d_count.add(1);
+    } while (e_NO_WRITER != d_writerState.load());
+}
+
+// CREATORS
+DistributedReaderWriterMutex::DistributedReaderWriterMutex()
+: d_writerState(e_NO_WRITER)
+{
+}
+
+// MANIPULATORS
+void DistributedReaderWriterMutex::lockWrite()
+{
+    d_writeMutex.lock();
+    d_writerState.store(e_PENDING);
+
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        while (0 != d_slots[i].d_count.load()) {
+            ThreadUtil::yield();
+        }
+    }
+
+    d_writerState.store(e_WRITE_LOCK);
+}
+
+int DistributedReaderWriterMutex::tryLockWrite()
+{
+    if (0 != d_writeMutex.tryLock()) {
+        return 1;                                                     // RETURN
+    }
+
+    d_writerState.store(e_PENDING);
+
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        if (0 != d_slots[i].d_count.load()) {
+            d_writerState.storeRelease(e_NO_WRITER);
+            d_writeMutex.unlock();
+            return 1;                                                 // RETURN
+        }
+    }
+
+    d_writerState.store(e_WRITE_LOCK);
+    return 0;
+}
+
+// ACCESSORS
+bool DistributedReaderWriterMutex::isLockedRead() const
+{
+    if (e_WRITE_LOCK == d_writerState.loadAcquire()) {
+        return false;                                                 // RETURN
+    }
+
+    // A reader backing out of its slot while a writer is pending is briefly
+    // counted; 'isLockedRead' is intended for testing, where this is benign.
+
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        if (0 < d_slots[i].d_count.loadAcquire()) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,357 @@
+// bslmt_distributedreaderwritermutex.h                               -*-C++-*-
+
+#ifndef INCLUDED_BSLMT_DISTRIBUTEDREADERWRITERMUTEX
+#define INCLUDED_BSLMT_DISTRIBUTEDREADERWRITERMUTEX
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multi-reader/single-writer lock for read-mostly data.
+//
+//@CLASSES:
+//   bslmt::DistributedReaderWriterMutex: lock with per-thread reader slots
+//
+//@SEE_ALSO: bslmt_readerwritermutex, bslmt_seqlock, bslmt_readlockguard
+//
+//@DESCRIPTION: This component defines a multi-reader/single-writer lock
+// mechanism, 'bslmt::DistributedReaderWriterMutex', for resources that are
+// read very frequently, by many threads, and updated rarely.
+//
+// In 'bslmt::ReaderWriterMutex' and 'bslmt::RWMutex', every reader modifies
+// a single shared state word to acquire and to release the lock, so that the
+// cache line holding it moves between the cores of concurrent readers, and
+// the cost of a read lock grows with the number of cores reading.  A
+// 'bslmt::DistributedReaderWriterMutex' instead counts readers in an array of
+// 'k_NUM_SLOTS' slots, each on its own cache line, and each thread uses the
+// slot selected by a hash of its thread id.  A reader therefore modifies only
+// its own slot (shared with few, if any, other threads), and reads a writer
+// flag that changes only when a writer locks or unlocks the mutex.
+//
+// A writer pays for this: it serializes with other writers on a mutex, sets
+// the writer flag, and then waits, yielding, until the reader count of every
+// slot drops to zero.  Readers that arrive while the writer flag is set back
+// out of their slot and block until the writer unlocks, so a writer waits only
+// for the readers already holding the lock, and writers are not starved.
+// Each object occupies 'k_NUM_SLOTS' cache lines.
+//
+// 'bslmt::DistributedReaderWriterMutex' provides the 'lockRead', 'lockWrite',
+// and 'unlock' methods (and their 'try' variants) expected by
+// 'bslmt::ReadLockGuard' and 'bslmt::WriteLockGuard', and, like
+// 'bslmt::ReaderWriterMutex', is not recursive: the behavior is undefined if
+// a thread that holds a lock on the mutex locks it again.  It does not
+// support upgrading a read lock to a write lock.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Read-Mostly Configuration Table
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that many threads look up configuration values, and that the values
+// are updated rarely.  We protect the table with a
+// 'bslmt::DistributedReaderWriterMutex', so that concurrent lookups do not
+// contend with each other.  Note the typical use of 'mutable' for the lock:
+//..
+//  class my_Config {
+//      // This 'class' holds a set of named integer settings.
+//
+//      // DATA
+//      bsl::map<bsl::string, int>                  d_values;
+//      mutable bslmt::DistributedReaderWriterMutex d_lock;
+//
+//    public:
+//      // MANIPULATORS
+//      void set(const bsl::string& name, int value)
+//          // Set the setting having the specified 'name' to the specified
+//          // 'value'.
+//      {
+//          bslmt::WriteLockGuard<bslmt::DistributedReaderWriterMutex>
+//                                                             guard(&d_lock);
+//          d_values[name] = value;
+//      }
+//
+//      // ACCESSORS
+//      int get(int *value, const bsl::string& name) const
+//          // Load into the specified 'value' the setting having the
+//          // specified 'name', and return 0, or return a non-zero value if
+//          // there is no such setting.
+//      {
+//          bslmt::ReadLockGuard<bslmt::DistributedReaderWriterMutex>
+//                                                             guard(&d_lock);
+//          bsl::map<bsl::string, int>::const_iterator it =
+//                                                        d_values.find(name);
+//          if (d_values.end() == it) {
+//              return 1;                                             // RETURN
+//          }
+//          *value = it->second;
+//          return 0;
+//      }
+//  };
+//..
+// Then, we use the table:
+//..
+//  my_Config config;
+//  config.set("timeout", 30);
+//
+//  int value = 0;
+//  assert(0 == config.get(&value, "timeout"));
+//  assert(30 == value);
+//  assert(0 != config.get(&value, "retries"));
+//..
+
+#include <bslscm_version.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bslmt {
+
+                  // ========================================
+                  // struct DistributedReaderWriterMutex_Slot
+                  // ========================================
+
+struct DistributedReaderWriterMutex_Slot {
+    // This component-private 'struct' holds the number of readers holding,
+    // or attempting to acquire, a 'DistributedReaderWriterMutex' through one
+    // slot, alone on its cache line.
+
+    // PUBLIC DATA
+    bsls::AtomicInt d_count;  // number of readers using this slot
+
+    char            d_pad[  Platform::e_CACHE_LINE_SIZE
+                          - sizeof(bsls::AtomicInt)];
+                              // padding to prevent false sharing
+};
+
+                     // ==================================
+                     // class DistributedReaderWriterMutex
+                     // ==================================
+
+class DistributedReaderWriterMutex {
+    // This class provides a multi-reader/single-writer lock mechanism in
+    // which readers are counted in per-thread slots.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_LOG2_NUM_SLOTS = 4,                      // log2 of 'k_NUM_SLOTS'
+        k_NUM_SLOTS      = 1 << k_LOG2_NUM_SLOTS   // number of reader slots
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef DistributedReaderWriterMutex_Slot Slot;
+
+    enum WriterState {
+        e_NO_WRITER  = 0,  // no writer holds or is acquiring the lock
+        e_PENDING    = 1,  // a writer is waiting for readers to leave
+        e_WRITE_LOCK = 2   // a writer holds the lock
+    };
+
+    // DATA
+    Slot            d_slots[k_NUM_SLOTS];  // reader counts
+
+    bsls::AtomicInt d_writerState;         // 'WriterState' of this mutex
+
+    Mutex           d_writeMutex;          // serializes writers, and blocks
+                                           // readers while a writer is
+                                           // active
+
+    // NOT IMPLEMENTED
+    DistributedReaderWriterMutex(const DistributedReaderWriterMutex&);
+    DistributedReaderWriterMutex& operator=(
+                                          const DistributedReaderWriterMutex&);
+
+    // PRIVATE CLASS METHODS
+    static int slotIndex();
+        // Return the index of the slot used by the calling thread.
+
+    // PRIVATE MANIPULATORS
+    void lockReadSlow(Slot *slot);
+        // Wait until no writer holds or is acquiring this mutex, and then lock
+        // it for reading through the specified 'slot', which the calling
+        // thread has incremented and in which it has seen a writer.
+
+  public:
+    // CREATORS
+    DistributedReaderWriterMutex();
+        // Create a reader/writer lock initialized to an unlocked state.
+
+    //! ~DistributedReaderWriterMutex() = default;
+        // Destroy this object.  The behavior is undefined unless this object
+        // is unlocked.
+
+    // MANIPULATORS
+    void lockRead();
+        // Lock this mutex for reading.  If no writer holds or is acquiring a
+        // write lock, return immediately; otherwise, block until the writer
+        // releases it.  Use 'unlockRead' or 'unlock' to release the lock.  The
+        // behavior is undefined if this method is called from a thread that
+        // already has a lock on this mutex.
+
+    void lockWrite();
+        // Lock this mutex for writing.  Block until no other writer holds the
+        // lock and every reader holding it has released it; readers that
+        // arrive in the meantime wait for this writer.  Use 'unlockWrite' or
+        // 'unlock' to release the lock.  The behavior is undefined if this
+        // method is called from a thread that already has a lock on this
+        // mutex.
+
+    int tryLockRead();
+        // Attempt to lock this mutex for reading.  Immediately return 0 on
+        // success, and a non-zero value if a writer holds or is acquiring the
+        // lock.  If successful, 'unlockRead' or 'unlock' must be used to
+        // release the lock.  The behavior is undefined if this method is
+        // called from a thread that already has a lock on this mutex.
+
+    int tryLockWrite();
+        // Attempt to lock this mutex for writing.  Immediately return 0 on
+        // success, and a non-zero value if the mutex is locked.  If
+        // successful, 'unlockWrite' or 'unlock' must be used to release the
+        // lock.  The behavior is undefined if this method is called from a
+        // thread that already has a lock on this mutex.
+
+    void unlock();
+        // Release the lock that the calling thread holds on this mutex.  The
+        // behavior is undefined unless the calling thread currently has a lock
+        // on this mutex.
+
+    void unlockRead();
+        // Release the read lock that the calling thread holds on this mutex.
+        // The behavior is undefined unless the calling thread currently has a
+        // read lock on this mutex.
+
+    void unlockWrite();
+        // Release the write lock that the calling thread holds on this mutex.
+        // The behavior is undefined unless the calling thread currently has a
+        // write lock on this mutex.
+
+    // ACCESSORS
+    bool isLocked() const;
+        // Return 'true' if this mutex is currently read locked or write
+        // locked, and 'false' otherwise.  Note that this method is intended
+        // for testing, and its result may be out of date on return.
+
+    bool isLockedRead() const;
+        // Return 'true' if this mutex is currently read locked, and 'false'
+        // otherwise.  Note that this method is intended for testing, and its
+        // result may be out of date on return.
+
+    bool isLockedWrite() const;
+        // Return 'true' if this mutex is currently write locked, and 'false'
+        // otherwise.  Note that this method is intended for testing, and its
+        // result may be out of date on return.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                     // ----------------------------------
+                     // class DistributedReaderWriterMutex
+                     // ----------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+int DistributedReaderWriterMutex::slotIndex()
+{
+    // Thread ids are often addresses, whose low-order bits are equal; a
+    // multiplicative hash brings the high-order bits into play.
+
+    const bsls::Types::Uint64 id = ThreadUtil::selfIdAsUint64();
+
+    return static_cast<int>((id * 0x9E3779B97F4A7C15ULL)
+                                                   >> (64 - k_LOG2_NUM_SLOTS));
+}
+
+// MANIPULATORS
+inline
+void DistributedReaderWriterMutex::lockRead()
+{
+    Slot *slot = &d_slots[slotIndex()];
+
+    // The sequentially consistent increment and load pair with the store and
+    // loads of 'lockWrite': either the writer sees this reader, or this
+    // reader sees the writer.
+
+    slot->d_count.add(1);
+    if (e_NO_WRITER != d_writerState.load()) {
+        lockReadSlow(slot);
+    }
+}
+
+inline
+int DistributedReaderWriterMutex::tryLockRead()
+{
+    Slot *slot = &d_slots[slotIndex()];
+
+    slot->d_count.add(1);
+    if (e_NO_WRITER != d_writerState.load()) {
+        slot->d_count.addAcqRel(-1);
+        return 1;                                                     // RETURN
+    }
+    return 0;
+}
+
+inline
+void DistributedReaderWriterMutex::unlock()
+{
+    if (e_WRITE_LOCK == d_writerState.loadRelaxed()) {
+        unlockWrite();
+    }
+    else {
+        unlockRead();
+    }
+}
+
+inline
+void DistributedReaderWriterMutex::unlockRead()
+{
+    d_slots[slotIndex()].d_count.addAcqRel(-1);
+}
+
+inline
+void DistributedReaderWriterMutex::unlockWrite()
+{
+    d_writerState.storeRelease(e_NO_WRITER);
+    d_writeMutex.unlock();
+}
+
+// ACCESSORS
+inline
+bool DistributedReaderWriterMutex::isLocked() const
+{
+    return isLockedWrite() || isLockedRead();
+}
+
+inline
+bool DistributedReaderWriterMutex::isLockedWrite() const
+{
+    return e_WRITE_LOCK == d_writerState.loadAcquire();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,639 @@
+// bslmt_distributedreaderwritermutex.t.cpp                           -*-C++-*-
+
+#include <bslmt_distributedreaderwritermutex.h>
+
+#include <bslmt_readlockguard.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
+#include <bslmt_writelockguard.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_atomic.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// A 'bslmt::DistributedReaderWriterMutex' counts readers in per-thread slots
+// and serializes writers on a mutex.  The manipulators are tested with helper
+// threads holding, or waiting for, a lock, so that each method can be
+// observed to succeed, fail, or block as documented; in particular, a writer
+// waiting for a reader must make new readers wait.  The accessors are tested
+// by corroborating the states put in place by the manipulators.  Finally,
+// mutual exclusion is verified by reader and writer threads that check, under
+// the lock, counts of the threads inside their critical sections.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] DistributedReaderWriterMutex();
+// [ 2] ~DistributedReaderWriterMutex();
+//
+// MANIPULATORS
+// [ 2] void lockRead();
+// [ 2] void lockWrite();
+// [ 2] int tryLockRead();
+// [ 2] int tryLockWrite();
+// [ 2] void unlock();
+// [ 2] void unlockRead();
+// [ 2] void unlockWrite();
+//
+// ACCESSORS
+// [ 3] bool isLocked() const;
+// [ 3] bool isLockedRead() const;
+// [ 3] bool isLockedWrite() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: readers and writers are mutually excluded
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslmt::DistributedReaderWriterMutex Obj;
+
+// ============================================================================
+//                   GLOBAL STRUCTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct ThreadData {
+    bslmt::ThreadUtil::Handle  d_handle;
+    bslmt::Semaphore           d_step;
+    bslmt::Semaphore           d_stepDone;
+    Obj                       *d_mutex_p;
+
+    ThreadData() : d_mutex_p(0) {}
+
+    explicit ThreadData(Obj *pObj) : d_mutex_p(pObj) {}
+};
+
+struct StressData {
+    Obj             *d_mutex_p;
+    bsls::AtomicInt  d_numReaders;     // readers in their critical section
+    bsls::AtomicInt  d_numWriters;     // writers in their critical section
+    int              d_first;          // modified by writers only
+    int              d_second;         // modified by writers only, equal to
+                                       // 'd_first' outside a write lock
+    int              d_numIterations;  // per thread
+};
+
+// ============================================================================
+//                   GLOBAL METHODS FOR TESTING
+// ----------------------------------------------------------------------------
+
+extern "C" void *writeLock(void *arg)
+{
+    ThreadData *data = static_cast<ThreadData *>(arg);
+
+    data->d_step.wait();
+    data->d_mutex_p->lockWrite();
+    data->d_stepDone.post();
+
+    data->d_step.wait();
+    data->d_mutex_p->unlock();
+    data->d_stepDone.post();
+
+    return 0;
+}
+
+extern "C" void *readLock(void *arg)
+{
+    ThreadData *data = static_cast<ThreadData *>(arg);
+
+    data->d_step.wait();
+    data->d_mutex_p->lockRead();
+    data->d_stepDone.post();
+
+    data->d_step.wait();
+    data->d_mutex_p->unlock();
+    data->d_stepDone.post();
+
+    return 0;
+}
+
+extern "C" void *stressReader(void *arg)
+{
+    StressData *data = static_cast<StressData *>(arg);
+
+    for (int i = 0; i < data->d_numIterations; ++i) {
+        bslmt::ReadLockGuard<Obj> guard(data->d_mutex_p);
+
+        data->d_numReaders.add(1);
+        ASSERT(0 == data->d_numWriters.load());
+        ASSERTV(data->d_first, data->d_second,
+                data->d_first == data->d_second);
+        data->d_numReaders.add(-1);
+    }
+
+    return 0;
+}
+
+extern "C" void *stressWriter(void *arg)
+{
+    StressData *data = static_cast<StressData *>(arg);
+
+    for (int i = 0; i < data->d_numIterations / 10; ++i) {
+        bslmt::WriteLockGuard<Obj> guard(data->d_mutex_p);
+
+        ASSERT(1 == data->d_numWriters.add(1));
+        ASSERT(0 == data->d_numReaders.load());
+        ++data->d_first;
+        bslmt::ThreadUtil::yield();
+        ++data->d_second;
+        data->d_numWriters.add(-1);
+    }
+
+    return 0;
+}
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Read-Mostly Configuration Table
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that many threads look up configuration values, and that the values
+// are updated rarely.  We protect the table with a
+// 'bslmt::DistributedReaderWriterMutex', so that concurrent lookups do not
+// contend with each other.  Note the typical use of 'mutable' for the lock:
+//..
+    class my_Config {
+        // This 'class' holds a set of named integer settings.
+
+        // DATA
+        bsl::map<bsl::string, int>                  d_values;
+        mutable bslmt::DistributedReaderWriterMutex d_lock;
+
+      public:
+        // MANIPULATORS
+        void set(const bsl::string& name, int value)
+            // Set the setting having the specified 'name' to the specified
+            // 'value'.
+        {
+            bslmt::WriteLockGuard<bslmt::DistributedReaderWriterMutex>
+                                                               guard(&d_lock);
+            d_values[name] = value;
+        }
+
+        // ACCESSORS
+        int get(int *value, const bsl::string& name) const
+            // Load into the specified 'value' the setting having the
+            // specified 'name', and return 0, or return a non-zero value if
+            // there is no such setting.
+        {
+            bslmt::ReadLockGuard<bslmt::DistributedReaderWriterMutex>
+                                                               guard(&d_lock);
+            bsl::map<bsl::string, int>::const_iterator it =
+                                                          d_values.find(name);
+            if (d_values.end() == it) {
+                return 1;                                             // RETURN
+            }
+            *value = it->second;
+            return 0;
+        }
+    };
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we use the table:
+//..
+    my_Config config;
+    config.set("timeout", 30);
+
+    int value = 0;
+    ASSERT(0 == config.get(&value, "timeout"));
+    ASSERT(30 == value);
+    ASSERT(0 != config.get(&value, "retries"));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: READERS AND WRITERS ARE MUTUALLY EXCLUDED
+        //
+        // Concerns:
+        //: 1 No reader holds the lock while a writer holds it.
+        //:
+        //: 2 At most one writer holds the lock at a time.
+        //:
+        //: 3 Readers observe data modified under the write lock in a
+        //:   consistent state.
+        //
+        // Plan:
+        //: 1 Create several reader threads and two writer threads that
+        //:   repeatedly acquire the lock through the guards.  Each thread
+        //:   maintains an atomic count of the readers, or of the writers, in
+        //:   their critical section, and verifies the counts of the other
+        //:   kind of thread.  Writers increment two integers, yielding in
+        //:   between, and readers verify that they are equal.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: readers and writers are mutually excluded
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                     << "CONCERN: READERS AND WRITERS ARE MUTUALLY EXCLUDED"
+                     << endl
+                     << "=================================================="
+                     << endl;
+
+        enum { k_NUM_READERS = 8, k_NUM_WRITERS = 2 };
+
+        Obj        mX;
+        StressData data;
+
+        data.d_mutex_p       = &mX;
+        data.d_first         = 0;
+        data.d_second        = 0;
+        data.d_numIterations = 20000;
+
+        bslmt::ThreadUtil::Handle readers[k_NUM_READERS];
+        bslmt::ThreadUtil::Handle writers[k_NUM_WRITERS];
+
+        for (int i = 0; i < k_NUM_READERS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&readers[i],
+                                                  stressReader,
+                                                  &data));
+        }
+        for (int i = 0; i < k_NUM_WRITERS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&writers[i],
+                                                  stressWriter,
+                                                  &data));
+        }
+        for (int i = 0; i < k_NUM_READERS; ++i) {
+            bslmt::ThreadUtil::join(readers[i]);
+        }
+        for (int i = 0; i < k_NUM_WRITERS; ++i) {
+            bslmt::ThreadUtil::join(writers[i]);
+        }
+
+        const int EXP = k_NUM_WRITERS * (data.d_numIterations / 10);
+
+        ASSERTV(data.d_first,  EXP == data.d_first);
+        ASSERTV(data.d_second, EXP == data.d_second);
+        ASSERT(false == mX.isLocked());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each accessor reports the state of the lock.
+        //:
+        //: 2 Each accessor is 'const' qualified.
+        //
+        // Plan:
+        //: 1 An ad-hoc sequence of (previously tested) lock and unlock
+        //:   operations, by this thread and by a helper thread, is used to put
+        //:   a test object into different states.  The accessors are used to
+        //:   corroborate those states.  (C-1)
+        //:
+        //: 2 Each accessor invocation is done via a 'const'-reference to the
+        //:   object under test.  (C-2)
+        //
+        // Testing:
+        //   bool isLocked() const;
+        //   bool isLockedRead() const;
+        //   bool isLockedWrite() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ACCESSORS" << endl
+                          << "=========" << endl;
+
+        Obj mX; const Obj& X = mX;
+        ASSERT(false == X.isLocked());
+        ASSERT(false == X.isLockedRead());
+        ASSERT(false == X.isLockedWrite());
+
+        mX.lockRead();
+        ASSERT(true  == X.isLocked());
+        ASSERT(true  == X.isLockedRead());
+        ASSERT(false == X.isLockedWrite());
+
+        {
+            ThreadData t(&mX);
+
+            bslmt::ThreadUtil::create(&t.d_handle, readLock, &t);
+
+            t.d_step.post();
+            t.d_stepDone.wait();
+
+            mX.unlock();
+            ASSERT(true  == X.isLocked());
+            ASSERT(true  == X.isLockedRead());
+            ASSERT(false == X.isLockedWrite());
+
+            t.d_step.post();
+            t.d_stepDone.wait();
+
+            bslmt::ThreadUtil::join(t.d_handle);
+        }
+        ASSERT(false == X.isLocked());
+        ASSERT(false == X.isLockedRead());
+        ASSERT(false == X.isLockedWrite());
+
+        mX.lockWrite();
+        ASSERT(true  == X.isLocked());
+        ASSERT(false == X.isLockedRead());
+        ASSERT(true  == X.isLockedWrite());
+
+        mX.unlock();
+        ASSERT(false == X.isLocked());
+        ASSERT(false == X.isLockedRead());
+        ASSERT(false == X.isLockedWrite());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND MANIPULATORS
+        //
+        // Concerns:
+        //: 1 A read lock excludes writers but not other readers.
+        //:
+        //: 2 A write lock excludes readers and other writers.
+        //:
+        //: 3 A writer waiting for readers to release the lock makes new
+        //:   readers wait, and acquires the lock once they have released it.
+        //:
+        //: 4 'unlock' releases a read lock or a write lock, as appropriate.
+        //
+        // Plan:
+        //: 1 Have a helper thread acquire a read lock, and verify that this
+        //:   thread can acquire a read lock but not a write lock.  (C-1, 4)
+        //:
+        //: 2 Have a helper thread acquire a write lock, and verify that this
+        //:   thread can acquire neither lock until it is released.  (C-2, 4)
+        //:
+        //: 3 Have a helper thread acquire a read lock and another block in
+        //:   'lockWrite', and verify that 'tryLockRead' eventually fails.
+        //:   Release the read lock and verify that the second helper thread
+        //:   acquires the write lock.  (C-3)
+        //
+        // Testing:
+        //   DistributedReaderWriterMutex();
+        //   ~DistributedReaderWriterMutex();
+        //   void lockRead();
+        //   void lockWrite();
+        //   int tryLockRead();
+        //   int tryLockWrite();
+        //   void unlock();
+        //   void unlockRead();
+        //   void unlockWrite();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND MANIPULATORS" << endl
+                          << "=========================" << endl;
+
+        if (verbose) cout << "\nA helper thread holds a read lock." << endl;
+        {
+            Obj        obj;
+            ThreadData t(&obj);
+
+            bslmt::ThreadUtil::create(&t.d_handle, readLock, &t);
+
+            t.d_step.post();
+            t.d_stepDone.wait();
+
+            obj.lockRead();
+            obj.unlockRead();
+
+            ASSERT(0 == obj.tryLockRead());
+            obj.unlock();
+
+            ASSERT(1 == obj.tryLockWrite());
+
+            t.d_step.post();
+            t.d_stepDone.wait();
+
+            ASSERT(0 == obj.tryLockWrite());
+            obj.unlockWrite();
+
+            bslmt::ThreadUtil::join(t.d_handle);
+        }
+
+        if (verbose) cout << "\nA helper thread holds a write lock." << endl;
+        {
+            Obj        obj;
+            ThreadData t(&obj);
+
+            bslmt::ThreadUtil::create(&t.d_handle, writeLock, &t);
+
+            t.d_step.post();
+            t.d_stepDone.wait();
+
+            ASSERT(1 == obj.tryLockRead());
+            ASSERT(1 == obj.tryLockWrite());
+
+            t.d_step.post();
+            t.d_stepDone.wait();
+
+            ASSERT(0 == obj.tryLockRead());
+            obj.unlock();
+
+            obj.lockWrite();
+            obj.unlock();
+
+            bslmt::ThreadUtil::join(t.d_handle);
+        }
+
+        if (verbose) cout << "\nA writer waits for a reader." << endl;
+        {
+            Obj        obj;
+            ThreadData r(&obj);
+            ThreadData w(&obj);
+
+            bslmt::ThreadUtil::create(&r.d_handle, readLock, &r);
+            bslmt::ThreadUtil::create(&w.d_handle, writeLock, &w);
+
+            r.d_step.post();
+            r.d_stepDone.wait();
+
+            w.d_step.post();
+
+            // Wait, for up to 10 seconds, for the writer to announce itself.
+
+            int rc    = 0;
+            int count = 0;
+            while (0 == (rc = obj.tryLockRead()) && count < 1000) {
+                obj.unlockRead();
+                bslmt::ThreadUtil::microSleep(10000);
+                ++count;
+            }
+            ASSERTV(count, 1 == rc);
+            ASSERT(false == obj.isLockedWrite());
+
+            r.d_step.post();
+            r.d_stepDone.wait();
+
+            w.d_stepDone.wait();
+            ASSERT(true == obj.isLockedWrite());
+            ASSERT(1    == obj.tryLockRead());
+
+            w.d_step.post();
+            w.d_stepDone.wait();
+
+            ASSERT(false == obj.isLocked());
+
+            bslmt::ThreadUtil::join(r.d_handle);
+            bslmt::ThreadUtil::join(w.d_handle);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, and lock and unlock it for reading and for
+        //:   writing.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj obj;
+
+        obj.lockRead();
+        obj.lockRead();
+        obj.unlock();
+        obj.unlock();
+
+        obj.lockWrite();
+        obj.unlock();
+
+        ASSERT(0 == obj.tryLockRead());
+        ASSERT(1 == obj.tryLockWrite());
+        obj.unlockRead();
+
+        ASSERT(0 == obj.tryLockWrite());
+        ASSERT(1 == obj.tryLockRead());
+        ASSERT(1 == obj.tryLockWrite());
+        obj.unlockWrite();
+
+        ASSERT(false == obj.isLocked());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = "
+             << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
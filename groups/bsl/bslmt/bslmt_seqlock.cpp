@@ -0,0 +1,42 @@
+// bslmt_seqlock.cpp                                                  -*-C++-*-
+#include <bslmt_seqlock.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslmt_seqlock_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+// A reader loads the sequence number with acquire semantics, loads the data
+// with acquire semantics, and reloads the sequence number.  A writer stores
+// an odd sequence number with a sequentially consistent store, stores the
+// data with release semantics, and stores the next (even) sequence number
+// with release semantics.  If a reader loads any data stored by a writer, the
+// release/acquire pairing on that word makes the writer's odd sequence number
+// visible to the reload, so 'validate' fails.  The acquire loads of the data
+// also prevent the reload from being satisfied before the data is read.
+//
+// The sequence number is unsigned, so that it wraps around, with well-defined
+// behavior, after 2^32 increments.  A reader can then validate torn data only
+// if exactly a multiple of 2^31 writes complete while it reads.
+
+namespace BloombergLP {
+namespace bslmt {
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
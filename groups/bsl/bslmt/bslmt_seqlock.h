@@ -0,0 +1,375 @@
+// bslmt_seqlock.h                                                    -*-C++-*-
+
+#ifndef INCLUDED_BSLMT_SEQLOCK
+#define INCLUDED_BSLMT_SEQLOCK
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sequence lock, and a value protected by one.
+//
+//@CLASSES:
+//   bslmt::SeqLock: sequence lock with optimistic, non-blocking readers
+//   bslmt::SeqLockValue: small trivially-copyable value guarded by a 'SeqLock'
+//
+//@SEE_ALSO: bslmt_distributedreaderwritermutex, bslmt_writelockguard
+//
+//@DESCRIPTION: This component defines a sequence lock, 'bslmt::SeqLock', and
+// a class template, 'bslmt::SeqLockValue', holding a small trivially-copyable
+// value that is read and written under a 'bslmt::SeqLock'.
+//
+// A sequence lock pairs a writer mutex with a sequence number that a writer
+// makes odd when it locks, and even again when it unlocks.  A reader does not
+// lock anything: it calls 'beginRead', which waits until the sequence number
+// is even and returns it, reads the protected data, and then calls 'validate'
+// with the returned value to find out whether a writer may have modified the
+// data in the meantime, in which case it retries.  Readers therefore never
+// modify shared memory, so any number of them proceed without contending
+// with each other, and writers are never blocked by readers.  In exchange, a
+// reader may observe torn data, which it must discard without acting on it
+// when 'validate' returns 'false', and may retry indefinitely under a steady
+// stream of writes.  Sequence locks are appropriate for small values that are
+// read very frequently and written rarely, such as a snapshot of a few
+// statistics or a timestamp.
+//
+// Because readers may run concurrently with a writer, the protected data must
+// be accessed through atomic operations: a writer must store it with release
+// (or stronger) stores, and a reader must load it with acquire (or stronger)
+// loads.  'bslmt::SeqLockValue' does this for any trivially-copyable 'TYPE',
+// by copying the value to and from an array of atomic words, and is the
+// preferred interface.
+//
+///Use With Lock Guards
+/// - - - - - - - - - -
+// 'bslmt::SeqLock' provides the 'lockWrite', 'tryLockWrite', and 'unlock'
+// methods expected by 'bslmt::WriteLockGuard'.  Its readers, being optimistic,
+// do not hold a lock that can be released, so 'bslmt::SeqLock' does not
+// support 'bslmt::ReadLockGuard'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing a Snapshot of Statistics
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a thread periodically computes a few statistics that many
+// other threads read, and that each reader must see a consistent set of
+// statistics.  First, we define a trivially-copyable 'struct' to hold them:
+//..
+//  struct Stats {
+//      // This 'struct' holds a snapshot of statistics.
+//
+//      int d_count;    // number of samples
+//      int d_minimum;  // minimum sample
+//      int d_maximum;  // maximum sample
+//  };
+//..
+// Then, we create a 'bslmt::SeqLockValue' holding an initial snapshot:
+//..
+//  const Stats                initial = { 0, 0, 0 };
+//  bslmt::SeqLockValue<Stats> stats(initial);
+//..
+// Next, the computing thread publishes a new snapshot:
+//..
+//  const Stats update = { 3, -5, 12 };
+//  stats.store(update);
+//..
+// Finally, a reader loads a consistent snapshot, without blocking the
+// computing thread and without contending with other readers:
+//..
+//  const Stats snapshot = stats.load();
+//
+//  assert( 3 == snapshot.d_count);
+//  assert(-5 == snapshot.d_minimum);
+//  assert(12 == snapshot.d_maximum);
+//..
+
+#include <bslscm_version.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bslmt {
+
+                               // =============
+                               // class SeqLock
+                               // =============
+
+class SeqLock {
+    // This class provides a sequence lock: a lock with mutually exclusive
+    // writers and optimistic readers that never block writers.
+
+    // DATA
+    bsls::AtomicUint d_sequence;    // odd while a writer holds the lock;
+                                    // wraps around on overflow
+
+    Mutex            d_writeMutex;  // serializes writers
+
+    // NOT IMPLEMENTED
+    SeqLock(const SeqLock&);
+    SeqLock& operator=(const SeqLock&);
+
+  public:
+    // CREATORS
+    SeqLock();
+        // Create a sequence lock initialized to an unlocked state.
+
+    //! ~SeqLock() = default;
+        // Destroy this object.  The behavior is undefined unless this object
+        // is unlocked.
+
+    // MANIPULATORS
+    void lockWrite();
+        // Lock this object for writing, blocking until no other writer holds
+        // it.  Use 'unlockWrite' or 'unlock' to release the lock.  The
+        // behavior is undefined if this method is called from a thread that
+        // already holds the write lock.
+
+    int tryLockWrite();
+        // Attempt to lock this object for writing.  Immediately return 0 on
+        // success, and a non-zero value if another writer holds the lock.  If
+        // successful, 'unlockWrite' or 'unlock' must be used to release the
+        // lock.
+
+    void unlock();
+        // Release the write lock that the calling thread holds on this
+        // object.  The behavior is undefined unless the calling thread holds
+        // the write lock.  Note that this method is equivalent to
+        // 'unlockWrite', and is provided for 'WriteLockGuard'.
+
+    void unlockWrite();
+        // Release the write lock that the calling thread holds on this
+        // object.  The behavior is undefined unless the calling thread holds
+        // the write lock.
+
+    // ACCESSORS
+    unsigned int beginRead() const;
+        // Wait until no writer holds this lock, and return a token to be
+        // passed to 'validate' once the protected data has been read.
+
+    bool isLockedWrite() const;
+        // Return 'true' if a writer currently holds this lock, and 'false'
+        // otherwise.  Note that this method is intended for testing, and its
+        // result may be out of date on return.
+
+    bool validate(unsigned int token) const;
+        // Return 'true' if no writer has locked this object since the call to
+        // 'beginRead' that returned the specified 'token', and 'false'
+        // otherwise.  If 'false' is returned, the data read since that call
+        // may be inconsistent and must be discarded.  The behavior is
+        // undefined unless the protected data was read with acquire (or
+        // stronger) atomic loads.
+};
+
+                          // ========================
+                          // class SeqLockValue<TYPE>
+                          // ========================
+
+template <class TYPE>
+class SeqLockValue {
+    // This class template holds a value of the (template parameter) 'TYPE'
+    // that may be loaded by any number of threads without blocking while it
+    // is stored by others.  The behavior is undefined unless 'TYPE' is
+    // trivially copyable.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations                   AtomicOps;
+    typedef bsls::AtomicOperations::AtomicTypes::Int Word;
+
+    enum {
+        k_NUM_WORDS = (sizeof(TYPE) + sizeof(int) - 1) / sizeof(int)
+                                        // number of words holding the value
+    };
+
+    // DATA
+    SeqLock d_lock;                 // guards 'd_words'
+
+    Word    d_words[k_NUM_WORDS];   // value, as atomic words
+
+    // NOT IMPLEMENTED
+    SeqLockValue(const SeqLockValue&);
+    SeqLockValue& operator=(const SeqLockValue&);
+
+  public:
+    // CREATORS
+    explicit SeqLockValue(const TYPE& value = TYPE());
+        // Create an object holding the specified 'value'.  If 'value' is not
+        // specified, a value-initialized 'TYPE' is held.
+
+    //! ~SeqLockValue() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void store(const TYPE& value);
+        // Set the value held by this object to the specified 'value',
+        // blocking only while another thread is storing a value.
+
+    // ACCESSORS
+    TYPE load() const;
+        // Return the value held by this object.  Do not block, except while
+        // another thread is storing a value.
+
+    void load(TYPE *result) const;
+        // Load into the specified 'result' the value held by this object.
+        // Do not block, except while another thread is storing a value.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                               // -------------
+                               // class SeqLock
+                               // -------------
+
+// CREATORS
+inline
+SeqLock::SeqLock()
+: d_sequence(0)
+{
+}
+
+// MANIPULATORS
+inline
+void SeqLock::lockWrite()
+{
+    d_writeMutex.lock();
+
+    // The sequentially consistent store is ordered before the writer's
+    // subsequent (release) stores to the protected data.
+
+    d_sequence.store(d_sequence.loadRelaxed() + 1);
+}
+
+inline
+int SeqLock::tryLockWrite()
+{
+    if (0 != d_writeMutex.tryLock()) {
+        return 1;                                                     // RETURN
+    }
+    d_sequence.store(d_sequence.loadRelaxed() + 1);
+    return 0;
+}
+
+inline
+void SeqLock::unlock()
+{
+    unlockWrite();
+}
+
+inline
+void SeqLock::unlockWrite()
+{
+    d_sequence.storeRelease(d_sequence.loadRelaxed() + 1);
+    d_writeMutex.unlock();
+}
+
+// ACCESSORS
+inline
+unsigned int SeqLock::beginRead() const
+{
+    unsigned int sequence = d_sequence.loadAcquire();
+    while (sequence & 1) {
+        ThreadUtil::yield();
+        sequence = d_sequence.loadAcquire();
+    }
+    return sequence;
+}
+
+inline
+bool SeqLock::isLockedWrite() const
+{
+    return d_sequence.loadAcquire() & 1;
+}
+
+inline
+bool SeqLock::validate(unsigned int token) const
+{
+    // The acquire loads of the protected data cannot be reordered after this
+    // load.
+
+    return token == d_sequence.loadRelaxed();
+}
+
+                          // ------------------------
+                          // class SeqLockValue<TYPE>
+                          // ------------------------
+
+// CREATORS
+template <class TYPE>
+SeqLockValue<TYPE>::SeqLockValue(const TYPE& value)
+{
+    int words[k_NUM_WORDS] = { 0 };
+    bsl::memcpy(words, &value, sizeof(TYPE));
+
+    for (int i = 0; i < k_NUM_WORDS; ++i) {
+        AtomicOps::initInt(&d_words[i], words[i]);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+void SeqLockValue<TYPE>::store(const TYPE& value)
+{
+    int words[k_NUM_WORDS] = { 0 };
+    bsl::memcpy(words, &value, sizeof(TYPE));
+
+    d_lock.lockWrite();
+    for (int i = 0; i < k_NUM_WORDS; ++i) {
+        AtomicOps::setIntRelease(&d_words[i], words[i]);
+    }
+    d_lock.unlockWrite();
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+TYPE SeqLockValue<TYPE>::load() const
+{
+    TYPE result;
+    load(&result);
+    return result;
+}
+
+template <class TYPE>
+void SeqLockValue<TYPE>::load(TYPE *result) const
+{
+    int          words[k_NUM_WORDS];
+    unsigned int token;
+
+    do {
+        token = d_lock.beginRead();
+        for (int i = 0; i < k_NUM_WORDS; ++i) {
+            words[i] = AtomicOps::getIntAcquire(&d_words[i]);
+        }
+    } while (!d_lock.validate(token));
+
+    bsl::memcpy(result, words, sizeof(TYPE));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
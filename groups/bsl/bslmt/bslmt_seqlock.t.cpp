@@ -0,0 +1,549 @@
+// bslmt_seqlock.t.cpp                                                -*-C++-*-
+
+#include <bslmt_seqlock.h>
+
+#include <bslmt_threadutil.h>
+#include <bslmt_writelockguard.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_atomic.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a sequence lock, and a class template
+// holding a trivially-copyable value guarded by one.  The single-threaded
+// tests verify that the write lock is exclusive, that the token returned by
+// 'beginRead' is validated exactly when no writer has locked the object
+// since, and that 'SeqLockValue' stores and loads values of various sizes
+// without loss.  The concurrency concern, that a reader never accepts a torn
+// value, is verified with reader threads loading, while a writer thread
+// stores, values whose members must all be equal.
+// ----------------------------------------------------------------------------
+// SeqLock
+// CREATORS
+// [ 2] SeqLock();
+// [ 2] ~SeqLock();
+//
+// MANIPULATORS
+// [ 2] void lockWrite();
+// [ 2] int tryLockWrite();
+// [ 2] void unlock();
+// [ 2] void unlockWrite();
+//
+// ACCESSORS
+// [ 2] unsigned int beginRead() const;
+// [ 2] bool isLockedWrite() const;
+// [ 2] bool validate(unsigned int token) const;
+//
+// SeqLockValue
+// CREATORS
+// [ 3] explicit SeqLockValue(const TYPE& value = TYPE());
+// [ 3] ~SeqLockValue();
+//
+// MANIPULATORS
+// [ 3] void store(const TYPE& value);
+//
+// ACCESSORS
+// [ 3] TYPE load() const;
+// [ 3] void load(TYPE *result) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: readers never accept a torn value
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslmt::SeqLock Obj;
+
+// ============================================================================
+//                   GLOBAL STRUCTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct Odd {
+    // This 'struct' has a size that is not a multiple of 'sizeof(int)'.
+
+    char d_data[7];
+};
+
+struct Wide {
+    // This 'struct' is stored by the concurrency test with all members equal.
+
+    enum { k_SIZE = 8 };
+
+    int d_data[k_SIZE];
+};
+
+struct StressData {
+    bslmt::SeqLockValue<Wide> d_value;          // shared value
+    bsls::AtomicInt           d_done;           // set when the writer is
+                                                // done
+    int                       d_numIterations;  // number of values stored
+};
+
+// ============================================================================
+//                   GLOBAL METHODS FOR TESTING
+// ----------------------------------------------------------------------------
+
+extern "C" void *stressReader(void *arg)
+{
+    StressData *data = static_cast<StressData *>(arg);
+
+    int previous = 0;
+    while (!data->d_done.load()) {
+        const Wide value = data->d_value.load();
+
+        for (int i = 1; i < Wide::k_SIZE; ++i) {
+            ASSERTV(i, value.d_data[0], value.d_data[i],
+                    value.d_data[0] == value.d_data[i]);
+        }
+        ASSERTV(previous, value.d_data[0], previous <= value.d_data[0]);
+        previous = value.d_data[0];
+    }
+
+    return 0;
+}
+
+extern "C" void *stressWriter(void *arg)
+{
+    StressData *data = static_cast<StressData *>(arg);
+
+    for (int i = 1; i <= data->d_numIterations; ++i) {
+        Wide value;
+        for (int j = 0; j < Wide::k_SIZE; ++j) {
+            value.d_data[j] = i;
+        }
+        data->d_value.store(value);
+    }
+
+    return 0;
+}
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing a Snapshot of Statistics
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a thread periodically computes a few statistics that many
+// other threads read, and that each reader must see a consistent set of
+// statistics.  First, we define a trivially-copyable 'struct' to hold them:
+//..
+    struct Stats {
+        // This 'struct' holds a snapshot of statistics.
+
+        int d_count;    // number of samples
+        int d_minimum;  // minimum sample
+        int d_maximum;  // maximum sample
+    };
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a 'bslmt::SeqLockValue' holding an initial snapshot:
+//..
+    const Stats                initial = { 0, 0, 0 };
+    bslmt::SeqLockValue<Stats> stats(initial);
+//..
+// Next, the computing thread publishes a new snapshot:
+//..
+    const Stats update = { 3, -5, 12 };
+    stats.store(update);
+//..
+// Finally, a reader loads a consistent snapshot, without blocking the
+// computing thread and without contending with other readers:
+//..
+    const Stats snapshot = stats.load();
+
+    ASSERT( 3 == snapshot.d_count);
+    ASSERT(-5 == snapshot.d_minimum);
+    ASSERT(12 == snapshot.d_maximum);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: READERS NEVER ACCEPT A TORN VALUE
+        //
+        // Concerns:
+        //: 1 A value loaded while another thread stores values is one of the
+        //:   values stored, and not a mixture of several.
+        //:
+        //: 2 A reader does not observe values going back in time.
+        //
+        // Plan:
+        //: 1 Create reader threads that repeatedly load a 'SeqLockValue' of a
+        //:   'struct' spanning several words, and a writer thread that stores
+        //:   increasing values having all members equal.  Each reader verifies
+        //:   that the members of every value it loads are equal, and that the
+        //:   values it loads do not decrease.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: readers never accept a torn value
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: READERS NEVER ACCEPT A TORN VALUE"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        enum { k_NUM_READERS = 4 };
+
+        StressData data;
+        data.d_numIterations = 20000;
+
+        bslmt::ThreadUtil::Handle readers[k_NUM_READERS];
+        bslmt::ThreadUtil::Handle writer;
+
+        for (int i = 0; i < k_NUM_READERS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&readers[i],
+                                                  stressReader,
+                                                  &data));
+        }
+        ASSERT(0 == bslmt::ThreadUtil::create(&writer, stressWriter, &data));
+        bslmt::ThreadUtil::join(writer);
+        data.d_done.store(1);
+        for (int i = 0; i < k_NUM_READERS; ++i) {
+            bslmt::ThreadUtil::join(readers[i]);
+        }
+
+        const Wide value = data.d_value.load();
+        for (int i = 0; i < Wide::k_SIZE; ++i) {
+            ASSERTV(i, value.d_data[i],
+                    data.d_numIterations == value.d_data[i]);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SEQLOCKVALUE
+        //
+        // Concerns:
+        //: 1 A default-constructed object holds a value-initialized 'TYPE'.
+        //:
+        //: 2 An object holds the value supplied at construction, or last
+        //:   stored, and both overloads of 'load' return it.
+        //:
+        //: 3 Values of types smaller than, and not a multiple of, a word are
+        //:   held without loss.
+        //
+        // Plan:
+        //: 1 For 'char', 'double', a 7-byte 'struct', and a 32-byte 'struct',
+        //:   create objects, store a sequence of values, and verify each
+        //:   value with both overloads of 'load'.  (C-1..3)
+        //
+        // Testing:
+        //   explicit SeqLockValue(const TYPE& value = TYPE());
+        //   ~SeqLockValue();
+        //   void store(const TYPE& value);
+        //   TYPE load() const;
+        //   void load(TYPE *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SEQLOCKVALUE" << endl
+                          << "============" << endl;
+
+        if (verbose) cout << "\nTesting 'char'." << endl;
+        {
+            bslmt::SeqLockValue<char>        mX;
+            const bslmt::SeqLockValue<char>& X = mX;
+            ASSERT(0 == X.load());
+
+            bslmt::SeqLockValue<char> mY('a');
+            ASSERT('a' == mY.load());
+
+            for (char c = 'b'; c <= 'z'; ++c) {
+                mX.store(c);
+                char result = 0;
+                X.load(&result);
+                ASSERTV(c, result, c == result);
+                ASSERTV(c, c == X.load());
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'double'." << endl;
+        {
+            bslmt::SeqLockValue<double>        mX(1.5);
+            const bslmt::SeqLockValue<double>& X = mX;
+            ASSERT(1.5 == X.load());
+
+            for (int i = 0; i < 10; ++i) {
+                const double VALUE = i * 0.25 - 1.0;
+                mX.store(VALUE);
+                ASSERTV(i, VALUE == X.load());
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'Odd'." << endl;
+        {
+            const Odd                       INITIAL = { "abcdef" };
+            bslmt::SeqLockValue<Odd>        mX(INITIAL);
+            const bslmt::SeqLockValue<Odd>& X = mX;
+
+            Odd result = X.load();
+            ASSERT(0 == bsl::memcmp(&INITIAL, &result, sizeof(Odd)));
+
+            const Odd VALUE = { "uvwxyz" };
+            mX.store(VALUE);
+            X.load(&result);
+            ASSERT(0 == bsl::memcmp(&VALUE, &result, sizeof(Odd)));
+        }
+
+        if (verbose) cout << "\nTesting 'Wide'." << endl;
+        {
+            bslmt::SeqLockValue<Wide>        mX;
+            const bslmt::SeqLockValue<Wide>& X = mX;
+
+            Wide result = X.load();
+            for (int i = 0; i < Wide::k_SIZE; ++i) {
+                ASSERTV(i, 0 == result.d_data[i]);
+            }
+
+            Wide value;
+            for (int i = 0; i < Wide::k_SIZE; ++i) {
+                value.d_data[i] = i * i - 7;
+            }
+            mX.store(value);
+            result = X.load();
+            for (int i = 0; i < Wide::k_SIZE; ++i) {
+                ASSERTV(i, value.d_data[i] == result.d_data[i]);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SEQLOCK
+        //
+        // Concerns:
+        //: 1 A newly created object is unlocked.
+        //:
+        //: 2 The write lock is exclusive, and is released by either 'unlock'
+        //:   or 'unlockWrite'.
+        //:
+        //: 3 'validate' returns 'true' for a token returned by 'beginRead'
+        //:   exactly when no writer has locked the object since.
+        //:
+        //: 4 The object can be used with 'bslmt::WriteLockGuard'.
+        //
+        // Plan:
+        //: 1 Create an object and verify that it is unlocked.  (C-1)
+        //:
+        //: 2 Lock the object, verify that 'tryLockWrite' fails, and release
+        //:   the lock with each of 'unlock' and 'unlockWrite'.  (C-2)
+        //:
+        //: 3 Obtain tokens and validate them before and after write locks,
+        //:   including write locks acquired through 'WriteLockGuard' and
+        //:   'WriteLockGuardTryLock'.  (C-3..4)
+        //
+        // Testing:
+        //   SeqLock();
+        //   ~SeqLock();
+        //   void lockWrite();
+        //   int tryLockWrite();
+        //   void unlock();
+        //   void unlockWrite();
+        //   unsigned int beginRead() const;
+        //   bool isLockedWrite() const;
+        //   bool validate(unsigned int token) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SEQLOCK" << endl
+                          << "=======" << endl;
+
+        Obj mX; const Obj& X = mX;
+        ASSERT(false == X.isLockedWrite());
+
+        unsigned int token = X.beginRead();
+        ASSERT(true == X.validate(token));
+
+        mX.lockWrite();
+        ASSERT(true  == X.isLockedWrite());
+        ASSERT(false == X.validate(token));
+        ASSERT(0     != mX.tryLockWrite());
+        mX.unlock();
+        ASSERT(false == X.isLockedWrite());
+        ASSERT(false == X.validate(token));
+
+        token = X.beginRead();
+        ASSERT(true == X.validate(token));
+        ASSERT(true == X.validate(token));
+
+        ASSERT(0 == mX.tryLockWrite());
+        ASSERT(true == X.isLockedWrite());
+        mX.unlockWrite();
+        ASSERT(false == X.isLockedWrite());
+        ASSERT(false == X.validate(token));
+
+        token = X.beginRead();
+        {
+            bslmt::WriteLockGuard<Obj> guard(&mX);
+            ASSERT(true == X.isLockedWrite());
+        }
+        ASSERT(false == X.isLockedWrite());
+        ASSERT(false == X.validate(token));
+
+        token = X.beginRead();
+        {
+            bslmt::WriteLockGuardTryLock<Obj> guard(&mX);
+            ASSERT(guard.ptr());
+            ASSERT(true == X.isLockedWrite());
+        }
+        ASSERT(false == X.isLockedWrite());
+        ASSERT(false == X.validate(token));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The classes are sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Lock and unlock a 'SeqLock', and validate a read across the
+        //:   write.  Store and load an 'int' in a 'SeqLockValue'.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;
+
+        const unsigned int token = mX.beginRead();
+        ASSERT(true == mX.validate(token));
+
+        mX.lockWrite();
+        mX.unlock();
+        ASSERT(false == mX.validate(token));
+
+        bslmt::SeqLockValue<int> mV(5);
+        ASSERT(5 == mV.load());
+
+        mV.store(7);
+        ASSERT(7 == mV.load());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = "
+             << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
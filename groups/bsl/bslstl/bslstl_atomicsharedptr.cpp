@@ -0,0 +1,400 @@
+// bslstl_atomicsharedptr.cpp                                         -*-C++-*-
+#include <bslstl_atomicsharedptr.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+
+#include <new>
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ===========================
+                        // struct AtomicSharedPtr_Node
+                        // ===========================
+
+struct AtomicSharedPtr_Node {
+    // This 'struct' holds the value of an 'AtomicSharedPtr_Imp', and the
+    // internal count of the tickets on it that remain to be released after
+    // it has been replaced.
+
+    // DATA
+    void                *d_ptr_p;          // held pointer
+    bslma::SharedPtrRep *d_rep_p;          // representation of 'd_ptr_p', on
+                                           // which a reference is held
+    bsls::AtomicInt64    d_internalCount;  // external count added by the
+                                           // writer that replaced this node,
+                                           // less the tickets released since
+};
+
+namespace {
+
+#ifdef BSLSTL_ATOMICSHAREDPTR_PACKED_WORD
+typedef bsls::Types::Uint64 Uint64;
+
+#if defined(BSLS_PLATFORM_CPU_64_BIT)
+const int k_COUNT_SHIFT = 48;  // user-space addresses occupy 48 bits
+#else
+const int k_COUNT_SHIFT = 32;
+#endif
+
+const Uint64 k_TICKET    = static_cast<Uint64>(1) << k_COUNT_SHIFT;
+const Uint64 k_NODE_MASK = k_TICKET - 1;
+
+inline
+AtomicSharedPtr_Node *nodeFromWord(Uint64 word)
+    // Return the address of the node in the specified 'word'.
+{
+    return reinterpret_cast<AtomicSharedPtr_Node *>(
+                                   static_cast<bsls::Types::UintPtr>(
+                                                         word & k_NODE_MASK));
+}
+
+inline
+Uint64 wordFromNode(AtomicSharedPtr_Node *node)
+    // Return a word holding the address of the specified 'node' and an
+    // external count of zero.
+{
+    const Uint64 word = reinterpret_cast<bsls::Types::UintPtr>(node);
+
+    BSLS_ASSERT_OPT(0 == (word & ~k_NODE_MASK));
+
+    return word;
+}
+#endif
+
+}  // close unnamed namespace
+
+                         // -------------------------
+                         // class AtomicSharedPtr_Imp
+                         // -------------------------
+
+// PRIVATE MANIPULATORS
+AtomicSharedPtr_Node *AtomicSharedPtr_Imp::acquireTicket() const
+{
+#ifdef BSLSTL_ATOMICSHAREDPTR_PACKED_WORD
+    return nodeFromWord(d_word.addAcqRel(k_TICKET));
+#else
+    bsls::SpinLockGuard guard(&d_lock);
+
+    ++d_externalCount;
+    return d_node_p;
+#endif
+}
+
+void AtomicSharedPtr_Imp::releaseTicket(Node *node) const
+{
+#ifdef BSLSTL_ATOMICSHAREDPTR_PACKED_WORD
+    Uint64 word = d_word.loadRelaxed();
+    while (nodeFromWord(word) == node) {
+        const Uint64 prior = d_word.testAndSwapAcqRel(word, word - k_TICKET);
+        if (prior == word) {
+            return;                                                   // RETURN
+        }
+        word = prior;
+    }
+#else
+    {
+        bsls::SpinLockGuard guard(&d_lock);
+
+        if (d_node_p == node) {
+            --d_externalCount;
+            return;                                                   // RETURN
+        }
+    }
+#endif
+
+    // 'node' has been replaced, and the writer that replaced it has added our
+    // ticket to its internal count.
+
+    if (node && 0 == node->d_internalCount.addAcqRel(-1)) {
+        destroyNode(node);
+    }
+}
+
+AtomicSharedPtr_Node *AtomicSharedPtr_Imp::createNode(
+                                                     void                *ptr,
+                                                     bslma::SharedPtrRep *rep)
+{
+    if (!ptr && !rep) {
+        return 0;                                                     // RETURN
+    }
+
+    Node *node = static_cast<Node *>(d_allocator_p->allocate(sizeof(Node)));
+    node->d_ptr_p = ptr;
+    node->d_rep_p = rep;
+    new (&node->d_internalCount) bsls::AtomicInt64(0);
+
+    if (rep) {
+        rep->acquireRef();
+    }
+    return node;
+}
+
+void AtomicSharedPtr_Imp::destroyNode(Node *node) const
+{
+    BSLS_ASSERT(node);
+
+    bslma::SharedPtrRep *rep = node->d_rep_p;
+    d_allocator_p->deallocate(node);
+
+    if (rep) {
+        rep->releaseRef();
+    }
+}
+
+AtomicSharedPtr_Node *AtomicSharedPtr_Imp::swapNode(Node   *node,
+                                                    Uint64 *externalCount)
+{
+#ifdef BSLSTL_ATOMICSHAREDPTR_PACKED_WORD
+    const Uint64 prior = d_word.swapAcqRel(wordFromNode(node));
+
+    *externalCount = prior >> k_COUNT_SHIFT;
+    return nodeFromWord(prior);
+#else
+    bsls::SpinLockGuard guard(&d_lock);
+
+    Node *prior = d_node_p;
+    *externalCount  = d_externalCount;
+    d_node_p        = node;
+    d_externalCount = 0;
+    return prior;
+#endif
+}
+
+bool AtomicSharedPtr_Imp::testAndSwapNode(Node   *expectedNode,
+                                          Node   *node,
+                                          Uint64 *externalCount)
+{
+#ifdef BSLSTL_ATOMICSHAREDPTR_PACKED_WORD
+    const Uint64 newWord = wordFromNode(node);
+
+    Uint64 word = d_word.loadRelaxed();
+    while (nodeFromWord(word) == expectedNode) {
+        const Uint64 prior = d_word.testAndSwapAcqRel(word, newWord);
+        if (prior == word) {
+            *externalCount = word >> k_COUNT_SHIFT;
+            return true;                                              // RETURN
+        }
+        word = prior;
+    }
+    return false;
+#else
+    bsls::SpinLockGuard guard(&d_lock);
+
+    if (d_node_p != expectedNode) {
+        return false;                                                 // RETURN
+    }
+    *externalCount  = d_externalCount;
+    d_node_p        = node;
+    d_externalCount = 0;
+    return true;
+#endif
+}
+
+void AtomicSharedPtr_Imp::retireNode(Node   *node,
+                                     Uint64  externalCount,
+                                     int     numTickets) const
+{
+    if (!node) {
+        return;                                                       // RETURN
+    }
+
+    // Each reader holding one of the displaced tickets will decrement the
+    // internal count exactly once; the node is destroyed by whichever
+    // operation brings the count to zero.
+
+    const bsls::Types::Int64 increment =
+                   static_cast<bsls::Types::Int64>(externalCount) - numTickets;
+
+    if (0 == node->d_internalCount.addAcqRel(increment)) {
+        destroyNode(node);
+    }
+}
+
+// CREATORS
+AtomicSharedPtr_Imp::AtomicSharedPtr_Imp(bslma::Allocator *basicAllocator)
+#ifdef BSLSTL_ATOMICSHAREDPTR_PACKED_WORD
+: d_word(0)
+#else
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_node_p(0)
+, d_externalCount(0)
+#endif
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+AtomicSharedPtr_Imp::AtomicSharedPtr_Imp(void                *ptr,
+                                         bslma::SharedPtrRep *rep,
+                                         bslma::Allocator    *basicAllocator)
+#ifdef BSLSTL_ATOMICSHAREDPTR_PACKED_WORD
+: d_word(0)
+#else
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_node_p(0)
+, d_externalCount(0)
+#endif
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+#ifdef BSLSTL_ATOMICSHAREDPTR_PACKED_WORD
+    d_word.storeRelaxed(wordFromNode(createNode(ptr, rep)));
+#else
+    d_node_p = createNode(ptr, rep);
+#endif
+}
+
+AtomicSharedPtr_Imp::~AtomicSharedPtr_Imp()
+{
+    Uint64 externalCount;
+    Node   *node = swapNode(0, &externalCount);
+
+    BSLS_ASSERT(0 == externalCount);
+
+    if (node) {
+        destroyNode(node);
+    }
+}
+
+// MANIPULATORS
+bool AtomicSharedPtr_Imp::compareExchange(void                 **ptr,
+                                          bslma::SharedPtrRep  **rep,
+                                          void                  *newPtr,
+                                          bslma::SharedPtrRep   *newRep)
+{
+    BSLS_ASSERT(ptr);
+    BSLS_ASSERT(rep);
+
+    Node *newNode = createNode(newPtr, newRep);
+
+    while (true) {
+        Node *node = acquireTicket();
+
+        const bool isEqual = node
+                           ? node->d_ptr_p == *ptr && node->d_rep_p == *rep
+                           : 0 == *ptr && 0 == *rep;
+
+        if (!isEqual) {
+            *ptr = node ? node->d_ptr_p : 0;
+            *rep = node ? node->d_rep_p : 0;
+            if (*rep) {
+                (*rep)->acquireRef();
+            }
+            releaseTicket(node);
+
+            if (newNode) {
+                destroyNode(newNode);
+            }
+            return false;                                             // RETURN
+        }
+
+        Uint64 externalCount;
+        if (testAndSwapNode(node, newNode, &externalCount)) {
+            // Our own ticket on 'node' is among those displaced.
+
+            retireNode(node, externalCount, 1);
+            return true;                                              // RETURN
+        }
+
+        // 'node' was replaced (possibly by a node having the same value)
+        // after we compared it; try again.
+
+        releaseTicket(node);
+    }
+}
+
+void AtomicSharedPtr_Imp::exchange(void                 **ptr,
+                                   bslma::SharedPtrRep  **rep,
+                                   void                  *newPtr,
+                                   bslma::SharedPtrRep   *newRep)
+{
+    BSLS_ASSERT(ptr);
+    BSLS_ASSERT(rep);
+
+    Node *newNode = createNode(newPtr, newRep);
+
+    Uint64 externalCount;
+    Node   *node = swapNode(newNode, &externalCount);
+
+    if (node) {
+        // No thread can destroy 'node' before 'retireNode' adds the displaced
+        // tickets to its internal count.
+
+        *ptr = node->d_ptr_p;
+        *rep = node->d_rep_p;
+        if (*rep) {
+            (*rep)->acquireRef();
+        }
+        retireNode(node, externalCount, 0);
+    }
+    else {
+        *ptr = 0;
+        *rep = 0;
+    }
+}
+
+void AtomicSharedPtr_Imp::store(void *ptr, bslma::SharedPtrRep *rep)
+{
+    Node *newNode = createNode(ptr, rep);
+
+    Uint64 externalCount;
+    Node   *node = swapNode(newNode, &externalCount);
+
+    retireNode(node, externalCount, 0);
+}
+
+// ACCESSORS
+void AtomicSharedPtr_Imp::load(void **ptr, bslma::SharedPtrRep **rep) const
+{
+    BSLS_ASSERT(ptr);
+    BSLS_ASSERT(rep);
+
+#ifdef BSLSTL_ATOMICSHAREDPTR_PACKED_WORD
+    if (0 == nodeFromWord(d_word.loadAcquire())) {
+        // Reading an empty value needs no ticket.
+
+        *ptr = 0;
+        *rep = 0;
+        return;                                                       // RETURN
+    }
+#endif
+
+    Node *node = acquireTicket();
+
+    if (node) {
+        *ptr = node->d_ptr_p;
+        *rep = node->d_rep_p;
+        if (*rep) {
+            (*rep)->acquireRef();
+        }
+    }
+    else {
+        *ptr = 0;
+        *rep = 0;
+    }
+
+    releaseTicket(node);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
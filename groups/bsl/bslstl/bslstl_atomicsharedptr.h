@@ -0,0 +1,580 @@
+// bslstl_atomicsharedptr.h                                           -*-C++-*-
+#ifndef INCLUDED_BSLSTL_ATOMICSHAREDPTR
+#define INCLUDED_BSLSTL_ATOMICSHAREDPTR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a shared pointer that can be loaded and stored atomically.
+//
+//@CLASSES:
+//  bsl::atomic_shared_ptr: shared pointer with atomic load, store, exchange
+//  bslstl::AtomicSharedPtr_Imp: untyped implementation of 'atomic_shared_ptr'
+//
+//@SEE_ALSO: bslstl_sharedptr, bslstl_localsharedptr
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bsl::atomic_shared_ptr', holding a 'bsl::shared_ptr' that may be read and
+// written concurrently by any number of threads without external
+// synchronization, in the manner of 'std::atomic<std::shared_ptr<T>>'.  The
+// canonical use is the publication of an immutable snapshot (e.g., a
+// configuration) that many threads read and that is occasionally replaced:
+// readers 'load' the current snapshot and keep it alive for as long as they
+// use it, while a writer 'store's a new one.
+//
+// The operations provided are 'load', 'store', 'exchange', and
+// 'compare_exchange_strong' (and its synonym 'compare_exchange_weak').  Each
+// is atomic with respect to the others, and each has acquire-release
+// semantics.
+//
+///Implementation Notes
+///--------------------
+// The value held by an 'atomic_shared_ptr' is kept in a small, internally
+// allocated *node* that owns one reference to the shared object.  The node is
+// referred to by a single word that packs the address of the node together
+// with an *external count* of the threads that are in the middle of reading
+// the node (so-called split, or differential, reference counting):
+//
+//: 1 A reader atomically increments the external count, which both reads the
+//:   node address and prevents the node from being destroyed, copies the
+//:   shared pointer held by the node (incrementing the reference count of the
+//:   shared object), and then decrements the external count -- provided the
+//:   word still refers to the same node.
+//:
+//: 2 A writer atomically replaces the word with one referring to a new node
+//:   (and having an external count of zero), and adds the external count it
+//:   displaced to an *internal count* held in the old node.  A reader that
+//:   finds the node replaced decrements the internal count instead of the
+//:   external count.  Whichever thread brings the internal count to zero
+//:   destroys the node, releasing its reference to the shared object.
+//
+// A 'load' is therefore three atomic read-modify-write operations, none of
+// which waits for another thread, and a 'store' allocates one node.  Storing
+// an empty shared pointer does not allocate.
+//
+// The word is updated with single-word atomic operations where a pointer and a
+// count fit in 64 bits: on 32-bit platforms, and on 64-bit x86 and ARM
+// platforms, where user-space addresses occupy at most 48 bits and the count
+// occupies the upper 16.  On other platforms the word is protected by a
+// 'bsls::SpinLock', and 'is_lock_free' returns 'false'.  On 64-bit platforms,
+// at most 65535 threads may be in the middle of reading the same object at
+// the same time.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing a Configuration Snapshot
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service keeps its configuration in an immutable object that
+// is read on every request, and replaced (rarely) when an administrator
+// changes a setting.  Guarding the configuration with a mutex would make every
+// request contend for that mutex; instead we publish it through an
+// 'atomic_shared_ptr'.
+//
+// First, we define the configuration type:
+//..
+//  struct Config {
+//      int d_timeout;
+//      int d_maxConnections;
+//  };
+//..
+// Then, we create the initial configuration and publish it:
+//..
+//  bslma::TestAllocator ta;
+//
+//  bsl::shared_ptr<Config> initial;
+//  initial.createInplace(&ta);
+//  initial->d_timeout        = 30;
+//  initial->d_maxConnections = 100;
+//
+//  bsl::atomic_shared_ptr<Config> current(initial, &ta);
+//  initial.reset();
+//..
+// Next, a reader obtains the current configuration.  The snapshot it obtains
+// stays valid for as long as the reader holds it, however often the
+// configuration is replaced in the meantime:
+//..
+//  bsl::shared_ptr<Config> snapshot = current.load();
+//  assert(30 == snapshot->d_timeout);
+//..
+// Now, an administrator publishes a new configuration, based on the current
+// one:
+//..
+//  bsl::shared_ptr<Config> updated;
+//  updated.createInplace(&ta, *current.load());
+//  updated->d_timeout = 60;
+//  current.store(updated);
+//..
+// Finally, we observe that new readers see the new configuration while the
+// earlier snapshot is unchanged:
+//..
+//  assert(60 == current.load()->d_timeout);
+//  assert(30 == snapshot->d_timeout);
+//..
+// If several writers can update the configuration concurrently, each should
+// use 'compare_exchange_strong' in a loop so that no update is lost.
+
+#include <bslscm_version.h>
+
+#include <bslstl_sharedptr.h>
+
+#include <bslma_allocator.h>
+#include <bslma_sharedptrrep.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_platform.h>
+#include <bsls_spinlock.h>
+#include <bsls_types.h>
+
+#if defined(BSLS_PLATFORM_CPU_32_BIT)                                         \
+ || defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ ||(defined(BSLS_PLATFORM_CPU_ARM) && defined(BSLS_PLATFORM_CPU_64_BIT))
+#define BSLSTL_ATOMICSHAREDPTR_PACKED_WORD 1
+    // The address of a node and an external count fit in a 64-bit word.
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+struct AtomicSharedPtr_Node;
+
+                         // =========================
+                         // class AtomicSharedPtr_Imp
+                         // =========================
+
+class AtomicSharedPtr_Imp {
+    // This mechanism provides the type-independent implementation of
+    // 'bsl::atomic_shared_ptr': it holds a pointer and the address of the
+    // 'bslma::SharedPtrRep' that manages it, and provides atomic operations
+    // to read and replace them, acquiring and releasing references to the
+    // representation as needed.  See the component-level documentation for
+    // the algorithm used.
+
+    // PRIVATE TYPES
+    typedef AtomicSharedPtr_Node Node;
+    typedef bsls::Types::Uint64  Uint64;
+
+    // DATA
+#ifdef BSLSTL_ATOMICSHAREDPTR_PACKED_WORD
+    mutable bsls::AtomicUint64  d_word;         // node address and external
+                                                // count
+
+#else
+    mutable bsls::SpinLock      d_lock;         // guards 'd_node_p' and
+                                                // 'd_externalCount'
+
+    Node                       *d_node_p;       // current node
+
+    mutable Uint64              d_externalCount;
+                                                // number of readers of
+                                                // 'd_node_p'
+#endif
+
+    bslma::Allocator           *d_allocator_p;  // allocator for nodes (held,
+                                                // not owned)
+
+    // PRIVATE MANIPULATORS
+    Node *acquireTicket() const;
+        // Increment the external count and return the address of the current
+        // node (which may be 0).  The node is not destroyed until
+        // 'releaseTicket' is called with its address.
+
+    void releaseTicket(Node *node) const;
+        // Decrement the external count if the current node is the specified
+        // 'node', and decrement the internal count of 'node' otherwise,
+        // destroying 'node' if that count becomes zero.  The behavior is
+        // undefined unless this thread holds a ticket for 'node' obtained by
+        // 'acquireTicket'.
+
+    Node *createNode(void *ptr, bslma::SharedPtrRep *rep);
+        // Return the address of a new node, allocated from the allocator of
+        // this object, holding the specified 'ptr' and 'rep' and owning a new
+        // reference to 'rep', or 0 if both 'ptr' and 'rep' are 0.
+
+    void destroyNode(Node *node) const;
+        // Release the reference to its representation held by the specified
+        // 'node', and return the memory of 'node' to the allocator of this
+        // object.
+
+    Node *swapNode(Node *node, Uint64 *externalCount);
+        // Make the specified 'node' current, with an external count of zero,
+        // load the external count of the node that was current into the
+        // specified 'externalCount', and return the address of that node.
+
+    bool testAndSwapNode(Node   *expectedNode,
+                         Node   *node,
+                         Uint64 *externalCount);
+        // If the current node is the specified 'expectedNode', make the
+        // specified 'node' current, with an external count of zero, load the
+        // external count of 'expectedNode' into the specified
+        // 'externalCount', and return 'true'; otherwise, return 'false' with
+        // no effect.
+
+    void retireNode(Node *node, Uint64 externalCount, int numTickets) const;
+        // Add to the internal count of the specified 'node' the specified
+        // 'externalCount' displaced from the word when 'node' was replaced,
+        // less the specified 'numTickets' held by this thread, and destroy
+        // 'node' if the internal count becomes zero.  Do nothing if 'node' is
+        // 0.
+
+  private:
+    // NOT IMPLEMENTED
+    AtomicSharedPtr_Imp(const AtomicSharedPtr_Imp&) BSLS_KEYWORD_DELETED;
+    AtomicSharedPtr_Imp& operator=(const AtomicSharedPtr_Imp&)
+                                                          BSLS_KEYWORD_DELETED;
+
+  public:
+    // CLASS METHODS
+    static bool isLockFree();
+        // Return 'true' if the operations of this class are lock-free on this
+        // platform, and 'false' otherwise.
+
+    // CREATORS
+    explicit AtomicSharedPtr_Imp(bslma::Allocator *basicAllocator = 0);
+        // Create an object holding a null pointer and no representation.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    AtomicSharedPtr_Imp(void                *ptr,
+                        bslma::SharedPtrRep *rep,
+                        bslma::Allocator    *basicAllocator = 0);
+        // Create an object holding the specified 'ptr' and 'rep', and
+        // acquire a reference to 'rep' if it is not 0.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ~AtomicSharedPtr_Imp();
+        // Release the reference held by this object, if any, and destroy this
+        // object.
+
+    // MANIPULATORS
+    bool compareExchange(void                 **ptr,
+                         bslma::SharedPtrRep  **rep,
+                         void                  *newPtr,
+                         bslma::SharedPtrRep   *newRep);
+        // If this object holds the pointer and representation at the
+        // specified 'ptr' and 'rep' addresses, replace them with the specified
+        // 'newPtr' and 'newRep', acquiring a reference to 'newRep' (if not 0)
+        // and releasing the one held on the old representation, and return
+        // 'true'.  Otherwise, load the pointer and representation held by
+        // this object into '*ptr' and '*rep', acquiring a reference to the
+        // latter (if not 0) that the caller is responsible for releasing, and
+        // return 'false'.
+
+    void exchange(void                 **ptr,
+                  bslma::SharedPtrRep  **rep,
+                  void                  *newPtr,
+                  bslma::SharedPtrRep   *newRep);
+        // Replace the pointer and representation held by this object with the
+        // specified 'newPtr' and 'newRep', acquiring a reference to 'newRep'
+        // (if not 0), and load the previous values into the specified 'ptr'
+        // and 'rep', together with a reference to the latter (if not 0) that
+        // the caller is responsible for releasing.
+
+    void store(void *ptr, bslma::SharedPtrRep *rep);
+        // Replace the pointer and representation held by this object with the
+        // specified 'ptr' and 'rep', acquiring a reference to 'rep' (if not 0)
+        // and releasing the one held on the previous representation.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+
+    void load(void **ptr, bslma::SharedPtrRep **rep) const;
+        // Load the pointer and representation held by this object into the
+        // specified 'ptr' and 'rep', and acquire a reference to the latter (if
+        // not 0) that the caller is responsible for releasing.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                          // =======================
+                          // class atomic_shared_ptr
+                          // =======================
+
+template <class ELEMENT_TYPE>
+class atomic_shared_ptr {
+    // This class template holds a 'shared_ptr<ELEMENT_TYPE>' that may be
+    // loaded, stored, exchanged, and compared-and-exchanged concurrently by
+    // multiple threads.  It is not copyable.
+
+    // DATA
+    BloombergLP::bslstl::AtomicSharedPtr_Imp d_imp;  // untyped implementation
+
+  private:
+    // NOT IMPLEMENTED
+    atomic_shared_ptr(const atomic_shared_ptr&) BSLS_KEYWORD_DELETED;
+    atomic_shared_ptr& operator=(const atomic_shared_ptr&)
+                                                          BSLS_KEYWORD_DELETED;
+
+  public:
+    // TYPES
+    typedef shared_ptr<ELEMENT_TYPE> value_type;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(atomic_shared_ptr,
+                                   BloombergLP::bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit atomic_shared_ptr(
+                          BloombergLP::bslma::Allocator *basicAllocator = 0);
+        // Create an object holding an empty shared pointer.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    atomic_shared_ptr(
+                   const shared_ptr<ELEMENT_TYPE>&  value,
+                   BloombergLP::bslma::Allocator   *basicAllocator = 0);
+        // Create an object holding a copy of the specified 'value'.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    //! ~atomic_shared_ptr() = default;
+        // Release the reference held by this object, if any, and destroy this
+        // object.  The behavior is undefined if any other thread is accessing
+        // this object.
+
+    // MANIPULATORS
+    atomic_shared_ptr& operator=(const shared_ptr<ELEMENT_TYPE>& value);
+        // Atomically replace the shared pointer held by this object with a
+        // copy of the specified 'value', and return a reference providing
+        // modifiable access to this object.
+
+    bool compare_exchange_strong(shared_ptr<ELEMENT_TYPE>&       expected,
+                                 const shared_ptr<ELEMENT_TYPE>& desired);
+    bool compare_exchange_weak(shared_ptr<ELEMENT_TYPE>&       expected,
+                               const shared_ptr<ELEMENT_TYPE>& desired);
+        // If the shared pointer held by this object refers to the same object
+        // as, and shares ownership with, the specified 'expected', atomically
+        // replace it with a copy of the specified 'desired' and return
+        // 'true'.  Otherwise, atomically load the shared pointer held by this
+        // object into 'expected' and return 'false'.  Note that the two
+        // methods are equivalent: neither fails spuriously.
+
+    shared_ptr<ELEMENT_TYPE> exchange(const shared_ptr<ELEMENT_TYPE>& value);
+        // Atomically replace the shared pointer held by this object with a
+        // copy of the specified 'value', and return the shared pointer it
+        // previously held.
+
+    void store(const shared_ptr<ELEMENT_TYPE>& value);
+        // Atomically replace the shared pointer held by this object with a
+        // copy of the specified 'value'.
+
+    // ACCESSORS
+    operator shared_ptr<ELEMENT_TYPE>() const;
+        // Atomically return a copy of the shared pointer held by this object.
+
+    BloombergLP::bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+
+    bool is_lock_free() const;
+        // Return 'true' if the operations on this object are lock-free, and
+        // 'false' otherwise.
+
+    shared_ptr<ELEMENT_TYPE> load() const;
+        // Atomically return a copy of the shared pointer held by this object.
+};
+
+}  // close namespace bsl
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                         // -------------------------
+                         // class AtomicSharedPtr_Imp
+                         // -------------------------
+
+// CLASS METHODS
+inline
+bool AtomicSharedPtr_Imp::isLockFree()
+{
+#ifdef BSLSTL_ATOMICSHAREDPTR_PACKED_WORD
+    return true;
+#else
+    return false;
+#endif
+}
+
+// ACCESSORS
+inline
+bslma::Allocator *AtomicSharedPtr_Imp::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                          // -----------------------
+                          // class atomic_shared_ptr
+                          // -----------------------
+
+// CREATORS
+template <class ELEMENT_TYPE>
+inline
+atomic_shared_ptr<ELEMENT_TYPE>::atomic_shared_ptr(
+                               BloombergLP::bslma::Allocator *basicAllocator)
+: d_imp(basicAllocator)
+{
+}
+
+template <class ELEMENT_TYPE>
+inline
+atomic_shared_ptr<ELEMENT_TYPE>::atomic_shared_ptr(
+                            const shared_ptr<ELEMENT_TYPE>&  value,
+                            BloombergLP::bslma::Allocator   *basicAllocator)
+: d_imp(const_cast<void *>(static_cast<const void *>(value.get())),
+        value.rep(),
+        basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class ELEMENT_TYPE>
+inline
+atomic_shared_ptr<ELEMENT_TYPE>&
+atomic_shared_ptr<ELEMENT_TYPE>::operator=(
+                                         const shared_ptr<ELEMENT_TYPE>& value)
+{
+    store(value);
+    return *this;
+}
+
+template <class ELEMENT_TYPE>
+bool atomic_shared_ptr<ELEMENT_TYPE>::compare_exchange_strong(
+                                      shared_ptr<ELEMENT_TYPE>&       expected,
+                                      const shared_ptr<ELEMENT_TYPE>& desired)
+{
+    void                             *ptr =
+              const_cast<void *>(static_cast<const void *>(expected.get()));
+    BloombergLP::bslma::SharedPtrRep *rep = expected.rep();
+
+    if (d_imp.compareExchange(
+              &ptr,
+              &rep,
+              const_cast<void *>(static_cast<const void *>(desired.get())),
+              desired.rep())) {
+        return true;                                                  // RETURN
+    }
+
+    // 'd_imp' acquired a reference to 'rep' on behalf of 'expected'.
+
+    expected = shared_ptr<ELEMENT_TYPE>(
+                     static_cast<ELEMENT_TYPE *>(ptr),
+                     rep,
+                    BloombergLP::bslstl::SharedPtr_RepFromExistingSharedPtr());
+    return false;
+}
+
+template <class ELEMENT_TYPE>
+inline
+bool atomic_shared_ptr<ELEMENT_TYPE>::compare_exchange_weak(
+                                      shared_ptr<ELEMENT_TYPE>&       expected,
+                                      const shared_ptr<ELEMENT_TYPE>& desired)
+{
+    return compare_exchange_strong(expected, desired);
+}
+
+template <class ELEMENT_TYPE>
+inline
+shared_ptr<ELEMENT_TYPE>
+atomic_shared_ptr<ELEMENT_TYPE>::exchange(
+                                         const shared_ptr<ELEMENT_TYPE>& value)
+{
+    void                             *ptr;
+    BloombergLP::bslma::SharedPtrRep *rep;
+
+    d_imp.exchange(&ptr,
+                   &rep,
+                   const_cast<void *>(static_cast<const void *>(value.get())),
+                   value.rep());
+
+    return shared_ptr<ELEMENT_TYPE>(
+                     static_cast<ELEMENT_TYPE *>(ptr),
+                     rep,
+                    BloombergLP::bslstl::SharedPtr_RepFromExistingSharedPtr());
+}
+
+template <class ELEMENT_TYPE>
+inline
+void atomic_shared_ptr<ELEMENT_TYPE>::store(
+                                         const shared_ptr<ELEMENT_TYPE>& value)
+{
+    d_imp.store(const_cast<void *>(static_cast<const void *>(value.get())),
+                value.rep());
+}
+
+// ACCESSORS
+template <class ELEMENT_TYPE>
+inline
+atomic_shared_ptr<ELEMENT_TYPE>::operator shared_ptr<ELEMENT_TYPE>() const
+{
+    return load();
+}
+
+template <class ELEMENT_TYPE>
+inline
+BloombergLP::bslma::Allocator *
+atomic_shared_ptr<ELEMENT_TYPE>::allocator() const
+{
+    return d_imp.allocator();
+}
+
+template <class ELEMENT_TYPE>
+inline
+bool atomic_shared_ptr<ELEMENT_TYPE>::is_lock_free() const
+{
+    return BloombergLP::bslstl::AtomicSharedPtr_Imp::isLockFree();
+}
+
+template <class ELEMENT_TYPE>
+inline
+shared_ptr<ELEMENT_TYPE> atomic_shared_ptr<ELEMENT_TYPE>::load() const
+{
+    void                             *ptr;
+    BloombergLP::bslma::SharedPtrRep *rep;
+
+    d_imp.load(&ptr, &rep);
+
+    return shared_ptr<ELEMENT_TYPE>(
+                     static_cast<ELEMENT_TYPE *>(ptr),
+                     rep,
+                    BloombergLP::bslstl::SharedPtr_RepFromExistingSharedPtr());
+}
+
+}  // close namespace bsl
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
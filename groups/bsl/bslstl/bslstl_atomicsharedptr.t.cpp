@@ -0,0 +1,999 @@
+// bslstl_atomicsharedptr.t.cpp                                       -*-C++-*-
+#include <bslstl_atomicsharedptr.h>
+
+#include <bslstl_sharedptr.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_issame.h>
+
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_spinlock.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE ThreadId;
+#else
+#include <pthread.h>
+typedef pthread_t ThreadId;
+#endif
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a class template holding a shared pointer
+// that can be read and replaced atomically, implemented by a non-template
+// mechanism using split reference counting.  We first verify, in a single
+// thread, that each operation holds, returns, and releases references to the
+// shared object correctly, and allocates and frees its internal nodes from the
+// intended allocator.  We then verify, with several threads loading, storing,
+// and comparing-and-exchanging concurrently, that readers always observe a
+// fully constructed object, that no update made with
+// 'compare_exchange_strong' is lost, and that every object and node is
+// eventually freed.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit atomic_shared_ptr(bslma::Allocator *ba = 0);
+// [ 2] atomic_shared_ptr(const shared_ptr&, Allocator * = 0);
+// [ 2] ~atomic_shared_ptr();
+//
+// MANIPULATORS
+// [ 3] atomic_shared_ptr& operator=(const shared_ptr<ELEMENT_TYPE>&);
+// [ 4] bool compare_exchange_strong(shared_ptr&, const shared_ptr&);
+// [ 4] bool compare_exchange_weak(shared_ptr&, const shared_ptr&);
+// [ 3] shared_ptr<ELEMENT_TYPE> exchange(const shared_ptr&);
+// [ 3] void store(const shared_ptr<ELEMENT_TYPE>&);
+//
+// ACCESSORS
+// [ 2] operator shared_ptr<ELEMENT_TYPE>() const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] bool is_lock_free() const;
+// [ 2] shared_ptr<ELEMENT_TYPE> load() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENT ACCESS
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'load' compared with a spin-locked 'shared_ptr'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::Types::Int64 Int64;
+
+//=============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+                               // ==============
+                               // class Snapshot
+                               // ==============
+
+class Snapshot {
+    // This class holds a value twice, so that a torn or destroyed object can
+    // be detected, and counts the live objects of its type.
+
+    // DATA
+    int d_value;
+    int d_check;
+
+  public:
+    // CLASS DATA
+    static bsls::AtomicInt s_numLive;
+
+    // CREATORS
+    explicit Snapshot(int value)
+    : d_value(value)
+    , d_check(~value)
+    {
+        ++s_numLive;
+    }
+
+    Snapshot(const Snapshot& original)
+    : d_value(original.d_value)
+    , d_check(original.d_check)
+    {
+        ++s_numLive;
+    }
+
+    ~Snapshot()
+    {
+        d_check = d_value;
+        --s_numLive;
+    }
+
+    // ACCESSORS
+    bool isValid() const
+        // Return 'true' if this object is intact, and 'false' otherwise.
+    {
+        return d_check == ~d_value;
+    }
+
+    int value() const
+        // Return the value of this object.
+    {
+        return d_value;
+    }
+};
+
+bsls::AtomicInt Snapshot::s_numLive(0);
+
+                             // ==================
+                             // class SnapshotPair
+                             // ==================
+
+struct SnapshotPair {
+    // This 'struct' holds two snapshots, so that a shared pointer to the
+    // second can alias one to the pair.
+
+    // DATA
+    Snapshot d_first;
+    Snapshot d_second;
+
+    // CREATORS
+    SnapshotPair(int first, int second)
+    : d_first(first)
+    , d_second(second)
+    {
+    }
+};
+
+typedef bsl::shared_ptr<Snapshot>        SP;
+typedef bsl::atomic_shared_ptr<Snapshot> Obj;
+
+                        // ===========================
+                        // thread creation and joining
+                        // ===========================
+
+extern "C" {
+    typedef void *(*ThreadFunction)(void *arg);
+}
+
+ThreadId createThread(ThreadFunction function, void *arg)
+    // Create a thread running the specified 'function' with the specified
+    // 'arg', and return its identifier.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE) function, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, function, arg);
+    return id;
+#endif
+}
+
+void joinThread(ThreadId id)
+    // Wait for the thread having the specified 'id' to finish.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+                          // ========================
+                          // struct ConcurrentTestArg
+                          // ========================
+
+struct ConcurrentTestArg {
+    // This 'struct' holds the state shared by the threads of the concurrency
+    // test.
+
+    Obj               *d_obj_p;          // object under test
+    bslma::Allocator  *d_allocator_p;    // allocator for snapshots
+    int                d_iterations;     // operations per thread
+    bsls::AtomicInt    d_numErrors;      // invalid snapshots observed
+    bsls::AtomicInt    d_numStarted;     // threads started
+    int                d_numThreads;     // threads expected
+};
+
+void waitForAll(ConcurrentTestArg *arg)
+    // Register the calling thread as started, and wait until all threads have
+    // started.
+{
+    ++arg->d_numStarted;
+    while (arg->d_numStarted < arg->d_numThreads) {
+    }
+}
+
+extern "C" void *readerThread(void *argPtr)
+    // Repeatedly load the object under test and check the snapshot loaded.
+{
+    ConcurrentTestArg *arg = static_cast<ConcurrentTestArg *>(argPtr);
+    waitForAll(arg);
+
+    int previous = 0;
+    for (int i = 0; i < arg->d_iterations; ++i) {
+        SP snapshot = arg->d_obj_p->load();
+        if (!snapshot || !snapshot->isValid()
+         || snapshot->value() < previous) {
+            ++arg->d_numErrors;
+        }
+        else {
+            previous = snapshot->value();
+        }
+    }
+    return 0;
+}
+
+extern "C" void *incrementThread(void *argPtr)
+    // Repeatedly replace the object under test with a snapshot whose value
+    // is one greater, using 'compare_exchange_strong'.
+{
+    ConcurrentTestArg *arg = static_cast<ConcurrentTestArg *>(argPtr);
+    waitForAll(arg);
+
+    for (int i = 0; i < arg->d_iterations; ++i) {
+        SP expected = arg->d_obj_p->load();
+        SP desired;
+        do {
+            if (!expected->isValid()) {
+                ++arg->d_numErrors;
+            }
+            desired.createInplace(arg->d_allocator_p, expected->value() + 1);
+        } while (!arg->d_obj_p->compare_exchange_strong(expected, desired));
+    }
+    return 0;
+}
+
+extern "C" void *exchangeThread(void *argPtr)
+    // Repeatedly exchange the object under test with an equal copy of
+    // itself, checking the snapshot displaced.
+{
+    ConcurrentTestArg *arg = static_cast<ConcurrentTestArg *>(argPtr);
+    waitForAll(arg);
+
+    for (int i = 0; i < arg->d_iterations; ++i) {
+        SP current = arg->d_obj_p->load();
+        SP copy;
+        copy.createInplace(arg->d_allocator_p, *current);
+
+        // Replace 'current' only if it is still current, so that the values
+        // held never decrease.
+
+        if (arg->d_obj_p->compare_exchange_strong(current, copy)) {
+            continue;
+        }
+        if (!current->isValid()) {
+            ++arg->d_numErrors;
+        }
+    }
+    return 0;
+}
+
+                         // ==========================
+                         // struct SpinLockedSharedPtr
+                         // ==========================
+
+struct SpinLockedSharedPtr {
+    // This 'struct' holds a shared pointer guarded by a spin lock, for
+    // comparison with 'atomic_shared_ptr' in the performance test.
+
+    mutable bsls::SpinLock d_lock;
+    SP                     d_value;
+
+    explicit SpinLockedSharedPtr(const SP& value)
+    : d_lock(bsls::SpinLock::s_unlocked)
+    , d_value(value)
+    {
+    }
+
+    SP load() const
+        // Return a copy of the held shared pointer.
+    {
+        bsls::SpinLockGuard guard(&d_lock);
+        return d_value;
+    }
+};
+
+struct PerformanceTestArg {
+    // This 'struct' holds the state shared by the threads of the performance
+    // test.
+
+    const Obj                 *d_atomic_p;
+    const SpinLockedSharedPtr *d_locked_p;
+    int                        d_iterations;
+    bsls::AtomicInt            d_numStarted;
+    int                        d_numThreads;
+    bsls::AtomicInt64          d_sum;
+};
+
+extern "C" void *atomicLoadThread(void *argPtr)
+    // Repeatedly load the 'atomic_shared_ptr' under test.
+{
+    PerformanceTestArg *arg = static_cast<PerformanceTestArg *>(argPtr);
+    ++arg->d_numStarted;
+    while (arg->d_numStarted < arg->d_numThreads) {
+    }
+
+    Int64 sum = 0;
+    for (int i = 0; i < arg->d_iterations; ++i) {
+        sum += arg->d_atomic_p->load()->value();
+    }
+    arg->d_sum += sum;
+    return 0;
+}
+
+extern "C" void *lockedLoadThread(void *argPtr)
+    // Repeatedly load the spin-locked shared pointer.
+{
+    PerformanceTestArg *arg = static_cast<PerformanceTestArg *>(argPtr);
+    ++arg->d_numStarted;
+    while (arg->d_numStarted < arg->d_numThreads) {
+    }
+
+    Int64 sum = 0;
+    for (int i = 0; i < arg->d_iterations; ++i) {
+        sum += arg->d_locked_p->load()->value();
+    }
+    arg->d_sum += sum;
+    return 0;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct Config {
+    int d_timeout;
+    int d_maxConnections;
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+//  bool veryVeryVerbose     = argc > 4;
+//  bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate the usage example from the header into the test
+        //:   driver, remove leading comment characters, and replace 'assert'
+        //:   with 'ASSERT'.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Example 1: Publishing a Configuration Snapshot
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service keeps its configuration in an immutable object that
+// is read on every request, and replaced (rarely) when an administrator
+// changes a setting.  Guarding the configuration with a mutex would make every
+// request contend for that mutex; instead we publish it through an
+// 'atomic_shared_ptr'.
+//
+// First, we define the configuration type (see 'struct Config' above).
+// Then, we create the initial configuration and publish it:
+//..
+    bslma::TestAllocator ta;
+
+    bsl::shared_ptr<Config> initial;
+    initial.createInplace(&ta);
+    initial->d_timeout        = 30;
+    initial->d_maxConnections = 100;
+
+    bsl::atomic_shared_ptr<Config> current(initial, &ta);
+    initial.reset();
+//..
+// Next, a reader obtains the current configuration.  The snapshot it obtains
+// stays valid for as long as the reader holds it, however often the
+// configuration is replaced in the meantime:
+//..
+    bsl::shared_ptr<Config> snapshot = current.load();
+    ASSERT(30 == snapshot->d_timeout);
+//..
+// Now, an administrator publishes a new configuration, based on the current
+// one:
+//..
+    bsl::shared_ptr<Config> updated;
+    updated.createInplace(&ta, *current.load());
+    updated->d_timeout = 60;
+    current.store(updated);
+//..
+// Finally, we observe that new readers see the new configuration while the
+// earlier snapshot is unchanged:
+//..
+    ASSERT(60 == current.load()->d_timeout);
+    ASSERT(30 == snapshot->d_timeout);
+//..
+// If several writers can update the configuration concurrently, each should
+// use 'compare_exchange_strong' in a loop so that no update is lost.
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENT ACCESS
+        //
+        // Concerns:
+        //: 1 A snapshot loaded while other threads replace the object is
+        //:   always a fully constructed, live object.
+        //:
+        //: 2 No increment made by 'compare_exchange_strong' in a retry loop is
+        //:   lost.
+        //:
+        //: 3 Every snapshot and internal node is freed once the object is
+        //:   destroyed.
+        //
+        // Plan:
+        //: 1 Run reader threads that load the object and check the snapshot
+        //:   (including that its value never decreases), alongside threads
+        //:   that increment the value by 'compare_exchange_strong' and
+        //:   threads that replace the value with an equal copy.  (C-1)
+        //:
+        //: 2 Verify that the final value is the total number of increments.
+        //:   (C-2)
+        //:
+        //: 3 After destroying the object, verify that no snapshot is live and
+        //:   no memory is in use.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENT ACCESS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENT ACCESS"
+                            "\n=================\n");
+
+        enum {
+            k_NUM_READERS    = 4,
+            k_NUM_INCREMENTS = 2,
+            k_NUM_EXCHANGES  = 2,
+            k_NUM_THREADS    = k_NUM_READERS
+                             + k_NUM_INCREMENTS
+                             + k_NUM_EXCHANGES,
+            k_ITERATIONS     = 20000
+        };
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator sa("snapshots", veryVerbose);
+        {
+            SP initial;
+            initial.createInplace(&sa, 0);
+
+            Obj mX(initial, &oa);
+            initial.reset();
+
+            ConcurrentTestArg arg;
+            arg.d_obj_p         = &mX;
+            arg.d_allocator_p   = &sa;
+            arg.d_iterations    = k_ITERATIONS;
+            arg.d_numThreads    = k_NUM_THREADS;
+
+            ThreadId threads[k_NUM_THREADS];
+            int      t = 0;
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                threads[t++] = createThread(&readerThread, &arg);
+            }
+            for (int i = 0; i < k_NUM_INCREMENTS; ++i) {
+                threads[t++] = createThread(&incrementThread, &arg);
+            }
+            for (int i = 0; i < k_NUM_EXCHANGES; ++i) {
+                threads[t++] = createThread(&exchangeThread, &arg);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                joinThread(threads[i]);
+            }
+
+            ASSERTV(arg.d_numErrors, 0 == arg.d_numErrors);
+
+            const SP X = mX.load();
+            ASSERTV(X->value(),
+                    k_NUM_INCREMENTS * k_ITERATIONS == X->value());
+            ASSERTV(Snapshot::s_numLive, 1 == Snapshot::s_numLive);
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+        }
+        ASSERTV(Snapshot::s_numLive, 0 == Snapshot::s_numLive);
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'compare_exchange_strong' AND 'compare_exchange_weak'
+        //
+        // Concerns:
+        //: 1 If the held shared pointer refers to the same object as, and
+        //:   shares ownership with, 'expected', it is replaced by 'desired',
+        //:   and 'true' is returned; 'expected' is unchanged.
+        //:
+        //: 2 Otherwise, including when the held pointer is equal to that of
+        //:   'expected' but ownership is not shared, 'expected' is set to the
+        //:   held shared pointer, and 'false' is returned.
+        //:
+        //: 3 Empty shared pointers compare equal to one another.
+        //:
+        //: 4 Reference counts and internal nodes are maintained correctly in
+        //:   each case.
+        //
+        // Plan:
+        //: 1 Perform each kind of exchange, successful and unsuccessful, on
+        //:   objects holding empty and non-empty values, and verify the
+        //:   results, the 'use_count' of the shared pointers involved, and
+        //:   the blocks in use by the object allocator.  (C-1..4)
+        //
+        // Testing:
+        //   bool compare_exchange_strong(shared_ptr&, const shared_ptr&);
+        //   bool compare_exchange_weak(shared_ptr&, const shared_ptr&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'compare_exchange_strong' AND"
+                            " 'compare_exchange_weak'"
+                            "\n============================="
+                            "========================\n");
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator sa("snapshots", veryVerbose);
+        {
+            SP a;  a.createInplace(&sa, 1);
+            SP b;  b.createInplace(&sa, 2);
+            SP c;  c.createInplace(&sa, 3);
+
+            Obj mX(a, &oa);  const Obj& X = mX;
+            ASSERT(2 == a.use_count());
+
+            if (veryVerbose) printf("\tSuccessful exchange.\n");
+
+            SP expected = a;
+            ASSERT(mX.compare_exchange_strong(expected, b));
+            ASSERT(expected == a);
+            ASSERT(X.load() == b);
+            ASSERTV(a.use_count(), 2 == a.use_count());
+            ASSERTV(b.use_count(), 2 == b.use_count());
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+            if (veryVerbose) printf("\tUnsuccessful exchange.\n");
+
+            ASSERT(!mX.compare_exchange_strong(expected, c));
+            ASSERT(expected == b);
+            ASSERT(X.load() == b);
+            ASSERTV(a.use_count(), 1 == a.use_count());
+            ASSERTV(b.use_count(), 3 == b.use_count());
+            ASSERTV(c.use_count(), 1 == c.use_count());
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+            if (veryVerbose) printf("\tSame pointer, distinct owner.\n");
+
+            SP alias(SP(), b.get());
+            ASSERT(alias.get() == b.get());
+
+            expected = alias;
+            ASSERT(!mX.compare_exchange_weak(expected, c));
+            ASSERT(expected == b);
+            ASSERT(expected.rep() == b.rep());
+
+            ASSERT(mX.compare_exchange_weak(expected, c));
+            ASSERT(X.load() == c);
+            ASSERTV(b.use_count(), 2 == b.use_count());
+
+            if (veryVerbose) printf("\tEmpty values.\n");
+
+            SP empty;
+            expected = c;
+            ASSERT(mX.compare_exchange_strong(expected, empty));
+            ASSERT(!X.load());
+            ASSERTV(c.use_count(), 2 == c.use_count());
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+            expected = a;
+            ASSERT(!mX.compare_exchange_strong(expected, b));
+            ASSERT(!expected);
+
+            ASSERT(mX.compare_exchange_strong(expected, a));
+            ASSERT(X.load() == a);
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+        }
+        ASSERTV(Snapshot::s_numLive, 0 == Snapshot::s_numLive);
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'store', 'operator=', AND 'exchange'
+        //
+        // Concerns:
+        //: 1 'store' and 'operator=' replace the held shared pointer with a
+        //:   copy of their argument and release the previous one.
+        //:
+        //: 2 'exchange' does the same, and returns the previous shared
+        //:   pointer with its ownership.
+        //:
+        //: 3 Storing an empty shared pointer frees the internal node and
+        //:   allocates nothing; storing a non-empty one allocates exactly one
+        //:   node from the object allocator.
+        //:
+        //: 4 An aliasing shared pointer is stored with its own pointer.
+        //
+        // Plan:
+        //: 1 Perform each operation and verify the value held, the
+        //:   'use_count' of the shared pointers involved, and the blocks in
+        //:   use by the object allocator.  (C-1..4)
+        //
+        // Testing:
+        //   atomic_shared_ptr& operator=(const shared_ptr<ELEMENT_TYPE>&);
+        //   shared_ptr<ELEMENT_TYPE> exchange(const shared_ptr&);
+        //   void store(const shared_ptr<ELEMENT_TYPE>&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'store', 'operator=', AND 'exchange'"
+                            "\n====================================\n");
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator sa("snapshots", veryVerbose);
+        {
+            SP a;  a.createInplace(&sa, 1);
+            SP b;  b.createInplace(&sa, 2);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.store(a);
+            ASSERT(X.load() == a);
+            ASSERTV(a.use_count(), 2 == a.use_count());
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+            mX = b;
+            ASSERT(X.load() == b);
+            ASSERTV(a.use_count(), 1 == a.use_count());
+            ASSERTV(b.use_count(), 2 == b.use_count());
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+            SP prior = mX.exchange(a);
+            ASSERT(prior == b);
+            ASSERT(X.load() == a);
+            ASSERTV(a.use_count(), 2 == a.use_count());
+            ASSERTV(b.use_count(), 2 == b.use_count());
+
+            prior = mX.exchange(SP());
+            ASSERT(prior == a);
+            ASSERT(!X.load());
+            ASSERTV(a.use_count(), 2 == a.use_count());
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+            const Int64 numAllocations = oa.numAllocations();
+            mX.store(SP());
+            ASSERT(!X.load());
+            ASSERTV(numAllocations == oa.numAllocations());
+
+            SP aliased(a, a.get());
+            bsl::shared_ptr<SnapshotPair> pair;
+            pair.createInplace(&sa, 5, 6);
+            SP second(pair, &pair->d_second);
+
+            mX = second;
+            ASSERT(X.load().get() == &pair->d_second);
+            ASSERT(6 == X.load()->value());
+            ASSERTV(pair.use_count(), 3 == pair.use_count());
+
+            pair.reset();
+            second.reset();
+            ASSERT(6 == X.load()->value());
+            mX.store(aliased);
+            ASSERT(X.load() == a);
+        }
+        ASSERTV(Snapshot::s_numLive, 0 == Snapshot::s_numLive);
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'load', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed object holds an empty shared pointer, and
+        //:   allocates nothing.
+        //:
+        //: 2 An object created from a shared pointer holds a copy of it, for
+        //:   which it allocates one node from the intended allocator.
+        //:
+        //: 3 'load' and the conversion operator return a copy of the held
+        //:   shared pointer, sharing ownership with it.
+        //:
+        //: 4 The destructor releases the held reference and frees the node.
+        //:
+        //: 5 'allocator' returns the intended allocator, and 'is_lock_free'
+        //:   returns 'true' on platforms having the packed implementation.
+        //
+        // Plan:
+        //: 1 Create objects with and without a value, and with and without an
+        //:   allocator, and verify the results of the accessors, the
+        //:   'use_count' of the shared pointers, and the blocks in use by the
+        //:   allocators before and after destroying the objects.  (C-1..5)
+        //
+        // Testing:
+        //   explicit atomic_shared_ptr(bslma::Allocator *ba = 0);
+        //   atomic_shared_ptr(const shared_ptr&, Allocator * = 0);
+        //   ~atomic_shared_ptr();
+        //   operator shared_ptr<ELEMENT_TYPE>() const;
+        //   bslma::Allocator *allocator() const;
+        //   bool is_lock_free() const;
+        //   shared_ptr<ELEMENT_TYPE> load() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, 'load', AND BASIC ACCESSORS"
+                            "\n=====================================\n");
+
+        ASSERT((bsl::is_same<SP, Obj::value_type>::value));
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator sa("snapshots", veryVerbose);
+        {
+            const Obj X;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(!X.load());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+#ifdef BSLSTL_ATOMICSHAREDPTR_PACKED_WORD
+            ASSERT(X.is_lock_free());
+#else
+            ASSERT(!X.is_lock_free());
+#endif
+
+            const Obj Y(&oa);
+            ASSERT(&oa == Y.allocator());
+            ASSERT(!Y.load());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            const Obj Z((SP()), &oa);
+            ASSERT(!Z.load());
+            ASSERT(0 == oa.numBlocksTotal());
+        }
+        {
+            SP a;  a.createInplace(&sa, 7);
+
+            {
+                const Obj X(a, &oa);
+                ASSERTV(a.use_count(), 2 == a.use_count());
+                ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+                SP b = X.load();
+                ASSERT(b == a);
+                ASSERT(b.rep() == a.rep());
+                ASSERTV(a.use_count(), 3 == a.use_count());
+
+                SP c = X;
+                ASSERT(c == a);
+                ASSERTV(a.use_count(), 4 == a.use_count());
+            }
+            ASSERTV(a.use_count(), 1 == a.use_count());
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+            {
+                const Obj X(a);
+                ASSERT(&defaultAllocator == X.allocator());
+                ASSERTV(defaultAllocator.numBlocksInUse(),
+                        1 == defaultAllocator.numBlocksInUse());
+            }
+            ASSERTV(defaultAllocator.numBlocksInUse(),
+                    0 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERTV(Snapshot::s_numLive, 0 == Snapshot::s_numLive);
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform an ad-hoc test of the primary operations.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        {
+            SP a;  a.createInplace(&oa, 1);
+            SP b;  b.createInplace(&oa, 2);
+
+            Obj mX(a, &oa);  const Obj& X = mX;
+            ASSERT(1 == X.load()->value());
+
+            mX.store(b);
+            ASSERT(2 == X.load()->value());
+
+            SP prior = mX.exchange(a);
+            ASSERT(2 == prior->value());
+            ASSERT(1 == X.load()->value());
+
+            SP expected = a;
+            ASSERT(mX.compare_exchange_strong(expected, b));
+            ASSERT(2 == X.load()->value());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'load' COMPARED WITH A SPIN-LOCKED 'shared_ptr'
+        //
+        // Concerns:
+        //: 1 Concurrent 'load' operations scale better than copying a shared
+        //:   pointer under a lock.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 threads, time the same number of loads per
+        //:   thread from an 'atomic_shared_ptr' and from a shared pointer
+        //:   guarded by a 'bsls::SpinLock', and report the elapsed times.  The
+        //:   number of loads per thread can be given as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: 'load' compared with a spin-locked 'shared_ptr'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'load' COMPARED WITH A"
+                            " SPIN-LOCKED 'shared_ptr'"
+                            "\n==================================="
+                            "=========================\n");
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bslma::Allocator *allocator =
+                                   &bslma::NewDeleteAllocator::singleton();
+
+        SP value;
+        value.createInplace(allocator, 1);
+
+        const Obj X(value, allocator);
+
+        const SpinLockedSharedPtr locked(value);
+
+        printf("threads   atomic_shared_ptr   spin-locked\n");
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            double elapsed[2];
+            for (int kind = 0; kind < 2; ++kind) {
+                PerformanceTestArg arg;
+                arg.d_atomic_p   = &X;
+                arg.d_locked_p   = &locked;
+                arg.d_iterations = NUM_ITERATIONS;
+                arg.d_numThreads = numThreads;
+
+                ThreadId threads[8];
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < numThreads; ++i) {
+                    threads[i] = createThread(kind ? &lockedLoadThread
+                                                   : &atomicLoadThread,
+                                              &arg);
+                }
+                for (int i = 0; i < numThreads; ++i) {
+                    joinThread(threads[i]);
+                }
+                timer.stop();
+                elapsed[kind] = timer.elapsedTime();
+
+                ASSERTV(arg.d_sum,
+                        static_cast<Int64>(NUM_ITERATIONS) * numThreads ==
+                                                                   arg.d_sum);
+            }
+            printf("%7d   %16gs   %10gs\n",
+                   numThreads,
+                   elapsed[0],
+                   elapsed[1]);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1656 @@
+// bslstl_flatmap.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMAP
+#define INCLUDED_BSLSTL_FLATMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map of unique keys held in contiguous storage.
+//
+//@CLASSES:
+//   bsl::flat_map: map of unique keys to values held in a sorted 'bsl::vector'
+//
+//@SEE_ALSO: bslstl_flatmultimap, bslstl_flattree, bslstl_map
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_map', implementing an ordered associative container mapping
+// unique keys to values, with the interface of 'bsl::map' (less the
+// guarantees of iterator stability), but holding its key-value pairs in a
+// sorted 'bsl::vector' (see 'bslstl_flattree') rather than in a red-black
+// tree.
+//
+// An instantiation of 'flat_map' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of key-value pairs) and the
+// ordered sequence of key-value pairs the 'flat_map' contains.
+//
+// Unlike 'bsl::map', whose 'value_type' is 'pair<const KEY, VALUE>', the
+// 'value_type' of a 'flat_map' is 'pair<KEY, VALUE>', so that its elements
+// can be moved within the underlying array.  The behavior is undefined if the
+// key of an element is modified through an iterator.
+//
+///Choosing Between 'map' and 'flat_map'
+///-------------------------------------
+// A 'bsl::map' allocates a tree node per element; a lookup follows one
+// pointer per level of the tree, typically incurring a cache miss at each
+// level once the map is larger than the cache.  A 'flat_map' allocates one
+// array for all of its elements, and looks up a key by a (branch-free) binary
+// search over that array, which touches far fewer cache lines, and iterates
+// over its elements as over an array.  On the other hand, inserting into or
+// erasing from a 'flat_map' moves all of the elements that follow the
+// affected position, and invalidates all iterators and references.  A
+// 'flat_map' is therefore best suited to maps that are built once (ideally in
+// bulk, see {Bulk Insertion}) and then searched often, such as configuration
+// and reference tables.
+//
+///Bulk Insertion
+///--------------
+// Inserting 'm' elements one at a time into a 'flat_map' of 'n' elements takes
+// 'O[m * (n + m)]' time.  The range constructors and the range 'insert'
+// instead append the range and merge it with the existing elements (see
+// 'bslstl_flattree'), taking 'O[n + m * log(m)]' time.  If the range is
+// already sorted by key and free of duplicate keys, passing
+// 'bsl::sorted_unique' to the constructor or to 'insert' skips the sort, so
+// that building a 'flat_map' from such a range takes linear time.  The merge
+// moves the elements into a newly allocated array, so it temporarily requires
+// memory for a second copy of them, and if an exception is thrown during the
+// merge, the 'flat_map' is left empty.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'flat_map''s 'ALLOCATOR' template parameter
+// determines how that 'flat_map' will allocate memory.  If it is
+// 'bsl::allocator' (the default), then a 'flat_map' accepts an optional
+// 'bslma::Allocator' argument at construction, uses it to supply memory for
+// its array of elements, and supplies it to the keys and values themselves if
+// they have the 'bslma::UsesBslmaAllocator' trait.  If no allocator is
+// supplied, the currently installed default allocator is used.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_map':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the 'flat_map'
+//  'V'             - (template parameter) type 'VALUE' of the 'flat_map'
+//  'a', 'b'        - two distinct objects of type 'flat_map<K, V>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'k'             - an object of type 'K'
+//  'v'             - an object of type 'pair<K, V>'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  'i1', 'i2'      - two iterators defining a sequence of 'pair<K, V>'
+//  'N'             - distance(i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_map<K, V> a;  (default construction)          | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | flat_map<K, V> a(b);  (copy construction)          | O[m]               |
+//  +----------------------------------------------------+--------------------+
+//  | flat_map<K, V> a(i1, i2);                          | O[N * log(N)]      |
+//  +----------------------------------------------------+--------------------+
+//  | flat_map<K, V> a(sorted_unique, i1, i2);           | O[N]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.count(k), a.lower_bound(k),           | O[log(n)]          |
+//  | a.upper_bound(k), a.equal_range(k), a.at(k)        |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a[k]                                               | O[log(n)] if 'k'   |
+//  |                                                    | is present, O[n]   |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(v), a.emplace(...), a.erase(k)            | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(p1, v)                                    | O[n], and no       |
+//  |                                                    | search if 'p1' is  |
+//  |                                                    | the correct place  |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[n + N * log(N)]  |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(sorted_unique, i1, i2)                    | O[n + N]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1), a.erase(p1, p2)                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a, b)                              | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b, a < b, a <= b, a > b, a >= b       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.size(), a.empty(),           | O[1]               |
+//  | a.capacity(), a.reserve(n), a.clear()              |                    |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Currency Conversion Table
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose a pricing service loads, at start-up, the conversion rates of a few
+// dozen currencies to US dollars, and then converts amounts many times per
+// second.
+//
+// First, we load the rates, in any order, in a single bulk insertion:
+//..
+//  typedef bsl::pair<bsl::string, double> Rate;
+//
+//  const Rate RATES[] = { Rate("JPY", 0.0091),
+//                         Rate("EUR", 1.1800),
+//                         Rate("GBP", 1.3900) };
+//  const int  NUM_RATES = sizeof RATES / sizeof *RATES;
+//
+//  bsl::flat_map<bsl::string, double> rates(RATES, RATES + NUM_RATES);
+//  assert(3 == rates.size());
+//  assert("EUR" == rates.begin()->first);
+//..
+// Then, we convert an amount, using 'at', which throws 'bsl::out_of_range'
+// for an unknown currency:
+//..
+//  assert(118.0 == 100.0 * rates.at("EUR"));
+//..
+// Finally, an update adds one currency and replaces the rate of another,
+// using 'operator[]':
+//..
+//  rates["CHF"] = 1.0800;
+//  rates["JPY"] = 0.0090;
+//  assert(4      == rates.size());
+//  assert(0.0090 == rates.find("JPY")->second);
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_flattree.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_stdexceptutil.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_rangecompare.h>
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_destructorguard.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace bsl {
+
+                              // ==============
+                              // class flat_map
+                              // ==============
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<pair<KEY, VALUE> > >
+class flat_map {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs having unique keys (of the
+    // template parameter type, 'KEY') and associated values (of the template
+    // parameter type, 'VALUE') in contiguous storage.  Insertion and removal
+    // invalidate all iterators, pointers, and references to the elements of
+    // the container.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   except for 'BDEX' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::FlatTree<
+                   BloombergLP::bslstl::UnorderedMapKeyConfiguration<
+                                                          KEY,
+                                                          pair<KEY, VALUE> >,
+                   COMPARATOR,
+                   ALLOCATOR>                          Tree;
+        // This 'typedef' is an alias for the implementation of this map.
+
+    typedef bsl::allocator_traits<ALLOCATOR>           AllocatorTraits;
+        // This 'typedef' is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef BloombergLP::bslmf::MovableRefUtil         MoveUtil;
+        // This 'typedef' is a convenient alias for the utility associated
+        // with movable references.
+
+    // DATA
+    Tree d_tree;  // key-value pairs, sorted by key
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef pair<KEY, VALUE>                           value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename Tree::Container                   container_type;
+    typedef typename container_type::size_type         size_type;
+    typedef typename container_type::difference_type   difference_type;
+    typedef typename container_type::pointer           pointer;
+    typedef typename container_type::const_pointer     const_pointer;
+
+    typedef typename container_type::iterator          iterator;
+    typedef typename container_type::const_iterator    const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' by adapting an object of (template parameter) type
+        // 'COMPARATOR', which compares two objects of (template parameter)
+        // type 'KEY'.  Note that this class matches the definition of
+        // 'map::value_compare'.
+
+        // FRIENDS
+        friend class flat_map;
+
+      protected:
+        // PROTECTED DATA
+        COMPARATOR comp;  // we would not have elected to make this data
+                          // member 'protected'
+
+        // PROTECTED CREATORS
+        value_compare(COMPARATOR comparator);                       // IMPLICIT
+            // Create a 'value_compare' object that uses the specified
+            // 'comparator'.
+
+      public:
+        // PUBLIC TYPES
+        typedef bool result_type;
+            // This 'typedef' is an alias for the result type of a call to the
+            // overload of 'operator()' (the comparison function) provided by a
+            // 'flat_map::value_compare' object.
+
+        typedef value_type first_argument_type;
+            // This 'typedef' is an alias for the type of the first parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'flat_map::value_compare' object.
+
+        typedef value_type second_argument_type;
+            // This 'typedef' is an alias for the type of the second parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'flat_map::value_compare' object.
+
+        // ACCESSORS
+        bool operator()(const value_type& x, const value_type& y) const;
+            // Return 'true' if the key of the specified 'x' object is ordered
+            // before that of the specified 'y' object, as determined by the
+            // comparator supplied at construction, and 'false' otherwise.
+    };
+
+    // CREATORS
+    flat_map();
+    explicit flat_map(const COMPARATOR& comparator,
+                      const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Create an empty map.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator is used.
+    : d_tree(comparator, basicAllocator)
+    {
+        // The implementation is placed here in the class definition to work
+        // around an AIX compiler bug, as for 'bsl::map'.
+    }
+
+    explicit flat_map(const ALLOCATOR& basicAllocator);
+        // Create an empty map that uses the specified 'basicAllocator' to
+        // supply memory, and a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order its keys.
+
+    flat_map(const flat_map& original);
+        // Create a map having the same value as the specified 'original'
+        // object, using a copy of 'original.key_comp()' to order keys and
+        // the allocator returned by 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // supply memory.
+
+    flat_map(BloombergLP::bslmf::MovableRef<flat_map> original);    // IMPLICIT
+        // Create a map having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new map.  The comparator and allocator of 'original' are
+        // propagated to the new map.  'original' is left in a valid but
+        // unspecified state.
+
+    flat_map(const flat_map& original, const ALLOCATOR& basicAllocator);
+        // Create a map having the same value as the specified 'original'
+        // object, using a copy of 'original.key_comp()' to order keys and the
+        // specified 'basicAllocator' to supply memory.
+
+    flat_map(BloombergLP::bslmf::MovableRef<flat_map> original,
+             const ALLOCATOR&                         basicAllocator);
+        // Create a map having the same value as the specified 'original'
+        // object, using a copy of 'original.key_comp()' to order keys and the
+        // specified 'basicAllocator' to supply memory.  The contents of
+        // 'original' are moved (in constant time) if 'basicAllocator' equals
+        // 'original.get_allocator()', and are move-inserted (in linear time)
+        // otherwise.  'original' is left in a valid but unspecified state.
+
+    template <class INPUT_ITERATOR>
+    flat_map(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator     = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_map(INPUT_ITERATOR   first,
+             INPUT_ITERATOR   last,
+             const ALLOCATOR& basicAllocator);
+        // Create a map holding the elements in the specified range
+        // '[first .. last)' having unique keys, keeping the first of any
+        // elements having equivalent keys.  Optionally specify a 'comparator'
+        // used to order keys.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  'INPUT_ITERATOR' must meet the requirements of
+        // an input iterator, and its 'value_type' must be convertible to
+        // 'value_type'.
+
+    template <class INPUT_ITERATOR>
+    flat_map(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator     = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_map(sorted_unique_t,
+             INPUT_ITERATOR   first,
+             INPUT_ITERATOR   last,
+             const ALLOCATOR& basicAllocator);
+        // Create a map holding the elements in the specified range
+        // '[first .. last)', in linear time.  Optionally specify a
+        // 'comparator' and a 'basicAllocator', as for the constructor without
+        // a 'sorted_unique_t' argument.  The behavior is undefined unless the
+        // range is sorted by key with respect to the comparator and contains
+        // no elements having equivalent keys.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_map(std::initializer_list<value_type> values,
+             const COMPARATOR&                 comparator     = COMPARATOR(),
+             const ALLOCATOR&                  basicAllocator = ALLOCATOR());
+    flat_map(std::initializer_list<value_type> values,
+             const ALLOCATOR&                  basicAllocator);
+        // Create a map holding the elements in the specified 'values'
+        // initializer list having unique keys, keeping the first of any
+        // elements having equivalent keys.  Optionally specify a 'comparator'
+        // and a 'basicAllocator', as for the range constructor.
+#endif
+
+    //! ~flat_map() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_map& operator=(const flat_map& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if
+        // the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    flat_map& operator=(BloombergLP::bslmf::MovableRef<flat_map> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  The contents of 'rhs' are moved (in constant time) if
+        // 'get_allocator() == rhs.get_allocator()', and are move-inserted (in
+        // linear time) otherwise.  'rhs' is left in a valid but unspecified
+        // state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_map& operator=(std::initializer_list<value_type> values);
+        // Assign to this object the elements of the specified 'values'
+        // initializer list having unique keys, and return a reference
+        // providing modifiable access to this object.
+#endif
+
+    VALUE& operator[](const key_type& key);
+        // Return a reference providing modifiable access to the value
+        // associated with the specified 'key' in this map, first inserting a
+        // default-constructed 'VALUE' for 'key' if 'key' is not already in
+        // this map.  This method requires that 'KEY' be copy-constructible
+        // and 'VALUE' be default-constructible.
+
+    VALUE& at(const key_type& key);
+        // Return a reference providing modifiable access to the value
+        // associated with the specified 'key' in this map, if 'key' is in
+        // this map; otherwise throw a 'std::out_of_range' exception.
+
+    pair<iterator, bool> insert(const value_type& value);
+    pair<iterator, bool> insert(
+                           BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this map if its key is not
+        // equivalent to a key already in this map.  Return a pair whose
+        // 'first' member is an iterator to the element in this map having a
+        // key equivalent to that of 'value', and whose 'second' member is
+        // 'true' if 'value' was inserted, and 'false' otherwise.
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this map if its key is not
+        // equivalent to a key already in this map, and return an iterator to
+        // the element in this map having a key equivalent to that of 'value'.
+        // If the specified 'hint' is the position before which 'value' must
+        // be inserted, no search is made.  The behavior is undefined unless
+        // 'hint' is an iterator in the range '[begin() .. end()]'.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map each element in the specified range
+        // '[first .. last)' whose key is not equivalent to a key already in
+        // this map or to that of a preceding element in the range.  If an
+        // exception is thrown while the elements are merged with the existing
+        // elements, this map is left empty.  The behavior is undefined unless
+        // the range does not refer to elements of this map.  Note that the
+        // elements are inserted in bulk (see {Bulk Insertion}).
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map each element in the specified range
+        // '[first .. last)' whose key is not equivalent to a key already in
+        // this map, in linear time.  If an exception is thrown while the
+        // elements are merged with the existing elements, this map is left
+        // empty.  The behavior is undefined unless the range is sorted by key,
+        // contains no elements having equivalent keys, and does not refer to
+        // elements of this map.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<value_type> values);
+        // Insert into this map each element in the specified 'values'
+        // initializer list whose key is not equivalent to a key already in
+        // this map or to that of a preceding element in the list.  If an
+        // exception is thrown while the elements are merged with the existing
+        // elements, this map is left empty.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    pair<iterator, bool> emplace(ARGS&&... arguments);
+        // Insert into this map a newly created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'arguments' to the corresponding
+        // constructor of 'value_type', if its key is not equivalent to a key
+        // already in this map.  Return a pair whose 'first' member is an
+        // iterator to the element in this map having a key equivalent to that
+        // of the new object, and whose 'second' member is 'true' if the object
+        // was inserted, and 'false' otherwise.
+
+    template <class... ARGS>
+    iterator emplace_hint(const_iterator hint, ARGS&&... arguments);
+        // Insert into this map a newly created 'value_type' object,
+        // constructed as for 'emplace' from the specified 'arguments', if its
+        // key is not equivalent to a key already in this map, and return an
+        // iterator to the element in this map having a key equivalent to that
+        // of the new object.  The specified 'hint' is ignored.
+#endif
+
+    iterator erase(const_iterator position);
+        // Remove from this map the element at the specified 'position', and
+        // return an iterator to the element that followed it (or 'end()').
+        // The behavior is undefined unless 'position' is an iterator in the
+        // range '[cbegin() .. cend())'.
+
+    size_type erase(const key_type& key);
+        // Remove from this map the element having a key equivalent to the
+        // specified 'key', if such an element exists, and return the number
+        // of elements removed.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the elements in the specified range
+        // '[first .. last)', and return 'last'.  The behavior is undefined
+        // unless '[first .. last)' is a valid range of this map.
+
+    void swap(flat_map& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  If the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_swap', also exchange the allocators.  This
+        // method provides the no-throw guarantee and takes constant time if
+        // the allocators are exchanged or are equal; otherwise, the values
+        // are exchanged by copying, in linear time.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all elements from this map, retaining its capacity.
+
+    void reserve(size_type numElements);
+        // Ensure that this map can hold the specified 'numElements' without
+        // reallocating.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this map to its size, if possible.
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator to the first (i.e., least-keyed) element in this
+        // map, or the past-the-end iterator if this map is empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator of this map.
+
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator to the last (i.e., greatest-keyed)
+        // element in this map, or the past-the-end reverse iterator if this
+        // map is empty.
+
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator of this map.
+
+    iterator find(const key_type& key);
+        // Return an iterator to the element in this map having a key
+        // equivalent to the specified 'key', if such an element exists, and
+        // 'end()' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator to the element in this map having a key
+        // equivalent to the specified 'key', if such an element exists, and
+        // 'end()' otherwise.  This overload participates in overload
+        // resolution only if 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.find(key);
+    }
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator to the first (i.e., least-keyed) element in this
+        // map whose key is not ordered before the specified 'key', and
+        // 'end()' if there is no such element.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    lower_bound(const LOOKUP_KEY& key)
+        // Return an iterator to the first (i.e., least-keyed) element in this
+        // map whose key is not ordered before the specified 'key', and
+        // 'end()' if there is no such element.  This overload participates in
+        // overload resolution only if 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.lowerBound(key);
+    }
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator to the first (i.e., least-keyed) element in this
+        // map whose key is ordered after the specified 'key', and 'end()' if
+        // there is no such element.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    upper_bound(const LOOKUP_KEY& key)
+        // Return an iterator to the first (i.e., least-keyed) element in this
+        // map whose key is ordered after the specified 'key', and 'end()' if
+        // there is no such element.  This overload participates in overload
+        // resolution only if 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.upperBound(key);
+    }
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators delimiting the elements in this map
+        // having a key equivalent to the specified 'key' (i.e., at most one
+        // element).
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators delimiting the elements in this map
+        // having a key equivalent to the specified 'key'.  This overload
+        // participates in overload resolution only if 'COMPARATOR' is
+        // transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.equalRange(key);
+    }
+
+    // ACCESSORS
+    const VALUE& at(const key_type& key) const;
+        // Return a reference providing non-modifiable access to the value
+        // associated with the specified 'key' in this map, if 'key' is in
+        // this map; otherwise throw a 'std::out_of_range' exception.
+
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // map.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., least-keyed) element in this map, or the past-the-end
+        // iterator if this map is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator providing non-modifiable access to
+        // this map.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last (i.e., greatest-keyed) element in this map, or the
+        // past-the-end reverse iterator if this map is empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator providing non-modifiable
+        // access to this map.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this map.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this map could possibly hold.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements this map can hold without
+        // reallocating.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor used by this map.
+
+    value_compare value_comp() const;
+        // Return a functor ordering elements of this map by key, using the
+        // key-comparison functor of this map.
+
+    const container_type& values() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reference providing non-modifiable access to the sequence
+        // of elements in this map, sorted by key.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the element
+        // in this map having a key equivalent to the specified 'key', if such
+        // an element exists, and 'end()' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the element
+        // in this map having a key equivalent to the specified 'key', if such
+        // an element exists, and 'end()' otherwise.  This overload
+        // participates in overload resolution only if 'COMPARATOR' is
+        // transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.find(key);
+    }
+
+    size_type count(const key_type& key) const;
+        // Return the number of elements in this map having a key equivalent
+        // to the specified 'key' (i.e., 0 or 1).
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of elements in this map having a key equivalent
+        // to the specified 'key'.  This overload participates in overload
+        // resolution only if 'COMPARATOR' is transparent.  Note that a
+        // transparent comparator may find more than one key equivalent to
+        // 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.count(key);
+    }
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., least-keyed) element in this map whose key is not ordered
+        // before the specified 'key', and 'end()' if there is no such
+        // element.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., least-keyed) element in this map whose key is not ordered
+        // before the specified 'key', and 'end()' if there is no such
+        // element.  This overload participates in overload resolution only if
+        // 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.lowerBound(key);
+    }
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., least-keyed) element in this map whose key is ordered after
+        // the specified 'key', and 'end()' if there is no such element.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., least-keyed) element in this map whose key is ordered after
+        // the specified 'key', and 'end()' if there is no such element.  This
+        // overload participates in overload resolution only if 'COMPARATOR'
+        // is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.upperBound(key);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                  const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // elements in this map having a key equivalent to the specified 'key'
+        // (i.e., at most one element).
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // elements in this map having a key equivalent to the specified
+        // 'key'.  This overload participates in overload resolution only if
+        // 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.equalRange(key);
+    }
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_map' objects have the same
+    // value if they have the same number of elements, and each element in the
+    // ordered sequence of elements of 'lhs' has the same value as the
+    // corresponding element of 'rhs'.  This method requires that 'KEY' and
+    // 'VALUE' be equality-comparable.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_map' objects do not have
+    // the same value if they do not have the same number of elements, or some
+    // element in the ordered sequence of elements of 'lhs' does not have the
+    // same value as the corresponding element of 'rhs'.  This method requires
+    // that 'KEY' and 'VALUE' be equality-comparable.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator< (const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the sequence of elements of the specified 'lhs' map is
+    // lexicographically less than that of the specified 'rhs' map, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator> (const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the sequence of elements of the specified 'lhs' map is
+    // lexicographically greater than that of the specified 'rhs' map, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the sequence of elements of the specified 'lhs' map is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // map, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the sequence of elements of the specified 'lhs' map is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // map, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                 BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the value and comparator of the specified 'a' object with
+    // those of the specified 'b' object, and also the allocators if the
+    // 'ALLOCATOR' type has trait 'propagate_on_container_swap'.  If the
+    // allocators are not exchanged and are not equal, 'a' and 'b' exchange
+    // their values by copying, in linear time.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                       // -----------------------------
+                       // class flat_map::value_compare
+                       // -----------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare::value_compare(
+                                                         COMPARATOR comparator)
+: comp(comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare::operator()(
+                                                     const value_type& x,
+                                                     const value_type& y) const
+{
+    return comp(x.first, y.first);
+}
+
+                              // --------------
+                              // class flat_map
+                              // --------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map()
+: d_tree(COMPARATOR(), ALLOCATOR())
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                                     const flat_map& original)
+: d_tree(original.d_tree,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                   original.get_allocator()))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                           BloombergLP::bslmf::MovableRef<flat_map> original)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                        const flat_map&  original,
+                                        const ALLOCATOR& basicAllocator)
+: d_tree(original.d_tree, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                     BloombergLP::bslmf::MovableRef<flat_map> original,
+                     const ALLOCATOR&                         basicAllocator)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertRangeUnique(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                              INPUT_ITERATOR   first,
+                                              INPUT_ITERATOR   last,
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertRangeUnique(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                            sorted_unique_t,
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertSortedRangeUnique(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                              sorted_unique_t,
+                                              INPUT_ITERATOR   first,
+                                              INPUT_ITERATOR   last,
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertSortedRangeUnique(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                            std::initializer_list<value_type> values,
+                            const COMPARATOR&                 comparator,
+                            const ALLOCATOR&                  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertRangeUnique(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                            std::initializer_list<value_type> values,
+                            const ALLOCATOR&                  basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertRangeUnique(values.begin(), values.end());
+}
+#endif
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(const flat_map& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                BloombergLP::bslmf::MovableRef<flat_map> rhs)
+{
+    d_tree = MoveUtil::move(MoveUtil::access(rhs).d_tree);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                      std::initializer_list<value_type> values)
+{
+    flat_map other(values, d_tree.comparator(), get_allocator());
+    d_tree.swap(other.d_tree);
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE& flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](
+                                                           const key_type& key)
+{
+    iterator position = d_tree.lowerBound(key);
+    if (position == end() || d_tree.comparator()(key, position->first)) {
+        BloombergLP::bsls::ObjectBuffer<VALUE> temp;  // for default 'VALUE'
+
+        ALLOCATOR alloc = get_allocator();
+
+        AllocatorTraits::construct(alloc, temp.address());
+
+        BloombergLP::bslma::DestructorGuard<VALUE> guard(temp.address());
+
+        // The new element is emplaced directly at its position in the
+        // underlying sequence, which is thereby kept sorted, avoiding a
+        // second search.  As for 'bsl::map', 'move' is not used in C++03,
+        // where a 'MovableRef' to a user type may not safely degrade to an
+        // lvalue reference.
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        position = d_tree.container().emplace(position,
+                                              key,
+                                              MoveUtil::move(temp.object()));
+#else
+        position = d_tree.container().emplace(position, key, temp.object());
+#endif
+    }
+    return position->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE& flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key)
+{
+    iterator position = d_tree.find(key);
+    if (position == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                            "flat_map<...>::at(key_type): invalid key value");
+    }
+    return position->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    return d_tree.insertUnique(value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                             BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    return d_tree.insertUnique(MoveUtil::move(value));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                                    const value_type& value)
+{
+    return d_tree.insertUnique(hint, value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                           const_iterator                             hint,
+                           BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    return d_tree.insertUnique(hint, MoveUtil::move(value));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    d_tree.insertRangeUnique(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(sorted_unique_t,
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    d_tree.insertSortedRangeUnique(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                      std::initializer_list<value_type> values)
+{
+    d_tree.insertRangeUnique(values.begin(), values.end());
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace(ARGS&&... arguments)
+{
+    return d_tree.emplaceUnique(
+                         BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace_hint(
+                                                     const_iterator,
+                                                     ARGS&&...      arguments)
+{
+    return d_tree.emplaceUnique(
+                   BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...).first;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != cend());
+
+    return d_tree.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    return d_tree.eraseKey(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                   const_iterator last)
+{
+    return d_tree.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(flat_map& other)
+                                  BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    d_tree.swap(other.d_tree);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    d_tree.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reserve(
+                                                         size_type numElements)
+{
+    d_tree.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_tree.shrinkToFit();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key)
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key)
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+     typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
+{
+    iterator first = d_tree.lowerBound(key);
+    iterator last  = first;
+    if (last != end() && !d_tree.comparator()(key, last->first)) {
+        ++last;
+    }
+    return pair<iterator, iterator>(first, last);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+const VALUE& flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(
+                                                     const key_type& key) const
+{
+    const_iterator position = d_tree.find(key);
+    if (position == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                            "flat_map<...>::at(key_type): invalid key value");
+    }
+    return position->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.maxSize();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::capacity() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(d_tree.comparator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::container_type&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::values() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.container();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return d_tree.find(key) != d_tree.end() ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    const_iterator first = d_tree.lowerBound(key);
+    const_iterator last  = first;
+    if (last != end() && !d_tree.comparator()(key, last->first)) {
+        ++last;
+    }
+    return pair<const_iterator, const_iterator>(first, last);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(
+                                                                 lhs.begin(),
+                                                                 lhs.end(),
+                                                                 lhs.size(),
+                                                                 rhs.begin(),
+                                                                 rhs.end(),
+                                                                 rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                  BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
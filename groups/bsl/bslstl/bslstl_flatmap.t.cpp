@@ -0,0 +1,861 @@
+// bslstl_flatmap.t.cpp                                               -*-C++-*-
+#include <bslstl_flatmap.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test defines a container adapter, 'bsl::flat_map', that
+// forwards most of its operations to 'bslstl::FlatTree', which is tested
+// thoroughly in its own component.  This test driver concentrates on the
+// operations 'flat_map' implements itself, 'operator[]' and 'at', and on the
+// forwarding: that the constructors install the intended allocator, which is
+// supplied to both the keys and the mapped values, and that the manipulators
+// and accessors agree with 'std::map' on pseudo-random input.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_map();
+// [ 2] flat_map(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_map(const ALLOCATOR&);
+// [ 2] flat_map(const flat_map&);
+// [ 2] flat_map(MovableRef<flat_map>);
+// [ 2] flat_map(const flat_map&, const ALLOCATOR&);
+// [ 2] flat_map(MovableRef<flat_map>, const ALLOCATOR&);
+// [ 2] flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, const A&);
+// [ 2] flat_map(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+// [ 2] flat_map(initializer_list<value_type>, const COMPARATOR&, const A&);
+//
+// MANIPULATORS
+// [ 2] flat_map& operator=(const flat_map&);
+// [ 2] flat_map& operator=(MovableRef<flat_map>);
+// [ 3] VALUE& operator[](const key_type&);
+// [ 3] VALUE& at(const key_type&);
+// [ 4] pair<iterator, bool> insert(const value_type&);
+// [ 4] iterator insert(const_iterator, const value_type&);
+// [ 4] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] pair<iterator, bool> emplace(ARGS&&...);
+// [ 4] iterator emplace_hint(const_iterator, ARGS&&...);
+// [ 4] iterator erase(const_iterator);
+// [ 4] size_type erase(const key_type&);
+// [ 4] iterator erase(const_iterator, const_iterator);
+// [ 2] void swap(flat_map&);
+// [ 4] iterator find(const key_type&);
+// [ 4] iterator lower_bound(const key_type&);
+// [ 4] iterator upper_bound(const key_type&);
+// [ 4] pair<iterator, iterator> equal_range(const key_type&);
+//
+// ACCESSORS
+// [ 3] const VALUE& at(const key_type&) const;
+// [ 4] const_iterator find(const key_type&) const;
+// [ 4] size_type count(const key_type&) const;
+// [ 4] const_iterator lower_bound(const key_type&) const;
+// [ 4] const_iterator upper_bound(const key_type&) const;
+// [ 4] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 5] value_compare value_comp() const;
+// [ 4] const container_type& values() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const flat_map&, const flat_map&);
+// [ 5] bool operator!=(const flat_map&, const flat_map&);
+// [ 5] bool operator< (const flat_map&, const flat_map&);
+// [ 5] bool operator> (const flat_map&, const flat_map&);
+// [ 5] bool operator<=(const flat_map&, const flat_map&);
+// [ 5] bool operator>=(const flat_map&, const flat_map&);
+// [ 2] void swap(flat_map&, flat_map&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslmf::MovableRefUtil                 MoveUtil;
+
+typedef bsl::flat_map<int, int>               IntMap;
+typedef bsl::flat_map<int, bsl::string>       StringMap;
+typedef StringMap::value_type                 StringElement;
+
+static const char *const LONG_STRING =
+                             "a string long enough to require an allocation";
+
+//=============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified linear-congruential generator 'state', and return
+    // its new value, scaled to the range '[0 .. 2^15)'.
+{
+    *state = *state * 1103515245 + 12345;
+    return (*state >> 16) & 0x7fff;
+}
+
+bool isEqual(const IntMap& map, const std::map<int, int>& reference)
+    // Return 'true' if the specified 'map' has the same sequence of elements
+    // as the specified 'reference', and 'false' otherwise.
+{
+    if (map.size() != reference.size()) {
+        return false;                                                 // RETURN
+    }
+    std::map<int, int>::const_iterator rit = reference.begin();
+    for (IntMap::const_iterator it = map.begin(); it != map.end(); ++it) {
+        if (it->first != rit->first || it->second != rit->second) {
+            return false;                                             // RETURN
+        }
+        ++rit;
+    }
+    return true;
+}
+
+bool allocatesFrom(const StringMap& map, bslma::Allocator *allocator)
+    // Return 'true' if the specified 'map', and each of its mapped values,
+    // uses the specified 'allocator', and 'false' otherwise.
+{
+    if (map.get_allocator().mechanism() != allocator) {
+        return false;                                                 // RETURN
+    }
+    for (StringMap::const_iterator it = map.begin(); it != map.end(); ++it) {
+        if (it->second.get_allocator().mechanism() != allocator) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+//  bool veryVeryVerbose     = argc > 4;
+//  bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Currency Conversion Table
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose a pricing service loads, at start-up, the conversion rates of a few
+// dozen currencies to US dollars, and then converts amounts many times per
+// second.
+//
+// First, we load the rates, in any order, in a single bulk insertion:
+//..
+    typedef bsl::pair<bsl::string, double> Rate;
+
+    const Rate RATES[] = { Rate("JPY", 0.0091),
+                           Rate("EUR", 1.1800),
+                           Rate("GBP", 1.3900) };
+    const int  NUM_RATES = sizeof RATES / sizeof *RATES;
+
+    bsl::flat_map<bsl::string, double> rates(RATES, RATES + NUM_RATES);
+    ASSERT(3 == rates.size());
+    ASSERT("EUR" == rates.begin()->first);
+//..
+// Then, we convert an amount, using 'at', which throws 'bsl::out_of_range'
+// for an unknown currency:
+//..
+    ASSERT(118.0 == 100.0 * rates.at("EUR"));
+//..
+// Finally, an update adds one currency and replaces the rate of another,
+// using 'operator[]':
+//..
+    rates["CHF"] = 1.0800;
+    rates["JPY"] = 0.0090;
+    ASSERT(4      == rates.size());
+    ASSERT(0.0090 == rates.find("JPY")->second);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // FREE OPERATORS AND 'value_comp'
+        //
+        // Concerns:
+        //: 1 The equality operators compare both the keys and the mapped
+        //:   values of the elements.
+        //:
+        //: 2 The relational operators compare the sequences of elements
+        //:   lexicographically, as those of 'std::map' do.
+        //:
+        //: 3 'value_comp' orders elements by their keys only.
+        //
+        // Plan:
+        //: 1 For every pair of small maps, having keys in '{0, 1}' and mapped
+        //:   values in '{0, 1}', compare the results of each operator with
+        //:   those of 'std::map'.  (C-1..2)
+        //:
+        //: 2 Apply 'value_comp' to elements having equal and different keys
+        //:   and mapped values.  (C-3)
+        //
+        // Testing:
+        //   bool operator==(const flat_map&, const flat_map&);
+        //   bool operator!=(const flat_map&, const flat_map&);
+        //   bool operator< (const flat_map&, const flat_map&);
+        //   bool operator> (const flat_map&, const flat_map&);
+        //   bool operator<=(const flat_map&, const flat_map&);
+        //   bool operator>=(const flat_map&, const flat_map&);
+        //   value_compare value_comp() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nFREE OPERATORS AND 'value_comp'"
+                            "\n===============================\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        for (int i = 0; i < 9; ++i) {
+            for (int j = 0; j < 9; ++j) {
+                // Digit 'k' of 'i' in base 3 selects whether key 'k' is
+                // absent, or is mapped to 0 or to 1; likewise for 'j'.
+
+                IntMap             mX(&sa);
+                IntMap             mY(&sa);
+                std::map<int, int> rX;
+                std::map<int, int> rY;
+
+                for (int k = 0, di = i, dj = j; k < 2; ++k) {
+                    if (di % 3) {
+                        mX[k] = di % 3 - 1;
+                        rX[k] = di % 3 - 1;
+                    }
+                    if (dj % 3) {
+                        mY[k] = dj % 3 - 1;
+                        rY[k] = dj % 3 - 1;
+                    }
+                    di /= 3;
+                    dj /= 3;
+                }
+                const IntMap& X = mX;
+                const IntMap& Y = mY;
+
+                ASSERTV(i, j, (rX == rY) == (X == Y));
+                ASSERTV(i, j, (rX != rY) == (X != Y));
+                ASSERTV(i, j, (rX <  rY) == (X <  Y));
+                ASSERTV(i, j, (rX >  rY) == (X >  Y));
+                ASSERTV(i, j, (rX <= rY) == (X <= Y));
+                ASSERTV(i, j, (rX >= rY) == (X >= Y));
+            }
+        }
+
+        const IntMap::value_compare COMP = IntMap(&sa).value_comp();
+
+        ASSERT( COMP(IntMap::value_type(1, 9), IntMap::value_type(2, 0)));
+        ASSERT(!COMP(IntMap::value_type(2, 0), IntMap::value_type(1, 9)));
+        ASSERT(!COMP(IntMap::value_type(1, 0), IntMap::value_type(1, 9)));
+        ASSERT(!COMP(IntMap::value_type(1, 9), IntMap::value_type(1, 0)));
+
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND LOOKUP
+        //
+        // Concerns:
+        //: 1 Each manipulator leaves the map with the same elements as the
+        //:   corresponding manipulator of 'std::map'; in particular, no
+        //:   insertion replaces the mapped value of an existing element.
+        //:
+        //: 2 'find', 'count', 'lower_bound', 'upper_bound', and
+        //:   'equal_range' agree with those of 'std::map', including for
+        //:   absent keys.
+        //:
+        //: 3 Mapped values may be modified through the iterators returned by
+        //:   the non-'const' lookups.
+        //:
+        //: 4 No memory is taken from the default allocator.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of manipulators to a 'flat_map'
+        //:   and to a 'std::map', and compare them after each step.  (C-1, 4)
+        //:
+        //: 2 Look up every key in and around the resulting map, and compare
+        //:   with 'std::map'.  Modify the mapped values through the result of
+        //:   'find'.  (C-2..3)
+        //
+        // Testing:
+        //   pair<iterator, bool> insert(const value_type&);
+        //   iterator insert(const_iterator, const value_type&);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   pair<iterator, bool> emplace(ARGS&&...);
+        //   iterator emplace_hint(const_iterator, ARGS&&...);
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   iterator find(const key_type&);
+        //   iterator lower_bound(const key_type&);
+        //   iterator upper_bound(const key_type&);
+        //   pair<iterator, iterator> equal_range(const key_type&);
+        //   const_iterator find(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   const container_type& values() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATORS AND LOOKUP"
+                            "\n=======================\n");
+
+        typedef IntMap::value_type Element;
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        unsigned int       state = 23;
+        IntMap             mX(&sa);  const IntMap& X = mX;
+        std::map<int, int> reference;
+
+        for (int i = 0; i < 2000; ++i) {
+            const int key   = static_cast<int>(nextRandom(&state) % 200);
+            const int value = i;
+
+            switch (nextRandom(&state) % 8) {
+              case 0: {
+                const bool isNew = reference.insert(
+                                  std::pair<int, int>(key, value)).second;
+
+                bsl::pair<IntMap::iterator, bool> result = mX.insert(
+                                                         Element(key, value));
+                ASSERTV(i, key, isNew == result.second);
+                ASSERTV(i, key, key   == result.first->first);
+              } break;
+              case 1: {
+                reference.insert(std::pair<int, int>(key, value));
+
+                IntMap::const_iterator hint = X.begin()
+                                 + nextRandom(&state) % (X.size() + 1);
+                IntMap::iterator it = mX.insert(hint, Element(key, value));
+                ASSERTV(i, key, key == it->first);
+              } break;
+              case 2: {
+                Element batch[8];
+                for (int j = 0; j < 8; ++j) {
+                    batch[j] = Element(static_cast<int>(
+                                                   nextRandom(&state) % 200),
+                                       value * 10 + j);
+                    reference.insert(std::pair<int, int>(batch[j].first,
+                                                         batch[j].second));
+                }
+                mX.insert(batch, batch + 8);
+              } break;
+              case 3: {
+                std::map<int, int> batch;
+                for (int j = 0; j < 8; ++j) {
+                    batch[static_cast<int>(nextRandom(&state) % 200)] = j;
+                }
+                reference.insert(batch.begin(), batch.end());
+                mX.insert(bsl::sorted_unique, batch.begin(), batch.end());
+              } break;
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+              case 4: {
+                const bool isNew = reference.insert(
+                                  std::pair<int, int>(key, value)).second;
+
+                bsl::pair<IntMap::iterator, bool> result =
+                                                      mX.emplace(key, value);
+                ASSERTV(i, key, isNew == result.second);
+                ASSERTV(i, key, key   == result.first->first);
+
+                reference.insert(std::pair<int, int>(key + 1, value));
+                IntMap::iterator it = mX.emplace_hint(X.end(),
+                                                      key + 1,
+                                                      value);
+                ASSERTV(i, key, key + 1 == it->first);
+              } break;
+#endif
+              case 5: {
+                ASSERTV(i, key, reference.erase(key) == mX.erase(key));
+              } break;
+              case 6: {
+                if (!X.empty()) {
+                    const IntMap::size_type index =
+                                              nextRandom(&state) % X.size();
+
+                    reference.erase(X.begin()[index].first);
+                    IntMap::iterator it = mX.erase(X.begin() + index);
+                    ASSERTV(i, it == X.begin() + index);
+                }
+              } break;
+              default: {
+                if (!X.empty()) {
+                    const IntMap::size_type first =
+                                              nextRandom(&state) % X.size();
+                    const IntMap::size_type last  = first
+                                   + nextRandom(&state) % (X.size() - first);
+
+                    reference.erase(
+                            reference.lower_bound(X.begin()[first].first),
+                            last < X.size()
+                            ? reference.lower_bound(X.begin()[last].first)
+                            : reference.end());
+                    mX.erase(X.begin() + first, X.begin() + last);
+                }
+              }
+            }
+            ASSERTV(i, isEqual(X, reference));
+            ASSERTV(i, X.values().size() == X.size());
+        }
+
+        for (int key = -1; key <= 201; ++key) {
+            typedef IntMap::const_iterator Iter;
+
+            const std::ptrdiff_t lower = std::distance(
+                                                 reference.begin(),
+                                                 reference.lower_bound(key));
+            const std::ptrdiff_t upper = std::distance(
+                                                 reference.begin(),
+                                                 reference.upper_bound(key));
+
+            ASSERTV(key, lower == X.lower_bound(key) - X.begin());
+            ASSERTV(key, upper == X.upper_bound(key) - X.begin());
+            ASSERTV(key, lower == mX.lower_bound(key) - X.begin());
+            ASSERTV(key, upper == mX.upper_bound(key) - X.begin());
+            ASSERTV(key, reference.count(key) == X.count(key));
+
+            bsl::pair<Iter, Iter> range = X.equal_range(key);
+            ASSERTV(key, lower == range.first  - X.begin());
+            ASSERTV(key, upper == range.second - X.begin());
+
+            bsl::pair<IntMap::iterator, IntMap::iterator> mRange =
+                                                         mX.equal_range(key);
+            ASSERTV(key, lower == mRange.first  - X.begin());
+            ASSERTV(key, upper == mRange.second - X.begin());
+
+            IntMap::iterator it = mX.find(key);
+            if (lower == upper) {
+                ASSERTV(key, X.end() == it);
+                ASSERTV(key, X.end() == X.find(key));
+            }
+            else {
+                ASSERTV(key, X.begin() + lower == it);
+                it->second = -key;
+                ASSERTV(key, -key == X.find(key)->second);
+            }
+        }
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'operator[]' AND 'at'
+        //
+        // Concerns:
+        //: 1 'operator[]' returns a reference to the mapped value of the
+        //:   element having the specified key, if one exists, and otherwise
+        //:   inserts an element having that key and a default-constructed
+        //:   mapped value, at the correct position.
+        //:
+        //: 2 The mapped value inserted by 'operator[]' uses the allocator of
+        //:   the map, and no memory is taken from the default allocator.
+        //:
+        //: 3 'at' returns a reference to the mapped value of the element
+        //:   having the specified key, if one exists, and otherwise throws
+        //:   'std::out_of_range' without modifying the map.
+        //
+        // Plan:
+        //: 1 Apply 'operator[]' to pseudo-random keys of a map of integers,
+        //:   and compare with 'std::map'.  (C-1)
+        //:
+        //: 2 Apply 'operator[]' to a map of strings using a test allocator,
+        //:   and verify the allocators of its mapped values.  (C-2)
+        //:
+        //: 3 Apply the 'const' and non-'const' 'at' to present and absent
+        //:   keys, and verify the exceptions thrown.  (C-3)
+        //
+        // Testing:
+        //   VALUE& operator[](const key_type&);
+        //   VALUE& at(const key_type&);
+        //   const VALUE& at(const key_type&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'operator[]' AND 'at'"
+                            "\n=====================\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        if (verbose) printf("\t'operator[]' against 'std::map'.\n");
+        {
+            unsigned int       state = 29;
+            IntMap             mX(&sa);  const IntMap& X = mX;
+            std::map<int, int> reference;
+
+            for (int i = 0; i < 1000; ++i) {
+                const int key = static_cast<int>(nextRandom(&state) % 300);
+
+                if (i % 2) {
+                    ASSERTV(i, key, reference[key] == mX[key]);
+                }
+                else {
+                    reference[key] += i;
+                    mX[key]        += i;
+                }
+                ASSERTV(i, isEqual(X, reference));
+            }
+        }
+
+        if (verbose) printf("\t'operator[]' allocator usage.\n");
+        {
+            StringMap mX(&sa);  const StringMap& X = mX;
+
+            for (int i = 0; i < 20; ++i) {
+                const int key = (i * 7) % 20;
+
+                bsl::string& value = mX[key];
+                ASSERTV(i, value.empty());
+                value = LONG_STRING;
+
+                ASSERTV(i, LONG_STRING == mX[key]);
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+            }
+            ASSERT(allocatesFrom(X, &sa));
+            for (int i = 0; i < 20; ++i) {
+                ASSERTV(i, i == X.begin()[i].first);
+            }
+        }
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) printf("\t'at'.\n");
+        {
+            IntMap mX(&sa);  const IntMap& X = mX;
+            mX[1] = 10;
+            mX[3] = 30;
+
+            ASSERT(10 == mX.at(1));
+            ASSERT(30 == X.at(3));
+
+            mX.at(1) = 11;
+            ASSERT(11 == X.at(1));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            const int ABSENT[]   = { 0, 2, 4 };
+            const int NUM_ABSENT = sizeof ABSENT / sizeof *ABSENT;
+
+            int exceptions = 0;
+            for (int i = 0; i < NUM_ABSENT; ++i) {
+                try {
+                    mX.at(ABSENT[i]);
+                    ASSERTV(ABSENT[i], false);
+                }
+                catch (const std::out_of_range&) {
+                    ++exceptions;
+                }
+                try {
+                    X.at(ABSENT[i]);
+                    ASSERTV(ABSENT[i], false);
+                }
+                catch (const std::out_of_range&) {
+                    ++exceptions;
+                }
+            }
+            ASSERTV(exceptions, 2 * NUM_ABSENT == exceptions);
+            ASSERTV(X.size(), 2 == X.size());
+#endif
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        //: 1 Each constructor installs the supplied allocator, or the default
+        //:   allocator if none is supplied, and supplies it to the mapped
+        //:   values.
+        //:
+        //: 2 The range constructors keep the first of the elements having
+        //:   equivalent keys.
+        //:
+        //: 3 Moving between maps having the same allocator does not allocate.
+        //:
+        //: 4 Copy assignment copies the elements, but not the allocator, and
+        //:   'swap' exchanges the elements of two maps.
+        //
+        // Plan:
+        //: 1 Construct, assign, and swap maps of long strings, and verify
+        //:   their elements and allocators, and the allocation performed.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   flat_map();
+        //   flat_map(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_map(const ALLOCATOR&);
+        //   flat_map(const flat_map&);
+        //   flat_map(MovableRef<flat_map>);
+        //   flat_map(const flat_map&, const ALLOCATOR&);
+        //   flat_map(MovableRef<flat_map>, const ALLOCATOR&);
+        //   flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, ...);
+        //   flat_map(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+        //   flat_map(initializer_list<value_type>, const COMPARATOR&, ...);
+        //   flat_map& operator=(const flat_map&);
+        //   flat_map& operator=(MovableRef<flat_map>);
+        //   void swap(flat_map&);
+        //   void swap(flat_map&, flat_map&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, ASSIGNMENT, AND SWAP"
+                            "\n==============================\n");
+
+        typedef IntMap::value_type Element;
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+        bslma::TestAllocator oa("other",    veryVerbose);
+
+        if (verbose) printf("\tRange constructors.\n");
+        {
+            const Element DATA[] = { Element(5, 0), Element(1, 1),
+                                     Element(4, 2), Element(1, 3),
+                                     Element(5, 4), Element(9, 5) };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            IntMap mX(DATA, DATA + NUM_DATA, std::less<int>(), &sa);
+            const IntMap& X = mX;
+
+            ASSERTV(X.size(), 4 == X.size());
+            ASSERT(1 == X.at(1));
+            ASSERT(0 == X.at(5));
+            ASSERT(&sa == X.get_allocator().mechanism());
+
+            const Element SORTED[] = { Element(1, 1), Element(4, 2),
+                                       Element(5, 0), Element(9, 5) };
+
+            IntMap mY(bsl::sorted_unique, SORTED, SORTED + 4, &sa);
+            ASSERT(X == mY);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            IntMap mZ({ { 9, 5 }, { 5, 0 }, { 4, 2 }, { 1, 1 }, { 1, 3 } },
+                      std::less<int>(),
+                      &sa);
+            ASSERT(X == mZ);
+#endif
+        }
+
+        if (verbose) printf("\tCopy, move, and assignment.\n");
+        {
+            StringMap mX(&sa);  const StringMap& X = mX;
+            for (int i = 0; i < 10; ++i) {
+                mX[i] = LONG_STRING;
+            }
+            ASSERT(allocatesFrom(X, &sa));
+
+            StringMap mC(X);
+            ASSERT(X == mC);
+            ASSERT(allocatesFrom(mC, &defaultAllocator));
+
+            StringMap mY(X, &sa);  const StringMap& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(allocatesFrom(Y, &sa));
+
+            const bsls::Types::Int64 NUM_BLOCKS = sa.numBlocksTotal();
+
+            StringMap mZ(MoveUtil::move(mY));
+            ASSERT(X == mZ);
+            ASSERT(NUM_BLOCKS == sa.numBlocksTotal());
+
+            StringMap mW(MoveUtil::move(mZ), &oa);
+            ASSERT(X == mW);
+            ASSERT(allocatesFrom(mW, &oa));
+
+            StringMap mV(&oa);
+            mV = X;
+            ASSERT(X == mV);
+            ASSERT(allocatesFrom(mV, &oa));
+
+            StringMap mU(&sa);  const StringMap& U = mU;
+            mU[99] = "u";
+            mU.swap(mV);
+            ASSERT(X == U);
+            ASSERT(1 == mV.size());
+
+            swap(mU, mV);
+            ASSERT(1 == U.size());
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        IntMap mX(&sa);  const IntMap& X = mX;
+        ASSERT(X.empty());
+
+        mX[2] = 20;
+        mX[1] = 10;
+        ASSERT(!mX.insert(IntMap::value_type(2, 21)).second);
+        ASSERT(2  == X.size());
+        ASSERT(20 == X.at(2));
+        ASSERT(1  == X.begin()->first);
+
+        IntMap mY(X, &sa);  const IntMap& Y = mY;
+        ASSERT(X == Y);
+
+        mY[1] = 11;
+        ASSERT(X != Y);
+        ASSERT(X <  Y);
+
+        ASSERT(1 == mX.erase(1));
+        mX.clear();
+        ASSERT(X.empty());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1587 @@
+// bslstl_flatmultimap.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMULTIMAP
+#define INCLUDED_BSLSTL_FLATMULTIMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered multimap held in contiguous storage.
+//
+//@CLASSES:
+//   bsl::flat_multimap: multimap of keys to values in a sorted 'bsl::vector'
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flattree, bslstl_multimap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_multimap', implementing an ordered associative container mapping
+// keys, possibly equivalent, to values, with the interface of
+// 'bsl::multimap' (less the guarantees of iterator stability), but holding
+// its key-value pairs in a sorted 'bsl::vector' (see 'bslstl_flattree')
+// rather than in a red-black tree.  Elements having equivalent keys are held
+// in the order in which they were inserted.
+//
+// An instantiation of 'flat_multimap' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of key-value pairs) and
+// the ordered sequence of key-value pairs the 'flat_multimap' contains.
+//
+// Unlike 'bsl::multimap', whose 'value_type' is 'pair<const KEY, VALUE>', the
+// 'value_type' of a 'flat_multimap' is 'pair<KEY, VALUE>', so that its
+// elements can be moved within the underlying array.  The behavior is
+// undefined if the key of an element is modified through an iterator.
+//
+///Choosing Between 'multimap' and 'flat_multimap'
+///-----------------------------------------------
+// A 'bsl::multimap' allocates a tree node per element; a lookup follows one
+// pointer per level of the tree, typically incurring a cache miss at each
+// level once the multimap is larger than the cache.  A 'flat_multimap'
+// allocates one array for all of its elements, and looks up a key by a
+// (branch-free) binary search over that array, which touches far fewer cache
+// lines, and iterates over its elements as over an array.  On the other hand,
+// inserting into or erasing from a 'flat_multimap' moves all of the elements
+// that follow the affected position, and invalidates all iterators and
+// references.  A 'flat_multimap' is therefore best suited to multimaps that
+// are built once (ideally in bulk, see {Bulk Insertion}) and then searched
+// often, such as configuration and reference tables.
+//
+///Bulk Insertion
+///--------------
+// Inserting 'm' elements one at a time into a 'flat_multimap' of 'n' elements
+// takes 'O[m * (n + m)]' time.  The range constructors and the range 'insert'
+// instead append the range and merge it with the existing elements (see
+// 'bslstl_flattree'), taking 'O[n + m * log(m)]' time.  If the range is
+// already sorted by key, passing 'bsl::sorted_equivalent' to the constructor
+// or to 'insert' skips the sort, so that building a 'flat_multimap' from such
+// a range takes linear time.  The merge moves the elements into a newly
+// allocated array, so it temporarily requires memory for a second copy of
+// them, and if an exception is thrown during the merge, the 'flat_multimap' is
+// left empty.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'flat_multimap''s 'ALLOCATOR' template parameter
+// determines how that 'flat_multimap' will allocate memory.  If it is
+// 'bsl::allocator' (the default), then a 'flat_multimap' accepts an optional
+// 'bslma::Allocator' argument at construction, uses it to supply memory for
+// its array of elements, and supplies it to the keys and values themselves if
+// they have the 'bslma::UsesBslmaAllocator' trait.  If no allocator is
+// supplied, the currently installed default allocator is used.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_multimap':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the 'flat_multimap'
+//  'V'             - (template parameter) type 'VALUE' of the 'flat_multimap'
+//  'a', 'b'        - two distinct objects of type 'flat_multimap<K, V>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'k'             - an object of type 'K'
+//  'v'             - an object of type 'pair<K, V>'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  'i1', 'i2'      - two iterators defining a sequence of 'pair<K, V>'
+//  'N'             - distance(i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_multimap<K, V> a;  (default construction)     | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multimap<K, V> a(b);  (copy construction)     | O[m]               |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multimap<K, V> a(i1, i2);                     | O[N * log(N)]      |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multimap<K, V> a(sorted_equivalent, i1, i2);  | O[N]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.count(k), a.lower_bound(k),           | O[log(n)]          |
+//  | a.upper_bound(k), a.equal_range(k)                 |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(v), a.emplace(...), a.erase(k)            | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(p1, v)                                    | O[n], and no       |
+//  |                                                    | search if 'p1' is  |
+//  |                                                    | the correct place  |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[n + N * log(N)]  |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(sorted_equivalent, i1, i2)                | O[n + N]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1), a.erase(p1, p2)                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a, b)                              | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b, a < b, a <= b, a > b, a >= b       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.size(), a.empty(),           | O[1]               |
+//  | a.capacity(), a.reserve(n), a.clear()              |                    |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: An Index of Orders by Account
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose an end-of-day report receives the day's orders, each identified by
+// an account number and an order number, and must list the orders of many
+// accounts.
+//
+// First, we load the orders, which arrive sorted by account, in a single pass,
+// using 'bsl::sorted_equivalent' to indicate that no sorting is needed:
+//..
+//  typedef bsl::pair<int, int> Order;  // (account, order number)
+//
+//  const Order ORDERS[]   = { Order(1001, 7), Order(1001, 9),
+//                             Order(1002, 8), Order(1005, 3),
+//                             Order(1005, 4), Order(1005, 5) };
+//  const int   NUM_ORDERS = sizeof ORDERS / sizeof *ORDERS;
+//
+//  bsl::flat_multimap<int, int> orders(bsl::sorted_equivalent,
+//                                      ORDERS,
+//                                      ORDERS + NUM_ORDERS);
+//  assert(6 == orders.size());
+//..
+// Then, we count the orders of an account:
+//..
+//  assert(3 == orders.count(1005));
+//  assert(0 == orders.count(1003));
+//..
+// Finally, we list the orders of an account, which are held in the order in
+// which they arrived:
+//..
+//  typedef bsl::flat_multimap<int, int>::const_iterator Iterator;
+//
+//  bsl::pair<Iterator, Iterator> range = orders.equal_range(1001);
+//  assert(2 == range.second - range.first);
+//  assert(7 == range.first[0].second);
+//  assert(9 == range.first[1].second);
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_flattree.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_rangecompare.h>
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace bsl {
+
+                           // ===================
+                           // class flat_multimap
+                           // ===================
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<pair<KEY, VALUE> > >
+class flat_multimap {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs, whose keys (of the template
+    // parameter type, 'KEY') may be equivalent, and whose associated values
+    // are of the template parameter type, 'VALUE', in contiguous storage.
+    // Insertion and removal invalidate all iterators, pointers, and
+    // references to the elements of the container.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   except for 'BDEX' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::FlatTree<
+                   BloombergLP::bslstl::UnorderedMapKeyConfiguration<
+                                                          KEY,
+                                                          pair<KEY, VALUE> >,
+                   COMPARATOR,
+                   ALLOCATOR>                          Tree;
+        // This 'typedef' is an alias for the implementation of this multimap.
+
+    typedef BloombergLP::bslmf::MovableRefUtil         MoveUtil;
+        // This 'typedef' is a convenient alias for the utility associated
+        // with movable references.
+
+    // DATA
+    Tree d_tree;  // key-value pairs, sorted by key
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef pair<KEY, VALUE>                           value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename Tree::Container                   container_type;
+    typedef typename container_type::size_type         size_type;
+    typedef typename container_type::difference_type   difference_type;
+    typedef typename container_type::pointer           pointer;
+    typedef typename container_type::const_pointer     const_pointer;
+
+    typedef typename container_type::iterator          iterator;
+    typedef typename container_type::const_iterator    const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' by adapting an object of (template parameter) type
+        // 'COMPARATOR', which compares two objects of (template parameter)
+        // type 'KEY'.  Note that this class matches the definition of
+        // 'multimap::value_compare'.
+
+        // FRIENDS
+        friend class flat_multimap;
+
+      protected:
+        // PROTECTED DATA
+        COMPARATOR comp;  // we would not have elected to make this data
+                          // member 'protected'
+
+        // PROTECTED CREATORS
+        value_compare(COMPARATOR comparator);                       // IMPLICIT
+            // Create a 'value_compare' object that uses the specified
+            // 'comparator'.
+
+      public:
+        // PUBLIC TYPES
+        typedef bool result_type;
+            // This 'typedef' is an alias for the result type of a call to the
+            // overload of 'operator()' (the comparison function) provided by a
+            // 'flat_multimap::value_compare' object.
+
+        typedef value_type first_argument_type;
+            // This 'typedef' is an alias for the type of the first parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'flat_multimap::value_compare' object.
+
+        typedef value_type second_argument_type;
+            // This 'typedef' is an alias for the type of the second parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'flat_multimap::value_compare' object.
+
+        // ACCESSORS
+        bool operator()(const value_type& x, const value_type& y) const;
+            // Return 'true' if the key of the specified 'x' object is ordered
+            // before that of the specified 'y' object, as determined by the
+            // comparator supplied at construction, and 'false' otherwise.
+    };
+
+    // CREATORS
+    flat_multimap();
+    explicit flat_multimap(const COMPARATOR& comparator,
+                           const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Create an empty multimap.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator is used.
+    : d_tree(comparator, basicAllocator)
+    {
+        // The implementation is placed here in the class definition to work
+        // around an AIX compiler bug, as for 'bsl::multimap'.
+    }
+
+    explicit flat_multimap(const ALLOCATOR& basicAllocator);
+        // Create an empty multimap that uses the specified 'basicAllocator' to
+        // supply memory, and a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order its keys.
+
+    flat_multimap(const flat_multimap& original);
+        // Create a multimap having the same value as the specified 'original'
+        // object, using a copy of 'original.key_comp()' to order keys and
+        // the allocator returned by 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // supply memory.
+
+    flat_multimap(BloombergLP::bslmf::MovableRef<flat_multimap> original);
+                                                                    // IMPLICIT
+        // Create a multimap having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new multimap.  The comparator and allocator of 'original' are
+        // propagated to the new multimap.  'original' is left in a valid but
+        // unspecified state.
+
+    flat_multimap(const flat_multimap& original,
+                  const ALLOCATOR&     basicAllocator);
+        // Create a multimap having the same value as the specified 'original'
+        // object, using a copy of 'original.key_comp()' to order keys and the
+        // specified 'basicAllocator' to supply memory.
+
+    flat_multimap(
+                 BloombergLP::bslmf::MovableRef<flat_multimap> original,
+                 const ALLOCATOR&                              basicAllocator);
+        // Create a multimap having the same value as the specified 'original'
+        // object, using a copy of 'original.key_comp()' to order keys and the
+        // specified 'basicAllocator' to supply memory.  The contents of
+        // 'original' are moved (in constant time) if 'basicAllocator' equals
+        // 'original.get_allocator()', and are move-inserted (in linear time)
+        // otherwise.  'original' is left in a valid but unspecified state.
+
+    template <class INPUT_ITERATOR>
+    flat_multimap(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator     = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_multimap(INPUT_ITERATOR   first,
+                  INPUT_ITERATOR   last,
+                  const ALLOCATOR& basicAllocator);
+        // Create a multimap holding the elements in the specified range
+        // '[first .. last)'.  Optionally specify a 'comparator' used to order
+        // keys.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  'INPUT_ITERATOR' must meet the requirements of
+        // an input iterator, and its 'value_type' must be convertible to
+        // 'value_type'.
+
+    template <class INPUT_ITERATOR>
+    flat_multimap(sorted_equivalent_t,
+                  INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator     = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_multimap(sorted_equivalent_t,
+                  INPUT_ITERATOR   first,
+                  INPUT_ITERATOR   last,
+                  const ALLOCATOR& basicAllocator);
+        // Create a multimap holding the elements in the specified range
+        // '[first .. last)', in linear time.  Optionally specify a
+        // 'comparator' and a 'basicAllocator', as for the constructor without
+        // a 'sorted_equivalent_t' argument.  The behavior is undefined unless
+        // the range is sorted by key with respect to the comparator.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multimap(
+              std::initializer_list<value_type> values,
+              const COMPARATOR&                 comparator     = COMPARATOR(),
+              const ALLOCATOR&                  basicAllocator = ALLOCATOR());
+    flat_multimap(std::initializer_list<value_type> values,
+                  const ALLOCATOR&                  basicAllocator);
+        // Create a multimap holding the elements in the specified 'values'
+        // initializer list.  Optionally specify a 'comparator' and a
+        // 'basicAllocator', as for the range constructor.
+#endif
+
+    //! ~flat_multimap() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_multimap& operator=(const flat_multimap& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if
+        // the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    flat_multimap& operator=(
+                            BloombergLP::bslmf::MovableRef<flat_multimap> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  The contents of 'rhs' are moved (in constant time) if
+        // 'get_allocator() == rhs.get_allocator()', and are move-inserted (in
+        // linear time) otherwise.  'rhs' is left in a valid but unspecified
+        // state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multimap& operator=(std::initializer_list<value_type> values);
+        // Assign to this object the elements of the specified 'values'
+        // initializer list, and return a reference providing modifiable
+        // access to this object.
+#endif
+
+    iterator insert(const value_type& value);
+    iterator insert(BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this multimap, after any elements
+        // having a key equivalent to that of 'value', and return an iterator
+        // to the inserted element.
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this multimap, as close as
+        // possible to the position before the specified 'hint' (i.e., before
+        // 'hint' if that keeps the elements ordered), and return an iterator
+        // to the inserted element.  If 'hint' is such a position, no search
+        // is made.  The behavior is undefined unless 'hint' is an iterator in
+        // the range '[begin() .. end()]'.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this multimap the elements in the specified range
+        // '[first .. last)'.  Elements having equivalent keys follow those
+        // already in this multimap, in the order of the range.  If an
+        // exception is thrown while the elements are merged with the existing
+        // elements, this multimap is left empty.  The behavior is undefined
+        // unless the range does not refer to elements of this multimap.  Note
+        // that the elements are inserted in bulk (see {Bulk Insertion}).
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_equivalent_t,
+                INPUT_ITERATOR      first,
+                INPUT_ITERATOR      last);
+        // Insert into this multimap the elements in the specified range
+        // '[first .. last)', in linear time.  Elements having equivalent keys
+        // follow those already in this multimap, in the order of the range.
+        // If an exception is thrown while the elements are merged with the
+        // existing elements, this multimap is left empty.  The behavior is
+        // undefined unless the range is sorted by key and does not refer to
+        // elements of this multimap.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<value_type> values);
+        // Insert into this multimap the elements in the specified 'values'
+        // initializer list.  If an exception is thrown while the elements are
+        // merged with the existing elements, this multimap is left empty.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    iterator emplace(ARGS&&... arguments);
+        // Insert into this multimap a newly created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'arguments' to the corresponding
+        // constructor of 'value_type', after any elements having an
+        // equivalent key, and return an iterator to the inserted element.
+
+    template <class... ARGS>
+    iterator emplace_hint(const_iterator hint, ARGS&&... arguments);
+        // Insert into this multimap a newly created 'value_type' object,
+        // constructed as for 'emplace' from the specified 'arguments', after
+        // any elements having an equivalent key, and return an iterator to
+        // the inserted element.  The specified 'hint' is ignored.
+#endif
+
+    iterator erase(const_iterator position);
+        // Remove from this multimap the element at the specified 'position',
+        // and return an iterator to the element that followed it (or 'end()').
+        // The behavior is undefined unless 'position' is an iterator in the
+        // range '[cbegin() .. cend())'.
+
+    size_type erase(const key_type& key);
+        // Remove from this multimap the elements having a key equivalent to
+        // the specified 'key', and return the number of elements removed.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this multimap the elements in the specified range
+        // '[first .. last)', and return 'last'.  The behavior is undefined
+        // unless '[first .. last)' is a valid range of this multimap.
+
+    void swap(flat_multimap& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  If the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_swap', also exchange the allocators.  This
+        // method provides the no-throw guarantee and takes constant time if
+        // the allocators are exchanged or are equal; otherwise, the values
+        // are exchanged by copying, in linear time.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all elements from this multimap, retaining its capacity.
+
+    void reserve(size_type numElements);
+        // Ensure that this multimap can hold the specified 'numElements'
+        // without reallocating.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this multimap to its size, if possible.
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator to the first (i.e., least-keyed) element in this
+        // multimap, or the past-the-end iterator if this multimap is empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator of this multimap.
+
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator to the last (i.e., greatest-keyed) element
+        // in this multimap, or the past-the-end reverse iterator if this
+        // multimap is empty.
+
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator of this multimap.
+
+    iterator find(const key_type& key);
+        // Return an iterator to the first element in this multimap having a
+        // key equivalent to the specified 'key', if such an element exists,
+        // and 'end()' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator to the first element in this multimap having a
+        // key equivalent to the specified 'key', if such an element exists,
+        // and 'end()' otherwise.  This overload participates in overload
+        // resolution only if 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.find(key);
+    }
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator to the first (i.e., least-keyed) element in this
+        // multimap whose key is not ordered before the specified 'key', and
+        // 'end()' if there is no such element.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    lower_bound(const LOOKUP_KEY& key)
+        // Return an iterator to the first (i.e., least-keyed) element in this
+        // multimap whose key is not ordered before the specified 'key', and
+        // 'end()' if there is no such element.  This overload participates in
+        // overload resolution only if 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.lowerBound(key);
+    }
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator to the first (i.e., least-keyed) element in this
+        // multimap whose key is ordered after the specified 'key', and 'end()'
+        // if there is no such element.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    upper_bound(const LOOKUP_KEY& key)
+        // Return an iterator to the first (i.e., least-keyed) element in this
+        // multimap whose key is ordered after the specified 'key', and 'end()'
+        // if there is no such element.  This overload participates in overload
+        // resolution only if 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.upperBound(key);
+    }
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators delimiting the elements in this multimap
+        // having a key equivalent to the specified 'key'.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators delimiting the elements in this multimap
+        // having a key equivalent to the specified 'key'.  This overload
+        // participates in overload resolution only if 'COMPARATOR' is
+        // transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.equalRange(key);
+    }
+
+    // ACCESSORS
+    const VALUE& at(const key_type& key) const;
+        // Return a reference providing non-modifiable access to the value
+        // associated with the specified 'key' in this multimap, if 'key' is in
+        // this multimap; otherwise throw a 'std::out_of_range' exception.
+
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // multimap.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., least-keyed) element in this multimap, or the past-the-end
+        // iterator if this multimap is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator providing non-modifiable access to
+        // this multimap.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last (i.e., greatest-keyed) element in this multimap, or the
+        // past-the-end reverse iterator if this multimap is empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator providing non-modifiable
+        // access to this multimap.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this multimap contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this multimap.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this multimap could possibly hold.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements this multimap can hold without
+        // reallocating.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor used by this multimap.
+
+    value_compare value_comp() const;
+        // Return a functor ordering elements of this multimap by key, using
+        // the key-comparison functor of this multimap.
+
+    const container_type& values() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reference providing non-modifiable access to the sequence
+        // of elements in this multimap, sorted by key.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // element in this multimap having a key equivalent to the specified
+        // 'key', if such an element exists, and 'end()' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // element in this multimap having a key equivalent to the specified
+        // 'key', if such an element exists, and 'end()' otherwise.  This
+        // overload participates in overload resolution only if 'COMPARATOR' is
+        // transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.find(key);
+    }
+
+    size_type count(const key_type& key) const;
+        // Return the number of elements in this multimap having a key
+        // equivalent to the specified 'key'.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of elements in this multimap having a key
+        // equivalent to the specified 'key'.  This overload participates in
+        // overload resolution only if 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.count(key);
+    }
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., least-keyed) element in this multimap whose key is not
+        // ordered before the specified 'key', and 'end()' if there is no such
+        // element.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., least-keyed) element in this multimap whose key is not
+        // ordered before the specified 'key', and 'end()' if there is no such
+        // element.  This overload participates in overload resolution only if
+        // 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.lowerBound(key);
+    }
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., least-keyed) element in this multimap whose key is ordered
+        // after the specified 'key', and 'end()' if there is no such element.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., least-keyed) element in this multimap whose key is ordered
+        // after the specified 'key', and 'end()' if there is no such
+        // element.  This overload participates in overload resolution only if
+        // 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.upperBound(key);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                  const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // elements in this multimap having a key equivalent to the specified
+        // 'key'.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // elements in this multimap having a key equivalent to the specified
+        // 'key'.  This overload participates in overload resolution only if
+        // 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.equalRange(key);
+    }
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_multimap' objects have the same
+    // value if they have the same number of elements, and each element in the
+    // ordered sequence of elements of 'lhs' has the same value as the
+    // corresponding element of 'rhs'.  This method requires that 'KEY' and
+    // 'VALUE' be equality-comparable.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_multimap' objects do not
+    // have the same value if they do not have the same number of elements, or
+    // some element in the ordered sequence of elements of 'lhs' does not have
+    // the same value as the corresponding element of 'rhs'.  This method
+    // requires that 'KEY' and 'VALUE' be equality-comparable.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator< (const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the sequence of elements of the specified 'lhs'
+    // multimap is lexicographically less than that of the specified 'rhs'
+    // multimap, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator> (const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the sequence of elements of the specified 'lhs'
+    // multimap is lexicographically greater than that of the specified 'rhs'
+    // multimap, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the sequence of elements of the specified 'lhs'
+    // multimap is lexicographically less than or equal to that of the
+    // specified 'rhs' multimap, and 'false' otherwise.  This method requires
+    // that 'operator<', inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the sequence of elements of the specified 'lhs'
+    // multimap is lexicographically greater than or equal to that of the
+    // specified 'rhs' multimap, and 'false' otherwise.  This method requires
+    // that 'operator<', inducing a total order, be defined for 'value_type'.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                 BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the value and comparator of the specified 'a' object with
+    // those of the specified 'b' object, and also the allocators if the
+    // 'ALLOCATOR' type has trait 'propagate_on_container_swap'.  If the
+    // allocators are not exchanged and are not equal, 'a' and 'b' exchange
+    // their values by copying, in linear time.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                    // ----------------------------------
+                    // class flat_multimap::value_compare
+                    // ----------------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare::value_compare(
+                                                         COMPARATOR comparator)
+: comp(comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare::operator()(
+                                                     const value_type& x,
+                                                     const value_type& y) const
+{
+    return comp(x.first, y.first);
+}
+
+                           // -------------------
+                           // class flat_multimap
+                           // -------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap()
+: d_tree(COMPARATOR(), ALLOCATOR())
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                                const flat_multimap& original)
+: d_tree(original.d_tree,
+         bsl::allocator_traits<ALLOCATOR>::
+             select_on_container_copy_construction(original.get_allocator()))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                      BloombergLP::bslmf::MovableRef<flat_multimap> original)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                        const flat_multimap& original,
+                                        const ALLOCATOR&     basicAllocator)
+: d_tree(original.d_tree, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                 BloombergLP::bslmf::MovableRef<flat_multimap> original,
+                 const ALLOCATOR&                              basicAllocator)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertRangeMulti(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                              INPUT_ITERATOR   first,
+                                              INPUT_ITERATOR   last,
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertRangeMulti(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                            sorted_equivalent_t,
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertSortedRangeMulti(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                              sorted_equivalent_t,
+                                              INPUT_ITERATOR   first,
+                                              INPUT_ITERATOR   last,
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertSortedRangeMulti(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                            std::initializer_list<value_type> values,
+                            const COMPARATOR&                 comparator,
+                            const ALLOCATOR&                  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertRangeMulti(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                            std::initializer_list<value_type> values,
+                            const ALLOCATOR&                  basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertRangeMulti(values.begin(), values.end());
+}
+#endif
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                                      const flat_multimap& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                           BloombergLP::bslmf::MovableRef<flat_multimap> rhs)
+{
+    d_tree = MoveUtil::move(MoveUtil::access(rhs).d_tree);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                      std::initializer_list<value_type> values)
+{
+    flat_multimap other(values, d_tree.comparator(), get_allocator());
+    d_tree.swap(other.d_tree);
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                       const value_type& value)
+{
+    return d_tree.insertMulti(value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                             BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    return d_tree.insertMulti(MoveUtil::move(value));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                        const_iterator    hint,
+                                                       const value_type& value)
+{
+    return d_tree.insertMulti(hint, value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                           const_iterator                             hint,
+                           BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    return d_tree.insertMulti(hint, MoveUtil::move(value));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                          INPUT_ITERATOR first,
+                                                           INPUT_ITERATOR last)
+{
+    d_tree.insertRangeMulti(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                           sorted_equivalent_t,
+                                                     INPUT_ITERATOR      first,
+                                                      INPUT_ITERATOR      last)
+{
+    d_tree.insertSortedRangeMulti(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                      std::initializer_list<value_type> values)
+{
+    d_tree.insertRangeMulti(values.begin(), values.end());
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace(ARGS&&... arguments)
+{
+    return d_tree.emplaceMulti(
+                         BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace_hint(
+                                                     const_iterator,
+                                                     ARGS&&...      arguments)
+{
+    return d_tree.emplaceMulti(
+                         BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != cend());
+
+    return d_tree.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    return d_tree.eraseKey(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                        const_iterator last)
+{
+    return d_tree.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(
+                                                          flat_multimap& other)
+                                  BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    d_tree.swap(other.d_tree);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    d_tree.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reserve(
+                                                         size_type numElements)
+{
+    d_tree.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_tree.shrinkToFit();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                           const key_type& key)
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                           const key_type& key)
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+     typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                           const key_type& key)
+{
+    return d_tree.equalRange(key);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.maxSize();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::capacity() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(d_tree.comparator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const typename
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::container_type&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::values() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.container();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(
+                                                     const key_type& key) const
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(
+                                                     const key_type& key) const
+{
+    return d_tree.count(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    return d_tree.equalRange(key);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(
+                                                                 lhs.begin(),
+                                                                 lhs.end(),
+                                                                 lhs.size(),
+                                                                 rhs.begin(),
+                                                                 rhs.end(),
+                                                                 rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                  BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<
+                        bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,608 @@
+// bslstl_flatmultimap.t.cpp                                          -*-C++-*-
+#include <bslstl_flatmultimap.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test defines a container adapter, 'bsl::flat_multimap',
+// that forwards to 'bslstl::FlatTree', which is tested thoroughly in its own
+// component.  This test driver therefore concentrates on the forwarding
+// itself: that the constructors install the intended allocator, and that the
+// manipulators and accessors agree with 'std::multimap' on pseudo-random
+// input, including the order of elements having equivalent keys, which
+// 'std::multimap' keeps in the order of their insertion.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_multimap();
+// [ 2] flat_multimap(const ALLOCATOR&);
+// [ 2] flat_multimap(const flat_multimap&);
+// [ 2] flat_multimap(MovableRef<flat_multimap>);
+// [ 2] flat_multimap(const flat_multimap&, const ALLOCATOR&);
+// [ 2] flat_multimap(MovableRef<flat_multimap>, const ALLOCATOR&);
+// [ 2] flat_multimap(INPUT_ITERATOR, INPUT_ITERATOR, const C&, const A&);
+// [ 2] flat_multimap(sorted_equivalent_t, INPUT_ITERATOR, ...);
+// [ 2] flat_multimap(initializer_list<value_type>, const C&, const A&);
+//
+// MANIPULATORS
+// [ 2] flat_multimap& operator=(const flat_multimap&);
+// [ 2] flat_multimap& operator=(MovableRef<flat_multimap>);
+// [ 3] iterator insert(const value_type&);
+// [ 3] iterator insert(const_iterator, const value_type&);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] iterator emplace(ARGS&&...);
+// [ 3] iterator erase(const_iterator);
+// [ 3] size_type erase(const key_type&);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 2] void swap(flat_multimap&);
+//
+// ACCESSORS
+// [ 3] const_iterator find(const key_type&) const;
+// [ 3] size_type count(const key_type&) const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(const key_type&);
+//
+// FREE OPERATORS
+// [ 2] bool operator==(const flat_multimap&, const flat_multimap&);
+// [ 2] bool operator!=(const flat_multimap&, const flat_multimap&);
+// [ 2] void swap(flat_multimap&, flat_multimap&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslmf::MovableRefUtil                MoveUtil;
+
+typedef bsl::flat_multimap<int, int>         IntMap;
+typedef bsl::flat_multimap<int, bsl::string> StringMap;
+
+typedef std::multimap<int, int>              Reference;
+
+static const char *const LONG_STRING =
+                             "a string long enough to require an allocation";
+
+//=============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified linear-congruential generator 'state', and return
+    // its new value, scaled to the range '[0 .. 2^15)'.
+{
+    *state = *state * 1103515245 + 12345;
+    return (*state >> 16) & 0x7fff;
+}
+
+bool isEqual(const IntMap& map, const Reference& reference)
+    // Return 'true' if the specified 'map' has the same sequence of elements
+    // as the specified 'reference', and 'false' otherwise.
+{
+    if (map.size() != reference.size()) {
+        return false;                                                 // RETURN
+    }
+    Reference::const_iterator rit = reference.begin();
+    for (IntMap::const_iterator it = map.begin(); it != map.end(); ++it) {
+        if (it->first != rit->first || it->second != rit->second) {
+            return false;                                             // RETURN
+        }
+        ++rit;
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+//  bool veryVeryVerbose     = argc > 4;
+//  bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: An Index of Orders by Account
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose an end-of-day report receives the day's orders, each identified by
+// an account number and an order number, and must list the orders of many
+// accounts.
+//
+// First, we load the orders, which arrive sorted by account, in a single pass,
+// using 'bsl::sorted_equivalent' to indicate that no sorting is needed:
+//..
+    typedef bsl::pair<int, int> Order;  // (account, order number)
+
+    const Order ORDERS[]   = { Order(1001, 7), Order(1001, 9),
+                               Order(1002, 8), Order(1005, 3),
+                               Order(1005, 4), Order(1005, 5) };
+    const int   NUM_ORDERS = sizeof ORDERS / sizeof *ORDERS;
+
+    bsl::flat_multimap<int, int> orders(bsl::sorted_equivalent,
+                                        ORDERS,
+                                        ORDERS + NUM_ORDERS);
+    ASSERT(6 == orders.size());
+//..
+// Then, we count the orders of an account:
+//..
+    ASSERT(3 == orders.count(1005));
+    ASSERT(0 == orders.count(1003));
+//..
+// Finally, we list the orders of an account, which are held in the order in
+// which they arrived:
+//..
+    typedef bsl::flat_multimap<int, int>::const_iterator Iterator;
+
+    bsl::pair<Iterator, Iterator> range = orders.equal_range(1001);
+    ASSERT(2 == range.second - range.first);
+    ASSERT(7 == range.first[0].second);
+    ASSERT(9 == range.first[1].second);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND LOOKUP
+        //
+        // Concerns:
+        //: 1 Each manipulator leaves the multimap with the same sequence of
+        //:   elements as the corresponding manipulator of 'std::multimap';
+        //:   in particular, elements having equivalent keys are kept in the
+        //:   order of their insertion, and the range 'insert' keeps
+        //:   equivalent elements of the range in their order in the range.
+        //:
+        //: 2 'find', 'count', and 'equal_range' agree with those of
+        //:   'std::multimap', and 'find' returns the first of the elements
+        //:   having the specified key.
+        //:
+        //: 3 No memory is taken from the default allocator.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of manipulators to a
+        //:   'flat_multimap' and to a 'std::multimap', using mapped values
+        //:   that identify each insertion, and compare the sequences of
+        //:   elements after each step.  (C-1, 3)
+        //:
+        //: 2 Look up every key in and around the resulting multimap, and
+        //:   compare with 'std::multimap'.  (C-2)
+        //
+        // Testing:
+        //   iterator insert(const value_type&);
+        //   iterator insert(const_iterator, const value_type&);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   iterator emplace(ARGS&&...);
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   const_iterator find(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATORS AND LOOKUP"
+                            "\n=======================\n");
+
+        typedef IntMap::value_type Element;
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        unsigned int state    = 31;
+        int          sequence = 0;
+        IntMap       mX(&sa);  const IntMap& X = mX;
+        Reference    reference;
+
+        for (int i = 0; i < 2000; ++i) {
+            const int key = static_cast<int>(nextRandom(&state) % 40);
+
+            switch (nextRandom(&state) % 7) {
+              case 0: {
+                reference.insert(std::pair<int, int>(key, sequence));
+
+                IntMap::iterator it = mX.insert(Element(key, sequence++));
+                ASSERTV(i, key, key == it->first);
+                ASSERTV(i, key, it + 1 == X.upper_bound(key));
+              } break;
+              case 1: {
+                // 'std::multimap' inserts before a hint that is a correct
+                // position, so that a hint of 'upper_bound' appends the
+                // element to those having an equivalent key.
+
+                reference.insert(reference.upper_bound(key),
+                                 std::pair<int, int>(key, sequence));
+                mX.insert(X.upper_bound(key), Element(key, sequence++));
+              } break;
+              case 2: {
+                Element batch[8];
+                for (int j = 0; j < 8; ++j) {
+                    batch[j] = Element(static_cast<int>(
+                                                    nextRandom(&state) % 40),
+                                       sequence++);
+                    reference.insert(std::pair<int, int>(batch[j].first,
+                                                         batch[j].second));
+                }
+                mX.insert(batch, batch + 8);
+              } break;
+              case 3: {
+                Reference batch;
+                for (int j = 0; j < 8; ++j) {
+                    batch.insert(std::pair<int, int>(
+                                     static_cast<int>(nextRandom(&state) % 40),
+                                     sequence++));
+                }
+                reference.insert(batch.begin(), batch.end());
+                mX.insert(bsl::sorted_equivalent, batch.begin(), batch.end());
+              } break;
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+              case 4: {
+                reference.insert(std::pair<int, int>(key, sequence));
+
+                IntMap::iterator it = mX.emplace(key, sequence++);
+                ASSERTV(i, key, key == it->first);
+              } break;
+#endif
+              case 5: {
+                ASSERTV(i, key, reference.erase(key) == mX.erase(key));
+              } break;
+              default: {
+                if (!X.empty()) {
+                    const IntMap::size_type first =
+                                              nextRandom(&state) % X.size();
+                    const IntMap::size_type last  = first
+                                   + nextRandom(&state) % (X.size() - first);
+
+                    Reference::iterator rFirst = reference.begin();
+                    std::advance(rFirst, first);
+                    Reference::iterator rLast = rFirst;
+                    std::advance(rLast, last - first);
+                    reference.erase(rFirst, rLast);
+
+                    if (first + 1 == last) {
+                        mX.erase(X.begin() + first);
+                    }
+                    else {
+                        mX.erase(X.begin() + first, X.begin() + last);
+                    }
+                }
+              }
+            }
+            ASSERTV(i, isEqual(X, reference));
+        }
+
+        for (int key = -1; key <= 41; ++key) {
+            typedef IntMap::const_iterator Iter;
+
+            const std::ptrdiff_t lower = std::distance(
+                                                 reference.begin(),
+                                                 reference.lower_bound(key));
+            const std::ptrdiff_t upper = std::distance(
+                                                 reference.begin(),
+                                                 reference.upper_bound(key));
+
+            ASSERTV(key, reference.count(key) == X.count(key));
+
+            Iter it = X.find(key);
+            ASSERTV(key, lower == upper ? X.end() == it
+                                        : X.begin() + lower == it);
+
+            bsl::pair<Iter, Iter> range = X.equal_range(key);
+            ASSERTV(key, lower == range.first  - X.begin());
+            ASSERTV(key, upper == range.second - X.begin());
+        }
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        //: 1 Each constructor installs the supplied allocator, or the default
+        //:   allocator if none is supplied, and supplies it to the mapped
+        //:   values.
+        //:
+        //: 2 The range constructors keep every element, and keep elements
+        //:   having equivalent keys in their order in the range.
+        //:
+        //: 3 Moving between multimaps having the same allocator does not
+        //:   allocate.
+        //:
+        //: 4 Copy assignment copies the elements, but not the allocator, and
+        //:   'swap' exchanges the elements of two multimaps.
+        //
+        // Plan:
+        //: 1 Construct, assign, and swap multimaps of long strings, and verify
+        //:   their elements and allocators, and the allocation performed.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   flat_multimap();
+        //   flat_multimap(const ALLOCATOR&);
+        //   flat_multimap(const flat_multimap&);
+        //   flat_multimap(MovableRef<flat_multimap>);
+        //   flat_multimap(const flat_multimap&, const ALLOCATOR&);
+        //   flat_multimap(MovableRef<flat_multimap>, const ALLOCATOR&);
+        //   flat_multimap(INPUT_ITERATOR, INPUT_ITERATOR, const C&, const A&);
+        //   flat_multimap(sorted_equivalent_t, INPUT_ITERATOR, ...);
+        //   flat_multimap(initializer_list<value_type>, const C&, const A&);
+        //   flat_multimap& operator=(const flat_multimap&);
+        //   flat_multimap& operator=(MovableRef<flat_multimap>);
+        //   void swap(flat_multimap&);
+        //   bool operator==(const flat_multimap&, const flat_multimap&);
+        //   bool operator!=(const flat_multimap&, const flat_multimap&);
+        //   void swap(flat_multimap&, flat_multimap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, ASSIGNMENT, AND SWAP"
+                            "\n==============================\n");
+
+        typedef IntMap::value_type Element;
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+        bslma::TestAllocator oa("other",    veryVerbose);
+
+        if (verbose) printf("\tRange constructors.\n");
+        {
+            const Element DATA[] = { Element(5, 0), Element(1, 1),
+                                     Element(4, 2), Element(1, 3),
+                                     Element(5, 4), Element(9, 5) };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            IntMap mX(DATA, DATA + NUM_DATA, std::less<int>(), &sa);
+            const IntMap& X = mX;
+
+            Reference reference;
+            for (int i = 0; i < NUM_DATA; ++i) {
+                reference.insert(std::pair<int, int>(DATA[i].first,
+                                                     DATA[i].second));
+            }
+            ASSERT(isEqual(X, reference));
+            ASSERT(&sa == X.get_allocator().mechanism());
+
+            const Element SORTED[] = { Element(1, 1), Element(1, 3),
+                                       Element(4, 2), Element(5, 0),
+                                       Element(5, 4), Element(9, 5) };
+
+            IntMap mY(bsl::sorted_equivalent, SORTED, SORTED + 6, &sa);
+            ASSERT(X == mY);
+
+            mY.erase(mY.begin());
+            mY.insert(Element(1, 1));
+            ASSERT(X != mY);  // '(1, 1)' now follows '(1, 3)'
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            IntMap mZ({ { 5, 0 }, { 1, 1 }, { 4, 2 },
+                        { 1, 3 }, { 5, 4 }, { 9, 5 } },
+                      std::less<int>(),
+                      &sa);
+            ASSERT(X == mZ);
+#endif
+        }
+
+        if (verbose) printf("\tCopy, move, and assignment.\n");
+        {
+            StringMap mX(&sa);  const StringMap& X = mX;
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(StringMap::value_type(i % 3,
+                                                bsl::string(LONG_STRING,
+                                                            &sa)));
+            }
+            ASSERT(10 == X.size());
+            ASSERT(&sa == X.begin()->second.get_allocator().mechanism());
+
+            StringMap mC(X);
+            ASSERT(X == mC);
+            ASSERT(&defaultAllocator == mC.get_allocator().mechanism());
+            ASSERT(&defaultAllocator ==
+                               mC.begin()->second.get_allocator().mechanism());
+
+            StringMap mY(X, &sa);
+            ASSERT(X == mY);
+
+            const bsls::Types::Int64 NUM_BLOCKS = sa.numBlocksTotal();
+
+            StringMap mZ(MoveUtil::move(mY));
+            ASSERT(X == mZ);
+            ASSERT(NUM_BLOCKS == sa.numBlocksTotal());
+
+            StringMap mW(MoveUtil::move(mZ), &oa);
+            ASSERT(X == mW);
+            ASSERT(&oa == mW.begin()->second.get_allocator().mechanism());
+
+            StringMap mV(&oa);
+            mV = X;
+            ASSERT(X == mV);
+            ASSERT(&oa == mV.begin()->second.get_allocator().mechanism());
+
+            StringMap mU(&sa);  const StringMap& U = mU;
+            mU.insert(StringMap::value_type(99, bsl::string("u", &sa)));
+            mU.swap(mV);
+            ASSERT(X == U);
+            ASSERT(1 == mV.size());
+
+            swap(mU, mV);
+            ASSERT(1 == U.size());
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        IntMap mX(&sa);  const IntMap& X = mX;
+        ASSERT(X.empty());
+
+        mX.insert(IntMap::value_type(2, 20));
+        mX.insert(IntMap::value_type(1, 10));
+        mX.insert(IntMap::value_type(2, 21));
+        ASSERT(3  == X.size());
+        ASSERT(2  == X.count(2));
+        ASSERT(20 == X.find(2)->second);
+        ASSERT(21 == X.rbegin()->second);
+
+        ASSERT(2 == mX.erase(2));
+        ASSERT(1 == X.size());
+
+        mX.clear();
+        ASSERT(X.empty());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1278 @@
+// bslstl_flatmultiset.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMULTISET
+#define INCLUDED_BSLSTL_FLATMULTISET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered multiset of keys held in contiguous storage.
+//
+//@CLASSES:
+//   bsl::flat_multiset: multiset of keys held in a sorted 'bsl::vector'
+//
+//@SEE_ALSO: bslstl_flatset, bslstl_flattree, bslstl_multiset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_multiset', implementing an ordered associative container holding
+// keys, possibly equivalent, with the interface of 'bsl::multiset' (less the
+// guarantees of iterator stability), but holding its keys in a sorted
+// 'bsl::vector' (see 'bslstl_flattree') rather than in a red-black tree.
+// Equivalent keys are held in the order in which they were inserted.
+//
+// An instantiation of 'flat_multiset' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the 'flat_multiset' contains.
+//
+///Choosing Between 'multiset' and 'flat_multiset'
+///-----------------------------------------------
+// A 'bsl::multiset' allocates a tree node per key; a lookup follows one
+// pointer per level of the tree, typically incurring a cache miss at each
+// level once the multiset is larger than the cache.  A 'flat_multiset'
+// allocates one array for all of its keys, and looks up a key by a
+// (branch-free) binary search over that array, which touches far fewer cache
+// lines, and iterates over its keys as over an array.  On the other hand,
+// inserting into or erasing from a 'flat_multiset' moves all of the keys that
+// follow the affected position, and invalidates all iterators and references.
+// A 'flat_multiset' is therefore best suited to multisets that are built once
+// (ideally in bulk, see {Bulk Insertion}) and then searched often, such as
+// configuration and reference tables.
+//
+///Bulk Insertion
+///--------------
+// Inserting 'm' keys one at a time into a 'flat_multiset' of 'n' keys takes
+// 'O[m * (n + m)]' time.  The range constructors and the range 'insert'
+// instead append the range and merge it with the existing keys (see
+// 'bslstl_flattree'), taking 'O[n + m * log(m)]' time.  If the range is
+// already sorted, passing 'bsl::sorted_equivalent' to the constructor or to
+// 'insert' skips the sort, so that building a 'flat_multiset' from such a
+// range takes linear time.  The merge moves the keys into a newly allocated
+// array, so it temporarily requires memory for a second copy of them, and if
+// an exception is thrown during the merge, the 'flat_multiset' is left empty.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'flat_multiset''s 'ALLOCATOR' template parameter
+// determines how that 'flat_multiset' will allocate memory.  If it is
+// 'bsl::allocator' (the default), then a 'flat_multiset' accepts an optional
+// 'bslma::Allocator' argument at construction, uses it to supply memory for
+// its array of keys, and supplies it to the keys themselves if they have the
+// 'bslma::UsesBslmaAllocator' trait.  If no allocator is supplied, the
+// currently installed default allocator is used.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_multiset':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the 'flat_multiset'
+//  'a', 'b'        - two distinct objects of type 'flat_multiset<K>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'k'             - an object of type 'K'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  'i1', 'i2'      - two iterators defining a sequence of 'K' objects
+//  'N'             - distance(i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_multiset<K> a;  (default construction)        | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multiset<K> a(b);  (copy construction)        | O[m]               |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multiset<K> a(i1, i2);                        | O[N * log(N)]      |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multiset<K> a(sorted_equivalent, i1, i2);     | O[N]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.count(k), a.lower_bound(k),           | O[log(n)]          |
+//  | a.upper_bound(k), a.equal_range(k)                 |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(k), a.emplace(...), a.erase(k)            | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(p1, k)                                    | O[n], and no       |
+//  |                                                    | search if 'p1' is  |
+//  |                                                    | the correct place  |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[n + N * log(N)]  |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(sorted_equivalent, i1, i2)                | O[n + N]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1), a.erase(p1, p2)                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a, b)                              | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b, a < b, a <= b, a > b, a >= b       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.size(), a.empty(),           | O[1]               |
+//  | a.capacity(), a.reserve(n), a.clear()              |                    |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing Trades by Price
+///- - - - - - - - - - - - - - - - - -
+// Suppose a risk report receives, once per run, the prices of a day's trades,
+// and must then answer many queries about how many trades executed within a
+// given price range.
+//
+// First, we load the prices, which may repeat, in a single bulk insertion:
+//..
+//  const double PRICES[]   = { 101.5, 100.0, 102.25, 100.0, 101.5, 100.0 };
+//  const int    NUM_PRICES = sizeof PRICES / sizeof *PRICES;
+//
+//  bsl::flat_multiset<double> prices(PRICES, PRICES + NUM_PRICES);
+//  assert(6 == prices.size());
+//..
+// Then, we count the trades at a given price:
+//..
+//  assert(3 == prices.count(100.0));
+//  assert(0 == prices.count(100.5));
+//..
+// Finally, we count the trades in the price range '[100.5 .. 102.0)':
+//..
+//  assert(2 == bsl::distance(prices.lower_bound(100.5),
+//                            prices.lower_bound(102.0)));
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_flattree.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_rangecompare.h>
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace bsl {
+
+                           // ===================
+                           // class flat_multiset
+                           // ===================
+
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<KEY> >
+class flat_multiset {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of keys (of the template parameter type, 'KEY'),
+    // possibly equivalent, in contiguous storage.  Insertion and removal
+    // invalidate all iterators, pointers, and references to the keys of the
+    // container.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   except for 'BDEX' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::FlatTree<
+                   BloombergLP::bslstl::UnorderedSetKeyConfiguration<KEY>,
+                   COMPARATOR,
+                   ALLOCATOR>                          Tree;
+        // This 'typedef' is an alias for the implementation of this multiset.
+
+    typedef BloombergLP::bslmf::MovableRefUtil         MoveUtil;
+        // This 'typedef' is a convenient alias for the utility associated
+        // with movable references.
+
+    // DATA
+    Tree d_tree;  // sorted keys
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename Tree::Container                   container_type;
+    typedef typename container_type::size_type         size_type;
+    typedef typename container_type::difference_type   difference_type;
+    typedef typename container_type::pointer           pointer;
+    typedef typename container_type::const_pointer     const_pointer;
+
+    typedef typename container_type::const_iterator    iterator;
+    typedef typename container_type::const_iterator    const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    // CREATORS
+    flat_multiset();
+    explicit flat_multiset(const COMPARATOR& comparator,
+                           const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Create an empty multiset.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator is used.
+    : d_tree(comparator, basicAllocator)
+    {
+        // The implementation is placed here in the class definition to work
+        // around an AIX compiler bug, as for 'bsl::set'.
+    }
+
+    explicit flat_multiset(const ALLOCATOR& basicAllocator);
+        // Create an empty multiset that uses the specified 'basicAllocator' to
+        // supply memory, and a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order its keys.
+
+    flat_multiset(const flat_multiset& original);
+        // Create a multiset having the same value as the specified 'original'
+        // object, using a copy of 'original.key_comp()' to order keys and
+        // the allocator returned by 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // supply memory.
+
+    flat_multiset(BloombergLP::bslmf::MovableRef<flat_multiset> original);
+                                                                    // IMPLICIT
+        // Create a multiset having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new multiset.  The comparator and allocator of 'original' are
+        // propagated to the new multiset.  'original' is left in a valid but
+        // unspecified state.
+
+    flat_multiset(const flat_multiset& original,
+                  const ALLOCATOR&     basicAllocator);
+        // Create a multiset having the same value as the specified 'original'
+        // object, using a copy of 'original.key_comp()' to order keys and the
+        // specified 'basicAllocator' to supply memory.
+
+    flat_multiset(
+                 BloombergLP::bslmf::MovableRef<flat_multiset> original,
+                 const ALLOCATOR&                              basicAllocator);
+        // Create a multiset having the same value as the specified 'original'
+        // object, using a copy of 'original.key_comp()' to order keys and the
+        // specified 'basicAllocator' to supply memory.  The contents of
+        // 'original' are moved (in constant time) if 'basicAllocator' equals
+        // 'original.get_allocator()', and are move-inserted (in linear time)
+        // otherwise.  'original' is left in a valid but unspecified state.
+
+    template <class INPUT_ITERATOR>
+    flat_multiset(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator     = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_multiset(INPUT_ITERATOR   first,
+                  INPUT_ITERATOR   last,
+                  const ALLOCATOR& basicAllocator);
+        // Create a multiset holding the keys in the specified range
+        // '[first .. last)'.
+        // Optionally specify a 'comparator' used to order keys.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'ALLOCATOR' is used.  'INPUT_ITERATOR' must meet the
+        // requirements of an input iterator, and its 'value_type' must be
+        // convertible to 'KEY'.
+
+    template <class INPUT_ITERATOR>
+    flat_multiset(sorted_equivalent_t,
+                  INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator     = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_multiset(sorted_equivalent_t,
+                  INPUT_ITERATOR   first,
+                  INPUT_ITERATOR   last,
+                  const ALLOCATOR& basicAllocator);
+        // Create a multiset holding the keys in the specified range
+        // '[first .. last)', in linear time.  Optionally specify a
+        // 'comparator' and a 'basicAllocator', as for the constructor without
+        // a 'sorted_equivalent_t' argument.  The behavior is undefined unless
+        // the range is sorted with respect to the comparator.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multiset(std::initializer_list<KEY> values,
+                  const COMPARATOR&          comparator     = COMPARATOR(),
+                  const ALLOCATOR&           basicAllocator = ALLOCATOR());
+    flat_multiset(std::initializer_list<KEY> values,
+                  const ALLOCATOR&           basicAllocator);
+        // Create a multiset holding the keys in the specified 'values'
+        // initializer list.
+        // Optionally specify a 'comparator' and a 'basicAllocator', as for
+        // the range constructor.
+#endif
+
+    //! ~flat_multiset() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_multiset& operator=(const flat_multiset& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if
+        // the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    flat_multiset& operator=(
+                        BloombergLP::bslmf::MovableRef<flat_multiset> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  The contents of 'rhs' are moved (in constant time) if
+        // 'get_allocator() == rhs.get_allocator()', and are move-inserted (in
+        // linear time) otherwise.  'rhs' is left in a valid but unspecified
+        // state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multiset& operator=(std::initializer_list<KEY> values);
+        // Assign to this object the keys of the specified 'values'
+        // initializer list, and return a reference providing modifiable access
+        // to this object.
+#endif
+
+    iterator insert(const value_type& value);
+    iterator insert(BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this multiset, after any keys
+        // equivalent to 'value', and return an iterator to the inserted key.
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this multiset, as close as
+        // possible to the position before the specified 'hint' (i.e., before
+        // 'hint' if that keeps the keys ordered), and return an iterator to
+        // the inserted key.  If 'hint' is such a position, no search is made.
+        // The behavior is undefined unless 'hint' is an iterator in the range
+        // '[begin() .. end()]'.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this multiset the keys in the specified range
+        // '[first .. last)'.  Equivalent keys follow the keys already in this
+        // multiset, in the order of the range.  If an exception is thrown
+        // while the keys are merged with the existing keys, this multiset is
+        // left empty.  The behavior is undefined unless the range does not
+        // refer to keys of this multiset.  Note that the keys are inserted in
+        // bulk (see {Bulk Insertion}).
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_equivalent_t,
+                INPUT_ITERATOR      first,
+                INPUT_ITERATOR      last);
+        // Insert into this multiset the keys in the specified range
+        // '[first .. last)', in linear time.  Equivalent keys follow the keys
+        // already in this multiset, in the order of the range.  If an
+        // exception is thrown while the keys are merged with the existing
+        // keys, this multiset is left empty.  The behavior is undefined unless
+        // the range is sorted and does not refer to keys of this multiset.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<KEY> values);
+        // Insert into this multiset the keys in the specified 'values'
+        // initializer list.  If an exception is thrown while the keys are
+        // merged with the existing keys, this multiset is left empty.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    iterator emplace(ARGS&&... arguments);
+        // Insert into this multiset a newly created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'arguments' to the corresponding
+        // constructor of 'value_type', after any equivalent keys, and return
+        // an iterator to the inserted key.
+
+    template <class... ARGS>
+    iterator emplace_hint(const_iterator hint, ARGS&&... arguments);
+        // Insert into this multiset a newly created 'value_type' object,
+        // constructed as for 'emplace' from the specified 'arguments', after
+        // any equivalent keys, and return an iterator to the inserted key.
+        // The specified 'hint' is ignored.
+#endif
+
+    iterator erase(const_iterator position);
+        // Remove from this multiset the key at the specified 'position', and
+        // return an iterator to the key that followed it (or 'end()').  The
+        // behavior is undefined unless 'position' is an iterator in the range
+        // '[cbegin() .. cend())'.
+
+    size_type erase(const key_type& key);
+        // Remove from this multiset the keys equivalent to the specified
+        // 'key', and return the number of keys removed.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this multiset the keys in the specified range
+        // '[first .. last)', and return 'last'.  The behavior is undefined
+        // unless '[first .. last)' is a valid range of this multiset.
+
+    void swap(flat_multiset& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  If the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_swap', also exchange the allocators.  This
+        // method provides the no-throw guarantee and takes constant time if
+        // the allocators are exchanged or are equal; otherwise, the values
+        // are exchanged by copying, in linear time.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all keys from this multiset, retaining its capacity.
+
+    void reserve(size_type numKeys);
+        // Ensure that this multiset can hold the specified 'numKeys' without
+        // reallocating.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this multiset to its size, if possible.
+
+    // ACCESSORS
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // multiset.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator to the first (i.e., least) key in this multiset,
+        // or the past-the-end iterator if this multiset is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator of this multiset.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator to the last (i.e., greatest) key in this
+        // multiset, or the past-the-end reverse iterator if this multiset is
+        // empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator of this multiset.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this multiset contains no keys, and 'false'
+        // otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of keys in this multiset.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of keys that
+        // this multiset could possibly hold.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of keys this multiset can hold without
+        // reallocating.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor used by this multiset.
+
+    value_compare value_comp() const;
+        // Return the value-comparison functor used by this multiset (which is
+        // the same as its key-comparison functor).
+
+    const container_type& keys() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reference providing non-modifiable access to the sorted
+        // sequence of keys in this multiset.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator to the first key in this multiset equivalent to
+        // the specified 'key', if such a key exists, and 'end()' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator to the first key in this multiset equivalent to
+        // the specified 'key', if such a key exists, and 'end()' otherwise.
+        // This
+        // overload participates in overload resolution only if 'COMPARATOR'
+        // is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.find(key);
+    }
+
+    size_type count(const key_type& key) const;
+        // Return the number of keys in this multiset equivalent to the
+        // specified 'key'.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of keys in this multiset equivalent to the
+        // specified 'key'.  This overload participates in overload resolution
+        // only if 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.count(key);
+    }
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator to the first (i.e., least) key in this multiset
+        // not ordered before the specified 'key', and 'end()' if there is no
+        // such key.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator to the first (i.e., least) key in this multiset
+        // not ordered before the specified 'key', and 'end()' if there is no
+        // such key.  This overload participates in overload resolution only if
+        // 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.lowerBound(key);
+    }
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator to the first (i.e., least) key in this multiset
+        // ordered after the specified 'key', and 'end()' if there is no such
+        // key.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator to the first (i.e., least) key in this multiset
+        // ordered after the specified 'key', and 'end()' if there is no such
+        // key.  This overload participates in overload resolution only if
+        // 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.upperBound(key);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                  const key_type& key) const;
+        // Return a pair of iterators delimiting the keys in this multiset
+        // equivalent to the specified 'key'.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators delimiting the keys in this multiset
+        // equivalent to the specified 'key'.  This overload participates in
+        // overload resolution only if 'COMPARATOR' is transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.equalRange(key);
+    }
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_multiset' objects have the same
+    // value if they have the same number of keys, and each key in the ordered
+    // sequence of keys of 'lhs' has the same value as the corresponding key
+    // of 'rhs'.  This method requires that 'KEY' be equality-comparable.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_multiset' objects do not
+    // have the same value if they do not have the same number of keys, or
+    // some key in the ordered sequence of keys of 'lhs' does not have the same
+    // value as the corresponding key of 'rhs'.  This method requires that
+    // 'KEY' be equality-comparable.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator< (const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the sequence of keys of the specified 'lhs' multiset is
+    // lexicographically less than that of the specified 'rhs' multiset, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'KEY'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator> (const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the sequence of keys of the specified 'lhs' multiset is
+    // lexicographically greater than that of the specified 'rhs' multiset, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'KEY'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the sequence of keys of the specified 'lhs' multiset is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // multiset, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'KEY'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the sequence of keys of the specified 'lhs' multiset is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // multiset, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'KEY'.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(flat_multiset<KEY, COMPARATOR, ALLOCATOR>& a,
+          flat_multiset<KEY, COMPARATOR, ALLOCATOR>& b)
+                                 BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the value and comparator of the specified 'a' object with
+    // those of the specified 'b' object, and also the allocators if the
+    // 'ALLOCATOR' type has trait 'propagate_on_container_swap'.  If the
+    // allocators are not exchanged and are not equal, 'a' and 'b' exchange
+    // their values by copying, in linear time.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // -------------------
+                           // class flat_multiset
+                           // -------------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset()
+: d_tree(COMPARATOR(), ALLOCATOR())
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                                const flat_multiset& original)
+: d_tree(original.d_tree,
+         bsl::allocator_traits<ALLOCATOR>::
+             select_on_container_copy_construction(original.get_allocator()))
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                      BloombergLP::bslmf::MovableRef<flat_multiset> original)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree))
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                        const flat_multiset& original,
+                                        const ALLOCATOR&     basicAllocator)
+: d_tree(original.d_tree, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                 BloombergLP::bslmf::MovableRef<flat_multiset> original,
+                 const ALLOCATOR&                              basicAllocator)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertRangeMulti(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                              INPUT_ITERATOR   first,
+                                              INPUT_ITERATOR   last,
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertRangeMulti(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                            sorted_equivalent_t,
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertSortedRangeMulti(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                              sorted_equivalent_t,
+                                              INPUT_ITERATOR   first,
+                                              INPUT_ITERATOR   last,
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertSortedRangeMulti(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                   std::initializer_list<KEY> values,
+                                   const COMPARATOR&          comparator,
+                                   const ALLOCATOR&           basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertRangeMulti(values.begin(), values.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                   std::initializer_list<KEY> values,
+                                   const ALLOCATOR&           basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertRangeMulti(values.begin(), values.end());
+}
+#endif
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>&
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::operator=(const flat_multiset& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>&
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                           BloombergLP::bslmf::MovableRef<flat_multiset> rhs)
+{
+    d_tree = MoveUtil::move(MoveUtil::access(rhs).d_tree);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>&
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                                             std::initializer_list<KEY> values)
+{
+    flat_multiset other(values, d_tree.comparator(), get_allocator());
+    d_tree.swap(other.d_tree);
+    return *this;
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    return d_tree.insertMulti(value);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(
+                             BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    return d_tree.insertMulti(MoveUtil::move(value));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                                  const value_type& value)
+{
+    return d_tree.insertMulti(hint, value);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(
+                           const_iterator                             hint,
+                           BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    return d_tree.insertMulti(hint, MoveUtil::move(value));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                       INPUT_ITERATOR last)
+{
+    d_tree.insertRangeMulti(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(sorted_equivalent_t,
+                                                       INPUT_ITERATOR first,
+                                                       INPUT_ITERATOR last)
+{
+    d_tree.insertSortedRangeMulti(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(
+                                             std::initializer_list<KEY> values)
+{
+    d_tree.insertRangeMulti(values.begin(), values.end());
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::emplace(ARGS&&... arguments)
+{
+    return d_tree.emplaceMulti(
+                         BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                                                     const_iterator,
+                                                     ARGS&&...      arguments)
+{
+    return d_tree.emplaceMulti(
+                         BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_tree.erase(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    return d_tree.eraseKey(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                 const_iterator last)
+{
+    return d_tree.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::swap(flat_multiset& other)
+                                  BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    d_tree.swap(other.d_tree);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::clear() BSLS_KEYWORD_NOEXCEPT
+{
+    d_tree.clear();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::reserve(size_type numKeys)
+{
+    d_tree.reserve(numKeys);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_tree.shrinkToFit();
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::allocator_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::begin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::cbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::end() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::cend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::rbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::rend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::crend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_multiset<KEY, COMPARATOR, ALLOCATOR>::empty() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.empty();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.maxSize();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::capacity() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.capacity();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::key_compare
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::value_compare
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+const typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::container_type&
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::keys() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.container();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return d_tree.count(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    return d_tree.equalRange(key);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(
+                                                                 lhs.begin(),
+                                                                 lhs.end(),
+                                                                 lhs.size(),
+                                                                 rhs.begin(),
+                                                                 rhs.end(),
+                                                                 rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& b)
+                                  BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,748 @@
+// bslstl_flatmultiset.t.cpp                                          -*-C++-*-
+#include <bslstl_flatmultiset.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+
+#include <algorithm>
+#include <functional>
+#include <set>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test defines a container adapter, 'bsl::flat_multiset',
+// that forwards to 'bslstl::FlatTree', which is tested thoroughly in its own
+// component.  This test driver therefore concentrates on the forwarding
+// itself: that the constructors install the intended allocator, that the
+// manipulators and accessors agree with 'std::multiset' on pseudo-random
+// input having many duplicates, and that equivalent keys retain their order
+// of insertion.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_multiset();
+// [ 2] flat_multiset(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_multiset(const ALLOCATOR&);
+// [ 2] flat_multiset(const flat_multiset&);
+// [ 2] flat_multiset(MovableRef<flat_multiset>);
+// [ 2] flat_multiset(const flat_multiset&, const ALLOCATOR&);
+// [ 2] flat_multiset(MovableRef<flat_multiset>, const ALLOCATOR&);
+// [ 2] flat_multiset(INPUT_ITERATOR, INPUT_ITERATOR, const C&, const A&);
+// [ 2] flat_multiset(sorted_equivalent_t, INPUT_ITERATOR, ...);
+// [ 2] flat_multiset(initializer_list<KEY>, const C&, const A&);
+//
+// MANIPULATORS
+// [ 2] flat_multiset& operator=(const flat_multiset&);
+// [ 2] flat_multiset& operator=(MovableRef<flat_multiset>);
+// [ 3] iterator insert(const value_type&);
+// [ 3] iterator insert(const_iterator, const value_type&);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] iterator emplace(ARGS&&...);
+// [ 3] iterator emplace_hint(const_iterator, ARGS&&...);
+// [ 3] iterator erase(const_iterator);
+// [ 3] size_type erase(const key_type&);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 2] void swap(flat_multiset&);
+// [ 3] void clear();
+//
+// ACCESSORS
+// [ 4] const_iterator find(const key_type&) const;
+// [ 4] size_type count(const key_type&) const;
+// [ 4] const_iterator lower_bound(const key_type&) const;
+// [ 4] const_iterator upper_bound(const key_type&) const;
+// [ 4] pair<const_iterator, const_iterator> equal_range(const key_type&);
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const flat_multiset&, const flat_multiset&);
+// [ 4] bool operator!=(const flat_multiset&, const flat_multiset&);
+// [ 4] bool operator< (const flat_multiset&, const flat_multiset&);
+// [ 4] bool operator> (const flat_multiset&, const flat_multiset&);
+// [ 4] bool operator<=(const flat_multiset&, const flat_multiset&);
+// [ 4] bool operator>=(const flat_multiset&, const flat_multiset&);
+// [ 2] void swap(flat_multiset&, flat_multiset&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslmf::MovableRefUtil           MoveUtil;
+
+typedef bsl::flat_multiset<int>         IntSet;
+typedef bsl::flat_multiset<bsl::string> StringSet;
+
+typedef bsl::pair<int, int>             Element;
+    // An 'Element' is a key (the 'first' member) and the sequence number of
+    // its insertion (the 'second' member), used to verify that equivalent
+    // keys retain their order of insertion.
+
+static const char *const LONG_STRING =
+                             "a string long enough to require an allocation";
+
+//=============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+                              // ================
+                              // struct FirstLess
+                              // ================
+
+struct FirstLess {
+    // This 'struct' orders 'Element' objects by their 'first' members only.
+
+    // ACCESSORS
+    bool operator()(const Element& lhs, const Element& rhs) const
+        // Return 'lhs.first < rhs.first'.
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+typedef bsl::flat_multiset<Element, FirstLess> ElementSet;
+
+//=============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified linear-congruential generator 'state', and return
+    // its new value, scaled to the range '[0 .. 2^15)'.
+{
+    *state = *state * 1103515245 + 12345;
+    return (*state >> 16) & 0x7fff;
+}
+
+bool isEqual(const IntSet& set, const std::multiset<int>& reference)
+    // Return 'true' if the specified 'set' has the same sequence of keys as
+    // the specified 'reference', and 'false' otherwise.
+{
+    return set.size() == reference.size()
+        && std::equal(set.begin(), set.end(), reference.begin());
+}
+
+bool isStablySorted(const ElementSet& set)
+    // Return 'true' if the elements of the specified 'set' are sorted by key
+    // and elements having equivalent keys are in increasing order of their
+    // sequence numbers, and 'false' otherwise.
+{
+    for (ElementSet::const_iterator it = set.begin();
+         it != set.end() && it + 1 != set.end();
+         ++it) {
+        if (it[1].first < it[0].first) {
+            return false;                                             // RETURN
+        }
+        if (it[1].first == it[0].first && it[1].second < it[0].second) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+//  bool veryVeryVerbose     = argc > 4;
+//  bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing Trades by Price
+///- - - - - - - - - - - - - - - - - -
+// Suppose a risk report receives, once per run, the prices of a day's trades,
+// and must then answer many queries about how many trades executed within a
+// given price range.
+//
+// First, we load the prices, which may repeat, in a single bulk insertion:
+//..
+    const double PRICES[]   = { 101.5, 100.0, 102.25, 100.0, 101.5, 100.0 };
+    const int    NUM_PRICES = sizeof PRICES / sizeof *PRICES;
+
+    bsl::flat_multiset<double> prices(PRICES, PRICES + NUM_PRICES);
+    ASSERT(6 == prices.size());
+//..
+// Then, we count the trades at a given price:
+//..
+    ASSERT(3 == prices.count(100.0));
+    ASSERT(0 == prices.count(100.5));
+//..
+// Finally, we count the trades in the price range '[100.5 .. 102.0)':
+//..
+    ASSERT(2 == bsl::distance(prices.lower_bound(100.5),
+                              prices.lower_bound(102.0)));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP AND FREE OPERATORS
+        //
+        // Concerns:
+        //: 1 'count', 'find', 'lower_bound', 'upper_bound', and 'equal_range'
+        //:   agree with the corresponding methods of 'std::multiset'.
+        //:
+        //: 2 'find' returns the first of a run of equivalent keys.
+        //:
+        //: 3 The free operators compare as those of 'std::multiset' do.
+        //
+        // Plan:
+        //: 1 Look up every key in and around a multiset of pseudo-random keys
+        //:   having many duplicates, and compare with 'std::multiset'.
+        //:   (C-1..2)
+        //:
+        //: 2 For every pair of small multisets of keys in '{0, 1}', compare
+        //:   the results of each operator with those of 'std::multiset'.
+        //:   (C-3)
+        //
+        // Testing:
+        //   const_iterator find(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   bool operator==(const flat_multiset&, const flat_multiset&);
+        //   bool operator!=(const flat_multiset&, const flat_multiset&);
+        //   bool operator< (const flat_multiset&, const flat_multiset&);
+        //   bool operator> (const flat_multiset&, const flat_multiset&);
+        //   bool operator<=(const flat_multiset&, const flat_multiset&);
+        //   bool operator>=(const flat_multiset&, const flat_multiset&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP AND FREE OPERATORS"
+                            "\n=========================\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        if (verbose) printf("\tLookup.\n");
+        {
+            unsigned int       state = 13;
+            IntSet             mX(&sa);  const IntSet& X = mX;
+            std::multiset<int> reference;
+
+            for (int i = 0; i < 400; ++i) {
+                const int key = static_cast<int>(nextRandom(&state) % 50) * 2;
+                mX.insert(key);
+                reference.insert(key);
+            }
+            ASSERT(isEqual(X, reference));
+
+            for (int key = -1; key <= 100; ++key) {
+                typedef IntSet::const_iterator Iter;
+
+                const std::ptrdiff_t lower = std::distance(
+                                                 reference.begin(),
+                                                 reference.lower_bound(key));
+                const std::ptrdiff_t upper = std::distance(
+                                                 reference.begin(),
+                                                 reference.upper_bound(key));
+
+                ASSERTV(key, lower == X.lower_bound(key) - X.begin());
+                ASSERTV(key, upper == X.upper_bound(key) - X.begin());
+                ASSERTV(key, reference.count(key) == X.count(key));
+
+                Iter it = X.find(key);
+                ASSERTV(key, lower == upper ? X.end() == it
+                                            : X.begin() + lower == it);
+
+                bsl::pair<Iter, Iter> range = X.equal_range(key);
+                ASSERTV(key, lower == range.first  - X.begin());
+                ASSERTV(key, upper == range.second - X.begin());
+            }
+        }
+
+        if (verbose) printf("\tFree operators.\n");
+        {
+            for (int i = 0; i < 16; ++i) {
+                for (int j = 0; j < 16; ++j) {
+                    // The low two bits of 'i' are the number of 0s, and the
+                    // high two bits the number of 1s, in the first multiset;
+                    // likewise for 'j' and the second multiset.
+
+                    IntSet             mX(&sa);
+                    IntSet             mY(&sa);
+                    std::multiset<int> rX;
+                    std::multiset<int> rY;
+
+                    for (int k = 0; k < (i & 3); ++k) {
+                        mX.insert(0);
+                        rX.insert(0);
+                    }
+                    for (int k = 0; k < (i >> 2); ++k) {
+                        mX.insert(1);
+                        rX.insert(1);
+                    }
+                    for (int k = 0; k < (j & 3); ++k) {
+                        mY.insert(0);
+                        rY.insert(0);
+                    }
+                    for (int k = 0; k < (j >> 2); ++k) {
+                        mY.insert(1);
+                        rY.insert(1);
+                    }
+                    const IntSet& X = mX;
+                    const IntSet& Y = mY;
+
+                    ASSERTV(i, j, (rX == rY) == (X == Y));
+                    ASSERTV(i, j, (rX != rY) == (X != Y));
+                    ASSERTV(i, j, (rX <  rY) == (X <  Y));
+                    ASSERTV(i, j, (rX >  rY) == (X >  Y));
+                    ASSERTV(i, j, (rX <= rY) == (X <= Y));
+                    ASSERTV(i, j, (rX >= rY) == (X >= Y));
+                }
+            }
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS
+        //
+        // Concerns:
+        //: 1 Each manipulator leaves the multiset with the same keys as the
+        //:   corresponding manipulator of 'std::multiset'.
+        //:
+        //: 2 'insert', 'emplace', and the range 'insert' place a key after
+        //:   the equivalent keys already present, and the range 'insert'
+        //:   keeps the equivalent keys of the range in their order.
+        //:
+        //: 3 No memory is taken from the default allocator.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of manipulators to a
+        //:   'flat_multiset' and to a 'std::multiset', and compare them after
+        //:   each step.  (C-1, 3)
+        //:
+        //: 2 Insert 'Element' values, tagged with sequence numbers, with each
+        //:   manipulator, and verify that the multiset is stably sorted.
+        //:   (C-2)
+        //
+        // Testing:
+        //   iterator insert(const value_type&);
+        //   iterator insert(const_iterator, const value_type&);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   iterator emplace(ARGS&&...);
+        //   iterator emplace_hint(const_iterator, ARGS&&...);
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATORS"
+                            "\n============\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        if (verbose) printf("\tAgainst 'std::multiset'.\n");
+        {
+            unsigned int       state = 17;
+            IntSet             mX(&sa);  const IntSet& X = mX;
+            std::multiset<int> reference;
+
+            for (int i = 0; i < 2000; ++i) {
+                const int key = static_cast<int>(nextRandom(&state) % 100);
+
+                switch (nextRandom(&state) % 7) {
+                  case 0: {
+                    reference.insert(key);
+
+                    IntSet::iterator it = mX.insert(key);
+                    ASSERTV(i, key, key == *it);
+                    ASSERTV(i, key, it + 1 == X.upper_bound(key));
+                  } break;
+                  case 1: {
+                    reference.insert(key);
+
+                    IntSet::const_iterator hint = X.begin()
+                                     + nextRandom(&state) % (X.size() + 1);
+                    ASSERTV(i, key, key == *mX.insert(hint, key));
+                  } break;
+                  case 2: {
+                    int batch[16];
+                    for (int j = 0; j < 16; ++j) {
+                        batch[j] = static_cast<int>(nextRandom(&state) % 100);
+                    }
+                    reference.insert(batch, batch + 16);
+                    mX.insert(batch, batch + 16);
+                  } break;
+                  case 3: {
+                    std::multiset<int> batch;
+                    for (int j = 0; j < 16; ++j) {
+                        batch.insert(static_cast<int>(
+                                                  nextRandom(&state) % 100));
+                    }
+                    reference.insert(batch.begin(), batch.end());
+                    mX.insert(bsl::sorted_equivalent,
+                              batch.begin(),
+                              batch.end());
+                  } break;
+                  case 4: {
+                    ASSERTV(i, key, reference.erase(key) == mX.erase(key));
+                  } break;
+                  case 5: {
+                    if (!X.empty()) {
+                        const IntSet::size_type index =
+                                              nextRandom(&state) % X.size();
+
+                        reference.erase(reference.find(X.begin()[index]));
+                        mX.erase(X.begin() + index);
+                    }
+                  } break;
+                  default: {
+                    if (!X.empty()) {
+                        const IntSet::size_type first =
+                                              nextRandom(&state) % X.size();
+                        const IntSet::size_type last  = first
+                                   + nextRandom(&state) % (X.size() - first);
+
+                        std::multiset<int>::iterator rFirst =
+                                                            reference.begin();
+                        std::advance(rFirst, first);
+                        std::multiset<int>::iterator rLast = rFirst;
+                        std::advance(rLast, last - first);
+                        reference.erase(rFirst, rLast);
+
+                        mX.erase(X.begin() + first, X.begin() + last);
+                    }
+                  }
+                }
+                ASSERTV(i, isEqual(X, reference));
+            }
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+
+        if (verbose) printf("\tStability of equivalent keys.\n");
+        {
+            unsigned int state    = 19;
+            int          sequence = 0;
+
+            ElementSet mX(&sa);  const ElementSet& X = mX;
+
+            for (int i = 0; i < 300; ++i) {
+                const int key = static_cast<int>(nextRandom(&state) % 10);
+
+                switch (i % 4) {
+                  case 0: {
+                    mX.insert(Element(key, sequence++));
+                  } break;
+                  case 1: {
+                    Element batch[5];
+                    for (int j = 0; j < 5; ++j) {
+                        batch[j] = Element(static_cast<int>(
+                                                   nextRandom(&state) % 10),
+                                           sequence++);
+                    }
+                    mX.insert(batch, batch + 5);
+                  } break;
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+                  case 2: {
+                    mX.emplace(key, sequence++);
+                  } break;
+#endif
+                  default: {
+                    mX.insert(X.end(), Element(key, sequence++));
+                  }
+                }
+                ASSERTV(i, isStablySorted(X));
+            }
+            ASSERTV(sequence, X.size(),
+                    static_cast<ElementSet::size_type>(sequence) == X.size());
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        //: 1 Each constructor installs the supplied allocator, or the default
+        //:   allocator if none is supplied, and supplies it to the keys.
+        //:
+        //: 2 The range constructors keep every key, including duplicates.
+        //:
+        //: 3 Moving between multisets having the same allocator does not
+        //:   allocate.
+        //:
+        //: 4 Copy assignment copies the keys, but not the allocator, and
+        //:   'swap' exchanges the keys of two multisets.
+        //
+        // Plan:
+        //: 1 Construct, assign, and swap multisets of long strings, and
+        //:   verify their keys and allocators, and the allocation performed.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   flat_multiset();
+        //   flat_multiset(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_multiset(const ALLOCATOR&);
+        //   flat_multiset(const flat_multiset&);
+        //   flat_multiset(MovableRef<flat_multiset>);
+        //   flat_multiset(const flat_multiset&, const ALLOCATOR&);
+        //   flat_multiset(MovableRef<flat_multiset>, const ALLOCATOR&);
+        //   flat_multiset(INPUT_ITERATOR, INPUT_ITERATOR, const C&, const A&);
+        //   flat_multiset(sorted_equivalent_t, INPUT_ITERATOR, ...);
+        //   flat_multiset(initializer_list<KEY>, const C&, const A&);
+        //   flat_multiset& operator=(const flat_multiset&);
+        //   flat_multiset& operator=(MovableRef<flat_multiset>);
+        //   void swap(flat_multiset&);
+        //   void swap(flat_multiset&, flat_multiset&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, ASSIGNMENT, AND SWAP"
+                            "\n==============================\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+        bslma::TestAllocator oa("other",    veryVerbose);
+
+        if (verbose) printf("\tRange constructors.\n");
+        {
+            const int DATA[]   = { 5, 1, 4, 1, 5, 9, 2, 6, 5, 3 };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            IntSet mX(DATA, DATA + NUM_DATA, std::less<int>(), &sa);
+            const IntSet& X = mX;
+
+            ASSERTV(X.size(), 10 == X.size());
+            ASSERT(isEqual(X, std::multiset<int>(DATA, DATA + NUM_DATA)));
+            ASSERT(&sa == X.get_allocator().mechanism());
+
+            const int SORTED[] = { 1, 1, 2, 3, 4, 5, 5, 5, 6, 9 };
+
+            IntSet mY(bsl::sorted_equivalent, SORTED, SORTED + 10, &sa);
+            ASSERT(X == mY);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            IntSet mZ({ 9, 6, 5, 5, 5, 4, 3, 2, 1, 1 }, std::less<int>(), &sa);
+            ASSERT(X == mZ);
+#endif
+        }
+
+        if (verbose) printf("\tCopy, move, and assignment.\n");
+        {
+            StringSet mX(&sa);  const StringSet& X = mX;
+            for (int i = 0; i < 10; ++i) {
+                bsl::string key(LONG_STRING, &sa);
+                key.push_back(static_cast<char>('a' + i % 3));
+                mX.insert(key);
+            }
+            ASSERT(10 == X.size());
+
+            StringSet mC(X);
+            ASSERT(X == mC);
+            ASSERT(&defaultAllocator == mC.get_allocator().mechanism());
+
+            StringSet mY(X, &sa);  const StringSet& Y = mY;
+            ASSERT(X == Y);
+
+            const bsls::Types::Int64 NUM_BLOCKS = sa.numBlocksTotal();
+
+            StringSet mZ(MoveUtil::move(mY));
+            ASSERT(X == mZ);
+            ASSERT(NUM_BLOCKS == sa.numBlocksTotal());
+
+            StringSet mW(MoveUtil::move(mZ), &oa);
+            ASSERT(X == mW);
+            ASSERT(&oa == mW.begin()->get_allocator().mechanism());
+
+            StringSet mV(&oa);
+            mV = X;
+            ASSERT(X == mV);
+            ASSERT(&oa == mV.get_allocator().mechanism());
+            ASSERT(&oa == mV.begin()->get_allocator().mechanism());
+
+            StringSet mU(&sa);  const StringSet& U = mU;
+            mU.insert(bsl::string("u", &sa));
+            mU.swap(mV);
+            ASSERT(X == U);
+            ASSERT(1 == mV.size());
+
+            swap(mU, mV);
+            ASSERT(1 == U.size());
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        IntSet mX(&sa);  const IntSet& X = mX;
+        ASSERT(X.empty());
+
+        mX.insert(2);
+        mX.insert(1);
+        mX.insert(2);
+        ASSERT(3 == X.size());
+        ASSERT(2 == X.count(2));
+        ASSERT(1 == *X.begin());
+
+        ASSERT(2 == mX.erase(2));
+        ASSERT(1 == X.size());
+
+        mX.clear();
+        ASSERT(X.empty());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,908 @@
+// bslstl_flatset.t.cpp                                               -*-C++-*-
+#include <bslstl_flatset.h>
+
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+
+#include <algorithm>
+#include <functional>
+#include <set>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test defines a container adapter, 'bsl::flat_set', that
+// forwards to 'bslstl::FlatTree', which is tested thoroughly in its own
+// component.  This test driver therefore concentrates on the forwarding
+// itself: that each constructor installs the intended comparator and
+// allocator, that the manipulators agree with 'std::set' on pseudo-random
+// input, that lookups with a transparent comparator do not create temporary
+// keys, and that the free operators compare as 'bsl::set' does.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_set();
+// [ 2] flat_set(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_set(const ALLOCATOR&);
+// [ 2] flat_set(const flat_set&);
+// [ 2] flat_set(MovableRef<flat_set>);
+// [ 2] flat_set(const flat_set&, const ALLOCATOR&);
+// [ 2] flat_set(MovableRef<flat_set>, const ALLOCATOR&);
+// [ 2] flat_set(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, const A&);
+// [ 2] flat_set(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+// [ 2] flat_set(initializer_list<KEY>, const COMPARATOR&, const A&);
+//
+// MANIPULATORS
+// [ 5] flat_set& operator=(const flat_set&);
+// [ 5] flat_set& operator=(MovableRef<flat_set>);
+// [ 3] pair<iterator, bool> insert(const value_type&);
+// [ 3] iterator insert(const_iterator, const value_type&);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] pair<iterator, bool> emplace(ARGS&&...);
+// [ 3] iterator emplace_hint(const_iterator, ARGS&&...);
+// [ 3] iterator erase(const_iterator);
+// [ 3] size_type erase(const key_type&);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 5] void swap(flat_set&);
+// [ 3] void clear();
+// [ 3] void reserve(size_type);
+// [ 3] void shrink_to_fit();
+//
+// ACCESSORS
+// [ 4] const_iterator find(const key_type&) const;
+// [ 4] const_iterator find(const LOOKUP_KEY&) const;
+// [ 4] size_type count(const key_type&) const;
+// [ 4] size_type count(const LOOKUP_KEY&) const;
+// [ 4] const_iterator lower_bound(const key_type&) const;
+// [ 4] const_iterator upper_bound(const key_type&) const;
+// [ 4] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 3] const container_type& keys() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const flat_set&, const flat_set&);
+// [ 5] bool operator!=(const flat_set&, const flat_set&);
+// [ 5] bool operator< (const flat_set&, const flat_set&);
+// [ 5] bool operator> (const flat_set&, const flat_set&);
+// [ 5] bool operator<=(const flat_set&, const flat_set&);
+// [ 5] bool operator>=(const flat_set&, const flat_set&);
+// [ 5] void swap(flat_set&, flat_set&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslmf::MovableRefUtil         MoveUtil;
+
+typedef bsl::flat_set<int>            IntSet;
+typedef bsl::flat_set<bsl::string>    StringSet;
+
+static const char *const LONG_STRING =
+                             "a string long enough to require an allocation";
+
+//=============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+                           // ======================
+                           // struct TransparentLess
+                           // ======================
+
+struct TransparentLess {
+    // This 'struct' is a transparent comparator that orders any two values
+    // using 'operator<', and counts the number of its invocations.
+
+    // PUBLIC TYPES
+    typedef void is_transparent;
+
+    // CLASS DATA
+    static int s_numCalls;
+
+    // ACCESSORS
+    template <class LHS, class RHS>
+    bool operator()(const LHS& lhs, const RHS& rhs) const
+        // Return 'lhs < rhs'.
+    {
+        ++s_numCalls;
+        return lhs < rhs;
+    }
+};
+
+int TransparentLess::s_numCalls = 0;
+
+                           // ==================
+                           // struct GreaterThan
+                           // ==================
+
+struct GreaterThan {
+    // This 'struct' is a stateful comparator that orders integers in
+    // decreasing order, and carries an identifier to verify that it is
+    // propagated.
+
+    // DATA
+    int d_id;
+
+    // CREATORS
+    explicit GreaterThan(int id = 0)
+        // Create a comparator having the optionally specified 'id'.
+    : d_id(id)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'lhs > rhs'.
+    {
+        return lhs > rhs;
+    }
+};
+
+//=============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified linear-congruential generator 'state', and return
+    // its new value, scaled to the range '[0 .. 2^15)'.
+{
+    *state = *state * 1103515245 + 12345;
+    return (*state >> 16) & 0x7fff;
+}
+
+bool isEqual(const IntSet& set, const std::set<int>& reference)
+    // Return 'true' if the specified 'set' has the same sequence of keys as
+    // the specified 'reference', and 'false' otherwise.
+{
+    return set.size() == reference.size()
+        && std::equal(set.begin(), set.end(), reference.begin());
+}
+
+bool allocatesFrom(const StringSet& set, bslma::Allocator *allocator)
+    // Return 'true' if the specified 'set', and each of its keys, uses the
+    // specified 'allocator', and 'false' otherwise.
+{
+    if (set.get_allocator().mechanism() != allocator) {
+        return false;                                                 // RETURN
+    }
+    for (StringSet::const_iterator it = set.begin(); it != set.end(); ++it) {
+        if (it->get_allocator().mechanism() != allocator) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+//  bool veryVeryVerbose     = argc > 4;
+//  bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Table of Holidays
+/// - - - - - - - - - - - - - - -
+// Suppose a scheduling service loads a list of holidays at start-up, and then
+// must determine, many times per second, whether a given day is a holiday.
+// The days are represented as serial numbers.
+//
+// First, we load the holidays, which arrive sorted, into a 'flat_set' in a
+// single pass, using 'bsl::sorted_unique' to indicate that no sorting is
+// needed:
+//..
+    const int HOLIDAYS[]   = { 17532, 17546, 17581, 17679, 17714, 17777 };
+    const int NUM_HOLIDAYS = sizeof HOLIDAYS / sizeof *HOLIDAYS;
+
+    bsl::flat_set<int> holidays(bsl::sorted_unique,
+                                HOLIDAYS,
+                                HOLIDAYS + NUM_HOLIDAYS);
+    ASSERT(6 == holidays.size());
+//..
+// Then, we query the table:
+//..
+    ASSERT( holidays.count(17581));
+    ASSERT(!holidays.count(17582));
+//..
+// Next, a late update adds a holiday, and repeats one that is already
+// present:
+//..
+    const int UPDATE[] = { 17777, 17600 };
+
+    holidays.insert(UPDATE, UPDATE + 2);
+    ASSERT(7 == holidays.size());
+//..
+// Finally, we find the first holiday on or after a given day:
+//..
+    bsl::flat_set<int>::const_iterator next = holidays.lower_bound(17582);
+    ASSERT(17600 == *next);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ASSIGNMENT, SWAP, AND FREE OPERATORS
+        //
+        // Concerns:
+        //: 1 Copy assignment copies the keys, but not the allocator.
+        //:
+        //: 2 Move assignment between sets having the same allocator does not
+        //:   allocate; otherwise it copies the keys into memory from the
+        //:   allocator of the target.
+        //:
+        //: 3 The member and free 'swap' exchange the keys of two sets.
+        //:
+        //: 4 The equality operators compare the sequences of keys, and the
+        //:   relational operators compare them lexicographically, as the
+        //:   corresponding operators of 'std::set' do.
+        //
+        // Plan:
+        //: 1 Assign, move, and swap sets of long strings, and verify the
+        //:   allocators of the resulting sets and their keys.  (C-1..3)
+        //:
+        //: 2 For every pair of a set of small subsets of '{0, 1, 2}',
+        //:   compare the results of each operator with those of 'std::set'.
+        //:   (C-4)
+        //
+        // Testing:
+        //   flat_set& operator=(const flat_set&);
+        //   flat_set& operator=(MovableRef<flat_set>);
+        //   void swap(flat_set&);
+        //   bool operator==(const flat_set&, const flat_set&);
+        //   bool operator!=(const flat_set&, const flat_set&);
+        //   bool operator< (const flat_set&, const flat_set&);
+        //   bool operator> (const flat_set&, const flat_set&);
+        //   bool operator<=(const flat_set&, const flat_set&);
+        //   bool operator>=(const flat_set&, const flat_set&);
+        //   void swap(flat_set&, flat_set&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nASSIGNMENT, SWAP, AND FREE OPERATORS"
+                            "\n====================================\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+        bslma::TestAllocator oa("other",    veryVerbose);
+
+        if (verbose) printf("\tAssignment and swap.\n");
+        {
+            StringSet mX(&sa);  const StringSet& X = mX;
+            for (char c = 'a'; c < 'k'; ++c) {
+                bsl::string key(LONG_STRING, &sa);
+                key.push_back(c);
+                mX.insert(key);
+            }
+
+            StringSet mY(&oa);  const StringSet& Y = mY;
+            mY = X;
+            ASSERT(X == Y);
+            ASSERT(allocatesFrom(Y, &oa));
+
+            StringSet mZ(X, &sa);  const StringSet& Z = mZ;
+            StringSet mW(&sa);     const StringSet& W = mW;
+
+            const bsls::Types::Int64 NUM_BLOCKS = sa.numBlocksTotal();
+            mW = MoveUtil::move(mZ);
+            ASSERTV(sa.numBlocksTotal() - NUM_BLOCKS,
+                    NUM_BLOCKS == sa.numBlocksTotal());
+            ASSERT(X == W);
+
+            mY = MoveUtil::move(mW);
+            ASSERT(X == Y);
+            ASSERT(allocatesFrom(Y, &oa));
+
+            mZ.clear();
+            mW.clear();
+            mZ.insert(bsl::string("z", &sa));
+            mZ.swap(mW);
+            ASSERT(1 == W.size());
+            ASSERT(Z.empty());
+
+            swap(mZ, mW);
+            ASSERT(1 == Z.size());
+            ASSERT(W.empty());
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tFree operators.\n");
+        {
+            for (int i = 0; i < 27; ++i) {
+                for (int j = 0; j < 27; ++j) {
+                    // Digit 'k' of 'i' in base 3 selects whether 'k' is
+                    // absent, present, or present and then erased, so that
+                    // sets of equal value may have different histories.
+
+                    IntSet        mX(&sa);
+                    IntSet        mY(&sa);
+                    std::set<int> rX;
+                    std::set<int> rY;
+
+                    for (int k = 0, di = i, dj = j; k < 3; ++k) {
+                        if (1 == di % 3) {
+                            mX.insert(k);
+                            rX.insert(k);
+                        }
+                        if (1 == dj % 3) {
+                            mY.insert(k);
+                            rY.insert(k);
+                        }
+                        di /= 3;
+                        dj /= 3;
+                    }
+                    const IntSet& X = mX;
+                    const IntSet& Y = mY;
+
+                    ASSERTV(i, j, (rX == rY) == (X == Y));
+                    ASSERTV(i, j, (rX != rY) == (X != Y));
+                    ASSERTV(i, j, (rX <  rY) == (X <  Y));
+                    ASSERTV(i, j, (rX >  rY) == (X >  Y));
+                    ASSERTV(i, j, (rX <= rY) == (X <= Y));
+                    ASSERTV(i, j, (rX >= rY) == (X >= Y));
+                }
+            }
+        }
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        //
+        // Concerns:
+        //: 1 'find', 'count', 'lower_bound', 'upper_bound', and
+        //:   'equal_range' agree with the corresponding methods of
+        //:   'std::set'.
+        //:
+        //: 2 With a transparent comparator, the 'LOOKUP_KEY' overloads
+        //:   compare the supplied key directly, without converting it to
+        //:   'key_type'.
+        //:
+        //: 3 'find' performs no more than 'ceil(log2(n + 1)) + 2'
+        //:   comparisons: those of the binary search, and one to test the
+        //:   equivalence of the key found.
+        //
+        // Plan:
+        //: 1 Look up every key in and around a set of pseudo-random keys, and
+        //:   compare with 'std::set'.  (C-1)
+        //:
+        //: 2 Look up 'const char *' keys in a set of strings having a
+        //:   transparent comparator, and verify that the default allocator is
+        //:   not used.  (C-2)
+        //:
+        //: 3 Count the comparisons made by the transparent comparator.  (C-3)
+        //
+        // Testing:
+        //   const_iterator find(const key_type&) const;
+        //   const_iterator find(const LOOKUP_KEY&) const;
+        //   size_type count(const key_type&) const;
+        //   size_type count(const LOOKUP_KEY&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        if (verbose) printf("\tAgainst 'std::set'.\n");
+        {
+            unsigned int  state = 11;
+            IntSet        mX(&sa);  const IntSet& X = mX;
+            std::set<int> reference;
+
+            for (int i = 0; i < 200; ++i) {
+                const int key = static_cast<int>(nextRandom(&state) % 500) * 2;
+                mX.insert(key);
+                reference.insert(key);
+            }
+            ASSERT(isEqual(X, reference));
+
+            for (int key = -1; key <= 1000; ++key) {
+                const std::ptrdiff_t lower = std::distance(
+                                                 reference.begin(),
+                                                 reference.lower_bound(key));
+                const std::ptrdiff_t upper = std::distance(
+                                                 reference.begin(),
+                                                 reference.upper_bound(key));
+
+                ASSERTV(key, lower == X.lower_bound(key) - X.begin());
+                ASSERTV(key, upper == X.upper_bound(key) - X.begin());
+                ASSERTV(key, reference.count(key) == X.count(key));
+                ASSERTV(key, (lower != upper) == (X.find(key) != X.end()));
+
+                typedef IntSet::const_iterator Iter;
+
+                bsl::pair<Iter, Iter> range = X.equal_range(key);
+                ASSERTV(key, lower == range.first  - X.begin());
+                ASSERTV(key, upper == range.second - X.begin());
+            }
+        }
+
+        if (verbose) printf("\tTransparent comparator.\n");
+        {
+            typedef bsl::flat_set<bsl::string, TransparentLess> Set;
+
+            const char *const NAMES[] = { "ADA", "BASIC", "C", "COBOL",
+                                          "FORTRAN", "LISP", "PASCAL" };
+            const int NUM_NAMES = sizeof NAMES / sizeof *NAMES;
+
+            Set mX(&sa);  const Set& X = mX;
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                mX.insert(bsl::string(NAMES[i], &sa));
+            }
+
+            const bsls::Types::Int64 NUM_DEFAULT =
+                                             defaultAllocator.numBlocksTotal();
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                TransparentLess::s_numCalls = 0;
+
+                ASSERTV(i, X.find(NAMES[i]) == X.begin() + i);
+                ASSERTV(i, TransparentLess::s_numCalls,
+                        TransparentLess::s_numCalls <= 5);
+
+                ASSERTV(i, 1 == X.count(NAMES[i]));
+                ASSERTV(i, X.lower_bound(NAMES[i]) == X.begin() + i);
+                ASSERTV(i, X.upper_bound(NAMES[i]) == X.begin() + i + 1);
+                ASSERTV(i, 1 == X.equal_range(NAMES[i]).second
+                              - X.equal_range(NAMES[i]).first);
+            }
+            ASSERT(X.end() == X.find("JAVA"));
+            ASSERT(0       == X.count("JAVA"));
+
+            ASSERTV(NUM_DEFAULT == defaultAllocator.numBlocksTotal());
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS
+        //
+        // Concerns:
+        //: 1 Each manipulator leaves the set with the same keys as the
+        //:   corresponding manipulator of 'std::set'.
+        //:
+        //: 2 'insert' and 'emplace' report whether a key was inserted, and
+        //:   return an iterator to the key equivalent to the one supplied.
+        //:
+        //: 3 'reserve' and 'shrink_to_fit' change the capacity, but not the
+        //:   keys.
+        //:
+        //: 4 No memory is taken from the default allocator.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of manipulators to a 'flat_set'
+        //:   and to a 'std::set', and compare them after each step.  (C-1..2)
+        //:
+        //: 2 Exercise 'reserve', 'shrink_to_fit', and 'clear', and verify
+        //:   'capacity'.  (C-3)
+        //:
+        //: 3 Verify that the default allocator was not used.  (C-4)
+        //
+        // Testing:
+        //   pair<iterator, bool> insert(const value_type&);
+        //   iterator insert(const_iterator, const value_type&);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   pair<iterator, bool> emplace(ARGS&&...);
+        //   iterator emplace_hint(const_iterator, ARGS&&...);
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   void clear();
+        //   void reserve(size_type);
+        //   void shrink_to_fit();
+        //   const container_type& keys() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATORS"
+                            "\n============\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        unsigned int  state = 5;
+        IntSet        mX(&sa);  const IntSet& X = mX;
+        std::set<int> reference;
+
+        for (int i = 0; i < 2000; ++i) {
+            const int key = static_cast<int>(nextRandom(&state) % 300);
+
+            switch (nextRandom(&state) % 8) {
+              case 0: {
+                const bool isNew = reference.insert(key).second;
+
+                bsl::pair<IntSet::iterator, bool> result = mX.insert(key);
+                ASSERTV(i, key, isNew == result.second);
+                ASSERTV(i, key, key   == *result.first);
+              } break;
+              case 1: {
+                reference.insert(key);
+
+                IntSet::const_iterator hint = X.begin()
+                                 + nextRandom(&state) % (X.size() + 1);
+                IntSet::iterator it = mX.insert(hint, key);
+                ASSERTV(i, key, key == *it);
+              } break;
+              case 2: {
+                int batch[16];
+                for (int j = 0; j < 16; ++j) {
+                    batch[j] = static_cast<int>(nextRandom(&state) % 300);
+                }
+                reference.insert(batch, batch + 16);
+                mX.insert(batch, batch + 16);
+              } break;
+              case 3: {
+                std::set<int> batch;
+                for (int j = 0; j < 16; ++j) {
+                    batch.insert(static_cast<int>(nextRandom(&state) % 300));
+                }
+                reference.insert(batch.begin(), batch.end());
+                mX.insert(bsl::sorted_unique, batch.begin(), batch.end());
+              } break;
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+              case 4: {
+                const bool isNew = reference.insert(key).second;
+
+                bsl::pair<IntSet::iterator, bool> result = mX.emplace(key);
+                ASSERTV(i, key, isNew == result.second);
+                ASSERTV(i, key, key   == *result.first);
+
+                IntSet::iterator it = mX.emplace_hint(X.end(), key + 1);
+                reference.insert(key + 1);
+                ASSERTV(i, key, key + 1 == *it);
+              } break;
+#endif
+              case 5: {
+                ASSERTV(i, key, reference.erase(key) == mX.erase(key));
+              } break;
+              case 6: {
+                if (!X.empty()) {
+                    const IntSet::size_type index =
+                                              nextRandom(&state) % X.size();
+
+                    reference.erase(X.begin()[index]);
+                    IntSet::iterator it = mX.erase(X.begin() + index);
+                    ASSERTV(i, it == X.begin() + index);
+                }
+              } break;
+              default: {
+                if (!X.empty()) {
+                    const IntSet::size_type first =
+                                               nextRandom(&state) % X.size();
+                    const IntSet::size_type last  = first
+                                   + nextRandom(&state) % (X.size() - first);
+
+                    reference.erase(reference.lower_bound(X.begin()[first]),
+                                    reference.lower_bound(last < X.size()
+                                                         ? X.begin()[last]
+                                                         : 1000));
+                    mX.erase(X.begin() + first, X.begin() + last);
+                }
+              }
+            }
+            ASSERTV(i, isEqual(X, reference));
+            ASSERTV(i, X.keys().size() == X.size());
+        }
+
+        if (verbose) printf("\tCapacity.\n");
+        {
+            mX.clear();
+            ASSERT(X.empty());
+
+            mX.reserve(100);
+            ASSERTV(X.capacity(), 100 <= X.capacity());
+
+            mX.insert(1);
+            mX.insert(2);
+            mX.shrink_to_fit();
+            ASSERTV(X.capacity(), 2 == X.capacity());
+            ASSERT(2 == X.size());
+        }
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS
+        //
+        // Concerns:
+        //: 1 Each constructor installs the supplied comparator, or a
+        //:   default-constructed one.
+        //:
+        //: 2 Each constructor installs the supplied allocator, or the default
+        //:   allocator if none is supplied, and supplies it to the keys.
+        //:
+        //: 3 The copy constructor installs the allocator of the original.
+        //:
+        //: 4 The move constructor does not allocate.
+        //:
+        //: 5 The range constructors discard duplicate keys, keeping the first.
+        //
+        // Plan:
+        //: 1 Construct sets with each constructor, and verify their keys,
+        //:   comparators, and allocators, and the allocation performed.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   flat_set();
+        //   flat_set(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_set(const ALLOCATOR&);
+        //   flat_set(const flat_set&);
+        //   flat_set(MovableRef<flat_set>);
+        //   flat_set(const flat_set&, const ALLOCATOR&);
+        //   flat_set(MovableRef<flat_set>, const ALLOCATOR&);
+        //   flat_set(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, ...);
+        //   flat_set(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+        //   flat_set(initializer_list<KEY>, const COMPARATOR&, const A&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS"
+                            "\n========\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+        bslma::TestAllocator oa("other",    veryVerbose);
+
+        if (verbose) printf("\tDefault and value constructors.\n");
+        {
+            StringSet mX;
+            ASSERT(&defaultAllocator == mX.get_allocator().mechanism());
+            ASSERT(mX.empty());
+
+            StringSet mY(&sa);
+            ASSERT(&sa == mY.get_allocator().mechanism());
+
+            typedef bsl::flat_set<int, GreaterThan> GreaterSet;
+
+            GreaterSet mZ(GreaterThan(7), &sa);
+            ASSERT(7   == mZ.key_comp().d_id);
+            ASSERT(&sa == mZ.get_allocator().mechanism());
+            ASSERT(0   == sa.numBlocksTotal());
+
+            mZ.insert(1);
+            mZ.insert(3);
+            mZ.insert(2);
+            ASSERT(3 == *mZ.begin());
+            ASSERT(1 == *mZ.rbegin());
+        }
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\tRange constructors.\n");
+        {
+            const int DATA[]   = { 5, 1, 4, 1, 5, 9, 2, 6, 5, 3 };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            IntSet mX(DATA, DATA + NUM_DATA, std::less<int>(), &sa);
+            const IntSet& X = mX;
+
+            ASSERTV(X.size(), 7 == X.size());
+            ASSERT(isEqual(X, std::set<int>(DATA, DATA + NUM_DATA)));
+
+            const int SORTED[] = { 1, 2, 3, 4, 5, 6, 9 };
+
+            IntSet mY(bsl::sorted_unique, SORTED, SORTED + 7, &sa);
+            ASSERT(X == mY);
+            ASSERT(&sa == mY.get_allocator().mechanism());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            IntSet mZ({ 9, 6, 5, 4, 3, 2, 1, 1 }, std::less<int>(), &sa);
+            ASSERT(X == mZ);
+#endif
+        }
+
+        if (verbose) printf("\tCopy and move constructors.\n");
+        {
+            StringSet mX(&sa);  const StringSet& X = mX;
+            for (char c = 'a'; c < 'k'; ++c) {
+                bsl::string key(LONG_STRING, &sa);
+                key.push_back(c);
+                mX.insert(key);
+            }
+            ASSERT(allocatesFrom(X, &sa));
+
+            StringSet mC(X);
+            ASSERT(X == mC);
+            ASSERT(allocatesFrom(mC, &defaultAllocator));
+
+            StringSet mY(X, &sa);
+
+            StringSet mZ(X, &oa);
+            ASSERT(X == mZ);
+            ASSERT(allocatesFrom(mZ, &oa));
+
+            const bsls::Types::Int64 NUM_BLOCKS = sa.numBlocksTotal();
+
+            StringSet mW(MoveUtil::move(mY));
+            ASSERT(X == mW);
+            ASSERT(NUM_BLOCKS == sa.numBlocksTotal());
+
+            StringSet mV(MoveUtil::move(mW), &sa);
+            ASSERT(X == mV);
+            ASSERT(NUM_BLOCKS == sa.numBlocksTotal());
+
+            StringSet mU(MoveUtil::move(mV), &oa);
+            ASSERT(X == mU);
+            ASSERT(allocatesFrom(mU, &oa));
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        IntSet mX(&sa);  const IntSet& X = mX;
+        ASSERT(X.empty());
+
+        ASSERT( mX.insert(2).second);
+        ASSERT( mX.insert(1).second);
+        ASSERT(!mX.insert(2).second);
+        ASSERT(2 == X.size());
+        ASSERT(1 == *X.begin());
+        ASSERT(2 == *X.rbegin());
+
+        IntSet mY(X, &sa);  const IntSet& Y = mY;
+        ASSERT(X == Y);
+
+        ASSERT(1 == mY.erase(1));
+        ASSERT(X != Y);
+        ASSERT(X <  Y);
+
+        mX.clear();
+        ASSERT(X.empty());
+        ASSERT(X.end() == X.find(2));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1462 @@
+// bslstl_flattree.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATTREE
+#define INCLUDED_BSLSTL_FLATTREE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sorted-vector implementation for flat associations.
+//
+//@CLASSES:
+//  bslstl::FlatTree: sorted contiguous sequence of values, searchable by key
+//  bslstl::FlatTreeUtil: branch-free binary searches over sorted ranges
+//  bsl::sorted_unique_t: tag for input that is sorted, with unique keys
+//  bsl::sorted_equivalent_t: tag for input that is sorted
+//
+//@SEE_ALSO: bslstl_flatset, bslstl_flatmap, bslstl_vector
+//
+//@DESCRIPTION: This component provides a class template, 'bslstl::FlatTree',
+// that implements the common parts of the "flat" ordered associative
+// containers ('bsl::flat_set', 'bsl::flat_multiset', 'bsl::flat_map', and
+// 'bsl::flat_multimap'): a sequence of values held contiguously in a
+// 'bsl::vector', ordered by the keys of those values, and searched by binary
+// search.  In exchange for linear-time insertion and removal, a 'FlatTree'
+// offers lookups that touch one contiguous block of memory rather than
+// following a pointer per level of a balanced tree, no per-element allocation
+// (and so no per-element memory overhead), and iteration at the speed of
+// iterating over an array.  It is therefore well suited to associations that
+// are built once (or rarely modified) and then searched often.
+//
+// A 'FlatTree' is parameterized by a 'KEY_CONFIG' type that describes how a
+// key is obtained from a value (as for 'bslstl::HashTable', see
+// 'bslstl_unorderedsetkeyconfiguration' and
+// 'bslstl_unorderedmapkeyconfiguration'), a 'COMPARATOR' that orders keys,
+// and an 'ALLOCATOR' that is used by the underlying 'bsl::vector'.  Whether
+// keys must be unique is not a property of the class, but of the
+// manipulators used: the '...Unique' manipulators maintain unique keys, and
+// the '...Multi' manipulators allow equivalent keys (in insertion order).
+//
+// This component also provides the tag types 'bsl::sorted_unique_t' and
+// 'bsl::sorted_equivalent_t' (and the corresponding constants
+// 'bsl::sorted_unique' and 'bsl::sorted_equivalent'), which a client passes
+// to a flat container to assert that the range of values it supplies is
+// already sorted, so that the container need not sort it.
+//
+///Branch-Free Binary Search
+///-------------------------
+// 'FlatTreeUtil' provides 'lowerBound' and 'upperBound' functions that are
+// equivalent to 'std::lower_bound' and 'std::upper_bound', but whose loop
+// contains no data-dependent branch: each step halves the length of the range
+// and conditionally advances its start, a selection that compilers emit as a
+// conditional move.  The number of iterations depends only on the length of
+// the range, so that the loop is not subject to branch misprediction, which
+// dominates the cost of a conventional binary search over a range that fits
+// in the cache.
+//
+///Bulk Insertion
+///--------------
+// Inserting the values of a range one at a time would take time quadratic in
+// the size of the range.  Instead, 'insertRangeUnique' and 'insertRangeMulti'
+// append the entire range to the underlying vector, sort the appended values
+// (unless the caller states that they are already sorted), and then merge
+// the two sorted sequences, taking linear time in addition to that of the
+// sort.  The merge moves the values into a newly allocated vector, which then
+// replaces the original, so that it temporarily requires memory for a second
+// copy of the values.  When every appended value orders after the existing
+// values (e.g., when building a container from successive sorted batches), no
+// merge, and no second vector, is needed.
+//
+///Exception Safety
+///----------------
+// The single-value manipulators of 'FlatTree' provide the strong exception
+// safety guarantee unless an exception is thrown by the move constructor or
+// move-assignment operator of the value type.  The range manipulators provide
+// the basic guarantee: if an exception is thrown before the merge, only the
+// appended values are discarded, but if an exception is thrown during the
+// merge (by the comparator, or by the move constructor of the value type),
+// the tree is left empty.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Sorted Array
+///- - - - - - - - - - - - - - - - - -
+// Suppose we have a sorted array of integers, and want to determine the
+// number of values less than a given threshold.  We can use
+// 'bslstl::FlatTreeUtil::lowerBound' with a key configuration in which each
+// value is its own key:
+//..
+//  typedef bslstl::UnorderedSetKeyConfiguration<int> Config;
+//
+//  const int DATA[]   = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29 };
+//  const int NUM_DATA = sizeof DATA / sizeof *DATA;
+//
+//  const int *position = bslstl::FlatTreeUtil::lowerBound<Config>(
+//                                                           DATA,
+//                                                           DATA + NUM_DATA,
+//                                                           12,
+//                                                           std::less<int>());
+//  assert(5  == position - DATA);
+//  assert(13 == *position);
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_vector.h>
+
+#include <bslma_stdallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace bsl {
+
+                          // ======================
+                          // struct sorted_unique_t
+                          // ======================
+
+struct sorted_unique_t {
+    // This tag type is used to indicate to a flat ordered container that the
+    // range of values passed along with it is sorted according to the ordering
+    // of the container, and contains no two values having equivalent keys.
+};
+
+static const sorted_unique_t sorted_unique = { };
+    // Value of type 'sorted_unique_t' used as the actual argument to functions
+    // that take a 'sorted_unique_t' argument.
+
+                        // ==========================
+                        // struct sorted_equivalent_t
+                        // ==========================
+
+struct sorted_equivalent_t {
+    // This tag type is used to indicate to a flat ordered container that the
+    // range of values passed along with it is sorted according to the ordering
+    // of the container.
+};
+
+static const sorted_equivalent_t sorted_equivalent = { };
+    // Value of type 'sorted_equivalent_t' used as the actual argument to
+    // functions that take a 'sorted_equivalent_t' argument.
+
+}  // close namespace bsl
+
+namespace BloombergLP {
+namespace bslstl {
+
+                            // ===================
+                            // struct FlatTreeUtil
+                            // ===================
+
+struct FlatTreeUtil {
+    // This 'struct' provides a namespace for branch-free binary searches over
+    // sorted ranges of values whose keys are obtained using a 'KEY_CONFIG'
+    // type, as described in the component-level documentation.
+
+    // CLASS METHODS
+    template <class KEY_CONFIG,
+              class RANDOM_ITERATOR,
+              class LOOKUP_KEY,
+              class COMPARATOR>
+    static RANDOM_ITERATOR lowerBound(RANDOM_ITERATOR   first,
+                                      RANDOM_ITERATOR   last,
+                                      const LOOKUP_KEY& key,
+                                      const COMPARATOR& comparator);
+        // Return an iterator to the first value in the specified range
+        // '[first .. last)' whose key is not ordered before the specified
+        // 'key' by the specified 'comparator', and 'last' if there is no such
+        // value.  The key of a value 'v' is 'KEY_CONFIG::extractKey(v)'.  The
+        // behavior is undefined unless the range is sorted with respect to
+        // 'comparator'.
+
+    template <class KEY_CONFIG,
+              class RANDOM_ITERATOR,
+              class LOOKUP_KEY,
+              class COMPARATOR>
+    static RANDOM_ITERATOR upperBound(RANDOM_ITERATOR   first,
+                                      RANDOM_ITERATOR   last,
+                                      const LOOKUP_KEY& key,
+                                      const COMPARATOR& comparator);
+        // Return an iterator to the first value in the specified range
+        // '[first .. last)' whose key is ordered after the specified 'key' by
+        // the specified 'comparator', and 'last' if there is no such value.
+        // The key of a value 'v' is 'KEY_CONFIG::extractKey(v)'.  The
+        // behavior is undefined unless the range is sorted with respect to
+        // 'comparator'.
+};
+
+                       // ==============================
+                       // class FlatTree_ValueComparator
+                       // ==============================
+
+template <class KEY_CONFIG, class COMPARATOR>
+class FlatTree_ValueComparator {
+    // This component-private class adapts a 'COMPARATOR' ordering keys into a
+    // functor ordering the values from which 'KEY_CONFIG' extracts those keys.
+
+    // DATA
+    const COMPARATOR *d_comparator_p;  // key comparator (held, not owned)
+
+  public:
+    // CREATORS
+    explicit FlatTree_ValueComparator(const COMPARATOR& comparator);
+        // Create a value comparator adapting the specified 'comparator'.
+
+    //! FlatTree_ValueComparator(const FlatTree_ValueComparator&) = default;
+    //! ~FlatTree_ValueComparator() = default;
+
+    // MANIPULATORS
+    //! FlatTree_ValueComparator& operator=(
+    //!                          const FlatTree_ValueComparator&) = default;
+
+    // ACCESSORS
+    bool operator()(const typename KEY_CONFIG::ValueType& lhs,
+                    const typename KEY_CONFIG::ValueType& rhs) const;
+        // Return 'true' if the key of the specified 'lhs' is ordered before
+        // the key of the specified 'rhs', and 'false' otherwise.
+};
+
+                        // ===========================
+                        // class FlatTree_EraseProctor
+                        // ===========================
+
+template <class CONTAINER>
+class FlatTree_EraseProctor {
+    // This component-private class implements a proctor that, unless
+    // released, erases on its destruction the elements of a container from a
+    // given position to the end.
+
+    // PRIVATE TYPES
+    typedef typename CONTAINER::size_type SizeType;
+
+    // DATA
+    CONTAINER *d_container_p;  // guarded container (held, not owned)
+    SizeType   d_position;     // position of the first element to erase
+
+  private:
+    // NOT IMPLEMENTED
+    FlatTree_EraseProctor(const FlatTree_EraseProctor&);
+    FlatTree_EraseProctor& operator=(const FlatTree_EraseProctor&);
+
+  public:
+    // CREATORS
+    FlatTree_EraseProctor(CONTAINER *container, SizeType position);
+        // Create a proctor that guards the elements of the specified
+        // 'container' from the specified 'position' to the end.
+
+    ~FlatTree_EraseProctor();
+        // Erase the guarded elements, unless this proctor has been released.
+
+    // MANIPULATORS
+    void release();
+        // Release the guarded elements from management by this proctor.
+
+    void reset(SizeType position);
+        // Guard the elements of the container from the specified 'position'
+        // to the end.
+};
+
+                               // ==============
+                               // class FlatTree
+                               // ==============
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class FlatTree {
+    // This class template implements a sequence of values held contiguously
+    // in a 'bsl::vector', ordered by their keys (as extracted by
+    // 'KEY_CONFIG' and ordered by 'COMPARATOR'), and supplies the operations
+    // common to the flat ordered associative containers.  The
+    // '...Unique' manipulators must be used exclusively if keys are to be
+    // unique.  'COMPARATOR' must be invocable on 'const' objects.
+
+  public:
+    // PUBLIC TYPES
+    typedef typename KEY_CONFIG::KeyType              KeyType;
+        // This 'typedef' is an alias for the type of the keys.
+
+    typedef typename KEY_CONFIG::ValueType            ValueType;
+        // This 'typedef' is an alias for the type of the values.
+
+    typedef bsl::vector<ValueType, ALLOCATOR>         Container;
+        // This 'typedef' is an alias for the type of the underlying sequence.
+
+    typedef typename Container::size_type             SizeType;
+    typedef typename Container::iterator              Iterator;
+    typedef typename Container::const_iterator        ConstIterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef FlatTree_ValueComparator<KEY_CONFIG, COMPARATOR>
+                                                      ValueComparator;
+    typedef FlatTree_EraseProctor<Container>          EraseProctor;
+    typedef BloombergLP::bslmf::MovableRefUtil        MoveUtil;
+
+    // DATA
+    Container  d_values;      // values, sorted by key
+    COMPARATOR d_comparator;  // key comparator
+
+    // PRIVATE MANIPULATORS
+    Iterator toIterator(ConstIterator position);
+        // Return the modifiable iterator referring to the same value as the
+        // specified 'position'.
+
+    void mergeAppended(SizeType numOldValues, bool isUnique, bool isSorted);
+        // Restore the ordering of this tree after appending values to its
+        // container, where the specified 'numOldValues' is the number of
+        // values this tree held before appending.  If the specified 'isUnique'
+        // is 'true', discard each appended value having a key equivalent to
+        // that of another value, keeping the existing value or, among
+        // appended values, the first.  If the specified 'isSorted' is 'true',
+        // the appended values are already sorted (and, if 'isUnique', unique).
+        // Otherwise, appended values having equivalent keys keep their
+        // relative order, and follow existing values having equivalent keys.
+        // If an exception is thrown before the merge of the appended values
+        // with the existing values begins, the appended values are discarded;
+        // if one is thrown during that merge, this tree is left empty.
+
+    template <class INPUT_ITERATOR>
+    void insertRange(INPUT_ITERATOR first,
+                     INPUT_ITERATOR last,
+                     bool           isUnique,
+                     bool           isSorted);
+        // Insert the values in the specified range '[first .. last)' into
+        // this tree, as described by 'mergeAppended' for the specified
+        // 'isUnique' and 'isSorted'.
+
+  public:
+    // CREATORS
+    FlatTree(const COMPARATOR& comparator, const ALLOCATOR& basicAllocator);
+        // Create an empty tree that orders keys using a copy of the specified
+        // 'comparator', and uses the specified 'basicAllocator' to supply
+        // memory.
+
+    FlatTree(const FlatTree& original, const ALLOCATOR& basicAllocator);
+        // Create a tree having the same values and comparator as the
+        // specified 'original' tree, using the specified 'basicAllocator' to
+        // supply memory.
+
+    FlatTree(bslmf::MovableRef<FlatTree> original);                 // IMPLICIT
+        // Create a tree having the same values and comparator as the
+        // specified 'original' tree, by moving (in constant time) the values
+        // of 'original', and propagating its allocator.  'original' is left
+        // in a valid but unspecified state.
+
+    FlatTree(bslmf::MovableRef<FlatTree> original,
+             const ALLOCATOR&            basicAllocator);
+        // Create a tree having the same values and comparator as the
+        // specified 'original' tree, using the specified 'basicAllocator' to
+        // supply memory.  The values are moved (in constant time) if
+        // 'basicAllocator' equals the allocator of 'original', and are
+        // move-inserted otherwise.  'original' is left in a valid but
+        // unspecified state.
+
+    //! ~FlatTree() = default;
+
+    // MANIPULATORS
+    FlatTree& operator=(const FlatTree& rhs);
+        // Assign to this tree the values and comparator of the specified
+        // 'rhs' tree, and return a reference providing modifiable access to
+        // this tree.
+
+    FlatTree& operator=(bslmf::MovableRef<FlatTree> rhs);
+        // Assign to this tree the values and comparator of the specified
+        // 'rhs' tree, moving the values (in constant time) if the two trees
+        // use equal allocators, and return a reference providing modifiable
+        // access to this tree.  'rhs' is left in a valid but unspecified
+        // state.
+
+    Iterator begin();
+        // Return an iterator to the first value of this tree, or 'end()' if
+        // this tree is empty.
+
+    Iterator end();
+        // Return the past-the-end iterator of this tree.
+
+    Container& container();
+        // Return a reference providing modifiable access to the underlying
+        // sequence of this tree.  The behavior is undefined if the sequence
+        // is modified other than in a way that keeps it sorted (and, if keys
+        // are to be unique, free of equivalent keys).
+
+    template <class LOOKUP_KEY>
+    Iterator lowerBound(const LOOKUP_KEY& key);
+        // Return an iterator to the first value of this tree whose key is not
+        // ordered before the specified 'key', and 'end()' if there is no such
+        // value.
+
+    template <class LOOKUP_KEY>
+    Iterator upperBound(const LOOKUP_KEY& key);
+        // Return an iterator to the first value of this tree whose key is
+        // ordered after the specified 'key', and 'end()' if there is no such
+        // value.
+
+    template <class LOOKUP_KEY>
+    Iterator find(const LOOKUP_KEY& key);
+        // Return an iterator to the first value of this tree whose key is
+        // equivalent to the specified 'key', and 'end()' if there is no such
+        // value.
+
+    template <class LOOKUP_KEY>
+    bsl::pair<Iterator, Iterator> equalRange(const LOOKUP_KEY& key);
+        // Return the pair of iterators delimiting the values of this tree
+        // whose keys are equivalent to the specified 'key'.
+
+    bsl::pair<Iterator, bool> insertUnique(const ValueType& value);
+    bsl::pair<Iterator, bool> insertUnique(
+                                       bslmf::MovableRef<ValueType> value);
+        // Insert the specified 'value' into this tree, unless a value having
+        // an equivalent key is already present.  Return a pair whose 'first'
+        // member is an iterator to the inserted value or to the value that
+        // prevented the insertion, and whose 'second' member is 'true' if the
+        // value was inserted, and 'false' otherwise.
+
+    Iterator insertUnique(ConstIterator hint, const ValueType& value);
+    Iterator insertUnique(ConstIterator                hint,
+                          bslmf::MovableRef<ValueType> value);
+        // Insert the specified 'value' into this tree, unless a value having
+        // an equivalent key is already present, using the specified 'hint' as
+        // the position at which the value would be inserted.  Return an
+        // iterator to the inserted value or to the value that prevented the
+        // insertion.  If 'hint' is the correct position, no search is made.
+
+    Iterator insertMulti(const ValueType& value);
+    Iterator insertMulti(bslmf::MovableRef<ValueType> value);
+        // Insert the specified 'value' into this tree, after any values
+        // having an equivalent key, and return an iterator to the inserted
+        // value.
+
+    Iterator insertMulti(ConstIterator hint, const ValueType& value);
+    Iterator insertMulti(ConstIterator                hint,
+                         bslmf::MovableRef<ValueType> value);
+        // Insert the specified 'value' into this tree at the position closest
+        // to the specified 'hint' that keeps this tree sorted, and return an
+        // iterator to the inserted value.
+
+    template <class INPUT_ITERATOR>
+    void insertRangeUnique(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree each value in the specified range
+        // '[first .. last)' whose key is not equivalent to that of a value
+        // already in this tree, or to that of a preceding value in the range.
+        // If an exception is thrown while the values are merged, this tree is
+        // left empty (see {Exception Safety}).  The behavior is undefined
+        // unless the range does not refer to values of this tree.
+
+    template <class INPUT_ITERATOR>
+    void insertRangeMulti(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree the values in the specified range
+        // '[first .. last)'.  Values having equivalent keys follow the values
+        // already in this tree, in the order of the range.  If an exception is
+        // thrown while the values are merged, this tree is left empty (see
+        // {Exception Safety}).  The behavior is undefined unless the range
+        // does not refer to values of this tree.
+
+    template <class INPUT_ITERATOR>
+    void insertSortedRangeUnique(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree each value in the specified range
+        // '[first .. last)' whose key is not equivalent to that of a value
+        // already in this tree.  If an exception is thrown while the values
+        // are merged, this tree is left empty (see {Exception Safety}).  The
+        // behavior is undefined unless the range is sorted, contains no two
+        // values having equivalent keys, and does not refer to values of this
+        // tree.
+
+    template <class INPUT_ITERATOR>
+    void insertSortedRangeMulti(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree the values in the specified range
+        // '[first .. last)'.  Values having equivalent keys follow the values
+        // already in this tree, in the order of the range.  If an exception is
+        // thrown while the values are merged, this tree is left empty (see
+        // {Exception Safety}).  The behavior is undefined unless the range is
+        // sorted and does not refer to values of this tree.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    bsl::pair<Iterator, bool> emplaceUnique(ARGS&&... arguments);
+        // Insert into this tree a value constructed in place from the
+        // specified 'arguments', unless a value having an equivalent key is
+        // already present (in which case the constructed value is destroyed).
+        // Return a pair whose 'first' member is an iterator to the inserted
+        // value or to the value that prevented the insertion, and whose
+        // 'second' member is 'true' if the value was inserted, and 'false'
+        // otherwise.
+
+    template <class... ARGS>
+    Iterator emplaceMulti(ARGS&&... arguments);
+        // Insert into this tree a value constructed in place from the
+        // specified 'arguments', after any values having an equivalent key,
+        // and return an iterator to the inserted value.
+#endif
+
+    Iterator erase(ConstIterator position);
+        // Remove from this tree the value at the specified 'position', and
+        // return an iterator to the value that followed it.  The behavior is
+        // undefined unless 'position' refers to a value of this tree.
+
+    Iterator erase(ConstIterator first, ConstIterator last);
+        // Remove from this tree the values in the specified range
+        // '[first .. last)', and return 'last'.  The behavior is undefined
+        // unless '[first .. last)' is a valid range of this tree.
+
+    template <class LOOKUP_KEY>
+    SizeType eraseKey(const LOOKUP_KEY& key);
+        // Remove from this tree the values whose keys are equivalent to the
+        // specified 'key', and return the number of values removed.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all values from this tree, retaining its capacity.
+
+    void reserve(SizeType numValues);
+        // Ensure that this tree can hold the specified 'numValues' without
+        // reallocating.
+
+    void shrinkToFit();
+        // Reduce the capacity of this tree to its size, if possible.
+
+    void swap(FlatTree& other);
+        // Exchange the values and comparator of this tree with those of the
+        // specified 'other' tree, as 'bsl::vector::swap' exchanges values
+        // (i.e., in constant time unless the allocators differ and do not
+        // propagate on swap, in which case the values are copied).
+
+    // ACCESSORS
+    ConstIterator begin() const;
+        // Return an iterator to the first value of this tree, or 'end()' if
+        // this tree is empty.
+
+    ConstIterator end() const;
+        // Return the past-the-end iterator of this tree.
+
+    const Container& container() const;
+        // Return a reference providing non-modifiable access to the
+        // underlying sequence of this tree.
+
+    template <class LOOKUP_KEY>
+    ConstIterator lowerBound(const LOOKUP_KEY& key) const;
+        // Return an iterator to the first value of this tree whose key is not
+        // ordered before the specified 'key', and 'end()' if there is no such
+        // value.
+
+    template <class LOOKUP_KEY>
+    ConstIterator upperBound(const LOOKUP_KEY& key) const;
+        // Return an iterator to the first value of this tree whose key is
+        // ordered after the specified 'key', and 'end()' if there is no such
+        // value.
+
+    template <class LOOKUP_KEY>
+    ConstIterator find(const LOOKUP_KEY& key) const;
+        // Return an iterator to the first value of this tree whose key is
+        // equivalent to the specified 'key', and 'end()' if there is no such
+        // value.
+
+    template <class LOOKUP_KEY>
+    bsl::pair<ConstIterator, ConstIterator> equalRange(
+                                                 const LOOKUP_KEY& key) const;
+        // Return the pair of iterators delimiting the values of this tree
+        // whose keys are equivalent to the specified 'key'.
+
+    template <class LOOKUP_KEY>
+    SizeType count(const LOOKUP_KEY& key) const;
+        // Return the number of values of this tree whose keys are equivalent
+        // to the specified 'key'.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the key
+        // comparator of this tree.
+
+    ALLOCATOR allocator() const;
+        // Return (a copy of) the allocator used by this tree.
+
+    SizeType capacity() const;
+        // Return the number of values this tree can hold without
+        // reallocating.
+
+    bool empty() const;
+        // Return 'true' if this tree holds no values, and 'false' otherwise.
+
+    SizeType maxSize() const;
+        // Return a theoretical upper bound on the number of values this tree
+        // can hold.
+
+    SizeType size() const;
+        // Return the number of values held by this tree.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // struct FlatTreeUtil
+                            // -------------------
+
+// CLASS METHODS
+template <class KEY_CONFIG,
+          class RANDOM_ITERATOR,
+          class LOOKUP_KEY,
+          class COMPARATOR>
+RANDOM_ITERATOR FlatTreeUtil::lowerBound(RANDOM_ITERATOR   first,
+                                         RANDOM_ITERATOR   last,
+                                         const LOOKUP_KEY& key,
+                                         const COMPARATOR& comparator)
+{
+    // Invariant: the result is in '[first .. first + length]'.  Each step
+    // selects, without branching, the half of the range holding the result.
+
+    std::size_t length = last - first;
+    if (0 == length) {
+        return first;                                                 // RETURN
+    }
+
+    while (length > 1) {
+        const std::size_t half = length / 2;
+
+        first   = comparator(KEY_CONFIG::extractKey(first[half]), key)
+                ? first + half
+                : first;
+        length -= half;
+    }
+    return first + static_cast<std::size_t>(
+                          comparator(KEY_CONFIG::extractKey(*first), key));
+}
+
+template <class KEY_CONFIG,
+          class RANDOM_ITERATOR,
+          class LOOKUP_KEY,
+          class COMPARATOR>
+RANDOM_ITERATOR FlatTreeUtil::upperBound(RANDOM_ITERATOR   first,
+                                         RANDOM_ITERATOR   last,
+                                         const LOOKUP_KEY& key,
+                                         const COMPARATOR& comparator)
+{
+    std::size_t length = last - first;
+    if (0 == length) {
+        return first;                                                 // RETURN
+    }
+
+    while (length > 1) {
+        const std::size_t half = length / 2;
+
+        first   = comparator(key, KEY_CONFIG::extractKey(first[half]))
+                ? first
+                : first + half;
+        length -= half;
+    }
+    return first + static_cast<std::size_t>(
+                         !comparator(key, KEY_CONFIG::extractKey(*first)));
+}
+
+                       // ------------------------------
+                       // class FlatTree_ValueComparator
+                       // ------------------------------
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+FlatTree_ValueComparator<KEY_CONFIG, COMPARATOR>::FlatTree_ValueComparator(
+                                                 const COMPARATOR& comparator)
+: d_comparator_p(&comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+bool FlatTree_ValueComparator<KEY_CONFIG, COMPARATOR>::operator()(
+                          const typename KEY_CONFIG::ValueType& lhs,
+                          const typename KEY_CONFIG::ValueType& rhs) const
+{
+    return (*d_comparator_p)(KEY_CONFIG::extractKey(lhs),
+                             KEY_CONFIG::extractKey(rhs));
+}
+
+                        // ---------------------------
+                        // class FlatTree_EraseProctor
+                        // ---------------------------
+
+// CREATORS
+template <class CONTAINER>
+inline
+FlatTree_EraseProctor<CONTAINER>::FlatTree_EraseProctor(CONTAINER *container,
+                                                        SizeType   position)
+: d_container_p(container)
+, d_position(position)
+{
+}
+
+template <class CONTAINER>
+inline
+FlatTree_EraseProctor<CONTAINER>::~FlatTree_EraseProctor()
+{
+    if (d_container_p) {
+        d_container_p->erase(d_container_p->begin() + d_position,
+                             d_container_p->end());
+    }
+}
+
+// MANIPULATORS
+template <class CONTAINER>
+inline
+void FlatTree_EraseProctor<CONTAINER>::release()
+{
+    d_container_p = 0;
+}
+
+template <class CONTAINER>
+inline
+void FlatTree_EraseProctor<CONTAINER>::reset(SizeType position)
+{
+    d_position = position;
+}
+
+                               // --------------
+                               // class FlatTree
+                               // --------------
+
+// PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::toIterator(ConstIterator position)
+{
+    return d_values.begin() + (position - d_values.cbegin());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::mergeAppended(
+                                                        SizeType numOldValues,
+                                                        bool     isUnique,
+                                                        bool     isSorted)
+{
+    BSLS_ASSERT_SAFE(numOldValues <= d_values.size());
+
+    const ValueComparator valueComparator(d_comparator);
+
+    // Until the merge, failure erases the appended values, which leaves the
+    // old values unchanged.
+
+    EraseProctor proctor(&d_values, numOldValues);
+
+    if (!isSorted) {
+        std::stable_sort(d_values.begin() + numOldValues,
+                         d_values.end(),
+                         valueComparator);
+        if (isUnique) {
+            // On a sorted range, 'a' and a following 'b' are equivalent if 'a'
+            // is not ordered before 'b'.  Keep the first of each run of
+            // equivalent values.
+
+            Iterator newEnd = d_values.begin() + numOldValues;
+            if (newEnd != d_values.end()) {
+                for (Iterator it = newEnd + 1; it != d_values.end(); ++it) {
+                    if (valueComparator(*newEnd, *it)) {
+                        ++newEnd;
+                        if (newEnd != it) {
+                            *newEnd = MoveUtil::move(*it);
+                        }
+                    }
+                }
+                ++newEnd;
+            }
+            d_values.erase(newEnd, d_values.end());
+        }
+    }
+
+#if defined(BSLS_ASSERT_SAFE_IS_ACTIVE)
+    for (Iterator it = d_values.begin() + numOldValues;
+         it != d_values.end() && it + 1 != d_values.end();
+         ++it) {
+        BSLS_ASSERT_SAFE(isUnique ?  valueComparator(it[0], it[1])
+                                  : !valueComparator(it[1], it[0]));
+    }
+#endif
+
+    Iterator middle = d_values.begin() + numOldValues;
+
+    if (0 == numOldValues
+     || middle == d_values.end()
+     || (isUnique ?  valueComparator(middle[-1], *middle)
+                  : !valueComparator(*middle, middle[-1]))) {
+        // The appended values all follow the old values.
+
+        proctor.release();
+        return;                                                       // RETURN
+    }
+
+    // Merge into a new sequence.  The values are moved, so from here failure
+    // clears the tree.
+
+    Container merged(d_values.get_allocator());
+    merged.reserve(d_values.size());
+
+    proctor.reset(0);
+
+    Iterator lhs = d_values.begin();
+    Iterator rhs = middle;
+    while (lhs != middle && rhs != d_values.end()) {
+        if (valueComparator(*rhs, *lhs)) {
+            merged.push_back(MoveUtil::move(*rhs));
+            ++rhs;
+        }
+        else {
+            if (isUnique && !valueComparator(*lhs, *rhs)) {
+                ++rhs;  // the existing value wins
+            }
+            merged.push_back(MoveUtil::move(*lhs));
+            ++lhs;
+        }
+    }
+    for (; lhs != middle; ++lhs) {
+        merged.push_back(MoveUtil::move(*lhs));
+    }
+    for (; rhs != d_values.end(); ++rhs) {
+        merged.push_back(MoveUtil::move(*rhs));
+    }
+
+    d_values.swap(merged);
+    proctor.release();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertRange(
+                                                      INPUT_ITERATOR first,
+                                                      INPUT_ITERATOR last,
+                                                      bool           isUnique,
+                                                      bool           isSorted)
+{
+    const SizeType numOldValues = d_values.size();
+
+    {
+        EraseProctor proctor(&d_values, numOldValues);
+
+        d_values.insert(d_values.end(), first, last);
+
+        proctor.release();
+    }
+
+    mergeAppended(numOldValues, isUnique, isSorted);
+}
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                         const COMPARATOR& comparator,
+                                         const ALLOCATOR&  basicAllocator)
+: d_values(basicAllocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                         const FlatTree&  original,
+                                         const ALLOCATOR& basicAllocator)
+: d_values(original.d_values, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                         bslmf::MovableRef<FlatTree> original)
+: d_values(MoveUtil::move(MoveUtil::access(original).d_values))
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                  bslmf::MovableRef<FlatTree> original,
+                                  const ALLOCATOR&            basicAllocator)
+: d_values(MoveUtil::move(MoveUtil::access(original).d_values),
+           basicAllocator)
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::operator=(const FlatTree& rhs)
+{
+    if (this != &rhs) {
+        d_values     = rhs.d_values;
+        d_comparator = rhs.d_comparator;
+    }
+    return *this;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::operator=(
+                                              bslmf::MovableRef<FlatTree> rhs)
+{
+    FlatTree& lvalue = rhs;
+
+    if (this != &lvalue) {
+        d_values     = MoveUtil::move(lvalue.d_values);
+        d_comparator = lvalue.d_comparator;
+    }
+    return *this;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_values.begin();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_values.end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Container&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::container()
+{
+    return d_values;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(const LOOKUP_KEY& key)
+{
+    return FlatTreeUtil::lowerBound<KEY_CONFIG>(d_values.begin(),
+                                                d_values.end(),
+                                                key,
+                                                d_comparator);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(const LOOKUP_KEY& key)
+{
+    return FlatTreeUtil::upperBound<KEY_CONFIG>(d_values.begin(),
+                                                d_values.end(),
+                                                key,
+                                                d_comparator);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const LOOKUP_KEY& key)
+{
+    return toIterator(
+                   static_cast<const FlatTree *>(this)->find(key));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+bsl::pair<typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator,
+          typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::equalRange(const LOOKUP_KEY& key)
+{
+    Iterator first = lowerBound(key);
+    return bsl::pair<Iterator, Iterator>(
+                              first,
+                              FlatTreeUtil::upperBound<KEY_CONFIG>(
+                                                               first,
+                                                               d_values.end(),
+                                                               key,
+                                                               d_comparator));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator, bool>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(
+                                                       const ValueType& value)
+{
+    const KeyType& key = KEY_CONFIG::extractKey(value);
+
+    Iterator position = lowerBound(key);
+    if (position != d_values.end()
+     && !d_comparator(key, KEY_CONFIG::extractKey(*position))) {
+        return bsl::pair<Iterator, bool>(position, false);            // RETURN
+    }
+    return bsl::pair<Iterator, bool>(d_values.insert(position, value), true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator, bool>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(
+                                           bslmf::MovableRef<ValueType> value)
+{
+    ValueType&     lvalue = value;
+    const KeyType& key    = KEY_CONFIG::extractKey(lvalue);
+
+    Iterator position = lowerBound(key);
+    if (position != d_values.end()
+     && !d_comparator(key, KEY_CONFIG::extractKey(*position))) {
+        return bsl::pair<Iterator, bool>(position, false);            // RETURN
+    }
+    return bsl::pair<Iterator, bool>(
+                         d_values.insert(position, MoveUtil::move(lvalue)),
+                         true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(
+                                                      ConstIterator    hint,
+                                                      const ValueType& value)
+{
+    const KeyType& key = KEY_CONFIG::extractKey(value);
+
+    if ((hint == d_values.cbegin()
+      || d_comparator(KEY_CONFIG::extractKey(hint[-1]), key))
+     && (hint == d_values.cend()
+      || d_comparator(key, KEY_CONFIG::extractKey(*hint)))) {
+        return d_values.insert(hint, value);                          // RETURN
+    }
+    return insertUnique(value).first;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(
+                                        ConstIterator                hint,
+                                        bslmf::MovableRef<ValueType> value)
+{
+    ValueType&     lvalue = value;
+    const KeyType& key    = KEY_CONFIG::extractKey(lvalue);
+
+    if ((hint == d_values.cbegin()
+      || d_comparator(KEY_CONFIG::extractKey(hint[-1]), key))
+     && (hint == d_values.cend()
+      || d_comparator(key, KEY_CONFIG::extractKey(*hint)))) {
+        return d_values.insert(hint, MoveUtil::move(lvalue));         // RETURN
+    }
+    return insertUnique(MoveUtil::move(lvalue)).first;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(
+                                                       const ValueType& value)
+{
+    return d_values.insert(upperBound(KEY_CONFIG::extractKey(value)), value);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(
+                                           bslmf::MovableRef<ValueType> value)
+{
+    ValueType& lvalue = value;
+
+    return d_values.insert(upperBound(KEY_CONFIG::extractKey(lvalue)),
+                           MoveUtil::move(lvalue));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(
+                                                      ConstIterator    hint,
+                                                      const ValueType& value)
+{
+    const KeyType& key = KEY_CONFIG::extractKey(value);
+
+    if (hint != d_values.cbegin()
+     && d_comparator(key, KEY_CONFIG::extractKey(hint[-1]))) {
+        // The value belongs before 'hint': insert it as late as possible.
+
+        hint = FlatTreeUtil::upperBound<KEY_CONFIG>(d_values.cbegin(),
+                                                    hint,
+                                                    key,
+                                                    d_comparator);
+    }
+    else if (hint != d_values.cend()
+          && d_comparator(KEY_CONFIG::extractKey(*hint), key)) {
+        // The value belongs after 'hint': insert it as early as possible.
+
+        hint = FlatTreeUtil::lowerBound<KEY_CONFIG>(hint,
+                                                    d_values.cend(),
+                                                    key,
+                                                    d_comparator);
+    }
+    return d_values.insert(hint, value);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(
+                                        ConstIterator                hint,
+                                        bslmf::MovableRef<ValueType> value)
+{
+    ValueType&     lvalue = value;
+    const KeyType& key    = KEY_CONFIG::extractKey(lvalue);
+
+    if (hint != d_values.cbegin()
+     && d_comparator(key, KEY_CONFIG::extractKey(hint[-1]))) {
+        hint = FlatTreeUtil::upperBound<KEY_CONFIG>(d_values.cbegin(),
+                                                    hint,
+                                                    key,
+                                                    d_comparator);
+    }
+    else if (hint != d_values.cend()
+          && d_comparator(KEY_CONFIG::extractKey(*hint), key)) {
+        hint = FlatTreeUtil::lowerBound<KEY_CONFIG>(hint,
+                                                    d_values.cend(),
+                                                    key,
+                                                    d_comparator);
+    }
+    return d_values.insert(hint, MoveUtil::move(lvalue));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertRangeUnique(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    insertRange(first, last, true, false);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertRangeMulti(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    insertRange(first, last, false, false);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertSortedRangeUnique(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    insertRange(first, last, true, true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertSortedRangeMulti(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    insertRange(first, last, false, true);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+bsl::pair<typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator, bool>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::emplaceUnique(
+                                                          ARGS&&... arguments)
+{
+    // Construct the value at the end, where it can be discarded cheaply if
+    // its key is a duplicate, and otherwise rotate it into position.
+
+    d_values.emplace_back(BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+
+    EraseProctor proctor(&d_values, d_values.size() - 1);
+
+    Iterator       last     = d_values.end() - 1;
+    const KeyType& key      = KEY_CONFIG::extractKey(*last);
+    Iterator       position = FlatTreeUtil::lowerBound<KEY_CONFIG>(
+                                                             d_values.begin(),
+                                                             last,
+                                                             key,
+                                                             d_comparator);
+    if (position != last
+     && !d_comparator(key, KEY_CONFIG::extractKey(*position))) {
+        return bsl::pair<Iterator, bool>(position, false);            // RETURN
+    }
+
+    proctor.reset(0);
+    std::rotate(position, last, d_values.end());
+    proctor.release();
+
+    return bsl::pair<Iterator, bool>(position, true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::emplaceMulti(ARGS&&... arguments)
+{
+    d_values.emplace_back(BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+
+    EraseProctor proctor(&d_values, d_values.size() - 1);
+
+    Iterator last     = d_values.end() - 1;
+    Iterator position = FlatTreeUtil::upperBound<KEY_CONFIG>(
+                                                d_values.begin(),
+                                                last,
+                                                KEY_CONFIG::extractKey(*last),
+                                                d_comparator);
+
+    proctor.reset(0);
+    std::rotate(position, last, d_values.end());
+    proctor.release();
+
+    return position;
+}
+#endif
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(ConstIterator position)
+{
+    BSLS_ASSERT_SAFE(d_values.cbegin() <= position);
+    BSLS_ASSERT_SAFE(position < d_values.cend());
+
+    return d_values.erase(position);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(ConstIterator first,
+                                                   ConstIterator last)
+{
+    BSLS_ASSERT_SAFE(d_values.cbegin() <= first);
+    BSLS_ASSERT_SAFE(first <= last);
+    BSLS_ASSERT_SAFE(last <= d_values.cend());
+
+    return d_values.erase(first, last);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::eraseKey(const LOOKUP_KEY& key)
+{
+    bsl::pair<Iterator, Iterator> range = equalRange(key);
+
+    const SizeType numErased = range.second - range.first;
+    d_values.erase(range.first, range.second);
+    return numErased;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::clear() BSLS_KEYWORD_NOEXCEPT
+{
+    d_values.clear();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::reserve(SizeType numValues)
+{
+    d_values.reserve(numValues);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::shrinkToFit()
+{
+    d_values.shrink_to_fit();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::swap(FlatTree& other)
+{
+    d_values.swap(other.d_values);
+
+    using std::swap;
+    swap(d_comparator, other.d_comparator);
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_values.begin();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_values.end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Container&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::container() const
+{
+    return d_values;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(
+                                                  const LOOKUP_KEY& key) const
+{
+    return FlatTreeUtil::lowerBound<KEY_CONFIG>(d_values.begin(),
+                                                d_values.end(),
+                                                key,
+                                                d_comparator);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(
+                                                  const LOOKUP_KEY& key) const
+{
+    return FlatTreeUtil::upperBound<KEY_CONFIG>(d_values.begin(),
+                                                d_values.end(),
+                                                key,
+                                                d_comparator);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const LOOKUP_KEY& key) const
+{
+    ConstIterator position = lowerBound(key);
+    if (position != d_values.end()
+     && d_comparator(key, KEY_CONFIG::extractKey(*position))) {
+        return d_values.end();                                        // RETURN
+    }
+    return position;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+bsl::pair<
+       typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator,
+       typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::equalRange(
+                                                  const LOOKUP_KEY& key) const
+{
+    ConstIterator first = lowerBound(key);
+    return bsl::pair<ConstIterator, ConstIterator>(
+                              first,
+                              FlatTreeUtil::upperBound<KEY_CONFIG>(
+                                                               first,
+                                                               d_values.end(),
+                                                               key,
+                                                               d_comparator));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::count(
+                                                  const LOOKUP_KEY& key) const
+{
+    bsl::pair<ConstIterator, ConstIterator> range = equalRange(key);
+    return range.second - range.first;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return d_values.get_allocator();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_values.capacity();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+bool FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return d_values.empty();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    return d_values.max_size();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_values.size();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
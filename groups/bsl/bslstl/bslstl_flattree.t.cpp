@@ -0,0 +1,1093 @@
+// bslstl_flattree.t.cpp                                              -*-C++-*-
+#include <bslstl_flattree.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <algorithm>
+#include <functional>
+#include <set>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a utility of branch-free binary searches,
+// 'bslstl::FlatTreeUtil', and a mechanism, 'bslstl::FlatTree', implementing a
+// sorted sequence of values held in a 'bsl::vector'.  The searches are
+// verified exhaustively against 'std::lower_bound' and 'std::upper_bound' for
+// all small ranges.  The manipulators of 'FlatTree' are verified against
+// 'std::set' and 'std::multiset' on pseudo-random input, checking after each
+// operation that the sequence is sorted, and, for the '...Multi'
+// manipulators, that equivalent values retain their order of insertion.
+// Allocator usage is verified with 'bslma::TestAllocator'.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] RANDOM_ITERATOR FlatTreeUtil::lowerBound(first, last, key, comp);
+// [ 2] RANDOM_ITERATOR FlatTreeUtil::upperBound(first, last, key, comp);
+//
+// CREATORS
+// [ 6] FlatTree(const COMPARATOR&, const ALLOCATOR&);
+// [ 6] FlatTree(const FlatTree&, const ALLOCATOR&);
+// [ 6] FlatTree(MovableRef<FlatTree>);
+// [ 6] FlatTree(MovableRef<FlatTree>, const ALLOCATOR&);
+//
+// MANIPULATORS
+// [ 3] pair<Iterator, bool> insertUnique(const ValueType&);
+// [ 3] Iterator insertUnique(ConstIterator, const ValueType&);
+// [ 3] Iterator insertMulti(const ValueType&);
+// [ 3] Iterator insertMulti(ConstIterator, const ValueType&);
+// [ 4] void insertRangeUnique(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void insertRangeMulti(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void insertSortedRangeUnique(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void insertSortedRangeMulti(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] pair<Iterator, bool> emplaceUnique(ARGS&&...);
+// [ 3] Iterator emplaceMulti(ARGS&&...);
+// [ 5] Iterator erase(ConstIterator);
+// [ 5] Iterator erase(ConstIterator, ConstIterator);
+// [ 5] SizeType eraseKey(const LOOKUP_KEY&);
+// [ 6] void swap(FlatTree&);
+//
+// ACCESSORS
+// [ 3] ConstIterator find(const LOOKUP_KEY&) const;
+// [ 3] SizeType count(const LOOKUP_KEY&) const;
+// [ 3] pair<ConstIterator, ConstIterator> equalRange(const LOOKUP_KEY&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::UnorderedSetKeyConfiguration<int>             IntConfig;
+typedef bslstl::FlatTree<IntConfig,
+                         std::less<int>,
+                         bsl::allocator<int> >                IntTree;
+
+typedef bsl::pair<int, int>                                   Element;
+    // An 'Element' is a key (the 'first' member) and the sequence number of
+    // its insertion (the 'second' member), used to verify that equivalent
+    // keys retain their order of insertion.
+
+typedef bslstl::UnorderedMapKeyConfiguration<int, Element>    ElementConfig;
+typedef bslstl::FlatTree<ElementConfig,
+                         std::less<int>,
+                         bsl::allocator<Element> >            ElementTree;
+
+typedef bslstl::UnorderedSetKeyConfiguration<bsl::string>     StringConfig;
+typedef bslstl::FlatTree<StringConfig,
+                         std::less<bsl::string>,
+                         bsl::allocator<bsl::string> >        StringTree;
+
+//=============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+                            // ==================
+                            // class ThrowingLess
+                            // ==================
+
+class ThrowingLess {
+    // This comparator orders 'int' values as 'std::less<int>', but throws an
+    // 'int' from the comparison for which the shared countdown reaches zero.
+
+    // DATA
+    int *d_countdown_p;  // comparisons remaining before a throw (held, not
+                         // owned); no throw while negative
+
+  public:
+    // CREATORS
+    explicit ThrowingLess(int *countdown)
+        // Create a comparator that decrements the specified 'countdown' on
+        // each comparison, and throws when it reaches zero.
+    : d_countdown_p(countdown)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'lhs < rhs', or throw an 'int' if the countdown reaches
+        // zero.
+    {
+        if (0 == (*d_countdown_p)--) {
+            throw lhs;
+        }
+        return lhs < rhs;
+    }
+};
+
+typedef bslstl::FlatTree<IntConfig,
+                         ThrowingLess,
+                         bsl::allocator<int> >                ThrowingTree;
+
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified linear-congruential generator 'state', and return
+    // its new value, scaled to the range '[0 .. 2^15)'.
+{
+    *state = *state * 1103515245 + 12345;
+    return (*state >> 16) & 0x7fff;
+}
+
+bool isSorted(const IntTree& tree, bool isUnique)
+    // Return 'true' if the values of the specified 'tree' are sorted, and, if
+    // the specified 'isUnique' is 'true', contain no equivalent values, and
+    // 'false' otherwise.
+{
+    for (IntTree::ConstIterator it = tree.begin(); it != tree.end(); ++it) {
+        if (it + 1 != tree.end()) {
+            if (isUnique ? !(it[0] < it[1]) : it[1] < it[0]) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+    return true;
+}
+
+bool isStablySorted(const ElementTree& tree)
+    // Return 'true' if the elements of the specified 'tree' are sorted by key
+    // and elements having equivalent keys are in increasing order of their
+    // sequence numbers, and 'false' otherwise.
+{
+    for (ElementTree::ConstIterator it = tree.begin();
+         it != tree.end() && it + 1 != tree.end();
+         ++it) {
+        if (it[1].first < it[0].first) {
+            return false;                                             // RETURN
+        }
+        if (it[1].first == it[0].first && it[1].second < it[0].second) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class REFERENCE>
+bool isEqual(const IntTree& tree, const REFERENCE& reference)
+    // Return 'true' if the specified 'tree' has the same sequence of values
+    // as the specified 'reference' container, and 'false' otherwise.
+{
+    return tree.size() == reference.size()
+        && std::equal(tree.begin(), tree.end(), reference.begin());
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+//  bool veryVeryVerbose     = argc > 4;
+//  bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Sorted Array
+///- - - - - - - - - - - - - - - - - -
+// Suppose we have a sorted array of integers, and want to determine the
+// number of values less than a given threshold.  We can use
+// 'bslstl::FlatTreeUtil::lowerBound' with a key configuration in which each
+// value is its own key:
+//..
+    typedef bslstl::UnorderedSetKeyConfiguration<int> Config;
+
+    const int DATA[]   = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29 };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    const int *position = bslstl::FlatTreeUtil::lowerBound<Config>(
+                                                             DATA,
+                                                             DATA + NUM_DATA,
+                                                             12,
+                                                             std::less<int>());
+    ASSERT(5  == position - DATA);
+    ASSERT(13 == *position);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CREATORS, SWAP, AND ALLOCATOR PROPAGATION
+        //
+        // Concerns:
+        //: 1 All memory, for the sequence and for the values themselves, is
+        //:   supplied by the allocator of the tree; none is supplied by the
+        //:   default allocator.
+        //:
+        //: 2 The copy constructor with an allocator copies the values into
+        //:   memory from that allocator.
+        //:
+        //: 3 The move constructor takes the sequence of its source in
+        //:   constant time, without allocating.
+        //:
+        //: 4 The extended move constructor moves the sequence when the
+        //:   allocators are equal, and copies it otherwise.
+        //:
+        //: 5 'swap' exchanges the values and comparators of two trees.
+        //
+        // Plan:
+        //: 1 Create trees of strings long enough to allocate, using a test
+        //:   allocator, and verify the usage of that allocator and the
+        //:   default allocator after each operation.  (C-1..5)
+        //
+        // Testing:
+        //   FlatTree(const COMPARATOR&, const ALLOCATOR&);
+        //   FlatTree(const FlatTree&, const ALLOCATOR&);
+        //   FlatTree(MovableRef<FlatTree>);
+        //   FlatTree(MovableRef<FlatTree>, const ALLOCATOR&);
+        //   void swap(FlatTree&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, SWAP, AND ALLOCATOR PROPAGATION"
+                            "\n=========================================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+        bslma::TestAllocator oa("other",    veryVerbose);
+
+        const char *LONG = "a string long enough to require an allocation";
+
+        {
+            StringTree mX(std::less<bsl::string>(), &sa);
+            const StringTree& X = mX;
+
+            bsl::vector<bsl::string> input(&sa);
+            for (int i = 0; i < 20; ++i) {
+                bsl::string s(LONG, &sa);
+                s.push_back(static_cast<char>('a' + (i * 7) % 20));
+                input.push_back(s);
+            }
+            mX.insertRangeUnique(input.begin(), input.end());
+            ASSERTV(X.size(), 20 == X.size());
+            ASSERTV(0 == defaultAllocator.numBlocksTotal());
+            for (StringTree::ConstIterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                ASSERT(&sa == it->get_allocator().mechanism());
+            }
+
+            if (veryVerbose) printf("\tcopy with allocator\n");
+            {
+                StringTree mY(X, &oa);  const StringTree& Y = mY;
+
+                ASSERT(X.container() == Y.container());
+                ASSERT(&oa == Y.allocator().mechanism());
+                ASSERT(&oa == Y.begin()->get_allocator().mechanism());
+                ASSERT(0 == defaultAllocator.numBlocksTotal());
+            }
+
+            if (veryVerbose) printf("\tmove\n");
+            {
+                StringTree mY(X, &sa);
+                const bsls::Types::Int64 NUM_BLOCKS = sa.numBlocksTotal();
+
+                StringTree mZ(MoveUtil::move(mY));  const StringTree& Z = mZ;
+
+                ASSERT(NUM_BLOCKS == sa.numBlocksTotal());
+                ASSERT(X.container() == Z.container());
+                ASSERT(&sa == Z.allocator().mechanism());
+            }
+
+            if (veryVerbose) printf("\tmove with allocator\n");
+            {
+                StringTree mY(X, &sa);
+                const bsls::Types::Int64 NUM_BLOCKS = sa.numBlocksTotal();
+
+                StringTree mZ(MoveUtil::move(mY), &sa);
+                ASSERT(NUM_BLOCKS == sa.numBlocksTotal());
+                ASSERT(X.container() == mZ.container());
+
+                StringTree mW(MoveUtil::move(mZ), &oa);
+                ASSERT(X.container() == mW.container());
+                ASSERT(&oa == mW.begin()->get_allocator().mechanism());
+            }
+
+            if (veryVerbose) printf("\tswap\n");
+            {
+                StringTree mY(std::less<bsl::string>(), &sa);
+                mY.insertUnique(bsl::string(LONG, &sa));
+
+                StringTree mZ(X, &sa);
+                mZ.swap(mY);
+
+                ASSERT(1 == mZ.size());
+                ASSERT(X.container() == mY.container());
+            }
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ERASURE
+        //
+        // Concerns:
+        //: 1 'erase' removes the value at a position, or the values in a
+        //:   range, and returns an iterator to the value that followed.
+        //:
+        //: 2 'eraseKey' removes all values equivalent to a key, and returns
+        //:   their number.
+        //:
+        //: 3 The precondition of 'erase' is checked in appropriate build
+        //:   modes.
+        //
+        // Plan:
+        //: 1 Erase pseudo-random keys and ranges from a tree holding
+        //:   equivalent keys, and compare against 'std::multiset'.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered.  (C-3)
+        //
+        // Testing:
+        //   Iterator erase(ConstIterator);
+        //   Iterator erase(ConstIterator, ConstIterator);
+        //   SizeType eraseKey(const LOOKUP_KEY&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nERASURE"
+                            "\n=======\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        unsigned int         state = 7;
+        IntTree              mX(std::less<int>(), &sa);
+        const IntTree&       X = mX;
+        std::multiset<int>   reference;
+
+        for (int i = 0; i < 500; ++i) {
+            const int key = static_cast<int>(nextRandom(&state) % 100);
+            mX.insertMulti(key);
+            reference.insert(key);
+        }
+
+        for (int i = 0; i < 200 && !X.empty(); ++i) {
+            switch (nextRandom(&state) % 3) {
+              case 0: {
+                const int key = static_cast<int>(nextRandom(&state) % 100);
+
+                const IntTree::SizeType n = mX.eraseKey(key);
+                ASSERTV(i, key, n, reference.erase(key) == n);
+              } break;
+              case 1: {
+                const IntTree::SizeType index = nextRandom(&state) % X.size();
+                const int               value = X.begin()[index];
+                const int               next  = index + 1 < X.size()
+                                              ? X.begin()[index + 1]
+                                              : -1;
+
+                reference.erase(reference.find(value));
+
+                IntTree::Iterator it = mX.erase(X.begin() + index);
+                ASSERTV(i, index, it == X.begin() + index);
+                if (it != X.end()) {
+                    ASSERTV(i, next, *it, next == *it);
+                }
+              } break;
+              default: {
+                const IntTree::SizeType first = nextRandom(&state) % X.size();
+                const IntTree::SizeType last  = first
+                                    + nextRandom(&state) % (X.size() - first);
+
+                std::multiset<int>::iterator rFirst = reference.begin();
+                std::advance(rFirst, first);
+                std::multiset<int>::iterator rLast = rFirst;
+                std::advance(rLast, last - first);
+                reference.erase(rFirst, rLast);
+
+                IntTree::Iterator it = mX.erase(X.begin() + first,
+                                                X.begin() + last);
+                ASSERTV(i, it == X.begin() + first);
+              }
+            }
+            ASSERTV(i, isSorted(X, false));
+            ASSERTV(i, isEqual(X, reference));
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            IntTree mY(std::less<int>(), &sa);
+            mY.insertUnique(1);
+
+            ASSERT_SAFE_PASS(mY.erase(mY.begin()));
+            ASSERT_SAFE_FAIL(mY.erase(mY.end()));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BULK INSERTION
+        //
+        // Concerns:
+        //: 1 'insertRangeUnique' inserts each value not equivalent to a value
+        //:   in the tree or to a preceding value of the range, whether or not
+        //:   the range is sorted, and whether or not the range orders after
+        //:   the values in the tree.
+        //:
+        //: 2 'insertRangeMulti' inserts every value, placing values after
+        //:   existing equivalent values, and keeping equivalent values of the
+        //:   range in their order in the range.
+        //:
+        //: 3 The '...Sorted...' variants produce the same results for sorted
+        //:   input.
+        //:
+        //: 4 Bulk insertion into an empty tree, and of an empty range, are
+        //:   handled.
+        //:
+        //: 5 If the comparator throws, the tree is left either holding its
+        //:   original values (before the merge) or empty (during the merge),
+        //:   and no memory is leaked.
+        //
+        // Plan:
+        //: 1 For a number of pseudo-random batches, of varying sizes and key
+        //:   densities, insert the batch with each manipulator, and compare
+        //:   the result against 'std::set' or 'std::multiset'.  (C-1, 3..4)
+        //:
+        //: 2 Insert batches of 'Element' values, tagged with sequence
+        //:   numbers, with 'insertRangeMulti', and verify that the tree is
+        //:   stably sorted.  (C-2)
+        //:
+        //: 3 Insert an unsorted range that must be merged into trees having
+        //:   comparators that throw after each possible number of
+        //:   comparisons, and verify the state of the tree after each throw.
+        //:   (C-5)
+        //
+        // Testing:
+        //   void insertRangeUnique(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insertRangeMulti(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insertSortedRangeUnique(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insertSortedRangeMulti(INPUT_ITERATOR, INPUT_ITERATOR);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBULK INSERTION"
+                            "\n==============\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        const int BATCH_SIZES[] = { 0, 1, 2, 3, 7, 16, 33, 100, 257 };
+        const int NUM_BATCH_SIZES = sizeof BATCH_SIZES / sizeof *BATCH_SIZES;
+
+        const int KEY_RANGES[] = { 1, 5, 50, 1000, 100000 };
+        const int NUM_KEY_RANGES = sizeof KEY_RANGES / sizeof *KEY_RANGES;
+
+        unsigned int state = 1;
+
+        if (verbose) printf("\tUnique and multi, sorted and unsorted.\n");
+
+        for (int ri = 0; ri < NUM_KEY_RANGES; ++ri) {
+            const int KEY_RANGE = KEY_RANGES[ri];
+
+            IntTree mU(std::less<int>(), &sa);  const IntTree& U = mU;
+            IntTree mM(std::less<int>(), &sa);  const IntTree& M = mM;
+            IntTree mSU(std::less<int>(), &sa); const IntTree& SU = mSU;
+            IntTree mSM(std::less<int>(), &sa); const IntTree& SM = mSM;
+
+            std::set<int>      uniqueRef;
+            std::multiset<int> multiRef;
+
+            for (int bi = 0; bi < NUM_BATCH_SIZES; ++bi) {
+                const int BATCH_SIZE = BATCH_SIZES[bi];
+
+                bsl::vector<int> batch(&sa);
+                for (int i = 0; i < BATCH_SIZE; ++i) {
+                    batch.push_back(static_cast<int>(
+                                          nextRandom(&state) % KEY_RANGE));
+                }
+                if (bi % 3 == 2) {
+                    // Make every value of the batch order after the values
+                    // already present, to exercise the append-only path.
+
+                    for (bsl::vector<int>::iterator it = batch.begin();
+                         it != batch.end();
+                         ++it) {
+                        *it += KEY_RANGE * (bi + 1);
+                    }
+                }
+
+                mU.insertRangeUnique(batch.begin(), batch.end());
+                mM.insertRangeMulti(batch.begin(), batch.end());
+
+                uniqueRef.insert(batch.begin(), batch.end());
+                multiRef.insert(batch.begin(), batch.end());
+
+                bsl::vector<int> sorted(batch, &sa);
+                std::sort(sorted.begin(), sorted.end());
+                mSM.insertSortedRangeMulti(sorted.begin(), sorted.end());
+                sorted.erase(std::unique(sorted.begin(), sorted.end()),
+                             sorted.end());
+                mSU.insertSortedRangeUnique(sorted.begin(), sorted.end());
+
+                ASSERTV(KEY_RANGE, BATCH_SIZE, isSorted(U, true));
+                ASSERTV(KEY_RANGE, BATCH_SIZE, isSorted(M, false));
+                ASSERTV(KEY_RANGE, BATCH_SIZE, isEqual(U, uniqueRef));
+                ASSERTV(KEY_RANGE, BATCH_SIZE, isEqual(M, multiRef));
+                ASSERTV(KEY_RANGE, BATCH_SIZE, isEqual(SU, uniqueRef));
+                ASSERTV(KEY_RANGE, BATCH_SIZE, isEqual(SM, multiRef));
+            }
+        }
+
+        if (verbose) printf("\tStability of equivalent values.\n");
+
+        for (int ri = 0; ri < NUM_KEY_RANGES; ++ri) {
+            const int KEY_RANGE = KEY_RANGES[ri];
+
+            ElementTree mX(std::less<int>(), &sa);
+            const ElementTree& X = mX;
+
+            int sequence = 0;
+            for (int bi = 0; bi < NUM_BATCH_SIZES; ++bi) {
+                const int BATCH_SIZE = BATCH_SIZES[bi];
+
+                bsl::vector<Element> batch(&sa);
+                for (int i = 0; i < BATCH_SIZE; ++i) {
+                    batch.push_back(Element(static_cast<int>(
+                                             nextRandom(&state) % KEY_RANGE),
+                                            sequence++));
+                }
+                mX.insertRangeMulti(batch.begin(), batch.end());
+                ASSERTV(KEY_RANGE, BATCH_SIZE, isStablySorted(X));
+            }
+            ASSERTV(KEY_RANGE, sequence, static_cast<int>(X.size()),
+                    sequence == static_cast<int>(X.size()));
+        }
+
+        if (verbose) printf("\tFirst of equivalent values is kept.\n");
+        {
+            ElementTree mX(std::less<int>(), &sa);
+            mX.insertUnique(Element(5, 0));
+
+            const Element BATCH[] = { Element(7, 1), Element(5, 2),
+                                      Element(7, 3), Element(1, 4) };
+            mX.insertRangeUnique(BATCH, BATCH + 4);
+
+            ASSERTV(mX.size(), 3 == mX.size());
+            ASSERT(4 == mX.find(1)->second);
+            ASSERT(0 == mX.find(5)->second);
+            ASSERT(1 == mX.find(7)->second);
+        }
+
+#if defined(BDE_BUILD_TARGET_EXC)
+        if (verbose) printf("\tThrowing comparator.\n");
+        {
+            enum { k_NUM_VALUES = 8 };
+
+            // '14' and '6' are equivalent to existing values.
+
+            const int BATCH[] = { 9, 3, 14, 1, 6 };
+            enum { k_BATCH_SIZE = sizeof BATCH / sizeof *BATCH };
+
+            for (int multi = 0; multi < 2; ++multi) {
+                bool completed = false;
+                bool emptied   = false;
+                for (int limit = 0; !completed; ++limit) {
+                    int          countdown = -1;
+                    ThrowingTree mX(ThrowingLess(&countdown), &sa);
+
+                    for (int i = 0; i < k_NUM_VALUES; ++i) {
+                        mX.insertMulti(2 * i);
+                    }
+
+                    countdown = limit;
+                    try {
+                        if (multi) {
+                            mX.insertRangeMulti(BATCH, BATCH + k_BATCH_SIZE);
+                        }
+                        else {
+                            mX.insertRangeUnique(BATCH, BATCH + k_BATCH_SIZE);
+                        }
+                        completed = true;
+                    }
+                    catch (int) {
+                    }
+                    countdown = -1;
+
+                    const ThrowingTree::SizeType NUM = k_NUM_VALUES;
+
+                    if (completed) {
+                        ASSERTV(multi, limit,
+                                NUM + (multi ? 5 : 3) == mX.size());
+                    }
+                    else if (mX.empty()) {
+                        emptied = true;
+                    }
+                    else {
+                        ASSERTV(multi, limit, NUM == mX.size());
+                        for (ThrowingTree::SizeType i = 0;
+                             i < NUM && i < mX.size();
+                             ++i) {
+                            ASSERTV(multi, limit, i,
+                                    static_cast<int>(2 * i) == mX.begin()[i]);
+                        }
+                    }
+                }
+                ASSERTV(multi, emptied);
+            }
+        }
+#endif
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SINGLE-VALUE INSERTION AND LOOKUP
+        //
+        // Concerns:
+        //: 1 'insertUnique' inserts a value only if no equivalent value is
+        //:   present, and returns its position and whether it was inserted.
+        //:
+        //: 2 'insertMulti' inserts a value after any equivalent values.
+        //:
+        //: 3 The hinted overloads produce the same results whether or not the
+        //:   hint is correct.
+        //:
+        //: 4 'emplaceUnique' and 'emplaceMulti' behave as the corresponding
+        //:   'insert...' manipulators.
+        //:
+        //: 5 'find', 'count', and 'equalRange' report the values equivalent
+        //:   to a key.
+        //:
+        //: 6 If the comparator throws, 'emplaceUnique' and 'emplaceMulti'
+        //:   leave the values unchanged, and leak no memory.
+        //
+        // Plan:
+        //: 1 Insert pseudo-random keys with each manipulator, using correct,
+        //:   incorrect, and boundary hints, and compare against 'std::set' or
+        //:   'std::multiset' after each insertion.  (C-1..5)
+        //:
+        //: 2 Emplace a key into trees having comparators that throw after
+        //:   each possible number of comparisons, and verify that, whenever
+        //:   an exception propagates, the tree holds its original values.
+        //:   (C-6)
+        //
+        // Testing:
+        //   pair<Iterator, bool> insertUnique(const ValueType&);
+        //   Iterator insertUnique(ConstIterator, const ValueType&);
+        //   Iterator insertMulti(const ValueType&);
+        //   Iterator insertMulti(ConstIterator, const ValueType&);
+        //   pair<Iterator, bool> emplaceUnique(ARGS&&...);
+        //   Iterator emplaceMulti(ARGS&&...);
+        //   ConstIterator find(const LOOKUP_KEY&) const;
+        //   SizeType count(const LOOKUP_KEY&) const;
+        //   pair<ConstIterator, ConstIterator> equalRange(const LOOKUP_KEY&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSINGLE-VALUE INSERTION AND LOOKUP"
+                            "\n=================================\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        unsigned int state = 3;
+
+        for (int mode = 0; mode < 6; ++mode) {
+            IntTree            mU(std::less<int>(), &sa);
+            const IntTree&     U = mU;
+            IntTree            mM(std::less<int>(), &sa);
+            const IntTree&     M = mM;
+            std::set<int>      uniqueRef;
+            std::multiset<int> multiRef;
+
+            for (int i = 0; i < 300; ++i) {
+                const int key = static_cast<int>(nextRandom(&state) % 64);
+
+                const bool isNew = uniqueRef.insert(key).second;
+                multiRef.insert(key);
+
+                IntTree::ConstIterator uHint;
+                IntTree::ConstIterator mHint;
+                switch (mode) {
+                  case 0:
+                  case 1: {
+                    uHint = U.begin();
+                    mHint = M.begin();
+                  } break;
+                  case 2: {
+                    uHint = U.end();
+                    mHint = M.end();
+                  } break;
+                  default: {
+                    uHint = U.lowerBound(key);  // correct hint
+                    mHint = M.upperBound(key);
+                  }
+                }
+
+                switch (mode) {
+                  case 0: {
+                    bsl::pair<IntTree::Iterator, bool> r =
+                                                         mU.insertUnique(key);
+                    ASSERTV(i, key, isNew == r.second);
+                    ASSERTV(i, key, key == *r.first);
+
+                    IntTree::Iterator it = mM.insertMulti(key);
+                    ASSERTV(i, key, key == *it);
+                    ASSERTV(i, key, it + 1 == M.upperBound(key));
+                  } break;
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+                  case 5: {
+                    bsl::pair<IntTree::Iterator, bool> r =
+                                                        mU.emplaceUnique(key);
+                    ASSERTV(i, key, isNew == r.second);
+                    ASSERTV(i, key, key == *r.first);
+
+                    IntTree::Iterator it = mM.emplaceMulti(key);
+                    ASSERTV(i, key, key == *it);
+                    ASSERTV(i, key, it + 1 == M.upperBound(key));
+                  } break;
+#endif
+                  default: {
+                    IntTree::Iterator it = mU.insertUnique(uHint, key);
+                    ASSERTV(i, key, key == *it);
+
+                    it = mM.insertMulti(mHint, key);
+                    ASSERTV(i, key, key == *it);
+                  }
+                }
+
+                ASSERTV(mode, i, isSorted(U, true));
+                ASSERTV(mode, i, isSorted(M, false));
+                ASSERTV(mode, i, isEqual(U, uniqueRef));
+                ASSERTV(mode, i, isEqual(M, multiRef));
+            }
+
+            for (int key = -1; key <= 64; ++key) {
+                const IntTree::SizeType n = multiRef.count(key);
+
+                ASSERTV(key, n == M.count(key));
+                ASSERTV(key, (n ? 1 : 0) == U.count(key));
+                ASSERTV(key, (n ? U.find(key) != U.end()
+                                : U.find(key) == U.end()));
+
+                typedef IntTree::ConstIterator Iter;
+
+                bsl::pair<Iter, Iter> range = M.equalRange(key);
+                ASSERTV(key, n == static_cast<IntTree::SizeType>(
+                                                  range.second - range.first));
+                ASSERTV(key, range.first == M.find(key) || 0 == n);
+            }
+        }
+
+        if (verbose) printf("\tEquivalent values keep insertion order.\n");
+        {
+            ElementTree mX(std::less<int>(), &sa);
+
+            for (int i = 0; i < 200; ++i) {
+                const int key = static_cast<int>(nextRandom(&state) % 10);
+                if (i % 2) {
+                    mX.insertMulti(Element(key, i));
+                }
+                else {
+                    mX.insertMulti(mX.end(), Element(key, i));
+                }
+                ASSERTV(i, isStablySorted(mX));
+            }
+        }
+
+#if defined(BDE_BUILD_TARGET_EXC)                                             \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+        if (verbose) printf("\tThrowing comparator.\n");
+        {
+            enum { k_NUM_VALUES = 20 };
+
+            for (int multi = 0; multi < 2; ++multi) {
+                for (int limit = 0; limit < 2 * k_NUM_VALUES; ++limit) {
+                    int          countdown = -1;
+                    ThrowingTree mX(ThrowingLess(&countdown), &sa);
+
+                    for (int i = 0; i < k_NUM_VALUES; ++i) {
+                        mX.insertMulti(2 * i);
+                    }
+
+                    countdown = limit;
+
+                    bool threw = false;
+                    try {
+                        if (multi) {
+                            mX.emplaceMulti(k_NUM_VALUES + 1);
+                        }
+                        else {
+                            mX.emplaceUnique(k_NUM_VALUES + 1);
+                        }
+                    }
+                    catch (int) {
+                        threw = true;
+                    }
+                    countdown = -1;
+
+                    ASSERTV(multi, limit, threw || limit > 0);
+                    const ThrowingTree::SizeType NUM = k_NUM_VALUES;
+
+                    if (threw) {
+                        ASSERTV(multi, limit, NUM == mX.size());
+                        for (ThrowingTree::SizeType i = 0;
+                             i < NUM && i < mX.size();
+                             ++i) {
+                            ASSERTV(multi, limit, i,
+                                    static_cast<int>(2 * i) == mX.begin()[i]);
+                        }
+                    }
+                    else {
+                        ASSERTV(multi, limit, NUM + 1 == mX.size());
+                    }
+                }
+            }
+        }
+#endif
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // BRANCH-FREE BINARY SEARCH
+        //
+        // Concerns:
+        //: 1 'lowerBound' and 'upperBound' return the same positions as
+        //:   'std::lower_bound' and 'std::upper_bound' for every key, for
+        //:   ranges of every length including 0, and for ranges having runs of
+        //:   equivalent values.
+        //:
+        //: 2 The searches use only the supplied comparator.
+        //
+        // Plan:
+        //: 1 For every range length from 0 to 130, and for several densities
+        //:   of duplicates, search for every key between one less than the
+        //:   least and one greater than the greatest value, and compare with
+        //:   the standard algorithms.  (C-1)
+        //:
+        //: 2 Repeat using 'std::greater', on a range sorted in decreasing
+        //:   order.  (C-2)
+        //
+        // Testing:
+        //   RANDOM_ITERATOR FlatTreeUtil::lowerBound(first, last, key, comp);
+        //   RANDOM_ITERATOR FlatTreeUtil::upperBound(first, last, key, comp);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBRANCH-FREE BINARY SEARCH"
+                            "\n=========================\n");
+
+        typedef bslstl::FlatTreeUtil Util;
+
+        enum { k_MAX_LENGTH = 130 };
+
+        int data[k_MAX_LENGTH];
+
+        for (int step = 1; step <= 4; ++step) {
+            for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+                for (int i = 0; i < length; ++i) {
+                    data[i] = (i / step) * 2;  // runs of 'step' even values
+                }
+                const int *first = data;
+                const int *last  = data + length;
+
+                const int maxKey = length ? data[length - 1] + 1 : 1;
+                for (int key = -1; key <= maxKey; ++key) {
+                    const int *expLower = std::lower_bound(first, last, key);
+                    const int *expUpper = std::upper_bound(first, last, key);
+
+                    const int *lower = Util::lowerBound<IntConfig>(
+                                                            first,
+                                                            last,
+                                                            key,
+                                                            std::less<int>());
+                    const int *upper = Util::upperBound<IntConfig>(
+                                                            first,
+                                                            last,
+                                                            key,
+                                                            std::less<int>());
+
+                    ASSERTV(step, length, key, expLower == lower);
+                    ASSERTV(step, length, key, expUpper == upper);
+                }
+
+                std::reverse(data, data + length);
+                for (int key = -1; key <= maxKey; ++key) {
+                    const int *expLower = std::lower_bound(
+                                                         first,
+                                                         last,
+                                                         key,
+                                                         std::greater<int>());
+                    const int *lower = Util::lowerBound<IntConfig>(
+                                                         first,
+                                                         last,
+                                                         key,
+                                                         std::greater<int>());
+
+                    ASSERTV(step, length, key, expLower == lower);
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        IntTree mX(std::less<int>(), &sa);  const IntTree& X = mX;
+
+        ASSERT(X.empty());
+        ASSERT(mX.insertUnique(3).second);
+        ASSERT(mX.insertUnique(1).second);
+        ASSERT(!mX.insertUnique(3).second);
+        mX.insertMulti(3);
+        ASSERT(3 == X.size());
+        ASSERT(1 == X.begin()[0]);
+        ASSERT(2 == X.count(3));
+        ASSERT(X.end() == X.find(2));
+
+        const int MORE[] = { 9, 0, 4 };
+        mX.insertRangeUnique(MORE, MORE + 3);
+        ASSERT(6 == X.size());
+        ASSERT(0 == *X.begin());
+        ASSERT(9 == X.end()[-1]);
+
+        ASSERT(2 == mX.eraseKey(3));
+        ASSERT(4 == X.size());
+
+        mX.clear();
+        ASSERT(X.empty());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
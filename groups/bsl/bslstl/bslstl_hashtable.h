@@ -2896,6 +2896,17 @@ class HashTable {
         // first such element (from the contiguous sequence of elements having
         // the same key).
 
+    bslalg::BidirectionalLink *find(const KeyType&     key,
+                                    native_std::size_t hashCode) const;
+        // Return the address of a link whose key has the same value as the
+        // specified 'key' (according to this hash-table's 'comparator'), and a
+        // null pointer value if no such link exists, using the specified
+        // 'hashCode' rather than computing the hash code of 'key'.  If this
+        // hash-table contains more than one element having the supplied
+        // 'key', return the first such element (from the contiguous sequence
+        // of elements having the same key).  The behavior is undefined unless
+        // 'hashCode' is the value returned by 'hasher()' for 'key'.
+
     bslalg::BidirectionalLink *findEndOfRange(
                                        bslalg::BidirectionalLink *first) const;
         // Return the address of the first node after any nodes holding a value
@@ -2920,6 +2931,26 @@ class HashTable {
         // the element following the range).  Also note that this hash-table
         // ensures all elements having the same key form a contiguous sequence.
 
+    template <class RESULT_TYPE, class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(FORWARD_ITERATOR first,
+                             FORWARD_ITERATOR last,
+                             OUTPUT_ITERATOR  result) const;
+        // Look up each key in the range starting at the specified 'first' and
+        // ending immediately before the specified 'last', and write to
+        // successive positions starting at the specified 'result' the address
+        // of the link that 'find' would return for that key, converted to the
+        // (template parameter) 'RESULT_TYPE'.  Return an iterator referring
+        // to the position immediately following the last value written.  The
+        // keys are processed in small groups: the hash codes of all the keys
+        // in a group are computed, and the buckets they select prefetched,
+        // before any of the buckets is probed, so that the memory latency of
+        // the lookups in a group overlaps.  'RESULT_TYPE' shall be
+        // constructible from 'bslalg::BidirectionalLink *'.  The behavior is
+        // undefined unless '[first, last)' is a valid range of a
+        // (template parameter) 'FORWARD_ITERATOR' type whose elements are
+        // convertible to 'KeyType', and the range starting at 'result' has
+        // room for 'distance(first, last)' values.
+
     bool hasSameValue(const HashTable& other) const;
         // Return 'true' if the specified 'other' has the same value as this
         // object, and 'false' otherwise.  Two 'HashTable' objects have the
@@ -2970,6 +3001,13 @@ class HashTable {
     SizeType numBuckets() const;
         // Return the number of buckets contained in this hash table.
 
+    void prefetchBucket(native_std::size_t hashCode) const;
+        // Hint to the processor to begin loading into the cache the bucket of
+        // this hash table that holds the elements having the specified
+        // 'hashCode'.  This function has no effect on the observable state of
+        // the program.  Note that a subsequent 'find' for 'hashCode' benefits
+        // only if enough time has elapsed for the load to complete.
+
     SizeType rehashThreshold() const;
         // Return the number of elements this hash table can hold without
         // requiring a rehash operation in order to respect the
@@ -6989,6 +7027,20 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                              d_parameters.hashCodeForKey(key));
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
+                                         const KeyType&     key,
+                                         native_std::size_t hashCode) const
+{
+    return bslalg::HashTableImpUtil::find<KEY_CONFIG>(
+                                                     d_anchor,
+                                                     key,
+                                                     d_parameters.comparator(),
+                                                     hashCode);
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findEndOfRange(
@@ -7032,6 +7084,51 @@ HashTable< KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findRange(
            : 0;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class RESULT_TYPE, class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findMany(
+                                          FORWARD_ITERATOR first,
+                                          FORWARD_ITERATOR last,
+                                          OUTPUT_ITERATOR  result) const
+{
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    // Each group of keys is processed in three passes: compute the hash codes
+    // and prefetch the buckets, then read the (now cached) buckets and
+    // prefetch their first elements, and finally probe.  A lookup therefore
+    // rarely waits on a cache miss that was not already in flight.
+
+    enum { k_GROUP_SIZE = 16 };
+
+    native_std::size_t hashCodes[k_GROUP_SIZE];
+
+    while (first != last) {
+        int count = 0;
+        for (FORWARD_ITERATOR it = first;
+             it != last && count < k_GROUP_SIZE;
+             ++it, ++count) {
+            const KeyType& key = *it;
+            hashCodes[count]   = d_parameters.hashCodeForKey(key);
+            ImpUtil::prefetchBucket(d_anchor, hashCodes[count]);
+        }
+
+        for (int i = 0; i < count; ++i) {
+            ImpUtil::prefetchBucketElements(d_anchor, hashCodes[i]);
+        }
+
+        for (int i = 0; i < count; ++i, ++first, ++result) {
+            const KeyType& key = *first;
+            *result = RESULT_TYPE(ImpUtil::find<KEY_CONFIG>(
+                                                     d_anchor,
+                                                     key,
+                                                     d_parameters.comparator(),
+                                                     hashCodes[i]));
+        }
+    }
+    return result;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 bool
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasSameValue(
@@ -7241,6 +7338,14 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::numBuckets() const
     return static_cast<SizeType>(d_anchor.bucketArraySize());
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::prefetchBucket(
+                                            native_std::size_t hashCode) const
+{
+    bslalg::HashTableImpUtil::prefetchBucket(d_anchor, hashCode);
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 typename HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
@@ -0,0 +1,1246 @@
+// bslstl_inplacefunction.h                                           -*-C++-*-
+#ifndef INCLUDED_BSLSTL_INPLACEFUNCTION
+#define INCLUDED_BSLSTL_INPLACEFUNCTION
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide polymorphic function wrappers that never allocate.
+//
+//@CLASSES:
+//  bsl::inplace_function: copyable function wrapper with inline storage only
+//  bsl::unique_function: move-only function wrapper with inline storage only
+//
+//@SEE_ALSO: bslstl_function
+//
+//@DESCRIPTION: This component provides two class templates,
+// 'bsl::inplace_function' and 'bsl::unique_function', that, like
+// 'bsl::function', wrap an arbitrary invocable object (the *target*) behind a
+// function prototype.  Unlike 'bsl::function', they store the target within
+// their own footprint, in a buffer whose size (the 'CAPACITY' template
+// parameter) is fixed at compile time, and so never allocate memory.  A target
+// that is too large for the buffer, or more strictly aligned than
+// 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT', is rejected at compile time
+// rather than being moved to the heap.
+//
+// The two templates differ only in the requirements they place on targets:
+//
+//: o An 'inplace_function' is copyable, and can wrap only copy-constructible
+//:   targets.
+//:
+//: o A 'unique_function' is move-only, and can wrap move-only targets, such as
+//:   a lambda that captures a 'bslma::ManagedPtr' or a 'unique_ptr'.  A
+//:   'unique_function' can be constructed from an 'inplace_function' having
+//:   the same prototype and no greater capacity, but not vice versa.
+//
+// Either template can be constructed from another specialization of the same
+// template having the same prototype and a smaller capacity; the target is
+// then copied or moved directly into the larger buffer rather than being
+// wrapped a second time.  The default capacity is the size of the buffer
+// 'bsl::function' uses for its small-object optimization, six pointers on
+// most platforms.
+//
+// Both templates mirror the subset of the 'bsl::function' interface that does
+// not involve allocators or type identification: they may be empty, tested
+// for emptiness, compared with a null pointer literal, swapped, and invoked.
+// Invoking an empty object throws 'bsl::bad_function_call' (or, in
+// non-exception builds, triggers an assertion failure).  The target is
+// invoked with the function-call syntax 'target(args...)'; pointers to member
+// functions must therefore be adapted, e.g., with 'bdlf::MemFnUtil', before
+// they can be wrapped.
+//
+// This component requires C++11 support for variadic templates and rvalue
+// references; when either is missing, it defines nothing.
+//
+///Choosing Between 'function' and 'inplace_function'
+///--------------------------------------------------
+// 'bsl::function' places a target in its in-place buffer only when the target
+// fits and has a non-throwing move constructor (or is bitwise moveable);
+// otherwise, each construction and copy of the 'bsl::function' allocates.
+// Many small lambdas fail the second test -- a lambda capturing an object
+// whose move constructor is not declared 'noexcept' is not nothrow movable --
+// and allocate although they would fit.  'inplace_function' and
+// 'unique_function' have no such restriction: they accept any target that
+// fits, at the cost of a move operation that may throw (see below) and of
+// rejecting, rather than accommodating, larger targets.
+//
+// Neither template carries an allocator.  A target that itself uses an
+// allocator is stored with the allocator it was constructed with, and a copy
+// of an 'inplace_function' holds a copy of the target made with that target's
+// copy constructor.
+//
+///Exception Safety
+///----------------
+// Moving or swapping an 'inplace_function' or 'unique_function' moves its
+// target, and so offers only the guarantees of the target's move constructor.
+// If that constructor throws while a target is being moved out of a source
+// object, the source object is left holding its (moved-from) target and the
+// destination object is left empty.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Queueing Callbacks Without Allocating
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a producer that hands small units of work to a consumer
+// through a fixed-size ring of slots, and that we want to avoid touching the
+// allocator on that path.
+//
+// First, we define the slot type; a lambda capturing a shared pointer and a
+// pair of integers fits easily within 48 bytes:
+//..
+//  typedef bsl::inplace_function<void(), 48> Task;
+//
+//  struct Counter {
+//      int d_total;
+//  };
+//..
+// Then, we create a counter shared between the producer and consumer and
+// fill a few slots with tasks that each add to it:
+//..
+//  bslma::TestAllocator ta;
+//  bslma::DefaultAllocatorGuard guard(&ta);
+//
+//  bsl::shared_ptr<Counter> counter;
+//  counter.createInplace(&ta);
+//  counter->d_total = 0;
+//
+//  const bsls::Types::Int64 numAllocations = ta.numAllocations();
+//
+//  Task ring[4];
+//  for (int i = 0; i < 4; ++i) {
+//      const int delta = i + 1;
+//      const int scale = 10;
+//      ring[i] = [counter, delta, scale]() {
+//          counter->d_total += delta * scale;
+//      };
+//  }
+//..
+// Now, the consumer invokes the tasks and clears the slots:
+//..
+//  for (int i = 0; i < 4; ++i) {
+//      ring[i]();
+//      ring[i] = nullptr;
+//  }
+//  assert(100 == counter->d_total);
+//..
+// Finally, we observe that neither storing nor invoking the tasks allocated
+// memory:
+//..
+//  assert(numAllocations == ta.numAllocations());
+//..
+//
+///Example 2: Wrapping a Move-Only Target
+/// - - - - - - - - - - - - - - - - - - -
+// A task that owns a resource cannot be held in a 'bsl::function' (or an
+// 'inplace_function'), which requires its target to be copyable.  A
+// 'unique_function' can hold it:
+//..
+//  struct Resource {
+//      int d_value;
+//  };
+//
+//  struct Release {
+//      bslma::ManagedPtr<Resource> d_resource;
+//
+//      int operator()() const { return d_resource->d_value; }
+//  };
+//
+//  bslma::ManagedPtr<Resource> resource(new (ta) Resource(), &ta);
+//  resource->d_value = 7;
+//
+//  Release release = { bslmf::MovableRefUtil::move(resource) };
+//
+//  bsl::unique_function<int()> task(bslmf::MovableRefUtil::move(release));
+//  assert(7 == task());
+//
+//  bsl::unique_function<int()> other(bslmf::MovableRefUtil::move(task));
+//  assert(!task);
+//  assert(7 == other());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_function.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_decay.h>
+#include <bslmf_enableif.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_keyword.h>
+#include <bsls_nullptr.h>
+#include <bsls_util.h>
+
+#include <cstddef>
+#include <new>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+
+namespace bsl {
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+class inplace_function;
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+class unique_function;
+
+}  // close namespace bsl
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ===========================
+                        // struct InplaceFunction_Util
+                        // ===========================
+
+struct InplaceFunction_Util {
+    // This component-private 'struct' provides a namespace for the
+    // type-erased operations on the target of an 'inplace_function' or
+    // 'unique_function'.
+
+    // TYPES
+    typedef bsl::Function_SmallObjectOptimization::InplaceBuffer
+                                                                FunctionBuffer;
+
+    enum {
+        k_DEFAULT_CAPACITY = sizeof(FunctionBuffer)
+            // default capacity of 'inplace_function' and 'unique_function',
+            // matching the in-place buffer of 'bsl::function'
+    };
+
+    enum OpCode {
+        // This enumeration identifies the operations performed by a 'Manager'
+        // function on the target objects at its 'to' and 'from' arguments.
+
+        e_COPY_CONSTRUCT,  // copy-construct 'to' from 'from'
+        e_RELOCATE,        // move-construct 'to' from 'from', destroy 'from'
+        e_DESTROY          // destroy 'from'
+    };
+
+    typedef void (*Manager)(OpCode opCode, void *to, void *from);
+        // 'Manager' is an alias for a pointer to a function that performs the
+        // specified 'opCode' on objects of a specific (erased) type at the
+        // specified 'to' and 'from' addresses.
+
+    // CLASS METHODS
+    template <class FUNC>
+    static void copy(void *to, const void *from, bsl::true_type);
+    template <class FUNC>
+    static void copy(void *to, const void *from, bsl::false_type);
+        // Copy-construct a 'FUNC' object at the specified 'to' address from
+        // the 'FUNC' object at the specified 'from' address.  The behavior is
+        // undefined for the 'bsl::false_type' overload, which is never called
+        // (it exists so that 'manage' compiles for move-only 'FUNC' types).
+
+    template <class FUNC>
+    static bool isNull(const FUNC&);
+    template <class FUNC>
+    static bool isNull(FUNC *ptr);
+    template <class PROTOTYPE>
+    static bool isNull(const bsl::function<PROTOTYPE>& func);
+        // Return 'true' if the specified invocable object, when wrapped,
+        // should result in an empty wrapper (i.e., it is a null function
+        // pointer or an empty 'bsl::function'), and 'false' otherwise.
+
+    template <class FUNC, bool IS_COPYABLE>
+    static void manage(OpCode opCode, void *to, void *from);
+        // Perform the specified 'opCode' on the 'FUNC' objects at the
+        // specified 'to' and 'from' addresses.  The behavior is undefined if
+        // 'opCode' is 'e_COPY_CONSTRUCT' and 'IS_COPYABLE' is 'false'.
+};
+
+                        // ===========================
+                        // struct InplaceFunction_Call
+                        // ===========================
+
+template <class RET>
+struct InplaceFunction_Call {
+    // This component-private 'struct' provides a namespace for a function
+    // that invokes a target and converts its result to 'RET'.
+
+    // CLASS METHODS
+    template <class FUNC, class... ARGS>
+    static RET call(FUNC& func, ARGS&&... args);
+        // Return the result of invoking the specified 'func' with the
+        // specified 'args', implicitly converted to 'RET'.
+};
+
+template <>
+struct InplaceFunction_Call<void> {
+    // This specialization of 'InplaceFunction_Call' discards the
+    // result of the target, as required for a 'void' prototype.
+
+    // CLASS METHODS
+    template <class FUNC, class... ARGS>
+    static void call(FUNC& func, ARGS&&... args);
+        // Invoke the specified 'func' with the specified 'args', discarding
+        // any result.
+};
+
+                      // ================================
+                      // struct InplaceFunction_IsWrapper
+                      // ================================
+
+template <class TYPE, class PROTOTYPE>
+struct InplaceFunction_IsWrapper : bsl::false_type {
+    // This component-private metafunction derives from 'bsl::true_type' if
+    // (the template parameter) 'TYPE' is an 'inplace_function' or
+    // 'unique_function' having (the template parameter) 'PROTOTYPE', and from
+    // 'bsl::false_type' otherwise.  Such types are copied or moved by the
+    // converting constructors, rather than wrapped, when the prototypes
+    // match.
+};
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+struct InplaceFunction_IsWrapper<bsl::inplace_function<PROTOTYPE, CAPACITY>,
+                                 PROTOTYPE> : bsl::true_type {
+};
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+struct InplaceFunction_IsWrapper<bsl::unique_function<PROTOTYPE, CAPACITY>,
+                                 PROTOTYPE> : bsl::true_type {
+};
+
+                         // =========================
+                         // class InplaceFunction_Imp
+                         // =========================
+
+template <class PROTOTYPE, std::size_t CAPACITY, bool IS_COPYABLE>
+class InplaceFunction_Imp;
+    // This component-private class template provides the implementation of
+    // 'inplace_function' (when 'IS_COPYABLE' is 'true') and 'unique_function'
+    // (when 'IS_COPYABLE' is 'false').  It is defined only for function
+    // prototypes.
+
+template <class RET, class... ARGS, std::size_t CAPACITY, bool IS_COPYABLE>
+class InplaceFunction_Imp<RET(ARGS...), CAPACITY, IS_COPYABLE> {
+    // This partial specialization stores a target, if any, in a buffer of
+    // 'CAPACITY' bytes, along with pointers to functions that manage and
+    // invoke it.  The derived classes supply the copy and move semantics.
+
+    // PRIVATE TYPES
+    typedef InplaceFunction_Util Util;
+
+    typedef RET (*Invoker)(void *target, ARGS&&... args);
+        // 'Invoker' is an alias for a pointer to a function that invokes the
+        // (erased) target at the specified 'target' address with the
+        // specified 'args'.
+
+    // DATA
+    mutable BloombergLP::bsls::AlignedBuffer<CAPACITY>
+                  d_buffer;     // storage for the target
+
+    Util::Manager d_manager_p;  // manager for the target, or 0 if empty
+
+    Invoker       d_invoker_p;  // invoker for the target, or 0 if empty
+
+    // FRIENDS
+    template <class, std::size_t, bool>
+    friend class InplaceFunction_Imp;
+
+    // PRIVATE CLASS METHODS
+    template <class FUNC>
+    static RET invokeTarget(void *target, ARGS&&... args);
+        // Return the result of invoking the 'FUNC' object at the specified
+        // 'target' address with the specified 'args'.
+
+  private:
+    // NOT IMPLEMENTED
+    InplaceFunction_Imp(const InplaceFunction_Imp&) BSLS_KEYWORD_DELETED;
+    InplaceFunction_Imp& operator=(const InplaceFunction_Imp&)
+                                                          BSLS_KEYWORD_DELETED;
+
+  protected:
+    // CREATORS
+    InplaceFunction_Imp() BSLS_KEYWORD_NOEXCEPT;
+        // Create an empty object.
+
+    ~InplaceFunction_Imp();
+        // Destroy this object and its target, if any.
+
+    // MANIPULATORS
+    template <class FUNC>
+    void initTarget(FUNC&& func);
+        // Store in this object a target constructed from the specified 'func'
+        // (or leave this object empty if 'func' is a null function pointer or
+        // an empty 'bsl::function').  The behavior is undefined unless this
+        // object is empty.  Compilation fails unless the decayed type of
+        // 'func' fits within 'CAPACITY' bytes, is not over-aligned, and, when
+        // 'IS_COPYABLE' is 'true', is copy-constructible.
+
+    template <std::size_t OTHER_CAPACITY>
+    void initCopy(const InplaceFunction_Imp<RET(ARGS...),
+                                            OTHER_CAPACITY,
+                                            true>& other);
+        // Store in this object a copy of the target of the specified 'other'
+        // object, if any.  The behavior is undefined unless this object is
+        // empty.  Compilation fails unless 'OTHER_CAPACITY <= CAPACITY'.
+
+    template <std::size_t OTHER_CAPACITY, bool OTHER_IS_COPYABLE>
+    void initMove(InplaceFunction_Imp<RET(ARGS...),
+                                      OTHER_CAPACITY,
+                                      OTHER_IS_COPYABLE>& other);
+        // Move the target of the specified 'other' object, if any, to this
+        // object, leaving 'other' empty.  The behavior is undefined unless
+        // this object is empty.  Compilation fails unless
+        // 'OTHER_CAPACITY <= CAPACITY', and 'OTHER_IS_COPYABLE' is 'true' if
+        // 'IS_COPYABLE' is 'true'.
+
+    void reset() BSLS_KEYWORD_NOEXCEPT;
+        // Destroy the target of this object, if any, leaving this object
+        // empty.
+
+    void swapImp(InplaceFunction_Imp& other);
+        // Exchange the targets of this object and the specified 'other'
+        // object.
+
+  public:
+    // TYPES
+    typedef RET result_type;
+
+    // ACCESSORS
+    RET operator()(ARGS... args) const;
+        // Invoke the target of this object with the specified 'args' and
+        // return the result.  If this object is empty, throw
+        // 'bsl::bad_function_call' (or, if exceptions are disabled, trigger an
+        // assertion failure).
+
+    explicit operator bool() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this object is not empty, and 'false' otherwise.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                           // ======================
+                           // class inplace_function
+                           // ======================
+
+template <class PROTOTYPE,
+          std::size_t CAPACITY = BloombergLP::bslstl::InplaceFunction_Util::
+                                                            k_DEFAULT_CAPACITY>
+class inplace_function
+: public BloombergLP::bslstl::InplaceFunction_Imp<PROTOTYPE, CAPACITY, true> {
+    // This class template provides a copyable wrapper for an invocable object
+    // having the specified 'PROTOTYPE', holding it in a buffer of 'CAPACITY'
+    // bytes within the 'inplace_function' object itself.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::InplaceFunction_Imp<PROTOTYPE, CAPACITY, true>
+                                                                          Base;
+
+    template <class FUNC>
+    struct IsTarget : bsl::integral_constant<bool,
+                      !BloombergLP::bslstl::InplaceFunction_IsWrapper<
+                                      typename bsl::decay<FUNC>::type,
+                                      PROTOTYPE>::value> {
+        // This metafunction is 'true' for the types from which an
+        // 'inplace_function' is constructed by wrapping.
+    };
+
+  public:
+    // CREATORS
+    inplace_function() BSLS_KEYWORD_NOEXCEPT;
+    inplace_function(bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT;         // IMPLICIT
+        // Create an empty 'inplace_function'.
+
+    template <class FUNC>
+    inplace_function(FUNC&& func,
+                     typename bsl::enable_if<IsTarget<FUNC>::value>::type * =
+                                                                        0);
+                                                                    // IMPLICIT
+        // Create an 'inplace_function' whose target is constructed from the
+        // specified 'func', or an empty 'inplace_function' if 'func' is a null
+        // function pointer or an empty 'bsl::function'.  Compilation fails
+        // unless the decayed type of 'func' is copy-constructible, is no
+        // larger than 'CAPACITY' bytes, and is not over-aligned.
+
+    inplace_function(const inplace_function& original);
+    template <std::size_t OTHER_CAPACITY>
+    inplace_function(
+                const inplace_function<PROTOTYPE, OTHER_CAPACITY>& original);
+                                                                    // IMPLICIT
+        // Create an 'inplace_function' holding a copy of the target of the
+        // specified 'original' object, if any.  Compilation fails unless
+        // 'OTHER_CAPACITY <= CAPACITY'.
+
+    inplace_function(inplace_function&& original);
+    template <std::size_t OTHER_CAPACITY>
+    inplace_function(inplace_function<PROTOTYPE, OTHER_CAPACITY>&& original);
+                                                                    // IMPLICIT
+        // Create an 'inplace_function' holding the target of the specified
+        // 'original' object, if any, moved from 'original', which is left
+        // empty.  Compilation fails unless 'OTHER_CAPACITY <= CAPACITY'.
+
+    //! ~inplace_function() = default;
+        // Destroy this object and its target, if any.
+
+    // MANIPULATORS
+    inplace_function& operator=(const inplace_function& rhs);
+        // Make the target of this object a copy of the target of the specified
+        // 'rhs' object, destroying the previous target of this object, and
+        // return a reference providing modifiable access to this object.
+
+    inplace_function& operator=(inplace_function&& rhs);
+        // Move the target of the specified 'rhs' object to this object,
+        // destroying the previous target of this object and leaving 'rhs'
+        // empty, and return a reference providing modifiable access to this
+        // object.
+
+    inplace_function& operator=(bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+        // Destroy the target of this object, if any, and return a reference
+        // providing modifiable access to this (now empty) object.
+
+    template <class FUNC>
+    typename bsl::enable_if<IsTarget<FUNC>::value, inplace_function&>::type
+    operator=(FUNC&& func);
+        // Replace the target of this object with one constructed from the
+        // specified 'func' (see the corresponding constructor), and return a
+        // reference providing modifiable access to this object.
+
+    void swap(inplace_function& other);
+        // Exchange the targets of this object and the specified 'other'
+        // object.
+};
+
+                           // =====================
+                           // class unique_function
+                           // =====================
+
+template <class PROTOTYPE,
+          std::size_t CAPACITY = BloombergLP::bslstl::InplaceFunction_Util::
+                                                            k_DEFAULT_CAPACITY>
+class unique_function
+: public BloombergLP::bslstl::InplaceFunction_Imp<PROTOTYPE, CAPACITY, false> {
+    // This class template provides a move-only wrapper for an invocable
+    // object having the specified 'PROTOTYPE', holding it in a buffer of
+    // 'CAPACITY' bytes within the 'unique_function' object itself.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::InplaceFunction_Imp<PROTOTYPE,
+                                                     CAPACITY,
+                                                     false> Base;
+
+    template <class FUNC>
+    struct IsTarget : bsl::integral_constant<bool,
+                      !BloombergLP::bslstl::InplaceFunction_IsWrapper<
+                                      typename bsl::decay<FUNC>::type,
+                                      PROTOTYPE>::value> {
+        // This metafunction is 'true' for the types from which a
+        // 'unique_function' is constructed by wrapping.
+    };
+
+  private:
+    // NOT IMPLEMENTED
+    unique_function(const unique_function&) BSLS_KEYWORD_DELETED;
+    unique_function& operator=(const unique_function&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+    unique_function() BSLS_KEYWORD_NOEXCEPT;
+    unique_function(bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT;          // IMPLICIT
+        // Create an empty 'unique_function'.
+
+    template <class FUNC>
+    unique_function(FUNC&& func,
+                    typename bsl::enable_if<IsTarget<FUNC>::value>::type * =
+                                                                        0);
+                                                                    // IMPLICIT
+        // Create a 'unique_function' whose target is constructed from the
+        // specified 'func', or an empty 'unique_function' if 'func' is a null
+        // function pointer or an empty 'bsl::function'.  Compilation fails
+        // unless the decayed type of 'func' is move-constructible, is no
+        // larger than 'CAPACITY' bytes, and is not over-aligned.
+
+    unique_function(unique_function&& original);
+    template <std::size_t OTHER_CAPACITY>
+    unique_function(unique_function<PROTOTYPE, OTHER_CAPACITY>&& original);
+                                                                    // IMPLICIT
+    template <std::size_t OTHER_CAPACITY>
+    unique_function(inplace_function<PROTOTYPE, OTHER_CAPACITY>&& original);
+                                                                    // IMPLICIT
+        // Create a 'unique_function' holding the target of the specified
+        // 'original' object, if any, moved from 'original', which is left
+        // empty.  Compilation fails unless 'OTHER_CAPACITY <= CAPACITY'.
+
+    template <std::size_t OTHER_CAPACITY>
+    unique_function(
+                const inplace_function<PROTOTYPE, OTHER_CAPACITY>& original);
+                                                                    // IMPLICIT
+        // Create a 'unique_function' holding a copy of the target of the
+        // specified 'original' object, if any.  Compilation fails unless
+        // 'OTHER_CAPACITY <= CAPACITY'.
+
+    //! ~unique_function() = default;
+        // Destroy this object and its target, if any.
+
+    // MANIPULATORS
+    unique_function& operator=(unique_function&& rhs);
+        // Move the target of the specified 'rhs' object to this object,
+        // destroying the previous target of this object and leaving 'rhs'
+        // empty, and return a reference providing modifiable access to this
+        // object.
+
+    unique_function& operator=(bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+        // Destroy the target of this object, if any, and return a reference
+        // providing modifiable access to this (now empty) object.
+
+    template <class FUNC>
+    typename bsl::enable_if<IsTarget<FUNC>::value, unique_function&>::type
+    operator=(FUNC&& func);
+        // Replace the target of this object with one constructed from the
+        // specified 'func' (see the corresponding constructor), and return a
+        // reference providing modifiable access to this object.
+
+    void swap(unique_function& other);
+        // Exchange the targets of this object and the specified 'other'
+        // object.
+};
+
+// FREE OPERATORS
+template <class PROTOTYPE, std::size_t CAPACITY>
+bool operator==(const inplace_function<PROTOTYPE, CAPACITY>& func,
+                bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, std::size_t CAPACITY>
+bool operator==(bsl::nullptr_t,
+                const inplace_function<PROTOTYPE, CAPACITY>& func)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, std::size_t CAPACITY>
+bool operator==(const unique_function<PROTOTYPE, CAPACITY>& func,
+                bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, std::size_t CAPACITY>
+bool operator==(bsl::nullptr_t,
+                const unique_function<PROTOTYPE, CAPACITY>& func)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+    // Return 'true' if the specified 'func' is empty, and 'false' otherwise.
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+bool operator!=(const inplace_function<PROTOTYPE, CAPACITY>& func,
+                bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, std::size_t CAPACITY>
+bool operator!=(bsl::nullptr_t,
+                const inplace_function<PROTOTYPE, CAPACITY>& func)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, std::size_t CAPACITY>
+bool operator!=(const unique_function<PROTOTYPE, CAPACITY>& func,
+                bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, std::size_t CAPACITY>
+bool operator!=(bsl::nullptr_t,
+                const unique_function<PROTOTYPE, CAPACITY>& func)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+    // Return 'true' if the specified 'func' is not empty, and 'false'
+    // otherwise.
+
+// FREE FUNCTIONS
+template <class PROTOTYPE, std::size_t CAPACITY>
+void swap(inplace_function<PROTOTYPE, CAPACITY>& a,
+          inplace_function<PROTOTYPE, CAPACITY>& b);
+template <class PROTOTYPE, std::size_t CAPACITY>
+void swap(unique_function<PROTOTYPE, CAPACITY>& a,
+          unique_function<PROTOTYPE, CAPACITY>& b);
+    // Exchange the targets of the specified 'a' and 'b' objects.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ---------------------------
+                        // struct InplaceFunction_Util
+                        // ---------------------------
+
+// CLASS METHODS
+template <class FUNC>
+inline
+void InplaceFunction_Util::copy(void *to, const void *from, bsl::true_type)
+{
+    ::new (to) FUNC(*static_cast<const FUNC *>(from));
+}
+
+template <class FUNC>
+inline
+void InplaceFunction_Util::copy(void *, const void *, bsl::false_type)
+{
+    BSLS_ASSERT_OPT(!"unreachable: copying a move-only target");
+}
+
+template <class FUNC>
+inline
+bool InplaceFunction_Util::isNull(const FUNC&)
+{
+    return false;
+}
+
+template <class FUNC>
+inline
+bool InplaceFunction_Util::isNull(FUNC *ptr)
+{
+    return 0 == ptr;
+}
+
+template <class PROTOTYPE>
+inline
+bool InplaceFunction_Util::isNull(const bsl::function<PROTOTYPE>& func)
+{
+    return !func;
+}
+
+template <class FUNC, bool IS_COPYABLE>
+void InplaceFunction_Util::manage(OpCode opCode, void *to, void *from)
+{
+    FUNC *source = static_cast<FUNC *>(from);
+
+    switch (opCode) {
+      case e_COPY_CONSTRUCT: {
+        copy<FUNC>(to, source, bsl::integral_constant<bool, IS_COPYABLE>());
+      } break;
+      case e_RELOCATE: {
+        ::new (to) FUNC(bslmf::MovableRefUtil::move(*source));
+        source->~FUNC();
+      } break;
+      case e_DESTROY: {
+        source->~FUNC();
+      } break;
+    }
+}
+
+                        // ---------------------------
+                        // struct InplaceFunction_Call
+                        // ---------------------------
+
+// CLASS METHODS
+template <class RET>
+template <class FUNC, class... ARGS>
+inline
+RET InplaceFunction_Call<RET>::call(FUNC& func, ARGS&&... args)
+{
+    return func(BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+}
+
+template <class FUNC, class... ARGS>
+inline
+void InplaceFunction_Call<void>::call(FUNC& func, ARGS&&... args)
+{
+    func(BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+}
+
+                         // -------------------------
+                         // class InplaceFunction_Imp
+                         // -------------------------
+
+// PRIVATE CLASS METHODS
+template <class RET, class... ARGS, std::size_t CAPACITY, bool IS_COPYABLE>
+template <class FUNC>
+RET InplaceFunction_Imp<RET(ARGS...), CAPACITY, IS_COPYABLE>::invokeTarget(
+                                                          void     *target,
+                                                          ARGS&&... args)
+{
+    return InplaceFunction_Call<RET>::call(
+                                *static_cast<FUNC *>(target),
+                                BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+}
+
+// CREATORS
+template <class RET, class... ARGS, std::size_t CAPACITY, bool IS_COPYABLE>
+inline
+InplaceFunction_Imp<RET(ARGS...), CAPACITY, IS_COPYABLE>::InplaceFunction_Imp()
+                                                          BSLS_KEYWORD_NOEXCEPT
+: d_manager_p(0)
+, d_invoker_p(0)
+{
+}
+
+template <class RET, class... ARGS, std::size_t CAPACITY, bool IS_COPYABLE>
+inline
+InplaceFunction_Imp<RET(ARGS...), CAPACITY, IS_COPYABLE>::
+                                                         ~InplaceFunction_Imp()
+{
+    reset();
+}
+
+// MANIPULATORS
+template <class RET, class... ARGS, std::size_t CAPACITY, bool IS_COPYABLE>
+template <class FUNC>
+void InplaceFunction_Imp<RET(ARGS...), CAPACITY, IS_COPYABLE>::initTarget(
+                                                                  FUNC&& func)
+{
+    typedef typename bsl::decay<FUNC>::type Target;
+
+    // A target that does not fit is a compile-time error, not a reason to
+    // allocate.
+
+    BSLMF_ASSERT(sizeof(Target) <= CAPACITY);
+    BSLMF_ASSERT(static_cast<int>(bsls::AlignmentFromType<Target>::VALUE) <=
+                 static_cast<int>(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT));
+
+    BSLS_ASSERT_SAFE(!d_manager_p);
+
+    if (Util::isNull(func)) {
+        return;                                                       // RETURN
+    }
+
+    ::new (d_buffer.buffer()) Target(BSLS_COMPILERFEATURES_FORWARD(FUNC,
+                                                                   func));
+    d_manager_p = &Util::manage<Target, IS_COPYABLE>;
+    d_invoker_p = &invokeTarget<Target>;
+}
+
+template <class RET, class... ARGS, std::size_t CAPACITY, bool IS_COPYABLE>
+template <std::size_t OTHER_CAPACITY>
+void InplaceFunction_Imp<RET(ARGS...), CAPACITY, IS_COPYABLE>::initCopy(
+                                  const InplaceFunction_Imp<RET(ARGS...),
+                                                            OTHER_CAPACITY,
+                                                            true>& other)
+{
+    BSLMF_ASSERT(OTHER_CAPACITY <= CAPACITY);
+
+    BSLS_ASSERT_SAFE(!d_manager_p);
+
+    if (other.d_manager_p) {
+        other.d_manager_p(Util::e_COPY_CONSTRUCT,
+                          d_buffer.buffer(),
+                          other.d_buffer.buffer());
+        d_manager_p = other.d_manager_p;
+        d_invoker_p = other.d_invoker_p;
+    }
+}
+
+template <class RET, class... ARGS, std::size_t CAPACITY, bool IS_COPYABLE>
+template <std::size_t OTHER_CAPACITY, bool OTHER_IS_COPYABLE>
+void InplaceFunction_Imp<RET(ARGS...), CAPACITY, IS_COPYABLE>::initMove(
+                              InplaceFunction_Imp<RET(ARGS...),
+                                                  OTHER_CAPACITY,
+                                                  OTHER_IS_COPYABLE>& other)
+{
+    BSLMF_ASSERT(OTHER_CAPACITY <= CAPACITY);
+    BSLMF_ASSERT(OTHER_IS_COPYABLE || !IS_COPYABLE);
+
+    BSLS_ASSERT_SAFE(!d_manager_p);
+
+    if (other.d_manager_p) {
+        other.d_manager_p(Util::e_RELOCATE,
+                          d_buffer.buffer(),
+                          other.d_buffer.buffer());
+        d_manager_p       = other.d_manager_p;
+        d_invoker_p       = other.d_invoker_p;
+        other.d_manager_p = 0;
+        other.d_invoker_p = 0;
+    }
+}
+
+template <class RET, class... ARGS, std::size_t CAPACITY, bool IS_COPYABLE>
+inline
+void InplaceFunction_Imp<RET(ARGS...), CAPACITY, IS_COPYABLE>::reset()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    if (d_manager_p) {
+        d_manager_p(Util::e_DESTROY, 0, d_buffer.buffer());
+        d_manager_p = 0;
+        d_invoker_p = 0;
+    }
+}
+
+template <class RET, class... ARGS, std::size_t CAPACITY, bool IS_COPYABLE>
+void InplaceFunction_Imp<RET(ARGS...), CAPACITY, IS_COPYABLE>::swapImp(
+                                                   InplaceFunction_Imp& other)
+{
+    if (this == &other) {
+        return;                                                       // RETURN
+    }
+
+    InplaceFunction_Imp temp;
+    temp.initMove(other);
+    other.initMove(*this);
+    initMove(temp);
+}
+
+// ACCESSORS
+template <class RET, class... ARGS, std::size_t CAPACITY, bool IS_COPYABLE>
+inline
+RET InplaceFunction_Imp<RET(ARGS...), CAPACITY, IS_COPYABLE>::operator()(
+                                                           ARGS... args) const
+{
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!d_invoker_p) {
+        BSLS_THROW(bsl::bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(d_invoker_p);
+#endif
+
+    return d_invoker_p(d_buffer.buffer(),
+                       BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+}
+
+template <class RET, class... ARGS, std::size_t CAPACITY, bool IS_COPYABLE>
+inline
+InplaceFunction_Imp<RET(ARGS...), CAPACITY, IS_COPYABLE>::operator bool() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return 0 != d_invoker_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                           // ----------------------
+                           // class inplace_function
+                           // ----------------------
+
+// CREATORS
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+inplace_function<PROTOTYPE, CAPACITY>::inplace_function() BSLS_KEYWORD_NOEXCEPT
+: Base()
+{
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+inplace_function<PROTOTYPE, CAPACITY>::inplace_function(bsl::nullptr_t)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: Base()
+{
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+template <class FUNC>
+inline
+inplace_function<PROTOTYPE, CAPACITY>::inplace_function(
+                 FUNC&&                                                  func,
+                 typename bsl::enable_if<IsTarget<FUNC>::value>::type *)
+: Base()
+{
+    this->initTarget(BSLS_COMPILERFEATURES_FORWARD(FUNC, func));
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+inplace_function<PROTOTYPE, CAPACITY>::inplace_function(
+                                              const inplace_function& original)
+: Base()
+{
+    this->initCopy(original);
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+template <std::size_t OTHER_CAPACITY>
+inline
+inplace_function<PROTOTYPE, CAPACITY>::inplace_function(
+                  const inplace_function<PROTOTYPE, OTHER_CAPACITY>& original)
+: Base()
+{
+    this->initCopy(original);
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+inplace_function<PROTOTYPE, CAPACITY>::inplace_function(
+                                                   inplace_function&& original)
+: Base()
+{
+    this->initMove(original);
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+template <std::size_t OTHER_CAPACITY>
+inline
+inplace_function<PROTOTYPE, CAPACITY>::inplace_function(
+                       inplace_function<PROTOTYPE, OTHER_CAPACITY>&& original)
+: Base()
+{
+    this->initMove(original);
+}
+
+// MANIPULATORS
+template <class PROTOTYPE, std::size_t CAPACITY>
+inplace_function<PROTOTYPE, CAPACITY>&
+inplace_function<PROTOTYPE, CAPACITY>::operator=(const inplace_function& rhs)
+{
+    if (this != &rhs) {
+        inplace_function temp(rhs);
+        this->reset();
+        this->initMove(temp);
+    }
+    return *this;
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inplace_function<PROTOTYPE, CAPACITY>&
+inplace_function<PROTOTYPE, CAPACITY>::operator=(inplace_function&& rhs)
+{
+    if (this != &rhs) {
+        this->reset();
+        this->initMove(rhs);
+    }
+    return *this;
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+inplace_function<PROTOTYPE, CAPACITY>&
+inplace_function<PROTOTYPE, CAPACITY>::operator=(bsl::nullptr_t)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    this->reset();
+    return *this;
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+template <class FUNC>
+typename bsl::enable_if<
+     inplace_function<PROTOTYPE, CAPACITY>::template IsTarget<FUNC>::value,
+     inplace_function<PROTOTYPE, CAPACITY>&>::type
+inplace_function<PROTOTYPE, CAPACITY>::operator=(FUNC&& func)
+{
+    inplace_function temp(BSLS_COMPILERFEATURES_FORWARD(FUNC, func));
+    this->reset();
+    this->initMove(temp);
+    return *this;
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+void inplace_function<PROTOTYPE, CAPACITY>::swap(inplace_function& other)
+{
+    this->swapImp(other);
+}
+
+                           // ---------------------
+                           // class unique_function
+                           // ---------------------
+
+// CREATORS
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+unique_function<PROTOTYPE, CAPACITY>::unique_function() BSLS_KEYWORD_NOEXCEPT
+: Base()
+{
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+unique_function<PROTOTYPE, CAPACITY>::unique_function(bsl::nullptr_t)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: Base()
+{
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+template <class FUNC>
+inline
+unique_function<PROTOTYPE, CAPACITY>::unique_function(
+                 FUNC&&                                                  func,
+                 typename bsl::enable_if<IsTarget<FUNC>::value>::type *)
+: Base()
+{
+    this->initTarget(BSLS_COMPILERFEATURES_FORWARD(FUNC, func));
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+unique_function<PROTOTYPE, CAPACITY>::unique_function(
+                                                    unique_function&& original)
+: Base()
+{
+    this->initMove(original);
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+template <std::size_t OTHER_CAPACITY>
+inline
+unique_function<PROTOTYPE, CAPACITY>::unique_function(
+                        unique_function<PROTOTYPE, OTHER_CAPACITY>&& original)
+: Base()
+{
+    this->initMove(original);
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+template <std::size_t OTHER_CAPACITY>
+inline
+unique_function<PROTOTYPE, CAPACITY>::unique_function(
+                       inplace_function<PROTOTYPE, OTHER_CAPACITY>&& original)
+: Base()
+{
+    this->initMove(original);
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+template <std::size_t OTHER_CAPACITY>
+inline
+unique_function<PROTOTYPE, CAPACITY>::unique_function(
+                  const inplace_function<PROTOTYPE, OTHER_CAPACITY>& original)
+: Base()
+{
+    this->initCopy(original);
+}
+
+// MANIPULATORS
+template <class PROTOTYPE, std::size_t CAPACITY>
+unique_function<PROTOTYPE, CAPACITY>&
+unique_function<PROTOTYPE, CAPACITY>::operator=(unique_function&& rhs)
+{
+    if (this != &rhs) {
+        this->reset();
+        this->initMove(rhs);
+    }
+    return *this;
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+unique_function<PROTOTYPE, CAPACITY>&
+unique_function<PROTOTYPE, CAPACITY>::operator=(bsl::nullptr_t)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    this->reset();
+    return *this;
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+template <class FUNC>
+typename bsl::enable_if<
+      unique_function<PROTOTYPE, CAPACITY>::template IsTarget<FUNC>::value,
+      unique_function<PROTOTYPE, CAPACITY>&>::type
+unique_function<PROTOTYPE, CAPACITY>::operator=(FUNC&& func)
+{
+    unique_function temp(BSLS_COMPILERFEATURES_FORWARD(FUNC, func));
+    this->reset();
+    this->initMove(temp);
+    return *this;
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+void unique_function<PROTOTYPE, CAPACITY>::swap(unique_function& other)
+{
+    this->swapImp(other);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator==(const inplace_function<PROTOTYPE, CAPACITY>& func,
+                     bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT
+{
+    return !func;
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator==(bsl::nullptr_t,
+                     const inplace_function<PROTOTYPE, CAPACITY>& func)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return !func;
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator==(const unique_function<PROTOTYPE, CAPACITY>& func,
+                     bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT
+{
+    return !func;
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator==(bsl::nullptr_t,
+                     const unique_function<PROTOTYPE, CAPACITY>& func)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return !func;
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator!=(const inplace_function<PROTOTYPE, CAPACITY>& func,
+                     bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT
+{
+    return static_cast<bool>(func);
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator!=(bsl::nullptr_t,
+                     const inplace_function<PROTOTYPE, CAPACITY>& func)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return static_cast<bool>(func);
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator!=(const unique_function<PROTOTYPE, CAPACITY>& func,
+                     bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT
+{
+    return static_cast<bool>(func);
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator!=(bsl::nullptr_t,
+                     const unique_function<PROTOTYPE, CAPACITY>& func)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return static_cast<bool>(func);
+}
+
+// FREE FUNCTIONS
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+void bsl::swap(inplace_function<PROTOTYPE, CAPACITY>& a,
+               inplace_function<PROTOTYPE, CAPACITY>& b)
+{
+    a.swap(b);
+}
+
+template <class PROTOTYPE, std::size_t CAPACITY>
+inline
+void bsl::swap(unique_function<PROTOTYPE, CAPACITY>& a,
+               unique_function<PROTOTYPE, CAPACITY>& b)
+{
+    a.swap(b);
+}
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES &&
+        // BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
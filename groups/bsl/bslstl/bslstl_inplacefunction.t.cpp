@@ -0,0 +1,1073 @@
+// bslstl_inplacefunction.t.cpp                                       -*-C++-*-
+#include <bslstl_inplacefunction.h>
+
+#include <bslstl_function.h>
+#include <bslstl_sharedptr.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_managedptr.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_issame.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test defines two function wrappers that hold their
+// target in a buffer of fixed size within the object.  The concerns specific
+// to these wrappers are that no operation ever allocates memory, that the
+// target is constructed, copied, moved, and destroyed exactly when expected
+// (including when moving between wrappers of different capacities and from
+// an 'inplace_function' to a 'unique_function'), that arguments are forwarded
+// to the target without extra copies, and that invoking an empty wrapper is
+// reported as 'bsl::function' reports it.  A target that does not fit is a
+// compile-time error, and so cannot be tested here.
+// ----------------------------------------------------------------------------
+// 'inplace_function' CREATORS
+// [ 2] inplace_function();
+// [ 2] inplace_function(nullptr_t);
+// [ 2] inplace_function(FUNC&&);
+// [ 2] inplace_function(const inplace_function&);
+// [ 2] inplace_function(const inplace_function<PROTOTYPE, OTHER>&);
+// [ 2] inplace_function(inplace_function&&);
+// [ 2] inplace_function(inplace_function<PROTOTYPE, OTHER>&&);
+// [ 2] ~inplace_function();
+//
+// 'inplace_function' MANIPULATORS
+// [ 2] inplace_function& operator=(const inplace_function&);
+// [ 2] inplace_function& operator=(inplace_function&&);
+// [ 2] inplace_function& operator=(nullptr_t);
+// [ 2] inplace_function& operator=(FUNC&&);
+// [ 5] void swap(inplace_function&);
+//
+// 'unique_function' CREATORS
+// [ 4] unique_function();
+// [ 4] unique_function(nullptr_t);
+// [ 4] unique_function(FUNC&&);
+// [ 4] unique_function(unique_function&&);
+// [ 4] unique_function(unique_function<PROTOTYPE, OTHER>&&);
+// [ 4] unique_function(inplace_function<PROTOTYPE, OTHER>&&);
+// [ 4] unique_function(const inplace_function<PROTOTYPE, OTHER>&);
+// [ 4] ~unique_function();
+//
+// 'unique_function' MANIPULATORS
+// [ 4] unique_function& operator=(unique_function&&);
+// [ 4] unique_function& operator=(nullptr_t);
+// [ 4] unique_function& operator=(FUNC&&);
+// [ 5] void swap(unique_function&);
+//
+// ACCESSORS
+// [ 3] RET operator()(ARGS...) const;
+// [ 2] operator bool() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const inplace_function&, nullptr_t);
+// [ 5] bool operator==(nullptr_t, const inplace_function&);
+// [ 5] bool operator!=(const inplace_function&, nullptr_t);
+// [ 5] bool operator!=(nullptr_t, const inplace_function&);
+// [ 5] bool operator==(const unique_function&, nullptr_t);
+// [ 5] bool operator==(nullptr_t, const unique_function&);
+// [ 5] bool operator!=(const unique_function&, nullptr_t);
+// [ 5] bool operator!=(nullptr_t, const unique_function&);
+// [ 5] void swap(inplace_function&, inplace_function&);
+// [ 5] void swap(unique_function&, unique_function&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: construction compared with 'bsl::function'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslmf::MovableRefUtil MoveUtil;
+
+//=============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int addOne(int x)
+    // Return the specified 'x' plus one.
+{
+    return x + 1;
+}
+
+                               // =============
+                               // class Counted
+                               // =============
+
+class Counted {
+    // This copyable function object adds a stored value to its argument and
+    // counts the live objects of its type, and the copies and moves made.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CLASS DATA
+    static int s_numLive;
+    static int s_numCopies;
+    static int s_numMoves;
+
+    // CLASS METHODS
+    static void resetCounts()
+        // Reset the copy and move counts to 0.
+    {
+        s_numCopies = 0;
+        s_numMoves  = 0;
+    }
+
+    // CREATORS
+    explicit Counted(int value)
+    : d_value(value)
+    {
+        ++s_numLive;
+    }
+
+    Counted(const Counted& original)
+    : d_value(original.d_value)
+    {
+        ++s_numLive;
+        ++s_numCopies;
+    }
+
+    Counted(Counted&& original)
+    : d_value(original.d_value)
+    {
+        original.d_value = -1;
+        ++s_numLive;
+        ++s_numMoves;
+    }
+
+    ~Counted()
+    {
+        --s_numLive;
+    }
+
+    // ACCESSORS
+    int operator()(int x) const
+        // Return the specified 'x' plus the value of this object.
+    {
+        return d_value + x;
+    }
+};
+
+int Counted::s_numLive   = 0;
+int Counted::s_numCopies = 0;
+int Counted::s_numMoves  = 0;
+
+                             // =================
+                             // class MoveOnlyAdd
+                             // =================
+
+class MoveOnlyAdd {
+    // This move-only function object adds the value it owns to its argument.
+
+    // DATA
+    bslma::ManagedPtr<int> d_value;
+
+  public:
+    // CREATORS
+    MoveOnlyAdd(int value, bslma::Allocator *basicAllocator)
+    : d_value(new (*basicAllocator) int(value), basicAllocator)
+    {
+    }
+
+    MoveOnlyAdd(MoveOnlyAdd&& original)
+    : d_value(MoveUtil::move(original.d_value))
+    {
+    }
+
+    // ACCESSORS
+    int operator()(int x) const
+        // Return the specified 'x' plus the value owned by this object.
+    {
+        return *d_value + x;
+    }
+};
+
+                              // ==============
+                              // class ArgProbe
+                              // ==============
+
+class ArgProbe {
+    // This copyable and movable value type counts its copies.
+
+  public:
+    // CLASS DATA
+    static int s_numCopies;
+
+    // CREATORS
+    ArgProbe() {}
+
+    ArgProbe(const ArgProbe&)
+    {
+        ++s_numCopies;
+    }
+
+    ArgProbe(ArgProbe&&) {}
+};
+
+int ArgProbe::s_numCopies = 0;
+
+struct ProbeArgs {
+    // This function object accepts its arguments by value, by reference, and
+    // by rvalue reference, and returns its 'int&' argument incremented.
+
+    int& operator()(ArgProbe, const ArgProbe&, ArgProbe&&, int& x) const
+    {
+        return ++x;
+    }
+};
+
+}  // close unnamed namespace
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES &&
+        // BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+//  bool veryVeryVerbose     = argc > 4;
+//  bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage examples provided in the component header file
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate the usage examples from the header into the test
+        //:   driver, remove leading comment characters, and replace 'assert'
+        //:   with 'ASSERT'.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Example 1: Queueing Callbacks Without Allocating
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a producer that hands small units of work to a consumer
+// through a fixed-size ring of slots, and that we want to avoid touching the
+// allocator on that path.
+//
+// First, we define the slot type; a lambda capturing a shared pointer and a
+// pair of integers fits easily within 48 bytes:
+//..
+    typedef bsl::inplace_function<void(), 48> Task;
+
+    struct Counter {
+        int d_total;
+    };
+//..
+// Then, we create a counter shared between the producer and consumer and
+// fill a few slots with tasks that each add to it:
+//..
+    bslma::TestAllocator ta;
+    bslma::DefaultAllocatorGuard guard(&ta);
+
+    bsl::shared_ptr<Counter> counter;
+    counter.createInplace(&ta);
+    counter->d_total = 0;
+
+    const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+    Task ring[4];
+    for (int i = 0; i < 4; ++i) {
+        const int delta = i + 1;
+        const int scale = 10;
+        ring[i] = [counter, delta, scale]() {
+            counter->d_total += delta * scale;
+        };
+    }
+//..
+// Now, the consumer invokes the tasks and clears the slots:
+//..
+    for (int i = 0; i < 4; ++i) {
+        ring[i]();
+        ring[i] = nullptr;
+    }
+    ASSERT(100 == counter->d_total);
+//..
+// Finally, we observe that neither storing nor invoking the tasks allocated
+// memory:
+//..
+    ASSERT(numAllocations == ta.numAllocations());
+//..
+//
+///Example 2: Wrapping a Move-Only Target
+/// - - - - - - - - - - - - - - - - - - -
+// A task that owns a resource cannot be held in a 'bsl::function' (or an
+// 'inplace_function'), which requires its target to be copyable.  A
+// 'unique_function' can hold it:
+//..
+    struct Resource {
+        int d_value;
+    };
+
+    struct Release {
+        bslma::ManagedPtr<Resource> d_resource;
+
+        int operator()() const { return d_resource->d_value; }
+    };
+
+    bslma::ManagedPtr<Resource> resource(new (ta) Resource(), &ta);
+    resource->d_value = 7;
+
+    Release release = { bslmf::MovableRefUtil::move(resource) };
+
+    bsl::unique_function<int()> task(bslmf::MovableRefUtil::move(release));
+    ASSERT(7 == task());
+
+    bsl::unique_function<int()> other(bslmf::MovableRefUtil::move(task));
+    ASSERT(!task);
+    ASSERT(7 == other());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SWAP AND COMPARISON WITH 'nullptr'
+        //
+        // Concerns:
+        //: 1 'swap' (member and free) exchanges the targets of two objects,
+        //:   either or both of which may be empty.
+        //:
+        //: 2 Swapping an object with itself has no effect.
+        //:
+        //: 3 An object compares equal to 'nullptr' (in either order) if and
+        //:   only if it is empty, and '!=' is the negation of '=='.
+        //:
+        //: 4 No memory is allocated, and no target is leaked.
+        //
+        // Plan:
+        //: 1 For each pair of empty and non-empty 'inplace_function' and
+        //:   'unique_function' objects, swap them with each function and
+        //:   verify the results by invoking them and comparing them with
+        //:   'nullptr'.  (C-1..3)
+        //:
+        //: 2 Check the count of live 'Counted' objects and the default
+        //:   allocator at the end.  (C-4)
+        //
+        // Testing:
+        //   void swap(inplace_function&);
+        //   void swap(unique_function&);
+        //   bool operator==(const inplace_function&, nullptr_t);
+        //   bool operator==(nullptr_t, const inplace_function&);
+        //   bool operator!=(const inplace_function&, nullptr_t);
+        //   bool operator!=(nullptr_t, const inplace_function&);
+        //   bool operator==(const unique_function&, nullptr_t);
+        //   bool operator==(nullptr_t, const unique_function&);
+        //   bool operator!=(const unique_function&, nullptr_t);
+        //   bool operator!=(nullptr_t, const unique_function&);
+        //   void swap(inplace_function&, inplace_function&);
+        //   void swap(unique_function&, unique_function&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSWAP AND COMPARISON WITH 'nullptr'"
+                            "\n==================================\n");
+
+        typedef bsl::inplace_function<int(int)> IObj;
+        typedef bsl::unique_function<int(int)>  UObj;
+
+        if (verbose) printf("\nComparison with 'nullptr'.\n");
+        {
+            IObj mE;  const IObj& E = mE;
+            IObj mX(Counted(10));  const IObj& X = mX;
+            UObj mF;  const UObj& F = mF;
+            UObj mY(Counted(20));  const UObj& Y = mY;
+
+            ASSERT(  E == nullptr);    ASSERT(  nullptr == E);
+            ASSERT(!(E != nullptr));   ASSERT(!(nullptr != E));
+            ASSERT(!(X == nullptr));   ASSERT(!(nullptr == X));
+            ASSERT(  X != nullptr);    ASSERT(  nullptr != X);
+            ASSERT(  F == nullptr);    ASSERT(  nullptr == F);
+            ASSERT(!(F != nullptr));   ASSERT(!(nullptr != F));
+            ASSERT(!(Y == nullptr));   ASSERT(!(nullptr == Y));
+            ASSERT(  Y != nullptr);    ASSERT(  nullptr != Y);
+        }
+
+        if (verbose) printf("\nSwapping 'inplace_function' objects.\n");
+        for (int ti = 0; ti < 4; ++ti) {
+            const bool A_EMPTY = ti & 1;
+            const bool B_EMPTY = ti & 2;
+
+            IObj mA;  const IObj& A = mA;
+            IObj mB;  const IObj& B = mB;
+            if (!A_EMPTY) mA = Counted(100);
+            if (!B_EMPTY) mB = &addOne;
+
+            mA.swap(mB);
+            ASSERTV(ti, A_EMPTY == (B == nullptr));
+            ASSERTV(ti, B_EMPTY == (A == nullptr));
+            if (!A_EMPTY) ASSERTV(ti, 101 == B(1));
+            if (!B_EMPTY) ASSERTV(ti,   2 == A(1));
+
+            swap(mA, mB);
+            ASSERTV(ti, A_EMPTY == (A == nullptr));
+            ASSERTV(ti, B_EMPTY == (B == nullptr));
+            if (!A_EMPTY) ASSERTV(ti, 101 == A(1));
+
+            mA.swap(mA);
+            ASSERTV(ti, A_EMPTY == (A == nullptr));
+            if (!A_EMPTY) ASSERTV(ti, 101 == A(1));
+        }
+        ASSERTV(Counted::s_numLive, 0 == Counted::s_numLive);
+
+        if (verbose) printf("\nSwapping 'unique_function' objects.\n");
+        for (int ti = 0; ti < 4; ++ti) {
+            const bool A_EMPTY = ti & 1;
+            const bool B_EMPTY = ti & 2;
+
+            bslma::TestAllocator sa("supplied", veryVerbose);
+
+            UObj mA;  const UObj& A = mA;
+            UObj mB;  const UObj& B = mB;
+            if (!A_EMPTY) mA = MoveOnlyAdd(100, &sa);
+            if (!B_EMPTY) mB = Counted(200);
+
+            mA.swap(mB);
+            ASSERTV(ti, A_EMPTY == (B == nullptr));
+            ASSERTV(ti, B_EMPTY == (A == nullptr));
+            if (!A_EMPTY) ASSERTV(ti, 101 == B(1));
+            if (!B_EMPTY) ASSERTV(ti, 201 == A(1));
+
+            swap(mA, mB);
+            ASSERTV(ti, A_EMPTY == (A == nullptr));
+            ASSERTV(ti, B_EMPTY == (B == nullptr));
+
+            mA = nullptr;
+            mB = nullptr;
+            ASSERTV(ti, 0 == sa.numBlocksInUse());
+        }
+        ASSERTV(Counted::s_numLive, 0 == Counted::s_numLive);
+        ASSERTV(defaultAllocator.numAllocations(),
+                0 == defaultAllocator.numAllocations());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'unique_function'
+        //
+        // Concerns:
+        //: 1 A 'unique_function' can be created from, and assigned, a
+        //:   move-only target, which is moved (not copied) into it.
+        //:
+        //: 2 Moving a 'unique_function' (by construction or assignment,
+        //:   including from a 'unique_function' of smaller capacity) moves the
+        //:   target once and leaves the source empty.
+        //:
+        //: 3 A 'unique_function' can be created from an 'inplace_function'
+        //:   (copying or moving its target) of no greater capacity, and the
+        //:   resulting target still behaves as a copyable one would.
+        //:
+        //: 4 Assigning 'nullptr' destroys the target.
+        //:
+        //: 5 No memory is allocated by the wrapper, and no target is leaked.
+        //
+        // Plan:
+        //: 1 Wrap 'MoveOnlyAdd' objects, whose resources come from a test
+        //:   allocator, and move them between wrappers, verifying the results
+        //:   of invocation and the blocks in use.  (C-1..2, 4..5)
+        //:
+        //: 2 Convert 'inplace_function' objects holding 'Counted' targets to
+        //:   'unique_function' objects, verifying the copy and move counts.
+        //:   (C-3, 5)
+        //
+        // Testing:
+        //   unique_function();
+        //   unique_function(nullptr_t);
+        //   unique_function(FUNC&&);
+        //   unique_function(unique_function&&);
+        //   unique_function(unique_function<PROTOTYPE, OTHER>&&);
+        //   unique_function(inplace_function<PROTOTYPE, OTHER>&&);
+        //   unique_function(const inplace_function<PROTOTYPE, OTHER>&);
+        //   ~unique_function();
+        //   unique_function& operator=(unique_function&&);
+        //   unique_function& operator=(nullptr_t);
+        //   unique_function& operator=(FUNC&&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'unique_function'"
+                            "\n=================\n");
+
+        typedef bsl::unique_function<int(int)>      Obj;
+        typedef bsl::unique_function<int(int), 64>  BigObj;
+        typedef bsl::inplace_function<int(int), 32> IObj;
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        if (verbose) printf("\nMove-only targets.\n");
+        {
+            Obj mE;           const Obj& E = mE;
+            Obj mN(nullptr);  const Obj& N = mN;
+            ASSERT(!E);
+            ASSERT(!N);
+
+            Obj mX(MoveOnlyAdd(5, &sa));  const Obj& X = mX;
+            ASSERT(X);
+            ASSERT(6 == X(1));
+            ASSERT(1 == sa.numBlocksInUse());
+
+            Obj mY(MoveUtil::move(mX));  const Obj& Y = mY;
+            ASSERT(!X);
+            ASSERT(6 == Y(1));
+            ASSERT(1 == sa.numBlocksInUse());
+
+            BigObj mZ(MoveUtil::move(mY));  const BigObj& Z = mZ;
+            ASSERT(!Y);
+            ASSERT(6 == Z(1));
+            ASSERT(1 == sa.numBlocksInUse());
+
+            mX = MoveOnlyAdd(7, &sa);
+            ASSERT(8 == X(1));
+            ASSERT(2 == sa.numBlocksInUse());
+
+            mY = MoveUtil::move(mX);
+            ASSERT(!X);
+            ASSERT(8 == Y(1));
+            ASSERT(2 == sa.numBlocksInUse());
+
+            mY = MoveUtil::move(mY);
+            ASSERT(8 == Y(1));
+
+            mY = nullptr;
+            ASSERT(!Y);
+            ASSERT(1 == sa.numBlocksInUse());
+
+            mZ = nullptr;
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nConversion from 'inplace_function'.\n");
+        {
+            IObj mI(Counted(3));  const IObj& I = mI;
+
+            Counted::resetCounts();
+            Obj mX(I);  const Obj& X = mX;
+            ASSERTV(Counted::s_numCopies, 1 == Counted::s_numCopies);
+            ASSERTV(Counted::s_numMoves,  0 == Counted::s_numMoves);
+            ASSERT(I);
+            ASSERT(4 == X(1));
+
+            Counted::resetCounts();
+            Obj mY(MoveUtil::move(mI));  const Obj& Y = mY;
+            ASSERTV(Counted::s_numCopies, 0 == Counted::s_numCopies);
+            ASSERTV(Counted::s_numMoves,  1 == Counted::s_numMoves);
+            ASSERT(!I);
+            ASSERT(4 == Y(1));
+
+            ASSERTV(Counted::s_numLive, 2 == Counted::s_numLive);
+        }
+        ASSERTV(Counted::s_numLive, 0 == Counted::s_numLive);
+
+        ASSERTV(defaultAllocator.numAllocations(),
+                0 == defaultAllocator.numAllocations());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INVOCATION
+        //
+        // Concerns:
+        //: 1 Invocation passes each argument to the target with the value
+        //:   category of the prototype's parameter, making no more copies than
+        //:   a direct call would.
+        //:
+        //: 2 A reference returned by the target is returned by reference.
+        //:
+        //: 3 The result of the target is implicitly converted to the return
+        //:   type of the prototype, and discarded if that type is 'void'.
+        //:
+        //: 4 Invoking an empty object throws 'bsl::bad_function_call' in
+        //:   exception-enabled builds.
+        //
+        // Plan:
+        //: 1 Invoke a 'ProbeArgs' target through a wrapper whose prototype
+        //:   takes arguments by value, by 'const' reference, by rvalue
+        //:   reference, and by modifiable reference, and verify the number of
+        //:   copies made and the address of the returned reference.  (C-1..2)
+        //:
+        //: 2 Wrap 'addOne' in wrappers returning 'long' and 'void'.  (C-3)
+        //:
+        //: 3 Invoke empty objects inside a 'try' block.  (C-4)
+        //
+        // Testing:
+        //   RET operator()(ARGS...) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINVOCATION"
+                            "\n==========\n");
+
+        if (verbose) printf("\nForwarding of arguments.\n");
+        {
+            typedef bsl::inplace_function<int&(ArgProbe,
+                                               const ArgProbe&,
+                                               ArgProbe&&,
+                                               int&)> Obj;
+
+            const Obj X = ProbeArgs();
+
+            ArgProbe a;
+            int      i = 0;
+
+            ArgProbe::s_numCopies = 0;
+            int& result = X(ArgProbe(), a, ArgProbe(), i);
+
+            ASSERTV(ArgProbe::s_numCopies, 0 == ArgProbe::s_numCopies);
+            ASSERT(&i == &result);
+            ASSERT(1 == i);
+
+            ArgProbe::s_numCopies = 0;
+            X(a, a, MoveUtil::move(a), i);
+            ASSERTV(ArgProbe::s_numCopies, 1 == ArgProbe::s_numCopies);
+            ASSERT(2 == i);
+        }
+
+        if (verbose) printf("\nConversion of results.\n");
+        {
+            const bsl::inplace_function<long(int)> X = &addOne;
+            ASSERT(3L == X(2));
+
+            const bsl::unique_function<void(int)> Y = &addOne;
+            Y(2);
+
+            const bsl::inplace_function<int(int)> Z = Counted(5);
+            ASSERT(7 == Z(2));
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) printf("\nInvoking an empty object.\n");
+        {
+            const bsl::inplace_function<int(int)> X;
+            const bsl::unique_function<int(int)>  Y;
+
+            bool caught = false;
+            try {
+                X(1);
+            }
+            catch (const bsl::bad_function_call&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                Y(1);
+            }
+            catch (const bsl::bad_function_call&) {
+                caught = true;
+            }
+            ASSERT(caught);
+        }
+#endif
+
+        ASSERTV(Counted::s_numLive, 0 == Counted::s_numLive);
+        ASSERTV(defaultAllocator.numAllocations(),
+                0 == defaultAllocator.numAllocations());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'inplace_function' CREATORS AND ASSIGNMENT
+        //
+        // Concerns:
+        //: 1 A default-constructed object, or one created from 'nullptr', a
+        //:   null function pointer, or an empty 'bsl::function', is empty.
+        //:
+        //: 2 An object created from a function object holds a copy of an
+        //:   lvalue argument, and a moved-from copy of an rvalue argument.
+        //:
+        //: 3 Copying an object copies its target exactly once, and moving an
+        //:   object moves its target exactly once, leaving the source empty;
+        //:   the same holds when the destination has a larger capacity.
+        //:
+        //: 4 Each form of assignment destroys the previous target, if any, and
+        //:   self-assignment has no effect.
+        //:
+        //: 5 Every target constructed is destroyed, and no memory is
+        //:   allocated.
+        //
+        // Plan:
+        //: 1 Create objects in each of the ways listed, using 'Counted'
+        //:   targets, and verify the copy, move, and live counts after each
+        //:   operation, and the result of invoking the objects.  (C-1..5)
+        //
+        // Testing:
+        //   inplace_function();
+        //   inplace_function(nullptr_t);
+        //   inplace_function(FUNC&&);
+        //   inplace_function(const inplace_function&);
+        //   inplace_function(const inplace_function<PROTOTYPE, OTHER>&);
+        //   inplace_function(inplace_function&&);
+        //   inplace_function(inplace_function<PROTOTYPE, OTHER>&&);
+        //   ~inplace_function();
+        //   inplace_function& operator=(const inplace_function&);
+        //   inplace_function& operator=(inplace_function&&);
+        //   inplace_function& operator=(nullptr_t);
+        //   inplace_function& operator=(FUNC&&);
+        //   operator bool() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'inplace_function' CREATORS AND ASSIGNMENT"
+                            "\n==========================================\n");
+
+        typedef bsl::inplace_function<int(int)>      Obj;
+        typedef bsl::inplace_function<int(int), 16>  SmallObj;
+        typedef bsl::inplace_function<int(int), 128> BigObj;
+
+        if (verbose) printf("\nEmpty objects.\n");
+        {
+            int (*nullFunction)(int) = 0;
+            bsl::function<int(int)> emptyFunction;
+
+            const Obj    A;
+            const Obj    B(nullptr);
+            const Obj    C(nullFunction);
+            const BigObj D(emptyFunction);
+
+            ASSERT(!A);
+            ASSERT(!B);
+            ASSERT(!C);
+            ASSERT(!D);
+
+            const Obj E(A);
+            ASSERT(!E);
+        }
+
+        if (verbose) printf("\nCreation from targets.\n");
+        {
+            const Counted F(10);
+
+            Counted::resetCounts();
+            Obj mX(F);  const Obj& X = mX;
+            ASSERTV(Counted::s_numCopies, 1 == Counted::s_numCopies);
+            ASSERTV(Counted::s_numMoves,  0 == Counted::s_numMoves);
+            ASSERT(X);
+            ASSERT(11 == X(1));
+
+            Counted::resetCounts();
+            Obj mY(Counted(20));  const Obj& Y = mY;
+            ASSERTV(Counted::s_numCopies, 0 == Counted::s_numCopies);
+            ASSERTV(Counted::s_numMoves,  1 == Counted::s_numMoves);
+            ASSERT(21 == Y(1));
+
+            const Obj Z(&addOne);
+            ASSERT(2 == Z(1));
+
+            ASSERTV(Counted::s_numLive, 3 == Counted::s_numLive);
+        }
+        ASSERTV(Counted::s_numLive, 0 == Counted::s_numLive);
+
+        if (verbose) printf("\nCopying and moving.\n");
+        {
+            Obj mX(Counted(10));  const Obj& X = mX;
+
+            Counted::resetCounts();
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERTV(Counted::s_numCopies, 1 == Counted::s_numCopies);
+            ASSERT(X);
+            ASSERT(11 == Y(1));
+
+            Counted::resetCounts();
+            BigObj mZ(X);  const BigObj& Z = mZ;
+            ASSERTV(Counted::s_numCopies, 1 == Counted::s_numCopies);
+            ASSERT(11 == Z(1));
+
+            Counted::resetCounts();
+            Obj mU(MoveUtil::move(mY));  const Obj& U = mU;
+            ASSERTV(Counted::s_numCopies, 0 == Counted::s_numCopies);
+            ASSERTV(Counted::s_numMoves,  1 == Counted::s_numMoves);
+            ASSERT(!Y);
+            ASSERT(11 == U(1));
+
+            SmallObj mS(&addOne);  const SmallObj& S = mS;
+
+            Counted::resetCounts();
+            BigObj mV(MoveUtil::move(mS));  const BigObj& V = mV;
+            ASSERT(!S);
+            ASSERT(2 == V(1));
+
+            ASSERTV(Counted::s_numLive, 3 == Counted::s_numLive);
+        }
+        ASSERTV(Counted::s_numLive, 0 == Counted::s_numLive);
+
+        if (verbose) printf("\nAssignment.\n");
+        {
+            Obj mX(Counted(10));  const Obj& X = mX;
+            Obj mY(Counted(20));  const Obj& Y = mY;
+            ASSERTV(Counted::s_numLive, 2 == Counted::s_numLive);
+
+            Counted::resetCounts();
+            mX = Y;
+            ASSERTV(Counted::s_numLive,   2 == Counted::s_numLive);
+            ASSERTV(Counted::s_numCopies, 1 == Counted::s_numCopies);
+            ASSERT(21 == X(1));
+            ASSERT(21 == Y(1));
+
+            mX = X;
+            ASSERT(21 == X(1));
+
+            mX = MoveUtil::move(mY);
+            ASSERTV(Counted::s_numLive, 1 == Counted::s_numLive);
+            ASSERT(!Y);
+            ASSERT(21 == X(1));
+
+            mX = MoveUtil::move(mX);
+            ASSERT(21 == X(1));
+
+            mY = Counted(30);
+            ASSERTV(Counted::s_numLive, 2 == Counted::s_numLive);
+            ASSERT(31 == Y(1));
+
+            mY = &addOne;
+            ASSERTV(Counted::s_numLive, 1 == Counted::s_numLive);
+            ASSERT(2 == Y(1));
+
+            mX = nullptr;
+            ASSERTV(Counted::s_numLive, 0 == Counted::s_numLive);
+            ASSERT(!X);
+
+            mX = nullptr;
+            ASSERT(!X);
+        }
+        ASSERTV(Counted::s_numLive, 0 == Counted::s_numLive);
+
+        ASSERTV(defaultAllocator.numAllocations(),
+                0 == defaultAllocator.numAllocations());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform an ad-hoc test of the primary constructors and
+        //:   invocation.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bsl::inplace_function<int(char)> CharObj;
+        ASSERT((bsl::is_same<int, CharObj::result_type>::value));
+
+        const int k = 3;
+
+        bsl::inplace_function<int(int)> mX = [k](int x) { return x * k; };
+        const bsl::inplace_function<int(int)>& X = mX;
+        ASSERT(6 == X(2));
+
+        bsl::inplace_function<int(int)> mY(X);
+        ASSERT(6 == mY(2));
+
+        mY = &addOne;
+        ASSERT(3 == mY(2));
+
+        bsl::unique_function<int(int)> mZ(MoveUtil::move(mX));
+        ASSERT(!X);
+        ASSERT(6 == mZ(2));
+
+        ASSERT(0 == defaultAllocator.numAllocations());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CONSTRUCTION COMPARED WITH 'bsl::function'
+        //
+        // Concerns:
+        //: 1 Wrapping a lambda that captures a 'shared_ptr' and an array of
+        //:   ten integers (too large for the small-object buffer of
+        //:   'bsl::function') in an 'inplace_function' does not allocate,
+        //:   where wrapping it in a 'bsl::function' does.
+        //
+        // Plan:
+        //: 1 Repeatedly wrap such a lambda in each of 'bsl::function' and
+        //:   'bsl::inplace_function', invoke the wrapper, and report the
+        //:   elapsed time and the number of allocations made.  The number of
+        //:   iterations can be given as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: construction compared with 'bsl::function'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: CONSTRUCTION COMPARED WITH"
+                            " 'bsl::function'"
+                            "\n======================================="
+                            "================\n");
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bsl::shared_ptr<bsls::Types::Int64> total;
+        total.createInplace(0, 0);
+
+        bsls::Stopwatch timer;
+
+        bsls::Types::Int64 numAllocations = defaultAllocator.numAllocations();
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            int data[10];
+            for (int j = 0; j < 10; ++j) {
+                data[j] = i + j;
+            }
+            bsl::function<void()> f = [total, data]() {
+                *total += data[9] - data[0];
+            };
+            f();
+        }
+        timer.stop();
+        printf("bsl::function:         %gs, %lld allocations\n",
+               timer.elapsedTime(),
+               defaultAllocator.numAllocations() - numAllocations);
+
+        timer.reset();
+        numAllocations = defaultAllocator.numAllocations();
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            int data[10];
+            for (int j = 0; j < 10; ++j) {
+                data[j] = i + j;
+            }
+            bsl::inplace_function<void(), 64> f = [total, data]() {
+                *total += data[9] - data[0];
+            };
+            f();
+        }
+        timer.stop();
+        const bsls::Types::Int64 inplaceAllocations =
+                            defaultAllocator.numAllocations() - numAllocations;
+        printf("bsl::inplace_function: %gs, %lld allocations\n",
+               timer.elapsedTime(),
+               inplaceAllocations);
+
+        ASSERTV(inplaceAllocations, 0 == inplaceAllocations);
+        const bsls::Types::Int64 N = NUM_ITERATIONS;
+        ASSERTV(*total, 18 * N == *total);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+#else
+    (void) verbose;
+    (void) veryVerbose;
+
+    if (verbose) printf("This component requires variadic templates and"
+                        " rvalue references.\n");
+#endif
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,962 @@
+// bslstl_localsharedptr.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLSTL_LOCALSHAREDPTR
+#define INCLUDED_BSLSTL_LOCALSHAREDPTR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a shared pointer with a non-atomic reference count.
+//
+//@CLASSES:
+//  bsl::local_shared_ptr: shared pointer for use within a single thread
+//  bslstl::LocalSharedPtr_Rep: protocol for 'local_shared_ptr' counts
+//
+//@SEE_ALSO: bslstl_sharedptr, bslstl_atomicsharedptr
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bsl::local_shared_ptr', that shares ownership of an object in the manner of
+// 'bsl::shared_ptr', but whose reference count is an ordinary (non-atomic)
+// integer.  Copying and destroying a 'local_shared_ptr' is therefore a plain
+// increment or decrement, which is markedly cheaper than the atomic
+// read-modify-write operation required by 'bsl::shared_ptr' on most
+// platforms, and which the compiler is free to combine or elide.
+//
+// The price is that all 'local_shared_ptr' objects sharing ownership of the
+// same object must be used by one thread at a time: copying, assigning, or
+// destroying two such objects concurrently (even objects that are not
+// themselves shared between threads) is undefined behavior.  A
+// 'local_shared_ptr' is intended for single-threaded hot paths, such as the
+// nodes of a data structure private to one thread, or the per-request state
+// of a handler; it cannot be converted to or from a 'bsl::shared_ptr'.
+//
+// Unlike 'bsl::shared_ptr', 'local_shared_ptr' does not support weak
+// pointers, custom deleters, or 'enable_shared_from_this'.
+//
+///Creating Objects
+///----------------
+// A 'local_shared_ptr' can take ownership of an object allocated from a
+// 'bslma::Allocator', in which case the count is allocated separately from the
+// same allocator, and the object is destroyed and deallocated with that
+// allocator.  More efficiently, 'createInplace' and 'allocate_local_shared'
+// create the object and its count in a single allocation.  If the object uses
+// 'bslma::Allocator' memory, it is passed the allocator used for the
+// allocation.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing Nodes Within a Single Thread
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a single-threaded parser builds an expression tree in which a
+// common sub-expression may be shared by several parents.  Because the tree
+// never leaves the thread that builds it, the nodes can be shared with
+// 'local_shared_ptr'.
+//
+// First, we define the node type:
+//..
+//  struct Node {
+//      int                         d_value;
+//      bsl::local_shared_ptr<Node> d_left;
+//      bsl::local_shared_ptr<Node> d_right;
+//
+//      explicit Node(int value) : d_value(value) {}
+//  };
+//..
+// Then, we create a leaf in a single allocation, and two parents that share
+// it:
+//..
+//  bslma::TestAllocator ta;
+//  {
+//      bsl::local_shared_ptr<Node> leaf =
+//                                   bsl::allocate_local_shared<Node>(&ta, 3);
+//
+//      bsl::local_shared_ptr<Node> left, right;
+//      left.createInplace(&ta, 1);
+//      right.createInplace(&ta, 2);
+//      left->d_left  = leaf;
+//      right->d_left = leaf;
+//
+//      assert(3 == leaf.use_count());
+//      assert(3 == ta.numBlocksInUse());
+//..
+// Finally, we observe that the leaf is destroyed when the last of its owners
+// is:
+//..
+//      leaf.reset();
+//      left.reset();
+//      assert(2 == ta.numBlocksInUse());
+//  }
+//  assert(0 == ta.numBlocksInUse());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_deleterhelper.h>
+
+#include <bslmf_addlvaluereference.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_util.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_keyword.h>
+#include <bsls_nullptr.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_unspecifiedbool.h>
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // ========================
+                          // class LocalSharedPtr_Rep
+                          // ========================
+
+class LocalSharedPtr_Rep {
+    // This protocol holds the non-atomic reference count of the object owned
+    // by a set of 'bsl::local_shared_ptr' objects, and disposes of the object
+    // (and of itself) when the count reaches zero.
+
+    // DATA
+    int d_count;  // number of owners
+
+  private:
+    // NOT IMPLEMENTED
+    LocalSharedPtr_Rep(const LocalSharedPtr_Rep&);
+    LocalSharedPtr_Rep& operator=(const LocalSharedPtr_Rep&);
+
+  protected:
+    // PROTECTED CREATORS
+    virtual ~LocalSharedPtr_Rep();
+        // Destroy this object.
+
+    // PROTECTED MANIPULATORS
+    virtual void destroy() = 0;
+        // Destroy the owned object and this representation, and free the
+        // memory they occupy.
+
+  public:
+    // CREATORS
+    LocalSharedPtr_Rep();
+        // Create a representation having one owner.
+
+    // MANIPULATORS
+    void acquireRef();
+        // Add an owner to this representation.
+
+    void releaseRef();
+        // Remove an owner from this representation, and destroy the owned
+        // object and this representation if no owner remains.
+
+    // ACCESSORS
+    int numReferences() const;
+        // Return the number of owners of this representation.
+};
+
+                     // ==================================
+                     // class LocalSharedPtr_OutofplaceRep
+                     // ==================================
+
+template <class TYPE>
+class LocalSharedPtr_OutofplaceRep : public LocalSharedPtr_Rep {
+    // This class provides a representation that owns an object allocated
+    // separately from it, from the same allocator.
+
+    // DATA
+    TYPE             *d_ptr_p;        // owned object
+    bslma::Allocator *d_allocator_p;  // allocator of the object and of this
+                                      // representation (held, not owned)
+
+    // PRIVATE CREATORS
+    ~LocalSharedPtr_OutofplaceRep() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this object.
+
+    // PRIVATE MANIPULATORS
+    void destroy() BSLS_KEYWORD_OVERRIDE;
+        // Destroy and deallocate the owned object and this representation.
+
+  public:
+    // CREATORS
+    LocalSharedPtr_OutofplaceRep(TYPE *ptr, bslma::Allocator *allocator);
+        // Create a representation owning the specified 'ptr', which was
+        // allocated, as is this representation, from the specified
+        // 'allocator'.
+};
+
+                      // ===============================
+                      // class LocalSharedPtr_InplaceRep
+                      // ===============================
+
+template <class TYPE>
+class LocalSharedPtr_InplaceRep : public LocalSharedPtr_Rep {
+    // This class provides a representation that holds the owned object in its
+    // own footprint.
+
+    // DATA
+    bslma::Allocator         *d_allocator_p;  // allocator of this
+                                              // representation (held, not
+                                              // owned)
+
+    bsls::ObjectBuffer<TYPE>  d_buffer;       // owned object
+
+    // PRIVATE CREATORS
+    ~LocalSharedPtr_InplaceRep() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this object.
+
+    // PRIVATE MANIPULATORS
+    void destroy() BSLS_KEYWORD_OVERRIDE;
+        // Destroy the owned object, and deallocate this representation.
+
+  public:
+    // CREATORS
+    explicit LocalSharedPtr_InplaceRep(bslma::Allocator *allocator);
+        // Create a representation, allocated from the specified 'allocator',
+        // whose owned object is not yet constructed.  The behavior is
+        // undefined unless the object is constructed (at 'ptr()') before
+        // 'releaseRef' brings the count to zero.
+
+    // MANIPULATORS
+    TYPE *ptr();
+        // Return the address of the owned object.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator of this representation.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                           // ======================
+                           // class local_shared_ptr
+                           // ======================
+
+template <class ELEMENT_TYPE>
+class local_shared_ptr {
+    // This value-semantic class template holds a pointer to an object of the
+    // (template parameter) 'ELEMENT_TYPE', and shares ownership of an object
+    // (typically the same one) with other 'local_shared_ptr' objects through
+    // a non-atomic reference count.  All 'local_shared_ptr' objects sharing
+    // ownership of the same object must be used by one thread at a time.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::LocalSharedPtr_Rep Rep;
+
+    typedef typename BloombergLP::bsls::UnspecifiedBool<local_shared_ptr>::
+                                                           BoolType BoolType;
+
+    // DATA
+    ELEMENT_TYPE *d_ptr_p;  // held pointer
+    Rep          *d_rep_p;  // shared count, or 0 if empty
+
+    // FRIENDS
+    template <class OTHER_TYPE>
+    friend class local_shared_ptr;
+
+  public:
+    // TYPES
+    typedef ELEMENT_TYPE element_type;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(local_shared_ptr,
+                                   BloombergLP::bslmf::IsBitwiseMoveable);
+
+    // CREATORS
+    local_shared_ptr() BSLS_KEYWORD_NOEXCEPT;
+    local_shared_ptr(bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT;         // IMPLICIT
+        // Create an empty 'local_shared_ptr'.
+
+    template <class CONVERTIBLE_TYPE>
+    explicit local_shared_ptr(
+                         CONVERTIBLE_TYPE              *ptr,
+                         BloombergLP::bslma::Allocator *basicAllocator = 0);
+        // Create a 'local_shared_ptr' that owns the specified 'ptr', which
+        // was allocated from the optionally specified 'basicAllocator', and
+        // which is destroyed and deallocated with 'basicAllocator' when no
+        // owner remains.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The reference count is allocated from
+        // the same allocator; if that allocation throws, 'ptr' is destroyed
+        // and deallocated.  If 'ptr' is 0, the created object is empty.
+        // 'CONVERTIBLE_TYPE *' shall be convertible to 'ELEMENT_TYPE *'.
+
+    template <class ANY_TYPE>
+    local_shared_ptr(const local_shared_ptr<ANY_TYPE>&  source,
+                     ELEMENT_TYPE                      *object)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+        // Create a 'local_shared_ptr' that shares ownership with the specified
+        // 'source', and that holds the specified 'object' (which is typically
+        // a sub-object of the object owned by 'source').
+
+    local_shared_ptr(const local_shared_ptr& original) BSLS_KEYWORD_NOEXCEPT;
+    template <class CONVERTIBLE_TYPE>
+    local_shared_ptr(const local_shared_ptr<CONVERTIBLE_TYPE>& original)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+                                                                    // IMPLICIT
+        // Create a 'local_shared_ptr' that holds the pointer held by, and
+        // shares ownership with, the specified 'original'.
+        // 'CONVERTIBLE_TYPE *' shall be convertible to 'ELEMENT_TYPE *'.
+
+    local_shared_ptr(BloombergLP::bslmf::MovableRef<local_shared_ptr> original)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+        // Create a 'local_shared_ptr' that holds the pointer held by, and
+        // takes over the ownership of, the specified 'original', leaving
+        // 'original' empty.
+
+    ~local_shared_ptr();
+        // Destroy this object, releasing its ownership.
+
+    // MANIPULATORS
+    local_shared_ptr& operator=(const local_shared_ptr& rhs)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+        // Make this object hold the pointer held by, and share ownership with,
+        // the specified 'rhs', releasing its previous ownership, and return a
+        // reference providing modifiable access to this object.
+
+    local_shared_ptr& operator=(
+                      BloombergLP::bslmf::MovableRef<local_shared_ptr> rhs)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+        // Make this object hold the pointer held by, and take over the
+        // ownership of, the specified 'rhs', leaving 'rhs' empty, releasing
+        // the previous ownership of this object, and return a reference
+        // providing modifiable access to this object.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    void createInplace(BloombergLP::bslma::Allocator *basicAllocator,
+                       ARGS&&...                      args);
+        // Create an object of type 'ELEMENT_TYPE' from the specified 'args',
+        // together with its reference count, in a single block allocated from
+        // the specified 'basicAllocator', and make this object hold and own
+        // it, releasing its previous ownership.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  If 'ELEMENT_TYPE'
+        // uses 'bslma::Allocator', the allocator is passed to its constructor.
+#else
+    void createInplace(BloombergLP::bslma::Allocator *basicAllocator = 0);
+    template <class ARG1>
+    void createInplace(BloombergLP::bslma::Allocator *basicAllocator,
+                       const ARG1&                    arg1);
+    template <class ARG1, class ARG2>
+    void createInplace(BloombergLP::bslma::Allocator *basicAllocator,
+                       const ARG1&                    arg1,
+                       const ARG2&                    arg2);
+        // Create an object of type 'ELEMENT_TYPE' from the specified 'arg1'
+        // and 'arg2' (if any), together with its reference count, in a single
+        // block allocated from the optionally specified 'basicAllocator', and
+        // make this object hold and own it, releasing its previous ownership.
+        // If 'basicAllocator' is 0, the currently installed default allocator
+        // is used.  If 'ELEMENT_TYPE' uses 'bslma::Allocator', the allocator
+        // is passed to its constructor.
+#endif
+
+    void reset() BSLS_KEYWORD_NOEXCEPT;
+        // Make this object empty, releasing its ownership.
+
+    template <class CONVERTIBLE_TYPE>
+    void reset(CONVERTIBLE_TYPE              *ptr,
+               BloombergLP::bslma::Allocator *basicAllocator = 0);
+        // Make this object own the specified 'ptr', which was allocated from
+        // the optionally specified 'basicAllocator', releasing its previous
+        // ownership.  See the constructor taking a pointer for details.
+
+    void swap(local_shared_ptr& other) BSLS_KEYWORD_NOEXCEPT;
+        // Exchange the values of this object and the specified 'other'.
+
+    // ACCESSORS
+    operator BoolType() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a value that converts to 'true' if this object holds a
+        // non-null pointer, and to 'false' otherwise.
+
+    typename add_lvalue_reference<ELEMENT_TYPE>::type
+    operator*() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reference to the object addressed by the held pointer.
+        // The behavior is undefined if the held pointer is null.
+
+    ELEMENT_TYPE *operator->() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the held pointer.
+
+    ELEMENT_TYPE *get() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the held pointer.
+
+    BloombergLP::bslstl::LocalSharedPtr_Rep *rep() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the address of the shared count of this object, or 0 if it
+        // is empty.
+
+    bool unique() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this object is the only owner of its object, and
+        // 'false' otherwise.
+
+    long use_count() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of owners of the object owned by this object, or
+        // 0 if it is empty.
+};
+
+// FREE OPERATORS
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator==(const local_shared_ptr<LHS_TYPE>& lhs,
+                const local_shared_ptr<RHS_TYPE>& rhs) BSLS_KEYWORD_NOEXCEPT;
+    // Return 'true' if the specified 'lhs' and 'rhs' hold the same pointer,
+    // and 'false' otherwise.
+
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator!=(const local_shared_ptr<LHS_TYPE>& lhs,
+                const local_shared_ptr<RHS_TYPE>& rhs) BSLS_KEYWORD_NOEXCEPT;
+    // Return 'true' if the specified 'lhs' and 'rhs' hold different pointers,
+    // and 'false' otherwise.
+
+// FREE FUNCTIONS
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class ELEMENT_TYPE, class... ARGS>
+local_shared_ptr<ELEMENT_TYPE> allocate_local_shared(
+                              BloombergLP::bslma::Allocator *basicAllocator,
+                              ARGS&&...                      args);
+    // Return a 'local_shared_ptr' owning an object of the (template
+    // parameter) 'ELEMENT_TYPE' created from the specified 'args' in a single
+    // block, together with its reference count, allocated from the specified
+    // 'basicAllocator'.  See 'local_shared_ptr::createInplace'.
+#endif
+
+template <class ELEMENT_TYPE>
+void swap(local_shared_ptr<ELEMENT_TYPE>& a,
+          local_shared_ptr<ELEMENT_TYPE>& b) BSLS_KEYWORD_NOEXCEPT;
+    // Exchange the values of the specified 'a' and 'b'.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // ------------------------
+                          // class LocalSharedPtr_Rep
+                          // ------------------------
+
+// CREATORS
+inline
+LocalSharedPtr_Rep::LocalSharedPtr_Rep()
+: d_count(1)
+{
+}
+
+// MANIPULATORS
+inline
+void LocalSharedPtr_Rep::acquireRef()
+{
+    ++d_count;
+}
+
+inline
+void LocalSharedPtr_Rep::releaseRef()
+{
+    BSLS_ASSERT_SAFE(0 < d_count);
+
+    if (0 == --d_count) {
+        destroy();
+    }
+}
+
+// ACCESSORS
+inline
+int LocalSharedPtr_Rep::numReferences() const
+{
+    return d_count;
+}
+
+                     // ----------------------------------
+                     // class LocalSharedPtr_OutofplaceRep
+                     // ----------------------------------
+
+// PRIVATE CREATORS
+template <class TYPE>
+LocalSharedPtr_OutofplaceRep<TYPE>::~LocalSharedPtr_OutofplaceRep()
+{
+}
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+void LocalSharedPtr_OutofplaceRep<TYPE>::destroy()
+{
+    bslma::Allocator *allocator = d_allocator_p;
+
+    bslma::DeleterHelper::deleteObject(d_ptr_p, allocator);
+    this->~LocalSharedPtr_OutofplaceRep();
+    allocator->deallocate(this);
+}
+
+// CREATORS
+template <class TYPE>
+inline
+LocalSharedPtr_OutofplaceRep<TYPE>::LocalSharedPtr_OutofplaceRep(
+                                                   TYPE             *ptr,
+                                                   bslma::Allocator *allocator)
+: d_ptr_p(ptr)
+, d_allocator_p(allocator)
+{
+}
+
+                      // -------------------------------
+                      // class LocalSharedPtr_InplaceRep
+                      // -------------------------------
+
+// PRIVATE CREATORS
+template <class TYPE>
+LocalSharedPtr_InplaceRep<TYPE>::~LocalSharedPtr_InplaceRep()
+{
+}
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+void LocalSharedPtr_InplaceRep<TYPE>::destroy()
+{
+    bslma::Allocator *allocator = d_allocator_p;
+
+    d_buffer.object().~TYPE();
+    this->~LocalSharedPtr_InplaceRep();
+    allocator->deallocate(this);
+}
+
+// CREATORS
+template <class TYPE>
+inline
+LocalSharedPtr_InplaceRep<TYPE>::LocalSharedPtr_InplaceRep(
+                                                   bslma::Allocator *allocator)
+: d_allocator_p(allocator)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+TYPE *LocalSharedPtr_InplaceRep<TYPE>::ptr()
+{
+    return d_buffer.address();
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bslma::Allocator *LocalSharedPtr_InplaceRep<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                           // ----------------------
+                           // class local_shared_ptr
+                           // ----------------------
+
+// CREATORS
+template <class ELEMENT_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::local_shared_ptr() BSLS_KEYWORD_NOEXCEPT
+: d_ptr_p(0)
+, d_rep_p(0)
+{
+}
+
+template <class ELEMENT_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::local_shared_ptr(bsl::nullptr_t)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: d_ptr_p(0)
+, d_rep_p(0)
+{
+}
+
+template <class ELEMENT_TYPE>
+template <class CONVERTIBLE_TYPE>
+local_shared_ptr<ELEMENT_TYPE>::local_shared_ptr(
+                              CONVERTIBLE_TYPE              *ptr,
+                              BloombergLP::bslma::Allocator *basicAllocator)
+: d_ptr_p(ptr)
+, d_rep_p(0)
+{
+    typedef BloombergLP::bslstl::LocalSharedPtr_OutofplaceRep<CONVERTIBLE_TYPE>
+                                                                      RepType;
+
+    if (!ptr) {
+        return;                                                       // RETURN
+    }
+
+    BloombergLP::bslma::Allocator *allocator =
+                        BloombergLP::bslma::Default::allocator(basicAllocator);
+
+    BSLS_TRY {
+        d_rep_p = new (*allocator) RepType(ptr, allocator);
+    }
+    BSLS_CATCH(...) {
+        BloombergLP::bslma::DeleterHelper::deleteObject(ptr, allocator);
+        BSLS_RETHROW;
+    }
+}
+
+template <class ELEMENT_TYPE>
+template <class ANY_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::local_shared_ptr(
+                                  const local_shared_ptr<ANY_TYPE>&  source,
+                                  ELEMENT_TYPE                      *object)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: d_ptr_p(object)
+, d_rep_p(source.d_rep_p)
+{
+    if (d_rep_p) {
+        d_rep_p->acquireRef();
+    }
+}
+
+template <class ELEMENT_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::local_shared_ptr(
+                                           const local_shared_ptr& original)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: d_ptr_p(original.d_ptr_p)
+, d_rep_p(original.d_rep_p)
+{
+    if (d_rep_p) {
+        d_rep_p->acquireRef();
+    }
+}
+
+template <class ELEMENT_TYPE>
+template <class CONVERTIBLE_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::local_shared_ptr(
+                         const local_shared_ptr<CONVERTIBLE_TYPE>& original)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: d_ptr_p(original.d_ptr_p)
+, d_rep_p(original.d_rep_p)
+{
+    if (d_rep_p) {
+        d_rep_p->acquireRef();
+    }
+}
+
+template <class ELEMENT_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::local_shared_ptr(
+               BloombergLP::bslmf::MovableRef<local_shared_ptr> original)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: d_ptr_p(BloombergLP::bslmf::MovableRefUtil::access(original).d_ptr_p)
+, d_rep_p(BloombergLP::bslmf::MovableRefUtil::access(original).d_rep_p)
+{
+    local_shared_ptr& lvalue =
+                          BloombergLP::bslmf::MovableRefUtil::access(original);
+    lvalue.d_ptr_p = 0;
+    lvalue.d_rep_p = 0;
+}
+
+template <class ELEMENT_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::~local_shared_ptr()
+{
+    if (d_rep_p) {
+        d_rep_p->releaseRef();
+    }
+}
+
+// MANIPULATORS
+template <class ELEMENT_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>&
+local_shared_ptr<ELEMENT_TYPE>::operator=(const local_shared_ptr& rhs)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    // Acquire before releasing, in case 'rhs' is owned by the object this
+    // object owns.
+
+    local_shared_ptr(rhs).swap(*this);
+    return *this;
+}
+
+template <class ELEMENT_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>& local_shared_ptr<ELEMENT_TYPE>::operator=(
+                       BloombergLP::bslmf::MovableRef<local_shared_ptr> rhs)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    local_shared_ptr(BloombergLP::bslmf::MovableRefUtil::move(rhs)).swap(
+                                                                        *this);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class ELEMENT_TYPE>
+template <class... ARGS>
+void local_shared_ptr<ELEMENT_TYPE>::createInplace(
+                              BloombergLP::bslma::Allocator *basicAllocator,
+                              ARGS&&...                      args)
+{
+    typedef BloombergLP::bslstl::LocalSharedPtr_InplaceRep<ELEMENT_TYPE>
+                                                                      RepType;
+
+    BloombergLP::bslma::Allocator *allocator =
+                        BloombergLP::bslma::Default::allocator(basicAllocator);
+
+    RepType *rep = new (*allocator) RepType(allocator);
+    BSLS_TRY {
+        BloombergLP::bslma::ConstructionUtil::construct(
+                              rep->ptr(),
+                              allocator,
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+    }
+    BSLS_CATCH(...) {
+        allocator->deallocate(rep);
+        BSLS_RETHROW;
+    }
+
+    local_shared_ptr result;
+    result.d_ptr_p = rep->ptr();
+    result.d_rep_p = rep;
+    result.swap(*this);
+}
+#else
+template <class ELEMENT_TYPE>
+void local_shared_ptr<ELEMENT_TYPE>::createInplace(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+{
+    typedef BloombergLP::bslstl::LocalSharedPtr_InplaceRep<ELEMENT_TYPE>
+                                                                      RepType;
+
+    BloombergLP::bslma::Allocator *allocator =
+                        BloombergLP::bslma::Default::allocator(basicAllocator);
+
+    RepType *rep = new (*allocator) RepType(allocator);
+    BSLS_TRY {
+        BloombergLP::bslma::ConstructionUtil::construct(rep->ptr(),
+                                                        allocator);
+    }
+    BSLS_CATCH(...) {
+        allocator->deallocate(rep);
+        BSLS_RETHROW;
+    }
+
+    local_shared_ptr result;
+    result.d_ptr_p = rep->ptr();
+    result.d_rep_p = rep;
+    result.swap(*this);
+}
+
+template <class ELEMENT_TYPE>
+template <class ARG1>
+void local_shared_ptr<ELEMENT_TYPE>::createInplace(
+                              BloombergLP::bslma::Allocator *basicAllocator,
+                              const ARG1&                    arg1)
+{
+    typedef BloombergLP::bslstl::LocalSharedPtr_InplaceRep<ELEMENT_TYPE>
+                                                                      RepType;
+
+    BloombergLP::bslma::Allocator *allocator =
+                        BloombergLP::bslma::Default::allocator(basicAllocator);
+
+    RepType *rep = new (*allocator) RepType(allocator);
+    BSLS_TRY {
+        BloombergLP::bslma::ConstructionUtil::construct(rep->ptr(),
+                                                        allocator,
+                                                        arg1);
+    }
+    BSLS_CATCH(...) {
+        allocator->deallocate(rep);
+        BSLS_RETHROW;
+    }
+
+    local_shared_ptr result;
+    result.d_ptr_p = rep->ptr();
+    result.d_rep_p = rep;
+    result.swap(*this);
+}
+
+template <class ELEMENT_TYPE>
+template <class ARG1, class ARG2>
+void local_shared_ptr<ELEMENT_TYPE>::createInplace(
+                              BloombergLP::bslma::Allocator *basicAllocator,
+                              const ARG1&                    arg1,
+                              const ARG2&                    arg2)
+{
+    typedef BloombergLP::bslstl::LocalSharedPtr_InplaceRep<ELEMENT_TYPE>
+                                                                      RepType;
+
+    BloombergLP::bslma::Allocator *allocator =
+                        BloombergLP::bslma::Default::allocator(basicAllocator);
+
+    RepType *rep = new (*allocator) RepType(allocator);
+    BSLS_TRY {
+        BloombergLP::bslma::ConstructionUtil::construct(rep->ptr(),
+                                                        allocator,
+                                                        arg1,
+                                                        arg2);
+    }
+    BSLS_CATCH(...) {
+        allocator->deallocate(rep);
+        BSLS_RETHROW;
+    }
+
+    local_shared_ptr result;
+    result.d_ptr_p = rep->ptr();
+    result.d_rep_p = rep;
+    result.swap(*this);
+}
+#endif
+
+template <class ELEMENT_TYPE>
+inline
+void local_shared_ptr<ELEMENT_TYPE>::reset() BSLS_KEYWORD_NOEXCEPT
+{
+    local_shared_ptr().swap(*this);
+}
+
+template <class ELEMENT_TYPE>
+template <class CONVERTIBLE_TYPE>
+inline
+void local_shared_ptr<ELEMENT_TYPE>::reset(
+                              CONVERTIBLE_TYPE              *ptr,
+                              BloombergLP::bslma::Allocator *basicAllocator)
+{
+    local_shared_ptr(ptr, basicAllocator).swap(*this);
+}
+
+template <class ELEMENT_TYPE>
+inline
+void local_shared_ptr<ELEMENT_TYPE>::swap(local_shared_ptr& other)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    ELEMENT_TYPE *ptr = d_ptr_p;
+    Rep          *rep = d_rep_p;
+
+    d_ptr_p = other.d_ptr_p;
+    d_rep_p = other.d_rep_p;
+    other.d_ptr_p = ptr;
+    other.d_rep_p = rep;
+}
+
+// ACCESSORS
+template <class ELEMENT_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::operator BoolType() const BSLS_KEYWORD_NOEXCEPT
+{
+    return BloombergLP::bsls::UnspecifiedBool<local_shared_ptr>::makeValue(
+                                                                      d_ptr_p);
+}
+
+template <class ELEMENT_TYPE>
+inline
+typename add_lvalue_reference<ELEMENT_TYPE>::type
+local_shared_ptr<ELEMENT_TYPE>::operator*() const BSLS_KEYWORD_NOEXCEPT
+{
+    BSLS_ASSERT_SAFE(d_ptr_p);
+
+    return *d_ptr_p;
+}
+
+template <class ELEMENT_TYPE>
+inline
+ELEMENT_TYPE *
+local_shared_ptr<ELEMENT_TYPE>::operator->() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_ptr_p;
+}
+
+template <class ELEMENT_TYPE>
+inline
+ELEMENT_TYPE *local_shared_ptr<ELEMENT_TYPE>::get() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_ptr_p;
+}
+
+template <class ELEMENT_TYPE>
+inline
+BloombergLP::bslstl::LocalSharedPtr_Rep *
+local_shared_ptr<ELEMENT_TYPE>::rep() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_rep_p;
+}
+
+template <class ELEMENT_TYPE>
+inline
+bool local_shared_ptr<ELEMENT_TYPE>::unique() const BSLS_KEYWORD_NOEXCEPT
+{
+    return 1 == use_count();
+}
+
+template <class ELEMENT_TYPE>
+inline
+long local_shared_ptr<ELEMENT_TYPE>::use_count() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_rep_p ? d_rep_p->numReferences() : 0;
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool bsl::operator==(const local_shared_ptr<LHS_TYPE>& lhs,
+                     const local_shared_ptr<RHS_TYPE>& rhs)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return lhs.get() == rhs.get();
+}
+
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool bsl::operator!=(const local_shared_ptr<LHS_TYPE>& lhs,
+                     const local_shared_ptr<RHS_TYPE>& rhs)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class ELEMENT_TYPE, class... ARGS>
+inline
+bsl::local_shared_ptr<ELEMENT_TYPE> bsl::allocate_local_shared(
+                              BloombergLP::bslma::Allocator *basicAllocator,
+                              ARGS&&...                      args)
+{
+    local_shared_ptr<ELEMENT_TYPE> result;
+    result.createInplace(basicAllocator,
+                         BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+    return result;
+}
+#endif
+
+template <class ELEMENT_TYPE>
+inline
+void bsl::swap(local_shared_ptr<ELEMENT_TYPE>& a,
+               local_shared_ptr<ELEMENT_TYPE>& b) BSLS_KEYWORD_NOEXCEPT
+{
+    a.swap(b);
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,845 @@
+// bslstl_localsharedptr.t.cpp                                        -*-C++-*-
+#include <bslstl_localsharedptr.h>
+
+#include <bslstl_sharedptr.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a shared pointer whose reference count is
+// not atomic.  We verify that each way of creating a 'local_shared_ptr'
+// allocates the object and its count from the intended allocator, that
+// copying, moving, assigning, and resetting maintain the count, and that the
+// object and count are freed exactly when the last owner releases them.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] local_shared_ptr();
+// [ 2] local_shared_ptr(bsl::nullptr_t);
+// [ 2] local_shared_ptr(CONVERTIBLE_TYPE *ptr, Allocator *ba = 0);
+// [ 3] local_shared_ptr(const local_shared_ptr<ANY_TYPE>& s, TYPE *o);
+// [ 3] local_shared_ptr(const local_shared_ptr& original);
+// [ 3] local_shared_ptr(const local_shared_ptr<CONVERTIBLE_TYPE>& orig);
+// [ 3] local_shared_ptr(MovableRef<local_shared_ptr> original);
+// [ 2] ~local_shared_ptr();
+//
+// MANIPULATORS
+// [ 3] local_shared_ptr& operator=(const local_shared_ptr& rhs);
+// [ 3] local_shared_ptr& operator=(MovableRef<local_shared_ptr> rhs);
+// [ 4] void createInplace(Allocator *ba, ARGS&&... args);
+// [ 3] void reset();
+// [ 3] void reset(CONVERTIBLE_TYPE *ptr, Allocator *ba = 0);
+// [ 3] void swap(local_shared_ptr& other);
+//
+// ACCESSORS
+// [ 2] operator BoolType() const;
+// [ 2] add_lvalue_reference<ELEMENT_TYPE>::type operator*() const;
+// [ 2] ELEMENT_TYPE *operator->() const;
+// [ 2] ELEMENT_TYPE *get() const;
+// [ 2] LocalSharedPtr_Rep *rep() const;
+// [ 2] bool unique() const;
+// [ 2] long use_count() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const local_shared_ptr&, const local_shared_ptr&);
+// [ 3] bool operator!=(const local_shared_ptr&, const local_shared_ptr&);
+//
+// FREE FUNCTIONS
+// [ 4] local_shared_ptr<ELEMENT_TYPE> allocate_local_shared(ba, args...);
+// [ 3] void swap(local_shared_ptr& a, local_shared_ptr& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: copying compared with 'bsl::shared_ptr'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+                               // =============
+                               // class Counted
+                               // =============
+
+class Counted {
+    // This class holds a value and counts the live objects of its type.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CLASS DATA
+    static int s_numLive;
+
+    // CREATORS
+    explicit Counted(int value = 0)
+    : d_value(value)
+    {
+        ++s_numLive;
+    }
+
+    Counted(const Counted& original)
+    : d_value(original.d_value)
+    {
+        ++s_numLive;
+    }
+
+    virtual ~Counted()
+    {
+        --s_numLive;
+    }
+
+    // ACCESSORS
+    int value() const
+        // Return the value of this object.
+    {
+        return d_value;
+    }
+};
+
+int Counted::s_numLive = 0;
+
+                            // ====================
+                            // class DerivedCounted
+                            // ====================
+
+class DerivedCounted : public Counted {
+    // This class derives from 'Counted', to test conversions, and counts its
+    // own live objects.
+
+  public:
+    // CLASS DATA
+    static int s_numDerivedLive;
+
+    // CREATORS
+    explicit DerivedCounted(int value)
+    : Counted(value)
+    {
+        ++s_numDerivedLive;
+    }
+
+    ~DerivedCounted() BSLS_KEYWORD_OVERRIDE
+    {
+        --s_numDerivedLive;
+    }
+};
+
+int DerivedCounted::s_numDerivedLive = 0;
+
+                             // ==================
+                             // class AllocCounted
+                             // ==================
+
+class AllocCounted {
+    // This class uses 'bslma::Allocator' memory, and records the allocator it
+    // was given.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;
+    int              *d_data_p;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AllocCounted, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit AllocCounted(bslma::Allocator *basicAllocator = 0)
+    : d_allocator_p(bslma::Default::allocator(basicAllocator))
+    , d_data_p(static_cast<int *>(d_allocator_p->allocate(sizeof(int))))
+    {
+        *d_data_p = 0;
+    }
+
+    AllocCounted(int value, int addend, bslma::Allocator *basicAllocator = 0)
+    : d_allocator_p(bslma::Default::allocator(basicAllocator))
+    , d_data_p(static_cast<int *>(d_allocator_p->allocate(sizeof(int))))
+    {
+        *d_data_p = value + addend;
+    }
+
+    ~AllocCounted()
+    {
+        d_allocator_p->deallocate(d_data_p);
+    }
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const
+        // Return the allocator of this object.
+    {
+        return d_allocator_p;
+    }
+
+    int value() const
+        // Return the value of this object.
+    {
+        return *d_data_p;
+    }
+};
+
+struct Pair {
+    // This 'struct' holds two values, so that a shared pointer to one can
+    // alias a shared pointer to the pair.
+
+    int d_first;
+    int d_second;
+};
+
+typedef bsl::local_shared_ptr<Counted> Obj;
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct Node {
+    int                         d_value;
+    bsl::local_shared_ptr<Node> d_left;
+    bsl::local_shared_ptr<Node> d_right;
+
+    explicit Node(int value) : d_value(value) {}
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+    bool veryVeryVerbose     = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate the usage example from the header into the test
+        //:   driver, remove leading comment characters, and replace 'assert'
+        //:   with 'ASSERT'.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+///Example 1: Sharing Nodes Within a Single Thread
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a single-threaded parser builds an expression tree in which a
+// common sub-expression may be shared by several parents.  Because the tree
+// never leaves the thread that builds it, the nodes can be shared with
+// 'local_shared_ptr'.
+//
+// First, we define the node type (see 'struct Node' above).
+//
+// Then, we create a leaf in a single allocation, and two parents that share
+// it:
+//..
+    bslma::TestAllocator ta;
+    {
+        bsl::local_shared_ptr<Node> leaf =
+                                     bsl::allocate_local_shared<Node>(&ta, 3);
+
+        bsl::local_shared_ptr<Node> left, right;
+        left.createInplace(&ta, 1);
+        right.createInplace(&ta, 2);
+        left->d_left  = leaf;
+        right->d_left = leaf;
+
+        ASSERT(3 == leaf.use_count());
+        ASSERT(3 == ta.numBlocksInUse());
+//..
+// Finally, we observe that the leaf is destroyed when the last of its owners
+// is:
+//..
+        leaf.reset();
+        left.reset();
+        ASSERT(2 == ta.numBlocksInUse());
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+//..
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'createInplace' AND 'allocate_local_shared'
+        //
+        // Concerns:
+        //: 1 The object and its count are created in a single block allocated
+        //:   from the supplied allocator, or from the default allocator if
+        //:   none is supplied.
+        //:
+        //: 2 The arguments are forwarded to the constructor of the object, as
+        //:   is the allocator if the object uses 'bslma::Allocator'.
+        //:
+        //: 3 Any previous ownership is released.
+        //:
+        //: 4 If the constructor of the object throws, the block is freed and
+        //:   the 'local_shared_ptr' is unchanged.
+        //
+        // Plan:
+        //: 1 Create objects in place with zero, one, and two arguments, and
+        //:   with and without an allocator, and verify the value of the
+        //:   object, its allocator, and the blocks in use by each allocator.
+        //:   (C-1..3)
+        //:
+        //: 2 Use the exception-test macros to verify exception neutrality.
+        //:   (C-4)
+        //
+        // Testing:
+        //   void createInplace(Allocator *ba, ARGS&&... args);
+        //   local_shared_ptr<ELEMENT_TYPE> allocate_local_shared(ba, args...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'createInplace' AND 'allocate_local_shared'"
+                            "\n===========================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.createInplace(&oa);
+            ASSERT(X);
+            ASSERT(0 == X->value());
+            ASSERT(1 == X.use_count());
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+            mX.createInplace(&oa, 5);
+            ASSERT(5 == X->value());
+            ASSERTV(Counted::s_numLive, 1 == Counted::s_numLive);
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+            mX.createInplace(0, 6);
+            ASSERT(6 == X->value());
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(defaultAllocator.numBlocksInUse(),
+                    1 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERTV(Counted::s_numLive, 0 == Counted::s_numLive);
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+
+        if (veryVerbose) printf("\tAllocator-aware element.\n");
+        {
+            bsl::local_shared_ptr<AllocCounted> mX;
+            mX.createInplace(&oa);
+            ASSERT(&oa == mX->allocator());
+            ASSERT(0 == mX->value());
+            ASSERTV(oa.numBlocksInUse(), 2 == oa.numBlocksInUse());
+
+            mX.createInplace(&oa, 3, 4);
+            ASSERT(&oa == mX->allocator());
+            ASSERT(7 == mX->value());
+            ASSERTV(oa.numBlocksInUse(), 2 == oa.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+        {
+            bsl::local_shared_ptr<AllocCounted> mX =
+                         bsl::allocate_local_shared<AllocCounted>(&oa, 1, 2);
+            ASSERT(&oa == mX->allocator());
+            ASSERT(3 == mX->value());
+            ASSERT(1 == mX.use_count());
+            ASSERTV(oa.numBlocksInUse(), 2 == oa.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+#endif
+
+        if (veryVerbose) printf("\tException neutrality.\n");
+        {
+            bsl::local_shared_ptr<AllocCounted> mX;
+            mX.createInplace(&oa, 1, 1);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                mX.createInplace(&oa, 2, 2);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(4 == mX->value());
+            ASSERT(1 == mX.use_count());
+            ASSERTV(oa.numBlocksInUse(), 2 == oa.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, ALIASING, 'reset', AND 'swap'
+        //
+        // Concerns:
+        //: 1 Copying (including to a pointer to a base class) and copy
+        //:   assignment share ownership and increment the count.
+        //:
+        //: 2 Moving and move assignment transfer ownership without changing
+        //:   the count, and leave the source empty.
+        //:
+        //: 3 Assignment releases the previous ownership, and self-assignment
+        //:   has no effect.
+        //:
+        //: 4 An aliasing 'local_shared_ptr' holds its own pointer and shares
+        //:   ownership with its source.
+        //:
+        //: 5 'reset' releases ownership, and optionally takes a new one.
+        //:
+        //: 6 'swap' exchanges values without changing counts.
+        //:
+        //: 7 '==' and '!=' compare the held pointers.
+        //
+        // Plan:
+        //: 1 Perform each operation and verify the held pointers, the
+        //:   'use_count' of each object, and the number of live elements.
+        //:   (C-1..7)
+        //
+        // Testing:
+        //   local_shared_ptr(const local_shared_ptr<ANY_TYPE>& s, TYPE *o);
+        //   local_shared_ptr(const local_shared_ptr& original);
+        //   local_shared_ptr(const local_shared_ptr<CONVERTIBLE_TYPE>& orig);
+        //   local_shared_ptr(MovableRef<local_shared_ptr> original);
+        //   local_shared_ptr& operator=(const local_shared_ptr& rhs);
+        //   local_shared_ptr& operator=(MovableRef<local_shared_ptr> rhs);
+        //   void reset();
+        //   void reset(CONVERTIBLE_TYPE *ptr, Allocator *ba = 0);
+        //   void swap(local_shared_ptr& other);
+        //   bool operator==(const local_shared_ptr&, const local_shared_ptr&);
+        //   bool operator!=(const local_shared_ptr&, const local_shared_ptr&);
+        //   void swap(local_shared_ptr& a, local_shared_ptr& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, ASSIGNMENT, ALIASING, 'reset',"
+                            " AND 'swap'"
+                            "\n========================================="
+                            "==========\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mA(new (oa) Counted(1), &oa);  const Obj& A = mA;
+
+            if (veryVerbose) printf("\tCopy.\n");
+
+            Obj mB(A);  const Obj& B = mB;
+            ASSERT(B == A);
+            ASSERT(B.rep() == A.rep());
+            ASSERTV(A.use_count(), 2 == A.use_count());
+
+            bsl::local_shared_ptr<DerivedCounted> mD(
+                                                  new (oa) DerivedCounted(2),
+                                                  &oa);
+            Obj mC(mD);  const Obj& C = mC;
+            ASSERT(2 == C->value());
+            ASSERTV(C.use_count(), 2 == C.use_count());
+
+            if (veryVerbose) printf("\tMove.\n");
+
+            Obj mE(MoveUtil::move(mB));  const Obj& E = mE;
+            ASSERT(!B);
+            ASSERT(0 == B.rep());
+            ASSERT(E == A);
+            ASSERTV(A.use_count(), 2 == A.use_count());
+
+            if (veryVerbose) printf("\tAssignment.\n");
+
+            mB = C;
+            ASSERT(B == C);
+            ASSERTV(C.use_count(), 3 == C.use_count());
+
+            mB = B;
+            ASSERTV(C.use_count(), 3 == C.use_count());
+
+            mB = MoveUtil::move(mE);
+            ASSERT(!E);
+            ASSERT(B == A);
+            ASSERTV(A.use_count(), 2 == A.use_count());
+            ASSERTV(C.use_count(), 2 == C.use_count());
+
+            mD.reset();
+            mC = A;
+            ASSERTV(DerivedCounted::s_numDerivedLive,
+                    0 == DerivedCounted::s_numDerivedLive);
+            ASSERTV(A.use_count(), 3 == A.use_count());
+
+            if (veryVerbose) printf("\t'swap' and comparison.\n");
+
+            Obj mF(new (oa) Counted(3), &oa);  const Obj& F = mF;
+            ASSERT(F != A);
+
+            mF.swap(mA);
+            ASSERT(3 == F.use_count());
+            ASSERT(1 == A.use_count());
+            ASSERT(3 == A->value());
+
+            bsl::swap(mA, mF);
+            ASSERT(1 == A->value());
+            ASSERT(3 == F->value());
+            ASSERT(1 == F.use_count());
+
+            if (veryVerbose) printf("\t'reset'.\n");
+
+            mF.reset();
+            ASSERT(!F);
+            ASSERT(0 == F.use_count());
+            ASSERTV(Counted::s_numLive, 1 == Counted::s_numLive);
+
+            mF.reset(new (oa) Counted(4), &oa);
+            ASSERT(4 == F->value());
+            ASSERT(F.unique());
+            ASSERTV(Counted::s_numLive, 2 == Counted::s_numLive);
+
+            mA.reset();
+            mB.reset();
+            ASSERT(C.unique());
+            mC.reset();
+            ASSERTV(Counted::s_numLive, 1 == Counted::s_numLive);
+        }
+        ASSERTV(Counted::s_numLive, 0 == Counted::s_numLive);
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (veryVerbose) printf("\tAliasing.\n");
+        {
+            bsl::local_shared_ptr<Pair> mP;
+            mP.createInplace(&oa);
+            mP->d_first  = 1;
+            mP->d_second = 2;
+
+            bsl::local_shared_ptr<int> mS(mP, &mP->d_second);
+            ASSERT(mS.get() == &mP->d_second);
+            ASSERT(mS.rep() == mP.rep());
+            ASSERT(2 == mP.use_count());
+
+            mP.reset();
+            ASSERT(2 == *mS);
+            ASSERT(mS.unique());
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+            int                        value = 0;
+            bsl::local_shared_ptr<int> mN(mP, &value);
+            ASSERT(&value == mN.get());
+            ASSERT(0 == mN.rep());
+            ASSERT(0 == mN.use_count());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed or null 'local_shared_ptr' is empty and
+        //:   allocates nothing.
+        //:
+        //: 2 A 'local_shared_ptr' taking ownership of a pointer allocates its
+        //:   count from the supplied allocator, or the default allocator if
+        //:   none is supplied, and destroys and deallocates the object with
+        //:   that allocator.
+        //:
+        //: 3 Taking ownership of a null pointer allocates nothing.
+        //:
+        //: 4 If the count cannot be allocated, the object is destroyed and
+        //:   deallocated.
+        //:
+        //: 5 The accessors return the held pointer and the count.
+        //
+        // Plan:
+        //: 1 Create objects in each way and verify the accessors, the number
+        //:   of live elements, and the blocks in use by the allocators.
+        //:   (C-1..3, 5)
+        //:
+        //: 2 Use the exception-test macros to verify that the object is freed
+        //:   if allocating the count throws.  (C-4)
+        //
+        // Testing:
+        //   local_shared_ptr();
+        //   local_shared_ptr(bsl::nullptr_t);
+        //   local_shared_ptr(CONVERTIBLE_TYPE *ptr, Allocator *ba = 0);
+        //   ~local_shared_ptr();
+        //   operator BoolType() const;
+        //   add_lvalue_reference<ELEMENT_TYPE>::type operator*() const;
+        //   ELEMENT_TYPE *operator->() const;
+        //   ELEMENT_TYPE *get() const;
+        //   LocalSharedPtr_Rep *rep() const;
+        //   bool unique() const;
+        //   long use_count() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS AND ACCESSORS"
+                            "\n======================\n");
+
+        ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            const Obj X;
+            ASSERT(!X);
+            ASSERT(0 == X.get());
+            ASSERT(0 == X.rep());
+            ASSERT(0 == X.use_count());
+            ASSERT(!X.unique());
+
+            const Obj Y(bsl::nullptr_t(0));
+            ASSERT(!Y);
+            ASSERT(0 == Y.use_count());
+
+            const Obj Z(static_cast<Counted *>(0), &oa);
+            ASSERT(!Z);
+            ASSERT(0 == Z.use_count());
+            ASSERT(0 == oa.numBlocksTotal());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+        {
+            Counted *p = new (oa) Counted(7);
+
+            const Obj X(p, &oa);
+            ASSERT(X);
+            ASSERT(p == X.get());
+            ASSERT(p == X.operator->());
+            ASSERT(p == &*X);
+            ASSERT(7 == X->value());
+            ASSERT(0 != X.rep());
+            ASSERT(1 == X.use_count());
+            ASSERT(X.unique());
+            ASSERTV(oa.numBlocksInUse(), 2 == oa.numBlocksInUse());
+        }
+        ASSERTV(Counted::s_numLive, 0 == Counted::s_numLive);
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        {
+            const Obj X(new (defaultAllocator) DerivedCounted(8));
+            ASSERT(8 == X->value());
+            ASSERTV(defaultAllocator.numBlocksInUse(),
+                    2 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERTV(Counted::s_numLive, 0 == Counted::s_numLive);
+        ASSERTV(DerivedCounted::s_numDerivedLive,
+                0 == DerivedCounted::s_numDerivedLive);
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+
+        if (veryVerbose) printf("\tException neutrality.\n");
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+            const bsls::Types::Int64 limit = oa.allocationLimit();
+            oa.setAllocationLimit(-1);
+            Counted *p = new (oa) Counted(9);
+            oa.setAllocationLimit(limit);
+
+            const Obj X(p, &oa);
+            ASSERT(9 == X->value());
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        ASSERTV(Counted::s_numLive, 0 == Counted::s_numLive);
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform an ad-hoc test of the primary operations.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX;  const Obj& X = mX;
+            mX.createInplace(&oa, 1);
+            ASSERT(1 == X->value());
+            ASSERT(1 == X.use_count());
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERT(Y == X);
+            ASSERT(2 == X.use_count());
+
+            mX.reset();
+            ASSERT(!X);
+            ASSERT(1 == Y.use_count());
+            ASSERT(1 == Counted::s_numLive);
+        }
+        ASSERT(0 == Counted::s_numLive);
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COPYING COMPARED WITH 'bsl::shared_ptr'
+        //
+        // Concerns:
+        //: 1 Copying and destroying a 'local_shared_ptr' is cheaper than
+        //:   copying and destroying a 'bsl::shared_ptr'.
+        //
+        // Plan:
+        //: 1 Time the same number of copies of a 'local_shared_ptr' and of a
+        //:   'bsl::shared_ptr', and report the elapsed times.  The number of
+        //:   copies can be given as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: copying compared with 'bsl::shared_ptr'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: COPYING COMPARED WITH"
+                            " 'bsl::shared_ptr'"
+                            "\n=================================="
+                            "==================\n");
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 10000000;
+
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        enum { k_NUM_COPIES = 16 };
+
+        double elapsed[2];
+        long   total[2] = { 0, 0 };
+        {
+            Obj source;
+            source.createInplace(allocator, 1);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                Obj copies[k_NUM_COPIES];
+                for (int j = 0; j < k_NUM_COPIES; ++j) {
+                    copies[j] = source;
+                }
+                total[0] += copies[i % k_NUM_COPIES].use_count();
+            }
+            timer.stop();
+            elapsed[0] = timer.elapsedTime();
+        }
+        {
+            bsl::shared_ptr<Counted> source;
+            source.createInplace(allocator, 1);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                bsl::shared_ptr<Counted> copies[k_NUM_COPIES];
+                for (int j = 0; j < k_NUM_COPIES; ++j) {
+                    copies[j] = source;
+                }
+                total[1] += copies[i % k_NUM_COPIES].use_count();
+            }
+            timer.stop();
+            elapsed[1] = timer.elapsedTime();
+        }
+        ASSERTV(total[0], total[1], total[0] == total[1]);
+
+        printf("local_shared_ptr: %gs\n", elapsed[0]);
+        printf("shared_ptr:       %gs\n", elapsed[1]);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,2193 @@
+// bslstl_smallvector.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SMALLVECTOR
+#define INCLUDED_BSLSTL_SMALLVECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector holding a few elements without allocating.
+//
+//@CLASSES:
+//   bsl::small_vector: vector with inline storage for 'N' elements
+//
+//@SEE_ALSO: bslstl_vector, bslalg_arrayprimitives
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::small_vector', implementing a sequence container with the interface
+// of 'bsl::vector', but having, within the object itself, storage for a
+// number of elements fixed at compile time (the template parameter
+// 'INLINE_CAPACITY').  A 'small_vector' holding no more than
+// 'INLINE_CAPACITY' elements does not allocate memory; once it grows beyond
+// that, it moves its elements to an array obtained from its allocator, as a
+// 'bsl::vector' would, and from then on behaves like one.
+//
+// An instantiation of 'small_vector' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of elements) and the
+// sequence of values the 'small_vector' contains.  The inline capacity is not
+// a salient attribute: 'small_vector' objects having different inline
+// capacities are distinct types.
+//
+///Choosing Between 'vector' and 'small_vector'
+///--------------------------------------------
+// A 'bsl::vector' allocates as soon as it holds an element, so that a
+// structure holding many short 'vector' members performs an allocation (and
+// later a deallocation) for each of them.  A 'small_vector' whose inline
+// capacity covers the typical number of elements performs neither, and its
+// elements share cache lines with the rest of the enclosing object.  On the
+// other hand:
+//
+//: o A 'small_vector' is larger than a 'vector' by the size of its inline
+//:   storage, which is wasted when the 'small_vector' is empty or has spilled
+//:   to the heap.
+//:
+//: o Moving or swapping a 'small_vector' whose elements are held inline moves
+//:   each of its elements (see {Relocation of Elements}), rather than taking
+//:   constant time.
+//:
+//: o Moving a 'small_vector' invalidates all iterators, pointers, and
+//:   references to its elements, even when the elements are held on the heap
+//:   and the move itself takes constant time.
+//
+// 'small_vector' is therefore best used for short sequences whose maximum
+// length is usually, but not always, small and known in advance, such as the
+// repeated fields of a message.
+//
+///Relocation of Elements
+///----------------------
+// 'small_vector' creates, moves, and destroys its elements using the
+// primitives of 'bslalg::ArrayPrimitives', as 'bsl::vector' does.  In
+// particular, whenever it must relocate its elements (when spilling from the
+// inline storage to the heap, growing on the heap, returning to the inline
+// storage in 'shrink_to_fit', and moving or swapping a 'small_vector' whose
+// elements are held inline), it uses 'ArrayPrimitives::destructiveMove', which
+// relocates elements of a type having the 'bslmf::IsBitwiseMoveable' trait
+// using 'memcpy', rather than by move-constructing and destroying each one.
+// Types such as 'bsl::string' and 'bsl::vector' have this trait, and so may be
+// held in a 'small_vector' at no more cost than in a 'bsl::vector'.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'small_vector''s 'ALLOCATOR' template parameter
+// determines how that 'small_vector' will allocate memory once it holds more
+// than 'INLINE_CAPACITY' elements.  If it is 'bsl::allocator' (the default),
+// then a 'small_vector' accepts an optional 'bslma::Allocator' argument at
+// construction, uses it to supply memory for its array of elements, and
+// supplies it to the elements themselves (whether held inline or on the heap)
+// if they have the 'bslma::UsesBslmaAllocator' trait.  If no allocator is
+// supplied, the currently installed default allocator is used.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'small_vector':
+//..
+//  Legend
+//  ------
+//  'V'             - (template parameter) type 'VALUE_TYPE' of the vector
+//  'N'             - (template parameter) 'INLINE_CAPACITY' of the vector
+//  'a', 'b'        - two distinct objects of type 'small_vector<V, N>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'k'             - non-negative integer
+//  'v'             - an object of type 'V'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  'i1', 'i2'      - two iterators defining a sequence of 'V' objects
+//  'M'             - distance(i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | small_vector<V, N> a;  (default construction)      | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | small_vector<V, N> a(b);  (copy construction)      | O[m]               |
+//  +----------------------------------------------------+--------------------+
+//  | small_vector<V, N> a(k, v);                        | O[k]               |
+//  +----------------------------------------------------+--------------------+
+//  | small_vector<V, N> a(i1, i2);                      | O[M]               |
+//  +----------------------------------------------------+--------------------+
+//  | small_vector<V, N> a(MoveUtil::move(b));           | O[1] if 'b' is on  |
+//  |                                                    | the heap, O[m]     |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a.push_back(v), a.emplace_back(...)                | amortized O[1]     |
+//  +----------------------------------------------------+--------------------+
+//  | a.pop_back()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(p1, v), a.insert(p1, k, v),               | O[n + k] or        |
+//  | a.insert(p1, i1, i2), a.erase(p1), a.erase(p1, p2) | O[n + M]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a, b)                              | O[1] if 'a' and    |
+//  |                                                    | 'b' are on the     |
+//  |                                                    | heap, O[n + m]     |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b, a < b, a <= b, a > b, a >= b       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.size(), a.empty(), a[k],     | O[1]               |
+//  | a.capacity(), a.front(), a.back(), a.data()        |                    |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding a Message Without Allocating
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the messages received by a service each carry a list of
+// routing hops, which rarely exceeds four, and that each message is decoded
+// into a short-lived structure.  Holding the hops in a 'bsl::vector' would
+// cost an allocation per message; holding them in a 'small_vector' with an
+// inline capacity of four costs none for the typical message.
+//
+// First, we define the decoded form of a message:
+//..
+//  struct Message {
+//      int                       d_id;
+//      bsl::small_vector<int, 4> d_hops;
+//
+//      explicit Message(bslma::Allocator *basicAllocator = 0)
+//      : d_id(0)
+//      , d_hops(basicAllocator)
+//      {
+//      }
+//  };
+//..
+// Then, we decode a typical message, and observe that no memory is
+// allocated:
+//..
+//  bslma::TestAllocator ta;
+//
+//  Message message(&ta);
+//  message.d_hops.push_back(17);
+//  message.d_hops.push_back(42);
+//  message.d_hops.push_back(8);
+//  assert(3 == message.d_hops.size());
+//  assert(0 == ta.numAllocations());
+//..
+// Next, a message with more hops than the inline capacity arrives, and the
+// 'small_vector' moves its elements to storage supplied by the allocator:
+//..
+//  message.d_hops.push_back(3);
+//  message.d_hops.push_back(99);
+//  assert(5  == message.d_hops.size());
+//  assert(1  == ta.numBlocksInUse());
+//  assert(17 == message.d_hops.front());
+//  assert(99 == message.d_hops.back());
+//..
+// Finally, after the message is processed, we reuse the structure for the
+// next one and return the memory to the allocator:
+//..
+//  message.d_hops.clear();
+//  message.d_hops.shrink_to_fit();
+//  assert(0 == ta.numBlocksInUse());
+//  assert(4 == message.d_hops.capacity());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_stdexceptutil.h>
+
+#include <bslalg_arraydestructionprimitives.h>
+#include <bslalg_arrayprimitives.h>
+#include <bslalg_containerbase.h>
+#include <bslalg_rangecompare.h>
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isconvertible.h>
+#include <bslmf_matchanytype.h>
+#include <bslmf_matcharithmetictype.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nil.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_performancehint.h>
+
+#include <cstddef>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace bsl {
+
+                            // ==================
+                            // class small_vector
+                            // ==================
+
+template <class VALUE_TYPE,
+          std::size_t INLINE_CAPACITY,
+          class ALLOCATOR = allocator<VALUE_TYPE> >
+class small_vector
+                 : private BloombergLP::bslalg::ContainerBase<ALLOCATOR> {
+    // This class template implements a value-semantic container type holding
+    // a sequence of elements (of the template parameter type, 'VALUE_TYPE')
+    // in contiguous storage, which is held within the object itself while the
+    // sequence has no more than 'INLINE_CAPACITY' elements, and is obtained
+    // from the allocator otherwise.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   except for 'BDEX' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslalg::ContainerBase<ALLOCATOR> ContainerBase;
+        // Container base type, containing the allocator and applying the empty
+        // base class optimization (EBO) whenever appropriate.
+
+    typedef BloombergLP::bslalg::ArrayPrimitives          ArrayPrimitives;
+        // This 'typedef' is a convenient alias for the utility used to
+        // construct, relocate, and destroy the elements.
+
+    typedef bsl::allocator_traits<ALLOCATOR>              AllocatorTraits;
+        // This 'typedef' is an alias for the allocator traits of 'ALLOCATOR'.
+
+    typedef BloombergLP::bslmf::MovableRefUtil            MoveUtil;
+        // This 'typedef' is a convenient alias for the utility associated
+        // with movable references.
+
+    enum {
+        k_BUFFER_LENGTH = INLINE_CAPACITY ? INLINE_CAPACITY : 1
+                                             // number of elements the inline
+                                             // buffer can hold, which must be
+                                             // positive
+    };
+
+    typedef BloombergLP::bsls::AlignedBuffer<
+                 k_BUFFER_LENGTH * sizeof(VALUE_TYPE),
+                 BloombergLP::bsls::AlignmentFromType<VALUE_TYPE>::VALUE>
+                                                          InlineBuffer;
+        // This 'typedef' is an alias for the type of the inline storage.
+
+    // DATA
+    VALUE_TYPE   *d_dataBegin_p;  // first element (inline or on the heap)
+    VALUE_TYPE   *d_dataEnd_p;    // one past the last element
+    std::size_t   d_capacity;     // number of elements 'd_dataBegin_p' holds
+    InlineBuffer  d_buffer;       // inline storage for 'INLINE_CAPACITY'
+                                  // elements
+
+    // PRIVATE MANIPULATORS
+    VALUE_TYPE *inlineData();
+        // Return the address of the inline storage of this object.
+
+    void privateAdoptStorage(small_vector *other);
+        // Take ownership of the heap storage held by the specified 'other'
+        // object, along with the elements in it, leaving 'other' empty.  The
+        // behavior is undefined unless this object is empty, 'other' holds
+        // its elements on the heap, and this object and 'other' use equal
+        // allocators.
+
+    void privateGrow(std::size_t newCapacity);
+        // Relocate the elements of this object to heap storage having the
+        // specified 'newCapacity'.  The behavior is undefined unless
+        // 'capacity() < newCapacity'.
+
+    template <class INTEGRAL_TYPE>
+    void privateInsertDispatch(
+                             const VALUE_TYPE                        *position,
+                             INTEGRAL_TYPE                            count,
+                             INTEGRAL_TYPE                            value,
+                             BloombergLP::bslmf::MatchArithmeticType,
+                             BloombergLP::bslmf::Nil);
+    template <class INPUT_ITER>
+    void privateInsertDispatch(const VALUE_TYPE                 *position,
+                               INPUT_ITER                        first,
+                               INPUT_ITER                        last,
+                               BloombergLP::bslmf::MatchAnyType,
+                               BloombergLP::bslmf::MatchAnyType);
+        // Insert at the specified 'position' the elements in the range
+        // '[first .. last)', or, if 'first' and 'last' are of an integral
+        // type (and so cannot be iterators), 'first' copies of 'last'.
+
+    template <class INPUT_ITER>
+    void privateInsert(const VALUE_TYPE        *position,
+                       INPUT_ITER               first,
+                       INPUT_ITER               last,
+                       std::input_iterator_tag);
+    template <class FWD_ITER>
+    void privateInsert(const VALUE_TYPE          *position,
+                       FWD_ITER                   first,
+                       FWD_ITER                   last,
+                       std::forward_iterator_tag);
+        // Insert at the specified 'position' the elements in the range
+        // '[first .. last)'.
+
+    void privateMoveFrom(small_vector *other);
+        // Move the elements of the specified 'other' object into this object,
+        // taking ownership of the storage of 'other' if it is on the heap and
+        // relocating the elements otherwise, and leave 'other' empty.  The
+        // behavior is undefined unless this object is empty and holds its
+        // elements inline, and this object and 'other' use equal allocators.
+
+    void privateSwap(small_vector *other);
+        // Exchange the elements of this object with those of the specified
+        // 'other' object.  The behavior is undefined unless this object and
+        // 'other' use equal allocators (after any propagation).
+
+    // PRIVATE ACCESSORS
+    const VALUE_TYPE *inlineData() const;
+        // Return the address of the inline storage of this object.
+
+    std::size_t privateNewCapacity(std::size_t newSize) const;
+        // Return the capacity to which this object must grow to hold the
+        // specified 'newSize' elements, which is at least twice the current
+        // capacity (to amortize the cost of growth) and at most 'max_size()'.
+        // The behavior is undefined unless 'capacity() < newSize' and
+        // 'newSize <= max_size()'.
+
+  public:
+    // PUBLIC TYPES
+    typedef VALUE_TYPE                                  value_type;
+    typedef ALLOCATOR                                   allocator_type;
+    typedef VALUE_TYPE&                                 reference;
+    typedef const VALUE_TYPE&                           const_reference;
+
+    typedef typename AllocatorTraits::size_type         size_type;
+    typedef typename AllocatorTraits::difference_type   difference_type;
+    typedef typename AllocatorTraits::pointer           pointer;
+    typedef typename AllocatorTraits::const_pointer     const_pointer;
+
+    typedef VALUE_TYPE                                 *iterator;
+    typedef const VALUE_TYPE                           *const_iterator;
+    typedef bsl::reverse_iterator<iterator>             reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>       const_reverse_iterator;
+
+    // CREATORS
+    small_vector() BSLS_KEYWORD_NOEXCEPT;
+    explicit small_vector(const ALLOCATOR& basicAllocator)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+        // Create an empty vector, holding no memory beyond its inline
+        // storage.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'ALLOCATOR' is used.  If the
+        // type 'ALLOCATOR' is 'bsl::allocator' and 'basicAllocator' is not
+        // supplied, the currently installed default allocator is used.
+
+    explicit small_vector(size_type        initialSize,
+                          const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create a vector of the specified 'initialSize' default-constructed
+        // elements.  Optionally specify a 'basicAllocator' used to supply
+        // memory, as for the default constructor.  Throw 'bsl::length_error'
+        // if 'initialSize > max_size()'.
+
+    small_vector(size_type         initialSize,
+                 const VALUE_TYPE& value,
+                 const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create a vector of the specified 'initialSize' copies of the
+        // specified 'value'.  Optionally specify a 'basicAllocator' used to
+        // supply memory, as for the default constructor.  Throw
+        // 'bsl::length_error' if 'initialSize > max_size()'.
+
+    template <class INPUT_ITER>
+    small_vector(INPUT_ITER       first,
+                 INPUT_ITER       last,
+                 const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create a vector holding, in order, the elements in the specified
+        // range '[first .. last)'.  Optionally specify a 'basicAllocator' used
+        // to supply memory, as for the default constructor.  Throw
+        // 'bsl::length_error' if the number of elements in the range exceeds
+        // 'max_size()'.  'INPUT_ITER' must meet the requirements of an input
+        // iterator, and its 'value_type' must be convertible to 'VALUE_TYPE'.
+        // If 'INPUT_ITER' is an integral type, this constructor behaves as the
+        // constructor taking a size and a value.
+
+    small_vector(const small_vector& original);
+        // Create a vector having the same value as the specified 'original'
+        // object, using the allocator returned by 'bsl::allocator_traits<
+        // ALLOCATOR>::select_on_container_copy_construction(
+        // original.get_allocator())' to supply memory.
+
+    small_vector(BloombergLP::bslmf::MovableRef<small_vector> original);
+                                                                    // IMPLICIT
+        // Create a vector having the same value as the specified 'original'
+        // object, using the allocator of 'original' to supply memory, and
+        // leave 'original' empty.  If 'original' holds its elements on the
+        // heap, its storage is transferred to the new vector in constant time;
+        // otherwise, its elements are relocated (see
+        // {Relocation of Elements}).
+
+    small_vector(const small_vector& original,
+                 const ALLOCATOR&    basicAllocator);
+        // Create a vector having the same value as the specified 'original'
+        // object, using the specified 'basicAllocator' to supply memory.
+
+    small_vector(BloombergLP::bslmf::MovableRef<small_vector> original,
+                 const ALLOCATOR&                             basicAllocator);
+        // Create a vector having the same value as the specified 'original'
+        // object, using the specified 'basicAllocator' to supply memory.  If
+        // 'basicAllocator == original.get_allocator()', the elements of
+        // 'original' are moved as for the move constructor and 'original' is
+        // left empty; otherwise, they are move-inserted (in linear time) and
+        // 'original' is left in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    small_vector(
+              std::initializer_list<VALUE_TYPE> values,
+              const ALLOCATOR&                  basicAllocator = ALLOCATOR());
+        // Create a vector holding, in order, the elements in the specified
+        // 'values' initializer list.  Optionally specify a 'basicAllocator'
+        // used to supply memory, as for the default constructor.
+#endif
+
+    ~small_vector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    small_vector& operator=(const small_vector& rhs);
+        // Assign to this object the value of the specified 'rhs' object,
+        // propagate to this object the allocator of 'rhs' if the 'ALLOCATOR'
+        // type has trait 'propagate_on_container_copy_assignment', and return
+        // a reference providing modifiable access to this object.
+
+    small_vector& operator=(BloombergLP::bslmf::MovableRef<small_vector> rhs);
+        // Assign to this object the value of the specified 'rhs' object,
+        // propagate to this object the allocator of 'rhs' if the 'ALLOCATOR'
+        // type has trait 'propagate_on_container_move_assignment', and return
+        // a reference providing modifiable access to this object.  The
+        // elements of 'rhs' are moved as for the move constructor if the
+        // allocators are (or, after propagation, become) equal, and are
+        // move-inserted (in linear time) otherwise.  'rhs' is left in a valid
+        // but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    small_vector& operator=(std::initializer_list<VALUE_TYPE> values);
+        // Assign to this object the elements of the specified 'values'
+        // initializer list, and return a reference providing modifiable access
+        // to this object.
+#endif
+
+    template <class INPUT_ITER>
+    void assign(INPUT_ITER first, INPUT_ITER last);
+        // Assign to this object the elements in the specified range
+        // '[first .. last)'.  The behavior is undefined unless the range does
+        // not refer to elements of this object.  If 'INPUT_ITER' is an
+        // integral type, this method behaves as 'assign(first, last)' taking
+        // a size and a value.
+
+    void assign(size_type numElements, const VALUE_TYPE& value);
+        // Assign to this object the specified 'numElements' copies of the
+        // specified 'value'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void assign(std::initializer_list<VALUE_TYPE> values);
+        // Assign to this object the elements of the specified 'values'
+        // initializer list.
+#endif
+
+                               // *** iterators ***
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing modifiable access to the first element
+        // of this vector, or the past-the-end iterator if this vector is
+        // empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator providing modifiable access to this
+        // vector.
+
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing modifiable access to the last
+        // element of this vector, or 'rend()' if this vector is empty.
+
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator providing modifiable access
+        // to this vector.
+
+                            // *** element access ***
+
+    reference operator[](size_type position);
+        // Return a reference providing modifiable access to the element at the
+        // specified 'position' in this vector.  The behavior is undefined
+        // unless 'position < size()'.
+
+    reference at(size_type position);
+        // Return a reference providing modifiable access to the element at the
+        // specified 'position' in this vector.  Throw 'bsl::out_of_range' if
+        // 'position >= size()'.
+
+    reference front();
+        // Return a reference providing modifiable access to the first element
+        // of this vector.  The behavior is undefined unless this vector is not
+        // empty.
+
+    reference back();
+        // Return a reference providing modifiable access to the last element
+        // of this vector.  The behavior is undefined unless this vector is not
+        // empty.
+
+    VALUE_TYPE *data() BSLS_KEYWORD_NOEXCEPT;
+        // Return the address of the modifiable first element of this vector,
+        // which, if this vector is empty, may not be dereferenced.
+
+                              // *** capacity ***
+
+    void reserve(size_type newCapacity);
+        // Change the capacity of this vector to at least the specified
+        // 'newCapacity', moving its elements to the heap if 'newCapacity'
+        // exceeds the current capacity.  Throw 'bsl::length_error' if
+        // 'newCapacity > max_size()'.
+
+    void resize(size_type newSize);
+    void resize(size_type newSize, const VALUE_TYPE& value);
+        // Change the size of this vector to the specified 'newSize', erasing
+        // elements at the back if 'newSize < size()', and appending
+        // default-constructed elements, or copies of the optionally specified
+        // 'value', if 'newSize > size()'.  Throw 'bsl::length_error' if
+        // 'newSize > max_size()'.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this vector to its size, or to
+        // 'INLINE_CAPACITY' if the size does not exceed it, in which case the
+        // elements are moved back to the inline storage and the heap storage
+        // is returned to the allocator.
+
+                              // *** modifiers ***
+
+    void push_back(const VALUE_TYPE& value);
+    void push_back(BloombergLP::bslmf::MovableRef<VALUE_TYPE> value);
+        // Append to the end of this vector a copy of, or the value moved from,
+        // the specified 'value'.  If an exception is thrown, this vector is
+        // unchanged.  Throw 'bsl::length_error' if 'size() == max_size()'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    reference emplace_back(ARGS&&... arguments);
+        // Append to the end of this vector a newly created 'value_type'
+        // object, constructed by forwarding 'get_allocator()' (if required)
+        // and the specified (variable number of) 'arguments' to the
+        // corresponding constructor of 'value_type', and return a reference
+        // providing modifiable access to the new element.  If an exception is
+        // thrown, this vector is unchanged.  Throw 'bsl::length_error' if
+        // 'size() == max_size()'.
+
+    template <class... ARGS>
+    iterator emplace(const_iterator position, ARGS&&... arguments);
+        // Insert at the specified 'position' in this vector a newly created
+        // 'value_type' object, constructed by forwarding 'get_allocator()'
+        // (if required) and the specified (variable number of) 'arguments' to
+        // the corresponding constructor of 'value_type', and return an
+        // iterator to the new element.  Throw 'bsl::length_error' if
+        // 'size() == max_size()'.  The behavior is undefined unless
+        // 'position' is an iterator in the range '[cbegin() .. cend()]'.
+#endif
+
+    void pop_back();
+        // Erase the last element of this vector.  The behavior is undefined
+        // if this vector is empty.
+
+    iterator insert(const_iterator position, const VALUE_TYPE& value);
+    iterator insert(const_iterator                             position,
+                    BloombergLP::bslmf::MovableRef<VALUE_TYPE> value);
+        // Insert at the specified 'position' in this vector a copy of, or the
+        // value moved from, the specified 'value', and return an iterator to
+        // the inserted element.  Throw 'bsl::length_error' if
+        // 'size() == max_size()'.  The behavior is undefined unless
+        // 'position' is an iterator in the range '[cbegin() .. cend()]'.
+
+    iterator insert(const_iterator    position,
+                    size_type         numElements,
+                    const VALUE_TYPE& value);
+        // Insert at the specified 'position' in this vector the specified
+        // 'numElements' copies of the specified 'value', and return an
+        // iterator to the first inserted element (or 'position' if
+        // 'numElements' is 0).  Throw 'bsl::length_error' if
+        // 'numElements > max_size() - size()'.  The behavior is undefined
+        // unless 'position' is an iterator in the range
+        // '[cbegin() .. cend()]'.
+
+    template <class INPUT_ITER>
+    iterator insert(const_iterator position,
+                    INPUT_ITER     first,
+                    INPUT_ITER     last);
+        // Insert at the specified 'position' in this vector the elements in
+        // the specified range '[first .. last)', and return an iterator to the
+        // first inserted element (or 'position' if the range is empty).  Throw
+        // 'bsl::length_error' if the number of elements in the range exceeds
+        // 'max_size() - size()'.  The behavior is undefined unless 'position'
+        // is an iterator in the range '[cbegin() .. cend()]'.  If
+        // 'INPUT_ITER' is an integral type, this method behaves as 'insert'
+        // taking a position, a size, and a value.  Note that if 'INPUT_ITER'
+        // is only an input iterator, the elements are appended one at a time
+        // and then rotated into place, so that if an exception is thrown, this
+        // vector is left in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    iterator insert(const_iterator                    position,
+                    std::initializer_list<VALUE_TYPE> values);
+        // Insert at the specified 'position' in this vector the elements of
+        // the specified 'values' initializer list, and return an iterator to
+        // the first inserted element.  The behavior is undefined unless
+        // 'position' is an iterator in the range '[cbegin() .. cend()]'.
+#endif
+
+    iterator erase(const_iterator position);
+        // Erase the element at the specified 'position' in this vector, and
+        // return an iterator to the element that followed it (or 'end()').
+        // The behavior is undefined unless 'position' is an iterator in the
+        // range '[cbegin() .. cend())'.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Erase the elements in the specified range '[first .. last)', and
+        // return an iterator to the element that followed them (or 'end()').
+        // The behavior is undefined unless 'first' and 'last' are iterators
+        // in the range '[cbegin() .. cend()]' and 'first <= last'.
+
+    void swap(small_vector& other)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value of this object with that of the specified 'other'
+        // object, and exchange their allocators if the 'ALLOCATOR' type has
+        // trait 'propagate_on_container_swap'.  If both objects hold their
+        // elements on the heap, this method takes constant time; otherwise,
+        // the elements held inline are relocated (see
+        // {Relocation of Elements}).  If the allocators are not exchanged and
+        // are unequal, the elements are copied into the other object's
+        // storage, taking linear time.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Erase all elements of this vector, retaining its capacity.
+
+    // ACCESSORS
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used by this vector.
+
+                               // *** iterators ***
+
+    const_iterator  begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // element of this vector, or the past-the-end iterator if this vector
+        // is empty.
+
+    const_iterator  end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator providing non-modifiable access to
+        // this vector.
+
+    const_reverse_iterator  rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last element of this vector, or 'rend()' if this vector is empty.
+
+    const_reverse_iterator  rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator providing non-modifiable
+        // access to this vector.
+
+                            // *** element access ***
+
+    const_reference operator[](size_type position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position' in this vector.  The behavior is
+        // undefined unless 'position < size()'.
+
+    const_reference at(size_type position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position' in this vector.  Throw
+        // 'bsl::out_of_range' if 'position >= size()'.
+
+    const_reference front() const;
+        // Return a reference providing non-modifiable access to the first
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    const_reference back() const;
+        // Return a reference providing non-modifiable access to the last
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    const VALUE_TYPE *data() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the address of the non-modifiable first element of this
+        // vector, which, if this vector is empty, may not be dereferenced.
+
+                              // *** capacity ***
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this vector has no elements, and 'false' otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this vector.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements this vector can hold without
+        // allocating, which is 'INLINE_CAPACITY' unless the elements have
+        // been moved to the heap.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this vector could possibly hold.
+
+    bool isInline() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if the elements of this vector are held in its inline
+        // storage, and 'false' if they are held on the heap.  Note that an
+        // inline vector owns no memory obtained from its allocator.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator==(
+             const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+             const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'small_vector' objects have the same
+    // value if they have the same number of elements, and each element of one
+    // compares equal to the corresponding element of the other.  This method
+    // requires that the (template parameter) type 'VALUE_TYPE' be
+    // equality-comparable.
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator!=(
+             const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+             const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'small_vector' objects do not
+    // have the same value if they do not have the same number of elements, or
+    // some element of one does not compare equal to the corresponding element
+    // of the other.
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator<(
+             const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+             const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically less than that of the specified 'rhs' vector, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'VALUE_TYPE'.
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator>(
+             const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+             const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically greater than that of the specified 'rhs' vector, and
+    // 'false' otherwise.
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator<=(
+             const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+             const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // vector, and 'false' otherwise.
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator>=(
+             const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+             const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // vector, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void swap(small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& a,
+          small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the values of the specified 'a' and 'b' objects, as for
+    // 'a.swap(b)'.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class small_vector
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+VALUE_TYPE *
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::inlineData()
+{
+    return reinterpret_cast<VALUE_TYPE *>(d_buffer.buffer());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateAdoptStorage(
+                                                           small_vector *other)
+{
+    BSLS_ASSERT_SAFE(empty());
+    BSLS_ASSERT_SAFE(!other->isInline());
+
+    if (isInline()) {
+        d_dataBegin_p = other->d_dataBegin_p;
+        d_dataEnd_p   = other->d_dataEnd_p;
+        d_capacity    = other->d_capacity;
+
+        other->d_dataBegin_p = other->d_dataEnd_p = other->inlineData();
+        other->d_capacity    = INLINE_CAPACITY;
+    }
+    else {
+        // 'other' takes our (empty) heap storage, and returns it to the
+        // allocator on destruction.
+
+        VALUE_TYPE  *dataBegin = d_dataBegin_p;
+        std::size_t  capacity  = d_capacity;
+
+        d_dataBegin_p = other->d_dataBegin_p;
+        d_dataEnd_p   = other->d_dataEnd_p;
+        d_capacity    = other->d_capacity;
+
+        other->d_dataBegin_p = other->d_dataEnd_p = dataBegin;
+        other->d_capacity    = capacity;
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateGrow(
+                                                       std::size_t newCapacity)
+{
+    BSLS_ASSERT_SAFE(d_capacity < newCapacity);
+
+    small_vector temp(get_allocator());
+    temp.reserve(newCapacity);
+
+    ArrayPrimitives::destructiveMove(temp.d_dataBegin_p,
+                                     d_dataBegin_p,
+                                     d_dataEnd_p,
+                                     ContainerBase::allocator());
+    temp.d_dataEnd_p += size();
+    d_dataEnd_p       = d_dataBegin_p;
+
+    privateAdoptStorage(&temp);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INTEGRAL_TYPE>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                     privateInsertDispatch(
+                             const VALUE_TYPE                        *position,
+                             INTEGRAL_TYPE                            count,
+                             INTEGRAL_TYPE                            value,
+                             BloombergLP::bslmf::MatchArithmeticType,
+                             BloombergLP::bslmf::Nil)
+{
+    // 'count' and 'value' are integral types that just happen to be the same.
+    // They are not iterators, so we call 'insert(position, count, value)'.
+
+    insert(position,
+           static_cast<size_type>(count),
+           static_cast<VALUE_TYPE>(value));
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                      privateInsertDispatch(
+                                    const VALUE_TYPE                 *position,
+                                    INPUT_ITER                        first,
+                                    INPUT_ITER                        last,
+                                    BloombergLP::bslmf::MatchAnyType,
+                                    BloombergLP::bslmf::MatchAnyType)
+{
+    typedef typename iterator_traits<INPUT_ITER>::iterator_category Tag;
+    privateInsert(position, first, last, Tag());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateInsert(
+                                           const VALUE_TYPE        *position,
+                                           INPUT_ITER               first,
+                                           INPUT_ITER               last,
+                                           std::input_iterator_tag)
+{
+    // The length of the range is not known in advance: append the elements,
+    // then rotate them into place.
+
+    const size_type index   = position - d_dataBegin_p;
+    const size_type oldSize = size();
+
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+
+    ArrayPrimitives::rotate(d_dataBegin_p + index,
+                            d_dataBegin_p + oldSize,
+                            d_dataEnd_p);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class FWD_ITER>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateInsert(
+                                         const VALUE_TYPE          *position,
+                                         FWD_ITER                   first,
+                                         FWD_ITER                   last,
+                                         std::forward_iterator_tag)
+{
+    VALUE_TYPE      *pos = const_cast<VALUE_TYPE *>(position);
+    const size_type  n   = bsl::distance(first, last);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(n > max_size() - size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                 "small_vector<...>::insert(pos,first,last): vector too long");
+    }
+
+    const size_type newSize = size() + n;
+    if (newSize > d_capacity) {
+        small_vector temp(get_allocator());
+        temp.reserve(privateNewCapacity(newSize));
+
+        ArrayPrimitives::destructiveMoveAndInsert(temp.d_dataBegin_p,
+                                                  &d_dataEnd_p,
+                                                  d_dataBegin_p,
+                                                  pos,
+                                                  d_dataEnd_p,
+                                                  first,
+                                                  last,
+                                                  n,
+                                                  ContainerBase::allocator());
+        temp.d_dataEnd_p += newSize;
+        privateAdoptStorage(&temp);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_dataEnd_p,
+                                first,
+                                last,
+                                n,
+                                ContainerBase::allocator());
+        d_dataEnd_p += n;
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateMoveFrom(
+                                                           small_vector *other)
+{
+    BSLS_ASSERT_SAFE(empty());
+    BSLS_ASSERT_SAFE(isInline());
+
+    if (other->isInline()) {
+        ArrayPrimitives::destructiveMove(d_dataBegin_p,
+                                         other->d_dataBegin_p,
+                                         other->d_dataEnd_p,
+                                         ContainerBase::allocator());
+        d_dataEnd_p       += other->size();
+        other->d_dataEnd_p = other->d_dataBegin_p;
+    }
+    else {
+        privateAdoptStorage(other);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateSwap(
+                                                           small_vector *other)
+{
+    if (!isInline() && !other->isInline()) {
+        VALUE_TYPE  *dataBegin = d_dataBegin_p;
+        VALUE_TYPE  *dataEnd   = d_dataEnd_p;
+        std::size_t  capacity  = d_capacity;
+
+        d_dataBegin_p = other->d_dataBegin_p;
+        d_dataEnd_p   = other->d_dataEnd_p;
+        d_capacity    = other->d_capacity;
+
+        other->d_dataBegin_p = dataBegin;
+        other->d_dataEnd_p   = dataEnd;
+        other->d_capacity    = capacity;
+        return;                                                       // RETURN
+    }
+
+    if (isInline() && other->isInline()) {
+        // Relocate our elements to a temporary buffer, then relocate those of
+        // 'other' into our storage, and ours into that of 'other'.
+
+        InlineBuffer     tempBuffer;
+        VALUE_TYPE      *temp     = reinterpret_cast<VALUE_TYPE *>(
+                                                         tempBuffer.buffer());
+        const size_type  thisSize = size();
+
+        ArrayPrimitives::destructiveMove(temp,
+                                         d_dataBegin_p,
+                                         d_dataEnd_p,
+                                         ContainerBase::allocator());
+        ArrayPrimitives::destructiveMove(d_dataBegin_p,
+                                         other->d_dataBegin_p,
+                                         other->d_dataEnd_p,
+                                         ContainerBase::allocator());
+        d_dataEnd_p = d_dataBegin_p + other->size();
+        ArrayPrimitives::destructiveMove(other->d_dataBegin_p,
+                                         temp,
+                                         temp + thisSize,
+                                         other->ContainerBase::allocator());
+        other->d_dataEnd_p = other->d_dataBegin_p + thisSize;
+        return;                                                       // RETURN
+    }
+
+    // Exactly one of the objects is inline: relocate its elements into the
+    // inline storage of the other, which passes its heap storage over.
+
+    small_vector *inlineVector = isInline() ? this  : other;
+    small_vector *heapVector   = isInline() ? other : this;
+
+    VALUE_TYPE  *heapBegin    = heapVector->d_dataBegin_p;
+    VALUE_TYPE  *heapEnd      = heapVector->d_dataEnd_p;
+    std::size_t  heapCapacity = heapVector->d_capacity;
+
+    ArrayPrimitives::destructiveMove(heapVector->inlineData(),
+                                     inlineVector->d_dataBegin_p,
+                                     inlineVector->d_dataEnd_p,
+                                     heapVector->ContainerBase::allocator());
+    heapVector->d_dataBegin_p = heapVector->inlineData();
+    heapVector->d_dataEnd_p   = heapVector->d_dataBegin_p
+                                                       + inlineVector->size();
+    heapVector->d_capacity    = INLINE_CAPACITY;
+
+    inlineVector->d_dataBegin_p = heapBegin;
+    inlineVector->d_dataEnd_p   = heapEnd;
+    inlineVector->d_capacity    = heapCapacity;
+}
+
+// PRIVATE ACCESSORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+const VALUE_TYPE *
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::inlineData() const
+{
+    return reinterpret_cast<const VALUE_TYPE *>(d_buffer.buffer());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+std::size_t
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateNewCapacity(
+                                                     std::size_t newSize) const
+{
+    BSLS_ASSERT_SAFE(d_capacity < newSize);
+
+    const std::size_t maxSize = max_size();
+    const std::size_t doubled = d_capacity > maxSize / 2
+                              ? maxSize
+                              : 2 * d_capacity;
+
+    return doubled < newSize ? newSize : doubled;
+}
+
+// CREATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector()
+                                                          BSLS_KEYWORD_NOEXCEPT
+: ContainerBase(ALLOCATOR())
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+{
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                               const ALLOCATOR& basicAllocator)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+{
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                               size_type        initialSize,
+                                               const ALLOCATOR& basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+{
+    resize(initialSize);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                              size_type         initialSize,
+                                              const VALUE_TYPE& value,
+                                              const ALLOCATOR&  basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+{
+    insert(d_dataEnd_p, initialSize, value);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                               INPUT_ITER       first,
+                                               INPUT_ITER       last,
+                                               const ALLOCATOR& basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+{
+    privateInsertDispatch(d_dataEnd_p,
+                          first,
+                          last,
+                          first,
+                          BloombergLP::bslmf::Nil());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                                  const small_vector& original)
+: ContainerBase(AllocatorTraits::select_on_container_copy_construction(
+                                          original.ContainerBase::allocator()))
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+{
+    privateInsert(d_dataEnd_p,
+                  original.d_dataBegin_p,
+                  original.d_dataEnd_p,
+                  std::random_access_iterator_tag());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                         BloombergLP::bslmf::MovableRef<small_vector> original)
+: ContainerBase(MoveUtil::access(original).get_allocator())
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+{
+    small_vector& lvalue = original;
+    privateMoveFrom(&lvalue);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                            const small_vector& original,
+                                            const ALLOCATOR&    basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+{
+    privateInsert(d_dataEnd_p,
+                  original.d_dataBegin_p,
+                  original.d_dataEnd_p,
+                  std::random_access_iterator_tag());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                   BloombergLP::bslmf::MovableRef<small_vector> original,
+                   const ALLOCATOR&                             basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+{
+    small_vector& lvalue = original;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(get_allocator() ==
+                                            lvalue.get_allocator())) {
+        privateMoveFrom(&lvalue);
+    }
+    else if (lvalue.size() <= INLINE_CAPACITY) {
+        ArrayPrimitives::moveConstruct(d_dataBegin_p,
+                                       lvalue.d_dataBegin_p,
+                                       lvalue.d_dataEnd_p,
+                                       ContainerBase::allocator());
+        d_dataEnd_p += lvalue.size();
+    }
+    else {
+        // Build the heap storage in a temporary, which releases it if a move
+        // constructor throws.
+
+        small_vector temp(basicAllocator);
+        temp.reserve(lvalue.size());
+        ArrayPrimitives::moveConstruct(temp.d_dataBegin_p,
+                                       lvalue.d_dataBegin_p,
+                                       lvalue.d_dataEnd_p,
+                                       ContainerBase::allocator());
+        temp.d_dataEnd_p += lvalue.size();
+        privateAdoptStorage(&temp);
+    }
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                              std::initializer_list<VALUE_TYPE> values,
+                              const ALLOCATOR&                  basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+{
+    privateInsert(d_dataEnd_p,
+                  values.begin(),
+                  values.end(),
+                  std::random_access_iterator_tag());
+}
+#endif
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::~small_vector()
+{
+    BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                   d_dataBegin_p,
+                                                   d_dataEnd_p,
+                                                   ContainerBase::allocator());
+    if (!isInline()) {
+        this->deallocateN(d_dataBegin_p, d_capacity);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>&
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator=(
+                                                       const small_vector& rhs)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(this != &rhs)) {
+        if (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+            small_vector other(rhs, rhs.get_allocator());
+            using std::swap;
+            swap(ContainerBase::allocator(), other.ContainerBase::allocator());
+            privateSwap(&other);
+        }
+        else {
+            clear();
+            privateInsert(d_dataEnd_p,
+                          rhs.d_dataBegin_p,
+                          rhs.d_dataEnd_p,
+                          std::random_access_iterator_tag());
+        }
+    }
+    return *this;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>&
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator=(
+                              BloombergLP::bslmf::MovableRef<small_vector> rhs)
+{
+    small_vector& lvalue = rhs;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(this != &lvalue)) {
+        if (get_allocator() == lvalue.get_allocator()) {
+            small_vector other(MoveUtil::move(lvalue));
+            privateSwap(&other);
+        }
+        else if (AllocatorTraits::
+                               propagate_on_container_move_assignment::value) {
+            small_vector other(MoveUtil::move(lvalue));
+            using std::swap;
+            swap(ContainerBase::allocator(), other.ContainerBase::allocator());
+            privateSwap(&other);
+        }
+        else {
+            small_vector other(MoveUtil::move(lvalue),
+                               ContainerBase::allocator());
+            privateSwap(&other);
+        }
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>&
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator=(
+                                      std::initializer_list<VALUE_TYPE> values)
+{
+    assign(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::assign(
+                                                             INPUT_ITER first,
+                                                             INPUT_ITER last)
+{
+    clear();
+    privateInsertDispatch(d_dataEnd_p,
+                          first,
+                          last,
+                          first,
+                          BloombergLP::bslmf::Nil());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::assign(
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    clear();
+    insert(d_dataEnd_p, numElements, value);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::assign(
+                                      std::initializer_list<VALUE_TYPE> values)
+{
+    assign(values.begin(), values.end());
+}
+#endif
+
+                               // *** iterators ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::begin()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::end()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rbegin()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rend()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+                            // *** element access ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator[](
+                                                            size_type position)
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::at(size_type position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                         "small_vector<...>::at(position): invalid position");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd_p - 1);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+VALUE_TYPE *small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::data()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+                              // *** capacity ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reserve(
+                                                         size_type newCapacity)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newCapacity > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                   "small_vector<...>::reserve(newCapacity): vector too long");
+    }
+
+    if (newCapacity <= d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    if (isInline() && empty()) {
+        d_dataBegin_p = d_dataEnd_p = this->allocateN((VALUE_TYPE *) 0,
+                                                      newCapacity);
+        d_capacity    = newCapacity;
+    }
+    else {
+        privateGrow(newCapacity);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::resize(
+                                                             size_type newSize)
+{
+    if (newSize <= size()) {
+        BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                   d_dataBegin_p + newSize,
+                                                   d_dataEnd_p,
+                                                   ContainerBase::allocator());
+        d_dataEnd_p = d_dataBegin_p + newSize;
+        return;                                                       // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newSize > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                       "small_vector<...>::resize(newSize): vector too long");
+    }
+
+    if (newSize > d_capacity) {
+        privateGrow(privateNewCapacity(newSize));
+    }
+    ArrayPrimitives::defaultConstruct(d_dataEnd_p,
+                                      newSize - size(),
+                                      ContainerBase::allocator());
+    d_dataEnd_p = d_dataBegin_p + newSize;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::resize(
+                                                     size_type         newSize,
+                                                     const VALUE_TYPE& value)
+{
+    if (newSize <= size()) {
+        BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                   d_dataBegin_p + newSize,
+                                                   d_dataEnd_p,
+                                                   ContainerBase::allocator());
+        d_dataEnd_p = d_dataBegin_p + newSize;
+    }
+    else {
+        insert(d_dataEnd_p, newSize - size(), value);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::shrink_to_fit()
+{
+    if (isInline() || size() == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    if (size() <= INLINE_CAPACITY) {
+        VALUE_TYPE      *heapBegin    = d_dataBegin_p;
+        const size_type  heapCapacity = d_capacity;
+        const size_type  numElements  = size();
+
+        ArrayPrimitives::destructiveMove(inlineData(),
+                                         d_dataBegin_p,
+                                         d_dataEnd_p,
+                                         ContainerBase::allocator());
+        d_dataBegin_p = inlineData();
+        d_dataEnd_p   = d_dataBegin_p + numElements;
+        d_capacity    = INLINE_CAPACITY;
+
+        this->deallocateN(heapBegin, heapCapacity);
+    }
+    else {
+        small_vector temp(get_allocator());
+        temp.reserve(size());
+
+        ArrayPrimitives::destructiveMove(temp.d_dataBegin_p,
+                                         d_dataBegin_p,
+                                         d_dataEnd_p,
+                                         ContainerBase::allocator());
+        temp.d_dataEnd_p += size();
+        d_dataEnd_p       = d_dataBegin_p;
+
+        privateAdoptStorage(&temp);
+    }
+}
+
+                              // *** modifiers ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::push_back(
+                                                       const VALUE_TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_capacity > size())) {
+        AllocatorTraits::construct(ContainerBase::allocator(),
+                                   d_dataEnd_p,
+                                   value);
+        ++d_dataEnd_p;
+    }
+    else {
+        insert(d_dataEnd_p, size_type(1), value);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::push_back(
+                              BloombergLP::bslmf::MovableRef<VALUE_TYPE> value)
+{
+    VALUE_TYPE& lvalue = value;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_capacity > size())) {
+        AllocatorTraits::construct(ContainerBase::allocator(),
+                                   d_dataEnd_p,
+                                   MoveUtil::move(lvalue));
+        ++d_dataEnd_p;
+    }
+    else {
+        insert(d_dataEnd_p, MoveUtil::move(lvalue));
+    }
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class... ARGS>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace_back(
+                                                          ARGS&&... arguments)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_capacity > size())) {
+        AllocatorTraits::construct(
+                           ContainerBase::allocator(),
+                           d_dataEnd_p,
+                           BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+        ++d_dataEnd_p;
+    }
+    else {
+        emplace(d_dataEnd_p,
+                BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+    }
+    return back();
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class... ARGS>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace(
+                                                  const_iterator position,
+                                                  ARGS&&...      arguments)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size() == max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                      "small_vector<...>::emplace(pos,args): vector too long");
+    }
+
+    const size_type  index   = position - d_dataBegin_p;
+    VALUE_TYPE      *pos     = const_cast<VALUE_TYPE *>(position);
+    const size_type  newSize = size() + 1;
+
+    if (newSize > d_capacity) {
+        small_vector temp(get_allocator());
+        temp.reserve(privateNewCapacity(newSize));
+
+        ArrayPrimitives::destructiveMoveAndEmplace(
+                            temp.d_dataBegin_p,
+                            &d_dataEnd_p,
+                            d_dataBegin_p,
+                            pos,
+                            d_dataEnd_p,
+                            ContainerBase::allocator(),
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+        temp.d_dataEnd_p += newSize;
+        privateAdoptStorage(&temp);
+    }
+    else {
+        ArrayPrimitives::emplace(
+                            pos,
+                            d_dataEnd_p,
+                            ContainerBase::allocator(),
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+        ++d_dataEnd_p;
+    }
+    return d_dataBegin_p + index;
+}
+#endif
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    --d_dataEnd_p;
+    AllocatorTraits::destroy(ContainerBase::allocator(), d_dataEnd_p);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                                   const_iterator    position,
+                                                   const VALUE_TYPE& value)
+{
+    return insert(position, size_type(1), value);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                           const_iterator                             position,
+                           BloombergLP::bslmf::MovableRef<VALUE_TYPE> value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size() == max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                         "small_vector<...>::insert(pos,rv): vector too long");
+    }
+
+    VALUE_TYPE&      lvalue  = value;
+    const size_type  index   = position - d_dataBegin_p;
+    VALUE_TYPE      *pos     = const_cast<VALUE_TYPE *>(position);
+    const size_type  newSize = size() + 1;
+
+    if (newSize > d_capacity) {
+        small_vector temp(get_allocator());
+        temp.reserve(privateNewCapacity(newSize));
+
+        ArrayPrimitives::destructiveMoveAndEmplace(temp.d_dataBegin_p,
+                                                   &d_dataEnd_p,
+                                                   d_dataBegin_p,
+                                                   pos,
+                                                   d_dataEnd_p,
+                                                   ContainerBase::allocator(),
+                                                   MoveUtil::move(lvalue));
+        temp.d_dataEnd_p += newSize;
+        privateAdoptStorage(&temp);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_dataEnd_p,
+                                MoveUtil::move(lvalue),
+                                ContainerBase::allocator());
+        ++d_dataEnd_p;
+    }
+    return d_dataBegin_p + index;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                                 const_iterator    position,
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                          numElements > max_size() - size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                        "small_vector<...>::insert(pos,n,v): vector too long");
+    }
+
+    const size_type  index   = position - d_dataBegin_p;
+    VALUE_TYPE      *pos     = const_cast<VALUE_TYPE *>(position);
+    const size_type  newSize = size() + numElements;
+
+    if (newSize > d_capacity) {
+        small_vector temp(get_allocator());
+        temp.reserve(privateNewCapacity(newSize));
+
+        ArrayPrimitives::destructiveMoveAndInsert(temp.d_dataBegin_p,
+                                                  &d_dataEnd_p,
+                                                  d_dataBegin_p,
+                                                  pos,
+                                                  d_dataEnd_p,
+                                                  value,
+                                                  numElements,
+                                                  ContainerBase::allocator());
+        temp.d_dataEnd_p += newSize;
+        privateAdoptStorage(&temp);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_dataEnd_p,
+                                value,
+                                numElements,
+                                ContainerBase::allocator());
+        d_dataEnd_p += numElements;
+    }
+    return d_dataBegin_p + index;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                                       const_iterator position,
+                                                       INPUT_ITER     first,
+                                                       INPUT_ITER     last)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    const size_type index = position - d_dataBegin_p;
+    privateInsertDispatch(position,
+                          first,
+                          last,
+                          first,
+                          BloombergLP::bslmf::Nil());
+    return d_dataBegin_p + index;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                    const_iterator                    position,
+                                    std::initializer_list<VALUE_TYPE> values)
+{
+    return insert(position, values.begin(), values.end());
+}
+#endif
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <  cend());
+
+    return erase(position, position + 1);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::erase(
+                                                         const_iterator first,
+                                                         const_iterator last)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= first);
+    BSLS_ASSERT_SAFE(first    <= last);
+    BSLS_ASSERT_SAFE(last     <= cend());
+
+    VALUE_TYPE      *from        = const_cast<VALUE_TYPE *>(first);
+    VALUE_TYPE      *to          = const_cast<VALUE_TYPE *>(last);
+    const size_type  numElements = to - from;
+
+    ArrayPrimitives::erase(from, to, d_dataEnd_p, ContainerBase::allocator());
+    d_dataEnd_p -= numElements;
+    return from;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::swap(
+                                                           small_vector& other)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    if (AllocatorTraits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(ContainerBase::allocator(), other.ContainerBase::allocator());
+        privateSwap(&other);
+    }
+    else if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                   get_allocator() == other.get_allocator())) {
+        privateSwap(&other);
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        small_vector toOtherCopy(MoveUtil::move(*this),
+                                 other.get_allocator());
+        small_vector toThisCopy(MoveUtil::move(other), get_allocator());
+
+        privateSwap(&toThisCopy);
+        other.privateSwap(&toOtherCopy);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::clear()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                   d_dataBegin_p,
+                                                   d_dataEnd_p,
+                                                   ContainerBase::allocator());
+    d_dataEnd_p = d_dataBegin_p;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::allocator_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return ContainerBase::allocator();
+}
+
+                               // *** iterators ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::begin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::cbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::end() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::cend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                                                         const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                                                         const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::crbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                                                         const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                                                         const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::crend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+                            // *** element access ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator[](
+                                                      size_type position) const
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::at(
+                                                      size_type position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                         "small_vector<...>::at(position): invalid position");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd_p - 1);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+const VALUE_TYPE *
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::data() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+                              // *** capacity ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::empty() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p == d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataEnd_p - d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::capacity() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_capacity;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::max_size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return ContainerBase::allocator().max_size();
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::isInline() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p == inlineData();
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator==(
+        const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+        const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+        const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+        const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator<(
+        const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+        const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(
+                                                                 lhs.begin(),
+                                                                 lhs.end(),
+                                                                 lhs.size(),
+                                                                 rhs.begin(),
+                                                                 rhs.end(),
+                                                                 rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator>(
+        const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+        const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+        const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+        const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+        const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+        const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void bsl::swap(bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& a,
+               bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'small_vector':
+//: o A 'small_vector' defines STL iterators.
+//: o A 'small_vector' uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+//: o A 'small_vector' is *not* bitwise moveable, as it may hold pointers into
+//:   its own inline storage.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+struct HasStlIterators<bsl::small_vector<VALUE_TYPE,
+                                         INLINE_CAPACITY,
+                                         ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::small_vector<VALUE_TYPE,
+                                            INLINE_CAPACITY,
+                                            ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
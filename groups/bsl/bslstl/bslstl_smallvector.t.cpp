@@ -0,0 +1,1451 @@
+// bslstl_smallvector.t.cpp                                           -*-C++-*-
+#include <bslstl_smallvector.h>
+
+#include <bslstl_string.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test defines a container, 'bsl::small_vector', whose
+// elements are held in storage within the object until they outnumber its
+// inline capacity, and on the heap thereafter.  The concerns specific to
+// this container are therefore the transitions between the two kinds of
+// storage (when growing, shrinking, moving, and swapping), that the inline
+// storage never causes an allocation, that the heap storage is always
+// returned to the allocator, and that the elements are relocated with the
+// primitives of 'bslalg::ArrayPrimitives' (so that bitwise-moveable elements
+// are never move-constructed).  The sequence operations are verified against
+// 'std::vector' on pseudo-random input, for several inline capacities,
+// including 0.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] small_vector();
+// [ 2] small_vector(const ALLOCATOR&);
+// [ 2] small_vector(size_type, const ALLOCATOR&);
+// [ 2] small_vector(size_type, const VALUE_TYPE&, const ALLOCATOR&);
+// [ 2] small_vector(INPUT_ITER, INPUT_ITER, const ALLOCATOR&);
+// [ 2] small_vector(const small_vector&);
+// [ 2] small_vector(MovableRef<small_vector>);
+// [ 2] small_vector(const small_vector&, const ALLOCATOR&);
+// [ 2] small_vector(MovableRef<small_vector>, const ALLOCATOR&);
+// [ 2] small_vector(initializer_list<VALUE_TYPE>, const ALLOCATOR&);
+// [ 2] ~small_vector();
+//
+// MANIPULATORS
+// [ 2] small_vector& operator=(const small_vector&);
+// [ 2] small_vector& operator=(MovableRef<small_vector>);
+// [ 4] void assign(INPUT_ITER, INPUT_ITER);
+// [ 4] void assign(size_type, const VALUE_TYPE&);
+// [ 4] reference at(size_type);
+// [ 3] void reserve(size_type);
+// [ 3] void resize(size_type);
+// [ 3] void resize(size_type, const VALUE_TYPE&);
+// [ 3] void shrink_to_fit();
+// [ 3] void push_back(const VALUE_TYPE&);
+// [ 3] void push_back(MovableRef<VALUE_TYPE>);
+// [ 4] reference emplace_back(ARGS&&...);
+// [ 4] iterator emplace(const_iterator, ARGS&&...);
+// [ 4] void pop_back();
+// [ 4] iterator insert(const_iterator, const VALUE_TYPE&);
+// [ 4] iterator insert(const_iterator, MovableRef<VALUE_TYPE>);
+// [ 4] iterator insert(const_iterator, size_type, const VALUE_TYPE&);
+// [ 4] iterator insert(const_iterator, INPUT_ITER, INPUT_ITER);
+// [ 4] iterator erase(const_iterator);
+// [ 4] iterator erase(const_iterator, const_iterator);
+// [ 2] void swap(small_vector&);
+// [ 3] void clear();
+//
+// ACCESSORS
+// [ 4] const_reference at(size_type) const;
+// [ 3] size_type capacity() const;
+// [ 3] bool isInline() const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const small_vector&, const small_vector&);
+// [ 6] bool operator!=(const small_vector&, const small_vector&);
+// [ 6] bool operator< (const small_vector&, const small_vector&);
+// [ 6] bool operator> (const small_vector&, const small_vector&);
+// [ 6] bool operator<=(const small_vector&, const small_vector&);
+// [ 6] bool operator>=(const small_vector&, const small_vector&);
+// [ 2] void swap(small_vector&, small_vector&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] RELOCATION OF ELEMENTS
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslmf::MovableRefUtil                MoveUtil;
+
+typedef bsl::small_vector<int, 4>            IntVec;
+typedef bsl::small_vector<bsl::string, 2>    StringVec;
+
+static const char *const LONG_STRING =
+                             "a string long enough to require an allocation";
+
+//=============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+                               // =============
+                               // class Tracked
+                               // =============
+
+template <bool BITWISE_MOVEABLE>
+class Tracked {
+    // This class holds an integer value and counts the invocations of its
+    // copy and move constructors.  It is bitwise moveable if (and only if)
+    // the (template parameter) 'BITWISE_MOVEABLE' is 'true'.
+
+    // DATA
+    int d_value;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION_IF(Tracked,
+                                      bslmf::IsBitwiseMoveable,
+                                      BITWISE_MOVEABLE);
+
+    // CLASS DATA
+    static int s_numCopies;
+    static int s_numMoves;
+
+    // CREATORS
+    explicit Tracked(int value = 0)
+        // Create an object having the optionally specified 'value'.
+    : d_value(value)
+    {
+    }
+
+    Tracked(const Tracked& original)
+        // Create an object having the value of the specified 'original'.
+    : d_value(original.d_value)
+    {
+        ++s_numCopies;
+    }
+
+    Tracked(bslmf::MovableRef<Tracked> original) BSLS_KEYWORD_NOEXCEPT
+                                                                    // IMPLICIT
+        // Create an object having the value of the specified 'original'.
+    : d_value(MoveUtil::access(original).d_value)
+    {
+        ++s_numMoves;
+    }
+
+    // MANIPULATORS
+    Tracked& operator=(const Tracked& rhs)
+        // Assign to this object the value of the specified 'rhs'.
+    {
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    Tracked& operator=(bslmf::MovableRef<Tracked> rhs)
+        // Assign to this object the value of the specified 'rhs'.
+    {
+        d_value = MoveUtil::access(rhs).d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const
+        // Return the value of this object.
+    {
+        return d_value;
+    }
+};
+
+template <bool BITWISE_MOVEABLE>
+int Tracked<BITWISE_MOVEABLE>::s_numCopies = 0;
+
+template <bool BITWISE_MOVEABLE>
+int Tracked<BITWISE_MOVEABLE>::s_numMoves = 0;
+
+typedef Tracked<true>  BitwiseTracked;
+typedef Tracked<false> MoveTracked;
+
+                            // ==================
+                            // class ThrowingCopy
+                            // ==================
+
+class ThrowingCopy {
+    // This class holds an integer value, and its copy constructor and copy
+    // assignment operator throw an 'int' once the number of copies made
+    // reaches a configurable limit.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CLASS DATA
+    static int s_copiesBeforeThrow;  // negative for no limit
+
+    // CREATORS
+    explicit ThrowingCopy(int value)
+        // Create an object having the specified 'value'.
+    : d_value(value)
+    {
+    }
+
+    ThrowingCopy(const ThrowingCopy& original)
+        // Create an object having the value of the specified 'original', or
+        // throw if the copy limit is reached.
+    : d_value(original.d_value)
+    {
+        if (0 == s_copiesBeforeThrow) {
+            throw 0;
+        }
+        --s_copiesBeforeThrow;
+    }
+
+    // MANIPULATORS
+    ThrowingCopy& operator=(const ThrowingCopy& rhs)
+        // Assign to this object the value of the specified 'rhs', and return
+        // a reference providing modifiable access to this object, or throw,
+        // leaving this object unchanged, if the copy limit is reached.
+    {
+        if (0 == s_copiesBeforeThrow) {
+            throw 0;
+        }
+        --s_copiesBeforeThrow;
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const
+        // Return the value of this object.
+    {
+        return d_value;
+    }
+};
+
+int ThrowingCopy::s_copiesBeforeThrow = -1;
+
+                            // ===================
+                            // class InputIterator
+                            // ===================
+
+class InputIterator {
+    // This class adapts a pointer to 'const int' to provide only the
+    // interface of an input iterator.
+
+    // DATA
+    const int *d_ptr_p;
+
+  public:
+    // PUBLIC TYPES
+    typedef std::input_iterator_tag  iterator_category;
+    typedef int                      value_type;
+    typedef std::ptrdiff_t           difference_type;
+    typedef const int               *pointer;
+    typedef const int&               reference;
+
+    // CREATORS
+    explicit InputIterator(const int *ptr)
+        // Create an iterator referring to the specified 'ptr'.
+    : d_ptr_p(ptr)
+    {
+    }
+
+    // MANIPULATORS
+    InputIterator& operator++()
+        // Advance this iterator, and return a reference to it.
+    {
+        ++d_ptr_p;
+        return *this;
+    }
+
+    // ACCESSORS
+    const int& operator*() const
+        // Return the element referred to by this iterator.
+    {
+        return *d_ptr_p;
+    }
+
+    bool operator==(const InputIterator& rhs) const
+        // Return 'true' if this iterator and the specified 'rhs' refer to the
+        // same element, and 'false' otherwise.
+    {
+        return d_ptr_p == rhs.d_ptr_p;
+    }
+
+    bool operator!=(const InputIterator& rhs) const
+        // Return 'true' if this iterator and the specified 'rhs' refer to
+        // different elements, and 'false' otherwise.
+    {
+        return d_ptr_p != rhs.d_ptr_p;
+    }
+};
+
+//=============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified linear-congruential generator 'state', and return
+    // its new value, scaled to the range '[0 .. 2^15)'.
+{
+    *state = *state * 1103515245 + 12345;
+    return (*state >> 16) & 0x7fff;
+}
+
+template <class VECTOR>
+bool isEqual(const VECTOR& vector, const std::vector<int>& reference)
+    // Return 'true' if the specified 'vector' has the same sequence of
+    // elements as the specified 'reference', and 'false' otherwise.
+{
+    return vector.size() == reference.size()
+        && std::equal(vector.begin(), vector.end(), reference.begin());
+}
+
+bool allocatesFrom(const StringVec& vector, bslma::Allocator *allocator)
+    // Return 'true' if the specified 'vector', and each of its elements, uses
+    // the specified 'allocator', and 'false' otherwise.
+{
+    if (vector.get_allocator().mechanism() != allocator) {
+        return false;                                                 // RETURN
+    }
+    for (StringVec::const_iterator it = vector.begin();
+                                   it != vector.end();
+                                   ++it) {
+        if (it->get_allocator().mechanism() != allocator) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+StringVec makeStrings(int numStrings, bslma::Allocator *allocator)
+    // Return a vector, using the specified 'allocator', of the specified
+    // 'numStrings' distinct strings, each long enough to allocate.
+{
+    StringVec result(allocator);
+    for (int i = 0; i < numStrings; ++i) {
+        bsl::string s(LONG_STRING, allocator);
+        s.push_back(static_cast<char>('a' + i));
+        result.push_back(s);
+    }
+    return result;
+}
+
+template <std::size_t INLINE_CAPACITY>
+void testSequenceOperations(unsigned int seed)
+    // Apply a pseudo-random sequence of insertions and erasures, derived from
+    // the specified 'seed', to a 'small_vector' having the (template
+    // parameter) 'INLINE_CAPACITY' and to a 'std::vector', and verify that
+    // they agree after each operation, and that the 'small_vector' allocates
+    // exactly when its size exceeds 'INLINE_CAPACITY'.
+{
+    typedef bsl::small_vector<int, INLINE_CAPACITY> Obj;
+
+    bslma::TestAllocator sa("supplied");
+    {
+        Obj              mX(&sa);  const Obj& X = mX;
+        std::vector<int> reference;
+
+        for (int i = 0; i < 400; ++i) {
+            const unsigned int op    = nextRandom(&seed) % 10;
+            const int          value = nextRandom(&seed) % 100;
+            const std::size_t  pos   = reference.empty()
+                                     ? 0
+                                     : nextRandom(&seed) % reference.size();
+
+            switch (op) {
+              case 0: {
+                mX.push_back(value);
+                reference.push_back(value);
+              } break;
+              case 1: {
+                typename Obj::iterator it = mX.insert(X.begin() + pos, value);
+                ASSERTV(INLINE_CAPACITY, i, value == *it);
+                reference.insert(reference.begin() + pos, value);
+              } break;
+              case 2: {
+                const std::size_t n = nextRandom(&seed) % 6;
+                mX.insert(X.begin() + pos, n, value);
+                reference.insert(reference.begin() + pos, n, value);
+              } break;
+              case 3: {
+                const int range[] = { value, value + 1, value + 2 };
+                mX.insert(X.begin() + pos, range, range + 3);
+                reference.insert(reference.begin() + pos, range, range + 3);
+              } break;
+              case 4: {
+                const int range[] = { value, value + 1 };
+                mX.insert(X.begin() + pos,
+                          InputIterator(range),
+                          InputIterator(range + 2));
+                reference.insert(reference.begin() + pos, range, range + 2);
+              } break;
+              case 5: {
+                // Insert a copy of an element of the vector itself.
+
+                if (!reference.empty()) {
+                    mX.insert(X.begin() + pos / 2, X[pos]);
+                    reference.insert(reference.begin() + pos / 2,
+                                     reference[pos]);
+                }
+              } break;
+              case 6:
+              case 7: {
+                if (!reference.empty()) {
+                    typename Obj::iterator it = mX.erase(X.begin() + pos);
+                    ASSERTV(INLINE_CAPACITY, i, X.begin() + pos == it);
+                    reference.erase(reference.begin() + pos);
+                }
+              } break;
+              case 8: {
+                const std::size_t n = nextRandom(&seed)
+                                                % (reference.size() - pos + 1);
+                mX.erase(X.begin() + pos, X.begin() + pos + n);
+                reference.erase(reference.begin() + pos,
+                                reference.begin() + pos + n);
+              } break;
+              case 9: {
+                if (!reference.empty()) {
+                    mX.pop_back();
+                    reference.pop_back();
+                }
+              } break;
+            }
+
+            ASSERTV(INLINE_CAPACITY, i, isEqual(X, reference));
+            ASSERTV(INLINE_CAPACITY, i, X.size() <= X.capacity());
+            ASSERTV(INLINE_CAPACITY, i, X.isInline() ==
+                                              (INLINE_CAPACITY == X.capacity()
+                                               && 0 == sa.numBlocksInUse()));
+        }
+    }
+    ASSERTV(INLINE_CAPACITY, 0 == sa.numBlocksInUse());
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+//  bool veryVeryVerbose     = argc > 4;
+//  bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding a Message Without Allocating
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the messages received by a service each carry a list of
+// routing hops, which rarely exceeds four, and that each message is decoded
+// into a short-lived structure.  Holding the hops in a 'bsl::vector' would
+// cost an allocation per message; holding them in a 'small_vector' with an
+// inline capacity of four costs none for the typical message.
+//
+// First, we define the decoded form of a message:
+//..
+    struct Message {
+        int                       d_id;
+        bsl::small_vector<int, 4> d_hops;
+
+        explicit Message(bslma::Allocator *basicAllocator = 0)
+        : d_id(0)
+        , d_hops(basicAllocator)
+        {
+        }
+    };
+//..
+// Then, we decode a typical message, and observe that no memory is
+// allocated:
+//..
+    bslma::TestAllocator ta;
+
+    Message message(&ta);
+    message.d_hops.push_back(17);
+    message.d_hops.push_back(42);
+    message.d_hops.push_back(8);
+    ASSERT(3 == message.d_hops.size());
+    ASSERT(0 == ta.numAllocations());
+//..
+// Next, a message with more hops than the inline capacity arrives, and the
+// 'small_vector' moves its elements to storage supplied by the allocator:
+//..
+    message.d_hops.push_back(3);
+    message.d_hops.push_back(99);
+    ASSERT(5  == message.d_hops.size());
+    ASSERT(1  == ta.numBlocksInUse());
+    ASSERT(17 == message.d_hops.front());
+    ASSERT(99 == message.d_hops.back());
+//..
+// Finally, after the message is processed, we reuse the structure for the
+// next one and return the memory to the allocator:
+//..
+    message.d_hops.clear();
+    message.d_hops.shrink_to_fit();
+    ASSERT(0 == ta.numBlocksInUse());
+    ASSERT(4 == message.d_hops.capacity());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // RELATIONAL OPERATORS
+        //
+        // Concerns:
+        //: 1 Two vectors compare equal if and only if they hold equal
+        //:   sequences, regardless of whether their elements are held inline
+        //:   or on the heap.
+        //:
+        //: 2 The ordering operators compare lexicographically.
+        //
+        // Plan:
+        //: 1 For each pair of a set of sequences, some short enough to be held
+        //:   inline and some not, ordered lexicographically, compare vectors
+        //:   holding them with each operator, and verify the result against
+        //:   the relative position of the sequences in the set.  Also compare
+        //:   an inline and a heap vector having the same value.  (C-1..2)
+        //
+        // Testing:
+        //   bool operator==(const small_vector&, const small_vector&);
+        //   bool operator!=(const small_vector&, const small_vector&);
+        //   bool operator< (const small_vector&, const small_vector&);
+        //   bool operator> (const small_vector&, const small_vector&);
+        //   bool operator<=(const small_vector&, const small_vector&);
+        //   bool operator>=(const small_vector&, const small_vector&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRELATIONAL OPERATORS"
+                            "\n====================\n");
+
+        static const char *const DATA[] = {
+            "", "a", "ab", "abc", "abcd", "abcde", "abcdf", "b", "ba", "bcdefg"
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        typedef bsl::small_vector<char, 4> Obj;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const Obj U(DATA[i], DATA[i] + strlen(DATA[i]));
+            for (int j = 0; j < NUM_DATA; ++j) {
+                const Obj V(DATA[j], DATA[j] + strlen(DATA[j]));
+
+                ASSERTV(i, j, (i == j) == (U == V));
+                ASSERTV(i, j, (i != j) == (U != V));
+                ASSERTV(i, j, (i <  j) == (U <  V));
+                ASSERTV(i, j, (i >  j) == (U >  V));
+                ASSERTV(i, j, (i <= j) == (U <= V));
+                ASSERTV(i, j, (i >= j) == (U >= V));
+            }
+        }
+
+        Obj mX;  const Obj& X = mX;
+        mX.push_back('a');
+        Obj mY;  const Obj& Y = mY;
+        mY.reserve(8);
+        mY.push_back('a');
+        ASSERT( X.isInline());
+        ASSERT(!Y.isInline());
+        ASSERT( X == Y);
+        ASSERT(!(X <  Y));
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // RELOCATION OF ELEMENTS
+        //
+        // Concerns:
+        //: 1 When the vector relocates elements of a bitwise-moveable type
+        //:   (on growth, on 'shrink_to_fit', and on moving or swapping a
+        //:   vector holding its elements inline), no copy or move constructor
+        //:   is invoked.
+        //:
+        //: 2 Elements of a type that is not bitwise moveable are relocated by
+        //:   their move constructor, never by their copy constructor.
+        //:
+        //: 3 Moving a vector holding its elements on the heap relocates none
+        //:   of them.
+        //:
+        //: 4 If copying the new element throws while 'push_back' grows the
+        //:   vector, the vector is unchanged, and no memory is leaked.
+        //:
+        //: 5 If a copy construction or copy assignment throws while 'insert'
+        //:   or 'erase' shifts elements, the vector remains usable, and no
+        //:   memory is leaked.
+        //
+        // Plan:
+        //: 1 Using a type that counts the invocations of its copy and move
+        //:   constructors, and that is bitwise moveable, grow, shrink, move,
+        //:   and swap vectors, and verify that only the copies explicitly
+        //:   requested are made.  (C-1, 3)
+        //:
+        //: 2 Repeat P-1 with an otherwise identical type that is not bitwise
+        //:   moveable, and verify that each relocation moves the elements.
+        //:   (C-2..3)
+        //:
+        //: 3 Fill a vector to its inline capacity with objects whose copy
+        //:   constructor can be made to throw, make it throw, and attempt to
+        //:   'push_back'.  Verify the value of the vector and that no memory
+        //:   is in use.  (C-4)
+        //:
+        //: 4 Insert at, and erase from, the front of an inline vector of the
+        //:   same type, making each copy construction or assignment in turn
+        //:   throw.  Verify that the size is plausible, that the vector can
+        //:   still be appended to, and that no memory is in use.  (C-5)
+        //
+        // Testing:
+        //   RELOCATION OF ELEMENTS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRELOCATION OF ELEMENTS"
+                            "\n======================\n");
+
+        ASSERT( bslmf::IsBitwiseMoveable<BitwiseTracked>::value);
+        ASSERT(!bslmf::IsBitwiseMoveable<MoveTracked>::value);
+        ASSERT(!bslmf::IsBitwiseMoveable<IntVec>::value);
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        if (verbose) printf("\tBitwise-moveable elements.\n");
+        {
+            typedef bsl::small_vector<BitwiseTracked, 4> Obj;
+
+            const BitwiseTracked V(7);
+
+            Obj mX(&sa);  const Obj& X = mX;
+            for (int i = 0; i < 4; ++i) {
+                mX.push_back(V);
+            }
+            ASSERT(4 == BitwiseTracked::s_numCopies);
+
+            BitwiseTracked::s_numCopies = 0;
+
+            // Spill to the heap: one copy, of the new element.
+
+            mX.push_back(V);
+            ASSERT(!X.isInline());
+            ASSERT(1 == BitwiseTracked::s_numCopies);
+            ASSERT(0 == BitwiseTracked::s_numMoves);
+
+            // Return to the inline storage.
+
+            mX.pop_back();
+            mX.shrink_to_fit();
+            ASSERT(X.isInline());
+            ASSERT(1 == BitwiseTracked::s_numCopies);
+            ASSERT(0 == BitwiseTracked::s_numMoves);
+
+            // Move and swap inline vectors.
+
+            Obj mY(MoveUtil::move(mX));  const Obj& Y = mY;
+            ASSERT(4 == Y.size());
+            ASSERT(X.empty());
+
+            const BitwiseTracked W(1);
+
+            Obj mZ(&sa);  const Obj& Z = mZ;
+            mZ.push_back(W);
+            mY.swap(mZ);
+            ASSERT(1 == Y.size());
+            ASSERT(4 == Z.size());
+            ASSERT(1 == Y.front().value());
+            ASSERT(7 == Z.back().value());
+
+            ASSERT(2 == BitwiseTracked::s_numCopies);
+            ASSERT(0 == BitwiseTracked::s_numMoves);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) printf("\tElements that are not bitwise moveable.\n");
+        {
+            typedef bsl::small_vector<MoveTracked, 4> Obj;
+
+            const MoveTracked V(7);
+
+            Obj mX(&sa);  const Obj& X = mX;
+            for (int i = 0; i < 4; ++i) {
+                mX.push_back(V);
+            }
+            MoveTracked::s_numCopies = 0;
+
+            mX.push_back(V);
+            ASSERT(!X.isInline());
+            ASSERT(1 == MoveTracked::s_numCopies);
+            ASSERT(4 == MoveTracked::s_numMoves);
+
+            MoveTracked::s_numMoves = 0;
+
+            // Moving a heap vector takes its storage.
+
+            Obj mY(MoveUtil::move(mX));  const Obj& Y = mY;
+            ASSERT(5 == Y.size());
+            ASSERT(0 == MoveTracked::s_numMoves);
+
+            mY.pop_back();
+            mY.shrink_to_fit();
+            ASSERT(Y.isInline());
+            ASSERT(4 == MoveTracked::s_numMoves);
+
+            Obj mZ(MoveUtil::move(mY));  const Obj& Z = mZ;
+            ASSERT(4 == Z.size());
+            ASSERT(8 == MoveTracked::s_numMoves);
+            ASSERT(1 == MoveTracked::s_numCopies);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+#if defined(BDE_BUILD_TARGET_EXC)
+        if (verbose) printf("\tException in 'push_back' on growth.\n");
+        {
+            typedef bsl::small_vector<ThrowingCopy, 2> Obj;
+
+            const ThrowingCopy V(5);
+
+            Obj mX(&sa);  const Obj& X = mX;
+            mX.push_back(V);
+            mX.push_back(V);
+
+            ThrowingCopy::s_copiesBeforeThrow = 0;
+            bool caught = false;
+            try {
+                mX.push_back(ThrowingCopy(6));
+            }
+            catch (int) {
+                caught = true;
+            }
+            ThrowingCopy::s_copiesBeforeThrow = -1;
+
+            ASSERT(caught);
+            ASSERT(2 == X.size());
+            ASSERT(X.isInline());
+            ASSERT(5 == X[0].value());
+            ASSERT(5 == X[1].value());
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tException in 'insert' and 'erase'.\n");
+        {
+            // Inserting at the front of an inline vector, and erasing its
+            // front, shift the remaining elements by copy assignment.  Make
+            // each copy, in turn, throw, and verify that the vector remains
+            // usable and leaks nothing.
+
+            typedef bsl::small_vector<ThrowingCopy, 4> Obj;
+
+            for (int limit = 0; limit < 8; ++limit) {
+                for (int erase = 0; erase < 2; ++erase) {
+                    Obj mX(&sa);  const Obj& X = mX;
+                    for (int i = 0; i < 3; ++i) {
+                        mX.push_back(ThrowingCopy(i));
+                    }
+
+                    ThrowingCopy::s_copiesBeforeThrow = limit;
+                    bool caught = false;
+                    try {
+                        if (erase) {
+                            mX.erase(X.begin());
+                        }
+                        else {
+                            mX.insert(X.begin(), ThrowingCopy(9));
+                        }
+                    }
+                    catch (int) {
+                        caught = true;
+                    }
+                    ThrowingCopy::s_copiesBeforeThrow = -1;
+
+                    ASSERTV(limit, erase, caught || 0 < limit);
+                    if (!caught) {
+                        ASSERTV(limit, erase, (erase ? 2 : 4) == X.size());
+                        ASSERTV(limit, erase,
+                                (erase ? 1 : 9) == X.front().value());
+                    }
+                    else {
+                        ASSERTV(limit, erase, 2 <= X.size());
+                        ASSERTV(limit, erase, 4 >= X.size());
+                    }
+
+                    mX.push_back(ThrowingCopy(7));
+                    ASSERTV(limit, erase, 7 == X.back().value());
+                }
+                ASSERTV(limit, 0 == sa.numBlocksInUse());
+            }
+        }
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SEQUENCE OPERATIONS
+        //
+        // Concerns:
+        //: 1 Insertion and erasure, of single elements and of ranges
+        //:   (including ranges of input iterators and of elements of the
+        //:   vector itself), agree with 'std::vector', whether or not they
+        //:   cause the vector to spill to the heap.
+        //:
+        //: 2 The vector allocates only when its size exceeds its inline
+        //:   capacity, and releases all memory on destruction.
+        //:
+        //: 3 'assign' replaces the value of the vector.
+        //:
+        //: 4 'at' throws 'std::out_of_range' for an invalid position.
+        //:
+        //: 5 'emplace' and 'emplace_back' construct the new element in place.
+        //
+        // Plan:
+        //: 1 For inline capacities of 0, 1, 4, and 8, apply the same
+        //:   pseudo-random sequence of operations to a vector and to a
+        //:   'std::vector', and compare them after each operation.  (C-1..2)
+        //:
+        //: 2 Assign to a vector from ranges of various lengths, and from a
+        //:   size and a value.  (C-3)
+        //:
+        //: 3 Call 'at' with valid and invalid positions.  (C-4)
+        //:
+        //: 4 Emplace elements in a vector of strings, and verify that they
+        //:   use the allocator of the vector.  (C-5)
+        //
+        // Testing:
+        //   void assign(INPUT_ITER, INPUT_ITER);
+        //   void assign(size_type, const VALUE_TYPE&);
+        //   reference at(size_type);
+        //   reference emplace_back(ARGS&&...);
+        //   iterator emplace(const_iterator, ARGS&&...);
+        //   void pop_back();
+        //   iterator insert(const_iterator, const VALUE_TYPE&);
+        //   iterator insert(const_iterator, MovableRef<VALUE_TYPE>);
+        //   iterator insert(const_iterator, size_type, const VALUE_TYPE&);
+        //   iterator insert(const_iterator, INPUT_ITER, INPUT_ITER);
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   const_reference at(size_type) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSEQUENCE OPERATIONS"
+                            "\n===================\n");
+
+        for (unsigned int seed = 1; seed <= 20; ++seed) {
+            testSequenceOperations<0>(seed);
+            testSequenceOperations<1>(seed);
+            testSequenceOperations<4>(seed);
+            testSequenceOperations<8>(seed);
+        }
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        if (verbose) printf("\t'assign'.\n");
+        {
+            const int DATA[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+            IntVec mX(&sa);  const IntVec& X = mX;
+            for (int n = 0; n <= 9; ++n) {
+                mX.assign(DATA + 9 - n, DATA + 9);
+                ASSERTV(n, isEqual(X, std::vector<int>(DATA + 9 - n,
+                                                       DATA + 9)));
+            }
+            mX.assign(3, 42);
+            ASSERT(isEqual(X, std::vector<int>(3, 42)));
+
+            mX.assign(InputIterator(DATA), InputIterator(DATA + 6));
+            ASSERT(isEqual(X, std::vector<int>(DATA, DATA + 6)));
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+#if defined(BDE_BUILD_TARGET_EXC)
+        if (verbose) printf("\t'at'.\n");
+        {
+            IntVec mX(3, 7, &sa);  const IntVec& X = mX;
+            ASSERT(7 == X.at(2));
+            mX.at(2) = 8;
+            ASSERT(8 == X[2]);
+
+            bool caught = false;
+            try {
+                X.at(3);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+        }
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+        if (verbose) printf("\t'emplace' and 'emplace_back'.\n");
+        {
+            StringVec mX(&sa);  const StringVec& X = mX;
+
+            mX.emplace_back(LONG_STRING);
+            mX.emplace_back(3, 'x');
+            StringVec::iterator it = mX.emplace(X.begin(), LONG_STRING, 2);
+            ASSERT(X.begin() == it);
+            ASSERT(3 == X.size());
+            ASSERT("a " == X[0]);
+            ASSERT(LONG_STRING == X[1]);
+            ASSERT("xxx" == X[2]);
+            ASSERT(allocatesFrom(X, &sa));
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+#endif
+
+        if (verbose) printf("\tMove-insertion.\n");
+        {
+            StringVec mX(&sa);  const StringVec& X = mX;
+            for (int i = 0; i < 4; ++i) {
+                bsl::string s(LONG_STRING, &sa);
+                s.push_back(static_cast<char>('a' + i));
+                StringVec::iterator it = mX.insert(X.begin() + i / 2,
+                                                   MoveUtil::move(s));
+                ASSERTV(i, X.begin() + i / 2 == it);
+                ASSERTV(i, static_cast<char>('a' + i) == it->back());
+            }
+            ASSERT(4 == X.size());
+            ASSERT(allocatesFrom(X, &sa));
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CAPACITY
+        //
+        // Concerns:
+        //: 1 A vector holds up to its inline capacity of elements without
+        //:   allocating, and allocates a single block when it first exceeds
+        //:   it.
+        //:
+        //: 2 The capacity at least doubles on each growth.
+        //:
+        //: 3 'reserve' beyond the current capacity moves the elements to the
+        //:   heap; 'reserve' within it has no effect.
+        //:
+        //: 4 'shrink_to_fit' returns the elements to the inline storage, and
+        //:   the heap storage to the allocator, if they fit; otherwise it
+        //:   reduces the heap storage to the size of the vector.
+        //:
+        //: 5 'clear' retains the capacity.
+        //:
+        //: 6 'resize' appends default-constructed elements or copies of a
+        //:   value, or erases elements at the back.
+        //:
+        //: 7 'push_back' of an element of the vector itself is correct when it
+        //:   causes the vector to grow.
+        //
+        // Plan:
+        //: 1 Push elements onto a vector one at a time, checking the capacity
+        //:   and the allocator after each.  (C-1..2)
+        //:
+        //: 2 Call 'reserve', 'shrink_to_fit', 'clear', and 'resize', checking
+        //:   the value, the capacity, and the memory in use.  (C-3..6)
+        //:
+        //: 3 Fill a vector to capacity and 'push_back' its first element.
+        //:   (C-7)
+        //
+        // Testing:
+        //   void reserve(size_type);
+        //   void resize(size_type);
+        //   void resize(size_type, const VALUE_TYPE&);
+        //   void shrink_to_fit();
+        //   void push_back(const VALUE_TYPE&);
+        //   void push_back(MovableRef<VALUE_TYPE>);
+        //   void clear();
+        //   size_type capacity() const;
+        //   bool isInline() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCAPACITY"
+                            "\n========\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        if (verbose) printf("\tGrowth.\n");
+        {
+            IntVec mX(&sa);  const IntVec& X = mX;
+            ASSERT(4 == X.capacity());
+            ASSERT(X.isInline());
+
+            std::size_t capacity = X.capacity();
+            for (int i = 0; i < 100; ++i) {
+                mX.push_back(i);
+                ASSERTV(i, i == X.back());
+                if (i < 4) {
+                    ASSERTV(i, X.isInline());
+                    ASSERTV(i, 0 == sa.numAllocations());
+                }
+                else {
+                    ASSERTV(i, !X.isInline());
+                    ASSERTV(i, 1 == sa.numBlocksInUse());
+                }
+                if (X.capacity() != capacity) {
+                    ASSERTV(i, X.capacity() >= 2 * capacity);
+                    capacity = X.capacity();
+                }
+            }
+            ASSERT(1 == sa.numAllocations() - sa.numDeallocations());
+            ASSERT(128 == X.capacity());
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) printf("\t'reserve' and 'shrink_to_fit'.\n");
+        {
+            IntVec mX(&sa);  const IntVec& X = mX;
+            mX.reserve(3);
+            ASSERT(X.isInline());
+            ASSERT(4 == X.capacity());
+
+            mX.push_back(1);
+            mX.push_back(2);
+            mX.reserve(10);
+            ASSERT(!X.isInline());
+            ASSERT(10 == X.capacity());
+            ASSERT(1  == sa.numBlocksInUse());
+            ASSERT(1  == X[0]);
+            ASSERT(2  == X[1]);
+
+            mX.shrink_to_fit();
+            ASSERT(X.isInline());
+            ASSERT(4 == X.capacity());
+            ASSERT(0 == sa.numBlocksInUse());
+            ASSERT(2 == X.size());
+            ASSERT(1 == X[0]);
+            ASSERT(2 == X[1]);
+
+            mX.resize(7, 9);
+            ASSERT(!X.isInline());
+            ASSERT(7 == X.size());
+            ASSERT(9 == X[6]);
+            mX.reserve(20);
+            mX.shrink_to_fit();
+            ASSERT(!X.isInline());
+            ASSERT(7 == X.capacity());
+            ASSERT(1 == sa.numBlocksInUse());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(7 == X.capacity());
+
+            mX.resize(5);
+            ASSERT(isEqual(X, std::vector<int>(5, 0)));
+            mX.resize(1);
+            ASSERT(isEqual(X, std::vector<int>(1, 0)));
+            mX.shrink_to_fit();
+            ASSERT(X.isInline());
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) printf("\tInline capacity of 0.\n");
+        {
+            typedef bsl::small_vector<int, 0> Obj;
+
+            Obj mX(&sa);  const Obj& X = mX;
+            ASSERT(0 == X.capacity());
+            ASSERT(X.isInline());
+
+            mX.push_back(1);
+            ASSERT(!X.isInline());
+            ASSERT(1 == sa.numBlocksInUse());
+
+            mX.pop_back();
+            mX.shrink_to_fit();
+            ASSERT(X.isInline());
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tAliased 'push_back'.\n");
+        {
+            StringVec mX(makeStrings(2, &sa), &sa);  const StringVec& X = mX;
+            ASSERT(X.isInline());
+
+            mX.push_back(X[0]);
+            ASSERT(!X.isInline());
+            ASSERT(3 == X.size());
+            ASSERT(X[0] == X[2]);
+
+            mX.shrink_to_fit();
+            mX.push_back(MoveUtil::move(mX[1]));
+            ASSERT(4 == X.size());
+            ASSERT(allocatesFrom(X, &sa));
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        //: 1 Each constructor creates a vector having the intended value and
+        //:   allocator, which it supplies to the elements.
+        //:
+        //: 2 A vector whose value fits in its inline capacity allocates no
+        //:   memory of its own.
+        //:
+        //: 3 Moving a vector holding its elements on the heap transfers its
+        //:   storage; moving one holding its elements inline relocates them.
+        //:   Either way, the moved-from vector is left empty and inline.
+        //:
+        //: 4 Copy construction uses the default allocator, and move
+        //:   construction the allocator of the original.
+        //:
+        //: 5 Assignment and swap are correct for each combination of inline
+        //:   and heap storage, and for equal and unequal allocators.
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Create vectors of strings with each constructor, from values
+        //:   that fit in the inline capacity and values that do not, and
+        //:   check their values, allocators, and the memory in use.  (C-1..4)
+        //:
+        //: 2 For each pair of a set of values, some of which fit in the
+        //:   inline capacity, assign and swap vectors having those values and
+        //:   equal or unequal allocators, and check the results.  (C-5..6)
+        //
+        // Testing:
+        //   small_vector();
+        //   small_vector(const ALLOCATOR&);
+        //   small_vector(size_type, const ALLOCATOR&);
+        //   small_vector(size_type, const VALUE_TYPE&, const ALLOCATOR&);
+        //   small_vector(INPUT_ITER, INPUT_ITER, const ALLOCATOR&);
+        //   small_vector(const small_vector&);
+        //   small_vector(MovableRef<small_vector>);
+        //   small_vector(const small_vector&, const ALLOCATOR&);
+        //   small_vector(MovableRef<small_vector>, const ALLOCATOR&);
+        //   small_vector(initializer_list<VALUE_TYPE>, const ALLOCATOR&);
+        //   ~small_vector();
+        //   small_vector& operator=(const small_vector&);
+        //   small_vector& operator=(MovableRef<small_vector>);
+        //   void swap(small_vector&);
+        //   void swap(small_vector&, small_vector&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, ASSIGNMENT, AND SWAP"
+                            "\n==============================\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+        bslma::TestAllocator oa("other",    veryVerbose);
+
+        if (verbose) printf("\tValue constructors.\n");
+        {
+            const StringVec X;
+            ASSERT(X.empty());
+            ASSERT(X.get_allocator().mechanism() == &defaultAllocator);
+
+            const StringVec Y(&sa);
+            ASSERT(Y.empty());
+            ASSERT(0 == sa.numAllocations());
+
+            const StringVec Z(2, &sa);
+            ASSERT(2 == Z.size());
+            ASSERT(Z[1].empty());
+            ASSERT(0 == sa.numAllocations());
+
+            const bsl::string V(LONG_STRING, &sa);
+            const StringVec   W(3, V, &sa);
+            ASSERT(3 == W.size());
+            ASSERT(V == W[2]);
+            ASSERT(!W.isInline());
+            ASSERT(allocatesFrom(W, &sa));
+
+            const int    DATA[] = { 3, 1, 4, 1, 5 };
+            const IntVec A(DATA, DATA + 5, &sa);
+            const IntVec B(InputIterator(DATA), InputIterator(DATA + 3), &sa);
+            const IntVec C(2, 7, &sa);  // integral "iterators"
+            ASSERT(isEqual(A, std::vector<int>(DATA, DATA + 5)));
+            ASSERT(isEqual(B, std::vector<int>(DATA, DATA + 3)));
+            ASSERT(isEqual(C, std::vector<int>(2, 7)));
+            ASSERT(B.isInline());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            const IntVec D({ 3, 1, 4, 1, 5 }, &sa);
+            ASSERT(A == D);
+#endif
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\tCopy and move constructors.\n");
+        for (int n = 0; n <= 4; ++n) {
+            const StringVec X(makeStrings(n, &sa), &sa);
+            ASSERTV(n, allocatesFrom(X, &sa));
+            ASSERTV(n, (n <= 2) == X.isInline());
+
+            {
+                const StringVec Y(X);
+                ASSERTV(n, X == Y);
+                ASSERTV(n, allocatesFrom(Y, &defaultAllocator));
+
+                const StringVec Z(X, &oa);
+                ASSERTV(n, X == Z);
+                ASSERTV(n, allocatesFrom(Z, &oa));
+            }
+            ASSERTV(n, 0 == oa.numBlocksInUse());
+
+            {
+                StringVec mY(X, &sa);  const StringVec& Y = mY;
+
+                const bsls::Types::Int64 numAllocations = sa.numAllocations();
+
+                const StringVec Z(MoveUtil::move(mY));
+                ASSERTV(n, X == Z);
+                ASSERTV(n, allocatesFrom(Z, &sa));
+                ASSERTV(n, Y.empty());
+                ASSERTV(n, Y.isInline());
+                ASSERTV(n, numAllocations == sa.numAllocations());
+            }
+
+            {
+                StringVec mY(X, &sa);  const StringVec& Y = mY;
+
+                const StringVec Z(MoveUtil::move(mY), &sa);
+                ASSERTV(n, X == Z);
+                ASSERTV(n, Y.empty());
+
+                StringVec mU(X, &sa);
+
+                const StringVec W(MoveUtil::move(mU), &oa);
+                ASSERTV(n, X == W);
+                ASSERTV(n, allocatesFrom(W, &oa));
+            }
+            ASSERTV(n, 0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\tAssignment and swap.\n");
+        for (int i = 0; i <= 4; ++i) {
+            const StringVec U(makeStrings(i, &sa), &sa);
+            for (int j = 0; j <= 4; ++j) {
+                StringVec mV(makeStrings(j, &sa), &sa);
+                std::reverse(mV.begin(), mV.end());
+                const StringVec& V = mV;
+
+                {
+                    StringVec mX(U, &sa);  const StringVec& X = mX;
+                    mX = V;
+                    ASSERTV(i, j, V == X);
+                    ASSERTV(i, j, allocatesFrom(X, &sa));
+
+                    mX = X;
+                    ASSERTV(i, j, V == X);
+                }
+                {
+                    StringVec mX(U, &sa);  const StringVec& X = mX;
+                    StringVec mY(V, &sa);  const StringVec& Y = mY;
+                    mX = MoveUtil::move(mY);
+                    ASSERTV(i, j, V == X);
+                    ASSERTV(i, j, allocatesFrom(X, &sa));
+                    ASSERTV(i, j, Y.empty());
+
+                    StringVec mZ(U, &oa);
+                    mX = MoveUtil::move(mZ);
+                    ASSERTV(i, j, U == X);
+                    ASSERTV(i, j, allocatesFrom(X, &sa));
+                }
+                {
+                    StringVec mX(U, &sa);  const StringVec& X = mX;
+                    StringVec mY(V, &sa);  const StringVec& Y = mY;
+                    mX.swap(mY);
+                    ASSERTV(i, j, V == X);
+                    ASSERTV(i, j, U == Y);
+                    ASSERTV(i, j, allocatesFrom(X, &sa));
+                    ASSERTV(i, j, allocatesFrom(Y, &sa));
+
+                    swap(mX, mY);
+                    ASSERTV(i, j, U == X);
+                    ASSERTV(i, j, V == Y);
+
+                    StringVec mZ(V, &oa);  const StringVec& Z = mZ;
+                    mX.swap(mZ);
+                    ASSERTV(i, j, V == X);
+                    ASSERTV(i, j, U == Z);
+                    ASSERTV(i, j, allocatesFrom(X, &sa));
+                    ASSERTV(i, j, allocatesFrom(Z, &oa));
+                }
+                ASSERTV(i, j, 0 == oa.numBlocksInUse());
+            }
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        IntVec mX(&sa);  const IntVec& X = mX;
+        ASSERT(X.empty());
+        ASSERT(X.isInline());
+
+        mX.push_back(1);
+        mX.push_back(2);
+        mX.insert(X.begin(), 0);
+        ASSERT(3 == X.size());
+        ASSERT(0 == X.front());
+        ASSERT(2 == X.back());
+        ASSERT(0 == sa.numAllocations());
+
+        mX.push_back(3);
+        mX.push_back(4);
+        ASSERT(5 == X.size());
+        ASSERT(!X.isInline());
+        ASSERT(1 == sa.numBlocksInUse());
+
+        IntVec mY(X, &sa);  const IntVec& Y = mY;
+        ASSERT(X == Y);
+
+        mY.erase(Y.begin());
+        ASSERT(X != Y);
+        ASSERT(X <  Y);
+
+        mX.clear();
+        ASSERT(X.empty());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2018 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -179,6 +179,11 @@ using bsl::pair;
 // [13] pair<const_iter, const_iter> equal_range(const KEY&) const;
 // [ 4] iterator find(const KEY& key);
 // [ 4] const_iterator find(const KEY& key) const;
+// [40] iterator find(const KEY& key, size_t hashCode);
+// [40] const_iterator find(const KEY& key, size_t hashCode) const;
+// [40] OUTPUT_ITERATOR findMany(FWD_ITER, FWD_ITER, OUTPUT_ITERATOR);
+// [40] OUTPUT_ITERATOR findMany(FWD_ITER, FWD_ITER, OUTPUT_ITERATOR) const;
+// [40] void prefetchBucket(size_t hashCode) const;
 //
 // non-local iterators:
 // [14] iterator begin();
@@ -225,7 +230,7 @@ using bsl::pair;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [40] USAGE EXAMPLE
+// [41] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int  ggg(Obj *, const char *, bool verbose = true);
@@ -10426,7 +10431,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 40: {
+      case 41: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -10446,6 +10451,129 @@ int main(int argc, char *argv[])
                             "\n=============\n");
         usage();
       } break;
+      case 40: {
+        // --------------------------------------------------------------------
+        // TESTING PRECOMPUTED-HASH AND BATCHED LOOKUP
+        //
+        // Concerns:
+        //: 1 'find(key, hashCode)' returns the same iterator as 'find(key)',
+        //:   both for keys that are in the map and for keys that are not.
+        //:
+        //: 2 'findMany' writes, in input order, the iterator that 'find'
+        //:   returns for each key in the input range, and returns the position
+        //:   following the last value written.
+        //:
+        //: 3 'findMany' handles input ranges that are empty, shorter than a
+        //:   group of batched lookups, and spanning several such groups.
+        //:
+        //: 4 'prefetchBucket' does not change the value of the map, including
+        //:   a map that has not yet allocated a bucket array.
+        //:
+        //: 5 None of these methods allocates memory.
+        //
+        // Plan:
+        //: 1 Using an empty map, look up a few keys with 'find(key, hashCode)'
+        //:   and 'findMany', after calling 'prefetchBucket' for each of them,
+        //:   and verify that 'end()' is returned every time.  (C-1..2, 4)
+        //:
+        //: 2 Populate a map with the even integers in '[0, 200)' and, for
+        //:   each integer in '[0, 200)', verify that 'find(key, hashCode)'
+        //:   (both overloads) agrees with 'find(key)'.  (C-1, 4)
+        //:
+        //: 3 For every prefix of the sequence of integers in '[0, 200)', call
+        //:   'findMany' (both overloads) and verify the returned position and
+        //:   each value written against 'find'.  (C-2..3)
+        //:
+        //: 4 Use a test allocator monitor to verify that no memory is
+        //:   allocated by any of the above.  (C-5)
+        //
+        // Testing:
+        //   iterator find(const key_type& key, size_type hashCode);
+        //   OUTPUT_ITERATOR findMany(FWD_ITER first, FWD_ITER last, OUT_ITER);
+        //   const_iterator find(const key_type&, size_type hashCode) const;
+        //   OUTPUT_ITERATOR findMany(FWD_ITER, FWD_ITER, OUT_ITER) const;
+        //   void prefetchBucket(size_type hashCode) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING PRECOMPUTED-HASH AND BATCHED LOOKUP"
+                            "\n===========================================\n");
+
+        typedef bsl::unordered_map<int, int> Obj;
+
+        enum { k_NUM_KEYS = 200 };
+
+        int keys[k_NUM_KEYS];
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            keys[i] = i;
+        }
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting an empty map.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            for (int i = 0; i < 3; ++i) {
+                const size_t HASH = X.hash_function()(keys[i]);
+
+                X.prefetchBucket(HASH);
+
+                ASSERTV(i,  X.end() ==  X.find(keys[i], HASH));
+                ASSERTV(i, mX.end() == mX.find(keys[i], HASH));
+            }
+
+            Obj::const_iterator results[3];
+            ASSERT(results + 3 == X.findMany(keys, keys + 3, results));
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, X.end() == results[i]);
+            }
+
+            ASSERT(oam.isTotalSame());
+            ASSERT(X.empty());
+        }
+
+        if (verbose) printf("\nTesting a populated map.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < k_NUM_KEYS; i += 2) {
+                mX[keys[i]] = -keys[i];
+            }
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                const int    KEY  = keys[i];
+                const size_t HASH = X.hash_function()(KEY);
+
+                X.prefetchBucket(HASH);
+
+                ASSERTV(i, X.find(KEY)  ==  X.find(KEY, HASH));
+                ASSERTV(i, mX.find(KEY) == mX.find(KEY, HASH));
+                ASSERTV(i, (0 == i % 2) == (X.end() != X.find(KEY, HASH)));
+            }
+
+            for (int n = 0; n <= k_NUM_KEYS; ++n) {
+                Obj::const_iterator cResults[k_NUM_KEYS];
+                Obj::iterator       mResults[k_NUM_KEYS];
+
+                ASSERTV(n, cResults + n ==
+                                      X.findMany(keys, keys + n, cResults));
+                ASSERTV(n, mResults + n ==
+                                     mX.findMany(keys, keys + n, mResults));
+
+                for (int j = 0; j < n; ++j) {
+                    ASSERTV(n, j,  X.find(keys[j]) == cResults[j]);
+                    ASSERTV(n, j, mX.find(keys[j]) == mResults[j]);
+                }
+            }
+
+            ASSERT(oam.isTotalSame());
+            ASSERTV(X.size(), k_NUM_KEYS / 2 == X.size());
+        }
+      } break;
       case 39: // falls through
       case 38: // falls through
       case 37: // falls through
@@ -1019,6 +1019,31 @@ class unordered_multimap {
         // 'key', if such entries exist, and the past-the-end ('end') iterator
         // otherwise.
 
+    iterator find(const key_type& key, size_type hashCode);
+        // Return the same value as 'find(key)', but use the specified
+        // 'hashCode' as the hash code of the specified 'key' rather than
+        // invoking the hash functor of this unordered multimap.  The behavior
+        // is undefined unless 'hashCode == hash_function()(key)'.  Note that
+        // this overload allows a hash code to be computed once and reused,
+        // e.g., to probe several containers having the same hash functor for
+        // the same key.
+
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(FORWARD_ITERATOR first,
+                             FORWARD_ITERATOR last,
+                             OUTPUT_ITERATOR  result);
+        // Write to successive positions starting at the specified 'result' the
+        // 'iterator' that 'find' returns for each key in the range starting at
+        // the specified 'first' and ending immediately before the specified
+        // 'last', and return an iterator referring to the position immediately
+        // following the last iterator written.  The lookups are batched: the
+        // keys are hashed, and the buckets they select are prefetched, in
+        // groups before any of the buckets is probed, so that the cache misses
+        // of the lookups in a group overlap rather than being serialized.  The
+        // behavior is undefined unless '[first, last)' is a valid range whose
+        // elements are convertible to 'key_type', and 'result' can be advanced
+        // and assigned 'distance(first, last)' times.
+
     iterator insert(const value_type& value);
         // Insert the specified 'value' into this unordered multimap, and
         // return an iterator referring to the newly inserted 'value_type'
@@ -1280,6 +1305,39 @@ class unordered_multimap {
         // unordered multimap with a key equivalent to the specified 'key', if
         // such entries exist, and the past-the-end ('end') iterator otherwise.
 
+    const_iterator find(const key_type& key, size_type hashCode) const;
+        // Return the same value as 'find(key)', but use the specified
+        // 'hashCode' as the hash code of the specified 'key' rather than
+        // invoking the hash functor of this unordered multimap.  The behavior
+        // is undefined unless 'hashCode == hash_function()(key)'.  Note that
+        // this overload allows a hash code to be computed once and reused,
+        // e.g., to probe several containers having the same hash functor for
+        // the same key.
+
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(FORWARD_ITERATOR first,
+                             FORWARD_ITERATOR last,
+                             OUTPUT_ITERATOR  result) const;
+        // Write to successive positions starting at the specified 'result' the
+        // 'const_iterator' that 'find' returns for each key in the range
+        // starting at the specified 'first' and ending immediately before the
+        // specified 'last', and return an iterator referring to the position
+        // immediately following the last iterator written.  The lookups are
+        // batched: the keys are hashed, and the buckets they select are
+        // prefetched, in groups before any of the buckets is probed, so that
+        // the cache misses of the lookups in a group overlap rather than being
+        // serialized.  The behavior is undefined unless '[first, last)' is a
+        // valid range whose elements are convertible to 'key_type', and
+        // 'result' can be advanced and assigned 'distance(first, last)' times.
+
+    void prefetchBucket(size_type hashCode) const;
+        // Hint to the processor to begin loading into the cache the bucket of
+        // this unordered multimap that holds the elements whose keys have the
+        // specified 'hashCode'.  This method has no effect on the observable
+        // state of the program.  Note that a subsequent 'find' of a key
+        // having 'hashCode' benefits only if enough other work is done in
+        // between for the load to complete.
+
     size_type count(const key_type& key) const;
         // Return the number of 'value_type' objects in this unordered multimap
         // with a key equivalent to the specified 'key'.
@@ -1840,6 +1898,28 @@ unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
+                                                      const key_type& key,
+                                                      size_type       hashCode)
+{
+    return iterator(d_impl.find(key, hashCode));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR
+unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::findMany(
+                                                       FORWARD_ITERATOR first,
+                                                       FORWARD_ITERATOR last,
+                                                       OUTPUT_ITERATOR  result)
+{
+    return d_impl.template findMany<iterator>(first, last, result);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 bsl::pair<
      typename unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
@@ -2161,6 +2241,37 @@ unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::const_iterator
+unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
+                                                const key_type& key,
+                                                size_type       hashCode) const
+{
+    return const_iterator(d_impl.find(key, hashCode));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR
+unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::findMany(
+                                                 FORWARD_ITERATOR first,
+                                                 FORWARD_ITERATOR last,
+                                                 OUTPUT_ITERATOR  result) const
+{
+    return d_impl.template findMany<const_iterator>(first, last, result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::prefetchBucket(
+                                                      size_type hashCode) const
+{
+    d_impl.prefetchBucket(hashCode);
+}
+
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
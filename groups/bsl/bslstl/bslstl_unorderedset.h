@@ -1392,6 +1392,31 @@ class unordered_set {
         // such an entry exists, and the past-the-end ('end') iterator
         // otherwise.
 
+    iterator find(const key_type& key, size_type hashCode);
+        // Return the same value as 'find(key)', but use the specified
+        // 'hashCode' as the hash code of the specified 'key' rather than
+        // invoking the hash functor of this unordered set.  The behavior is
+        // undefined unless 'hashCode == hash_function()(key)'.  Note that this
+        // overload allows a hash code to be computed once and reused, e.g., to
+        // probe several containers having the same hash functor for the same
+        // key.
+
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(FORWARD_ITERATOR first,
+                             FORWARD_ITERATOR last,
+                             OUTPUT_ITERATOR  result);
+        // Write to successive positions starting at the specified 'result' the
+        // 'iterator' that 'find' returns for each key in the range starting at
+        // the specified 'first' and ending immediately before the specified
+        // 'last', and return an iterator referring to the position immediately
+        // following the last iterator written.  The lookups are batched: the
+        // keys are hashed, and the buckets they select are prefetched, in
+        // groups before any of the buckets is probed, so that the cache misses
+        // of the lookups in a group overlap rather than being serialized.  The
+        // behavior is undefined unless '[first, last)' is a valid range whose
+        // elements are convertible to 'key_type', and 'result' can be advanced
+        // and assigned 'distance(first, last)' times.
+
     pair<iterator, iterator> equal_range(const key_type& key);
         // Return a pair of iterators providing modifiable access to the
         // sequence of 'value_type' objects in this unordered set that are
@@ -1477,6 +1502,39 @@ class unordered_set {
         // 'key', if such an entry exists, and the past-the-end ('end')
         // iterator otherwise.
 
+    const_iterator find(const key_type& key, size_type hashCode) const;
+        // Return the same value as 'find(key)', but use the specified
+        // 'hashCode' as the hash code of the specified 'key' rather than
+        // invoking the hash functor of this unordered set.  The behavior is
+        // undefined unless 'hashCode == hash_function()(key)'.  Note that this
+        // overload allows a hash code to be computed once and reused, e.g., to
+        // probe several containers having the same hash functor for the same
+        // key.
+
+    template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(FORWARD_ITERATOR first,
+                             FORWARD_ITERATOR last,
+                             OUTPUT_ITERATOR  result) const;
+        // Write to successive positions starting at the specified 'result' the
+        // 'const_iterator' that 'find' returns for each key in the range
+        // starting at the specified 'first' and ending immediately before the
+        // specified 'last', and return an iterator referring to the position
+        // immediately following the last iterator written.  The lookups are
+        // batched: the keys are hashed, and the buckets they select are
+        // prefetched, in groups before any of the buckets is probed, so that
+        // the cache misses of the lookups in a group overlap rather than being
+        // serialized.  The behavior is undefined unless '[first, last)' is a
+        // valid range whose elements are convertible to 'key_type', and
+        // 'result' can be advanced and assigned 'distance(first, last)' times.
+
+    void prefetchBucket(size_type hashCode) const;
+        // Hint to the processor to begin loading into the cache the bucket of
+        // this unordered set that holds the elements whose keys have the
+        // specified 'hashCode'.  This method has no effect on the observable
+        // state of the program.  Note that a subsequent 'find' of a key
+        // having 'hashCode' benefits only if enough other work is done in
+        // between for the load to complete.
+
     size_type count(const key_type& key) const;
         // Return the number of 'value_type' objects within this set that are
         // equivalent to the specified 'key'.  Note that since an unordered set
@@ -2650,6 +2708,28 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(
+                                                      const key_type& key,
+                                                      size_type       hashCode)
+{
+    return iterator(d_impl.find(key, hashCode));
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::findMany(
+                                                       FORWARD_ITERATOR first,
+                                                       FORWARD_ITERATOR last,
+                                                       OUTPUT_ITERATOR  result)
+{
+    return d_impl.template findMany<iterator>(first, last, result);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bsl::pair<typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator, bool>
@@ -2866,6 +2946,37 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key) const
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(
+                                                const key_type& key,
+                                                size_type       hashCode) const
+{
+    return const_iterator(d_impl.find(key, hashCode));
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class FORWARD_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::findMany(
+                                                 FORWARD_ITERATOR first,
+                                                 FORWARD_ITERATOR last,
+                                                 OUTPUT_ITERATOR  result) const
+{
+    return d_impl.template findMany<const_iterator>(first, last, result);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::prefetchBucket(
+                                                      size_type hashCode) const
+{
+    d_impl.prefetchBucket(hashCode);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
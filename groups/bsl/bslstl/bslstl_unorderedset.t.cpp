@@ -11,6 +11,7 @@
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_destructorguard.h>
+#include <bslma_mallocfreeallocator.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
 #include <bslma_usesbslmaallocator.h>
@@ -27,6 +28,7 @@
 #include <bsls_libraryfeatures.h>
 #include <bsls_nameof.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_util.h>
 
 #include <bsltf_stdallocatoradaptor.h>
@@ -168,6 +170,11 @@ using bsls::NameOf;
 //*[13] size_type count(const key_type& key) const;
 //*[13] bsl::pair<iterator, iterator> equal_range(const key_type& key);
 //*[13] bsl::pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [34] iterator find(const key_type& key, size_type hashCode);
+// [34] OUTPUT_ITERATOR findMany(FWD_ITER first, FWD_ITER last, OUT_ITER);
+// [34] const_iterator find(const key_type&, size_type hashCode) const;
+// [34] OUTPUT_ITERATOR findMany(FWD_ITER, FWD_ITER, OUT_ITER) const;
+// [34] void prefetchBucket(size_type hashCode) const;
 //
 // bucket interface:
 //*[26] size_type bucket_count() const;
@@ -198,7 +205,8 @@ using bsls::NameOf;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] default construction (only)
-// [34] USAGE EXAMPLE
+// [35] USAGE EXAMPLE
+// [-1] PERFORMANCE: findMany vs. find
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 //*[ 3] int ggg(unordered_set<K,H,E,A> *object, const char *spec, int verbose);
@@ -4699,7 +4707,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 34: {
+      case 35: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -4854,6 +4862,129 @@ if (verbose) {
 // See the material in {'bslstl_unorderedmap'|Example 2}.
 
       } break;
+      case 34: {
+        // --------------------------------------------------------------------
+        // TESTING PRECOMPUTED-HASH AND BATCHED LOOKUP
+        //
+        // Concerns:
+        //: 1 'find(key, hashCode)' returns the same iterator as 'find(key)',
+        //:   both for keys that are in the set and for keys that are not.
+        //:
+        //: 2 'findMany' writes, in input order, the iterator that 'find'
+        //:   returns for each key in the input range, and returns the position
+        //:   following the last value written.
+        //:
+        //: 3 'findMany' handles input ranges that are empty, shorter than a
+        //:   group of batched lookups, and spanning several such groups.
+        //:
+        //: 4 'prefetchBucket' does not change the value of the set, including
+        //:   a set that has not yet allocated a bucket array.
+        //:
+        //: 5 None of these methods allocates memory.
+        //
+        // Plan:
+        //: 1 Using an empty set, look up a few keys with 'find(key, hashCode)'
+        //:   and 'findMany', after calling 'prefetchBucket' for each of them,
+        //:   and verify that 'end()' is returned every time.  (C-1..2, 4)
+        //:
+        //: 2 Populate a set with the even integers in '[0, 200)' and, for
+        //:   each integer in '[0, 200)', verify that 'find(key, hashCode)'
+        //:   (both overloads) agrees with 'find(key)'.  (C-1, 4)
+        //:
+        //: 3 For every prefix of the sequence of integers in '[0, 200)', call
+        //:   'findMany' (both overloads) and verify the returned position and
+        //:   each value written against 'find'.  (C-2..3)
+        //:
+        //: 4 Use a test allocator monitor to verify that no memory is
+        //:   allocated by any of the above.  (C-5)
+        //
+        // Testing:
+        //   iterator find(const key_type& key, size_type hashCode);
+        //   OUTPUT_ITERATOR findMany(FWD_ITER first, FWD_ITER last, OUT_ITER);
+        //   const_iterator find(const key_type&, size_type hashCode) const;
+        //   OUTPUT_ITERATOR findMany(FWD_ITER, FWD_ITER, OUT_ITER) const;
+        //   void prefetchBucket(size_type hashCode) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING PRECOMPUTED-HASH AND BATCHED LOOKUP"
+                            "\n===========================================\n");
+
+        typedef bsl::unordered_set<int> Obj;
+
+        enum { k_NUM_KEYS = 200 };
+
+        int keys[k_NUM_KEYS];
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            keys[i] = i;
+        }
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting an empty set.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            for (int i = 0; i < 3; ++i) {
+                const size_t HASH = X.hash_function()(keys[i]);
+
+                X.prefetchBucket(HASH);
+
+                ASSERTV(i,  X.end() ==  X.find(keys[i], HASH));
+                ASSERTV(i, mX.end() == mX.find(keys[i], HASH));
+            }
+
+            Obj::const_iterator results[3];
+            ASSERT(results + 3 == X.findMany(keys, keys + 3, results));
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, X.end() == results[i]);
+            }
+
+            ASSERT(oam.isTotalSame());
+            ASSERT(X.empty());
+        }
+
+        if (verbose) printf("\nTesting a populated set.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < k_NUM_KEYS; i += 2) {
+                mX.insert(keys[i]);
+            }
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                const int    KEY  = keys[i];
+                const size_t HASH = X.hash_function()(KEY);
+
+                X.prefetchBucket(HASH);
+
+                ASSERTV(i, X.find(KEY)  ==  X.find(KEY, HASH));
+                ASSERTV(i, mX.find(KEY) == mX.find(KEY, HASH));
+                ASSERTV(i, (0 == i % 2) == (X.end() != X.find(KEY, HASH)));
+            }
+
+            for (int n = 0; n <= k_NUM_KEYS; ++n) {
+                Obj::const_iterator cResults[k_NUM_KEYS];
+                Obj::iterator       mResults[k_NUM_KEYS];
+
+                ASSERTV(n, cResults + n ==
+                                      X.findMany(keys, keys + n, cResults));
+                ASSERTV(n, mResults + n ==
+                                     mX.findMany(keys, keys + n, mResults));
+
+                for (int j = 0; j < n; ++j) {
+                    ASSERTV(n, j,  X.find(keys[j]) == cResults[j]);
+                    ASSERTV(n, j, mX.find(keys[j]) == mResults[j]);
+                }
+            }
+
+            ASSERT(oam.isTotalSame());
+            ASSERTV(X.size(), k_NUM_KEYS / 2 == X.size());
+        }
+      } break;
       case 33: // falls through
       case 32: // falls through
       case 31: // falls through
@@ -5290,6 +5421,82 @@ if (verbose) {
             printf("Final message to confim the end of the breathing test.\n");
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE OF BATCHED LOOKUP
+        //
+        // Concerns:
+        //: 1 Looking up a sequence of keys in a set much larger than the
+        //:   processor cache with 'findMany' is faster than calling 'find' for
+        //:   each key in turn.
+        //
+        // Plan:
+        //: 1 Populate a set with a large number of integers, then look up a
+        //:   pseudo-random permutation of them, first one 'find' at a time and
+        //:   then with 'findMany', and report the elapsed time of each.  The
+        //:   number of elements can be given as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: findMany vs. find
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE OF BATCHED LOOKUP"
+                            "\n=============================\n");
+
+        typedef bsl::unordered_set<int> Obj;
+
+        const int NUM_KEYS = argc > 2 ? atoi(argv[2]) : 1 << 21;
+
+        bslma::MallocFreeAllocator& ma =
+                                       bslma::MallocFreeAllocator::singleton();
+
+        int *keys = static_cast<int *>(ma.allocate(NUM_KEYS * sizeof(int)));
+        Obj::const_iterator *results = static_cast<Obj::const_iterator *>(
+                       ma.allocate(NUM_KEYS * sizeof(Obj::const_iterator)));
+
+        Obj mX(&ma);  const Obj& X = mX;
+        mX.reserve(NUM_KEYS);
+
+        unsigned int state = 12345;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            keys[i] = i;
+            mX.insert(i);
+        }
+        for (int i = NUM_KEYS - 1; 0 < i; --i) {
+            state = state * 1103515245 + 12345;
+            const int j = static_cast<int>(state % (i + 1));
+            const int t = keys[i];  keys[i] = keys[j];  keys[j] = t;
+        }
+
+        bsls::Stopwatch timer;
+
+        size_t found = 0;
+        timer.start();
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            found += X.end() != X.find(keys[i]);
+        }
+        timer.stop();
+        const double findTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        X.findMany(keys, keys + NUM_KEYS, results);
+        timer.stop();
+        const double findManyTime = timer.elapsedTime();
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            found -= X.end() != results[i];
+        }
+        ASSERTV(found, 0 == found);
+
+        printf("%d keys: find: %gs, findMany: %gs\n",
+               NUM_KEYS,
+               findTime,
+               findManyTime);
+
+        ma.deallocate(results);
+        ma.deallocate(keys);
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
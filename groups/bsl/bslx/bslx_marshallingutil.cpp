@@ -4,7 +4,150 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bslx_marshallingutil_cpp,"$Id$ $CSID$")
 
+#include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(BSLS_PLATFORM_CPU_X86)
+#if defined(__SSSE3__)
+#define BSLX_MARSHALLINGUTIL_USE_SSSE3 1
+#include <tmmintrin.h>
+#endif
+#endif
+
 namespace BloombergLP {
+namespace {
+
+                        // ========================
+                        // local byte-order kernels
+                        // ========================
+
+// The following functions implement the bulk of the full-width array
+// functions ('put/getArrayInt64', 'put/getArrayInt32', 'put/getArrayInt16',
+// 'put/getArrayFloat64', and 'put/getArrayFloat32') for platforms where the
+// native size of the element type matches its externalized size.  Converting
+// between native and network byte order is then a pure byte permutation
+// within each element, so, on little-endian platforms, whole 16-byte blocks
+// are permuted with a single 'pshufb' when SSSE3 is available, and the
+// remaining elements are converted one element at a time using the 'bswap'
+// family of instructions (as exposed by 'bsls::ByteOrderUtil').  On
+// big-endian platforms the conversion is a plain 'memcpy'.  Neither the
+// source nor the destination is required to be aligned.
+
+#if defined(BSLX_MARSHALLINGUTIL_USE_SSSE3)
+inline
+bsl::size_t shuffleBlocks(char          *destination,
+                          const char    *source,
+                          bsl::size_t    numBytes,
+                          const __m128i& mask)
+    // Permute the bytes of each complete 16-byte block in the specified
+    // 'source' having the specified 'numBytes' according to the specified
+    // 'mask' and write the result to the specified 'destination'.  Return the
+    // number of bytes converted (i.e., 'numBytes' rounded down to a multiple
+    // of 16).
+{
+    const bsl::size_t numBlockBytes = numBytes & ~static_cast<bsl::size_t>(15);
+
+    for (bsl::size_t i = 0; i < numBlockBytes; i += 16) {
+        const __m128i block = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(source + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i),
+                         _mm_shuffle_epi8(block, mask));
+    }
+    return numBlockBytes;
+}
+#endif
+
+void byteOrderCopy16(void *destination, const void *source, int numElements)
+    // Copy the specified 'numElements' 2-byte elements from the specified
+    // 'source' to the specified 'destination', converting each element
+    // between native and network byte order.
+{
+    char       *dst      = static_cast<char *>(destination);
+    const char *src      = static_cast<const char *>(source);
+    bsl::size_t numBytes = static_cast<bsl::size_t>(numElements) * 2;
+
+#if BSLS_PLATFORM_IS_LITTLE_ENDIAN
+#if defined(BSLX_MARSHALLINGUTIL_USE_SSSE3)
+    const __m128i     mask = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6,
+                                           9, 8, 11, 10, 13, 12, 15, 14);
+    const bsl::size_t done = shuffleBlocks(dst, src, numBytes, mask);
+    dst      += done;
+    src      += done;
+    numBytes -= done;
+#endif
+    for (bsl::size_t i = 0; i < numBytes; i += 2) {
+        unsigned short value;
+        bsl::memcpy(&value, src + i, 2);
+        value = bsls::ByteOrderUtil::swapBytes16(value);
+        bsl::memcpy(dst + i, &value, 2);
+    }
+#else
+    bsl::memcpy(dst, src, numBytes);
+#endif
+}
+
+void byteOrderCopy32(void *destination, const void *source, int numElements)
+    // Copy the specified 'numElements' 4-byte elements from the specified
+    // 'source' to the specified 'destination', converting each element
+    // between native and network byte order.
+{
+    char       *dst      = static_cast<char *>(destination);
+    const char *src      = static_cast<const char *>(source);
+    bsl::size_t numBytes = static_cast<bsl::size_t>(numElements) * 4;
+
+#if BSLS_PLATFORM_IS_LITTLE_ENDIAN
+#if defined(BSLX_MARSHALLINGUTIL_USE_SSSE3)
+    const __m128i     mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                           11, 10, 9, 8, 15, 14, 13, 12);
+    const bsl::size_t done = shuffleBlocks(dst, src, numBytes, mask);
+    dst      += done;
+    src      += done;
+    numBytes -= done;
+#endif
+    for (bsl::size_t i = 0; i < numBytes; i += 4) {
+        unsigned int value;
+        bsl::memcpy(&value, src + i, 4);
+        value = bsls::ByteOrderUtil::swapBytes32(value);
+        bsl::memcpy(dst + i, &value, 4);
+    }
+#else
+    bsl::memcpy(dst, src, numBytes);
+#endif
+}
+
+void byteOrderCopy64(void *destination, const void *source, int numElements)
+    // Copy the specified 'numElements' 8-byte elements from the specified
+    // 'source' to the specified 'destination', converting each element
+    // between native and network byte order.
+{
+    char       *dst      = static_cast<char *>(destination);
+    const char *src      = static_cast<const char *>(source);
+    bsl::size_t numBytes = static_cast<bsl::size_t>(numElements) * 8;
+
+#if BSLS_PLATFORM_IS_LITTLE_ENDIAN
+#if defined(BSLX_MARSHALLINGUTIL_USE_SSSE3)
+    const __m128i     mask = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0,
+                                           15, 14, 13, 12, 11, 10, 9, 8);
+    const bsl::size_t done = shuffleBlocks(dst, src, numBytes, mask);
+    dst      += done;
+    src      += done;
+    numBytes -= done;
+#endif
+    for (bsl::size_t i = 0; i < numBytes; i += 8) {
+        bsls::Types::Uint64 value;
+        bsl::memcpy(&value, src + i, 8);
+        value = bsls::ByteOrderUtil::swapBytes64(value);
+        bsl::memcpy(dst + i, &value, 8);
+    }
+#else
+    bsl::memcpy(dst, src, numBytes);
+#endif
+}
+
+}  // close unnamed namespace
+
 namespace bslx {
 
                         // ----------------------
@@ -23,6 +166,11 @@ void MarshallingUtil::putArrayInt64(char                     *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT64) {
+        byteOrderCopy64(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const bsls::Types::Int64 *end = values + numValues;
     for (; values != end; ++values) {
         putInt64(buffer, *values);
@@ -38,6 +186,11 @@ void MarshallingUtil::putArrayInt64(char                      *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT64) {
+        byteOrderCopy64(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const bsls::Types::Uint64 *end = values + numValues;
     for (; values != end; ++values) {
         putInt64(buffer, *values);
@@ -143,6 +296,11 @@ void MarshallingUtil::putArrayInt32(char      *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT32) {
+        byteOrderCopy32(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const int *end = values + numValues;
     for (; values != end; ++values) {
         putInt32(buffer, *values);
@@ -158,6 +316,11 @@ void MarshallingUtil::putArrayInt32(char               *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT32) {
+        byteOrderCopy32(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const unsigned int *end = values + numValues;
     for (; values != end; ++values) {
         putInt32(buffer, *values);
@@ -203,6 +366,11 @@ void MarshallingUtil::putArrayInt16(char        *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT16) {
+        byteOrderCopy16(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const short *end = values + numValues;
     for (; values != end; ++values) {
         putInt16(buffer, *values);
@@ -218,6 +386,11 @@ void MarshallingUtil::putArrayInt16(char                 *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT16) {
+        byteOrderCopy16(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const unsigned short *end = values + numValues;
     for (; values != end; ++values) {
         putInt16(buffer, *values);
@@ -235,6 +408,11 @@ void MarshallingUtil::putArrayFloat64(char         *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_FLOAT64) {
+        byteOrderCopy64(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const double *end = values + numValues;
     for (; values < end; ++values) {
         putFloat64(buffer, *values);
@@ -250,6 +428,11 @@ void MarshallingUtil::putArrayFloat32(char        *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_FLOAT32) {
+        byteOrderCopy32(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const float *end = values + numValues;
     for (; values < end; ++values) {
         putFloat32(buffer, *values);
@@ -267,6 +450,11 @@ void MarshallingUtil::getArrayInt64(bsls::Types::Int64 *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT64) {
+        byteOrderCopy64(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const bsls::Types::Int64 *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getInt64(variables, buffer);
@@ -282,6 +470,11 @@ void MarshallingUtil::getArrayUint64(bsls::Types::Uint64 *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT64) {
+        byteOrderCopy64(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const bsls::Types::Uint64 *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getUint64(variables, buffer);
@@ -387,6 +580,11 @@ void MarshallingUtil::getArrayInt32(int        *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT32) {
+        byteOrderCopy32(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const int *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getInt32(variables, buffer);
@@ -402,6 +600,11 @@ void MarshallingUtil::getArrayUint32(unsigned int *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT32) {
+        byteOrderCopy32(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const unsigned int *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getUint32(variables, buffer);
@@ -447,6 +650,11 @@ void MarshallingUtil::getArrayInt16(short      *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT16) {
+        byteOrderCopy16(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const short *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getInt16(variables, buffer);
@@ -462,6 +670,11 @@ void MarshallingUtil::getArrayUint16(unsigned short *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT16) {
+        byteOrderCopy16(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const unsigned short *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getUint16(variables, buffer);
@@ -479,6 +692,11 @@ void MarshallingUtil::getArrayFloat64(double     *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_FLOAT64) {
+        byteOrderCopy64(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const double *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getFloat64(variables, buffer);
@@ -494,6 +712,11 @@ void MarshallingUtil::getArrayFloat32(float      *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_FLOAT32) {
+        byteOrderCopy32(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const float *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getFloat32(variables, buffer);
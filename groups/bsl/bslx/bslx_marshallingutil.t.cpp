@@ -115,7 +115,8 @@ using namespace bslx;
 // [ 2] EXPLORE DOUBLE FORMAT -- make sure format is IEEE-COMPLIANT
 // [ 3] EXPLORE FLOAT FORMAT -- make sure format is IEEE-COMPLIANT
 // [24] STRESS TEST - Used to determine performance characteristics.
-// [25] USAGE EXAMPLE
+// [25] BULK ARRAY BYTE-ORDER CONVERSION
+// [26] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -210,6 +211,73 @@ void reverse(TYPE *array, int numElements)
     }
 }
 
+template <class TYPE>
+static void verifyBulkArray(const char *name,
+                            void (*putArray)(char *, const TYPE *, int),
+                            void (*getArray)(TYPE *, const char *, int))
+    // Verify, for every array length in '[0 .. 70]' and every buffer
+    // misalignment in '[0 .. 7]', that the specified 'putArray' writes each
+    // element of a 'TYPE' array as its native bytes in network byte order,
+    // that the specified 'getArray' restores the original array, and that
+    // neither function writes outside of its destination.  Use the specified
+    // 'name' to identify 'TYPE' in diagnostic output.
+{
+    enum { k_MAX_LENGTH = 70, k_SIZE = sizeof(TYPE), k_GUARD = 8 };
+
+    const char GUARD = static_cast<char>(0xA5);
+
+    for (int len = 0; len <= k_MAX_LENGTH; ++len) {
+        TYPE  values[k_MAX_LENGTH];
+        char *valueBytes = reinterpret_cast<char *>(values);
+        for (int i = 0; i < k_MAX_LENGTH * k_SIZE; ++i) {
+            valueBytes[i] = static_cast<char>(i * 37 + len + 1);
+        }
+
+        for (int off = 0; off < 8; ++off) {
+            char buffer[k_GUARD + k_MAX_LENGTH * k_SIZE + k_GUARD];
+            memset(buffer, GUARD, sizeof buffer);
+
+            putArray(buffer + k_GUARD + off, values, len);
+
+            const char *data = buffer + k_GUARD + off;
+            for (int i = 0; i < len; ++i) {
+                for (int b = 0; b < k_SIZE; ++b) {
+#if BSLS_PLATFORM_IS_LITTLE_ENDIAN
+                    const int nativeIndex = i * k_SIZE + k_SIZE - 1 - b;
+#else
+                    const int nativeIndex = i * k_SIZE + b;
+#endif
+                    LOOP5_ASSERT(name, len, off, i, b,
+                                 valueBytes[nativeIndex] ==
+                                                         data[i * k_SIZE + b]);
+                }
+            }
+            for (int i = 0; i < k_GUARD + off; ++i) {
+                LOOP3_ASSERT(name, len, off, GUARD == buffer[i]);
+            }
+            for (int i = k_GUARD + off + len * k_SIZE;
+                 i < static_cast<int>(sizeof buffer);
+                 ++i) {
+                LOOP3_ASSERT(name, len, off, GUARD == buffer[i]);
+            }
+
+            TYPE  result[k_MAX_LENGTH + 1];
+            char *resultBytes = reinterpret_cast<char *>(result);
+            memset(result, GUARD, sizeof result);
+
+            getArray(result, data, len);
+
+            LOOP3_ASSERT(name, len, off,
+                         0 == memcmp(result, values, len * k_SIZE));
+            for (int i = len * k_SIZE;
+                 i < static_cast<int>(sizeof result);
+                 ++i) {
+                LOOP3_ASSERT(name, len, off, GUARD == resultBytes[i]);
+            }
+        }
+    }
+}
+
 // ============================================================================
 //                      FUNCTIONS TO MANIPULATE DOUBLES
 // ----------------------------------------------------------------------------
@@ -335,7 +403,7 @@ int main(int argc, char *argv[]) {
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 25: {
+      case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -397,6 +465,68 @@ int main(int argc, char *argv[]) {
 //..
 
       } break;
+      case 25: {
+        // --------------------------------------------------------------------
+        // BULK ARRAY BYTE-ORDER CONVERSION
+        //   The full-width array functions convert whole blocks of elements
+        //   at a time rather than delegating to the scalar functions.
+        //
+        // Concerns:
+        //: 1 Each element is written in network byte order for every array
+        //:   length, including lengths that are not a multiple of the block
+        //:   size and lengths smaller than one block.
+        //:
+        //: 2 The externalized buffer is not required to be aligned.
+        //:
+        //: 3 The 'get' functions restore exactly the values written.
+        //:
+        //: 4 No byte outside of the destination range is modified.
+        //
+        // Plan:
+        //: 1 For each full-width element type, for every length in
+        //:   '[0 .. 70]' and every buffer misalignment in '[0 .. 7]',
+        //:   externalize an array of distinct byte patterns into a
+        //:   guard-filled buffer, verify each element against the reversed
+        //:   (on little-endian platforms) native bytes and verify the guard
+        //:   bytes, then unexternalize into a guard-filled array and compare
+        //:   with the original.  (C-1..4)
+        //
+        // Testing:
+        //   BULK ARRAY BYTE-ORDER CONVERSION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK ARRAY BYTE-ORDER CONVERSION" << endl
+                          << "================================" << endl;
+
+        typedef bsls::Types::Int64  Int64;
+        typedef bsls::Types::Uint64 Uint64;
+
+        verifyBulkArray<Int64>("Int64",
+                               &MarshallingUtil::putArrayInt64,
+                               &MarshallingUtil::getArrayInt64);
+        verifyBulkArray<Uint64>("Uint64",
+                                &MarshallingUtil::putArrayInt64,
+                                &MarshallingUtil::getArrayUint64);
+        verifyBulkArray<int>("int",
+                             &MarshallingUtil::putArrayInt32,
+                             &MarshallingUtil::getArrayInt32);
+        verifyBulkArray<unsigned int>("unsigned int",
+                                      &MarshallingUtil::putArrayInt32,
+                                      &MarshallingUtil::getArrayUint32);
+        verifyBulkArray<short>("short",
+                               &MarshallingUtil::putArrayInt16,
+                               &MarshallingUtil::getArrayInt16);
+        verifyBulkArray<unsigned short>("unsigned short",
+                                        &MarshallingUtil::putArrayInt16,
+                                        &MarshallingUtil::getArrayUint16);
+        verifyBulkArray<double>("double",
+                                &MarshallingUtil::putArrayFloat64,
+                                &MarshallingUtil::getArrayFloat64);
+        verifyBulkArray<float>("float",
+                               &MarshallingUtil::putArrayFloat32,
+                               &MarshallingUtil::getArrayFloat32);
+      } break;
       case 24: {
         // --------------------------------------------------------------------
         // STRESS TEST